@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025 Arm Limited.
+ * Copyright (c) 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -572,7 +572,9 @@ private:
 /** Import memory types */
 enum class ImportType
 {
-    Host = AclImportMemoryType::AclHostPtr
+    Host                  = AclImportMemoryType::AclHostPtr,
+    DmaBuf                = AclImportMemoryType::AclDmaBuf,
+    AndroidHardwareBuffer = AclImportMemoryType::AclAndroidHardwareBuffer,
 };
 
 /** Tensor class
@@ -796,6 +798,235 @@ public:
         }
     }
 };
+using GemmDesc = AclGemmDescriptor;
+class Gemm : public Operator
+{
+public:
+    Gemm(Context                &ctx,
+         const TensorDescriptor &a,
+         const TensorDescriptor &b,
+         const TensorDescriptor *c,
+         const TensorDescriptor &d,
+         const GemmDesc         &desc,
+         StatusCode             *status = nullptr)
+    {
+        const AclTensorDescriptor *c_desc = (c != nullptr) ? c->get() : nullptr;
+
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclGemm(&op, ctx.get(), a.get(), b.get(), c_desc, d.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Gemm operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+using MatMulDesc = AclMatMulDescriptor;
+class MatMul : public Operator
+{
+public:
+    MatMul(Context                &ctx,
+           const TensorDescriptor &lhs,
+           const TensorDescriptor &rhs,
+           const TensorDescriptor &dst,
+           const MatMulDesc       &desc,
+           StatusCode             *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclMatMul(&op, ctx.get(), lhs.get(), rhs.get(), dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during MatMul operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+using Conv2dDesc = AclConv2dDescriptor;
+class Conv2d : public Operator
+{
+public:
+    Conv2d(Context                &ctx,
+           const TensorDescriptor &src,
+           const TensorDescriptor &weights,
+           const TensorDescriptor *biases,
+           const TensorDescriptor &dst,
+           const Conv2dDesc       &desc,
+           StatusCode             *status = nullptr)
+    {
+        const AclTensorDescriptor *biases_desc = (biases != nullptr) ? biases->get() : nullptr;
+
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclConv2d(&op, ctx.get(), src.get(), weights.get(), biases_desc,
+                                                                    dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Conv2d operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+using DepthwiseConv2dDesc = AclDepthwiseConv2dDescriptor;
+class DepthwiseConv2d : public Operator
+{
+public:
+    DepthwiseConv2d(Context                   &ctx,
+                    const TensorDescriptor    &src,
+                    const TensorDescriptor    &weights,
+                    const TensorDescriptor    *biases,
+                    const TensorDescriptor    &dst,
+                    const DepthwiseConv2dDesc &desc,
+                    StatusCode                *status = nullptr)
+    {
+        const AclTensorDescriptor *biases_desc = (biases != nullptr) ? biases->get() : nullptr;
+
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclDepthwiseConv2d(&op, ctx.get(), src.get(), weights.get(),
+                                                                             biases_desc, dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during DepthwiseConv2d operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+using Pool2dDesc = AclPool2dDescriptor;
+class Pool2d : public Operator
+{
+public:
+    Pool2d(Context                &ctx,
+           const TensorDescriptor &src,
+           const TensorDescriptor &dst,
+           const Pool2dDesc       &desc,
+           StatusCode             *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclPool2d(&op, ctx.get(), src.get(), dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Pool2d operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+using SoftmaxDesc = AclSoftmaxDescriptor;
+class Softmax : public Operator
+{
+public:
+    Softmax(Context                &ctx,
+            const TensorDescriptor &src,
+            const TensorDescriptor &dst,
+            const SoftmaxDesc      &desc,
+            StatusCode             *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclSoftmax(&op, ctx.get(), src.get(), dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Softmax operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+using ElementwiseDesc = AclElementwiseDescriptor;
+class Elementwise : public Operator
+{
+public:
+    Elementwise(Context                &ctx,
+                const TensorDescriptor &src0,
+                const TensorDescriptor &src1,
+                const TensorDescriptor &dst,
+                const ElementwiseDesc  &desc,
+                StatusCode             *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclElementwise(&op, ctx.get(), src0.get(), src1.get(), dst.get(),
+                                                                         desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Elementwise operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+using QuantizationDesc = AclQuantizationDescriptor;
+class Quantize : public Operator
+{
+public:
+    Quantize(Context                &ctx,
+             const TensorDescriptor &src,
+             const TensorDescriptor &dst,
+             const QuantizationDesc &desc,
+             StatusCode             *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclQuantize(&op, ctx.get(), src.get(), dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Quantize operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+class Dequantize : public Operator
+{
+public:
+    Dequantize(Context                &ctx,
+               const TensorDescriptor &src,
+               const TensorDescriptor &dst,
+               const QuantizationDesc &desc,
+               StatusCode             *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclDequantize(&op, ctx.get(), src.get(), dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Dequantize operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+
+/** Run a list of operators in order on the same queue
+ *
+ * Each operator is paired with the tensor pack at the same position. All the entries are
+ * validated before any operator is submitted.
+ *
+ * @param[in] queue Queue to schedule the operators on
+ * @param[in] ops   Operators to run
+ * @param[in] packs Tensor packs to be used by each operator
+ *
+ * @return Status Code
+ */
+inline StatusCode
+run_operators(Queue &queue, const std::vector<Operator *> &ops, const std::vector<TensorPack *> &packs)
+{
+    if (ops.size() != packs.size())
+    {
+        return StatusCode::InvalidArgument;
+    }
+
+    std::vector<AclOperator>   c_ops(ops.size(), nullptr);
+    std::vector<AclTensorPack> c_packs(packs.size(), nullptr);
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        if (ops[i] == nullptr || packs[i] == nullptr)
+        {
+            return StatusCode::InvalidArgument;
+        }
+        c_ops[i]   = ops[i]->get();
+        c_packs[i] = packs[i]->get();
+    }
+    return detail::as_enum<StatusCode>(AclRunOperators(c_ops.data(), queue.get(), c_packs.data(), ops.size()));
+}
 } // namespace acl
 #undef ARM_COMPUTE_IGNORE_UNUSED
 #endif // ACL_ARM_COMPUTE_ACL_HPP
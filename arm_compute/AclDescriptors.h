@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025 Arm Limited.
+ * Copyright (c) 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,8 @@
  * @publicapi
  */
 
+#include "arm_compute/AclTypes.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif /** __cplusplus */
@@ -60,6 +62,109 @@ typedef struct
     float             b;       /**< Factor &beta used by some activations */
     bool              inplace; /**< Hint that src and dst tensors will be the same */
 } AclActivationDescriptor;
+
+/**< Padding and strides of a 2D window sliding over a tensor */
+typedef struct
+{
+    int32_t stride_x;   /**< Stride along the width */
+    int32_t stride_y;   /**< Stride along the height */
+    int32_t pad_left;   /**< Padding on the left of the width */
+    int32_t pad_right;  /**< Padding on the right of the width */
+    int32_t pad_top;    /**< Padding on the top of the height */
+    int32_t pad_bottom; /**< Padding on the bottom of the height */
+} AclPadStrideDescriptor;
+
+/**< General matrix multiplication descriptor: alpha * A * B + beta * C */
+typedef struct
+{
+    float alpha; /**< Weight of the matrix product */
+    float beta;  /**< Weight of matrix C */
+} AclGemmDescriptor;
+
+/**< Matrix multiplication descriptor */
+typedef struct
+{
+    bool                    adj_lhs; /**< Transpose the left-hand side before the multiplication */
+    bool                    adj_rhs; /**< Transpose the right-hand side before the multiplication */
+    AclActivationDescriptor act;     /**< Fused activation */
+} AclMatMulDescriptor;
+
+/**< 2D convolution descriptor */
+typedef struct
+{
+    AclDataLayout           data_layout;      /**< Data layout of the tensors, NHWC if unknown */
+    AclPadStrideDescriptor  pad_stride;       /**< Padding and strides */
+    int32_t                 dilation_x;       /**< Dilation along the width, 1 if not positive */
+    int32_t                 dilation_y;       /**< Dilation along the height, 1 if not positive */
+    AclActivationDescriptor act;              /**< Fused activation */
+    bool                    enable_fast_math; /**< Allow faster implementations that may reduce the accuracy */
+} AclConv2dDescriptor;
+
+/**< 2D depthwise convolution descriptor */
+typedef struct
+{
+    AclDataLayout           data_layout;      /**< Data layout of the tensors, NHWC if unknown */
+    AclPadStrideDescriptor  pad_stride;       /**< Padding and strides */
+    int32_t                 dilation_x;       /**< Dilation along the width, 1 if not positive */
+    int32_t                 dilation_y;       /**< Dilation along the height, 1 if not positive */
+    int32_t                 depth_multiplier; /**< Multiplier of the source depth giving the destination depth */
+    AclActivationDescriptor act;              /**< Fused activation */
+} AclDepthwiseConv2dDescriptor;
+
+/**< Supported pooling types */
+typedef enum
+{
+    AclPoolingTypeNone = 0, /**< No pooling */
+    AclPoolingMax      = 1, /**< Max pooling */
+    AclPoolingAvg      = 2, /**< Average pooling */
+    AclPoolingL2       = 3, /**< L2 pooling */
+} AclPoolingType;
+
+/**< 2D pooling descriptor */
+typedef struct
+{
+    AclDataLayout          data_layout;     /**< Data layout of the tensors, NHWC if unknown */
+    AclPoolingType         type;            /**< Pooling type */
+    int32_t                pool_width;      /**< Width of the pooling window */
+    int32_t                pool_height;     /**< Height of the pooling window */
+    AclPadStrideDescriptor pad_stride;      /**< Padding and strides */
+    bool                   exclude_padding; /**< Exclude the padding from the average of average pooling */
+    bool                   is_global;       /**< Pool the whole plane, the window, padding and strides are ignored */
+} AclPool2dDescriptor;
+
+/**< Softmax descriptor */
+typedef struct
+{
+    float   beta;   /**< Scaling factor of the exponent */
+    int32_t axis;   /**< Dimension along which the softmax is computed */
+    bool    is_log; /**< Compute the log-softmax */
+} AclSoftmaxDescriptor;
+
+/**< Supported binary elementwise operations */
+typedef enum
+{
+    AclElementwiseNone = 0, /**< No operation */
+    AclElementwiseAdd  = 1, /**< Addition */
+    AclElementwiseSub  = 2, /**< Subtraction */
+    AclElementwiseMul  = 3, /**< Multiplication */
+    AclElementwiseDiv  = 4, /**< Division */
+    AclElementwiseMax  = 5, /**< Maximum */
+    AclElementwiseMin  = 6, /**< Minimum */
+} AclElementwiseOp;
+
+/**< Binary elementwise descriptor */
+typedef struct
+{
+    AclElementwiseOp        op;  /**< Operation */
+    AclActivationDescriptor act; /**< Fused activation, supported by addition, subtraction and multiplication */
+} AclElementwiseDescriptor;
+
+/**< Uniform affine quantization descriptor */
+typedef struct
+{
+    float   scale;  /**< Quantization scale */
+    int32_t offset; /**< Quantization offset */
+} AclQuantizationDescriptor;
 #ifdef __cplusplus
 }
 #endif /** __cplusplus */
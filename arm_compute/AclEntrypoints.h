@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025 Arm Limited.
+ * Copyright (c) 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -83,6 +83,8 @@ AclStatus AclDestroyContext(AclContext ctx);
 AclStatus AclCreateQueue(AclQueue *queue, AclContext ctx, const AclQueueOptions *options);
 
 /** Wait until all elements on the queue have been completed
+ *
+ * Errors raised while executing the enqueued operators are reported here.
  *
  * @param[in] queue Queue to wait on completion
  *
@@ -157,9 +159,12 @@ AclStatus AclUnmapTensor(AclTensor tensor, void *handle);
  * @param[in]      handle Backing memory to be imported
  * @param[in]      type   Type of the imported memory
  *
+ * @note @ref AclDmaBuf and @ref AclAndroidHardwareBuffer are only supported by @ref AclGpuOcl tensors
+ *
  * Returns:
  *  - @ref AclSuccess if function was completed successfully
  *  - @ref AclInvalidArgument if a given argument is invalid
+ *  - @ref AclUnsupportedConfig if the memory type is not supported by the tensor's target or device
  */
 AclStatus AclTensorImport(AclTensor tensor, void *handle, AclImportMemoryType type);
 
@@ -235,6 +240,10 @@ AclStatus AclPackTensors(AclTensorPack pack, AclTensor *tensors, int32_t *slot_i
 AclStatus AclDestroyTensorPack(AclTensorPack pack);
 
 /** Eager execution of a given operator on a list of inputs and outputs
+ *
+ * The operator is enqueued on the given queue and executed in submission order. Execution is asynchronous on both
+ * the CPU and OpenCL targets: the operator and the tensors must remain valid, and the outputs must not be read,
+ * until @ref AclQueueFinish has been called on the queue. The tensor pack itself can be reused right away.
  *
  * @param[in]     op      Operator to execute
  * @param[in]     queue   Queue to schedule the operator on
@@ -251,6 +260,27 @@ AclStatus AclDestroyTensorPack(AclTensorPack pack);
  */
 AclStatus AclRunOperator(AclOperator op, AclQueue queue, AclTensorPack tensors);
 
+/** Eager execution of a list of operators, each on its own list of inputs and outputs
+ *
+ * Equivalent to calling @ref AclRunOperator on each operator in order, with the arguments validated once for the
+ * whole list. Nothing is run if any of the arguments is invalid.
+ *
+ * @param[in]     ops     Operators to execute, in order
+ * @param[in]     queue   Queue to schedule the operators on
+ * @param[in,out] tensors Tensor packs to execute the operators on, one per operator
+ * @param[in]     num_ops Number of operators
+ *
+ * @return Status Code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ *  - @ref AclRuntimeError on any other runtime related error
+ */
+AclStatus AclRunOperators(AclOperator *ops, AclQueue queue, AclTensorPack *tensors, size_t num_ops);
+
 /** Destroy a given operator object
  *
  * @param[in,out] op A valid operator object to destroy
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025 Arm Limited.
+ * Copyright (c) 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -84,6 +84,268 @@ AclStatus AclActivation(AclOperator                  *op,
                         const AclTensorDescriptor    *src,
                         const AclTensorDescriptor    *dst,
                         const AclActivationDescriptor info);
+
+/** Create a general matrix multiplication operator
+ *
+ * Computes alpha * A * B + beta * C. Matrix B, and matrix C if any, are expected to be constant: they are
+ * prepared on the first run.
+ *
+ * Backends:
+ *   - Cpu   : CpuGemm
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      a    Matrix A descriptor. Slot id: ACL_SRC_0
+ * @param[in]      b    Matrix B descriptor. Slot id: ACL_SRC_1
+ * @param[in]      c    Matrix C descriptor, can be nullptr. Slot id: ACL_SRC_2
+ * @param[in]      d    Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info Gemm meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+AclStatus AclGemm(AclOperator               *op,
+                  AclContext                 ctx,
+                  const AclTensorDescriptor *a,
+                  const AclTensorDescriptor *b,
+                  const AclTensorDescriptor *c,
+                  const AclTensorDescriptor *d,
+                  const AclGemmDescriptor    info);
+
+/** Create a matrix multiplication operator
+ *
+ * Multiplies two batched matrices, either of them can be transposed first.
+ *
+ * Backends:
+ *   - Cpu   : CpuMatMul
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      lhs  Left-hand side tensor descriptor. Slot id: ACL_SRC_0
+ * @param[in]      rhs  Right-hand side tensor descriptor. Slot id: ACL_SRC_1
+ * @param[in]      dst  Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info MatMul meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+AclStatus AclMatMul(AclOperator               *op,
+                    AclContext                 ctx,
+                    const AclTensorDescriptor *lhs,
+                    const AclTensorDescriptor *rhs,
+                    const AclTensorDescriptor *dst,
+                    const AclMatMulDescriptor  info);
+
+/** Create a 2D convolution operator
+ *
+ * The convolution method is selected for the given configuration. The weights and biases are expected to be
+ * constant: they are prepared on the first run.
+ *
+ * Backends:
+ *   - Cpu   : CpuConv2d
+ *
+ * @param[in, out] op      Operator construct to be created if creation was successful
+ * @param[in]      ctx     Context to be used for the creation of the operator
+ * @param[in]      src     Source tensor descriptor. Slot id: ACL_SRC_0
+ * @param[in]      weights Weights tensor descriptor. Slot id: ACL_SRC_1
+ * @param[in]      biases  Biases tensor descriptor, can be nullptr. Slot id: ACL_SRC_2
+ * @param[in]      dst     Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info    Convolution meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+AclStatus AclConv2d(AclOperator               *op,
+                    AclContext                 ctx,
+                    const AclTensorDescriptor *src,
+                    const AclTensorDescriptor *weights,
+                    const AclTensorDescriptor *biases,
+                    const AclTensorDescriptor *dst,
+                    const AclConv2dDescriptor  info);
+
+/** Create a 2D depthwise convolution operator
+ *
+ * The weights and biases are expected to be constant: they are prepared on the first run.
+ *
+ * Backends:
+ *   - Cpu   : CpuDepthwiseConv2d
+ *
+ * @param[in, out] op      Operator construct to be created if creation was successful
+ * @param[in]      ctx     Context to be used for the creation of the operator
+ * @param[in]      src     Source tensor descriptor. Slot id: ACL_SRC_0
+ * @param[in]      weights Weights tensor descriptor. Slot id: ACL_SRC_1
+ * @param[in]      biases  Biases tensor descriptor, can be nullptr. Slot id: ACL_SRC_2
+ * @param[in]      dst     Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info    Depthwise convolution meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+AclStatus AclDepthwiseConv2d(AclOperator                       *op,
+                             AclContext                         ctx,
+                             const AclTensorDescriptor         *src,
+                             const AclTensorDescriptor         *weights,
+                             const AclTensorDescriptor         *biases,
+                             const AclTensorDescriptor         *dst,
+                             const AclDepthwiseConv2dDescriptor info);
+
+/** Create a 2D pooling operator
+ *
+ * Max, average and L2 pooling over a window or the whole plane @ref AclPoolingType.
+ *
+ * Backends:
+ *   - Cpu   : CpuPool2d
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      src  Source tensor descriptor. Slot id: ACL_SRC
+ * @param[in]      dst  Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info Pooling meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+AclStatus AclPool2d(AclOperator               *op,
+                    AclContext                 ctx,
+                    const AclTensorDescriptor *src,
+                    const AclTensorDescriptor *dst,
+                    const AclPool2dDescriptor  info);
+
+/** Create a softmax operator
+ *
+ * Computes the softmax, or log-softmax, of the source along a given axis.
+ *
+ * Backends:
+ *   - Cpu   : CpuSoftmaxGeneric
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      src  Source tensor descriptor. Slot id: ACL_SRC
+ * @param[in]      dst  Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info Softmax meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+AclStatus AclSoftmax(AclOperator               *op,
+                     AclContext                 ctx,
+                     const AclTensorDescriptor *src,
+                     const AclTensorDescriptor *dst,
+                     const AclSoftmaxDescriptor info);
+
+/** Create a binary elementwise operator
+ *
+ * Applies an operation @ref AclElementwiseOp on two tensors, broadcasting their dimensions of size 1.
+ *
+ * Backends:
+ *   - Cpu   : CpuAdd, CpuSub, CpuMul, CpuElementwiseDivision, CpuElementwiseMax and CpuElementwiseMin
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      src0 First source tensor descriptor. Slot id: ACL_SRC_0
+ * @param[in]      src1 Second source tensor descriptor. Slot id: ACL_SRC_1
+ * @param[in]      dst  Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info Elementwise meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+AclStatus AclElementwise(AclOperator                   *op,
+                         AclContext                     ctx,
+                         const AclTensorDescriptor     *src0,
+                         const AclTensorDescriptor     *src1,
+                         const AclTensorDescriptor     *dst,
+                         const AclElementwiseDescriptor info);
+
+/** Create a quantization operator
+ *
+ * Quantizes a floating point source. The 8-bit integer data type of the destination selects an asymmetric
+ * quantization: @ref AclUInt8 or @ref AclInt8.
+ *
+ * Backends:
+ *   - Cpu   : CpuQuantize
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      src  Source tensor descriptor. Slot id: ACL_SRC
+ * @param[in]      dst  Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info Quantization of the destination
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+AclStatus AclQuantize(AclOperator                    *op,
+                      AclContext                      ctx,
+                      const AclTensorDescriptor      *src,
+                      const AclTensorDescriptor      *dst,
+                      const AclQuantizationDescriptor info);
+
+/** Create a dequantization operator
+ *
+ * Dequantizes an asymmetric 8-bit source, @ref AclUInt8 or @ref AclInt8, to floating point.
+ *
+ * Backends:
+ *   - Cpu   : CpuDequantize
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      src  Source tensor descriptor. Slot id: ACL_SRC
+ * @param[in]      dst  Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info Quantization of the source
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+AclStatus AclDequantize(AclOperator                    *op,
+                        AclContext                      ctx,
+                        const AclTensorDescriptor      *src,
+                        const AclTensorDescriptor      *dst,
+                        const AclQuantizationDescriptor info);
 #ifdef __cplusplus
 }
 #endif /** __cplusplus */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025 Arm Limited.
+ * Copyright (c) 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -188,7 +188,9 @@ typedef enum AclDataLayout
 /** Type of memory to be imported */
 typedef enum AclImportMemoryType
 {
-    AclHostPtr = 0 /**< Host allocated memory */
+    AclHostPtr               = 0, /**< Host allocated memory */
+    AclDmaBuf                = 1, /**< dma-buf memory, the handle points to the file descriptor */
+    AclAndroidHardwareBuffer = 2, /**< Android hardware buffer, the handle is the AHardwareBuffer pointer */
 } AclImportMemoryType;
 
 /**< Tensor Descriptor */
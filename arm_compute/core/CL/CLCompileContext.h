@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, 2025 Arm Limited.
+ * Copyright (c) 2020-2022, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,10 +31,15 @@
 #include "arm_compute/core/CL/CLDevice.h"
 #include "arm_compute/core/CL/OpenCL.h"
 
+#include "support/Mutex.h"
+
+#include <future>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -244,6 +249,9 @@ public:
     void set_device(cl::Device device);
 
     /** Creates an OpenCL kernel.
+     *
+     * It is safe to call this function from several threads. Different programs are built in parallel, while a program
+     * that is already being built by another thread is waited for rather than built twice.
      *
      * @param[in] kernel_name       Kernel name.
      * @param[in] program_name      Program name.
@@ -265,6 +273,28 @@ public:
      */
     void clear_programs_cache();
 
+    /** Sets the directory of the persistent cache of program binaries
+     *
+     * Programs built from source are looked up in the directory before being compiled, using a key made of the device,
+     * the driver version, the build options and the program source. Binaries of newly compiled programs are written
+     * to the directory asynchronously.
+     *
+     * @note The directory defaults to the content of ARM_COMPUTE_CL_PROGRAM_CACHE_DIR, if set.
+     * @note The directory must exist. Failures to read or write the cache are not errors and fall back to compiling.
+     *
+     * @param[in] directory Directory of the cache, or an empty string to disable the cache
+     */
+    void set_program_cache_directory(const std::string &directory);
+
+    /** Gets the directory of the persistent cache of program binaries
+     *
+     * @return The directory of the cache, empty if the cache is disabled
+     */
+    const std::string &program_cache_directory() const;
+
+    /** Waits for the program binaries being written to the persistent cache */
+    void wait_for_program_cache() const;
+
     /** Access the cache of built OpenCL programs */
     const std::map<std::string, cl::Program> &get_built_programs() const;
 
@@ -352,11 +382,30 @@ private:
      */
     std::string stringify_set(const StringSet &s, const std::string &kernel_path) const;
 
+    /** Builds a program, going through the persistent cache of program binaries if enabled
+     *
+     * @param[in] program        Program to build.
+     * @param[in] program_source Source of the program.
+     * @param[in] is_binary      Flag to indicate if the program source is binary.
+     * @param[in] build_options  Build options.
+     *
+     * @return The built program.
+     */
+    cl::Program build_program(const Program     &program,
+                              const std::string &program_source,
+                              bool               is_binary,
+                              const std::string &build_options) const;
+
     cl::Context                                  _context;            /**< Underlying CL context. */
     CLDevice                                     _device;             /**< Underlying CL device. */
     mutable std::map<std::string, const Program> _programs_map;       /**< Map with all already loaded program data. */
     mutable std::map<std::string, cl::Program>   _built_programs_map; /**< Map with all already built program data. */
     bool _is_wbsm_supported; /**< Support of worksize batch size modifier support boolean*/
+    std::string _program_cache_dir; /**< Directory of the persistent cache of program binaries */
+    mutable std::vector<std::shared_future<void>> _program_cache_writes; /**< Pending writes to the persistent cache */
+    mutable std::map<std::string, std::shared_future<cl::Program>>
+        _programs_in_flight; /**< Programs being built, indexed by built program name */
+    std::unique_ptr<arm_compute::Mutex> _programs_mtx; /**< Protects the program maps and the pending cache writes */
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_CORE_CL_CLCOMPILECONTEXT_H
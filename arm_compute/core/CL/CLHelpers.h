@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -128,6 +128,16 @@ CLVersion get_cl_version(const cl::Device &device);
  */
 size_t get_cl_image_pitch_alignment(const cl::Device &device);
 
+/** Helper function to get the alignment in bytes of the origin of the sub-buffers of a buffer
+ *
+ * The alignment also covers the base address of the images created from the sub-buffers, if supported.
+ *
+ * @param[in] device A CL device
+ *
+ * @return the sub-buffer origin alignment in bytes. If an error occurs, the function will return 0
+ */
+size_t get_cl_sub_buffer_alignment(const cl::Device &device);
+
 /** Helper function to check whether non-uniform work group is supported
  *
  * @param[in] device A CL device
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2025 Arm Limited.
+ * Copyright (c) 2016-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -134,6 +134,17 @@ public:
      */
     void add_built_program(const std::string &built_program_name, const cl::Program &program);
 
+    /** Sets the directory of the persistent cache of program binaries
+     *
+     * @note See @ref CLCompileContext::set_program_cache_directory
+     *
+     * @param[in] directory Directory of the cache, or an empty string to disable the cache
+     */
+    void set_program_cache_directory(const std::string &directory);
+
+    /** Waits for the program binaries being written to the persistent cache */
+    void wait_for_program_cache() const;
+
     /** Returns true if FP16 is supported by the CL device
      *
      * @return true if the CL device supports FP16
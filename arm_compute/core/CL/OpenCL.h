@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -105,6 +105,7 @@ public:
     DECLARE_FUNCTION_PTR(clReleaseKernel);
     DECLARE_FUNCTION_PTR(clCreateProgramWithSource);
     DECLARE_FUNCTION_PTR(clCreateBuffer);
+    DECLARE_FUNCTION_PTR(clCreateSubBuffer);
     DECLARE_FUNCTION_PTR(clRetainKernel);
     DECLARE_FUNCTION_PTR(clCreateKernel);
     DECLARE_FUNCTION_PTR(clGetProgramInfo);
@@ -141,6 +142,9 @@ public:
     DECLARE_FUNCTION_PTR(clEnqueueSVMUnmap);
     DECLARE_FUNCTION_PTR(clEnqueueMarker);
     DECLARE_FUNCTION_PTR(clWaitForEvents);
+    DECLARE_FUNCTION_PTR(clEnqueueMarkerWithWaitList);
+    DECLARE_FUNCTION_PTR(clEnqueueBarrierWithWaitList);
+    DECLARE_FUNCTION_PTR(clGetEventInfo);
     DECLARE_FUNCTION_PTR(clCreateImage);
     DECLARE_FUNCTION_PTR(clSetKernelExecInfo);
     DECLARE_FUNCTION_PTR(clGetExtensionFunctionAddressForPlatform);
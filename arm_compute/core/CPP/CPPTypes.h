@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -103,6 +103,16 @@ public:
      * @return true if the cpu supports bf16, false otherwise
      */
     bool has_svebf16() const;
+    /** Checks if the cpu model supports the FP8 E4M3 and E5M2 conversions.
+     *
+     * @return true if the cpu supports fp8, false otherwise
+     */
+    bool has_fp8() const;
+    /** Checks if the cpu model supports the FP8 4-way dot product.
+     *
+     * @return true if the cpu supports the fp8 dot product, false otherwise
+     */
+    bool has_fp8dot4() const;
     /** Checks if the cpu model supports dot product.
      *
      * @return true if the cpu supports dot product, false otherwise
@@ -186,6 +196,18 @@ public:
      * @return Number of CPUs excluding little
      */
     unsigned int get_cpu_num_excluding_little() const;
+    /** Return the NUMA node of a given cpu
+     *
+     * @param[in] cpuid The id of the cpu core
+     *
+     * @return The NUMA node of the core, 0 when the topology of the system is unknown
+     */
+    unsigned int get_cpu_numa_node(unsigned int cpuid) const;
+    /** Return the number of NUMA nodes of the system
+     *
+     * @return Number of NUMA nodes, 1 when the topology of the system is unknown
+     */
+    unsigned int get_num_numa_nodes() const;
     /** Return the vector length in bytes for sme2
      *
      * @return Vector length if sme2 is enabled, otherwise returns 0.
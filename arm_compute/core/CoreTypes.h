@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -105,6 +105,8 @@ enum class DataType
     F16,                /**< 16-bit floating-point number */
     F32,                /**< 32-bit floating-point number */
     F64,                /**< 64-bit floating-point number */
+    FP8_E4M3,           /**< 8-bit floating-point number with 4 exponent and 3 mantissa bits, without infinities */
+    FP8_E5M2,           /**< 8-bit floating-point number with 5 exponent and 2 mantissa bits */
     SIZET               /**< size_t */
 };
 
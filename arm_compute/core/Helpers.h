@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -137,6 +137,20 @@ private:
 template <typename L, typename... Ts>
 inline void execute_window_loop(const Window &w, L &&lambda_function, Ts &&...iterators);
 
+/** Iterate through the first @p num_dims dimensions of the passed window like @ref execute_window_loop
+ *
+ * Only the loops and the iterator updates of the first @p num_dims dimensions are generated, which removes the
+ * overhead of the others from each row. The dimensions from @p num_dims must have a single step, for example once
+ * they have been collapsed into the dimension @p num_dims - 1 by Window::collapse().
+ *
+ * @param[in]     w               Window to iterate through.
+ * @param[in]     lambda_function The function of type void(function)( const Coordinates & id ) to call at each iteration.
+ *                                Where id represents the absolute coordinates of the item to process.
+ * @param[in,out] iterators       Tensor iterators which will be updated by this function before calling lambda_function.
+ */
+template <size_t num_dims, typename L, typename... Ts>
+inline void execute_window_loop_dims(const Window &w, L &&lambda_function, Ts &&...iterators);
+
 /** Permutes given Dimensions according to a permutation vector
  *
  * @warning Validity of permutation is not checked
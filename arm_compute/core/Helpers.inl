@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -81,16 +81,33 @@ struct ForEachDimension<0>
 template <typename L, typename... Ts>
 inline void execute_window_loop(const Window &w, L &&lambda_function, Ts &&...iterators)
 {
+    execute_window_loop_dims<Coordinates::num_max_dimensions>(w, std::forward<L>(lambda_function),
+                                                              std::forward<Ts>(iterators)...);
+}
+
+template <size_t num_dims, typename L, typename... Ts>
+inline void execute_window_loop_dims(const Window &w, L &&lambda_function, Ts &&...iterators)
+{
+    static_assert(num_dims > 0 && num_dims <= Coordinates::num_max_dimensions, "Invalid number of dimensions");
+
     w.validate();
 
+    Coordinates id;
     for (unsigned int i = 0; i < Coordinates::num_max_dimensions; ++i)
     {
         ARM_COMPUTE_ERROR_ON(w[i].step() == 0);
+        if (i >= num_dims)
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(w[i].end() - w[i].start() > w[i].step(), "Dimension not iterated over");
+            if (w[i].start() >= w[i].end())
+            {
+                return;
+            }
+            id.set(i, w[i].start());
+        }
     }
 
-    Coordinates id;
-    ForEachDimension<Coordinates::num_max_dimensions>::unroll(w, id, std::forward<L>(lambda_function),
-                                                              std::forward<Ts>(iterators)...);
+    ForEachDimension<num_dims>::unroll(w, id, std::forward<L>(lambda_function), std::forward<Ts>(iterators)...);
 }
 
 inline constexpr Iterator::Iterator() : _ptr(nullptr), _dims()
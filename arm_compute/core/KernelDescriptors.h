@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, 2025 Arm Limited.
+ * Copyright (c) 2019-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -241,9 +241,20 @@ struct ScaleKernelInfo
 struct MatMulKernelInfo
 {
     MatMulKernelInfo() = default;
-    MatMulKernelInfo(
-        bool adj_lhs, bool adj_rhs, int m0 = 1, int n0 = 1, int k0 = 1, bool export_rhs_to_cl_image = false)
-        : adj_lhs{adj_lhs}, adj_rhs{adj_rhs}, m0{m0}, n0{n0}, k0{k0}, export_rhs_to_cl_image{export_rhs_to_cl_image}
+    MatMulKernelInfo(bool adj_lhs,
+                     bool adj_rhs,
+                     int  m0                     = 1,
+                     int  n0                     = 1,
+                     int  k0                     = 1,
+                     bool export_rhs_to_cl_image = false,
+                     bool export_lhs_to_cl_image = false)
+        : adj_lhs{adj_lhs},
+          adj_rhs{adj_rhs},
+          m0{m0},
+          n0{n0},
+          k0{k0},
+          export_rhs_to_cl_image{export_rhs_to_cl_image},
+          export_lhs_to_cl_image{export_lhs_to_cl_image}
     {
     }
     bool adj_lhs{false};                /**< Get Adjoint LHS flag value */
@@ -252,6 +263,7 @@ struct MatMulKernelInfo
     int  n0{1};                         /**< Number of output columns processed by each work-item*/
     int  k0{1};                         /**< Number of inner accumulations */
     bool export_rhs_to_cl_image{false}; /**< Flag to know whether the RHS tensor should be exported to cl_image*/
+    bool export_lhs_to_cl_image{false}; /**< Flag to know whether the LHS tensor should be exported to cl_image*/
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_CORE_KERNELDESCRIPTORS_H
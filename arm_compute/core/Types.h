@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1681,7 +1681,8 @@ public:
           _kernel_height(0),
           _num_kernels(0),
           _retain_internal_weights(false),
-          _weight_format(arm_compute::WeightFormat::UNSPECIFIED)
+          _weight_format(arm_compute::WeightFormat::UNSPECIFIED),
+          _sparse_weights(false)
     {
     }
     /** Constructor
@@ -1704,7 +1705,8 @@ public:
           _kernel_height(kernel_height),
           _num_kernels(num_kernels),
           _retain_internal_weights(retain_internal_weights),
-          _weight_format(weight_format)
+          _weight_format(weight_format),
+          _sparse_weights(false)
     {
     }
     /** Flag which specifies if the weights tensor has been reshaped.
@@ -1752,6 +1754,22 @@ public:
     {
         return _kernel_height;
     }
+    /** Flag which specifies if the weights are 2:4 structured-sparse along the input channels
+     *
+     * @return True if at most two values out of every four consecutive input channels are non-zero
+     */
+    bool sparse_weights() const
+    {
+        return _sparse_weights;
+    }
+    /** Set the sparse weights flag
+     *
+     * @param[in] sparse_weights True if the weights are 2:4 structured-sparse along the input channels
+     */
+    void set_sparse_weights(bool sparse_weights)
+    {
+        _sparse_weights = sparse_weights;
+    }
 
 private:
     bool                      _are_reshaped;
@@ -1760,6 +1778,7 @@ private:
     unsigned int              _num_kernels;
     bool                      _retain_internal_weights;
     arm_compute::WeightFormat _weight_format;
+    bool                      _sparse_weights;
 };
 
 /** GEMM reshape information class. This class stores the necessary information about matrix A and matrix B reshape.
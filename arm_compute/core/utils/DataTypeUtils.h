@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,8 @@ inline size_t data_size_from_type(DataType data_type)
         case DataType::QASYMM8:
         case DataType::QASYMM8_SIGNED:
         case DataType::QSYMM8_PER_CHANNEL:
+        case DataType::FP8_E4M3:
+        case DataType::FP8_E5M2:
             return 1;
         case DataType::U16:
         case DataType::S16:
@@ -118,6 +120,8 @@ inline size_t element_size_from_data_type(DataType dt)
         case DataType::QASYMM8:
         case DataType::QASYMM8_SIGNED:
         case DataType::QSYMM8_PER_CHANNEL:
+        case DataType::FP8_E4M3:
+        case DataType::FP8_E5M2:
             return 1;
         case DataType::U16:
         case DataType::S16:
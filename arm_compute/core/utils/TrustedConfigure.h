@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_CORE_UTILS_TRUSTEDCONFIGURE_H
+#define ACL_ARM_COMPUTE_CORE_UTILS_TRUSTEDCONFIGURE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Error.h"
+
+namespace arm_compute
+{
+/** Scope during which the operators configured by the calling thread trust their arguments to be valid
+ *
+ * The functions open it once their arguments have been validated, so that the operators they are made of skip
+ * validating again the arguments derived from them. Scopes can be nested, the previous state is restored on exit.
+ *
+ * @note Validations which are not repeated (e.g. of the arguments only known to a nested operator) must not be
+ *       skipped, only the ones already covered by the validation of the caller.
+ */
+class TrustedConfigureScope
+{
+public:
+    /** Constructor
+     *
+     * @param[in] trusted (Optional) Whether the configurations in the scope are trusted. Defaults to true.
+     */
+    explicit TrustedConfigureScope(bool trusted = true);
+    /** Restore the state of the calling thread before the scope */
+    ~TrustedConfigureScope();
+    /** Prevent instances of this class from being copied */
+    TrustedConfigureScope(const TrustedConfigureScope &) = delete;
+    /** Prevent instances of this class from being copied */
+    TrustedConfigureScope &operator=(const TrustedConfigureScope &) = delete;
+
+private:
+    bool _previous;
+};
+
+/** Whether the configurations made by the calling thread are trusted
+ *
+ * @return True if a @ref TrustedConfigureScope is open on the calling thread
+ */
+bool is_configure_trusted();
+} // namespace arm_compute
+
+#ifdef ARM_COMPUTE_ASSERTS_ENABLED
+/** Checks if a status value is valid if not throws an exception with the error, unless the configuration is trusted
+ *
+ * The status expression is not evaluated inside a @ref arm_compute::TrustedConfigureScope.
+ *
+ * @param[in] status Status value to check.
+ */
+#define ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(status) \
+    do                                               \
+    {                                                \
+        if (!arm_compute::is_configure_trusted())    \
+        {                                            \
+            ARM_COMPUTE_ERROR_THROW_ON(status);      \
+        }                                            \
+    } while (false)
+#else /* ARM_COMPUTE_ASSERTS_ENABLED */
+#define ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(status)
+#endif /* ARM_COMPUTE_ASSERTS_ENABLED */
+
+#endif // ACL_ARM_COMPUTE_CORE_UTILS_TRUSTEDCONFIGURE_H
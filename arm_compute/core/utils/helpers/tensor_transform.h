@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -132,6 +132,34 @@ TensorShape compute_strided_slice_output_shape(TensorShape input_shape,
                                                int32_t     shrink_axis_mask  = 0,
                                                bool        return_unshrinked = false);
 
+/** Checks if a strided slice only selects a block of its input
+ *
+ * This is the case when the slice reads a contiguous range of each dimension, i.e. all its strides are 1, and only
+ * shrinks its outermost dimensions. Its output is then the @ref SubTensor of the input starting at @p view_coords, which
+ * can be used instead of copying the elements.
+ *
+ * @param[in]  input_shape      Input tensor shape
+ * @param[in]  starts           Start coordinates
+ * @param[in]  ends             End coordinates
+ * @param[in]  strides          Slice strides
+ * @param[in]  begin_mask       If the ith bit of begin_mask is set, starts[i] is ignored and
+ *                              the fullest possible range in that dimension is used instead.
+ * @param[in]  end_mask         If the ith bit of end_mask is set, end[i] is ignored and
+ *                              the fullest possible range in that dimension is used instead.
+ * @param[in]  shrink_axis_mask If the ith bit of shrink_axis_mask is set, it implies that the ith specification shrinks the dimensionality by 1.
+ * @param[out] view_coords      Coordinates of the first element of the slice in the input, set if the slice is a view
+ *
+ * @return True if the output of the slice is a view of its input
+ */
+bool is_strided_slice_view(TensorShape  input_shape,
+                           Coordinates  starts,
+                           Coordinates  ends,
+                           Coordinates  strides,
+                           int32_t      begin_mask,
+                           int32_t      end_mask,
+                           int32_t      shrink_axis_mask,
+                           Coordinates &view_coords);
+
 /** Constructs end mask in case we want to perform a slice operation using the strided slice interface
  *
  * @note Ends are inclusive in slice operations that is why construction an end mask is needed
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/helpers/tensor_transform.h"
 #include "arm_compute/function_info/ConvolutionInfo.h"
+#include "arm_compute/function_info/CopyProgramInfo.h"
 #include "arm_compute/runtime/FunctionDescriptors.h"
 
 #include <cmath>
@@ -127,6 +128,30 @@ inline TensorShape compute_permutation_output_shape(const ITensorInfo &input, co
     return output_shape;
 }
 
+/** Calculate the output shape of a copy program
+ *
+ * @param[in] input_shape Input shape of the program
+ * @param[in] program     Data movements of the program, in order
+ *
+ * @return the calculated shape
+ */
+inline TensorShape compute_copy_program_shape(const TensorShape &input_shape, const CopyProgramInfo &program)
+{
+    TensorShape output_shape = input_shape;
+    for (const auto &stage : program)
+    {
+        if (stage.type == CopyProgramStageType::PERMUTE)
+        {
+            permute(output_shape, stage.perm);
+        }
+        else
+        {
+            output_shape = stage.shape;
+        }
+    }
+    return output_shape;
+}
+
 /** Calculate the output shape of the reorg layer given a stride
  *
  * @param[in] input  Input tensor info
@@ -345,6 +370,75 @@ inline TensorShape compute_transpose1xW_with_element_size_shape(const ITensorInf
     return shape_transposed1xW_b;
 }
 
+/** Calculate the shape of the non-zero values of a 2:4 structured-sparse matrix B
+ *
+ * @param[in] b          Input tensor info
+ * @param[in] transposed (Optional) True if @p b is stored transposed, i.e. with K along its first dimension
+ *
+ * @return the calculated shape
+ */
+inline TensorShape compute_sparse_rhs_values_shape(const ITensorInfo &b, bool transposed = false)
+{
+    // The columns are compressed in blocks of 4, each group of 4 rows keeps 2 values per column:
+    // [ ceil(b_height / 4) * 8, ceil(b_width / 4) ]
+    const size_t n = transposed ? b.dimension(1) : b.dimension(0);
+    const size_t k = transposed ? b.dimension(0) : b.dimension(1);
+    return TensorShape(DIV_CEIL(k, 4) * 8, DIV_CEIL(n, 4));
+}
+
+/** Calculate the shape of the metadata of a 2:4 structured-sparse matrix B
+ *
+ * @param[in] b          Input tensor info
+ * @param[in] transposed (Optional) True if @p b is stored transposed, i.e. with K along its first dimension
+ *
+ * @return the calculated shape
+ */
+inline TensorShape compute_sparse_rhs_metadata_shape(const ITensorInfo &b, bool transposed = false)
+{
+    // One byte per kept value of a group of 4 rows, holding the 2-bit row index of each column of the block:
+    // [ ceil(b_height / 4) * 2, ceil(b_width / 4) ]
+    const size_t n = transposed ? b.dimension(1) : b.dimension(0);
+    const size_t k = transposed ? b.dimension(0) : b.dimension(1);
+    return TensorShape(DIV_CEIL(k, 4) * 2, DIV_CEIL(n, 4));
+}
+
+/** Calculate the shape of the values of a block-sparse matrix B, sized for the case where every block is kept
+ *
+ * @param[in] b Input tensor info
+ *
+ * @return the calculated shape
+ */
+inline TensorShape compute_block_sparse_rhs_values_shape(const ITensorInfo &b)
+{
+    // Each column is split in blocks of 4 rows: [ ceil(b_height / 4) * 4 * b_width ]
+    return TensorShape(DIV_CEIL(b.dimension(1), 4) * 4 * b.dimension(0));
+}
+
+/** Calculate the shape of the block indices of a block-sparse matrix B, sized for the case where every block is kept
+ *
+ * @param[in] b Input tensor info
+ *
+ * @return the calculated shape
+ */
+inline TensorShape compute_block_sparse_rhs_columns_shape(const ITensorInfo &b)
+{
+    // One index per block: [ ceil(b_height / 4) * b_width ]
+    return TensorShape(DIV_CEIL(b.dimension(1), 4) * b.dimension(0));
+}
+
+/** Calculate the shape of the offsets of a block-sparse matrix B
+ *
+ * @param[in] b          Input tensor info
+ * @param[in] num_chunks Number of chunks the columns of @p b are split into
+ *
+ * @return the calculated shape
+ */
+inline TensorShape compute_block_sparse_rhs_offsets_shape(const ITensorInfo &b, unsigned int num_chunks)
+{
+    // The offset of each column and of each chunk, each followed by the end offset: [ b_width + num_chunks + 2 ]
+    return TensorShape(b.dimension(0) + num_chunks + 2);
+}
+
 /** Calculate the reductionA shape used in GEMMLowp
  *
  * @param[in] b Input tensor info
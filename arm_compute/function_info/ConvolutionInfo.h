@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,8 +40,13 @@ struct ConvolutionInfo
     ConvolutionInfo(const PadStrideInfo       &pad_stride_info,
                     unsigned int               depth_multiplier,
                     const ActivationLayerInfo &act_info,
-                    const Size2D              &dilation)
-        : pad_stride_info(pad_stride_info), depth_multiplier(depth_multiplier), act_info(act_info), dilation(dilation)
+                    const Size2D              &dilation,
+                    bool                       enable_fast_math = false)
+        : pad_stride_info(pad_stride_info),
+          depth_multiplier(depth_multiplier),
+          act_info(act_info),
+          dilation(dilation),
+          enable_fast_math(enable_fast_math)
     {
     }
     PadStrideInfo pad_stride_info{}; /**< Convolution info (Pads, strides,...) */
@@ -49,6 +54,7 @@ struct ConvolutionInfo
         1}; /**< Multiplier to apply to input's depth to retrieve the output depth. Defaults to 1 */
     ActivationLayerInfo act_info{};             /**< Fused activation to apply after convolution. */
     Size2D              dilation{Size2D(1, 1)}; /**< Dilation, in elements, across x and y. Defaults to (1, 1). */
+    bool enable_fast_math{false}; /**< Allow F32 convolutions to compute in BF16 where supported. Defaults to false. */
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_FUNCTION_INFO_CONVOLUTIONINFO_H
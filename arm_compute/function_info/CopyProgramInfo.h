@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_COPYPROGRAMINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_COPYPROGRAMINFO_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+/** Data movements of a copy program */
+enum class CopyProgramStageType
+{
+    RESHAPE, /**< Reinterpret the elements, in linear order, with a new shape */
+    PERMUTE, /**< Permute the dimensions */
+    SLICE    /**< Extract a strided slice */
+};
+
+/** Data movement applied by a copy program to the output of the previous stage */
+struct CopyProgramStage
+{
+    /** Constructor of a reshape
+     *
+     * @param[in] shape Output shape, with the total size of the input of the stage
+     */
+    CopyProgramStage(const TensorShape &shape) : type(CopyProgramStageType::RESHAPE), shape(shape)
+    {
+    }
+    /** Constructor of a permutation
+     *
+     * @param[in] perm Permutation vector: dimension i of the output is dimension perm[i] of the input
+     */
+    CopyProgramStage(const PermutationVector &perm) : type(CopyProgramStageType::PERMUTE), perm(perm)
+    {
+    }
+    /** Constructor of a slice
+     *
+     * @param[in] starts  Absolute start coordinates of the slice in the input of the stage
+     * @param[in] strides Strides of the slice, greater than 0
+     * @param[in] shape   Output shape
+     */
+    CopyProgramStage(const Coordinates &starts, const BiStrides &strides, const TensorShape &shape)
+        : type(CopyProgramStageType::SLICE), shape(shape), starts(starts), strides(strides)
+    {
+    }
+
+    CopyProgramStageType type;      /**< Data movement to apply */
+    TensorShape          shape{};   /**< Output shape of reshape and slice stages */
+    PermutationVector    perm{};    /**< Permutation vector of permute stages */
+    Coordinates          starts{};  /**< Start coordinates of slice stages */
+    BiStrides            strides{}; /**< Strides of slice stages */
+};
+
+/** Sequence of data movements performed by a copy program, in order */
+using CopyProgramInfo = std::vector<CopyProgramStage>;
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_COPYPROGRAMINFO_H
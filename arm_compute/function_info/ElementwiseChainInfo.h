@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISECHAININFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISECHAININFO_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+/** Operations of an elementwise chain */
+enum class ElementwiseChainOpType
+{
+    ADD,          /**< value + operand */
+    SUB,          /**< value - operand */
+    MUL,          /**< value * operand */
+    DIV,          /**< value / operand */
+    MIN,          /**< min(value, operand) */
+    MAX,          /**< max(value, operand) */
+    SQUARED_DIFF, /**< (value - operand)^2 */
+    EXP,          /**< exp(value) */
+    NEG,          /**< -value */
+    ABS,          /**< |value| */
+    RSQRT,        /**< 1 / sqrt(value) */
+    ACTIVATION    /**< Activation function applied to value */
+};
+
+/** Operation applied to the running value of an elementwise chain */
+struct ElementwiseChainOp
+{
+    /** Constructor of a unary operation
+     *
+     * @param[in] type Operation to apply, must not be a binary operation nor an activation
+     */
+    ElementwiseChainOp(ElementwiseChainOpType type) : type(type)
+    {
+    }
+    /** Constructor of a binary operation
+     *
+     * @param[in] type     Operation to apply, must be a binary operation
+     * @param[in] operand  Index of the operand tensor, in the list of operands given with the chain
+     * @param[in] reversed (Optional) Compute operand op value instead of value op operand
+     */
+    ElementwiseChainOp(ElementwiseChainOpType type, unsigned int operand, bool reversed = false)
+        : type(type), operand(operand), reversed(reversed)
+    {
+    }
+    /** Constructor of an activation
+     *
+     * @param[in] act_info Activation to apply
+     */
+    ElementwiseChainOp(const ActivationLayerInfo &act_info)
+        : type(ElementwiseChainOpType::ACTIVATION), act_info(act_info)
+    {
+    }
+
+    ElementwiseChainOpType type;            /**< Operation to apply */
+    unsigned int           operand{0};      /**< Index of the operand tensor of binary operations */
+    bool                   reversed{false}; /**< Whether the operand is the first argument of binary operations */
+    ActivationLayerInfo    act_info{};      /**< Activation information of activation operations */
+};
+
+/** Sequence of operations evaluated by an elementwise chain, in order */
+using ElementwiseChainInfo = std::vector<ElementwiseChainOp>;
+
+/** Checks whether an elementwise chain operation takes an operand tensor
+ *
+ * @param[in] type Operation type
+ *
+ * @return True if the operation is binary
+ */
+inline bool is_binary_elementwise_chain_op(ElementwiseChainOpType type)
+{
+    return type <= ElementwiseChainOpType::SQUARED_DIFF;
+}
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_ELEMENTWISECHAININFO_H
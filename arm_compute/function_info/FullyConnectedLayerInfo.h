@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -44,6 +44,8 @@ struct FullyConnectedLayerInfo
     bool       are_weights_reshaped{false};              /**<  @deprecated Reshape the weights tensor if false. */
     bool       retain_internal_weights{false};           /**<  Retain internal reshaped weights. */
     bool       enable_fast_math{false};                  /**<  Enable fast math computation. */
+    bool       sparse_weights{false};                    /**<  Weights are 2:4 structured-sparse. */
+    bool       block_sparse_weights{false};              /**<  Weights are pruned, skip their zero 1x4 blocks. */
     /* Other parameters */
     bool fp_mixed_precision{false}; /**<  Use wider accumulators (32 bit instead of 16 for FP16) to improve accuracy. */
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -106,7 +106,8 @@ public:
           _fixed_format(false),
           _weight_format(arm_compute::WeightFormat::UNSPECIFIED),
           _accumulate(false),
-          _use_fp32_acc(false)
+          _use_fp32_acc(false),
+          _sparse_weights(false)
     {
     }
     /** Constructor
@@ -162,7 +163,8 @@ public:
           _fixed_format(fixed_format),
           _weight_format(weight_format),
           _accumulate(accumulate),
-          _use_fp32_acc(use_fp32_acc)
+          _use_fp32_acc(use_fp32_acc),
+          _sparse_weights(false)
     {
     }
     /** Flag which specifies if the matrix A has been reshaped
@@ -378,6 +380,24 @@ public:
     {
         _use_fp32_acc = use_fp32_acc;
     }
+    /** Flag which specifies if the matrix B holds 2:4 structured-sparse weights
+     *
+     * @return True if at most two values out of every four consecutive values along the K dimension of B are non-zero
+     */
+    bool sparse_weights() const
+    {
+        return _sparse_weights;
+    }
+    /** Set sparse_weights flag
+     *
+     * @note Only honoured for constant F32/F16 matrices B, any other configuration runs the dense GEMM
+     *
+     * @param[in] sparse_weights sets whether or not the matrix B is 2:4 structured-sparse along K
+     */
+    void set_sparse_weights(bool sparse_weights)
+    {
+        _sparse_weights = sparse_weights;
+    }
 
 private:
     bool                      _is_a_reshaped;
@@ -397,6 +417,7 @@ private:
     arm_compute::WeightFormat _weight_format;
     bool                      _accumulate;
     bool                      _use_fp32_acc;
+    bool                      _sparse_weights;
 };
 } //namespace arm_compute
 #endif // ACL_ARM_COMPUTE_FUNCTION_INFO_GEMMINFO_H
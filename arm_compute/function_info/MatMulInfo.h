@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,6 +45,11 @@ public:
     {
         return _adj_rhs;
     }
+    /* Get incremental mode flag value */
+    bool incremental() const
+    {
+        return _incremental;
+    }
     /* Set Adjoint LHS flag */
     MatMulInfo &adj_lhs(bool adj_lhs)
     {
@@ -57,10 +62,22 @@ public:
         _adj_rhs = adj_rhs;
         return *this;
     }
+    /* Set incremental mode flag
+     *
+     * In incremental mode the rhs is configured at its capacity and only its first rows, as set at runtime with
+     * NEMatMul::set_valid_rhs_rows(), take part in the product. This suits a key/value cache that grows by one row
+     * per decode step: rows are appended in place and no reconfiguration or copy of the history is needed.
+     */
+    MatMulInfo &incremental(bool incremental)
+    {
+        _incremental = incremental;
+        return *this;
+    }
 
 private:
     bool _adj_lhs{false};
     bool _adj_rhs{false};
+    bool _incremental{false};
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_FUNCTION_INFO_MATMULINFO_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,12 +32,14 @@
 #include "arm_compute/graph/Edge.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphProfiler.h"
 #include "arm_compute/graph/IDeviceBackend.h"
 #include "arm_compute/graph/IGraphMutator.h"
 #include "arm_compute/graph/IGraphPrinter.h"
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/INodeVisitor.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/SharedWeightsContext.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/TensorDescriptor.h"
 #include "arm_compute/graph/TypePrinter.h"
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -146,6 +146,21 @@ public:
      */
     static NodeID add_bounding_box_transform_node(
         Graph &g, NodeParams params, NodeIdxPair input, NodeIdxPair deltas, BoundingBoxTransformInfo info);
+    /** Adds a cast layer node to the graph
+     *
+     * @param[in] g             Graph to add the node to
+     * @param[in] params        Common node parameters
+     * @param[in] input         Input to the cast layer node as a NodeID-Index pair
+     * @param[in] out_data_type Output data type
+     * @param[in] policy        (Optional) Conversion policy. Defaults to ConvertPolicy::SATURATE
+     *
+     * @return Node ID of the created node, EmptyNodeID in case of error
+     */
+    static NodeID add_cast_node(Graph        &g,
+                                NodeParams    params,
+                                NodeIdxPair   input,
+                                DataType      out_data_type,
+                                ConvertPolicy policy = ConvertPolicy::SATURATE);
     /** Adds an channel shuffle layer node to the graph
      *
      * @param[in] g          Graph to add the node to
@@ -244,6 +259,7 @@ public:
      * @param[in] bias_accessor         (Optional) Accessor of the bias node data
      * @param[in] quant_info            (Optional) Weights quantization info
      * @param[in] out_quant_info        (Optional) Output quantization info
+     * @param[in] fast_math_hint        (Optional) Fast math hint
      *
      * @return Node ID of the created node, EmptyNodeID in case of error
      */
@@ -258,19 +274,25 @@ public:
                                    ITensorAccessorUPtr        weights_accessor = nullptr,
                                    ITensorAccessorUPtr        bias_accessor    = nullptr,
                                    const QuantizationInfo    &quant_info       = QuantizationInfo(),
-                                   const QuantizationInfo    &out_quant_info   = QuantizationInfo());
+                                   const QuantizationInfo    &out_quant_info   = QuantizationInfo(),
+                                   FastMathHint               fast_math_hint   = FastMathHint::Disabled);
     /** Adds an element-wise layer node to the graph
      *
-     * @param[in] g         Graph to add the node to
-     * @param[in] params    Common node parameters
-     * @param[in] input0    First input to the element-wise operation layer node as a NodeID-Index pair
-     * @param[in] input1    Second input to the element-wise operation layer node as a NodeID-Index pair
-     * @param[in] operation Element-wise operation to perform
+     * @param[in] g              Graph to add the node to
+     * @param[in] params         Common node parameters
+     * @param[in] input0         First input to the element-wise operation layer node as a NodeID-Index pair
+     * @param[in] input1         Second input to the element-wise operation layer node as a NodeID-Index pair
+     * @param[in] operation      Element-wise operation to perform
+     * @param[in] out_quant_info (Optional) Output quantization info
      *
      * @return Node ID of the created node, EmptyNodeID in case of error
      */
-    static NodeID add_elementwise_node(
-        Graph &g, NodeParams params, NodeIdxPair input0, NodeIdxPair input1, EltwiseOperation operation);
+    static NodeID add_elementwise_node(Graph                  &g,
+                                       NodeParams              params,
+                                       NodeIdxPair             input0,
+                                       NodeIdxPair             input1,
+                                       EltwiseOperation        operation,
+                                       const QuantizationInfo &out_quant_info = QuantizationInfo());
     /** Adds a dequantization node to the graph
      *
      * @param[in] g      Graph to add the node to
@@ -526,11 +548,15 @@ public:
      * @param[in] params         Common node parameters
      * @param[in] input          Input to the quantization layer node as a NodeID-Index pair
      * @param[in] out_quant_info Output quantization info
+     * @param[in] out_data_type  (Optional) Output data type, must be quantized. Defaults to @ref DataType::QASYMM8
      *
      * @return Node ID of the created node, EmptyNodeID in case of error
      */
-    static NodeID
-    add_quantization_node(Graph &g, NodeParams params, NodeIdxPair input, const QuantizationInfo &out_quant_info);
+    static NodeID add_quantization_node(Graph                  &g,
+                                        NodeParams              params,
+                                        NodeIdxPair             input,
+                                        const QuantizationInfo &out_quant_info,
+                                        DataType                out_data_type = DataType::QASYMM8);
     /** Adds a reduction sum layer node to the graph
      *
      * @param[in] g         Graph to add the node to
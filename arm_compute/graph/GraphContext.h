@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -124,13 +124,20 @@ public:
      * @return Weights manager contexts
      */
     std::map<Target, WeightsManagerContext> &weights_managers();
-    /** Finalizes memory managers in graph context */
-    void finalize();
+    /** Finalizes memory managers in graph context
+     *
+     * @note The memory managers keep at least as many pools as requested by the previous calls, as the functions of
+     *       the graphs finalized before share them
+     *
+     * @param[in] num_pools (Optional) Number of pools of the memory managers, one per function executed concurrently
+     */
+    void finalize(size_t num_pools = 1);
 
 private:
     GraphConfig                             _config;           /**< Graph configuration */
     std::map<Target, MemoryManagerContext>  _memory_managers;  /**< Memory managers for each target */
     std::map<Target, WeightsManagerContext> _weights_managers; /**< Weights managers for each target */
+    size_t                                  _num_pools;        /**< Number of pools of the memory managers */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,10 +28,20 @@
  * @publicapi
  */
 
+#include "arm_compute/graph/detail/CrossLayerMemoryManagerHelpers.h"
+#include "arm_compute/graph/detail/LazyPrepareExecutor.h"
+#include "arm_compute/graph/detail/ParallelTaskExecutor.h"
+#include "arm_compute/graph/detail/PipelineStageExecutor.h"
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/TensorDescriptor.h"
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/graph/Workload.h"
 
 #include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -42,6 +52,9 @@ class Graph;
 class GraphContext;
 class PassManager;
 
+/** Milliseconds spent in each phase of a graph finalization, in execution order */
+using FinalizePhaseTimings = std::vector<std::pair<std::string, double>>;
+
 /** Graph manager class
  *
  * Manages a list of graphs along with their resources
@@ -76,14 +89,140 @@ public:
      * @param[in] graph Graph to execute
      */
     void execute_graph(Graph &graph);
+    /** Removes the one-off costs of the first execution of a finalized graph
+     *
+     * The nodes left to be prepared are prepared, the allocated inputs and intermediate tensors are zeroed to fault
+     * their pages in, then the tasks are run once without calling the input and output accessors. The run acquires
+     * and touches the memory pools and builds the state the functions create on their first run.
+     *
+     * @note With a pipeline depth greater than 1 only the buffers of the first request in flight are warmed up.
+     *
+     * @param[in] graph               Graph to warm up
+     * @param[in] run_dummy_iteration (Optional) Run the tasks once on the zeroed inputs. Defaults to true
+     */
+    void warm_up(Graph &graph, bool run_dummy_iteration = true);
+    /** Specialises a finalized graph to new input shapes
+     *
+     * The const tensors of the graph are kept, so the functions configured for the new shapes share the weights
+     * transformed through the weights manager with the ones configured for the previous shapes. The other tensor
+     * shapes, the functions and the transition memory are recomputed.
+     *
+     * The workloads of the previous shapes are kept and swapped back in when the graph is reshaped to them again.
+     * They only share their transient memory when the transition memory manager is used.
+     *
+     * @note The nodes whose weights depend on the input shapes, like a fully connected layer on a flattened input,
+     *       cannot be reshaped.
+     * @note A graph executed in pipeline stages cannot be reshaped.
+     *
+     * @param[in] graph        Graph to reshape
+     * @param[in] input_shapes Shapes of the inputs of the graph, in the order of Graph::nodes(NodeType::Input)
+     */
+    void reshape_inputs(Graph &graph, const std::vector<TensorShape> &input_shapes);
+    /** Updates a finalized graph after an edit
+     *
+     * The nodes added by the edit and the ones whose inputs, outputs, parameters or target changed are validated,
+     * configured and prepared again. The other nodes keep their functions along with their prepared weights.
+     * The tensors added by the edit are allocated outside of the transition memory.
+     *
+     * When the transition memory manager is used and a node configured again would access a managed tensor outside of
+     * its planned lifetime, all the nodes are configured again and the transition memory is planned for the edited
+     * graph. The const tensors are kept, like when reshaping the inputs.
+     *
+     * @note The IR mutating passes are not run on the edited graph.
+     * @note A node added to read a tensor that another node overwrites in place must run before it, sequentially.
+     * @note The parameters that the dot graph printer does not print, like the fused activation of a convolution,
+     *       are not compared. The nodes whose parameters were changed in place must be listed in @p edited_nodes.
+     * @note The workloads of the previous input shapes cannot be swapped back in once the graph is updated.
+     * @note A graph executed in pipeline stages cannot be updated.
+     *
+     * @param[in] graph        Graph to update
+     * @param[in] edited_nodes (Optional) Nodes whose parameters were changed in place
+     */
+    void update_graph(Graph &graph, const std::vector<NodeID> &edited_nodes = {});
     /** Invalidates the graph execution workload
      *
      * @param[in] graph Graph to invalidate
      */
     void invalidate_graph(Graph &graph);
+    /** Phase timings of the last graph finalized by any graph manager of the process
+     *
+     * Used by the benchmark harnesses to split the time-to-first-inference of a model,
+     * as the graph managers are usually owned by a frontend stream.
+     *
+     * @note The prepare phase is empty when the nodes are prepared on their first execution.
+     *
+     * @return The timings of the phases of the last @ref finalize_graph call, empty if no graph was finalized
+     */
+    static FinalizePhaseTimings last_finalize_timings();
 
 private:
-    std::map<GraphID, ExecutionWorkload> _workloads = {}; /**< Graph workloads */
+    /** Configuration of a workload, used to find the nodes that an edit of its graph affects */
+    struct WorkloadRecord
+    {
+        std::map<NodeID, std::string> nodes{};      /**< Inputs, outputs and parameters of the nodes */
+        std::vector<NodeID>           task_nodes{}; /**< Nodes of the tasks, in execution order */
+        detail::TransitionLifetimes   lifetimes{};  /**< Planned lifetimes of the transition handles */
+        bool has_transition_plan{false}; /**< Whether the transition memory was planned for the tasks */
+    };
+
+    /** Workload of a graph configured for other input shapes than the current ones */
+    struct InputShapesWorkload
+    {
+        std::vector<TensorShape>                    input_shapes{}; /**< Shapes of the inputs */
+        ExecutionWorkload                           workload{};     /**< Workload configured for the inputs */
+        WorkloadRecord                              record{};       /**< Configuration of the workload */
+        std::vector<TensorDescriptor>               descriptors{};  /**< Descriptors of the tensors, by tensor ID */
+        std::vector<std::unique_ptr<ITensorHandle>> handles{}; /**< Handles of the non-const tensors, by tensor ID */
+    };
+
+    /** Puts the registered workload of a graph aside, with the handles of the non-const tensors
+     *
+     * @param[in] graph Graph of the workload
+     *
+     * @return The workload, its record and the handles of the tensors its functions were configured with
+     */
+    InputShapesWorkload extract_workload(Graph &graph);
+    /** Configures a workload for all the nodes of a graph, creating the missing tensor handles
+     *
+     * The transition memory is planned and the memory pools are created again.
+     *
+     * @param[in] graph      Graph to configure
+     * @param[in] ctx        Graph context
+     * @param[in] target     Target the graph was finalized for
+     * @param[in] node_order The order to configure the nodes
+     *
+     * @return The execution workload
+     */
+    ExecutionWorkload
+    configure_workload(Graph &graph, GraphContext &ctx, Target target, const std::vector<NodeID> &node_order);
+    /** Records the configuration of the registered workload of a graph, whose transition memory was just planned
+     *
+     * @param[in] graph Graph of the workload
+     */
+    void record_workload(Graph &graph);
+
+    /** Creates the executor, the backend runner or the lazy preparer of a registered workload
+     *
+     * @param[in] graph  Graph of the workload
+     * @param[in] target Target the graph was finalized for
+     */
+    void setup_executors(Graph &graph, Target target);
+    /** Runs the tasks of a registered workload through its executor
+     *
+     * @param[in] graph    Graph of the workload
+     * @param[in] workload Workload to run
+     */
+    void run_tasks(Graph &graph, ExecutionWorkload &workload);
+
+    std::map<GraphID, ExecutionWorkload>                              _workloads          = {}; /**< Graph workloads */
+    std::map<GraphID, std::unique_ptr<detail::ParallelTaskExecutor>>  _parallel_executors = {}; /**< Executors of the graphs running branches concurrently */
+    std::map<GraphID, std::unique_ptr<detail::PipelineStageExecutor>> _stage_executors    = {}; /**< Executors of the graphs split into pipeline stages */
+    std::map<GraphID, WorkloadRunner>                                 _workload_runners   = {}; /**< Backend runners of the graph workloads */
+    std::map<GraphID, std::unique_ptr<detail::LazyPrepareExecutor>>   _lazy_preparers     = {}; /**< Executors of the graphs preparing their nodes on first use */
+    std::map<GraphID, Target>                                         _targets            = {}; /**< Targets the graphs were finalized for */
+    std::map<GraphID, std::vector<InputShapesWorkload>>               _other_workloads    = {}; /**< Workloads of the graphs for their previous input shapes */
+    std::map<GraphID, WorkloadRecord>                                 _records            = {}; /**< Configurations of the graph workloads */
+    std::map<GraphID, std::vector<InputShapesWorkload>>               _retired_workloads  = {}; /**< Workloads replaced by graph updates, the memory managers still refer to their tensors */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_GRAPHPROFILER_H
+#define ACL_ARM_COMPUTE_GRAPH_GRAPHPROFILER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/graph/Workload.h"
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Execution of a kernel enqueued by a node */
+struct KernelProfile
+{
+    std::string name{};        /**< Name of the kernel, including its work sizes on OpenCL */
+    double      start_us{0.0}; /**< Start of the execution on the device, in microseconds since the profiler started */
+    double      end_us{0.0};   /**< End of the execution on the device, in microseconds since the profiler started */
+};
+
+/** Execution of a node */
+struct NodeProfile
+{
+    NodeID                     id{EmptyNodeID};             /**< Node ID */
+    std::string                name{};                      /**< Node name */
+    NodeType                   type{NodeType::Dummy};       /**< Node type */
+    Target                     target{Target::UNSPECIFIED}; /**< Target the node is assigned to */
+    unsigned int               thread{0};                   /**< Index of the thread which ran the node */
+    double                     start_us{0.0}; /**< Start of the host call, in microseconds since the profiler started */
+    double                     end_us{0.0};   /**< End of the host call, in microseconds since the profiler started */
+    std::vector<KernelProfile> kernels{};     /**< Kernels enqueued by the node, on the targets profiling kernels */
+};
+
+/** Interface of the backend profilers timing the kernels enqueued by the nodes */
+class IKernelProfiler
+{
+public:
+    /** Clock the timings are measured with */
+    using Clock = std::chrono::steady_clock;
+    /** Virtual Destructor */
+    virtual ~IKernelProfiler() = default;
+    /** Starts recording the kernels enqueued on the backend */
+    virtual void start() = 0;
+    /** Stops recording the kernels enqueued on the backend */
+    virtual void stop() = 0;
+    /** Sets the profile the kernels enqueued from the calling thread belong to
+     *
+     * @param[in] profile Index of the profile, negative if the kernels do not belong to a node
+     */
+    virtual void set_current_profile(int profile) = 0;
+    /** Waits for the recorded kernels to complete and adds them to the profiles they belong to
+     *
+     * @param[in]     origin   Time the timings are relative to
+     * @param[in,out] profiles Node profiles to add the kernels to
+     */
+    virtual void collect(Clock::time_point origin, std::vector<NodeProfile> &profiles) = 0;
+};
+
+/** Profiler recording the execution of the nodes of the graphs
+ *
+ * Records the host time of every task run by the @ref TaskExecutor and, on the backends supporting it, the device
+ * time of the kernels each task enqueues. The profiles can be exported as a Chrome trace (chrome://tracing or
+ * Perfetto) to find the hot layers of a deployed model.
+ *
+ * @note Only one profiler can be started at a time, and it must be started after the graphs are finalized.
+ */
+class GraphProfiler final
+{
+public:
+    /** Default Constructor */
+    GraphProfiler();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    GraphProfiler(const GraphProfiler &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    GraphProfiler &operator=(const GraphProfiler &) = delete;
+    /** Destructor, stops the profiler if running */
+    ~GraphProfiler();
+    /** Starts recording the tasks executed */
+    void start();
+    /** Stops recording and resolves the kernel timings
+     *
+     * @note On asynchronous backends this waits for the recorded kernels to complete.
+     */
+    void stop();
+    /** Discards the recorded profiles */
+    void clear();
+    /** Returns the recorded profiles, in start order
+     *
+     * @return Node profiles
+     */
+    const std::vector<NodeProfile> &profiles() const;
+    /** Exports the recorded profiles in the Chrome trace event format
+     *
+     * Nodes are complete events of the host threads, kernels complete events of their device.
+     *
+     * @param[out] os Output stream
+     */
+    void export_chrome_trace(std::ostream &os) const;
+
+private:
+    void execute(ExecutionTask &task);
+
+    std::function<decltype(execute_task)>         _real_function;
+    std::vector<std::unique_ptr<IKernelProfiler>> _kernel_profilers;
+    std::vector<NodeProfile>                      _profiles;
+    std::map<std::thread::id, unsigned int>       _threads;
+    IKernelProfiler::Clock::time_point            _origin;
+    std::mutex                                    _mtx;
+    bool                                          _running;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_GRAPHPROFILER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,8 +28,10 @@
  * @publicapi
  */
 
+#include "arm_compute/graph/GraphProfiler.h"
 #include "arm_compute/graph/ITensorHandle.h"
 #include "arm_compute/graph/Types.h"
+#include "arm_compute/graph/Workload.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/IWeightsManager.h"
@@ -94,6 +96,20 @@ public:
      */
     virtual std::unique_ptr<ITensorHandle>
     create_subtensor(ITensorHandle *parent, TensorShape shape, Coordinates coords, bool extend_parent) = 0;
+    /** Create a backend Tensor reinterpreting the memory of another one
+     *
+     * @note The alias has the descriptor of the given tensor and the same size in bytes as its parent
+     *
+     * @param[in] parent Parent tensor handle
+     * @param[in] tensor The tensor we want to create an alias for
+     *
+     * @return Backend alias tensor handle, nullptr if the backend can't alias the memory of the parent
+     */
+    virtual std::unique_ptr<ITensorHandle> create_alias_tensor(ITensorHandle *parent, const Tensor &tensor)
+    {
+        ARM_COMPUTE_UNUSED(parent, tensor);
+        return nullptr;
+    }
     /** Configure a backend Node
      *
      * @note This creates an appropriate configured backend function for the given node
@@ -111,6 +127,18 @@ public:
      * @return An error status
      */
     virtual Status validate_node(INode &node) = 0;
+    /** Checks if the validation of a node checks the arguments of the functions the node is configured with
+     *
+     * @param[in] node The node to check
+     *
+     * @return True if @ref IDeviceBackend::validate_node validates the functions of the node, false if it accepts
+     *         the node without checking it
+     */
+    virtual bool is_node_validated(const INode &node)
+    {
+        ARM_COMPUTE_UNUSED(node);
+        return false;
+    }
     /** Create a backend memory manager given its affinity
      *
      * @param[in] affinity Memory Manager affinity
@@ -125,6 +153,60 @@ public:
     virtual std::shared_ptr<arm_compute::IWeightsManager> create_weights_manager() = 0;
     /** Synchronize kernels execution on the backend. On GPU, this results in a blocking call waiting for all kernels to be completed. */
     virtual void sync() = 0;
+    /** Create the function running the tasks of the workloads of a graph
+     *
+     * Backends can use it to speed-up the execution of a workload run repeatedly, for example by replaying the
+     * commands recorded on its first run.
+     *
+     * @param[in] ctx Context of the graph
+     *
+     * @return The function running the tasks, empty to run them directly
+     */
+    virtual WorkloadRunner create_workload_runner(GraphContext &ctx)
+    {
+        ARM_COMPUTE_UNUSED(ctx);
+        return {};
+    }
+    /** Create a profiler timing the kernels the nodes enqueue on the backend
+     *
+     * @return The kernel profiler, nullptr if the backend does not time its kernels
+     */
+    virtual std::unique_ptr<IKernelProfiler> create_kernel_profiler()
+    {
+        return nullptr;
+    }
+    /** Get the convolution method measured as the fastest for a convolution layer node
+     *
+     * Backends timing their convolution methods for the exact shapes of a node report the fastest one here.
+     *
+     * @param[in]  node   Convolution layer node
+     * @param[out] method Measured convolution method. Only set when one is available
+     *
+     * @return True if the backend has a measured method for the node
+     */
+    virtual bool measured_convolution_method(INode &node, ConvolutionMethod &method)
+    {
+        ARM_COMPUTE_UNUSED(node, method);
+        return false;
+    }
+    /** Register a tensor which keeps its content as long as it is registered
+     *
+     * Backends can use it to share the weights transformed from the tensor between the graphs reading it.
+     *
+     * @param[in] handle Handle of the tensor
+     */
+    virtual void register_persistent_tensor(ITensorHandle &handle)
+    {
+        ARM_COMPUTE_UNUSED(handle);
+    }
+    /** Unregister a tensor registered with @ref IDeviceBackend::register_persistent_tensor
+     *
+     * @param[in] handle Handle of the tensor
+     */
+    virtual void unregister_persistent_tensor(ITensorHandle &handle)
+    {
+        ARM_COMPUTE_UNUSED(handle);
+    }
 };
 } // namespace backends
 } // namespace graph
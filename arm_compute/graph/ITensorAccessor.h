@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
  * @publicapi
  */
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/core/ITensor.h"
 
 #include <memory>
@@ -57,6 +58,20 @@ public:
     {
         return true;
     }
+    /** Returns memory already holding the tensor data, which can be imported instead of allocating the tensor
+     *
+     * @note The memory must remain valid for the lifetime of the accessor
+     *
+     * @param[in] info Info of the tensor to be accessed
+     *
+     * @return Pointer to the data laid out as described by @p info, nullptr if the tensor must be allocated and filled
+     *         by @ref access_tensor
+     */
+    virtual void *import_memory(const ITensorInfo &info)
+    {
+        ARM_COMPUTE_UNUSED(info);
+        return nullptr;
+    }
 };
 
 using ITensorAccessorUPtr = std::unique_ptr<ITensorAccessor>;
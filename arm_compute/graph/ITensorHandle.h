@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,9 +28,12 @@
  * @publicapi
  */
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/graph/Types.h"
 
+#include <functional>
+
 namespace arm_compute
 {
 // Forward declarations
@@ -48,6 +51,34 @@ public:
     virtual void allocate() = 0;
     /** Allocates backend memory for the handle */
     virtual void free() = 0;
+    /** Backs the handle with externally owned memory instead of allocating it
+     *
+     * @note The memory must outlive the handle and be laid out as described by the tensor info
+     *
+     * @param[in] memory Memory to import
+     *
+     * @return True if the memory has been imported, false if the backend cannot import host memory
+     */
+    virtual bool import_memory(void *memory)
+    {
+        ARM_COMPUTE_UNUSED(memory);
+        return false;
+    }
+    /** Enqueues a copy between the backend tensor and host memory without waiting for its completion
+     *
+     * @note The host memory must not be accessed until the returned function has been called
+     *
+     * @param[in,out] host      Host memory, with the layout and total size of the backend tensor
+     * @param[in]     to_handle True to upload @p host to the backend tensor, false to read the backend tensor back
+     *
+     * @return A function waiting for the completion of the copy, or an empty function if the backend only copies
+     *         synchronously through @ref map()
+     */
+    virtual std::function<void()> enqueue_host_copy(void *host, bool to_handle)
+    {
+        ARM_COMPUTE_UNUSED(host, to_handle);
+        return {};
+    }
     /** Set backend tensor to be managed by a memory group
      *
      * @param[in] mg Memory group
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_SHAREDWEIGHTSCONTEXT_H
+#define ACL_ARM_COMPUTE_GRAPH_SHAREDWEIGHTSCONTEXT_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/TensorDescriptor.h"
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/runtime/IWeightsManager.h"
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Tensor;
+
+/** Read-only weights shared by the graphs built from the same model
+ *
+ * The constant tensors of the graphs using the context are allocated and filled once, by the first graph finalized
+ * with each of them, and the weights managers of the context transform the weights once for all the graphs. Only the
+ * transition and the auxiliary memory are then allocated for each graph.
+ *
+ * @note Constant tensors are matched by the name of their node, which must be unique in each graph
+ * @note The graphs using the context must be finalized one after the other, and kept alive while any of them runs
+ *       as the transformed weights are owned by the functions of the first graph using them
+ * @note On OpenCL, the weights transformed by GEMM based functions are also kept by the backend while the context
+ *       is alive, so the graphs created from the context later on do not transform them again
+ */
+class SharedWeightsContext final
+{
+public:
+    /** Constructor */
+    SharedWeightsContext();
+    /** Destructor */
+    ~SharedWeightsContext();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    SharedWeightsContext(const SharedWeightsContext &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    SharedWeightsContext &operator=(const SharedWeightsContext &) = delete;
+    /** Gets the weights manager shared by the graphs running on a target
+     *
+     * @param[in] target Target of the weights manager
+     *
+     * @return Weights manager of the target, created on first use
+     */
+    std::shared_ptr<arm_compute::IWeightsManager> weights_manager(Target target);
+    /** Shares the backend tensor of a constant
+     *
+     * The first tensor shared with a name creates the backend tensor of the context, the tensors shared afterwards
+     * with the same name and descriptor use it.
+     *
+     * @param[in]  name     Name of the constant
+     * @param[in]  tensor   Constant tensor of a graph
+     * @param[out] is_owner True if the backend tensor has been created for this tensor, which has to fill it
+     *
+     * @return Handle to the backend tensor of the context, nullptr if the descriptor doesn't match the shared tensor
+     */
+    std::unique_ptr<ITensorHandle> share_tensor(const std::string &name, const Tensor &tensor, bool &is_owner);
+    /** Gets the number of constant tensors shared
+     *
+     * @return Number of constant tensors
+     */
+    size_t num_tensors() const;
+
+private:
+    /** Backend tensor of a constant */
+    struct SharedTensor
+    {
+        TensorDescriptor               desc{};         /**< Descriptor of the constant */
+        std::unique_ptr<ITensorHandle> handle{nullptr}; /**< Backend tensor */
+    };
+
+    std::map<std::string, SharedTensor>                               _tensors;          /**< Shared constants */
+    std::map<Target, std::shared_ptr<arm_compute::IWeightsManager>> _weights_managers; /**< Shared weights managers */
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_SHAREDWEIGHTSCONTEXT_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -75,6 +75,13 @@ public:
      * @return Backend tensor handle
      */
     ITensorHandle *handle();
+    /** Extracts the backend tensor
+     *
+     * @warning Backend tensor gets unbound from the tensor
+     *
+     * @return The backend tensor
+     */
+    std::unique_ptr<ITensorHandle> extract_handle();
     /** Sets the backend tensor accessor
      *
      * @param[in] accessor Accessor to set
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,7 +39,10 @@
 #include "arm_compute/runtime/CL/CLTypes.h"
 
 #include <limits>
+#include <map>
+#include <memory>
 #include <string>
+#include <utility>
 
 namespace arm_compute
 {
@@ -87,12 +90,30 @@ constexpr EdgeID EmptyEdgeID = std::numeric_limits<EdgeID>::max();
 // Forward declarations
 struct TensorDescriptor;
 
+/** Mixed precision policy
+ *
+ * Layers are looked up by node name. Ranges are the calibrated minimum and maximum values of a tensor.
+ */
+struct MixedPrecisionPolicy
+{
+    DataType                                       default_data_type{DataType::F16}; /**< Data type of the layers without an explicit data type */
+    std::map<std::string, DataType>                layer_data_types{};               /**< Explicit data type per layer */
+    std::map<std::string, std::pair<float, float>> output_ranges{};                  /**< Calibrated output range per layer */
+    std::map<std::string, std::pair<float, float>> weights_ranges{};                 /**< Calibrated weights range per layer */
+    std::map<std::string, float>                   int8_sensitivity{};               /**< Accuracy loss of running a layer in 8-bit */
+    float                                          accuracy_budget{0.f};             /**< Total accuracy loss allowed when selecting the 8-bit layers */
+};
+
+// Forward declarations
+class SharedWeightsContext;
+
 /** Graph configuration structure */
 struct GraphConfig
 {
     bool        use_function_memory_manager{true};   /**< Use a memory manager to manage per-function auxilary memory */
     bool        use_function_weights_manager{true};  /**< Use a weights manager to manage transformed weights */
     bool        use_transition_memory_manager{true}; /**< Use a memory manager to manager transition buffer memory */
+    bool        use_heterogeneous_targets{false};    /**< Run the nodes which are faster on the CPU on the NEON target when the graph targets CL */
     bool        use_tuner{false};                    /**< Use a tuner in tunable backends */
     bool        use_synthetic_type{false};           /**< Convert graph to a synthetic graph for a data type */
     DataType    synthetic_type{DataType::QASYMM8};   /**< The data type of the synthetic graph  */
@@ -102,6 +123,35 @@ struct GraphConfig
     std::string   tuner_file{"acl_tuner.csv"};         /**< File to load/store tuning values from */
     std::string   mlgo_file{"heuristics.mlgo"};        /**< Filename to load MLGO heuristics from */
     CLBackendType backend_type{CLBackendType::Native}; /**< CL backend type to use */
+    std::string   program_cache_file{};                /**< File to load/store compiled CL programs from, if empty programs are built at every run */
+    int           num_parallel_branches{
+        1}; /**< Number of independent nodes executed concurrently (NEON target with thread local schedulers, or CL target with a command queue per branch), if 1 nodes are executed sequentially. */
+    int           pipeline_depth{
+        1}; /**< Number of requests in flight when executing a graph (accessors overlap with computation), if 1 requests are executed one at a time. */
+    int           num_pipeline_stages{
+        1}; /**< Number of stages of balanced estimated cost the nodes are split into when executing a stream of requests, each stage running on its own cores and passing the requests to the next one (NEON target with thread local schedulers), if 1 the nodes are executed as a single stage. Takes precedence over the parallel branches and the pipeline depth, and disables the transition memory manager and the lazy prepare. */
+    bool use_kernel_replay{
+        false}; /**< Record the kernels run by a graph on its first execution and replay them afterwards (CL target only, the graph must only run OpenCL kernels) */
+    bool use_adaptive_job_chaining{
+        false}; /**< Adjust the number of kernels enqueued between two flushes of the command queue to the activity of the GPU (CL target only) */
+    bool use_fp32_accumulation{
+        false}; /**< Accumulate the FP16 fully connected layers in FP32, except the ones with fast math enabled (CL target only) */
+    bool                 use_mixed_precision{false}; /**< Select the data type of each layer following the mixed precision policy */
+    MixedPrecisionPolicy mixed_precision_policy{};  /**< Mixed precision policy */
+    std::shared_ptr<SharedWeightsContext> shared_weights{
+        nullptr}; /**< Context of the read-only weights shared with other graphs built from the same model, if null the graph owns its weights */
+    bool use_lazy_prepare{
+        false}; /**< Prepare each node on its first execution instead of when finalizing the graph, releasing its original weights once transformed */
+    int lazy_prepare_distance{
+        2}; /**< Number of nodes prepared by a background thread ahead of the executing one in lazy prepare mode (NEON target with thread local schedulers), if 0 nodes are prepared just before running */
+    bool use_trusted_configure{
+        false}; /**< Skip validating again the arguments of the functions when configuring the nodes whose backend validates them beforehand, the other nodes are validated when configured (only effective when asserts are enabled) */
+    bool use_fast_math{
+        false}; /**< Enable the fast math hint of all the convolution, depthwise convolution and fully connected nodes, letting the F32 ones compute in BF16 where supported */
+    bool use_cl_offset_memory_pools{
+        false}; /**< Allocate the transient tensors of each memory manager as sub-buffers of a single buffer sized to the planned peak, instead of a buffer per blob (CL target only) */
+    bool use_async_const_upload{
+        false}; /**< Fill the constants of the accelerator targets from their accessors on host threads while the nodes are configured, then upload them without blocking. The accessors of the constants must be thread safe */
 };
 
 /**< Device target types */
@@ -161,6 +211,7 @@ enum class NodeType
     ArgMinMaxLayer,
     BatchNormalizationLayer,
     BoundingBoxTransformLayer,
+    CastLayer,
     ChannelShuffleLayer,
     ConcatenateLayer,
     ConvolutionLayer,
@@ -174,7 +225,12 @@ enum class NodeType
     FlattenLayer,
     FullyConnectedLayer,
     FusedConvolutionBatchNormalizationLayer,
+    FusedConvolutionEltwiseAddLayer,
+    FusedConvolutionPoolingLayer,
+    FusedCopyProgramLayer,
     FusedDepthwiseConvolutionBatchNormalizationLayer,
+    FusedDepthwiseSeparableConvolutionLayer,
+    FusedElementwiseChainLayer,
     GenerateProposalsLayer,
     L2NormalizeLayer,
     NormalizationLayer,
@@ -209,8 +265,9 @@ enum class NodeType
 /** Backend Memory Manager affinity **/
 enum class MemoryManagerAffinity
 {
-    Buffer, /**< Affinity at buffer level */
-    Offset  /**< Affinity at offset level */
+    Buffer,      /**< Affinity at buffer level */
+    Offset,      /**< Affinity at offset level */
+    PackedOffset /**< Affinity at offset level, with offsets packed from the lifetimes of the buffers */
 };
 
 /** NodeID-index struct
@@ -229,6 +286,15 @@ struct NodeParams
     std::string name;   /**< Node name */
     Target      target; /**< Node target */
 };
+
+/** Region of the input read by the outputs of a graph, used to run the graph on overlapping tiles of its input */
+struct ReceptiveFieldInfo
+{
+    unsigned int halo_x{0};    /**< Input columns read on each side of the columns an output pixel maps to */
+    unsigned int halo_y{0};    /**< Input rows read on each side of the rows an output pixel maps to */
+    unsigned int alignment{1}; /**< Input pixels per pixel of the most downsampled tensor, tile origins are multiples */
+    float        scale{1.f};   /**< Output pixels per input pixel */
+};
 } // namespace graph
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_GRAPH_TYPES_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -92,6 +92,23 @@ Target get_default_target();
  * @param[in] target Target to force
  */
 void force_target_to_graph(Graph &g, Target target);
+/** Assigns a target to every graph construct, moving the nodes which run faster on the CPU off the GPU
+ *
+ * Detection post-processing and small fully connected or argmin/argmax layers are assigned to the NEON target when
+ * @p target is CL, the other nodes being assigned to @p target. Tensors are assigned to the NEON target only if all
+ * the nodes accessing them are, the NEON nodes map the remaining CL tensors when they execute.
+ *
+ * @note Behaves as @ref force_target_to_graph if @p target is not CL or the NEON target is not supported.
+ *
+ * @param[in] g      Graph to assign the targets of
+ * @param[in] target Target of the nodes which are not moved to the CPU
+ */
+void assign_heterogeneous_targets(Graph &g, Target target);
+/** Enables the fast math hint of every graph node having one
+ *
+ * @param[in] g Graph to enable fast math on
+ */
+void force_fast_math_to_graph(Graph &g);
 /** Creates a default @ref PassManager
  *
  * @param[in] target Target to create the pass manager for
@@ -148,6 +165,17 @@ std::vector<NodeIdxPair> get_driver_nodes(const INode &node);
  * @param[in, out] tensor Tensor to configure
  */
 void configure_tensor(Tensor *tensor);
+/** Computes the region of its input each output pixel of a graph reads
+ *
+ * Only graphs made of convolutions, deconvolutions, poolings and layers computing each pixel from the same pixel of
+ * their inputs are supported, with the same stride along both dimensions and a single input tensor.
+ *
+ * @param[in]  g    Graph to compute the receptive field of
+ * @param[out] info Receptive field of the outputs. Only set if the graph is supported
+ *
+ * @return True if the outputs of the graph can be computed on overlapping tiles of its input
+ */
+bool compute_receptive_field(Graph &g, ReceptiveFieldInfo &info);
 } // namespace graph
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_GRAPH_UTILS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2025 Arm Limited.
+ * Copyright (c) 2018-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -106,6 +106,10 @@ struct ExecutionWorkload
     Graph                     *graph   = {nullptr}; /**< Graph bound to the workload */
     GraphContext              *ctx     = {nullptr}; /**< Graph execution context */
 };
+
+/** Function running the tasks of a workload, given the function actually running them */
+using WorkloadRunner =
+    std::function<void(ExecutionWorkload &, const std::function<void(ExecutionWorkload &)> &run_tasks)>;
 } // namespace graph
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_GRAPH_WORKLOAD_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include "arm_compute/runtime/CL/CLGEMMHeuristicsHandle.h"
 #include "arm_compute/runtime/CL/CLTuner.h"
 #include "arm_compute/runtime/CL/CLTypes.h"
+#include "arm_compute/runtime/CL/CLWeightsCache.h"
 
 namespace arm_compute
 {
@@ -72,17 +73,24 @@ public:
     create_subtensor(ITensorHandle *parent, TensorShape shape, Coordinates coords, bool extend_parent) override;
     std::unique_ptr<arm_compute::IFunction>       configure_node(INode &node, GraphContext &ctx) override;
     Status                                        validate_node(INode &node) override;
+    bool                                          is_node_validated(const INode &node) override;
     std::shared_ptr<arm_compute::IMemoryManager>  create_memory_manager(MemoryManagerAffinity affinity) override;
     std::shared_ptr<arm_compute::IWeightsManager> create_weights_manager() override;
     void                                          sync() override;
+    WorkloadRunner                                create_workload_runner(GraphContext &ctx) override;
+    std::unique_ptr<IKernelProfiler>              create_kernel_profiler() override;
+    void                                          register_persistent_tensor(ITensorHandle &handle) override;
+    void                                          unregister_persistent_tensor(ITensorHandle &handle) override;
 
 private:
     int                                _context_count; /**< Counts how many contexts are currently using the backend */
     CLTuner                            _tuner;         /**< CL kernel tuner */
-    CLGEMMHeuristicsHandle             _gemm_heuristics; /**< GEMM heuristics */
-    std::unique_ptr<CLBufferAllocator> _allocator;       /**< CL buffer affinity allocator */
-    std::string                        _tuner_file;      /**< Filename to load/store the tuner's values from */
-    CLBackendType                      _backend_type;    /**< OpenCL backend type to use */
+    CLGEMMHeuristicsHandle             _gemm_heuristics;    /**< GEMM heuristics */
+    std::unique_ptr<CLBufferAllocator> _allocator;          /**< CL buffer affinity allocator */
+    std::string                        _tuner_file;         /**< Filename to load/store the tuner's values from */
+    std::string                        _program_cache_file; /**< Filename to load/store the compiled programs from */
+    CLBackendType                      _backend_type;       /**< OpenCL backend type to use */
+    CLWeightsCache                     _weights_cache;      /**< Transformed weights shared between the graphs */
 };
 } // namespace backends
 } // namespace graph
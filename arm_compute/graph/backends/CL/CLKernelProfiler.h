@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_BACKENDS_CL_CLKERNELPROFILER_H
+#define ACL_ARM_COMPUTE_GRAPH_BACKENDS_CL_CLKERNELPROFILER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/graph/GraphProfiler.h"
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** Profiler timing the OpenCL kernels enqueued by the nodes
+ *
+ * Intercepts the kernel enqueues and reads the profiling information of their events. The queue of the
+ * @ref CLScheduler is recreated with profiling enabled if needed.
+ *
+ * @note The extra queues of the multi-queue executor must be created after the profiler started for their kernels to be
+ *       timed.
+ */
+class CLKernelProfiler final : public IKernelProfiler
+{
+public:
+    /** Default Constructor */
+    CLKernelProfiler();
+    /** Destructor, stops intercepting the enqueues if running */
+    ~CLKernelProfiler();
+
+    // Inherited overridden methods
+    void start() override;
+    void stop() override;
+    void set_current_profile(int profile) override;
+    void collect(Clock::time_point origin, std::vector<NodeProfile> &profiles) override;
+
+private:
+    struct KernelEvent
+    {
+        int         profile;
+        std::string name;
+        cl::Event   event;
+    };
+
+    std::function<decltype(clEnqueueNDRangeKernel)> _real_function;
+    std::vector<KernelEvent>                        _events;
+    std::mutex                                      _mtx;
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_BACKENDS_CL_CLKERNELPROFILER_H
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_BACKENDS_CL_CLMULTIQUEUETASKEXECUTOR_H
+#define ACL_ARM_COMPUTE_GRAPH_BACKENDS_CL_CLMULTIQUEUETASKEXECUTOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/CL/OpenCL.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+struct ExecutionWorkload;
+
+namespace backends
+{
+/** Enqueues the tasks of a workload on several OpenCL command queues
+ *
+ * Independent branches of the graph (e.g. Inception towers or detection heads) are assigned to different in-order
+ * queues so that the GPU can execute their kernels at the same time when a single kernel does not fill all the shader
+ * cores. A task continues the queue of one of its predecessors when possible, and waits for the predecessors executed
+ * on other queues with event barriers. The first queue is the one of the @ref CLScheduler, which waits for all the
+ * other queues at the end of a run so that the output accessors see the results.
+ *
+ * @note Requires an OpenCL 1.2 device for the event barriers, a single queue is used otherwise.
+ * @note The tensors of the workload must not share memory between nodes that can run concurrently, i.e. the transition
+ *       and function memory managers must be disabled.
+ */
+class CLMultiQueueTaskExecutor final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] num_queues Number of command queues the tasks are distributed over.
+     */
+    explicit CLMultiQueueTaskExecutor(unsigned int num_queues);
+    /** Enqueue all the tasks of the workload
+     *
+     * @note The tasks are assigned to the queues on the first run.
+     *
+     * @param[in] workload Workload to execute. Must be the same at every run.
+     */
+    void run(ExecutionWorkload &workload);
+    /** Returns the number of command queues the tasks are distributed over
+     *
+     * @return Number of queues
+     */
+    unsigned int num_queues() const;
+
+private:
+    void assign_queues(const ExecutionWorkload &workload);
+
+    std::vector<cl::CommandQueue>         _queues;      /**< Additional queues, the first entry is the scheduler's */
+    std::vector<unsigned int>             _task_queue;  /**< Queue of each task */
+    std::vector<std::vector<std::size_t>> _waits;       /**< Tasks on other queues each task waits for */
+    std::vector<bool>                     _needs_event; /**< Whether other queues wait for a task */
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_BACKENDS_CL_CLMULTIQUEUETASKEXECUTOR_H
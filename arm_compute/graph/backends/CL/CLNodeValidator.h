@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,15 @@ public:
      * @return An error status
      */
     static Status validate(INode *node);
+    /** Checks if @ref validate checks the arguments of the functions a node is configured with
+     *
+     * The nodes of the other types are accepted without being checked.
+     *
+     * @param[in] node Node to check
+     *
+     * @return True if the functions of the node are validated
+     */
+    static bool is_validated(const INode &node);
 };
 } // namespace backends
 } // namespace graph
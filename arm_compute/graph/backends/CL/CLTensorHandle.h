@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -56,6 +56,7 @@ public:
     // Inherited overridden methods
     void                        allocate() override;
     void                        free() override;
+    std::function<void()>       enqueue_host_copy(void *host, bool to_handle) override;
     void                        manage(IMemoryGroup *mg) override;
     void                        map(bool blocking) override;
     void                        unmap() override;
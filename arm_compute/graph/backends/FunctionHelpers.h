@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,7 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/utils/helpers/tensor_transform.h"
 #include "arm_compute/graph/backends/FusedConvolutionBatchNormalizationFunction.h"
 #include "arm_compute/graph/backends/FusedDepthwiseConvolutionBatchNormalizationFunction.h"
 #include "arm_compute/graph/backends/Utils.h"
@@ -65,7 +66,9 @@ typename TargetInfo::TensorType *get_backing_tensor(arm_compute::graph::Tensor *
     typename TargetInfo::TensorType *backing_tensor = nullptr;
     if (tensor != nullptr)
     {
-        ARM_COMPUTE_ERROR_ON(tensor->desc().target != TargetInfo::TargetType);
+        // CPU functions access the tensors of the other targets through their mapping
+        ARM_COMPUTE_ERROR_ON(tensor->desc().target != TargetInfo::TargetType &&
+                             TargetInfo::TargetType != Target::NEON);
         // Get backing tensor handle
         ITensorHandle *tensor_handle = tensor->handle();
         // Get backing tensor
@@ -90,6 +93,33 @@ void validate_node(const INode &node, size_t num_expected_inputs, size_t num_exp
     ARM_COMPUTE_UNUSED(node, num_expected_inputs, num_expected_outputs);
 }
 
+/** Checks if the output of a node is a view of its input
+ *
+ * The backend mutators turn the outputs of the data movement nodes into aliases or sub-tensors of their inputs when
+ * possible, in which case the nodes don't need a function.
+ *
+ * @param[in] node        Node with a single input and output
+ * @param[in] view_coords (Optional) Coordinates of the first element of the output in the input
+ *
+ * @return True if the output shares the memory of the input starting at @p view_coords
+ */
+inline bool is_output_view_of_input(INode &node, const Coordinates &view_coords = Coordinates())
+{
+    ITensorHandle *input  = (node.input(0) != nullptr) ? node.input(0)->handle() : nullptr;
+    ITensorHandle *output = (node.output(0) != nullptr) ? node.output(0)->handle() : nullptr;
+    if (input == nullptr || output == nullptr || !output->is_subtensor() ||
+        output->parent_handle() != input->parent_handle())
+    {
+        return false;
+    }
+
+    // Views of the same parent only overlap if they are the same view
+    const ITensorInfo *input_info  = input->tensor().info();
+    const ITensorInfo *output_info = output->tensor().info();
+    return static_cast<int32_t>(output_info->offset_first_element_in_bytes()) ==
+           input_info->offset_element_in_bytes(view_coords);
+}
+
 /** Creates a backend activation layer function
  *
  * @tparam ActivationLayerFunction Backend activation function
@@ -303,6 +333,82 @@ create_fused_depthwise_convolution_batch_normalization_layer(FusedDepthwiseConvo
     return func;
 }
 
+/** Create a backend fused copy program function
+ *
+ * @tparam CopyProgramFunction Backend copy program function
+ * @tparam TargetInfo          Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend fused copy program function
+ */
+template <typename CopyProgramFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_fused_copy_program_layer(FusedCopyProgramNode &node)
+{
+    validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = std::make_unique<CopyProgramFunction>();
+    func->configure(input, output, node.program());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Input shape: "
+                               << input->info()->tensor_shape() << " Output shape: " << output->info()->tensor_shape()
+                               << " Stages: " << node.program().size() << std::endl);
+
+    return func;
+}
+
+/** Create a backend fused elementwise chain function
+ *
+ * @tparam ElementwiseChainFunction Backend elementwise chain function
+ * @tparam TargetInfo               Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend fused elementwise chain function
+ */
+template <typename ElementwiseChainFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_fused_elementwise_chain_layer(FusedElementwiseChainNode &node)
+{
+    validate_node<TargetInfo>(node, node.num_inputs() /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    std::vector<const typename TargetInfo::TensorType *> operands;
+    for (size_t i = 1; i < node.num_inputs(); ++i)
+    {
+        operands.push_back(get_backing_tensor<TargetInfo>(node.input(i)));
+        ARM_COMPUTE_ERROR_ON(operands.back() == nullptr);
+    }
+
+    // Create and configure function
+    auto func = std::make_unique<ElementwiseChainFunction>();
+    func->configure(input, operands, output, node.chain());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Input shape: "
+                               << input->info()->tensor_shape() << " Output shape: " << output->info()->tensor_shape()
+                               << " Operations: " << node.chain().size() << " Operands: " << operands.size()
+                               << std::endl);
+
+    return func;
+}
+
 /** Create a backend bounding box transform layer function
  *
  * @tparam BoundingBoxTransformLayerFunction    Backend bounding box transform function
@@ -337,6 +443,38 @@ std::unique_ptr<IFunction> create_bounding_box_transform_layer(BoundingBoxTransf
     return std::move(func);
 }
 
+/** Create a backend cast layer function
+ *
+ * @tparam CastLayerFunction Backend cast function
+ * @tparam TargetInfo        Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend cast layer function
+ */
+template <typename CastLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_cast_layer(CastLayerNode &node)
+{
+    validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+    const ConvertPolicy              policy = node.convert_policy();
+
+    // Create function
+    auto func = std::make_unique<CastLayerFunction>();
+    func->configure(input, output, policy);
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
+                                               << TargetInfo::TargetType << " Input data type: "
+                                               << input->info()->data_type() << " Output data type: "
+                                               << output->info()->data_type()
+                                               << " Shape: " << input->info()->tensor_shape() << std::endl);
+
+    return func;
+}
+
 /** Create a backend channel shuffle layer function
  *
  * @tparam ChannelShuffleLayerFunction Backend channel shuffle function
@@ -887,6 +1025,13 @@ std::unique_ptr<IFunction> create_flatten_layer(FlattenLayerNode &node)
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    if (is_output_view_of_input(node))
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Skipped " << node.name() << " Type: " << node.type()
+                                              << " as its output is a view of its input" << std::endl);
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
@@ -929,6 +1074,7 @@ std::unique_ptr<IFunction> create_fully_connected_layer(FullyConnectedLayerNode
     typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
     FullyConnectedLayerInfo          fc_info = node.info();
     fc_info.enable_fast_math                 = (node.fast_math_hint() == FastMathHint::Enabled);
+    fc_info.fp_mixed_precision               = fc_info.fp_mixed_precision || ctx.config().use_fp32_accumulation;
 
     ARM_COMPUTE_ERROR_ON(input == nullptr);
     ARM_COMPUTE_ERROR_ON(weights == nullptr);
@@ -1440,6 +1586,13 @@ std::unique_ptr<IFunction> create_reshape_layer(ReshapeLayerNode &node)
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    if (is_output_view_of_input(node))
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Skipped " << node.name() << " Type: " << node.type()
+                                              << " as its output is a view of its input" << std::endl);
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
@@ -1550,6 +1703,17 @@ std::unique_ptr<IFunction> create_slice_layer(SliceLayerNode &node)
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    Coordinates view_coords;
+    if (arm_compute::helpers::tensor_transform::is_strided_slice_view(
+            node.input(0)->desc().shape, node.starts(), node.ends(), BiStrides(), 0,
+            arm_compute::helpers::tensor_transform::construct_slice_end_mask(node.ends()), 0, view_coords) &&
+        is_output_view_of_input(node, view_coords))
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Skipped " << node.name() << " Type: " << node.type()
+                                              << " as its output is a view of its input" << std::endl);
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
@@ -1658,6 +1822,18 @@ std::unique_ptr<IFunction> create_strided_slice_layer(StridedSliceLayerNode &nod
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    const StridedSliceLayerInfo slice_info = node.strided_slice_info();
+    Coordinates                 view_coords;
+    if (arm_compute::helpers::tensor_transform::is_strided_slice_view(
+            node.input(0)->desc().shape, node.starts(), node.ends(), node.strides(), slice_info.begin_mask(),
+            slice_info.end_mask(), slice_info.shrink_axis_mask(), view_coords) &&
+        is_output_view_of_input(node, view_coords))
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Skipped " << node.name() << " Type: " << node.type()
+                                              << " as its output is a view of its input" << std::endl);
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
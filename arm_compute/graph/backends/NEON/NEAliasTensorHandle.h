@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_BACKENDS_NEON_NEALIASTENSORHANDLE_H
+#define ACL_ARM_COMPUTE_GRAPH_BACKENDS_NEON_NEALIASTENSORHANDLE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/graph/ITensorHandle.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** CPU tensor handle reinterpreting the memory of another handle
+ *
+ * The alias describes the memory of its parent with its own shape, data type and quantization info, which lets
+ * operators that don't move their elements, for example a reshape, run in-place.
+ */
+class NEAliasTensorHandle final : public ITensorHandle
+{
+public:
+    /** Default constructor
+     *
+     * @param[in] parent_handle Parent tensor handle, must be dense and have the same size in bytes as the alias
+     * @param[in] info          Tensor info of the alias
+     */
+    NEAliasTensorHandle(ITensorHandle *parent_handle, const ITensorInfo &info);
+    /** Destructor */
+    ~NEAliasTensorHandle() = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEAliasTensorHandle(const NEAliasTensorHandle &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEAliasTensorHandle &operator=(const NEAliasTensorHandle &) = delete;
+
+    // Inherited overridden methods
+    void                        allocate() override;
+    void                        free() override;
+    void                        manage(IMemoryGroup *mg) override;
+    void                        map(bool blocking) override;
+    void                        unmap() override;
+    void                        release_if_unused() override;
+    arm_compute::ITensor       &tensor() override;
+    const arm_compute::ITensor &tensor() const override;
+    ITensorHandle              *parent_handle() override;
+    bool                        is_subtensor() const override;
+    Target                      target() const override;
+
+private:
+    /** Tensor reading the buffer of the parent at each access, as the memory of managed tensors is bound on acquire */
+    class AliasTensor final : public arm_compute::ITensor
+    {
+    public:
+        /** Constructor
+         *
+         * @param[in] parent Parent tensor
+         * @param[in] info   Tensor info of the alias
+         */
+        AliasTensor(arm_compute::ITensor *parent, const ITensorInfo &info);
+
+        // Inherited overridden methods
+        ITensorInfo *info() const override;
+        ITensorInfo *info() override;
+        uint8_t     *buffer() const override;
+
+    private:
+        arm_compute::ITensor *_parent;
+        mutable TensorInfo    _info;
+    };
+
+    AliasTensor    _alias;         /**< Backend alias tensor */
+    ITensorHandle *_parent_handle; /**< Parent handle */
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_BACKENDS_NEON_NEALIASTENSORHANDLE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2025 Arm Limited.
+ * Copyright (c) 2018-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,9 @@
  */
 
 #include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/IWeightsManager.h"
 
@@ -83,6 +86,25 @@ inline bool is_in_place_operation(void *input, void *output)
     return (output == nullptr) || (input == output);
 }
 
+/** Checks if a tensor is a view over some of the channels of a wider NHWC tensor
+ *
+ * The rows of such a view are strided by the channels of its parent, only the functions honouring the strides of
+ * their destination can write to it.
+ *
+ * @param[in] tensor Tensor to check
+ *
+ * @return True if the tensor is a channel slice of its parent, else false
+ */
+inline bool is_channel_slice(Tensor *tensor)
+{
+    ITensorHandle *handle = tensor != nullptr ? tensor->handle() : nullptr;
+    if (handle == nullptr || !handle->is_subtensor() || tensor->desc().layout != DataLayout::NHWC)
+    {
+        return false;
+    }
+    return handle->parent_handle()->tensor().info()->dimension(0) != handle->tensor().info()->dimension(0);
+}
+
 /** Returns the memory manager for a given target
  *
  * @param[in] ctx    Graph context containing memory management metadata
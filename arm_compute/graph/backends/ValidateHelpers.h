@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -104,6 +104,30 @@ Status validate_bounding_box_transform_layer(BoundingBoxTransformLayerNode &node
     return BoundingBoxTransformLayer::validate(input, output, deltas, bbox_info);
 }
 
+/** Validates a Cast layer node
+ *
+ * @tparam CastLayer Cast layer function type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename CastLayer>
+Status validate_cast_layer(CastLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating CastLayer node with ID : " << node.id() << " and Name: " << node.name()
+                                                                         << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input  = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *output = get_backing_tensor_info(node.output(0));
+    const ConvertPolicy       policy = node.convert_policy();
+
+    return CastLayer::validate(input, output, policy);
+}
+
 /** Validates a Channel Shuffle layer node
  *
  * @tparam ChannelShuffleLayer  Channel Shuffle layer function type
@@ -332,6 +356,57 @@ Status validate_detection_post_process_layer(DetectionPostProcessLayerNode &node
     return DetectionPostProcessLayer::validate(input0, input1, input2, output0, output1, output2, output3, detect_info);
 }
 
+/** Validates a fused copy program node
+ *
+ * @tparam CopyProgram Copy program function type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename CopyProgram>
+Status validate_fused_copy_program_layer(FusedCopyProgramNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedCopyProgramLayer node with ID : " << node.id() << " and Name: "
+                                                                                      << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input  = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *output = get_backing_tensor_info(node.output(0));
+
+    return CopyProgram::validate(input, output, node.program());
+}
+
+/** Validates a fused elementwise chain node
+ *
+ * @tparam ElementwiseChain Elementwise chain function type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename ElementwiseChain>
+Status validate_fused_elementwise_chain_layer(FusedElementwiseChainNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedElementwiseChainLayer node with ID : " << node.id() << " and Name: "
+                                                                                           << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input  = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *output = get_backing_tensor_info(node.output(0));
+
+    std::vector<const arm_compute::ITensorInfo *> operands;
+    for (size_t i = 1; i < node.num_inputs(); ++i)
+    {
+        operands.push_back(get_backing_tensor_info(node.input(i)));
+    }
+
+    return ElementwiseChain::validate(input, operands, output, node.chain());
+}
+
 /** Validates a Generate Proposals layer node
  *
  * @tparam GenerateProposalsLayer Generate Proposals layer type
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,8 @@
  * @publicapi
  */
 
+#include <map>
+#include <utility>
 #include <vector>
 
 namespace arm_compute
@@ -50,6 +52,19 @@ namespace detail
  * @param[in] workload Workload to configure
  */
 void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload &workload);
+
+/** Lifetimes of the transition handles, as the indices of the tasks acquiring and releasing the handles */
+using TransitionLifetimes = std::map<ITensorHandle *, std::pair<int, int>>;
+
+/** Computes the lifetimes the transition manager plans for the handles of a workload
+ *
+ * @param[in] g        Graph of the workload
+ * @param[in] ctx      Graph context
+ * @param[in] workload Workload whose tasks are in execution order
+ *
+ * @return The lifetimes of the managed handles. The handles that are never released end with the maximum index
+ */
+TransitionLifetimes compute_transition_lifetimes(Graph &g, GraphContext &ctx, ExecutionWorkload &workload);
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,13 @@
 
 #include "arm_compute/graph/Types.h"
 
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
 namespace arm_compute
 {
 namespace graph
@@ -37,12 +44,17 @@ namespace graph
 // Forward declarations
 class Graph;
 class GraphContext;
+class SharedWeightsContext;
+struct ExecutionTask;
 struct ExecutionWorkload;
 class Tensor;
 class INode;
 
 namespace detail
 {
+// Forward declarations
+struct ConstTensorUpload;
+
 /** Validates all nodes
  *
  * @param[in] g Graph to validate
@@ -53,6 +65,14 @@ void validate_all_nodes(Graph &g);
  * @param[in] g Graph to configure
  */
 void configure_all_tensors(Graph &g);
+/** Replaces the backend tensors of the const nodes with the ones shared with other graphs
+ *
+ * @note The tensors of the graph which shares them first keep their accessor to fill them, the other ones drop it
+ *
+ * @param[in, out] g              Graph to share the const tensors of
+ * @param[in, out] shared_weights Context of the shared weights
+ */
+void share_const_tensors(Graph &g, SharedWeightsContext &shared_weights);
 /** Allocates all input tensors of a node.
  *
  * @param[in] node Node to allocate the input tensor of
@@ -63,6 +83,11 @@ void allocate_all_input_tensors(INode &node);
  * @param[in] node Node to allocate the output tensor of
  */
 void allocate_all_output_tensors(INode &node);
+/** Allocates the output tensors of a const node, importing the memory of their accessors when supported
+ *
+ * @param[in] node Const node to allocate the output tensor of
+ */
+void import_or_allocate_const_tensors(INode &node);
 /** Allocates const tensor of a given graph
  *
  * @param[in] g Graph to allocate the tensors
@@ -73,6 +98,19 @@ void allocate_const_tensors(Graph &g);
  * @param[in] g Graph to allocate the tensors
  */
 void allocate_all_tensors(Graph &g);
+/** Configures the function of a node and adds its task to a workload
+ *
+ * @param[in, out] node     Node to configure
+ * @param[in]      ctx      Graph context to use
+ * @param[in, out] workload Workload to add the task to. Nothing is added if the node has no function
+ */
+void add_node_task(INode &node, GraphContext &ctx, ExecutionWorkload &workload);
+/** Adds the tensors of the input and output nodes of a graph to a workload
+ *
+ * @param[in]      g        Graph of the workload
+ * @param[in, out] workload Workload to add the input and output tensors to
+ */
+void add_workload_io_tensors(Graph &g, ExecutionWorkload &workload);
 /** Configures all nodes of graph
  *
  * @param[in, out] g          Graph to configure the nodes
@@ -82,6 +120,23 @@ void allocate_all_tensors(Graph &g);
  * @return The execution workload
  */
 ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order);
+/** Configures the nodes of a graph edited since its workload was configured
+ *
+ * The other nodes keep the tasks of the previous workload, along with the weights their functions prepared.
+ *
+ * @param[in, out] g                  Graph to configure the nodes
+ * @param[in]      ctx                Graph context to use
+ * @param[in]      node_order         The order to configure the nodes
+ * @param[in]      nodes_to_configure Nodes to configure again
+ * @param[in, out] previous_tasks     Tasks of the previous workload by node ID. The tasks kept are moved out
+ *
+ * @return The execution workload
+ */
+ExecutionWorkload configure_edited_nodes(Graph                           &g,
+                                         GraphContext                    &ctx,
+                                         const std::vector<NodeID>       &node_order,
+                                         const std::set<NodeID>          &nodes_to_configure,
+                                         std::map<NodeID, ExecutionTask> &previous_tasks);
 /** Release the memory of all unused const nodes
  *
  * @param[in] g Graph to release the memory from
@@ -97,6 +152,32 @@ void call_tensor_accessor(Tensor *tensor);
  * @param[in] g Graph containing the const nodes
  */
 void call_all_const_node_accessors(Graph &g);
+/** Starts filling the const tensors of the accelerator targets from their accessors on host threads
+ *
+ * Each const tensor gets a host staging copy laid out as its tensor handle, which the accessors fill in parallel while
+ * the graph keeps being configured (e.g. while the kernels are compiled).
+ *
+ * @note The accessors of the staged tensors must be thread safe
+ *
+ * @param[in] g Graph containing the const nodes, with its tensors configured
+ *
+ * @return The upload in progress
+ */
+std::shared_ptr<ConstTensorUpload> start_const_tensor_upload(Graph &g);
+/** Call all const node accessors, uploading the staging copies of the tensors filled by @p upload instead
+ *
+ * Backends with an asynchronous queue (e.g. CL) only enqueue the uploads, which overlap with what is enqueued next
+ * (e.g. the weights reshapes of the prepare stage).
+ *
+ * @param[in]      g      Graph containing the const nodes, with its const tensors allocated
+ * @param[in, out] upload Upload started by @ref start_const_tensor_upload on @p g
+ */
+void call_all_const_node_accessors(Graph &g, ConstTensorUpload &upload);
+/** Waits for the uploads left in flight by @ref call_all_const_node_accessors and releases the staging copies
+ *
+ * @param[in, out] upload Upload to complete
+ */
+void finish_const_tensor_upload(ConstTensorUpload &upload);
 /** Call all input node accessors
  *
  * @param[in] workload Workload to execute
@@ -116,11 +197,40 @@ bool call_all_output_node_accessors(ExecutionWorkload &workload);
  * @param[in] workload Workload to prepare
  */
 void prepare_all_tasks(ExecutionWorkload &workload);
+/** Extracts the data dependencies between the tasks of a workload
+ *
+ * @note Nodes without a task (e.g. inputs, constants or nodes optimized out) are traversed so that dependencies
+ *       through them are preserved.
+ *
+ * @param[in] workload Workload to extract the dependencies of
+ *
+ * @return The indices of the tasks each task depends on, in increasing order
+ */
+std::vector<std::vector<std::size_t>> extract_task_predecessors(const ExecutionWorkload &workload);
 /** Executes all tasks of a workload
  *
  * @param[in] workload Workload to execute
  */
 void call_all_tasks(ExecutionWorkload &workload);
+/** Executes a stream of requests on a workload keeping several requests in flight
+ *
+ * Input accessors fill staging copies of the input tensors on a dedicated thread and output accessors drain staging
+ * copies of the output tensors on another one, so both overlap with the computation of the neighbouring requests.
+ * The staging tensors of the in-flight requests are allocated through a @ref MemoryManagerOnDemand.
+ * On backends with an asynchronous queue (e.g. CL), the staging copies are uploaded and read back with non-blocking
+ * transfers ordered with the kernels by the queue: the host enqueues the next request without waiting for the current
+ * one to complete.
+ *
+ * @note As input accessors run ahead of the computation, up to @p depth requests can be read after an output accessor
+ *       has requested the stream to stop.
+ *
+ * @param[in] workload  Workload to execute
+ * @param[in] depth     Number of requests in flight
+ * @param[in] run_tasks Function executing all the tasks of the workload for a single request
+ */
+void call_all_tasks_pipelined(ExecutionWorkload                              &workload,
+                              unsigned int                                    depth,
+                              const std::function<void(ExecutionWorkload &)> &run_tasks);
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
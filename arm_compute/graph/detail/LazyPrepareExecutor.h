@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_DETAIL_LAZYPREPAREEXECUTOR_H
+#define ACL_ARM_COMPUTE_GRAPH_DETAIL_LAZYPREPAREEXECUTOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+struct ExecutionWorkload;
+
+namespace detail
+{
+/** Executes the tasks of a workload sequentially, preparing each task on its first use
+ *
+ * Instead of preparing all the tasks before the first execution, the tasks are prepared in execution order while the
+ * workload runs. A background thread prepares the tasks up to a given distance ahead of the task being executed, so
+ * that the transformation of the weights of the next nodes overlaps with the computation of the current one. The
+ * original weights of a node are released as soon as its task is prepared, which lowers the peak memory usage during
+ * the first execution.
+ *
+ * Once all the tasks are prepared the background thread exits and the workload runs as with @ref call_all_tasks.
+ *
+ * @note The background thread needs a library built with thread local schedulers (ARM_COMPUTE_THREAD_LOCAL_SCHEDULER)
+ *       to prepare with its own scheduler. Without them, or with a prefetch distance of 0, the tasks are prepared by
+ *       the thread executing the workload, just before running them.
+ */
+class LazyPrepareExecutor final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] workload          Workload whose tasks are prepared lazily.
+     * @param[in] prefetch_distance Number of tasks prepared ahead of the task being executed.
+     */
+    LazyPrepareExecutor(ExecutionWorkload &workload, unsigned int prefetch_distance);
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    LazyPrepareExecutor(const LazyPrepareExecutor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    LazyPrepareExecutor &operator=(const LazyPrepareExecutor &) = delete;
+    /** Destructor: joins the prepare thread */
+    ~LazyPrepareExecutor();
+    /** Execute all the tasks of the workload, preparing the ones not prepared yet
+     *
+     * @note If the preparation of a task throws, the exception is rethrown, prefetching stops and the task is prepared
+     *       again on the next execution.
+     *
+     * @param[in] workload Workload to execute. Must be the one the executor has been created with.
+     */
+    void run(ExecutionWorkload &workload);
+    /** Checks if all the tasks have been prepared
+     *
+     * @return True if the workload runs without preparing tasks anymore
+     */
+    bool is_prepared() const;
+
+private:
+    enum class TaskState
+    {
+        Unprepared,
+        Preparing,
+        Prepared
+    };
+
+    void        prepare_thread(unsigned int num_threads);
+    void        prepare_task(std::size_t task_id);
+    void        ensure_prepared(std::size_t task_id);
+    std::size_t find_unprepared(std::size_t end) const;
+
+    ExecutionWorkload      *_workload;            /**< Workload whose tasks are prepared */
+    unsigned int            _prefetch_distance;   /**< Number of tasks prepared ahead of the executed one */
+    std::vector<TaskState>  _state;               /**< Preparation state of each task */
+    std::thread             _thread{};            /**< Prepare thread */
+    mutable std::mutex      _mtx{};               /**< Protects the preparation state below */
+    std::condition_variable _cv_request{};        /**< Signals the prepare thread that more tasks can be prepared */
+    std::condition_variable _cv_prepared{};       /**< Signals the completion of a preparation */
+    std::size_t             _first_unprepared{0}; /**< No task before this index is left unprepared */
+    std::size_t             _limit{0};            /**< Tasks before this index can be prepared ahead */
+    std::size_t             _num_prepared{0};     /**< Number of tasks prepared */
+    bool                    _stop{false};         /**< Request the prepare thread to exit */
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_DETAIL_LAZYPREPAREEXECUTOR_H
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_DETAIL_PARALLELTASKEXECUTOR_H
+#define ACL_ARM_COMPUTE_GRAPH_DETAIL_PARALLELTASKEXECUTOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+struct ExecutionWorkload;
+
+namespace detail
+{
+/** Executes the tasks of a workload concurrently while respecting the data dependencies between them
+ *
+ * Every branch is run by a dedicated thread which owns a scheduler with its own share of the CPU threads, so that
+ * independent nodes (e.g. the branches of an Inception module) are computed at the same time instead of one after the
+ * other.
+ *
+ * @note Requires a library built with thread local schedulers (ARM_COMPUTE_THREAD_LOCAL_SCHEDULER) so that each
+ *       branch thread can use its own scheduler.
+ * @note The tensors of the workload must not share memory between nodes that can run concurrently, i.e. the transition
+ *       memory manager must be disabled and the function memory manager needs a pool per branch.
+ */
+class ParallelTaskExecutor final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] workload               Workload whose tasks dependencies are extracted.
+     * @param[in] num_branches           Number of tasks that can run concurrently.
+     * @param[in] num_threads_per_branch Number of CPU threads of the scheduler of each branch.
+     */
+    ParallelTaskExecutor(const ExecutionWorkload &workload, unsigned int num_branches, unsigned int num_threads_per_branch);
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    ParallelTaskExecutor(const ParallelTaskExecutor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    ParallelTaskExecutor &operator=(const ParallelTaskExecutor &) = delete;
+    /** Destructor: joins the branch threads */
+    ~ParallelTaskExecutor();
+    /** Execute all the tasks of the workload and wait for their completion
+     *
+     * @note If a task throws, no new task is started and the exception is rethrown once the running tasks are complete.
+     *
+     * @param[in] workload Workload to execute. Must be the one the executor has been created with.
+     */
+    void run(ExecutionWorkload &workload);
+    /** Returns the number of tasks that can run concurrently
+     *
+     * @return Number of branches
+     */
+    unsigned int num_branches() const;
+
+private:
+    void branch_thread(unsigned int num_threads);
+    void complete_task(std::size_t task_id);
+
+    std::vector<std::vector<std::size_t>> _successors;       /**< Tasks depending on each task */
+    std::vector<unsigned int>             _num_predecessors; /**< Number of tasks each task depends on */
+    std::vector<std::thread>              _threads;          /**< Branch threads */
+
+    std::mutex                _mtx;                 /**< Protects the run state below */
+    std::condition_variable   _cv_ready;            /**< Signals new ready tasks to the branch threads */
+    std::condition_variable   _cv_done;             /**< Signals the completion of a task to the caller */
+    ExecutionWorkload        *_workload{nullptr};   /**< Workload being executed */
+    std::vector<unsigned int> _pending{};           /**< Number of predecessors each task is still waiting for */
+    std::deque<std::size_t>   _ready{};             /**< Tasks ready to be executed */
+    std::size_t               _num_completed{0};    /**< Number of tasks completed in the current run */
+    unsigned int              _num_running{0};      /**< Number of tasks currently executing */
+    std::exception_ptr        _exception{nullptr};  /**< First exception thrown in the current run */
+    bool                      _stop{false};         /**< Request the branch threads to exit */
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_DETAIL_PARALLELTASKEXECUTOR_H
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_DETAIL_PIPELINESTAGEEXECUTOR_H
+#define ACL_ARM_COMPUTE_GRAPH_DETAIL_PIPELINESTAGEEXECUTOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+class GraphContext;
+class Tensor;
+struct ExecutionWorkload;
+
+namespace detail
+{
+/** Executes a stream of requests through a graph split into pipeline stages
+ *
+ * The nodes, in topological order, are split into contiguous stages of balanced estimated cost. Every stage is run by
+ * a dedicated thread which owns a scheduler pinned to its own cores, so that consecutive requests are computed by the
+ * stages at the same time without synchronizing all the cores after each layer. A stage reads the tensors produced by
+ * the previous stages from its own copies, filled from a ring of transition buffers written by the producing stages.
+ *
+ * @note Requires a library built with thread local schedulers (ARM_COMPUTE_THREAD_LOCAL_SCHEDULER) so that each
+ *       stage thread can use its own scheduler.
+ * @note The tensors of the workload must not share memory between stages, i.e. the transition memory manager must be
+ *       disabled and the function memory manager needs a pool per stage.
+ */
+class PipelineStageExecutor final
+{
+public:
+    /** Constructor: splits the nodes into stages
+     *
+     * The nodes writing to the same memory, like the inputs of a concatenation optimized out, are kept in one stage.
+     *
+     * @param[in] g          Graph to split, on which the backend passes have been run.
+     * @param[in] node_order Nodes of the graph in topological order.
+     * @param[in] num_stages Number of stages. Fewer stages are used if the nodes cannot be split in as many.
+     */
+    PipelineStageExecutor(Graph &g, const std::vector<NodeID> &node_order, unsigned int num_stages);
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    PipelineStageExecutor(const PipelineStageExecutor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    PipelineStageExecutor &operator=(const PipelineStageExecutor &) = delete;
+    /** Destructor: joins the stage threads */
+    ~PipelineStageExecutor();
+    /** Configures all the nodes of the graph, the ones of each stage reading the tensors of the other stages from
+     *  the copies of the stage
+     *
+     * @param[in, out] g          Graph the executor has been created with
+     * @param[in]      ctx        Graph context to use
+     * @param[in]      node_order The order to configure the nodes, the one the executor has been created with
+     *
+     * @return The execution workload, its tasks in the order of the stages
+     */
+    ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order);
+    /** Allocates the copies of the tensors and the transition buffers, then spawns the stage threads
+     *
+     * @param[in] num_threads_per_stage Number of CPU threads of the scheduler of each stage.
+     */
+    void start(unsigned int num_threads_per_stage);
+    /** Executes the tasks of the workload once, stage after stage, without calling the accessors
+     *
+     * @param[in] workload Workload to execute. Must be the one configured by the executor.
+     */
+    void run(ExecutionWorkload &workload);
+    /** Executes the workload on requests until an input or an output accessor returns false
+     *
+     * The input accessors are called by the first stage and the output accessors by the last one.
+     *
+     * @note If a task or an accessor throws, the stages stop and the exception is rethrown once they all stopped.
+     *
+     * @param[in] workload Workload to execute. Must be the one configured by the executor.
+     */
+    void run_stream(ExecutionWorkload &workload);
+    /** Returns the number of stages
+     *
+     * @return Number of stages
+     */
+    unsigned int num_stages() const;
+
+private:
+    /** Tensor of a stage produced by another stage */
+    struct StageImport
+    {
+        Tensor                                           *tensor{nullptr}; /**< Tensor of the graph */
+        unsigned int                                      producer{0};     /**< Stage producing the tensor */
+        std::unique_ptr<ITensorHandle>                    handle{nullptr}; /**< Copy read by the stage */
+        std::vector<std::unique_ptr<arm_compute::Tensor>> ring{};          /**< Transition buffers, by request */
+    };
+
+    void           run_frames(ExecutionWorkload &workload, bool call_accessors);
+    void           stage_thread(unsigned int stage, unsigned int num_threads, std::vector<int> cores);
+    void           run_stage(unsigned int stage);
+    bool           receive_imports(unsigned int stage, unsigned int frame);
+    bool           send_exports(unsigned int stage, unsigned int frame);
+    ITensorHandle *stage_handle(Tensor *tensor, unsigned int stage);
+
+    std::map<NodeID, unsigned int>                   _node_stages;  /**< Stage of each node */
+    std::vector<std::vector<StageImport>>            _imports;      /**< Tensors produced by other stages, by stage */
+    std::vector<std::pair<std::size_t, std::size_t>> _task_ranges;  /**< Range of the tasks of each stage */
+    std::vector<std::thread>                         _threads;      /**< Stage threads */
+    unsigned int                                     _ring_size{2}; /**< Number of transition buffers of each copy */
+
+    std::mutex                _mtx;                   /**< Protects the run state below */
+    std::condition_variable   _cv;                    /**< Signals the progress of the stages */
+    ExecutionWorkload        *_workload{nullptr};     /**< Workload being executed */
+    bool                      _call_accessors{false}; /**< Whether the requests are read and written by the accessors */
+    unsigned int              _generation{0};         /**< Number of runs started */
+    unsigned int              _num_frames{0};         /**< Number of requests of the run, known once the inputs end */
+    unsigned int              _num_finished{0};       /**< Number of stages done with the current run */
+    std::vector<unsigned int> _received{};            /**< Number of requests each stage has copied in */
+    std::vector<unsigned int> _completed{};           /**< Number of requests each stage has computed */
+    std::exception_ptr        _exception{nullptr};    /**< First exception thrown in the current run */
+    bool                      _stop_run{false};       /**< Request the stages to abandon the current run */
+    bool                      _stop{false};           /**< Request the stage threads to exit */
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_DETAIL_PIPELINESTAGEEXECUTOR_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -518,7 +518,7 @@ public:
         return GraphBuilder::add_depthwise_convolution_node(
             s.graph(), common_params, input, Size2D(_conv_width, _conv_height), _conv_info, _depth_multiplier,
             s.hints().depthwise_convolution_method_hint, std::move(_weights), std::move(_bias),
-            std::move(_weights_quant_info), std::move(_out_quant_info));
+            std::move(_weights_quant_info), std::move(_out_quant_info), s.hints().fast_math_hint);
     }
 
 private:
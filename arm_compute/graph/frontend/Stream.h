@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2025 Arm Limited.
+ * Copyright (c) 2018-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -66,6 +66,27 @@ public:
     void finalize(Target target, const GraphConfig &config);
     /** Executes the stream **/
     void run();
+    /** Removes the one-off costs of the first execution of a finalized stream
+     *
+     * @param[in] run_dummy_iteration (Optional) Run the stream once on zeroed inputs. Defaults to true
+     *
+     * @see GraphManager::warm_up
+     */
+    void warm_up(bool run_dummy_iteration = true);
+    /** Reshapes the inputs of a finalized stream
+     *
+     * @param[in] input_shapes Shapes of the inputs, in the order they were added to the stream
+     *
+     * @see GraphManager::reshape_inputs
+     */
+    void reshape_inputs(const std::vector<TensorShape> &input_shapes);
+    /** Updates a finalized stream after an edit of its graph
+     *
+     * @param[in] edited_nodes (Optional) Nodes whose parameters were changed in place
+     *
+     * @see GraphManager::update_graph
+     */
+    void update(const std::vector<NodeID> &edited_nodes = {});
 
     // Inherited overridden methods
     void         add_layer(ILayer &layer) override;
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_MUTATORS_MIXEDPRECISIONMUTATOR_H
+#define ACL_ARM_COMPUTE_GRAPH_MUTATORS_MIXEDPRECISIONMUTATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/IGraphMutator.h"
+#include "arm_compute/graph/Types.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Mutation pass selecting the data type of each layer of a F32 graph
+ *
+ * Layers are computed in the data type the policy gives them, or in its default data type.
+ * Convolution and fully connected layers with constant weights can run in QASYMM8_SIGNED when the policy has the
+ * calibrated ranges of their input, output and weights: the layers explicitly asked for are converted first, then
+ * the least sensitive layers are added while their accumulated sensitivity fits in the accuracy budget.
+ * Layers that only move or select values follow the data type of their inputs, the other layers keep their original
+ * data type. BF16 layers are computed in F32 with fast math enabled, which lets the backends use BF16 arithmetic.
+ * Cast, quantization and dequantization nodes are inserted where data types change, while constants are converted
+ * when they are loaded.
+ */
+class MixedPrecisionMutator final : public IGraphMutator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] policy Mixed precision policy
+     * @param[in] target (Optional) Target the graph runs on. Defaults to Target::NEON
+     */
+    MixedPrecisionMutator(MixedPrecisionPolicy policy, Target target = Target::NEON);
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char  *name() override;
+
+private:
+    MixedPrecisionPolicy _policy;
+    Target               _target;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_MUTATORS_MIXEDPRECISIONMUTATOR_H
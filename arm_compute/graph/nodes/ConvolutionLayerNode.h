@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -99,6 +99,11 @@ public:
      * @param[in] info Convolution info to set
      */
     void set_convolution_info(PadStrideInfo info);
+    /** Sets the output quantization info
+     *
+     * @param[in] out_quant_info Output quantization info to set
+     */
+    void set_output_quant_info(QuantizationInfo out_quant_info);
     /** Computes convolution output descriptor
      *
      * @param[in] input_descriptor   Input descriptor
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2025 Arm Limited.
+ * Copyright (c) 2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,14 +43,19 @@ class DequantizationLayerNode final : public INode
 {
 public:
     /** Constructor
+     *
+     * @param[in] out_data_type (Optional) Output data type. Defaults to DataType::F32
      */
-    DequantizationLayerNode();
+    DequantizationLayerNode(DataType out_data_type = DataType::F32);
 
     // Inherited overridden methods:
     NodeType         type() const override;
     bool             forward_descriptors() override;
     TensorDescriptor configure_output(size_t idx) const override;
     void             accept(INodeVisitor &v) override;
+
+private:
+    DataType _out_data_type;
 };
 } // namespace graph
 } // namespace arm_compute
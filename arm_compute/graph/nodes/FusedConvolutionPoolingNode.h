@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDCONVOLUTIONPOOLINGNODE_H
+#define ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDCONVOLUTIONPOOLINGNODE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Fused Convolution Pooling node
+ *
+ * Pools the result of a convolution without writing it back to memory. Inputs are the convolution input, weights and
+ * optional biases, the output is the result of the pooling.
+ */
+class FusedConvolutionPoolingNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] conv_info        Convolution layer attributes
+     * @param[in] pool_info        Pooling layer attributes
+     * @param[in] fast_math_hint   (Optional) Fast math hint
+     * @param[in] fused_activation (Optional) Activation applied to the result of the convolution
+     */
+    FusedConvolutionPoolingNode(PadStrideInfo       conv_info,
+                                PoolingLayerInfo    pool_info,
+                                FastMathHint        fast_math_hint   = FastMathHint::Disabled,
+                                ActivationLayerInfo fused_activation = ActivationLayerInfo());
+    /** Fast math hint accessor
+     *
+     * @return Fast math hint to be used by the node
+     */
+    FastMathHint fast_math_hint() const;
+    /** Convolution metadata accessor
+     *
+     * @return Convolution information
+     */
+    PadStrideInfo convolution_info() const;
+    /** Pooling metadata accessor
+     *
+     * @return Pooling information
+     */
+    PoolingLayerInfo pooling_info() const;
+    /** Returns fused activation
+     *
+     * @return Fused activation
+     */
+    ActivationLayerInfo fused_activation() const;
+    /** Sets fused activation
+     *
+     * @param[in] fused_activation Fused activation to set
+     */
+    void set_fused_activation(ActivationLayerInfo fused_activation);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+    static constexpr NodeType node_type = NodeType::FusedConvolutionPoolingLayer;
+
+private:
+    PadStrideInfo       _conv_info;
+    PoolingLayerInfo    _pool_info;
+    FastMathHint        _fast_math_hint;
+    ActivationLayerInfo _fused_activation;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDCONVOLUTIONPOOLINGNODE_H
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDCOPYPROGRAMNODE_H
+#define ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDCOPYPROGRAMNODE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/function_info/CopyProgramInfo.h"
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Fused Copy Program node
+ *
+ * Performs a sequence of data movements (reshapes, permutations and slices) in a single pass.
+ */
+class FusedCopyProgramNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] program    Data movements to apply, in order
+     * @param[in] out_layout (Optional) Output data layout. Defaults to the data layout of the input
+     */
+    FusedCopyProgramNode(CopyProgramInfo program, DataLayout out_layout = DataLayout::UNKNOWN);
+    /** Data movements of the program accessor
+     *
+     * @return The data movements applied by the node, in order
+     */
+    const CopyProgramInfo &program() const;
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+    static constexpr NodeType node_type = NodeType::FusedCopyProgramLayer;
+
+private:
+    CopyProgramInfo _program;
+    DataLayout      _out_layout;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDCOPYPROGRAMNODE_H
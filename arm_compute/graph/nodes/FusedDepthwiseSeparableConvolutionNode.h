@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDDEPTHWISESEPARABLECONVOLUTIONNODE_H
+#define ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDDEPTHWISESEPARABLECONVOLUTIONNODE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Fused Depthwise Separable Convolution node
+ *
+ * Computes a pointwise convolution on the result of a depthwise convolution without writing it back to memory.
+ * Inputs are the depthwise input, weights and optional biases followed by the pointwise weights and optional biases,
+ * the output is the result of the pointwise convolution. The optional expansion weights and biases at inputs 5 and 6
+ * make the depthwise convolution read the result of a pointwise convolution of input 0, as in inverted residual
+ * blocks.
+ */
+class FusedDepthwiseSeparableConvolutionNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] depthwise_info       Depthwise convolution layer attributes
+     * @param[in] depth_multiplier     Multiplier to apply to the input's depth in order to retrieve the depthwise output's depth
+     * @param[in] depthwise_activation Activation applied to the result of the depthwise convolution
+     * @param[in] pointwise_info       Pointwise convolution layer attributes
+     * @param[in] fast_math_hint       (Optional) Fast math hint of the pointwise convolution
+     * @param[in] fused_activation     (Optional) Activation applied to the result of the pointwise convolution
+     */
+    FusedDepthwiseSeparableConvolutionNode(PadStrideInfo       depthwise_info,
+                                           int                 depth_multiplier,
+                                           ActivationLayerInfo depthwise_activation,
+                                           PadStrideInfo       pointwise_info,
+                                           FastMathHint        fast_math_hint   = FastMathHint::Disabled,
+                                           ActivationLayerInfo fused_activation = ActivationLayerInfo());
+    /** Depthwise convolution metadata accessor
+     *
+     * @return Depthwise convolution information
+     */
+    PadStrideInfo depthwise_convolution_info() const;
+    /** Depth multiplier accessor
+     *
+     * @return Depth multiplier of the depthwise convolution
+     */
+    int depth_multiplier() const;
+    /** Depthwise activation accessor
+     *
+     * @return Activation applied to the result of the depthwise convolution
+     */
+    ActivationLayerInfo depthwise_activation() const;
+    /** Pointwise convolution metadata accessor
+     *
+     * @return Pointwise convolution information
+     */
+    PadStrideInfo pointwise_convolution_info() const;
+    /** Fast math hint accessor
+     *
+     * @return Fast math hint to be used by the node
+     */
+    FastMathHint fast_math_hint() const;
+    /** Returns fused activation
+     *
+     * @return Fused activation
+     */
+    ActivationLayerInfo fused_activation() const;
+    /** Sets fused activation
+     *
+     * @param[in] fused_activation Fused activation to set
+     */
+    void set_fused_activation(ActivationLayerInfo fused_activation);
+    /** Expansion activation accessor
+     *
+     * @return Activation applied to the result of the expansion convolution, if any
+     */
+    ActivationLayerInfo expansion_activation() const;
+    /** Sets the expansion activation
+     *
+     * @param[in] expansion_activation Activation applied to the result of the expansion convolution
+     */
+    void set_expansion_activation(ActivationLayerInfo expansion_activation);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+    static constexpr NodeType node_type = NodeType::FusedDepthwiseSeparableConvolutionLayer;
+
+private:
+    PadStrideInfo       _depthwise_info;
+    int                 _depth_multiplier;
+    ActivationLayerInfo _depthwise_activation;
+    PadStrideInfo       _pointwise_info;
+    FastMathHint        _fast_math_hint;
+    ActivationLayerInfo _fused_activation;
+    ActivationLayerInfo _expansion_activation;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDDEPTHWISESEPARABLECONVOLUTIONNODE_H
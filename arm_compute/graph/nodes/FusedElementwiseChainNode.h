@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDELEMENTWISECHAINNODE_H
+#define ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDELEMENTWISECHAINNODE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Fused Elementwise Chain node
+ *
+ * Evaluates a sequence of elementwise operations in a single pass. Input 0 is the input of the chain, the following
+ * inputs are the operands of the binary operations.
+ */
+class FusedElementwiseChainNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] chain          Operations to apply, in order
+     * @param[in] num_operands   Number of operand tensors of the binary operations
+     * @param[in] out_data_type  (Optional) Output data type. Defaults to the data type of the input
+     * @param[in] out_quant_info (Optional) Output quantization info when the chain ends with a quantization
+     */
+    FusedElementwiseChainNode(ElementwiseChainInfo chain,
+                              unsigned int         num_operands,
+                              DataType             out_data_type  = DataType::UNKNOWN,
+                              QuantizationInfo     out_quant_info = QuantizationInfo());
+    /** Operations of the chain accessor
+     *
+     * @return The operations applied by the node, in order
+     */
+    const ElementwiseChainInfo &chain() const;
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+    static constexpr NodeType node_type = NodeType::FusedElementwiseChainLayer;
+
+private:
+    ElementwiseChainInfo _chain;
+    DataType             _out_data_type;
+    QuantizationInfo     _out_quant_info;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDELEMENTWISECHAINNODE_H
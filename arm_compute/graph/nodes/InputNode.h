@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,6 +43,13 @@ public:
      * @param[in] desc Tensor descriptor
      */
     InputNode(TensorDescriptor desc);
+    /** Sets the shape of the input
+     *
+     * @note The descriptors of the graph have to be forwarded again from the input
+     *
+     * @param[in] shape Shape of the input
+     */
+    void set_shape(const TensorShape &shape);
 
     // Inherited overridden methods:
     NodeType         type() const override;
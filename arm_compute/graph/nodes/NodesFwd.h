@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,7 @@ class ActivationLayerNode;
 class ArgMinMaxLayerNode;
 class BatchNormalizationLayerNode;
 class BoundingBoxTransformLayerNode;
+class CastLayerNode;
 class ChannelShuffleLayerNode;
 class ConcatenateLayerNode;
 class ConstNode;
@@ -53,7 +54,12 @@ class EltwiseLayerNode;
 class FlattenLayerNode;
 class FullyConnectedLayerNode;
 class FusedConvolutionBatchNormalizationNode;
+class FusedConvolutionEltwiseAddNode;
+class FusedConvolutionPoolingNode;
+class FusedCopyProgramNode;
 class FusedDepthwiseConvolutionBatchNormalizationNode;
+class FusedDepthwiseSeparableConvolutionNode;
+class FusedElementwiseChainNode;
 class GenerateProposalsLayerNode;
 class InputNode;
 class L2NormalizeLayerNode;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,6 +50,11 @@ public:
      * @return Padding list
      */
     const PaddingList &padding() const;
+    /** Sets the padding list
+     *
+     * @param[in] padding The padding for each dimension of the input tensor
+     */
+    void set_padding(const PaddingList &padding);
     /** Padding value accessor
      *
      * @return Padding value
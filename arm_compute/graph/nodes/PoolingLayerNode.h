@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2025 Arm Limited.
+ * Copyright (c) 2018-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,6 +48,11 @@ public:
      * @return Pooling Layer info
      */
     PoolingLayerInfo pooling_info() const;
+    /** Sets the pooling metadata
+     *
+     * @param[in] info Pooling Layer information
+     */
+    void set_pooling_info(PoolingLayerInfo info);
     /** Computes pooling output descriptor
      *
      * @param[in] input_descriptor Input descriptor
@@ -63,6 +68,9 @@ public:
     TensorDescriptor configure_output(size_t idx) const override;
     void             accept(INodeVisitor &v) override;
 
+public:
+    static constexpr NodeType node_type = NodeType::PoolingLayer;
+
 private:
     PoolingLayerInfo _info;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2025 Arm Limited.
+ * Copyright (c) 2018-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,6 +72,11 @@ public:
      * @return Split axis
      */
     unsigned int axis() const;
+    /** Sets the split axis
+     *
+     * @param[in] axis Axis to split on
+     */
+    void set_axis(int axis);
 
     // Inherited overridden methods:
     Status           validate() const override;
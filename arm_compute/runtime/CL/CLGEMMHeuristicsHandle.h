@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025 Arm Limited.
+ * Copyright (c) 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
  */
 
 #include <memory>
+#include <string>
 
 namespace arm_compute
 {
@@ -61,14 +62,43 @@ public:
      * @return bool Signals if the reload succeeded or failed
      */
     bool reload_from_file(const std::string &filename);
+    /** Save the heuristics to a dotmlgo file
+     *
+     * The GEMM configurations tuned so far are merged with the loaded heuristics, so that the file can be reloaded to
+     * use them in the next runs.
+     *
+     * @param[in] filename Path to the dotmlgo file. (Content will be overwritten)
+     *
+     * @return bool Signals if the file was written
+     */
+    bool save_to_file(const std::string &filename) const;
+    /** Enable the tuning of the GEMM configurations
+     *
+     * When enabled, the reshaped and reshaped only rhs GEMM kernels time the block configurations next to the one
+     * selected by the heuristics while being configured, and use the fastest. Each GEMM shape is only tuned once.
+     *
+     * @param[in] tune_gemm_configs True to tune the GEMM configurations
+     */
+    void set_tune_gemm_configs(bool tune_gemm_configs);
+    /** Tune the configurations of the GEMM kernels ?
+     *
+     * @return True if the tuning of the GEMM configurations is enabled
+     */
+    bool tune_gemm_configs() const;
     /** Return a pointer to underlying heuristics for querying purposes
      *
      * @return MLGOHeuristics*
      */
     const mlgo::MLGOHeuristics *get() const;
+    /** Return a pointer to underlying heuristics to record the tuned configurations
+     *
+     * @return MLGOHeuristics*
+     */
+    mlgo::MLGOHeuristics *get();
 
 private:
-    std::unique_ptr<mlgo::MLGOHeuristics> _heuristics; /**< Pointer to underlying heuristics */
+    std::unique_ptr<mlgo::MLGOHeuristics> _heuristics;        /**< Pointer to underlying heuristics */
+    bool                                  _tune_gemm_configs; /**< Tune the configurations of the GEMM kernels */
 };
 
 } // namespace arm_compute
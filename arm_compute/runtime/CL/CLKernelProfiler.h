@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CL_CLKERNELPROFILER_H
+#define ACL_ARM_COMPUTE_RUNTIME_CL_CLKERNELPROFILER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/CL/OpenCL.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+/** Interface of a source of hardware counters sampled around each kernel profiled by @ref CLKernelProfiler
+ *
+ * This is where a reader of the GPU performance counters, such as the Mali hardware counters, plugs into the
+ * profiler. The command queue is idle when both functions are called, so the counters only cover the kernel.
+ */
+class ICLHardwareCounterSampler
+{
+public:
+    /** Default virtual destructor */
+    virtual ~ICLHardwareCounterSampler() = default;
+    /** Start sampling the counters of a kernel about to be enqueued */
+    virtual void begin_kernel() = 0;
+    /** Stop sampling the counters of the kernel that has just completed
+     *
+     * @return Value of each counter accumulated since @ref ICLHardwareCounterSampler::begin_kernel,
+     *         e.g. "ALU active cycles" or "Bytes read"
+     */
+    virtual std::map<std::string, uint64_t> end_kernel() = 0;
+};
+
+/** Profile of a kernel dispatch */
+struct CLKernelProfile
+{
+    std::string                     name{};       /**< Name of the OpenCL kernel function */
+    std::string                     config_id{};  /**< Configuration ID of the kernel */
+    cl::NDRange                     gws{};        /**< Global workgroup size of the dispatch */
+    cl::NDRange                     lws{};        /**< Local workgroup size of the dispatch */
+    uint64_t                        queued_ns{0}; /**< Device time when the dispatch was enqueued, in nanoseconds */
+    uint64_t                        start_ns{0};  /**< Device time when the dispatch started, in nanoseconds */
+    uint64_t                        end_ns{0};    /**< Device time when the dispatch completed, in nanoseconds */
+    std::map<std::string, uint64_t> counters{};   /**< Hardware counters of the kernel, if a sampler is set */
+};
+
+/** Records the duration and the hardware counters of each kernel run through @ref CLScheduler
+ *
+ * Profiling is enabled with @ref CLScheduler::set_kernel_profiler, which enables profiling on the queue of the
+ * scheduler if needed. Without a counter sampler, kernels are not serialized and only the OpenCL profiling events are
+ * recorded. With a counter sampler, the queue is drained before and after each kernel so the counters can be
+ * attributed to it, which slows the execution down.
+ */
+class CLKernelProfiler final
+{
+public:
+    /** Default constructor */
+    CLKernelProfiler();
+    /** Prevent instances of this class from being copied */
+    CLKernelProfiler(const CLKernelProfiler &) = delete;
+    /** Prevent instances of this class from being copied */
+    CLKernelProfiler &operator=(const CLKernelProfiler &) = delete;
+    /** Default move constructor */
+    CLKernelProfiler(CLKernelProfiler &&);
+    /** Default move assignment operator */
+    CLKernelProfiler &operator=(CLKernelProfiler &&);
+    /** Default destructor */
+    ~CLKernelProfiler();
+    /** Set the source of hardware counters sampled around each kernel
+     *
+     * @param[in] sampler Sampler to use, nullptr to only record the durations. Must outlive the profiling.
+     */
+    void set_counter_sampler(ICLHardwareCounterSampler *sampler);
+    /** Access the profiles recorded so far
+     *
+     * @note This function waits for the recorded kernels to complete.
+     *
+     * @return The profile of each dispatch, in enqueue order
+     */
+    const std::vector<CLKernelProfile> &profiles();
+    /** Discard the recorded profiles */
+    void clear();
+    /** Notify that a kernel is about to be enqueued
+     *
+     * Called by @ref CLScheduler.
+     *
+     * @param[in] queue Command queue the kernel is enqueued on
+     */
+    void begin_kernel(cl::CommandQueue &queue);
+    /** Notify that the kernel passed to @ref CLKernelProfiler::begin_kernel has been enqueued
+     *
+     * Called by @ref CLScheduler.
+     *
+     * @param[in] queue Command queue the kernel has been enqueued on
+     */
+    void end_kernel(cl::CommandQueue &queue);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CL_CLKERNELPROFILER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,8 @@
 #include "arm_compute/runtime/IMemoryRegion.h"
 
 #include <cstddef>
+#include <map>
+#include <utility>
 
 namespace arm_compute
 {
@@ -94,7 +96,10 @@ protected:
     cl::Buffer  _mem;
 };
 
-/** OpenCL buffer memory region implementation */
+/** OpenCL buffer memory region implementation
+ *
+ * Subregions are sub-buffers of the buffer, so their offset must be aligned to @ref get_cl_sub_buffer_alignment.
+ */
 class CLBufferMemoryRegion final : public ICLMemoryRegion
 {
 public:
@@ -112,9 +117,13 @@ public:
     virtual ~CLBufferMemoryRegion() override;
 
     // Inherited methods overridden :
-    void *ptr() final;
-    void *map(cl::CommandQueue &q, bool blocking) final;
-    void  unmap(cl::CommandQueue &q) final;
+    void                          *ptr() final;
+    void                          *map(cl::CommandQueue &q, bool blocking) final;
+    void                           unmap(cl::CommandQueue &q) final;
+    std::unique_ptr<IMemoryRegion> extract_subregion(size_t offset, size_t size) final;
+
+private:
+    std::map<std::pair<size_t, size_t>, cl::Buffer> _sub_buffers{}; /**< Sub-buffers indexed by offset and size */
 };
 
 /** OpenCL SVM memory region interface */
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CL_CLRECORDEDQUEUE_H
+#define ACL_ARM_COMPUTE_RUNTIME_CL_CLRECORDEDQUEUE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <memory>
+
+namespace arm_compute
+{
+/** Records the OpenCL kernels enqueued through @ref CLScheduler to replay them without running the functions again
+ *
+ * The kernels are recorded into a command buffer when the device supports cl_khr_command_buffer, so that a replay is a
+ * single enqueue. Otherwise each dispatch is recorded and replayed on the command queue of the scheduler without
+ * setting the kernel arguments again. As OpenCL kernel arguments stay set between dispatches, this fallback is only
+ * available when every kernel is dispatched once during the recording.
+ *
+ * @note The kernels are still run while being recorded.
+ * @note A recording stays valid while the tensors used by the recorded kernels keep their backing memory and only as
+ *       long as the recorded functions do not enqueue anything but kernels, for example copies or host-side work.
+ * @note Only one recording can be in progress at a time.
+ */
+class CLRecordedQueue final
+{
+public:
+    /** Default constructor */
+    CLRecordedQueue();
+    /** Prevent instances of this class from being copied */
+    CLRecordedQueue(const CLRecordedQueue &) = delete;
+    /** Prevent instances of this class from being copied */
+    CLRecordedQueue &operator=(const CLRecordedQueue &) = delete;
+    /** Default move constructor */
+    CLRecordedQueue(CLRecordedQueue &&);
+    /** Default move assignment operator */
+    CLRecordedQueue &operator=(CLRecordedQueue &&);
+    /** Default destructor */
+    ~CLRecordedQueue();
+    /** Start recording the kernels enqueued through @ref CLScheduler
+     *
+     * @note Any previous recording is discarded.
+     */
+    void begin_recording();
+    /** Stop recording
+     *
+     * @return True if the recording can be replayed
+     */
+    bool end_recording();
+    /** Check whether a recording can be replayed
+     *
+     * @return True if a recording can be replayed
+     */
+    bool is_replayable() const;
+    /** Enqueue the recorded kernels on the command queue of the scheduler
+     *
+     * @return True if the kernels have been enqueued, false if there is no recording that can be replayed,
+     *         in which case the functions have to be run
+     */
+    bool replay();
+    /** Discard the recording */
+    void clear();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CL_CLRECORDEDQUEUE_H
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CL_CLSVMALLOCATOR_H
+#define ACL_ARM_COMPUTE_RUNTIME_CL_CLSVMALLOCATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/IAllocator.h"
+
+#include <cstddef>
+
+namespace arm_compute
+{
+/** OpenCL allocator backed by shared virtual memory
+ *
+ * Regions use fine-grained SVM when the device supports it: the host and the device then access the same
+ * allocation, so mapping a tensor to run CPU functions on it neither copies nor flushes the buffer.
+ * Devices supporting only coarse-grained SVM get coarse-grained regions, and devices without SVM get cl buffers
+ * as with @ref CLBufferAllocator.
+ *
+ * @note The allocator can be set as global allocator of @ref CLTensorAllocator or used to populate memory managers.
+ */
+class CLSVMAllocator final : public IAllocator
+{
+public:
+    /** Default constructor, queries the SVM capabilities of the device */
+    CLSVMAllocator();
+
+    /** Whether the regions use fine-grained SVM
+     *
+     * @return True if the host and the device share the allocations without map and unmap synchronizations
+     */
+    bool is_fine_grained() const;
+
+    // Inherited methods overridden:
+    void                          *allocate(size_t size, size_t alignment) override;
+    void                           free(void *ptr) override;
+    std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    bool _fine_grained;
+    bool _coarse_grained;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CL_CLSVMALLOCATOR_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2016-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,6 +41,8 @@
 
 namespace arm_compute
 {
+class CLKernelProfiler;
+class CLWeightsCache;
 class ICLKernel;
 class ICLTuner;
 /** Provides global access to a CL context and command queue. */
@@ -171,9 +173,42 @@ public:
      */
     void set_tuner(ICLTuner *tuner);
 
+    /** Accessor for the CL tuner used by the scheduler
+     *
+     * @return The tuner in use, nullptr if there is none
+     */
+    ICLTuner *tuner() const;
+
     /** Blocks until all commands in the associated command queue have finished. */
     void sync();
 
+    /** Set the profiler recording the kernels enqueued by the scheduler
+     *
+     * @note Profiling is enabled on the command queue if needed, by replacing it with a queue using the same
+     *       properties plus CL_QUEUE_PROFILING_ENABLE.
+     *
+     * @param[in] profiler Profiler to use, nullptr to stop profiling. Must outlive its use by the scheduler.
+     */
+    void set_kernel_profiler(CLKernelProfiler *profiler);
+
+    /** Accessor for the profiler recording the kernels enqueued by the scheduler
+     *
+     * @return The profiler in use, nullptr if profiling is disabled
+     */
+    CLKernelProfiler *kernel_profiler() const;
+
+    /** Set the cache of transformed weights used by the functions configured with the scheduler
+     *
+     * @param[in] cache Cache to use, nullptr to disable the caching. Must outlive its use by the scheduler.
+     */
+    void set_weights_cache(CLWeightsCache *cache);
+
+    /** Accessor for the cache of transformed weights
+     *
+     * @return The cache in use, nullptr if the caching is disabled
+     */
+    CLWeightsCache *weights_cache() const;
+
     /** Enqueues a marker into the associated command queue and return the event.
      *
      * @return An event that can be waited on to block the executing thread.
@@ -192,6 +227,18 @@ public:
      */
     void enable_job_chaining(int job_chaining_size);
 
+    /** Enable the adaptive job chaining. The number of kernels enqueued between two flushes of the command queue is
+     *  adjusted each time the queue is flushed, depending on whether the GPU was idle.
+     *
+     * The GPU is considered idle if the kernels flushed last time have completed when the queue is flushed again: the
+     * queue is then flushed twice as often. Otherwise one more kernel is enqueued before the next flush.
+     *
+     * @note A marker is enqueued at each flush to sample the GPU activity
+     *
+     * @param[in] max_job_chaining_size Maximum number of kernels to enqueue before flushing
+     */
+    void enable_adaptive_job_chaining(int max_job_chaining_size = 32);
+
     bool is_initialised() const;
 
 private:
@@ -201,6 +248,8 @@ private:
      * @param[in] flush Flush the command queue. Ignored when job chain is enabled.
      */
     void flush_queue(bool flush);
+    /** Adjust the job chaining size according to the GPU activity since the last flush, before flushing the queue */
+    void adapt_job_chaining_size();
 
     /** Flag to ensure symbols initialisation is happening before Scheduler creation */
     static std::once_flag _initialize_symbols;
@@ -215,8 +264,13 @@ private:
     bool                    _job_chaining_enabled;
     int                     _job_chaining_size;
     int                     _job_chaining_count;
+    bool                    _adaptive_job_chaining;
+    int                     _max_job_chaining_size;
+    cl::Event               _flush_marker;
     unsigned int            _enqueue_count;
     unsigned int            _flush_count;
+    CLKernelProfiler       *_kernel_profiler;
+    CLWeightsCache         *_weights_cache;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_CL_CLSCHEDULER_H
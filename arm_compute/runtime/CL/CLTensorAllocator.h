@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2016-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,8 @@
 
 #include <cstdint>
 
+struct AHardwareBuffer;
+
 namespace arm_compute
 {
 class CLTensor;
@@ -128,6 +130,37 @@ public:
      * @return An error status
      */
     Status import_memory(cl::Buffer buffer);
+    /** Import a dma-buf as a tensor's backing memory, without copying it
+     *
+     * @note Requires the cl_arm_import_memory_dma_buf extension.
+     * @note Kernels can read the tensor through an image2d view (e.g. export_input_to_cl_image) only if
+     *       the padding set in ITensorInfo before the import meets the image pitch alignment of the device.
+     * @warning tensor shouldn't be memory managed.
+     * @warning ownership of the file descriptor is not transferred, it must stay open while the tensor is in use.
+     * @warning padding should be accounted by the client code.
+     * @note The first total_size bytes reported by ITensorInfo are imported.
+     *
+     * @param[in] fd File descriptor of the dma-buf
+     *
+     * @return An error status
+     */
+    Status import_dma_buf(int fd);
+    /** Import a plane of an Android hardware buffer as a tensor's backing memory, without copying it
+     *
+     * @note Requires the cl_arm_import_memory_android_hardware_buffer extension.
+     * @note Kernels can read the tensor through an image2d view (e.g. export_input_to_cl_image) only if
+     *       the padding set in ITensorInfo before the import meets the image pitch alignment of the device.
+     * @warning tensor shouldn't be memory managed.
+     * @warning ownership of the buffer is not transferred, it must stay alive while the tensor is in use.
+     * @warning padding should be accounted by the client code.
+     * @note buffer size will be checked to be compliant with total_size reported by ITensorInfo.
+     *
+     * @param[in] buffer Android hardware buffer to be used as backing memory
+     * @param[in] plane  (Optional) Index of the plane to import for multi-planar formats. Defaults to 0
+     *
+     * @return An error status
+     */
+    Status import_android_hardware_buffer(AHardwareBuffer *buffer, unsigned int plane = 0);
     /** Associates the tensor with a memory group
      *
      * @param[in] associated_memory_group Memory group to associate the tensor with
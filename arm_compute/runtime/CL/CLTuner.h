@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2025 Arm Limited.
+ * Copyright (c) 2017-2022, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,9 @@
 #include "arm_compute/runtime/CL/CLTuningParams.h"
 #include "arm_compute/runtime/CL/ICLTuner.h"
 
+#include <map>
+#include <memory>
+#include <string>
 #include <unordered_map>
 
 namespace arm_compute
@@ -53,7 +56,7 @@ public:
     CLTuner(bool tune_new_kernels = true, CLTuningInfo tuning_info = CLTuningInfo());
 
     /** Destructor */
-    ~CLTuner() = default;
+    ~CLTuner();
 
     /** Setter for tune_new_kernels option
      *
@@ -110,6 +113,14 @@ public:
     std::function<decltype(clEnqueueNDRangeKernel)> real_clEnqueueNDRangeKernel;
 
     /** Load the tuning parameters table from file. It also sets up the tuning read from the file
+     *
+     * Tuning files hold a section of parameters per device, identified by its GPU target, driver version and number of
+     * compute units. The parameters of the current device are used or, if it has not been tuned, the parameters of the
+     * nearest device with the same GPU target: same driver version first, then nearest number of compute units.
+     * Sections of other GPU targets are never used, but they are kept when saving. Rows of files without sections are
+     * used on any device, with a lower priority.
+     *
+     * @note Loading several files merges their sections
      *
      * @param[in] filename Load the tuning parameters table from this file.(Must exist)
      *
@@ -117,6 +128,9 @@ public:
     void load_from_file(const std::string &filename);
 
     /** Save the content of the tuning parameters table to file
+     *
+     * The parameters are saved in the section of the current device, next to the sections of the other devices loaded
+     * by @ref load_from_file
      *
      * @param[in] filename Save the tuning parameters table to this file. (Content will be overwritten)
      *
@@ -154,12 +168,33 @@ private:
      * @return The optimal tuning parameters to use
      */
     CLTuningParams find_optimal_tuning_params(ICLKernel &kernel, IKernelData *data);
+    /** Advance the incremental search of the tuning parameters of a kernel by at most one candidate
+     *
+     * The candidate is timed on a profiling queue ordered with respect to the default queue, so the caller never waits
+     * for the measurement: its result is collected in one of the next runs of the kernel.
+     *
+     * @param[in]     kernel    OpenCL kernel to be tuned with tuning parameters
+     * @param[in,out] data      IKernelData object wrapping tensors and other objects needed for running the kernel
+     * @param[in]     config_id Configuration ID of the kernel in the tuning parameters table
+     *
+     * @return The best tuning parameters found so far
+     */
+    CLTuningParams tune_online_step(ICLKernel &kernel, IKernelData *data, const std::string &config_id);
+    /** Redirect clEnqueueNDRangeKernel so the event of the first slice enqueued is stored in _kernel_event */
+    void start_intercepting_enqueues();
+    /** Get a queue with profiling enabled, the default queue if it already supports it */
+    cl::CommandQueue profiling_queue() const;
+
+    struct OnlineState;
 
     std::unordered_map<std::string, CLTuningParams> _tuning_params_table;
     std::unordered_map<std::string, cl::NDRange>    _lws_table;
     cl::Event                                       _kernel_event;
     bool                                            _tune_new_kernels;
     CLTuningInfo                                    _tuning_info;
+    std::unique_ptr<OnlineState>                    _online_state;
+    /** Parameters loaded from tuning files, by device key */
+    std::map<std::string, std::unordered_map<std::string, CLTuningParams>> _device_tables;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_CL_CLTUNER_H
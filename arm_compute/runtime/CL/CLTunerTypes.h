@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -46,10 +46,14 @@ enum class CLTunerMode
 /**< OpenCL tuner tuning information */
 struct CLTuningInfo
 {
-    CLTunerMode tuner_mode = CLTunerMode::NORMAL; /**< Parameter to select the level (granularity) of the tuning */
-    bool        tune_wbsm  = false; /**< Flag to tune the batches of work groups distributed to compute units.
+    CLTunerMode tuner_mode  = CLTunerMode::NORMAL; /**< Parameter to select the level (granularity) of the tuning */
+    bool        tune_wbsm   = false; /**< Flag to tune the batches of work groups distributed to compute units.
                                                        Internally, the library will check if this feature is available on
                                                        the target platform. This OpenCL tuner extension is still in experimental phase */
+    bool        tune_online = false; /**< Flag to tune new kernels incrementally while they run in production: each kernel
+                                                       runs straight away with its default parameters and a single candidate is timed every
+                                                       other run until the search converges. The tuning_params_table only holds the kernels
+                                                       whose search has completed */
 };
 
 /** Converts a string to a strong types enumeration @ref CLTunerMode
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CL_CLWEIGHTSCACHE_H
+#define ACL_ARM_COMPUTE_RUNTIME_CL_CLWEIGHTSCACHE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/CL/OpenCL.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Device-side cache of transformed weights
+ *
+ * The functions preparing registered weights store the buffers of their transformed weights, e.g. the output of
+ * @ref opencl::kernels::ClWeightsReshapeKernel or @ref opencl::kernels::ClGemmReshapeRhsMatrixKernel, in the cache.
+ * A function configured later with the same weights and the same transformation, for instance by a graph re-created
+ * after a shape change, imports these buffers instead of running the transformation kernels again.
+ *
+ * The cache is enabled with @ref CLScheduler::set_weights_cache.
+ *
+ * @note Weights are identified by their tensor, so only the weights registered with
+ *       @ref CLWeightsCache::register_weights are cached: a registered tensor must keep its memory and its content
+ *       until it is unregistered, which also drops its transformed weights.
+ */
+class CLWeightsCache final
+{
+public:
+    /** Buffers of a set of transformed weights, indexed by the auxiliary memory slot of the operator */
+    using Buffers = std::map<int, cl::Buffer>;
+
+    /** Default constructor */
+    CLWeightsCache();
+    /** Prevent instances of this class from being copied */
+    CLWeightsCache(const CLWeightsCache &) = delete;
+    /** Prevent instances of this class from being copied */
+    CLWeightsCache &operator=(const CLWeightsCache &) = delete;
+    /** Default destructor */
+    ~CLWeightsCache();
+    /** Allow the transformations of a weights tensor to be cached
+     *
+     * @param[in] weights Weights tensor. Its memory and its content must not change until it is unregistered.
+     */
+    void register_weights(const ITensor *weights);
+    /** Stop caching the transformations of a weights tensor and release the ones already cached
+     *
+     * @note The functions which imported the transformed weights keep them alive until they are destroyed
+     *
+     * @param[in] weights Weights tensor passed to @ref CLWeightsCache::register_weights
+     */
+    void unregister_weights(const ITensor *weights);
+    /** Check if the transformations of a weights tensor can be cached
+     *
+     * @param[in] weights Weights tensor
+     *
+     * @return True if @p weights has been registered
+     */
+    bool is_registered(const ITensor *weights) const;
+    /** Look for transformed weights
+     *
+     * @param[in]  weights      Registered weights tensor
+     * @param[in]  transform_id Identifier of the transformation, see @ref opencl::ClGemm::weights_transform_id
+     * @param[out] buffers      Buffers of the transformed weights, if found
+     *
+     * @return True if the transformed weights have been found
+     */
+    bool find(const ITensor *weights, const std::string &transform_id, Buffers &buffers) const;
+    /** Store transformed weights
+     *
+     * @note Nothing is stored if @p weights is not registered or if the transformed weights are already cached
+     *
+     * @param[in] weights      Registered weights tensor
+     * @param[in] transform_id Identifier of the transformation
+     * @param[in] buffers      Buffers of the transformed weights. They must not be written afterwards.
+     */
+    void insert(const ITensor *weights, const std::string &transform_id, const Buffers &buffers);
+    /** Release all the transformed weights, the weights remain registered */
+    void clear();
+    /** Get the number of transformed weights cached
+     *
+     * @return Number of (weights, transformation) pairs in the cache
+     */
+    size_t size() const;
+
+private:
+    mutable std::mutex                                        _mtx;     /**< Protects the entries */
+    std::map<const ITensor *, std::map<std::string, Buffers>> _entries; /**< Transformed weights of each weights */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CL_CLWEIGHTSCACHE_H
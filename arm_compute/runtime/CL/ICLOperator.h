@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025 Arm Limited.
+ * Copyright (c) 2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,9 +59,10 @@ public:
     ICLOperator &operator=(ICLOperator &&) = default;
 
     // Inherited methods overridden:
-    void               run(ITensorPack &tensors) override;
-    void               prepare(ITensorPack &constants) override;
-    MemoryRequirements workspace() const override;
+    void                run(ITensorPack &tensors) override;
+    void                prepare(ITensorPack &constants) override;
+    MemoryRequirements  workspace() const override;
+    OperatorDescription describe() const override;
 
 protected:
     std::unique_ptr<ICLKernel> _kernel;
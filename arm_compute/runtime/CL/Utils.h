@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025 Arm Limited.
+ * Copyright (c) 2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,8 +40,13 @@ void save_program_cache_to_file(const std::string &filename = "cache.bin");
 
 /** This function loads prebuilt opencl kernels from a file
  *
- * @param[in] filename Name of the file to be used to load the kernels
+ * The programs are built concurrently, so that all the programs a graph needs are ready before its kernels are
+ * configured. Programs failing to build, for example after a driver update, are skipped and rebuilt from source
+ * when requested.
+ *
+ * @param[in] filename    Name of the file to be used to load the kernels
+ * @param[in] num_threads Number of threads building the programs. Defaults to 0, to use one thread per core
  */
-void restore_program_cache_from_file(const std::string &filename = "cache.bin");
+void restore_program_cache_from_file(const std::string &filename = "cache.bin", unsigned int num_threads = 0);
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_CL_UTILS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -225,8 +225,9 @@ public:
                                                     const Size2D              &dilation         = Size2D(1U, 1U),
                                                     bool                       enable_fast_math = false);
     // Inherited methods overridden:
-    void run() override;
-    void prepare() override;
+    void                run() override;
+    void                prepare() override;
+    OperatorDescription describe() const override;
 
 private:
     struct Impl;
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CL_FUNCTIONS_CLCOPYPROGRAM_H
+#define ACL_ARM_COMPUTE_RUNTIME_CL_FUNCTIONS_CLCOPYPROGRAM_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/CopyProgramInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class CLCompileContext;
+class ICLTensor;
+class ITensorInfo;
+
+/** Function to perform a sequence of data movements with a single OpenCL kernel
+ *
+ * Equivalent to running reshapes, permutations and slices one after the other, with a single kernel launch and
+ * without writing the intermediate tensors to memory. The shapes of the program are kernel arguments, so that
+ * programs with the same element size and number of stages share a single OpenCL program.
+ */
+class CLCopyProgram : public IFunction
+{
+public:
+    /** Constructor */
+    CLCopyProgram();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLCopyProgram(const CLCopyProgram &) = delete;
+    /** Default move constructor */
+    CLCopyProgram(CLCopyProgram &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLCopyProgram &operator=(const CLCopyProgram &) = delete;
+    /** Default move assignment operator */
+    CLCopyProgram &operator=(CLCopyProgram &&);
+    /** Destructor */
+    ~CLCopyProgram();
+    /** Initialize the function's input and output.
+     *
+     * Valid data layouts:
+     * - Any
+     *
+     * Valid data type configurations:
+     * |src            |dst            |
+     * |:--------------|:--------------|
+     * |All            |All            |
+     *
+     * @param[in]  src     Source tensor, up to 4D. Data types supported: All.
+     * @param[out] dst     Destination tensor, up to 4D. Data types supported: same as @p src.
+     * @param[in]  program Data movements to apply, in order. Up to 8 stages, whose intermediate shapes are up to 4D.
+     */
+    void configure(const ICLTensor *src, ICLTensor *dst, const CopyProgramInfo &program);
+    /** Initialize the function's input and output.
+     *
+     * Similar to @ref CLCopyProgram::configure()
+     *
+     * @param[in]  compile_context The compile context to be used.
+     * @param[in]  src             Source tensor.
+     * @param[out] dst             Destination tensor.
+     * @param[in]  program         Data movements to apply, in order.
+     */
+    void configure(const CLCompileContext &compile_context,
+                   const ICLTensor        *src,
+                   ICLTensor              *dst,
+                   const CopyProgramInfo  &program);
+    /** Static function to check if given info will lead to a valid configuration of @ref CLCopyProgram
+     *
+     * Similar to @ref CLCopyProgram::configure() except the arguments are @ref ITensorInfo * instead of @ref ICLTensor *
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const CopyProgramInfo &program);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CL_FUNCTIONS_CLCOPYPROGRAM_H
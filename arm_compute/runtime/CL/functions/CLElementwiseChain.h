@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CL_FUNCTIONS_CLELEMENTWISECHAIN_H
+#define ACL_ARM_COMPUTE_RUNTIME_CL_FUNCTIONS_CLELEMENTWISECHAIN_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+class CLCompileContext;
+class ICLTensor;
+class ITensorInfo;
+
+/** Function to evaluate a chain of elementwise operations with a single OpenCL kernel
+ *
+ * Equivalent to running the operations of the chain one after the other, e.g. an addition followed by an activation
+ * and a quantization, with a single kernel launch and without writing the intermediate tensors to memory. The kernel
+ * is generated at runtime from the chain and its program is cached by the compile context.
+ */
+class CLElementwiseChain : public IFunction
+{
+public:
+    /** Constructor */
+    CLElementwiseChain();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLElementwiseChain(const CLElementwiseChain &) = delete;
+    /** Default move constructor */
+    CLElementwiseChain(CLElementwiseChain &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLElementwiseChain &operator=(const CLElementwiseChain &) = delete;
+    /** Default move assignment operator */
+    CLElementwiseChain &operator=(CLElementwiseChain &&);
+    /** Destructor */
+    ~CLElementwiseChain();
+    /** Initialize the function's inputs and outputs.
+     *
+     * Valid data layouts:
+     * - Any
+     *
+     * Valid data type configurations:
+     * |src            |operands       |dst            |
+     * |:--------------|:--------------|:--------------|
+     * |F32            |F32            |F32            |
+     * |F32            |F32            |F16            |
+     * |F32            |F32            |QASYMM8        |
+     * |F32            |F32            |QASYMM8_SIGNED |
+     * |F16            |F16            |F16            |
+     * |F16            |F16            |F32            |
+     * |F16            |F16            |QASYMM8        |
+     * |F16            |F16            |QASYMM8_SIGNED |
+     *
+     * @param[in]  src      Input tensor of the chain. Data types supported: F32/F16.
+     * @param[in]  operands Operand tensors of the binary operations, indexed by @ref ElementwiseChainOp::operand, with
+     *                      the shape of @p src (no broadcasting). Data types supported: same as @p src.
+     * @param[out] dst      Destination tensor with the shape of @p src. Data types supported: F32/F16 to cast the
+     *                      result of the chain, QASYMM8/QASYMM8_SIGNED to quantize it.
+     * @param[in]  chain    Operations to apply, in order. The supported activations are IDENTITY, LINEAR, RELU,
+     *                      BOUNDED_RELU, LU_BOUNDED_RELU, LEAKY_RELU, SOFT_RELU, ELU, LOGISTIC, TANH, ABS, SQUARE,
+     *                      SQRT, HARD_SWISH and GELU.
+     */
+    void configure(const ICLTensor                      *src,
+                   const std::vector<const ICLTensor *> &operands,
+                   ICLTensor                            *dst,
+                   const ElementwiseChainInfo           &chain);
+    /** Initialize the function's inputs and outputs.
+     *
+     * Similar to @ref CLElementwiseChain::configure()
+     *
+     * @param[in]  compile_context The compile context to be used.
+     * @param[in]  src             Input tensor of the chain.
+     * @param[in]  operands        Operand tensors of the binary operations.
+     * @param[out] dst             Destination tensor.
+     * @param[in]  chain           Operations to apply, in order.
+     */
+    void configure(const CLCompileContext               &compile_context,
+                   const ICLTensor                      *src,
+                   const std::vector<const ICLTensor *> &operands,
+                   ICLTensor                            *dst,
+                   const ElementwiseChainInfo           &chain);
+    /** Static function to check if given info will lead to a valid configuration of @ref CLElementwiseChain
+     *
+     * Similar to @ref CLElementwiseChain::configure() except the arguments are @ref ITensorInfo * instead of @ref ICLTensor *
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                      *src,
+                           const std::vector<const ITensorInfo *> &operands,
+                           const ITensorInfo                      *dst,
+                           const ElementwiseChainInfo             &chain);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CL_FUNCTIONS_CLELEMENTWISECHAIN_H
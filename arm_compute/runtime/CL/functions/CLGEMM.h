@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -84,6 +84,8 @@ public:
      *
      * @note Batched GEMM only allows RHS tensor's rank to be <= 3
      * @note Batched GEMM only supports broadcasting cases where RHS rank < LHS rank but not the other way around
+     * @note F16 GEMMs accumulate in F32 if GEMMInfo::fp_mixed_precision is set, unless GEMMInfo::fast_math is set too
+     *       or B is not constant
      *
      * @param[in]  compile_context The compile context to be used.
      * @param[in]  a               First input tensor  (Matrix or Vector A). Data types supported: F16/F32
@@ -132,8 +134,9 @@ public:
                            const GEMMInfo    &gemm_info = GEMMInfo());
 
     // Inherited methods overridden:
-    void run() override;
-    void prepare() override;
+    void                run() override;
+    void                prepare() override;
+    OperatorDescription describe() const override;
 
 private:
     struct Impl;
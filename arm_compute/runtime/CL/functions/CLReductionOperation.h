@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -126,6 +126,8 @@ private:
 
     MemoryGroup                                 _memory_group;
     CLTensor                                    _unreshaped_output;
+    CLTensor                                    _partial_results;
+    std::unique_ptr<CLReductionOperationKernel> _partial_kernel;
     std::unique_ptr<CLReductionOperationKernel> _reduction_kernel;
     CLReshapeLayer                              _reshape;
     unsigned int                                _reduction_axis;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2025 Arm Limited.
+ * Copyright (c) 2016-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,10 +42,37 @@ namespace arm_compute
  * variable ARM_COMPUTE_CPP_SCHEDULER_MODE. e.g.:
  * ARM_COMPUTE_CPP_SCHEDULER_MODE=linear      # Force select the linear scheduling mode
  * ARM_COMPUTE_CPP_SCHEDULER_MODE=fanout      # Force select the fanout scheduling mode
+ * The mode can also be forced at runtime through @ref CPPScheduler::set_scheduling_mode.
+ *
+ * Between two jobs the worker threads park on a condition variable. They can instead be made to busy-wait for a
+ * given number of microseconds before parking, which removes the wake-up latency when kernels are scheduled back to
+ * back, at the cost of burning CPU cycles while idle. The same applies to the main thread waiting for the workers to
+ * complete. This is configured through @ref CPPScheduler::set_spin_wait_duration or the environment variable
+ * ARM_COMPUTE_CPP_SCHEDULER_SPIN_US. e.g.:
+ * ARM_COMPUTE_CPP_SCHEDULER_SPIN_US=50       # Busy-wait for up to 50us before parking
+ *
+ * The number of threads the jobs run on can adapt to the sustained throughput, e.g. when the cores are throttled as
+ * they heat up. This is enabled through @ref CPPScheduler::set_adaptive_threads or the environment variable
+ * ARM_COMPUTE_CPP_SCHEDULER_ADAPTIVE. e.g.:
+ * ARM_COMPUTE_CPP_SCHEDULER_ADAPTIVE=1       # Adapt the number of active threads
 */
 class CPPScheduler final : public IScheduler
 {
 public:
+    /** Scheduling modes of the pool of threads */
+    enum class SchedulingMode
+    {
+        AUTO,   /**< Linear for up to 8 threads, fanout above */
+        LINEAR, /**< The main thread wakes up all the worker threads */
+        FANOUT  /**< The worker threads wake up the next ones in a tree */
+    };
+    /** Priorities of the jobs submitted to the pool of threads */
+    enum class Priority
+    {
+        NORMAL, /**< Jobs run one after the other on the threads that are not reserved */
+        HIGH    /**< Jobs preempting the normal priority one running at its granule boundaries */
+    };
+
     /** Constructor: create a pool of threads. */
     CPPScheduler();
     /** Default destructor */
@@ -58,12 +85,92 @@ public:
      */
     static CPPScheduler &get();
 
+    /** Set how long the threads busy-wait for new work (or for the workers to complete) before parking
+     *
+     * @param[in] spin_us Busy-wait duration in microseconds. 0 (the default) parks the threads immediately.
+     */
+    void set_spin_wait_duration(unsigned int spin_us);
+    /** Get the busy-wait duration set by @ref CPPScheduler::set_spin_wait_duration
+     *
+     * @return Busy-wait duration in microseconds
+     */
+    unsigned int spin_wait_duration() const;
+    /** Force the scheduling mode, overriding the ARM_COMPUTE_CPP_SCHEDULER_MODE environment variable
+     *
+     * @param[in] mode Scheduling mode to use for the current and the next numbers of threads
+     */
+    void set_scheduling_mode(SchedulingMode mode);
+    /** Set the priority of the jobs scheduled from the calling thread, e.g. the thread running a latency-critical model
+     *
+     * A high priority job does not wait for the normal priority job holding the pool of threads to complete: the
+     * threads of that job run parts of the high priority one between two of their own windows, and the reserved threads
+     * run its parts straight away. The high priority jobs run one after the other. Kernels split with
+     * @ref IScheduler::StrategyHint::DYNAMIC have the smallest windows and thus the shortest preemption delays.
+     *
+     * @param[in] priority Priority of the jobs scheduled from the calling thread. Defaults to Priority::NORMAL
+     */
+    static void set_thread_priority(Priority priority);
+    /** Get the priority set by @ref CPPScheduler::set_thread_priority for the calling thread
+     *
+     * @return The priority of the jobs scheduled from the calling thread
+     */
+    static Priority thread_priority();
+    /** Reserve worker threads for the high priority jobs
+     *
+     * The normal priority jobs run on the other threads, which keeps them off the cores of the reserved threads when
+     * the threads are bound with @ref CPPScheduler::set_num_threads_with_affinity. The last worker threads are reserved.
+     *
+     * @param[in] num_reserved Number of worker threads to reserve. Clamped to the number of worker threads
+     */
+    void set_num_reserved_threads(unsigned int num_reserved);
+    /** Get the number of worker threads reserved for the high priority jobs
+     *
+     * @return The number of reserved worker threads
+     */
+    unsigned int num_reserved_threads() const;
+    /** Enable the adaptation of the number of threads the normal priority jobs run on
+     *
+     * The time of the jobs is measured over epochs spanning many of them, which assumes that the workloads repeat
+     * (e.g. inferences of the same models). After each epoch, the number of active threads moves by one towards the
+     * count with the lowest time per job. The counts are measured again periodically and whenever the frequency of the
+     * cores reported by cpufreq changes, so that the number of threads follows the thermal state of the device.
+     *
+     * The jobs are still split for all the threads, so that the functions configured for them remain valid. The
+     * threads bound last by @ref CPPScheduler::set_num_threads_with_affinity are the first ones left idle: binding the
+     * big cores first keeps them active.
+     *
+     * @param[in] enable True to adapt the number of active threads, false to always use all of them
+     */
+    void set_adaptive_threads(bool enable);
+    /** Get whether the number of active threads adapts, see @ref CPPScheduler::set_adaptive_threads
+     *
+     * @return True if the number of active threads adapts
+     */
+    bool adaptive_threads() const;
+    /** Get the number of threads the next normal priority job runs on, the calling thread included
+     *
+     * @return The number of active threads, which is the number of threads minus the reserved ones unless the
+     *         adaptive mode has reduced it
+     */
+    unsigned int num_active_threads() const;
+
     // Inherited functions overridden
     void         set_num_threads(unsigned int num_threads) override;
     void         set_num_threads_with_affinity(unsigned int num_threads, BindFunc func) override;
     unsigned int num_threads() const override;
     void         schedule(ICPPKernel *kernel, const Hints &hints) override;
     void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override;
+    CompletionHandle
+    schedule_op_async(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override;
+    /** NUMA nodes of the cores the threads have been bound to
+     *
+     * Only known if the threads have been bound with @ref CPPScheduler::set_num_threads_with_affinity.
+     *
+     * @param[in] num_threads Number of threads taking part in the run.
+     *
+     * @return One node per thread id, or an empty vector if the threads are not bound
+     */
+    std::vector<unsigned int> thread_numa_nodes(unsigned int num_threads) const override;
 
 protected:
     /** Will run the workloads in parallel using num_threads
@@ -71,6 +178,22 @@ protected:
      * @param[in] workloads Workloads to run
      */
     void run_workloads(std::vector<Workload> &workloads) override;
+    /** Will run the parts of the job in parallel using num_threads, without any heap allocation
+     *
+     * @param[in] job      Function to run for each part.
+     * @param[in] context  State shared by the parts, passed to @p job.
+     * @param[in] num_jobs Number of parts to run.
+     */
+    void run_indexed_jobs(IndexedJob job, void *context, unsigned int num_jobs) override;
+    /** Relative capacities of the cores the threads have been bound to
+     *
+     * Only known if the threads have been bound with @ref CPPScheduler::set_num_threads_with_affinity.
+     *
+     * @param[in] num_threads Number of threads taking part in the run.
+     *
+     * @return One capacity per thread id, or an empty vector if the threads are not bound
+     */
+    std::vector<float> thread_capacities(unsigned int num_threads) const override;
 
 private:
     struct Impl;
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_CPP_WORKSTEALINGSCHEDULER_H
+#define ACL_ARM_COMPUTE_RUNTIME_CPP_WORKSTEALINGSCHEDULER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+/** C++11 implementation of a pool of threads where each thread owns a range of workloads and idle threads steal from the others.
+ *
+ * Unlike @ref CPPScheduler, which hands out every workload past the first num_threads ones through a single shared
+ * atomic counter, the workloads of a run are split up-front in contiguous ranges, one per thread. A thread consumes its
+ * own range from the front and, once it is exhausted, steals single workloads from the back of the other threads' ranges.
+ * Each range lives on its own cache line, therefore threads only contend with each other when load imbalance forces
+ * them to steal, which makes it better suited to DYNAMIC-hinted kernels on processors with a high core count.
+ */
+class WorkStealingScheduler final : public IScheduler
+{
+public:
+    /** Constructor: create a pool of threads. */
+    WorkStealingScheduler();
+    /** Default destructor */
+    ~WorkStealingScheduler();
+
+    // Inherited functions overridden
+    void         set_num_threads(unsigned int num_threads) override;
+    void         set_num_threads_with_affinity(unsigned int num_threads, BindFunc func) override;
+    unsigned int num_threads() const override;
+    void         schedule(ICPPKernel *kernel, const Hints &hints) override;
+    void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override;
+    CompletionHandle
+    schedule_op_async(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override;
+
+protected:
+    /** Will run the workloads in parallel using num_threads
+     *
+     * @param[in] workloads Workloads to run
+     */
+    void run_workloads(std::vector<Workload> &workloads) override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_CPP_WORKSTEALINGSCHEDULER_H
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_EXTERNALSCHEDULER_H
+#define ACL_ARM_COMPUTE_RUNTIME_EXTERNALSCHEDULER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/IScheduler.h"
+
+namespace arm_compute
+{
+/** Executor of the application, e.g. its own thread pool, that @ref ExternalScheduler runs the kernels on */
+class IExternalExecutor
+{
+public:
+    /** Function running one task
+     *
+     * The first parameter is the context given to run_and_wait(), the second one the index of the task.
+     */
+    using Task = void (*)(void *, unsigned int);
+
+    /** Default virtual destructor */
+    virtual ~IExternalExecutor() = default;
+    /** Number of tasks the executor can run concurrently, usually its number of worker threads
+     *
+     * @return A number greater than 0
+     */
+    virtual unsigned int concurrency() const = 0;
+    /** Run @p task for every index in [0, @p num_tasks) and return once all of them have returned
+     *
+     * The tasks can run in any order, on any thread including the calling one, and concurrently or not: running them
+     * one after the other is correct, only slower.
+     *
+     * @note The tasks never block on each other, so a task that cannot start until another one has returned does not
+     *       lead to a deadlock.
+     *
+     * @param[in] task      Function to run for each index.
+     * @param[in] context   State shared by the tasks, passed to @p task.
+     * @param[in] num_tasks Number of tasks to run.
+     */
+    virtual void run_and_wait(Task task, void *context, unsigned int num_tasks) = 0;
+};
+
+/** Scheduler running the kernels on an executor of the application instead of threads of its own.
+ *
+ * The kernel parts are not handed one by one to the executor: it is asked to run at most num_threads() tasks and
+ * each of them pulls parts from a shared counter until none are left. The thread id seen by the kernels is the index
+ * of the task, so the ids of parts running concurrently are always different and below num_threads(), as the kernels
+ * indexing per-thread workspaces expect, whichever threads of the executor end up running the tasks. No
+ * std::function or heap allocation is needed per kernel.
+ *
+ * Set it as the active scheduler with Scheduler::set(std::shared_ptr<IScheduler>) or bind it to a thread with
+ * @ref ScopedScheduler.
+ */
+class ExternalScheduler final : public IScheduler
+{
+public:
+    /** Constructor
+     *
+     * @param[in] executor Executor to run the kernels on. It must outlive the scheduler.
+     */
+    explicit ExternalScheduler(IExternalExecutor *executor);
+    /** Sets the maximum number of tasks the kernels are split in
+     *
+     * @param[in] num_threads If set to 0, then IExternalExecutor::concurrency() will be used, otherwise the number
+     *                        specified.
+     */
+    void set_num_threads(unsigned int num_threads) override;
+    /** Returns the maximum number of tasks the kernels are split in
+     *
+     * @return Number of threads the kernels can run on concurrently.
+     */
+    unsigned int num_threads() const override;
+    /** Multithread the execution of the passed kernel if possible.
+     *
+     * @param[in] kernel Kernel to execute.
+     * @param[in] hints  Hints for the scheduler.
+     */
+    void schedule(ICPPKernel *kernel, const Hints &hints) override;
+    /** Multithread the execution of the passed kernel if possible.
+     *
+     * @param[in] kernel  Kernel to execute.
+     * @param[in] hints   Hints for the scheduler.
+     * @param[in] window  Window to use for kernel execution.
+     * @param[in] tensors Vector containing the tensors to operate on.
+     */
+    void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override;
+
+protected:
+    /** Execute all the passed workloads
+     *
+     * @param[in] workloads Array of workloads to run
+     */
+    void run_workloads(std::vector<Workload> &workloads) override;
+    /** Execute all the parts of the job on the executor, without any heap allocation
+     *
+     * @param[in] job      Function to run for each part.
+     * @param[in] context  State shared by the parts, passed to @p job.
+     * @param[in] num_jobs Number of parts to run.
+     */
+    void run_indexed_jobs(IndexedJob job, void *context, unsigned int num_jobs) override;
+
+private:
+    IExternalExecutor *_executor;
+    unsigned int       _num_threads{0};
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_EXTERNALSCHEDULER_H
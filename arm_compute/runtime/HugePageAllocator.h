@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_HUGEPAGEALLOCATOR_H
+#define ACL_ARM_COMPUTE_RUNTIME_HUGEPAGEALLOCATOR_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryRegion.h"
+#include "support/Mutex.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+
+namespace arm_compute
+{
+/** Huge pages requested by @ref HugePageAllocator */
+enum class HugePageSize
+{
+    Transparent, /**< Transparent huge pages, requested with madvise() */
+    Explicit2MB, /**< Explicit 2MB pages reserved in the hugetlb pool */
+    Explicit1GB  /**< Explicit 1GB pages reserved in the hugetlb pool */
+};
+
+/** Allocator backed by huge pages and placed on the NUMA nodes of the threads using it
+ *
+ * Allocations are mapped directly from the operating system so that large buffers, such as pre-transposed weights or
+ * the blobs of a memory pool, need fewer TLB entries. The pages are first touched by the threads of the scheduler,
+ * each one touching the part of the buffer it is most likely to process, so that the kernel places them on the
+ * local NUMA node.
+ *
+ * @note Explicit huge pages fall back to transparent huge pages when the hugetlb pool is exhausted.
+ * @note Allocations smaller than a huge page, and all allocations on systems without huge page support, are served
+ *       by the default allocator.
+ * @note The allocator must outlive the memory allocated and the regions created with it.
+ */
+class HugePageAllocator final : public IAllocator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] page_size   Huge pages to request. Defaults to transparent huge pages
+     * @param[in] first_touch Touch the pages from the scheduler threads to place them on their NUMA nodes. Defaults to true
+     */
+    HugePageAllocator(HugePageSize page_size = HugePageSize::Transparent, bool first_touch = true);
+    /** Prevent instances of this class from being copied */
+    HugePageAllocator(const HugePageAllocator &) = delete;
+    /** Prevent instances of this class from being copied */
+    HugePageAllocator &operator=(const HugePageAllocator &) = delete;
+    /** Destructor */
+    ~HugePageAllocator();
+
+    // Inherited methods overridden:
+    void                          *allocate(size_t size, size_t alignment) override;
+    void                           free(void *ptr) override;
+    std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override;
+
+private:
+    /** Memory handed out by the allocator */
+    struct Mapping
+    {
+        void  *base;   /**< Start of the mapping, or of the default allocation */
+        size_t length; /**< Length of the mapping, 0 for a default allocation */
+    };
+
+    HugePageSize              _page_size;
+    bool                      _first_touch;
+    std::map<void *, Mapping> _mappings;
+    arm_compute::Mutex        _mtx;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_HUGEPAGEALLOCATOR_H
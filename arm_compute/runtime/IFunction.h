@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2025 Arm Limited.
+ * Copyright (c) 2016-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,8 @@
  * @publicapi
  */
 
+#include "arm_compute/runtime/OperatorDescription.h"
+
 namespace arm_compute
 {
 /** Base class for all functions */
@@ -61,6 +63,28 @@ public:
     virtual void prepare()
     {
     }
+    /** Removes the one-off costs of the first run of the function
+     *
+     * Prepares the function then runs it once on the current content of its tensors, which faults in the pages of
+     * its memory, acquires its memory pools and builds the state the kernels create on their first run.
+     *
+     * @note The destination tensors are overwritten. For OpenCL functions, the run is enqueued but not waited for.
+     */
+    virtual void warm_up()
+    {
+        prepare();
+        run();
+    }
+    /** Describe the implementation selected when the function was configured
+     *
+     * @note Only valid after the function has been configured
+     *
+     * @return Description of the function. Functions that do not implement it return an empty description.
+     */
+    virtual OperatorDescription describe() const
+    {
+        return OperatorDescription{};
+    }
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_IFUNCTION_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -89,6 +89,20 @@ public:
      * @return Mapping type of the lifetime manager
      */
     virtual MappingType mapping_type() const = 0;
+    /** Size of a memory pool created from the lifetimes finalized so far
+     *
+     * This is the peak size of the transient memory of the managed groups, and is known before any pool is created.
+     *
+     * @return Size in bytes of one memory pool
+     */
+    virtual size_t pool_size() const = 0;
+    /** Size the finalized objects of a group would need without sharing any memory
+     *
+     * @param[in] group Memory group to query
+     *
+     * @return Sum of the sizes in bytes of the objects of the group, 0 if the group has not been finalized
+     */
+    virtual size_t group_size(const IMemoryGroup *group) const = 0;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_ILIFETIMEMANAGER_H
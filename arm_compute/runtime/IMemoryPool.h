@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -63,6 +63,20 @@ public:
      * @return A duplicate of the existing pool
      */
     virtual std::unique_ptr<IMemoryPool> duplicate() = 0;
+    /** Size of the memory allocated by the pool
+     *
+     * @return Allocated size in bytes
+     */
+    virtual size_t allocated_size() const = 0;
+    /** Free the memory backing the pool while keeping its configuration
+     *
+     * The memory is allocated again by @ref IMemoryPool::restore, or by the next @ref IMemoryPool::acquire.
+     *
+     * @note The pool must not be in use
+     */
+    virtual void trim() = 0;
+    /** Allocate again the memory freed by @ref IMemoryPool::trim, does nothing if the pool is not trimmed */
+    virtual void restore() = 0;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_IMEMORYPOOL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025 Arm Limited.
+ * Copyright (c) 2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 
 #include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/runtime/IRuntimeContext.h"
+#include "arm_compute/runtime/OperatorDescription.h"
 #include "arm_compute/runtime/Types.h"
 
 namespace arm_compute
@@ -73,6 +74,22 @@ public:
         static MemoryRequirements empty{};
         return empty;
     }
+
+    /** Describe the implementation selected when the operator was configured
+     *
+     * @note Only valid after the operator has been configured
+     *
+     * @return Description of the operator. The default one only reports the static workspace.
+     */
+    virtual OperatorDescription describe() const
+    {
+        OperatorDescription desc{};
+        for (const auto &mem : workspace())
+        {
+            desc.workspace_bytes += mem.size;
+        }
+        return desc;
+    }
 };
 } // namespace experimental
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,6 +72,15 @@ public:
      * @return Number of managed pools
      */
     virtual size_t num_pools() const = 0;
+    /** Returns the total size of the memory allocated by the managed pools
+     *
+     * @return Allocated size in bytes
+     */
+    virtual size_t allocated_size() const = 0;
+    /** Free the memory backing the pools that are not in use, see @ref IMemoryPool::trim */
+    virtual void trim_pools() = 0;
+    /** Allocate again the memory of the trimmed pools, see @ref IMemoryPool::restore */
+    virtual void restore_pools() = 0;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_IPOOLMANAGER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023, 2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,8 +32,15 @@
 #include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/core/Types.h"
 
+#include <chrono>
 #include <functional>
+#include <future>
 #include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -59,6 +66,15 @@ public:
      */
     using BindFunc = std::function<int(int, int)>;
 
+    /** Built-in policies binding the threads to the logical cores, derived from the topology of the CPU */
+    enum class AffinityPolicy
+    {
+        BIG_CORES,       /**< Only the cores of the highest capacity, their SMT siblings last */
+        PHYSICAL_CORES,  /**< One thread per physical core, skipping the SMT siblings, the biggest cores first */
+        CLUSTER_COMPACT, /**< Fill the clusters one after the other, the cluster of the biggest cores first */
+        SPREAD_L3        /**< Spread the threads across the L3 caches, taking one core of each cache in turn */
+    };
+
     /** When arm_compute::ISchedular::Hints::_split_dimension is initialized with this value
      * then the schedular is free to break down the problem space over as many dimensions
      * as it wishes
@@ -135,8 +151,74 @@ public:
         StrategyHint _strategy{};
         int          _threshold{};
     };
+    /** Handle to the completion of a kernel submitted through @ref IScheduler::schedule_op_async
+     *
+     * A default constructed handle refers to work that has already completed.
+     */
+    class CompletionHandle
+    {
+    public:
+        /** Default constructor: the handle is complete */
+        CompletionHandle() = default;
+        /** Constructor
+         *
+         * @param[in] future Future that becomes ready once the submitted work has completed.
+         */
+        explicit CompletionHandle(std::shared_future<void> future) : _future(std::move(future))
+        {
+        }
+        /** Check whether the submitted work has completed without blocking
+         *
+         * @return True if the work has completed
+         */
+        bool is_complete() const
+        {
+            return !_future.valid() || _future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+        /** Block until the submitted work has completed
+         *
+         * @note If the work threw an exception, it is rethrown here.
+         */
+        void wait() const
+        {
+            if (_future.valid())
+            {
+                _future.get();
+            }
+        }
+
+    private:
+        std::shared_future<void> _future{};
+    };
     /** Signature for the workloads to execute */
     using Workload = std::function<void(const ThreadInfo &)>;
+    /** Signature for the indexed jobs to execute: runs part @p index of the job whose state @p context points to */
+    using IndexedJob = void (*)(void *context, unsigned int index, const ThreadInfo &info);
+
+    /** Execution statistics of the parallel runs of a kernel, or of workloads run with the same tag
+     *
+     * The per-thread vectors are indexed by ThreadInfo::thread_id.
+     */
+    struct KernelStatistics
+    {
+        /** Ratio between the busy time of the slowest thread of a run and the mean busy time of its threads
+         *
+         * @return 1 for perfectly balanced runs, larger values the more the runs wait for their slowest thread
+         */
+        double imbalance() const
+        {
+            return sum_mean_busy_us > 0.0 ? sum_max_busy_us / sum_mean_busy_us : 1.0;
+        }
+
+        unsigned int          num_runs{0};           /**< Number of runs recorded */
+        double                total_time_us{0.0};    /**< Wall time of the runs, measured by the calling thread */
+        std::vector<double>   busy_time_us{};        /**< Time each thread spent running parts */
+        std::vector<double>   wait_time_us{};        /**< Time each thread waited for the end of its runs */
+        std::vector<uint64_t> num_parts{};           /**< Number of parts run by each thread */
+        std::vector<uint64_t> num_fed_parts{};       /**< Number of parts taken by each thread after its first one */
+        double                sum_max_busy_us{0.0};  /**< Sum over the runs of the busy time of their slowest thread */
+        double                sum_mean_busy_us{0.0}; /**< Sum over the runs of the mean busy time of their threads */
+    };
     /** Default constructor. */
     IScheduler();
 
@@ -156,6 +238,17 @@ public:
      */
     virtual void set_num_threads_with_affinity(unsigned int num_threads, BindFunc func);
 
+    /** Sets the number of threads the scheduler will use to run the kernels, pinning them with a built-in policy
+     *
+     * The cores are ordered by the policy and thread i is bound to the i-th one, wrapping around when there are more
+     * threads than selected cores. The scheduler runs unpinned threads if the topology of the CPU cannot be read.
+     *
+     * @param[in] num_threads If set to 0, then one thread per core selected by the policy will be used, otherwise the
+     *                        number of threads specified.
+     * @param[in] policy      Policy selecting and ordering the cores.
+     */
+    void set_num_threads_with_affinity_policy(unsigned int num_threads, AffinityPolicy policy);
+
     /** Returns the number of threads that the SingleThreadScheduler has in its pool.
      *
      * @return Number of threads available in SingleThreadScheduler.
@@ -178,6 +271,23 @@ public:
      */
     virtual void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) = 0;
 
+    /** Submit the kernel for execution and return without waiting for it to complete.
+     *
+     * Kernels submitted through this function are executed in submission order, one after the other.
+     * The default implementation executes the kernel synchronously and returns a completed handle.
+     *
+     * @note The kernel and the tensors in the pack must remain valid until the returned handle has completed.
+     *
+     * @param[in] kernel  Kernel to execute.
+     * @param[in] hints   Hints for the scheduler.
+     * @param[in] window  Window to use for kernel execution.
+     * @param[in] tensors Vector containing the tensors to operate on.
+     *
+     * @return A handle to wait for the completion of the kernel
+     */
+    virtual CompletionHandle
+    schedule_op_async(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors);
+
     /** Execute all the passed workloads
      *
      * @note There is no guarantee regarding the order in which the workloads will be executed or whether or not they will be executed in parallel.
@@ -201,6 +311,72 @@ public:
      */
     unsigned int num_threads_hint() const;
 
+    /** Enable or disable capacity-aware splitting of STATIC workloads
+     *
+     * When enabled, and the scheduler knows the relative capacity of the core each of its threads runs on
+     * (e.g. because the threads have been bound with @ref IScheduler::set_num_threads_with_affinity), STATIC workloads
+     * are split in windows proportional to these capacities instead of evenly. On heterogeneous systems this prevents
+     * the slower cores from becoming the long pole of every kernel.
+     *
+     * @param[in] enable True to enable capacity-aware splitting. Disabled by default.
+     */
+    void set_capacity_aware_split(bool enable);
+    /** Check whether capacity-aware splitting of STATIC workloads is enabled
+     *
+     * @return True if enabled
+     */
+    bool capacity_aware_split() const;
+
+    /** Enable or disable the replication of constant weights on each NUMA node
+     *
+     * When enabled, and the threads of the scheduler run on cores of several NUMA nodes (e.g. because they have been
+     * bound with @ref IScheduler::set_num_threads_with_affinity on a multi-socket server), the operators supporting it
+     * keep one copy of their prepared weights per node and have each thread read the copy local to its node. This
+     * trades memory for the bandwidth of the interconnect between the sockets.
+     *
+     * @note Only affects the operators configured after the call.
+     *
+     * @param[in] enable True to enable the replication. Disabled by default.
+     */
+    void set_numa_weights_replication(bool enable);
+    /** Check whether the replication of constant weights on each NUMA node is enabled
+     *
+     * @return True if enabled
+     */
+    bool numa_weights_replication() const;
+    /** NUMA nodes of the threads taking part in a run
+     *
+     * @param[in] num_threads Number of threads taking part in the run.
+     *
+     * @return One node per ThreadInfo::thread_id, or an empty vector if the nodes are unknown (default)
+     */
+    virtual std::vector<unsigned int> thread_numa_nodes(unsigned int num_threads) const;
+
+    /** Enable or disable the collection of execution statistics
+     *
+     * When enabled, every parallel run of a kernel, or of tagged workloads, records how long each thread was busy
+     * running its parts, how long it then waited for the other threads and how many parts it ran. The runs are
+     * recorded under the name of the kernel or the tag of the workloads. Work run on the calling thread alone is not
+     * recorded.
+     *
+     * @note Timing every part has a small cost, the statistics are therefore disabled by default.
+     *
+     * @param[in] enable True to collect the statistics.
+     */
+    void set_statistics_enabled(bool enable);
+    /** Check whether execution statistics are collected
+     *
+     * @return True if enabled
+     */
+    bool statistics_enabled() const;
+    /** Get the statistics collected so far
+     *
+     * @return The statistics of each kernel name or workloads tag
+     */
+    std::map<std::string, KernelStatistics> statistics() const;
+    /** Discard the statistics collected so far */
+    void reset_statistics();
+
 protected:
     /** Execute all the passed workloads
      *
@@ -210,6 +386,19 @@ protected:
      */
     virtual void run_workloads(std::vector<Workload> &workloads) = 0;
 
+    /** Execute all the parts of an indexed job
+     *
+     * Unlike @ref IScheduler::run_workloads the parts are not materialised as std::function objects, so schedulers
+     * can run them without any heap allocation. The default implementation wraps each part in a workload.
+     *
+     * @note there is no guarantee regarding the order in which the parts will be executed or whether or not they will be executed in parallel.
+     *
+     * @param[in] job      Function to run for each part.
+     * @param[in] context  State shared by the parts, passed to @p job.
+     * @param[in] num_jobs Number of parts to run.
+     */
+    virtual void run_indexed_jobs(IndexedJob job, void *context, unsigned int num_jobs);
+
     /** Common scheduler logic to execute the given kernel
      *
      * @param[in] kernel  Kernel to execute.
@@ -236,8 +425,31 @@ protected:
                                       const ICPPKernel &kernel,
                                       const CPUInfo    &cpu_info);
 
+    /** Relative capacities of the threads taking part in a run
+     *
+     * @param[in] num_threads Number of threads taking part in the run.
+     *
+     * @return One capacity per ThreadInfo::thread_id, or an empty vector if the capacities are unknown (default)
+     */
+    virtual std::vector<float> thread_capacities(unsigned int num_threads) const;
+
+    /** Run the given jobs with @ref IScheduler::run_indexed_jobs, recording their statistics under @p tag if enabled
+     *
+     * @param[in] job      Function to call for each index.
+     * @param[in] context  Pointer passed to each call of @p job.
+     * @param[in] num_jobs Number of indices to run.
+     * @param[in] tag      Name to record the statistics under.
+     */
+    void run_recorded_jobs(IndexedJob job, void *context, unsigned int num_jobs, const char *tag);
+
 private:
-    unsigned int _num_threads_hint = {};
+    unsigned int _num_threads_hint         = {};
+    bool         _capacity_aware_split     = {false};
+    bool         _numa_weights_replication = {false};
+    bool         _statistics_enabled       = {false};
+
+    mutable std::mutex                      _statistics_mutex{};
+    std::map<std::string, KernelStatistics> _statistics{};
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_ISCHEDULER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,11 +59,12 @@ public:
     ISimpleLifetimeManager &operator=(ISimpleLifetimeManager &&) = default;
 
     // Inherited methods overridden:
-    void register_group(IMemoryGroup *group) override;
-    bool release_group(IMemoryGroup *group) override;
-    void start_lifetime(void *obj) override;
-    void end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment) override;
-    bool are_all_finalized() const override;
+    void   register_group(IMemoryGroup *group) override;
+    bool   release_group(IMemoryGroup *group) override;
+    void   start_lifetime(void *obj) override;
+    void   end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment) override;
+    bool   are_all_finalized() const override;
+    size_t group_size(const IMemoryGroup *group) const override;
 
 protected:
     /** Update blobs and mappings */
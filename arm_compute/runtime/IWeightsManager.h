@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021, 2025 Arm Limited.
+ * Copyright (c) 2019, 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,7 @@
 
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/runtime/ITransformWeights.h"
+#include "arm_compute/runtime/Types.h"
 
 #include <map>
 
@@ -90,6 +91,14 @@ public:
      * @param weights Weights to mark unused
      */
     void pre_mark_as_unused(const ITensor *weights);
+    /** Report the memory used by the transformed weights
+     *
+     * The planned size covers every transformed weights tensor registered so far, the allocated size only the ones
+     * that are currently backed by memory.
+     *
+     * @return Memory usage of the transformed weights
+     */
+    MemoryUsage usage() const;
 
 private:
     struct CounterElement
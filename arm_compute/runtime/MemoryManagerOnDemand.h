@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,7 @@
 #include "arm_compute/runtime/IMemoryGroup.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/IPoolManager.h"
+#include "arm_compute/runtime/Types.h"
 
 #include <memory>
 
@@ -58,6 +59,23 @@ public:
     IPoolManager     *pool_manager() override;
     void              populate(IAllocator &allocator, size_t num_pools) override;
     void              clear() override;
+    /** Report the memory used by the manager
+     *
+     * The planned size is the size of one pool for the groups finalized so far, which is the peak transient memory of
+     * an inference and is available before @ref MemoryManagerOnDemand::populate. The allocated size covers all the
+     * pools currently registered.
+     *
+     * @return Memory usage of the manager
+     */
+    MemoryUsage usage() const;
+    /** Free the memory of the pools that are not in use while keeping the memory plan
+     *
+     * Unlike @ref MemoryManagerOnDemand::clear, the pools stay registered: they are allocated again by
+     * @ref MemoryManagerOnDemand::restore or lazily the next time they are acquired.
+     */
+    void trim();
+    /** Allocate again the memory of the pools freed by @ref MemoryManagerOnDemand::trim */
+    void restore();
 
 private:
     std::shared_ptr<ILifetimeManager> _lifetime_mgr; /**< Lifetime manager */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, 2025 Arm Limited.
+ * Copyright (c) 2020-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -64,9 +64,10 @@ public:
     ~INEOperator();
 
     // Inherited methods overridden:
-    void               run(ITensorPack &tensors) override;
-    void               prepare(ITensorPack &constants) override;
-    MemoryRequirements workspace() const override;
+    void                run(ITensorPack &tensors) override;
+    void                prepare(ITensorPack &constants) override;
+    MemoryRequirements  workspace() const override;
+    OperatorDescription describe() const override;
 
 protected:
     void run(ITensorPack &tensors, const Window &window);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2025 Arm Limited.
+ * Copyright (c) 2019-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -69,9 +69,12 @@ public:
      * |U8             | U16, S16, S32, F32, F16                        |
      * |U16            | U8, U32                                        |
      * |S16            | QASYMM8_SIGNED, U8, S32                        |
-     * |F16            | QASYMM8_SIGNED, QASYMM8, F32, S32, U8          |
+     * |F16            | QASYMM8_SIGNED, QASYMM8, F32, S32, U8, FP8     |
      * |S32            | QASYMM8_SIGNED, QASYMM8, F16, F32, U8          |
      * |F32            | QASYMM8_SIGNED, QASYMM8, BFLOAT16, F16, S32, U8|
+     * |               | FP8                                            |
+     * |FP8_E4M3       | F16, F32                                       |
+     * |FP8_E5M2       | F16, F32                                       |
      *
      * Input data type must be different than output data type.
      *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,7 +40,11 @@ class ITensor;
 class ITensorInfo;
 class Status;
 
-/** Basic function to execute concatenate tensors along a given axis */
+/** Basic function to execute concatenate tensors along a given axis
+ *
+ * @note When the producers of the inputs can write to the output directly, @ref create_concatenate_views makes
+ *       views of the output slices that avoid the copies altogether.
+ */
 class NEConcatenateLayer : public IFunction
 {
 public:
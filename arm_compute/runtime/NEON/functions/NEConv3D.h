@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,6 +41,7 @@ namespace arm_compute
 class ITensor;
 
 /** Basic function to simulate a 3d convolution. This function calls one of the following functions:
+ * -# cpu::CpuGemmDirectConv3d (if the assembly GEMM kernels support the configuration)
  * -# cpu::CpuDirectConv3d
  *
  */
@@ -95,6 +96,7 @@ public:
 
     // Inherited methods overridden:
     void run() override;
+    void prepare() override;
 
 private:
     struct Impl;
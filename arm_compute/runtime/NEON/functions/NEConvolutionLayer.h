@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,7 @@
 #include "arm_compute/core/ITensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/function_info/ActivationLayerInfo.h"
+#include "arm_compute/runtime/experimental/RunWorkspace.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 
@@ -121,7 +122,8 @@ public:
      * @param[in]  act_info         (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
      * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                              available which may introduce a drop of accuracy as well. Default is false
-     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups > 1 is only supported for
+     *                              NHWC F16/F32 with initialized outputs, the IFM of the weights being the one of a group
      */
     void configure(ITensor                   *input,
                    const ITensor             *weights,
@@ -151,7 +153,8 @@ public:
      * @param[in] act_info         (Optional) Activation layer information in case of a fused activation.
      * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                             available which may introduce a drop of accuracy as well. Default is false
-     * @param[in] num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in] num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups > 1 is only supported for
+     *                             NHWC F16/F32 with initialized outputs, the IFM of the weights being the one of a group
      *
      * @return a status
      */
@@ -192,9 +195,58 @@ public:
                                                     const Size2D              &dilation         = Size2D(1U, 1U),
                                                     const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
                                                     bool                       enable_fast_math = false);
+    /** Static function to get the convolution method measured as the fastest for the given info
+     *
+     * The measured methods are kept in a table, keyed by CPU model, shapes and number of threads, which is loaded from
+     * and saved to the file named by the ARM_COMPUTE_CPU_CONV_TUNER_FILE environment variable. When the
+     * ARM_COMPUTE_CPU_CONV_TUNER_MODE environment variable is set to 1, the valid methods of a convolution missing from
+     * the table are timed and the fastest one is recorded first. @ref NEConvolutionLayer::get_convolution_method
+     * returns the measured method when there is one.
+     *
+     * @param[in]  input            Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights          Weights tensor info. Data type supported: Same as @p input, also could be
+     *                              QSYMM8_PER_CHANNEL or QASYMM8_SIGNED if input is QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  output           Destination tensor info. Must be initialized for the methods to be timed.
+     * @param[in]  conv_info        Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  dilation         Dilation, in elements, across x and y.
+     * @param[in]  act_info         Activation layer information in case of a fused activation.
+     * @param[in]  enable_fast_math Enable fast math computation.
+     * @param[out] method           Measured convolution method. Only set when one is available
+     *
+     * @return True if a measured method valid for the given info is available
+     */
+    static bool get_measured_convolution_method(const ITensorInfo         *input,
+                                                const ITensorInfo         *weights,
+                                                const ITensorInfo         *output,
+                                                const PadStrideInfo       &conv_info,
+                                                const Size2D              &dilation,
+                                                const ActivationLayerInfo &act_info,
+                                                bool                       enable_fast_math,
+                                                ConvolutionMethod         &method);
+    /** Configures the transient memory of a run with a caller-owned workspace
+     *
+     * @param[out] workspace Workspace to configure. Each thread running the function at the same time needs its own.
+     */
+    void configure_workspace(experimental::RunWorkspace &workspace) const;
+    /** Runs the prepared function on the given tensors with a caller-owned workspace
+     *
+     * Unlike run(), the function is not modified: once prepared, several threads can run it at the same time, each
+     * with its own tensors, workspace and scheduler (see @ref ScopedScheduler). The weights and biases given to
+     * configure() are prepared once and shared, read-only, by every run.
+     *
+     * @note prepare() must be called first
+     * @note Not supported by the FFT method
+     *
+     * @param[in]  input     Source tensor, with the same info as the one given to configure()
+     * @param[out] output    Destination tensor, with the same info as the one given to configure()
+     * @param[in]  workspace Workspace configured with @ref configure_workspace(), not used by another run at the same time
+     */
+    void run(const ITensor *input, ITensor *output, experimental::RunWorkspace &workspace) const;
+
     // Inherited methods overridden:
-    void run() override;
-    void prepare() override;
+    void                run() override;
+    void                prepare() override;
+    OperatorDescription describe() const override;
 
 private:
     struct Impl;
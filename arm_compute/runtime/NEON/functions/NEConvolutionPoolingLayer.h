@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NECONVOLUTIONPOOLINGLAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NECONVOLUTIONPOOLINGLAYER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to compute a convolution layer followed by a 2x2 max pooling of stride 2. This function calls the
+ * following operators:
+ *
+ * -# cpu::CpuGemmDirectConv2d
+ * -# cpu::CpuPool2d
+ *
+ * Supports only NHWC data layout
+ *
+ * The convolution output is computed in bands of rows sized to stay in the L2 cache, and each band is pooled before
+ * the next one is computed. The full convolution output is therefore never written back to memory. Bands reading
+ * past the top or bottom of the input are computed on a zero padded copy of their input rows.
+ */
+class NEConvolutionPoolingLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEConvolutionPoolingLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEConvolutionPoolingLayer(const NEConvolutionPoolingLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEConvolutionPoolingLayer(NEConvolutionPoolingLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEConvolutionPoolingLayer &operator=(const NEConvolutionPoolingLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEConvolutionPoolingLayer &operator=(NEConvolutionPoolingLayer &&) = delete;
+    /** Destructor */
+    ~NEConvolutionPoolingLayer();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |src2           |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|
+     * |F16            |F16            |F16            |F16            |
+     * |F32            |F32            |F32            |F32            |
+     *
+     * @param[in]  input     Source tensor. 3 lower dimensions represent a single input [IFM, width, height],
+     *                       while every optional dimension from 4 and above represent a batch of inputs.
+     *                       Data types supported: F16/F32.
+     * @param[in]  weights   Weights tensor. Weights are 4D tensor with dimensions [IFM, kernel_x, kernel_y, OFM].
+     *                       Data type supported: Same as @p input.
+     * @param[in]  biases    Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                       Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output    Destination tensor of the pooling. 3 lower dimensions represent a single output
+     *                       [OFM, width, height], while the rest represent batch of outputs.
+     *                       Data types supported: Same as @p input.
+     * @param[in]  conv_info Convolution layer descriptor. Accumulation is not supported.
+     * @param[in]  pool_info Pooling layer descriptor. Only 2x2 max pooling of stride 2 without padding is supported.
+     */
+    void configure(ITensor                *input,
+                   const ITensor          *weights,
+                   const ITensor          *biases,
+                   ITensor                *output,
+                   const Conv2dInfo       &conv_info,
+                   const PoolingLayerInfo &pool_info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEConvolutionPoolingLayer
+     *
+     * Similar to @ref NEConvolutionPoolingLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo      *input,
+                           const ITensorInfo      *weights,
+                           const ITensorInfo      *biases,
+                           const ITensorInfo      *output,
+                           const Conv2dInfo       &conv_info,
+                           const PoolingLayerInfo &pool_info);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NECONVOLUTIONPOOLINGLAYER_H
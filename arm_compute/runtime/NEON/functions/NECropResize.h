@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,18 +28,22 @@
  * @publicapi
  */
 
-#include "arm_compute/runtime/NEON/functions/NEScale.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
 
 #include <memory>
 
 namespace arm_compute
 {
 // Forward Declarations
-class Tensor;
 class ITensor;
-class NECropKernel;
+class ITensorInfo;
+class NECropResizeKernel;
 
-/** Function to perform cropping and resizing */
+/** Function to perform cropping and resizing
+ *
+ * All the boxes are cropped and resized by a single kernel, scheduled once over the rows of all the resized boxes.
+ */
 class NECropResize : public IFunction
 {
 public:
@@ -64,16 +68,16 @@ public:
      * Valid data type configurations:
      * |src0     |src1     |src2   |dst      |
      * |:--------|:--------|:------|:--------|
-     * |All      |F32      |F32    |F32      |
+     * |All      |F32      |S32    |F32      |
      *
      * @note Supported tensor rank: up to 4
      * @note Box indices may be outside of the bounds, in which case @p extrapolation_value is used.
      * @note Start and end indices of boxes are inclusive.
      *
-     * @param[in]  input               Source tensor containing N batches of 3D images to be cropped. Data type supported: U8/U16/S16/U32/S32/F16/F32
+     * @param[in]  input               Source tensor containing N batches of 3D images to be cropped. Data type supported: U8/U16/S16/U32/S32/F16/F32/QASYMM8/QASYMM8_SIGNED
      * @param[in]  boxes               Tensor containing the boxes used to crop the images. Data type supported: F32
      * @param[in]  box_ind             One dimensional tensor containing the batch index of the 3D image in @p input that the corresponding
-     *                                 box in @p boxes will be applied to. Data type supported: F32
+     *                                 box in @p boxes will be applied to. Data type supported: S32
      * @param[out] output              Destination tensor containing a cropped and resized image for each box in @p boxes. Data type supported: F32
      * @param[in]  crop_size           The dimensions that each cropped image will be resized to.
      * @param[in]  method              The policy to be used when resizing image. Default is bilinear.
@@ -93,10 +97,10 @@ public:
      * @note Box indices may be outside of the bounds, in which case @p extrapolation_value is used.
      * @note Start and end indices of boxes are inclusive.
      *
-     * @param[in] input               Source tensor containing N batches of 3D images to be cropped. Data type supported: U8/U16/S16/U32/S32/F16/F32
+     * @param[in] input               Source tensor containing N batches of 3D images to be cropped. Data type supported: U8/U16/S16/U32/S32/F16/F32/QASYMM8/QASYMM8_SIGNED
      * @param[in] boxes               Tensor info for the tensor containing the boxes used to crop the images. Data type supported: F32
      * @param[in] box_ind             Tensor info for the one dimensional tensor containing the batch index of the 3D image in @p input
-     *                                that the corresponding box in @p boxes will be applied to. Data type supported: F32
+     *                                that the corresponding box in @p boxes will be applied to. Data type supported: S32
      * @param[in] output              Tensor info for the destination tensor containing a cropped and resized image for each box in @p boxes.
      *                                Data type supported: F32
      * @param[in] crop_size           The dimensions that each cropped image will be resized to.
@@ -120,10 +124,7 @@ public:
     InterpolationPolicy _method;
     float               _extrapolation_value;
 
-    std::vector<std::unique_ptr<NECropKernel>> _crop;
-    std::vector<std::unique_ptr<NEScale>>      _scale;
-    std::vector<std::unique_ptr<Tensor>>       _crop_results;
-    std::vector<std::unique_ptr<Tensor>>       _scaled_results;
+    std::unique_ptr<NECropResizeKernel> _kernel;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NECROPRESIZE_H
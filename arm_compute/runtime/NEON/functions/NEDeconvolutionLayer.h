@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,12 +33,18 @@
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEConcatenateLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthToSpaceLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEFill.h"
 #include "arm_compute/runtime/NEON/functions/NEReverse.h"
+#include "arm_compute/runtime/NEON/functions/NEStridedSlice.h"
+#include "arm_compute/runtime/SubTensor.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -67,11 +73,19 @@ namespace arm_compute
  * The weights used by Deconvolution are supposed to be the same as the ones used for Convolution. Therefore, it will be necessary to use the weights in the
  * reverse order to perform an actual convolution. This is achieved by using @ref NEReverse.
  *
+ * When the stride is the same in both dimensions and the output is a multiple of it, the zeros are not inserted: the
+ * deconvolution is decomposed into stride * stride phases, each a convolution of unit stride over the original input
+ * with the taps of the weights falling into that phase. The phases are computed by a single convolution whose output
+ * channels are those of every phase, and interleaved into the output with @ref NEDepthToSpaceLayer. This path is only
+ * taken when it reads fewer weights per output element than the convolution of the upsampled input, and is not
+ * available for QSYMM8_PER_CHANNEL weights.
+ *
  * This function calls the following kernels/functions:
  *
  * -# @ref CPPUpsample
  * -# @ref NEConvolutionLayer
  * -# @ref NEReverse
+ * -# @ref NEFill, @ref NEStridedSlice, @ref NEConcatenateLayer and @ref NEDepthToSpaceLayer (Sub-pixel deconvolution)
  *
  */
 class NEDeconvolutionLayer : public IFunction
@@ -156,18 +170,27 @@ public:
     void prepare() override;
 
 private:
-    MemoryGroup        _memory_group;
-    NEConvolutionLayer _conv_f;
-    CPPUpsample        _upsample_f;
-    NEReverse          _flip_weights;
-    Tensor             _scaled_output;
-    Tensor             _weights_flipped;
-    Tensor             _flip_axis;
-    const ITensor     *_original_weights;
-    ITensor           *_input;
-    PadStrideInfo      _info;
-    bool               _is_prepared;
-    bool               _do_upsampling;
+    MemoryGroup                          _memory_group;
+    NEConvolutionLayer                   _conv_f;
+    CPPUpsample                          _upsample_f;
+    NEReverse                            _flip_weights;
+    NEFill                               _fill_phase_weights;
+    std::vector<NEStridedSlice>          _slice_weights;
+    NEConcatenateLayer                   _concat_bias;
+    std::unique_ptr<NEDepthToSpaceLayer> _depth_to_space;
+    Tensor                               _scaled_output;
+    Tensor                               _weights_flipped;
+    Tensor                               _flip_axis;
+    Tensor                               _phase_weights;
+    std::vector<SubTensor>               _phase_weights_views;
+    Tensor                               _phase_bias;
+    Tensor                               _phase_output;
+    const ITensor                       *_original_weights;
+    ITensor                             *_input;
+    PadStrideInfo                        _info;
+    bool                                 _is_prepared;
+    bool                                 _do_upsampling;
+    bool                                 _do_sub_pixel;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEDECONVOLUTIONLAYER_H
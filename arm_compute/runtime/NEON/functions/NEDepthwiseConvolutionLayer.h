@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -73,17 +73,25 @@ public:
      * |QASYMM8        |QSYMM8_PER_CHANNEL |S32    |QASYMM8        |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
      * |QASYMM8_SIGNED |QSYMM8_PER_CHANNEL |S32    |QASYMM8_SIGNED |
+     * |QASYMM8_SIGNED |U8                 |S32    |QASYMM8_SIGNED |
+     *
+     * @note U8 weights hold two 4-bit two's complement values per byte along their first dimension, the even index in
+     *       the low nibble, and are quantized per channel when their quantization info has one scale per channel.
+     *       They are unpacked to 8-bit before the convolution, once if they are constant.
      *
      * @param[in, out] input            Source tensor. Data type supported: QASYMM8/QASYMM8_SIGNED/F16/F32
      * @param[out]     output           Destination tensor. Data type supported: same as @p input.
      * @param[in]      weights          Weights tensor. These are 3D tensors with shape [kernel_x, kernel_y, IFM].
-     *                                  Data type supported: Same as @p input or QASYMM8/QASYMM8_SIGNED/QSYMM8_PER_CHANNEL when @p input is QASYMM8/QASYMM8_SIGNED.
+     *                                  Data type supported: Same as @p input or QASYMM8/QASYMM8_SIGNED/QSYMM8_PER_CHANNEL when @p input is QASYMM8/QASYMM8_SIGNED,
+     *                                  U8 (packed 4-bit) when @p input is QASYMM8_SIGNED.
      * @param[in]      biases           Biases tensor. A 1D tensor with shape [IFM]. Must be nullptr if not needed.
      *                                  Data type supported: Same as @p input, S32 when input is QASYMM8/QASYMM8_SIGNED.
      * @param[in]      conv_info        Padding and stride information to use for the convolution.
      * @param[in]      depth_multiplier (Optional) Multiplier to apply to the input's depth in order to retrieve the output's depth. Defaults to 1.
      * @param[in]      act_info         (Optional) Activation layer information in case of a fused activation.
      * @param[in]      dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     * @param[in]      enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
+     *                                  available which may introduce a drop of accuracy as well. Default is false
      */
     void configure(ITensor                   *input,
                    const ITensor             *weights,
@@ -92,20 +100,24 @@ public:
                    const PadStrideInfo       &conv_info,
                    unsigned int               depth_multiplier = 1,
                    const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
-                   const Size2D              &dilation         = Size2D(1U, 1U));
+                   const Size2D              &dilation         = Size2D(1U, 1U),
+                   bool                       enable_fast_math = false);
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEDepthwiseConvolutionLayer
      *
      * @param[in] input            Source tensor. Data type supported: QASYMM8/QASYMM8_SIGNED/F16/F32
      * @param[in] output           Destination tensor. Data type supported: same as @p input.
      * @param[in] weights          Weights tensor. These are 3D tensors with shape [kernel_x, kernel_y, IFM].
-     *                             Data type supported: Same as @p input or QASYMM8/QASYMM8_SIGNED/QSYMM8_PER_CHANNEL when @p input is QASYMM8/QASYMM8_SIGNED.
+     *                             Data type supported: Same as @p input or QASYMM8/QASYMM8_SIGNED/QSYMM8_PER_CHANNEL when @p input is QASYMM8/QASYMM8_SIGNED,
+     *                             U8 (packed 4-bit) when @p input is QASYMM8_SIGNED.
      * @param[in] biases           Biases tensor. A 1D tensor with shape [IFM]. Must be nullptr if not needed.
      *                             Data type supported: Same as @p input, S32 when input is QASYMM8/QASYMM8_SIGNED.
      * @param[in] conv_info        Padding and stride information to use for the convolution.
      * @param[in] depth_multiplier (Optional) Multiplier to apply to the input's depth in order to retrieve the output's depth. Defaults to 1.
      * @param[in] act_info         (Optional) Activation layer information in case of a fused activation.
      * @param[in] dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
+     *                             available which may introduce a drop of accuracy as well. Default is false
      *
      * @return a status
      */
@@ -116,18 +128,23 @@ public:
                            const PadStrideInfo       &conv_info,
                            unsigned int               depth_multiplier = 1,
                            const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
-                           const Size2D              &dilation         = Size2D(1U, 1U));
+                           const Size2D              &dilation         = Size2D(1U, 1U),
+                           bool                       enable_fast_math = false);
 
     // Inherited methods overriden:
     void run() override;
     void prepare() override;
 
 private:
+    /** Unpack the packed 4-bit weights, if any and if not done yet or if they are not constant */
+    void unpack_weights();
+    /** Release the unpacked weights once the convolution does not use them anymore */
+    void release_unpacked_weights();
+
     /** Basic function to execute optimized depthwise convolution routines. This function calls the following kernels:
     *
     * @note At the moment 3x3 and 5x5 convolution of stride 1, 2 are supported
     *
-    * -# NEFillBorderKernel (if pad_x or pad_y > 0) and no assembly kernel implementation is present
     * -# NEDepthwiseConvolutionLayer3x3Kernel if 3x3 and no assembly kernel implementation is present
     * -# cpu::CpuDepthwiseConvolutionAssemblyDispatch if assembly kernel implementation is present
     * -# NEDirectConvolutionLayerOutputStageKernel if re-quantization of output is required
@@ -162,6 +179,8 @@ private:
          * @param[in]      depth_multiplier (Optional) Multiplier to apply to the input's depth in order to retrieve the output's depth. Defaults to 1.
          * @param[in]      act_info         (Optional) Activation layer information in case of a fused activation.
          * @param[in]      dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+         * @param[in]      enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
+         *                                  available which may introduce a drop of accuracy as well. Default is false
          */
         void configure(ITensor                   *input,
                        const ITensor             *weights,
@@ -170,7 +189,8 @@ private:
                        const PadStrideInfo       &conv_info,
                        unsigned int               depth_multiplier = 1,
                        const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
-                       const Size2D              &dilation         = Size2D(1U, 1U));
+                       const Size2D              &dilation         = Size2D(1U, 1U),
+                       bool                       enable_fast_math = false);
 
         /** Static function to check if given info will lead to a valid configuration of @ref NEDepthwiseConvolutionLayer3x3
          *
@@ -183,6 +203,8 @@ private:
          * @param[in] depth_multiplier (Optional) Multiplier to apply to the input's depth in order to retrieve the output's depth. Defaults to 1.
          * @param[in] act_info         (Optional) Activation layer information in case of a fused activation.
          * @param[in] dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+         * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
+         *                             available which may introduce a drop of accuracy as well. Default is false
          *
          * @return a status
          */
@@ -193,7 +215,8 @@ private:
                                const PadStrideInfo       &conv_info,
                                unsigned int               depth_multiplier = 1,
                                const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
-                               const Size2D              &dilation         = Size2D(1U, 1U));
+                               const Size2D              &dilation         = Size2D(1U, 1U),
+                               bool                       enable_fast_math = false);
 
         // Inherited methods overriden:
         void run() override;
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEDEPTHWISESEPARABLECONVOLUTIONLAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEDEPTHWISESEPARABLECONVOLUTIONLAYER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ConvolutionInfo.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to compute a depthwise convolution followed by a pointwise (1x1) convolution, optionally preceded
+ * by an expansion pointwise convolution as in the inverted residual blocks. This function calls the following
+ * operators:
+ *
+ * -# cpu::CpuGemmDirectConv2d (executed only if there is an expansion convolution)
+ * -# cpu::CpuDepthwiseConv2dAssemblyDispatch
+ * -# cpu::CpuGemmDirectConv2d
+ *
+ * Supports only NHWC data layout
+ *
+ * The depthwise output is computed in bands of rows sized to stay in the L2 cache, and each band is consumed by the
+ * pointwise convolution before the next one is computed. The full depthwise output is therefore never written back to
+ * memory. Each band reads its input rows in place and carries the top and bottom padding it needs, so that bands
+ * sharing the same geometry share the same depthwise operator and packed weights.
+ *
+ * With an expansion convolution, each band first computes the expanded rows read by its depthwise convolution,
+ * including the halo rows shared with the neighbouring bands which are computed again, so that the expanded tensor is
+ * never written back to memory either.
+ */
+class NEDepthwiseSeparableConvolutionLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEDepthwiseSeparableConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDepthwiseSeparableConvolutionLayer(const NEDepthwiseSeparableConvolutionLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEDepthwiseSeparableConvolutionLayer(NEDepthwiseSeparableConvolutionLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDepthwiseSeparableConvolutionLayer &operator=(const NEDepthwiseSeparableConvolutionLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEDepthwiseSeparableConvolutionLayer &operator=(NEDepthwiseSeparableConvolutionLayer &&) = delete;
+    /** Destructor */
+    ~NEDepthwiseSeparableConvolutionLayer();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |src2           |src3           |src4           |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|:--------------|:--------------|
+     * |F16            |F16            |F16            |F16            |F16            |F16            |
+     * |F32            |F32            |F32            |F32            |F32            |F32            |
+     *
+     * @param[in]  input             Source tensor. 3 lower dimensions represent a single input [IFM, width, height],
+     *                               while every optional dimension from 4 and above represent a batch of inputs.
+     *                               Data types supported: F16/F32.
+     * @param[in]  depthwise_weights Depthwise weights tensor. These are 3D tensors with shape [IFM * depth_multiplier,
+     *                               kernel_x, kernel_y]. Data type supported: Same as @p input.
+     * @param[in]  depthwise_biases  Depthwise biases tensor. A 1D tensor with shape [IFM * depth_multiplier].
+     *                               Can be nullptr. Data type supported: Same as @p input.
+     * @param[in]  pointwise_weights Pointwise weights tensor. Weights are 4D tensor with dimensions
+     *                               [IFM * depth_multiplier, 1, 1, OFM]. Data type supported: Same as @p input.
+     * @param[in]  pointwise_biases  Pointwise biases tensor. A 1D tensor with shape [OFM].
+     *                               Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output            Destination tensor of the pointwise convolution. 3 lower dimensions represent a
+     *                               single output [OFM, width, height], while the rest represent batch of outputs.
+     *                               Data types supported: Same as @p input.
+     * @param[in]  depthwise_info    Depthwise convolution descriptor. Only activations supported by the assembly
+     *                               kernels (RELU/RELU6) are supported.
+     * @param[in]  pointwise_info    Pointwise convolution descriptor. Only unit strides without padding are supported.
+     *                               Accumulation is not supported.
+     */
+    void configure(ITensor               *input,
+                   const ITensor         *depthwise_weights,
+                   const ITensor         *depthwise_biases,
+                   const ITensor         *pointwise_weights,
+                   const ITensor         *pointwise_biases,
+                   ITensor               *output,
+                   const ConvolutionInfo &depthwise_info,
+                   const Conv2dInfo      &pointwise_info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDepthwiseSeparableConvolutionLayer
+     *
+     * Similar to @ref NEDepthwiseSeparableConvolutionLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo     *input,
+                           const ITensorInfo     *depthwise_weights,
+                           const ITensorInfo     *depthwise_biases,
+                           const ITensorInfo     *pointwise_weights,
+                           const ITensorInfo     *pointwise_biases,
+                           const ITensorInfo     *output,
+                           const ConvolutionInfo &depthwise_info,
+                           const Conv2dInfo      &pointwise_info);
+    /** Set the input and output tensors of an inverted residual block
+     *
+     * Similar to @ref NEDepthwiseSeparableConvolutionLayer::configure(), the depthwise convolution reading the result
+     * of an expansion pointwise convolution of @p input.
+     *
+     * @param[in]  input             Source tensor of the expansion convolution. Data types supported: F16/F32.
+     * @param[in]  expansion_weights Expansion weights tensor. Weights are 4D tensor with dimensions [IFM, 1, 1, EFM].
+     *                               Data type supported: Same as @p input.
+     * @param[in]  expansion_biases  Expansion biases tensor. A 1D tensor with shape [EFM]. Can be nullptr.
+     *                               Data type supported: Same as @p input.
+     * @param[in]  depthwise_weights Depthwise weights tensor with shape [EFM * depth_multiplier, kernel_x, kernel_y].
+     *                               Data type supported: Same as @p input.
+     * @param[in]  depthwise_biases  Depthwise biases tensor. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in]  pointwise_weights Pointwise weights tensor with dimensions [EFM * depth_multiplier, 1, 1, OFM].
+     *                               Data type supported: Same as @p input.
+     * @param[in]  pointwise_biases  Pointwise biases tensor. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output            Destination tensor of the pointwise convolution. Data types supported: Same as
+     *                               @p input.
+     * @param[in]  expansion_info    Expansion convolution descriptor. Only unit strides without padding are
+     *                               supported. Accumulation is not supported.
+     * @param[in]  depthwise_info    Depthwise convolution descriptor. Only activations supported by the assembly
+     *                               kernels (RELU/RELU6) are supported.
+     * @param[in]  pointwise_info    Pointwise convolution descriptor. Only unit strides without padding are supported.
+     *                               Accumulation is not supported.
+     */
+    void configure(ITensor               *input,
+                   const ITensor         *expansion_weights,
+                   const ITensor         *expansion_biases,
+                   const ITensor         *depthwise_weights,
+                   const ITensor         *depthwise_biases,
+                   const ITensor         *pointwise_weights,
+                   const ITensor         *pointwise_biases,
+                   ITensor               *output,
+                   const Conv2dInfo      &expansion_info,
+                   const ConvolutionInfo &depthwise_info,
+                   const Conv2dInfo      &pointwise_info);
+    /** Static function to check if given info will lead to a valid configuration of an inverted residual block
+     *
+     * Similar to @ref NEDepthwiseSeparableConvolutionLayer::configure() with an expansion convolution
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo     *input,
+                           const ITensorInfo     *expansion_weights,
+                           const ITensorInfo     *expansion_biases,
+                           const ITensorInfo     *depthwise_weights,
+                           const ITensorInfo     *depthwise_biases,
+                           const ITensorInfo     *pointwise_weights,
+                           const ITensorInfo     *pointwise_biases,
+                           const ITensorInfo     *output,
+                           const Conv2dInfo      &expansion_info,
+                           const ConvolutionInfo &depthwise_info,
+                           const Conv2dInfo      &pointwise_info);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEDEPTHWISESEPARABLECONVOLUTIONLAYER_H
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEEMBEDDINGBAG_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEEMBEDDINGBAG_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to look up and pool bags of embeddings, as found in recommendation models
+ *
+ * The rows of each bag are gathered, optionally weighted, and summed or averaged in a single pass, instead of
+ * running @ref NEGather to an intermediate tensor followed by @ref NEReductionOperation.
+ * Bag b pools the rows indexed by indices[offsets[b]] up to, excluding, indices[offsets[b + 1]], or the end of
+ * @p indices for the last bag. An empty bag produces zeros.
+ */
+class NEEmbeddingBag : public IFunction
+{
+public:
+    /** Constructor */
+    NEEmbeddingBag();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEmbeddingBag(const NEEmbeddingBag &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEmbeddingBag &operator=(const NEEmbeddingBag &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEEmbeddingBag(NEEmbeddingBag &&) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEEmbeddingBag &operator=(NEEmbeddingBag &&) = delete;
+    /** Default Destructor */
+    ~NEEmbeddingBag();
+    /** Initialise the function's input and outputs.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |table          |indices |offsets |weights |output |
+     * |:--------------|:-------|:-------|:-------|:------|
+     * |F32            |U32/S32 |U32/S32 |F32     |F32    |
+     * |F16            |U32/S32 |U32/S32 |F32     |F16    |
+     * |QASYMM8        |U32/S32 |U32/S32 |F32     |F32    |
+     * |QASYMM8_SIGNED |U32/S32 |U32/S32 |F32     |F32    |
+     *
+     * @param[in]  table   Embedding table with shape [embedding size, number of embeddings]. Quantized tables are
+     *                     dequantized on the fly. Data types supported: F32/F16/QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  indices 1D tensor of the rows to gather, out of range indices gather zeros.
+     *                     Data types supported: U32/S32.
+     * @param[in]  offsets 1D tensor of the first index of each bag, with shape [number of bags].
+     *                     Data types supported: U32/S32.
+     * @param[in]  weights (Optional) Per index weights with the same shape as @p indices. Can be nullptr.
+     *                     Only supported with @ref ReductionOperation::SUM. Data types supported: F32.
+     * @param[out] output  Destination tensor with shape [embedding size, number of bags].
+     *                     Data types supported: F16 if @p table is F16, F32 otherwise.
+     * @param[in]  op      (Optional) Pooling of the rows of a bag. Supported: @ref ReductionOperation::SUM,
+     *                     @ref ReductionOperation::MEAN_SUM. Defaults to @ref ReductionOperation::SUM.
+     */
+    void configure(const ITensor     *table,
+                   const ITensor     *indices,
+                   const ITensor     *offsets,
+                   const ITensor     *weights,
+                   ITensor           *output,
+                   ReductionOperation op = ReductionOperation::SUM);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEEmbeddingBag
+     *
+     * Similar to @ref NEEmbeddingBag::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *table,
+                           const ITensorInfo *indices,
+                           const ITensorInfo *offsets,
+                           const ITensorInfo *weights,
+                           const ITensorInfo *output,
+                           ReductionOperation op = ReductionOperation::SUM);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEEMBEDDINGBAG_H
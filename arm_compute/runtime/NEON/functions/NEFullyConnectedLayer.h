@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -116,12 +116,19 @@ public:
      * |F32            |F32                |F32    |F32            |
      * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
+     * |QASYMM8_SIGNED |U8                 |S32    |QASYMM8_SIGNED |
+     * |F32            |QASYMM8_SIGNED     |F32    |F32            |
+     *
+     * @note F32 input with QASYMM8_SIGNED weights selects dynamic quantization: the input is quantized at every run
+     *       with a symmetric scale computed from its values and the weights must be constant with a zero offset.
+     * @note U8 weights hold packed 4-bit weights quantized per tensor: two 4-bit two's complement values per byte
+     *       along their first dimension, the even index in the low nibble.
      *
      * @param[in]  input        Source tensor. Data type supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
      * @param[in]  weights      Weights tensor. The weights must be 2 dimensional.
      *                          If this function is called after a Convolution Layer, the (transposed) weights will have as many rows as the product of the first 3 input's dimensions.
      *                          If it is called after another FullyConnected Layer, the (transposed) weights will have as many rows as the input's first dimension.
-     *                          Data type supported: Same as @p input.
+     *                          Data type supported: Same as @p input, U8 (packed 4-bit) if @p input is QASYMM8_SIGNED.
      * @param[in]  biases       Bias tensor. Can be nullptr. Data type supported: Same as @p weights, S32 if @p weights is QASYMM8/QASYMM8_SIGNED.
      * @param[out] output       Destination tensor. Its shape should be equal to the output of a matrix multiplication between:
      *                          - The output of im2col on the input and the (transposed) 2D weights, if the function is called after a Convolution Layer
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,11 +29,14 @@
  */
 
 #include "arm_compute/function_info/GEMMInfo.h"
+#include "arm_compute/runtime/experimental/RunWorkspace.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/IWeightsManager.h"
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -118,9 +121,56 @@ public:
                                float                      beta,
                                const GEMMInfo            &gemm_info = GEMMInfo());
 
+    /** Exports the weights pretransposed for the selected kernel and CPU
+     *
+     * Exporting once, offline, allows other functions with the same configuration to import the weights and skip
+     * their pretranspose. The function is prepared if not done already.
+     *
+     * @note Only available for assembly kernels pretransposing constant non-quantized weights
+     *
+     * @param[out] blob Exported pretransposed weights, prefixed by a header identifying the kernel and the CPU
+     *
+     * @return a status
+     */
+    Status export_pretransposed_weights(std::vector<uint8_t> &blob);
+    /** Imports weights exported by @ref export_pretransposed_weights
+     *
+     * prepare() then uses the imported weights instead of pretransposing @p b, which does not need to be filled.
+     * The import fails when the blob was exported for a different kernel, problem size or CPU, the function then
+     * pretransposes @p b as usual.
+     *
+     * @note Must be called after configure() and before the first run() or prepare()
+     *
+     * @param[in] blob Pretransposed weights. Copied, the blob can be released afterwards.
+     *
+     * @return a status
+     */
+    Status import_pretransposed_weights(const std::vector<uint8_t> &blob);
+
+    /** Configures the transient memory of a run with a caller-owned workspace
+     *
+     * @param[out] workspace Workspace to configure. Each thread running the function at the same time needs its own.
+     */
+    void configure_workspace(experimental::RunWorkspace &workspace) const;
+    /** Runs the prepared function on the given tensors with a caller-owned workspace
+     *
+     * Unlike run(), the function is not modified: once prepared, several threads can run it at the same time, each
+     * with its own tensors, workspace and scheduler (see @ref ScopedScheduler). The matrix B and matrix C given to
+     * configure() are prepared once and shared, read-only, by every run.
+     *
+     * @note prepare() must be called first
+     * @note Dynamic shapes are not supported
+     *
+     * @param[in]  a         First input tensor (Matrix A), with the same info as the one given to configure()
+     * @param[out] d         Output tensor, with the same info as the one given to configure()
+     * @param[in]  workspace Workspace configured with @ref configure_workspace(), not used by another run at the same time
+     */
+    void run(const ITensor *a, ITensor *d, experimental::RunWorkspace &workspace) const;
+
     // Inherited methods overridden:
-    void run() override;
-    void prepare() override;
+    void                run() override;
+    void                prepare() override;
+    OperatorDescription describe() const override;
 
 private:
     struct Impl;
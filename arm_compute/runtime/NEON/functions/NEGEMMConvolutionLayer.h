@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -96,7 +96,8 @@ public:
      * @param[in]  act_info         (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
      * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                              available which may introduce a drop of accuracy as well. Default is false
-     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups > 1 is only supported for
+     *                              NHWC F16/F32 with initialized outputs, the IFM of the weights being the one of a group
      */
     void configure(const ITensor             *input,
                    const ITensor             *weights,
@@ -126,7 +127,8 @@ public:
      * @param[in] act_info         (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
      * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                             available which may introduce a drop of accuracy as well. Default is false
-     * @param[in] num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in] num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups > 1 is only supported for
+     *                             NHWC F16/F32 with initialized outputs, the IFM of the weights being the one of a group
      *
      * @return a status
      */
@@ -228,8 +230,9 @@ public:
     void update_quantization_parameters();
 
     // Inherited methods overridden:
-    void run() override;
-    void prepare() override;
+    void                run() override;
+    void                prepare() override;
+    OperatorDescription describe() const override;
 
 private:
     struct Impl;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -88,6 +88,11 @@ public:
      * |QASYMM8_SIGNED |QSYMM8             |S32      |S32            |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |F32      |F32            |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |F32      |F16            |
+     * |QASYMM8_SIGNED |U8                 |S32      |QASYMM8_SIGNED |
+     * |QASYMM8_SIGNED |U8                 |S32      |S32            |
+     *
+     * @note A U8 @p b holds packed 4-bit weights: two 4-bit two's complement values per byte along its first
+     *       dimension, the even index in the low nibble, whose quantization info describes the unpacked values.
      *
      * @note GEMM_LOWP:  low precision GEMM kernel
      *  This kernel performs the following computations:
@@ -99,7 +104,7 @@ public:
      * @note The @p output type is S32 if @p gemm_info.type == GEMMLowpOutputStageType::NONE. It is QASYMM8/QASYMM8_SIGNED/F32 otherwise
      *
      * @param[in]  a         First input tensor  (Matrix A). Data type supported: QASYMM8/QASYMM8_SIGNED.
-     * @param[in]  b         Second input tensor (Matrix B). Data type supported: QASYMM8/QASYMM8_SIGNED/QSYMM8/QSYMM8_PER_CHANNEL.
+     * @param[in]  b         Second input tensor (Matrix B). Data type supported: QASYMM8/QASYMM8_SIGNED/QSYMM8/QSYMM8_PER_CHANNEL/U8.
      * @param[in]  c         Third input tensor  (Matrix C). It can be a nullptr. Data type supported: S32/F32
      * @param[out] output    Output tensor. Data type supported: Data type supported: S32/QASYMM8/QASYMM8_SIGNED/F32
      * @param[in]  gemm_info (Optional) Specifies if the matrix A and/or matrix B have been reshaped and
@@ -124,8 +129,9 @@ public:
     void update_quantization_parameters();
 
     // Inherited methods overridden
-    void run() override;
-    void prepare() override;
+    void                run() override;
+    void                prepare() override;
+    OperatorDescription describe() const override;
 
 private:
     struct Impl;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -44,7 +44,6 @@ class NEL2NormalizeLayerKernel;
 /** Basic function to perform a L2 normalization on a given axis.
  *
  * This function runs the following kernels:
- * -# @ref NEReductionOperation
  * -# NEL2NormalizeLayerKernel
  */
 class NEL2NormalizeLayer : public IFunction
@@ -97,9 +96,8 @@ public:
 
 private:
     MemoryGroup                               _memory_group;
-    NEReductionOperation                      _reduce_func;
     std::unique_ptr<NEL2NormalizeLayerKernel> _normalize_kernel;
-    Tensor                                    _sumsq;
+    size_t                                    _split_dimension;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEL2NORMALIZELAYER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,10 +41,13 @@
 #include "arm_compute/runtime/NEON/functions/NEPixelWiseMultiplication.h"
 #include "arm_compute/runtime/NEON/functions/NETranspose.h"
 
+#include <memory>
+
 namespace arm_compute
 {
 // Forward declarations
 class ITensor;
+class NELSTMCellKernel;
 
 /** Basic function to run @ref NELSTMLayer */
 class NELSTMLayer : public IFunction
@@ -194,88 +197,100 @@ public:
     void prepare() override;
 
 private:
-    MemoryGroup                    _memory_group;
-    NEFullyConnectedLayer          _fully_connected_input_gate;
-    NEArithmeticAddition           _accum_input_gate1;
-    NEArithmeticSubtraction        _subtract_input_gate;
-    NEPixelWiseMultiplication      _pixelwise_mul_input_gate;
-    NEActivationLayer              _activation_input_gate;
-    NEFullyConnectedLayer          _fully_connected_forget_gate;
-    NEArithmeticAddition           _accum_forget_gate1;
-    NEPixelWiseMultiplication      _pixelwise_mul_forget_gate;
-    NEActivationLayer              _activation_forget_gate;
-    NEFullyConnectedLayer          _fully_connected_cell_state;
-    NEGEMM                         _gemm_cell_state1;
-    NETranspose                    _transpose_cell_state;
-    NEArithmeticAddition           _accum_cell_state1;
-    NEArithmeticAddition           _accum_cell_state2;
-    NEPixelWiseMultiplication      _pixelwise_mul_cell_state1;
-    NEActivationLayer              _activation_cell_state;
-    NEActivationLayer              _cell_clip;
-    NEPixelWiseMultiplication      _pixelwise_mul_cell_state2;
-    NEFullyConnectedLayer          _fully_connected_output;
-    NEPixelWiseMultiplication      _pixelwise_mul_output_state1;
-    NEArithmeticAddition           _accum_output1;
-    NEActivationLayer              _activation_output;
-    NEActivationLayer              _activation_output_state;
-    NEPixelWiseMultiplication      _pixelwise_mul_output_state2;
-    NEFullyConnectedLayer          _fully_connected_output_state;
-    NEActivationLayer              _projection_clip;
-    NECopy                         _copy_cell_state;
-    NECopy                         _copy_output;
-    NEConcatenateLayer             _concat_scratch_buffer;
-    NEConcatenateLayer             _concat_inputs_forget_gate;
-    NEConcatenateLayer             _concat_weights_forget_gate;
-    NEConcatenateLayer             _concat_weights_input_gate;
-    NEConcatenateLayer             _concat_weights_output;
-    NEMeanStdDevNormalizationLayer _mean_std_norm_input_gate;
-    NEPixelWiseMultiplication      _pixelwise_mul_input_gate_coeff;
-    NEArithmeticAddition           _accum_input_gate_bias;
-    NEMeanStdDevNormalizationLayer _mean_std_norm_forget_gate;
-    NEPixelWiseMultiplication      _pixelwise_mul_forget_gate_coeff;
-    NEArithmeticAddition           _accum_forget_gate_bias;
-    NEMeanStdDevNormalizationLayer _mean_std_norm_cell_gate;
-    NEPixelWiseMultiplication      _pixelwise_mul_cell_gate_coeff;
-    NEArithmeticAddition           _accum_cell_gate_bias;
-    NEMeanStdDevNormalizationLayer _mean_std_norm_output_gate;
-    NEPixelWiseMultiplication      _pixelwise_mul_output_gate_coeff;
-    NEArithmeticAddition           _accum_output_gate_bias;
-    Tensor                         _input_gate_out1;
-    Tensor                         _input_gate_out2;
-    Tensor                         _input_gate_out3;
-    Tensor                         _input_gate_out4;
-    Tensor                         _forget_gate_out1;
-    Tensor                         _forget_gate_out2;
-    Tensor                         _forget_gate_out3;
-    Tensor                         _forget_gate_out4;
-    Tensor                         _forget_gate_out5;
-    Tensor                         _cell_state_out1;
-    Tensor                         _cell_state_out2;
-    Tensor                         _cell_state_out3;
-    Tensor                         _cell_state_out4;
-    Tensor                         _cell_state_out5;
-    Tensor                         _output1;
-    Tensor                         _output2;
-    Tensor                         _output3;
-    Tensor                         _output4;
-    Tensor                         _cell_state_activation;
-    Tensor                         _output_state1;
-    Tensor                         _ones;
-    Tensor                         _input_layer_norm_out1;
-    Tensor                         _input_layer_norm_out2;
-    Tensor                         _forget_layer_norm_out1;
-    Tensor                         _forget_layer_norm_out2;
-    Tensor                         _cell_layer_norm_out1;
-    Tensor                         _cell_layer_norm_out2;
-    Tensor                         _output_layer_norm_out1;
-    Tensor                         _output_layer_norm_out2;
-    bool                           _run_peephole_opt;
-    bool                           _run_cifg_opt;
-    bool                           _perform_cell_clipping;
-    bool                           _has_projection_weights;
-    bool                           _perform_projection_clipping;
-    bool                           _is_prepared;
-    bool                           _is_layer_norm_lstm;
+    MemoryGroup                       _memory_group;
+    NEFullyConnectedLayer             _fully_connected_input_gate;
+    NEArithmeticAddition              _accum_input_gate1;
+    NEArithmeticSubtraction           _subtract_input_gate;
+    NEPixelWiseMultiplication         _pixelwise_mul_input_gate;
+    NEActivationLayer                 _activation_input_gate;
+    NEFullyConnectedLayer             _fully_connected_forget_gate;
+    NEArithmeticAddition              _accum_forget_gate1;
+    NEPixelWiseMultiplication         _pixelwise_mul_forget_gate;
+    NEActivationLayer                 _activation_forget_gate;
+    NEFullyConnectedLayer             _fully_connected_cell_state;
+    NEGEMM                            _gemm_cell_state1;
+    NETranspose                       _transpose_cell_state;
+    NEArithmeticAddition              _accum_cell_state1;
+    NEArithmeticAddition              _accum_cell_state2;
+    NEPixelWiseMultiplication         _pixelwise_mul_cell_state1;
+    NEActivationLayer                 _activation_cell_state;
+    NEActivationLayer                 _cell_clip;
+    NEPixelWiseMultiplication         _pixelwise_mul_cell_state2;
+    NEFullyConnectedLayer             _fully_connected_output;
+    NEPixelWiseMultiplication         _pixelwise_mul_output_state1;
+    NEArithmeticAddition              _accum_output1;
+    NEActivationLayer                 _activation_output;
+    NEActivationLayer                 _activation_output_state;
+    NEPixelWiseMultiplication         _pixelwise_mul_output_state2;
+    NEFullyConnectedLayer             _fully_connected_output_state;
+    NEActivationLayer                 _projection_clip;
+    NECopy                            _copy_cell_state;
+    NECopy                            _copy_output;
+    NEConcatenateLayer                _concat_scratch_buffer;
+    NEConcatenateLayer                _concat_inputs_forget_gate;
+    NEConcatenateLayer                _concat_weights_forget_gate;
+    NEConcatenateLayer                _concat_weights_input_gate;
+    NEConcatenateLayer                _concat_weights_output;
+    NEMeanStdDevNormalizationLayer    _mean_std_norm_input_gate;
+    NEPixelWiseMultiplication         _pixelwise_mul_input_gate_coeff;
+    NEArithmeticAddition              _accum_input_gate_bias;
+    NEMeanStdDevNormalizationLayer    _mean_std_norm_forget_gate;
+    NEPixelWiseMultiplication         _pixelwise_mul_forget_gate_coeff;
+    NEArithmeticAddition              _accum_forget_gate_bias;
+    NEMeanStdDevNormalizationLayer    _mean_std_norm_cell_gate;
+    NEPixelWiseMultiplication         _pixelwise_mul_cell_gate_coeff;
+    NEArithmeticAddition              _accum_cell_gate_bias;
+    NEMeanStdDevNormalizationLayer    _mean_std_norm_output_gate;
+    NEPixelWiseMultiplication         _pixelwise_mul_output_gate_coeff;
+    NEArithmeticAddition              _accum_output_gate_bias;
+    NEConcatenateLayer                _concat_input_weights;
+    NEConcatenateLayer                _concat_recurrent_weights;
+    NEConcatenateLayer                _concat_gate_weights;
+    NEConcatenateLayer                _concat_gate_biases;
+    NEFullyConnectedLayer             _fully_connected_gates;
+    std::unique_ptr<NELSTMCellKernel> _lstm_cell_kernel;
+    Tensor                            _input_gate_out1;
+    Tensor                            _input_gate_out2;
+    Tensor                            _input_gate_out3;
+    Tensor                            _input_gate_out4;
+    Tensor                            _forget_gate_out1;
+    Tensor                            _forget_gate_out2;
+    Tensor                            _forget_gate_out3;
+    Tensor                            _forget_gate_out4;
+    Tensor                            _forget_gate_out5;
+    Tensor                            _cell_state_out1;
+    Tensor                            _cell_state_out2;
+    Tensor                            _cell_state_out3;
+    Tensor                            _cell_state_out4;
+    Tensor                            _cell_state_out5;
+    Tensor                            _output1;
+    Tensor                            _output2;
+    Tensor                            _output3;
+    Tensor                            _output4;
+    Tensor                            _cell_state_activation;
+    Tensor                            _output_state1;
+    Tensor                            _ones;
+    Tensor                            _input_layer_norm_out1;
+    Tensor                            _input_layer_norm_out2;
+    Tensor                            _forget_layer_norm_out1;
+    Tensor                            _forget_layer_norm_out2;
+    Tensor                            _cell_layer_norm_out1;
+    Tensor                            _cell_layer_norm_out2;
+    Tensor                            _output_layer_norm_out1;
+    Tensor                            _output_layer_norm_out2;
+    Tensor                            _input_weights;
+    Tensor                            _recurrent_weights;
+    Tensor                            _gate_weights;
+    Tensor                            _gate_biases;
+    Tensor                            _gates;
+    bool                              _run_peephole_opt;
+    bool                              _run_cifg_opt;
+    bool                              _perform_cell_clipping;
+    bool                              _has_projection_weights;
+    bool                              _perform_projection_clipping;
+    bool                              _is_prepared;
+    bool                              _is_layer_norm_lstm;
+    bool                              _is_fused;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELSTMLAYER_H
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELAYERNORM_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELAYERNORM_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to run a layer or RMS normalization, as found in transformer blocks
+ *
+ * Each row along X is normalized in a single kernel which also adds an optional residual and applies the optional
+ * gamma and beta, instead of chaining @ref NEMeanStdDevNormalizationLayer with a multiplication and an addition.
+ */
+class NELayerNorm : public IFunction
+{
+public:
+    /** Constructor */
+    NELayerNorm();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELayerNorm(const NELayerNorm &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELayerNorm &operator=(const NELayerNorm &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NELayerNorm(NELayerNorm &&) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NELayerNorm &operator=(NELayerNorm &&) = delete;
+    /** Default Destructor */
+    ~NELayerNorm();
+    /** Initialise the function's input and outputs.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src      |dst       |
+     * |:--------|:---------|
+     * |F32      |F32       |
+     * |F16      |F16       |
+     * |BFLOAT16 |BFLOAT16  |
+     *
+     * @param[in]  input        Source tensor, normalized along X. Data types supported: F32/F16/BFLOAT16.
+     * @param[in]  residual     (Optional) Tensor added to @p input before the normalization. Can be nullptr.
+     *                          Data type and shape supported: same as @p input.
+     * @param[in]  gamma        (Optional) Scale tensor with shape [input.dimension(0)]. Can be nullptr.
+     *                          Data type supported: same as @p input.
+     * @param[in]  beta         (Optional) Offset tensor with shape [input.dimension(0)]. Can be nullptr.
+     *                          Data type supported: same as @p input.
+     * @param[out] output       Destination tensor. Can be @p input or @p residual for in-place computation.
+     *                          Data type and shape supported: same as @p input.
+     * @param[in]  epsilon      (Optional) Small float added to the variance to avoid a division by zero. Defaults to 1e-5.
+     * @param[in]  use_rms_norm (Optional) Normalize by the root mean square, without subtracting the mean. Defaults to false.
+     */
+    void configure(const ITensor *input,
+                   const ITensor *residual,
+                   const ITensor *gamma,
+                   const ITensor *beta,
+                   ITensor       *output,
+                   float          epsilon      = 1e-5f,
+                   bool           use_rms_norm = false);
+    /** Static function to check if given info will lead to a valid configuration of @ref NELayerNorm
+     *
+     * Similar to @ref NELayerNorm::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input,
+                           const ITensorInfo *residual,
+                           const ITensorInfo *gamma,
+                           const ITensorInfo *beta,
+                           const ITensorInfo *output,
+                           float              epsilon      = 1e-5f,
+                           bool               use_rms_norm = false);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NELAYERNORM_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,9 +30,11 @@
 
 #include "arm_compute/core/Types.h"
 #include "arm_compute/function_info/ActivationLayerInfo.h"
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
 #include "arm_compute/runtime/IFunction.h"
 
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -137,6 +139,71 @@ public:
                            const MatMulInfo          &info,
                            const CpuMatMulSettings   &settings,
                            const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Initialize with an epilogue applied to the product before it is stored
+     *
+     * The epilogue fuses the elementwise operations that usually follow a matrix multiplication, e.g. for a gated
+     * feed-forward layer: ADD of a bias holding a single row, a GELU or SWISH activation, MUL by the gate, ADD of the
+     * residual, and the quantization of the result when @p dst is quantized.
+     *
+     * Valid data type configurations:
+     * |lhs            |rhs                |operands       |dst            |
+     * |:--------------|:------------------|:--------------|:--------------|
+     * |F32            |F32                |F32            |F32            |
+     * |F32            |F32                |F32            |QASYMM8        |
+     * |F32            |F32                |F32            |QASYMM8_SIGNED |
+     * |F16            |F16                |F16            |F16            |
+     *
+     * @param[in]  lhs      Left-hand side tensor. Data types supported: F16/F32.
+     * @param[in]  rhs      Right-hand side tensor. Data types supported: same as @p lhs.
+     * @param[in]  operands Operand tensors of the binary operations of @p epilogue, indexed by
+     *                      @ref ElementwiseChainOp::operand, with the shape of @p dst or holding a single row of it.
+     *                      Data types supported: same as @p lhs.
+     * @param[out] dst      Output tensor. Data types supported: same as @p lhs, or QASYMM8/QASYMM8_SIGNED if @p lhs is
+     *                      F32.
+     * @param[in]  info     Contains MatMul operation information described in @ref MatMulInfo. Must not be incremental.
+     * @param[in]  settings Contains flags for function level settings i.e fast math
+     * @param[in]  epilogue Operations applied to the product, in order. See @ref NEElementwiseChain for the supported
+     *                      activations.
+     */
+    void configure(ITensor                            *lhs,
+                   ITensor                            *rhs,
+                   const std::vector<const ITensor *> &operands,
+                   ITensor                            *dst,
+                   const MatMulInfo                   &info,
+                   const CpuMatMulSettings            &settings,
+                   const ElementwiseChainInfo         &epilogue);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEMatMul with an epilogue
+     *
+     * Similar to @ref NEMatMul::configure() with an epilogue, except the arguments are @ref ITensorInfo * instead of
+     * @ref ITensor *
+     *
+     * @return Status
+     */
+    static Status validate(const ITensorInfo                      *lhs,
+                           const ITensorInfo                      *rhs,
+                           const std::vector<const ITensorInfo *> &operands,
+                           const ITensorInfo                      *dst,
+                           const MatMulInfo                       &info,
+                           const CpuMatMulSettings                &settings,
+                           const ElementwiseChainInfo             &epilogue);
+
+    /** Set the number of rhs rows used by the following calls to run()
+     *
+     * Only valid when configured with @ref MatMulInfo::incremental set. The rhs, and the lhs or dst dimension that
+     * matches its rows, are then configured at their capacity, e.g. the maximum sequence length of a key/value cache,
+     * and only the first @p rows rows of rhs take part in the product. Rows can be appended to rhs in place between
+     * runs without reconfiguring the function.
+     *
+     * - When adj_rhs is false, the rows of rhs are the accumulation dimension: the product only uses the first
+     *   @p rows columns of lhs.
+     * - When adj_rhs is true, the rows of rhs are the output columns: only the first @p rows columns of dst are
+     *   written.
+     *
+     * Incremental mode supports F32/F16/BFLOAT16 without adj_lhs, fixed format kernels or fused activations.
+     *
+     * @param[in] rows Number of valid rhs rows. Must not exceed the number of rows of rhs passed to configure().
+     */
+    void set_valid_rhs_rows(size_t rows);
 
     // Inherited methods overridden
     void run() override;
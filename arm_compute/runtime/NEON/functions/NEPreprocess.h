@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPREPROCESS_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPREPROCESS_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to turn camera frames into the input tensor of a network in a single pass
+ *
+ * The frame is converted to RGB, resized with area interpolation, then each channel c is normalized and converted to
+ * the destination type:
+ * @f[ output_c = \frac{resized_c - mean_c}{std_c} @f]
+ *
+ * The RGB values are in [0, 255], semi-planar YUV frames use the full range BT.601 conversion. The destination can be
+ * the input tensor of a graph, which avoids the intermediate RGB image and the scalar loops of the preprocessors of
+ * the graph utilities.
+ */
+class NEPreprocess : public IFunction
+{
+public:
+    /** Constructor */
+    NEPreprocess();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPreprocess(const NEPreprocess &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPreprocess &operator=(const NEPreprocess &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEPreprocess(NEPreprocess &&) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEPreprocess &operator=(NEPreprocess &&) = delete;
+    /** Default Destructor */
+    ~NEPreprocess();
+    /** Initialise the function's input and outputs.
+     *
+     * Valid data layouts:
+     * - NHWC for the output
+     *
+     * Valid data type configurations:
+     * |src |dst                        |
+     * |:---|:--------------------------|
+     * |U8  |F32/QASYMM8/QASYMM8_SIGNED |
+     *
+     * @param[in]  input   Source frame. Data types supported: U8.
+     *                     NV12 and NV21 frames have the shape [W, H * 3 / 2]: the H luma rows followed by the H / 2
+     *                     interleaved chroma rows, W and H must be even. RGB888 and RGBA8888 frames have the shape
+     *                     [3, W, H] and [4, W, H], the alpha channel is ignored.
+     * @param[out] output  Destination tensor with NHWC layout and the shape [3, resized W, resized H].
+     *                     Its shape must be initialized. Data types supported: F32/QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  format  Format of @p input. Formats supported: NV12/NV21/RGB888/RGBA8888.
+     * @param[in]  mean    Mean of each output channel, or a single mean for all the channels.
+     * @param[in]  std_dev Standard deviation of each output channel, or a single one for all the channels.
+     *                     Must not be 0.
+     * @param[in]  bgr     (Optional) True to write the channels of @p output in BGR order. Defaults to false.
+     */
+    void configure(const ITensor            *input,
+                   ITensor                  *output,
+                   Format                    format,
+                   const std::vector<float> &mean,
+                   const std::vector<float> &std_dev,
+                   bool                      bgr = false);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEPreprocess
+     *
+     * Similar to @ref NEPreprocess::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo        *input,
+                           const ITensorInfo        *output,
+                           Format                    format,
+                           const std::vector<float> &mean,
+                           const std::vector<float> &std_dev,
+                           bool                      bgr = false);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPREPROCESS_H
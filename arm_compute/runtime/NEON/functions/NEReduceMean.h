@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,9 +35,24 @@
 #include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include <memory>
+
 namespace arm_compute
 {
-/** Basic function to perform reduce operation */
+// Forward declarations
+namespace cpu
+{
+namespace kernels
+{
+class CpuMultiAxisReductionKernel;
+} // namespace kernels
+} // namespace cpu
+
+/** Basic function to perform reduce operation
+ *
+ * Several axes are reduced at once by cpu::kernels::CpuMultiAxisReductionKernel, a single axis by
+ * @ref NEReductionOperation.
+ */
 class NEReduceMean : public IFunction
 {
 public:
@@ -91,12 +106,15 @@ public:
     void run() override;
 
 private:
-    MemoryGroup                       _memory_group;
-    std::vector<NEReductionOperation> _reduction_kernels;
-    std::vector<Tensor>               _reduced_outs;
-    NEReshapeLayer                    _reshape;
-    int                               _reduction_ops;
-    bool                              _keep_dims;
+    MemoryGroup                                                 _memory_group;
+    std::vector<NEReductionOperation>                           _reduction_kernels;
+    std::vector<Tensor>                                         _reduced_outs;
+    NEReshapeLayer                                              _reshape;
+    std::unique_ptr<cpu::kernels::CpuMultiAxisReductionKernel> _multi_axis_kernel;
+    ITensor                                                    *_input;
+    ITensor                                                    *_output;
+    int                                                         _reduction_ops;
+    bool                                                        _keep_dims;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEREDUCEMEAN_H
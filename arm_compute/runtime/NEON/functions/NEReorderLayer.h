@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025 Arm Limited.
+ * Copyright (c) 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,7 +39,11 @@ namespace arm_compute
 class ITensor;
 class ITensorInfo;
 class NEReorderKernel;
-/** Function to compute blocked reorder. */
+/** Function to compute blocked reorder.
+ *
+ * Any fixed WeightFormat of arm_gemm can be produced. The reorder is split across the threads along both the
+ * panels of rows and the columns of the output.
+ */
 class NEReorderLayer : public IFunction
 {
 public:
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NERESIZENORMALIZE_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NERESIZENORMALIZE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to preprocess images for inference: resize, normalize and quantize them in a single pass
+ *
+ * The image is resized with area interpolation, which averages the source pixels covered by each destination pixel
+ * to avoid aliasing when downscaling by large ratios. Each channel c of the resized image is then normalized and
+ * converted to the destination type:
+ * @f[ output_c = \frac{resized_c - mean_c}{std_c} @f]
+ *
+ * This replaces @ref NEScale followed by a normalization and @ref NEQuantizationLayer over intermediate tensors.
+ */
+class NEResizeNormalize : public IFunction
+{
+public:
+    /** Constructor */
+    NEResizeNormalize();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEResizeNormalize(const NEResizeNormalize &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEResizeNormalize &operator=(const NEResizeNormalize &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEResizeNormalize(NEResizeNormalize &&) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEResizeNormalize &operator=(NEResizeNormalize &&) = delete;
+    /** Default Destructor */
+    ~NEResizeNormalize();
+    /** Initialise the function's input and outputs.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src |dst                        |
+     * |:---|:--------------------------|
+     * |U8  |F32/QASYMM8/QASYMM8_SIGNED |
+     * |F32 |F32/QASYMM8/QASYMM8_SIGNED |
+     *
+     * @param[in]  input   Source image with NHWC layout. Data types supported: U8/F32.
+     * @param[out] output  Destination tensor with NHWC layout, the same number of channels and batches as @p input
+     *                     and the resized width and height. Its shape must be initialized.
+     *                     Data types supported: F32/QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  mean    Mean of each channel, or a single mean for all the channels.
+     * @param[in]  std_dev Standard deviation of each channel, or a single one for all the channels. Must not be 0.
+     */
+    void configure(const ITensor            *input,
+                   ITensor                  *output,
+                   const std::vector<float> &mean,
+                   const std::vector<float> &std_dev);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEResizeNormalize
+     *
+     * Similar to @ref NEResizeNormalize::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo        *input,
+                           const ITensorInfo        *output,
+                           const std::vector<float> &mean,
+                           const std::vector<float> &std_dev);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NERESIZENORMALIZE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -91,6 +91,20 @@ public:
      */
     static Status
     validate(const ITensorInfo *input, const ITensorInfo *output, const Coordinates &starts, const Coordinates &ends);
+    /** Static function to check if the output of the slice is a view of its input
+     *
+     * The @ref SubTensor of @p input with the output shape starting at @p view_coords then holds the output of the slice,
+     * which doesn't need to be run.
+     *
+     * @param[in]  input       Source tensor info.
+     * @param[in]  starts      The starts of the dimensions of the input tensor to be sliced. The length must be of rank(input).
+     * @param[in]  ends        The ends of the dimensions of the input tensor to be sliced. The length must be of rank(input).
+     * @param[out] view_coords Coordinates of the first element of the output in @p input, set if the output is a view
+     *
+     * @return True if the output of the slice is a view of @p input
+     */
+    static bool
+    is_view(const ITensorInfo *input, const Coordinates &starts, const Coordinates &ends, Coordinates &view_coords);
 
     // Inherited methods overridden:
     void run() override;
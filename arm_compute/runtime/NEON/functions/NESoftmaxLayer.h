@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -76,6 +76,11 @@ public:
      * @param[in]     beta   (Optional) A scaling factor for the exponent.
      * @param[in]     axis   (Optional) The dimension in which to apply the function. E.g. for input of shape 4x5x6 and
      *                       axis=1, softmax will be applied to 4x6=24 vectors of size 5. Defaults to 0
+     *
+     * @note The shape of @p input can be bounded instead of fixed by marking some of its dimensions as dynamic, see
+     *       @ref ITensorInfo::set_tensor_dims_state(). The configured shape is then the largest one, and before each
+     *       run the shapes of @p input and @p output can be set to any shape that is not larger on the dynamic
+     *       dimensions and equal on the others, without configuring the function again.
      */
     void configure(ITensor *input, ITensor *output, float beta = 1.0f, int32_t axis = 0);
     /** Static function to check if given info will lead to a valid configuration of @ref NESoftmaxLayer
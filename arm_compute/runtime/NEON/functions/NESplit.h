@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,7 +39,11 @@
 
 namespace arm_compute
 {
-/** Basic function to split a tensor along a given axis */
+/** Basic function to split a tensor along a given axis
+ *
+ * @note When the consumers of the outputs can read strided tensors, @ref create_split_views makes views aliasing
+ *       the input that avoid the copies altogether.
+ */
 class NESplit : public CPPSplit<NESlice>
 {
 public:
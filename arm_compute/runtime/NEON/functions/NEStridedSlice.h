@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -106,6 +106,30 @@ public:
                            int32_t            begin_mask       = 0,
                            int32_t            end_mask         = 0,
                            int32_t            shrink_axis_mask = 0);
+    /** Static function to check if the output of the strided slice is a view of its input
+     *
+     * The @ref SubTensor of @p input with the output shape starting at @p view_coords then holds the output of the slice,
+     * which doesn't need to be run.
+     *
+     * @param[in]  input            Source tensor info.
+     * @param[in]  starts           The starts of the dimensions of the input tensor to be sliced. The length must be of rank(input).
+     * @param[in]  ends             The ends of the dimensions of the input tensor to be sliced. The length must be of rank(input).
+     * @param[in]  strides          The strides of the dimensions of the input tensor to be sliced. The length must be of rank(input).
+     * @param[in]  begin_mask       If the ith bit of begin_mask is set, starts[i] is ignored and the fullest possible range in that dimension is used instead.
+     * @param[in]  end_mask         If the ith bit of end_mask is set, ends[i] is ignored and the fullest possible range in that dimension is used instead.
+     * @param[in]  shrink_axis_mask If the ith bit of shrink_axis_mask is set, it implies that the ith specification shrinks the dimensionality by 1.
+     * @param[out] view_coords      Coordinates of the first element of the output in @p input, set if the output is a view
+     *
+     * @return True if the output of the slice is a view of @p input
+     */
+    static bool is_view(const ITensorInfo *input,
+                        const Coordinates &starts,
+                        const Coordinates &ends,
+                        const BiStrides   &strides,
+                        int32_t            begin_mask,
+                        int32_t            end_mask,
+                        int32_t            shrink_axis_mask,
+                        Coordinates       &view_coords);
 
     // Inherited methods overridden:
     void run() override;
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NETOPKV_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NETOPKV_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to select the k largest elements of each row, e.g. the top classes of a classifier
+ *
+ * Unlike @ref CPPTopKV, which checks whether target classes are among the top k predictions, this function returns
+ * the top k values of each row with their positions. With k = 1 it computes an arg max that also returns the maximum.
+ *
+ * This function calls the following kernels:
+ * -# cpu::kernels::CpuTopKVKernel
+ */
+class NETopKV : public IFunction
+{
+public:
+    /** Constructor */
+    NETopKV();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETopKV(const NETopKV &) = delete;
+    /** Default move constructor */
+    NETopKV(NETopKV &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETopKV &operator=(const NETopKV &) = delete;
+    /** Default move assignment operator */
+    NETopKV &operator=(NETopKV &&);
+    /** Destructor */
+    ~NETopKV();
+    /** Set the input and outputs of the function
+     *
+     * The values of each row are selected along the first dimension and written in decreasing order. Equal values are
+     * ordered by increasing position.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src            |values         |indices |
+     * |:--------------|:--------------|:-------|
+     * |QASYMM8        |QASYMM8        |U32     |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED |U32     |
+     * |F16            |F16            |U32     |
+     * |F32            |F32            |U32     |
+     *
+     * @param[in]  input   Source tensor with shape [N, rows...]. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[out] values  Destination tensor of the selected values with shape [k, rows...].
+     *                     Data type supported: same as @p input, with the same quantization info.
+     * @param[out] indices Destination tensor of the positions of the selected values in their row, with the same shape
+     *                     as @p values. Data type supported: U32.
+     * @param[in]  k       Number of elements to select in each row, between 1 and N.
+     */
+    void configure(const ITensor *input, ITensor *values, ITensor *indices, unsigned int k);
+    /** Static function to check if given info will lead to a valid configuration of @ref NETopKV
+     *
+     * @param[in] input   Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in] values  Destination tensor info of the selected values. Data type supported: same as @p input.
+     * @param[in] indices Destination tensor info of the positions of the selected values. Data type supported: U32.
+     * @param[in] k       Number of elements to select in each row, between 1 and N.
+     *
+     * @return a status
+     */
+    static Status
+    validate(const ITensorInfo *input, const ITensorInfo *values, const ITensorInfo *indices, unsigned int k);
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NETOPKV_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,14 +30,28 @@
 
 #include "arm_compute/runtime/IScheduler.h"
 
+#include <memory>
+
 namespace arm_compute
 {
+class SchedulerAsyncQueue;
+
 /** Pool of threads to automatically split a kernel's execution among several threads. */
 class OMPScheduler final : public IScheduler
 {
 public:
+    /** How to run the kernels scheduled from inside a parallel region of the application */
+    enum class NestedPolicy
+    {
+        SERIAL,   /**< Run the parts of the kernel one after the other on the calling thread */
+        TEAM,     /**< Open a nested parallel region, of the size given to set_nested_policy() */
+        TASKLOOP, /**< Run the parts of the kernel as OpenMP tasks, executed by the threads of the enclosing team */
+    };
+
     /** Constructor. */
     OMPScheduler();
+    /** Destructor: waits for the kernels submitted through schedule_op_async() to complete */
+    ~OMPScheduler();
     /** Sets the number of threads the scheduler will use to run the kernels.
      *
      * @param[in] num_threads If set to 0, then the number returned by omp_get_max_threads() will be used, otherwise the number of threads specified.
@@ -48,6 +62,21 @@ public:
      * @return Number of threads available in OMPScheduler.
      */
     unsigned int num_threads() const override;
+    /** Sets how the kernels scheduled from inside an active parallel region are run.
+     *
+     * Opening a parallel region of num_threads() threads from each thread of an enclosing team would oversubscribe the
+     * cores, so by default such kernels run serially on the calling thread.
+     *
+     * @note With NestedPolicy::TEAM the kernels also run serially when the enclosing region already is at the maximum
+     *       number of active levels.
+     * @note With NestedPolicy::TASKLOOP the kernels run serially when the enclosing team is larger than num_threads(),
+     *       as the thread ids must stay below the number of threads the kernels were configured for.
+     *
+     * @param[in] policy      Policy to use.
+     * @param[in] num_threads (Optional) Size of the nested team for NestedPolicy::TEAM, capped to num_threads(). If 0,
+     *                        the number returned by omp_get_max_threads() in the enclosing region is used.
+     */
+    void set_nested_policy(NestedPolicy policy, unsigned int num_threads = 0);
     /** Multithread the execution of the passed kernel if possible.
      *
      * The kernel will run on a single thread if any of these conditions is true:
@@ -65,6 +94,9 @@ public:
      * - ICPPKernel::is_parallelisable() returns false
      * - The scheduler has been initialized with only one thread.
      *
+     * With StrategyHint::DYNAMIC the window is split in more parts than threads and the threads pick the next part
+     * once they are done with theirs.
+     *
      * @param[in] kernel  Kernel to execute.
      * @param[in] hints   Hints for the scheduler.
      * @param[in] window  Window to use for kernel execution.
@@ -72,6 +104,22 @@ public:
      */
     void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override;
 
+    /** Submit the kernel and return without waiting for it to complete.
+     *
+     * Kernels are executed in submission order by a dispatch thread that opens the OpenMP parallel region.
+     *
+     * @note Calling schedule_op() while asynchronous kernels are in flight creates two concurrent parallel regions.
+     *
+     * @param[in] kernel  Kernel to execute.
+     * @param[in] hints   Hints for the scheduler.
+     * @param[in] window  Window to use for kernel execution.
+     * @param[in] tensors Vector containing the tensors to operate on.
+     *
+     * @return A handle to wait for the completion of the kernel
+     */
+    CompletionHandle
+    schedule_op_async(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override;
+
 protected:
     /** Execute all the passed workloads
      *
@@ -80,10 +128,24 @@ protected:
      * @param[in] workloads Array of workloads to run
      */
     void run_workloads(std::vector<Workload> &workloads) override;
+    /** Execute all the parts of the job in an OpenMP parallel loop, without any heap allocation
+     *
+     * The parts are dealt out one per thread when there are no more parts than threads, otherwise the threads pick
+     * the next part once they are done. From inside an active parallel region the parts are run as set by
+     * set_nested_policy().
+     *
+     * @param[in] job      Function to run for each part.
+     * @param[in] context  State shared by the parts, passed to @p job.
+     * @param[in] num_jobs Number of parts to run.
+     */
+    void run_indexed_jobs(IndexedJob job, void *context, unsigned int num_jobs) override;
 
 private:
-    unsigned int _num_threads;
-    unsigned int _nonlittle_num_cpus;
+    unsigned int                         _num_threads;
+    unsigned int                         _nonlittle_num_cpus;
+    NestedPolicy                         _nested_policy{NestedPolicy::SERIAL};
+    unsigned int                         _nested_num_threads{0};
+    std::unique_ptr<SchedulerAsyncQueue> _async_queue;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_OMP_OMPSCHEDULER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,6 +72,9 @@ public:
     void                         release(MemoryMappings &handles) override;
     MappingType                  mapping_type() const override;
     std::unique_ptr<IMemoryPool> duplicate() override;
+    size_t                       allocated_size() const override;
+    void                         trim() override;
+    void                         restore() override;
 
 private:
     IAllocator                    *_allocator; /**< Allocator to use for internal allocation */
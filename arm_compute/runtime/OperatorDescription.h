@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_OPERATORDESCRIPTION_H
+#define ACL_ARM_COMPUTE_RUNTIME_OPERATORDESCRIPTION_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+/** Description of the implementation selected by an operator or a function when it was configured
+ *
+ * Functions and operators made of other operators describe them as @ref children, so that the description of a
+ * function is a tree whose leaves run the kernels. Fields a node knows nothing about are left empty or zero.
+ */
+struct OperatorDescription
+{
+    std::string              name{};             /**< Name of the operator or function */
+    std::string              method{};           /**< Implementation method selected, e.g. the convolution method */
+    std::vector<std::string> kernels{};          /**< Kernels run by this node, for OpenCL with their configuration */
+    std::string              gemm_strategy{};    /**< Name of the arm_gemm kernel, empty if no assembly GEMM is run */
+    std::string              gemm_config{};      /**< arm_gemm method, block sizes and weight format of the kernel */
+    std::string              split_dimension{};  /**< Dimension(s) the CPU scheduler splits the work along */
+    size_t                   workspace_bytes{0}; /**< Auxiliary memory requested by this node, excluding the children */
+    uint64_t                 estimated_cycles{0}; /**< Cycles of a run estimated by arm_gemm, 0 if not estimated */
+    std::vector<OperatorDescription> children{}; /**< Descriptions of the operators this node is made of */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_OPERATORDESCRIPTION_H
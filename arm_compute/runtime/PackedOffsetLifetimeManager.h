@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_PACKEDOFFSETLIFETIMEMANAGER_H
+#define ACL_ARM_COMPUTE_RUNTIME_PACKEDOFFSETLIFETIMEMANAGER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/runtime/ISimpleLifetimeManager.h"
+#include "arm_compute/runtime/Types.h"
+
+#include <map>
+#include <utility>
+
+namespace arm_compute
+{
+// Forward declarations
+class IMemoryPool;
+
+/** Concrete class that tracks the lifetime of registered tensors and packs them in a single blob
+ *
+ * Lifetimes are ordered by the sequence of start and end events of the tensors of a group. Tensors are placed by
+ * decreasing size, each one at the offset of the tightest gap left by the placed tensors whose lifetime overlaps it,
+ * which usually brings the blob close to the largest total size of the tensors alive at the same time.
+ */
+class PackedOffsetLifetimeManager : public ISimpleLifetimeManager
+{
+public:
+    using info_type = BlobInfo;
+
+public:
+    /** Constructor */
+    PackedOffsetLifetimeManager();
+    /** Prevent instances of this class to be copy constructed */
+    PackedOffsetLifetimeManager(const PackedOffsetLifetimeManager &) = delete;
+    /** Prevent instances of this class to be copied */
+    PackedOffsetLifetimeManager &operator=(const PackedOffsetLifetimeManager &) = delete;
+    /** Allow instances of this class to be move constructed */
+    PackedOffsetLifetimeManager(PackedOffsetLifetimeManager &&) = default;
+    /** Allow instances of this class to be moved */
+    PackedOffsetLifetimeManager &operator=(PackedOffsetLifetimeManager &&) = default;
+    /** Accessor to the pool internal configuration meta-data
+     *
+     * @return Lifetime manager internal configuration meta-data
+     */
+    const info_type &info() const;
+    /** Lower bound of the blob size
+     *
+     * @return Largest total size of the tensors of a group alive at the same time
+     */
+    size_t lower_bound_size() const;
+
+    // Inherited methods overridden:
+    void                         start_lifetime(void *obj) override;
+    void                         end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment) override;
+    std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
+    MappingType                  mapping_type() const override;
+    size_t                       pool_size() const override;
+
+private:
+    // Inherited methods overridden:
+    void update_blobs_and_mappings() override;
+
+private:
+    BlobInfo                                    _blob;             /**< Memory blob size */
+    size_t                                      _lower_bound_size; /**< Lower bound of the blob size */
+    size_t                                      _num_events;       /**< Number of lifetime events of the group */
+    std::map<void *, std::pair<size_t, size_t>> _lifetimes;        /**< Start and end events of each tensor */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_PACKEDOFFSETLIFETIMEMANAGER_H
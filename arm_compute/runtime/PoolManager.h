@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2025 Arm Limited.
+ * Copyright (c) 2017-2020, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,13 +35,21 @@
 #include "support/Mutex.h"
 #include "support/Semaphore.h"
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <list>
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
-/** Memory pool manager */
+/** Memory pool manager
+ *
+ * The free pools are kept in a lock-free stack so that locking and unlocking a pool, which memory groups do on every
+ * run, only takes a few atomic operations. Threads only block when all the pools are occupied.
+ * Registering, releasing and clearing pools still require all of them to be free.
+ */
 class PoolManager : public IPoolManager
 {
 public:
@@ -63,12 +71,36 @@ public:
     std::unique_ptr<IMemoryPool> release_pool() override;
     void                         clear_pools() override;
     size_t                       num_pools() const override;
+    size_t                       allocated_size() const override;
+    void                         trim_pools() override;
+    void                         restore_pools() override;
 
 private:
-    std::list<std::unique_ptr<IMemoryPool>> _free_pools;     /**< List of free pools */
-    std::list<std::unique_ptr<IMemoryPool>> _occupied_pools; /**< List of occupied pools */
-    std::unique_ptr<arm_compute::Semaphore> _sem;            /**< Semaphore to control the queues */
-    mutable arm_compute::Mutex              _mtx;            /**< Mutex to control access to the queues */
+    /** Rebuilds the stack of free pools from the registered ones */
+    void reset_free_pools();
+    /** Claims a free pool without waiting
+     *
+     * @return True if a pool was claimed, in which case one can be popped from the stack
+     */
+    bool try_claim_pool();
+    /** Pops a free pool from the stack. A pool must have been claimed first
+     *
+     * @return The index of the pool
+     */
+    uint32_t pop_pool();
+    /** Pushes a pool back to the stack and wakes up a thread waiting for one, if any
+     *
+     * @param[in] index Index of the pool
+     */
+    void push_pool(uint32_t index);
+
+    std::list<std::unique_ptr<IMemoryPool>>  _pools;     /**< List of registered pools */
+    std::vector<IMemoryPool *>               _pool_ptrs; /**< Registered pools, indexed as in the stack */
+    std::unique_ptr<std::atomic<uint32_t>[]> _next;      /**< Index of the pool below each one in the stack */
+    std::atomic<uint64_t>                    _head;      /**< Top of the stack, tagged against ABA */
+    std::atomic<int>                         _num_free;  /**< Free pools minus the threads waiting for one */
+    std::unique_ptr<arm_compute::Semaphore>  _sem;       /**< Semaphore the threads wait on for a pool */
+    mutable arm_compute::Mutex               _mtx;       /**< Mutex to control the registration of pools */
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_POOLMANAGER_H
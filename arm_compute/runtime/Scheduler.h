@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2019, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,6 +53,8 @@ public:
      */
     static void set(std::shared_ptr<IScheduler> scheduler);
     /** Access the scheduler singleton.
+     *
+     * @note If a scheduler has been bound to the calling thread with @ref ScopedScheduler, that scheduler is returned.
      *
      * @return A reference to the scheduler object.
      */
@@ -78,15 +80,44 @@ public:
     static bool is_available(Type t);
 
 private:
-    static Type _scheduler_type;
 #ifndef ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    static Type                        _scheduler_type;
     static std::shared_ptr<IScheduler> _custom_scheduler;
 #else  // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    static Type thread_local                        _scheduler_type;
     static std::shared_ptr<IScheduler> thread_local _custom_scheduler;
 #endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
     static std::map<Type, std::unique_ptr<IScheduler>> _schedulers;
 
     Scheduler();
 };
+
+/** Binds a scheduler to the calling thread for the lifetime of the object
+ *
+ * While the object is alive @ref Scheduler::get returns the bound scheduler on the calling thread, so every function
+ * and operator run from this thread uses it, whatever the active scheduler type is. This lets several models run
+ * concurrently from different threads, each on its own thread pool: for instance two CPPScheduler objects pinned to
+ * disjoint sets of cores with @ref IScheduler::set_num_threads_with_affinity.
+ *
+ * Scopes can be nested, the destructor binds back the scheduler that was bound before.
+ */
+class ScopedScheduler
+{
+public:
+    /** Constructor
+     *
+     * @param[in] scheduler Scheduler to bind to the calling thread. If nullptr, the current binding is left unchanged.
+     */
+    explicit ScopedScheduler(IScheduler *scheduler);
+    /** Destructor: restores the previously bound scheduler */
+    ~ScopedScheduler();
+    /** Prevent instances of this class from being copied */
+    ScopedScheduler(const ScopedScheduler &) = delete;
+    /** Prevent instances of this class from being copied */
+    ScopedScheduler &operator=(const ScopedScheduler &) = delete;
+
+private:
+    IScheduler *_previous;
+};
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_SCHEDULER_H
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_SUBTENSORVIEWS_H
+#define ACL_ARM_COMPUTE_RUNTIME_SUBTENSORVIEWS_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/runtime/SubTensor.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace arm_compute
+{
+/** Create views of the slices of a concatenated tensor
+ *
+ * Each view aliases the slice of @p output that the matching input of a concatenation along @p axis would be copied
+ * to. Its info keeps the strides and the offset of @p output, so operators configured and run with a view as
+ * destination write straight into the concatenated buffer and no concatenation needs to run afterwards.
+ *
+ * @note The views do not own memory and @p output must outlive them.
+ * @note The views share the padding of @p output, which must be extended before it is allocated.
+ *
+ * @param[in] output       Concatenated tensor. Its info must be initialized with the concatenated shape.
+ * @param[in] input_shapes Shapes of the inputs, in concatenation order.
+ * @param[in] axis         Concatenation axis.
+ *
+ * @return One view per input, in concatenation order
+ */
+std::vector<SubTensor>
+create_concatenate_views(ITensor *output, const std::vector<TensorShape> &input_shapes, size_t axis);
+/** Create views of the slices of a tensor split along an axis
+ *
+ * Each view aliases a slice of @p input, so consumers read the split outputs from the input buffer and no split
+ * needs to run.
+ *
+ * @note The views do not own memory and @p input must outlive them.
+ *
+ * @param[in] input       Tensor to split. Its info must be initialized.
+ * @param[in] split_sizes Size of each slice along @p axis. They must add up to the dimension of @p input.
+ * @param[in] axis        Split axis.
+ *
+ * @return One view per slice, in order along @p axis
+ */
+std::vector<SubTensor> create_split_views(ITensor *input, const std::vector<size_t> &split_sizes, size_t axis);
+/** Create views of the equal slices of a tensor split along an axis
+ *
+ * Similar to @ref create_split_views(ITensor *, const std::vector<size_t> &, size_t) with @p num_splits slices of the
+ * same size, as @ref NESplit computes them.
+ *
+ * @param[in] input      Tensor to split. Its info must be initialized.
+ * @param[in] num_splits Number of slices. It must divide the dimension of @p input along @p axis.
+ * @param[in] axis       Split axis.
+ *
+ * @return One view per slice, in order along @p axis
+ */
+std::vector<SubTensor> create_split_views(ITensor *input, unsigned int num_splits, size_t axis);
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_SUBTENSORVIEWS_H
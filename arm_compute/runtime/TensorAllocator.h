@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2019, 2024-2025 Arm Limited.
+ * Copyright (c) 2016-2019, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
  * @publicapi
  */
 
+#include "arm_compute/runtime/IAllocator.h"
 #include "arm_compute/runtime/ITensorAllocator.h"
 #include "arm_compute/runtime/Memory.h"
 #include "arm_compute/runtime/MemoryGroup.h"
@@ -116,6 +117,15 @@ public:
      * @param[in] associated_memory_group Memory group to associate the tensor with
      */
     void set_associated_memory_group(IMemoryGroup *associated_memory_group);
+    /** Sets the allocator used for the backing memory of a tensor that is not memory managed
+     *
+     * @note The allocator must outlive the backing memory.
+     * @note Tensors that are memory managed get their memory from the pools of their memory manager,
+     *       see @ref IMemoryManager::populate.
+     *
+     * @param[in] backing_allocator Allocator to use, or nullptr to use the default allocation
+     */
+    void set_backing_allocator(IAllocator *backing_allocator);
 
 protected:
     /** No-op for CPU memory
@@ -131,6 +141,7 @@ private:
     IMemoryManageable *_owner;                   /**< Memory manageable object that owns the allocator */
     IMemoryGroup      *_associated_memory_group; /**< Registered memory manager */
     Memory             _memory;                  /**< CPU memory */
+    IAllocator        *_backing_allocator;       /**< Allocator of the backing memory */
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_TENSORALLOCATOR_H
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_TRACER_H
+#define ACL_ARM_COMPUTE_RUNTIME_TRACER_H
+
+/** @file
+ * @publicapi
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+/** Low overhead recorder of trace events
+ *
+ * The events are recorded without locking in a fixed size ring buffer, the oldest events being overwritten once it
+ * is full. The buffer can be dumped at any time in the Chrome trace event format, which can be opened by Perfetto.
+ *
+ * The trace points of the library (kernel runs, worker thread workloads, OpenCL enqueues and memory pool locks) are
+ * only compiled in when the library is built with ARM_COMPUTE_TRACING_ENABLED, and recorded while the tracer is enabled.
+ * If the environment variable ARM_COMPUTE_TRACE_FILE is set, the trace is written to that file at exit.
+ */
+class Tracer final
+{
+public:
+    /** Phase of a trace event */
+    enum class Phase : uint8_t
+    {
+        BEGIN,  /**< Start of a scope */
+        END,    /**< End of the last scope started on the thread */
+        INSTANT /**< Event without duration */
+    };
+
+    /** Recorded trace event */
+    struct Event
+    {
+        std::string category;     /**< Category of the event */
+        std::string name;         /**< Name of the event */
+        uint64_t    timestamp_ns; /**< Steady clock time of the event in nanoseconds */
+        uint32_t    thread_id;    /**< Index of the thread that recorded the event */
+        Phase       phase;        /**< Phase of the event */
+    };
+
+    /** Number of events kept in the ring buffer */
+    static constexpr size_t capacity = 16384;
+    /** Longest name kept for an event, longer names are truncated */
+    static constexpr size_t max_name_length = 47;
+
+    /** Access the tracer singleton
+     *
+     * @return The tracer
+     */
+    static Tracer &get();
+    /** Prevent instances of this class from being copied */
+    Tracer(const Tracer &) = delete;
+    /** Prevent instances of this class from being copied */
+    Tracer &operator=(const Tracer &) = delete;
+    /** Destructor, writing the trace to ARM_COMPUTE_TRACE_FILE if set */
+    ~Tracer();
+
+    /** Enable or disable the recording of the events
+     *
+     * @param[in] enabled True to record the events (default)
+     */
+    void set_enabled(bool enabled);
+    /** Whether the events are recorded
+     *
+     * @return True if the events are recorded
+     */
+    bool is_enabled() const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+    /** Record an event, if enabled
+     *
+     * @param[in] category Category of the event. Must be a string literal as it is not copied.
+     * @param[in] name     Name of the event.
+     * @param[in] phase    Phase of the event.
+     */
+    void record(const char *category, const char *name, Phase phase);
+    /** Get the events currently in the ring buffer
+     *
+     * @note Events being overwritten while the buffer is read are skipped.
+     *
+     * @return The events, oldest first
+     */
+    std::vector<Event> events() const;
+    /** Write the events currently in the ring buffer in the Chrome trace event JSON format
+     *
+     * @param[out] os Stream to write the trace to
+     */
+    void dump(std::ostream &os) const;
+    /** Discard all the recorded events */
+    void clear();
+
+private:
+    struct Slot;
+
+    Tracer();
+
+    std::unique_ptr<Slot[]> _slots;
+    std::atomic<uint64_t>   _next{0};
+    std::atomic<bool>       _enabled{true};
+};
+
+/** Records the begin and end events of a scope */
+class TraceScope final
+{
+public:
+    /** Record the begin event of the scope
+     *
+     * @param[in] category Category of the scope. Must be a string literal.
+     * @param[in] name     Name of the scope.
+     */
+    TraceScope(const char *category, const char *name);
+    /** Prevent instances of this class from being copied */
+    TraceScope(const TraceScope &) = delete;
+    /** Prevent instances of this class from being copied */
+    TraceScope &operator=(const TraceScope &) = delete;
+    /** Record the end event of the scope */
+    ~TraceScope();
+
+private:
+    const char *_category;
+    bool        _recorded;
+};
+} // namespace arm_compute
+
+#ifdef ARM_COMPUTE_TRACING_ENABLED
+#define ARM_COMPUTE_TRACE_CONCAT_IMPL(a, b) a##b
+#define ARM_COMPUTE_TRACE_CONCAT(a, b)      ARM_COMPUTE_TRACE_CONCAT_IMPL(a, b)
+/** Trace the current scope */
+#define ARM_COMPUTE_TRACE_SCOPE(category, name) \
+    const ::arm_compute::TraceScope ARM_COMPUTE_TRACE_CONCAT(acl_trace_scope_, __LINE__)(category, name)
+/** Trace an event without duration */
+#define ARM_COMPUTE_TRACE_INSTANT(category, name) \
+    ::arm_compute::Tracer::get().record(category, name, ::arm_compute::Tracer::Phase::INSTANT)
+#else /* ARM_COMPUTE_TRACING_ENABLED */
+#define ARM_COMPUTE_TRACE_SCOPE(category, name)
+#define ARM_COMPUTE_TRACE_INSTANT(category, name)
+#endif /* ARM_COMPUTE_TRACING_ENABLED */
+
+#endif // ACL_ARM_COMPUTE_RUNTIME_TRACER_H
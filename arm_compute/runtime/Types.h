@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2019, 2025 Arm Limited.
+ * Copyright (c) 2016-2019, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -62,5 +62,12 @@ struct BlobInfo
     size_t alignment; /**< Blob alignment */
     size_t owners;    /**< Number of owners in parallel of the blob */
 };
+
+/** Memory usage report, in bytes */
+struct MemoryUsage
+{
+    size_t planned_size{0};   /**< Size required by the current memory plan */
+    size_t allocated_size{0}; /**< Size currently allocated */
+};
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_TYPES_H
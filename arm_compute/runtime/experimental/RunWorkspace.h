@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_RUNWORKSPACE_H
+#define ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_RUNWORKSPACE_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/ITensorPack.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace experimental
+{
+/** Transient memory of a single run of a prepared function
+ *
+ * Holds the tensors with a temporary lifetime of a function. The prepared weights are not part of it, they stay
+ * owned by the function and are shared, read-only, by every run. Giving each thread its own workspace allows
+ * the same function to run concurrently.
+ */
+class RunWorkspace
+{
+public:
+    /** Constructor */
+    RunWorkspace();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    RunWorkspace(const RunWorkspace &) = delete;
+    /** Prevent copy assignment */
+    RunWorkspace &operator=(const RunWorkspace &) = delete;
+    /** Default move constructor */
+    RunWorkspace(RunWorkspace &&);
+    /** Default move assignment */
+    RunWorkspace &operator=(RunWorkspace &&);
+    /** Default destructor */
+    ~RunWorkspace();
+    /** Allocate the temporary tensors of the given memory requirements
+     *
+     * Requirements with a persistent or prepare lifetime are skipped. A configured workspace is released first.
+     *
+     * @param[in] mem_reqs Memory requirements of the function.
+     */
+    void configure(const MemoryRequirements &mem_reqs);
+    /** Size in bytes of the allocated tensors
+     *
+     * @return the total size of the workspace
+     */
+    size_t total_size() const;
+    /** Add the workspace tensors to a tensor pack, replacing the tensors already in their slots
+     *
+     * @param[in,out] pack Tensor pack used to run the function.
+     */
+    void add_to_pack(ITensorPack &pack);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+} // namespace experimental
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_RUNWORKSPACE_H
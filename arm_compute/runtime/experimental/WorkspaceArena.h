@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_WORKSPACEARENA_H
+#define ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_WORKSPACEARENA_H
+
+/** @file
+ * @publicapi
+ */
+
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/runtime/IOperator.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace experimental
+{
+/** Single buffer holding the workspace of a chain of operators
+ *
+ * The operators are expected to be prepared and run one after the other. Their persistent workspace tensors get
+ * a region each, while the temporary and prepare-only tensors of different operators share regions, the same way
+ * @ref OffsetLifetimeManager assigns blobs: the n-th largest tensor of each operator goes to the n-th shared region,
+ * whose size is the largest of them.
+ *
+ * Once allocated, the workspace tensors are views on the arena, so running the chain performs no allocation.
+ */
+class WorkspaceArena
+{
+public:
+    /** Constructor */
+    WorkspaceArena();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    WorkspaceArena(const WorkspaceArena &) = delete;
+    /** Prevent copy assignment */
+    WorkspaceArena &operator=(const WorkspaceArena &) = delete;
+    /** Default move constructor */
+    WorkspaceArena(WorkspaceArena &&);
+    /** Default move assignment */
+    WorkspaceArena &operator=(WorkspaceArena &&);
+    /** Default destructor */
+    ~WorkspaceArena();
+    /** Plan the workspace of a chain of configured operators
+     *
+     * @param[in] operators Operators in the order they run. They must outlive the call only.
+     */
+    void configure(const std::vector<const IOperator *> &operators);
+    /** Size in bytes of the arena
+     *
+     * @return the size of the single buffer holding every workspace tensor
+     */
+    size_t total_size() const;
+    /** Alignment in bytes required for the arena
+     *
+     * @return the largest alignment of the workspace tensors
+     */
+    size_t alignment() const;
+    /** Allocate the arena */
+    void allocate();
+    /** Use externally owned memory for the arena
+     *
+     * @param[in] memory Buffer of at least @ref total_size() bytes aligned to @ref alignment(). Must outlive the runs.
+     */
+    void import_memory(void *memory);
+    /** Add the workspace tensors of an operator to its tensor pack
+     *
+     * @param[in]     index Index of the operator in the chain given to @ref configure().
+     * @param[in,out] pack  Tensor pack used to prepare or run the operator.
+     */
+    void add_to_pack(size_t index, ITensorPack &pack);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+} // namespace experimental
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_EXPERIMENTAL_WORKSPACEARENA_H
@@ -1,4 +1,4 @@
-# Copyright (c) 2025 Arm Limited.
+# Copyright (c) 2025-2026 Arm Limited.
 #
 # SPDX-License-Identifier: MIT
 #
@@ -56,6 +56,7 @@ set(
   $<$<BOOL:${ARM_COMPUTE_ENABLE_ASSERTS}>:ARM_COMPUTE_ASSERTS_ENABLED>
   $<$<BOOL:${ARM_COMPUTE_ENABLE_CPPTHREADS}>:ARM_COMPUTE_CPP_SCHEDULER>
   $<$<BOOL:${ARM_COMPUTE_ENABLE_LOGGING}>:ARM_COMPUTE_LOGGING_ENABLED>
+  $<$<BOOL:${ARM_COMPUTE_ENABLE_TRACING}>:ARM_COMPUTE_TRACING_ENABLED>
   $<$<BOOL:${ARM_COMPUTE_ENABLE_OPENMP}>:ARM_COMPUTE_OPENMP_SCHEDULER>
 )
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,15 +41,21 @@ public:
           common_opts(cmd_parser),
           model_input_width(nullptr),
           model_input_height(nullptr),
+          tile_width(nullptr),
+          tile_height(nullptr),
           common_params(),
           graph(0, "SRCNN955")
     {
         model_input_width  = cmd_parser.add_option<SimpleOption<unsigned int>>("image-width", 300);
         model_input_height = cmd_parser.add_option<SimpleOption<unsigned int>>("image-height", 300);
+        tile_width         = cmd_parser.add_option<SimpleOption<unsigned int>>("tile-width", 0);
+        tile_height        = cmd_parser.add_option<SimpleOption<unsigned int>>("tile-height", 0);
 
         // Add model id option
         model_input_width->set_help("Input image width.");
         model_input_height->set_help("Input image height.");
+        tile_width->set_help("Width of the tiles the image is split into, 0 to process the whole image at once.");
+        tile_height->set_help("Height of the tiles the image is split into, 0 to process the whole image at once.");
     }
     GraphSRCNN955Example(const GraphSRCNN955Example &)            = delete;
     GraphSRCNN955Example &operator=(const GraphSRCNN955Example &) = delete;
@@ -79,6 +85,16 @@ public:
         std::cout << "Image width: " << image_width << std::endl;
         std::cout << "Image height: " << image_height << std::endl;
 
+        // The graph is built for a tile of the image when tiling is enabled
+        const bool         is_tiled     = tile_width->value() != 0 && tile_height->value() != 0;
+        const unsigned int input_width  = is_tiled ? tile_width->value() : image_width;
+        const unsigned int input_height = is_tiled ? tile_height->value() : image_height;
+        if (is_tiled)
+        {
+            std::cout << "Tile width: " << input_width << std::endl;
+            std::cout << "Tile height: " << input_height << std::endl;
+        }
+
         // Get trainable parameters data path
         const std::string data_path  = common_params.data_path;
         const std::string model_path = "/cnn_data/srcnn955_model/";
@@ -88,7 +104,7 @@ public:
 
         // Create input descriptor
         const TensorShape tensor_shape =
-            permute_shape(TensorShape(image_width, image_height, 3U, common_params.batches), DataLayout::NCHW,
+            permute_shape(TensorShape(input_width, input_height, 3U, common_params.batches), DataLayout::NCHW,
                           common_params.data_layout);
         TensorDescriptor input_descriptor =
             TensorDescriptor(tensor_shape, common_params.data_type).set_layout(common_params.data_layout);
@@ -96,9 +112,17 @@ public:
         // Set weights trained layout
         const DataLayout weights_layout = DataLayout::NCHW;
 
+        std::unique_ptr<arm_compute::graph::ITensorAccessor> input_accessor =
+            get_input_accessor(common_params, std::move(preprocessor), false /* Do not convert to BGR */);
+        std::unique_ptr<arm_compute::graph::ITensorAccessor> output_accessor = std::make_unique<DummyAccessor>(0);
+        if (is_tiled)
+        {
+            input_accessor  = std::make_unique<TiledInputAccessor>(tiler, std::move(input_accessor));
+            output_accessor = std::make_unique<TiledOutputAccessor>(tiler, std::move(output_accessor));
+        }
+
         graph << common_params.target << common_params.fast_math_hint
-              << InputLayer(input_descriptor, get_input_accessor(common_params, std::move(preprocessor),
-                                                                 false /* Do not convert to BGR */))
+              << InputLayer(input_descriptor, std::move(input_accessor))
               << ConvolutionLayer(9U, 9U, 64U, get_weights_accessor(data_path, "conv1_weights.npy", weights_layout),
                                   get_weights_accessor(data_path, "conv1_biases.npy"), PadStrideInfo(1, 1, 4, 4))
                      .set_name("conv1/convolution")
@@ -114,17 +138,24 @@ public:
                      .set_name("conv3/convolution")
               << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
                      .set_name("conv3/Relu")
-              << OutputLayer(std::make_unique<DummyAccessor>(0));
+              << OutputLayer(std::move(output_accessor));
+
+        // Split the image in the tiles the graph is run on
+        if (is_tiled)
+        {
+            tiler->configure(graph.graph(), image_width, image_height);
+        }
 
         // Finalize graph
         GraphConfig config;
-        config.num_threads        = common_params.threads;
-        config.use_tuner          = common_params.enable_tuner;
-        config.tuner_mode         = common_params.tuner_mode;
-        config.tuner_file         = common_params.tuner_file;
-        config.mlgo_file          = common_params.mlgo_file;
-        config.use_synthetic_type = arm_compute::is_data_type_quantized(common_params.data_type);
-        config.synthetic_type     = common_params.data_type;
+        config.num_threads           = common_params.threads;
+        config.use_tuner             = common_params.enable_tuner;
+        config.tuner_mode            = common_params.tuner_mode;
+        config.tuner_file            = common_params.tuner_file;
+        config.mlgo_file             = common_params.mlgo_file;
+        config.use_trusted_configure = common_params.trusted_configure;
+        config.use_synthetic_type    = arm_compute::is_data_type_quantized(common_params.data_type);
+        config.synthetic_type        = common_params.data_type;
 
         graph.finalize(common_params.target, config);
 
@@ -138,12 +169,15 @@ public:
     }
 
 private:
-    CommandLineParser           cmd_parser;
-    CommonGraphOptions          common_opts;
-    SimpleOption<unsigned int> *model_input_width{nullptr};
-    SimpleOption<unsigned int> *model_input_height{nullptr};
-    CommonGraphParams           common_params;
-    Stream                      graph;
+    CommandLineParser             cmd_parser;
+    CommonGraphOptions            common_opts;
+    SimpleOption<unsigned int>   *model_input_width{nullptr};
+    SimpleOption<unsigned int>   *model_input_height{nullptr};
+    SimpleOption<unsigned int>   *tile_width{nullptr};
+    SimpleOption<unsigned int>   *tile_height{nullptr};
+    CommonGraphParams             common_params;
+    std::shared_ptr<SpatialTiler> tiler{std::make_shared<SpatialTiler>()};
+    Stream                        graph;
 };
 
 /** Main program for SRCNN 9-5-5
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+
+#include "support/ToolchainSupport.h"
+#include "utils/CommonGraphOptions.h"
+#include "utils/GraphUtils.h"
+#include "utils/TFLiteModel.h"
+#include "utils/Utils.h"
+
+using namespace arm_compute::utils;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::graph_utils;
+
+/** Example demonstrating how to run a TensorFlow Lite model with the Compute Library's graph API */
+class GraphTFLiteExample : public Example
+{
+public:
+    GraphTFLiteExample() : cmd_parser(), common_opts(cmd_parser), common_params(), graph(0, "TFLite")
+    {
+        model_opt = cmd_parser.add_option<SimpleOption<std::string>>("model", "");
+        model_opt->set_help("Path of the .tflite model to run");
+    }
+    GraphTFLiteExample(const GraphTFLiteExample &)            = delete;
+    GraphTFLiteExample &operator=(const GraphTFLiteExample &) = delete;
+    ~GraphTFLiteExample() override                            = default;
+    bool do_setup(int argc, char **argv) override
+    {
+        // Parse arguments
+        cmd_parser.parse(argc, argv);
+        cmd_parser.validate();
+
+        // Consume common parameters
+        common_params = consume_common_graph_parameters(common_opts);
+
+        // Return when help menu is requested
+        if (common_params.help)
+        {
+            cmd_parser.print_help(argv[0]);
+            return false;
+        }
+
+        // Checks
+        ARM_COMPUTE_EXIT_ON_MSG(model_opt->value().empty(), "A .tflite model must be given with --model");
+
+        // Print parameter values
+        std::cout << common_params << std::endl;
+        std::cout << "Model : " << model_opt->value() << std::endl;
+
+        // The data types and the layout of the tensors come from the model, only the first input and output are
+        // accessed
+        std::vector<arm_compute::graph::ITensorAccessorUPtr> input_accessors;
+        input_accessors.push_back(get_input_accessor(common_params));
+        std::vector<arm_compute::graph::ITensorAccessorUPtr> output_accessors;
+        output_accessors.push_back(get_output_accessor(common_params, 5));
+
+        graph << common_params.target << common_params.fast_math_hint
+              << TFLiteModelLayer(model_opt->value(), std::move(input_accessors), std::move(output_accessors));
+
+        // Finalize graph
+        GraphConfig config;
+        config.num_threads           = common_params.threads;
+        config.use_tuner             = common_params.enable_tuner;
+        config.tuner_mode            = common_params.tuner_mode;
+        config.tuner_file            = common_params.tuner_file;
+        config.mlgo_file             = common_params.mlgo_file;
+        config.use_trusted_configure = common_params.trusted_configure;
+
+        graph.finalize(common_params.target, config);
+
+        return true;
+    }
+    void do_run() override
+    {
+        // Run graph
+        graph.run();
+    }
+
+private:
+    CommandLineParser          cmd_parser;
+    CommonGraphOptions         common_opts;
+    SimpleOption<std::string> *model_opt{nullptr};
+    CommonGraphParams          common_params;
+    Stream                     graph;
+};
+
+/** Main program for running TensorFlow Lite models
+ *
+ * The model is imported by @ref arm_compute::graph_utils::TFLiteModelLayer, which lists the supported operators.
+ * Inputs are read from the .npy file given with --image, the top 5 predictions are printed when --labels is given.
+ *
+ * @note To list all the possible arguments execute the binary appended with the --help option
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments
+ */
+int main(int argc, char **argv)
+{
+    return arm_compute::utils::run_example<GraphTFLiteExample>(argc, argv);
+}
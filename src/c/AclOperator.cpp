@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,6 +50,41 @@ extern "C" AclStatus AclRunOperator(AclOperator external_op, AclQueue external_q
     return AclSuccess;
 }
 
+extern "C" AclStatus AclRunOperators(AclOperator   *external_ops,
+                                     AclQueue       external_queue,
+                                     AclTensorPack *external_tensors,
+                                     size_t         num_ops)
+{
+    using namespace arm_compute;
+
+    auto queue = get_internal(external_queue);
+
+    StatusCode status = detail::validate_internal_queue(queue);
+    ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+    if (num_ops != 0 && (external_ops == nullptr || external_tensors == nullptr))
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("[AclRunOperators]: Invalid operator or tensor pack list");
+        return AclInvalidArgument;
+    }
+
+    // Validate the whole list before running anything
+    for (size_t i = 0; i < num_ops; ++i)
+    {
+        status = detail::validate_internal_operator(get_internal(external_ops[i]));
+        ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+        status = detail::validate_internal_pack(get_internal(external_tensors[i]));
+        ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+    }
+
+    for (size_t i = 0; i < num_ops; ++i)
+    {
+        status = get_internal(external_ops[i])->run(*queue, get_internal(external_tensors[i])->get_tensor_pack());
+        ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+    }
+
+    return AclSuccess;
+}
+
 extern "C" AclStatus AclDestroyOperator(AclOperator external_op)
 {
     using namespace arm_compute;
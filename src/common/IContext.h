@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021,2023 Arm Limited.
+ * Copyright (c) 2021,2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,8 @@
 #ifndef SRC_COMMON_ICONTEXT_H
 #define SRC_COMMON_ICONTEXT_H
 
+#include "arm_compute/core/Error.h"
+
 #include "src/common/Types.h"
 #include "src/common/utils/Log.h"
 #include "src/common/utils/Object.h"
@@ -112,6 +114,90 @@ public:
                                                                   const AclTensorDescriptor     &dst,
                                                                   const AclActivationDescriptor &act,
                                                                   bool                           is_validate)          = 0;
+    /** Operators creation, the targets without an implementation report themselves as unsupported
+     *
+     * Optional tensors are given as nullptr. If @p is_validate is set, the configuration is validated first.
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_gemm(const AclTensorDescriptor &a,
+                                                            const AclTensorDescriptor &b,
+                                                            const AclTensorDescriptor *c,
+                                                            const AclTensorDescriptor &d,
+                                                            const AclGemmDescriptor   &gemm,
+                                                            bool                       is_validate)
+    {
+        ARM_COMPUTE_UNUSED(a, b, c, d, gemm, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    virtual std::tuple<IOperator *, StatusCode> create_matmul(const AclTensorDescriptor &lhs,
+                                                              const AclTensorDescriptor &rhs,
+                                                              const AclTensorDescriptor &dst,
+                                                              const AclMatMulDescriptor &matmul,
+                                                              bool                       is_validate)
+    {
+        ARM_COMPUTE_UNUSED(lhs, rhs, dst, matmul, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    virtual std::tuple<IOperator *, StatusCode> create_conv2d(const AclTensorDescriptor &src,
+                                                              const AclTensorDescriptor &weights,
+                                                              const AclTensorDescriptor *biases,
+                                                              const AclTensorDescriptor &dst,
+                                                              const AclConv2dDescriptor &conv,
+                                                              bool                       is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, weights, biases, dst, conv, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    virtual std::tuple<IOperator *, StatusCode> create_depthwise_conv2d(const AclTensorDescriptor          &src,
+                                                                        const AclTensorDescriptor          &weights,
+                                                                        const AclTensorDescriptor          *biases,
+                                                                        const AclTensorDescriptor          &dst,
+                                                                        const AclDepthwiseConv2dDescriptor &conv,
+                                                                        bool                                is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, weights, biases, dst, conv, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    virtual std::tuple<IOperator *, StatusCode> create_pool2d(const AclTensorDescriptor &src,
+                                                              const AclTensorDescriptor &dst,
+                                                              const AclPool2dDescriptor &pool,
+                                                              bool                       is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, dst, pool, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    virtual std::tuple<IOperator *, StatusCode> create_softmax(const AclTensorDescriptor  &src,
+                                                               const AclTensorDescriptor  &dst,
+                                                               const AclSoftmaxDescriptor &softmax,
+                                                               bool                        is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, dst, softmax, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    virtual std::tuple<IOperator *, StatusCode> create_elementwise(const AclTensorDescriptor      &src0,
+                                                                   const AclTensorDescriptor      &src1,
+                                                                   const AclTensorDescriptor      &dst,
+                                                                   const AclElementwiseDescriptor &info,
+                                                                   bool                            is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src0, src1, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    virtual std::tuple<IOperator *, StatusCode> create_quantize(const AclTensorDescriptor       &src,
+                                                                const AclTensorDescriptor       &dst,
+                                                                const AclQuantizationDescriptor &qinfo,
+                                                                bool                             is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, dst, qinfo, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    virtual std::tuple<IOperator *, StatusCode> create_dequantize(const AclTensorDescriptor       &src,
+                                                                  const AclTensorDescriptor       &dst,
+                                                                  const AclQuantizationDescriptor &qinfo,
+                                                                  bool                             is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, dst, qinfo, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
 
 private:
     Target                   _target;   /**< Target type of context */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,23 +48,74 @@ bool IOperator::is_valid() const
 
 StatusCode IOperator::run(ITensorPack &tensors)
 {
-    _op->run(tensors);
+    if (_workspace.empty())
+    {
+        run_internal(tensors);
+    }
+    else
+    {
+        ITensorPack pack = with_workspace(tensors);
+        run_internal(pack);
+    }
     return StatusCode::Success;
 }
 
 StatusCode IOperator::run(IQueue &queue, ITensorPack &tensors)
 {
-    ARM_COMPUTE_UNUSED(queue);
-    _op->run(tensors);
-    return StatusCode::Success;
+    // The pack is copied as the caller is free to reuse it once the operator has been enqueued
+    return queue.enqueue([this, tensors]() mutable { run(tensors); });
 }
 
 StatusCode IOperator::prepare(ITensorPack &tensors)
 {
-    _op->prepare(tensors);
+    if (!_is_prepared)
+    {
+        ITensorPack pack = with_workspace(tensors);
+        _op->prepare(pack);
+        release_temporaries<Tensor>(_aux_mem_req, _workspace);
+        _is_prepared = true;
+    }
     return StatusCode::Success;
 }
 
+void IOperator::set_internal_operator(std::unique_ptr<experimental::IOperator> op)
+{
+    _op          = std::move(op);
+    _is_prepared = false;
+    _workspace.clear();
+
+    // The workspace is host memory, only the CPU operators request one
+    _aux_mem_req = _op->workspace();
+    if (this->header.ctx->type() == Target::Cpu)
+    {
+        MemoryGroup mg{};
+        ITensorPack run_pack{};
+        ITensorPack prep_pack{};
+        _workspace = manage_workspace<Tensor>(_aux_mem_req, mg, run_pack, prep_pack);
+    }
+}
+
+void IOperator::run_internal(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        _op->prepare(tensors);
+        release_temporaries<Tensor>(_aux_mem_req, _workspace);
+        _is_prepared = true;
+    }
+    _op->run(tensors);
+}
+
+ITensorPack IOperator::with_workspace(const ITensorPack &tensors)
+{
+    ITensorPack pack = tensors;
+    for (auto &ws : _workspace)
+    {
+        pack.add_tensor(ws.slot, ws.tensor.get());
+    }
+    return pack;
+}
+
 MemoryRequirements IOperator::workspace() const
 {
     return _op->workspace();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,9 +30,13 @@
 // TODO: Remove when all functions have been ported
 #include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/runtime/IOperator.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "src/common/utils/Validate.h"
+#include "src/core/helpers/MemoryHelpers.h"
 
+#include <memory>
+#include <tuple>
 #include <vector>
 
 struct AclOperator_
@@ -71,7 +75,9 @@ public:
      * @return True if successful otherwise false
      */
     bool is_valid() const;
-    /** Run the kernels contained in the function
+    /** Submit the kernels contained in the function to a queue
+     *
+     * @note On asynchronous queues the operator and the tensors must remain valid until the queue has been finished.
      *
      * @param[in] queue   Queue to use
      * @param[in] tensors Vector that contains the tensors to operate on
@@ -95,13 +101,33 @@ public:
      */
     virtual MemoryRequirements workspace() const;
 
-    void set_internal_operator(std::unique_ptr<experimental::IOperator> op)
-    {
-        _op = std::move(op);
-    }
+    /** Set the operator to run
+     *
+     * On the CPU, the auxiliary tensors requested by the operator are allocated here and added to the tensors of
+     * every run, the operator is prepared on its first run.
+     *
+     * @param[in] op Operator to run
+     */
+    void set_internal_operator(std::unique_ptr<experimental::IOperator> op);
 
 private:
+    /** Run the operator, preparing it first if not done already
+     *
+     * @param[in] tensors Vector that contains the tensors to operate on, with the auxiliary tensors
+     */
+    void run_internal(ITensorPack &tensors);
+    /** Add the auxiliary tensors to a copy of the tensors to operate on
+     *
+     * @param[in] tensors Vector that contains the tensors to operate on
+     *
+     * @return the tensors to operate on with the auxiliary tensors
+     */
+    ITensorPack with_workspace(const ITensorPack &tensors);
+
     std::unique_ptr<experimental::IOperator> _op{nullptr};
+    MemoryRequirements                       _aux_mem_req{};
+    WorkspaceData<Tensor>                    _workspace{};
+    bool                                     _is_prepared{false};
 };
 
 /** Extract internal representation of an Operator
@@ -132,6 +158,26 @@ inline StatusCode validate_internal_operator(const IOperator *op)
     }
     return StatusCode::Success;
 }
+
+/** Wrap an internal operator into an operator object of a given context
+ *
+ * @param[in] ctx Context of the operator
+ * @param[in] op  Configured internal operator
+ *
+ * @return The operator object and the status code of its creation
+ */
+inline std::tuple<IOperator *, StatusCode> make_operator(IContext *ctx, std::unique_ptr<experimental::IOperator> op)
+{
+    auto iop = new arm_compute::IOperator(ctx);
+    if (iop == nullptr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Couldn't allocate internal resources");
+        return std::make_tuple(nullptr, StatusCode::OutOfMemory);
+    }
+    iop->set_internal_operator(std::move(op));
+
+    return std::make_tuple(iop, StatusCode::Success);
+}
 } // namespace detail
 } // namespace arm_compute
 #endif /* SRC_COMMON_IOPERATOR_H_ */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,8 @@
 
 #include "src/common/IContext.h"
 
+#include <functional>
+
 struct AclQueue_
 {
     arm_compute::detail::Header header{arm_compute::detail::ObjectType::Queue, nullptr};
@@ -64,6 +66,24 @@ public:
     {
         return this->header.type == detail::ObjectType::Queue;
     };
+    /** Submit a job to the queue
+     *
+     * The default implementation executes the job before returning. Asynchronous queues override it and only
+     * guarantee that the job has completed once @ref IQueue::finish has returned.
+     *
+     * @param[in] job Job to execute
+     *
+     * @return Status code
+     */
+    virtual StatusCode enqueue(std::function<void()> job)
+    {
+        job();
+        return StatusCode::Success;
+    }
+    /** Wait for all the submitted work to complete
+     *
+     * @return Status code
+     */
     virtual StatusCode finish() = 0;
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -56,7 +56,9 @@ enum class ExecutionMode
 
 enum class ImportMemoryType
 {
-    HostPtr = AclImportMemoryType::AclHostPtr
+    HostPtr               = AclImportMemoryType::AclHostPtr,
+    DmaBuf                = AclImportMemoryType::AclDmaBuf,
+    AndroidHardwareBuffer = AclImportMemoryType::AclAndroidHardwareBuffer,
 };
 } // namespace arm_compute
 #endif /* SRC_COMMON_TYPES_H_ */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Log.h"
+#include "arm_compute/core/utils/misc/Utility.h"
 
 #include "support/StringSupport.h"
 #include "support/ToolchainSupport.h"
@@ -34,6 +35,7 @@
 
 #if !defined(BARE_METAL)
 #include <algorithm>
+#include <cstdlib>
 #include <cstring>
 #include <fstream>
 #if !defined(_WIN64)
@@ -277,6 +279,145 @@ int get_max_cpus()
     }
     return max_cpus;
 }
+
+/** Read the MIDR of each core from a cache written by @ref store_midr_cache
+ *
+ * The cache is only used when it was written on a system with the same HWCAPs and number of CPUs.
+ *
+ * @param[in] path     Path of the cache file
+ * @param[in] hwcaps   HWCAP of the system
+ * @param[in] hwcaps2  HWCAP2 of the system
+ * @param[in] max_cpus Maximum number of possible CPUs
+ *
+ * @return std::vector<uint32_t> A list of the MIDR of each core, empty if the cache is missing or not valid
+ */
+std::vector<uint32_t> load_midr_cache(const std::string &path, uint32_t hwcaps, uint64_t hwcaps2, uint32_t max_cpus)
+{
+    std::vector<uint32_t> cpus;
+    std::ifstream         file(path, std::ios::in);
+    if (!file.is_open())
+    {
+        return cpus;
+    }
+
+    std::string tag;
+    uint32_t    file_hwcaps   = 0;
+    uint64_t    file_hwcaps2  = 0;
+    uint32_t    file_max_cpus = 0;
+    file >> tag >> std::hex >> file_hwcaps >> file_hwcaps2 >> std::dec >> file_max_cpus;
+    if (!file || tag != "acl_cpuinfo_v1" || file_hwcaps != hwcaps || file_hwcaps2 != hwcaps2 ||
+        file_max_cpus != max_cpus)
+    {
+        return cpus;
+    }
+
+    uint32_t midr = 0;
+    while (cpus.size() < max_cpus && (file >> std::hex >> midr))
+    {
+        cpus.emplace_back(midr);
+    }
+    if (cpus.size() != max_cpus)
+    {
+        cpus.clear();
+    }
+    return cpus;
+}
+
+/** Write the MIDR of each core to a cache read back by @ref load_midr_cache
+ *
+ * @param[in] path     Path of the cache file
+ * @param[in] hwcaps   HWCAP of the system
+ * @param[in] hwcaps2  HWCAP2 of the system
+ * @param[in] cpus     List of the MIDR of each core
+ */
+void store_midr_cache(const std::string &path, uint32_t hwcaps, uint64_t hwcaps2, const std::vector<uint32_t> &cpus)
+{
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open())
+    {
+        ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Unable to write the CPU info cache %s", path.c_str());
+        return;
+    }
+    file << "acl_cpuinfo_v1 " << std::hex << hwcaps << " " << hwcaps2 << " " << std::dec << cpus.size() << "\n";
+    for (const auto midr : cpus)
+    {
+        file << std::hex << midr << "\n";
+    }
+}
+
+/** Parse a list of ranges or single values, e.g. 0-5 or 1-3,5,7, as found in sysfs
+ *
+ * @param[in] line List to parse
+ *
+ * @return std::vector<uint32_t> The values of the list, empty if it is not valid
+ */
+std::vector<uint32_t> parse_sysfs_list(const std::string &line)
+{
+    std::vector<uint32_t> values;
+    std::stringstream     ranges(line);
+    std::string           range;
+    while (std::getline(ranges, range, ','))
+    {
+        const size_t   dash  = range.find('-');
+        char          *end   = nullptr;
+        const uint32_t first = static_cast<uint32_t>(std::strtoul(range.c_str(), &end, 10));
+        if (end == range.c_str())
+        {
+            return {};
+        }
+        uint32_t last = first;
+        if (dash != std::string::npos)
+        {
+            last = static_cast<uint32_t>(std::strtoul(range.c_str() + dash + 1, &end, 10));
+        }
+        for (uint32_t v = first; v <= last; ++v)
+        {
+            values.emplace_back(v);
+        }
+    }
+    return values;
+}
+
+/** Get the NUMA node of each CPU by parsing /sys/devices/system/node
+ *
+ * @param[in] max_cpus Maximum number of possible CPUs
+ *
+ * @return std::vector<int32_t> The node of each core, empty if the system exposes a single node or no topology
+ */
+std::vector<int32_t> numa_nodes_from_sysfs(uint32_t max_cpus)
+{
+    std::vector<int32_t> nodes;
+    std::ifstream        online("/sys/devices/system/node/online", std::ios::in);
+    std::string          line;
+    if (!online.is_open() || !getline(online, line))
+    {
+        return nodes;
+    }
+    const std::vector<uint32_t> node_ids = parse_sysfs_list(line);
+    if (node_ids.size() < 2)
+    {
+        return nodes;
+    }
+
+    nodes.resize(max_cpus, 0);
+    for (const auto node : node_ids)
+    {
+        std::stringstream str;
+        str << "/sys/devices/system/node/node" << node << "/cpulist";
+        std::ifstream cpulist(str.str(), std::ios::in);
+        if (cpulist.is_open() && getline(cpulist, line))
+        {
+            for (const auto cpu : parse_sysfs_list(line))
+            {
+                if (cpu < max_cpus)
+                {
+                    nodes[cpu] = static_cast<int32_t>(node);
+                }
+            }
+        }
+    }
+    return nodes;
+}
 #if defined(__ANDROID__)
 std::vector<uint32_t> get_cpu_capacities()
 {
@@ -355,22 +496,34 @@ CpuInfo CpuInfo::build()
 #if !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__) && \
     (defined(__arm__) || defined(__aarch64__))
     const uint32_t hwcaps   = getauxval(AT_HWCAP);
-    const uint32_t hwcaps2  = getauxval(AT_HWCAP2);
+    const uint64_t hwcaps2  = getauxval(AT_HWCAP2);
     const uint32_t max_cpus = get_max_cpus();
 
-    // Populate midr values
+    // Populate midr values, reading them from the cache when one is given
+    const std::string     cache_path = utility::getenv("ARM_COMPUTE_CPUINFO_CACHE");
     std::vector<uint32_t> cpus_midr;
-    if (hwcaps & ARM_COMPUTE_CPU_FEATURE_HWCAP_CPUID)
+    if (!cache_path.empty())
     {
-        cpus_midr = midr_from_cpuid(max_cpus);
+        cpus_midr = load_midr_cache(cache_path, hwcaps, hwcaps2, max_cpus);
     }
     if (cpus_midr.empty())
     {
-        cpus_midr = midr_from_proc_cpuinfo(max_cpus);
-    }
-    if (cpus_midr.empty())
-    {
-        cpus_midr.resize(max_cpus, 0);
+        if (hwcaps & ARM_COMPUTE_CPU_FEATURE_HWCAP_CPUID)
+        {
+            cpus_midr = midr_from_cpuid(max_cpus);
+        }
+        if (cpus_midr.empty())
+        {
+            cpus_midr = midr_from_proc_cpuinfo(max_cpus);
+        }
+        if (cpus_midr.empty())
+        {
+            cpus_midr.resize(max_cpus, 0);
+        }
+        if (!cache_path.empty())
+        {
+            store_midr_cache(cache_path, hwcaps, hwcaps2, cpus_midr);
+        }
     }
 
     // Populate isa (Assume homogeneous ISA specification)
@@ -382,6 +535,7 @@ CpuInfo CpuInfo::build()
                    [](uint32_t midr) -> CpuModel { return midr_to_model(midr); });
 
     CpuInfo info(isa, cpus_model);
+    info._numa_nodes = numa_nodes_from_sysfs(max_cpus);
     return info;
 #elif defined(__OpenBSD__)
     int    mib[2] = {0, 0};
@@ -474,6 +628,24 @@ CpuModel CpuInfo::cpu_model() const
 #endif /* defined(BARE_METAL) || defined(__APPLE__) || defined(__OpenBSD__) || (!defined(__arm__) && !defined(__aarch64__)) */
 }
 
+uint32_t CpuInfo::numa_node(uint32_t cpuid) const
+{
+    if (cpuid < _numa_nodes.size())
+    {
+        return _numa_nodes[cpuid];
+    }
+    return 0;
+}
+
+uint32_t CpuInfo::num_numa_nodes() const
+{
+    if (_numa_nodes.empty())
+    {
+        return 1;
+    }
+    return *std::max_element(_numa_nodes.begin(), _numa_nodes.end()) + 1;
+}
+
 uint32_t CpuInfo::num_cpus() const
 {
     return _cpus.size();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2021-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,6 +53,10 @@ public:
      */
     CpuInfo(CpuIsaInfo isa, std::vector<CpuModel> cpus);
     /** CpuInfo builder function from system related information
+     *
+     * On Linux, the MIDR of each core can be cached in the file given by the ARM_COMPUTE_CPUINFO_CACHE environment
+     * variable to avoid reading them from sysfs or /proc/cpuinfo at every start-up. The file is written when missing
+     * and ignored when the HWCAPs or the number of CPUs of the system do not match the ones it was written with.
      *
      * @return CpuInfo A populated CpuInfo structure
      */
@@ -95,6 +99,10 @@ public:
     {
         return _isa.svebf16;
     }
+    bool has_fp8() const
+    {
+        return _isa.fp8;
+    }
     bool has_dotprod() const
     {
         return _isa.dot;
@@ -111,6 +119,10 @@ public:
     {
         return _isa.svef32mm;
     }
+    bool has_fp8dot4() const
+    {
+        return _isa.fp8dot4;
+    }
 
     const CpuIsaInfo &isa() const
     {
@@ -125,10 +137,16 @@ public:
     CpuModel cpu_model() const;
     uint32_t num_cpus() const;
     uint32_t not_little_num_cpus() const;
+    /** NUMA node of a given CPU, 0 when the topology is unknown */
+    uint32_t numa_node(uint32_t cpuid) const;
+    /** Number of NUMA nodes of the system, 1 when the topology is unknown */
+    uint32_t num_numa_nodes() const;
 
 private:
     CpuIsaInfo            _isa{};
     std::vector<CpuModel> _cpus{};
+    /** NUMA node of each CPU, read from /sys/devices/system/node on Linux. Empty on single node systems */
+    std::vector<int32_t> _numa_nodes{};
 };
 
 /** Some systems have both big and small cores, this fuction computes the minimum number of cores
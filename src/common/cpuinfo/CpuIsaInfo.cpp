@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2021-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,6 +45,11 @@
 #define ARM_COMPUTE_CPU_FEATURE_HWCAP2_I8MM     (1 << 13)
 #define ARM_COMPUTE_CPU_FEATURE_HWCAP2_BF16     (1 << 14)
 #define ARM_COMPUTE_CPU_FEATURE_HWCAP2_SME      (1 << 23)
+#define ARM_COMPUTE_CPU_FEATURE_HWCAP2_FPMR     (1ULL << 48)
+#define ARM_COMPUTE_CPU_FEATURE_HWCAP2_F8CVT    (1ULL << 51)
+#define ARM_COMPUTE_CPU_FEATURE_HWCAP2_F8DP4    (1ULL << 53)
+#define ARM_COMPUTE_CPU_FEATURE_HWCAP2_F8E4M3   (1ULL << 55)
+#define ARM_COMPUTE_CPU_FEATURE_HWCAP2_F8E5M2   (1ULL << 56)
 
 namespace arm_compute
 {
@@ -58,14 +63,14 @@ inline bool is_feature_supported(uint64_t features, uint64_t feature_mask)
 }
 
 #if defined(__arm__)
-void decode_hwcaps(CpuIsaInfo &isa, const uint32_t hwcaps, const uint32_t hwcaps2)
+void decode_hwcaps(CpuIsaInfo &isa, const uint32_t hwcaps, const uint64_t hwcaps2)
 {
     ARM_COMPUTE_UNUSED(hwcaps2);
     isa.fp16 = false;
     isa.neon = is_feature_supported(hwcaps, ARM_COMPUTE_CPU_FEATURE_HWCAP_NEON);
 }
 #elif defined(__aarch64__)
-void decode_hwcaps(CpuIsaInfo &isa, const uint32_t hwcaps, const uint32_t hwcaps2)
+void decode_hwcaps(CpuIsaInfo &isa, const uint32_t hwcaps, const uint64_t hwcaps2)
 {
     // High-level SIMD support
     isa.neon = is_feature_supported(hwcaps, ARM_COMPUTE_CPU_FEATURE_HWCAP_ASIMD);
@@ -81,15 +86,21 @@ void decode_hwcaps(CpuIsaInfo &isa, const uint32_t hwcaps, const uint32_t hwcaps
     isa.fp16 = is_feature_supported(hwcaps, ARM_COMPUTE_CPU_FEATURE_HWCAP_FPHP | ARM_COMPUTE_CPU_FEATURE_HWCAP_ASIMDHP);
     isa.bf16 = is_feature_supported(hwcaps2, ARM_COMPUTE_CPU_FEATURE_HWCAP2_BF16);
     isa.svebf16 = is_feature_supported(hwcaps2, ARM_COMPUTE_CPU_FEATURE_HWCAP2_SVEBF16);
+    // The FP8 instructions take their formats from FPMR, which must be accessible too
+    isa.fp8 = is_feature_supported(hwcaps2, ARM_COMPUTE_CPU_FEATURE_HWCAP2_FPMR) &&
+              is_feature_supported(hwcaps2, ARM_COMPUTE_CPU_FEATURE_HWCAP2_F8CVT) &&
+              is_feature_supported(hwcaps2, ARM_COMPUTE_CPU_FEATURE_HWCAP2_F8E4M3) &&
+              is_feature_supported(hwcaps2, ARM_COMPUTE_CPU_FEATURE_HWCAP2_F8E5M2);
 
     // Instruction extensions
     isa.dot      = is_feature_supported(hwcaps, ARM_COMPUTE_CPU_FEATURE_HWCAP_ASIMDDP);
     isa.i8mm     = is_feature_supported(hwcaps2, ARM_COMPUTE_CPU_FEATURE_HWCAP2_I8MM);
     isa.svei8mm  = is_feature_supported(hwcaps2, ARM_COMPUTE_CPU_FEATURE_HWCAP2_SVEI8MM);
     isa.svef32mm = is_feature_supported(hwcaps2, ARM_COMPUTE_CPU_FEATURE_HWCAP2_SVEF32MM);
+    isa.fp8dot4  = isa.fp8 && is_feature_supported(hwcaps2, ARM_COMPUTE_CPU_FEATURE_HWCAP2_F8DP4);
 }
 #else  /* defined(__aarch64__) */
-void decode_hwcaps(CpuIsaInfo &isa, const uint32_t hwcaps, const uint32_t hwcaps2)
+void decode_hwcaps(CpuIsaInfo &isa, const uint32_t hwcaps, const uint64_t hwcaps2)
 {
     ARM_COMPUTE_UNUSED(isa, hwcaps, hwcaps2);
 }
@@ -143,7 +154,7 @@ void allowlisted_model_features(CpuIsaInfo &isa, CpuModel model)
 }
 } // namespace
 
-CpuIsaInfo init_cpu_isa_from_hwcaps(uint32_t hwcaps, uint32_t hwcaps2, uint32_t midr)
+CpuIsaInfo init_cpu_isa_from_hwcaps(uint32_t hwcaps, uint64_t hwcaps2, uint32_t midr)
 {
     CpuIsaInfo isa;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2021-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,12 +48,14 @@ struct CpuIsaInfo
     bool fp16{false};
     bool bf16{false};
     bool svebf16{false};
+    bool fp8{false};
 
     /* Instruction support */
     bool dot{false};
     bool i8mm{false};
     bool svei8mm{false};
     bool svef32mm{false};
+    bool fp8dot4{false};
 };
 
 /** Identify ISA related information through system information
@@ -64,7 +66,7 @@ struct CpuIsaInfo
  *
  * @return CpuIsaInfo A populated ISA feature structure
  */
-CpuIsaInfo init_cpu_isa_from_hwcaps(uint32_t hwcaps, uint32_t hwcaps2, uint32_t midr);
+CpuIsaInfo init_cpu_isa_from_hwcaps(uint32_t hwcaps, uint64_t hwcaps2, uint32_t midr);
 
 /** Identify ISA related information through register information
  *
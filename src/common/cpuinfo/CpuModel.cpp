@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -77,6 +77,22 @@ bool model_supports_dot(CpuModel model)
     }
 }
 
+float model_relative_capacity(CpuModel model)
+{
+    switch (model)
+    {
+        case CpuModel::A35:
+        case CpuModel::A53:
+        case CpuModel::A55r0:
+        case CpuModel::A55r1:
+            return 0.4f;
+        case CpuModel::A510:
+            return 0.5f;
+        default:
+            return 1.0f;
+    }
+}
+
 CpuModel midr_to_model(uint32_t midr)
 {
     CpuModel model = CpuModel::GENERIC;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -66,6 +66,16 @@ bool model_supports_fp16(CpuModel model);
  * @param[in] model Model to check for allowlisted capabilities
  */
 bool model_supports_dot(CpuModel model);
+
+/** Approximate throughput of a model relative to the out-of-order cores it is usually paired with
+ *
+ * @note This is used to balance the work between the cores of heterogeneous (e.g. big.LITTLE) systems.
+ *
+ * @param[in] model Model to query
+ *
+ * @return 1.0 for big or unknown cores, a lower value for the in-order LITTLE cores
+ */
+float model_relative_capacity(CpuModel model);
 } // namespace cpuinfo
 } // namespace arm_compute
 #endif /* SRC_COMMON_CPUINFO_CPUMODEL_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023 Arm Limited.
+ * Copyright (c) 2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,8 @@
 
 #include "arm_compute/function_info/ActivationLayerInfo.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace detail
@@ -41,6 +43,18 @@ DataType convert_to_legacy_data_type(AclDataType data_type)
             return DataType::F16;
         case AclDataType::AclBFloat16:
             return DataType::BFLOAT16;
+        case AclDataType::AclUInt8:
+            return DataType::U8;
+        case AclDataType::AclInt8:
+            return DataType::S8;
+        case AclDataType::AclUInt16:
+            return DataType::U16;
+        case AclDataType::AclInt16:
+            return DataType::S16;
+        case AclDataType::AclUint32:
+            return DataType::U32;
+        case AclDataType::AclInt32:
+            return DataType::S32;
         default:
             return DataType::UNKNOWN;
     }
@@ -56,6 +70,20 @@ AclDataType convert_to_c_data_type(DataType data_type)
             return AclDataType::AclFloat16;
         case DataType::BFLOAT16:
             return AclDataType::AclBFloat16;
+        case DataType::U8:
+        case DataType::QASYMM8:
+            return AclDataType::AclUInt8;
+        case DataType::S8:
+        case DataType::QASYMM8_SIGNED:
+            return AclDataType::AclInt8;
+        case DataType::U16:
+            return AclDataType::AclUInt16;
+        case DataType::S16:
+            return AclDataType::AclInt16;
+        case DataType::U32:
+            return AclDataType::AclUint32;
+        case DataType::S32:
+            return AclDataType::AclInt32;
         default:
             return AclDataType::AclDataTypeUnknown;
     }
@@ -158,5 +186,72 @@ ActivationLayerInfo convert_to_activation_info(const AclActivationDescriptor &de
 
     return ActivationLayerInfo(act, desc.a, desc.b);
 }
+
+TensorInfo convert_to_legacy_tensor_info(const AclTensorDescriptor &desc, const AclQuantizationDescriptor &quant)
+{
+    TensorInfo legacy_desc = convert_to_legacy_tensor_info(desc);
+    switch (legacy_desc.data_type())
+    {
+        case DataType::U8:
+            legacy_desc.set_data_type(DataType::QASYMM8);
+            break;
+        case DataType::S8:
+            legacy_desc.set_data_type(DataType::QASYMM8_SIGNED);
+            break;
+        default:
+            return legacy_desc;
+    }
+    legacy_desc.set_quantization_info(QuantizationInfo(quant.scale, quant.offset));
+    return legacy_desc;
+}
+
+DataLayout convert_to_legacy_data_layout(AclDataLayout layout)
+{
+    return layout == AclDataLayout::AclNchw ? DataLayout::NCHW : DataLayout::NHWC;
+}
+
+bool is_valid_pad_stride(const AclPadStrideDescriptor &desc)
+{
+    return desc.stride_x > 0 && desc.stride_y > 0 && desc.pad_left >= 0 && desc.pad_right >= 0 && desc.pad_top >= 0 &&
+           desc.pad_bottom >= 0;
+}
+
+PadStrideInfo convert_to_pad_stride_info(const AclPadStrideDescriptor &desc)
+{
+    return PadStrideInfo(desc.stride_x, desc.stride_y, desc.pad_left, desc.pad_right, desc.pad_top, desc.pad_bottom,
+                         DimensionRoundingType::FLOOR);
+}
+
+Size2D convert_to_dilation(int32_t dilation_x, int32_t dilation_y)
+{
+    return Size2D(std::max(dilation_x, 1), std::max(dilation_y, 1));
+}
+
+PoolingLayerInfo convert_to_pooling_info(const AclPool2dDescriptor &desc)
+{
+    PoolingType type;
+    switch (desc.type)
+    {
+        case AclPoolingType::AclPoolingMax:
+            type = PoolingType::MAX;
+            break;
+        case AclPoolingType::AclPoolingAvg:
+            type = PoolingType::AVG;
+            break;
+        case AclPoolingType::AclPoolingL2:
+            type = PoolingType::L2;
+            break;
+        default:
+            return PoolingLayerInfo();
+    }
+
+    const DataLayout layout = convert_to_legacy_data_layout(desc.data_layout);
+    if (desc.is_global)
+    {
+        return PoolingLayerInfo(type, layout);
+    }
+    return PoolingLayerInfo(type, Size2D(desc.pool_width, desc.pool_height), layout,
+                            convert_to_pad_stride_info(desc.pad_stride), desc.exclude_padding);
+}
 } // namespace detail
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023 Arm Limited.
+ * Copyright (c) 2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -54,6 +54,53 @@ AclTensorDescriptor convert_to_descriptor(const TensorInfo &info);
  * @return Legacy tensor meta-data
  */
 ActivationLayerInfo convert_to_activation_info(const AclActivationDescriptor &desc);
+/** Convert a descriptor of a quantized tensor to a legacy format one
+ *
+ * The 8-bit integer data types are converted to their asymmetric quantized counterparts, the other ones are left
+ * unchanged without quantization.
+ *
+ * @param[in] desc  Descriptor to convert
+ * @param[in] quant Quantization of the tensor
+ *
+ * @return Legacy tensor meta-data
+ */
+TensorInfo convert_to_legacy_tensor_info(const AclTensorDescriptor &desc, const AclQuantizationDescriptor &quant);
+/** Convert a data layout to a legacy one, NHWC if unknown
+ *
+ * @param[in] layout Data layout to convert
+ *
+ * @return Legacy data layout
+ */
+DataLayout convert_to_legacy_data_layout(AclDataLayout layout);
+/** Check that a padding and strides descriptor has positive strides and no negative padding
+ *
+ * @param[in] desc Descriptor to check
+ *
+ * @return True if the descriptor is valid
+ */
+bool is_valid_pad_stride(const AclPadStrideDescriptor &desc);
+/** Convert a padding and strides descriptor to an internal one
+ *
+ * @param[in] desc Descriptor to convert
+ *
+ * @return Legacy padding and strides information
+ */
+PadStrideInfo convert_to_pad_stride_info(const AclPadStrideDescriptor &desc);
+/** Convert the dilations of a descriptor to an internal one, a dilation that is not positive being 1
+ *
+ * @param[in] dilation_x Dilation along the width
+ * @param[in] dilation_y Dilation along the height
+ *
+ * @return Legacy dilation
+ */
+Size2D convert_to_dilation(int32_t dilation_x, int32_t dilation_y);
+/** Convert an AclPool2d descriptor to an internal one
+ *
+ * @param[in] desc Descriptor to convert
+ *
+ * @return Legacy pooling information
+ */
+PoolingLayerInfo convert_to_pooling_info(const AclPool2dDescriptor &desc);
 } // namespace detail
 } // namespace arm_compute
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited.
+ * Copyright (c) 2020-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,13 +27,106 @@
 #include "arm_compute/core/CL/OpenCL.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/misc/Utility.h"
 
 #include "support/StringSupport.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iomanip>
 #include <regex>
+#include <sstream>
 
 namespace arm_compute
 {
+namespace
+{
+/** Key of a program in the persistent cache of program binaries */
+std::string program_cache_key(const cl::Device &device, const std::string &build_options, const std::string &source)
+{
+    return device.getInfo<CL_DEVICE_NAME>() + "\n" + device.getInfo<CL_DEVICE_VERSION>() + "\n" +
+           device.getInfo<CL_DRIVER_VERSION>() + "\n" + build_options + "\n" + source;
+}
+
+/** Path of a program in the persistent cache, named after the FNV-1a hash of its key */
+std::string program_cache_path(const std::string &directory, const std::string &key)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (const char c : key)
+    {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+    }
+
+    std::stringstream path;
+    path << directory << "/" << std::hex << std::setw(16) << std::setfill('0') << hash << ".clbin";
+    return path.str();
+}
+
+/** Reads a program binary from the persistent cache
+ *
+ * @note The key is stored with the binary to rule out hash collisions.
+ *
+ * @return The binary, empty if the program is not in the cache
+ */
+std::vector<unsigned char> read_program_binary(const std::string &path, const std::string &key)
+{
+    std::ifstream file(path, std::ios::binary);
+    size_t        key_len    = 0;
+    size_t        binary_len = 0;
+    if (!file.read(reinterpret_cast<char *>(&key_len), sizeof(size_t)) || key_len != key.size())
+    {
+        return {};
+    }
+
+    std::string stored_key(key_len, '\0');
+    if (!file.read(&stored_key[0], key_len) || stored_key != key ||
+        !file.read(reinterpret_cast<char *>(&binary_len), sizeof(size_t)) || binary_len == 0)
+    {
+        return {};
+    }
+
+    std::vector<unsigned char> binary(binary_len);
+    if (!file.read(reinterpret_cast<char *>(binary.data()), binary_len))
+    {
+        return {};
+    }
+    return binary;
+}
+
+/** Writes a program binary to the persistent cache
+ *
+ * The binary is written to a temporary file first and renamed, so that concurrent readers never see a partial file.
+ */
+void write_program_binary(const std::string &path, const std::string &key, const std::vector<unsigned char> &binary)
+{
+    const std::string tmp_path =
+        path + ".tmp" + support::cpp11::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    {
+        std::ofstream file(tmp_path, std::ios::binary);
+        const size_t  key_len    = key.size();
+        const size_t  binary_len = binary.size();
+        file.write(reinterpret_cast<const char *>(&key_len), sizeof(size_t));
+        file.write(key.data(), key_len);
+        file.write(reinterpret_cast<const char *>(&binary_len), sizeof(size_t));
+        file.write(reinterpret_cast<const char *>(binary.data()), binary_len);
+        if (!file)
+        {
+            file.close();
+            std::remove(tmp_path.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tmp_path.c_str());
+    }
+}
+} // namespace
+
 CLBuildOptions::CLBuildOptions() : _build_opts()
 {
 }
@@ -151,12 +244,28 @@ Kernel::Kernel(std::string name, const cl::Program &program)
 {
 }
 CLCompileContext::CLCompileContext()
-    : _context(), _device(), _programs_map(), _built_programs_map(), _is_wbsm_supported()
+    : _context(),
+      _device(),
+      _programs_map(),
+      _built_programs_map(),
+      _is_wbsm_supported(),
+      _program_cache_dir(utility::getenv("ARM_COMPUTE_CL_PROGRAM_CACHE_DIR")),
+      _program_cache_writes(),
+      _programs_in_flight(),
+      _programs_mtx(std::make_unique<arm_compute::Mutex>())
 {
 }
 
 CLCompileContext::CLCompileContext(cl::Context context, const cl::Device &device)
-    : _context(), _device(), _programs_map(), _built_programs_map(), _is_wbsm_supported()
+    : _context(),
+      _device(),
+      _programs_map(),
+      _built_programs_map(),
+      _is_wbsm_supported(),
+      _program_cache_dir(utility::getenv("ARM_COMPUTE_CL_PROGRAM_CACHE_DIR")),
+      _program_cache_writes(),
+      _programs_in_flight(),
+      _programs_mtx(std::make_unique<arm_compute::Mutex>())
 {
     _context           = std::move(context);
     _device            = CLDevice(device);
@@ -172,24 +281,65 @@ Kernel CLCompileContext::create_kernel(const std::string &kernel_name,
 {
     const std::string build_options      = generate_build_options(build_options_set, kernel_path);
     const std::string built_program_name = program_name + "_" + build_options;
-    auto              built_program_it   = _built_programs_map.find(built_program_name);
-    cl::Program       cl_program;
 
-    if (_built_programs_map.end() != built_program_it)
+    std::promise<cl::Program>       build_promise;
+    std::shared_future<cl::Program> build_future;
     {
+        arm_compute::lock_guard<arm_compute::Mutex> lock(*_programs_mtx);
+
         // If program has been built, retrieve to create kernel from it
-        cl_program = built_program_it->second;
+        const auto built_program_it = _built_programs_map.find(built_program_name);
+        if (_built_programs_map.end() != built_program_it)
+        {
+            return Kernel(kernel_name, built_program_it->second);
+        }
+
+        // If another thread is building the program, wait for it instead of building it again
+        const auto in_flight_it = _programs_in_flight.find(built_program_name);
+        if (_programs_in_flight.end() != in_flight_it)
+        {
+            build_future = in_flight_it->second;
+        }
+        else
+        {
+            _programs_in_flight.emplace(built_program_name, build_promise.get_future().share());
+        }
     }
-    else
+
+    if (build_future.valid())
     {
-        Program program = load_program(program_name, program_source, is_binary);
+        return Kernel(kernel_name, build_future.get());
+    }
 
-        // Build program
-        cl_program = program.build(build_options);
+    // Build program without holding the lock so that other programs can be built in parallel
+    cl::Program cl_program;
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        const Program &program = load_program(program_name, program_source, is_binary);
+        cl_program             = build_program(program, program_source, is_binary, build_options);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch (...)
+    {
+        // Let the waiting threads see the failure, a later call will try building the program again
+        {
+            arm_compute::lock_guard<arm_compute::Mutex> lock(*_programs_mtx);
+            _programs_in_flight.erase(built_program_name);
+        }
+        build_promise.set_exception(std::current_exception());
+        throw;
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
 
-        // Add built program to internal map
+    // Add built program to internal map
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> lock(*_programs_mtx);
         _built_programs_map.emplace(built_program_name, cl_program);
+        _programs_in_flight.erase(built_program_name);
     }
+    build_promise.set_value(cl_program);
 
     // Create and return kernel
     return Kernel(kernel_name, cl_program);
@@ -198,6 +348,8 @@ Kernel CLCompileContext::create_kernel(const std::string &kernel_name,
 const Program &
 CLCompileContext::load_program(const std::string &program_name, const std::string &program_source, bool is_binary) const
 {
+    arm_compute::lock_guard<arm_compute::Mutex> lock(*_programs_mtx);
+
     const auto program_it = _programs_map.find(program_name);
 
     if (program_it != _programs_map.end())
@@ -228,6 +380,87 @@ CLCompileContext::load_program(const std::string &program_name, const std::strin
     return new_program.first->second;
 }
 
+cl::Program CLCompileContext::build_program(const Program     &program,
+                                            const std::string &program_source,
+                                            bool               is_binary,
+                                            const std::string &build_options) const
+{
+#ifdef EMBEDDED_KERNELS
+    is_binary = false;
+#endif /* EMBEDDED_KERNELS */
+
+    if (_program_cache_dir.empty() || is_binary)
+    {
+        return program.build(build_options);
+    }
+
+    const cl::Device &device = _device.cl_device();
+    const std::string key    = program_cache_key(device, build_options, program_source);
+    const std::string path   = program_cache_path(_program_cache_dir, key);
+    const auto        binary = read_program_binary(path, key);
+    if (!binary.empty())
+    {
+        try
+        {
+            cl::Program cl_program(_context, {device}, {binary});
+            if (Program::build(cl_program, build_options))
+            {
+                return cl_program;
+            }
+        }
+        catch (const cl::Error &)
+        {
+            // Stale or corrupted binary, compile the program from source
+        }
+    }
+
+    cl::Program cl_program = program.build(build_options);
+
+    std::vector<std::vector<unsigned char>> binaries;
+    if (cl_program.getInfo(CL_PROGRAM_BINARIES, &binaries) == CL_SUCCESS && binaries.size() == 1 &&
+        !binaries[0].empty())
+    {
+#ifndef NO_MULTI_THREADING
+        arm_compute::lock_guard<arm_compute::Mutex> lock(*_programs_mtx);
+        // Drop the writes already completed
+        _program_cache_writes.erase(
+            std::remove_if(_program_cache_writes.begin(), _program_cache_writes.end(),
+                           [](const std::shared_future<void> &write)
+                           { return write.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }),
+            _program_cache_writes.end());
+        _program_cache_writes.emplace_back(
+            std::async(std::launch::async, write_program_binary, path, key, std::move(binaries[0])).share());
+#else  /* NO_MULTI_THREADING */
+        write_program_binary(path, key, binaries[0]);
+#endif /* NO_MULTI_THREADING */
+    }
+
+    return cl_program;
+}
+
+void CLCompileContext::set_program_cache_directory(const std::string &directory)
+{
+    _program_cache_dir = directory;
+}
+
+const std::string &CLCompileContext::program_cache_directory() const
+{
+    return _program_cache_dir;
+}
+
+void CLCompileContext::wait_for_program_cache() const
+{
+    std::vector<std::shared_future<void>> writes;
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> lock(*_programs_mtx);
+        std::swap(writes, _program_cache_writes);
+    }
+    for (const auto &write : writes)
+    {
+        write.wait();
+    }
+}
+
 void CLCompileContext::set_context(cl::Context context)
 {
     _context = std::move(context);
@@ -319,11 +552,13 @@ std::string CLCompileContext::stringify_set(const StringSet &s, const std::strin
 
 void CLCompileContext::add_built_program(const std::string &built_program_name, const cl::Program &program) const
 {
+    arm_compute::lock_guard<arm_compute::Mutex> lock(*_programs_mtx);
     _built_programs_map.emplace(built_program_name, program);
 }
 
 void CLCompileContext::clear_programs_cache()
 {
+    arm_compute::lock_guard<arm_compute::Mutex> lock(*_programs_mtx);
     _programs_map.clear();
     _built_programs_map.clear();
 }
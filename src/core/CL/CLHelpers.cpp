@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include "src/gpu/cl/ClCompileContext.h"
 #include "src/gpu/cl/ClKernelLibrary.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -395,6 +396,28 @@ size_t get_cl_image_pitch_alignment(const cl::Device &device)
     }
 }
 
+size_t get_cl_sub_buffer_alignment(const cl::Device &device)
+{
+    size_t  alignment          = 0;
+    cl_uint base_address_align = 0;
+    if (clGetDeviceInfo(device(), CL_DEVICE_MEM_BASE_ADDR_ALIGN, sizeof(cl_uint), &base_address_align, nullptr) ==
+        CL_SUCCESS)
+    {
+        // Reported in bits
+        alignment = base_address_align / 8;
+    }
+
+    // The widest pixel of the images created from buffers is 4 x 32 bits
+    cl_uint image_address_align = 0;
+    if (image2d_from_buffer_supported(device) &&
+        clGetDeviceInfo(device(), CL_DEVICE_IMAGE_BASE_ADDRESS_ALIGNMENT, sizeof(cl_uint), &image_address_align,
+                        nullptr) == CL_SUCCESS)
+    {
+        alignment = std::max(alignment, static_cast<size_t>(image_address_align) * 16);
+    }
+    return alignment;
+}
+
 bool get_cl_non_uniform_work_group_supported(const cl::Device &device)
 {
     cl_bool supported = CL_FALSE;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021 Arm Limited.
+ * Copyright (c) 2016-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,7 +59,13 @@ std::string CLKernelLibrary::get_program_name(const std::string &kernel_name) co
 }
 void CLKernelLibrary::init(std::string kernel_path, cl::Context context, cl::Device device)
 {
-    _compile_context = CLCompileContext(context, device);
+    // Keep the persistent cache of program binaries set on the previous context
+    const std::string program_cache_dir = _compile_context.program_cache_directory();
+    _compile_context                    = CLCompileContext(context, device);
+    if (!program_cache_dir.empty())
+    {
+        _compile_context.set_program_cache_directory(program_cache_dir);
+    }
     opencl::ClKernelLibrary::get().set_kernel_path(kernel_path);
 }
 void CLKernelLibrary::set_kernel_path(const std::string &kernel_path)
@@ -98,6 +104,14 @@ void CLKernelLibrary::add_built_program(const std::string &built_program_name, c
 {
     _compile_context.add_built_program(built_program_name, program);
 }
+void CLKernelLibrary::set_program_cache_directory(const std::string &directory)
+{
+    _compile_context.set_program_cache_directory(directory);
+}
+void CLKernelLibrary::wait_for_program_cache() const
+{
+    _compile_context.wait_for_program_cache();
+}
 bool CLKernelLibrary::fp16_supported() const
 {
     return _compile_context.fp16_supported();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,22 @@
 
 #include <cstddef>
 
+namespace
+{
+arm_compute::ICLKernelRecorder      *kernel_recorder       = nullptr;
+arm_compute::ICLKernelEventListener *kernel_event_listener = nullptr;
+} // namespace
+
+void arm_compute::set_kernel_recorder(ICLKernelRecorder *recorder)
+{
+    kernel_recorder = recorder;
+}
+
+void arm_compute::set_kernel_event_listener(ICLKernelEventListener *listener)
+{
+    kernel_event_listener = listener;
+}
+
 void arm_compute::enqueue(cl::CommandQueue  &queue,
                           ICLKernel         &kernel,
                           const Window      &window,
@@ -79,7 +95,21 @@ void arm_compute::enqueue(cl::CommandQueue  &queue,
     {
         set_wbsm(kernel.kernel(), kernel.wbsm_hint());
     }
-    queue.enqueueNDRangeKernel(kernel.kernel(), cl::NullRange, gws, lws);
+    if (kernel_event_listener != nullptr)
+    {
+        cl::Event event;
+        queue.enqueueNDRangeKernel(kernel.kernel(), cl::NullRange, gws, lws, nullptr, &event);
+        kernel_event_listener->dispatched(kernel, gws, lws, event);
+    }
+    else
+    {
+        queue.enqueueNDRangeKernel(kernel.kernel(), cl::NullRange, gws, lws);
+    }
+
+    if (kernel_recorder != nullptr)
+    {
+        kernel_recorder->record(kernel.kernel(), gws, lws);
+    }
 }
 
 namespace arm_compute
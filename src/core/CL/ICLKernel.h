@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -506,6 +506,52 @@ private:
     cl::NDRange    _cached_gws;         /**< Latest GWS used to enqueue this kernel */
 };
 
+/** Interface of an object recording the kernels dispatched by @ref enqueue */
+class ICLKernelRecorder
+{
+public:
+    /** Default virtual destructor */
+    virtual ~ICLKernelRecorder() = default;
+    /** Record a kernel dispatch
+     *
+     * @param[in] kernel Kernel dispatched, with its arguments set
+     * @param[in] gws    Global workgroup size of the dispatch
+     * @param[in] lws    Local workgroup size of the dispatch
+     */
+    virtual void record(const cl::Kernel &kernel, const cl::NDRange &gws, const cl::NDRange &lws) = 0;
+};
+
+/** Set the recorder notified of every kernel dispatched by @ref enqueue
+ *
+ * @note The dispatches are still enqueued to their command queue while recording.
+ *
+ * @param[in] recorder Recorder to notify, nullptr to stop recording
+ */
+void set_kernel_recorder(ICLKernelRecorder *recorder);
+
+/** Interface of an object notified of the events of the kernels dispatched by @ref enqueue */
+class ICLKernelEventListener
+{
+public:
+    /** Default virtual destructor */
+    virtual ~ICLKernelEventListener() = default;
+    /** Notify a kernel dispatch
+     *
+     * @param[in] kernel Kernel dispatched
+     * @param[in] gws    Global workgroup size of the dispatch
+     * @param[in] lws    Local workgroup size of the dispatch
+     * @param[in] event  Event of the dispatch
+     */
+    virtual void
+    dispatched(ICLKernel &kernel, const cl::NDRange &gws, const cl::NDRange &lws, const cl::Event &event) = 0;
+};
+
+/** Set the listener notified of the event of every kernel dispatched by @ref enqueue
+ *
+ * @param[in] listener Listener to notify, nullptr to stop creating events for the dispatches
+ */
+void set_kernel_event_listener(ICLKernelEventListener *listener);
+
 /** Add the kernel to the command queue with the given window.
  *
  * @note Depending on the size of the window, this might translate into several jobs being enqueued.
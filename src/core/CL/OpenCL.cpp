@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -147,6 +147,7 @@ bool CLSymbols::load(const std::vector<std::string> &libraries_filenames, bool u
     LOAD_FUNCTION_PTR(clReleaseKernel, handle);
     LOAD_FUNCTION_PTR(clCreateProgramWithSource, handle);
     LOAD_FUNCTION_PTR(clCreateBuffer, handle);
+    LOAD_FUNCTION_PTR(clCreateSubBuffer, handle);
     LOAD_FUNCTION_PTR(clRetainKernel, handle);
     LOAD_FUNCTION_PTR(clCreateKernel, handle);
     LOAD_FUNCTION_PTR(clGetProgramInfo, handle);
@@ -183,6 +184,9 @@ bool CLSymbols::load(const std::vector<std::string> &libraries_filenames, bool u
     LOAD_FUNCTION_PTR(clEnqueueSVMUnmap, handle);
     LOAD_FUNCTION_PTR(clEnqueueMarker, handle);
     LOAD_FUNCTION_PTR(clWaitForEvents, handle);
+    LOAD_FUNCTION_PTR(clEnqueueMarkerWithWaitList, handle);
+    LOAD_FUNCTION_PTR(clEnqueueBarrierWithWaitList, handle);
+    LOAD_FUNCTION_PTR(clGetEventInfo, handle);
     LOAD_FUNCTION_PTR(clCreateImage, handle);
     LOAD_FUNCTION_PTR(clSetKernelExecInfo, handle);
     LOAD_FUNCTION_PTR(clGetExtensionFunctionAddressForPlatform, handle);
@@ -285,6 +289,58 @@ cl_int clWaitForEvents(cl_uint num_events, const cl_event *event_list)
     }
 }
 
+cl_int clEnqueueMarkerWithWaitList(cl_command_queue command_queue,
+                                   cl_uint          num_events_in_wait_list,
+                                   const cl_event  *event_wait_list,
+                                   cl_event        *event)
+{
+    arm_compute::CLSymbols::get().load_default();
+    auto func = arm_compute::CLSymbols::get().clEnqueueMarkerWithWaitList_ptr;
+    if (func != nullptr)
+    {
+        return func(command_queue, num_events_in_wait_list, event_wait_list, event);
+    }
+    else
+    {
+        return CL_OUT_OF_RESOURCES;
+    }
+}
+
+cl_int clEnqueueBarrierWithWaitList(cl_command_queue command_queue,
+                                    cl_uint          num_events_in_wait_list,
+                                    const cl_event  *event_wait_list,
+                                    cl_event        *event)
+{
+    arm_compute::CLSymbols::get().load_default();
+    auto func = arm_compute::CLSymbols::get().clEnqueueBarrierWithWaitList_ptr;
+    if (func != nullptr)
+    {
+        return func(command_queue, num_events_in_wait_list, event_wait_list, event);
+    }
+    else
+    {
+        return CL_OUT_OF_RESOURCES;
+    }
+}
+
+cl_int clGetEventInfo(cl_event      event,
+                      cl_event_info param_name,
+                      size_t        param_value_size,
+                      void         *param_value,
+                      size_t       *param_value_size_ret)
+{
+    arm_compute::CLSymbols::get().load_default();
+    auto func = arm_compute::CLSymbols::get().clGetEventInfo_ptr;
+    if (func != nullptr)
+    {
+        return func(event, param_name, param_value_size, param_value, param_value_size_ret);
+    }
+    else
+    {
+        return CL_OUT_OF_RESOURCES;
+    }
+}
+
 cl_int clEnqueueSVMMap(cl_command_queue command_queue,
                        cl_bool          blocking_map,
                        cl_map_flags     flags,
@@ -850,6 +906,28 @@ cl_mem clCreateBuffer(cl_context context, cl_mem_flags flags, size_t size, void
     }
 }
 
+cl_mem clCreateSubBuffer(cl_mem                buffer,
+                         cl_mem_flags          flags,
+                         cl_buffer_create_type buffer_create_type,
+                         const void           *buffer_create_info,
+                         cl_int               *errcode_ret)
+{
+    arm_compute::CLSymbols::get().load_default();
+    auto func = arm_compute::CLSymbols::get().clCreateSubBuffer_ptr;
+    if (func != nullptr)
+    {
+        return func(buffer, flags, buffer_create_type, buffer_create_info, errcode_ret);
+    }
+    else
+    {
+        if (errcode_ret != nullptr)
+        {
+            *errcode_ret = CL_OUT_OF_RESOURCES;
+        }
+        return nullptr;
+    }
+}
+
 cl_program clCreateProgramWithSource(
     cl_context context, cl_uint count, const char **strings, const size_t *lengths, cl_int *errcode_ret)
 {
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "helpers.h"
+#include "tile_helpers.h"
+
+#if defined(DATA_TYPE) && defined(NUM_STAGES)
+
+/** Map the coordinates at the output of a copy program stage to the coordinates at its input
+ *
+ * Stages are encoded as follows:
+ * - Reshape:   s0 = 0, s1..s4 input shape, s5..s8 output shape
+ * - Permute:   s0 = 1, s1..s4 permutation vector, padded with the identity
+ * - Slice:     s0 = 2, s1..s4 start coordinates, s5..s8 strides
+ *
+ * @param[in]     stage Encoded stage
+ * @param[in,out] c     Coordinates of the element, mapped in place
+ */
+inline void copy_program_stage(const int16 stage, int *c)
+{
+    if(stage.s0 == 0)
+    {
+        int index = ((c[3] * stage.s7 + c[2]) * stage.s6 + c[1]) * stage.s5 + c[0];
+        c[0]      = index % stage.s1;
+        index /= stage.s1;
+        c[1] = index % stage.s2;
+        index /= stage.s2;
+        c[2] = index % stage.s3;
+        c[3] = index / stage.s3;
+    }
+    else if(stage.s0 == 1)
+    {
+        int src_c[4];
+        src_c[stage.s1] = c[0];
+        src_c[stage.s2] = c[1];
+        src_c[stage.s3] = c[2];
+        src_c[stage.s4] = c[3];
+        c[0]            = src_c[0];
+        c[1]            = src_c[1];
+        c[2]            = src_c[2];
+        c[3]            = src_c[3];
+    }
+    else
+    {
+        c[0] = stage.s1 + c[0] * stage.s5;
+        c[1] = stage.s2 + c[1] * stage.s6;
+        c[2] = stage.s3 + c[2] * stage.s7;
+        c[3] = stage.s4 + c[3] * stage.s8;
+    }
+}
+
+/** Perform a sequence of data movements (reshape, permute, slice) of up to 4D tensors in a single pass
+ *
+ * Each work-item copies one element of the destination: its coordinates are mapped back through the stages, from the
+ * last to the first, to the coordinates of the element to read in the source. The shapes and the coordinates of the
+ * stages are kernel arguments, so that a program only depends on the element size and the number of stages.
+ *
+ * @note The data type must be passed at compile time using -DDATA_TYPE, as the unsigned type of the element size (e.g. -DDATA_TYPE=ushort)
+ * @note The number of stages must be passed at compile time using -DNUM_STAGES (e.g. -DNUM_STAGES=2). The maximum number of stages is 8
+ *
+ * @param[in]  src_ptr                           Pointer to the source tensor. Supported data types: All
+ * @param[in]  src_stride_y                      Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_stride_z                      Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  src_stride_w                      Stride of the source tensor in W dimension (in bytes)
+ * @param[in]  src_c                             Size of the first dimension of the source tensor
+ * @param[in]  src_w                             Size of the second dimension of the source tensor
+ * @param[in]  src_h                             Size of the third dimension of the source tensor
+ * @param[in]  src_n                             Size of the fourth dimension of the source tensor
+ * @param[in]  src_offset_first_element_in_bytes The offset of the first element in the source tensor
+ * @param[out] dst_ptr                           Pointer to the destination tensor. Supported data types: same as @p src_ptr
+ * @param[in]  dst_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_stride_z                      Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_stride_w                      Stride of the destination tensor in W dimension (in bytes)
+ * @param[in]  dst_c                             Size of the first dimension of the destination tensor
+ * @param[in]  dst_w                             Size of the second dimension of the destination tensor
+ * @param[in]  dst_h                             Size of the third dimension of the destination tensor
+ * @param[in]  dst_n                             Size of the fourth dimension of the destination tensor
+ * @param[in]  dst_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ * @param[in]  stage0                            Encoded first stage, see @ref copy_program_stage
+ * @param[in]  stage1                            Encoded second stage, if any
+ * @param[in]  stage2                            Encoded third stage, if any
+ * @param[in]  stage3                            Encoded fourth stage, if any
+ * @param[in]  stage4                            Encoded fifth stage, if any
+ * @param[in]  stage5                            Encoded sixth stage, if any
+ * @param[in]  stage6                            Encoded seventh stage, if any
+ * @param[in]  stage7                            Encoded eighth stage, if any
+ */
+__kernel void copy_program(TENSOR4D_T(src, BUFFER),
+                           TENSOR4D_T(dst, BUFFER),
+                           const int16 stage0,
+                           const int16 stage1,
+                           const int16 stage2,
+                           const int16 stage3,
+                           const int16 stage4,
+                           const int16 stage5,
+                           const int16 stage6,
+                           const int16 stage7)
+{
+    int c[4];
+    c[0] = get_global_id(0);
+    c[1] = get_global_id(1);
+    c[2] = get_global_id(2) % dst_h;
+    c[3] = get_global_id(2) / dst_h;
+
+    __global uchar *dst_addr = dst_ptr + dst_offset_first_element_in_bytes + c[0] * sizeof(DATA_TYPE) +
+                               c[1] * dst_stride_y + c[2] * dst_stride_z + c[3] * dst_stride_w;
+
+#if NUM_STAGES > 7
+    copy_program_stage(stage7, c);
+#endif // NUM_STAGES > 7
+#if NUM_STAGES > 6
+    copy_program_stage(stage6, c);
+#endif // NUM_STAGES > 6
+#if NUM_STAGES > 5
+    copy_program_stage(stage5, c);
+#endif // NUM_STAGES > 5
+#if NUM_STAGES > 4
+    copy_program_stage(stage4, c);
+#endif // NUM_STAGES > 4
+#if NUM_STAGES > 3
+    copy_program_stage(stage3, c);
+#endif // NUM_STAGES > 3
+#if NUM_STAGES > 2
+    copy_program_stage(stage2, c);
+#endif // NUM_STAGES > 2
+#if NUM_STAGES > 1
+    copy_program_stage(stage1, c);
+#endif // NUM_STAGES > 1
+    copy_program_stage(stage0, c);
+
+    __global uchar *src_addr = src_ptr + src_offset_first_element_in_bytes + c[0] * sizeof(DATA_TYPE) +
+                               c[1] * src_stride_y + c[2] * src_stride_z + c[3] * src_stride_w;
+
+    *((__global DATA_TYPE *)dst_addr) = *((__global DATA_TYPE *)src_addr);
+}
+#endif // defined(DATA_TYPE) && defined(NUM_STAGES)
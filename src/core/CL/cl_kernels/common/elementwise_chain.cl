@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "helpers.h"
+#include "tile_helpers.h"
+#include "activation_float_helpers.h"
+
+/** Helpers of the elementwise chain kernels generated at runtime by ClElementwiseChainKernel
+ *
+ * The generated source appends to this file an elementwise_chain kernel evaluating the operations of the chain on a
+ * float vector of VEC_SIZE elements, so that the intermediate results never leave the registers:
+ *
+ * __kernel void elementwise_chain(TENSOR3D_T(src, BUFFER), TENSOR3D_T(op0, BUFFER), ..., TENSOR3D_T(dst, BUFFER))
+ * {
+ *     CHAIN_COORDS;
+ *     CHAIN_VEC_TYPE v = CHAIN_LOAD(src);
+ *     v = v + CHAIN_LOAD(op0);
+ *     v = ACTIVATION(relu, float, VEC_SIZE, v, 0, 0);
+ *     CHAIN_STORE(v);
+ * }
+ *
+ * @note The data type of the source and operands must be passed at compile time using -DDATA_TYPE (e.g. -DDATA_TYPE=half)
+ * @note The data type of the destination must be passed at compile time using -DDST_DATA_TYPE (e.g. -DDST_DATA_TYPE=uchar)
+ * @note The vector size must be passed at compile time using -DVEC_SIZE (e.g. -DVEC_SIZE=4)
+ * @note The leftover vector size must be passed at compile time using -DVEC_SIZE_LEFTOVER (e.g. -DVEC_SIZE_LEFTOVER=3). It is defined as the remainder between the destination's first dimension and VEC_SIZE
+ * @note To quantize the result of the chain, the scale and offset of the destination must be passed at compile time using -DDST_SCALE and -DDST_OFFSET (e.g. -DDST_SCALE=0.5f -DDST_OFFSET=10)
+ */
+#if defined(DATA_TYPE) && defined(DST_DATA_TYPE) && defined(VEC_SIZE) && defined(VEC_SIZE_LEFTOVER)
+
+/** The chain is evaluated in float whatever the data type of the tensors */
+#define CHAIN_VEC_TYPE VEC_DATA_TYPE(float, VEC_SIZE)
+
+/** Position of the work-item: first element along X, row and plane */
+#define CHAIN_COORDS                                               \
+    const int x = GET_SPATIAL_IDX(0, VEC_SIZE, VEC_SIZE_LEFTOVER); \
+    const int y = GET_SPATIAL_IDX(1, 1, 0);                        \
+    const int z = GET_SPATIAL_IDX(2, 1, 0)
+
+/** Address of the elements of the work-item in the tensor called name */
+#define CHAIN_ADDRESS(name) \
+    (name##_ptr + name##_offset_first_element_in_bytes + x * sizeof(DATA_TYPE) + y * name##_stride_y + z * name##_stride_z)
+
+/** Load the elements of the work-item from the tensor called name, converted to float */
+#define CHAIN_LOAD(name) CONVERT(VLOAD(VEC_SIZE)(0, (__global DATA_TYPE *)CHAIN_ADDRESS(name)), CHAIN_VEC_TYPE)
+
+#if defined(DST_SCALE) && defined(DST_OFFSET)
+/** Convert the result of the chain to the destination data type */
+#define CHAIN_CONVERT_OUT(v) \
+    CONVERT_SAT_ROUND((v) / (float)DST_SCALE + (float)DST_OFFSET, VEC_DATA_TYPE(DST_DATA_TYPE, VEC_SIZE), rte)
+#else // defined(DST_SCALE) && defined(DST_OFFSET)
+/** Convert the result of the chain to the destination data type */
+#define CHAIN_CONVERT_OUT(v) CONVERT(v, VEC_DATA_TYPE(DST_DATA_TYPE, VEC_SIZE))
+#endif // defined(DST_SCALE) && defined(DST_OFFSET)
+
+/** Store the result of the chain, the first work-item along X stores the leftover elements */
+#define CHAIN_STORE(v)                                                                                                 \
+    {                                                                                                                  \
+        VEC_DATA_TYPE(DST_DATA_TYPE, VEC_SIZE)                                                                         \
+        out0                     = CHAIN_CONVERT_OUT(v);                                                               \
+        __global uchar *dst_addr = dst_ptr + dst_offset_first_element_in_bytes + x * sizeof(DST_DATA_TYPE) +          \
+                                   y * dst_stride_y + z * dst_stride_z;                                                \
+        STORE_VECTOR_SELECT(out, DST_DATA_TYPE, dst_addr, VEC_SIZE, VEC_SIZE_LEFTOVER,                                 \
+                            VEC_SIZE_LEFTOVER != 0 && get_global_id(0) == 0)                                           \
+    }
+
+#endif // defined(DATA_TYPE) && defined(DST_DATA_TYPE) && defined(VEC_SIZE) && defined(VEC_SIZE_LEFTOVER)
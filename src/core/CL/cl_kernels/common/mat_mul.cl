@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,9 +48,11 @@ inline void perform_bias_addition(uchar *bias_ptr, uint bias_offset_first_elemen
  * @note The data type must be passed at compile time using -DDATA_TYPE (e.g. -DDATA_TYPE=float)
  * @note The block's dimensions used for the LHS and RHS matrices (M0, N0 and K0) must be passed at compile time using -DN0, -DM0 and -DK0 (e.g. -DN0=8, -DM0=4, -DK0=4).
  * @note The fused activation function used should be passed with -DACTIVATION_TYPE, -DA_VAL and -DB_VAL are used for min and max output bounded activation functions.
- * @note The number of leftover outputs rows/columns must be passed using -DPARTIAL_STORE_N0 and -DPARTIAL_STORE_M0 (e.g. -DPARTIAL_STORE_N0=2, -DPARTIAL_STORE_M0=3)
- * @note The dimension K must be passed at compile time using -DK (e.g. -DK=6)
+ * @note The number of leftover output columns must be passed using -DPARTIAL_STORE_N0 (e.g. -DPARTIAL_STORE_N0=2)
+ * @note The dimension K and the number of leftover output rows are kernel arguments, so that the program does not depend on them
  * @note The tensor type ("BUFFER" or "IMAGE") of the rhs tensor must be passed at compile time using -DRHS_TENSOR_TYPE (e.g. -DRHS_TENSOR_TYPE=BUFFER)
+ * @note The tensor type ("BUFFER" or "IMAGE") of the lhs tensor must be passed at compile time using -DLHS_TENSOR_TYPE (e.g. -DLHS_TENSOR_TYPE=BUFFER)
+ * @note If the lhs tensor is read through cl_image, -DEXPORT_LHS_TO_CL_IMAGE must be passed at compile time and K0 can only be 4, 8 or 16
  * @note The kernel name in uppercase must be passed at compile time (e.g. -DMAT_MUL_NATIVE_NT_NT)
  * @note Only the following configurations of M0, N0 and K0 are currently supported:
  *  - M0 > 0
@@ -58,6 +60,7 @@ inline void perform_bias_addition(uchar *bias_ptr, uint bias_offset_first_elemen
  *  - K0 = 1, 2, 3, 4, 8, 16
  * @note Values > 8 for M0 are not expected to be efficient
  *
+ * @param[in]  lhs_img                            (Optional) Read only cl_image object for the lhs tensor. Included when LHS_TENSOR_TYPE=IMAGE
  * @param[in]  lhs_ptr                            Pointer to the lhs matrix. Supported data types: F32/F16
  * @param[in]  lhs_stride_y                       Stride of the lhs matrix in Y (2nd) dimension (in bytes)
  * @param[in]  lhs_stride_z                       Stride of the lhs tensor in Z (3rd) dimension (in bytes)
@@ -87,17 +90,21 @@ inline void perform_bias_addition(uchar *bias_ptr, uint bias_offset_first_elemen
  * @param[in]  dst_h                              The height of the dst tensor
  * @param[in]  dst_n                              Number of the matrices (buffers) in the batch
  * @param[in]  dst_offset_first_element_in_bytes  The offset of the first element in the dst matrix
+ * @param[in]  K                                  Number of columns of the lhs matrix (or rows if it is transposed)
+ * @param[in]  partial_store_m0                   Number of leftover output rows (M % M0)
  */
 __kernel void mat_mul_native_nt_nt(
-    TENSOR3D_T(lhs, BUFFER),
+    TENSOR3D_T(lhs, LHS_TENSOR_TYPE),
     TENSOR3D_T(rhs, RHS_TENSOR_TYPE),
 #ifdef BIAS
     TENSOR3D_T(bias, BUFFER),
 #endif // defined(BIAS)
-    TENSOR3D_T(dst, BUFFER))
+    TENSOR3D_T(dst, BUFFER),
+    const int K,
+    const int partial_store_m0)
 {
     const uint x = GET_SPATIAL_IDX(0, N0, PARTIAL_STORE_N0);
-    const uint y = GET_SPATIAL_IDX(1, M0, PARTIAL_STORE_M0);
+    const uint y = GET_SPATIAL_IDX(1, M0, partial_store_m0);
     const uint z = GET_SPATIAL_IDX(2, 1, 0);
 
     // Compute LHS/RHS/DST matrix address
@@ -113,6 +120,9 @@ __kernel void mat_mul_native_nt_nt(
     })
 
     const int rhs_z = z * rhs_h;
+#if defined(EXPORT_LHS_TO_CL_IMAGE)
+    const int lhs_z = z * lhs_h;
+#endif // defined(EXPORT_LHS_TO_CL_IMAGE)
     int       k;
     for(k = 0; k <= K - K0; k += K0)
     {
@@ -130,7 +140,11 @@ __kernel void mat_mul_native_nt_nt(
         })
 
         // Load tile from the lhs/rhs tensors
+#if defined(EXPORT_LHS_TO_CL_IMAGE)
+        T_LOAD(DATA_TYPE, M0, K0, IMAGE, lhs, k, y + lhs_z, 1, lhs_stride_y, a);
+#else  // defined(EXPORT_LHS_TO_CL_IMAGE)
         T_LOAD(DATA_TYPE, M0, K0, BUFFER, lhs, 0, 0, 1, lhs_stride_y, a);
+#endif // defined(EXPORT_LHS_TO_CL_IMAGE)
         T_LOAD(DATA_TYPE, K0, N0, RHS_TENSOR_TYPE, rhs, x, k + rhs_z, 1, rhs_stride_y, b);
 
         T_MMUL(DATA_TYPE, DATA_TYPE, DATA_TYPE, M0, N0, K0, NT, NT, a, b, acc);
@@ -138,7 +152,6 @@ __kernel void mat_mul_native_nt_nt(
         lhs_offset_first_element_in_bytes += K0 * sizeof(DATA_TYPE);
     }
 
-#if K % K0 != 0
     /* Leftover Loop */
     for(; k < K; ++k)
     {
@@ -163,15 +176,14 @@ __kernel void mat_mul_native_nt_nt(
 
         lhs_offset_first_element_in_bytes += 1 * sizeof(DATA_TYPE);
     }
-#endif // K % K0 != 0
 
     const bool x_cond = PARTIAL_STORE_N0 != 0 && get_global_id(0) == 0;
-    const bool y_cond = PARTIAL_STORE_M0 != 0 && get_global_id(1) == 0;
+    const bool y_cond = partial_store_m0 != 0 && get_global_id(1) == 0;
 
     TILE(int, M0, 1, indirect_buffer);
     LOOP_UNROLLING(int, _i, 0, 1, M0,
     {
-        indirect_buffer[_i].v = min(_i, select(M0 - 1, PARTIAL_STORE_M0 - 1, y_cond));
+        indirect_buffer[_i].v = min(_i, select(M0 - 1, partial_store_m0 - 1, y_cond));
     });
 
 #ifdef BIAS
@@ -192,9 +204,11 @@ __kernel void mat_mul_native_nt_nt(
  * @note The data type must be passed at compile time using -DDATA_TYPE (e.g. -DDATA_TYPE=float)
  * @note The block's dimensions used for the LHS and RHS matrices (M0, N0 and K0) must be passed at compile time using -DN0, -DM0 and -DK0 (e.g. -DN0=8, -DM0=4, -DK0=4).
  * @note The fused activation function used should be passed with -DACTIVATION_TYPE, -DA_VAL and -DB_VAL are used for min and max output bounded activation functions.
- * @note The number of leftover outputs rows/columns must be passed using -DPARTIAL_STORE_N0 and -DPARTIAL_STORE_M0 (e.g. -DPARTIAL_STORE_N0=2, -DPARTIAL_STORE_M0=3)
- * @note The dimension K must be passed at compile time using -DK (e.g. -DK=6)
+ * @note The number of leftover output columns must be passed using -DPARTIAL_STORE_N0 (e.g. -DPARTIAL_STORE_N0=2)
+ * @note The dimension K and the number of leftover output rows are kernel arguments, so that the program does not depend on them
  * @note The tensor type ("BUFFER" or "IMAGE") of the rhs tensor must be passed at compile time using -DRHS_TENSOR_TYPE (e.g. -DRHS_TENSOR_TYPE=BUFFER)
+ * @note The tensor type ("BUFFER" or "IMAGE") of the lhs tensor must be passed at compile time using -DLHS_TENSOR_TYPE (e.g. -DLHS_TENSOR_TYPE=BUFFER)
+ * @note If the lhs tensor is read through cl_image, -DEXPORT_LHS_TO_CL_IMAGE must be passed at compile time and K0 can only be 4, 8 or 16
  * @note The kernel name in uppercase must be passed at compile time (e.g. -DMAT_MUL_NATIVE_NT_T)
  * @note Only the following configurations of M0, N0 and K0 are currently supported:
  *  - M0 > 0
@@ -202,6 +216,7 @@ __kernel void mat_mul_native_nt_nt(
  *  - K0 = 1, 2, 3, 4, 8, 16 (only 4, 8, 16 if RHS_TENSOR_TYPE=IMAGE)
  * @note Values > 8 for M0, N0 and K0 are not expected to be efficient
  *
+ * @param[in]  lhs_img                            (Optional) Read only cl_image object for the lhs tensor. Included when LHS_TENSOR_TYPE=IMAGE
  * @param[in]  lhs_ptr                            Pointer to the lhs matrix. Supported data types: F32/F16
  * @param[in]  lhs_stride_y                       Stride of the lhs matrix in Y (2nd) dimension (in bytes)
  * @param[in]  lhs_stride_z                       Stride of the lhs tensor in Z (3rd) dimension (in bytes)
@@ -231,17 +246,21 @@ __kernel void mat_mul_native_nt_nt(
  * @param[in]  dst_h                              The height of the dst tensor
  * @param[in]  dst_n                              Number of the matrices (buffers) in the batch
  * @param[in]  dst_offset_first_element_in_bytes  The offset of the first element in the dst matrix
+ * @param[in]  K                                  Number of columns of the lhs matrix (or rows if it is transposed)
+ * @param[in]  partial_store_m0                   Number of leftover output rows (M % M0)
  */
-__kernel void mat_mul_native_nt_t(TENSOR3D_T(lhs, BUFFER),
+__kernel void mat_mul_native_nt_t(TENSOR3D_T(lhs, LHS_TENSOR_TYPE),
                                   TENSOR3D_T(rhs, RHS_TENSOR_TYPE),
 #ifdef BIAS
                                   TENSOR3D_T(bias, BUFFER),
 #endif // defined(BIAS)
-                                  TENSOR3D_T(dst, BUFFER))
+                                  TENSOR3D_T(dst, BUFFER),
+                                  const int K,
+                                  const int partial_store_m0)
 
 {
     const uint x = GET_SPATIAL_IDX(0, N0, PARTIAL_STORE_N0);
-    const uint y = GET_SPATIAL_IDX(1, M0, PARTIAL_STORE_M0);
+    const uint y = GET_SPATIAL_IDX(1, M0, partial_store_m0);
     const uint z = GET_SPATIAL_IDX(2, 1, 0);
 
     // Compute LHS/RHS/DST matrix address
@@ -257,6 +276,9 @@ __kernel void mat_mul_native_nt_t(TENSOR3D_T(lhs, BUFFER),
     })
 
     const int rhs_z = z * rhs_h;
+#if defined(EXPORT_LHS_TO_CL_IMAGE)
+    const int lhs_z = z * lhs_h;
+#endif // defined(EXPORT_LHS_TO_CL_IMAGE)
     int       k;
     for(k = 0; k <= K - K0; k += K0)
     {
@@ -274,7 +296,11 @@ __kernel void mat_mul_native_nt_t(TENSOR3D_T(lhs, BUFFER),
         })
 
         // Load tile from the lhs/rhs tensors
+#if defined(EXPORT_LHS_TO_CL_IMAGE)
+        T_LOAD(DATA_TYPE, M0, K0, IMAGE, lhs, k, y + lhs_z, 1, lhs_stride_y, a);
+#else  // defined(EXPORT_LHS_TO_CL_IMAGE)
         T_LOAD(DATA_TYPE, M0, K0, BUFFER, lhs, 0, 0, 1, lhs_stride_y, a);
+#endif // defined(EXPORT_LHS_TO_CL_IMAGE)
         T_LOAD(DATA_TYPE, N0, K0, RHS_TENSOR_TYPE, rhs, k, x + rhs_z, 1, rhs_stride_y, b);
 
 #if GPU_ARCH == GPU_ARCH_MIDGARD
@@ -299,7 +325,6 @@ __kernel void mat_mul_native_nt_t(TENSOR3D_T(lhs, BUFFER),
         lhs_offset_first_element_in_bytes += K0 * sizeof(DATA_TYPE);
     }
 
-#if K % K0 != 0
     /* Leftover Loop */
     for(; k < K; ++k)
     {
@@ -334,15 +359,14 @@ __kernel void mat_mul_native_nt_t(TENSOR3D_T(lhs, BUFFER),
 
         lhs_offset_first_element_in_bytes += 1 * sizeof(DATA_TYPE);
     }
-#endif // K % K0 != 0
 
     const bool x_cond = PARTIAL_STORE_N0 != 0 && get_global_id(0) == 0;
-    const bool y_cond = PARTIAL_STORE_M0 != 0 && get_global_id(1) == 0;
+    const bool y_cond = partial_store_m0 != 0 && get_global_id(1) == 0;
 
     TILE(int, M0, 1, indirect_buffer);
     LOOP_UNROLLING(int, _i, 0, 1, M0,
     {
-        indirect_buffer[_i].v = min(_i, select(M0 - 1, PARTIAL_STORE_M0 - 1, y_cond));
+        indirect_buffer[_i].v = min(_i, select(M0 - 1, partial_store_m0 - 1, y_cond));
     });
 
 #ifdef BIAS
@@ -363,8 +387,8 @@ __kernel void mat_mul_native_nt_t(TENSOR3D_T(lhs, BUFFER),
  * @note The data type must be passed at compile time using -DDATA_TYPE (e.g. -DDATA_TYPE=float)
  * @note The block's dimensions used for the LHS and RHS matrices (M0, N0 and K0) must be passed at compile time using -DN0, -DM0 and -DK0 (e.g. -DN0=8, -DM0=4, -DK0=4).
  * @note The fused activation function used should be passed with -DACTIVATION_TYPE, -DA_VAL and -DB_VAL are used for min and max output bounded activation functions.
- * @note The number of leftover outputs rows/columns must be passed using -DPARTIAL_STORE_N0 and -DPARTIAL_STORE_M0 (e.g. -DPARTIAL_STORE_N0=2, -DPARTIAL_STORE_M0=3)
- * @note The dimension K must be passed at compile time using -DK (e.g. -DK=6)
+ * @note The number of leftover output columns must be passed using -DPARTIAL_STORE_N0 (e.g. -DPARTIAL_STORE_N0=2)
+ * @note The dimension K and the number of leftover output rows are kernel arguments, so that the program does not depend on them
  * @note The tensor type ("BUFFER" or "IMAGE") of the rhs tensor must be passed at compile time using -DRHS_TENSOR_TYPE (e.g. -DRHS_TENSOR_TYPE=BUFFER)
  * @note The kernel name in uppercase must be passed at compile time (e.g. -DMAT_MUL_NATIVE_T_NT)
  * @note Only the following configurations of M0, N0 and K0 are currently supported:
@@ -402,6 +426,8 @@ __kernel void mat_mul_native_nt_t(TENSOR3D_T(lhs, BUFFER),
  * @param[in]  dst_h                              The height of the dst tensor
  * @param[in]  dst_n                              Number of the matrices (buffers) in the batch
  * @param[in]  dst_offset_first_element_in_bytes  The offset of the first element in the dst matrix
+ * @param[in]  K                                  Number of columns of the lhs matrix (or rows if it is transposed)
+ * @param[in]  partial_store_m0                   Number of leftover output rows (M % M0)
  */
 __kernel void mat_mul_native_t_nt(
     TENSOR3D_T(lhs, BUFFER),
@@ -409,10 +435,12 @@ __kernel void mat_mul_native_t_nt(
 #ifdef BIAS
     TENSOR3D_T(bias, BUFFER),
 #endif // defined(BIAS)
-    TENSOR3D_T(dst, BUFFER))
+    TENSOR3D_T(dst, BUFFER),
+    const int K,
+    const int partial_store_m0)
 {
     const uint x = GET_SPATIAL_IDX(0, N0, PARTIAL_STORE_N0);
-    const uint y = GET_SPATIAL_IDX(1, M0, PARTIAL_STORE_M0);
+    const uint y = GET_SPATIAL_IDX(1, M0, partial_store_m0);
     const uint z = GET_SPATIAL_IDX(2, 1, 0);
 
     // Compute LHS/RHS/DST matrix address
@@ -466,7 +494,6 @@ __kernel void mat_mul_native_t_nt(
         lhs_offset_first_element_in_bytes += K0 * lhs_stride_y;
     }
 
-#if K % K0 != 0
     /* Leftover Loop */
     for(; k < K; ++k)
     {
@@ -501,15 +528,14 @@ __kernel void mat_mul_native_t_nt(
 
         lhs_offset_first_element_in_bytes += 1 * lhs_stride_y;
     }
-#endif // K % K0 != 0
 
     const bool x_cond = PARTIAL_STORE_N0 != 0 && get_global_id(0) == 0;
-    const bool y_cond = PARTIAL_STORE_M0 != 0 && get_global_id(1) == 0;
+    const bool y_cond = partial_store_m0 != 0 && get_global_id(1) == 0;
 
     TILE(int, M0, 1, indirect_buffer);
     LOOP_UNROLLING(int, _i, 0, 1, M0,
     {
-        indirect_buffer[_i].v = min(_i, select(M0 - 1, PARTIAL_STORE_M0 - 1, y_cond));
+        indirect_buffer[_i].v = min(_i, select(M0 - 1, partial_store_m0 - 1, y_cond));
     });
 
 #ifdef BIAS
@@ -530,8 +556,8 @@ __kernel void mat_mul_native_t_nt(
  * @note The data type must be passed at compile time using -DDATA_TYPE (e.g. -DDATA_TYPE=float)
  * @note The block's dimensions used for the LHS and RHS matrices (M0, N0 and K0) must be passed at compile time using -DN0, -DM0 and -DK0 (e.g. -DN0=8, -DM0=4, -DK0=4).
  * @note The fused activation function used should be passed with -DACTIVATION_TYPE, -DA_VAL and -DB_VAL are used for min and max output bounded activation functions.
- * @note The number of leftover outputs rows/columns must be passed using -DPARTIAL_STORE_N0 and -DPARTIAL_STORE_M0 (e.g. -DPARTIAL_STORE_N0=2, -DPARTIAL_STORE_M0=3)
- * @note The dimension K must be passed at compile time using -DK (e.g. -DK=6)
+ * @note The number of leftover output columns must be passed using -DPARTIAL_STORE_N0 (e.g. -DPARTIAL_STORE_N0=2)
+ * @note The dimension K and the number of leftover output rows are kernel arguments, so that the program does not depend on them
  * @note The tensor type ("BUFFER" or "IMAGE") of the rhs tensor must be passed at compile time using -DRHS_TENSOR_TYPE (e.g. -DRHS_TENSOR_TYPE=BUFFER)
  * @note The kernel name in uppercase must be passed at compile time (e.g. -DMAT_MUL_NATIVE_T_NT)
  * @note Only the following configurations of M0, N0 and K0 are currently supported:
@@ -569,6 +595,8 @@ __kernel void mat_mul_native_t_nt(
  * @param[in]  dst_h                              The height of the dst tensor
  * @param[in]  dst_n                              Number of the matrices (buffers) in the batch
  * @param[in]  dst_offset_first_element_in_bytes  The offset of the first element in the dst matrix
+ * @param[in]  K                                  Number of columns of the lhs matrix (or rows if it is transposed)
+ * @param[in]  partial_store_m0                   Number of leftover output rows (M % M0)
  */
 __kernel void mat_mul_native_t_t(
     TENSOR3D_T(lhs, BUFFER),
@@ -576,10 +604,12 @@ __kernel void mat_mul_native_t_t(
 #ifdef BIAS
     TENSOR3D_T(bias, BUFFER),
 #endif // defined(BIAS)
-    TENSOR3D_T(dst, BUFFER))
+    TENSOR3D_T(dst, BUFFER),
+    const int K,
+    const int partial_store_m0)
 {
     const uint x = GET_SPATIAL_IDX(0, N0, PARTIAL_STORE_N0);
-    const uint y = GET_SPATIAL_IDX(1, M0, PARTIAL_STORE_M0);
+    const uint y = GET_SPATIAL_IDX(1, M0, partial_store_m0);
     const uint z = GET_SPATIAL_IDX(2, 1, 0);
 
     // Compute LHS/RHS/DST matrix address
@@ -643,7 +673,6 @@ __kernel void mat_mul_native_t_t(
         lhs_offset_first_element_in_bytes += K0 * lhs_stride_y;
     }
 
-#if K % K0 != 0
     /* Leftover Loop */
     for(; k < K; ++k)
     {
@@ -686,15 +715,14 @@ __kernel void mat_mul_native_t_t(
 
         lhs_offset_first_element_in_bytes += 1 * lhs_stride_y;
     }
-#endif // K % K0 != 0
 
     const bool x_cond = PARTIAL_STORE_N0 != 0 && get_global_id(0) == 0;
-    const bool y_cond = PARTIAL_STORE_M0 != 0 && get_global_id(1) == 0;
+    const bool y_cond = partial_store_m0 != 0 && get_global_id(1) == 0;
 
     TILE(int, M0, 1, indirect_buffer);
     LOOP_UNROLLING(int, _i, 0, 1, M0,
     {
-        indirect_buffer[_i].v = min(_i, select(M0 - 1, PARTIAL_STORE_M0 - 1, y_cond));
+        indirect_buffer[_i].v = min(_i, select(M0 - 1, partial_store_m0 - 1, y_cond));
     });
 
 #ifdef BIAS
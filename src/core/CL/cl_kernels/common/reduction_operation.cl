@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2023 Arm Limited.
+ * Copyright (c) 2016-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -113,6 +113,136 @@ __kernel void reduction_operation_x(
     *((__global DATA_TYPE *)output_addr) = res;
 }
 #endif // defined(OPERATION)
+
+#if defined(OPERATION) && defined(LOCAL_SIZE) && defined(CHUNK_WIDTH)
+
+#if defined(PROD)
+#define COMBINE(x, y) ((x) * (y))
+#elif defined(MIN)
+#define COMBINE(x, y) min(x, y)
+#elif defined(MAX)
+#define COMBINE(x, y) max(x, y)
+#else // !(defined(PROD) || defined(MIN) || defined(MAX))
+#define COMBINE(x, y) ((x) + (y))
+#endif // defined(PROD)
+
+#if defined(SUBGROUP_REDUCTION)
+#pragma OPENCL EXTENSION cl_khr_subgroups : enable
+#if defined(MIN)
+#define SUB_GROUP_REDUCE(x) sub_group_reduce_min(x)
+#elif defined(MAX)
+#define SUB_GROUP_REDUCE(x) sub_group_reduce_max(x)
+#else // !(defined(MIN) || defined(MAX))
+#define SUB_GROUP_REDUCE(x) sub_group_reduce_add(x)
+#endif // defined(MIN)
+#endif // defined(SUBGROUP_REDUCTION)
+
+/** This kernel performs a reduction on x-axis with a work-group per chunk of each row.
+ *
+ * The work-items of a work-group reduce vectors of the chunk strided by the work-group, then their results are combined
+ * by sub-group reductions when -DSUBGROUP_REDUCTION is passed, or by a tree reduction in local memory otherwise.
+ *
+ * @note The data type must be passed at compile time using -DDATA_TYPE: e.g. -DDATA_TYPE=float
+ * @note The operation we want to perform must be passed at compile time using -DOPERATION e.g. -DOPERATION=square_sum
+ * @note The mean flag must be passed at compile time using -DMEAN if we want to compute the mean value
+ * @note The width size must be passed at compile time using -DWIDTH e.g. -DWIDTH=32768
+ * @note The local size, a power of two, must be passed at compile time using -DLOCAL_SIZE e.g. -DLOCAL_SIZE=128
+ * @note The number of elements of each chunk must be passed at compile time using -DCHUNK_WIDTH e.g. -DCHUNK_WIDTH=4096.
+ *       The result of the chunk handled by the n-th work-group along x is stored to the n-th element of the output row,
+ *       the mean of a partial result being its sum divided by the whole width
+ *
+ * @param[in] input_ptr                            Pointer to the source tensor. Supported data types: F16/F32
+ * @param[in] input_stride_x                       Stride of the source tensor in X dimension (in bytes)
+ * @param[in] input_step_x                         input_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in] input_stride_y                       Stride of the source tensor in Y dimension (in bytes)
+ * @param[in] input_step_y                         input_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in] input_stride_z                       Stride of the source tensor in Z dimension (in bytes)
+ * @param[in] input_step_z                         input_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in] input_offset_first_element_in_bytes  The offset of the first element in the source tensor
+ * @param[in] output_ptr                           Pointer to the destination tensor. Supported data types: same as @p input
+ * @param[in] output_stride_x                      Stride of the destination tensor in X dimension (in bytes)
+ * @param[in] output_step_x                        output_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in] output_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in] output_step_y                        output_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in] output_stride_z                      Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in] output_step_z                        output_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in] output_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ */
+__kernel void reduction_operation_x_local(
+    TENSOR3D_DECLARATION(input),
+    TENSOR3D_DECLARATION(output))
+{
+    __local DATA_TYPE partials[LOCAL_SIZE];
+
+    const int lid       = get_local_id(0);
+    const int partition = get_group_id(0);
+    const int y         = get_global_id(1);
+    const int z         = get_global_id(2);
+    const int x_start   = partition * CHUNK_WIDTH;
+    const int x_end     = min(x_start + CHUNK_WIDTH, WIDTH);
+    const int x_vec_end = x_start + ((x_end - x_start) / VEC_SIZE) * VEC_SIZE;
+
+    __global uchar *input_addr  = input_ptr + input_offset_first_element_in_bytes + y * input_stride_y + z * input_stride_z;
+    __global uchar *output_addr = output_ptr + output_offset_first_element_in_bytes + partition * sizeof(DATA_TYPE) + y * output_stride_y + z * output_stride_z;
+
+#if defined(MIN) || defined(MAX)
+    DATA_TYPE res = *((__global DATA_TYPE *)(input_addr + x_start * sizeof(DATA_TYPE)));
+#elif defined(PROD)
+    DATA_TYPE res = (DATA_TYPE)1;
+#else  // !(defined(MIN) || defined(MAX) || defined(PROD))
+    DATA_TYPE res = (DATA_TYPE)0;
+#endif // defined(MIN) || defined(MAX)
+
+    for(int x = x_start + lid * VEC_SIZE; x < x_vec_end; x += LOCAL_SIZE * VEC_SIZE)
+    {
+        VEC_DATA_TYPE(DATA_TYPE, VEC_SIZE)
+        vals = VLOAD(VEC_SIZE)(0, (__global DATA_TYPE *)(input_addr + x * sizeof(DATA_TYPE)));
+        res  = OPERATION(res, vals, VEC_SIZE);
+    }
+    for(int x = x_vec_end + lid; x < x_end; x += LOCAL_SIZE)
+    {
+        DATA_TYPE val = *((__global DATA_TYPE *)(input_addr + x * sizeof(DATA_TYPE)));
+        res           = OPERATION(res, val, 1);
+    }
+
+#if defined(SUBGROUP_REDUCTION)
+    res = SUB_GROUP_REDUCE(res);
+    if(get_sub_group_local_id() == 0)
+    {
+        partials[get_sub_group_id()] = res;
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+    if(lid == 0)
+    {
+        res = partials[0];
+        for(uint i = 1; i < get_num_sub_groups(); ++i)
+        {
+            res = COMBINE(res, partials[i]);
+        }
+    }
+#else  // !defined(SUBGROUP_REDUCTION)
+    partials[lid] = res;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for(int stride = LOCAL_SIZE / 2; stride > 0; stride /= 2)
+    {
+        if(lid < stride)
+        {
+            partials[lid] = COMBINE(partials[lid], partials[lid + stride]);
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    res = partials[0];
+#endif // defined(SUBGROUP_REDUCTION)
+
+    if(lid == 0)
+    {
+#if defined(MEAN)
+        res /= WIDTH;
+#endif // defined(MEAN)
+        *((__global DATA_TYPE *)output_addr) = res;
+    }
+}
+#endif // defined(OPERATION) && defined(LOCAL_SIZE) && defined(CHUNK_WIDTH)
 /** This kernel performs reduction on x-axis. (Non parallel)
  *
  * @note The data type must be passed at compile time using -DDATA_TYPE: e.g. -DDATA_TYPE=float
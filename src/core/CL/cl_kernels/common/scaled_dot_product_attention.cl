@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "helpers.h"
+#include "tile_helpers.h"
+
+#if defined(SCALED_DOT_PRODUCT_ATTENTION_NATIVE)
+/** This OpenCL kernel computes a fused scaled dot product attention: dst = softmax(SCALE * Q K^T) V
+ *
+ * Each work-item computes a M0 x DV0 block of dst. The keys are visited in blocks of N0 and the softmax is computed
+ * online: the running maximum and sum of each query row are updated for every block and the accumulators are
+ * rescaled accordingly, so the scores never leave the registers.
+ *
+ * @note the "batch" (heads and batches of the attention) is collapsed onto the Z dimension
+ * @note The data type must be passed at compile time using -DDATA_TYPE (e.g. -DDATA_TYPE=float)
+ * @note The block's dimensions must be passed at compile time using -DM0, -DN0, -DK0 and -DDV0 (e.g. -DM0=4, -DN0=4, -DK0=4, -DDV0=8)
+ * @note The number of leftover output rows/columns must be passed using -DPARTIAL_STORE_M0 and -DPARTIAL_STORE_DV0 (e.g. -DPARTIAL_STORE_M0=1, -DPARTIAL_STORE_DV0=0)
+ * @note The depth of the queries and the number of keys must be passed at compile time using -DD and -DSKV (e.g. -DD=64, -DSKV=128)
+ * @note The scale of the scores must be passed at compile time using -DSCALE (e.g. -DSCALE=0.125f)
+ * @note For a causal attention, -DIS_CAUSAL and the offset of the last key visible by the first query (Skv - Sq) must be passed using -DCAUSAL_OFFSET (e.g. -DCAUSAL_OFFSET=0)
+ * @note The kernel name in uppercase must be passed at compile time (e.g. -DSCALED_DOT_PRODUCT_ATTENTION_NATIVE)
+ * @note Only the following configurations of M0, N0, K0 and DV0 are currently supported:
+ *  - M0 > 0
+ *  - N0 = 1, 2, 3, 4, 8, 16
+ *  - K0 = 1, 2, 3, 4, 8, 16 and D must be a multiple of K0
+ *  - DV0 = 1, 2, 3, 4, 8, 16
+ *
+ * @param[in]  q_ptr                             Pointer to the queries tensor. Supported data types: F32/F16
+ * @param[in]  q_stride_y                        Stride of the queries tensor in Y (2nd) dimension (in bytes)
+ * @param[in]  q_stride_z                        Stride of the queries tensor in Z (3rd) dimension (in bytes)
+ * @param[in]  q_w                               The width of the queries tensor
+ * @param[in]  q_h                               The height of the queries tensor
+ * @param[in]  q_n                               Number of the matrices (buffers) in the batch
+ * @param[in]  q_offset_first_element_in_bytes   The offset of the first element in the queries tensor
+ * @param[in]  k_ptr                             Pointer to the keys tensor. Supported data types: same as @p q_ptr
+ * @param[in]  k_stride_y                        Stride of the keys tensor in Y (2nd) dimension (in bytes)
+ * @param[in]  k_stride_z                        Stride of the keys tensor in Z (3rd) dimension (in bytes)
+ * @param[in]  k_w                               The width of the keys tensor
+ * @param[in]  k_h                               The height of the keys tensor
+ * @param[in]  k_n                               Number of the matrices (buffers) in the batch
+ * @param[in]  k_offset_first_element_in_bytes   The offset of the first element in the keys tensor
+ * @param[in]  v_ptr                             Pointer to the values tensor. Supported data types: same as @p q_ptr
+ * @param[in]  v_stride_y                        Stride of the values tensor in Y (2nd) dimension (in bytes)
+ * @param[in]  v_stride_z                        Stride of the values tensor in Z (3rd) dimension (in bytes)
+ * @param[in]  v_w                               The width of the values tensor
+ * @param[in]  v_h                               The height of the values tensor
+ * @param[in]  v_n                               Number of the matrices (buffers) in the batch
+ * @param[in]  v_offset_first_element_in_bytes   The offset of the first element in the values tensor
+ * @param[out] dst_ptr                           Pointer to the dst tensor. Supported data types: same as @p q_ptr
+ * @param[in]  dst_stride_y                      Stride of the dst tensor in Y (2nd) dimension (in bytes)
+ * @param[in]  dst_stride_z                      Stride of the dst tensor in Z (3rd) dimension (in bytes)
+ * @param[in]  dst_w                             The width of the dst tensor
+ * @param[in]  dst_h                             The height of the dst tensor
+ * @param[in]  dst_n                             Number of the matrices (buffers) in the batch
+ * @param[in]  dst_offset_first_element_in_bytes The offset of the first element in the dst tensor
+ */
+__kernel void scaled_dot_product_attention_native(TENSOR3D_T(q, BUFFER),
+                                                  TENSOR3D_T(k, BUFFER),
+                                                  TENSOR3D_T(v, BUFFER),
+                                                  TENSOR3D_T(dst, BUFFER))
+{
+    const int x = GET_SPATIAL_IDX(0, DV0, PARTIAL_STORE_DV0);
+    const int y = GET_SPATIAL_IDX(1, M0, PARTIAL_STORE_M0);
+    const int z = GET_SPATIAL_IDX(2, 1, 0);
+
+    // Compute Q/K/V/DST matrix address
+    q_offset_first_element_in_bytes += y * q_stride_y + z * q_stride_z;
+    k_offset_first_element_in_bytes += z * k_stride_z;
+    v_offset_first_element_in_bytes += x * sizeof(DATA_TYPE) + z * v_stride_z;
+    dst_offset_first_element_in_bytes += x * sizeof(DATA_TYPE) + y * dst_stride_y + z * dst_stride_z;
+
+    // Accumulators, running maximum and running sum of the exponentials of each query row
+    TILE(float, M0, DV0, acc);
+    TILE(float, M0, 1, row_max);
+    TILE(float, M0, 1, row_sum);
+
+    LOOP_UNROLLING(int, i, 0, 1, M0,
+    {
+        acc[i].v     = 0.f;
+        row_max[i].v = -INFINITY;
+        row_sum[i].v = 0.f;
+    })
+
+#if defined(IS_CAUSAL)
+    // Query row i only attends to the keys up to i + CAUSAL_OFFSET
+    const int num_keys = min(SKV, y + M0 + CAUSAL_OFFSET);
+#else  // defined(IS_CAUSAL)
+    const int num_keys = SKV;
+#endif // defined(IS_CAUSAL)
+
+    for(int j = 0; j < num_keys; j += N0)
+    {
+        // The keys past the last one are clamped to it, their scores are masked out below
+        TILE(int, N0, 1, key);
+        LOOP_UNROLLING(int, n, 0, 1, N0,
+        {
+            key[n].v = min(j + n, SKV - 1);
+        })
+
+        // Scores of the block: s = Q K^T
+        TILE(float, M0, N0, s);
+        LOOP_UNROLLING(int, i, 0, 1, M0,
+        {
+            s[i].v = 0.f;
+        })
+
+        for(int d = 0; d < D; d += K0)
+        {
+            TILE(DATA_TYPE, M0, K0, a);
+            TILE(DATA_TYPE, N0, K0, b);
+
+            T_LOAD(DATA_TYPE, M0, K0, BUFFER, q, d, 0, 1, q_stride_y, a);
+            LOOP_UNROLLING(int, n, 0, 1, N0,
+            {
+                b[n].v = VLOAD(K0)(0, (__global DATA_TYPE *)(k_ptr + k_offset_first_element_in_bytes + d * sizeof(DATA_TYPE) + key[n].v * k_stride_y));
+            })
+
+            T_MMUL(DATA_TYPE, DATA_TYPE, float, M0, N0, K0, NT, T, a, b, s);
+        }
+
+        // Online softmax: update the running maximum and sum, rescale the accumulators and turn the scores into
+        // probabilities relative to the new maximum
+        for(int i = 0; i < M0; ++i)
+        {
+            float new_max = row_max[i].v;
+            for(int n = 0; n < N0; ++n)
+            {
+#if defined(IS_CAUSAL)
+                const bool masked = (j + n >= SKV) || (j + n > y + i + CAUSAL_OFFSET);
+#else  // defined(IS_CAUSAL)
+                const bool masked = (j + n >= SKV);
+#endif // defined(IS_CAUSAL)
+                s[i].s[n] = masked ? -INFINITY : s[i].s[n] * SCALE;
+                new_max   = fmax(new_max, s[i].s[n]);
+            }
+
+            // A row with no visible key so far keeps its null accumulators
+            const float correction = (row_max[i].v == -INFINITY) ? 0.f : exp(row_max[i].v - new_max);
+
+            float block_sum = 0.f;
+            for(int n = 0; n < N0; ++n)
+            {
+                s[i].s[n] = (s[i].s[n] == -INFINITY) ? 0.f : exp(s[i].s[n] - new_max);
+                block_sum += s[i].s[n];
+            }
+
+            row_sum[i].v = row_sum[i].v * correction + block_sum;
+            row_max[i].v = new_max;
+            acc[i].v *= correction;
+        }
+
+        // acc += P V
+        for(int n = 0; n < N0; ++n)
+        {
+            const VEC_DATA_TYPE(float, DV0) vrow = CONVERT(VLOAD(DV0)(0, (__global DATA_TYPE *)(v_ptr + v_offset_first_element_in_bytes + key[n].v * v_stride_y)), VEC_DATA_TYPE(float, DV0));
+            for(int i = 0; i < M0; ++i)
+            {
+                acc[i].v = fma((VEC_DATA_TYPE(float, DV0))s[i].s[n], vrow, acc[i].v);
+            }
+        }
+    }
+
+    TILE(DATA_TYPE, M0, DV0, out);
+    LOOP_UNROLLING(int, i, 0, 1, M0,
+    {
+        const float inv_sum = row_sum[i].v > 0.f ? 1.f / row_sum[i].v : 0.f;
+        out[i].v            = CONVERT(acc[i].v * inv_sum, VEC_DATA_TYPE(DATA_TYPE, DV0));
+    })
+
+    const bool x_cond = PARTIAL_STORE_DV0 != 0 && get_global_id(0) == 0;
+    const bool y_cond = PARTIAL_STORE_M0 != 0 && get_global_id(1) == 0;
+
+    TILE(int, M0, 1, indirect_buffer);
+    LOOP_UNROLLING(int, _i, 0, 1, M0,
+    {
+        indirect_buffer[_i].v = min(_i, select(M0 - 1, PARTIAL_STORE_M0 - 1, y_cond));
+    });
+
+    T_STORE_INDIRECT_WIDTH_SELECT(DATA_TYPE, M0, DV0, PARTIAL_STORE_DV0, BUFFER, dst, 0, dst_stride_y, x_cond, out, indirect_buffer);
+}
+#endif // defined(SCALED_DOT_PRODUCT_ATTENTION_NATIVE)
+
+#if defined(SCALED_DOT_PRODUCT_ATTENTION_MMUL)
+/** This OpenCL kernel computes a fused scaled dot product attention: dst = softmax(SCALE * Q K^T) V using the Arm® matrix multiply extension (cl_arm_matrix_multiply)
+ *
+ * Each work-group of MMUL_M0 x MMUL_N0 work-items computes MMUL_M0 rows of dst. Work-item (thread_y, thread_x) of the
+ * group holds, as in @ref mat_mul_native_mmul_nt_nt, the element (thread_y, thread_x) of each MMUL_M0 x MMUL_N0 block
+ * multiplied by arm_matrix_multiply:
+ * - S = Q K^T: the score of query thread_y and key thread_x of each of the N0 blocks of MMUL_N0 keys
+ * - O += P V: the output of query thread_y and value column thread_x of each of the DV / MMUL_N0 blocks of columns
+ * The probabilities P of a block of keys are thus in the same work-items as its scores S. The maximum and sum of a row
+ * of scores are shared between the MMUL_N0 work-items of the row through local memory, and the softmax is computed
+ * online over the blocks of keys.
+ *
+ * @note The work-group size must be MMUL_M0 x MMUL_N0 in the X dimension (e.g. 16, 1, 1)
+ * @note the "batch" (heads and batches of the attention) is collapsed onto the Z dimension
+ * @note The data type must be passed at compile time using -DDATA_TYPE (e.g. -DDATA_TYPE=float)
+ * @note The number of blocks of MMUL_N0 keys visited at once must be passed at compile time using -DN0 (e.g. -DN0=4)
+ * @note The MMUL block dimension (MMUL_M0, MMUL_N0, MMUL_K0) must be passed at compile time using -DMMUL_M0, -DMMUL_N0 and -DMMUL_K0 (e.g. -DMMUL_M0=4, -DMMUL_N0=4, -DMMUL_K0=4).
+ * @note The depth of the queries and values and the number of queries and keys must be passed at compile time using -DD, -DDV, -DSQ and -DSKV (e.g. -DD=64, -DDV=64, -DSQ=128, -DSKV=128)
+ * @note The scale of the scores must be passed at compile time using -DSCALE (e.g. -DSCALE=0.125f)
+ * @note For a causal attention, -DIS_CAUSAL and the offset of the last key visible by the first query (Skv - Sq) must be passed using -DCAUSAL_OFFSET (e.g. -DCAUSAL_OFFSET=0)
+ * @note The kernel name in uppercase must be passed at compile time (e.g. -DSCALED_DOT_PRODUCT_ATTENTION_MMUL)
+ * @note D must be a multiple of MMUL_K0 and DV a multiple of MMUL_N0
+ *
+ * @param[in]  q_ptr                             Pointer to the queries tensor. Supported data types: F32/F16
+ * @param[in]  q_stride_y                        Stride of the queries tensor in Y (2nd) dimension (in bytes)
+ * @param[in]  q_stride_z                        Stride of the queries tensor in Z (3rd) dimension (in bytes)
+ * @param[in]  q_w                               The width of the queries tensor
+ * @param[in]  q_h                               The height of the queries tensor
+ * @param[in]  q_n                               Number of the matrices (buffers) in the batch
+ * @param[in]  q_offset_first_element_in_bytes   The offset of the first element in the queries tensor
+ * @param[in]  k_ptr                             Pointer to the keys tensor. Supported data types: same as @p q_ptr
+ * @param[in]  k_stride_y                        Stride of the keys tensor in Y (2nd) dimension (in bytes)
+ * @param[in]  k_stride_z                        Stride of the keys tensor in Z (3rd) dimension (in bytes)
+ * @param[in]  k_w                               The width of the keys tensor
+ * @param[in]  k_h                               The height of the keys tensor
+ * @param[in]  k_n                               Number of the matrices (buffers) in the batch
+ * @param[in]  k_offset_first_element_in_bytes   The offset of the first element in the keys tensor
+ * @param[in]  v_ptr                             Pointer to the values tensor. Supported data types: same as @p q_ptr
+ * @param[in]  v_stride_y                        Stride of the values tensor in Y (2nd) dimension (in bytes)
+ * @param[in]  v_stride_z                        Stride of the values tensor in Z (3rd) dimension (in bytes)
+ * @param[in]  v_w                               The width of the values tensor
+ * @param[in]  v_h                               The height of the values tensor
+ * @param[in]  v_n                               Number of the matrices (buffers) in the batch
+ * @param[in]  v_offset_first_element_in_bytes   The offset of the first element in the values tensor
+ * @param[out] dst_ptr                           Pointer to the dst tensor. Supported data types: same as @p q_ptr
+ * @param[in]  dst_stride_y                      Stride of the dst tensor in Y (2nd) dimension (in bytes)
+ * @param[in]  dst_stride_z                      Stride of the dst tensor in Z (3rd) dimension (in bytes)
+ * @param[in]  dst_w                             The width of the dst tensor
+ * @param[in]  dst_h                             The height of the dst tensor
+ * @param[in]  dst_n                             Number of the matrices (buffers) in the batch
+ * @param[in]  dst_offset_first_element_in_bytes The offset of the first element in the dst tensor
+ */
+__kernel void scaled_dot_product_attention_mmul(TENSOR3D_T(q, BUFFER),
+                                                TENSOR3D_T(k, BUFFER),
+                                                TENSOR3D_T(v, BUFFER),
+                                                TENSOR3D_T(dst, BUFFER))
+{
+#define BLOCK_KEYS (N0 * MMUL_N0) // Keys visited at once
+
+    const int thread_id = get_local_id(0);
+    const int thread_x  = thread_id % MMUL_N0;
+    const int thread_y  = thread_id / MMUL_N0;
+    const int z         = get_global_id(2);
+
+    // Query row of the work-item. The work-items past the last row take part in arm_matrix_multiply on the last row,
+    // but do not store it.
+    const int row_unclamped = get_group_id(1) * MMUL_M0 + thread_y;
+    const int row           = min(row_unclamped, SQ - 1);
+
+    // Compute Q/K/V/DST matrix address
+    q_offset_first_element_in_bytes += row * q_stride_y + z * q_stride_z;
+    k_offset_first_element_in_bytes += z * k_stride_z;
+    v_offset_first_element_in_bytes += z * v_stride_z;
+    dst_offset_first_element_in_bytes += row * dst_stride_y + z * dst_stride_z;
+
+    // Scores of the block of keys, shared by the work-items of a row to compute its maximum and sum
+    __local float scores[MMUL_M0][BLOCK_KEYS];
+
+    // MMUL extension accumulates the result in F32 for both F32 and F16
+    float acc[DV / MMUL_N0];
+    for(int c = 0; c < DV / MMUL_N0; ++c)
+    {
+        acc[c] = 0.f;
+    }
+    float row_max = -INFINITY;
+    float row_sum = 0.f;
+
+#if defined(IS_CAUSAL)
+    // The last row of the group only attends to the keys up to its index + CAUSAL_OFFSET
+    const int num_keys = min(SKV, (int)(get_group_id(1) + 1) * MMUL_M0 + CAUSAL_OFFSET);
+#else  // defined(IS_CAUSAL)
+    const int num_keys = SKV;
+#endif // defined(IS_CAUSAL)
+
+    for(int j = 0; j < num_keys; j += BLOCK_KEYS)
+    {
+        // S = Q K^T: the lhs element of the work-item is Q[row][d + thread_x], the rhs element is K[key][d + thread_y]
+        // with key the thread_x-th key of the block. The keys past the last one are clamped and masked out below.
+        float s[N0];
+        for(int n = 0; n < N0; ++n)
+        {
+            s[n] = 0.f;
+        }
+
+        for(int d = 0; d < D; d += MMUL_K0)
+        {
+            const DATA_TYPE a = *((__global DATA_TYPE *)(q_ptr + q_offset_first_element_in_bytes + (d + thread_x) * sizeof(DATA_TYPE)));
+            for(int n = 0; n < N0; ++n)
+            {
+                const int       key = min(j + n * MMUL_N0 + thread_x, SKV - 1);
+                const DATA_TYPE b   = *((__global DATA_TYPE *)(k_ptr + k_offset_first_element_in_bytes + (d + thread_y) * sizeof(DATA_TYPE) + key * k_stride_y));
+                s[n]                = arm_matrix_multiply(a, b, s[n]);
+            }
+        }
+
+        for(int n = 0; n < N0; ++n)
+        {
+            const int key = j + n * MMUL_N0 + thread_x;
+#if defined(IS_CAUSAL)
+            const bool masked = (key >= SKV) || (key > row_unclamped + CAUSAL_OFFSET);
+#else  // defined(IS_CAUSAL)
+            const bool masked = (key >= SKV);
+#endif // defined(IS_CAUSAL)
+            s[n]                                      = masked ? -INFINITY : s[n] * SCALE;
+            scores[thread_y][n * MMUL_N0 + thread_x] = s[n];
+        }
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        // Online softmax: every work-item of a row computes the maximum and sum of the whole row
+        float new_max = row_max;
+        for(int c = 0; c < BLOCK_KEYS; ++c)
+        {
+            new_max = fmax(new_max, scores[thread_y][c]);
+        }
+        float block_sum = 0.f;
+        for(int c = 0; c < BLOCK_KEYS; ++c)
+        {
+            const float score = scores[thread_y][c];
+            block_sum += (score == -INFINITY) ? 0.f : exp(score - new_max);
+        }
+
+        // The scores are overwritten by the next block
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        // A row with no visible key so far keeps its null accumulators
+        const float correction = (row_max == -INFINITY) ? 0.f : exp(row_max - new_max);
+        row_sum                = row_sum * correction + block_sum;
+        row_max                = new_max;
+        for(int c = 0; c < DV / MMUL_N0; ++c)
+        {
+            acc[c] *= correction;
+        }
+
+        // O += P V: the lhs element of the work-item is its own probability P[row][key], the rhs element is
+        // V[key'][c * MMUL_N0 + thread_x] with key' the thread_y-th key of the block of MMUL_N0 keys
+        for(int n = 0; n < N0; ++n)
+        {
+            const DATA_TYPE p   = (DATA_TYPE)((s[n] == -INFINITY) ? 0.f : exp(s[n] - new_max));
+            const int       key = min(j + n * MMUL_N0 + thread_y, SKV - 1);
+            for(int c = 0; c < DV / MMUL_N0; ++c)
+            {
+                const DATA_TYPE b = *((__global DATA_TYPE *)(v_ptr + v_offset_first_element_in_bytes + (c * MMUL_N0 + thread_x) * sizeof(DATA_TYPE) + key * v_stride_y));
+                acc[c]            = arm_matrix_multiply(p, b, acc[c]);
+            }
+        }
+    }
+
+    // For work-items "outside" of the dst bound, we do not write but we have to take part in arm_matrix_multiply.
+    // That's why this needs to happen after the loop
+    if(row_unclamped >= SQ)
+    {
+        return;
+    }
+
+    const float inv_sum = row_sum > 0.f ? 1.f / row_sum : 0.f;
+    for(int c = 0; c < DV / MMUL_N0; ++c)
+    {
+        *((__global DATA_TYPE *)(dst_ptr + dst_offset_first_element_in_bytes + (c * MMUL_N0 + thread_x) * sizeof(DATA_TYPE))) = (DATA_TYPE)(acc[c] * inv_sum);
+    }
+
+#undef BLOCK_KEYS
+}
+#endif // defined(SCALED_DOT_PRODUCT_ATTENTION_MMUL)
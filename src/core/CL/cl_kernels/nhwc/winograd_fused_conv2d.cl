@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "activation_float_helpers.h"
+#include "helpers.h"
+#include "tile_helpers.h"
+
+#if defined(WINOGRAD_FUSED_CONV2D_4X4_3X3_NHWC)
+/** This OpenCL kernel computes a 3x3 Winograd convolution with a 4x4 output tile in a single pass when the data layout is NHWC
+ *
+ * Each work-group computes one tile of the output for WG_SIZE * N0 output channels:
+ * -# the input is visited in blocks of WG_SIZE * N0 channels. Each work-item transforms N0 channels of the 6x6 input
+ *    tile and writes them to local memory, so the transformed input is shared by the whole work-group.
+ * -# each work-item multiplies the 36 transformed input rows with the matching rows of the transformed weights and
+ *    accumulates its N0 output channels in registers.
+ * -# the output transform, the bias and the activation are applied to the accumulators before the 4x4 tile is stored.
+ *
+ * The transformed input and the result of the batched matrix multiplication are never written to global memory.
+ *
+ * @note The data type must be passed at compile time using -DDATA_TYPE (e.g. -DDATA_TYPE=half)
+ * @note The accumulator data type must be passed at compile time using -DACC_DATA_TYPE (e.g. -DACC_DATA_TYPE=float)
+ * @note The number of channels processed by each work-item must be passed at compile time using -DN0 (e.g. -DN0=4).
+ *       It must divide both the number of input and output channels
+ * @note The number of work-items of a work-group must be passed at compile time using -DWG_SIZE (e.g. -DWG_SIZE=8).
+ *       The kernel must be enqueued with a local work size of (WG_SIZE, 1, 1)
+ * @note The number of input and output channels must be passed at compile time using -DSRC_CHANNELS and -DDST_CHANNELS
+ * @note The convolution padding (left and top) must be passed at compile time using -DPAD_LEFT and -DPAD_TOP (e.g. -DPAD_LEFT=1, -DPAD_TOP=1)
+ * @note The number of tiles along the X direction must be passed at compile time using -DNUM_TILES_X (e.g. -DNUM_TILES_X=8)
+ * @note If the source tensor has more than one batch, -DIS_BATCHED has to be passed at compile time
+ * @note If the convolution has a bias, -DHAS_BIAS has to be passed at compile time
+ *
+ * @param[in]  src_ptr                           Pointer to the source tensor. Supported data types: F32/F16
+ * @param[in]  src_stride_x                      Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                        src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                      Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                        src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                      Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  src_step_z                        src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_stride_w                      Stride of the source tensor in W dimension (in bytes)
+ * @param[in]  src_step_w                        src_stride_w * number of elements along W processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes The offset of the first element in the source tensor
+ * @param[in]  wei_ptr                           Pointer to the transformed weights with shape [OFM, IFM, 36]. Supported data types: same as @p src_ptr
+ * @param[in]  wei_stride_x                      Stride of the weights tensor in X dimension (in bytes)
+ * @param[in]  wei_step_x                        wei_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  wei_stride_y                      Stride of the weights tensor in Y dimension (in bytes)
+ * @param[in]  wei_step_y                        wei_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  wei_stride_z                      Stride of the weights tensor in Z dimension (in bytes)
+ * @param[in]  wei_step_z                        wei_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  wei_stride_w                      Stride of the weights tensor in W dimension (in bytes)
+ * @param[in]  wei_step_w                        wei_stride_w * number of elements along W processed per workitem(in bytes)
+ * @param[in]  wei_offset_first_element_in_bytes The offset of the first element in the weights tensor
+ * @param[in]  bias_ptr                          (Optional) Pointer to the biases tensor. Supported data types: same as @p src_ptr
+ * @param[in]  bias_stride_x                     (Optional) Stride of the biases tensor in X dimension (in bytes)
+ * @param[in]  bias_step_x                       (Optional) bias_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  bias_offset_first_element_in_bytes (Optional) The offset of the first element in the biases tensor
+ * @param[out] dst_ptr                           Pointer to the destination tensor. Supported data types: same as @p src_ptr
+ * @param[in]  dst_stride_x                      Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                      Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                        dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_stride_w                      Stride of the destination tensor in W dimension (in bytes)
+ * @param[in]  dst_step_w                        dst_stride_w * number of elements along W processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ * @param[in]  SRC_WIDTH                         The source tensor's width
+ * @param[in]  SRC_HEIGHT                        The source tensor's height
+ * @param[in]  DST_WIDTH                         The destination tensor's width
+ * @param[in]  DST_HEIGHT                        The destination tensor's height
+ */
+__kernel void winograd_fused_conv2d_4x4_3x3_nhwc(
+    TENSOR4D(src, BUFFER),
+    TENSOR4D(wei, BUFFER),
+#if defined(HAS_BIAS)
+    VECTOR_DECLARATION(bias),
+#endif // defined(HAS_BIAS)
+    TENSOR4D(dst, BUFFER),
+    const int SRC_WIDTH,
+    const int SRC_HEIGHT,
+    const int DST_WIDTH,
+    const int DST_HEIGHT)
+{
+#define K0 (WG_SIZE * N0)
+
+    const int lid  = get_local_id(0);
+    const int cout = get_global_id(0) * N0; // OFM
+    const int mout = get_global_id(1);      // WINOGRAD OUTPUT TILES
+#if defined(IS_BATCHED)
+    const int bout = get_global_id(2); // BATCH SIZE IDX
+#else                                  // defined(IS_BATCHED)
+    const int bout = 0; // BATCH SIZE IDX
+#endif                                 // defined(IS_BATCHED)
+
+    // Work-items past the last output channel still transform their share of the input tile
+    const bool is_valid_cout = cout < DST_CHANNELS;
+
+    const int x_out = (mout % NUM_TILES_X) * 4;
+    const int y_out = (mout / NUM_TILES_X) * 4;
+    const int x_in  = x_out - PAD_LEFT;
+    const int y_in  = y_out - PAD_TOP;
+
+    // Transformed input tile of the current block of channels, laid out as [36][K0]
+    __local DATA_TYPE lds[36 * K0];
+
+    TILE(ACC_DATA_TYPE, 36, N0, acc);
+
+    LOOP_UNROLLING(int, i, 0, 1, 36,
+    {
+        acc[i].v = 0;
+    })
+
+    for(int k0 = 0; k0 < SRC_CHANNELS; k0 += K0)
+    {
+        const int cin = k0 + lid * N0;
+
+        TILE(DATA_TYPE, 36, N0, out);
+
+        LOOP_UNROLLING(int, i, 0, 1, 36,
+        {
+            out[i].v = 0;
+        })
+
+        if(cin < SRC_CHANNELS)
+        {
+            TILE(DATA_TYPE, 36, N0, in);
+
+            LOOP_UNROLLING(int, i, 0, 1, 36,
+            {
+                in[i].v = 0;
+            })
+
+            // Load the tile from a NHWC tensor
+            T_LOAD_NHWC(DATA_TYPE, 6, 6, N0, BUFFER, src, bout, y_in, x_in, cin, SRC_WIDTH, SRC_HEIGHT, src_stride_y, in);
+
+            TILE(DATA_TYPE, 6, N0, com);
+            TILE(DATA_TYPE, 36, N0, tmp);
+
+            LOOP_UNROLLING(int, i, 0, 1, 6,
+            {
+                com[0].v         = in[2 * 6 + i].v - (DATA_TYPE)4.0f * in[0 * 6 + i].v;
+                com[1].v         = in[3 * 6 + i].v - (DATA_TYPE)4.0f * in[1 * 6 + i].v;
+                com[2].v         = in[4 * 6 + i].v - (DATA_TYPE)4.0f * in[2 * 6 + i].v;
+                com[3].v         = in[5 * 6 + i].v - (DATA_TYPE)4.0f * in[3 * 6 + i].v;
+                com[4].v         = in[3 * 6 + i].v - in[1 * 6 + i].v;
+                com[4].v         = com[4].v + com[4].v;
+                com[5].v         = in[4 * 6 + i].v - in[2 * 6 + i].v;
+                tmp[i + 0 * 6].v = com[2].v - com[0].v;
+                tmp[i + 1 * 6].v = com[2].v + com[1].v;
+                tmp[i + 2 * 6].v = com[2].v - com[1].v;
+                tmp[i + 3 * 6].v = com[5].v + com[4].v;
+                tmp[i + 4 * 6].v = com[5].v - com[4].v;
+                tmp[i + 5 * 6].v = com[3].v - com[1].v;
+            })
+
+            LOOP_UNROLLING(int, i, 0, 1, 6,
+            {
+                com[0].v         = tmp[i * 6 + 2].v - (DATA_TYPE)4.f * tmp[i * 6 + 0].v;
+                com[1].v         = tmp[i * 6 + 3].v - (DATA_TYPE)4.f * tmp[i * 6 + 1].v;
+                com[2].v         = tmp[i * 6 + 4].v - (DATA_TYPE)4.f * tmp[i * 6 + 2].v;
+                com[3].v         = tmp[i * 6 + 5].v - (DATA_TYPE)4.f * tmp[i * 6 + 3].v;
+                com[4].v         = tmp[i * 6 + 3].v - tmp[i * 6 + 1].v;
+                com[4].v         = com[4].v + com[4].v;
+                com[5].v         = tmp[i * 6 + 4].v - tmp[i * 6 + 2].v;
+                out[i * 6 + 0].v = com[2].v - com[0].v;
+                out[i * 6 + 1].v = com[2].v + com[1].v;
+                out[i * 6 + 2].v = com[2].v - com[1].v;
+                out[i * 6 + 3].v = com[5].v + com[4].v;
+                out[i * 6 + 4].v = com[5].v - com[4].v;
+                out[i * 6 + 5].v = com[3].v - com[1].v;
+            })
+        }
+
+        // The previous block of channels must have been consumed by every work-item before it is overwritten
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        LOOP_UNROLLING(int, i, 0, 1, 36,
+        {
+            VSTORE(N0)(out[i].v, 0, lds + i * K0 + lid * N0);
+        })
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        if(is_valid_cout)
+        {
+            const int k_end = min((int)K0, (int)SRC_CHANNELS - k0);
+
+            __global uchar *wei_addr = wei_ptr + wei_offset_first_element_in_bytes + cout * sizeof(DATA_TYPE) + k0 * wei_stride_y;
+
+            for(int k = 0; k < k_end; ++k)
+            {
+                LOOP_UNROLLING(int, i, 0, 1, 36,
+                {
+                    VEC_DATA_TYPE(ACC_DATA_TYPE, N0) w = CONVERT(VLOAD(N0)(0, (__global DATA_TYPE *)(wei_addr + i * wei_stride_z)), VEC_DATA_TYPE(ACC_DATA_TYPE, N0));
+                    acc[i].v = fma((VEC_DATA_TYPE(ACC_DATA_TYPE, N0))((ACC_DATA_TYPE)lds[i * K0 + k]), w, acc[i].v);
+                })
+                wei_addr += wei_stride_y;
+            }
+        }
+    }
+
+    if(!is_valid_cout)
+    {
+        return;
+    }
+
+    TILE(DATA_TYPE, 36, N0, in);
+
+    LOOP_UNROLLING(int, i, 0, 1, 36,
+    {
+        in[i].v = CONVERT(acc[i].v, VEC_DATA_TYPE(DATA_TYPE, N0));
+    })
+
+    TILE(DATA_TYPE, 4, N0, tmp);
+
+    LOOP_UNROLLING(int, i, 0, 1, 6,
+    {
+        tmp[0].v     = in[6 + i].v + in[12 + i].v;
+        tmp[1].v     = in[6 + i].v - in[12 + i].v;
+        tmp[2].v     = in[18 + i].v + in[24 + i].v;
+        tmp[3].v     = in[18 + i].v - in[24 + i].v;
+        tmp[3].v     = tmp[3].v + tmp[3].v;
+        in[i].v      = in[i].v + tmp[0].v + tmp[2].v;
+        in[6 + i].v  = tmp[3].v + tmp[1].v;
+        in[12 + i].v = fma(tmp[2].v, (VEC_DATA_TYPE(DATA_TYPE, N0))4.0f, tmp[0].v);
+        in[18 + i].v = fma(tmp[3].v, (VEC_DATA_TYPE(DATA_TYPE, N0))4.0f, tmp[1].v) + in[30 + i].v;
+    })
+
+    // Compute the output tile
+    TILE(DATA_TYPE, 16, N0, out);
+
+    LOOP_UNROLLING(int, i, 0, 1, 4,
+    {
+        tmp[0].v         = in[6 * i + 1].v + in[6 * i + 2].v;
+        tmp[1].v         = in[6 * i + 1].v - in[6 * i + 2].v;
+        tmp[2].v         = in[6 * i + 3].v + in[6 * i + 4].v;
+        tmp[3].v         = in[6 * i + 3].v - in[6 * i + 4].v;
+        tmp[3].v         = tmp[3].v + tmp[3].v;
+        out[4 * i + 0].v = in[6 * i + 0].v + tmp[0].v + tmp[2].v;
+        out[4 * i + 1].v = tmp[3].v + tmp[1].v;
+        out[4 * i + 2].v = fma(tmp[2].v, (VEC_DATA_TYPE(DATA_TYPE, N0))4.0f, tmp[0].v);
+        out[4 * i + 3].v = fma(tmp[3].v, (VEC_DATA_TYPE(DATA_TYPE, N0))4.0f, tmp[1].v) + in[6 * i + 5].v;
+    })
+
+#if defined(HAS_BIAS)
+    TILE(DATA_TYPE, 1, N0, b);
+
+    T_LOAD(DATA_TYPE, 1, N0, BUFFER, bias, cout, 0, 1, 0, b);
+
+    // c = c + bias[broadcasted]
+    T_ELTWISE_BROADCAST_ADD_X(DATA_TYPE, 16, N0, out, b, out);
+#endif // HAS_BIAS
+
+    T_ACTIVATION(DATA_TYPE, 16, N0, ACTIVATION_TYPE, A_VAL, B_VAL, out, out);
+
+    TILE(uint, 16, 1, dst_indirect_y);
+
+    // Calculate the destination indirect Y
+    LOOP_UNROLLING(int, yk, 0, 1, 4,
+    {
+        LOOP_UNROLLING(int, xk, 0, 1, 4,
+        {
+            int x_c                       = min(x_out + xk, ((int)DST_WIDTH - 1));
+            int y_c                       = min(y_out + yk, ((int)DST_HEIGHT - 1));
+            dst_indirect_y[xk + yk * 4].v = x_c + y_c *DST_WIDTH;
+            dst_indirect_y[xk + yk * 4].v += bout * (int)(DST_WIDTH * DST_HEIGHT);
+        })
+    })
+
+    // Store the tile in reverse order so the invalid values are overwritten with the valid ones
+    T_STORE_INDIRECT_WIDTH_SELECT(DATA_TYPE, 16, N0, 0, BUFFER, dst, cout, dst_stride_y, false, out, dst_indirect_y);
+
+#undef K0
+}
+#endif // defined(WINOGRAD_FUSED_CONV2D_4X4_3X3_NHWC)
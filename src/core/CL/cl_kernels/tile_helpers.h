@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -725,13 +725,39 @@
         })                                                                                                                                            \
     })
 
+/** Load a vector from global memory (tensor) when the tensor is stored using a NHWC layout
+ *
+ * The cl_image of a NHWC tensor has one row per (batch, height, width) position, so the row is computed from the
+ * spatial coordinates, whereas cl_buffer reads use the tensor strides.
+ *
+ * @param[in] DATA_TYPE     Data type
+ * @param[in] WIDTH         Number of channels to load. In case of cl_image, only WIDTH multiples of 4 are supported (4, 8, 16)
+ * @param[in] TENSOR_TYPE   Type of cl_type used to store the tensor in global memory (BUFFER=cl_buffer, IMAGE=cl_image).
+ * @param[in] TENSOR        Tensor basename
+ * @param[in] B             Batch index
+ * @param[in] Y             Y index
+ * @param[in] X             X index
+ * @param[in] C             Channel index. In case of cl_image, it must be a multiple of 4
+ * @param[in] TENSOR_WIDTH  Width of the tensor
+ * @param[in] TENSOR_HEIGHT Height of the tensor
+ */
+#define V_LOAD_NHWC(DATA_TYPE, WIDTH, TENSOR_TYPE, TENSOR, B, Y, X, C, TENSOR_WIDTH, TENSOR_HEIGHT) \
+    V_LOAD_NHWC_STR(DATA_TYPE, WIDTH, TENSOR_TYPE, TENSOR, B, Y, X, C, TENSOR_WIDTH, TENSOR_HEIGHT)
+#define V_LOAD_NHWC_STR(DATA_TYPE, WIDTH, TENSOR_TYPE, TENSOR, B, Y, X, C, TENSOR_WIDTH, TENSOR_HEIGHT) \
+    V_LOAD_NHWC_##TENSOR_TYPE(DATA_TYPE, WIDTH, TENSOR, B, Y, X, C, TENSOR_WIDTH, TENSOR_HEIGHT)
+#define V_LOAD_NHWC_BUFFER(DATA_TYPE, WIDTH, TENSOR, B, Y, X, C, TENSOR_WIDTH, TENSOR_HEIGHT) \
+    VLOAD(WIDTH)                                                                             \
+    (0, (__global DATA_TYPE *)(TENSOR##_ptr + TENSOR##_offset_first_element_in_bytes + (C) * sizeof(DATA_TYPE) + (X) * (TENSOR##_stride_y) + (Y) * (TENSOR##_stride_z) + (B) * (TENSOR##_stride_w)))
+#define V_LOAD_NHWC_IMAGE(DATA_TYPE, WIDTH, TENSOR, B, Y, X, C, TENSOR_WIDTH, TENSOR_HEIGHT) \
+    READ_IMAGE2D(DATA_TYPE, CONVERT_VECTOR_SIZE_TO_PIXEL_UNIT(WIDTH), TENSOR##_img, (C) / 4, (X) + ((Y) + (B) * (int)(TENSOR_HEIGHT)) * (int)(TENSOR_WIDTH))
+
 /** Load a tile from global memory (tensor) when the tensor is stored using a NHWC layout with dilation for the X and Y increments
  *
  * @param[in]  DATA_TYPE      Data type
  * @param[in]  TILE_HEIGHT    Number of elements to load from Y (height) dimension
  * @param[in]  TILE_WIDTH     Number of elements to load from X (width) dimension
  * @param[in]  TILE_CHANNELS  Number of elements to load from C (channel) dimension
- * @param[in]  TENSOR_TYPE    Type of cl_type used to store the tensor in global memory (BUFFER=cl_buffer, IMAGE=cl_image). Currently BUFFER only is supported
+ * @param[in]  TENSOR_TYPE    Type of cl_type used to store the tensor in global memory (BUFFER=cl_buffer, IMAGE=cl_image).
  *                            In case of cl_image, only TILE_CHANNELS multiples of 4 are supported (4, 8, 16)
  * @param[in]  TENSOR         Tensor basename
  * @param[in]  B              Starting batch index
@@ -757,15 +783,13 @@
                 bool _src_valid_y = (((X) + _xk * (DILATION_X)) >= 0) && (((X) + _xk * (DILATION_X)) < (int)(TENSOR_WIDTH)) && (((Y) + _yk * (DILATION_Y)) >= 0) && (((Y) + _yk * (DILATION_Y)) < (int)(TENSOR_HEIGHT)); \
                 if(!(BOUNDARY_CHECK)) \
                 { \
-                    dst[_xk + _yk * (TILE_WIDTH)].v = VLOAD(TILE_CHANNELS)                                                \
-                    (0, (__global DATA_TYPE *)(TENSOR##_ptr + TENSOR##_offset_first_element_in_bytes + (C) * sizeof(DATA_TYPE) + (_src_y) * (TENSOR##_stride_y) + (_src_z) * (TENSOR##_stride_z) + (_src_w) * (TENSOR##_stride_w))); \
+                    dst[_xk + _yk * (TILE_WIDTH)].v = V_LOAD_NHWC(DATA_TYPE, TILE_CHANNELS, TENSOR_TYPE, TENSOR, _src_w, _src_z, _src_y, C, TENSOR_WIDTH, TENSOR_HEIGHT); \
                 } \
                 else \
                 { \
                     if(_src_valid_y) \
                     { \
-                        dst[_xk + _yk * (TILE_WIDTH)].v = VLOAD(TILE_CHANNELS)                                                \
-                    (0, (__global DATA_TYPE *)(TENSOR##_ptr + TENSOR##_offset_first_element_in_bytes + (C) * sizeof(DATA_TYPE) + (_src_y) * (TENSOR##_stride_y) + (_src_z) * (TENSOR##_stride_z) + (_src_w) * (TENSOR##_stride_w))); \
+                        dst[_xk + _yk * (TILE_WIDTH)].v = V_LOAD_NHWC(DATA_TYPE, TILE_CHANNELS, TENSOR_TYPE, TENSOR, _src_w, _src_z, _src_y, C, TENSOR_WIDTH, TENSOR_HEIGHT); \
                     }                                                                                                                                                                                                 \
                 } \
             })                                                                                                                                                                                                             \
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023 Arm Limited.
+ * Copyright (c) 2019-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -69,7 +69,16 @@ Status validate_arguments(const ITensorInfo          *input,
                                                          DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON(conv_info.pad_stride_info.stride().first > 1 && dwc_info.m0 != 1);
     ARM_COMPUTE_RETURN_ERROR_ON(conv_info.dilation.x() > 1 && dwc_info.m0 != 1);
-    ARM_COMPUTE_RETURN_ERROR_ON((dwc_info.export_input_to_cl_image == true));
+    if (dwc_info.export_input_to_cl_image)
+    {
+        // The cl_image is created from the start of the buffer and can only be read by blocks of 4 channels
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(in_place, "Input cannot be exported to cl_image for in-place computation");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.depth_multiplier != 1,
+                                        "Input can only be exported to cl_image with depth multiplier 1");
+        ARM_COMPUTE_RETURN_ERROR_ON((dwc_info.n0 % 4) != 0);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->lock_paddings() || input->offset_first_element_in_bytes() != 0);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(export_to_cl_image(input) == false, "Input cannot be exported to cl_image!");
+    }
     ARM_COMPUTE_RETURN_ERROR_ON_MSG((dwc_info.export_weights_to_cl_image == true) &&
                                         (export_to_cl_image(weights) == false),
                                     "Weights cannot be exported to cl_image!");
@@ -224,7 +233,9 @@ void CLDepthwiseConvolutionLayerNativeKernel::configure(const CLCompileContext
         conv_info, (output_multipliers != nullptr) ? output_multipliers->info() : nullptr,
         (output_shifts != nullptr) ? output_shifts->info() : nullptr));
 
-    auto padding_info = get_padding_info({input, output});
+    // The input paddings are extended when the input is exported to cl_image
+    auto padding_info =
+        dwc_info.export_input_to_cl_image ? get_padding_info({output}) : get_padding_info({input, output});
 
     const TensorShape output_shape = arm_compute::misc::shape_calculator::compute_depthwise_convolution_shape(
         *(input->info()), *(weights->info()), conv_info);
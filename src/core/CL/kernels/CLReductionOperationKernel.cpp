@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023 Arm Limited.
+ * Copyright (c) 2017-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,11 +39,46 @@
 #include "src/core/helpers/WindowHelpers.h"
 #include "support/StringSupport.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace
 {
-Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, unsigned int axis, ReductionOperation op)
+/** Width from which the rows along X are reduced by work-groups */
+constexpr unsigned int local_reduction_min_width = 1024;
+
+/** Number of elements along X each work-item loads at once */
+unsigned int reduction_vec_size(const ITensorInfo *input, unsigned int axis)
+{
+    const unsigned int width    = input->dimension(0) * input->num_channels();
+    const unsigned int vec_size = (is_data_type_quantized(input->data_type()) && (axis == 0)) ? 1 : 16;
+    return adjust_vec_size(vec_size, width);
+}
+
+/** Size of the work-groups reducing the rows along X, a power of two */
+unsigned int local_reduction_size()
+{
+    const size_t max_size = CLKernelLibrary::get().get_device().getInfo<CL_DEVICE_MAX_WORK_GROUP_SIZE>();
+    unsigned int size     = 128;
+    while (size > 1 && size > max_size)
+    {
+        size /= 2;
+    }
+    return size;
+}
+
+/** Number of elements of each chunk of a row split into partitions, a multiple of the vector size */
+unsigned int chunk_width(unsigned int width, unsigned int vec_size, unsigned int num_partitions)
+{
+    return ceil_to_multiple(DIV_CEIL(width, num_partitions), vec_size);
+}
+
+Status validate_arguments(const ITensorInfo *input,
+                          const ITensorInfo *output,
+                          unsigned int       axis,
+                          ReductionOperation op,
+                          unsigned int       num_partitions)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_RETURN_ERROR_ON_F16_UNSUPPORTED(input);
@@ -68,18 +103,50 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, u
     ARM_COMPUTE_RETURN_ERROR_ON_MSG((op == ReductionOperation::ARG_IDX_MAX) || (op == ReductionOperation::ARG_IDX_MIN),
                                     "Not supported reduction operation, use CLArgMinMaxLayer");
 
+    ARM_COMPUTE_RETURN_ERROR_ON(num_partitions == 0);
+    if (num_partitions > 1)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(CLReductionOperationKernel::get_x_partitions(input, axis, op) == 0,
+                                        "Rows are only split into partitions along X for long float rows");
+        // Every chunk must hold at least an element
+        const unsigned int width = input->dimension(0);
+        ARM_COMPUTE_RETURN_ERROR_ON(
+            (num_partitions - 1) * chunk_width(width, reduction_vec_size(input, axis), num_partitions) >= width);
+    }
+
     if (output->total_size() != 0)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_QUANTIZATION_INFO(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON(num_partitions > 1 && output->dimension(0) != num_partitions);
     }
 
     return Status{};
 }
 } // namespace
 
+unsigned int
+CLReductionOperationKernel::get_x_partitions(const ITensorInfo *input, unsigned int axis, ReductionOperation op)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input);
+    const bool is_supported = axis == 0 && input->num_channels() == 1 && is_data_type_float(input->data_type()) &&
+                              op != ReductionOperation::ARG_IDX_MAX && op != ReductionOperation::ARG_IDX_MIN;
+    const unsigned int width = input->dimension(0);
+    if (!is_supported || width < local_reduction_min_width)
+    {
+        return 0;
+    }
+
+    // A few work-groups per compute unit, each work-item loading at least one vector of its chunk
+    const unsigned int num_rows       = input->tensor_shape().total_size_upper(1);
+    const unsigned int num_cu         = CLKernelLibrary::get().get_device().getInfo<CL_DEVICE_MAX_COMPUTE_UNITS>();
+    const unsigned int max_partitions = DIV_CEIL(width, local_reduction_size() * reduction_vec_size(input, axis));
+    const unsigned int num_partitions = DIV_CEIL(4 * std::max(num_cu, 1U), std::max(num_rows, 1U));
+    return std::max(1U, std::min(max_partitions, num_partitions));
+}
+
 CLReductionOperationKernel::CLReductionOperationKernel()
-    : _input(nullptr), _output(nullptr), _reduction_axis(0), _op(ReductionOperation::SUM_SQUARE)
+    : _input(nullptr), _output(nullptr), _reduction_axis(0), _op(ReductionOperation::SUM_SQUARE), _local_size(0)
 {
     _type = CLKernelType::ELEMENTWISE;
 }
@@ -96,11 +163,12 @@ void CLReductionOperationKernel::configure(const CLCompileContext &compile_conte
                                            const ICLTensor        *input,
                                            ICLTensor              *output,
                                            unsigned int            axis,
-                                           ReductionOperation      op)
+                                           ReductionOperation      op,
+                                           unsigned int            num_partitions)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
 
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), axis, op));
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), axis, op, num_partitions));
 
     auto padding_info = get_padding_info({input, output});
 
@@ -108,9 +176,11 @@ void CLReductionOperationKernel::configure(const CLCompileContext &compile_conte
     _output         = output;
     _reduction_axis = axis;
     _op             = op;
+    _local_size     = (get_x_partitions(input->info(), axis, op) != 0) ? local_reduction_size() : 0;
 
-    const TensorShape output_shape =
+    TensorShape output_shape =
         arm_compute::misc::shape_calculator::compute_reduced_shape(input->info()->tensor_shape(), axis, true);
+    output_shape.set(0, (num_partitions > 1) ? num_partitions : output_shape[0]);
     auto_init_if_empty(*output->info(),
                        input->info()->clone()->set_tensor_shape(output_shape).reset_padding().set_is_resizable(true));
 
@@ -129,8 +199,7 @@ void CLReductionOperationKernel::configure(const CLCompileContext &compile_conte
     }
 
     const unsigned int width             = input->info()->dimension(0) * input->info()->num_channels();
-    unsigned int       vec_size          = (is_data_type_quantized(input->info()->data_type()) && (axis == 0)) ? 1 : 16;
-    vec_size                             = adjust_vec_size(vec_size, width);
+    const unsigned int vec_size          = reduction_vec_size(input->info(), axis);
     const unsigned int vec_size_leftover = width % vec_size;
 
     build_opts.add_option("-DDATA_TYPE=" + get_cl_type_from_data_type(data_type));
@@ -183,6 +252,18 @@ void CLReductionOperationKernel::configure(const CLCompileContext &compile_conte
         {
             build_opts.add_option("-DWIDTH=" + support::cpp11::to_string(width));
             kernel_axis_name = ((is_serial_op) ? "non_parallel_x" : "x");
+            if (_local_size != 0)
+            {
+                // Sub-groups reduce the results of their work-items without going through local memory
+                const bool use_subgroups = data_type == DataType::F32 && op != ReductionOperation::PROD &&
+                                           device_supports_extension(CLKernelLibrary::get().get_device(),
+                                                                     "cl_khr_subgroups");
+                build_opts.add_option("-DLOCAL_SIZE=" + support::cpp11::to_string(_local_size));
+                build_opts.add_option("-DCHUNK_WIDTH=" +
+                                      support::cpp11::to_string(chunk_width(width, vec_size, num_partitions)));
+                build_opts.add_option_if(use_subgroups, "-DSUBGROUP_REDUCTION");
+                kernel_axis_name = "x_local";
+            }
         }
         break;
         case 1:
@@ -208,6 +289,11 @@ void CLReductionOperationKernel::configure(const CLCompileContext &compile_conte
     actual_input_shape[0]          = width;
 
     Window win = calculate_max_window(actual_input_shape, Steps(vec_size));
+    if (_local_size != 0)
+    {
+        // A work-group per chunk of each row
+        win.set(Window::DimX, Window::Dimension(0, num_partitions * _local_size, 1));
+    }
     ICLKernel::configure_internal(win);
 
     ARM_COMPUTE_ERROR_ON(has_padding_changed(padding_info));
@@ -216,9 +302,10 @@ void CLReductionOperationKernel::configure(const CLCompileContext &compile_conte
 Status CLReductionOperationKernel::validate(const ITensorInfo *input,
                                             const ITensorInfo *output,
                                             unsigned int       axis,
-                                            ReductionOperation op)
+                                            ReductionOperation op,
+                                            unsigned int       num_partitions)
 {
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, axis, op));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, axis, op, num_partitions));
     return Status{};
 }
 
@@ -267,7 +354,15 @@ void CLReductionOperationKernel::run(const Window &window, cl::CommandQueue &que
                 unsigned int idx = 0;
                 add_3D_tensor_argument(idx, _input, window_in);
                 add_3D_tensor_argument(idx, _output, window_out);
-                enqueue(queue, *this, window_in);
+                if (_local_size != 0)
+                {
+                    // The kernel relies on its work-group size, which must not be tuned
+                    enqueue(queue, *this, window_in, cl::NDRange(_local_size, 1, 1));
+                }
+                else
+                {
+                    enqueue(queue, *this, window_in);
+                }
             }
         }
         break;
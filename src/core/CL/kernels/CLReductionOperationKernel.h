@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,25 +67,44 @@ public:
      *                             Output will have the same number of dimensions as input.
      * @param[in]  axis            Axis along which to reduce. Supported reduction axis : 0,1,2,3
      * @param[in]  op              Reduction operation to perform. Operations supported: MEAN_SUM, PROD, SUM_SQUARE, SUM, MIN, MAX
+     * @param[in]  num_partitions  (Optional) Number of chunks each row is split into, each reduced to an element of the row
+     *                             of @p output. Partitions other than 1 are only supported when @ref get_x_partitions is not 0
      */
     void configure(const CLCompileContext &compile_context,
                    const ICLTensor        *input,
                    ICLTensor              *output,
                    unsigned int            axis,
-                   ReductionOperation      op);
+                   ReductionOperation      op,
+                   unsigned int            num_partitions = 1);
 
     /** Static function to check if given info will lead to a valid configuration of @ref CLReductionOperationKernel.
      *
      * @param[in] input  Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/S32/F16/F32.
      * @param[in] output Destination tensor info. Data types and data layouts supported: Same as @p input.
      *                   Output will have the same number of dimensions as input.
-     * @param[in] axis   Axis along which to reduce. Supported reduction axis : 0,1,2,3
-     * @param[in] op     Reduction operation to perform. Operations supported: MEAN_SUM, PROD, SUM_SQUARE, SUM, MIN, MAX
+     * @param[in] axis           Axis along which to reduce. Supported reduction axis : 0,1,2,3
+     * @param[in] op             Reduction operation to perform. Operations supported: MEAN_SUM, PROD, SUM_SQUARE, SUM, MIN, MAX
+     * @param[in] num_partitions (Optional) Number of chunks each row is split into
      *
      * @return a status
      */
-    static Status
-    validate(const ITensorInfo *input, const ITensorInfo *output, unsigned int axis, ReductionOperation op);
+    static Status validate(const ITensorInfo *input,
+                           const ITensorInfo *output,
+                           unsigned int       axis,
+                           ReductionOperation op,
+                           unsigned int       num_partitions = 1);
+    /** Static function to get the number of work-groups that should reduce each row of the input
+     *
+     * Long float rows along X are reduced by work-groups, each row by a single one when there are enough rows to occupy
+     * the device, otherwise split into chunks whose partial results must be reduced by a second kernel.
+     *
+     * @param[in] input Source tensor info.
+     * @param[in] axis  Axis along which to reduce.
+     * @param[in] op    Reduction operation to perform.
+     *
+     * @return the number of chunks to split each row into, 0 if each row is reduced by a single work-item
+     */
+    static unsigned int get_x_partitions(const ITensorInfo *input, unsigned int axis, ReductionOperation op);
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
@@ -95,6 +114,7 @@ private:
     ICLTensor         *_output;
     unsigned int       _reduction_axis;
     ReductionOperation _op;
+    unsigned int       _local_size;
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_CLREDUCTIONOPERATIONKERNEL_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,6 +72,16 @@ bool CPUInfo::has_svebf16() const
     return _impl->info.has_svebf16();
 }
 
+bool CPUInfo::has_fp8() const
+{
+    return _impl->info.has_fp8();
+}
+
+bool CPUInfo::has_fp8dot4() const
+{
+    return _impl->info.has_fp8dot4();
+}
+
 bool CPUInfo::has_dotprod() const
 {
     return _impl->info.has_dotprod();
@@ -127,6 +137,16 @@ CPUModel CPUInfo::get_cpu_model(unsigned int cpuid) const
     return _impl->info.cpu_model(cpuid);
 }
 
+unsigned int CPUInfo::get_cpu_numa_node(unsigned int cpuid) const
+{
+    return _impl->info.numa_node(cpuid);
+}
+
+unsigned int CPUInfo::get_num_numa_nodes() const
+{
+    return _impl->info.num_numa_nodes();
+}
+
 cpuinfo::CpuIsaInfo CPUInfo::get_isa() const
 {
     return _impl->info.isa();
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/CPP/NMSHelpers.h"
+
+#include "arm_compute/runtime/Scheduler.h"
+
+#ifdef __aarch64__
+#include <arm_neon.h>
+#endif // __aarch64__
+
+namespace arm_compute
+{
+namespace cpp
+{
+void NMSBoxes::reserve(size_t num_boxes)
+{
+    x1.reserve(num_boxes);
+    y1.reserve(num_boxes);
+    x2.reserve(num_boxes);
+    y2.reserve(num_boxes);
+    areas.reserve(num_boxes);
+}
+
+void NMSBoxes::resize(size_t num_boxes)
+{
+    x1.resize(num_boxes);
+    y1.resize(num_boxes);
+    x2.resize(num_boxes);
+    y2.resize(num_boxes);
+    areas.resize(num_boxes);
+}
+
+void NMSBoxes::push_back(float box_x1, float box_y1, float box_x2, float box_y2, float area)
+{
+    x1.push_back(box_x1);
+    y1.push_back(box_y1);
+    x2.push_back(box_x2);
+    y2.push_back(box_y2);
+    areas.push_back(area);
+}
+
+void NMSBoxes::copy(size_t src, size_t dst)
+{
+    x1[dst]    = x1[src];
+    y1[dst]    = y1[src];
+    x2[dst]    = x2[src];
+    y2[dst]    = y2[src];
+    areas[dst] = areas[src];
+}
+
+size_t NMSBoxes::size() const
+{
+    return areas.size();
+}
+
+void compute_iou(const NMSBoxes &ref_boxes,
+                 size_t          ref,
+                 const NMSBoxes &boxes,
+                 size_t          start,
+                 size_t          end,
+                 float           offset,
+                 float          *iou)
+{
+    const float ref_x1   = ref_boxes.x1[ref];
+    const float ref_y1   = ref_boxes.y1[ref];
+    const float ref_x2   = ref_boxes.x2[ref];
+    const float ref_y2   = ref_boxes.y2[ref];
+    const float ref_area = ref_boxes.areas[ref];
+
+    size_t i = start;
+#ifdef __aarch64__
+    const float32x4_t vref_x1   = vdupq_n_f32(ref_x1);
+    const float32x4_t vref_y1   = vdupq_n_f32(ref_y1);
+    const float32x4_t vref_x2   = vdupq_n_f32(ref_x2);
+    const float32x4_t vref_y2   = vdupq_n_f32(ref_y2);
+    const float32x4_t vref_area = vdupq_n_f32(ref_area);
+    const float32x4_t voffset   = vdupq_n_f32(offset);
+    const float32x4_t vzero     = vdupq_n_f32(0.f);
+    for (; i + 4 <= end; i += 4)
+    {
+        const float32x4_t xx1 = vmaxq_f32(vref_x1, vld1q_f32(boxes.x1.data() + i));
+        const float32x4_t yy1 = vmaxq_f32(vref_y1, vld1q_f32(boxes.y1.data() + i));
+        const float32x4_t xx2 = vminq_f32(vref_x2, vld1q_f32(boxes.x2.data() + i));
+        const float32x4_t yy2 = vminq_f32(vref_y2, vld1q_f32(boxes.y2.data() + i));
+
+        const float32x4_t w     = vmaxq_f32(vaddq_f32(vsubq_f32(xx2, xx1), voffset), vzero);
+        const float32x4_t h     = vmaxq_f32(vaddq_f32(vsubq_f32(yy2, yy1), voffset), vzero);
+        const float32x4_t inter = vmulq_f32(w, h);
+        const float32x4_t uni   = vsubq_f32(vaddq_f32(vref_area, vld1q_f32(boxes.areas.data() + i)), inter);
+
+        // The lanes of empty intersections are discarded, as the union of degenerated boxes can be 0
+        vst1q_f32(iou + (i - start), vbslq_f32(vcgtq_f32(inter, vzero), vdivq_f32(inter, uni), vzero));
+    }
+#endif // __aarch64__
+    for (; i < end; ++i)
+    {
+        const float w     = std::max(std::min(ref_x2, boxes.x2[i]) - std::max(ref_x1, boxes.x1[i]) + offset, 0.f);
+        const float h     = std::max(std::min(ref_y2, boxes.y2[i]) - std::max(ref_y1, boxes.y1[i]) + offset, 0.f);
+        const float inter = w * h;
+        iou[i - start]    = (inter > 0.f) ? inter / (ref_area + boxes.areas[i] - inter) : 0.f;
+    }
+}
+
+void run_per_class(int start, int end, const std::function<void(int)> &func)
+{
+    IScheduler        &scheduler   = Scheduler::get();
+    const unsigned int num_classes = static_cast<unsigned int>(std::max(end - start, 0));
+    const unsigned int num_threads = std::min(std::max(scheduler.num_threads(), 1U), num_classes);
+    if (num_threads <= 1)
+    {
+        for (int c = start; c < end; ++c)
+        {
+            func(c);
+        }
+        return;
+    }
+
+    // Classes are interleaved across the threads to spread the classes with many candidates
+    std::vector<IScheduler::Workload> workloads;
+    for (unsigned int t = 0; t < num_threads; ++t)
+    {
+        workloads.emplace_back(
+            [=, &func](const ThreadInfo &)
+            {
+                for (int c = start + static_cast<int>(t); c < end; c += static_cast<int>(num_threads))
+                {
+                    func(c);
+                }
+            });
+    }
+    scheduler.run_tagged_workloads(workloads, "NMS/run_per_class");
+}
+} // namespace cpp
+} // namespace arm_compute
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_CPP_NMSHELPERS_H
+#define ACL_SRC_CORE_CPP_NMSHELPERS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpp
+{
+/** Boxes in corner format stored as a structure of arrays, to compute the overlaps of a box with many at once */
+class NMSBoxes
+{
+public:
+    /** Reserves the memory of the boxes
+     *
+     * @param[in] num_boxes Number of boxes
+     */
+    void reserve(size_t num_boxes);
+    /** Keeps the first boxes
+     *
+     * @param[in] num_boxes Number of boxes to keep
+     */
+    void resize(size_t num_boxes);
+    /** Adds a box
+     *
+     * @param[in] x1   Left coordinate
+     * @param[in] y1   Top coordinate
+     * @param[in] x2   Right coordinate
+     * @param[in] y2   Bottom coordinate
+     * @param[in] area Area of the box, following the convention of the caller for degenerated boxes
+     */
+    void push_back(float x1, float y1, float x2, float y2, float area);
+    /** Copies a box over another one
+     *
+     * @param[in] src Index of the box to copy
+     * @param[in] dst Index of the box to overwrite
+     */
+    void copy(size_t src, size_t dst);
+    /** Gets the number of boxes
+     *
+     * @return Number of boxes
+     */
+    size_t size() const;
+
+    std::vector<float> x1{};    /**< Left coordinates */
+    std::vector<float> y1{};    /**< Top coordinates */
+    std::vector<float> x2{};    /**< Right coordinates */
+    std::vector<float> y2{};    /**< Bottom coordinates */
+    std::vector<float> areas{}; /**< Areas */
+};
+
+/** Computes the intersection over union of a box with a range of boxes
+ *
+ * The overlap is 0 when the intersection is empty, whatever the areas of the boxes.
+ *
+ * @param[in]  ref_boxes Boxes holding the reference box
+ * @param[in]  ref       Index of the reference box
+ * @param[in]  boxes     Boxes to compare with the reference box
+ * @param[in]  start     Index of the first box to compare
+ * @param[in]  end       Index past the last box to compare
+ * @param[in]  offset    Added to the width and height of the intersection, 1 for boxes in pixel coordinates
+ * @param[out] iou       Overlap with the reference box of each box of the range
+ */
+void compute_iou(const NMSBoxes &ref_boxes,
+                 size_t          ref,
+                 const NMSBoxes &boxes,
+                 size_t          start,
+                 size_t          end,
+                 float           offset,
+                 float          *iou);
+
+/** Sorts a range of indices by decreasing score, the order of the indices after the range is unspecified
+ *
+ * Only the top of the candidates is sorted, as the non-maximum suppressions stop once their output is full. Indices
+ * with equal scores are sorted in increasing order so that the result doesn't depend on the sort algorithm.
+ *
+ * @param[in,out] indices Indices to sort
+ * @param[in]     first   Position of the first index of the range
+ * @param[in]     num     Number of indices in the range
+ * @param[in]     scores  Scores of the indices
+ */
+template <typename S>
+void sort_by_score(std::vector<int> &indices, size_t first, size_t num, const S &scores)
+{
+    const auto begin = indices.begin() + first;
+    std::partial_sort(begin, begin + num, indices.end(),
+                      [&scores](int lhs, int rhs)
+                      { return (scores[lhs] > scores[rhs]) || (!(scores[rhs] > scores[lhs]) && lhs < rhs); });
+}
+
+/** Runs a function for each class, distributing the classes across the threads of the scheduler
+ *
+ * @note The function is called concurrently so it must only modify the results of the class it is given
+ *
+ * @param[in] start First class
+ * @param[in] end   Class past the last one
+ * @param[in] func  Function to run for each class
+ */
+void run_per_class(int start, int end, const std::function<void(int)> &func);
+} // namespace cpp
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_CPP_NMSHELPERS_H
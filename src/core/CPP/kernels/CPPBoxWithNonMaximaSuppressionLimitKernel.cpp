@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2022 Arm Limited.
+ * Copyright (c) 2018-2020, 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Helpers.h"
 
+#include "src/core/CPP/NMSHelpers.h"
 #include "src/core/helpers/WindowHelpers.h"
 
 #include <algorithm>
@@ -130,62 +131,59 @@ std::vector<int> NonMaximaSuppression(const ITensor         *proposals,
 {
     std::vector<int> keep;
 
-    const int proposals_width = proposals->info()->dimension(1);
-
-    std::vector<T> x1(proposals_width);
-    std::vector<T> y1(proposals_width);
-    std::vector<T> x2(proposals_width);
-    std::vector<T> y2(proposals_width);
-    std::vector<T> areas(proposals_width);
-
-    for (int i = 0; i < proposals_width; ++i)
+    // The remaining boxes are stored contiguously in score order, to compute their overlaps with the kept box at once
+    cpp::NMSBoxes boxes;
+    boxes.reserve(sorted_indices.size());
+    for (auto idx : sorted_indices)
     {
-        x1[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4, i)));
-        y1[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 1, i)));
-        x2[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 2, i)));
-        y2[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 3, i)));
-        areas[i] = (x2[i] - x1[i] + 1.0) * (y2[i] - y1[i] + 1.0);
+        const T x1 = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4, idx)));
+        const T y1 = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 1, idx)));
+        const T x2 = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 2, idx)));
+        const T y2 = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 3, idx)));
+        const T area = (x2 - x1 + T(1.0)) * (y2 - y1 + T(1.0));
+        boxes.push_back(x1, y1, x2, y2, area);
     }
 
+    std::vector<float> overlaps(sorted_indices.size());
     while (!sorted_indices.empty())
     {
-        int i = sorted_indices.at(0);
-        keep.push_back(i);
-
-        std::vector<int> sorted_indices_temp = sorted_indices;
-        std::vector<int> new_indices;
-        sorted_indices_temp.erase(sorted_indices_temp.begin());
-
-        for (unsigned int j = 0; j < sorted_indices_temp.size(); ++j)
+        keep.push_back(sorted_indices.at(0));
+
+        const size_t num_remaining = sorted_indices.size();
+        const float  x1            = boxes.x1[0];
+        const float  y1            = boxes.y1[0];
+        const float  x2            = boxes.x2[0];
+        const float  y2            = boxes.y2[0];
+        cpp::compute_iou(boxes, 0, boxes, 1, num_remaining, 1.f, overlaps.data());
+
+        // Move the boxes which are kept to the front, in the same order
+        size_t num_kept = 0;
+        for (size_t j = 1; j < num_remaining; ++j)
         {
-            const float xx1 = std::max(x1[sorted_indices_temp.at(j)], x1[i]);
-            const float yy1 = std::max(y1[sorted_indices_temp.at(j)], y1[i]);
-            const float xx2 = std::min(x2[sorted_indices_temp.at(j)], x2[i]);
-            const float yy2 = std::min(y2[sorted_indices_temp.at(j)], y2[i]);
-
-            const float w     = std::max((xx2 - xx1 + 1.f), 0.f);
-            const float h     = std::max((yy2 - yy1 + 1.f), 0.f);
-            const float inter = w * h;
-            const float ovr   = inter / (areas[i] + areas[sorted_indices_temp.at(j)] - inter);
-            const float ctr_x = xx1 + (w / 2);
-            const float ctr_y = yy1 + (h / 2);
-
             // If suppress_size is specified, filter the boxes based on their size and position
-            const bool keep_size = !info.suppress_size() || (w >= info.min_size() && h >= info.min_size() &&
-                                                             ctr_x < info.im_width() && ctr_y < info.im_height());
-            if (ovr <= info.nms() && keep_size)
+            bool keep_size = true;
+            if (info.suppress_size())
             {
-                new_indices.push_back(j);
+                const float xx1   = std::max(boxes.x1[j], x1);
+                const float yy1   = std::max(boxes.y1[j], y1);
+                const float xx2   = std::min(boxes.x2[j], x2);
+                const float yy2   = std::min(boxes.y2[j], y2);
+                const float w     = std::max((xx2 - xx1 + 1.f), 0.f);
+                const float h     = std::max((yy2 - yy1 + 1.f), 0.f);
+                const float ctr_x = xx1 + (w / 2);
+                const float ctr_y = yy1 + (h / 2);
+                keep_size =
+                    w >= info.min_size() && h >= info.min_size() && ctr_x < info.im_width() && ctr_y < info.im_height();
+            }
+            if (overlaps[j - 1] <= info.nms() && keep_size)
+            {
+                boxes.copy(j, num_kept);
+                sorted_indices[num_kept] = sorted_indices[j];
+                ++num_kept;
             }
         }
-
-        const unsigned int new_indices_size = new_indices.size();
-        std::vector<int>   new_sorted_indices(new_indices_size);
-        for (unsigned int i = 0; i < new_indices_size; ++i)
-        {
-            new_sorted_indices[i] = sorted_indices[new_indices[i] + 1];
-        }
-        sorted_indices = new_sorted_indices;
+        boxes.resize(num_kept);
+        sorted_indices.resize(num_kept);
     }
 
     return keep;
@@ -234,39 +232,39 @@ void CPPBoxWithNonMaximaSuppressionLimitKernel::run_nmslimit()
     for (int b = 0; b < batch_size; ++b)
     {
         // Skip first class if there is more than 1 except if the number of classes is 1.
+        // The classes are independent, each one only updating its own scores and kept boxes.
         const int j_start = (num_classes == 1 ? 0 : 1);
+        cpp::run_per_class(j_start, num_classes,
+                           [&](int j)
+                           {
+                               std::vector<int> inds;
+                               for (int i = 0; i < scores_count; ++i)
+                               {
+                                   if (in_scores[j][i] > _info.score_thresh())
+                                   {
+                                       inds.push_back(i);
+                                   }
+                               }
+                               if (_info.soft_nms_enabled())
+                               {
+                                   keeps[j] = SoftNMS(_boxes_in, in_scores, inds, _info, j);
+                               }
+                               else
+                               {
+                                   cpp::sort_by_score(inds, 0, inds.size(), in_scores[j]);
+                                   keeps[j] = NonMaximaSuppression<T>(_boxes_in, inds, _info, j);
+                               }
+                           });
         for (int j = j_start; j < num_classes; ++j)
         {
-            std::vector<T>   cur_scores(scores_count);
-            std::vector<int> inds;
-            for (int i = 0; i < scores_count; ++i)
-            {
-                const T score = in_scores[j][i];
-                cur_scores[i] = score;
-
-                if (score > _info.score_thresh())
-                {
-                    inds.push_back(i);
-                }
-            }
-            if (_info.soft_nms_enabled())
-            {
-                keeps[j] = SoftNMS(_boxes_in, in_scores, inds, _info, j);
-            }
-            else
-            {
-                std::sort(inds.data(), inds.data() + inds.size(),
-                          [&cur_scores](int lhs, int rhs) { return cur_scores[lhs] > cur_scores[rhs]; });
-
-                keeps[j] = NonMaximaSuppression<T>(_boxes_in, inds, _info, j);
-            }
             total_keep_count += keeps[j].size();
         }
 
         if (_info.detections_per_im() > 0 && total_keep_count > _info.detections_per_im())
         {
-            // merge all scores (represented by indices) together and sort
-            auto get_all_scores_sorted = [&in_scores, &keeps, total_keep_count]()
+            // merge all scores (represented by indices) together and select the threshold
+            const size_t detections_per_im     = _info.detections_per_im();
+            auto         get_all_scores_sorted = [&in_scores, &keeps, total_keep_count, detections_per_im]()
             {
                 std::vector<T> ret(total_keep_count);
 
@@ -280,13 +278,14 @@ void CPPBoxWithNonMaximaSuppressionLimitKernel::run_nmslimit()
                     }
                 }
 
-                std::sort(ret.data(), ret.data() + ret.size());
+                // Only the score of the last detection kept is needed
+                std::nth_element(ret.data(), ret.data() + (ret.size() - detections_per_im), ret.data() + ret.size());
 
                 return ret;
             };
 
             auto    all_scores_sorted = get_all_scores_sorted();
-            const T image_thresh      = all_scores_sorted[all_scores_sorted.size() - _info.detections_per_im()];
+            const T image_thresh      = all_scores_sorted[all_scores_sorted.size() - detections_per_im];
             for (int j = 1; j < num_classes; ++j)
             {
                 auto            &cur_keep = keeps[j];
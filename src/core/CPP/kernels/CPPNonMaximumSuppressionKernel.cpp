@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020 Arm Limited.
+ * Copyright (c) 2019-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,10 +26,12 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Validate.h"
 
+#include "src/core/CPP/NMSHelpers.h"
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/WindowHelpers.h"
 
 #include <algorithm>
+#include <numeric>
 
 namespace arm_compute
 {
@@ -119,9 +121,10 @@ void CPPNonMaximumSuppressionKernel::run(const Window &window, const ThreadInfo
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICPPKernel::window(), window);
 
-    // Auxiliary tensors
+    // Auxiliary tensors, the boxes being stored contiguously to compute the overlaps of a box with all the others
     std::vector<int>   indices_above_thd;
     std::vector<float> scores_above_thd;
+    cpp::NMSBoxes      boxes_above_thd;
     for (unsigned int i = 0; i < _num_boxes; ++i)
     {
         const float score_i = *(reinterpret_cast<float *>(_input_scores->ptr_to_element(Coordinates(i))));
@@ -129,95 +132,55 @@ void CPPNonMaximumSuppressionKernel::run(const Window &window, const ThreadInfo
         {
             scores_above_thd.emplace_back(score_i);
             indices_above_thd.emplace_back(i);
+
+            // Box-corner format: xmin, ymin, xmax, ymax
+            const auto xmin = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(0, i))));
+            const auto ymin = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(1, i))));
+            const auto xmax = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(2, i))));
+            const auto ymax = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(3, i))));
+            boxes_above_thd.push_back(xmin, ymin, xmax, ymax, (xmax - xmin) * (ymax - ymin));
         }
     }
 
-    // Sort selected indices based on scores
-    const unsigned int        num_above_thd = indices_above_thd.size();
-    std::vector<unsigned int> sorted_indices;
-    sorted_indices.resize(num_above_thd);
-    std::iota(sorted_indices.data(), sorted_indices.data() + num_above_thd, 0);
-    std::sort(std::begin(sorted_indices), std::end(sorted_indices),
-              [&](unsigned int first, unsigned int second)
-              { return scores_above_thd[first] > scores_above_thd[second]; });
-
     // Number of output is the minimum between max_detection and the scores above the threshold
-    const unsigned int num_output = std::min(_max_output_size, num_above_thd);
-    unsigned int       output_idx = 0;
-    std::vector<bool>  visited(num_above_thd, false);
+    const unsigned int num_above_thd = indices_above_thd.size();
+    const unsigned int num_output    = std::min(_max_output_size, num_above_thd);
+    unsigned int       output_idx    = 0;
+
+    // Selected indices are sorted by score lazily, as the output is usually full well before visiting all of them
+    std::vector<int> sorted_indices(num_above_thd);
+    std::iota(sorted_indices.begin(), sorted_indices.end(), 0);
+    unsigned int num_sorted = 0;
+
+    std::vector<uint8_t> visited(num_above_thd, 0);
+    std::vector<float>   overlaps(num_above_thd);
 
     // Keep only boxes with small IoU
-    for (unsigned int i = 0; i < num_above_thd; ++i)
+    for (unsigned int i = 0; i < num_above_thd && output_idx < num_output; ++i)
     {
-        // Check if the output is full
-        if (output_idx >= num_output)
+        if (i == num_sorted)
         {
-            break;
+            const unsigned int num_to_sort = std::min(num_output, num_above_thd - num_sorted);
+            cpp::sort_by_score(sorted_indices, num_sorted, num_to_sort, scores_above_thd);
+            num_sorted += num_to_sort;
         }
 
         // Check if it was already visited, if not add it to the output and update the indices counter
-        if (!visited[sorted_indices[i]])
-        {
-            *(reinterpret_cast<int *>(_output_indices->ptr_to_element(Coordinates(output_idx)))) =
-                indices_above_thd[sorted_indices[i]];
-            visited[sorted_indices[i]] = true;
-            ++output_idx;
-        }
-        else
+        const int box_i = sorted_indices[i];
+        if (visited[box_i] != 0)
         {
             continue;
         }
-
-        // Once added one element at the output check if the next ones overlap and can be skipped
-        for (unsigned int j = i + 1; j < num_above_thd; ++j)
+        *(reinterpret_cast<int *>(_output_indices->ptr_to_element(Coordinates(output_idx)))) = indices_above_thd[box_i];
+        visited[box_i] = 1;
+        ++output_idx;
+
+        // Once added one element at the output skip the ones which overlap it. The boxes with higher scores have
+        // already been visited, so computing the overlaps of all the boxes at once doesn't change the selection.
+        cpp::compute_iou(boxes_above_thd, box_i, boxes_above_thd, 0, num_above_thd, 0.f, overlaps.data());
+        for (unsigned int j = 0; j < num_above_thd; ++j)
         {
-            if (!visited[sorted_indices[j]])
-            {
-                // Calculate IoU
-                const unsigned int i_index = indices_above_thd[sorted_indices[i]];
-                const unsigned int j_index = indices_above_thd[sorted_indices[j]];
-                // Box-corner format: xmin, ymin, xmax, ymax
-                const auto box_i_xmin =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(0, i_index))));
-                const auto box_i_ymin =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(1, i_index))));
-                const auto box_i_xmax =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(2, i_index))));
-                const auto box_i_ymax =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(3, i_index))));
-
-                const auto box_j_xmin =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(0, j_index))));
-                const auto box_j_ymin =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(1, j_index))));
-                const auto box_j_xmax =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(2, j_index))));
-                const auto box_j_ymax =
-                    *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(3, j_index))));
-
-                const float area_i = (box_i_xmax - box_i_xmin) * (box_i_ymax - box_i_ymin);
-                const float area_j = (box_j_xmax - box_j_xmin) * (box_j_ymax - box_j_ymin);
-                float       overlap;
-                if (area_i <= 0 || area_j <= 0)
-                {
-                    overlap = 0.0f;
-                }
-                else
-                {
-                    const auto y_min_intersection = std::max<float>(box_i_ymin, box_j_ymin);
-                    const auto x_min_intersection = std::max<float>(box_i_xmin, box_j_xmin);
-                    const auto y_max_intersection = std::min<float>(box_i_ymax, box_j_ymax);
-                    const auto x_max_intersection = std::min<float>(box_i_xmax, box_j_xmax);
-                    const auto area_intersection  = std::max<float>(y_max_intersection - y_min_intersection, 0.0f) *
-                                                   std::max<float>(x_max_intersection - x_min_intersection, 0.0f);
-                    overlap = area_intersection / (area_i + area_j - area_intersection);
-                }
-
-                if (overlap > _iou_threshold)
-                {
-                    visited[sorted_indices[j]] = true;
-                }
-            }
+            visited[j] |= static_cast<uint8_t>(overlaps[j] > _iou_threshold);
         }
     }
     // The output could be full but not the output indices tensor
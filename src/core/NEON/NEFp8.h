@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_NEFP8_H
+#define ACL_SRC_CORE_NEON_NEFP8_H
+
+#ifdef __aarch64__
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+/** Factor between an E4M3 number and the fp16 number returned by @ref vfp8_e4m3_to_f16_bits */
+constexpr float fp8_e4m3_f16_scale = 256.f;
+
+/** Widen 16 E4M3 numbers to the bits of fp16 numbers that are @ref fp8_e4m3_f16_scale times smaller
+ *
+ * The 7 magnitude bits shifted into an fp16 keep their meaning for normal and subnormal numbers alike, only the
+ * exponent bias differs, so the conversion is exact and the factor can be folded into a later multiplication.
+ *
+ * @note The NaN encodings are converted to finite numbers.
+ *
+ * @param[in] v E4M3 numbers
+ *
+ * @return The fp16 bits of the first and last 8 numbers
+ */
+inline uint16x8x2_t vfp8_e4m3_to_f16_bits(uint8x16_t v)
+{
+    const uint8x16_t sign = vandq_u8(v, vdupq_n_u8(0x80));
+    const uint8x16_t mag  = vandq_u8(v, vdupq_n_u8(0x7F));
+    return {{vorrq_u16(vshll_n_u8(vget_low_u8(sign), 8), vshll_n_u8(vget_low_u8(mag), 7)),
+             vorrq_u16(vshll_n_u8(vget_high_u8(sign), 8), vshll_n_u8(vget_high_u8(mag), 7))}};
+}
+
+/** Widen 16 E5M2 numbers to the bits of the same fp16 numbers, E5M2 being fp16 without its 8 lowest mantissa bits
+ *
+ * @param[in] v E5M2 numbers
+ *
+ * @return The fp16 bits of the first and last 8 numbers
+ */
+inline uint16x8x2_t vfp8_e5m2_to_f16_bits(uint8x16_t v)
+{
+    return {{vshll_n_u8(vget_low_u8(v), 8), vshll_n_u8(vget_high_u8(v), 8)}};
+}
+
+/** Convert 4 fp16 numbers given by their bits to fp32
+ *
+ * @param[in] bits Bits of the fp16 numbers
+ *
+ * @return The fp32 numbers
+ */
+inline float32x4_t vcvt_f32_f16_bits(uint16x4_t bits)
+{
+    return vcvt_f32_f16(vreinterpret_f16_u16(bits));
+}
+} // namespace arm_compute
+#endif // __aarch64__
+#endif // ACL_SRC_CORE_NEON_NEFP8_H
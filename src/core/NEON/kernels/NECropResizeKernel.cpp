@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NECropResizeKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/CPP/Validate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace arm_compute
+{
+NECropResizeKernel::NECropResizeKernel()
+    : _input(nullptr),
+      _boxes(nullptr),
+      _box_ind(nullptr),
+      _output(nullptr),
+      _method(InterpolationPolicy::BILINEAR),
+      _extrapolation_value(0),
+      _crop_boxes()
+{
+}
+
+void NECropResizeKernel::configure(const ITensor      *input,
+                                   const ITensor      *boxes,
+                                   const ITensor      *box_ind,
+                                   ITensor            *output,
+                                   Coordinates2D       crop_size,
+                                   InterpolationPolicy method,
+                                   float               extrapolation_value)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, boxes, box_ind, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate(input->info(), boxes->info(), box_ind->info(), output->info(), crop_size,
+                                        method, extrapolation_value));
+
+    _input               = input;
+    _boxes               = boxes;
+    _box_ind             = box_ind;
+    _output              = output;
+    _method              = method;
+    _extrapolation_value = extrapolation_value;
+    _crop_boxes.resize(boxes->info()->dimension(1));
+
+    // Each step of the window is an output row of a box, the rows of all the boxes being consecutive
+    Window win;
+    win.set(Window::DimZ, Window::Dimension(0, crop_size.y * _crop_boxes.size(), 1));
+    INEKernel::configure(win);
+}
+
+Status NECropResizeKernel::validate(const ITensorInfo  *input,
+                                    const ITensorInfo  *boxes,
+                                    const ITensorInfo  *box_ind,
+                                    const ITensorInfo  *output,
+                                    Coordinates2D       crop_size,
+                                    InterpolationPolicy method,
+                                    float               extrapolation_value)
+{
+    ARM_COMPUTE_UNUSED(extrapolation_value);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, boxes, box_ind, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::U16, DataType::S16,
+                                                         DataType::F16, DataType::U32, DataType::S32, DataType::F32,
+                                                         DataType::QASYMM8, DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(input, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape().num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(boxes->tensor_shape()[0] != 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(boxes->tensor_shape()[1] != box_ind->tensor_shape()[0]);
+    ARM_COMPUTE_RETURN_ERROR_ON(crop_size.x <= 0 || crop_size.y <= 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(method != InterpolationPolicy::BILINEAR &&
+                                method != InterpolationPolicy::NEAREST_NEIGHBOR);
+    if (output->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(output, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+        const TensorShape out_shape(input->tensor_shape()[0], crop_size.x, crop_size.y, boxes->tensor_shape()[1]);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), out_shape);
+    }
+    return Status{};
+}
+
+void NECropResizeKernel::configure_boxes()
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    const int32_t input_width  = _input->info()->dimension(1);
+    const int32_t input_height = _input->info()->dimension(2);
+    for (size_t i = 0; i < _crop_boxes.size(); ++i)
+    {
+        // The box is specified by normalized coordinates [y0, x0, y1, x1], scaled to the image and rounded to integers
+        const auto  *box      = reinterpret_cast<const float *>(_boxes->ptr_to_element(Coordinates(0, i)));
+        const int32_t start_x = std::floor(box[1] * (input_width - 1) + 0.5f);
+        const int32_t start_y = std::floor(box[0] * (input_height - 1) + 0.5f);
+        const int32_t end_x   = std::floor(box[3] * (input_width - 1) + 0.5f);
+        const int32_t end_y   = std::floor(box[2] * (input_height - 1) + 0.5f);
+
+        Box &crop_box    = _crop_boxes[i];
+        crop_box.start_x = start_x;
+        crop_box.start_y = start_y;
+        crop_box.width   = std::abs(end_x - start_x) + 1;
+        crop_box.height  = std::abs(end_y - start_y) + 1;
+        crop_box.step_x  = end_x < start_x ? -1 : 1;
+        crop_box.step_y  = end_y < start_y ? -1 : 1;
+        crop_box.batch   = *reinterpret_cast<const int32_t *>(_box_ind->ptr_to_element(Coordinates(i)));
+        ARM_COMPUTE_ERROR_ON(crop_box.batch < 0 ||
+                             crop_box.batch >= static_cast<int32_t>(_input->info()->tensor_shape()[3]));
+    }
+}
+
+template <typename T>
+void NECropResizeKernel::run_rows(int32_t z_start, int32_t z_end)
+{
+    const ITensorInfo *src_info     = _input->info();
+    const ITensorInfo *dst_info     = _output->info();
+    const int32_t      channels     = src_info->dimension(0);
+    const int32_t      src_width    = src_info->dimension(1);
+    const int32_t      src_height   = src_info->dimension(2);
+    const size_t       src_stride_x = src_info->strides_in_bytes()[1];
+    const size_t       src_stride_y = src_info->strides_in_bytes()[2];
+    const size_t       src_stride_b = src_info->strides_in_bytes()[3];
+    const int32_t      dst_width    = dst_info->dimension(1);
+    const int32_t      dst_height   = dst_info->dimension(2);
+    const size_t       dst_stride_x = dst_info->strides_in_bytes()[1];
+
+    // Quantized values are read back as floats, the other types are converted as they are
+    const bool                    is_quantized = is_data_type_quantized_asymmetric(src_info->data_type());
+    const UniformQuantizationInfo qinfo        = src_info->quantization_info().uniform();
+    const float                   scale        = is_quantized ? qinfo.scale : 1.f;
+    const float                   offset       = is_quantized ? static_cast<float>(qinfo.offset) : 0.f;
+
+    const float extrapolation_value = _extrapolation_value;
+
+    const auto value = [&](const T *ptr, int32_t c)
+    { return ptr == nullptr ? extrapolation_value : (static_cast<float>(ptr[c]) - offset) * scale; };
+
+    for (int32_t z = z_start; z < z_end; ++z)
+    {
+        const int32_t  box_id    = z / dst_height;
+        const int32_t  dst_y     = z % dst_height;
+        const Box     &box       = _crop_boxes[box_id];
+        const uint8_t *batch_ptr =
+            _input->buffer() + src_info->offset_first_element_in_bytes() + box.batch * src_stride_b;
+        uint8_t *dst_row = _output->ptr_to_element(Coordinates(0, 0, dst_y, box_id));
+
+        // Address of an element of the crop, nullptr if it is outside of the crop or of the input image
+        const auto element = [&](int32_t col, int32_t row) -> const T *
+        {
+            if (col >= box.width || row >= box.height)
+            {
+                return nullptr;
+            }
+            const int32_t x = box.start_x + box.step_x * col;
+            const int32_t y = box.start_y + box.step_y * row;
+            if (x < 0 || x >= src_width || y < 0 || y >= src_height)
+            {
+                return nullptr;
+            }
+            return reinterpret_cast<const T *>(batch_ptr + x * src_stride_x + y * src_stride_y);
+        };
+
+        const float wr    = static_cast<float>(box.width) / static_cast<float>(dst_width);
+        const float hr    = static_cast<float>(box.height) / static_cast<float>(dst_height);
+        const float src_y = dst_y * hr;
+        const auto  row   = static_cast<int32_t>(std::floor(src_y));
+
+        for (int32_t dst_x = 0; dst_x < dst_width; ++dst_x)
+        {
+            auto       *dst   = reinterpret_cast<float *>(dst_row + dst_x * dst_stride_x);
+            const float src_x = dst_x * wr;
+            const auto  col   = static_cast<int32_t>(std::floor(src_x));
+            if (_method == InterpolationPolicy::NEAREST_NEIGHBOR)
+            {
+                const T *in = element(col, row);
+                for (int32_t c = 0; c < channels; ++c)
+                {
+                    dst[c] = value(in, c);
+                }
+            }
+            else if (col >= box.width || row >= box.height)
+            {
+                std::fill_n(dst, channels, extrapolation_value);
+            }
+            else
+            {
+                const float dx   = src_x - col;
+                const float dy   = src_y - row;
+                const float dx_1 = 1.f - dx;
+                const float dy_1 = 1.f - dy;
+                const T    *tl   = element(col, row);
+                const T    *tr   = element(col + 1, row);
+                const T    *bl   = element(col, row + 1);
+                const T    *br   = element(col + 1, row + 1);
+                for (int32_t c = 0; c < channels; ++c)
+                {
+                    dst[c] = value(tl, c) * (dx_1 * dy_1) + value(tr, c) * (dx * dy_1) + value(bl, c) * (dx_1 * dy) +
+                             value(br, c) * (dx * dy);
+                }
+            }
+        }
+    }
+}
+
+void NECropResizeKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int32_t z_start = window.z().start();
+    const int32_t z_end   = window.z().end();
+    switch (_input->info()->data_type())
+    {
+        case DataType::U8:
+        case DataType::QASYMM8:
+            run_rows<uint8_t>(z_start, z_end);
+            break;
+        case DataType::QASYMM8_SIGNED:
+            run_rows<int8_t>(z_start, z_end);
+            break;
+        case DataType::U16:
+            run_rows<uint16_t>(z_start, z_end);
+            break;
+        case DataType::S16:
+            run_rows<int16_t>(z_start, z_end);
+            break;
+        case DataType::U32:
+            run_rows<uint32_t>(z_start, z_end);
+            break;
+        case DataType::S32:
+            run_rows<int32_t>(z_start, z_end);
+            break;
+        case DataType::F16:
+            run_rows<half>(z_start, z_end);
+            break;
+        case DataType::F32:
+            run_rows<float>(z_start, z_end);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type");
+    }
+}
+} // namespace arm_compute
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NECROPRESIZEKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NECROPRESIZEKERNEL_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/core/NEON/INEKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Kernel to crop boxes of a batch of images and resize them in a single pass
+ *
+ * The rows of all the resized boxes form a single iteration space, so the boxes are processed by one scheduled job.
+ * Each output row is interpolated straight from the source image, without an intermediate cropped image.
+ */
+class NECropResizeKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NECropResizeKernel";
+    }
+    /** Default constructor */
+    NECropResizeKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NECropResizeKernel(const NECropResizeKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NECropResizeKernel &operator=(const NECropResizeKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NECropResizeKernel(NECropResizeKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NECropResizeKernel &operator=(NECropResizeKernel &&) = default;
+    /** Default destructor */
+    ~NECropResizeKernel() = default;
+    /** Configure kernel
+     *
+     * @note Supported tensor rank: up to 4
+     *
+     * @param[in]  input               Source tensor containing N batches of 3D images to be cropped.
+     *                                 Data type supported: U8/U16/S16/U32/S32/F16/F32/QASYMM8/QASYMM8_SIGNED. Data layouts supported: NHWC.
+     *                                 Quantized values are dequantized.
+     * @param[in]  boxes               Tensor containing the boxes used to crop the images, each represented by 4 normalized values
+     *                                 [y0, x0, y1, x1]. Data type supported: F32
+     * @param[in]  box_ind             One dimensional tensor containing the batch index of the 3D image in @p input that the corresponding
+     *                                 box in @p boxes will be applied to. Data type supported: S32
+     * @param[out] output              Destination tensor containing a cropped and resized image for each box in @p boxes. Data type supported: F32
+     * @param[in]  crop_size           The dimensions that each cropped image will be resized to.
+     * @param[in]  method              The policy to be used when resizing image. Bilinear and nearest neighbor are supported.
+     * @param[in]  extrapolation_value Value to be used for values outside of the image.
+     */
+    void configure(const ITensor      *input,
+                   const ITensor      *boxes,
+                   const ITensor      *box_ind,
+                   ITensor            *output,
+                   Coordinates2D       crop_size,
+                   InterpolationPolicy method,
+                   float               extrapolation_value);
+    /** Static function to check if given info will lead to a valid configuration of @ref NECropResizeKernel
+     *
+     * Similar to @ref NECropResizeKernel::configure()
+     *
+     * @return A status
+     */
+    static Status validate(const ITensorInfo  *input,
+                           const ITensorInfo  *boxes,
+                           const ITensorInfo  *box_ind,
+                           const ITensorInfo  *output,
+                           Coordinates2D       crop_size,
+                           InterpolationPolicy method,
+                           float               extrapolation_value);
+    /** Read the boxes and their batch indices, which are only known at run time. Must be called before each run */
+    void configure_boxes();
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Crop and resize the output rows [z_start, z_end) of the boxes, counted across all the boxes */
+    template <typename T>
+    void run_rows(int32_t z_start, int32_t z_end);
+
+    /** Box in the coordinates of its source image */
+    struct Box
+    {
+        int32_t start_x; /**< First column of the crop, inclusive */
+        int32_t start_y; /**< First row of the crop, inclusive */
+        int32_t width;   /**< Number of columns of the crop */
+        int32_t height;  /**< Number of rows of the crop */
+        int32_t step_x;  /**< Step between two columns of the crop in the source image, -1 if the crop is flipped */
+        int32_t step_y;  /**< Step between two rows of the crop in the source image, -1 if the crop is flipped */
+        int32_t batch;   /**< Index of the source image */
+    };
+
+    const ITensor      *_input;
+    const ITensor      *_boxes;
+    const ITensor      *_box_ind;
+    ITensor            *_output;
+    InterpolationPolicy _method;
+    float               _extrapolation_value;
+    std::vector<Box>    _crop_boxes;
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NECROPRESIZEKERNEL_H
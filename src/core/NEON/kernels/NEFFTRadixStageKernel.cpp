@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021 Arm Limited.
+ * Copyright (c) 2019-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include "src/core/helpers/WindowHelpers.h"
 #include "src/core/NEON/wrapper/traits.h"
 #include "src/core/NEON/wrapper/wrapper.h"
+#include "src/core/utils/helpers/fft.h"
 #include "support/ToolchainSupport.h"
 
 #include <arm_neon.h>
@@ -44,9 +45,6 @@ namespace arm_compute
 {
 namespace
 {
-// PI constant (from cmath)
-constexpr float kPi = float(M_PI);
-
 // Constant used in the fft_3 kernel
 constexpr float kSqrt3Div2 = 0.866025403784438;
 
@@ -397,11 +395,12 @@ void fft_8(float32x2_t       &x1,
 
 template <bool first_stage>
 void fft_radix_2_axes_0(
-    float *out, float *in, unsigned int Nx, unsigned int NxRadix, const float32x2_t &w_m, unsigned int N)
+    float *out, float *in, unsigned int Nx, unsigned int NxRadix, const float *twiddles, unsigned int N)
 {
-    float32x2_t w{1.0f, 0.0f};
     for (unsigned int j = 0; j < Nx; j++)
     {
+        float32x2_t w = wrapper::vload(twiddles + 2 * j);
+
         for (unsigned int k = 2 * j; k < 2 * N; k += 2 * NxRadix)
         {
             auto a = float32x2_t{0, 0};
@@ -434,8 +433,6 @@ void fft_radix_2_axes_0(
                 wrapper::vstore(out + k + 2 * Nx, b);
             }
         }
-
-        w = c_mul_neon(w, w_m);
     }
 }
 
@@ -443,15 +440,16 @@ void fft_radix_2_axes_1(float             *out,
                         float             *in,
                         unsigned int       Nx,
                         unsigned int       NxRadix,
-                        const float32x2_t &w_m,
+                        const float       *twiddles,
                         unsigned int       N,
                         unsigned int       M,
                         unsigned int       in_pad_x,
                         unsigned int       out_pad_x)
 {
-    float32x2_t w{1.0f, 0.0f};
     for (unsigned int j = 0; j < Nx; j++)
     {
+        float32x2_t w = wrapper::vload(twiddles + 2 * j);
+
         for (unsigned int k = 2 * j; k < 2 * M; k += 2 * NxRadix)
         {
             // Load inputs
@@ -465,19 +463,18 @@ void fft_radix_2_axes_1(float             *out,
             wrapper::vstore(out + (N + out_pad_x) * k, a);
             wrapper::vstore(out + (N + out_pad_x) * (k + 2 * Nx), b);
         }
-
-        w = c_mul_neon(w, w_m);
     }
 }
 
 template <bool first_stage>
 void fft_radix_3_axes_0(
-    float *out, float *in, unsigned int Nx, unsigned int NxRadix, const float32x2_t &w_m, unsigned int N)
+    float *out, float *in, unsigned int Nx, unsigned int NxRadix, const float *twiddles, unsigned int N)
 {
-    float32x2_t w{1.0f, 0.0f};
     for (unsigned int j = 0; j < Nx; j++)
     {
-        const auto w2 = c_mul_neon(w, w);
+        float32x2_t w = wrapper::vload(twiddles + 2 * j);
+
+        const auto w2 = wrapper::vload(twiddles + 4 * j);
 
         for (unsigned int k = 2 * j; k < 2 * N; k += 2 * NxRadix)
         {
@@ -520,16 +517,17 @@ void fft_radix_3_axes_1(float             *out,
                         float             *in,
                         unsigned int       Nx,
                         unsigned int       NxRadix,
-                        const float32x2_t &w_m,
+                        const float       *twiddles,
                         unsigned int       N,
                         unsigned int       M,
                         unsigned int       in_pad_x,
                         unsigned int       out_pad_x)
 {
-    float32x2_t w{1.0f, 0.0f};
     for (unsigned int j = 0; j < Nx; j++)
     {
-        const auto w2 = c_mul_neon(w, w);
+        float32x2_t w = wrapper::vload(twiddles + 2 * j);
+
+        const auto w2 = wrapper::vload(twiddles + 4 * j);
 
         for (unsigned int k = 2 * j; k < 2 * M; k += 2 * NxRadix)
         {
@@ -552,13 +550,14 @@ void fft_radix_3_axes_1(float             *out,
 
 template <bool first_stage>
 void fft_radix_4_axes_0(
-    float *out, float *in, unsigned int Nx, unsigned int NxRadix, const float32x2_t &w_m, unsigned int N)
+    float *out, float *in, unsigned int Nx, unsigned int NxRadix, const float *twiddles, unsigned int N)
 {
-    float32x2_t w{1.0f, 0.0f};
     for (unsigned int j = 0; j < Nx; j++)
     {
-        const auto w2 = c_mul_neon(w, w);
-        const auto w3 = c_mul_neon(w2, w);
+        float32x2_t w = wrapper::vload(twiddles + 2 * j);
+
+        const auto w2 = wrapper::vload(twiddles + 4 * j);
+        const auto w3 = wrapper::vload(twiddles + 6 * j);
 
         for (unsigned int k = 2 * j; k < 2 * N; k += 2 * NxRadix)
         {
@@ -600,8 +599,6 @@ void fft_radix_4_axes_0(
                 wrapper::vstore(out + k + 6 * Nx, d);
             }
         }
-
-        w = c_mul_neon(w, w_m);
     }
 }
 
@@ -609,17 +606,18 @@ void fft_radix_4_axes_1(float             *out,
                         float             *in,
                         unsigned int       Nx,
                         unsigned int       NxRadix,
-                        const float32x2_t &w_m,
+                        const float       *twiddles,
                         unsigned int       N,
                         unsigned int       M,
                         unsigned int       in_pad_x,
                         unsigned int       out_pad_x)
 {
-    float32x2_t w{1.0f, 0.0f};
     for (unsigned int j = 0; j < Nx; j++)
     {
-        const auto w2 = c_mul_neon(w, w);
-        const auto w3 = c_mul_neon(w2, w);
+        float32x2_t w = wrapper::vload(twiddles + 2 * j);
+
+        const auto w2 = wrapper::vload(twiddles + 4 * j);
+        const auto w3 = wrapper::vload(twiddles + 6 * j);
 
         for (unsigned int k = 2 * j; k < 2 * M; k += 2 * NxRadix)
         {
@@ -637,21 +635,20 @@ void fft_radix_4_axes_1(float             *out,
             wrapper::vstore(out + (N + out_pad_x) * (k + 4 * Nx), c);
             wrapper::vstore(out + (N + out_pad_x) * (k + 6 * Nx), d);
         }
-
-        w = c_mul_neon(w, w_m);
     }
 }
 
 template <bool first_stage>
 void fft_radix_5_axes_0(
-    float *out, float *in, unsigned int Nx, unsigned int NxRadix, const float32x2_t &w_m, unsigned int N)
+    float *out, float *in, unsigned int Nx, unsigned int NxRadix, const float *twiddles, unsigned int N)
 {
-    float32x2_t w{1.0f, 0.0f};
     for (unsigned int j = 0; j < Nx; j++)
     {
-        const float32x2_t w2 = c_mul_neon(w, w);
-        const float32x2_t w3 = c_mul_neon(w2, w);
-        const float32x2_t w4 = c_mul_neon(w3, w);
+        float32x2_t w = wrapper::vload(twiddles + 2 * j);
+
+        const float32x2_t w2 = wrapper::vload(twiddles + 4 * j);
+        const float32x2_t w3 = wrapper::vload(twiddles + 6 * j);
+        const float32x2_t w4 = wrapper::vload(twiddles + 8 * j);
 
         for (unsigned int k = 2 * j; k < 2 * N; k += 2 * NxRadix)
         {
@@ -699,8 +696,6 @@ void fft_radix_5_axes_0(
             }
             wrapper::vstore(out + k + 8 * Nx, e);
         }
-
-        w = c_mul_neon(w, w_m);
     }
 }
 
@@ -708,18 +703,19 @@ void fft_radix_5_axes_1(float             *out,
                         float             *in,
                         unsigned int       Nx,
                         unsigned int       NxRadix,
-                        const float32x2_t &w_m,
+                        const float       *twiddles,
                         unsigned int       N,
                         unsigned int       M,
                         unsigned int       in_pad_x,
                         unsigned int       out_pad_x)
 {
-    float32x2_t w{1.0f, 0.0f};
     for (unsigned int j = 0; j < Nx; j++)
     {
-        const float32x2_t w2 = c_mul_neon(w, w);
-        const float32x2_t w3 = c_mul_neon(w2, w);
-        const float32x2_t w4 = c_mul_neon(w3, w);
+        float32x2_t w = wrapper::vload(twiddles + 2 * j);
+
+        const float32x2_t w2 = wrapper::vload(twiddles + 4 * j);
+        const float32x2_t w3 = wrapper::vload(twiddles + 6 * j);
+        const float32x2_t w4 = wrapper::vload(twiddles + 8 * j);
 
         for (unsigned int k = 2 * j; k < 2 * M; k += 2 * NxRadix)
         {
@@ -740,23 +736,22 @@ void fft_radix_5_axes_1(float             *out,
             wrapper::vstore(out + (N + out_pad_x) * (k + 6 * Nx), d);
             wrapper::vstore(out + (N + out_pad_x) * (k + 8 * Nx), e);
         }
-
-        w = c_mul_neon(w, w_m);
     }
 }
 
 template <bool first_stage>
 void fft_radix_7_axes_0(
-    float *out, float *in, unsigned int Nx, unsigned int NxRadix, const float32x2_t &w_m, unsigned int N)
+    float *out, float *in, unsigned int Nx, unsigned int NxRadix, const float *twiddles, unsigned int N)
 {
-    float32x2_t w{1.0f, 0.0f};
     for (unsigned int j = 0; j < Nx; j++)
     {
-        const float32x2_t w2 = c_mul_neon(w, w);
-        const float32x2_t w3 = c_mul_neon(w2, w);
-        const float32x2_t w4 = c_mul_neon(w3, w);
-        const float32x2_t w5 = c_mul_neon(w4, w);
-        const float32x2_t w6 = c_mul_neon(w5, w);
+        float32x2_t w = wrapper::vload(twiddles + 2 * j);
+
+        const float32x2_t w2 = wrapper::vload(twiddles + 4 * j);
+        const float32x2_t w3 = wrapper::vload(twiddles + 6 * j);
+        const float32x2_t w4 = wrapper::vload(twiddles + 8 * j);
+        const float32x2_t w5 = wrapper::vload(twiddles + 10 * j);
+        const float32x2_t w6 = wrapper::vload(twiddles + 12 * j);
 
         for (unsigned int k = 2 * j; k < 2 * N; k += 2 * NxRadix)
         {
@@ -813,8 +808,6 @@ void fft_radix_7_axes_0(
             }
             wrapper::vstore(out + k + 12 * Nx, g);
         }
-
-        w = c_mul_neon(w, w_m);
     }
 }
 
@@ -822,20 +815,21 @@ void fft_radix_7_axes_1(float             *out,
                         float             *in,
                         unsigned int       Nx,
                         unsigned int       NxRadix,
-                        const float32x2_t &w_m,
+                        const float       *twiddles,
                         unsigned int       N,
                         unsigned int       M,
                         unsigned int       in_pad_x,
                         unsigned int       out_pad_x)
 {
-    float32x2_t w{1.0f, 0.0f};
     for (unsigned int j = 0; j < Nx; j++)
     {
-        const float32x2_t w2 = c_mul_neon(w, w);
-        const float32x2_t w3 = c_mul_neon(w2, w);
-        const float32x2_t w4 = c_mul_neon(w3, w);
-        const float32x2_t w5 = c_mul_neon(w4, w);
-        const float32x2_t w6 = c_mul_neon(w5, w);
+        float32x2_t w = wrapper::vload(twiddles + 2 * j);
+
+        const float32x2_t w2 = wrapper::vload(twiddles + 4 * j);
+        const float32x2_t w3 = wrapper::vload(twiddles + 6 * j);
+        const float32x2_t w4 = wrapper::vload(twiddles + 8 * j);
+        const float32x2_t w5 = wrapper::vload(twiddles + 10 * j);
+        const float32x2_t w6 = wrapper::vload(twiddles + 12 * j);
 
         for (unsigned int k = 2 * j; k < 2 * M; k += 2 * NxRadix)
         {
@@ -860,24 +854,23 @@ void fft_radix_7_axes_1(float             *out,
             wrapper::vstore(out + (N + out_pad_x) * (k + 10 * Nx), f);
             wrapper::vstore(out + (N + out_pad_x) * (k + 12 * Nx), g);
         }
-
-        w = c_mul_neon(w, w_m);
     }
 }
 
 template <bool first_stage>
 void fft_radix_8_axes_0(
-    float *out, float *in, unsigned int Nx, unsigned int NxRadix, const float32x2_t &w_m, unsigned int N)
+    float *out, float *in, unsigned int Nx, unsigned int NxRadix, const float *twiddles, unsigned int N)
 {
-    float32x2_t w{1.0f, 0.0f};
     for (unsigned int j = 0; j < Nx; j++)
     {
-        const float32x2_t w2 = c_mul_neon(w, w);
-        const float32x2_t w3 = c_mul_neon(w2, w);
-        const float32x2_t w4 = c_mul_neon(w3, w);
-        const float32x2_t w5 = c_mul_neon(w4, w);
-        const float32x2_t w6 = c_mul_neon(w5, w);
-        const float32x2_t w7 = c_mul_neon(w6, w);
+        float32x2_t w = wrapper::vload(twiddles + 2 * j);
+
+        const float32x2_t w2 = wrapper::vload(twiddles + 4 * j);
+        const float32x2_t w3 = wrapper::vload(twiddles + 6 * j);
+        const float32x2_t w4 = wrapper::vload(twiddles + 8 * j);
+        const float32x2_t w5 = wrapper::vload(twiddles + 10 * j);
+        const float32x2_t w6 = wrapper::vload(twiddles + 12 * j);
+        const float32x2_t w7 = wrapper::vload(twiddles + 14 * j);
 
         for (unsigned int k = 2 * j; k < 2 * N; k += 2 * NxRadix)
         {
@@ -943,8 +936,6 @@ void fft_radix_8_axes_0(
                 wrapper::vstore(out + k + 14 * Nx, h);
             }
         }
-
-        w = c_mul_neon(w, w_m);
     }
 }
 
@@ -952,21 +943,22 @@ void fft_radix_8_axes_1(float             *out,
                         float             *in,
                         unsigned int       Nx,
                         unsigned int       NxRadix,
-                        const float32x2_t &w_m,
+                        const float       *twiddles,
                         unsigned int       N,
                         unsigned int       M,
                         unsigned int       in_pad_x,
                         unsigned int       out_pad_x)
 {
-    float32x2_t w{1.0f, 0.0f};
     for (unsigned int j = 0; j < Nx; j++)
     {
-        const float32x2_t w2 = c_mul_neon(w, w);
-        const float32x2_t w3 = c_mul_neon(w2, w);
-        const float32x2_t w4 = c_mul_neon(w3, w);
-        const float32x2_t w5 = c_mul_neon(w4, w);
-        const float32x2_t w6 = c_mul_neon(w5, w);
-        const float32x2_t w7 = c_mul_neon(w6, w);
+        float32x2_t w = wrapper::vload(twiddles + 2 * j);
+
+        const float32x2_t w2 = wrapper::vload(twiddles + 4 * j);
+        const float32x2_t w3 = wrapper::vload(twiddles + 6 * j);
+        const float32x2_t w4 = wrapper::vload(twiddles + 8 * j);
+        const float32x2_t w5 = wrapper::vload(twiddles + 10 * j);
+        const float32x2_t w6 = wrapper::vload(twiddles + 12 * j);
+        const float32x2_t w7 = wrapper::vload(twiddles + 14 * j);
 
         for (unsigned int k = 2 * j; k < 2 * M; k += 2 * NxRadix)
         {
@@ -993,8 +985,6 @@ void fft_radix_8_axes_1(float             *out,
             wrapper::vstore(out + (N + out_pad_x) * (k + 12 * Nx), g);
             wrapper::vstore(out + (N + out_pad_x) * (k + 14 * Nx), h);
         }
-
-        w = c_mul_neon(w, w_m);
     }
 }
 
@@ -1032,7 +1022,7 @@ validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, const FFT
 } // namespace
 
 NEFFTRadixStageKernel::NEFFTRadixStageKernel()
-    : _input(nullptr), _output(nullptr), _Nx(0), _axis(0), _radix(0), _func_0(), _func_1()
+    : _input(nullptr), _output(nullptr), _Nx(0), _axis(0), _radix(0), _twiddles(nullptr), _func_0(), _func_1()
 {
 }
 
@@ -1092,11 +1082,12 @@ void NEFFTRadixStageKernel::configure(ITensor *input, ITensor *output, const FFT
     ARM_COMPUTE_ERROR_THROW_ON(
         validate_arguments(input->info(), (output != nullptr) ? output->info() : nullptr, config));
 
-    _input  = input;
-    _output = (output == nullptr) ? input : output;
-    _Nx     = config.Nx;
-    _axis   = config.axis;
-    _radix  = config.radix;
+    _input    = input;
+    _output   = (output == nullptr) ? input : output;
+    _Nx       = config.Nx;
+    _axis     = config.axis;
+    _radix    = config.radix;
+    _twiddles = arm_compute::helpers::fft::twiddle_factors(config.radix * config.Nx).data();
 
     switch (config.axis)
     {
@@ -1148,10 +1139,7 @@ void NEFFTRadixStageKernel::run(const Window &window, const ThreadInfo &info)
     Iterator in(_input, input_window);
     Iterator out(_output, input_window);
 
-    // Precompute FFT constants
     const unsigned int NxRadix = _radix * _Nx;
-    const float        alpha   = 2.0f * kPi / float(NxRadix);
-    const float32x2_t  w_m{cosf(alpha), -sinf(alpha)};
 
     if (_axis == 0)
     {
@@ -1159,8 +1147,8 @@ void NEFFTRadixStageKernel::run(const Window &window, const ThreadInfo &info)
         execute_window_loop(
             input_window,
             [&](const Coordinates &) {
-                _func_0(reinterpret_cast<float *>(out.ptr()), reinterpret_cast<float *>(in.ptr()), _Nx, NxRadix, w_m,
-                        N);
+                _func_0(reinterpret_cast<float *>(out.ptr()), reinterpret_cast<float *>(in.ptr()), _Nx, NxRadix,
+                        _twiddles, N);
             },
             in, out);
     }
@@ -1172,8 +1160,8 @@ void NEFFTRadixStageKernel::run(const Window &window, const ThreadInfo &info)
             input_window,
             [&](const Coordinates &)
             {
-                _func_1(reinterpret_cast<float *>(out.ptr()), reinterpret_cast<float *>(in.ptr()), _Nx, NxRadix, w_m, N,
-                        M, _input->info()->padding().right + _input->info()->padding().left,
+                _func_1(reinterpret_cast<float *>(out.ptr()), reinterpret_cast<float *>(in.ptr()), _Nx, NxRadix,
+                        _twiddles, N, M, _input->info()->padding().right + _input->info()->padding().left,
                         _output->info()->padding().right + _output->info()->padding().left);
             },
             in, out);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021 Arm Limited.
+ * Copyright (c) 2019-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -89,17 +89,18 @@ private:
     unsigned int _Nx;
     unsigned int _axis;
     unsigned int _radix;
+    const float *_twiddles;
 
     void set_radix_stage_axis0(const FFTRadixStageKernelInfo &config);
     void set_radix_stage_axis1(const FFTRadixStageKernelInfo &config);
 
     using FFTFunctionPointerAxis0 =
-        std::function<void(float *, float *, unsigned int, unsigned int, const float32x2_t &, unsigned int)>;
+        std::function<void(float *, float *, unsigned int, unsigned int, const float *, unsigned int)>;
     using FFTFunctionPointerAxis1 = std::function<void(float *,
                                                        float *,
                                                        unsigned int,
                                                        unsigned int,
-                                                       const float32x2_t &,
+                                                       const float *,
                                                        unsigned int,
                                                        unsigned int,
                                                        unsigned int,
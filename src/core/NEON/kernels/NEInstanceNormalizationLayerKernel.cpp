@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, 2024 Arm Limited.
+ * Copyright (c) 2019-2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -102,8 +102,6 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, f
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(epsilon == 0.f, "Epsilon must be different than 0");
 
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(input, DataType::F16, DataType::F32);
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_layout() == DataLayout::NHWC,
-                                    "NHWC data layout is not supported by the kernel directly");
 
     if (output != nullptr && output->total_size() != 0)
     {
@@ -120,6 +118,14 @@ std::tuple<Status, Window> validate_and_configure_window(ITensorInfo *input, ITe
 {
     // We handle the planes manually
     Window win = calculate_max_window(*input, Steps(1));
+    if (input->data_layout() == DataLayout::NHWC)
+    {
+        // The channels are reduced over the planes in blocks of 64 bytes, the plane of each block is handled manually
+        const unsigned int block_size = 64 / input->element_size();
+        win = calculate_max_window(*input, Steps(block_size));
+        win.set(Window::DimY, Window::Dimension(0, 1, 1));
+        win.set(Window::DimZ, Window::Dimension(0, 1, 1));
+    }
 
     // Output auto initialization if not yet initialized
     auto_init_if_empty(*output, input->tensor_shape(), 1, input->data_type());
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022 Arm Limited.
+ * Copyright (c) 2019-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,7 +53,7 @@ public:
     ~NEInstanceNormalizationLayerKernel() = default;
     /** Set the input and output tensors.
      *
-     * @param[in, out] input  Source tensor. Data types supported: F16/F32. Data layout supported: NCHW
+     * @param[in, out] input  Source tensor. Data types supported: F16/F32. Data layout supported: NCHW/NHWC
      *                        In case of @p output tensor = nullptr this tensor will store the result of the normalization.
      * @param[out]     output Destination tensor. Data types and data layouts supported: same as @p input.
      * @param[in]      info   Kernel meta-data descriptor
@@ -62,7 +62,7 @@ public:
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEInstanceNormalizationLayer.
      *
-     * @param[in] input  Source tensor info. Data types supported: F16/F32. Data layout supported: NCHW
+     * @param[in] input  Source tensor info. Data types supported: F16/F32. Data layout supported: NCHW/NHWC
      * @param[in] output Destination tensor info. Data types and data layouts supported: same as @p input.
      * @param[in] info   Kernel meta-data descriptor
      *
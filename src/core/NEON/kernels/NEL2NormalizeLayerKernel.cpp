@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,6 +51,7 @@ struct L2NormalizeLayerSelectorData
 {
     DataType            dt;
     unsigned int        actual_axis;
+    bool                fused;
     cpuinfo::CpuIsaInfo isa;
 };
 
@@ -67,24 +68,44 @@ struct L2NormalizeLayerKernel
 };
 
 static const L2NormalizeLayerKernel available_kernels[] = {
+    {"fp32_neon_l2normalize_fused_x",
+     [](const L2NormalizeLayerSelectorData &data)
+     { return data.dt == DataType::F32 && data.fused && data.actual_axis == Window::DimX; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_l2_normalize_fused_x)},
+    {"fp32_neon_l2normalize_fused_yz",
+     [](const L2NormalizeLayerSelectorData &data)
+     { return data.dt == DataType::F32 && data.fused && data.actual_axis != Window::DimX; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_l2_normalize_fused_yz)},
     {"fp32_neon_l2normalize_x",
      [](const L2NormalizeLayerSelectorData &data)
-     { return data.dt == DataType::F32 && data.actual_axis == Window::DimX; },
+     { return data.dt == DataType::F32 && !data.fused && data.actual_axis == Window::DimX; },
      REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_l2_normalize_x)},
     {"fp32_neon_l2normalize_yz",
      [](const L2NormalizeLayerSelectorData &data)
-     { return data.dt == DataType::F32 && data.actual_axis != Window::DimX; },
+     { return data.dt == DataType::F32 && !data.fused && data.actual_axis != Window::DimX; },
      REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_l2_normalize_yz)},
+    {
+        "fp16_neon_l2normalize_fused_x",
+        [](const L2NormalizeLayerSelectorData &data)
+        { return data.dt == DataType::F16 && data.isa.fp16 && data.fused && data.actual_axis == Window::DimX; },
+        REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_l2_normalize_fused_x),
+    },
+    {
+        "fp16_neon_l2normalize_fused_yz",
+        [](const L2NormalizeLayerSelectorData &data)
+        { return data.dt == DataType::F16 && data.isa.fp16 && data.fused && data.actual_axis != Window::DimX; },
+        REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_l2_normalize_fused_yz),
+    },
     {
         "fp16_neon_l2normalize_x",
         [](const L2NormalizeLayerSelectorData &data)
-        { return data.dt == DataType::F16 && data.isa.fp16 && data.actual_axis == Window::DimX; },
+        { return data.dt == DataType::F16 && data.isa.fp16 && !data.fused && data.actual_axis == Window::DimX; },
         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_l2_normalize_x),
     },
     {
         "fp16_neon_l2normalize_yz",
         [](const L2NormalizeLayerSelectorData &data)
-        { return data.dt == DataType::F16 && data.isa.fp16 && data.actual_axis != Window::DimX; },
+        { return data.dt == DataType::F16 && data.isa.fp16 && !data.fused && data.actual_axis != Window::DimX; },
         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_l2_normalize_yz),
     },
 };
@@ -113,17 +134,21 @@ validate_arguments(const ITensorInfo *input, const ITensorInfo *sum, const ITens
     ARM_COMPUTE_UNUSED(epsilon);
 
     const uint32_t actual_axis = wrap_around(axis, max_input_tensor_dim);
-    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, sum, output);
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, sum);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(actual_axis > 2, "Actual axis greater than 2 is not supported");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(actual_axis >= TensorShape::num_max_dimensions,
                                     "Actual normalization axis greater than max number of dimensions");
 
-    // Reduce shape on axis
-    TensorShape sum_shape = input->tensor_shape();
-    sum_shape.set(actual_axis, 1);
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(sum->tensor_shape(), sum_shape);
+    if (sum != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, sum);
+
+        // Reduce shape on axis
+        TensorShape sum_shape = input->tensor_shape();
+        sum_shape.set(actual_axis, 1);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(sum->tensor_shape(), sum_shape);
+    }
 
     if (output->total_size() != 0)
     {
@@ -136,10 +161,17 @@ validate_arguments(const ITensorInfo *input, const ITensorInfo *sum, const ITens
     return Status{};
 }
 
-std::tuple<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output)
+std::tuple<Status, Window>
+validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, unsigned int actual_axis, bool fused)
 {
     Window win = calculate_max_window(*input, Steps());
 
+    // The fused kernels reduce and normalize whole lines along the axis, so the window must not be split along it
+    if (fused)
+    {
+        win.set(actual_axis, Window::Dimension(0, 1, 1));
+    }
+
     // Output auto initialization if not yet initialized
     auto_init_if_empty(*output, input->tensor_shape(), 1, input->data_type());
 
@@ -157,8 +189,9 @@ NEL2NormalizeLayerKernel::NEL2NormalizeLayerKernel()
 void NEL2NormalizeLayerKernel::configure(
     const ITensor *input, const ITensor *sum, ITensor *output, int axis, float epsilon)
 {
-    ARM_COMPUTE_ERROR_ON_NULLPTR(input, sum, output);
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), sum->info(), output->info(), axis, epsilon));
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), sum != nullptr ? sum->info() : nullptr,
+                                                  output->info(), axis, epsilon));
 
     _input       = input;
     _sum         = sum;
@@ -167,7 +200,7 @@ void NEL2NormalizeLayerKernel::configure(
     _epsilon     = epsilon;
 
     // Configure kernel window
-    auto win_config = validate_and_configure_window(_input->info(), _output->info());
+    auto win_config = validate_and_configure_window(_input->info(), _output->info(), _actual_axis, _sum == nullptr);
     ARM_COMPUTE_ERROR_THROW_ON(std::get<0>(win_config));
 
     INEKernel::configure(std::get<1>(win_config));
@@ -177,8 +210,8 @@ Status NEL2NormalizeLayerKernel::validate(
     const ITensorInfo *input, const ITensorInfo *sum, const ITensorInfo *output, int axis, float epsilon)
 {
     ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, sum, output, axis, epsilon));
-    ARM_COMPUTE_RETURN_ON_ERROR(
-        std::get<0>(validate_and_configure_window(input->clone().get(), output->clone().get())));
+    ARM_COMPUTE_RETURN_ON_ERROR(std::get<0>(validate_and_configure_window(
+        input->clone().get(), output->clone().get(), wrap_around(axis, max_input_tensor_dim), sum == nullptr)));
 
     return Status{};
 }
@@ -194,8 +227,8 @@ void NEL2NormalizeLayerKernel::run(const Window &window, const ThreadInfo &info)
         ARM_COMPUTE_ERROR("Unsupported normalization axis");
     }
 
-    const auto *uk = get_implementation(
-        L2NormalizeLayerSelectorData{_output->info()->data_type(), _actual_axis, CPUInfo::get().get_isa()});
+    const auto *uk = get_implementation(L2NormalizeLayerSelectorData{_output->info()->data_type(), _actual_axis,
+                                                                     _sum == nullptr, CPUInfo::get().get_isa()});
     ARM_COMPUTE_ERROR_ON(uk == nullptr);
     ARM_COMPUTE_ERROR_ON(uk->ukernel == nullptr);
 
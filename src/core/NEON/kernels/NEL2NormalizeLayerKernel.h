@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,7 +30,11 @@ namespace arm_compute
 {
 class ITensor;
 
-/** Interface for performing a L2 normalize on a given axis given the square sum of it in this axis */
+/** Interface for performing a L2 normalize on a given axis given the square sum of it in this axis
+ *
+ * When no square sum is given, it is computed by the kernel, each line along the axis being reduced and then
+ * normalized while it is in the cache.
+ */
 class NEL2NormalizeLayerKernel : public INEKernel
 {
 public:
@@ -54,7 +58,8 @@ public:
      *
      * @param[in]  input   Source tensor. Data types supported: F16/F32.
      * @param[in]  sum     Sum values tensor. Data types supported: same as @p input.
-     *                     Sum will have the same number of dimensions as input.
+     *                     Sum will have the same number of dimensions as input. Can be nullptr, in which case the
+     *                     sum is computed by the kernel.
      * @param[out] output  Destination tensor. Data types and data layouts supported: same as @p input.
      *                     Output will have the same number of dimensions as input.
      * @param[in]  axis    Axis along which to reduce. Negative values wrap around. Maximum supported actual reduction axis : 2
@@ -66,7 +71,8 @@ public:
      *
      * @param[in] input   Source tensor info. Data types supported: F16/F32.
      * @param[in] sum     Sum values tensor info. Data types supported: same as @p input.
-     *                    Sum will have the same number of dimensions as input.
+     *                    Sum will have the same number of dimensions as input. Can be nullptr, in which case the
+     *                    sum is computed by the kernel.
      * @param[in] output  Destination tensor info. Data types and data layouts supported: same as @p input.
      *                    Output will have the same number of dimensions as input.
      * @param[in] axis    Axis along which to reduce. Negative values wrap around. Maximum supported actual reduction axis : 2
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NELSTMCellKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/lstm/list.h"
+
+namespace arm_compute
+{
+namespace
+{
+struct LSTMCellSelectorData
+{
+    DataType dt;
+};
+
+using LSTMCellSelectorPtr = std::add_pointer<bool(const LSTMCellSelectorData &data)>::type;
+using LSTMCellUKernelPtr  = std::add_pointer<void(
+    const LSTMCellArguments<ITensor> &tensors, const LSTMCellKernelInfo &info, const Window &window)>::type;
+
+struct LSTMCellKernel
+{
+    const char               *name;
+    const LSTMCellSelectorPtr is_selected;
+    LSTMCellUKernelPtr        ukernel;
+};
+
+static const LSTMCellKernel available_kernels[] = {
+    {"neon_fp32_lstm_cell", [](const LSTMCellSelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_lstm_cell)},
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    {"neon_fp16_lstm_cell", [](const LSTMCellSelectorData &data) { return data.dt == DataType::F16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_lstm_cell)},
+#endif // ARM_COMPUTE_ENABLE_FP16
+};
+
+/** Micro-kernel selector
+ *
+ * @param[in] data Selection data passed to help pick the appropriate micro-kernel
+ *
+ * @return A matching micro-kernel else nullptr
+ */
+const LSTMCellKernel *get_implementation(const LSTMCellSelectorData &data)
+{
+    for (const auto &uk : available_kernels)
+    {
+        if (uk.is_selected(data))
+        {
+            return &uk;
+        }
+    }
+    return nullptr;
+}
+
+bool is_supported_activation(const ActivationLayerInfo &info)
+{
+    switch (info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+        case ActivationLayerInfo::ActivationFunction::TANH:
+        case ActivationLayerInfo::ActivationFunction::RELU:
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+        case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+        case ActivationLayerInfo::ActivationFunction::IDENTITY:
+            return info.enabled();
+        default:
+            return false;
+    }
+}
+
+Status validate_vector(const ITensorInfo *vector, const ITensorInfo *ref, unsigned int num_units)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(vector);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(ref, vector);
+    ARM_COMPUTE_RETURN_ERROR_ON(vector->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(vector->dimension(0) != num_units);
+    return Status{};
+}
+
+Status validate_arguments(const LSTMCellArguments<const ITensorInfo> &tensors, const LSTMCellKernelInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(tensors.gates, tensors.cell_state_in, tensors.cell_state_out,
+                                        tensors.output_state_out);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(tensors.gates);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(tensors.gates, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(tensors.gates, tensors.cell_state_in, tensors.cell_state_out,
+                                                       tensors.output_state_out);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_supported_activation(info.activation_info),
+                                    "Activation function not supported by the LSTM cell");
+
+    const unsigned int num_units = tensors.cell_state_in->dimension(0);
+    const unsigned int num_gates = info.has_cifg_opt ? 3 : 4;
+    const unsigned int batches   = tensors.cell_state_in->dimension(1);
+    ARM_COMPUTE_RETURN_ERROR_ON(tensors.cell_state_in->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(tensors.cell_state_in, tensors.cell_state_out,
+                                                   tensors.output_state_out);
+    ARM_COMPUTE_RETURN_ERROR_ON(tensors.gates->dimension(0) != num_gates * num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(tensors.gates->dimension(1) != batches);
+
+    if (tensors.input_gates != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(tensors.gates, tensors.input_gates);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(tensors.gates, tensors.input_gates);
+    }
+
+    if (tensors.scratch_buffer != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(tensors.gates, tensors.scratch_buffer);
+        ARM_COMPUTE_RETURN_ERROR_ON(tensors.scratch_buffer->dimension(0) != num_gates * num_units);
+        ARM_COMPUTE_RETURN_ERROR_ON(tensors.scratch_buffer->dimension(1) != batches);
+    }
+
+    if (info.has_peephole_opt)
+    {
+        if (!info.has_cifg_opt)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(tensors.cell_to_input_weights, tensors.gates, num_units));
+        }
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(tensors.cell_to_forget_weights, tensors.gates, num_units));
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(tensors.cell_to_output_weights, tensors.gates, num_units));
+    }
+
+    if (info.use_layer_norm)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(info.epsilon <= 0.f);
+        if (!info.has_cifg_opt)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(tensors.input_layer_norm_weights, tensors.gates, num_units));
+            ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(tensors.input_gate_bias, tensors.gates, num_units));
+        }
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(tensors.forget_layer_norm_weights, tensors.gates, num_units));
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(tensors.forget_gate_bias, tensors.gates, num_units));
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(tensors.cell_layer_norm_weights, tensors.gates, num_units));
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(tensors.cell_bias, tensors.gates, num_units));
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(tensors.output_layer_norm_weights, tensors.gates, num_units));
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(tensors.output_gate_bias, tensors.gates, num_units));
+    }
+
+    const auto *uk = get_implementation(LSTMCellSelectorData{tensors.gates->data_type()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+
+const ITensorInfo *info_of(const ITensor *tensor)
+{
+    return tensor == nullptr ? nullptr : tensor->info();
+}
+
+LSTMCellArguments<const ITensorInfo> infos_of(const LSTMCellArguments<ITensor> &tensors)
+{
+    LSTMCellArguments<const ITensorInfo> infos{};
+    infos.gates                     = info_of(tensors.gates);
+    infos.input_gates               = info_of(tensors.input_gates);
+    infos.cell_state_in             = info_of(tensors.cell_state_in);
+    infos.cell_to_input_weights     = info_of(tensors.cell_to_input_weights);
+    infos.cell_to_forget_weights    = info_of(tensors.cell_to_forget_weights);
+    infos.cell_to_output_weights    = info_of(tensors.cell_to_output_weights);
+    infos.input_layer_norm_weights  = info_of(tensors.input_layer_norm_weights);
+    infos.forget_layer_norm_weights = info_of(tensors.forget_layer_norm_weights);
+    infos.cell_layer_norm_weights   = info_of(tensors.cell_layer_norm_weights);
+    infos.output_layer_norm_weights = info_of(tensors.output_layer_norm_weights);
+    infos.input_gate_bias           = info_of(tensors.input_gate_bias);
+    infos.forget_gate_bias          = info_of(tensors.forget_gate_bias);
+    infos.cell_bias                 = info_of(tensors.cell_bias);
+    infos.output_gate_bias          = info_of(tensors.output_gate_bias);
+    infos.cell_state_out            = info_of(tensors.cell_state_out);
+    infos.output_state_out          = info_of(tensors.output_state_out);
+    infos.scratch_buffer            = info_of(tensors.scratch_buffer);
+    return infos;
+}
+} // namespace
+
+void NELSTMCellKernel::configure(const LSTMCellArguments<ITensor> &tensors, const LSTMCellKernelInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(tensors.gates, tensors.cell_state_in, tensors.cell_state_out,
+                                 tensors.output_state_out);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(infos_of(tensors), info));
+
+    const auto *uk = get_implementation(LSTMCellSelectorData{tensors.gates->info()->data_type()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _tensors = tensors;
+    _info    = info;
+    _func    = uk->ukernel;
+
+    // Each row of the batch is processed as a whole by a single thread
+    Window win = calculate_max_window(*tensors.cell_state_out->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    INEKernel::configure(win);
+}
+
+Status NELSTMCellKernel::validate(const LSTMCellArguments<const ITensorInfo> &tensors, const LSTMCellKernelInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(tensors, info));
+    return Status{};
+}
+
+void NELSTMCellKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    _func(_tensors, _info, window);
+}
+} // namespace arm_compute
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NELSTMCELLKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NELSTMCELLKERNEL_H
+
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Tensors read and written by @ref NELSTMCellKernel
+ *
+ * @tparam T Either ITensor or const ITensorInfo
+ */
+template <typename T>
+struct LSTMCellArguments
+{
+    T       *gates{nullptr};                     /**< Pre-activation values of the gates, [num_gates * num_units, batch_size] */
+    const T *input_gates{nullptr};               /**< Precomputed contribution of the input added to @p gates, can be nullptr */
+    const T *cell_state_in{nullptr};             /**< Previous cell state, [num_units, batch_size] */
+    const T *cell_to_input_weights{nullptr};     /**< Peephole weights of the input gate, nullptr without peephole or with CIFG */
+    const T *cell_to_forget_weights{nullptr};    /**< Peephole weights of the forget gate, nullptr without peephole */
+    const T *cell_to_output_weights{nullptr};    /**< Peephole weights of the output gate, nullptr without peephole */
+    const T *input_layer_norm_weights{nullptr};  /**< Layer normalization weights of the input gate */
+    const T *forget_layer_norm_weights{nullptr}; /**< Layer normalization weights of the forget gate */
+    const T *cell_layer_norm_weights{nullptr};   /**< Layer normalization weights of the cell gate */
+    const T *output_layer_norm_weights{nullptr}; /**< Layer normalization weights of the output gate */
+    const T *input_gate_bias{nullptr};           /**< Input gate bias, only added here with layer normalization */
+    const T *forget_gate_bias{nullptr};          /**< Forget gate bias, only added here with layer normalization */
+    const T *cell_bias{nullptr};                 /**< Cell gate bias, only added here with layer normalization */
+    const T *output_gate_bias{nullptr};          /**< Output gate bias, only added here with layer normalization */
+    T       *cell_state_out{nullptr};            /**< New cell state, [num_units, batch_size] */
+    T       *output_state_out{nullptr};          /**< New output state before the projection, [num_units, batch_size] */
+    T       *scratch_buffer{nullptr};            /**< Activated gates and new cell state, [num_gates * num_units, batch_size], can be nullptr */
+};
+
+/** Descriptor of the elementwise part of an LSTM cell */
+struct LSTMCellKernelInfo
+{
+    ActivationLayerInfo activation_info{};       /**< Activation of the cell gate and of the new cell state */
+    float               cell_threshold{0.f};     /**< Clipping threshold of the cell state, 0 disables the clipping */
+    float               epsilon{1e-8f};          /**< Epsilon of the layer normalization */
+    bool                has_cifg_opt{false};     /**< The input gate is 1 - forget gate and is not part of @p gates */
+    bool                has_peephole_opt{false}; /**< The gates read the cell state through the peephole weights */
+    bool                use_layer_norm{false};   /**< The gates are layer normalized before their bias is added */
+};
+
+/** Kernel computing every elementwise step of an LSTM cell from the output of the concatenated gate GEMM
+ *
+ * The gates are laid out along X as [input, forget, cell, output], without the input gate with CIFG.
+ * Each row adds the peepholes, normalizes the gates, applies the gate activations, then computes the new cell
+ * state and the output state, writing the activated gates to the scratch buffer as it goes. The values of a row
+ * never leave the registers between the steps, except the gates that need a whole row for their layer normalization.
+ */
+class NELSTMCellKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NELSTMCellKernel";
+    }
+    /** Default constructor */
+    NELSTMCellKernel() = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMCellKernel(const NELSTMCellKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMCellKernel &operator=(const NELSTMCellKernel &) = delete;
+    /** Default Move Constructor. */
+    NELSTMCellKernel(NELSTMCellKernel &&) = default;
+    /** Default move assignment operator */
+    NELSTMCellKernel &operator=(NELSTMCellKernel &&) = default;
+    /** Default destructor */
+    ~NELSTMCellKernel() = default;
+
+    /** Set the tensors of the cell.
+     *
+     * @note @p cell_state_out can be the same tensor as @p cell_state_in.
+     * @note With layer normalization the peephole contributions are accumulated into @p gates in place.
+     *
+     * @param[in, out] tensors Tensors of the cell. Data types supported: F16/F32, all the same.
+     * @param[in]      info    Kernel meta-data descriptor. The supported activations are LOGISTIC, TANH, RELU,
+     *                         BOUNDED_RELU, LU_BOUNDED_RELU and IDENTITY.
+     */
+    void configure(const LSTMCellArguments<ITensor> &tensors, const LSTMCellKernelInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NELSTMCellKernel
+     *
+     * @param[in] tensors Tensor infos of the cell. Data types supported: F16/F32, all the same.
+     * @param[in] info    Kernel meta-data descriptor.
+     *
+     * @return a status
+     */
+    static Status validate(const LSTMCellArguments<const ITensorInfo> &tensors, const LSTMCellKernelInfo &info);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    using LSTMCellFunction = void(const LSTMCellArguments<ITensor> &tensors,
+                                  const LSTMCellKernelInfo         &info,
+                                  const Window                     &window);
+
+    LSTMCellArguments<ITensor> _tensors{};
+    LSTMCellKernelInfo         _info{};
+    LSTMCellFunction          *_func{nullptr};
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NELSTMCELLKERNEL_H
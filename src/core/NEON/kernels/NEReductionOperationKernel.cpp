@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -82,6 +82,9 @@ void NEReductionOperationKernel::reduce_op()
         return;
     }
 
+    // Arg min/max along X have their own kernels tracking the index of each lane alongside its extremum
+    const bool is_arg_min_max = (_op == ReductionOperation::ARG_IDX_MIN || _op == ReductionOperation::ARG_IDX_MAX);
+
     switch (_reduction_axis)
     {
         case 0:
@@ -90,29 +93,34 @@ void NEReductionOperationKernel::reduce_op()
             {
                 case DataType::QASYMM8:
                 {
-                    _func = REGISTER_QASYMM8_NEON(cpu::reduce_RedOpX_reduceX_qasymm8);
+                    _func = is_arg_min_max ? REGISTER_QASYMM8_NEON(cpu::reduce_ArgMinMaxX_qasymm8)
+                                           : REGISTER_QASYMM8_NEON(cpu::reduce_RedOpX_reduceX_qasymm8);
                     break;
                 }
                 case DataType::QASYMM8_SIGNED:
                 {
-                    _func = REGISTER_QASYMM8_SIGNED_NEON(cpu::reduce_RedOpX_reduceX_qasymm8_signed);
+                    _func = is_arg_min_max ? REGISTER_QASYMM8_SIGNED_NEON(cpu::reduce_ArgMinMaxX_qasymm8_signed)
+                                           : REGISTER_QASYMM8_SIGNED_NEON(cpu::reduce_RedOpX_reduceX_qasymm8_signed);
                     break;
                 }
 #ifdef ARM_COMPUTE_ENABLE_FP16
                 case DataType::F16:
                 {
-                    _func = REGISTER_FP16_NEON(cpu::reduce_RedOpX_reduceX_float16_8);
+                    _func = is_arg_min_max ? REGISTER_FP16_NEON(cpu::reduce_ArgMinMaxX_float16_8)
+                                           : REGISTER_FP16_NEON(cpu::reduce_RedOpX_reduceX_float16_8);
                     break;
                 }
 #endif // ARM_COMPUTE_ENABLE_FP16
                 case DataType::F32:
                 {
-                    _func = REGISTER_FP32_NEON(cpu::reduce_RedOpX_reduceX_float32_4);
+                    _func = is_arg_min_max ? REGISTER_FP32_NEON(cpu::reduce_ArgMinMaxX_float32_4)
+                                           : REGISTER_FP32_NEON(cpu::reduce_RedOpX_reduceX_float32_4);
                     break;
                 }
                 case DataType::S32:
                 {
-                    _func = REGISTER_INTEGER_NEON(cpu::reduce_RedOpX_reduceX_S32_4);
+                    _func = is_arg_min_max ? REGISTER_INTEGER_NEON(cpu::reduce_ArgMinMaxX_S32_4)
+                                           : REGISTER_INTEGER_NEON(cpu::reduce_RedOpX_reduceX_S32_4);
                     break;
                 }
                 default:
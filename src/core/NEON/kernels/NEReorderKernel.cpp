@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,7 @@
 #include "src/common/utils/Log.h"
 #include "src/core/NEON/kernels/arm_gemm/transform.hpp"
 
+#include <algorithm>
 #include <map>
 
 namespace arm_compute
@@ -92,6 +93,124 @@ inline int get_sve_interleave_by(int interleave_by, int block_by)
 }
 #endif // ARM_COMPUTE_ENABLE_SVE
 
+template <typename TOut>
+using TransformFunc = void (*)(TOut *, const float *, int, int, int, int, int);
+
+// Return the arm_gemm transform matching the parameters, nullptr if there is none
+template <typename TOut>
+TransformFunc<TOut> find_transform(const std::map<TransformParams, TransformFunc<TOut>> &transforms,
+                                   int                                                   interleave_by,
+                                   int                                                   block_by,
+                                   bool                                                  transpose)
+{
+#ifdef ARM_COMPUTE_ENABLE_SVE
+    // The SVE transforms interleave by a multiple of the vector length, which has to match the requested one exactly
+    const int vl_by_block = CPUInfo::get().has_sve() ? static_cast<int>(get_vector_length<TOut>()) / block_by : 0;
+    if (vl_by_block > 0 && interleave_by % vl_by_block == 0)
+    {
+        const auto it = transforms.find(
+            {get_sve_interleave_by<TOut>(interleave_by, block_by), block_by, transpose, arm_gemm::VLType::SVE});
+        if (it != transforms.end())
+        {
+            return it->second;
+        }
+    }
+#endif // ARM_COMPUTE_ENABLE_SVE
+    const auto it = transforms.find({interleave_by, block_by, transpose, arm_gemm::VLType::None});
+    return it != transforms.end() ? it->second : nullptr;
+}
+
+// Portable version of arm_gemm's TransformImpl for the formats without a specialised transform: rows
+// [k0, kmax) are written in panels of interleave_by rows, each panel being made of interleave_by x block_by
+// tiles, one per block_by columns in [x0, xmax). Rows and columns out of the input are zero padded.
+template <typename TOut>
+void transform_generic(TOut        *out,
+                       const float *in,
+                       int          stride,
+                       int          k0,
+                       int          kmax,
+                       int          x0,
+                       int          xmax,
+                       int          interleave_by,
+                       int          block_by,
+                       bool         transpose)
+{
+    const TOut zero = static_cast<TOut>(0.f);
+    for (int k = k0; k < kmax; k += interleave_by)
+    {
+        for (int x = x0; x < xmax; x += block_by)
+        {
+            for (int kb = 0; kb < interleave_by; ++kb)
+            {
+                const int row = k + kb;
+                for (int xb = 0; xb < block_by; ++xb)
+                {
+                    const int col = x + xb;
+                    if (row >= kmax || col >= xmax)
+                    {
+                        *out++ = zero;
+                    }
+                    else
+                    {
+                        *out++ =
+                            static_cast<TOut>(transpose ? in[col * stride + row] : in[row * stride + col]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Reorder the panels of rows and the columns covered by the window. The window runs along the panels of
+// interleave_by rows in dimension X and along the columns, by block_by, in dimension Y.
+template <typename TOut>
+void reorder_window(TransformFunc<TOut> transform_func,
+                    TOut               *out,
+                    const float        *in,
+                    const Window       &window,
+                    int                 kmax,
+                    int                 xmax,
+                    int                 interleave_by,
+                    int                 block_by,
+                    bool                transpose)
+{
+    const int k_start = window.x().start() * interleave_by;
+    const int k_end   = std::min(window.x().end() * interleave_by, kmax);
+    const int x_start = window.y().start();
+    const int x_end   = std::min(window.y().end(), xmax);
+    const int stride  = transpose ? kmax : xmax;
+
+    if (k_start >= k_end || x_start >= x_end)
+    {
+        return;
+    }
+
+    const auto transform = [&](TOut *out_ptr, int k0, int k1)
+    {
+        if (transform_func != nullptr)
+        {
+            transform_func(out_ptr, in, stride, k0, k1, x_start, x_end);
+        }
+        else
+        {
+            transform_generic(out_ptr, in, stride, k0, k1, x_start, x_end, interleave_by, block_by, transpose);
+        }
+    };
+
+    if (x_start == 0 && x_end == xmax)
+    {
+        // Full panels are contiguous in the output, they are reordered with a single call
+        transform(out + k_start * xmax, k_start, k_end);
+    }
+    else
+    {
+        // Each panel only gets the tiles of the columns in the window
+        for (int k = k_start; k < k_end; k += interleave_by)
+        {
+            transform(out + k * xmax + x_start * interleave_by, k, std::min(k + interleave_by, k_end));
+        }
+    }
+}
 } // namespace
 
 void NEReorderKernel::run(const Window &window, const ThreadInfo &info)
@@ -100,64 +219,26 @@ void NEReorderKernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON_MSG(_input->info()->data_type() != DataType::F32, "Unsupported input data type");
-    const int ksize_rows_elements = _xmax * _ksize;
-    const int jump_rows           = ksize_rows_elements * window.x().start();
-    const int k_start             = window.x().start() * _ksize;
-    const int k_end               = std::min(window.x().end() * _ksize, _kmax);
-    const int stride              = _transpose ? _kmax : _xmax;
-    const int block_by            = arm_compute::block_by(_output_wf);
-    const int interleave_by       = arm_compute::interleave_by(_output_wf);
-    ARM_COMPUTE_ERROR_ON(interleave_by != 4 && interleave_by != 8);
-
-    if (k_start >= k_end)
-        return;
+    const int    block_by      = arm_compute::block_by(_output_wf);
+    const int    interleave_by = arm_compute::interleave_by(_output_wf);
+    const float *in            = reinterpret_cast<const float *>(_input->buffer());
 
     switch (_output->info()->data_type())
     {
         case DataType::F32:
         {
-            void (*transform_func)(float *, const float *, int, int, int, int, int) = nullptr;
-#ifdef ARM_COMPUTE_ENABLE_SVE
-            if (CPUInfo::get().has_sve())
-            {
-                TransformParams tparams = {get_sve_interleave_by<float>(interleave_by, block_by), block_by, _transpose,
-                                           arm_gemm::VLType::SVE};
-                if (supported_float_transforms.count(tparams))
-                {
-                    transform_func = supported_float_transforms[tparams];
-                }
-            }
-#endif // ARM_COMPUTE_ENABLE_SVE
-            if (transform_func == nullptr)
-            {
-                transform_func =
-                    supported_float_transforms[{interleave_by, block_by, _transpose, arm_gemm::VLType::None}];
-            }
-            transform_func(reinterpret_cast<float *>(_output->buffer()) + jump_rows,
-                           reinterpret_cast<float *>(_input->buffer()), stride, k_start, k_end, 0, _xmax);
+            reorder_window(find_transform(supported_float_transforms, interleave_by, block_by, _transpose),
+                           reinterpret_cast<float *>(_output->buffer()), in, window, _kmax, _xmax, interleave_by,
+                           block_by, _transpose);
             break;
         }
         case DataType::BFLOAT16:
         {
             if (CPUInfo::get().has_bf16())
             {
-                void (*transform_func)(bfloat16 *, const float *, int, int, int, int, int) = nullptr;
-#ifdef ARM_COMPUTE_ENABLE_SVE
-                if (CPUInfo::get().has_sve())
-                {
-                    TransformParams tparams = {get_sve_interleave_by<bfloat16>(interleave_by, block_by), block_by,
-                                               _transpose, arm_gemm::VLType::SVE};
-                    if (supported_bf16_transforms.count(tparams))
-                        transform_func = supported_bf16_transforms[tparams];
-                }
-#endif // ARM_COMPUTE_ENABLE_SVE
-                if (transform_func == nullptr)
-                {
-                    transform_func =
-                        supported_bf16_transforms[{interleave_by, block_by, _transpose, arm_gemm::VLType::None}];
-                }
-                transform_func(reinterpret_cast<bfloat16 *>(_output->buffer()) + jump_rows,
-                               reinterpret_cast<float *>(_input->buffer()), stride, k_start, k_end, 0, _xmax);
+                reorder_window(find_transform(supported_bf16_transforms, interleave_by, block_by, _transpose),
+                               reinterpret_cast<bfloat16 *>(_output->buffer()), in, window, _kmax, _xmax,
+                               interleave_by, block_by, _transpose);
                 break;
             }
             ARM_COMPUTE_ERROR("Trying to run BF16 on unsupported machine\n");
@@ -222,18 +303,13 @@ void NEReorderKernel::configure(const ITensor            *input,
     }
 
     // Configure kernel window
-    // Window size is set by rows / _ksize
+    // Window size is set by rows / _ksize along X and by the columns, in steps of the block size, along Y
     Window win;
-    int    window_size = 0;
-    ARM_COMPUTE_ERROR_ON(arm_compute::interleave_by(_output_wf) != 4 && arm_compute::interleave_by(_output_wf) != 8);
-    _ksize      = arm_compute::interleave_by(_output_wf);
-    window_size = _kmax / _ksize;
-    if (_kmax % _ksize != 0)
-    {
-        window_size += 1;
-    }
+    _ksize                = arm_compute::interleave_by(_output_wf);
+    const int window_size = DIV_CEIL(_kmax, _ksize);
 
     win.set(Window::DimX, Window::Dimension(0, window_size, 1));
+    win.set(Window::DimY, Window::Dimension(0, _xmax, arm_compute::block_by(_output_wf)));
 
     INEKernel::configure(win);
 }
@@ -283,7 +359,7 @@ Status NEReorderKernel::validate(const ITensorInfo        *input,
     int ksize         = 0;
     int interleave_by = arm_compute::interleave_by(output_wf);
     int block_by      = arm_compute::block_by(output_wf);
-    ARM_COMPUTE_RETURN_ERROR_ON(interleave_by != 4 && interleave_by != 8);
+    ARM_COMPUTE_RETURN_ERROR_ON(interleave_by < 1 || block_by < 1);
     ksize = interleave_by;
 
     // output x_dim needs to be same as input but multiple of block_by
@@ -295,39 +371,9 @@ Status NEReorderKernel::validate(const ITensorInfo        *input,
     // output x_dim needs to be same as input
     ARM_COMPUTE_RETURN_ERROR_ON(input_x_dim != output_x_dim);
 
-    switch (output->data_type())
-    {
-        case DataType::F32:
-        {
-#ifdef ARM_COMPUTE_ENABLE_SVE
-            if (CPUInfo::get().has_sve() &&
-                supported_float_transforms.count({get_sve_interleave_by<float>(interleave_by, block_by), block_by,
-                                                  transpose, arm_gemm::VLType::SVE}))
-                break;
-#endif // ARM_COMPUTE_ENABLE_SVE
-            ARM_COMPUTE_RETURN_ERROR_ON(
-                !supported_float_transforms.count({interleave_by, block_by, transpose, arm_gemm::VLType::None}));
-            break;
-        }
-        case DataType::BFLOAT16:
-        {
-            ARM_COMPUTE_RETURN_ERROR_ON(!CPUInfo::get().has_bf16());
-#ifdef ARM_COMPUTE_ENABLE_SVE
-            if (CPUInfo::get().has_sve() &&
-                supported_bf16_transforms.count({get_sve_interleave_by<bfloat16>(interleave_by, block_by), block_by,
-                                                 transpose, arm_gemm::VLType::SVE}))
-                break;
-#endif // ARM_COMPUTE_ENABLE_SVE
-            ARM_COMPUTE_RETURN_ERROR_ON(
-                !supported_bf16_transforms.count({interleave_by, block_by, transpose, arm_gemm::VLType::None}));
-            break;
-        }
-        default:
-        {
-            ARM_COMPUTE_RETURN_ERROR_MSG("Unsupported output data type");
-            break;
-        }
-    }
+    // Every format is supported, the ones without a specialised arm_gemm transform being reordered by the generic one
+    ARM_COMPUTE_UNUSED(transpose);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->data_type() == DataType::BFLOAT16 && !CPUInfo::get().has_bf16());
     return Status{};
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025 Arm Limited.
+ * Copyright (c) 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,7 +34,12 @@
 namespace arm_compute
 {
 
-/** Interface kernel to reorder tensor into blocked format. */
+/** Interface kernel to reorder tensor into blocked format.
+ *
+ * Any fixed WeightFormat of arm_gemm can be produced: the formats with a specialised arm_gemm transform use it,
+ * the other ones are reordered by a generic one. The window runs along the panels of rows in dimension X and
+ * along the columns, by the block size of the output format, in dimension Y.
+ */
 class NEReorderKernel : public INEKernel
 {
 public:
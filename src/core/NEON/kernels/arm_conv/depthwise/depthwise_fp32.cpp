@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -68,6 +68,8 @@
 #include "kernels/a64_fp32_nhwc_3x3_s1_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_fp32_nhwc_3x3_s2_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_fp32_nhwc_5x5_s1_output2x2_mla_depthfirst.hpp"
+#include "kernels/a64_fp32_nhwc_5x5_s2_output2x2_mla_depthfirst.hpp"
+#include "kernels/a64_fp32_nhwc_7x7_s1_output2x2_mla_depthfirst.hpp"
 #include "kernels/a64_fp32_nhwc_generic_output9_mla_depthfirst.hpp"
 #include "kernels/a64_fp32_packed_to_nhwc_3x3_s2_with_multiplier_output3x3_mla_depthfirst.hpp"
 #include "kernels/a64_fp32_packed_to_nhwc_5x5_s1_with_multiplier_output2x4_mla_depthfirst.hpp"
@@ -96,6 +98,10 @@ namespace
     {
       threshold = 5;
     }
+    else if (args.stride_rows == 1 && args.kernel_rows == 7)
+    {
+      threshold = 8;
+    }
     else if (args.stride_rows == 2 && args.kernel_rows == 3)
     {
       threshold = 5;
@@ -478,6 +484,26 @@ static const DepthwiseImplementation<float, float> depthwise_fp32_methods[] = {
       return new DepthwiseDepthfirst<float>(strat, args);
     },
   },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "a64_fp32_nhwc_5x5_s2_output2x2_mla_depthfirst",
+    constraint(is_supported<a64_fp32_nhwc_5x5_s2_output2x2_mla_depthfirst>),
+    cycle_estimate<a64_fp32_nhwc_5x5_s2_output2x2_mla_depthfirst>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<float, float, float> * {
+      auto strat = new a64_fp32_nhwc_5x5_s2_output2x2_mla_depthfirst(args.cpu_info);
+      return new DepthwiseDepthfirst<float>(strat, args);
+    },
+  },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "a64_fp32_nhwc_7x7_s1_output2x2_mla_depthfirst",
+    constraint(is_supported<a64_fp32_nhwc_7x7_s1_output2x2_mla_depthfirst>),
+    cycle_estimate<a64_fp32_nhwc_7x7_s1_output2x2_mla_depthfirst>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<float, float, float> * {
+      auto strat = new a64_fp32_nhwc_7x7_s1_output2x2_mla_depthfirst(args.cpu_info);
+      return new DepthwiseDepthfirst<float>(strat, args);
+    },
+  },
   {
     DepthwiseMethod::DEPTHFIRST,
     "a64_fp32_nhwc_generic_output3x3_mla_depthfirst",
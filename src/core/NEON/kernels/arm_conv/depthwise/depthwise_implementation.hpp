@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 #pragma once
 
 #include "depthwise.hpp"
+#include "implementation_cache.hpp"
 
 #include <cstddef>
 #include <functional>
@@ -67,8 +68,22 @@ struct DepthwiseImplementation
 template <typename TInput, typename TWeight = TInput, typename TOutput = TInput, class OutputStage = Nothing>
 const DepthwiseImplementation<TInput, TWeight, TOutput, OutputStage> *depthwise_implementation_list();
 
+inline arm_gemm::SelectionKey &add_selection_args(arm_gemm::SelectionKey &key, const DepthwiseArgs &args)
+{
+  key.add(args.cpu_info).add(args.kernel_rows).add(args.kernel_cols).add(args.stride_rows).add(args.stride_cols);
+  key.add(args.dilation_rows).add(args.dilation_cols).add(args.n_batches).add(args.input_rows).add(args.input_cols);
+  key.add(args.input_channels).add(args.output_rows).add(args.output_cols).add(args.channel_multiplier);
+  key.add(args.padding.left).add(args.padding.top).add(args.padding.right).add(args.padding.bottom);
+  key.add(args.activation).add(args.fast_mode).add(args.config != nullptr);
+  if (args.config != nullptr)
+  {
+    key.add(args.config->method).add(args.config->filter);
+  }
+  return key;
+}
+
 template <typename TInput, typename TWeight = TInput, typename TOutput = TInput, class OutputStage = Nothing>
-bool find_implementation(
+bool select_implementation(
   const DepthwiseArgs &args,
   const OutputStage &os,
   const DepthwiseImplementation<TInput, TWeight, TOutput, OutputStage> * &selected
@@ -110,6 +125,28 @@ bool find_implementation(
   return (selected != nullptr);
 }
 
+/**
+ * Same as select_implementation(), the selection of each problem being cached
+ * so that operators configured for the same problem only make it once.
+ */
+template <typename TInput, typename TWeight = TInput, typename TOutput = TInput, class OutputStage = Nothing>
+bool find_implementation(
+  const DepthwiseArgs &args,
+  const OutputStage &os,
+  const DepthwiseImplementation<TInput, TWeight, TOutput, OutputStage> * &selected
+)
+{
+  using Implementation = DepthwiseImplementation<TInput, TWeight, TOutput, OutputStage>;
+
+  selected = nullptr;
+  arm_gemm::SelectionKey key;
+  add_selection_args(add_selection_args(key, args), os);
+  return arm_gemm::ImplementationCache<Implementation>::get().find_or_select(
+    key, selected,
+    [&](const Implementation * &impl) { return select_implementation<TInput, TWeight, TOutput, OutputStage>(args, os, impl); }
+  );
+}
+
 template <typename TInput, typename TWeight, typename TOutput, class OutputStage>
 std::vector<KernelDescription> get_compatible_kernels(const DepthwiseArgs &args, const OutputStage &os)
 {
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <arm_neon.h>
+
+#include <cstdint>
+
+#if defined(__aarch64__)
+
+namespace arm_conv {
+namespace depthwise {
+namespace intrinsics {
+
+/* Vector operations used by the depthfirst kernels below, for each of the
+ * supported element types.
+ */
+template <typename T>
+struct MlaVector;
+
+template <>
+struct MlaVector<float>
+{
+  using Type = float32x4_t;
+  constexpr static unsigned int lanes = 4;
+
+  static inline Type dup(const float value) { return vdupq_n_f32(value); }
+  static inline Type load(const float *ptr) { return vld1q_f32(ptr); }
+  static inline void store(float *ptr, const Type &value) { vst1q_f32(ptr, value); }
+  static inline Type mla(const Type &acc, const Type &a, const Type &b) { return vfmaq_f32(acc, a, b); }
+  static inline Type clamp(const Type &value, const Type &min, const Type &max)
+  {
+    return vminq_f32(vmaxq_f32(value, min), max);
+  }
+};
+
+#if defined(__ARM_FP16_ARGS) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+template <>
+struct MlaVector<__fp16>
+{
+  using Type = float16x8_t;
+  constexpr static unsigned int lanes = 8;
+
+  static inline Type dup(const __fp16 value) { return vdupq_n_f16(value); }
+  static inline Type load(const __fp16 *ptr) { return vld1q_f16(ptr); }
+  static inline void store(__fp16 *ptr, const Type &value) { vst1q_f16(ptr, value); }
+  static inline Type mla(const Type &acc, const Type &a, const Type &b) { return vfmaq_f16(acc, a, b); }
+  static inline Type clamp(const Type &value, const Type &min, const Type &max)
+  {
+    return vminq_f16(vmaxq_f16(value, min), max);
+  }
+};
+#endif  // defined(__ARM_FP16_ARGS) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+
+/* Depthfirst multiply-accumulate kernel for a fixed kernel size, stride and
+ * output tile, written with intrinsics for the shapes which have no dedicated
+ * assembly kernel.
+ *
+ * The parameters are packed by the generic interleave: for each vector of
+ * channels, a vector of biases followed by a vector of weights for each point
+ * of the kernel in row-major order, the last vector being padded.
+ */
+template <typename T,
+          unsigned int KernelRows, unsigned int KernelCols,
+          unsigned int StrideRows, unsigned int StrideCols,
+          unsigned int OutputRows, unsigned int OutputCols>
+struct DepthfirstMlaKernel
+{
+  constexpr static unsigned int input_rows = (OutputRows - 1) * StrideRows + KernelRows;
+  constexpr static unsigned int input_cols = (OutputCols - 1) * StrideCols + KernelCols;
+  constexpr static unsigned int n_params = 1 + KernelRows * KernelCols;  // Bias and weights
+
+  static void indirect(
+    const T *const *const input_ptrs,
+    T *const *const outptrs,
+    const void *params,
+    unsigned int n_channels,
+    const T activation_min,
+    const T activation_max
+  )
+  {
+    using V = MlaVector<T>;
+    constexpr unsigned int vl = V::lanes;
+
+    const auto vmin = V::dup(activation_min);
+    const auto vmax = V::dup(activation_max);
+    auto weights = static_cast<const T *>(params);
+
+    unsigned int c = 0;
+    for (; c + vl <= n_channels; c += vl, weights += n_params * vl)
+    {
+      typename V::Type acc[OutputRows * OutputCols];
+      for (unsigned int o = 0; o < OutputRows * OutputCols; o++)
+      {
+        acc[o] = V::load(weights);
+      }
+
+      for (unsigned int ki = 0; ki < KernelRows; ki++)
+      {
+        for (unsigned int kj = 0; kj < KernelCols; kj++)
+        {
+          const auto w = V::load(weights + (1 + ki * KernelCols + kj) * vl);
+          for (unsigned int oi = 0; oi < OutputRows; oi++)
+          {
+            for (unsigned int oj = 0; oj < OutputCols; oj++)
+            {
+              const T *inptr = input_ptrs[(oi * StrideRows + ki) * input_cols + oj * StrideCols + kj];
+              acc[oi * OutputCols + oj] = V::mla(acc[oi * OutputCols + oj], V::load(inptr + c), w);
+            }
+          }
+        }
+      }
+
+      for (unsigned int o = 0; o < OutputRows * OutputCols; o++)
+      {
+        V::store(outptrs[o] + c, V::clamp(acc[o], vmin, vmax));
+      }
+    }
+
+    // Left-over channels, from the padded vector of parameters
+    for (unsigned int l = 0; c + l < n_channels; l++)
+    {
+      for (unsigned int oi = 0; oi < OutputRows; oi++)
+      {
+        for (unsigned int oj = 0; oj < OutputCols; oj++)
+        {
+          T acc = weights[l];
+          for (unsigned int ki = 0; ki < KernelRows; ki++)
+          {
+            for (unsigned int kj = 0; kj < KernelCols; kj++)
+            {
+              const T *inptr = input_ptrs[(oi * StrideRows + ki) * input_cols + oj * StrideCols + kj];
+              acc += inptr[c + l] * weights[(1 + ki * KernelCols + kj) * vl + l];
+            }
+          }
+          acc = acc < activation_min ? activation_min : acc;
+          acc = acc > activation_max ? activation_max : acc;
+          outptrs[oi * OutputCols + oj][c + l] = acc;
+        }
+      }
+    }
+  }
+
+  static void direct(
+    const unsigned int n_tile_rows,
+    const unsigned int n_tile_cols,
+    const T *inptr,
+    int64_t ld_input_row,
+    int64_t ld_input_col,
+    T *outptr,
+    int64_t ld_output_row,
+    int64_t ld_output_col,
+    const void *params,
+    unsigned int n_channels,
+    const T activation_min,
+    const T activation_max
+  )
+  {
+    const T *input_ptrs[input_rows * input_cols];
+    T *outptrs[OutputRows * OutputCols];
+
+    for (unsigned int tile_i = 0; tile_i < n_tile_rows; tile_i++)
+    {
+      for (unsigned int tile_j = 0; tile_j < n_tile_cols; tile_j++)
+      {
+        const T *tile_inptr = inptr + tile_i * OutputRows * StrideRows * ld_input_row +
+                              tile_j * OutputCols * StrideCols * ld_input_col;
+        T *tile_outptr = outptr + tile_i * OutputRows * ld_output_row + tile_j * OutputCols * ld_output_col;
+
+        for (unsigned int i = 0; i < input_rows; i++)
+        {
+          for (unsigned int j = 0; j < input_cols; j++)
+          {
+            input_ptrs[i * input_cols + j] = tile_inptr + i * ld_input_row + j * ld_input_col;
+          }
+        }
+        for (unsigned int i = 0; i < OutputRows; i++)
+        {
+          for (unsigned int j = 0; j < OutputCols; j++)
+          {
+            outptrs[i * OutputCols + j] = tile_outptr + i * ld_output_row + j * ld_output_col;
+          }
+        }
+
+        indirect(input_ptrs, outptrs, params, n_channels, activation_min, activation_max);
+      }
+    }
+  }
+};
+
+}  // namespace intrinsics
+}  // namespace depthwise
+}  // namespace arm_conv
+
+#endif  // defined(__aarch64__)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #pragma once
 
+#include "implementation_cache.hpp"
 #include "pooling.hpp"
 
 #include <cstddef>
@@ -63,8 +64,33 @@ struct PoolingImplementation
 template <typename TInput, typename TOutput, class OutputStage = Nothing>
 const PoolingImplementation<TInput, TOutput, OutputStage> *pooling_implementation_list();
 
+inline arm_gemm::SelectionKey &add_selection_args(arm_gemm::SelectionKey &key, const PoolingArgs &args)
+{
+  key.add(args.cpu_info).add(args.pool_type).add(args.pool_window.rows).add(args.pool_window.cols);
+  key.add(args.pool_stride.rows).add(args.pool_stride.cols).add(args.exclude_padding).add(args.n_batches);
+  key.add(args.input_rows).add(args.input_cols).add(args.n_channels).add(args.output_rows).add(args.output_cols);
+  key.add(args.padding.left).add(args.padding.top).add(args.padding.right).add(args.padding.bottom);
+  key.add(args.config != nullptr);
+  if (args.config != nullptr)
+  {
+    key.add(args.config->method).add(args.config->filter);
+  }
+  return key;
+}
+
+inline arm_gemm::SelectionKey &add_selection_args(arm_gemm::SelectionKey &key, const Nothing &)
+{
+  return key;
+}
+
+inline arm_gemm::SelectionKey &add_selection_args(arm_gemm::SelectionKey &key, const Requantize32 &os)
+{
+  return key.add(os.input_offset).add(os.output_offset).add(os.per_layer_left_shift).add(os.per_layer_right_shift)
+            .add(os.per_layer_mul);
+}
+
 template <typename TInput, typename TOutput, class OutputStage = Nothing>
-bool find_implementation(
+bool select_implementation(
   const PoolingArgs &args,
   const OutputStage &os,
   const PoolingImplementation<TInput, TOutput, OutputStage> * &selected
@@ -94,6 +120,27 @@ bool find_implementation(
   return false;
 }
 
+/**
+ * Same as select_implementation(), the selection of each problem being cached
+ * so that operators configured for the same problem only make it once.
+ */
+template <typename TInput, typename TOutput, class OutputStage = Nothing>
+bool find_implementation(
+  const PoolingArgs &args,
+  const OutputStage &os,
+  const PoolingImplementation<TInput, TOutput, OutputStage> * &selected
+)
+{
+  using Implementation = PoolingImplementation<TInput, TOutput, OutputStage>;
+
+  arm_gemm::SelectionKey key;
+  add_selection_args(add_selection_args(key, args), os);
+  return arm_gemm::ImplementationCache<Implementation>::get().find_or_select(
+    key, selected,
+    [&](const Implementation * &impl) { return select_implementation<TInput, TOutput, OutputStage>(args, os, impl); }
+  );
+}
+
 template <typename TInput, typename TOutput, class OutputStage>
 UniquePoolingCommon<TInput, TOutput> pooling(const PoolingArgs &args, const OutputStage &os)
 {
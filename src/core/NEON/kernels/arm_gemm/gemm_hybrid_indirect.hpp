@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -764,7 +764,7 @@ public:
     // parameters - it's arbitrary but usually either the input or output type.
     template <typename perf_type>
     static uint64_t estimate_cycles(const GemmArgs &args, const OutputStage &os = {}) {
-        const PerformanceParameters params = strategy::template get_performance_parameters<perf_type>(args._ci);
+        const PerformanceParameters params = get_performance_parameters<strategy, perf_type>(args._ci);
 
         // Note: Current hybrid kernels don't actually round up height (they
         // have paths for each possible height).  Might need to make this
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -275,28 +275,48 @@ public:
         }
     }
 
+    // One unit of work per (multi, K block, N block).
+    size_t get_B_pretranspose_window_size() const override {
+        return _nmulti * iceildiv(_Ksize, _k_block) * iceildiv(_Nsize, _n_block);
+    }
+
     void pretranspose_B_array(void *in_buffer, const To *B, const int ldb, const int B_multi_stride, bool transposed) override {
+        pretranspose_B_array_part(in_buffer, B, ldb, B_multi_stride, transposed, 0, get_B_pretranspose_window_size());
+    }
+
+    void pretranspose_B_array_part(void *in_buffer, const To *B, const int ldb, const int B_multi_stride, bool transposed, size_t start, size_t end) override {
         assert(!transposed);
 
-        requantize_bias(in_buffer, B, ldb, B_multi_stride);
+        // Perform column sums as part of the last block.
+        if (end >= get_B_pretranspose_window_size()) {
+            requantize_bias(in_buffer, B, ldb, B_multi_stride);
+        }
 
         uintptr_t buffer_int = reinterpret_cast<uintptr_t>(in_buffer);
         Toi *buffer = reinterpret_cast<Toi *>(buffer_int + get_col_sum_size());
         _B_transposed = buffer;
         strategy strat(_ci);
 
+        // Blocks are laid out in window order, walk over the ones before start to find where ours go.
+        size_t block = 0;
         for (unsigned int multi=0; multi<_nmulti; multi++) {
             for (unsigned int k0=0; k0<_Ksize; k0+=_k_block) {
                 const unsigned int kmax = std::min(k0 + _k_block, _Ksize);
                 const unsigned int k_size = roundup(kmax-k0, strategy::k_unroll());
 
-                for (unsigned int x0=0; x0<_Nsize; x0+=_n_block) {
+                for (unsigned int x0=0; x0<_Nsize; x0+=_n_block, block++) {
+                    if (block >= end) {
+                        return;
+                    }
+
                     const unsigned int xmax = std::min(x0+_n_block, _Nsize);
 
                     const unsigned int size = roundup(xmax-x0, strategy::out_width()) * k_size;
 
-                    strat.transforms.PrepareB( buffer, B + (multi * B_multi_stride), ldb,
-                                               x0, xmax, k0, kmax, false);
+                    if (block >= start) {
+                        strat.transforms.PrepareB( buffer, B + (multi * B_multi_stride), ldb,
+                                                   x0, xmax, k0, kmax, false);
+                    }
 
                     buffer += size;
                 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2022-2024 Arm Limited.
+ * Copyright (c) 2018-2020, 2022-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,7 +24,9 @@
 
 #include "arm_gemm.hpp"
 
+#include "implementation_cache.hpp"
 #include "kernel_weight_format.hpp"
+#include "utils.hpp"
 
 #include <cstdint>
 #include <functional>
@@ -235,7 +237,7 @@ const GemmImplementation<Tlop, Trop, Tret, OutputStage> *gemm_implementation_lis
  * reference.
  */
 template<typename Tlop, typename Trop, typename Tret, class OutputStage>
-bool find_implementation(const GemmArgs &args, const OutputStage &os, const GemmImplementation<Tlop, Trop, Tret, OutputStage> * &impl) {
+bool select_implementation(const GemmArgs &args, const OutputStage &os, const GemmImplementation<Tlop, Trop, Tret, OutputStage> * &impl) {
     auto gemms = gemm_implementation_list<Tlop, Trop, Tret, OutputStage>();
     const GemmConfig *cfg = args._cfg;
 
@@ -284,6 +286,21 @@ bool find_implementation(const GemmArgs &args, const OutputStage &os, const Gemm
     return false;
 }
 
+/*
+ * Same as select_implementation(), the selection of each problem being
+ * cached so that it is only made once.
+ */
+template<typename Tlop, typename Trop, typename Tret, class OutputStage>
+bool find_implementation(const GemmArgs &args, const OutputStage &os, const GemmImplementation<Tlop, Trop, Tret, OutputStage> * &impl) {
+    using Implementation = GemmImplementation<Tlop, Trop, Tret, OutputStage>;
+
+    SelectionKey key;
+    add_selection_args(add_selection_args(key, args), os);
+    return ImplementationCache<Implementation>::get().find_or_select(key, impl, [&](const Implementation * &selected) {
+        return select_implementation<Tlop, Trop, Tret, OutputStage>(args, os, selected);
+    });
+}
+
 template<typename Tlop, typename Trop, typename Tret, class OutputStage>
 std::vector<KernelDescription> get_compatible_kernels(const GemmArgs &args, const OutputStage &os) {
     std::vector<KernelDescription> res;
@@ -327,12 +344,82 @@ UniqueGemmCommon<Tlop, Trop, Tret> gemm(const GemmArgs &args, const OutputStage
     return UniqueGemmCommon<Tlop, Trop, Tret>(nullptr);
 }
 
+/*
+ * Number of sections to split K into when M and N are too small to keep the
+ * threads busy.
+ *
+ * Each section is computed as a separate multi of a GEMM over K/sections,
+ * its partial results being summed afterwards by the caller.  The time of
+ * the selected implementation is modelled as the number of rounds of its
+ * window the threads go through, each unit of the window costing its share
+ * of the multiply-accumulates, plus a pass over the partial results of every
+ * section for the split problem.  Returns 1 when no split wins.
+ */
+template<typename Tlop, typename Trop, typename Tret, class OutputStage>
+unsigned int get_gemm_split_k(const GemmArgs &args, const OutputStage &os) {
+    /* Sections shorter than this do not amortise the setup of the kernels over K. */
+    const unsigned int min_section_k = 64;
+    /* Cost of reading and adding one partial result, in multiply-accumulates. */
+    const uint64_t reduction_cost = 4;
+
+    if (args._maxthreads < 2 || args._nmulti != 1 || args._Ksections != 1 || args._indirect_input ||
+        args._accumulate || args._Ksize < 2 * min_section_k) {
+        return 1;
+    }
+
+    const uint64_t threads = args._maxthreads;
+    const uint64_t macs = static_cast<uint64_t>(args._Msize) * args._Nsize * args._Ksize * args._nbatches;
+    const uint64_t outputs = static_cast<uint64_t>(args._Msize) * args._Nsize * args._nbatches;
+
+    auto time = [&](const GemmArgs &split_args, uint64_t sections, uint64_t &cost) {
+        const GemmImplementation<Tlop, Trop, Tret, OutputStage> *impl;
+        if (!find_implementation<Tlop, Trop, Tret, OutputStage>(split_args, os, impl)) {
+            return false;
+        }
+        const UniqueGemmCommon<Tlop, Trop, Tret> gemm(impl->do_instantiate(split_args, os));
+        const uint64_t units = gemm->get_window_size().total_size();
+        if (units == 0) {
+            return false;
+        }
+        cost = iceildiv(units, threads) * macs / units;
+        if (sections > 1) {
+            cost += iceildiv(sections * outputs * reduction_cost, threads);
+        }
+        return true;
+    };
+
+    uint64_t best_cost = 0;
+    if (!time(args, 1, best_cost)) {
+        return 1;
+    }
+
+    unsigned int best_sections = 1;
+    for (unsigned int sections = 2; sections <= threads && args._Ksize / sections >= min_section_k; sections++) {
+        if (args._Ksize % sections != 0) {
+            continue;
+        }
+
+        GemmArgs split_args(args);
+        split_args._Ksize = args._Ksize / sections;
+        split_args._nmulti = sections;
+        split_args._act = Activation();
+
+        uint64_t cost = 0;
+        if (time(split_args, sections, cost) && cost < best_cost) {
+            best_cost = cost;
+            best_sections = sections;
+        }
+    }
+
+    return best_sections;
+}
+
 template<typename Tlop, typename Trop, typename Tret, class OutputStage>
 KernelDescription get_gemm_method(const GemmArgs &args, const OutputStage &os) {
     const GemmImplementation<Tlop, Trop, Tret, OutputStage> *impl;
 
     if (find_implementation<Tlop, Trop, Tret>(args, os, impl)) {
-        return KernelDescription(impl->method, impl->name);
+        return KernelDescription(impl->method, impl->name, true, impl->do_cycle_estimate(args, os));
     }
 
     /* This shouldn't happen - there should always be at least one valid implementation. */
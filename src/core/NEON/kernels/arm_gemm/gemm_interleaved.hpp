@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -683,6 +683,26 @@ class GemmInterleaved : public GemmCommon<Tlo, Tro, Tr> {
         return args._Ksections * roundup(args._Ksize, strategy::k_unroll());
     }
 
+    // Prefetch rows [m0, mmax) of columns [k0, kmax) of a plain A matrix.  Issued for the block interleaved next
+    // while the kernel works on the current one, so that the interleave finds A in the cache rather than stalling
+    // on memory.  Indirect and convolution inputs gather their rows, they are left to the hardware prefetchers.
+    void prefetch_A(const Tlo *A, const int lda, unsigned int m0, unsigned int mmax, unsigned int k0, unsigned int kmax) const {
+        if (_indirect_buf != nullptr || _convolver || k0 >= kmax) {
+            return;
+        }
+
+        const unsigned int line_size = 64 / sizeof(Tlo);
+
+        for (unsigned int m=m0; m<mmax; m++) {
+            const Tlo *row = A + (m * lda);
+
+            for (unsigned int k=k0; k<kmax; k+=line_size) {
+                __builtin_prefetch(row + k, 0, 2);
+            }
+            __builtin_prefetch(row + kmax - 1, 0, 2);
+        }
+    }
+
     static unsigned int get_k_block_size(const GemmArgs &args) {
         if (args._cfg && args._cfg->inner_block_size) {
             return roundup(args._cfg->inner_block_size, strategy::k_unroll());
@@ -938,6 +958,18 @@ public:
                             }
                         }
 
+                        // Prefetch the rows of A interleaved on the next iteration while the kernel runs on these ones.
+                        // The window only spans the batches and rows of the current multi.
+                        if (p + 1 < end) {
+                            const unsigned int next_batch = (p + 1) / window_per_batch;
+                            const unsigned int next_row   = ((p + 1) - (next_batch * window_per_batch)) * strategy::out_height();
+
+                            if (next_batch < _nbatches) {
+                                prefetch_A(g_arrays._Aptr + (next_batch * g_arrays._A_batch_stride) + (multi * g_arrays._A_multi_stride),
+                                           g_arrays._lda, next_row, std::min(next_row + strategy::out_height(), _Msize), k0, std::min(kmax, _Ksize));
+                            }
+                        }
+
                         Tr *result_ptr = g_arrays._Cptr + (batch * g_arrays._C_batch_stride) + (multi * g_arrays._C_multi_stride);
 
                         // If we are using an accumulation buffer and this isn't the last pass, don't pass a result pointer.
@@ -1056,6 +1088,21 @@ public:
                                                                            (current.k0() * get_stripe_width<strategy, FixedFormat>::get());
                 }
 
+                // On the last X block of a K block, prefetch the first rows of A interleaved for the next K block
+                // while the kernel runs on this one.  Only one strip of rows is prefetched: the interleave streams
+                // through the others, and prefetching the whole block would evict the panels the kernel works on.
+                if (current.xmax() >= _Nsize) {
+                    const bool next_multi = (current.k0() + _k_block >= _Ktotal);
+                    const unsigned int multi = next_multi ? current.multi() + 1 : current.multi();
+                    const unsigned int k0    = next_multi ? 0 : current.k0() + _k_block;
+                    const unsigned int last_m = std::min(m_0 + strategy::out_height(), (batch_0 == batch_end) ? m_max : _Msize);
+
+                    if (multi < _nmulti) {
+                        prefetch_A(g_arrays._Aptr + (batch_0 * g_arrays._A_batch_stride) + (multi * g_arrays._A_multi_stride),
+                                   g_arrays._lda, m_0, last_m, k0, std::min(k0 + _k_block, _Ksize));
+                    }
+                }
+
                 /* Do the actual work. */
                 for (unsigned int batch = batch_0; batch <= batch_end; batch++) {
                     unsigned int first_m = (batch == batch_0)   ? m_0   : 0;
@@ -1178,11 +1225,14 @@ public:
         return (x_size * _Ktotal * _nmulti * sizeof(Troi)) + get_col_sum_size();
     }
 
+    // The pretranspose window is made of the column strips (of the kernel output width) of each K block rather than
+    // of the X blocks, so that the threads still share the packing of B when it only has a few X blocks.  B is
+    // packed once into the shared buffer and read by all the threads of the GEMM.
     size_t get_B_pretranspose_window_size() const override {
-        size_t n_blocks = iceildiv(_Nsize, _x_block);
+        size_t n_strips = iceildiv(_Nsize, strategy::out_width());
         size_t k_blocks = iceildiv(_Ktotal, _k_block);
 
-        return n_blocks * k_blocks * _nmulti;
+        return n_strips * k_blocks * _nmulti;
     }
 
     void requantize_bias(void *in_buffer, const Tro *B, const int ldb, const int B_multi_stride) override {
@@ -1220,30 +1270,34 @@ public:
         Troi *buffer = reinterpret_cast<Troi *>(buffer_int + get_col_sum_size());
         _B_transposed = buffer;
 
-        blockwalker current(*this);
         strategy strat(_ci);
 
-        // Skip over blocks we aren't doing
-        for(size_t i = 0; i < start; i++) {
-            buffer += roundup(current.xmax() - current.x0(), strategy::out_width()) * roundup(current.kmax() - current.k0(), strategy::k_unroll());
-            current.advance();
-        }
+        const unsigned int n_strips      = iceildiv(_Nsize, strategy::out_width());
+        const unsigned int k_blocks      = iceildiv(_Ktotal, _k_block);
+        const unsigned int rounded_width = n_strips * strategy::out_width();
 
-        size_t blocks_left = (end - start);
+        end = std::min(end, get_B_pretranspose_window_size());
 
-        // Double check that we haven't run out of work
-        if (current.done()) {
-            blocks_left = 0;
-        }
+        for (size_t index = start; index < end; ) {
+            /* Figure out the K block and the strips of it to do - all the strips left in the K block are done together. */
+            const unsigned int multi       = index / (n_strips * k_blocks);
+            const unsigned int k_block     = (index / n_strips) % k_blocks;
+            const unsigned int strip_start = index % n_strips;
+            const unsigned int strip_end   = std::min<size_t>(n_strips, strip_start + (end - index));
 
-        for (/* blocks_left initialized above */; blocks_left > 0; blocks_left--) {
-            /* Figure out the size of each block. */
-            unsigned int k_size = (current.kmax() - current.k0());
+            const unsigned int k0      = k_block * _k_block;
+            const unsigned int k_size  = std::min(k0 + _k_block, _Ktotal) - k0;
+            const unsigned int x_start = strip_start * strategy::out_width();
+            const unsigned int x_end   = std::min(strip_end * strategy::out_width(), _Nsize);
+
+            // Each K block spans the full rounded width, made of strips of <out_width> columns interleaved over the
+            // (padded) depth of the block.  This matches the layout of the X blocks walked by execute().
+            Troi *block_buffer = buffer + (((multi * _Ktotal) + k0) * rounded_width) + (x_start * roundup(k_size, strategy::k_unroll()));
 
             if (_Ksections > 1) {
                 // We need to insert padding at the end of each K section.
-                // The computation needed is a little delicate - the coordinates from the block walker are expressed in
-                // terms of the full, padded, _Ktotal.
+                // The computation needed is a little delicate - the K coordinates are expressed in terms of the full,
+                // padded, _Ktotal.
                 // But we need to transform each section with reference to the original, unpadded, input, letting the
                 // transform pad each section as needed.
 
@@ -1253,11 +1307,11 @@ public:
                 // The expected output format is also an entire <out_width> columns interleaved, then the next set of
                 // columns, and so on.  This means, as we are breaking it up vertically, we have to do it one column at
                 // a time.
-                for (unsigned int x0=current.x0(); x0 < current.xmax(); x0 += strategy::out_width() ) {
-                    unsigned int xmax = std::min(x0 + strategy::out_width(), current.xmax());
+                for (unsigned int x0=x_start; x0 < x_end; x0 += strategy::out_width() ) {
+                    unsigned int xmax = std::min(x0 + strategy::out_width(), x_end);
 
                     // Track where we are and how much work is left.
-                    unsigned int kpos  = current.k0();
+                    unsigned int kpos  = k0;
                     unsigned int kleft = k_size;
 
                     while (kleft) {
@@ -1269,7 +1323,7 @@ public:
                         // We will either copy the rest of this section, or to the end of the requested length.
                         unsigned int k_length = std::min(_Ksize - k_offset, kleft);
 
-                        strat.transforms.PrepareB(buffer, B + (current.multi() * B_multi_stride), ldb,
+                        strat.transforms.PrepareB(block_buffer, B + (multi * B_multi_stride), ldb,
                                                   x0, xmax,
                                                   (k_section_base * _Ksize) + k_offset,               // K starting point - compute row to read based on our section and the true section length.
                                                   (k_section_base * _Ksize) + k_offset + k_length,    // K end point - starting point plus length computed above.
@@ -1278,7 +1332,7 @@ public:
                         // We need to modify our position based on the ROUNDED version of what we just did.
                         unsigned int padded_length = roundup(k_length, strategy::k_unroll());
 
-                        buffer += strategy::out_width() * padded_length;
+                        block_buffer += strategy::out_width() * padded_length;
 
                         kpos  += padded_length;
                         kleft -= padded_length;
@@ -1286,16 +1340,12 @@ public:
                 }
             } else {
                 // In the single K section case, can process the whole lot in one go.
-                // Caution: 'blockwalker::kmax()' rounds up, so clamp to valid _Ksize.
-                strat.transforms.PrepareB(buffer, B + (current.multi() * B_multi_stride), ldb,
-                                          current.x0(), current.xmax(), current.k0(), std::min(current.kmax(), _Ksize), transposed);
-                buffer += roundup(current.xmax() - current.x0(), strategy::out_width()) * roundup(current.kmax() - current.k0(), strategy::k_unroll());
+                // Caution: the K block end rounds up, so clamp to valid _Ksize.
+                strat.transforms.PrepareB(block_buffer, B + (multi * B_multi_stride), ldb,
+                                          x_start, x_end, k0, std::min(k0 + k_size, _Ksize), transposed);
             }
 
-            // Advance to the next block, break if we run off the end.
-            if (!current.advance()) {
-                break;
-            }
+            index += strip_end - strip_start;
         }
     }
 
@@ -1337,7 +1387,7 @@ public:
     static uint64_t estimate_cycles(const GemmArgs &args) {
         unsigned int k_blocks = iceildiv(args._Ksize, get_k_block_size(args));
 
-        const PerformanceParameters &params = strategy::template get_performance_parameters<perf_type>(args._ci);
+        const PerformanceParameters params = get_performance_parameters<strategy, perf_type>(args._ci);
 
         uint64_t total_macs    = static_cast<uint64_t>(args._nbatches) * args._nmulti * roundup(args._Msize, strategy::out_height()) * roundup(args._Nsize, strategy::out_width()) * get_ktotal(args);
         uint64_t prepare_bytes = static_cast<uint64_t>(args._nbatches) * args._nmulti * roundup(args._Msize, strategy::out_height()) * get_ktotal(args) * sizeof(Tloi);
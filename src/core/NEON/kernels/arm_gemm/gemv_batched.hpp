@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -88,10 +88,18 @@ public:
         return _subgemm->get_B_pretransposed_array_size();
     }
 
+    size_t get_B_pretranspose_window_size() const override {
+        return _subgemm->get_B_pretranspose_window_size();
+    }
+
     void pretranspose_B_array(void *buffer, const To *B, const int ldb, const int B_multi_stride, bool transposed) override {
         _subgemm->pretranspose_B_array(buffer, B, ldb, B_multi_stride, transposed);
     }
 
+    void pretranspose_B_array_part(void *buffer, const To *B, const int ldb, const int B_multi_stride, bool transposed, size_t start, size_t end) override {
+        _subgemm->pretranspose_B_array_part(buffer, B, ldb, B_multi_stride, transposed, start, end);
+    }
+
     void set_pretransposed_B_data(void *buffer) override {
         _subgemm->set_pretransposed_B_data(buffer);
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -223,10 +223,22 @@ public:
         }
     }
 
+    // One unit of work per (multi, out_width wide column block).
+    size_t get_B_pretranspose_window_size() const override {
+        return _args._nmulti * iceildiv(_args._Nsize, strategy::out_width());
+    }
+
     void pretranspose_B_array(void *buffer, const To *B, const int ldb, const int B_multi_stride, bool transposed) override {
+        pretranspose_B_array_part(buffer, B, ldb, B_multi_stride, transposed, 0, get_B_pretranspose_window_size());
+    }
+
+    void pretranspose_B_array_part(void *buffer, const To *B, const int ldb, const int B_multi_stride, bool transposed, size_t start, size_t end) override {
         assert(!transposed);
 
-        requantize_bias(buffer, B, ldb, B_multi_stride);
+        // Perform column sums as part of the last block.
+        if (end >= get_B_pretranspose_window_size()) {
+            requantize_bias(buffer, B, ldb, B_multi_stride);
+        }
 
         // The actual transposed buffer goes after the column sums (if any)
         uintptr_t buffer_int = reinterpret_cast<uintptr_t>(buffer);
@@ -234,8 +246,15 @@ public:
 
         strategy strat(_args._ci);
 
-        for (unsigned int multi=0; multi<_args._nmulti; multi++) {
-            strat.transforms.PrepareB(B_buffer + (multi * _buffer_per_multi), B + (multi * B_multi_stride), ldb, 0, _args._Nsize, 0, _args._Ksize, false);
+        // Each block of out_width columns is stored contiguously, roundup(K, k_unroll) rows deep.
+        const size_t n_blocks = iceildiv(_args._Nsize, strategy::out_width());
+        for (size_t block=start; block<end; block++) {
+            const unsigned int multi = block / n_blocks;
+            const unsigned int x0    = (block % n_blocks) * strategy::out_width();
+            const unsigned int xmax  = std::min(x0 + strategy::out_width(), _args._Nsize);
+
+            strat.transforms.PrepareB(B_buffer + (multi * _buffer_per_multi) + (x0 * roundup(_args._Ksize, strategy::k_unroll())),
+                                      B + (multi * B_multi_stride), ldb, x0, xmax, 0, _args._Ksize, false);
         }
 
         _B_pretransposed = B_buffer;
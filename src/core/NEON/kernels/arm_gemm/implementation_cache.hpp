@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "arm_gemm.hpp"
+
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+namespace arm_gemm {
+
+/* Key identifying a kernel selection problem.
+ *
+ * The values the selection depends on are appended one after the other, so
+ * two problems only share a key if all of them are identical.  Pointers are
+ * never part of a key, only whether they are set, as the same address can
+ * be reused for different values.  */
+class SelectionKey {
+public:
+    template<typename T>
+    SelectionKey &add(const T &value) {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "Only plain values can be added to a key");
+        _bytes.append(reinterpret_cast<const char *>(&value), sizeof(T));
+        return *this;
+    }
+
+    SelectionKey &add(const std::string &value) {
+        add(value.size());
+        _bytes.append(value);
+        return *this;
+    }
+
+    SelectionKey &add(const Activation &act) {
+        return add(act.type).add(act.param1).add(act.param2);
+    }
+
+    /* The selections query the features of the CPU and may tune for its model. */
+    SelectionKey &add(const CPUInfo *ci) {
+        add(ci != nullptr);
+        if (ci != nullptr) {
+            add(ci->get_cpu_model());
+            add(ci->has_fp16()).add(ci->has_bf16()).add(ci->has_svebf16()).add(ci->has_fp8()).add(ci->has_fp8dot4());
+            add(ci->has_dotprod()).add(ci->has_svef32mm()).add(ci->has_i8mm()).add(ci->has_svei8mm()).add(ci->has_fhm());
+            add(ci->has_sve()).add(ci->has_sve2()).add(ci->has_sme()).add(ci->has_sme2());
+        }
+        return *this;
+    }
+
+    const std::string &str() const {
+        return _bytes;
+    }
+
+private:
+    std::string _bytes{};
+};
+
+inline SelectionKey &add_selection_args(SelectionKey &key, const GemmArgs &args) {
+    key.add(args._ci).add(args._Msize).add(args._Nsize).add(args._Ksize).add(args._Ksections).add(args._nbatches);
+    key.add(args._nmulti).add(args._indirect_input).add(args._act).add(args._maxthreads).add(args._fixed_format);
+    key.add(args._fast_mode).add(args._accumulate).add(args._cfg != nullptr);
+    if (args._cfg != nullptr) {
+        key.add(args._cfg->method).add(args._cfg->filter).add(args._cfg->inner_block_size);
+        key.add(args._cfg->outer_block_size).add(args._cfg->weight_format);
+    }
+    return key;
+}
+
+inline SelectionKey &add_selection_args(SelectionKey &key, const Nothing &) {
+    return key;
+}
+
+inline SelectionKey &add_selection_args(SelectionKey &key, const DequantizeFloat &os) {
+    return key.add(os.scale);
+}
+
+inline SelectionKey &add_selection_args(SelectionKey &key, const Requantize32 &os) {
+    key.add(os.bias != nullptr).add(os.bias_multi_stride).add(os.a_offset).add(os.b_offset).add(os.c_offset);
+    key.add(os.per_channel_requant).add(os.per_layer_left_shift).add(os.per_layer_right_shift).add(os.per_layer_mul);
+    key.add(os.per_channel_left_shifts != nullptr).add(os.per_channel_right_shifts != nullptr);
+    key.add(os.per_channel_muls != nullptr).add(os.minval).add(os.maxval);
+    return key;
+}
+
+/* Thread-safe cache of the implementations selected from a static list.
+ *
+ * Selecting an implementation evaluates the support and the cycle estimate
+ * of every candidate, which operators configured for the same problem (e.g.
+ * the layers of a network sharing a shape) would otherwise repeat.  The
+ * lists are static, so the cached entries stay valid for the lifetime of
+ * the library.  Problems without a valid implementation are cached as
+ * nullptr.  There is one cache per type of implementation.  */
+template<typename Implementation>
+class ImplementationCache {
+public:
+    static ImplementationCache &get() {
+        static ImplementationCache cache;
+        return cache;
+    }
+
+    /* Returns true if the problem has been seen, setting impl to its selection. */
+    bool find(const SelectionKey &key, const Implementation * &impl) const {
+        std::lock_guard<std::mutex> lock(_mtx);
+        const auto it = _impls.find(key.str());
+        if (it == _impls.end()) {
+            return false;
+        }
+        impl = it->second;
+        return true;
+    }
+
+    void insert(const SelectionKey &key, const Implementation *impl) {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _impls.emplace(key.str(), impl);
+    }
+
+    /* Looks up the selection for a problem, calling select() to fill the
+     * entry on a miss.  Returns false if the problem has no valid
+     * implementation.  */
+    template<typename F>
+    bool find_or_select(const SelectionKey &key, const Implementation * &impl, F &&select) {
+        const Implementation *selected = nullptr;
+        if (!find(key, selected)) {
+            if (!select(selected)) {
+                selected = nullptr;
+            }
+            insert(key, selected);
+        }
+        if (selected == nullptr) {
+            return false;
+        }
+        impl = selected;
+        return true;
+    }
+
+private:
+    ImplementationCache() = default;
+
+    mutable std::mutex                                    _mtx{};
+    std::unordered_map<std::string, const Implementation *> _impls{};
+};
+
+} // namespace arm_gemm
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018, 2022-2023 Arm Limited.
+ * Copyright (c) 2017-2018, 2022-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,9 +26,13 @@
 #include <mutex>
 #endif
 #include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
 
 #include "arm_gemm.hpp"
 #include "kernel_weight_format.hpp"
+#include "performance_parameters.hpp"
 #include "utils.hpp"
 
 namespace arm_gemm {
@@ -37,6 +41,50 @@ namespace arm_gemm {
 std::mutex report_mutex;
 #endif
 
+namespace {
+
+#ifndef NO_MULTI_THREADING
+std::mutex performance_parameters_mutex;
+#endif
+
+std::map<std::pair<CPUModel, std::string>, PerformanceParameters> &performance_parameters_overrides() {
+    static std::map<std::pair<CPUModel, std::string>, PerformanceParameters> overrides;
+    return overrides;
+}
+
+} // anonymous namespace
+
+void set_performance_parameters_override(CPUModel model, const std::string &kernel_name, const PerformanceParameters &params) {
+#ifndef NO_MULTI_THREADING
+    std::lock_guard<std::mutex> lock(performance_parameters_mutex);
+#endif
+    auto &overrides = performance_parameters_overrides();
+    overrides.erase(std::make_pair(model, kernel_name));
+    overrides.emplace(std::make_pair(model, kernel_name), params);
+}
+
+bool get_performance_parameters_override(CPUModel model, const std::string &kernel_name, PerformanceParameters &params) {
+#ifndef NO_MULTI_THREADING
+    std::lock_guard<std::mutex> lock(performance_parameters_mutex);
+#endif
+    const auto &overrides = performance_parameters_overrides();
+    const auto it = overrides.find(std::make_pair(model, kernel_name));
+
+    if (it == overrides.end()) {
+        return false;
+    }
+
+    params = it->second;
+    return true;
+}
+
+void clear_performance_parameters_overrides() {
+#ifndef NO_MULTI_THREADING
+    std::lock_guard<std::mutex> lock(performance_parameters_mutex);
+#endif
+    performance_parameters_overrides().clear();
+}
+
 WeightFormat get_weight_format(const KernelWeightFormat kwf, size_t element_size) {
     if (kwf==KernelWeightFormat::NON_FIXED) {
         return WeightFormat::UNSPECIFIED;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2024 Arm Limited.
+ * Copyright (c) 2020, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,11 @@
  */
 #pragma once
 
+#include "arm_gemm.hpp"
+#include "utils.hpp"
+
+#include <string>
+
 namespace arm_gemm {
 
 struct PerformanceParameters {
@@ -34,4 +39,34 @@ struct PerformanceParameters {
     PerformanceParameters(float k, float p, float m) : kernel_macs_cycle(k), prepare_bytes_cycle(p), merge_bytes_cycle(m) { }
 };
 
+/* Runtime overrides of the built-in performance parameters, e.g. measured on
+ * a CPU model the kernels have no figures for.  Overrides are keyed by CPU
+ * model and kernel name (as returned by get_type_name()).  Fields left at
+ * zero keep the built-in value. */
+void set_performance_parameters_override(CPUModel model, const std::string &kernel_name, const PerformanceParameters &params);
+bool get_performance_parameters_override(CPUModel model, const std::string &kernel_name, PerformanceParameters &params);
+void clear_performance_parameters_overrides();
+
+/* Performance parameters of a strategy on the current CPU, with any runtime
+ * override applied on top of the strategy's built-in values. */
+template<typename strategy, typename perf_type>
+PerformanceParameters get_performance_parameters(const CPUInfo *ci) {
+    PerformanceParameters params = strategy::template get_performance_parameters<perf_type>(ci);
+    PerformanceParameters override_params(0.0f);
+
+    if (get_performance_parameters_override(ci->get_cpu_model(), get_type_name<strategy>(), override_params)) {
+        if (override_params.kernel_macs_cycle > 0.0f) {
+            params.kernel_macs_cycle = override_params.kernel_macs_cycle;
+        }
+        if (override_params.prepare_bytes_cycle > 0.0f) {
+            params.prepare_bytes_cycle = override_params.prepare_bytes_cycle;
+        }
+        if (override_params.merge_bytes_cycle > 0.0f) {
+            params.merge_bytes_cycle = override_params.merge_bytes_cycle;
+        }
+    }
+
+    return params;
+}
+
 } // namespace arm_gemm
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,8 @@
 #include "src/common/utils/Validate.h"
 #include "support/Bfloat16.h"
 
+#include <cmath>
+
 namespace arm_compute
 {
 #ifdef __aarch64__
@@ -41,7 +43,9 @@ union Element
 
 inline float16_t activation(float16_t x, const LUTInfo &info)
 {
-    float16_t out = 0.f;
+    // Evaluated in fp32, the tables are only built once per activation
+    const float xf  = static_cast<float>(x);
+    float16_t   out = 0.f;
     switch (info.act)
     {
         case ActivationLayerInfo::ActivationFunction::LOGISTIC:
@@ -52,6 +56,15 @@ inline float16_t activation(float16_t x, const LUTInfo &info)
             out = static_cast<float16_t>(info.alpha * std::tanh(info.beta * x));
             break;
         }
+        case ActivationLayerInfo::ActivationFunction::GELU:
+            out = static_cast<float16_t>(xf * (0.5f * (1.0f + std::erf(xf / 1.41421356237f))));
+            break;
+        case ActivationLayerInfo::ActivationFunction::SWISH:
+            out = static_cast<float16_t>(xf / (1.f + std::exp(-info.alpha * xf)));
+            break;
+        case ActivationLayerInfo::ActivationFunction::ELU:
+            out = static_cast<float16_t>((xf >= 0.f) ? xf : info.alpha * (std::exp(xf) - 1.f));
+            break;
         default:
             ARM_COMPUTE_ERROR("Unsupported Activation for 16-bit LUT table");
             break;
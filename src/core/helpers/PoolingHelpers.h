@@ -1,5 +1,5 @@
 /*
-* Copyright (c) 2022, 2024 Arm Limited.
+* Copyright (c) 2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,26 @@ namespace cpu
 namespace
 {
 
+/** Expand the coordinates of a 3D pooling output window whose height, depth and batch dimensions may be collapsed
+ *  into DimZ
+ *
+ * @param[in] id           Coordinates of the, possibly collapsed, output window.
+ * @param[in] output_dim_h Output height.
+ * @param[in] output_dim_d Output depth.
+ *
+ * @return the NDHWC coordinates of the output element
+ */
+inline Coordinates expand_pool3d_coordinates(const Coordinates &id, const int output_dim_h, const int output_dim_d)
+{
+    const int linear_idx = id[2] + output_dim_h * (id[3] + output_dim_d * id[4]);
+
+    Coordinates expanded = id;
+    expanded.set(2, linear_idx % output_dim_h);
+    expanded.set(3, (linear_idx / output_dim_h) % output_dim_d);
+    expanded.set(4, linear_idx / (output_dim_h * output_dim_d));
+    return expanded;
+}
+
 inline float calculate_avg_scale_pool3d(bool               exclude_padding,
                                         const Coordinates &id,
                                         const int          pool_size_x,
@@ -1,5 +1,5 @@
 /*
-* Copyright (c) 2023 Arm Limited.
+* Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -46,4 +46,25 @@ bool has_holes(const ITensorInfo &info, size_t dimension)
     }
     return false;
 }
+
+bool has_shape_bounds(const ITensorInfo &info)
+{
+    return info.is_dynamic() && info.tensor_shape().total_size() != 0;
+}
+
+bool is_within_shape_bounds(const TensorShape &shape, const ITensorInfo &bounds)
+{
+    const TensorShape &max_shape  = bounds.tensor_shape();
+    const auto        &dims_state = bounds.tensor_dims_state();
+
+    for (size_t dim = 0; dim < TensorShape::num_max_dimensions; ++dim)
+    {
+        const bool is_dynamic = dims_state[dim] == ITensorInfo::get_dynamic_state_value();
+        if (shape[dim] > max_shape[dim] || (!is_dynamic && shape[dim] != max_shape[dim]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
-* Copyright (c) 2020-2021, 2023 Arm Limited.
+* Copyright (c) 2020-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -115,6 +115,26 @@ bool has_holes(const ITensorInfo &info);
  */
 bool has_holes(const ITensorInfo &info, size_t dimension);
 
+/** Check if a tensor info declares shape bounds.
+ *
+ * A tensor info with dynamic dimensions and a non-empty shape declares bounds: its shape is the largest shape the
+ * function configured with it accepts at run time, and only its dynamic dimensions may be smaller.
+ *
+ * @param[in] info Tensor info object to check.
+ *
+ * @return True if the tensor info declares shape bounds.
+ */
+bool has_shape_bounds(const ITensorInfo &info);
+
+/** Check if a shape is within the bounds declared by a tensor info.
+ *
+ * @param[in] shape  Shape to check.
+ * @param[in] bounds Tensor info object declaring the bounds, see @ref has_shape_bounds().
+ *
+ * @return True if every dynamic dimension of @p shape is at most the one of @p bounds and every other dimension is equal.
+ */
+bool is_within_shape_bounds(const TensorShape &shape, const ITensorInfo &bounds);
+
 } // namespace arm_compute
 
 #endif // ACL_SRC_CORE_HELPERS_UTILS_H
@@ -1,5 +1,5 @@
 /*
-* Copyright (c) 2020-2022 Arm Limited.
+* Copyright (c) 2020-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,39 @@
 
 namespace arm_compute
 {
+namespace
+{
+/** Check whether the dimensions [first_dim, last_dim) of a tensor follow each other in memory */
+bool are_dimensions_contiguous(const ITensorInfo &info, size_t first_dim, size_t last_dim)
+{
+    const auto &shape   = info.tensor_shape();
+    const auto &strides = info.strides_in_bytes();
+
+    last_dim = std::min(last_dim, info.num_dimensions());
+    for (size_t dim = first_dim + 1; dim < last_dim; ++dim)
+    {
+        if (strides[dim] != strides[dim - 1] * shape[dim - 1])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Check whether all the dimensions [first_dim, last_dim) of a tensor are broadcast */
+bool are_dimensions_broadcast(const ITensorInfo &info, size_t first_dim, size_t last_dim)
+{
+    for (size_t dim = first_dim; dim < last_dim; ++dim)
+    {
+        if (info.tensor_shape()[dim] != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
 Window
 calculate_max_window(const ValidRegion &valid_region, const Steps &steps, bool skip_border, BorderSize border_size)
 {
@@ -304,6 +337,83 @@ std::pair<Window, size_t> calculate_squashed_or_max_window(const ITensorInfo &sr
     return std::make_pair(win, split_dimension);
 }
 
+std::pair<Window, size_t>
+calculate_squashed_or_collapsed_window(const ITensorInfo &src0, const ITensorInfo &src1, const ITensorInfo &dst)
+{
+    auto win_and_split = calculate_squashed_or_max_window(src0, src1);
+    if (win_and_split.second == Window::DimX)
+    {
+        return win_and_split;
+    }
+
+    const auto  &dst_shape      = dst.tensor_shape();
+    const size_t num_dimensions = dst.num_dimensions();
+
+    Window win;
+
+    // A single value applied to a whole tensor: the other input and the destination are read as 1D arrays.
+    const bool is_src0_scalar = src0.tensor_shape().total_size() == 1;
+    const bool is_src1_scalar = src1.tensor_shape().total_size() == 1;
+    if (is_src0_scalar != is_src1_scalar && dst_shape.x() > 1)
+    {
+        const ITensorInfo &non_scalar = is_src0_scalar ? src1 : src0;
+        if (non_scalar.tensor_shape() == dst_shape && are_dimensions_contiguous(non_scalar, 0, num_dimensions) &&
+            are_dimensions_contiguous(dst, 0, num_dimensions))
+        {
+            win.set(Window::DimX, Window::Dimension(0, dst_shape.total_size(), 1));
+            for (size_t dim = 1; dim < Coordinates::num_max_dimensions; ++dim)
+            {
+                win.set(dim, Window::Dimension(0, 1, 1));
+            }
+            return std::make_pair(win, Window::DimX);
+        }
+    }
+
+    // Collapse the dimensions from Y upwards over which each input is either read in full or broadcast.
+    // The Y dimension of an input read in full must be greater than 1, otherwise it would be broadcast.
+    size_t collapsed_end = Window::DimY + 1;
+    if (dst_shape.y() > 1)
+    {
+        for (; collapsed_end < num_dimensions; ++collapsed_end)
+        {
+            bool can_collapse = are_dimensions_contiguous(dst, Window::DimY, collapsed_end + 1);
+            for (const ITensorInfo *src : {&src0, &src1})
+            {
+                bool is_read_in_full = are_dimensions_contiguous(*src, Window::DimY, collapsed_end + 1);
+                for (size_t dim = Window::DimY; dim <= collapsed_end; ++dim)
+                {
+                    is_read_in_full = is_read_in_full && src->tensor_shape()[dim] == dst_shape[dim];
+                }
+                const bool is_broadcast = are_dimensions_broadcast(*src, Window::DimY, collapsed_end + 1);
+                can_collapse            = can_collapse && (is_read_in_full || is_broadcast);
+            }
+            if (!can_collapse)
+            {
+                break;
+            }
+        }
+    }
+
+    if (collapsed_end == Window::DimY + 1)
+    {
+        return win_and_split;
+    }
+
+    size_t collapsed_rows = 1;
+    for (size_t dim = Window::DimY; dim < collapsed_end; ++dim)
+    {
+        collapsed_rows *= dst_shape[dim];
+    }
+
+    win.set(Window::DimX, Window::Dimension(0, dst_shape.x(), 1));
+    win.set(Window::DimY, Window::Dimension(0, collapsed_rows, 1));
+    for (size_t dim = Window::DimZ; dim < Coordinates::num_max_dimensions; ++dim)
+    {
+        win.set(dim, Window::Dimension(0, dim < collapsed_end ? 1 : dst_shape[dim], 1));
+    }
+    return std::make_pair(win, Window::DimY);
+}
+
 std::pair<Window, size_t> calculate_squashed_or_max_window(const ITensorInfo &src)
 {
     const auto &shape          = src.tensor_shape();
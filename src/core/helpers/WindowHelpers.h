@@ -1,5 +1,5 @@
 /*
-* Copyright (c) 2020-2022 Arm Limited.
+* Copyright (c) 2020-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -212,6 +212,26 @@ std::pair<Window, size_t> calculate_squashed_or_max_window(const ITensorInfo &sr
  */
 std::pair<Window, size_t> calculate_squashed_or_max_window(const ITensorInfo &src0, const ITensorInfo &src1);
 
+/** Calculate the squashed or collapsed window of a broadcast elementwise operation.
+ *
+ * On top of the squashing of @ref calculate_squashed_or_max_window, it handles the common broadcast patterns:
+ * - When one of the inputs holds a single value and the other input and the destination are contiguous, all the
+ *   dimensions are squashed into the x-dimension and the single value is applied to the whole 1D array.
+ * - Otherwise, the dimensions from the y-dimension upwards over which each input is either read in full from
+ *   contiguous memory or broadcast are collapsed into the y-dimension. One row per channel vector or per value of
+ *   a row broadcast thus covers all the collapsed dimensions.
+ *
+ * The broadcast inputs are expected to be handled with @ref Window::broadcast_if_dimension_le_one.
+ *
+ * @param[in] src0 Tensor info object of the first input tensor.
+ * @param[in] src1 Tensor info object of the second input tensor.
+ * @param[in] dst  Tensor info object of the destination tensor, with the broadcast shape of the inputs.
+ *
+ * @return The squashed, collapsed or maximum window the kernel can be executed on and the preferred split dimension.
+ */
+std::pair<Window, size_t>
+calculate_squashed_or_collapsed_window(const ITensorInfo &src0, const ITensorInfo &src1, const ITensorInfo &dst);
+
 /** Function to compute the shape of output and window for the given inputs
  *
  * @param[in] infos Input tensor informations
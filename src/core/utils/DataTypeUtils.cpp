@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,6 +51,8 @@ const std::string &string_from_data_type(DataType dt)
         {DataType::QSYMM16, "QSYMM16"},
         {DataType::QASYMM16, "QASYMM16"},
         {DataType::BFLOAT16, "BFLOAT16"},
+        {DataType::FP8_E4M3, "FP8_E4M3"},
+        {DataType::FP8_E5M2, "FP8_E5M2"},
     };
 
     return dt_map[dt];
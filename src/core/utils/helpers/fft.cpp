@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020 Arm Limited.
+ * Copyright (c) 2019-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,10 @@
  */
 #include "src/core/utils/helpers/fft.h"
 
+#include "support/Mutex.h"
+
+#include <cmath>
+#include <map>
 #include <numeric>
 
 namespace arm_compute
@@ -120,6 +124,28 @@ std::vector<unsigned int> digit_reverse_indices(unsigned int N, const std::vecto
 
     return idx_digit_reverse;
 }
+
+const std::vector<float> &twiddle_factors(unsigned int N)
+{
+    static std::map<unsigned int, std::vector<float>> tables;
+    static arm_compute::Mutex                         mtx;
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(mtx);
+
+    auto it = tables.find(N);
+    if (it == tables.end())
+    {
+        std::vector<float> table(2 * N);
+        const double       alpha = 2.0 * M_PI / static_cast<double>(N);
+        for (unsigned int j = 0; j < N; ++j)
+        {
+            table[2 * j]     = static_cast<float>(std::cos(alpha * j));
+            table[2 * j + 1] = static_cast<float>(-std::sin(alpha * j));
+        }
+        it = tables.emplace(N, std::move(table)).first;
+    }
+    return it->second;
+}
 } // namespace fft
 } // namespace helpers
 } // namespace arm_compute
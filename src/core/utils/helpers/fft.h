@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020 Arm Limited.
+ * Copyright (c) 2019-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,16 @@ std::vector<unsigned int> decompose_stages(unsigned int N, const std::set<unsign
  * @return A vector with the digit reverse indices. Will be empty if it failed.
  */
 std::vector<unsigned int> digit_reverse_indices(unsigned int N, const std::vector<unsigned int> &fft_stages);
+/** Get the twiddle factors of a radix stage
+ *
+ * The table holds the N complex values exp(-2 * pi * i * j / N), j in [0, N), as interleaved real and imaginary parts.
+ * Tables are computed once in double precision and shared by all the FFTs of the same size.
+ *
+ * @param N Number of points of the radix stage, i.e. radix times the span of the previous stages
+ *
+ * @return The table of twiddle factors. The reference stays valid for the lifetime of the process.
+ */
+const std::vector<float> &twiddle_factors(unsigned int N);
 } // namespace fft
 } // namespace helpers
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2024 Arm Limited.
+ * Copyright (c) 2018-2020, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -187,6 +187,37 @@ TensorShape compute_strided_slice_output_shape(TensorShape input_shape,
     return output_shape;
 }
 
+bool is_strided_slice_view(TensorShape  input_shape,
+                           Coordinates  starts,
+                           Coordinates  ends,
+                           Coordinates  strides,
+                           int32_t      begin_mask,
+                           int32_t      end_mask,
+                           int32_t      shrink_axis_mask,
+                           Coordinates &view_coords)
+{
+    Coordinates starts_abs{};
+    Coordinates ends_abs{};
+    Coordinates final_strides{};
+    std::tie(starts_abs, ends_abs, final_strides) =
+        calculate_strided_slice_coords(input_shape, starts, ends, strides, begin_mask, end_mask, shrink_axis_mask);
+
+    // Dropping a dimension only keeps the layout of the others if no kept dimension is above it
+    bool has_kept_outer_dimension = false;
+    for (int i = static_cast<int>(input_shape.num_dimensions()) - 1; i >= 0; --i)
+    {
+        const bool is_shrink = arm_compute::helpers::bit_ops::is_bit_set(shrink_axis_mask, i);
+        if (final_strides[i] != 1 || ends_abs[i] <= starts_abs[i] || (is_shrink && has_kept_outer_dimension))
+        {
+            return false;
+        }
+        has_kept_outer_dimension |= !is_shrink;
+    }
+
+    view_coords = starts_abs;
+    return true;
+}
+
 int32_t construct_slice_end_mask(Coordinates ends)
 {
     // Create end mask
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -66,6 +66,50 @@ public:
                                                           const AclTensorDescriptor     &dst,
                                                           const AclActivationDescriptor &act,
                                                           bool                           is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_gemm(const AclTensorDescriptor &a,
+                                                    const AclTensorDescriptor &b,
+                                                    const AclTensorDescriptor *c,
+                                                    const AclTensorDescriptor &d,
+                                                    const AclGemmDescriptor   &gemm,
+                                                    bool                       is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_matmul(const AclTensorDescriptor &lhs,
+                                                      const AclTensorDescriptor &rhs,
+                                                      const AclTensorDescriptor &dst,
+                                                      const AclMatMulDescriptor &matmul,
+                                                      bool                       is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_conv2d(const AclTensorDescriptor &src,
+                                                      const AclTensorDescriptor &weights,
+                                                      const AclTensorDescriptor *biases,
+                                                      const AclTensorDescriptor &dst,
+                                                      const AclConv2dDescriptor &conv,
+                                                      bool                       is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_depthwise_conv2d(const AclTensorDescriptor          &src,
+                                                                const AclTensorDescriptor          &weights,
+                                                                const AclTensorDescriptor          *biases,
+                                                                const AclTensorDescriptor          &dst,
+                                                                const AclDepthwiseConv2dDescriptor &conv,
+                                                                bool                                is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_pool2d(const AclTensorDescriptor &src,
+                                                      const AclTensorDescriptor &dst,
+                                                      const AclPool2dDescriptor &pool,
+                                                      bool                       is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_softmax(const AclTensorDescriptor  &src,
+                                                       const AclTensorDescriptor  &dst,
+                                                       const AclSoftmaxDescriptor &softmax,
+                                                       bool                        is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_elementwise(const AclTensorDescriptor      &src0,
+                                                           const AclTensorDescriptor      &src1,
+                                                           const AclTensorDescriptor      &dst,
+                                                           const AclElementwiseDescriptor &info,
+                                                           bool                            is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_quantize(const AclTensorDescriptor       &src,
+                                                        const AclTensorDescriptor       &dst,
+                                                        const AclQuantizationDescriptor &qinfo,
+                                                        bool                             is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_dequantize(const AclTensorDescriptor       &src,
+                                                          const AclTensorDescriptor       &dst,
+                                                          const AclQuantizationDescriptor &qinfo,
+                                                          bool                             is_validate) override;
 
 private:
     AllocatorWrapper _allocator;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,8 +23,14 @@
  */
 #include "src/cpu/CpuQueue.h"
 
+#include "arm_compute/core/Window.h"
 #include "arm_compute/runtime/Scheduler.h"
 
+#include "src/common/utils/Log.h"
+
+#include <algorithm>
+#include <utility>
+
 namespace arm_compute
 {
 namespace cpu
@@ -39,9 +45,65 @@ arm_compute::IScheduler &CpuQueue::scheduler()
     return arm_compute::Scheduler::get();
 }
 
-StatusCode CpuQueue::finish()
+void CpuQueue::schedule_op_async(ICPPKernel               *kernel,
+                                 const IScheduler::Hints &hints,
+                                 const Window            &window,
+                                 ITensorPack             &tensors)
+{
+    enqueue([this, kernel, hints, window, tensors]() mutable
+            { scheduler().schedule_op(kernel, hints, window, tensors); });
+}
+
+StatusCode CpuQueue::enqueue(std::function<void()> job)
 {
+#ifndef BARE_METAL
+    // Run on the scheduler bound to the submitting thread rather than on the worker's default one
+    IScheduler *bound_scheduler = &arm_compute::Scheduler::get();
+    auto        handle          = _worker.enqueue(
+        [bound_scheduler, job]()
+        {
+            ScopedScheduler scope(bound_scheduler);
+            job();
+        });
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    // Drop the handles that already completed so that the list does not grow in long running queues
+    _pending.erase(std::remove_if(_pending.begin(), _pending.end(),
+                                  [](const IScheduler::CompletionHandle &h) { return h.is_complete(); }),
+                   _pending.end());
+    _pending.emplace_back(std::move(handle));
     return StatusCode::Success;
+#else  /* BARE_METAL */
+    return IQueue::enqueue(std::move(job));
+#endif /* BARE_METAL */
+}
+
+StatusCode CpuQueue::finish()
+{
+    std::vector<IScheduler::CompletionHandle> pending;
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+        std::swap(pending, _pending);
+    }
+
+    StatusCode status = StatusCode::Success;
+    for (const auto &handle : pending)
+    {
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            handle.wait();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch (...)
+        {
+            ARM_COMPUTE_LOG_ERROR_WITH_FUNCNAME_ACL("Asynchronous kernel execution failed");
+            status = StatusCode::RuntimeError;
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+    }
+    return status;
 }
 } // namespace cpu
 } // namespace arm_compute
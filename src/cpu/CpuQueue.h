@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,12 +27,21 @@
 #include "arm_compute/runtime/IScheduler.h"
 
 #include "src/common/IQueue.h"
+#include "src/runtime/SchedulerAsyncQueue.h"
+#include "support/Mutex.h"
+
+#include <functional>
+#include <vector>
 
 namespace arm_compute
 {
 namespace cpu
 {
-/** CPU queue implementation class */
+/** CPU queue implementation class
+ *
+ * Work submitted to the queue is executed in submission order by a dedicated worker thread, so that the host thread
+ * can keep enqueueing while the operators run. @ref CpuQueue::finish is the synchronization point.
+ */
 class CpuQueue final : public IQueue
 {
 public:
@@ -47,9 +56,32 @@ public:
      * @return arm_compute::IScheduler&
      */
     arm_compute::IScheduler &scheduler();
+    /** Submit a kernel to the legacy scheduler without waiting for its completion
+     *
+     * The kernel is executed on the queue's worker, in order with the rest of the work submitted to the queue.
+     *
+     * @note The kernel and the tensors in the pack must remain valid until finish() has returned.
+     *
+     * @param[in] kernel  Kernel to execute.
+     * @param[in] hints   Hints for the scheduler.
+     * @param[in] window  Window to use for kernel execution.
+     * @param[in] tensors Tensors to operate on.
+     */
+    void schedule_op_async(ICPPKernel               *kernel,
+                           const IScheduler::Hints &hints,
+                           const Window            &window,
+                           ITensorPack             &tensors);
 
     // Inherited functions overridden
+    StatusCode enqueue(std::function<void()> job) override;
     StatusCode finish() override;
+
+private:
+    arm_compute::Mutex                        _mtx{};
+    std::vector<IScheduler::CompletionHandle> _pending{};
+#ifndef BARE_METAL
+    SchedulerAsyncQueue _worker{}; /**< Declared last so that pending work is drained before the members above go */
+#endif /* BARE_METAL */
 };
 } // namespace cpu
 } // namespace arm_compute
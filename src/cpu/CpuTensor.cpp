@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -65,7 +65,12 @@ StatusCode CpuTensor::unmap()
 StatusCode CpuTensor::import(void *handle, ImportMemoryType type)
 {
     ARM_COMPUTE_ASSERT(_legacy_tensor.get() != nullptr);
-    ARM_COMPUTE_UNUSED(type);
+
+    if (type != ImportMemoryType::HostPtr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("[CpuTensor:import]: Only host memory can be imported!");
+        return StatusCode::UnsupportedConfig;
+    }
 
     const auto st = _legacy_tensor->allocator()->import_memory(handle);
     return bool(st) ? StatusCode::Success : StatusCode::RuntimeError;
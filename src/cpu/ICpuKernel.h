@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,6 +43,9 @@ class ICpuKernel : public ICPPKernel
 {
 public:
     /** Micro-kernel selector
+     *
+     * The micro-kernels are listed by Derived::get_available_kernels(), which builds its table on first use so that
+     * loading the library does not construct the tables of kernels an application never runs.
      *
      * @param[in] selector       Selection struct passed including information to help pick the appropriate micro-kernel
      * @param[in] selection_type (Optional) Decides whether to get the best implementation for the given hardware or for the given build
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -54,6 +54,12 @@ static const std::array<ActivationLayerInfo::ActivationFunction, 8> qasymm8_acti
     ActivationLayerInfo::ActivationFunction::LEAKY_RELU,   ActivationLayerInfo::ActivationFunction::GELU,
 };
 
+#ifdef __aarch64__
+/* Activations only supported in the 8-bit integer domain through a lookup table */
+static const std::array<ActivationLayerInfo::ActivationFunction, 2> qasymm8_lut_activations = {
+    ActivationLayerInfo::ActivationFunction::ELU, ActivationLayerInfo::ActivationFunction::SWISH};
+#endif // __aarch64__
+
 /* Static quantization can only, currently, support relu based activations */
 static const std::array<ActivationLayerInfo::ActivationFunction, 3> qasymm8_static_quant_activations = {
     ActivationLayerInfo::ActivationFunction::RELU, ActivationLayerInfo::ActivationFunction::BOUNDED_RELU,
@@ -84,11 +90,16 @@ Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const
                        f_act) == std::end(qasymm8_static_quant_activations)),
         "For QASYMM8 statically quantized, only relu and lower/upper bounded relu are supported");
 
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(
-        is_data_type_quantized_asymmetric(data_type) &&
-            (std::find(std::begin(qasymm8_activations), std::end(qasymm8_activations), f_act) ==
-             std::end(qasymm8_activations)),
-        "For QASYMM8 only hard swish, leaky relu, tanh, logistic, relu and lower/upper bounded relu are supported");
+    bool is_qasymm8_supported = std::find(std::begin(qasymm8_activations), std::end(qasymm8_activations), f_act) !=
+                                std::end(qasymm8_activations);
+#ifdef __aarch64__
+    is_qasymm8_supported = is_qasymm8_supported ||
+                           std::find(std::begin(qasymm8_lut_activations), std::end(qasymm8_lut_activations), f_act) !=
+                               std::end(qasymm8_lut_activations);
+#endif // __aarch64__
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_data_type_quantized_asymmetric(data_type) && !is_qasymm8_supported,
+                                    "For QASYMM8 only hard swish, leaky relu, gelu, tanh, logistic, relu and "
+                                    "lower/upper bounded relu are supported, and elu and swish on aarch64");
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_data_type_quantized_symmetric(data_type) &&
                                         (std::find(std::begin(qsymm16_activations), std::end(qsymm16_activations),
@@ -232,9 +243,10 @@ void CpuActivationKernel::configure(const ITensorInfo *src, ITensorInfo *dst, Ac
         activation_info.setLookupTable256(tmp_lut);
     }
 
-    if (std::string(uk->name) == "sve_fp16_activation_lut")
+    const std::string uk_name = uk->name;
+    if (uk_name == "sve_fp16_activation_lut" || uk_name == "neon_fp16_activation_lut")
     {
-        // Create info using init list.
+        // The 65536 entries tables are shared by all the kernels with the same activation
         const LUTInfo info = {activation_info.activation(), activation_info.a(), activation_info.b(), src->data_type(),
                               src->quantization_info().uniform()};
         activation_info.setLookupTable65536((lut_manager.get_lut_table<LookupTable65536>(info)));
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, 2024 Arm Limited.
+ * Copyright (c) 2021-2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,66 +51,6 @@ namespace kernels
 {
 namespace
 {
-static const std::vector<CpuAddKernel::AddKernel> available_kernels = {
-    {"sme2_qs8_add_fixedpoint",
-     [](const CpuAddKernelDataTypeISASelectorData &data) {
-         return (data.dt == DataType::QASYMM8_SIGNED) && data.isa.sme2 && data.can_use_fixedpoint &&
-                data.can_use_sme2_impl;
-     },
-     REGISTER_QASYMM8_SIGNED_SME2(arm_compute::cpu::add_qasymm8_signed_sme2)},
-    {"neon_qu8_add_fixedpoint",
-     [](const CpuAddKernelDataTypeISASelectorData &data)
-     { return (data.dt == DataType::QASYMM8) && data.can_use_fixedpoint; },
-     REGISTER_FP32_NEON(arm_compute::cpu::add_q8_neon_fixedpoint<uint8_t>)},
-    {"neon_qs8_add_fixedpoint",
-     [](const CpuAddKernelDataTypeISASelectorData &data)
-     { return (data.dt == DataType::QASYMM8_SIGNED) && data.can_use_fixedpoint; },
-     REGISTER_FP32_NEON(arm_compute::cpu::add_q8_neon_fixedpoint<int8_t>)},
-    {"sve2_qu8_add",
-     [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8) && data.isa.sve2; },
-     REGISTER_QASYMM8_SVE2(arm_compute::cpu::add_qasymm8_sve2)},
-    {"sve2_qs8_add",
-     [](const CpuAddKernelDataTypeISASelectorData &data)
-     { return (data.dt == DataType::QASYMM8_SIGNED) && data.isa.sve2; },
-     REGISTER_QASYMM8_SIGNED_SVE2(arm_compute::cpu::add_qasymm8_signed_sve2)},
-    {"sve2_qs16_add",
-     [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::QSYMM16) && data.isa.sve2; },
-     REGISTER_QSYMM16_SVE2(arm_compute::cpu::add_qsymm16_sve2)},
-    {"sve_fp32_add",
-     [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::F32) && data.isa.sve; },
-     REGISTER_FP32_SVE(arm_compute::cpu::add_fp32_sve)},
-    {"sve_fp16_add",
-     [](const CpuAddKernelDataTypeISASelectorData &data)
-     { return (data.dt == DataType::F16) && data.isa.sve && data.isa.fp16; },
-     REGISTER_FP16_SVE(arm_compute::cpu::add_fp16_sve)},
-    {"sve_u8_add",
-     [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::U8) && data.isa.sve; },
-     REGISTER_INTEGER_SVE(arm_compute::cpu::add_u8_sve)},
-    {"sve_s16_add",
-     [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::S16) && data.isa.sve; },
-     REGISTER_INTEGER_SVE(arm_compute::cpu::add_s16_sve)},
-    {"sve_s32_add",
-     [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::S32) && data.isa.sve; },
-     REGISTER_INTEGER_SVE(arm_compute::cpu::add_s32_sve)},
-    {"neon_fp32_add", [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
-     REGISTER_FP32_NEON(arm_compute::cpu::add_fp32_neon)},
-    {"neon_fp16_add",
-     [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
-     REGISTER_FP16_NEON(arm_compute::cpu::add_fp16_neon)},
-    {"neon_u8_add", [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::U8); },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::add_u8_neon)},
-    {"neon_s16_add", [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::S16); },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::add_s16_neon)},
-    {"neon_s32_add", [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::S32); },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::add_s32_neon)},
-    {"neon_qu8_add", [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8); },
-     REGISTER_QASYMM8_NEON(arm_compute::cpu::add_qasymm8_neon)},
-    {"neon_qs8_add",
-     [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8_SIGNED); },
-     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::add_qasymm8_signed_neon)},
-    {"neon_qs16_add", [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::QSYMM16); },
-     REGISTER_QSYMM16_NEON(arm_compute::cpu::add_qsymm16_neon)}};
-
 Status
 validate_arguments(const ITensorInfo &src0, const ITensorInfo &src1, const ITensorInfo &dst, ConvertPolicy policy)
 {
@@ -183,7 +123,7 @@ void CpuAddKernel::configure(const ITensorInfo *src0, const ITensorInfo *src1, I
 
     // Configure kernel window
     Window win;
-    std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src0, *src1);
+    std::tie(win, _split_dimension) = calculate_squashed_or_collapsed_window(*src0, *src1, *dst);
 
     ICpuKernel::configure(win);
 }
@@ -220,6 +160,68 @@ const char *CpuAddKernel::name() const
 
 const std::vector<CpuAddKernel::AddKernel> &CpuAddKernel::get_available_kernels()
 {
+    static const std::vector<AddKernel> available_kernels = {
+        {"sme2_qs8_add_fixedpoint",
+         [](const CpuAddKernelDataTypeISASelectorData &data) {
+             return (data.dt == DataType::QASYMM8_SIGNED) && data.isa.sme2 && data.can_use_fixedpoint &&
+                    data.can_use_sme2_impl;
+         },
+         REGISTER_QASYMM8_SIGNED_SME2(arm_compute::cpu::add_qasymm8_signed_sme2)},
+        {"neon_qu8_add_fixedpoint",
+         [](const CpuAddKernelDataTypeISASelectorData &data)
+         { return (data.dt == DataType::QASYMM8) && data.can_use_fixedpoint; },
+         REGISTER_FP32_NEON(arm_compute::cpu::add_q8_neon_fixedpoint<uint8_t>)},
+        {"neon_qs8_add_fixedpoint",
+         [](const CpuAddKernelDataTypeISASelectorData &data)
+         { return (data.dt == DataType::QASYMM8_SIGNED) && data.can_use_fixedpoint; },
+         REGISTER_FP32_NEON(arm_compute::cpu::add_q8_neon_fixedpoint<int8_t>)},
+        {"sve2_qu8_add",
+         [](const CpuAddKernelDataTypeISASelectorData &data)
+         { return (data.dt == DataType::QASYMM8) && data.isa.sve2; },
+         REGISTER_QASYMM8_SVE2(arm_compute::cpu::add_qasymm8_sve2)},
+        {"sve2_qs8_add",
+         [](const CpuAddKernelDataTypeISASelectorData &data)
+         { return (data.dt == DataType::QASYMM8_SIGNED) && data.isa.sve2; },
+         REGISTER_QASYMM8_SIGNED_SVE2(arm_compute::cpu::add_qasymm8_signed_sve2)},
+        {"sve2_qs16_add",
+         [](const CpuAddKernelDataTypeISASelectorData &data)
+         { return (data.dt == DataType::QSYMM16) && data.isa.sve2; },
+         REGISTER_QSYMM16_SVE2(arm_compute::cpu::add_qsymm16_sve2)},
+        {"sve_fp32_add",
+         [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::F32) && data.isa.sve; },
+         REGISTER_FP32_SVE(arm_compute::cpu::add_fp32_sve)},
+        {"sve_fp16_add",
+         [](const CpuAddKernelDataTypeISASelectorData &data)
+         { return (data.dt == DataType::F16) && data.isa.sve && data.isa.fp16; },
+         REGISTER_FP16_SVE(arm_compute::cpu::add_fp16_sve)},
+        {"sve_u8_add",
+         [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::U8) && data.isa.sve; },
+         REGISTER_INTEGER_SVE(arm_compute::cpu::add_u8_sve)},
+        {"sve_s16_add",
+         [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::S16) && data.isa.sve; },
+         REGISTER_INTEGER_SVE(arm_compute::cpu::add_s16_sve)},
+        {"sve_s32_add",
+         [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::S32) && data.isa.sve; },
+         REGISTER_INTEGER_SVE(arm_compute::cpu::add_s32_sve)},
+        {"neon_fp32_add", [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+         REGISTER_FP32_NEON(arm_compute::cpu::add_fp32_neon)},
+        {"neon_fp16_add",
+         [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::add_fp16_neon)},
+        {"neon_u8_add", [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::U8); },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::add_u8_neon)},
+        {"neon_s16_add", [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::S16); },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::add_s16_neon)},
+        {"neon_s32_add", [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::S32); },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::add_s32_neon)},
+        {"neon_qu8_add", [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8); },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::add_qasymm8_neon)},
+        {"neon_qs8_add",
+         [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8_SIGNED); },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::add_qasymm8_signed_neon)},
+        {"neon_qs16_add",
+         [](const CpuAddKernelDataTypeISASelectorData &data) { return (data.dt == DataType::QSYMM16); },
+         REGISTER_QSYMM16_NEON(arm_compute::cpu::add_qsymm16_neon)}};
     return available_kernels;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,20 +41,6 @@ namespace kernels
 {
 namespace
 {
-static const std::vector<CpuAddMulAddKernel::AddMulAddKernel> available_kernels = {
-#ifdef __aarch64__
-    {"neon_fp32_add_mul_add", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
-     REGISTER_FP32_NEON(arm_compute::cpu::add_mul_add_fp32_neon)},
-    {"neon_fp16_add_mul_add", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16); },
-     REGISTER_FP16_NEON(arm_compute::cpu::add_mul_add_fp16_neon)},
-    {"neon_qasymm8_add_mul_add", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8); },
-     REGISTER_QASYMM8_NEON(arm_compute::cpu::add_mul_add_u8_neon)},
-    {"neon_qasymm8_signed_add_mul_add",
-     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8_SIGNED); },
-     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::add_mul_add_s8_neon)}
-#endif // __aarch64__
-};
-
 Status validate_arguments(const ITensorInfo         *input1,
                           const ITensorInfo         *input2,
                           const ITensorInfo         *bn_mul,
@@ -202,6 +188,19 @@ const char *CpuAddMulAddKernel::name() const
 
 const std::vector<CpuAddMulAddKernel::AddMulAddKernel> &CpuAddMulAddKernel::get_available_kernels()
 {
+    static const std::vector<AddMulAddKernel> available_kernels = {
+#ifdef __aarch64__
+        {"neon_fp32_add_mul_add", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+         REGISTER_FP32_NEON(arm_compute::cpu::add_mul_add_fp32_neon)},
+        {"neon_fp16_add_mul_add", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16); },
+         REGISTER_FP16_NEON(arm_compute::cpu::add_mul_add_fp16_neon)},
+        {"neon_qasymm8_add_mul_add", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8); },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::add_mul_add_u8_neon)},
+        {"neon_qasymm8_signed_add_mul_add",
+         [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8_SIGNED); },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::add_mul_add_s8_neon)}
+#endif // __aarch64__
+    };
     return available_kernels;
 }
 } // namespace kernels
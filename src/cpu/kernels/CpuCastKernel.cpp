@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024 Arm Limited.
+ * Copyright (c) 2016-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,6 +39,10 @@
 #include "src/cpu/kernels/cast/list.h"
 #include "support/SaturateCast.h"
 
+#include <cmath>
+#include <limits>
+#include <tuple>
+
 namespace arm_compute
 {
 namespace cpu
@@ -47,33 +51,28 @@ namespace kernels
 {
 namespace
 {
-static const std::vector<CpuCastKernel::CastKernel> available_kernels = {
-    {"neon_qs8_cast",
-     [](const CastDataTypeISASelectorData &data)
-     { return data.src_dt == DataType::QASYMM8_SIGNED && data.dst_dt == DataType::F16 && data.isa.fp16; },
-     REGISTER_FP16_NEON(arm_compute::cpu::neon_qasymm8_signed_to_fp16_cast)},
-    {"neon_qu8_cast",
-     [](const CastDataTypeISASelectorData &data)
-     { return data.src_dt == DataType::QASYMM8 && data.dst_dt == DataType::F16 && data.isa.fp16; },
-     REGISTER_FP16_NEON(arm_compute::cpu::neon_u8_to_fp16_cast)},
-    {"neon_u8_cast",
-     [](const CastDataTypeISASelectorData &data)
-     { return data.src_dt == DataType::U8 && data.dst_dt == DataType::F16 && data.isa.fp16; },
-     REGISTER_FP16_NEON(arm_compute::cpu::neon_u8_to_fp16_cast)},
-    {"neon_fp16_cast",
-     [](const CastDataTypeISASelectorData &data) { return data.src_dt == DataType::F16 && data.isa.fp16; },
-     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_to_other_dt_cast)},
-    {"neon_fp32_to_fp16_cast",
-     [](const CastDataTypeISASelectorData &data)
-     { return data.src_dt == DataType::F32 && data.dst_dt == DataType::F16 && data.isa.fp16; },
-     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp32_to_fp16_cast)},
-    {"neon_s32_cast",
-     [](const CastDataTypeISASelectorData &data)
-     { return data.src_dt == DataType::S32 && data.dst_dt == DataType::F16 && data.isa.fp16; },
-     REGISTER_FP16_NEON(arm_compute::cpu::neon_s32_to_fp16_cast)},
-};
-
-Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, ConvertPolicy policy)
+/** Whether the conversion can go through F32 lanes, which is also where a scale and offset can be fused */
+bool is_f32_lanes_cast(DataType src_dt, DataType dst_dt)
+{
+    const auto is_f32_lanes_other = [](DataType dt)
+    {
+        return dt == DataType::S32 || dt == DataType::U8 || dt == DataType::QASYMM8 ||
+               dt == DataType::QASYMM8_SIGNED;
+    };
+    return (src_dt == DataType::F32 && is_f32_lanes_other(dst_dt)) ||
+           (dst_dt == DataType::F32 && is_f32_lanes_other(src_dt));
+}
+
+/** Whether the conversion is between an FP8 type and F32 or F16 */
+bool is_fp8_cast(DataType src_dt, DataType dst_dt)
+{
+    const auto is_fp8   = [](DataType dt) { return dt == DataType::FP8_E4M3 || dt == DataType::FP8_E5M2; };
+    const auto is_float = [](DataType dt) { return dt == DataType::F32 || dt == DataType::F16; };
+    return (is_fp8(src_dt) && is_float(dst_dt)) || (is_float(src_dt) && is_fp8(dst_dt));
+}
+
+Status validate_arguments(
+    const ITensorInfo *src, const ITensorInfo *dst, ConvertPolicy policy, float scale, float offset)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(dst);
@@ -82,11 +81,13 @@ Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, Conver
 #ifdef __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8_SIGNED, DataType::QASYMM8,
                                                          DataType::U8, DataType::S16, DataType::U16, DataType::F16,
-                                                         DataType::F32, DataType::S32, DataType::S64, DataType::U64);
+                                                         DataType::F32, DataType::S32, DataType::S64, DataType::U64,
+                                                         DataType::FP8_E4M3, DataType::FP8_E5M2);
 
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::QASYMM8_SIGNED, DataType::QASYMM8,
                                                          DataType::U8, DataType::S16, DataType::U16, DataType::F16,
-                                                         DataType::U32, DataType::S32, DataType::F32, DataType::S64);
+                                                         DataType::U32, DataType::S32, DataType::F32, DataType::S64,
+                                                         DataType::FP8_E4M3, DataType::FP8_E5M2);
 
 #else  // __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8_SIGNED, DataType::QASYMM8,
@@ -125,16 +126,18 @@ Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, Conver
                                     "Only data_types supported [in] S16 ->  [out] U8, S32");
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_type() == DataType::F16 &&
+                                        !is_fp8_cast(src->data_type(), dst->data_type()) &&
                                         (dst->data_type() != DataType::QASYMM8_SIGNED &&
                                          dst->data_type() != DataType::QASYMM8 && dst->data_type() != DataType::U8 &&
                                          dst->data_type() != DataType::F32 && dst->data_type() != DataType::S32),
-                                    "Only data_types supported [in] F16 ->  [out] QASYMM8, F32, S32, U8");
+                                    "Only data_types supported [in] F16 ->  [out] QASYMM8, F32, S32, U8, FP8");
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_type() == DataType::F32 &&
+                                        !is_fp8_cast(src->data_type(), dst->data_type()) &&
                                         (dst->data_type() != DataType::QASYMM8_SIGNED &&
                                          dst->data_type() != DataType::QASYMM8 && dst->data_type() != DataType::F16 &&
                                          dst->data_type() != DataType::S32 && dst->data_type() != DataType::U8),
-                                    "Only data_types supported [in] F32 ->  [out] QASYMM8, F16, S32, U8");
+                                    "Only data_types supported [in] F32 ->  [out] QASYMM8, F16, S32, U8, FP8");
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_type() == DataType::S32 &&
                                         (dst->data_type() != DataType::QASYMM8_SIGNED &&
@@ -148,8 +151,19 @@ Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, Conver
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_type() == DataType::U64 && dst->data_type() != DataType::F32,
                                     "Only data_types supported [in] U64 ->  [out] F32");
+
+    const bool has_fp8 = src->data_type() == DataType::FP8_E4M3 || src->data_type() == DataType::FP8_E5M2 ||
+                         dst->data_type() == DataType::FP8_E4M3 || dst->data_type() == DataType::FP8_E5M2;
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(has_fp8 && !is_fp8_cast(src->data_type(), dst->data_type()),
+                                    "Only data_types supported [in] FP8 ->  [out] F16, F32 and "
+                                    "[in] F16, F32 ->  [out] FP8");
 #endif // __aarch64__
 
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((scale != 1.f || offset != 0.f) &&
+                                        !is_f32_lanes_cast(src->data_type(), dst->data_type()),
+                                    "A scale or offset is only supported when casting F32 to or from "
+                                    "QASYMM8_SIGNED, QASYMM8, U8, S32");
+
     // Validate in case of configured dst
     if (dst->total_size() > 0)
     {
@@ -160,7 +174,8 @@ Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, Conver
 }
 } // namespace
 
-void CpuCastKernel::configure(const ITensorInfo *src, ITensorInfo *dst, ConvertPolicy policy)
+void CpuCastKernel::configure(
+    const ITensorInfo *src, ITensorInfo *dst, ConvertPolicy policy, float scale, float offset)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
 
@@ -168,18 +183,27 @@ void CpuCastKernel::configure(const ITensorInfo *src, ITensorInfo *dst, ConvertP
     set_shape_if_empty(*dst, src->tensor_shape());
 
     _policy = policy;
+    _scale  = scale;
+    _offset = offset;
 
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, policy));
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, policy, scale, offset));
 
-    // Configure kernel window
-    Window win = calculate_max_window(*src, Steps());
+    // Configure kernel window, contiguous tensors are processed as a single row
+    Window win;
+    std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src);
+    if (_split_dimension == Window::DimX && calculate_squashed_or_max_window(*dst).second != Window::DimX)
+    {
+        win              = calculate_max_window(*src, Steps());
+        _split_dimension = Window::DimY;
+    }
 
     ICPPKernel::configure(win);
 }
 
-Status CpuCastKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, ConvertPolicy policy)
+Status CpuCastKernel::validate(
+    const ITensorInfo *src, const ITensorInfo *dst, ConvertPolicy policy, float scale, float offset)
 {
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, policy));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, policy, scale, offset));
     return Status{};
 }
 #ifdef __aarch64__
@@ -247,7 +271,7 @@ template <typename T1, typename T2>
 inline void
 convert64(Iterator &src, Iterator &dst, const Window &win, int window_start_x, int window_end_x, int window_step_x)
 {
-    execute_window_loop(
+    execute_window_loop_dims<3>(
         win,
         [&](const Coordinates &)
         {
@@ -268,6 +292,101 @@ convert64(Iterator &src, Iterator &dst, const Window &win, int window_start_x, i
 } // namespace
 #endif // __aarch64__
 
+namespace
+{
+template <typename T>
+inline T round_and_saturate(float v)
+{
+    // Compare in F32 first so that the conversion of the rounded value cannot overflow
+    if (v >= static_cast<float>(std::numeric_limits<T>::max()))
+    {
+        return std::numeric_limits<T>::max();
+    }
+    if (v <= static_cast<float>(std::numeric_limits<T>::lowest()))
+    {
+        return std::numeric_limits<T>::lowest();
+    }
+    return static_cast<T>(std::round(v));
+}
+
+template <>
+inline float round_and_saturate<float>(float v)
+{
+    return v;
+}
+
+template <typename TIn, typename TOut>
+void affine_cast(const ITensor *src, ITensor *dst, float scale, float offset, const Window &window)
+{
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    Window win = window.collapse_if_possible(window, Window::DimZ);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(src, win);
+    Iterator output(dst, win);
+
+    execute_window_loop_dims<3>(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto src_ptr = reinterpret_cast<const TIn *>(input.ptr());
+            const auto dst_ptr = reinterpret_cast<TOut *>(output.ptr());
+
+            for (int x = window_start_x; x < window_end_x; ++x)
+            {
+                dst_ptr[x] = round_and_saturate<TOut>(static_cast<float>(src_ptr[x]) * scale + offset);
+            }
+        },
+        input, output);
+}
+
+/** Cast with a fused scale and offset when no vector-length-agnostic kernel is available */
+void run_affine_cast(const ITensor *src, ITensor *dst, float scale, float offset, const Window &window)
+{
+    const DataType src_dt = src->info()->data_type();
+    const DataType dst_dt = dst->info()->data_type();
+
+    if (src_dt == DataType::F32)
+    {
+        switch (dst_dt)
+        {
+            case DataType::S32:
+                affine_cast<float, int32_t>(src, dst, scale, offset, window);
+                break;
+            case DataType::QASYMM8:
+            case DataType::U8:
+                affine_cast<float, uint8_t>(src, dst, scale, offset, window);
+                break;
+            case DataType::QASYMM8_SIGNED:
+                affine_cast<float, int8_t>(src, dst, scale, offset, window);
+                break;
+            default:
+                ARM_COMPUTE_ERROR("dst data type not supported");
+        }
+    }
+    else
+    {
+        switch (src_dt)
+        {
+            case DataType::S32:
+                affine_cast<int32_t, float>(src, dst, scale, offset, window);
+                break;
+            case DataType::QASYMM8:
+            case DataType::U8:
+                affine_cast<uint8_t, float>(src, dst, scale, offset, window);
+                break;
+            case DataType::QASYMM8_SIGNED:
+                affine_cast<int8_t, float>(src, dst, scale, offset, window);
+                break;
+            default:
+                ARM_COMPUTE_ERROR("src data type not supported");
+        }
+    }
+}
+} // namespace
+
 void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_UNUSED(info);
@@ -285,7 +404,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
 
     ARM_COMPUTE_ERROR_ON_NULLPTR(_src, _dst);
 
-    Window win{window};
+    Window win = window.collapse_if_possible(window, Window::DimZ);
     win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator src(_src, win);
@@ -295,6 +414,26 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
     const auto *uk = CpuCastKernel::get_implementation(
         CastDataTypeISASelectorData{_src->info()->data_type(), _dst->info()->data_type(), CPUInfo::get().get_isa()});
 
+    if (is_fp8_cast(_src->info()->data_type(), _dst->info()->data_type()))
+    {
+        ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+        uk->ukernel(_src, _dst, info, _policy, _scale, _offset, window);
+        return;
+    }
+    if (is_f32_lanes_cast(_src->info()->data_type(), _dst->info()->data_type()))
+    {
+        if (uk != nullptr && uk->ukernel != nullptr)
+        {
+            uk->ukernel(_src, _dst, info, _policy, _scale, _offset, window);
+            return;
+        }
+        if (_scale != 1.f || _offset != 0.f)
+        {
+            run_affine_cast(_src, _dst, _scale, _offset, window);
+            return;
+        }
+    }
+
     switch (_src->info()->data_type())
     {
 #ifdef __aarch64__
@@ -335,7 +474,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                 case DataType::S16:
                 {
                     /* Up-conversion QASYMM8_SIGNED -> S16 */
-                    execute_window_loop(
+                    execute_window_loop_dims<3>(
                         win,
                         [&](const Coordinates &)
                         {
@@ -366,7 +505,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                 case DataType::S32:
                 {
                     /* Up-conversion QASYMM8_SIGNED -> S32 */
-                    execute_window_loop(
+                    execute_window_loop_dims<3>(
                         win,
                         [&](const Coordinates &)
                         {
@@ -399,7 +538,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                 case DataType::F32:
                 {
                     /* Up-conversion QASYMM8_SIGNED -> F32 */
-                    execute_window_loop(
+                    execute_window_loop_dims<3>(
                         win,
                         [&](const Coordinates &)
                         {
@@ -432,7 +571,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                 {
                     /* Up-conversion QASYMM8_SIGNED -> F16 */
                     ARM_COMPUTE_ERROR_ON(uk->ukernel == nullptr);
-                    uk->ukernel(_src, _dst, info, _policy, window);
+                    uk->ukernel(_src, _dst, info, _policy, _scale, _offset, window);
                     break;
                 }
                 default:
@@ -449,7 +588,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                 case DataType::S16:
                 {
                     /* Up-conversion U8 -> S16 */
-                    execute_window_loop(
+                    execute_window_loop_dims<3>(
                         win,
                         [&](const Coordinates &)
                         {
@@ -480,7 +619,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                 case DataType::S32:
                 {
                     /* Up-conversion U8 -> S32 */
-                    execute_window_loop(
+                    execute_window_loop_dims<3>(
                         win,
                         [&](const Coordinates &)
                         {
@@ -513,7 +652,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                 case DataType::F32:
                 {
                     /* Up-conversion U8 -> F32 */
-                    execute_window_loop(
+                    execute_window_loop_dims<3>(
                         win,
                         [&](const Coordinates &)
                         {
@@ -546,13 +685,13 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                 {
                     /* Up-conversion U8 -> FP16 */
                     ARM_COMPUTE_ERROR_ON(uk->ukernel == nullptr);
-                    uk->ukernel(_src, _dst, info, _policy, window);
+                    uk->ukernel(_src, _dst, info, _policy, _scale, _offset, window);
                     break;
                 }
                 case DataType::U16:
                 {
                     /* Up-conversion U8 -> U16 */
-                    execute_window_loop(
+                    execute_window_loop_dims<3>(
                         win,
                         [&](const Coordinates &)
                         {
@@ -594,7 +733,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                     /* Down-conversion S16 -> QASYMM8_SIGNED */
                     if (ConvertPolicy::SATURATE == _policy)
                     {
-                        execute_window_loop(
+                        execute_window_loop_dims<3>(
                             win,
                             [&](const Coordinates &)
                             {
@@ -620,7 +759,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                     }
                     else
                     {
-                        execute_window_loop(
+                        execute_window_loop_dims<3>(
                             win,
                             [&](const Coordinates &)
                             {
@@ -651,7 +790,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                     /* Down-conversion S16 -> U8 */
                     if (ConvertPolicy::SATURATE == _policy)
                     {
-                        execute_window_loop(
+                        execute_window_loop_dims<3>(
                             win,
                             [&](const Coordinates &)
                             {
@@ -677,7 +816,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                     }
                     else
                     {
-                        execute_window_loop(
+                        execute_window_loop_dims<3>(
                             win,
                             [&](const Coordinates &)
                             {
@@ -706,7 +845,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                 case DataType::S32:
                 {
                     /* Up-conversion S16 -> S32 */
-                    execute_window_loop(
+                    execute_window_loop_dims<3>(
                         win,
                         [&](const Coordinates &)
                         {
@@ -752,7 +891,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                     /* Down-conversion U16 -> U8 */
                     if (ConvertPolicy::SATURATE == _policy)
                     {
-                        execute_window_loop(
+                        execute_window_loop_dims<3>(
                             win,
                             [&](const Coordinates &)
                             {
@@ -778,7 +917,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                     }
                     else
                     {
-                        execute_window_loop(
+                        execute_window_loop_dims<3>(
                             win,
                             [&](const Coordinates &)
                             {
@@ -807,7 +946,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                 case DataType::U32:
                 {
                     /* Up-conversion U16 -> U32 */
-                    execute_window_loop(
+                    execute_window_loop_dims<3>(
                         win,
                         [&](const Coordinates &)
                         {
@@ -842,7 +981,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
         {
             /* conversion F16 -> any data type */
             ARM_COMPUTE_ERROR_ON(uk->ukernel == nullptr);
-            uk->ukernel(_src, _dst, info, _policy, window);
+            uk->ukernel(_src, _dst, info, _policy, _scale, _offset, window);
             break;
         }
         case DataType::F32:
@@ -852,13 +991,13 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                 {
                     /* Down-conversion F32 -> F16 */
                     ARM_COMPUTE_ERROR_ON(uk->ukernel == nullptr);
-                    uk->ukernel(_src, _dst, info, _policy, window);
+                    uk->ukernel(_src, _dst, info, _policy, _scale, _offset, window);
                     break;
                 }
                 case DataType::S32:
                 {
                     /* Conversion F32 -> S32 */
-                    execute_window_loop(
+                    execute_window_loop_dims<3>(
                         win,
                         [&](const Coordinates &)
                         {
@@ -894,7 +1033,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                 case DataType::U8:
                 {
                     /* Down-conversion F32 -> QASYMM8, U8 */
-                    execute_window_loop(
+                    execute_window_loop_dims<3>(
                         win,
                         [&](const Coordinates &)
                         {
@@ -931,7 +1070,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                 case DataType::QASYMM8_SIGNED:
                 {
                     /* Down-conversion F32 -> QASYMM8_SIGNED */
-                    execute_window_loop(
+                    execute_window_loop_dims<3>(
                         win,
                         [&](const Coordinates &)
                         {
@@ -983,13 +1122,13 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                 {
                     /* Down-conversion S32 -> F16 */
                     ARM_COMPUTE_ERROR_ON(uk->ukernel == nullptr);
-                    uk->ukernel(_src, _dst, info, _policy, window);
+                    uk->ukernel(_src, _dst, info, _policy, _scale, _offset, window);
                     break;
                 }
                 case DataType::F32:
                 {
                     /* Conversion S32 -> F32 */
-                    execute_window_loop(
+                    execute_window_loop_dims<3>(
                         win,
                         [&](const Coordinates &)
                         {
@@ -1026,7 +1165,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                     /* Down-conversion S32 -> QASYMM8_SIGNED */
                     if (ConvertPolicy::SATURATE == _policy)
                     {
-                        execute_window_loop(
+                        execute_window_loop_dims<3>(
                             win,
                             [&](const Coordinates &)
                             {
@@ -1058,7 +1197,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                     }
                     else
                     {
-                        execute_window_loop(
+                        execute_window_loop_dims<3>(
                             win,
                             [&](const Coordinates &)
                             {
@@ -1094,7 +1233,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                     /* Down-conversion S32 -> U8 */
                     if (ConvertPolicy::SATURATE == _policy)
                     {
-                        execute_window_loop(
+                        execute_window_loop_dims<3>(
                             win,
                             [&](const Coordinates &)
                             {
@@ -1123,7 +1262,7 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                     }
                     else
                     {
-                        execute_window_loop(
+                        execute_window_loop_dims<3>(
                             win,
                             [&](const Coordinates &)
                             {
@@ -1171,6 +1310,40 @@ const char *CpuCastKernel::name() const
 
 const std::vector<CpuCastKernel::CastKernel> &CpuCastKernel::get_available_kernels()
 {
+    static const std::vector<CastKernel> available_kernels = {
+#ifdef __aarch64__
+        {"neon_fp8_cast",
+         [](const CastDataTypeISASelectorData &data) { return is_fp8_cast(data.src_dt, data.dst_dt); },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp8_cast)},
+#endif // __aarch64__
+        {"sve_fp32_cast",
+         [](const CastDataTypeISASelectorData &data)
+         { return data.isa.sve && is_f32_lanes_cast(data.src_dt, data.dst_dt); },
+         REGISTER_FP32_SVE(arm_compute::cpu::sve_fp32_cast)},
+        {"neon_qs8_cast",
+         [](const CastDataTypeISASelectorData &data)
+         { return data.src_dt == DataType::QASYMM8_SIGNED && data.dst_dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_qasymm8_signed_to_fp16_cast)},
+        {"neon_qu8_cast",
+         [](const CastDataTypeISASelectorData &data)
+         { return data.src_dt == DataType::QASYMM8 && data.dst_dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_u8_to_fp16_cast)},
+        {"neon_u8_cast",
+         [](const CastDataTypeISASelectorData &data)
+         { return data.src_dt == DataType::U8 && data.dst_dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_u8_to_fp16_cast)},
+        {"neon_fp16_cast",
+         [](const CastDataTypeISASelectorData &data) { return data.src_dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_to_other_dt_cast)},
+        {"neon_fp32_to_fp16_cast",
+         [](const CastDataTypeISASelectorData &data)
+         { return data.src_dt == DataType::F32 && data.dst_dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp32_to_fp16_cast)},
+        {"neon_s32_cast",
+         [](const CastDataTypeISASelectorData &data)
+         { return data.src_dt == DataType::S32 && data.dst_dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_s32_to_fp16_cast)},
+    };
     return available_kernels;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,8 +40,8 @@ namespace kernels
 class CpuCastKernel : public ICpuKernel<CpuCastKernel>
 {
 private:
-    using CastKernelPtr =
-        std::add_pointer<void(const ITensor *, ITensor *, const ThreadInfo &, ConvertPolicy, const Window &)>::type;
+    using CastKernelPtr = std::add_pointer<void(
+        const ITensor *, ITensor *, const ThreadInfo &, ConvertPolicy, float, float, const Window &)>::type;
 
 public:
     CpuCastKernel() = default;
@@ -55,26 +55,45 @@ public:
      *   - U8             -> U16, S16, S32, F32, F16
      *   - U16            -> U8, U32
      *   - S16            -> QASYMM8_SIGNED, U8, S32
-     *   - F16            -> QASYMM8_SIGNED, QASYMM8, F32, S32, U8
+     *   - F16            -> QASYMM8_SIGNED, QASYMM8, F32, S32, U8, FP8_E4M3, FP8_E5M2
      *   - S32            -> QASYMM8_SIGNED, QASYMM8, F16, F32, U8
      *   - S64            -> F32
-     *   - F32            -> QASYMM8_SIGNED, QASYMM8, F16, S32, U8
+     *   - F32            -> QASYMM8_SIGNED, QASYMM8, F16, S32, U8, FP8_E4M3, FP8_E5M2
+     *   - FP8_E4M3       -> F16, F32
+     *   - FP8_E5M2       -> F16, F32
      *
      * @param[in]  src    The src tensor to convert. Data types supported: QASYMM8_SIGNED/QASYMM8/U8/U16/S16/S32/S64/F16/F32.
      * @param[out] dst    The dst tensor. Data types supported: QASYMM8_SIGNED/QASYMM8/U8/U16/S16/U32/S32/S64/F16/F32.
      * @param[in]  policy Conversion policy.
+     * @param[in]  scale  (Optional) Scale applied to the converted values, dst = src * scale + offset. Defaults to 1.
+     * @param[in]  offset (Optional) Offset added to the scaled values. Defaults to 0.
      *
-     * @note S64 is only supported in aarch64
+     * @note S64 and the FP8 types are only supported in aarch64
+     * @note Casting to FP8 rounds to nearest even. Values out of range saturate to the largest finite value with
+     *       ConvertPolicy::SATURATE, otherwise they become NaN for FP8_E4M3 and infinity for FP8_E5M2.
+     * @note A scale or offset is only supported when casting F32 to or from QASYMM8_SIGNED/QASYMM8/U8/S32.
+     *       The affine transform is computed in F32 and integer results are rounded to nearest before saturating.
      *
      */
-    void configure(const ITensorInfo *src, ITensorInfo *dst, ConvertPolicy policy);
+    void configure(
+        const ITensorInfo *src, ITensorInfo *dst, ConvertPolicy policy, float scale = 1.f, float offset = 0.f);
     /** Static function to check if given info will lead to a valid configuration
      *
      * Similar to @ref CpuCastKernel::configure()
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, ConvertPolicy policy);
+    static Status validate(
+        const ITensorInfo *src, const ITensorInfo *dst, ConvertPolicy policy, float scale = 1.f, float offset = 0.f);
+
+    /** Get the preferred dimension in which the scheduler splits the work into multiple jobs.
+     *
+     * @return The split dimension hint.
+     */
+    size_t get_split_dimension_hint() const
+    {
+        return _split_dimension;
+    }
 
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
@@ -91,6 +110,9 @@ public:
 
 private:
     ConvertPolicy _policy{ConvertPolicy::SATURATE};
+    float         _scale{1.f};
+    float         _offset{0.f};
+    size_t        _split_dimension{Window::DimY};
 };
 } // namespace kernels
 } // namespace cpu
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -44,6 +44,16 @@ namespace kernels
 {
 namespace
 {
+template <typename T>
+void col2im_row(const uint8_t *in_ptr, uint8_t *out_ptr, unsigned int num_channels, size_t output_stride_z)
+{
+    const T *in_row_ptr = reinterpret_cast<const T *>(in_ptr);
+    for (unsigned int c = 0; c < num_channels; ++c, out_ptr += output_stride_z)
+    {
+        *reinterpret_cast<T *>(out_ptr) = in_row_ptr[c];
+    }
+}
+
 Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const Size2D &convolved_dims)
 {
     //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use CPU FP16 instructions.
@@ -73,8 +83,9 @@ void CpuCol2ImKernel::configure(const ITensorInfo *src, ITensorInfo *dst, const
     // Output auto inizialitation if not yet initialized
     auto_init_if_empty(*dst, src->clone()->set_tensor_shape(compute_col2im_shape(*src, convolved_dims, false)));
 
-    // Configure kernel window
+    // Configure kernel window, each row of the input is moved in a single iteration
     Window win = calculate_max_window(*src, Steps());
+    win.set(Window::DimX, Window::Dimension(0, src->dimension(0), src->dimension(0)));
 
     ICpuKernel::configure(win);
 }
@@ -94,10 +105,31 @@ void CpuCol2ImKernel::run_op(ITensorPack &tensors, const Window &window, const T
     auto src = tensors.get_const_tensor(TensorType::ACL_SRC);
     auto dst = tensors.get_tensor(TensorType::ACL_DST);
 
-    const uint8_t el_size         = src->info()->element_size();
-    const int     output_stride_x = dst->info()->strides_in_bytes().x();
-    const int     output_stride_y = dst->info()->strides_in_bytes().y();
-    const int     output_stride_z = dst->info()->strides_in_bytes().z();
+    const unsigned int num_channels    = src->info()->dimension(0);
+    const int          output_stride_x = dst->info()->strides_in_bytes().x();
+    const int          output_stride_y = dst->info()->strides_in_bytes().y();
+    const size_t       output_stride_z = dst->info()->strides_in_bytes().z();
+
+    using Col2ImRowPtr       = void (*)(const uint8_t *, uint8_t *, unsigned int, size_t);
+    Col2ImRowPtr col2im_func = nullptr;
+    switch (src->info()->element_size())
+    {
+        case 1:
+            col2im_func = &col2im_row<uint8_t>;
+            break;
+        case 2:
+            col2im_func = &col2im_row<uint16_t>;
+            break;
+        case 4:
+            col2im_func = &col2im_row<uint32_t>;
+            break;
+        case 8:
+            col2im_func = &col2im_row<uint64_t>;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Element size not supported");
+            break;
+    }
 
     Window window_out(window);
     window_out.set(Window::DimX, Window::Dimension(0, 0, 0));
@@ -113,9 +145,9 @@ void CpuCol2ImKernel::run_op(ITensorPack &tensors, const Window &window, const T
         [&](const Coordinates &id)
         {
             const int hidx = id.y();
-            const int idx  = id.x() * output_stride_z + (hidx / _convolved_dims.width) * output_stride_y +
-                            (hidx % _convolved_dims.width) * output_stride_x;
-            std::memcpy(out.ptr() + idx, in.ptr(), el_size);
+            const int idx =
+                (hidx / _convolved_dims.width) * output_stride_y + (hidx % _convolved_dims.width) * output_stride_x;
+            col2im_func(in.ptr(), out.ptr() + idx, num_channels, output_stride_z);
         },
         in, out);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,9 @@
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/WindowHelpers.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace arm_compute
 {
 namespace cpu
@@ -63,7 +66,7 @@ std::pair<Status, Window> validate_and_configure_window(const ITensorInfo *src,
 {
     // Destination auto inizialitation if not yet initialized
     auto_init_if_empty(*dst, *src);
-    return std::make_pair(Status{}, calculate_max_window(*dst));
+    return std::make_pair(Status{}, calculate_squashed_or_max_window(*src, *dst).first);
 }
 
 std::pair<Status, Window>
@@ -98,6 +101,9 @@ void CpuCopyKernel::configure(const ITensorInfo *src, ITensorInfo *dst, const Pa
 
     ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
     ICpuKernel::configure(win_config.second);
+
+    // The window of contiguous tensors copied without padding is a single row, split along it
+    _split_dimension = padding.empty() ? calculate_squashed_or_max_window(*src, *dst).second : Window::DimY;
 }
 
 Status CpuCopyKernel::validate(const arm_compute::ITensorInfo *src,
@@ -130,21 +136,17 @@ void CpuCopyKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
 
     if (_padding.empty())
     {
-        Window dst_window{window};
-        dst_window.set(Window::DimX,
-                       Window::Dimension(dst_window.x().start(), dst_window.x().end(), src->info()->dimension(0)));
-        Window out_slice = dst_window.first_slice_window_1D();
-        do
-        {
-            Iterator src_it(src, out_slice);
-            Iterator dst_it(dst, out_slice);
-
-            execute_window_loop(
-                out_slice,
-                [&](const Coordinates &)
-                { memcpy(dst_it.ptr(), src_it.ptr(), dst->info()->dimension(0) * dst->info()->element_size()); },
-                src_it, dst_it);
-        } while (dst_window.slide_window_slice_1D(out_slice));
+        // Each row of the window is copied at once
+        const int row_size = window.x().end() - window.x().start();
+        Window    win      = window.collapse_if_possible(window, Window::DimZ);
+        win.set(Window::DimX, Window::Dimension(window.x().start(), window.x().end(), std::max(row_size, 1)));
+
+        Iterator     src_it(src, win);
+        Iterator     dst_it(dst, win);
+        const size_t row_size_in_bytes = row_size * dst->info()->element_size();
+        execute_window_loop_dims<3>(
+            win, [&](const Coordinates &) { std::memcpy(dst_it.ptr(), src_it.ptr(), row_size_in_bytes); }, src_it,
+            dst_it);
     }
     else
     {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024 Arm Limited.
+ * Copyright (c) 2019-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,31 +42,6 @@ namespace kernels
 {
 namespace
 {
-static const std::vector<CpuDepthwiseConv2dNativeKernel::DepthwiseConv2dNativeKernel> available_kernels = {
-    {"neon_qu8_deptwiseconv2dnative",
-     [](const DepthwiseConv2dNativeDataTypeISASelectorData &data) { return (data.weights_dt == DataType::QASYMM8); },
-     REGISTER_QASYMM8_NEON(neon_qu8_deptwiseconv2dnative)},
-    {"neon_qs8_deptwiseconv2dnative",
-     [](const DepthwiseConv2dNativeDataTypeISASelectorData &data)
-     { return (data.weights_dt == DataType::QASYMM8_SIGNED); },
-     REGISTER_QASYMM8_SIGNED_NEON(neon_qs8_deptwiseconv2dnative)},
-    {"neon_fp16_deptwiseconv2dnative",
-     [](const DepthwiseConv2dNativeDataTypeISASelectorData &data)
-     { return (data.weights_dt == DataType::F16 && data.isa.fp16); },
-     REGISTER_FP16_NEON(neon_fp16_deptwiseconv2dnative)},
-    {"neon_fp32_deptwiseconv2dnative",
-     [](const DepthwiseConv2dNativeDataTypeISASelectorData &data) { return (data.weights_dt == DataType::F32); },
-     REGISTER_FP32_NEON(neon_fp32_deptwiseconv2dnative)},
-    {"neon_qp8_qu8_deptwiseconv2dnative",
-     [](const DepthwiseConv2dNativeDataTypeISASelectorData &data)
-     { return (data.weights_dt == DataType::QSYMM8_PER_CHANNEL && data.source_dt == DataType::QASYMM8); },
-     REGISTER_QASYMM8_NEON(neon_qp8_qu8_deptwiseconv2dnative)},
-    {"neon_qp8_qs8_deptwiseconv2dnative",
-     [](const DepthwiseConv2dNativeDataTypeISASelectorData &data)
-     { return (data.weights_dt == DataType::QSYMM8_PER_CHANNEL && data.source_dt != DataType::QASYMM8); },
-     REGISTER_QASYMM8_SIGNED_NEON(neon_qp8_qs8_deptwiseconv2dnative)},
-};
-
 Status validate_arguments(const ITensorInfo     *src,
                           const ITensorInfo     *weights,
                           const ITensorInfo     *biases,
@@ -186,6 +161,31 @@ const char *CpuDepthwiseConv2dNativeKernel::name() const
 const std::vector<CpuDepthwiseConv2dNativeKernel::DepthwiseConv2dNativeKernel> &
 CpuDepthwiseConv2dNativeKernel::get_available_kernels()
 {
+    static const std::vector<DepthwiseConv2dNativeKernel> available_kernels = {
+        {"neon_qu8_deptwiseconv2dnative",
+         [](const DepthwiseConv2dNativeDataTypeISASelectorData &data)
+         { return (data.weights_dt == DataType::QASYMM8); },
+         REGISTER_QASYMM8_NEON(neon_qu8_deptwiseconv2dnative)},
+        {"neon_qs8_deptwiseconv2dnative",
+         [](const DepthwiseConv2dNativeDataTypeISASelectorData &data)
+         { return (data.weights_dt == DataType::QASYMM8_SIGNED); },
+         REGISTER_QASYMM8_SIGNED_NEON(neon_qs8_deptwiseconv2dnative)},
+        {"neon_fp16_deptwiseconv2dnative",
+         [](const DepthwiseConv2dNativeDataTypeISASelectorData &data)
+         { return (data.weights_dt == DataType::F16 && data.isa.fp16); },
+         REGISTER_FP16_NEON(neon_fp16_deptwiseconv2dnative)},
+        {"neon_fp32_deptwiseconv2dnative",
+         [](const DepthwiseConv2dNativeDataTypeISASelectorData &data) { return (data.weights_dt == DataType::F32); },
+         REGISTER_FP32_NEON(neon_fp32_deptwiseconv2dnative)},
+        {"neon_qp8_qu8_deptwiseconv2dnative",
+         [](const DepthwiseConv2dNativeDataTypeISASelectorData &data)
+         { return (data.weights_dt == DataType::QSYMM8_PER_CHANNEL && data.source_dt == DataType::QASYMM8); },
+         REGISTER_QASYMM8_NEON(neon_qp8_qu8_deptwiseconv2dnative)},
+        {"neon_qp8_qs8_deptwiseconv2dnative",
+         [](const DepthwiseConv2dNativeDataTypeISASelectorData &data)
+         { return (data.weights_dt == DataType::QSYMM8_PER_CHANNEL && data.source_dt != DataType::QASYMM8); },
+         REGISTER_QASYMM8_SIGNED_NEON(neon_qp8_qs8_deptwiseconv2dnative)},
+    };
     return available_kernels;
 }
 } // namespace kernels
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,17 +39,6 @@ namespace cpu
 {
 namespace kernels
 {
-static const std::vector<CpuDirectConv2dKernel::DirectConv2dKernel> available_kernels = {
-    {"neon_fp32_nhwc_directconv2d",
-     [](const DataTypeDataLayoutISASelectorData &data)
-     { return data.dt == DataType::F32 && data.dl == DataLayout::NHWC; },
-     REGISTER_FP32_NEON(arm_compute::cpu::kernels::neon_fp32_nhwc_directconv2d)},
-    {"neon_fp16_nhwc_directconv2d",
-     [](const DataTypeDataLayoutISASelectorData &data)
-     { return data.dt == DataType::F16 && data.dl == DataLayout::NHWC && data.isa.fp16; },
-     REGISTER_FP16_NEON(arm_compute::cpu::kernels::neon_fp16_nhwc_directconv2d)},
-};
-
 Status validate_arguments(const ITensorInfo   *src,
                           const ITensorInfo   *weights,
                           const ITensorInfo   *dst,
@@ -167,6 +156,16 @@ const char *CpuDirectConv2dKernel::name() const
 
 const std::vector<CpuDirectConv2dKernel::DirectConv2dKernel> &CpuDirectConv2dKernel::get_available_kernels()
 {
+    static const std::vector<DirectConv2dKernel> available_kernels = {
+        {"neon_fp32_nhwc_directconv2d",
+         [](const DataTypeDataLayoutISASelectorData &data)
+         { return data.dt == DataType::F32 && data.dl == DataLayout::NHWC; },
+         REGISTER_FP32_NEON(arm_compute::cpu::kernels::neon_fp32_nhwc_directconv2d)},
+        {"neon_fp16_nhwc_directconv2d",
+         [](const DataTypeDataLayoutISASelectorData &data)
+         { return data.dt == DataType::F16 && data.dl == DataLayout::NHWC && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::kernels::neon_fp16_nhwc_directconv2d)},
+    };
     return available_kernels;
 }
 
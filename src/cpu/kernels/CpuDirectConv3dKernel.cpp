@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, 2024 Arm Limited.
+ * Copyright (c) 2021-2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,18 +48,6 @@ namespace kernels
 {
 namespace
 {
-static const std::vector<CpuDirectConv3dKernel::DirectConv3dKernel> available_kernels = {
-    {"neon_fp16_directconv3d",
-     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
-     REGISTER_FP16_NEON(directconv3d_fp16_neon_ndhwc)},
-    {"neon_fp32_directconv3d", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
-     REGISTER_FP32_NEON(directconv3d_fp32_neon_ndhwc)},
-    {"neon_qasymm8_directconv3d", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
-     REGISTER_QASYMM8_NEON(directconv3d_qu8_neon_ndhwc)},
-    {"neon_qasymm8_signed_directconv3d",
-     [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
-     REGISTER_QASYMM8_SIGNED_NEON(directconv3d_qs8_neon_ndhwc)}};
-
 Status validate_arguments(const ITensorInfo *src0,
                           const ITensorInfo *src1,
                           const ITensorInfo *src2,
@@ -186,6 +174,17 @@ const char *CpuDirectConv3dKernel::name() const
 
 const std::vector<CpuDirectConv3dKernel::DirectConv3dKernel> &CpuDirectConv3dKernel::get_available_kernels()
 {
+    static const std::vector<DirectConv3dKernel> available_kernels = {
+        {"neon_fp16_directconv3d",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(directconv3d_fp16_neon_ndhwc)},
+        {"neon_fp32_directconv3d", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(directconv3d_fp32_neon_ndhwc)},
+        {"neon_qasymm8_directconv3d", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+         REGISTER_QASYMM8_NEON(directconv3d_qu8_neon_ndhwc)},
+        {"neon_qasymm8_signed_directconv3d",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+         REGISTER_QASYMM8_SIGNED_NEON(directconv3d_qs8_neon_ndhwc)}};
     return available_kernels;
 }
 
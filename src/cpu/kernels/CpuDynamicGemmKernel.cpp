@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Arm Limited.
+ * Copyright (c) 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,8 @@
 #include "src/cpu/kernels/dynamic_gemm/heuristics/CpuDynamicGemmKernelHeuristics.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
+#include <algorithm>
+
 using namespace arm_compute::experimental;
 using namespace arm_compute::cpu::kernels::heuristics;
 
@@ -39,6 +41,19 @@ namespace cpu
 {
 namespace kernels
 {
+namespace
+{
+/** Round a workspace size up to the next power of two */
+size_t bucket_size(size_t size)
+{
+    size_t bucket = 1;
+    while (bucket < size)
+    {
+        bucket <<= 1;
+    }
+    return bucket;
+}
+} // namespace
 
 void CpuDynamicGemmKernel::configure(const ITensorInfo *a,
                                      const ITensorInfo *b,
@@ -55,7 +70,8 @@ void CpuDynamicGemmKernel::configure(const ITensorInfo *a,
 
     _name = std::string{"CpuDynamicGemmKernel"}.append("/").append(_heuristics.name());
 
-    _base_aux_slot = base_aux_slot;
+    _base_aux_slot     = base_aux_slot;
+    _bucket_packed_rhs = b->is_dynamic();
     _aux_mem.reserve(Count);
 
     Window window = _heuristics.get_window()(d);
@@ -160,11 +176,22 @@ const MemoryRequirements &CpuDynamicGemmKernel::workspace(const ITensorPack &ten
     const ITensor *const b = tensors.get_const_tensor(ACL_SRC_1);
     ARM_COMPUTE_ERROR_ON_NULLPTR(b);
 
+    // The requirements only depend on the shape of b
+    const TensorShape &b_shape = b->info()->tensor_shape();
+    if (_aux_mem[PackedRHS].size != 0 && b_shape == _workspace_rhs_shape)
+    {
+        return _aux_mem;
+    }
+
     // The ukernel needs a tensor allocation for the packed RHS.
-    const TensorShape &b_shape     = b->info()->tensor_shape();
-    const size_t       pack_b_size = _heuristics.size_of_packed_rhs()(b_shape.y(), b_shape.x());
-    _aux_mem[PackedRHS]            = MemoryInfo{offset_int_vec(_base_aux_slot + PackedRHS), MemoryLifetime::Persistent,
-                                     std::max(pack_b_size, size_t{1})};
+    size_t pack_b_size = std::max(_heuristics.size_of_packed_rhs()(b_shape.y(), b_shape.x()), size_t{1});
+    if (_bucket_packed_rhs)
+    {
+        pack_b_size = bucket_size(pack_b_size);
+    }
+    _aux_mem[PackedRHS] =
+        MemoryInfo{offset_int_vec(_base_aux_slot + PackedRHS), MemoryLifetime::Persistent, pack_b_size};
+    _workspace_rhs_shape = b_shape;
 
     return _aux_mem;
 }
@@ -175,15 +202,24 @@ void CpuDynamicGemmKernel::prepare(ITensorPack &tensors, const bool reuse_b)
     Window               window = _heuristics.get_window()(dst->info());
     ICPPKernel::configure(window);
 
-    const bool run_packing = !reuse_b;
+    const ITensor *const rhs                  = tensors.get_const_tensor(ACL_SRC_1);
+    const ITensor *const bias                 = tensors.get_const_tensor(ACL_SRC_2);
+    const int            pack_b_tensor_offset = offset_int_vec(_base_aux_slot + PackedRHS);
+    ITensor *const       pack_b               = tensors.get_tensor(pack_b_tensor_offset);
+
+    // A packing can only be reused if it was done for the same shapes into the same buffer
+    const bool is_pack_stale = pack_b->buffer() != _packed_rhs_buffer ||
+                               rhs->info()->tensor_shape() != _packed_rhs_shape ||
+                               bias->info()->tensor_shape() != _packed_bias_shape;
+
+    const bool run_packing = !reuse_b || is_pack_stale;
     if (run_packing)
     {
-        const ITensor *const rhs                  = tensors.get_const_tensor(ACL_SRC_1);
-        const ITensor *const bias                 = tensors.get_const_tensor(ACL_SRC_2);
-        const int            pack_b_tensor_offset = offset_int_vec(_base_aux_slot + PackedRHS);
-        ITensor *const       pack_b               = tensors.get_tensor(pack_b_tensor_offset);
-
         _heuristics.pack_rhs()(rhs, bias, pack_b);
+
+        _packed_rhs_shape  = rhs->info()->tensor_shape();
+        _packed_bias_shape = bias->info()->tensor_shape();
+        _packed_rhs_buffer = pack_b->buffer();
     }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -86,6 +86,11 @@ public:
 
     /** Return updated extra memory requirements for the selected ukernel,
      * based on the tensors that will be used when running it.
+     *
+     * The requirements are only recomputed when the shape of b changes, so
+     * runs that only vary the number of rows in a reuse them as is. When b is
+     * dynamic the packed RHS size is rounded up to a power of two, so that a
+     * workspace which only grows is reallocated a logarithmic number of times.
      */
     const experimental::MemoryRequirements &workspace(const ITensorPack &tensors) const;
 
@@ -99,6 +104,10 @@ public:
      * Any actions the kernel needs to perform before the run should be
      * done here. An example of such an action could be packing RHS.
      *
+     * @note Even when @p reuse_b is set, b is packed again if the shapes of
+     *       b and c or the packed RHS buffer differ from the last packing,
+     *       e.g. because the workspace was reallocated.
+     *
      * @param[in] tensors Tensors to operate on.
      * @param[in] reuse_b Whether b-tensor from the last run should
      *                    be reused. This for instance allows to skip
@@ -135,9 +144,17 @@ private:
     heuristics::CpuDynamicGemmKernelHeuristics _heuristics{};
     std::string                                _name{};
     size_t                                     _base_aux_slot{};
+    bool                                       _bucket_packed_rhs{false};
+    // Shapes and destination of the last packing of b, to detect a stale
+    // packed RHS.
+    TensorShape                                _packed_rhs_shape{};
+    TensorShape                                _packed_bias_shape{};
+    const uint8_t                             *_packed_rhs_buffer{nullptr};
     // `mutable` to be able to cache and return memory requirements from the
     // `workspace` method.
     mutable experimental::MemoryRequirements _aux_mem{Count};
+    // Shape of b the memory requirements in `_aux_mem` were computed for.
+    mutable TensorShape _workspace_rhs_shape{};
 };
 
 constexpr size_t CpuDynamicGemmKernel::max_workspace_count()
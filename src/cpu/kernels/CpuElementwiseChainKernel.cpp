@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuElementwiseChainKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/elementwise_chain/list.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+// The ukernels are selected on the destination data type, the F32 ones quantize the result of the chain
+bool is_activation_supported(ActivationLayerInfo::ActivationFunction act)
+{
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+    switch (act)
+    {
+        case ActFunction::IDENTITY:
+        case ActFunction::LINEAR:
+        case ActFunction::RELU:
+        case ActFunction::BOUNDED_RELU:
+        case ActFunction::LU_BOUNDED_RELU:
+        case ActFunction::LEAKY_RELU:
+        case ActFunction::LOGISTIC:
+        case ActFunction::TANH:
+        case ActFunction::ABS:
+        case ActFunction::SQUARE:
+        case ActFunction::HARD_SWISH:
+        case ActFunction::SWISH:
+            return true;
+#ifdef __aarch64__
+        case ActFunction::GELU:
+            return true;
+#endif // __aarch64__
+        default:
+            return false;
+    }
+}
+
+Status validate_arguments(const ITensorInfo                      *src,
+                          const std::vector<const ITensorInfo *> &operands,
+                          const ITensorInfo                      *dst,
+                          const ElementwiseChainInfo             &chain)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32, DataType::F16);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(chain.empty(), "The chain must hold at least one operation");
+
+    for (const auto *operand : operands)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(operand);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, operand);
+        // Operands either have the shape of src or hold a single row broadcast to all the rows of src
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(operand->tensor_shape() != src->tensor_shape() &&
+                                            (operand->dimension(0) != src->dimension(0) ||
+                                             operand->tensor_shape().total_size_upper(1) != 1),
+                                        "Operands must have the shape of the input or be a single row of it");
+    }
+
+    for (const auto &op : chain)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_binary_elementwise_chain_op(op.type) && op.operand >= operands.size(),
+                                        "Binary operation without operand");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(op.type == ElementwiseChainOpType::ACTIVATION &&
+                                            !is_activation_supported(op.act_info.activation()),
+                                        "Unsupported activation function in the chain");
+    }
+
+    DataType dst_data_type = src->data_type();
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->data_type() != src->data_type() &&
+                                            !(src->data_type() == DataType::F32 &&
+                                              (dst->data_type() == DataType::QASYMM8 ||
+                                               dst->data_type() == DataType::QASYMM8_SIGNED)),
+                                        "The destination must be of the input type, or quantized from F32");
+        dst_data_type = dst->data_type();
+    }
+
+    const auto *uk = CpuElementwiseChainKernel::get_implementation(
+        DataTypeISASelectorData{dst_data_type, CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuElementwiseChainKernel::configure(const ITensorInfo                      *src,
+                                          const std::vector<const ITensorInfo *> &operands,
+                                          ITensorInfo                            *dst,
+                                          const ElementwiseChainInfo             &chain)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, operands, dst, chain));
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*dst, *src->clone());
+
+    const auto *uk = CpuElementwiseChainKernel::get_implementation(
+        DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _chain        = chain;
+    _num_operands = operands.size();
+    _run_method   = uk->ukernel;
+    _name         = std::string("CpuElementwiseChainKernel").append("/").append(uk->name);
+
+    // Tensors without padding are processed as 1D arrays, unless a row is broadcast
+    const bool has_padding = src->has_padding() || dst->has_padding() ||
+                             std::any_of(operands.begin(), operands.end(),
+                                         [](const ITensorInfo *operand) { return operand->has_padding(); });
+    const bool has_broadcast =
+        std::any_of(operands.begin(), operands.end(), [src](const ITensorInfo *operand)
+                    { return operand->tensor_shape().total_size() != src->tensor_shape().total_size(); });
+    Window win;
+    if (has_padding || has_broadcast)
+    {
+        win              = calculate_max_window(*dst, Steps());
+        _split_dimension = Window::DimY;
+    }
+    else
+    {
+        std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src);
+    }
+
+    ICpuKernel<CpuElementwiseChainKernel>::configure(win);
+}
+
+Status CpuElementwiseChainKernel::validate(const ITensorInfo                      *src,
+                                           const std::vector<const ITensorInfo *> &operands,
+                                           const ITensorInfo                      *dst,
+                                           const ElementwiseChainInfo             &chain)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, operands, dst, chain));
+
+    return Status{};
+}
+
+void CpuElementwiseChainKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuElementwiseChainKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto src = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    auto       dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    std::vector<const ITensor *> operands(_num_operands);
+    for (size_t i = 0; i < _num_operands; ++i)
+    {
+        operands[i] = tensors.get_const_tensor(static_cast<TensorType>(TensorType::ACL_SRC_VEC + i));
+        ARM_COMPUTE_ERROR_ON(operands[i] == nullptr);
+    }
+
+    _run_method(src, operands, dst, _chain, window);
+}
+
+const char *CpuElementwiseChainKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuElementwiseChainKernel::ElementwiseChainKernel> &CpuElementwiseChainKernel::get_available_kernels()
+{
+    static const std::vector<ElementwiseChainKernel> available_kernels = {
+        {"neon_fp32_elementwise_chain", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_elementwise_chain)},
+        {"neon_fp32_to_qasymm8_elementwise_chain",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_to_qasymm8_elementwise_chain)},
+        {"neon_fp32_to_qasymm8_signed_elementwise_chain",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_to_qasymm8_signed_elementwise_chain)},
+        {"neon_fp16_elementwise_chain",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_elementwise_chain)},
+    };
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
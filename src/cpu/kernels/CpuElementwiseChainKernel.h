@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUELEMENTWISECHAINKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUELEMENTWISECHAINKERNEL_H
+
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the kernel evaluating a chain of elementwise operations
+ *
+ * Applies the operations of the chain in order to every element of the input, the binary ones with the element at the
+ * same coordinates of their operand. Each block of elements stays in registers from the load of the input to the store
+ * of the destination, which reads and writes every tensor once instead of once per operation.
+ */
+class CpuElementwiseChainKernel : public ICpuKernel<CpuElementwiseChainKernel>
+{
+private:
+    using ElementwiseChainKernelPtr = std::add_pointer<void(const ITensor *,
+                                                            const std::vector<const ITensor *> &,
+                                                            ITensor *,
+                                                            const ElementwiseChainInfo &,
+                                                            const Window &)>::type;
+
+public:
+    CpuElementwiseChainKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuElementwiseChainKernel);
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  src      Input tensor info of the chain. Data types supported: F32/F16.
+     * @param[in]  operands Operand tensor infos of the binary operations, with the shape of @p src or holding a single
+     *                      row of it, which is then broadcast to all the rows. Data types supported: same as @p src.
+     * @param[out] dst      Destination tensor info with the shape of @p src. Data types supported: same as @p src, or
+     *                      QASYMM8/QASYMM8_SIGNED if @p src is F32 to quantize the result of the chain.
+     *                      Can be @p src to apply the chain in place.
+     * @param[in]  chain    Operations to apply, in order. The supported activations are IDENTITY, LINEAR, RELU,
+     *                      BOUNDED_RELU, LU_BOUNDED_RELU, LEAKY_RELU, LOGISTIC, TANH, ABS, SQUARE, HARD_SWISH, SWISH
+     *                      and, on aarch64, GELU.
+     */
+    void configure(const ITensorInfo                      *src,
+                   const std::vector<const ITensorInfo *> &operands,
+                   ITensorInfo                            *dst,
+                   const ElementwiseChainInfo             &chain);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuElementwiseChainKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                      *src,
+                           const std::vector<const ITensorInfo *> &operands,
+                           const ITensorInfo                      *dst,
+                           const ElementwiseChainInfo             &chain);
+
+    /** Get the preferred dimension in which the scheduler splits the work into multiple jobs.
+     *
+     * @return The split dimension hint.
+     */
+    size_t get_split_dimension() const
+    {
+        return _split_dimension;
+    }
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct ElementwiseChainKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        ElementwiseChainKernelPtr    ukernel;
+    };
+
+    static const std::vector<ElementwiseChainKernel> &get_available_kernels();
+
+private:
+    ElementwiseChainInfo      _chain{};
+    size_t                    _num_operands{0};
+    size_t                    _split_dimension{Window::DimY};
+    ElementwiseChainKernelPtr _run_method{nullptr};
+    std::string               _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUELEMENTWISECHAINKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, 2025 Arm Limited.
+ * Copyright (c) 2018-2022, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -107,6 +107,21 @@ const std::vector<CpuElementwiseKernel<CpuArithmeticKernel>::ElementwiseKernel>
      { return data.dt == DataType::QASYMM8_SIGNED && static_cast<ArithmeticOperation>(data.op) == op; },
      REGISTER_QASYMM8_SIGNED_NEON(neon_qasymm8_signed_elementwise_binary<op>)},
 };
+template <ArithmeticOperation op>
+const std::vector<CpuElementwiseKernel<CpuArithmeticKernel>::ElementwiseKernel> available_kernels_min_max_integer = {
+    {"neon_qu8_min_max_integer",
+     [](const ElementwiseDataTypeISASelectorData &data) {
+         return data.dt == DataType::QASYMM8 && data.same_quantization_info &&
+                static_cast<ArithmeticOperation>(data.op) == op;
+     },
+     REGISTER_QASYMM8_NEON(neon_qasymm8_integer_elementwise_binary<op>)},
+    {"neon_qs8_min_max_integer",
+     [](const ElementwiseDataTypeISASelectorData &data) {
+         return data.dt == DataType::QASYMM8_SIGNED && data.same_quantization_info &&
+                static_cast<ArithmeticOperation>(data.op) == op;
+     },
+     REGISTER_QASYMM8_SIGNED_NEON(neon_qasymm8_signed_integer_elementwise_binary<op>)},
+};
 template <ComparisonOperation op>
 const std::vector<CpuElementwiseKernel<CpuComparisonKernel>::ElementwiseKernel> available_kernels_comperison = {
     {"sve2_qu8_comparison",
@@ -176,6 +191,11 @@ const std::vector<CpuElementwiseKernel<CpuArithmeticKernel>::ElementwiseKernel>
 CpuArithmeticKernel::get_available_kernels()
 {
     static std::vector<CpuElementwiseKernel<CpuArithmeticKernel>::ElementwiseKernel> available_kernels;
+    // The quantized minimum and maximum are computed on the quantized values when the quantization info is unchanged
+    std::move(available_kernels_min_max_integer<ArithmeticOperation::MIN>.begin(),
+              available_kernels_min_max_integer<ArithmeticOperation::MIN>.end(), std::back_inserter(available_kernels));
+    std::move(available_kernels_min_max_integer<ArithmeticOperation::MAX>.begin(),
+              available_kernels_min_max_integer<ArithmeticOperation::MAX>.end(), std::back_inserter(available_kernels));
     std::move(available_kernels_arithmetic<ArithmeticOperation::ADD>.begin(),
               available_kernels_arithmetic<ArithmeticOperation::ADD>.end(), std::back_inserter(available_kernels));
     std::move(available_kernels_arithmetic<ArithmeticOperation::SUB>.begin(),
@@ -248,8 +268,11 @@ void CpuArithmeticKernel::configure_common(const ITensorInfo *src0, const ITenso
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src0, src1, dst);
 
-    const auto *uk = CpuArithmeticKernel::get_implementation(
-        ElementwiseDataTypeISASelectorData{src0->data_type(), CPUInfo::get().get_isa(), static_cast<int>(_op)});
+    const bool same_quantization_info = is_data_type_quantized_asymmetric(src0->data_type()) &&
+                                        src0->quantization_info() == dst->quantization_info() &&
+                                        src1->quantization_info() == dst->quantization_info();
+    const auto *uk = CpuArithmeticKernel::get_implementation(ElementwiseDataTypeISASelectorData{
+        src0->data_type(), CPUInfo::get().get_isa(), static_cast<int>(_op), same_quantization_info});
 
     ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
 
@@ -262,9 +285,12 @@ void CpuArithmeticKernel::configure_common(const ITensorInfo *src0, const ITenso
         return;
     }
 
-    auto shape_and_window = compute_output_shape_and_window(src0->tensor_shape(), src1->tensor_shape());
-    auto_init_if_empty(*dst, shape_and_window.first, 1, src0->data_type());
-    ICpuKernel::configure(shape_and_window.second);
+    const TensorShape out_shape = TensorShape::broadcast_shape(src0->tensor_shape(), src1->tensor_shape());
+    auto_init_if_empty(*dst, out_shape, 1, src0->data_type());
+
+    Window win;
+    std::tie(win, _split_dimension) = calculate_squashed_or_collapsed_window(*src0, *src1, *dst);
+    ICpuKernel::configure(win);
 }
 
 void CpuComparisonKernel::configure_common(const ITensorInfo *src0, const ITensorInfo *src1, ITensorInfo *dst)
@@ -272,7 +298,7 @@ void CpuComparisonKernel::configure_common(const ITensorInfo *src0, const ITenso
     ARM_COMPUTE_ERROR_ON_NULLPTR(src0, src1, dst);
 
     const auto *uk = CpuComparisonKernel::get_implementation(
-        ElementwiseDataTypeISASelectorData{src0->data_type(), CPUInfo::get().get_isa(), static_cast<int>(_op)});
+        ElementwiseDataTypeISASelectorData{src0->data_type(), CPUInfo::get().get_isa(), static_cast<int>(_op), false});
 
     ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
 
@@ -285,9 +311,12 @@ void CpuComparisonKernel::configure_common(const ITensorInfo *src0, const ITenso
         return;
     }
 
-    auto shape_and_window = compute_output_shape_and_window(src0->tensor_shape(), src1->tensor_shape());
-    auto_init_if_empty(*dst, shape_and_window.first, 1, src0->data_type());
-    ICpuKernel::configure(shape_and_window.second);
+    const TensorShape out_shape = TensorShape::broadcast_shape(src0->tensor_shape(), src1->tensor_shape());
+    auto_init_if_empty(*dst, out_shape, 1, src0->data_type());
+
+    Window win;
+    std::tie(win, _split_dimension) = calculate_squashed_or_collapsed_window(*src0, *src1, *dst);
+    ICpuKernel::configure(win);
 }
 
 template <class Derived>
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -112,74 +112,6 @@ std::unique_ptr<uint8_t[]> q8_prepare_lut(ElementWiseUnary op, const ITensorInfo
 
 #endif // __aarch64__
 
-static const std::vector<CpuElementwiseUnaryKernel::ElementwiseUnaryKernel> available_kernels = {
-    {
-        "sve_fp32_elementwise_unary",
-        [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32 && data.isa.sve); },
-        REGISTER_FP32_SVE(sve_fp32_elementwise_unary),
-        nullptr,
-    },
-    {
-        "sve_fp16_elementwise_unary",
-        [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16 && data.isa.sve && data.isa.fp16); },
-        REGISTER_FP16_SVE(sve_fp16_elementwise_unary),
-        nullptr,
-    },
-    {
-        "sve_s32_elementwise_unary",
-        [](const DataTypeISASelectorData &data) { return (data.dt == DataType::S32 && data.isa.sve); },
-        REGISTER_INTEGER_SVE(sve_s32_elementwise_unary),
-        nullptr,
-    },
-    {
-        "neon_fp32_elementwise_unary",
-        [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
-        REGISTER_FP32_NEON(neon_fp32_elementwise_unary),
-        nullptr,
-    },
-    {
-        "neon_fp16_elementwise_unary",
-        [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
-        REGISTER_FP16_NEON(neon_fp16_elementwise_unary),
-        nullptr,
-    },
-    {
-        "neon_s32_elementwise_unary",
-        [](const DataTypeISASelectorData &data) { return data.dt == DataType::S32; },
-        REGISTER_INTEGER_NEON(neon_s32_elementwise_unary),
-        nullptr,
-    },
-#ifdef __aarch64__
-    {
-        "sve2_q8_elementwise_unary",
-        [](const DataTypeISASelectorData &data)
-        { return (data.dt == DataType::QASYMM8 || data.dt == DataType::QASYMM8_SIGNED) && data.isa.sve2; },
-        REGISTER_QASYMM8_SVE2(sve2_q8_elementwise_unary),
-        &q8_prepare_lut,
-    },
-    {
-        "neon_q8_elementwise_unary",
-        [](const DataTypeISASelectorData &data)
-        { return data.dt == DataType::QASYMM8 || data.dt == DataType::QASYMM8_SIGNED; },
-        REGISTER_QASYMM8_NEON(neon_q8_elementwise_unary),
-        &q8_prepare_lut,
-    },
-#else  // __aarch64__
-    {
-        "neon_qasymm8_signed_elementwise_unary",
-        [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
-        REGISTER_QASYMM8_SIGNED_NEON(neon_qasymm8_signed_elementwise_unary),
-        nullptr,
-    },
-    {
-        "neon_qasymm8_elementwise_unary",
-        [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
-        REGISTER_QASYMM8_NEON(neon_qasymm8_elementwise_unary),
-        nullptr,
-    },
-#endif // __aarch64__
-};
-
 } // namespace
 
 void CpuElementwiseUnaryKernel::configure(ElementWiseUnary op, const ITensorInfo &src, ITensorInfo &dst)
@@ -262,6 +194,74 @@ const char *CpuElementwiseUnaryKernel::name() const
 
 const std::vector<CpuElementwiseUnaryKernel::ElementwiseUnaryKernel> &CpuElementwiseUnaryKernel::get_available_kernels()
 {
+    static const std::vector<ElementwiseUnaryKernel> available_kernels = {
+        {
+            "sve_fp32_elementwise_unary",
+            [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32 && data.isa.sve); },
+            REGISTER_FP32_SVE(sve_fp32_elementwise_unary),
+            nullptr,
+        },
+        {
+            "sve_fp16_elementwise_unary",
+            [](const DataTypeISASelectorData &data)
+            { return (data.dt == DataType::F16 && data.isa.sve && data.isa.fp16); },
+            REGISTER_FP16_SVE(sve_fp16_elementwise_unary),
+            nullptr,
+        },
+        {
+            "sve_s32_elementwise_unary",
+            [](const DataTypeISASelectorData &data) { return (data.dt == DataType::S32 && data.isa.sve); },
+            REGISTER_INTEGER_SVE(sve_s32_elementwise_unary),
+            nullptr,
+        },
+        {
+            "neon_fp32_elementwise_unary",
+            [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+            REGISTER_FP32_NEON(neon_fp32_elementwise_unary),
+            nullptr,
+        },
+        {
+            "neon_fp16_elementwise_unary",
+            [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+            REGISTER_FP16_NEON(neon_fp16_elementwise_unary),
+            nullptr,
+        },
+        {
+            "neon_s32_elementwise_unary",
+            [](const DataTypeISASelectorData &data) { return data.dt == DataType::S32; },
+            REGISTER_INTEGER_NEON(neon_s32_elementwise_unary),
+            nullptr,
+        },
+#ifdef __aarch64__
+        {
+            "sve2_q8_elementwise_unary",
+            [](const DataTypeISASelectorData &data)
+            { return (data.dt == DataType::QASYMM8 || data.dt == DataType::QASYMM8_SIGNED) && data.isa.sve2; },
+            REGISTER_QASYMM8_SVE2(sve2_q8_elementwise_unary),
+            &q8_prepare_lut,
+        },
+        {
+            "neon_q8_elementwise_unary",
+            [](const DataTypeISASelectorData &data)
+            { return data.dt == DataType::QASYMM8 || data.dt == DataType::QASYMM8_SIGNED; },
+            REGISTER_QASYMM8_NEON(neon_q8_elementwise_unary),
+            &q8_prepare_lut,
+        },
+#else  // __aarch64__
+        {
+            "neon_qasymm8_signed_elementwise_unary",
+            [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+            REGISTER_QASYMM8_SIGNED_NEON(neon_qasymm8_signed_elementwise_unary),
+            nullptr,
+        },
+        {
+            "neon_qasymm8_elementwise_unary",
+            [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+            REGISTER_QASYMM8_NEON(neon_qasymm8_elementwise_unary),
+            nullptr,
+        },
+#endif // __aarch64__
+    };
     return available_kernels;
 }
 
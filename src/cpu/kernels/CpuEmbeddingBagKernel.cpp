@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuEmbeddingBagKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/embedding_bag/list.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+TensorInfo dst_info(const ITensorInfo &table, const ITensorInfo &offsets)
+{
+    const DataType dt = table.data_type() == DataType::F16 ? DataType::F16 : DataType::F32;
+    return TensorInfo(TensorShape(table.dimension(0), offsets.dimension(0)), 1, dt);
+}
+
+Status validate_arguments(const ITensorInfo *table,
+                          const ITensorInfo *indices,
+                          const ITensorInfo *offsets,
+                          const ITensorInfo *weights,
+                          const ITensorInfo *dst,
+                          ReductionOperation op)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(table, indices, offsets, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(table);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(table, 1, DataType::F32, DataType::F16, DataType::QASYMM8,
+                                                         DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(indices, 1, DataType::U32, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(offsets, 1, DataType::U32, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(table->num_dimensions() > 2, "The table must be a 2D tensor");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(indices->num_dimensions() > 1, "Indices must be a 1D tensor");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(offsets->num_dimensions() > 1, "Offsets must be a 1D tensor");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(op != ReductionOperation::SUM && op != ReductionOperation::MEAN_SUM,
+                                    "Only sum and mean pooling are supported");
+
+    if (weights != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(indices, weights);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(op != ReductionOperation::SUM, "Per index weights require sum pooling");
+    }
+
+    if (dst->total_size() != 0)
+    {
+        const TensorInfo expected_dst = dst_info(*table, *offsets);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(dst, &expected_dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(dst, &expected_dst);
+    }
+
+    const auto *uk = CpuEmbeddingBagKernel::get_implementation(
+        DataTypeISASelectorData{table->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuEmbeddingBagKernel::EmbeddingBagKernel> &CpuEmbeddingBagKernel::get_available_kernels()
+{
+    static const std::vector<EmbeddingBagKernel> available_kernels = {
+        {"neon_fp32_embedding_bag", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_embedding_bag)},
+#ifdef ARM_COMPUTE_ENABLE_FP16
+        {"neon_fp16_embedding_bag",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_embedding_bag)},
+#endif // ARM_COMPUTE_ENABLE_FP16
+        {"neon_qu8_embedding_bag", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qu8_embedding_bag)},
+        {"neon_qs8_embedding_bag",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qs8_embedding_bag)},
+    };
+    return available_kernels;
+}
+
+void CpuEmbeddingBagKernel::configure(const ITensorInfo *table,
+                                      const ITensorInfo *indices,
+                                      const ITensorInfo *offsets,
+                                      const ITensorInfo *weights,
+                                      ITensorInfo       *dst,
+                                      ReductionOperation op)
+{
+    ARM_COMPUTE_UNUSED(indices, weights);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(table, indices, offsets, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(table, indices, offsets, weights, dst, op));
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*dst, dst_info(*table, *offsets));
+
+    const auto *uk = CpuEmbeddingBagKernel::get_implementation(
+        DataTypeISASelectorData{table->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _use_mean   = op == ReductionOperation::MEAN_SUM;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuEmbeddingBagKernel").append("/").append(uk->name);
+
+    // A bag is pooled by a single thread, the window only spans the bags
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    ICpuKernel<CpuEmbeddingBagKernel>::configure(win);
+}
+
+Status CpuEmbeddingBagKernel::validate(const ITensorInfo *table,
+                                       const ITensorInfo *indices,
+                                       const ITensorInfo *offsets,
+                                       const ITensorInfo *weights,
+                                       const ITensorInfo *dst,
+                                       ReductionOperation op)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(table, indices, offsets, weights, dst, op));
+
+    return Status{};
+}
+
+void CpuEmbeddingBagKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuEmbeddingBagKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto table   = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const auto indices = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const auto offsets = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const auto weights = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    auto       dst     = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(table, indices, offsets, weights, dst, _use_mean, window);
+}
+
+const char *CpuEmbeddingBagKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,12 +42,6 @@ namespace kernels
 {
 namespace
 {
-static const std::vector<CpuFloorKernel::FloorKernel> available_kernels = {
-    {"neon_fp16_floor", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
-     REGISTER_FP16_NEON(arm_compute::cpu::fp16_neon_floor)},
-    {"neon_fp32_floor", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
-     REGISTER_FP32_NEON(arm_compute::cpu::fp32_neon_floor)}};
-
 Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
@@ -133,6 +127,12 @@ const char *CpuFloorKernel::name() const
 
 const std::vector<CpuFloorKernel::FloorKernel> &CpuFloorKernel::get_available_kernels()
 {
+    static const std::vector<FloorKernel> available_kernels = {
+        {"neon_fp16_floor",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::fp16_neon_floor)},
+        {"neon_fp32_floor", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::fp32_neon_floor)}};
     return available_kernels;
 }
 
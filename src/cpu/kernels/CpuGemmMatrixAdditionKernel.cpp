@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022 Arm Limited.
+ * Copyright (c) 2016-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,18 +39,6 @@ namespace cpu
 {
 namespace kernels
 {
-namespace
-{
-static const std::vector<CpuGemmMatrixAdditionKernel::GemmMatrixAddKernel> available_kernels = {
-    {"neon_fp32_gemm_matrix_add", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
-     REGISTER_FP32_NEON(neon_fp32_gemm_matrix_add)},
-    {"neon_fp16_gemm_matrix_add",
-     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
-     REGISTER_FP16_NEON(neon_fp16_gemm_matrix_add)},
-
-};
-} // namespace
-
 void CpuGemmMatrixAdditionKernel::configure(const ITensorInfo *src, ITensorInfo *dst, float beta)
 {
     ARM_COMPUTE_UNUSED(dst);
@@ -109,6 +97,14 @@ const char *CpuGemmMatrixAdditionKernel::name() const
 const std::vector<CpuGemmMatrixAdditionKernel::GemmMatrixAddKernel> &
 CpuGemmMatrixAdditionKernel::get_available_kernels()
 {
+    static const std::vector<GemmMatrixAddKernel> available_kernels = {
+        {"neon_fp32_gemm_matrix_add", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+         REGISTER_FP32_NEON(neon_fp32_gemm_matrix_add)},
+        {"neon_fp16_gemm_matrix_add",
+         [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+         REGISTER_FP16_NEON(neon_fp16_gemm_matrix_add)},
+
+    };
     return available_kernels;
 }
 } // namespace kernels
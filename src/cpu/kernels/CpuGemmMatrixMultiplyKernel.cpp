@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,14 +43,6 @@ namespace kernels
 {
 namespace
 {
-static const std::vector<CpuGemmMatrixMultiplyKernel::GemmMatrixMulKernel> available_kernels = {
-    {"neon_fp32_gemm_matrix_mul", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
-     REGISTER_FP32_NEON(neon_fp32_gemm_matrix_mul)},
-    {"neon_fp16_gemm_matrix_mul",
-     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
-     REGISTER_FP16_NEON(neon_fp16_gemm_matrix_mul)},
-};
-
 inline Status validate_arguments(const ITensorInfo     *lhs,
                                  const ITensorInfo     *rhs,
                                  const ITensorInfo     *dst,
@@ -206,6 +198,13 @@ const char *CpuGemmMatrixMultiplyKernel::name() const
 const std::vector<CpuGemmMatrixMultiplyKernel::GemmMatrixMulKernel> &
 CpuGemmMatrixMultiplyKernel::get_available_kernels()
 {
+    static const std::vector<GemmMatrixMulKernel> available_kernels = {
+        {"neon_fp32_gemm_matrix_mul", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+         REGISTER_FP32_NEON(neon_fp32_gemm_matrix_mul)},
+        {"neon_fp16_gemm_matrix_mul",
+         [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+         REGISTER_FP16_NEON(neon_fp16_gemm_matrix_mul)},
+    };
     return available_kernels;
 }
 } // namespace kernels
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmSparseMatrixMultiplyKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/cpu/kernels/gemm_sparse/list.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+/** Number of outputs sharing a block of the compressed matrix B */
+constexpr unsigned int block_outputs = 4;
+
+Status validate_arguments(const ITensorInfo *lhs,
+                          const ITensorInfo *rhs_values,
+                          const ITensorInfo *rhs_metadata,
+                          const ITensorInfo *bias,
+                          const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lhs, rhs_values, rhs_metadata, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(lhs);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lhs, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(lhs, rhs_values, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(rhs_metadata, 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->total_size() == 0, "The output tensor must be initialized");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs_values->num_dimensions() > 2 || rhs_metadata->num_dimensions() > 2,
+                                    "The compressed matrix B must be 2D");
+
+    const size_t num_groups = DIV_CEIL(lhs->dimension(0), 4U);
+    const size_t num_blocks = DIV_CEIL(dst->dimension(0), static_cast<size_t>(block_outputs));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs_values->dimension(0) != num_groups * 8 ||
+                                        rhs_metadata->dimension(0) != num_groups * 2,
+                                    "The compressed matrix B does not match the number of columns of A");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(rhs_values->dimension(1) != num_blocks || rhs_metadata->dimension(1) != num_blocks,
+                                    "The compressed matrix B does not match the number of columns of the output");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->tensor_shape().total_size_upper(1) != dst->tensor_shape().total_size_upper(1),
+                                    "The output must have the same number of rows as A");
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(lhs, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(bias->num_dimensions() > 1 || bias->dimension(0) != dst->dimension(0),
+                                        "Bias must be a vector with one value per output column");
+    }
+
+    const auto *uk = CpuGemmSparseMatrixMultiplyKernel::get_implementation(
+        DataTypeISASelectorData{lhs->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuGemmSparseMatrixMultiplyKernel::GemmSparseMatrixMulKernel> &
+CpuGemmSparseMatrixMultiplyKernel::get_available_kernels()
+{
+    static const std::vector<GemmSparseMatrixMulKernel> available_kernels = {
+        {"neon_fp32_gemm_sparse_matrix_mul",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_gemm_sparse_matrix_mul)},
+        {"neon_fp16_gemm_sparse_matrix_mul",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_gemm_sparse_matrix_mul)},
+    };
+    return available_kernels;
+}
+
+void CpuGemmSparseMatrixMultiplyKernel::configure(const ITensorInfo *lhs,
+                                                  const ITensorInfo *rhs_values,
+                                                  const ITensorInfo *rhs_metadata,
+                                                  const ITensorInfo *bias,
+                                                  const ITensorInfo *dst,
+                                                  float              alpha)
+{
+    ARM_COMPUTE_UNUSED(rhs_values, rhs_metadata, bias);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, rhs_values, rhs_metadata, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(lhs, rhs_values, rhs_metadata, bias, dst));
+
+    const auto *uk = CpuGemmSparseMatrixMultiplyKernel::get_implementation(
+        DataTypeISASelectorData{lhs->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _alpha      = alpha;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuGemmSparseMatrixMultiplyKernel").append("/").append(uk->name);
+
+    // X walks the blocks of output columns, the ukernel handles the last partial block. Y walks the flattened rows
+    const size_t n_end = ceil_to_multiple(dst->dimension(0), static_cast<size_t>(block_outputs));
+    Window       win;
+    win.set(Window::DimX, Window::Dimension(0, n_end, block_outputs));
+    win.set(Window::DimY, Window::Dimension(0, dst->tensor_shape().total_size_upper(1), 1));
+
+    ICpuKernel<CpuGemmSparseMatrixMultiplyKernel>::configure(win);
+}
+
+Status CpuGemmSparseMatrixMultiplyKernel::validate(const ITensorInfo *lhs,
+                                                   const ITensorInfo *rhs_values,
+                                                   const ITensorInfo *rhs_metadata,
+                                                   const ITensorInfo *bias,
+                                                   const ITensorInfo *dst,
+                                                   float              alpha)
+{
+    ARM_COMPUTE_UNUSED(alpha);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(lhs, rhs_values, rhs_metadata, bias, dst));
+
+    return Status{};
+}
+
+void CpuGemmSparseMatrixMultiplyKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuGemmSparseMatrixMultiplyKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *lhs          = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *rhs_values   = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *rhs_metadata = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *bias         = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    ITensor       *dst          = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(lhs, rhs_values, rhs_metadata, bias, dst, _alpha, window);
+}
+
+const char *CpuGemmSparseMatrixMultiplyKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
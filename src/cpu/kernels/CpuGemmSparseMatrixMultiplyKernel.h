@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMMSPARSEMATRIXMULTIPLYKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMMSPARSEMATRIXMULTIPLYKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to multiply a matrix A by a 2:4 structured-sparse matrix B compressed by @ref CpuGemmSparseRhsCompressKernel
+ *
+ * Computes @f[ dst = alpha \cdot A \cdot B + bias @f] reading only the non-zero values of B. For each group of 4
+ * elements of a row of A, the activations matching the kept values of B are picked with a table lookup indexed by the
+ * metadata, so the kernel loads half of the weights and does half of the multiply-accumulates of a dense product.
+ *
+ * @note All the dimensions of A and of dst above the first one are flattened into rows, so A may be 3D and dst 4D
+ *       as long as they hold the same number of rows, e.g. when a convolution reinterprets its output as 3D.
+ */
+class CpuGemmSparseMatrixMultiplyKernel : public ICpuKernel<CpuGemmSparseMatrixMultiplyKernel>
+{
+private:
+    using GemmSparseMatrixMulKernelPtr = std::add_pointer<void(
+        const ITensor *, const ITensor *, const ITensor *, const ITensor *, ITensor *, float, const Window &)>::type;
+
+public:
+    struct GemmSparseMatrixMulKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        GemmSparseMatrixMulKernelPtr ukernel;
+    };
+
+    CpuGemmSparseMatrixMultiplyKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmSparseMatrixMultiplyKernel);
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  lhs          Matrix A tensor info with shape [K, M, ...]. Data types supported: F16/F32
+     * @param[in]  rhs_values   Non-zero values of matrix B, with shape [ceil(K / 4) * 8, ceil(N / 4)]. Data type supported: same as @p lhs
+     * @param[in]  rhs_metadata Metadata of matrix B, with shape [ceil(K / 4) * 2, ceil(N / 4)]. Data type supported: U8
+     * @param[in]  bias         (Optional) Bias tensor info with shape [N]. Can be nullptr. Data type supported: same as @p lhs
+     * @param[in]  dst          Output tensor info with shape [N, M, ...]. It must be initialized. Data type supported: same as @p lhs
+     * @param[in]  alpha        Weight of the matrix product
+     */
+    void configure(const ITensorInfo *lhs,
+                   const ITensorInfo *rhs_values,
+                   const ITensorInfo *rhs_metadata,
+                   const ITensorInfo *bias,
+                   const ITensorInfo *dst,
+                   float              alpha);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmSparseMatrixMultiplyKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *lhs,
+                           const ITensorInfo *rhs_values,
+                           const ITensorInfo *rhs_metadata,
+                           const ITensorInfo *bias,
+                           const ITensorInfo *dst,
+                           float              alpha);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<GemmSparseMatrixMulKernel> &get_available_kernels();
+
+private:
+    GemmSparseMatrixMulKernelPtr _run_method{nullptr};
+    float                        _alpha{1.f};
+    std::string                  _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMMSPARSEMATRIXMULTIPLYKERNEL_H
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmSparseRhsCompressKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+/** Number of columns compressed together */
+constexpr size_t block_width = 4;
+/** Number of rows out of which each column keeps at most 2 values */
+constexpr size_t group_depth = 4;
+/** Number of values kept per column of a group */
+constexpr size_t group_taps = 2;
+
+Status validate_arguments(const ITensorInfo *src,
+                          const ITensorInfo *values,
+                          const ITensorInfo *metadata,
+                          bool               transposed)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, values, metadata);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->num_dimensions() > 2, "Matrix B must be a 2D tensor");
+
+    if (values->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, values);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+            values->tensor_shape(), misc::shape_calculator::compute_sparse_rhs_values_shape(*src, transposed));
+    }
+    if (metadata->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(metadata, 1, DataType::U8);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+            metadata->tensor_shape(), misc::shape_calculator::compute_sparse_rhs_metadata_shape(*src, transposed));
+    }
+
+    return Status{};
+}
+
+template <typename T>
+void compress_rhs(const ITensor *src, ITensor *values, ITensor *metadata, bool transposed, const Window &window)
+{
+    const ITensorInfo *info       = src->info();
+    const size_t       n_total    = info->dimension(transposed ? 1 : 0);
+    const size_t       k_total    = info->dimension(transposed ? 0 : 1);
+    const size_t       n_stride   = info->strides_in_bytes()[transposed ? 1 : 0];
+    const size_t       k_stride   = info->strides_in_bytes()[transposed ? 0 : 1];
+    const size_t       num_groups = metadata->info()->dimension(0) / group_taps;
+    const uint8_t     *src_ptr    = src->buffer() + info->offset_first_element_in_bytes();
+
+    Iterator values_it(values, window);
+    Iterator metadata_it(metadata, window);
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            auto *v    = reinterpret_cast<T *>(values_it.ptr());
+            auto *meta = metadata_it.ptr();
+
+            // Unused taps keep a zero value and the index of the first row of their group, which always exists
+            std::fill_n(v, num_groups * group_taps * block_width, static_cast<T>(0));
+            std::fill_n(meta, num_groups * group_taps, 0);
+
+            for (size_t lane = 0; lane < block_width; ++lane)
+            {
+                const size_t n = id.y() * block_width + lane;
+                if (n >= n_total)
+                {
+                    break;
+                }
+                for (size_t g = 0; g < num_groups; ++g)
+                {
+                    size_t tap = 0;
+                    for (size_t i = 0; i < group_depth && g * group_depth + i < k_total; ++i)
+                    {
+                        const size_t k     = g * group_depth + i;
+                        const T      value = *reinterpret_cast<const T *>(src_ptr + n * n_stride + k * k_stride);
+                        if (value == static_cast<T>(0))
+                        {
+                            continue;
+                        }
+                        if (tap == group_taps)
+                        {
+                            ARM_COMPUTE_ERROR_VAR("Matrix B is not 2:4 sparse: column %zu has more than 2 non-zero "
+                                                  "values in rows %zu to %zu",
+                                                  n, g * group_depth, g * group_depth + group_depth - 1);
+                        }
+                        v[(g * group_taps + tap) * block_width + lane] = value;
+                        meta[g * group_taps + tap] |= static_cast<uint8_t>(i << (2 * lane));
+                        ++tap;
+                    }
+                }
+            }
+        },
+        values_it, metadata_it);
+}
+} // namespace
+
+void CpuGemmSparseRhsCompressKernel::configure(const ITensorInfo *src,
+                                               ITensorInfo       *values,
+                                               ITensorInfo       *metadata,
+                                               bool               transposed)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, values, metadata);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*values, src->clone()->set_tensor_shape(
+                                    misc::shape_calculator::compute_sparse_rhs_values_shape(*src, transposed)));
+    auto_init_if_empty(*metadata, src->clone()
+                                      ->set_tensor_shape(misc::shape_calculator::compute_sparse_rhs_metadata_shape(
+                                          *src, transposed))
+                                      .set_data_type(DataType::U8));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, values, metadata, transposed));
+
+    _transposed = transposed;
+
+    // Each window step along Y compresses one block of columns
+    Window win = calculate_max_window(*metadata, Steps(metadata->dimension(0)));
+
+    ICpuKernel<CpuGemmSparseRhsCompressKernel>::configure(win);
+}
+
+Status CpuGemmSparseRhsCompressKernel::validate(const ITensorInfo *src,
+                                                const ITensorInfo *values,
+                                                const ITensorInfo *metadata,
+                                                bool               transposed)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, values, metadata, transposed));
+
+    return Status{};
+}
+
+void CpuGemmSparseRhsCompressKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuGemmSparseRhsCompressKernel>::window(), window);
+
+    const ITensor *src      = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *values   = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *metadata = tensors.get_tensor(TensorType::ACL_DST_1);
+
+    if (src->info()->data_type() == DataType::F32)
+    {
+        compress_rhs<float>(src, values, metadata, _transposed, window);
+    }
+    else
+    {
+        compress_rhs<half>(src, values, metadata, _transposed, window);
+    }
+}
+
+const char *CpuGemmSparseRhsCompressKernel::name() const
+{
+    return "CpuGemmSparseRhsCompressKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMMSPARSERHSCOMPRESSKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMMSPARSERHSCOMPRESSKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to compress a 2:4 structured-sparse matrix B into its non-zero values and their metadata
+ *
+ * B is split along K into groups of 4 rows, out of which each column may hold at most 2 non-zero values. The columns
+ * are compressed in blocks of 4: for every group, the block keeps two taps of 4 values, one per column, and one
+ * metadata byte per tap holding the 2-bit row index, within the group, of the value of each column.
+ * A column with fewer than 2 non-zero values in a group is padded with zeros.
+ *
+ * @note The kernel throws an error if a group of B holds more than 2 non-zero values in a column.
+ */
+class CpuGemmSparseRhsCompressKernel : public ICpuKernel<CpuGemmSparseRhsCompressKernel>
+{
+public:
+    CpuGemmSparseRhsCompressKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmSparseRhsCompressKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src        Matrix B tensor info with shape [N, K]. Data types supported: F16/F32
+     * @param[out] values     Non-zero values tensor info with shape [ceil(K / 4) * 8, ceil(N / 4)]. Data type supported: same as @p src
+     * @param[out] metadata   Metadata tensor info with shape [ceil(K / 4) * 2, ceil(N / 4)]. Data type supported: U8
+     * @param[in]  transposed (Optional) True if @p src is stored transposed, i.e. with shape [K, N]
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *values, ITensorInfo *metadata, bool transposed = false);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmSparseRhsCompressKernel::configure()
+     *
+     * @return a status
+     */
+    static Status
+    validate(const ITensorInfo *src, const ITensorInfo *values, const ITensorInfo *metadata, bool transposed = false);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    bool _transposed{false};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMMSPARSERHSCOMPRESSKERNEL_H
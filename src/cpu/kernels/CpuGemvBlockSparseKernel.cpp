@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemvBlockSparseKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/cpu/kernels/gemm_sparse/list.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *src,
+                          const ITensorInfo *values,
+                          const ITensorInfo *columns,
+                          const ITensorInfo *offsets,
+                          const ITensorInfo *bias,
+                          const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, values, columns, offsets, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, values, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(columns, 1, DataType::U16);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(offsets, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->total_size() == 0, "The output tensor must be initialized");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->tensor_shape().total_size_upper(1) != 1 ||
+                                        dst->tensor_shape().total_size_upper(1) != 1,
+                                    "The input and the output must be vectors");
+
+    const size_t max_blocks = DIV_CEIL(src->dimension(0), 4U) * dst->dimension(0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(values->tensor_shape().total_size() != max_blocks * 4 ||
+                                        columns->tensor_shape().total_size() != max_blocks,
+                                    "The packed matrix B does not match the input and the output");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(offsets->num_dimensions() > 1 || offsets->dimension(0) < dst->dimension(0) + 3,
+                                    "The offsets must hold the outputs offsets and at least one chunk");
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(bias->num_dimensions() > 1 || bias->dimension(0) != dst->dimension(0),
+                                        "Bias must be a vector with one value per output");
+    }
+
+    const auto *uk = CpuGemvBlockSparseKernel::get_implementation(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuGemvBlockSparseKernel::GemvBlockSparseKernel> &CpuGemvBlockSparseKernel::get_available_kernels()
+{
+    static const std::vector<GemvBlockSparseKernel> available_kernels = {
+        {"neon_fp32_gemv_block_sparse", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_gemv_block_sparse)},
+        {"neon_fp16_gemv_block_sparse",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_gemv_block_sparse)},
+    };
+    return available_kernels;
+}
+
+void CpuGemvBlockSparseKernel::configure(const ITensorInfo *src,
+                                         const ITensorInfo *values,
+                                         const ITensorInfo *columns,
+                                         const ITensorInfo *offsets,
+                                         const ITensorInfo *bias,
+                                         const ITensorInfo *dst)
+{
+    ARM_COMPUTE_UNUSED(values, columns, bias);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, values, columns, offsets, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, values, columns, offsets, bias, dst));
+
+    const auto *uk = CpuGemvBlockSparseKernel::get_implementation(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuGemvBlockSparseKernel").append("/").append(uk->name);
+
+    // The offsets hold the N + 1 output offsets followed by the number of chunks + 1 chunk offsets
+    const size_t num_chunks = offsets->dimension(0) - dst->dimension(0) - 2;
+    Window       win;
+    win.set(Window::DimX, Window::Dimension(0, num_chunks, 1));
+
+    ICpuKernel<CpuGemvBlockSparseKernel>::configure(win);
+}
+
+Status CpuGemvBlockSparseKernel::validate(const ITensorInfo *src,
+                                          const ITensorInfo *values,
+                                          const ITensorInfo *columns,
+                                          const ITensorInfo *offsets,
+                                          const ITensorInfo *bias,
+                                          const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, values, columns, offsets, bias, dst));
+
+    return Status{};
+}
+
+void CpuGemvBlockSparseKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuGemvBlockSparseKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src     = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *values  = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *columns = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *offsets = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    const ITensor *bias    = tensors.get_const_tensor(TensorType::ACL_SRC_4);
+    ITensor       *dst     = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, values, columns, offsets, bias, dst, window);
+}
+
+const char *CpuGemvBlockSparseKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMVBLOCKSPARSEKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMVBLOCKSPARSEKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to multiply a vector by a block-sparse matrix B packed by @ref CpuGemvBlockSparsePackKernel
+ *
+ * Computes @f[ dst = src \cdot B + bias @f] reading only the kept blocks of B, so the work and the weights traffic
+ * scale with the number of non-zero blocks instead of the size of B.
+ *
+ * The window walks the chunks of outputs, which hold about the same amount of work each, so splitting the window
+ * evenly among the threads balances them.
+ */
+class CpuGemvBlockSparseKernel : public ICpuKernel<CpuGemvBlockSparseKernel>
+{
+private:
+    using GemvBlockSparseKernelPtr = std::add_pointer<void(const ITensor *,
+                                                           const ITensor *,
+                                                           const ITensor *,
+                                                           const ITensor *,
+                                                           const ITensor *,
+                                                           ITensor *,
+                                                           const Window &)>::type;
+
+public:
+    struct GemvBlockSparseKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        GemvBlockSparseKernelPtr     ukernel;
+    };
+
+    CpuGemvBlockSparseKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemvBlockSparseKernel);
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  src     Vector tensor info with shape [K]. Data types supported: F16/F32
+     * @param[in]  values  Values of the kept blocks of B, with shape [ceil(K / 4) * 4 * N]. Data type supported: same as @p src
+     * @param[in]  columns Block indices of the kept blocks of B, with shape [ceil(K / 4) * N]. Data type supported: U16
+     * @param[in]  offsets Offsets of the outputs and of the chunks, with shape [N + number of chunks + 2]. Data type supported: S32
+     * @param[in]  bias    (Optional) Bias tensor info with shape [N]. Can be nullptr. Data type supported: same as @p src
+     * @param[in]  dst     Output tensor info with shape [N]. It must be initialized. Data type supported: same as @p src
+     */
+    void configure(const ITensorInfo *src,
+                   const ITensorInfo *values,
+                   const ITensorInfo *columns,
+                   const ITensorInfo *offsets,
+                   const ITensorInfo *bias,
+                   const ITensorInfo *dst);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemvBlockSparseKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *values,
+                           const ITensorInfo *columns,
+                           const ITensorInfo *offsets,
+                           const ITensorInfo *bias,
+                           const ITensorInfo *dst);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    static const std::vector<GemvBlockSparseKernel> &get_available_kernels();
+
+private:
+    GemvBlockSparseKernelPtr _run_method{nullptr};
+    std::string              _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMVBLOCKSPARSEKERNEL_H
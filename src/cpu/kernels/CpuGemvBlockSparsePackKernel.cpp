@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemvBlockSparsePackKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+using namespace misc::shape_calculator;
+
+namespace
+{
+/** Number of rows of B in a block */
+constexpr size_t block_depth = 4;
+
+Status validate_arguments(const ITensorInfo *src,
+                          const ITensorInfo *values,
+                          const ITensorInfo *columns,
+                          const ITensorInfo *offsets,
+                          unsigned int       num_chunks)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, values, columns, offsets);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->num_dimensions() > 2, "Matrix B must be a 2D tensor");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(DIV_CEIL(src->dimension(1), block_depth) >
+                                        static_cast<size_t>(std::numeric_limits<uint16_t>::max()) + 1,
+                                    "Matrix B has too many rows for 16-bit block indices");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(compute_block_sparse_rhs_columns_shape(*src).total_size() >
+                                        static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+                                    "Matrix B has too many blocks for 32-bit offsets");
+    ARM_COMPUTE_RETURN_ERROR_ON(num_chunks == 0 || num_chunks > src->dimension(0));
+
+    if (values->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, values);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(values->tensor_shape(),
+                                                           compute_block_sparse_rhs_values_shape(*src));
+    }
+    if (columns->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(columns, 1, DataType::U16);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(columns->tensor_shape(),
+                                                           compute_block_sparse_rhs_columns_shape(*src));
+    }
+    if (offsets->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(offsets, 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(offsets->tensor_shape(),
+                                                           compute_block_sparse_rhs_offsets_shape(*src, num_chunks));
+    }
+
+    return Status{};
+}
+
+template <typename T>
+void pack_blocks(const ITensor *src, ITensor *values, ITensor *columns, ITensor *offsets)
+{
+    const ITensorInfo *info       = src->info();
+    const size_t       n_total    = info->dimension(0);
+    const size_t       k_total    = info->dimension(1);
+    const size_t       num_blocks = DIV_CEIL(k_total, block_depth);
+    const size_t       num_chunks = offsets->info()->dimension(0) - n_total - 2;
+    const uint8_t     *src_ptr    = src->buffer() + info->offset_first_element_in_bytes();
+
+    auto *v      = reinterpret_cast<T *>(values->buffer() + values->info()->offset_first_element_in_bytes());
+    auto *col    = reinterpret_cast<uint16_t *>(columns->buffer() + columns->info()->offset_first_element_in_bytes());
+    auto *rows   = reinterpret_cast<int32_t *>(offsets->buffer() + offsets->info()->offset_first_element_in_bytes());
+    auto *chunks = rows + n_total + 1;
+
+    int32_t nnz = 0;
+    rows[0]     = 0;
+    for (size_t n = 0; n < n_total; ++n)
+    {
+        for (size_t block = 0; block < num_blocks; ++block)
+        {
+            T    weights[block_depth] = {};
+            bool keep                 = false;
+            for (size_t i = 0; i < block_depth && block * block_depth + i < k_total; ++i)
+            {
+                const size_t k = block * block_depth + i;
+                weights[i]     = *reinterpret_cast<const T *>(src_ptr + n * info->strides_in_bytes()[0] +
+                                                          k * info->strides_in_bytes()[1]);
+                keep           = keep || weights[i] != static_cast<T>(0);
+            }
+            if (keep)
+            {
+                std::copy_n(weights, block_depth, v + nnz * block_depth);
+                col[nnz] = static_cast<uint16_t>(block);
+                ++nnz;
+            }
+        }
+        rows[n + 1] = nnz;
+    }
+
+    // Chunk c ends at the first output where the work done so far reaches c / num_chunks of the total work
+    const uint64_t total_work = static_cast<uint64_t>(nnz) + n_total;
+    size_t         c          = 1;
+    chunks[0]                 = 0;
+    for (size_t n = 0; n < n_total && c < num_chunks; ++n)
+    {
+        const uint64_t work = static_cast<uint64_t>(rows[n + 1]) + n + 1;
+        while (c < num_chunks && work * num_chunks >= c * total_work)
+        {
+            chunks[c++] = static_cast<int32_t>(n + 1);
+        }
+    }
+    std::fill(chunks + c, chunks + num_chunks + 1, static_cast<int32_t>(n_total));
+}
+} // namespace
+
+void CpuGemvBlockSparsePackKernel::configure(const ITensorInfo *src,
+                                             ITensorInfo       *values,
+                                             ITensorInfo       *columns,
+                                             ITensorInfo       *offsets,
+                                             unsigned int       num_chunks)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, values, columns, offsets);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*values, src->clone()->set_tensor_shape(compute_block_sparse_rhs_values_shape(*src)));
+    auto_init_if_empty(*columns, compute_block_sparse_rhs_columns_shape(*src), 1, DataType::U16);
+    auto_init_if_empty(*offsets, compute_block_sparse_rhs_offsets_shape(*src, num_chunks), 1, DataType::S32);
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, values, columns, offsets, num_chunks));
+
+    // A single window step packs the whole matrix
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    ICpuKernel<CpuGemvBlockSparsePackKernel>::configure(win);
+}
+
+Status CpuGemvBlockSparsePackKernel::validate(const ITensorInfo *src,
+                                              const ITensorInfo *values,
+                                              const ITensorInfo *columns,
+                                              const ITensorInfo *offsets,
+                                              unsigned int       num_chunks)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, values, columns, offsets, num_chunks));
+
+    return Status{};
+}
+
+void CpuGemvBlockSparsePackKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(window, info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuGemvBlockSparsePackKernel>::window(), window);
+
+    const ITensor *src     = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *values  = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *columns = tensors.get_tensor(TensorType::ACL_DST_1);
+    ITensor       *offsets = tensors.get_tensor(TensorType::ACL_DST_2);
+
+    if (src->info()->data_type() == DataType::F32)
+    {
+        pack_blocks<float>(src, values, columns, offsets);
+    }
+    else
+    {
+        pack_blocks<half>(src, values, columns, offsets);
+    }
+}
+
+const char *CpuGemvBlockSparsePackKernel::name() const
+{
+    return "CpuGemvBlockSparsePackKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUGEMVBLOCKSPARSEPACKKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUGEMVBLOCKSPARSEPACKKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to pack a pruned matrix B into the block-sparse format of @ref CpuGemvBlockSparseKernel
+ *
+ * Each column of B, i.e. each output, is split along K into blocks of 4 rows and only the blocks holding a non-zero
+ * value are kept, the blocks of all the columns being stored one after the other as in a CSR matrix:
+ * - values: the 4 weights of each kept block, the last block of a column being zero padded when K is not a multiple of 4
+ * - columns: the index along K, in blocks, of each kept block
+ * - offsets: the index of the first kept block of each output followed by the total number of kept blocks, then the
+ *   first output of each chunk of outputs followed by N. The chunks split the outputs so that they hold the same
+ *   amount of work, counted as one per kept block plus one per output
+ *
+ * The number of kept blocks is only known once the values of B are, so @p values and @p columns are sized for a dense
+ * B. The kernel runs on a single thread as the offsets of each output depend on all the previous ones.
+ */
+class CpuGemvBlockSparsePackKernel : public ICpuKernel<CpuGemvBlockSparsePackKernel>
+{
+public:
+    CpuGemvBlockSparsePackKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemvBlockSparsePackKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * @param[in]  src        Matrix B tensor info with shape [N, K]. Data types supported: F16/F32
+     * @param[out] values     Values tensor info with shape [ceil(K / 4) * 4 * N]. Data type supported: same as @p src
+     * @param[out] columns    Block indices tensor info with shape [ceil(K / 4) * N]. Data type supported: U16
+     * @param[out] offsets    Offsets tensor info with shape [N + @p num_chunks + 2]. Data type supported: S32
+     * @param[in]  num_chunks Number of chunks the outputs are split into. Must be in the range [1, N]
+     */
+    void configure(const ITensorInfo *src,
+                   ITensorInfo       *values,
+                   ITensorInfo       *columns,
+                   ITensorInfo       *offsets,
+                   unsigned int       num_chunks);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemvBlockSparsePackKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *values,
+                           const ITensorInfo *columns,
+                           const ITensorInfo *offsets,
+                           unsigned int       num_chunks);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUGEMVBLOCKSPARSEPACKKERNEL_H
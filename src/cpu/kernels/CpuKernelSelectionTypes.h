@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -68,6 +68,7 @@ struct PoolDataTypeISASelectorData
     int                 pool_stride_x;
     Size2D              pool_size;
     cpuinfo::CpuIsaInfo isa;
+    bool                is_global_pooling;
 };
 
 struct ElementwiseDataTypeISASelectorData
@@ -75,6 +76,7 @@ struct ElementwiseDataTypeISASelectorData
     DataType            dt;
     cpuinfo::CpuIsaInfo isa;
     int                 op;
+    bool                same_quantization_info;
 };
 struct DepthwiseConv2dNativeDataTypeISASelectorData
 {
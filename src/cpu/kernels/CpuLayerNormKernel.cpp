@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuLayerNormKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/layernorm/list.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+Status validate_vector(const ITensorInfo *src, const ITensorInfo *vector)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, vector);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(vector->num_dimensions() > 1 || vector->dimension(0) != src->dimension(0),
+                                    "Gamma and beta must be vectors with one value per normalized element");
+    return Status{};
+}
+
+Status validate_arguments(const ITensorInfo *src,
+                          const ITensorInfo *residual,
+                          const ITensorInfo *gamma,
+                          const ITensorInfo *beta,
+                          const ITensorInfo *dst,
+                          float              epsilon)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32, DataType::F16, DataType::BFLOAT16);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(epsilon < 0.f, "Epsilon must not be negative");
+
+    if (residual != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, residual);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, residual);
+    }
+    if (gamma != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(src, gamma));
+    }
+    if (beta != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(src, beta));
+    }
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+    }
+
+    const auto *uk =
+        CpuLayerNormKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuLayerNormKernel::LayerNormKernel> &CpuLayerNormKernel::get_available_kernels()
+{
+    static const std::vector<LayerNormKernel> available_kernels = {
+        {"neon_fp32_layer_norm", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_layer_norm)},
+#ifdef ARM_COMPUTE_ENABLE_FP16
+        {"neon_fp16_layer_norm",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_layer_norm)},
+#endif // ARM_COMPUTE_ENABLE_FP16
+#if defined(ARM_COMPUTE_ENABLE_BF16)
+        {"neon_bf16_layer_norm", [](const DataTypeISASelectorData &data) { return data.dt == DataType::BFLOAT16; },
+         REGISTER_BF16_NEON(arm_compute::cpu::neon_bf16_layer_norm)},
+#endif // defined(ARM_COMPUTE_ENABLE_BF16)
+    };
+    return available_kernels;
+}
+
+void CpuLayerNormKernel::configure(const ITensorInfo *src,
+                                   const ITensorInfo *residual,
+                                   const ITensorInfo *gamma,
+                                   const ITensorInfo *beta,
+                                   ITensorInfo       *dst,
+                                   float              epsilon,
+                                   bool               use_rms_norm)
+{
+    ARM_COMPUTE_UNUSED(residual, gamma, beta);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, residual, gamma, beta, dst, epsilon));
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*dst, *src->clone());
+
+    const auto *uk =
+        CpuLayerNormKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _epsilon      = epsilon;
+    _use_rms_norm = use_rms_norm;
+    _run_method   = uk->ukernel;
+    _name         = std::string("CpuLayerNormKernel").append("/").append(uk->name);
+
+    // A row is normalized by a single thread, the window only spans the rows
+    Window win = calculate_max_window(*src, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    ICpuKernel<CpuLayerNormKernel>::configure(win);
+}
+
+Status CpuLayerNormKernel::validate(const ITensorInfo *src,
+                                    const ITensorInfo *residual,
+                                    const ITensorInfo *gamma,
+                                    const ITensorInfo *beta,
+                                    const ITensorInfo *dst,
+                                    float              epsilon,
+                                    bool               use_rms_norm)
+{
+    ARM_COMPUTE_UNUSED(use_rms_norm);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, residual, gamma, beta, dst, epsilon));
+
+    return Status{};
+}
+
+void CpuLayerNormKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuLayerNormKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto src      = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const auto residual = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const auto gamma    = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const auto beta     = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    auto       dst      = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, residual, gamma, beta, dst, _epsilon, _use_rms_norm, window);
+}
+
+const char *CpuLayerNormKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPULAYERNORMKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPULAYERNORMKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the layer normalization kernel
+ *
+ * Normalizes each row along the X dimension, optionally after adding a residual, and applies an optional affine
+ * transform:
+ * - layer normalization: @f[ dst = \frac{x - mean(x)}{\sqrt{var(x) + \epsilon}} \cdot \gamma + \beta @f]
+ * - RMS normalization: @f[ dst = \frac{x}{\sqrt{mean(x^2) + \epsilon}} \cdot \gamma + \beta @f]
+ *
+ * where @f$ x = src + residual @f$. The statistics of a row are computed in a single pass (Welford's algorithm for
+ * the variance), so each row is read twice instead of once per operator of the unfused chain.
+ */
+class CpuLayerNormKernel : public ICpuKernel<CpuLayerNormKernel>
+{
+private:
+    using LayerNormKernelPtr = std::add_pointer<void(const ITensor *,
+                                                     const ITensor *,
+                                                     const ITensor *,
+                                                     const ITensor *,
+                                                     ITensor *,
+                                                     float,
+                                                     bool,
+                                                     const Window &)>::type;
+
+public:
+    CpuLayerNormKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuLayerNormKernel);
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  src          Source tensor info, normalized along X. Data types supported: F32/F16/BFLOAT16.
+     * @param[in]  residual     (Optional) Tensor info added to @p src before the normalization. Can be nullptr.
+     *                          Data type and shape supported: same as @p src.
+     * @param[in]  gamma        (Optional) Scale tensor info with shape [src.dimension(0)]. Can be nullptr.
+     *                          Data type supported: same as @p src.
+     * @param[in]  beta         (Optional) Offset tensor info with shape [src.dimension(0)]. Can be nullptr.
+     *                          Data type supported: same as @p src.
+     * @param[out] dst          Destination tensor info. Can be @p src or @p residual for in-place computation.
+     *                          Data type and shape supported: same as @p src.
+     * @param[in]  epsilon      Small float added to the variance to avoid a division by zero.
+     * @param[in]  use_rms_norm Normalize by the root mean square instead of the mean and standard deviation.
+     */
+    void configure(const ITensorInfo *src,
+                   const ITensorInfo *residual,
+                   const ITensorInfo *gamma,
+                   const ITensorInfo *beta,
+                   ITensorInfo       *dst,
+                   float              epsilon,
+                   bool               use_rms_norm);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuLayerNormKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *residual,
+                           const ITensorInfo *gamma,
+                           const ITensorInfo *beta,
+                           const ITensorInfo *dst,
+                           float              epsilon,
+                           bool               use_rms_norm);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct LayerNormKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        LayerNormKernelPtr           ukernel;
+    };
+
+    static const std::vector<LayerNormKernel> &get_available_kernels();
+
+private:
+    float              _epsilon{1e-5f};
+    bool               _use_rms_norm{false};
+    LayerNormKernelPtr _run_method{nullptr};
+    std::string        _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPULAYERNORMKERNEL_H
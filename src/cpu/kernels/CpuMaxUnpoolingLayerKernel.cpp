@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited.
+ * Copyright (c) 2020-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -44,18 +44,6 @@ using namespace misc::shape_calculator;
 
 namespace
 {
-static const std::vector<CpuMaxUnpoolingLayerKernel::MaxUnpoolingKernel> available_kernels = {
-    {"neon_fp32_maxunpooling", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
-     REGISTER_FP32_NEON(neon_fp32_maxunpooling)},
-    {"neon_fp16_maxunpooling",
-     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
-     REGISTER_FP16_NEON(neon_fp16_maxunpooling)},
-    {"neon_qu8_maxunpooling", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
-     REGISTER_QASYMM8_NEON(neon_qs8_maxunpooling)},
-    {"neon_qs8_maxunpooling", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
-     REGISTER_QASYMM8_SIGNED_NEON(neon_qu8_maxunpooling)},
-};
-
 Status validate_arguments(const ITensorInfo      *src,
                           const ITensorInfo      *indices,
                           const ITensorInfo      *dst,
@@ -141,6 +129,18 @@ const char *CpuMaxUnpoolingLayerKernel::name() const
 
 const std::vector<CpuMaxUnpoolingLayerKernel::MaxUnpoolingKernel> &CpuMaxUnpoolingLayerKernel::get_available_kernels()
 {
+    static const std::vector<MaxUnpoolingKernel> available_kernels = {
+        {"neon_fp32_maxunpooling", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(neon_fp32_maxunpooling)},
+        {"neon_fp16_maxunpooling",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(neon_fp16_maxunpooling)},
+        {"neon_qu8_maxunpooling", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+         REGISTER_QASYMM8_NEON(neon_qs8_maxunpooling)},
+        {"neon_qs8_maxunpooling",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+         REGISTER_QASYMM8_SIGNED_NEON(neon_qu8_maxunpooling)},
+    };
     return available_kernels;
 }
 } // namespace kernels
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -46,17 +46,6 @@ namespace kernels
 namespace
 {
 
-static const std::vector<CpuMeanStdDevNormalizationKernel::MeanStdDevNormKernel> available_kernels = {
-    {"fp32_neon_meanstddevnorm", [](const DataTypeSelectorData &data) { return data.dt == DataType::F32; },
-     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_meanstddevnorm)},
-#ifdef ARM_COMPUTE_ENABLE_FP16
-    {"fp16_neon_meanstddevnorm", [](const DataTypeSelectorData &data) { return data.dt == DataType::F16; },
-     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_meanstddevnorm)},
-#endif // ARM_COMPUTE_ENABLE_FP16
-    {"qasymm8_neon_meanstddevnorm", [](const DataTypeSelectorData &data) { return data.dt == DataType::QASYMM8; },
-     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_meanstddevnorm)},
-};
-
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, float epsilon)
 {
     ARM_COMPUTE_UNUSED(epsilon);
@@ -94,6 +83,16 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
 const std::vector<CpuMeanStdDevNormalizationKernel::MeanStdDevNormKernel> &
 CpuMeanStdDevNormalizationKernel::get_available_kernels()
 {
+    static const std::vector<MeanStdDevNormKernel> available_kernels = {
+        {"fp32_neon_meanstddevnorm", [](const DataTypeSelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_meanstddevnorm)},
+#ifdef ARM_COMPUTE_ENABLE_FP16
+        {"fp16_neon_meanstddevnorm", [](const DataTypeSelectorData &data) { return data.dt == DataType::F16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_meanstddevnorm)},
+#endif // ARM_COMPUTE_ENABLE_FP16
+        {"qasymm8_neon_meanstddevnorm", [](const DataTypeSelectorData &data) { return data.dt == DataType::QASYMM8; },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_meanstddevnorm)},
+    };
     return available_kernels;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1713,7 +1713,7 @@ void CpuMulKernel::configure(ITensorInfo   *src1,
 
     // Configure kernel window
     Window win;
-    std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src1, *src2);
+    std::tie(win, _split_dimension) = calculate_squashed_or_collapsed_window(*src1, *src2, *dst);
 
     ICpuKernel::configure(win);
 }
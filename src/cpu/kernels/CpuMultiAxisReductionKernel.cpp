@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuMultiAxisReductionKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/cpu/kernels/multi_axis_reduction/list.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+/** Maximum rank of the reduced tensors */
+constexpr unsigned int max_dims = 4;
+
+/** Bit mask of the reduced axes, 0 if an axis is out of range or repeated */
+uint32_t reduction_axis_mask(const ITensorInfo &src, const Coordinates &reduction_axis)
+{
+    const int rank = static_cast<int>(src.num_dimensions());
+    uint32_t  mask = 0;
+    for (unsigned int i = 0; i < reduction_axis.num_dimensions(); ++i)
+    {
+        const int axis = reduction_axis[i] < 0 ? reduction_axis[i] + rank : reduction_axis[i];
+        if (axis < 0 || axis >= rank || (mask & (1U << axis)) != 0)
+        {
+            return 0;
+        }
+        mask |= 1U << axis;
+    }
+    return mask;
+}
+
+Status validate_arguments(const ITensorInfo *src,
+                          const ITensorInfo *dst,
+                          const Coordinates &reduction_axis,
+                          bool               keep_dims,
+                          ReductionOperation op)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8_SIGNED, DataType::QASYMM8,
+                                                         DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->num_dimensions() > max_dims, "Only up to 4D tensors are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(reduction_axis.num_dimensions() < 1, "At least one axis must be reduced");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(reduction_axis_mask(*src, reduction_axis) == 0,
+                                    "Reduction axes must be distinct and in the range [-rank, rank)");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(op != ReductionOperation::SUM && op != ReductionOperation::MEAN_SUM,
+                                    "Only sum and mean reductions are supported");
+
+    if (dst->total_size() != 0)
+    {
+        const TensorShape dst_shape = arm_compute::misc::shape_calculator::calculate_reduce_mean_shape(
+            src->clone().get(), reduction_axis, keep_dims);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), dst_shape);
+    }
+
+    const auto *uk = CpuMultiAxisReductionKernel::get_implementation(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuMultiAxisReductionKernel::MultiAxisReductionKernel> &
+CpuMultiAxisReductionKernel::get_available_kernels()
+{
+    static const std::vector<MultiAxisReductionKernel> available_kernels = {
+        {"neon_fp32_multi_axis_reduction", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_multi_axis_reduction)},
+#ifdef ARM_COMPUTE_ENABLE_FP16
+        {"neon_fp16_multi_axis_reduction",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_multi_axis_reduction)},
+#endif // ARM_COMPUTE_ENABLE_FP16
+        {"neon_qu8_multi_axis_reduction",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qu8_multi_axis_reduction)},
+        {"neon_qs8_multi_axis_reduction",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qs8_multi_axis_reduction)},
+    };
+    return available_kernels;
+}
+
+void CpuMultiAxisReductionKernel::configure(const ITensorInfo *src,
+                                            ITensorInfo       *dst,
+                                            const Coordinates &reduction_axis,
+                                            bool               keep_dims,
+                                            ReductionOperation op)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, reduction_axis, keep_dims, op));
+
+    // Output auto initialization if not yet initialized
+    const TensorShape dst_shape =
+        arm_compute::misc::shape_calculator::calculate_reduce_mean_shape(src->clone().get(), reduction_axis, keep_dims);
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(dst_shape));
+
+    const auto *uk = CpuMultiAxisReductionKernel::get_implementation(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _axis_mask  = reduction_axis_mask(*src, reduction_axis);
+    _keep_dims  = keep_dims;
+    _use_mean   = op == ReductionOperation::MEAN_SUM;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuMultiAxisReductionKernel").append("/").append(uk->name);
+
+    // A destination row is computed by a single thread, the window spans the rows of all the preserved dimensions
+    size_t num_rows = 1;
+    for (unsigned int d = 1; d < max_dims; ++d)
+    {
+        num_rows *= (_axis_mask & (1U << d)) != 0 ? 1 : src->dimension(d);
+    }
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, num_rows, 1));
+
+    ICpuKernel<CpuMultiAxisReductionKernel>::configure(win);
+}
+
+Status CpuMultiAxisReductionKernel::validate(const ITensorInfo *src,
+                                             const ITensorInfo *dst,
+                                             const Coordinates &reduction_axis,
+                                             bool               keep_dims,
+                                             ReductionOperation op)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, reduction_axis, keep_dims, op));
+
+    return Status{};
+}
+
+void CpuMultiAxisReductionKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuMultiAxisReductionKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto src = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    auto       dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, dst, _axis_mask, _keep_dims, _use_mean, window);
+}
+
+const char *CpuMultiAxisReductionKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUMULTIAXISREDUCTIONKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUMULTIAXISREDUCTIONKERNEL_H
+
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Types.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the kernel reducing several axes at once
+ *
+ * All the reduced axes are accumulated in a single pass over the source, instead of running a reduction per axis
+ * and writing the intermediate tensors. The accumulation is vectorised along X when it is preserved, and the
+ * destination rows are split across threads.
+ */
+class CpuMultiAxisReductionKernel : public ICpuKernel<CpuMultiAxisReductionKernel>
+{
+private:
+    using MultiAxisReductionKernelPtr =
+        std::add_pointer<void(const ITensor *, ITensor *, uint32_t, bool, bool, const Window &)>::type;
+
+public:
+    CpuMultiAxisReductionKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuMultiAxisReductionKernel);
+
+    /** Set the source and destination tensors.
+     *
+     * @param[in]  src            Source tensor info, up to 4D. Data types supported: QASYMM8_SIGNED/QASYMM8/F16/F32.
+     * @param[out] dst            Destination tensor info. Data types supported: Same as @p src.
+     * @param[in]  reduction_axis Distinct axes to reduce, in the range [-rank(src), rank(src)).
+     * @param[in]  keep_dims      If true, retains reduced dimensions with length 1.
+     * @param[in]  op             Reduction operation. Supported: @ref ReductionOperation::SUM,
+     *                            @ref ReductionOperation::MEAN_SUM.
+     */
+    void configure(const ITensorInfo *src,
+                   ITensorInfo       *dst,
+                   const Coordinates &reduction_axis,
+                   bool               keep_dims,
+                   ReductionOperation op);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuMultiAxisReductionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *dst,
+                           const Coordinates &reduction_axis,
+                           bool               keep_dims,
+                           ReductionOperation op);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct MultiAxisReductionKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        MultiAxisReductionKernelPtr  ukernel;
+    };
+
+    static const std::vector<MultiAxisReductionKernel> &get_available_kernels();
+
+private:
+    uint32_t                    _axis_mask{0};
+    bool                        _keep_dims{false};
+    bool                        _use_mean{false};
+    MultiAxisReductionKernelPtr _run_method{nullptr};
+    std::string                 _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUMULTIAXISREDUCTIONKERNEL_H
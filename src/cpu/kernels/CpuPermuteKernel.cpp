@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,11 @@
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/WindowHelpers.h"
 
+#include <arm_neon.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+
 namespace
 {
 #include "src/core/NEON/kernels/convolution/common/shims.hpp"
@@ -49,31 +54,218 @@ namespace
 {
 inline bool is_permutation_supported(const PermutationVector &v)
 {
-    static const std::array<PermutationVector, 2>  permutations2 = {{
-         PermutationVector(0U, 1U),
-         PermutationVector(1U, 0U),
-    }};
-    static const std::array<PermutationVector, 6>  permutations3 = {{
-         PermutationVector(2U, 0U, 1U),
-         PermutationVector(1U, 2U, 0U),
-         PermutationVector(0U, 1U, 2U),
-         PermutationVector(0U, 2U, 1U),
-         PermutationVector(1U, 0U, 2U),
-         PermutationVector(2U, 1U, 0U),
-    }};
-    static const std::array<PermutationVector, 24> permutations4 = {
-        {PermutationVector(0U, 1U, 2U, 3U), PermutationVector(1U, 0U, 2U, 3U), PermutationVector(2U, 0U, 1U, 3U),
-         PermutationVector(0U, 2U, 1U, 3U), PermutationVector(1U, 2U, 0U, 3U), PermutationVector(2U, 1U, 0U, 3U),
-         PermutationVector(2U, 1U, 3U, 0U), PermutationVector(1U, 2U, 3U, 0U), PermutationVector(3U, 2U, 1U, 0U),
-         PermutationVector(2U, 3U, 1U, 0U), PermutationVector(1U, 3U, 2U, 0U), PermutationVector(3U, 1U, 2U, 0U),
-         PermutationVector(3U, 0U, 2U, 1U), PermutationVector(0U, 3U, 2U, 1U), PermutationVector(2U, 3U, 0U, 1U),
-         PermutationVector(3U, 2U, 0U, 1U), PermutationVector(0U, 2U, 3U, 1U), PermutationVector(2U, 0U, 3U, 1U),
-         PermutationVector(1U, 0U, 3U, 2U), PermutationVector(0U, 1U, 3U, 2U), PermutationVector(3U, 1U, 0U, 2U),
-         PermutationVector(1U, 3U, 0U, 2U), PermutationVector(0U, 3U, 1U, 2U), PermutationVector(3U, 0U, 1U, 2U)}};
-
-    return (permutations2.end() != std::find(permutations2.begin(), permutations2.end(), v)) ||
-           (permutations3.end() != std::find(permutations3.begin(), permutations3.end(), v)) ||
-           (permutations4.end() != std::find(permutations4.begin(), permutations4.end(), v));
+    // Any reordering of up to the maximum number of dimensions is supported
+    const unsigned int num_dims = v.num_dimensions();
+    if (num_dims == 0)
+    {
+        return false;
+    }
+
+    std::array<bool, Coordinates::num_max_dimensions> is_used{};
+    for (unsigned int i = 0; i < num_dims; ++i)
+    {
+        if (v[i] >= num_dims || is_used[v[i]])
+        {
+            return false;
+        }
+        is_used[v[i]] = true;
+    }
+    return true;
+}
+
+/** Transposes square blocks of elements with Neon™ */
+template <typename T>
+struct BlockTranspose;
+
+template <>
+struct BlockTranspose<uint32_t>
+{
+    static constexpr int size = 4;
+
+    static void run(const uint32_t *src, int src_stride, uint32_t *dst, int dst_stride)
+    {
+        const uint32x4x2_t t01 = vtrnq_u32(vld1q_u32(src), vld1q_u32(src + src_stride));
+        const uint32x4x2_t t23 = vtrnq_u32(vld1q_u32(src + 2 * src_stride), vld1q_u32(src + 3 * src_stride));
+
+        vst1q_u32(dst, vcombine_u32(vget_low_u32(t01.val[0]), vget_low_u32(t23.val[0])));
+        vst1q_u32(dst + dst_stride, vcombine_u32(vget_low_u32(t01.val[1]), vget_low_u32(t23.val[1])));
+        vst1q_u32(dst + 2 * dst_stride, vcombine_u32(vget_high_u32(t01.val[0]), vget_high_u32(t23.val[0])));
+        vst1q_u32(dst + 3 * dst_stride, vcombine_u32(vget_high_u32(t01.val[1]), vget_high_u32(t23.val[1])));
+    }
+};
+
+template <>
+struct BlockTranspose<uint16_t>
+{
+    static constexpr int size = 8;
+
+    static void run(const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride)
+    {
+        // Interleave pairs of rows at 16-bit and then 32-bit granularity, the 64-bit halves hold the columns
+        const uint16x8x2_t t0 = vtrnq_u16(vld1q_u16(src), vld1q_u16(src + src_stride));
+        const uint16x8x2_t t1 = vtrnq_u16(vld1q_u16(src + 2 * src_stride), vld1q_u16(src + 3 * src_stride));
+        const uint16x8x2_t t2 = vtrnq_u16(vld1q_u16(src + 4 * src_stride), vld1q_u16(src + 5 * src_stride));
+        const uint16x8x2_t t3 = vtrnq_u16(vld1q_u16(src + 6 * src_stride), vld1q_u16(src + 7 * src_stride));
+
+        const uint32x4x2_t u0 = vtrnq_u32(vreinterpretq_u32_u16(t0.val[0]), vreinterpretq_u32_u16(t1.val[0]));
+        const uint32x4x2_t u1 = vtrnq_u32(vreinterpretq_u32_u16(t0.val[1]), vreinterpretq_u32_u16(t1.val[1]));
+        const uint32x4x2_t u2 = vtrnq_u32(vreinterpretq_u32_u16(t2.val[0]), vreinterpretq_u32_u16(t3.val[0]));
+        const uint32x4x2_t u3 = vtrnq_u32(vreinterpretq_u32_u16(t2.val[1]), vreinterpretq_u32_u16(t3.val[1]));
+
+        const auto store = [&](int col, uint32x2_t lo, uint32x2_t hi)
+        { vst1q_u16(dst + col * dst_stride, vreinterpretq_u16_u32(vcombine_u32(lo, hi))); };
+
+        store(0, vget_low_u32(u0.val[0]), vget_low_u32(u2.val[0]));
+        store(1, vget_low_u32(u1.val[0]), vget_low_u32(u3.val[0]));
+        store(2, vget_low_u32(u0.val[1]), vget_low_u32(u2.val[1]));
+        store(3, vget_low_u32(u1.val[1]), vget_low_u32(u3.val[1]));
+        store(4, vget_high_u32(u0.val[0]), vget_high_u32(u2.val[0]));
+        store(5, vget_high_u32(u1.val[0]), vget_high_u32(u3.val[0]));
+        store(6, vget_high_u32(u0.val[1]), vget_high_u32(u2.val[1]));
+        store(7, vget_high_u32(u1.val[1]), vget_high_u32(u3.val[1]));
+    }
+};
+
+template <>
+struct BlockTranspose<uint8_t>
+{
+    static constexpr int size = 8;
+
+    static void run(const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride)
+    {
+        // Interleave pairs of rows at 8-bit, 16-bit and then 32-bit granularity
+        const uint8x8x2_t t0 = vtrn_u8(vld1_u8(src), vld1_u8(src + src_stride));
+        const uint8x8x2_t t1 = vtrn_u8(vld1_u8(src + 2 * src_stride), vld1_u8(src + 3 * src_stride));
+        const uint8x8x2_t t2 = vtrn_u8(vld1_u8(src + 4 * src_stride), vld1_u8(src + 5 * src_stride));
+        const uint8x8x2_t t3 = vtrn_u8(vld1_u8(src + 6 * src_stride), vld1_u8(src + 7 * src_stride));
+
+        const uint16x4x2_t u0 = vtrn_u16(vreinterpret_u16_u8(t0.val[0]), vreinterpret_u16_u8(t1.val[0]));
+        const uint16x4x2_t u1 = vtrn_u16(vreinterpret_u16_u8(t0.val[1]), vreinterpret_u16_u8(t1.val[1]));
+        const uint16x4x2_t u2 = vtrn_u16(vreinterpret_u16_u8(t2.val[0]), vreinterpret_u16_u8(t3.val[0]));
+        const uint16x4x2_t u3 = vtrn_u16(vreinterpret_u16_u8(t2.val[1]), vreinterpret_u16_u8(t3.val[1]));
+
+        const uint32x2x2_t v0 = vtrn_u32(vreinterpret_u32_u16(u0.val[0]), vreinterpret_u32_u16(u2.val[0]));
+        const uint32x2x2_t v1 = vtrn_u32(vreinterpret_u32_u16(u1.val[0]), vreinterpret_u32_u16(u3.val[0]));
+        const uint32x2x2_t v2 = vtrn_u32(vreinterpret_u32_u16(u0.val[1]), vreinterpret_u32_u16(u2.val[1]));
+        const uint32x2x2_t v3 = vtrn_u32(vreinterpret_u32_u16(u1.val[1]), vreinterpret_u32_u16(u3.val[1]));
+
+        vst1_u8(dst, vreinterpret_u8_u32(v0.val[0]));
+        vst1_u8(dst + dst_stride, vreinterpret_u8_u32(v1.val[0]));
+        vst1_u8(dst + 2 * dst_stride, vreinterpret_u8_u32(v2.val[0]));
+        vst1_u8(dst + 3 * dst_stride, vreinterpret_u8_u32(v3.val[0]));
+        vst1_u8(dst + 4 * dst_stride, vreinterpret_u8_u32(v0.val[1]));
+        vst1_u8(dst + 5 * dst_stride, vreinterpret_u8_u32(v1.val[1]));
+        vst1_u8(dst + 6 * dst_stride, vreinterpret_u8_u32(v2.val[1]));
+        vst1_u8(dst + 7 * dst_stride, vreinterpret_u8_u32(v3.val[1]));
+    }
+};
+
+/** Transposes a plane, dst[x * dst_stride + y] = src[y * src_stride + x]
+ *
+ * The plane is walked in tiles that fit in the L1 cache, each of them transposed in Neon™ blocks.
+ */
+template <typename T>
+void transpose_plane(const T *src, int src_stride, T *dst, int dst_stride, int width, int height)
+{
+    constexpr int tile_size  = 64;
+    constexpr int block_size = BlockTranspose<T>::size;
+
+    for (int tile_y = 0; tile_y < height; tile_y += tile_size)
+    {
+        const int tile_y_end = std::min(tile_y + tile_size, height);
+        for (int tile_x = 0; tile_x < width; tile_x += tile_size)
+        {
+            const int tile_x_end = std::min(tile_x + tile_size, width);
+
+            int y = tile_y;
+            for (; y <= tile_y_end - block_size; y += block_size)
+            {
+                int x = tile_x;
+                for (; x <= tile_x_end - block_size; x += block_size)
+                {
+                    BlockTranspose<T>::run(src + y * src_stride + x, src_stride, dst + x * dst_stride + y,
+                                           dst_stride);
+                }
+                // Left-over columns
+                for (; x < tile_x_end; ++x)
+                {
+                    for (int yy = y; yy < y + block_size; ++yy)
+                    {
+                        dst[x * dst_stride + yy] = src[yy * src_stride + x];
+                    }
+                }
+            }
+            // Left-over rows
+            for (; y < tile_y_end; ++y)
+            {
+                for (int x = tile_x; x < tile_x_end; ++x)
+                {
+                    dst[x * dst_stride + y] = src[y * src_stride + x];
+                }
+            }
+        }
+    }
+}
+
+/** Permutes any number of dimensions
+ *
+ * If the innermost dimension stays contiguous in the destination, rows are copied as a whole. Otherwise the plane
+ * made of the innermost source dimension and the source dimension that becomes innermost in the destination is
+ * transposed in blocks, for each position in the outer dimensions of the window.
+ */
+template <typename T>
+void run_permute_blocked(const Window &window, const ITensor *src, const ITensor *dst, const PermutationVector &perm)
+{
+    const ITensorInfo *src_info = src->info();
+    const ITensorInfo *dst_info = dst->info();
+
+    // Destination stride of each source dimension
+    const Strides &src_strides  = src_info->strides_in_bytes();
+    Strides        perm_strides = dst_info->strides_in_bytes();
+    permute_strides(perm_strides, perm);
+
+    const int    x_start    = window.x().start();
+    const int    x_end      = window.x().end();
+    const bool   copy_rows  = perm_strides[0] == sizeof(T);
+    const size_t inner_dim  = copy_rows ? 0 : perm[0];
+    const int    y_start    = window[inner_dim].start();
+    const int    y_end      = window[inner_dim].end();
+    uint8_t     *src_buffer = src->buffer() + src_info->offset_first_element_in_bytes();
+    uint8_t     *dst_buffer = dst->buffer() + dst_info->offset_first_element_in_bytes();
+
+    Window win{window};
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(inner_dim, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(win,
+                        [&](const Coordinates &id)
+                        {
+                            size_t src_offset = x_start * src_strides[0];
+                            size_t dst_offset = x_start * perm_strides[0];
+                            if (!copy_rows)
+                            {
+                                src_offset += y_start * src_strides[inner_dim];
+                                dst_offset += y_start * perm_strides[inner_dim];
+                            }
+                            for (size_t d = 1; d < Coordinates::num_max_dimensions; ++d)
+                            {
+                                src_offset += id[d] * src_strides[d];
+                                dst_offset += id[d] * perm_strides[d];
+                            }
+
+                            if (copy_rows)
+                            {
+                                std::memcpy(dst_buffer + dst_offset, src_buffer + src_offset,
+                                            (x_end - x_start) * sizeof(T));
+                            }
+                            else
+                            {
+                                transpose_plane<T>(reinterpret_cast<const T *>(src_buffer + src_offset),
+                                                   src_strides[inner_dim] / sizeof(T),
+                                                   reinterpret_cast<T *>(dst_buffer + dst_offset),
+                                                   perm_strides[0] / sizeof(T), x_end - x_start, y_end - y_start);
+                            }
+                        });
 }
 
 Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const PermutationVector &perm)
@@ -97,22 +289,26 @@ Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const
 template <typename T>
 void run_permute(const Window &window, const ITensor *src, const ITensor *dst, const PermutationVector &perm)
 {
-    // Source window
-    Window window_src = window;
-
-    // we only support these two configs in src/core/NEON/kernels/convolution/common/shims.hpp, for all others
-    // we have to fall back to C++
-    if (perm == PermutationVector{2U, 0U, 1U} || perm == PermutationVector{1U, 2U, 0U})
+    // we only support these two configs of up to 4 dimensions in src/core/NEON/kernels/convolution/common/shims.hpp,
+    // all others go through the blocked engine
+    const bool use_shims = (perm == PermutationVector{2U, 0U, 1U} || perm == PermutationVector{1U, 2U, 0U}) &&
+                           src->info()->num_dimensions() <= 4;
+    if (!use_shims)
     {
-        window_src.set(Window::DimX,
-                       Window::Dimension(window.x().start(), window.x().end(), window.x().end() - window.x().start()));
-        window_src.set(Window::DimY,
-                       Window::Dimension(window.y().start(), window.y().end(), window.y().end() - window.y().start()));
-        window_src.set(Window::DimZ,
-                       Window::Dimension(window.z().start(), window.z().end(), window.z().end() - window.z().start()));
-        window_src.set(3, Window::Dimension(window[3].start(), window[3].end(), window[3].end() - window[3].start()));
+        run_permute_blocked<T>(window, src, dst, perm);
+        return;
     }
 
+    // Source window
+    Window window_src = window;
+    window_src.set(Window::DimX,
+                   Window::Dimension(window.x().start(), window.x().end(), window.x().end() - window.x().start()));
+    window_src.set(Window::DimY,
+                   Window::Dimension(window.y().start(), window.y().end(), window.y().end() - window.y().start()));
+    window_src.set(Window::DimZ,
+                   Window::Dimension(window.z().start(), window.z().end(), window.z().end() - window.z().start()));
+    window_src.set(3, Window::Dimension(window[3].start(), window[3].end(), window[3].end() - window[3].start()));
+
     // Destination window
     Window                  window_dst(window);
     const Window::Dimension zero_window = Window::Dimension(0, 0, 0);
@@ -177,24 +373,6 @@ void run_permute(const Window &window, const ITensor *src, const ITensor *dst, c
             },
             src_it, dst_it);
     }
-    else
-    {
-        // All other cases fall back to C++
-        // Permute strides
-        Strides strides      = dst->info()->strides_in_bytes();
-        Strides perm_strides = strides;
-        permute_strides(perm_strides, perm);
-        const int perm_stride_3 = src->info()->num_dimensions() >= 4 ? perm_strides[3] : 0;
-        execute_window_loop(
-            window,
-            [&](const Coordinates &id)
-            {
-                const int idx =
-                    id[0] * perm_strides[0] + id[1] * perm_strides[1] + id[2] * perm_strides[2] + id[3] * perm_stride_3;
-                *(reinterpret_cast<T *>(dst_it.ptr() + idx)) = *(reinterpret_cast<const T *>(src_it.ptr()));
-            },
-            src_it, dst_it);
-    }
 }
 } // namespace
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022 Arm Limited.
+ * Copyright (c) 2018-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,7 +41,7 @@ public:
     ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuPermuteKernel);
     /** Configure kernel for a given list of arguments
      *
-     * @note Arbitrary permutation vectors are supported with rank not greater than 4
+     * @note Arbitrary permutation vectors are supported with rank not greater than 6
      *
      * @param[in]  src  Srouce tensor to permute. Data types supported: All
      * @param[out] dst  Destination tensor. Data types supported: Same as @p src
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,105 +48,21 @@ namespace
 {
 using namespace misc::shape_calculator;
 
-static const std::vector<CpuPool2dKernel::PoolingKernel> available_kernels = {
-    {"neon_qu8_nhwc_poolMxN",
-     [](const PoolDataTypeISASelectorData &data)
-     { return ((data.dl == DataLayout::NHWC) && (data.dt == DataType::QASYMM8)); },
-     REGISTER_QASYMM8_NEON(arm_compute::cpu::poolingMxN_qasymm8_neon_nhwc)},
-    {"neon_qs8_nhwc_poolMxN",
-     [](const PoolDataTypeISASelectorData &data)
-     { return ((data.dl == DataLayout::NHWC) && (data.dt == DataType::QASYMM8_SIGNED)); },
-     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::poolingMxN_qasymm8_signed_neon_nhwc)},
-    {"neon_f16_nhwc_poolMxN",
-     [](const PoolDataTypeISASelectorData &data)
-     { return ((data.dl == DataLayout::NHWC) && (data.dt == DataType::F16)) && data.isa.fp16; },
-     REGISTER_FP16_NEON(arm_compute::cpu::poolingMxN_fp16_neon_nhwc)},
-    {"neon_fp32_nhwc_poolMxN",
-     [](const PoolDataTypeISASelectorData &data)
-     { return ((data.dl == DataLayout::NHWC) && (data.dt == DataType::F32)); },
-     REGISTER_FP32_NEON(arm_compute::cpu::poolingMxN_fp32_neon_nhwc)},
 #if defined(ENABLE_NCHW_KERNELS)
-    {"neon_qu8_nchw_pool2",
-     [](const PoolDataTypeISASelectorData &data)
-     {
-         return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::QASYMM8) &&
-                 (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 2) && (data.pool_stride_x < 3));
-     },
-     REGISTER_QASYMM8_NEON(arm_compute::cpu::pooling2_quantized_neon_nchw<uint8_t>)},
-    {"neon_qu8_nchw_pool3",
-     [](const PoolDataTypeISASelectorData &data)
-     {
-         return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::QASYMM8) &&
-                 (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 3) && (data.pool_stride_x < 3));
-     },
-     REGISTER_QASYMM8_NEON(arm_compute::cpu::pooling3_quantized_neon_nchw<uint8_t>)},
-    {"neon_qu8_nchw_poolMxN",
-     [](const PoolDataTypeISASelectorData &data)
-     { return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::QASYMM8)); },
-     REGISTER_QASYMM8_NEON(arm_compute::cpu::poolingMxN_quantized_neon_nchw<uint8_t>)},
-    {"neon_qs8_nchw_pool2",
-     [](const PoolDataTypeISASelectorData &data)
-     {
-         return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::QASYMM8_SIGNED) &&
-                 (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 2) && (data.pool_stride_x < 3));
-     },
-     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::pooling2_quantized_neon_nchw<int8_t>)},
-    {"neon_qs8_nchw_pool3",
-     [](const PoolDataTypeISASelectorData &data)
-     {
-         return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::QASYMM8_SIGNED) &&
-                 (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 3) && (data.pool_stride_x < 3));
-     },
-     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::pooling3_quantized_neon_nchw<int8_t>)},
-    {"neon_qs8_nchw_poolMxN",
-     [](const PoolDataTypeISASelectorData &data)
-     { return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::QASYMM8_SIGNED)); },
-     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::poolingMxN_quantized_neon_nchw<int8_t>)},
-    {"neon_fp16_nchw_pool2",
-     [](const PoolDataTypeISASelectorData &data)
-     {
-         return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F16 && data.isa.fp16) &&
-                 (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 2));
-     },
-     REGISTER_FP16_NEON(arm_compute::cpu::pooling2_fp16_neon_nchw)},
-    {"neon_fp16_nchw_pool3",
-     [](const PoolDataTypeISASelectorData &data)
-     {
-         return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F16 && data.isa.fp16) &&
-                 (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 3));
-     },
-     REGISTER_FP16_NEON(arm_compute::cpu::pooling3_fp16_neon_nchw)},
-    {"neon_fp16_nchw_poolMxN",
-     [](const PoolDataTypeISASelectorData &data)
-     { return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F16 && data.isa.fp16)); },
-     REGISTER_FP16_NEON(arm_compute::cpu::poolingMxN_fp16_neon_nchw)},
-    {"neon_fp32_nchw_pool2",
-     [](const PoolDataTypeISASelectorData &data)
-     {
-         return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F32) &&
-                 (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 2));
-     },
-     REGISTER_FP32_NEON(arm_compute::cpu::pooling2_fp32_neon_nchw)},
-    {"neon_fp32_nchw_pool3",
-     [](const PoolDataTypeISASelectorData &data)
-     {
-         return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F32) &&
-                 (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 3));
-     },
-     REGISTER_FP32_NEON(arm_compute::cpu::pooling3_fp32_neon_nchw)},
-    {"neon_fp32_nchw_pool7",
-     [](const PoolDataTypeISASelectorData &data)
-     {
-         return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F32) &&
-                 (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 7));
-     },
-     REGISTER_FP32_NEON(arm_compute::cpu::pooling7_fp32_neon_nchw)},
-    {"neon_fp32_nchw_poolMxN",
-     [](const PoolDataTypeISASelectorData &data)
-     { return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F32)); },
-     REGISTER_FP32_NEON(arm_compute::cpu::poolingMxN_fp32_neon_nchw)},
+/** Pool regions larger than the 7x7 specialization reduce whole output rows rather than rescanning each region */
+constexpr size_t max_small_pool_area = 49;
 #endif /* defined(ENABLE_NCHW_KERNELS) */
-};
+
+/** Whether each pooling region spans the whole unpadded input plane, as in global pooling */
+bool covers_whole_plane(const ITensorInfo &src, const PoolingLayerInfo &pool_info, const Size2D &pool_size)
+{
+    const auto data_layout = pool_info.data_layout == DataLayout::UNKNOWN ? src.data_layout() : pool_info.data_layout;
+    const int  idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const int  idx_height  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+
+    return pool_size.x() == src.dimension(idx_width) && pool_size.y() == src.dimension(idx_height) &&
+           !pool_info.pad_stride_info.has_padding();
+}
 
 Status validate_arguments(const ITensorInfo      *src,
                           const ITensorInfo      *dst,
@@ -214,8 +130,9 @@ Status validate_arguments(const ITensorInfo      *src,
         }
     }
 
-    const auto *uk = CpuPool2dKernel::get_implementation(PoolDataTypeISASelectorData{
-        src->data_type(), src->data_layout(), pool_stride_x, pool_size, CPUInfo::get().get_isa()});
+    const auto *uk = CpuPool2dKernel::get_implementation(
+        PoolDataTypeISASelectorData{src->data_type(), src->data_layout(), pool_stride_x, pool_size,
+                                    CPUInfo::get().get_isa(), covers_whole_plane(*src, pool_info, pool_size)});
     ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
 
     return Status{};
@@ -321,7 +238,8 @@ void CpuPool2dKernel::configure(ITensorInfo            *src,
 
     const auto *uk = CpuPool2dKernel::get_implementation(
         PoolDataTypeISASelectorData{src->data_type(), src->data_layout(), (int)pad_stride_info.stride().first,
-                                    pool_size, CPUInfo::get().get_isa()});
+                                    pool_size, CPUInfo::get().get_isa(),
+                                    covers_whole_plane(*src, pool_info, pool_size)});
     ARM_COMPUTE_ERROR_ON(uk == nullptr);
 
     // Set instance variables
@@ -443,6 +361,120 @@ const char *CpuPool2dKernel::name() const
 
 const std::vector<CpuPool2dKernel::PoolingKernel> &CpuPool2dKernel::get_available_kernels()
 {
+    static const std::vector<PoolingKernel> available_kernels = {
+        {"neon_qu8_nhwc_poolMxN",
+         [](const PoolDataTypeISASelectorData &data)
+         { return ((data.dl == DataLayout::NHWC) && (data.dt == DataType::QASYMM8)); },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::poolingMxN_qasymm8_neon_nhwc)},
+        {"neon_qs8_nhwc_poolMxN",
+         [](const PoolDataTypeISASelectorData &data)
+         { return ((data.dl == DataLayout::NHWC) && (data.dt == DataType::QASYMM8_SIGNED)); },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::poolingMxN_qasymm8_signed_neon_nhwc)},
+        {"neon_f16_nhwc_poolMxN",
+         [](const PoolDataTypeISASelectorData &data)
+         { return ((data.dl == DataLayout::NHWC) && (data.dt == DataType::F16)) && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::poolingMxN_fp16_neon_nhwc)},
+        {"neon_fp32_nhwc_poolMxN",
+         [](const PoolDataTypeISASelectorData &data)
+         { return ((data.dl == DataLayout::NHWC) && (data.dt == DataType::F32)); },
+         REGISTER_FP32_NEON(arm_compute::cpu::poolingMxN_fp32_neon_nhwc)},
+#if defined(ENABLE_NCHW_KERNELS)
+        {"neon_qu8_nchw_pool2",
+         [](const PoolDataTypeISASelectorData &data)
+         {
+             return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::QASYMM8) &&
+                     (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 2) &&
+                     (data.pool_stride_x < 3));
+         },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::pooling2_quantized_neon_nchw<uint8_t>)},
+        {"neon_qu8_nchw_pool3",
+         [](const PoolDataTypeISASelectorData &data)
+         {
+             return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::QASYMM8) &&
+                     (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 3) &&
+                     (data.pool_stride_x < 3));
+         },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::pooling3_quantized_neon_nchw<uint8_t>)},
+        {"neon_qu8_nchw_poolMxN",
+         [](const PoolDataTypeISASelectorData &data)
+         { return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::QASYMM8)); },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::poolingMxN_quantized_neon_nchw<uint8_t>)},
+        {"neon_qs8_nchw_pool2",
+         [](const PoolDataTypeISASelectorData &data)
+         {
+             return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::QASYMM8_SIGNED) &&
+                     (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 2) &&
+                     (data.pool_stride_x < 3));
+         },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::pooling2_quantized_neon_nchw<int8_t>)},
+        {"neon_qs8_nchw_pool3",
+         [](const PoolDataTypeISASelectorData &data)
+         {
+             return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::QASYMM8_SIGNED) &&
+                     (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 3) &&
+                     (data.pool_stride_x < 3));
+         },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::pooling3_quantized_neon_nchw<int8_t>)},
+        {"neon_qs8_nchw_poolMxN",
+         [](const PoolDataTypeISASelectorData &data)
+         { return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::QASYMM8_SIGNED)); },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::poolingMxN_quantized_neon_nchw<int8_t>)},
+        {"neon_fp16_nchw_pool2",
+         [](const PoolDataTypeISASelectorData &data)
+         {
+             return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F16 && data.isa.fp16) &&
+                     (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 2));
+         },
+         REGISTER_FP16_NEON(arm_compute::cpu::pooling2_fp16_neon_nchw)},
+        {"neon_fp16_nchw_pool3",
+         [](const PoolDataTypeISASelectorData &data)
+         {
+             return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F16 && data.isa.fp16) &&
+                     (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 3));
+         },
+         REGISTER_FP16_NEON(arm_compute::cpu::pooling3_fp16_neon_nchw)},
+        {"neon_fp16_nchw_poolMxN",
+         [](const PoolDataTypeISASelectorData &data)
+         { return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F16 && data.isa.fp16)); },
+         REGISTER_FP16_NEON(arm_compute::cpu::poolingMxN_fp16_neon_nchw)},
+        {"neon_fp32_nchw_pool2",
+         [](const PoolDataTypeISASelectorData &data)
+         {
+             return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F32) &&
+                     (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 2));
+         },
+         REGISTER_FP32_NEON(arm_compute::cpu::pooling2_fp32_neon_nchw)},
+        {"neon_fp32_nchw_pool3",
+         [](const PoolDataTypeISASelectorData &data)
+         {
+             return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F32) &&
+                     (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 3));
+         },
+         REGISTER_FP32_NEON(arm_compute::cpu::pooling3_fp32_neon_nchw)},
+        {"neon_fp32_nchw_pool7",
+         [](const PoolDataTypeISASelectorData &data)
+         {
+             return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F32) &&
+                     (data.pool_size.x() == data.pool_size.y()) && (data.pool_size.x() == 7));
+         },
+         REGISTER_FP32_NEON(arm_compute::cpu::pooling7_fp32_neon_nchw)},
+        {"neon_fp32_nchw_pool_global",
+         [](const PoolDataTypeISASelectorData &data)
+         { return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F32) && data.is_global_pooling); },
+         REGISTER_FP32_NEON(arm_compute::cpu::pooling_global_fp32_neon_nchw)},
+        {"neon_fp32_nchw_poolMxN_large",
+         [](const PoolDataTypeISASelectorData &data)
+         {
+             return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F32) &&
+                     (data.pool_size.area() > max_small_pool_area));
+         },
+         REGISTER_FP32_NEON(arm_compute::cpu::poolingMxN_large_fp32_neon_nchw)},
+        {"neon_fp32_nchw_poolMxN",
+         [](const PoolDataTypeISASelectorData &data)
+         { return ((data.dl == DataLayout::NCHW) && (data.dt == DataType::F32)); },
+         REGISTER_FP32_NEON(arm_compute::cpu::poolingMxN_fp32_neon_nchw)},
+#endif /* defined(ENABLE_NCHW_KERNELS) */
+    };
     return available_kernels;
 }
 
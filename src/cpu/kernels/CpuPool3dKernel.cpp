@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,18 +42,6 @@ namespace
 {
 using namespace misc::shape_calculator;
 
-static const std::vector<CpuPool3dKernel::Pooling3dKernel> available_kernels = {
-    {"neon_qu8_ndhwc_poolMxNxD", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8); },
-     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_q8_pool3d)},
-    {"neon_qs8_ndhwc_poolMxNxD",
-     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8_SIGNED); },
-     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_q8_signed_pool3d)},
-    {"neon_fp16_ndhwc_poolMxNxD",
-     [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16 && data.isa.fp16); },
-     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_pool3d)},
-    {"neon_fp32_ndhwc_poolMxNxD", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
-     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_pool3d)}};
-
 Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const Pooling3dLayerInfo &pool_info)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
@@ -144,8 +132,15 @@ void CpuPool3dKernel::configure(const ITensorInfo *src, ITensorInfo *dst, const
     _run_method = uk->ukernel;
     _name       = std::string("CpuPool3dKernel").append("/").append(uk->name);
 
-    // Configure kernel window
+    // Configure kernel window, the height, depth and batch dimensions are collapsed so that the work can be split
+    // across all of them: the ukernels expand the coordinates back from the output shape
     Window win = calculate_max_window(*dst, Steps());
+    if (!dst->has_padding())
+    {
+        bool has_collapsed = false;
+        win                = win.collapse_if_possible(win, Window::DimZ, &has_collapsed);
+        _split_dimension   = has_collapsed ? Window::DimZ : Window::DimY;
+    }
     ICpuKernel::configure(win);
 }
 
@@ -178,6 +173,17 @@ const char *CpuPool3dKernel::name() const
 
 const std::vector<CpuPool3dKernel::Pooling3dKernel> &CpuPool3dKernel::get_available_kernels()
 {
+    static const std::vector<Pooling3dKernel> available_kernels = {
+        {"neon_qu8_ndhwc_poolMxNxD", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8); },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_q8_pool3d)},
+        {"neon_qs8_ndhwc_poolMxNxD",
+         [](const DataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8_SIGNED); },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_q8_signed_pool3d)},
+        {"neon_fp16_ndhwc_poolMxNxD",
+         [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16 && data.isa.fp16); },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_pool3d)},
+        {"neon_fp32_ndhwc_poolMxNxD", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_pool3d)}};
     return available_kernels;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -82,10 +82,20 @@ public:
 
     static const std::vector<Pooling3dKernel> &get_available_kernels();
 
+    /** Get the dimension along which the kernel window should be split across threads
+     *
+     * @return DimZ when the height, depth and batch dimensions are collapsed into it, DimY otherwise
+     */
+    size_t get_split_dimension() const
+    {
+        return _split_dimension;
+    }
+
 private:
     Pooling3dLayerInfo _pool_info{};
     Pooling3dKernelPtr _run_method{nullptr};
     std::string        _name{};
+    size_t             _split_dimension{Window::DimY};
 };
 
 } // namespace kernels
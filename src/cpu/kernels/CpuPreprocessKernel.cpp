@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuPreprocessKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/preprocess/list.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo        *src,
+                          const ITensorInfo        *dst,
+                          Format                    format,
+                          const std::vector<float> &mean,
+                          const std::vector<float> &std_dev)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F32, DataType::QASYMM8,
+                                                         DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(dst, DataLayout::NHWC);
+
+    switch (format)
+    {
+        case Format::NV12:
+        case Format::NV21:
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->num_dimensions() > 2, "Semi-planar images must be 2D tensors");
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(1) % 3 != 0,
+                                            "Semi-planar images must hold H luma rows and H / 2 chroma rows");
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) % 2 != 0 || (src->dimension(1) / 3) % 2 != 0,
+                                            "Semi-planar images must have an even width and height");
+            break;
+        case Format::RGB888:
+        case Format::RGBA8888:
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->num_dimensions() > 3, "Packed images must be 3D tensors");
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) != (format == Format::RGB888 ? 3U : 4U),
+                                            "The channels of the image do not match its format");
+            break;
+        default:
+            ARM_COMPUTE_RETURN_ERROR_MSG("Unsupported image format");
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->total_size() == 0, "The destination shape must be initialized");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->num_dimensions() > 3 || dst->dimension(0) != 3,
+                                    "The destination must be a single image of 3 channels");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->dimension(1) == 0 || dst->dimension(2) == 0,
+                                    "The destination width and height must not be 0");
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(mean.size() != 1 && mean.size() != 3,
+                                    "There must be a single mean or one per channel");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(std_dev.size() != 1 && std_dev.size() != 3,
+                                    "There must be a single standard deviation or one per channel");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(std::find(std_dev.begin(), std_dev.end(), 0.f) != std_dev.end(),
+                                    "Standard deviations must not be 0");
+
+    const auto *uk =
+        CpuPreprocessKernel::get_implementation(DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuPreprocessKernel::PreprocessKernel> &CpuPreprocessKernel::get_available_kernels()
+{
+    static const std::vector<PreprocessKernel> available_kernels = {
+        {"neon_fp32_preprocess", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_preprocess)},
+        {"neon_qu8_preprocess", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qu8_preprocess)},
+        {"neon_qs8_preprocess", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qs8_preprocess)},
+    };
+    return available_kernels;
+}
+
+void CpuPreprocessKernel::configure(const ITensorInfo        *src,
+                                    ITensorInfo              *dst,
+                                    Format                    format,
+                                    const std::vector<float> &mean,
+                                    const std::vector<float> &std_dev,
+                                    bool                      bgr)
+{
+    ARM_COMPUTE_UNUSED(src);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, format, mean, std_dev));
+
+    const auto *uk =
+        CpuPreprocessKernel::get_implementation(DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _format     = format;
+    _bgr        = bgr;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuPreprocessKernel").append("/").append(uk->name);
+
+    // Fold the normalization and the quantization of each channel into a single scale and bias
+    const bool  is_quantized = is_data_type_quantized_asymmetric(dst->data_type());
+    const auto  qinfo        = dst->quantization_info().uniform();
+    const float qscale       = is_quantized ? qinfo.scale : 1.f;
+    const float qoffset      = is_quantized ? static_cast<float>(qinfo.offset) : 0.f;
+
+    _channel_scale.resize(3);
+    _channel_bias.resize(3);
+    for (size_t c = 0; c < 3; ++c)
+    {
+        const float channel_mean = mean.size() == 1 ? mean[0] : mean[c];
+        const float channel_std  = std_dev.size() == 1 ? std_dev[0] : std_dev[c];
+        _channel_scale[c]        = 1.f / (channel_std * qscale);
+        _channel_bias[c]         = qoffset - channel_mean * _channel_scale[c];
+    }
+
+    // The channels of a pixel are computed together, the rows are split across threads
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    ICpuKernel<CpuPreprocessKernel>::configure(win);
+}
+
+Status CpuPreprocessKernel::validate(const ITensorInfo        *src,
+                                     const ITensorInfo        *dst,
+                                     Format                    format,
+                                     const std::vector<float> &mean,
+                                     const std::vector<float> &std_dev,
+                                     bool                      bgr)
+{
+    ARM_COMPUTE_UNUSED(bgr);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, format, mean, std_dev));
+
+    return Status{};
+}
+
+void CpuPreprocessKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuPreprocessKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    auto       dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, dst, _format, _bgr, _channel_scale.data(), _channel_bias.data(), window);
+}
+
+const char *CpuPreprocessKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUPREPROCESSKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUPREPROCESSKERNEL_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the kernel converting camera frames to the normalized RGB input of a network in a single pass
+ *
+ * The source image is converted to RGB, resized with area interpolation, then each channel c is normalized and
+ * converted to the destination type:
+ * @f[ dst_c = \frac{resized_c - mean_c}{std_c} @f]
+ *
+ * Semi-planar YUV sources use the full range BT.601 conversion. The RGB values are in [0, 255].
+ */
+class CpuPreprocessKernel : public ICpuKernel<CpuPreprocessKernel>
+{
+private:
+    using PreprocessKernelPtr = std::add_pointer<void(
+        const ITensor *, ITensor *, Format, bool, const float *, const float *, const Window &)>::type;
+
+public:
+    CpuPreprocessKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuPreprocessKernel);
+
+    /** Set the source and destination tensors.
+     *
+     * @param[in]  src     Source image info. Data types supported: U8.
+     *                     NV12 and NV21 images have the shape [W, H * 3 / 2]: the H luma rows followed by the H / 2
+     *                     interleaved chroma rows, W and H must be even. RGB888 and RGBA8888 images have the shape
+     *                     [3, W, H] and [4, W, H], the alpha channel is ignored.
+     * @param[out] dst     Destination tensor info with NHWC layout and the shape [3, resized W, resized H].
+     *                     Data types supported: F32/QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  format  Format of @p src. Formats supported: NV12/NV21/RGB888/RGBA8888.
+     * @param[in]  mean    Mean of each destination channel, or a single mean for all the channels.
+     * @param[in]  std_dev Standard deviation of each destination channel, or a single one for all the channels.
+     *                     Must not be 0.
+     * @param[in]  bgr     True to write the channels of @p dst in BGR order.
+     */
+    void configure(const ITensorInfo        *src,
+                   ITensorInfo              *dst,
+                   Format                    format,
+                   const std::vector<float> &mean,
+                   const std::vector<float> &std_dev,
+                   bool                      bgr);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuPreprocessKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo        *src,
+                           const ITensorInfo        *dst,
+                           Format                    format,
+                           const std::vector<float> &mean,
+                           const std::vector<float> &std_dev,
+                           bool                      bgr);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct PreprocessKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        PreprocessKernelPtr          ukernel;
+    };
+
+    static const std::vector<PreprocessKernel> &get_available_kernels();
+
+private:
+    Format              _format{Format::UNKNOWN};
+    bool                _bgr{false};
+    std::vector<float>  _channel_scale{};
+    std::vector<float>  _channel_bias{};
+    PreprocessKernelPtr _run_method{nullptr};
+    std::string         _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUPREPROCESSKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -166,7 +166,11 @@ void reshape_tensor_per_window(const Window &window, const ITensor *src, ITensor
     const auto input_ptr  = src_it.ptr();
     const auto output_ptr = dst_it.ptr();
 
-    std::memcpy(output_ptr, input_ptr, window_size_in_bytes);
+    // Nothing to copy when the destination aliases the source
+    if (output_ptr != input_ptr)
+    {
+        std::memcpy(output_ptr, input_ptr, window_size_in_bytes);
+    }
 }
 } // namespace
 
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuResizeNormalizeKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/resize_normalize/list.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo        *src,
+                          const ITensorInfo        *dst,
+                          const std::vector<float> &mean,
+                          const std::vector<float> &std_dev)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::U8, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F32, DataType::QASYMM8,
+                                                         DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(src, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(dst, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->num_dimensions() > 4, "Only up to 4D images are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->total_size() == 0, "The destination shape must be initialized");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->dimension(0) != src->dimension(0) || dst->dimension(3) != src->dimension(3),
+                                    "The destination must have the channels and batches of the source");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->dimension(1) == 0 || dst->dimension(2) == 0,
+                                    "The destination width and height must not be 0");
+
+    const size_t channels = src->dimension(0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(mean.size() != 1 && mean.size() != channels,
+                                    "There must be a single mean or one per channel");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(std_dev.size() != 1 && std_dev.size() != channels,
+                                    "There must be a single standard deviation or one per channel");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(std::find(std_dev.begin(), std_dev.end(), 0.f) != std_dev.end(),
+                                    "Standard deviations must not be 0");
+
+    const auto *uk = CpuResizeNormalizeKernel::get_implementation(
+        CastDataTypeISASelectorData{src->data_type(), dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuResizeNormalizeKernel::ResizeNormalizeKernel> &CpuResizeNormalizeKernel::get_available_kernels()
+{
+    static const std::vector<ResizeNormalizeKernel> available_kernels = {
+        {"neon_u8_to_fp32_resize_normalize",
+         [](const CastDataTypeISASelectorData &data)
+         { return data.src_dt == DataType::U8 && data.dst_dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_u8_to_fp32_resize_normalize)},
+        {"neon_u8_to_qu8_resize_normalize",
+         [](const CastDataTypeISASelectorData &data)
+         { return data.src_dt == DataType::U8 && data.dst_dt == DataType::QASYMM8; },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_u8_to_qu8_resize_normalize)},
+        {"neon_u8_to_qs8_resize_normalize",
+         [](const CastDataTypeISASelectorData &data)
+         { return data.src_dt == DataType::U8 && data.dst_dt == DataType::QASYMM8_SIGNED; },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_u8_to_qs8_resize_normalize)},
+        {"neon_fp32_to_fp32_resize_normalize",
+         [](const CastDataTypeISASelectorData &data)
+         { return data.src_dt == DataType::F32 && data.dst_dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_to_fp32_resize_normalize)},
+        {"neon_fp32_to_qu8_resize_normalize",
+         [](const CastDataTypeISASelectorData &data)
+         { return data.src_dt == DataType::F32 && data.dst_dt == DataType::QASYMM8; },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_fp32_to_qu8_resize_normalize)},
+        {"neon_fp32_to_qs8_resize_normalize",
+         [](const CastDataTypeISASelectorData &data)
+         { return data.src_dt == DataType::F32 && data.dst_dt == DataType::QASYMM8_SIGNED; },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_fp32_to_qs8_resize_normalize)},
+    };
+    return available_kernels;
+}
+
+void CpuResizeNormalizeKernel::configure(const ITensorInfo        *src,
+                                         ITensorInfo              *dst,
+                                         const std::vector<float> &mean,
+                                         const std::vector<float> &std_dev)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, mean, std_dev));
+
+    const auto *uk = CpuResizeNormalizeKernel::get_implementation(
+        CastDataTypeISASelectorData{src->data_type(), dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuResizeNormalizeKernel").append("/").append(uk->name);
+
+    // Fold the normalization and the quantization of each channel into a single scale and bias
+    const bool  is_quantized = is_data_type_quantized_asymmetric(dst->data_type());
+    const auto  qinfo        = dst->quantization_info().uniform();
+    const float qscale       = is_quantized ? qinfo.scale : 1.f;
+    const float qoffset      = is_quantized ? static_cast<float>(qinfo.offset) : 0.f;
+
+    const size_t channels = src->dimension(0);
+    _channel_scale.resize(channels);
+    _channel_bias.resize(channels);
+    for (size_t c = 0; c < channels; ++c)
+    {
+        const float channel_mean = mean.size() == 1 ? mean[0] : mean[c];
+        const float channel_std  = std_dev.size() == 1 ? std_dev[0] : std_dev[c];
+        _channel_scale[c]        = 1.f / (channel_std * qscale);
+        _channel_bias[c]         = qoffset - channel_mean * _channel_scale[c];
+    }
+
+    // The channels of a pixel are computed together, the rows are split across threads
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    ICpuKernel<CpuResizeNormalizeKernel>::configure(win);
+}
+
+Status CpuResizeNormalizeKernel::validate(const ITensorInfo        *src,
+                                          const ITensorInfo        *dst,
+                                          const std::vector<float> &mean,
+                                          const std::vector<float> &std_dev)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, mean, std_dev));
+
+    return Status{};
+}
+
+void CpuResizeNormalizeKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuResizeNormalizeKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    auto       dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, dst, _channel_scale.data(), _channel_bias.data(), window);
+}
+
+const char *CpuResizeNormalizeKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuRowAbsMaxKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+TensorShape compute_row_abs_max_shape(const ITensorInfo &src)
+{
+    TensorShape shape = src.tensor_shape();
+    shape.remove_dimension(0, false);
+    return shape;
+}
+
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32);
+
+    if (dst->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), compute_row_abs_max_shape(*src));
+    }
+    return Status{};
+}
+} // namespace
+
+void CpuRowAbsMaxKernel::configure(const ITensorInfo *src, ITensorInfo *dst)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst));
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*dst, compute_row_abs_max_shape(*src), 1, src->data_type());
+
+    // Each row is reduced by a single thread, the window only walks the output
+    Window win = calculate_max_window(*dst, Steps(1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuRowAbsMaxKernel::validate(const ITensorInfo *src, const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst));
+    return Status{};
+}
+
+void CpuRowAbsMaxKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    const auto src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    auto       dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    const int      row_size = static_cast<int>(src->info()->dimension(0));
+    const Strides &strides  = src->info()->strides_in_bytes();
+    const uint8_t *src_base = src->buffer() + src->info()->offset_first_element_in_bytes();
+    Iterator       out(dst, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const float *row = reinterpret_cast<const float *>(src_base + id.x() * strides[1] + id.y() * strides[2] +
+                                                               id.z() * strides[3]);
+
+            auto  vmax    = wrapper::vdup_n(0.f, wrapper::traits::vector_128_tag{});
+            float row_max = 0.f;
+
+            int x = 0;
+            for (; x <= (row_size - 16); x += 16)
+            {
+                const auto a0 = wrapper::vabs(wrapper::vloadq(row + x));
+                const auto a1 = wrapper::vabs(wrapper::vloadq(row + x + 4));
+                const auto a2 = wrapper::vabs(wrapper::vloadq(row + x + 8));
+                const auto a3 = wrapper::vabs(wrapper::vloadq(row + x + 12));
+                vmax          = wrapper::vmax(vmax, wrapper::vmax(wrapper::vmax(a0, a1), wrapper::vmax(a2, a3)));
+            }
+            for (; x <= (row_size - 4); x += 4)
+            {
+                vmax = wrapper::vmax(vmax, wrapper::vabs(wrapper::vloadq(row + x)));
+            }
+
+            // Reduce the vector accumulator
+            auto tmp = wrapper::vpmax(wrapper::vgethigh(vmax), wrapper::vgetlow(vmax));
+            tmp      = wrapper::vpmax(tmp, tmp);
+            row_max  = wrapper::vgetlane(tmp, 0);
+
+            // Compute left-over elements
+            for (; x < row_size; ++x)
+            {
+                row_max = std::max(row_max, std::fabs(row[x]));
+            }
+
+            *reinterpret_cast<float *>(out.ptr()) = row_max;
+        },
+        out);
+}
+
+const char *CpuRowAbsMaxKernel::name() const
+{
+    return "CpuRowAbsMaxKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
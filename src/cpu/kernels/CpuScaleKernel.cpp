@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -282,57 +282,6 @@ namespace kernels
 {
 namespace
 {
-static const std::vector<CpuScaleKernel::ScaleKernel> available_kernels = {
-    {"sve_fp16_scale",
-     [](const ScaleKernelDataTypeISASelectorData &data)
-     {
-         return data.dt == DataType::F16 && data.isa.sve && data.isa.fp16 &&
-                data.interpolation_policy != InterpolationPolicy::BILINEAR;
-     },
-     REGISTER_FP16_SVE(arm_compute::cpu::fp16_sve_scale)},
-    {"sve_fp32_scale",
-     [](const ScaleKernelDataTypeISASelectorData &data)
-     { return data.dt == DataType::F32 && data.isa.sve && data.interpolation_policy != InterpolationPolicy::BILINEAR; },
-     REGISTER_FP32_SVE(arm_compute::cpu::fp32_sve_scale)},
-    {"sve_qu8_scale",
-     [](const ScaleKernelDataTypeISASelectorData &data) {
-         return data.dt == DataType::QASYMM8 && data.isa.sve &&
-                data.interpolation_policy != InterpolationPolicy::BILINEAR;
-     },
-     REGISTER_QASYMM8_SVE(arm_compute::cpu::qasymm8_sve_scale)},
-    {"sve_qs8_scale",
-     [](const ScaleKernelDataTypeISASelectorData &data)
-     {
-         return data.dt == DataType::QASYMM8_SIGNED && data.isa.sve &&
-                data.interpolation_policy != InterpolationPolicy::BILINEAR;
-     },
-     REGISTER_QASYMM8_SIGNED_SVE(arm_compute::cpu::qasymm8_signed_sve_scale)},
-    {"sve_u8_scale",
-     [](const ScaleKernelDataTypeISASelectorData &data)
-     { return data.dt == DataType::U8 && data.isa.sve && data.interpolation_policy != InterpolationPolicy::BILINEAR; },
-     REGISTER_INTEGER_SVE(arm_compute::cpu::u8_sve_scale)},
-    {"sve_s16_scale",
-     [](const ScaleKernelDataTypeISASelectorData &data)
-     { return data.dt == DataType::S16 && data.isa.sve && data.interpolation_policy != InterpolationPolicy::BILINEAR; },
-     REGISTER_INTEGER_SVE(arm_compute::cpu::s16_sve_scale)},
-    {"neon_fp16_scale",
-     [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
-     REGISTER_FP16_NEON(arm_compute::cpu::fp16_common_neon_scale)},
-    {"neon_fp32_scale", [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::F32; },
-     REGISTER_FP32_NEON(arm_compute::cpu::common_neon_scale<float>)},
-    {"neon_qu8_scale", [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
-     REGISTER_QASYMM8_NEON(arm_compute::cpu::qasymm8_neon_scale)},
-    {"neon_qs8_scale",
-     [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
-     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::qasymm8_signed_neon_scale)},
-    {"neon_u8_scale", [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::U8; },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::u8_neon_scale)},
-    {"neon_s8_scale", [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::S8; },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::s8_neon_scale)},
-    {"neon_s16_scale", [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::S16; },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::s16_neon_scale)},
-};
-
 Status validate_arguments(const ITensorInfo     *src,
                           const ITensorInfo     *dx,
                           const ITensorInfo     *dy,
@@ -386,8 +335,17 @@ Status validate_arguments(const ITensorInfo     *src,
 
     if (info.interpolation_policy == InterpolationPolicy::AREA)
     {
-        ARM_COMPUTE_RETURN_ERROR_ON(data_layout != DataLayout::NCHW);
-        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::U8);
+        if (data_layout == DataLayout::NCHW)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::U8);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::U8, DataType::QASYMM8,
+                                                                 DataType::QASYMM8_SIGNED, DataType::F16,
+                                                                 DataType::F32);
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.align_corners, "Area interpolation does not align corners");
+        }
     }
 
     return Status{};
@@ -530,6 +488,65 @@ const char *CpuScaleKernel::name() const
 
 const std::vector<CpuScaleKernel::ScaleKernel> &CpuScaleKernel::get_available_kernels()
 {
+    static const std::vector<ScaleKernel> available_kernels = {
+        {"sve_fp16_scale",
+         [](const ScaleKernelDataTypeISASelectorData &data)
+         {
+             return data.dt == DataType::F16 && data.isa.sve && data.isa.fp16 &&
+                    data.interpolation_policy == InterpolationPolicy::NEAREST_NEIGHBOR;
+         },
+         REGISTER_FP16_SVE(arm_compute::cpu::fp16_sve_scale)},
+        {"sve_fp32_scale",
+         [](const ScaleKernelDataTypeISASelectorData &data)
+         {
+             return data.dt == DataType::F32 && data.isa.sve &&
+                    data.interpolation_policy == InterpolationPolicy::NEAREST_NEIGHBOR;
+         },
+         REGISTER_FP32_SVE(arm_compute::cpu::fp32_sve_scale)},
+        {"sve_qu8_scale",
+         [](const ScaleKernelDataTypeISASelectorData &data) {
+             return data.dt == DataType::QASYMM8 && data.isa.sve &&
+                    data.interpolation_policy == InterpolationPolicy::NEAREST_NEIGHBOR;
+         },
+         REGISTER_QASYMM8_SVE(arm_compute::cpu::qasymm8_sve_scale)},
+        {"sve_qs8_scale",
+         [](const ScaleKernelDataTypeISASelectorData &data)
+         {
+             return data.dt == DataType::QASYMM8_SIGNED && data.isa.sve &&
+                    data.interpolation_policy == InterpolationPolicy::NEAREST_NEIGHBOR;
+         },
+         REGISTER_QASYMM8_SIGNED_SVE(arm_compute::cpu::qasymm8_signed_sve_scale)},
+        {"sve_u8_scale",
+         [](const ScaleKernelDataTypeISASelectorData &data)
+         {
+             return data.dt == DataType::U8 && data.isa.sve &&
+                    data.interpolation_policy == InterpolationPolicy::NEAREST_NEIGHBOR;
+         },
+         REGISTER_INTEGER_SVE(arm_compute::cpu::u8_sve_scale)},
+        {"sve_s16_scale",
+         [](const ScaleKernelDataTypeISASelectorData &data)
+         {
+             return data.dt == DataType::S16 && data.isa.sve &&
+                    data.interpolation_policy == InterpolationPolicy::NEAREST_NEIGHBOR;
+         },
+         REGISTER_INTEGER_SVE(arm_compute::cpu::s16_sve_scale)},
+        {"neon_fp16_scale",
+         [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::fp16_common_neon_scale)},
+        {"neon_fp32_scale", [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::common_neon_scale<float>)},
+        {"neon_qu8_scale", [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::qasymm8_neon_scale)},
+        {"neon_qs8_scale",
+         [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::qasymm8_signed_neon_scale)},
+        {"neon_u8_scale", [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::U8; },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::u8_neon_scale)},
+        {"neon_s8_scale", [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::S8; },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::s8_neon_scale)},
+        {"neon_s16_scale", [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::S16; },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::s16_neon_scale)},
+    };
     return available_kernels;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -58,7 +58,8 @@ public:
     /** Initialise the kernel's inputs, output and interpolation policy
      *
      * @note dx, dy and offsets have the same dimensions (width and height) of the output tensor
-     * @note Using @p policy Area only supports data layout NCHW and input data type U8.
+     * @note Using @p policy Area with data layout NCHW only supports input data type U8, with data layout NHWC it
+     *       supports U8/QASYMM8/QASYMM8_SIGNED/F16/F32 and averages the covered source pixels in two separable passes.
      * @note Using S8 data type only supports NHWC, @p border_mode Replicate, and @p policy Bilinear
      *
      * @param[in]  src     Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/U8/S8/S16/F16/F32.
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuScaledDotProductAttentionKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/attention/list.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *q,
+                          const ITensorInfo *k,
+                          const ITensorInfo *v,
+                          const ITensorInfo *dst,
+                          const ITensorInfo *tmp,
+                          bool               is_causal)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(q, k, v, dst, tmp);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(q);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_BF16_UNSUPPORTED(q);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(q, 1, DataType::F32, DataType::F16, DataType::BFLOAT16);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(q, k, v);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(q->num_dimensions() > 4, "Only up to 4 dimensions are supported");
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(k->dimension(0) != q->dimension(0), "Queries and keys must have the same depth");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(v->dimension(1) != k->dimension(1), "Keys and values must have the same length");
+    for (size_t d = 2; d < 4; ++d)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(k->dimension(d) != q->dimension(d) || v->dimension(d) != q->dimension(d),
+                                        "Queries, keys and values must have the same heads and batches");
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_causal && k->dimension(1) < q->dimension(1),
+                                    "Causal attention needs at least as many keys as queries");
+
+    const TensorShape dst_shape = TensorShape(q->tensor_shape()).set(0, v->dimension(0));
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(q, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), dst_shape);
+    }
+    if (tmp->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(tmp, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(tmp->tensor_shape(),
+                                                           TensorShape(dst_shape).set(0, v->dimension(0) + 2));
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(tmp->has_padding(), "The accumulators must be contiguous");
+    }
+
+    const auto *uk = CpuScaledDotProductAttentionKernel::get_implementation(
+        DataTypeISASelectorData{q->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuScaledDotProductAttentionKernel::SdpaKernel> &
+CpuScaledDotProductAttentionKernel::get_available_kernels()
+{
+    static const std::vector<SdpaKernel> available_kernels = {
+        {"neon_fp32_scaled_dot_product_attention",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_scaled_dot_product_attention)},
+        {"neon_fp16_scaled_dot_product_attention",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_scaled_dot_product_attention)},
+        {"neon_bf16_scaled_dot_product_attention",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::BFLOAT16 && data.isa.bf16; },
+         REGISTER_BF16_NEON(arm_compute::cpu::neon_bf16_scaled_dot_product_attention)},
+    };
+    return available_kernels;
+}
+
+void CpuScaledDotProductAttentionKernel::configure(const ITensorInfo *q,
+                                                   const ITensorInfo *k,
+                                                   const ITensorInfo *v,
+                                                   ITensorInfo       *dst,
+                                                   ITensorInfo       *tmp,
+                                                   float              scale,
+                                                   bool               is_causal)
+{
+    ARM_COMPUTE_UNUSED(k);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(q, k, v, dst, tmp);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(q, k, v, dst, tmp, is_causal));
+
+    // Output and accumulators auto initialization if not yet initialized
+    const TensorShape dst_shape = TensorShape(q->tensor_shape()).set(0, v->dimension(0));
+    auto_init_if_empty(*dst, q->clone()->set_tensor_shape(dst_shape).reset_padding());
+    auto_init_if_empty(*tmp, TensorInfo(TensorShape(dst_shape).set(0, v->dimension(0) + 2), 1, DataType::F32));
+
+    const auto *uk = CpuScaledDotProductAttentionKernel::get_implementation(
+        DataTypeISASelectorData{q->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _scale      = scale;
+    _is_causal  = is_causal;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuScaledDotProductAttentionKernel").append("/").append(uk->name);
+
+    // Each row of the output is computed at once, the ukernel walks the rows in blocks
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    ICpuKernel<CpuScaledDotProductAttentionKernel>::configure(win);
+}
+
+Status CpuScaledDotProductAttentionKernel::validate(const ITensorInfo *q,
+                                                    const ITensorInfo *k,
+                                                    const ITensorInfo *v,
+                                                    const ITensorInfo *dst,
+                                                    const ITensorInfo *tmp,
+                                                    float              scale,
+                                                    bool               is_causal)
+{
+    ARM_COMPUTE_UNUSED(scale);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(q, k, v, dst, tmp, is_causal));
+
+    return Status{};
+}
+
+void CpuScaledDotProductAttentionKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuScaledDotProductAttentionKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto q   = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const auto k   = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const auto v   = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    auto       dst = tensors.get_tensor(TensorType::ACL_DST_0);
+    auto       tmp = tensors.get_tensor(TensorType::ACL_DST_1);
+
+    _run_method(q, k, v, dst, tmp, _scale, _is_causal, window);
+}
+
+const char *CpuScaledDotProductAttentionKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUSCALEDDOTPRODUCTATTENTIONKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUSCALEDDOTPRODUCTATTENTIONKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the fused scaled dot product attention kernel
+ *
+ * Computes @f[ dst = softmax(scale * Q K^T) V @f] with an online softmax over blocks of keys, so the Sq x Skv score
+ * matrix is never written to memory.
+ */
+class CpuScaledDotProductAttentionKernel : public ICpuKernel<CpuScaledDotProductAttentionKernel>
+{
+private:
+    using SdpaKernelPtr = std::add_pointer<void(
+        const ITensor *, const ITensor *, const ITensor *, ITensor *, ITensor *, float, bool, const Window &)>::type;
+
+public:
+    CpuScaledDotProductAttentionKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuScaledDotProductAttentionKernel);
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  q         Queries tensor info with shape [D, Sq, H, B]. Data types supported: F32/F16/BFLOAT16.
+     * @param[in]  k         Keys tensor info with shape [D, Skv, H, B]. Data type supported: same as @p q.
+     * @param[in]  v         Values tensor info with shape [Dv, Skv, H, B]. Data type supported: same as @p q.
+     * @param[out] dst       Destination tensor info with shape [Dv, Sq, H, B]. Data type supported: same as @p q.
+     * @param[in]  tmp       Auxiliary tensor info. Must be F32, contiguous, with shape [Dv + 2, Sq, H, B].
+     * @param[in]  scale     Scale applied to the scores before the softmax, usually 1 / sqrt(D).
+     * @param[in]  is_causal Whether query i only attends to the keys up to i + Skv - Sq.
+     */
+    void configure(const ITensorInfo *q,
+                   const ITensorInfo *k,
+                   const ITensorInfo *v,
+                   ITensorInfo       *dst,
+                   ITensorInfo       *tmp,
+                   float              scale,
+                   bool               is_causal);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuScaledDotProductAttentionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *q,
+                           const ITensorInfo *k,
+                           const ITensorInfo *v,
+                           const ITensorInfo *dst,
+                           const ITensorInfo *tmp,
+                           float              scale,
+                           bool               is_causal);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct SdpaKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        SdpaKernelPtr                ukernel;
+    };
+
+    static const std::vector<SdpaKernel> &get_available_kernels();
+
+private:
+    float         _scale{1.f};
+    bool          _is_causal{false};
+    SdpaKernelPtr _run_method{nullptr};
+    std::string   _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUSCALEDDOTPRODUCTATTENTIONKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,26 +45,25 @@ namespace kernels
 constexpr int max_index_length = 5;
 
 /* Scatter */
-static const std::vector<typename CpuScatterKernel::ScatterKernel> available_kernels = {
-    {"neon_fp32_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
-     REGISTER_FP32_NEON(arm_compute::cpu::scatter_fp32_neon)},
-    {"neon_fp16_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16); },
-     REGISTER_FP16_NEON(arm_compute::cpu::scatter_fp16_neon)},
-    {"neon_s32_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::S32); },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::scatter_s32_neon)},
-    {"neon_s16_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::S16); },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::scatter_s16_neon)},
-    {"neon_s8_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::S8); },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::scatter_s8_neon)},
-    {"neon_u32_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::U32); },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::scatter_u32_neon)},
-    {"neon_u16_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::U16); },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::scatter_u16_neon)},
-    {"neon_u8_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::U8); },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::scatter_u8_neon)}};
-
 const std::vector<typename CpuScatterKernel::ScatterKernel> &CpuScatterKernel::get_available_kernels()
 {
+    static const std::vector<ScatterKernel> available_kernels = {
+        {"neon_fp32_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+         REGISTER_FP32_NEON(arm_compute::cpu::scatter_fp32_neon)},
+        {"neon_fp16_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::F16); },
+         REGISTER_FP16_NEON(arm_compute::cpu::scatter_fp16_neon)},
+        {"neon_s32_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::S32); },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::scatter_s32_neon)},
+        {"neon_s16_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::S16); },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::scatter_s16_neon)},
+        {"neon_s8_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::S8); },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::scatter_s8_neon)},
+        {"neon_u32_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::U32); },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::scatter_u32_neon)},
+        {"neon_u16_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::U16); },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::scatter_u16_neon)},
+        {"neon_u8_scatter", [](const DataTypeISASelectorData &data) { return (data.dt == DataType::U8); },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::scatter_u8_neon)}};
     return available_kernels;
 }
 
@@ -96,7 +95,15 @@ void CpuScatterKernel::configure(const ITensorInfo *updates,
     //  y-dimension refers to the collapsed y-coordinate of the data part of the dst tensor
     Window win;
 
-    if (!is_scalar_block)
+    if (scatter_partitions_blocks(dst->num_dimensions(), index_len))
+    {
+        // The data part is a single block, so the y-dimension refers to the destination blocks instead: each thread
+        // applies the indices that fall in its range of blocks, which keeps colliding indices on the same thread.
+        const size_t num_blocks = dst->tensor_shape().total_size() / _data_block_length;
+        win.set(Window::DimX, Window::Dimension(0, 1, 1));
+        win.set(Window::DimY, Window::Dimension(0, num_blocks, 1));
+    }
+    else
     {
         win = calculate_max_window(*dst, Steps(_data_block_length));
 
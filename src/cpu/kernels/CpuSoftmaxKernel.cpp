@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,67 +51,6 @@ namespace
 {
 
 /* Softmax */
-static const std::vector<typename CpuSoftmaxKernel::SoftmaxKernel> available_kernels = {
-#if defined(ARM_COMPUTE_ENABLE_BF16)
-#if defined(ARM_COMPUTE_ENABLE_SVE)
-    {"sve_bf16_softmax",
-     [](const SoftmaxKernelDataTypeISASelectorData &data)
-     { return (!data.is_log && data.dt == DataType::BFLOAT16 && data.isa.sve && data.axis == 0); },
-     REGISTER_BF16_SVE(sve_softmax_bf16)},
-#endif // defined(ARM_COMPUTE_ENABLE_SVE)
-#endif // defined(ARM_COMPUTE_ENABLE_BF16)
-    {"sme2_fp32_softmax",
-     [](const SoftmaxKernelDataTypeISASelectorData &data)
-     { return (!data.is_log && data.dt == DataType::F32 && data.isa.sme2 && data.axis == 0); },
-     REGISTER_FP32_SME2(sme2_fp32_softmax)},
-    {"neon_fp32_softmax",
-     [](const SoftmaxKernelDataTypeISASelectorData &data) { return (!data.is_log && data.dt == DataType::F32); },
-     REGISTER_FP32_NEON(neon_fp32_softmax<false>)},
-    {"sme2_fp16_softmax",
-     [](const SoftmaxKernelDataTypeISASelectorData &data)
-     { return (!data.is_log && data.dt == DataType::F16 && data.isa.sme2 && data.axis == 0); },
-     REGISTER_FP16_SME2(sme2_fp16_softmax)},
-    {"neon_fp16_softmax",
-     [](const SoftmaxKernelDataTypeISASelectorData &data)
-     { return (!data.is_log && data.dt == DataType::F16) && data.isa.fp16; },
-     REGISTER_FP16_NEON(neon_fp16_softmax<false>)},
-    {"sme2_qu8_softmax_lut_512VL",
-     [](const SoftmaxKernelDataTypeISASelectorData &data)
-     {
-         return (!data.is_log && data.dt == DataType::QASYMM8 && data.isa.sme2 && data.axis == 0 &&
-                 data.sme2_vector_length == 512);
-     },
-     REGISTER_QASYMM8_SME2(sme2_qasymm8_softmax_lut_512VL)},
-    {"neon_qu8_softmax",
-     [](const SoftmaxKernelDataTypeISASelectorData &data) { return (!data.is_log && data.dt == DataType::QASYMM8); },
-     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_softmax<false>)},
-    {"sme2_qs8_softmax_lut_512VL",
-     [](const SoftmaxKernelDataTypeISASelectorData &data)
-     {
-         return (!data.is_log && data.dt == DataType::QASYMM8_SIGNED && data.isa.sme2 && data.axis == 0 &&
-                 data.sme2_vector_length == 512);
-     },
-     REGISTER_QASYMM8_SIGNED_SME2(sme2_qasymm8_signed_softmax_lut_512VL)},
-    {"neon_qs8_softmax",
-     [](const SoftmaxKernelDataTypeISASelectorData &data)
-     { return (!data.is_log && data.dt == DataType::QASYMM8_SIGNED); },
-     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_softmax<false>)},
-    {"neon_fp32_log_softmax",
-     [](const SoftmaxKernelDataTypeISASelectorData &data) { return (data.is_log && data.dt == DataType::F32); },
-     REGISTER_FP32_NEON(neon_fp32_softmax<true>)},
-    {"neon_fp16_log_softmax",
-     [](const SoftmaxKernelDataTypeISASelectorData &data)
-     { return (data.is_log && data.dt == DataType::F16) && data.isa.fp16; },
-     REGISTER_FP16_NEON(neon_fp16_softmax<true>)},
-    {"neon_qu8_log_softmax",
-     [](const SoftmaxKernelDataTypeISASelectorData &data) { return (data.is_log && data.dt == DataType::QASYMM8); },
-     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_softmax<true>)},
-    {"neon_qs8_log_softmax",
-     [](const SoftmaxKernelDataTypeISASelectorData &data)
-     { return (data.is_log && data.dt == DataType::QASYMM8_SIGNED); },
-     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_softmax<true>)},
-};
-
 Status validate_arguments_softmax(
     const ITensorInfo &src, const ITensorInfo &dst, float beta, int axis, const ITensorInfo &tmp, bool is_log)
 {
@@ -159,6 +98,75 @@ Status validate_arguments_softmax(
 
 const std::vector<typename CpuSoftmaxKernel::SoftmaxKernel> &CpuSoftmaxKernel::get_available_kernels()
 {
+    static const std::vector<SoftmaxKernel> available_kernels = {
+#if defined(ARM_COMPUTE_ENABLE_BF16)
+#if defined(ARM_COMPUTE_ENABLE_SVE)
+        {"sve_bf16_softmax",
+         [](const SoftmaxKernelDataTypeISASelectorData &data)
+         { return (!data.is_log && data.dt == DataType::BFLOAT16 && data.isa.sve && data.axis == 0); },
+         REGISTER_BF16_SVE(sve_softmax_bf16)},
+#endif // defined(ARM_COMPUTE_ENABLE_SVE)
+        {"neon_bf16_softmax",
+         [](const SoftmaxKernelDataTypeISASelectorData &data)
+         { return (!data.is_log && data.dt == DataType::BFLOAT16 && data.axis == 0); },
+         REGISTER_BF16_NEON(neon_bf16_softmax<false>)},
+        {"neon_bf16_log_softmax",
+         [](const SoftmaxKernelDataTypeISASelectorData &data)
+         { return (data.is_log && data.dt == DataType::BFLOAT16 && data.axis == 0); },
+         REGISTER_BF16_NEON(neon_bf16_softmax<true>)},
+#endif // defined(ARM_COMPUTE_ENABLE_BF16)
+        {"sme2_fp32_softmax",
+         [](const SoftmaxKernelDataTypeISASelectorData &data)
+         { return (!data.is_log && data.dt == DataType::F32 && data.isa.sme2 && data.axis == 0); },
+         REGISTER_FP32_SME2(sme2_fp32_softmax)},
+        {"neon_fp32_softmax",
+         [](const SoftmaxKernelDataTypeISASelectorData &data) { return (!data.is_log && data.dt == DataType::F32); },
+         REGISTER_FP32_NEON(neon_fp32_softmax<false>)},
+        {"sme2_fp16_softmax",
+         [](const SoftmaxKernelDataTypeISASelectorData &data)
+         { return (!data.is_log && data.dt == DataType::F16 && data.isa.sme2 && data.axis == 0); },
+         REGISTER_FP16_SME2(sme2_fp16_softmax)},
+        {"neon_fp16_softmax",
+         [](const SoftmaxKernelDataTypeISASelectorData &data)
+         { return (!data.is_log && data.dt == DataType::F16) && data.isa.fp16; },
+         REGISTER_FP16_NEON(neon_fp16_softmax<false>)},
+        {"sme2_qu8_softmax_lut_512VL",
+         [](const SoftmaxKernelDataTypeISASelectorData &data)
+         {
+             return (!data.is_log && data.dt == DataType::QASYMM8 && data.isa.sme2 && data.axis == 0 &&
+                     data.sme2_vector_length == 512);
+         },
+         REGISTER_QASYMM8_SME2(sme2_qasymm8_softmax_lut_512VL)},
+        {"neon_qu8_softmax",
+         [](const SoftmaxKernelDataTypeISASelectorData &data)
+         { return (!data.is_log && data.dt == DataType::QASYMM8); },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_softmax<false>)},
+        {"sme2_qs8_softmax_lut_512VL",
+         [](const SoftmaxKernelDataTypeISASelectorData &data)
+         {
+             return (!data.is_log && data.dt == DataType::QASYMM8_SIGNED && data.isa.sme2 && data.axis == 0 &&
+                     data.sme2_vector_length == 512);
+         },
+         REGISTER_QASYMM8_SIGNED_SME2(sme2_qasymm8_signed_softmax_lut_512VL)},
+        {"neon_qs8_softmax",
+         [](const SoftmaxKernelDataTypeISASelectorData &data)
+         { return (!data.is_log && data.dt == DataType::QASYMM8_SIGNED); },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_softmax<false>)},
+        {"neon_fp32_log_softmax",
+         [](const SoftmaxKernelDataTypeISASelectorData &data) { return (data.is_log && data.dt == DataType::F32); },
+         REGISTER_FP32_NEON(neon_fp32_softmax<true>)},
+        {"neon_fp16_log_softmax",
+         [](const SoftmaxKernelDataTypeISASelectorData &data)
+         { return (data.is_log && data.dt == DataType::F16) && data.isa.fp16; },
+         REGISTER_FP16_NEON(neon_fp16_softmax<true>)},
+        {"neon_qu8_log_softmax",
+         [](const SoftmaxKernelDataTypeISASelectorData &data) { return (data.is_log && data.dt == DataType::QASYMM8); },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_softmax<true>)},
+        {"neon_qs8_log_softmax",
+         [](const SoftmaxKernelDataTypeISASelectorData &data)
+         { return (data.is_log && data.dt == DataType::QASYMM8_SIGNED); },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_softmax<true>)},
+    };
     return available_kernels;
 }
 
@@ -195,38 +203,12 @@ void CpuSoftmaxKernel::configure(
     _run_method = uk->ukernel;
     _name       = kernel_name.append("/").append(uk->name);
 
-    Window win;
-
-    int vec_size = 16 / dst->element_size();
-
-    if (_axis == 0)
-    {
-        win = calculate_max_window(*dst, Steps());
-
-        /// TODO:Check dimensions > 0 for holes only. For this, we need
-        /// a utility function checking if there are holes after some dimension.
-        if (!has_holes(*dst, dst->num_dimensions() - 1))
-        {
-            win = win.collapse(win, Window::DimY);
-        }
-    }
-    else if (_axis > 0 && _axis <= 3)
-    {
-        win = calculate_max_window(*dst, Steps(vec_size));
-    }
-    else
-    {
-        ARM_COMPUTE_ERROR("Invalid axis");
-    }
-
-    win.set(_axis, Window::Dimension(0, 1, 1));
-
-    ICpuKernel<CpuSoftmaxKernel>::configure(win);
+    ICpuKernel<CpuSoftmaxKernel>::configure(calculate_window(*dst, _axis));
 
 #ifdef __aarch64__
     const std::string uk_name = uk->name;
 
-    if (src->data_type() == DataType::BFLOAT16)
+    if (uk_name == "sve_bf16_softmax")
     {
         LUTManager &lutmanager = LUTManager::get_instance();
         LUTInfo     info       = {LUTType::Exponential, beta, DataType::BFLOAT16, UniformQuantizationInfo()};
@@ -243,9 +225,49 @@ void CpuSoftmaxKernel::configure(
         const LUTInfo info{LUTType::Exponential, -beta, src->data_type(), qinfo};
         _lut = LUTManager::get_instance().get_lut_table<LookupTable256>(info);
     }
+    if ((uk_name == "neon_qu8_softmax" || uk_name == "neon_qs8_softmax") && axis == 0)
+    {
+        // The NEON ukernels look up exp(-b * scale * d) for the distance d between the max of a row and each of its
+        // values, so the table is indexed with the distance whatever the signedness of the values.
+        UniformQuantizationInfo qinfo = src->quantization_info().uniform();
+        qinfo.offset                  = 0;
+        const LUTInfo info{LUTType::Exponential, -beta, DataType::QASYMM8, qinfo};
+        _lut = LUTManager::get_instance().get_lut_table<LookupTable256>(info);
+    }
 #endif // __aarch64__
 }
 
+Window CpuSoftmaxKernel::calculate_window(const ITensorInfo &dst, int axis)
+{
+    Window win;
+
+    int vec_size = 16 / dst.element_size();
+
+    if (axis == 0)
+    {
+        win = calculate_max_window(dst, Steps());
+
+        /// TODO:Check dimensions > 0 for holes only. For this, we need
+        /// a utility function checking if there are holes after some dimension.
+        if (!has_holes(dst, dst.num_dimensions() - 1))
+        {
+            win = win.collapse(win, Window::DimY);
+        }
+    }
+    else if (axis > 0 && axis <= 3)
+    {
+        win = calculate_max_window(dst, Steps(vec_size));
+    }
+    else
+    {
+        ARM_COMPUTE_ERROR("Invalid axis");
+    }
+
+    win.set(axis, Window::Dimension(0, 1, 1));
+
+    return win;
+}
+
 Status CpuSoftmaxKernel::validate(
     const ITensorInfo *src, const ITensorInfo *dst, float beta, int axis, bool is_log, const ITensorInfo *tmp)
 {
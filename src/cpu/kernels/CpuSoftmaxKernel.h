@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -65,6 +65,15 @@ public:
     static Status
     validate(const ITensorInfo *src, const ITensorInfo *dst, float beta, int axis, bool is_log, const ITensorInfo *tmp);
 
+    /** Calculate the execution window for a destination tensor
+     *
+     * @param[in] dst  Destination tensor info.
+     * @param[in] axis The axis along which to perform the softmax operation.
+     *
+     * @return the execution window
+     */
+    static Window calculate_window(const ITensorInfo &dst, int axis);
+
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
     const char *name() const override;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,35 +53,6 @@ namespace
 using CpuSubKernelDataTypeISASelectorData    = CpuAddKernelDataTypeISASelectorData;
 using CpuSubKernelDataTypeISASelectorDataPtr = CpuAddKernelDataTypeISASelectorDataPtr;
 
-static const std::vector<CpuSubKernel::SubKernel> available_kernels = {
-    {"neon_fp32_sub", [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
-     REGISTER_FP32_NEON(arm_compute::cpu::sub_same_neon<float>)},
-    {"neon_fp16_sub",
-     [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
-     REGISTER_FP16_NEON(arm_compute::cpu::sub_same_neon_fp16)},
-    {"neon_u8_sub", [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::U8); },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::sub_same_neon<uint8_t>)},
-    {"neon_s16_sub", [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::S16); },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::sub_same_neon<int16_t>)},
-    {"neon_s32_sub", [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::S32); },
-     REGISTER_INTEGER_NEON(arm_compute::cpu::sub_same_neon<int32_t>)},
-    {"neon_qu8_sub_fixedpoint",
-     [](const CpuSubKernelDataTypeISASelectorData &data)
-     { return ((data.dt == DataType::QASYMM8) && data.can_use_fixedpoint); },
-     REGISTER_QASYMM8_NEON(arm_compute::cpu::sub_qasymm8_neon_fixedpoint)},
-    {"neon_qs8_sub_fixedpoint",
-     [](const CpuSubKernelDataTypeISASelectorData &data)
-     { return ((data.dt == DataType::QASYMM8_SIGNED) && data.can_use_fixedpoint); },
-     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::sub_qasymm8_signed_neon_fixedpoint)},
-    {"neon_qu8_sub", [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8); },
-     REGISTER_QASYMM8_NEON(arm_compute::cpu::sub_qasymm8_neon)},
-    {"neon_qs8_sub",
-     [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8_SIGNED); },
-     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::sub_qasymm8_signed_neon)},
-    {"neon_qs16_sub", [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::QSYMM16); },
-     REGISTER_QSYMM16_NEON(arm_compute::cpu::sub_qsymm16_neon)},
-};
-
 inline Status
 validate_arguments(const ITensorInfo &src0, const ITensorInfo &src1, const ITensorInfo &dst, ConvertPolicy policy)
 {
@@ -143,7 +114,7 @@ void CpuSubKernel::configure(const ITensorInfo *src0, const ITensorInfo *src1, I
 
     // CpuSubKernel doesn't need padding so update_window_and_padding() can be skipped
     Window win;
-    std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src0, *src1);
+    std::tie(win, _split_dimension) = calculate_squashed_or_collapsed_window(*src0, *src1, *dst);
 
     ICpuKernel::configure(win);
 }
@@ -219,6 +190,35 @@ const char *CpuSubKernel::name() const
 
 const std::vector<CpuSubKernel::SubKernel> &CpuSubKernel::get_available_kernels()
 {
+    static const std::vector<SubKernel> available_kernels = {
+        {"neon_fp32_sub", [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::F32); },
+         REGISTER_FP32_NEON(arm_compute::cpu::sub_same_neon<float>)},
+        {"neon_fp16_sub",
+         [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::F16) && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::sub_same_neon_fp16)},
+        {"neon_u8_sub", [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::U8); },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::sub_same_neon<uint8_t>)},
+        {"neon_s16_sub", [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::S16); },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::sub_same_neon<int16_t>)},
+        {"neon_s32_sub", [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::S32); },
+         REGISTER_INTEGER_NEON(arm_compute::cpu::sub_same_neon<int32_t>)},
+        {"neon_qu8_sub_fixedpoint",
+         [](const CpuSubKernelDataTypeISASelectorData &data)
+         { return ((data.dt == DataType::QASYMM8) && data.can_use_fixedpoint); },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::sub_qasymm8_neon_fixedpoint)},
+        {"neon_qs8_sub_fixedpoint",
+         [](const CpuSubKernelDataTypeISASelectorData &data)
+         { return ((data.dt == DataType::QASYMM8_SIGNED) && data.can_use_fixedpoint); },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::sub_qasymm8_signed_neon_fixedpoint)},
+        {"neon_qu8_sub", [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8); },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::sub_qasymm8_neon)},
+        {"neon_qs8_sub",
+         [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::QASYMM8_SIGNED); },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::sub_qasymm8_signed_neon)},
+        {"neon_qs16_sub",
+         [](const CpuSubKernelDataTypeISASelectorData &data) { return (data.dt == DataType::QSYMM16); },
+         REGISTER_QSYMM16_NEON(arm_compute::cpu::sub_qsymm16_neon)},
+    };
     return available_kernels;
 }
 
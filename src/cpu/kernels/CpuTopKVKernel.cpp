@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuTopKVKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/topkv/list.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+TensorShape compute_topkv_shape(const ITensorInfo &src, unsigned int k)
+{
+    return TensorShape(src.tensor_shape()).set(0, k);
+}
+
+Status
+validate_arguments(const ITensorInfo *src, const ITensorInfo *values, const ITensorInfo *indices, unsigned int k)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, values, indices);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                         DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(k == 0 || k > src->dimension(0),
+                                    "k must be between 1 and the number of elements of a row");
+
+    const TensorShape dst_shape = compute_topkv_shape(*src, k);
+    if (values->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, values);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_QUANTIZATION_INFO(src, values);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(values->tensor_shape(), dst_shape);
+    }
+    if (indices->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(indices, 1, DataType::U32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(indices->tensor_shape(), dst_shape);
+    }
+
+    const auto *uk =
+        CpuTopKVKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuTopKVKernel::TopKVKernel> &CpuTopKVKernel::get_available_kernels()
+{
+    static const std::vector<TopKVKernel> available_kernels = {
+        {"neon_fp32_topkv", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_topkv)},
+        {"neon_fp16_topkv",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_topkv)},
+        {"neon_qu8_topkv", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+         REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_topkv)},
+        {"neon_qs8_topkv", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+         REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_topkv)},
+    };
+    return available_kernels;
+}
+
+void CpuTopKVKernel::configure(const ITensorInfo *src, ITensorInfo *values, ITensorInfo *indices, unsigned int k)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, values, indices);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, values, indices, k));
+
+    // Output auto initialization if not yet initialized
+    const TensorShape dst_shape = compute_topkv_shape(*src, k);
+    auto_init_if_empty(*values, src->clone()->set_tensor_shape(dst_shape));
+    auto_init_if_empty(*indices, dst_shape, 1, DataType::U32);
+
+    const auto *uk =
+        CpuTopKVKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _k          = k;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuTopKVKernel").append("/").append(uk->name);
+
+    // Each row is selected at once, the rows are distributed across the threads
+    Window win = calculate_max_window(*values, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    ICpuKernel<CpuTopKVKernel>::configure(win);
+}
+
+Status CpuTopKVKernel::validate(const ITensorInfo *src,
+                                const ITensorInfo *values,
+                                const ITensorInfo *indices,
+                                unsigned int       k)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, values, indices, k));
+
+    return Status{};
+}
+
+void CpuTopKVKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuTopKVKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto src     = tensors.get_const_tensor(TensorType::ACL_SRC);
+    auto       values  = tensors.get_tensor(TensorType::ACL_DST_0);
+    auto       indices = tensors.get_tensor(TensorType::ACL_DST_1);
+
+    _run_method(src, values, indices, _k, window);
+}
+
+const char *CpuTopKVKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUTOPKVKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUTOPKVKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the kernel selecting the k largest elements of each row
+ *
+ * For each row along the first dimension of the source, writes the k largest values in decreasing order along with
+ * their positions in the row. Equal values are ordered by increasing position.
+ */
+class CpuTopKVKernel : public ICpuKernel<CpuTopKVKernel>
+{
+private:
+    using TopKVKernelPtr =
+        std::add_pointer<void(const ITensor *, ITensor *, ITensor *, unsigned int, const Window &)>::type;
+
+public:
+    CpuTopKVKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuTopKVKernel);
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  src     Source tensor info with shape [N, rows...]. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[out] values  Destination tensor info of the selected values with shape [k, rows...].
+     *                     Data type supported: same as @p src, with the same quantization info.
+     * @param[out] indices Destination tensor info of the positions of the selected values in their row, with the same
+     *                     shape as @p values. Data type supported: U32.
+     * @param[in]  k       Number of elements to select in each row, between 1 and N.
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *values, ITensorInfo *indices, unsigned int k);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuTopKVKernel::configure()
+     *
+     * @return a status
+     */
+    static Status
+    validate(const ITensorInfo *src, const ITensorInfo *values, const ITensorInfo *indices, unsigned int k);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct TopKVKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        TopKVKernelPtr               ukernel;
+    };
+
+    static const std::vector<TopKVKernel> &get_available_kernels();
+
+private:
+    unsigned int   _k{0};
+    TopKVKernelPtr _run_method{nullptr};
+    std::string    _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUTOPKVKERNEL_H
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuUnpackInt4Kernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::U8);
+
+    // Validate output if initialized
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::QASYMM8_SIGNED,
+                                                             DataType::QSYMM8_PER_CHANNEL);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(),
+                                                           CpuUnpackInt4Kernel::unpacked_info(*src).tensor_shape());
+    }
+
+    return Status{};
+}
+
+/** Sign extend the low and the high nibbles of each byte */
+inline int8x16x2_t unpack_int4(const uint8x16_t packed)
+{
+    const int8x16_t bytes = vreinterpretq_s8_u8(packed);
+    const int8x16_t low   = vshrq_n_s8(vshlq_n_s8(bytes, 4), 4);
+    const int8x16_t high  = vshrq_n_s8(bytes, 4);
+    return vzipq_s8(low, high);
+}
+} // namespace
+
+TensorInfo CpuUnpackInt4Kernel::unpacked_info(const ITensorInfo &src)
+{
+    const bool     is_per_channel = src.quantization_info().scale().size() > 1;
+    const DataType dt             = is_per_channel ? DataType::QSYMM8_PER_CHANNEL : DataType::QASYMM8_SIGNED;
+
+    TensorShape shape = src.tensor_shape();
+    shape.set(0, 2 * src.dimension(0));
+
+    return TensorInfo(
+        src.clone()->set_is_resizable(true).reset_padding().set_data_type(dt).set_tensor_shape(shape));
+}
+
+void CpuUnpackInt4Kernel::configure(const ITensorInfo *src, ITensorInfo *dst)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst));
+
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*dst, unpacked_info(*src));
+
+    ICpuKernel::configure(calculate_max_window(*src));
+}
+
+Status CpuUnpackInt4Kernel::validate(const ITensorInfo *src, const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst));
+    return Status{};
+}
+
+void CpuUnpackInt4Kernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    const auto src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    auto       dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // Both tensors share the same outer dimensions, the iterators only walk the rows
+    Iterator input(src, win_collapsed);
+    Iterator output(dst, win_collapsed);
+
+    const int  window_step_x  = 16;
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    execute_window_loop(
+        win_collapsed,
+        [&](const Coordinates &)
+        {
+            const auto input_ptr  = reinterpret_cast<const uint8_t *>(input.ptr());
+            const auto output_ptr = reinterpret_cast<int8_t *>(output.ptr());
+
+            // Unpack 32 values per iteration
+            int x = window_start_x;
+            for (; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                const int8x16x2_t values = unpack_int4(vld1q_u8(input_ptr + x));
+                vst1q_s8(output_ptr + 2 * x, values.val[0]);
+                vst1q_s8(output_ptr + 2 * x + 16, values.val[1]);
+            }
+
+            // Compute left-over elements
+            for (; x < window_end_x; ++x)
+            {
+                const int8_t low      = static_cast<int8_t>(static_cast<uint8_t>(input_ptr[x] << 4));
+                output_ptr[2 * x]     = static_cast<int8_t>(low >> 4);
+                output_ptr[2 * x + 1] = static_cast<int8_t>(static_cast<int8_t>(input_ptr[x]) >> 4);
+            }
+        },
+        input, output);
+}
+
+const char *CpuUnpackInt4Kernel::name() const
+{
+    return "CpuUnpackInt4Kernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUUNPACKINT4KERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUUNPACKINT4KERNEL_H
+
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to unpack 4-bit weights stored two per byte into 8-bit weights.
+ *
+ * The packed tensor is U8 and holds along its first dimension two 4-bit two's complement values per byte, the even
+ * index in the low nibble. Its quantization info describes the unpacked values.
+ */
+class CpuUnpackInt4Kernel : public ICpuKernel<CpuUnpackInt4Kernel>
+{
+public:
+    /** Default constructor */
+    CpuUnpackInt4Kernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuUnpackInt4Kernel);
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  src Packed source tensor info. Data type supported: U8
+     * @param[out] dst Destination tensor info, its first dimension is twice the one of @p src.
+     *                 Data types supported: QASYMM8_SIGNED/QSYMM8_PER_CHANNEL
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuUnpackInt4Kernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst);
+    /** Return the info of the tensor unpacked from a packed 4-bit tensor
+     *
+     * The unpacked data type is QSYMM8_PER_CHANNEL if @p src holds one scale per channel, QASYMM8_SIGNED otherwise.
+     *
+     * @param[in] src Packed source tensor info. Data type supported: U8
+     *
+     * @return the unpacked tensor info
+     */
+    static TensorInfo unpacked_info(const ITensorInfo &src);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUUNPACKINT4KERNEL_H
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuWeightOnlyQuantizedGemmKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/woq_gemm/list.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+/** Number of weights the ukernels dequantize at once */
+constexpr unsigned int block_depth = 16;
+/** Number of outputs the ukernels compute at once */
+constexpr unsigned int block_outputs = 4;
+
+Status validate_arguments(const ITensorInfo *src,
+                          const ITensorInfo *weights,
+                          const ITensorInfo *scales,
+                          const ITensorInfo *bias,
+                          const ITensorInfo *dst,
+                          unsigned int       group_size)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, scales, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32, DataType::F16);
+#ifdef __aarch64__
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::S8, DataType::U8, DataType::FP8_E4M3,
+                                                         DataType::FP8_E5M2);
+#else  // __aarch64__
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::S8, DataType::U8);
+#endif // __aarch64__
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(scales, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->num_dimensions() > 2, "Weights must be a 2D tensor");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(scales->num_dimensions() > 2, "Scales must be a 2D tensor");
+
+    const unsigned int depth = src->dimension(0);
+    const unsigned int n     = weights->dimension(1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(group_size == 0 || group_size % block_depth != 0,
+                                    "The group size must be a multiple of 16");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(depth % group_size != 0, "The group size must divide the depth of the activations");
+
+    const bool         is_int4       = weights->data_type() == DataType::U8;
+    const unsigned int weights_depth = is_int4 ? depth / 2 : depth;
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(0) != weights_depth,
+                                    "Each weight row must hold the depth of the activations");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(scales->dimension(0) != n || scales->dimension(1) != depth / group_size,
+                                    "There must be one scale per group of each output");
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(bias->num_dimensions() > 1 || bias->dimension(0) != n,
+                                        "Bias must be a vector with one value per output");
+    }
+
+    const TensorShape dst_shape = TensorShape(src->tensor_shape()).set(0, n);
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), dst_shape);
+    }
+
+    const auto *uk = CpuWeightOnlyQuantizedGemmKernel::get_implementation(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+const std::vector<CpuWeightOnlyQuantizedGemmKernel::WoqGemmKernel> &
+CpuWeightOnlyQuantizedGemmKernel::get_available_kernels()
+{
+    static const std::vector<WoqGemmKernel> available_kernels = {
+        {"neon_fp32_weight_only_quantized_gemm",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+         REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_weight_only_quantized_gemm)},
+        {"neon_fp16_weight_only_quantized_gemm",
+         [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+         REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_weight_only_quantized_gemm)},
+    };
+    return available_kernels;
+}
+
+void CpuWeightOnlyQuantizedGemmKernel::configure(const ITensorInfo *src,
+                                                 const ITensorInfo *weights,
+                                                 const ITensorInfo *scales,
+                                                 const ITensorInfo *bias,
+                                                 ITensorInfo       *dst,
+                                                 unsigned int       group_size)
+{
+    ARM_COMPUTE_UNUSED(scales, bias);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, scales, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, weights, scales, bias, dst, group_size));
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(TensorShape(src->tensor_shape()).set(0, weights->dimension(1))));
+
+    const auto *uk = CpuWeightOnlyQuantizedGemmKernel::get_implementation(
+        DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    _group_size = group_size;
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuWeightOnlyQuantizedGemmKernel").append("/").append(uk->name);
+
+    // Outputs are computed in blocks sharing the loads of the activations, the ukernel handles the last partial block
+    Window win = calculate_max_window(*dst, Steps(block_outputs));
+
+    ICpuKernel<CpuWeightOnlyQuantizedGemmKernel>::configure(win);
+}
+
+Status CpuWeightOnlyQuantizedGemmKernel::validate(const ITensorInfo *src,
+                                                  const ITensorInfo *weights,
+                                                  const ITensorInfo *scales,
+                                                  const ITensorInfo *bias,
+                                                  const ITensorInfo *dst,
+                                                  unsigned int       group_size)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, weights, scales, bias, dst, group_size));
+
+    return Status{};
+}
+
+void CpuWeightOnlyQuantizedGemmKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel<CpuWeightOnlyQuantizedGemmKernel>::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto src     = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const auto weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const auto scales  = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const auto bias    = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    auto       dst     = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, weights, scales, bias, dst, _group_size, window);
+}
+
+const char *CpuWeightOnlyQuantizedGemmKernel::name() const
+{
+    return _name.c_str();
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUWEIGHTONLYQUANTIZEDGEMMKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUWEIGHTONLYQUANTIZEDGEMMKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Interface for the weight-only quantized GEMM kernel
+ *
+ * Computes @f[ dst = src \cdot dequantize(weights)^T + bias @f] where the weights are int8, int4 or FP8 with one
+ * fp32 scale per group of consecutive weights of an output. The weights are dequantized in registers, so they are only read
+ * in their quantized form. This suits memory-bound products with few rows, e.g. the fully connected layers of a
+ * decoder running with batch 1.
+ */
+class CpuWeightOnlyQuantizedGemmKernel : public ICpuKernel<CpuWeightOnlyQuantizedGemmKernel>
+{
+private:
+    using WoqGemmKernelPtr = std::add_pointer<void(
+        const ITensor *, const ITensor *, const ITensor *, const ITensor *, ITensor *, unsigned int, const Window &)>::type;
+
+public:
+    CpuWeightOnlyQuantizedGemmKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuWeightOnlyQuantizedGemmKernel);
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  src        Activations tensor info with shape [K, M, batches]. Data types supported: F32/F16.
+     * @param[in]  weights    Weights tensor info, one row of K weights per output. Data types supported:
+     *                        - S8 with shape [K, N] for int8 weights
+     *                        - U8 with shape [K / 2, N] for int4 weights, packed two per byte with the even index in
+     *                          the low nibble, as 4-bit two's complement values
+     *                        - FP8_E4M3/FP8_E5M2 with shape [K, N] for FP8 weights, only on aarch64. The weights
+     *                          must be finite
+     * @param[in]  scales     Scales tensor info with shape [N, K / @p group_size]. Data type supported: F32.
+     * @param[in]  bias       (Optional) Bias tensor info with shape [N]. Can be nullptr. Data type supported: same as @p src.
+     * @param[out] dst        Destination tensor info with shape [N, M, batches]. Data type supported: same as @p src.
+     * @param[in]  group_size Number of consecutive weights sharing a scale. Must be a multiple of 16 that divides K.
+     */
+    void configure(const ITensorInfo *src,
+                   const ITensorInfo *weights,
+                   const ITensorInfo *scales,
+                   const ITensorInfo *bias,
+                   ITensorInfo       *dst,
+                   unsigned int       group_size);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuWeightOnlyQuantizedGemmKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *weights,
+                           const ITensorInfo *scales,
+                           const ITensorInfo *bias,
+                           const ITensorInfo *dst,
+                           unsigned int       group_size);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct WoqGemmKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        WoqGemmKernelPtr             ukernel;
+    };
+
+    static const std::vector<WoqGemmKernel> &get_available_kernels();
+
+private:
+    unsigned int     _group_size{0};
+    WoqGemmKernelPtr _run_method{nullptr};
+    std::string      _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUWEIGHTONLYQUANTIZEDGEMMKERNEL_H
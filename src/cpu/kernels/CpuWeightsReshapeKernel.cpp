@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021,2024 Arm Limited.
+ * Copyright (c) 2017-2021,2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,8 @@
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/WindowHelpers.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace cpu
@@ -37,6 +39,53 @@ namespace kernels
 {
 namespace
 {
+// Number of kernels linearized together, so that each row of the output is written in blocks instead of one element
+// at a time
+constexpr unsigned int num_kernels_per_block = 8;
+
+template <typename T>
+void reshape_kernels_block(const uint8_t *in_ptr,
+                           uint8_t       *out_ptr,
+                           const uint8_t *bias_ptr,
+                           unsigned int   num_kernels,
+                           unsigned int   kernel_size_x,
+                           unsigned int   kernel_size_y,
+                           unsigned int   kernel_depth,
+                           const Strides &input_strides,
+                           size_t         bias_stride_x,
+                           size_t         output_stride_y)
+{
+    const size_t input_stride_w = input_strides[3];
+
+    for (unsigned int d = 0; d < kernel_depth; ++d)
+    {
+        for (unsigned int j = 0; j < kernel_size_y; ++j)
+        {
+            const uint8_t *in_row_ptr = in_ptr + d * input_strides.z() + j * input_strides.y();
+            for (unsigned int i = 0; i < kernel_size_x; ++i, out_ptr += output_stride_y)
+            {
+                // Transpose the element of each kernel of the block into a contiguous run of the output row
+                const uint8_t *in_elem_ptr = in_row_ptr + i * input_strides.x();
+                T             *out_row_ptr = reinterpret_cast<T *>(out_ptr);
+                for (unsigned int k = 0; k < num_kernels; ++k)
+                {
+                    out_row_ptr[k] = *reinterpret_cast<const T *>(in_elem_ptr + k * input_stride_w);
+                }
+            }
+        }
+    }
+
+    // Add bias
+    if (bias_ptr != nullptr)
+    {
+        T *out_row_ptr = reinterpret_cast<T *>(out_ptr);
+        for (unsigned int k = 0; k < num_kernels; ++k)
+        {
+            out_row_ptr[k] = *reinterpret_cast<const T *>(bias_ptr + k * bias_stride_x);
+        }
+    }
+}
+
 TensorShape get_output_shape(const ITensorInfo *src, bool has_bias)
 {
     TensorShape output_shape{src->tensor_shape()};
@@ -97,6 +146,8 @@ void CpuWeightsReshapeKernel::configure(const ITensorInfo *src, const ITensorInf
     window.set(Window::DimX, Window::Dimension(0, src->dimension(0), src->dimension(0)));
     window.set(Window::DimY, Window::Dimension(0, src->dimension(1), src->dimension(1)));
     window.set(Window::DimZ, Window::Dimension(0, src->dimension(2), src->dimension(2)));
+    window.set(3, Window::Dimension(0, ceil_to_multiple(src->dimension(3), num_kernels_per_block),
+                                    num_kernels_per_block));
     ICpuKernel::configure(window);
 }
 
@@ -119,10 +170,32 @@ void CpuWeightsReshapeKernel::run_op(ITensorPack &tensors, const Window &window,
     const unsigned int kernel_size_x   = src->info()->dimension(0);
     const unsigned int kernel_size_y   = src->info()->dimension(1);
     const unsigned int kernel_depth    = src->info()->dimension(2);
-    const unsigned int input_stride_x  = src->info()->strides_in_bytes().x();
-    const unsigned int input_stride_y  = src->info()->strides_in_bytes().y();
-    const unsigned int input_stride_z  = src->info()->strides_in_bytes().z();
-    const unsigned int output_stride_y = dst->info()->strides_in_bytes().y();
+    const unsigned int num_kernels     = src->info()->dimension(3);
+    const Strides     &input_strides   = src->info()->strides_in_bytes();
+    const size_t       output_stride_y = dst->info()->strides_in_bytes().y();
+    const size_t       bias_stride_x   = biases != nullptr ? biases->info()->strides_in_bytes().x() : 0;
+
+    using ReshapeBlockPtr = void (*)(const uint8_t *, uint8_t *, const uint8_t *, unsigned int, unsigned int,
+                                     unsigned int, unsigned int, const Strides &, size_t, size_t);
+    ReshapeBlockPtr reshape_block = nullptr;
+    switch (src->info()->element_size())
+    {
+        case 1:
+            reshape_block = &reshape_kernels_block<uint8_t>;
+            break;
+        case 2:
+            reshape_block = &reshape_kernels_block<uint16_t>;
+            break;
+        case 4:
+            reshape_block = &reshape_kernels_block<uint32_t>;
+            break;
+        case 8:
+            reshape_block = &reshape_kernels_block<uint64_t>;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Element size not supported");
+            break;
+    }
 
     // Create iterators
     Iterator in(src, window);
@@ -134,37 +207,14 @@ void CpuWeightsReshapeKernel::run_op(ITensorPack &tensors, const Window &window,
             const int kernel_idx = id[3];
             const int kernel_idz = id[4];
 
-            // Setup pointers
-            const uint8_t *tmp_input_ptr        = in.ptr();
-            uint8_t       *tmp_output_ptr       = dst->ptr_to_element(Coordinates(kernel_idx, 0, kernel_idz));
-            const uint8_t *curr_input_row_ptr   = tmp_input_ptr;
-            const uint8_t *curr_input_depth_ptr = tmp_input_ptr;
+            const unsigned int num_block_kernels = std::min(num_kernels_per_block, num_kernels - kernel_idx);
+            const uint8_t     *bias_ptr =
+                biases != nullptr ? biases->ptr_to_element(Coordinates(kernel_idx, kernel_idz)) : nullptr;
 
             // Linearize volume
-            for (unsigned int d = 0; d < kernel_depth; ++d)
-            {
-                for (unsigned int j = 0; j < kernel_size_y; ++j)
-                {
-                    for (unsigned int i = 0; i < kernel_size_x; ++i)
-                    {
-                        std::memcpy(tmp_output_ptr, tmp_input_ptr, src->info()->element_size());
-                        tmp_input_ptr += input_stride_x;
-                        tmp_output_ptr += output_stride_y;
-                    }
-                    curr_input_row_ptr += input_stride_y;
-                    tmp_input_ptr = curr_input_row_ptr;
-                }
-                curr_input_depth_ptr += input_stride_z;
-                curr_input_row_ptr = curr_input_depth_ptr;
-                tmp_input_ptr      = curr_input_depth_ptr;
-            }
-
-            // Add bias
-            if (biases != nullptr)
-            {
-                std::memcpy(tmp_output_ptr, biases->ptr_to_element(Coordinates(kernel_idx, kernel_idz)),
-                            src->info()->element_size());
-            }
+            reshape_block(in.ptr(), dst->ptr_to_element(Coordinates(kernel_idx, 0, kernel_idz)), bias_ptr,
+                          num_block_kernels, kernel_size_x, kernel_size_y, kernel_depth, input_strides, bias_stride_x,
+                          output_stride_y);
         },
         in);
 }
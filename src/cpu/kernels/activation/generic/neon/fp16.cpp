@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
 
 #include "src/cpu/kernels/activation/generic/neon/impl.h"
+#include "src/cpu/kernels/lut/list.h"
 
 namespace arm_compute
 {
@@ -38,6 +39,34 @@ void neon_fp16_activation(const ITensor *src, ITensor *dst, const ActivationLaye
 {
     fp_neon_activation_impl<float16_t, Fp16Params>(src, dst, act_info, window);
 }
+
+#ifdef __aarch64__
+void neon_fp16_activation_lut(const ITensor             *src,
+                              ITensor                   *dst,
+                              const ActivationLayerInfo &act_info,
+                              const Window              &window)
+{
+    ARM_COMPUTE_ERROR_ON(src->info()->data_type() != DataType::F16);
+    const auto window_start_x = window.x().start();
+    const auto window_end_x   = window.x().end();
+    const auto size           = window_end_x - window_start_x;
+    Window     win_collapsed  = window.collapse_if_possible(window, Window::DimZ);
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(src, win_collapsed);
+    Iterator output(dst, win_collapsed);
+    execute_window_loop_dims<3>(
+        win_collapsed,
+        [&](const Coordinates &)
+        {
+            const auto input_ptr  = reinterpret_cast<const uint16_t *>(input.ptr());
+            auto       output_ptr = reinterpret_cast<uint16_t *>(output.ptr());
+            lut_u16_neon(reinterpret_cast<const uint16_t *>(act_info.lut_fp16().data()), 1U /* num_strings (UNUSED) */,
+                         size, input_ptr + window_start_x, output_ptr + window_start_x);
+        },
+        input, output);
+}
+#endif // __aarch64__
 } // namespace cpu
 } // namespace arm_compute
 #endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifdef ARM_COMPUTE_ENABLE_SME2
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+
+// This function expects a collapsed 2D shape.
+void sme2_f32_relu_kernel(const float    *src,
+                          float          *dst,
+                          const uintptr_t shape[2],
+                          const uintptr_t src_strides[2],
+                          const uintptr_t dst_strides[2],
+                          uint32_t        lower_bound,
+                          uint32_t        upper_bound)
+{
+    // Precondition:
+    assert(src_strides[0] == sizeof(float));
+    assert(dst_strides[0] == sizeof(float));
+    __asm__ volatile(
+        R"(
+            .inst 0xd503477f  // smstart
+
+            ptrue p0.b
+            .inst 0x25207811  // ptrue pn9.b
+
+            // Registers
+            //
+            //   *  x9: temporary, index
+            //   * x13: temporary, body_length
+            //
+            //   * x26: index_1
+            //   * x27: src_1
+            //   * x28: dst_1
+            //
+            //   *  z0: lower_bound
+            //   *  z1: upper_bound
+            //   * z12-z15: x
+            //   * z16-z19: clamp(x, lower_bound, upper_bound)
+            //
+            //   * p0: all-true
+            //   * p1: leftover predicate
+            //   * pn9: all-true
+
+            dup z0.s, %w[lower_bound]
+            dup z1.s, %w[upper_bound]
+
+            // ---------------------------------------------------------------- x13: body_length = (length / vl) * vl
+            cntw x13, ALL, MUL #4 // x13 is vl
+            udiv x9, %x[length], x13 // length/vl
+            mul x13, x13, x9 // x13 = vl * result
+
+            // ==================================================
+            // Outer loop opening
+            // ==================================================
+
+            mov x27, %x[src]  // starting point of pointers for src.
+            mov x28, %x[dst]  // starting point of pointers for dst.
+            mov x26, %x[shape_1]
+
+1: // outer_loop_start
+            // for index_1 in shape_1 downto 1
+            cmp x26, #0
+            b.eq 6f // outer_loop_end
+            sub x26, x26, #1
+
+            mov x9, #0                                                         // x9: index
+
+2: // inner_body_start
+            cmp x9, x13
+            b.eq 3f // inner_body_end
+
+            // Loads the input data to 4 consecutive registers ---------------- z12-z15: input_data
+            .inst 0xa009c76c  // ld1w {z12.s-z15.s}, pn9/z, [x27, x9, LSL #2]
+
+            // ---------------------------------------------------------------- z16-z19: max(x, lower_bound)
+            movprfx z16, z12
+            fmax z16.s, p0/m, z16.s, z0.s
+            movprfx z17, z13
+            fmax z17.s, p0/m, z17.s, z0.s
+            movprfx z18, z14
+            fmax z18.s, p0/m, z18.s, z0.s
+            movprfx z19, z15
+            fmax z19.s, p0/m, z19.s, z0.s
+
+            // ---------------------------------------------------------------- z16-z19: min(z16-z19, upper_bound)
+            fmin z16.s, p0/m, z16.s, z1.s
+            fmin z17.s, p0/m, z17.s, z1.s
+            fmin z18.s, p0/m, z18.s, z1.s
+            fmin z19.s, p0/m, z19.s, z1.s
+
+            // Stores 4 consecutive registers to the output
+            .inst 0xa029c790  // st1w {z16.s-z19.s}, pn9, [x28, x9, LSL #2]
+
+            incw x9, ALL, MUL #4
+            b 2b // inner_body_start
+3: // inner_body_end
+
+4: // inner_leftover_start
+            whilelo p1.s, x9, %x[length]                                       // While x9<length
+            b.none 5f // inner_leftover_end
+
+            ld1w z12.s, p1/z, [x27, x9, LSL #2]                                // z12: input_data
+            fmax z12.s, p1/m, z12.s, z0.s                                      // z12: max(x, lower_bound)
+            fmin z12.s, p1/m, z12.s, z1.s                                      // z12: min(z12, upper_bound)
+            st1w z12.s, p1, [x28, x9, LSL #2]
+
+            incw x9                                                            // Advance index of leftover loop
+            b 4b // inner_leftover_start
+5: // inner_leftover_end
+
+            // ==================================================
+            // Outer loop closing
+            // ==================================================
+
+            add x27, x27, %x[src_stride_1]
+            add x28, x28, %x[dst_stride_1]
+            b 1b // outer_loop_start
+6: // outer_loop_end
+
+            .inst 0xd503467f  // smstop
+        )"
+        :
+        : [src] "r"(src), [dst] "r"(dst), [shape_1] "r"(shape[1]), [src_stride_1] "r"(src_strides[1]),
+          [dst_stride_1] "r"(dst_strides[1]), [length] "r"(shape[0]), [lower_bound] "r"(lower_bound),
+          [upper_bound] "r"(upper_bound)
+        : "cc", "memory",                                                      //
+          "p0", "p1", "p9",                                                    //
+          "x9", "x13", "x26", "x27", "x28",                                    //
+          "z0", "z1", "z12", "z13", "z14", "z15", "z16", "z17", "z18", "z19"   //
+    );
+}
+
+void sme2_fp32_relu(const ITensor *in, ITensor *out, const ActivationLayerInfo &act_info, const Window &window)
+{
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    // RELU, BOUNDED_RELU and LU_BOUNDED_RELU are all a clamp of the input between two bounds.
+    float lower = 0.f;
+    float upper = std::numeric_limits<float>::infinity();
+    switch (act_info.activation())
+    {
+        case ActivationFunction::RELU:
+            break;
+        case ActivationFunction::BOUNDED_RELU:
+            upper = act_info.a();
+            break;
+        case ActivationFunction::LU_BOUNDED_RELU:
+            lower = act_info.b();
+            upper = act_info.a();
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+    }
+
+    uint32_t lower_bound = 0;
+    uint32_t upper_bound = 0;
+    std::memcpy(&lower_bound, &lower, sizeof(float));
+    std::memcpy(&upper_bound, &upper, sizeof(float));
+
+    const auto *src_info = in->info();
+    const auto *dst_info = out->info();
+
+    const auto &src_strides = src_info->strides_in_bytes();
+    const auto &dst_strides = dst_info->strides_in_bytes();
+
+    // Iterator calculates pointer offsets and takes into account padding.
+    Iterator input(in, window);
+    Iterator output(out, window);
+
+    // NOTE: This kernel uses collapsed 2D shapes.
+    // The excecution window is expected to be pre-collapsed in kernel configure(...) function.
+    const uintptr_t k_shape[] = {window.num_iterations(0), window.num_iterations(1)};
+
+    const uintptr_t k_src_strides[] = {src_strides[0], src_strides[1]};
+    const uintptr_t k_dst_strides[] = {dst_strides[0], dst_strides[1]};
+
+    const auto *k_src = reinterpret_cast<const float *>(input.ptr());
+    auto       *k_dst = reinterpret_cast<float *>(output.ptr());
+
+    sme2_f32_relu_kernel(k_src, k_dst, k_shape, k_src_strides, k_dst_strides, lower_bound, upper_bound);
+}
+
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // ARM_COMPUTE_ENABLE_SME2
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,7 +50,17 @@ namespace
 bool is_fp16_lut_supported(ActivationLayerInfo::ActivationFunction func)
 {
     return func == ActivationLayerInfo::ActivationFunction::LOGISTIC ||
-           func == ActivationLayerInfo::ActivationFunction::TANH;
+           func == ActivationLayerInfo::ActivationFunction::TANH ||
+           func == ActivationLayerInfo::ActivationFunction::GELU ||
+           func == ActivationLayerInfo::ActivationFunction::SWISH ||
+           func == ActivationLayerInfo::ActivationFunction::ELU;
+}
+
+bool is_fp32_sme2_clamp_supported(ActivationLayerInfo::ActivationFunction func)
+{
+    return func == ActivationLayerInfo::ActivationFunction::RELU ||
+           func == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU ||
+           func == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU;
 }
 
 using KernelList = std::vector<CpuActivationKernelHeuristics::ActivationKernel>;
@@ -61,6 +71,10 @@ static const KernelList fp32_kernels = {
      [](const ActivationDataTypeISASelectorData &data)
      { return data.f == ActivationLayerInfo::ActivationFunction::LOGISTIC && data.isa.sme2; },
      REGISTER_FP32_SME2(arm_compute::cpu::sme2_fp32_logistic)},
+    {"sme2_fp32_relu",
+     [](const ActivationDataTypeISASelectorData &data)
+     { return is_fp32_sme2_clamp_supported(data.f) && data.isa.sme2; },
+     REGISTER_FP32_SME2(arm_compute::cpu::sme2_fp32_relu)},
     {"sve_fp32_activation",
      [](const ActivationDataTypeISASelectorData &data)
      { return data.isa.sve && data.f != ActivationLayerInfo::ActivationFunction::GELU; },
@@ -83,6 +97,12 @@ static const KernelList fp16_kernels = {
      [](const ActivationDataTypeISASelectorData &data)
      { return data.isa.sve && data.isa.fp16 && data.f != ActivationLayerInfo::ActivationFunction::GELU; },
      REGISTER_FP16_SVE(arm_compute::cpu::sve_fp16_activation)},
+#ifdef __aarch64__
+    {// Scalar lookups over all the 65536 fp16 inputs are cheaper than evaluating the transcendental functions
+     "neon_fp16_activation_lut",
+     [](const ActivationDataTypeISASelectorData &data) { return data.isa.fp16 && is_fp16_lut_supported(data.f); },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_activation_lut)},
+#endif // __aarch64__
     {"neon_fp16_activation", [](const ActivationDataTypeISASelectorData &data) { return data.isa.fp16; },
      REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_activation)},
 };
@@ -332,7 +352,8 @@ CpuActivationKernelHeuristics::CpuActivationKernelHeuristics(const ITensorInfo
     std::tie(_window, split_dim) = calculate_squashed_or_max_window(*src);
 
     // Collapse window with SME kernels in Y-Dim
-    if (std::string(_kernel->name) == "sme2_fp32_logistic")
+    const std::string kernel_name = _kernel->name;
+    if (kernel_name == "sme2_fp32_logistic" || kernel_name == "sme2_fp32_relu")
     {
         _window = _window.collapse(_window, Window::DimY);
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024 Arm Limited.
+ * Copyright (c) 2020-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@ namespace cpu
 
 #ifdef __aarch64__
 DECLARE_ACTIVATION_KERNEL(neon_q8_activation_lut);
+DECLARE_ACTIVATION_KERNEL(neon_fp16_activation_lut);
 #endif // __aarch64__
 DECLARE_ACTIVATION_KERNEL(sve2_q8_activation_lut);
 DECLARE_ACTIVATION_KERNEL(neon_qasymm8_activation);
@@ -44,6 +45,7 @@ DECLARE_ACTIVATION_KERNEL(sve2_qsymm16_activation);
 DECLARE_ACTIVATION_KERNEL(sve_fp16_activation);
 DECLARE_ACTIVATION_KERNEL(sve_fp16_activation_lut);
 DECLARE_ACTIVATION_KERNEL(sve_fp32_activation);
+DECLARE_ACTIVATION_KERNEL(sme2_fp32_relu);
 DECLARE_ACTIVATION_KERNEL(neon_fp16_activation);
 DECLARE_ACTIVATION_KERNEL(neon_fp32_activation);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,10 +31,13 @@
 
 #include "src/core/NEON/INEKernel.h"
 #include "src/cpu/kernels/assembly/arm_gemm_compute_iface.hpp"
+#include "src/cpu/utils/CpuCycleCounter.h"
 
 #include "gemm_arrays.hpp"
 #include "gemm_common.hpp"
 
+#include <atomic>
+
 namespace arm_compute
 {
 class ITensor;
@@ -83,7 +86,7 @@ public:
 
         arm_gemm::ndcoord_t thread_locator{};
 
-        _kernel->execute(win, thread_locator, info.thread_id);
+        count_cycles([&]() { _kernel->execute(win, thread_locator, info.thread_id); });
     }
 
     // Inherited methods overridden:
@@ -96,7 +99,7 @@ public:
         auto ndc_win = arm_gemm::to_ndcoord(window);
         auto ndc_tlc = arm_gemm::to_ndcoord(thread_locator);
 
-        _kernel->execute(ndc_win, ndc_tlc, info.thread_id);
+        count_cycles([&]() { _kernel->execute(ndc_win, ndc_tlc, info.thread_id); });
     }
 
     void run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override
@@ -126,7 +129,7 @@ public:
 
         arm_gemm::ndcoord_t thread_locator{};
 
-        _kernel->execute_stateless(win, thread_locator, info.thread_id, ga);
+        count_cycles([&]() { _kernel->execute_stateless(win, thread_locator, info.thread_id, ga); });
     }
 
     /** Configure window of the kernel
@@ -157,6 +160,16 @@ public:
             _name += "/" + kernel_name_tag;
         }
     }
+    /** Set the counter the CPU cycles spent by each thread in the kernel are added to
+     *
+     * The cycles are only counted while @ref is_cycle_counting_enabled is true.
+     *
+     * @param[in] cycles Counter to add the cycles to, nullptr to not count the cycles. Must outlive the kernel.
+     */
+    void set_cycle_counter(std::atomic<uint64_t> *cycles)
+    {
+        _cycles = cycles;
+    }
     /** Return minimum workload size of the relevant kernel
      *
      * @param[in] platform     The CPU platform used to create the context.
@@ -173,8 +186,24 @@ public:
     }
 
 private:
+    template <typename F>
+    void count_cycles(F &&execute)
+    {
+        uint64_t start = 0;
+        if (_cycles == nullptr || !is_cycle_counting_enabled() || !read_thread_cycles(start))
+        {
+            execute();
+            return;
+        }
+        execute();
+        uint64_t end = start;
+        read_thread_cycles(end);
+        _cycles->fetch_add(end - start, std::memory_order_relaxed);
+    }
+
     arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput> *_kernel;
     std::string                                              _name;
+    std::atomic<uint64_t>                                   *_cycles{nullptr};
 };
 } // namespace kernel
 } // namespace cpu
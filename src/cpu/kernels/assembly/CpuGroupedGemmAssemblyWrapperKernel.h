@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_ASSEMBLY_CPUGROUPEDGEMMASSEMBLYWRAPPERKERNEL_H
+#define ACL_SRC_CPU_KERNELS_ASSEMBLY_CPUGROUPEDGEMMASSEMBLYWRAPPERKERNEL_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/INEKernel.h"
+
+#include "gemm_common.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernel
+{
+/** Wrapper running many independent assembly kernels as a single job.
+ *
+ * The windows of all the kernels are laid end to end in a 1D window of (problem, tile) pairs, so that the scheduler
+ * balances the tiles of every problem across the threads in one dispatch. A thread whose range spans several problems
+ * runs the relevant tiles of each of them in turn.
+ *
+ * @note Every kernel must have been created for, and given working space for, at least as many threads as the
+ *       scheduler runs, since any thread can execute tiles of any problem.
+ */
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+class CpuGroupedGemmAssemblyWrapperKernel final : public INEKernel
+{
+public:
+    /** Constructor
+     */
+    CpuGroupedGemmAssemblyWrapperKernel() : _kernels(), _offsets(), _name("CpuGroupedGemmAssemblyWrapperKernel")
+    {
+    }
+
+    CpuGroupedGemmAssemblyWrapperKernel(CpuGroupedGemmAssemblyWrapperKernel &)            = delete;
+    CpuGroupedGemmAssemblyWrapperKernel(CpuGroupedGemmAssemblyWrapperKernel &&)           = default;
+    CpuGroupedGemmAssemblyWrapperKernel &operator=(CpuGroupedGemmAssemblyWrapperKernel &) = delete;
+
+    const char *name() const override
+    {
+        return _name.c_str();
+    }
+
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+        const unsigned int start = window.x().start();
+        const unsigned int end   = window.x().end();
+
+        // Last problem whose first tile is not after the start of the range
+        size_t problem = std::upper_bound(_offsets.begin(), _offsets.end(), start) - _offsets.begin() - 1;
+        for (; problem < _kernels.size() && _offsets[problem] < end; ++problem)
+        {
+            const unsigned int first = std::max(start, _offsets[problem]) - _offsets[problem];
+            const unsigned int last  = std::min(end, _offsets[problem + 1]) - _offsets[problem];
+            run_problem(problem, first, last, info.thread_id);
+        }
+    }
+
+    /** Initialise the kernel
+     *
+     * @param[in] kernels         Assembly kernel of each problem, in the order their tiles are laid out.
+     * @param[in] kernel_name_tag Tag to be attached to the kernel's name.
+     */
+    void configure(const std::vector<arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput> *> &kernels,
+                   std::string                                                                 kernel_name_tag)
+    {
+        ARM_COMPUTE_ERROR_ON(kernels.empty());
+        _kernels = kernels;
+
+        _offsets.assign(1, 0U);
+        for (const auto *kernel : _kernels)
+        {
+            ARM_COMPUTE_ERROR_ON_NULLPTR((reinterpret_cast<const void *>(kernel)));
+            _offsets.push_back(_offsets.back() + kernel->get_window_size().total_size());
+        }
+
+        Window win;
+        win.set(Window::DimX, Window::Dimension(0, _offsets.back(), 1));
+        INEKernel::configure(win);
+
+        if (!kernel_name_tag.empty())
+        {
+            _name += "/" + kernel_name_tag;
+        }
+    }
+    /** Return minimum workload size of the relevant kernel
+     *
+     * @param[in] platform     The CPU platform used to create the context.
+     * @param[in] thread_count Number of threads in the execution.
+     *
+     * @return[out] small_network_mws         Minimum workload size for requested configuration.
+     */
+    size_t get_mws(const CPUInfo &platform, size_t thread_count) const override
+    {
+        ARM_COMPUTE_UNUSED(thread_count);
+        ARM_COMPUTE_UNUSED(platform);
+
+        return ICPPKernel::default_mws;
+    }
+
+private:
+    /** Run the tiles [first, last) of one problem
+     *
+     * arm_gemm windows can have more than one dimension, a linear range of tiles is run as one box per row of
+     * dimension 0.
+     */
+    void run_problem(size_t problem, unsigned int first, unsigned int last, int thread_id)
+    {
+        auto *const               kernel = _kernels[problem];
+        const arm_gemm::ndrange_t range  = kernel->get_window_size();
+        const arm_gemm::ndcoord_t thread_locator{};
+
+        for (auto it = range.iterator(first, last); !it.done(); it.next_dim1())
+        {
+            const arm_gemm::ndcoord_t work_range{{it.dim(0), it.dim0_max() - it.dim(0)},
+                                                 {it.dim(1), 1},
+                                                 {it.dim(2), 1},
+                                                 {it.dim(3), 1},
+                                                 {it.dim(4), 1},
+                                                 {it.dim(5), 1}};
+            kernel->execute(work_range, thread_locator, thread_id);
+        }
+    }
+
+    std::vector<arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput> *> _kernels;
+    std::vector<unsigned int>                                              _offsets;
+    std::string                                                            _name;
+};
+} // namespace kernel
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_ASSEMBLY_CPUGROUPEDGEMMASSEMBLYWRAPPERKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -282,7 +282,7 @@ using UniqueGemmCommon = std::unique_ptr<GemmCommon<Tlop, Trop, Tret>>;
 
 /* get_gemm_method(): Given the templated types and provided parameters,
  * which is the preferred method to implement this GEMM?  */
-template <typename Top, typename Tret, class OutputStage = Nothing>
+template <typename Tlop, typename Trop, typename Tret, class OutputStage = Nothing>
 KernelDescription get_gemm_method(const GemmArgs &args, const OutputStage & = {});
 
 template <typename Tlop, typename Trop, typename Tret, class OutputStage = Nothing>
@@ -294,6 +294,12 @@ std::vector<KernelDescription> get_compatible_kernels(const GemmArgs &args, cons
 template <typename Tlop, typename Trop, typename Tret, class OutputStage = Nothing>
 bool has_opt_gemm(WeightFormat &weight_format, const GemmArgs &args, const OutputStage & = {});
 
+/* get_gemm_split_k(): Given the templated types and provided parameters,
+ * into how many sections should K be split for the threads to have enough
+ * work?  1 if the problem should not be split.  */
+template <typename Tlop, typename Trop, typename Tret, class OutputStage = Nothing>
+unsigned int get_gemm_split_k(const GemmArgs &args, const OutputStage & = {});
+
 } // namespace arm_gemm
 
 #endif // ACL_SRC_CPU_KERNELS_ASSEMBLY_ARM_GEMM_HPP
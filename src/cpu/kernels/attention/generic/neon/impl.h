@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_ATTENTION_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_ATTENTION_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEMath.h"
+#include "support/Bfloat16.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace sdpa
+{
+/** Number of query rows sharing each block of keys and values */
+constexpr int block_rows = 4;
+/** Number of keys whose scores are computed at once */
+constexpr int block_keys = 64;
+
+// Whatever the storage type, scores and accumulators are kept in fp32
+inline float32x4_t load_f32x4(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+inline void store_f32x4(float *ptr, float32x4_t v)
+{
+    vst1q_f32(ptr, v);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline float32x4_t load_f32x4(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline void store_f32x4(float16_t *ptr, float32x4_t v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+inline float32x4_t load_f32x4(const bfloat16 *ptr)
+{
+    // bfloat16 is the upper half of a fp32
+    return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(reinterpret_cast<const uint16_t *>(ptr)), 16));
+}
+
+inline void store_f32x4(bfloat16 *ptr, float32x4_t v)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        ptr[i] = bfloat16(vgetq_lane_f32(v, 0));
+        v      = vextq_f32(v, v, 1);
+    }
+}
+
+inline float reduce_add(float32x4_t v)
+{
+#ifdef __aarch64__
+    return vaddvq_f32(v);
+#else  // __aarch64__
+    float32x2_t sum = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    sum             = vpadd_f32(sum, sum);
+    return vget_lane_f32(sum, 0);
+#endif // __aarch64__
+}
+
+inline float32x4_t multiply_add(float32x4_t acc, float32x4_t a, float32x4_t b)
+{
+#ifdef __aarch64__
+    return vfmaq_f32(acc, a, b);
+#else  // __aarch64__
+    return vmlaq_f32(acc, a, b);
+#endif // __aarch64__
+}
+
+/** Dot product of two rows of @p len elements, accumulated in fp32 */
+template <typename T>
+inline float dot(const T *a, const T *b, int len)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.f);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+    int         x    = 0;
+    for (; x <= len - 8; x += 8)
+    {
+        acc0 = multiply_add(acc0, load_f32x4(a + x), load_f32x4(b + x));
+        acc1 = multiply_add(acc1, load_f32x4(a + x + 4), load_f32x4(b + x + 4));
+    }
+    for (; x <= len - 4; x += 4)
+    {
+        acc0 = multiply_add(acc0, load_f32x4(a + x), load_f32x4(b + x));
+    }
+    float res = reduce_add(vaddq_f32(acc0, acc1));
+    for (; x < len; ++x)
+    {
+        res += static_cast<float>(a[x]) * static_cast<float>(b[x]);
+    }
+    return res;
+}
+
+/** acc *= scale, over @p len elements */
+inline void rescale(float *acc, float scale, int len)
+{
+    int x = 0;
+    for (; x <= len - 4; x += 4)
+    {
+        vst1q_f32(acc + x, vmulq_n_f32(vld1q_f32(acc + x), scale));
+    }
+    for (; x < len; ++x)
+    {
+        acc[x] *= scale;
+    }
+}
+
+/** acc += p * row, over @p len elements */
+template <typename T>
+inline void accumulate(float *acc, float p, const T *row, int len)
+{
+    const float32x4_t p_vec = vdupq_n_f32(p);
+    int               x     = 0;
+    for (; x <= len - 4; x += 4)
+    {
+        vst1q_f32(acc + x, multiply_add(vld1q_f32(acc + x), load_f32x4(row + x), p_vec));
+    }
+    for (; x < len; ++x)
+    {
+        acc[x] += p * static_cast<float>(row[x]);
+    }
+}
+
+/** Flash-attention style scaled dot product attention
+ *
+ * For each block of query rows, the keys are visited in blocks. The scores of a block are turned into probabilities
+ * relative to the running maximum of the row, the output accumulator and the running sum of the row are rescaled
+ * whenever the maximum grows, and the values are accumulated straight away. The full score matrix is never stored:
+ * besides the output, only Dv + 2 floats per query row live in @p tmp.
+ *
+ * @param[in]  q         Queries [D, Sq, H, B].
+ * @param[in]  k         Keys [D, Skv, H, B].
+ * @param[in]  v         Values [Dv, Skv, H, B].
+ * @param[out] dst       Output [Dv, Sq, H, B].
+ * @param[in]  tmp       F32 accumulators [Dv + 2, Sq, H, B], contiguous.
+ * @param[in]  scale     Scale applied to the scores before the softmax.
+ * @param[in]  is_causal Whether query i only attends to keys up to i + Skv - Sq.
+ * @param[in]  window    Region of @p dst to compute. X must cover the whole row.
+ */
+template <typename T>
+void neon_scaled_dot_product_attention(const ITensor *q,
+                                       const ITensor *k,
+                                       const ITensor *v,
+                                       ITensor       *dst,
+                                       ITensor       *tmp,
+                                       float          scale,
+                                       bool           is_causal,
+                                       const Window  &window)
+{
+    const ITensorInfo *q_info   = q->info();
+    const ITensorInfo *k_info   = k->info();
+    const ITensorInfo *v_info   = v->info();
+    const ITensorInfo *dst_info = dst->info();
+
+    const int head_dim      = q_info->dimension(0);
+    const int value_dim     = v_info->dimension(0);
+    const int num_q         = q_info->dimension(1);
+    const int num_kv        = k_info->dimension(1);
+    const int causal_offset = num_kv - num_q;
+
+    const int tmp_row = value_dim + 2;
+    float     scores[block_rows * block_keys];
+
+    for (int w = window[3].start(); w < window[3].end(); ++w)
+    {
+        for (int z = window.z().start(); z < window.z().end(); ++z)
+        {
+            const uint8_t *q_head = q->buffer() + q_info->offset_first_element_in_bytes() +
+                                    z * q_info->strides_in_bytes()[2] + w * q_info->strides_in_bytes()[3];
+            const uint8_t *k_head = k->buffer() + k_info->offset_first_element_in_bytes() +
+                                    z * k_info->strides_in_bytes()[2] + w * k_info->strides_in_bytes()[3];
+            const uint8_t *v_head = v->buffer() + v_info->offset_first_element_in_bytes() +
+                                    z * v_info->strides_in_bytes()[2] + w * v_info->strides_in_bytes()[3];
+            uint8_t *dst_head = dst->buffer() + dst_info->offset_first_element_in_bytes() +
+                                z * dst_info->strides_in_bytes()[2] + w * dst_info->strides_in_bytes()[3];
+            float *tmp_head = reinterpret_cast<float *>(tmp->buffer() + tmp->info()->offset_first_element_in_bytes()) +
+                              (static_cast<size_t>(w) * dst_info->dimension(2) + z) * num_q * tmp_row;
+
+            for (int y0 = window.y().start(); y0 < window.y().end(); y0 += block_rows)
+            {
+                const int rows = std::min(block_rows, static_cast<int>(window.y().end()) - y0);
+
+                // Keys visible to the last row of the block
+                const int num_keys = is_causal ? std::min(num_kv, y0 + rows + causal_offset) : num_kv;
+
+                for (int r = 0; r < rows; ++r)
+                {
+                    float *acc = tmp_head + (y0 + r) * tmp_row;
+                    std::fill_n(acc, value_dim, 0.f);
+                    acc[value_dim]     = -std::numeric_limits<float>::infinity(); // Running maximum
+                    acc[value_dim + 1] = 0.f;                                     // Running sum
+                }
+
+                for (int kb = 0; kb < num_keys; kb += block_keys)
+                {
+                    for (int r = 0; r < rows; ++r)
+                    {
+                        const int y = y0 + r;
+                        const int keys =
+                            std::min(block_keys, (is_causal ? std::min(num_kv, y + causal_offset + 1) : num_kv) - kb);
+                        if (keys <= 0)
+                        {
+                            continue;
+                        }
+
+                        const T *q_row = reinterpret_cast<const T *>(q_head + y * q_info->strides_in_bytes()[1]);
+                        float   *s     = scores + r * block_keys;
+                        float    m     = -std::numeric_limits<float>::infinity();
+                        for (int j = 0; j < keys; ++j)
+                        {
+                            const T *k_row =
+                                reinterpret_cast<const T *>(k_head + (kb + j) * k_info->strides_in_bytes()[1]);
+                            s[j] = scale * dot(q_row, k_row, head_dim);
+                            m    = std::max(m, s[j]);
+                        }
+
+                        float      *acc    = tmp_head + y * tmp_row;
+                        const float m_prev = acc[value_dim];
+                        const float m_new  = std::max(m_prev, m);
+
+                        // exp(s - m_new), vectorised like the softmax kernels
+                        const float32x4_t m_vec = vdupq_n_f32(m_new);
+                        int               j     = 0;
+                        for (; j <= keys - 4; j += 4)
+                        {
+                            vst1q_f32(s + j, vexpq_f32(vsubq_f32(vld1q_f32(s + j), m_vec)));
+                        }
+                        for (; j < keys; ++j)
+                        {
+                            s[j] = std::exp(s[j] - m_new);
+                        }
+
+                        // Rescale what was accumulated against the previous maximum
+                        float sum = acc[value_dim + 1];
+                        if (m_new > m_prev)
+                        {
+                            const float correction = std::exp(m_prev - m_new);
+                            rescale(acc, correction, value_dim);
+                            sum *= correction;
+                        }
+                        for (j = 0; j < keys; ++j)
+                        {
+                            const T *v_row =
+                                reinterpret_cast<const T *>(v_head + (kb + j) * v_info->strides_in_bytes()[1]);
+                            accumulate(acc, s[j], v_row, value_dim);
+                            sum += s[j];
+                        }
+                        acc[value_dim]     = m_new;
+                        acc[value_dim + 1] = sum;
+                    }
+                }
+
+                for (int r = 0; r < rows; ++r)
+                {
+                    const float *acc     = tmp_head + (y0 + r) * tmp_row;
+                    const float  inv_sum = acc[value_dim + 1] > 0.f ? 1.f / acc[value_dim + 1] : 0.f;
+                    T           *out     = reinterpret_cast<T *>(dst_head + (y0 + r) * dst_info->strides_in_bytes()[1]);
+                    int          x       = 0;
+                    for (; x <= value_dim - 4; x += 4)
+                    {
+                        store_f32x4(out + x, vmulq_n_f32(vld1q_f32(acc + x), inv_sum));
+                    }
+                    for (; x < value_dim; ++x)
+                    {
+                        out[x] = static_cast<T>(acc[x] * inv_sum);
+                    }
+                }
+            }
+        }
+    }
+}
+} // namespace sdpa
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_ATTENTION_GENERIC_NEON_IMPL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024 Arm Limited.
+ * Copyright (c) 2016-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,11 +36,17 @@ namespace arm_compute
 {
 namespace cpu
 {
-void neon_qasymm8_signed_to_fp16_cast(
-    const ITensor *_src, ITensor *_dst, const ThreadInfo &info, ConvertPolicy _policy, const Window &window)
+void neon_qasymm8_signed_to_fp16_cast(const ITensor    *_src,
+                                      ITensor          *_dst,
+                                      const ThreadInfo &info,
+                                      ConvertPolicy     _policy,
+                                      float             scale,
+                                      float             offset,
+                                      const Window     &window)
 {
     ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_UNUSED(_policy);
+    ARM_COMPUTE_UNUSED(scale, offset);
 
     const auto window_start_x = static_cast<int>(window.x().start());
     const auto window_end_x   = static_cast<int>(window.x().end());
@@ -51,12 +57,12 @@ void neon_qasymm8_signed_to_fp16_cast(
 
     ARM_COMPUTE_ERROR_ON_NULLPTR(_src, _dst);
 
-    Window win{window};
+    Window win = window.collapse_if_possible(window, Window::DimZ);
     win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator src(_src, win);
     Iterator dst(_dst, win);
-    execute_window_loop(
+    execute_window_loop_dims<3>(
         win,
         [&](const Coordinates &)
         {
@@ -82,11 +88,17 @@ void neon_qasymm8_signed_to_fp16_cast(
         src, dst);
 }
 
-void neon_s32_to_fp16_cast(
-    const ITensor *_src, ITensor *_dst, const ThreadInfo &info, ConvertPolicy _policy, const Window &window)
+void neon_s32_to_fp16_cast(const ITensor    *_src,
+                           ITensor          *_dst,
+                           const ThreadInfo &info,
+                           ConvertPolicy     _policy,
+                           float             scale,
+                           float             offset,
+                           const Window     &window)
 {
     ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_UNUSED(_policy);
+    ARM_COMPUTE_UNUSED(scale, offset);
 
     const auto window_start_x = static_cast<int>(window.x().start());
     const auto window_end_x   = static_cast<int>(window.x().end());
@@ -97,13 +109,13 @@ void neon_s32_to_fp16_cast(
 
     ARM_COMPUTE_ERROR_ON_NULLPTR(_src, _dst);
 
-    Window win{window};
+    Window win = window.collapse_if_possible(window, Window::DimZ);
     win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator src(_src, win);
     Iterator dst(_dst, win);
 
-    execute_window_loop(
+    execute_window_loop_dims<3>(
         win,
         [&](const Coordinates &)
         {
@@ -130,11 +142,17 @@ void neon_s32_to_fp16_cast(
         src, dst);
 }
 
-void neon_fp32_to_fp16_cast(
-    const ITensor *_src, ITensor *_dst, const ThreadInfo &info, ConvertPolicy _policy, const Window &window)
+void neon_fp32_to_fp16_cast(const ITensor    *_src,
+                            ITensor          *_dst,
+                            const ThreadInfo &info,
+                            ConvertPolicy     _policy,
+                            float             scale,
+                            float             offset,
+                            const Window     &window)
 {
     ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_UNUSED(_policy);
+    ARM_COMPUTE_UNUSED(scale, offset);
 
     const auto window_start_x = static_cast<int>(window.x().start());
     const auto window_end_x   = static_cast<int>(window.x().end());
@@ -145,13 +163,13 @@ void neon_fp32_to_fp16_cast(
 
     ARM_COMPUTE_ERROR_ON_NULLPTR(_src, _dst);
 
-    Window win{window};
+    Window win = window.collapse_if_possible(window, Window::DimZ);
     win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator src(_src, win);
     Iterator dst(_dst, win);
 
-    execute_window_loop(
+    execute_window_loop_dims<3>(
         win,
         [&](const Coordinates &)
         {
@@ -177,11 +195,17 @@ void neon_fp32_to_fp16_cast(
         src, dst);
 }
 
-void neon_fp16_to_other_dt_cast(
-    const ITensor *_src, ITensor *_dst, const ThreadInfo &info, ConvertPolicy _policy, const Window &window)
+void neon_fp16_to_other_dt_cast(const ITensor    *_src,
+                                ITensor          *_dst,
+                                const ThreadInfo &info,
+                                ConvertPolicy     _policy,
+                                float             scale,
+                                float             offset,
+                                const Window     &window)
 {
     ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_UNUSED(_policy);
+    ARM_COMPUTE_UNUSED(scale, offset);
 
     const auto window_start_x = static_cast<int>(window.x().start());
     const auto window_end_x   = static_cast<int>(window.x().end());
@@ -192,7 +216,7 @@ void neon_fp16_to_other_dt_cast(
 
     ARM_COMPUTE_ERROR_ON_NULLPTR(_src, _dst);
 
-    Window win{window};
+    Window win = window.collapse_if_possible(window, Window::DimZ);
     win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator src(_src, win);
@@ -202,7 +226,7 @@ void neon_fp16_to_other_dt_cast(
         case DataType::QASYMM8_SIGNED:
         {
             /* Down-conversion F16 -> QASYMM8_SIGNED (Always saturating) */
-            execute_window_loop(
+            execute_window_loop_dims<3>(
                 win,
                 [&](const Coordinates &)
                 {
@@ -234,7 +258,7 @@ void neon_fp16_to_other_dt_cast(
         case DataType::U8:
         {
             /* Down-conversion F16 -> QASYMM8/U8 (Always saturating) */
-            execute_window_loop(
+            execute_window_loop_dims<3>(
                 win,
                 [&](const Coordinates &)
                 {
@@ -265,7 +289,7 @@ void neon_fp16_to_other_dt_cast(
         case DataType::F32:
         {
             /* Up-conversion F16 -> F32 */
-            execute_window_loop(
+            execute_window_loop_dims<3>(
                 win,
                 [&](const Coordinates &)
                 {
@@ -294,7 +318,7 @@ void neon_fp16_to_other_dt_cast(
         case DataType::S32:
         {
             /* Up-conversion F16 -> S32 */
-            execute_window_loop(
+            execute_window_loop_dims<3>(
                 win,
                 [&](const Coordinates &)
                 {
@@ -326,11 +350,17 @@ void neon_fp16_to_other_dt_cast(
     }
 }
 
-void neon_u8_to_fp16_cast(
-    const ITensor *_src, ITensor *_dst, const ThreadInfo &info, ConvertPolicy _policy, const Window &window)
+void neon_u8_to_fp16_cast(const ITensor    *_src,
+                          ITensor          *_dst,
+                          const ThreadInfo &info,
+                          ConvertPolicy     _policy,
+                          float             scale,
+                          float             offset,
+                          const Window     &window)
 {
     ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_UNUSED(_policy);
+    ARM_COMPUTE_UNUSED(scale, offset);
 
     const auto window_start_x = static_cast<int>(window.x().start());
     const auto window_end_x   = static_cast<int>(window.x().end());
@@ -341,13 +371,13 @@ void neon_u8_to_fp16_cast(
 
     ARM_COMPUTE_ERROR_ON_NULLPTR(_src, _dst);
 
-    Window win{window};
+    Window win = window.collapse_if_possible(window, Window::DimZ);
     win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator src(_src, win);
     Iterator dst(_dst, win);
     /* Up-conversion U8 -> F16 */
-    execute_window_loop(
+    execute_window_loop_dims<3>(
         win,
         [&](const Coordinates &)
         {
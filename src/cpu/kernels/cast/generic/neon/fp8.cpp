@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifdef __aarch64__
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/core/NEON/NEFp8.h"
+#include "src/cpu/kernels/cast/list.h"
+#include "src/cpu/kernels/CpuCastKernel.h"
+#include "support/Fp8.h"
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+float to_float(uint8_t v, DataType dt)
+{
+    return dt == DataType::FP8_E4M3 ? fp8::e4m3_to_float(v) : fp8::e5m2_to_float(v);
+}
+
+/** Convert 16 FP8 numbers to fp32 */
+float32x4x4_t decode(uint8x16_t v, DataType dt)
+{
+    if (dt == DataType::FP8_E4M3)
+    {
+        // The all-ones magnitude is NaN, which the fp16 bits of the other numbers do not cover
+        uint16x8x2_t      bits = vfp8_e4m3_to_f16_bits(v);
+        const uint16x8_t  nan  = vdupq_n_u16(0x7E00);
+        const float32x4_t k    = vdupq_n_f32(fp8_e4m3_f16_scale);
+        for (auto &b : bits.val)
+        {
+            const uint16x8_t is_nan = vceqq_u16(vandq_u16(b, vdupq_n_u16(0x7FFF)), vdupq_n_u16(0x3F80));
+            b                       = vbslq_u16(is_nan, vorrq_u16(vandq_u16(b, vdupq_n_u16(0x8000)), nan), b);
+        }
+        return {{vmulq_f32(vcvt_f32_f16_bits(vget_low_u16(bits.val[0])), k),
+                 vmulq_f32(vcvt_f32_f16_bits(vget_high_u16(bits.val[0])), k),
+                 vmulq_f32(vcvt_f32_f16_bits(vget_low_u16(bits.val[1])), k),
+                 vmulq_f32(vcvt_f32_f16_bits(vget_high_u16(bits.val[1])), k)}};
+    }
+    const uint16x8x2_t bits = vfp8_e5m2_to_f16_bits(v);
+    return {{vcvt_f32_f16_bits(vget_low_u16(bits.val[0])), vcvt_f32_f16_bits(vget_high_u16(bits.val[0])),
+             vcvt_f32_f16_bits(vget_low_u16(bits.val[1])), vcvt_f32_f16_bits(vget_high_u16(bits.val[1]))}};
+}
+
+template <typename T>
+void fp8_to_float(const uint8_t *src, T *dst, int start, int end, DataType dt);
+
+template <>
+void fp8_to_float<float>(const uint8_t *src, float *dst, int start, int end, DataType dt)
+{
+    int x = start;
+    for (; x <= end - 16; x += 16)
+    {
+        const float32x4x4_t res = decode(vld1q_u8(src + x), dt);
+        vst1q_f32(dst + x, res.val[0]);
+        vst1q_f32(dst + x + 4, res.val[1]);
+        vst1q_f32(dst + x + 8, res.val[2]);
+        vst1q_f32(dst + x + 12, res.val[3]);
+    }
+    for (; x < end; ++x)
+    {
+        dst[x] = to_float(src[x], dt);
+    }
+}
+
+template <>
+void fp8_to_float<float16_t>(const uint8_t *src, float16_t *dst, int start, int end, DataType dt)
+{
+    int x = start;
+    for (; x <= end - 16; x += 16)
+    {
+        const uint8x16_t v = vld1q_u8(src + x);
+        if (dt == DataType::FP8_E5M2)
+        {
+            // The fp16 bits are the result
+            const uint16x8x2_t bits = vfp8_e5m2_to_f16_bits(v);
+            vst1q_u16(reinterpret_cast<uint16_t *>(dst + x), bits.val[0]);
+            vst1q_u16(reinterpret_cast<uint16_t *>(dst + x + 8), bits.val[1]);
+        }
+        else
+        {
+            // All the E4M3 numbers are fp16 numbers, the narrowing is exact
+            const float32x4x4_t res = decode(v, dt);
+            vst1_f16(dst + x, vcvt_f16_f32(res.val[0]));
+            vst1_f16(dst + x + 4, vcvt_f16_f32(res.val[1]));
+            vst1_f16(dst + x + 8, vcvt_f16_f32(res.val[2]));
+            vst1_f16(dst + x + 12, vcvt_f16_f32(res.val[3]));
+        }
+    }
+    for (; x < end; ++x)
+    {
+        dst[x] = static_cast<float16_t>(to_float(src[x], dt));
+    }
+}
+
+template <typename T>
+void float_to_fp8(const T *src, uint8_t *dst, int start, int end, DataType dt, bool saturate)
+{
+    // Rounding to nearest even with saturation has no vector instruction before FP8, and the conversion to FP8
+    // mostly runs once on weights
+    for (int x = start; x < end; ++x)
+    {
+        const float v = static_cast<float>(src[x]);
+        dst[x]        = dt == DataType::FP8_E4M3 ? fp8::float_to_e4m3(v, saturate) : fp8::float_to_e5m2(v, saturate);
+    }
+}
+} // namespace
+
+void neon_fp8_cast(const ITensor    *_src,
+                   ITensor          *_dst,
+                   const ThreadInfo &info,
+                   ConvertPolicy     _policy,
+                   float             scale,
+                   float             offset,
+                   const Window     &window)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_UNUSED(scale, offset);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(_src, _dst);
+    ARM_COMPUTE_ERROR_ON(_src == _dst);
+
+    const auto     window_start_x = static_cast<int>(window.x().start());
+    const auto     window_end_x   = static_cast<int>(window.x().end());
+    const DataType src_dt         = _src->info()->data_type();
+    const DataType dst_dt         = _dst->info()->data_type();
+    const bool     saturate       = _policy == ConvertPolicy::SATURATE;
+
+    Window win = window.collapse_if_possible(window, Window::DimZ);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator src(_src, win);
+    Iterator dst(_dst, win);
+    execute_window_loop_dims<3>(
+        win,
+        [&](const Coordinates &)
+        {
+            if (src_dt == DataType::FP8_E4M3 || src_dt == DataType::FP8_E5M2)
+            {
+                const auto src_ptr = reinterpret_cast<const uint8_t *>(src.ptr());
+                if (dst_dt == DataType::F32)
+                {
+                    fp8_to_float(src_ptr, reinterpret_cast<float *>(dst.ptr()), window_start_x, window_end_x, src_dt);
+                }
+                else
+                {
+                    fp8_to_float(src_ptr, reinterpret_cast<float16_t *>(dst.ptr()), window_start_x, window_end_x,
+                                 src_dt);
+                }
+            }
+            else
+            {
+                const auto dst_ptr = reinterpret_cast<uint8_t *>(dst.ptr());
+                if (src_dt == DataType::F32)
+                {
+                    float_to_fp8(reinterpret_cast<const float *>(src.ptr()), dst_ptr, window_start_x, window_end_x,
+                                 dst_dt, saturate);
+                }
+                else
+                {
+                    float_to_fp8(reinterpret_cast<const float16_t *>(src.ptr()), dst_ptr, window_start_x,
+                                 window_end_x, dst_dt, saturate);
+                }
+            }
+        },
+        src, dst);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // __aarch64__
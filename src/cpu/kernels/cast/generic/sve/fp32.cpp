@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_sve.h>
+#include <cstdint>
+#include <type_traits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+inline svfloat32_t load_f32(svbool_t pg, const float *ptr)
+{
+    return svld1_f32(pg, ptr);
+}
+
+inline svfloat32_t load_f32(svbool_t pg, const int32_t *ptr)
+{
+    return svcvt_f32_s32_z(pg, svld1_s32(pg, ptr));
+}
+
+inline svfloat32_t load_f32(svbool_t pg, const uint8_t *ptr)
+{
+    return svcvt_f32_u32_z(pg, svld1ub_u32(pg, ptr));
+}
+
+inline svfloat32_t load_f32(svbool_t pg, const int8_t *ptr)
+{
+    return svcvt_f32_s32_z(pg, svld1sb_s32(pg, ptr));
+}
+
+inline void store_f32(svbool_t pg, float *ptr, svfloat32_t v)
+{
+    svst1_f32(pg, ptr, v);
+}
+
+inline void store_f32(svbool_t pg, int32_t *ptr, svfloat32_t v)
+{
+    // The conversion saturates out of range values
+    svst1_s32(pg, ptr, svcvt_s32_f32_z(pg, v));
+}
+
+inline void store_f32(svbool_t pg, uint8_t *ptr, svfloat32_t v)
+{
+    const svint32_t vi = svmin_n_s32_z(pg, svmax_n_s32_z(pg, svcvt_s32_f32_z(pg, v), 0), 255);
+    svst1b_u32(pg, ptr, svreinterpret_u32_s32(vi));
+}
+
+inline void store_f32(svbool_t pg, int8_t *ptr, svfloat32_t v)
+{
+    const svint32_t vi = svmin_n_s32_z(pg, svmax_n_s32_z(pg, svcvt_s32_f32_z(pg, v), -128), 127);
+    svst1b_s32(pg, ptr, vi);
+}
+
+/** Cast the elements of the window through 32-bit floating point lanes
+ *
+ * Without an affine transform float values are truncated toward zero, as in the Neon™ paths. With an affine
+ * transform the result is rounded to the nearest integer, ties away from zero, before saturating.
+ */
+template <typename TIn, typename TOut>
+void cast_f32_lanes(const ITensor *src, ITensor *dst, float scale, float offset, const Window &window)
+{
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+    const bool has_affine     = scale != 1.f || offset != 0.f;
+    const bool round_result   = has_affine && !std::is_same<TOut, float>::value;
+
+    Window win{window};
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(src, win);
+    Iterator output(dst, win);
+
+    const auto vscale  = svdup_n_f32(scale);
+    const auto voffset = svdup_n_f32(offset);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto src_ptr = reinterpret_cast<const TIn *>(input.ptr());
+            const auto dst_ptr = reinterpret_cast<TOut *>(output.ptr());
+
+            int      x  = window_start_x;
+            svbool_t pg = svwhilelt_b32(x, window_end_x);
+            do
+            {
+                svfloat32_t v = load_f32(pg, src_ptr + x);
+                if (has_affine)
+                {
+                    v = svmla_f32_z(pg, voffset, v, vscale);
+                }
+                if (round_result)
+                {
+                    v = svrinta_f32_z(pg, v);
+                }
+                store_f32(pg, dst_ptr + x, v);
+
+                x += svcntw();
+                pg = svwhilelt_b32(x, window_end_x);
+            } while (svptest_any(svptrue_b32(), pg));
+        },
+        input, output);
+}
+} // namespace
+
+void sve_fp32_cast(const ITensor    *_src,
+                   ITensor          *_dst,
+                   const ThreadInfo &info,
+                   ConvertPolicy     _policy,
+                   float             scale,
+                   float             offset,
+                   const Window     &window)
+{
+    ARM_COMPUTE_UNUSED(info);
+    // Narrowing conversions always saturate, matching the Neon™ paths for these data types
+    ARM_COMPUTE_UNUSED(_policy);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(_src, _dst);
+    ARM_COMPUTE_ERROR_ON(_src == _dst);
+
+    const DataType src_dt = _src->info()->data_type();
+    const DataType dst_dt = _dst->info()->data_type();
+
+    if (src_dt == DataType::F32)
+    {
+        switch (dst_dt)
+        {
+            case DataType::S32:
+                cast_f32_lanes<float, int32_t>(_src, _dst, scale, offset, window);
+                break;
+            case DataType::QASYMM8:
+            case DataType::U8:
+                cast_f32_lanes<float, uint8_t>(_src, _dst, scale, offset, window);
+                break;
+            case DataType::QASYMM8_SIGNED:
+                cast_f32_lanes<float, int8_t>(_src, _dst, scale, offset, window);
+                break;
+            default:
+                ARM_COMPUTE_ERROR("dst data type not supported");
+        }
+    }
+    else
+    {
+        ARM_COMPUTE_ERROR_ON(dst_dt != DataType::F32);
+        switch (src_dt)
+        {
+            case DataType::S32:
+                cast_f32_lanes<int32_t, float>(_src, _dst, scale, offset, window);
+                break;
+            case DataType::QASYMM8:
+            case DataType::U8:
+                cast_f32_lanes<uint8_t, float>(_src, _dst, scale, offset, window);
+                break;
+            case DataType::QASYMM8_SIGNED:
+                cast_f32_lanes<int8_t, float>(_src, _dst, scale, offset, window);
+                break;
+            default:
+                ARM_COMPUTE_ERROR("src data type not supported");
+        }
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,7 +29,7 @@ namespace cpu
 {
 #define DECLARE_CAST_KERNEL(func_name)                                                                  \
     void func_name(const ITensor *_src, ITensor *_dst, const ThreadInfo &tensor, ConvertPolicy _policy, \
-                   const Window &window)
+                   float scale, float offset, const Window &window)
 
 DECLARE_CAST_KERNEL(neon_fp32_to_fp16_cast);
 DECLARE_CAST_KERNEL(neon_u8_to_fp16_cast);
@@ -38,6 +38,8 @@ DECLARE_CAST_KERNEL(neon_s32_to_fp16_cast);
 DECLARE_CAST_KERNEL(neon_qasymm8_signed_to_fp16_cast);
 DECLARE_CAST_KERNEL(neon_fp32_to_bfloat16_cast);
 DECLARE_CAST_KERNEL(neon_bfloat16_to_fp32_cast);
+DECLARE_CAST_KERNEL(neon_fp8_cast);
+DECLARE_CAST_KERNEL(sve_fp32_cast);
 
 #undef DECLARE_CAST_KERNEL
 } // namespace cpu
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,9 +24,13 @@
 #ifndef SRC_CORE_KERNELS_DEPTWISECONV2DNATIVE_IMPL_H
 #define SRC_CORE_KERNELS_DEPTWISECONV2DNATIVE_IMPL_H
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/utils/math/Math.h"
 
 #include "src/core/NEON/wrapper/wrapper.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace arm_compute
 {
 struct ConvolutionInfo;
@@ -240,6 +244,173 @@ void depthwise_loop_multiplier1_fp(const ITensor       *src,
         input_it, weights_it, biases_it, output_it);
 }
 
+/** Number of elements of the 128-bit vectors holding several pixels of tensors with few channels */
+template <typename T>
+constexpr size_t small_channels_vector_elements()
+{
+    return 16 / sizeof(T);
+}
+
+/** Returns true if the pixels of a tensor with few channels are vectorized together by
+ * @ref depthwise_loop_small_channels_fp
+ *
+ * The channels of consecutive pixels along the width must fill a 128-bit vector and be contiguous in the source,
+ * weights and destination, and consecutive outputs must read consecutive inputs.
+ */
+template <typename T>
+bool is_small_channels_depthwise(const ITensorInfo   &src,
+                                 const ITensorInfo   &weights,
+                                 const ITensorInfo   &dst,
+                                 const PadStrideInfo &conv_info)
+{
+    const size_t channels = src.dimension(channel_idx);
+    const size_t row_size = channels * sizeof(T);
+    return channels < small_channels_vector_elements<T>() && small_channels_vector_elements<T>() % channels == 0 &&
+           conv_info.stride().first == 1 && src.strides_in_bytes().y() == row_size &&
+           weights.strides_in_bytes().y() == row_size && dst.strides_in_bytes().y() == row_size;
+}
+
+/** Depthwise convolution of multiplier 1 on tensors with fewer channels than a vector
+ *
+ * Vectorizing along the channels would leave most of the lanes empty, so each vector holds the channels of several
+ * consecutive output pixels instead: the inputs they read are consecutive as well, and the weights and biases of the
+ * channels are repeated along the vector. Groups of pixels reading the input borders are computed one channel at a
+ * time.
+ */
+template <typename T>
+void depthwise_loop_small_channels_fp(const ITensor       *src,
+                                      const ITensor       *weights,
+                                      const ITensor       *biases,
+                                      ITensor             *dst,
+                                      const PadStrideInfo &conv_info,
+                                      const Size2D        &dilation,
+                                      const Window        &window,
+                                      bool                 has_biases)
+{
+    constexpr auto element_per_vector = small_channels_vector_elements<T>();
+    using VectorType                  = typename wrapper::traits::neon_vector<T, element_per_vector>::type;
+    using TagType                     = typename wrapper::traits::neon_vector<T, element_per_vector>::tag_type;
+
+    const auto   run_info         = DepthwiseConvolutionRunInfo(*src->info(), *weights->info(), conv_info, window);
+    const size_t channels         = run_info.input_depth;
+    const size_t pixels_per_group = element_per_vector / channels;
+
+    // Weights and biases of the channels repeated along a vector
+    std::vector<T> repeated_weights(run_info.weights_width * run_info.weights_height * element_per_vector);
+    std::vector<T> repeated_biases(element_per_vector, T(0));
+    for (size_t h = 0; h < run_info.weights_height; ++h)
+    {
+        for (size_t w = 0; w < run_info.weights_width; ++w)
+        {
+            const auto *weights_ptr = reinterpret_cast<const T *>(weights->ptr_to_element(Coordinates(0, w, h)));
+            for (size_t i = 0; i < element_per_vector; ++i)
+            {
+                repeated_weights[(h * run_info.weights_width + w) * element_per_vector + i] = weights_ptr[i % channels];
+            }
+        }
+    }
+    if (has_biases)
+    {
+        const auto *biases_ptr = reinterpret_cast<const T *>(biases->ptr_to_element(Coordinates(0)));
+        for (size_t i = 0; i < element_per_vector; ++i)
+        {
+            repeated_biases[i] = biases_ptr[i % channels];
+        }
+    }
+    const VectorType biases_vals = wrapper::vloadq(repeated_biases.data());
+    const VectorType zero_vector = wrapper::vdup_n(static_cast<T>(0), TagType{});
+
+    // The last group of the window may be partial
+    const int32_t           y_end  = window.y().end();
+    const int32_t           groups = DIV_CEIL(y_end - window.y().start(), static_cast<int32_t>(pixels_per_group));
+    const Window::Dimension dim_groups(window.y().start(),
+                                       window.y().start() + groups * static_cast<int32_t>(pixels_per_group),
+                                       static_cast<int32_t>(pixels_per_group));
+
+    Window execution_window = window;
+    execution_window.set(Window::DimX, dim_single_unit_step);
+    execution_window.set(Window::DimY, dim_groups);
+
+    Window win_input = window;
+    win_input.set(Window::DimX, dim_manual_loop);
+    win_input.set(Window::DimY, dim_manual_loop);
+    win_input.set(Window::DimZ, dim_manual_loop);
+
+    Window win_output = window;
+    win_output.set(Window::DimX, dim_manual_loop);
+    win_output.set(Window::DimY, dim_groups);
+
+    Iterator input_it(src, win_input);
+    Iterator output_it(dst, win_output);
+
+    const int32_t input_width = static_cast<int32_t>(run_info.input_width);
+    const int32_t last_x      = static_cast<int32_t>((run_info.weights_width - 1) * dilation.x());
+
+    execute_window_loop(
+        execution_window,
+        [&](const Coordinates &id)
+        {
+            const int32_t input_y = id.y() - static_cast<int32_t>(run_info.conv_pad_left);
+            const int32_t input_z = id.z() * run_info.conv_stride_y - run_info.conv_pad_top;
+            const int32_t pixels  = std::min(static_cast<int32_t>(pixels_per_group), y_end - id.y());
+            auto         *out_ptr = reinterpret_cast<T *>(output_it.ptr());
+
+            // The whole group reads inside the input width
+            if (pixels == static_cast<int32_t>(pixels_per_group) && input_y >= 0 &&
+                input_y + last_x + pixels <= input_width)
+            {
+                VectorType acc = zero_vector;
+                for (uint32_t h = 0; h < run_info.weights_height; ++h)
+                {
+                    const int32_t current_z = input_z + h * dilation.y();
+                    if (current_z < 0 || current_z >= static_cast<int32_t>(run_info.input_height))
+                    {
+                        continue;
+                    }
+                    const uint8_t *row_ptr = input_it.ptr() + current_z * run_info.input_stride_z +
+                                             input_y * run_info.input_stride_y;
+                    for (uint32_t w = 0; w < run_info.weights_width; ++w)
+                    {
+                        const auto input_vals = wrapper::vloadq(
+                            reinterpret_cast<const T *>(row_ptr + w * dilation.x() * run_info.input_stride_y));
+                        const auto weights_vals = wrapper::vloadq(
+                            repeated_weights.data() + (h * run_info.weights_width + w) * element_per_vector);
+                        acc = wrapper::vmla(acc, weights_vals, input_vals);
+                    }
+                }
+                wrapper::vstore(out_ptr, has_biases ? wrapper::vadd(acc, biases_vals) : acc);
+                return;
+            }
+
+            for (int32_t p = 0; p < pixels; ++p)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    T acc_scalar = has_biases ? repeated_biases[c] : T(0);
+                    for (uint32_t h = 0; h < run_info.weights_height; ++h)
+                    {
+                        for (uint32_t w = 0; w < run_info.weights_width; ++w)
+                        {
+                            if (!is_valid_input_region(input_y + p, input_z, w, h, run_info, dilation))
+                            {
+                                continue;
+                            }
+                            const int32_t current_y = input_y + p + w * dilation.x();
+                            const int32_t current_z = input_z + h * dilation.y();
+                            const T       input_val = *reinterpret_cast<const T *>(
+                                input_it.ptr() + current_z * run_info.input_stride_z +
+                                current_y * run_info.input_stride_y + c * sizeof(T));
+                            acc_scalar += input_val *
+                                          repeated_weights[(h * run_info.weights_width + w) * element_per_vector + c];
+                        }
+                    }
+                    out_ptr[p * channels + c] = acc_scalar;
+                }
+            }
+        },
+        input_it, output_it);
+}
+
 template <typename T>
 void depthwise_loop_generic_fp(const ITensor       *src,
                                const ITensor       *weights,
@@ -349,7 +520,12 @@ void run_depthwise_float(const ITensor         *src,
     unsigned int  depth_multiplier = info.depth_multiplier;
     Size2D        dilation         = info.dilation;
 
-    if (depth_multiplier == 1)
+    if (depth_multiplier == 1 &&
+        is_small_channels_depthwise<T>(*src->info(), *weights->info(), *dst->info(), conv_info))
+    {
+        depthwise_loop_small_channels_fp<T>(src, weights, biases, dst, conv_info, dilation, window, has_biases);
+    }
+    else if (depth_multiplier == 1)
     {
         depthwise_loop_multiplier1_fp<T>(src, weights, biases, dst, conv_info, dilation, window, has_biases);
     }
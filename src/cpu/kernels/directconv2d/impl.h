@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023, 2025 Arm Limited.
+ * Copyright (c) 2022-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,7 @@
 #include "src/core/NEON/wrapper/wrapper.h"
 
 #include <algorithm>
+#include <cstring>
 
 namespace arm_compute
 {
@@ -61,80 +62,49 @@ void linearize_volume_nchw(const uint8_t *const in_ptr,
                            int                  dilation_x,
                            int                  dilation_y)
 {
-    const int kernel_area = kernel_width * kernel_height;
-    const int x_e         = top_left_x + kernel_width * dilation_x;
-    const int y_e         = top_left_y + kernel_height * dilation_y;
+    const int y_e = top_left_y + kernel_height * dilation_y;
+    const T   pad = static_cast<T>(pad_value);
 
-    // Linearize volume
-    int d = 0;
-    // This for loop linearizes a volume with 3 slices. This allows:
-    // 1) to reduce the iterations of the outer for loop "d"
-    // 2) to have an optimized im2col for the first convolution layer where usually we have 3 IFMs
-    for (; d <= (kernel_depth - 3); d += 3)
+    // Range of the kernel columns which fall inside the input, the others read the padding
+    int x_begin = 0;
+    int x_end   = kernel_width;
+    if (has_pads)
     {
-        for (int y = top_left_y; y < y_e; y += dilation_y)
-        {
-            if ((y < 0 || y >= input_h) && has_pads)
-            {
-                // All the values will be the offset (will be zeros when not quantized)
-                for (int x = top_left_x; x < x_e; x += dilation_x, ++out_ptr)
-                {
-                    *(out_ptr + 0 * kernel_area) = pad_value;
-                    *(out_ptr + 1 * kernel_area) = pad_value;
-                    *(out_ptr + 2 * kernel_area) = pad_value;
-                }
-            }
-            else
-            {
-                for (int x = top_left_x; x < x_e; x += dilation_x, ++out_ptr)
-                {
-                    if ((x < 0 || x >= input_w) && has_pads)
-                    {
-                        *(out_ptr + 0 * kernel_area) = pad_value;
-                        *(out_ptr + 1 * kernel_area) = pad_value;
-                        *(out_ptr + 2 * kernel_area) = pad_value;
-                    }
-                    else
-                    {
-                        *(out_ptr + 0 * kernel_area) = *(reinterpret_cast<const T *>(
-                            in_ptr + ((d + 0) * input_stride_z + y * input_stride_y + x * input_stride_x)));
-                        *(out_ptr + 1 * kernel_area) = *(reinterpret_cast<const T *>(
-                            in_ptr + ((d + 1) * input_stride_z + y * input_stride_y + x * input_stride_x)));
-                        *(out_ptr + 2 * kernel_area) = *(reinterpret_cast<const T *>(
-                            in_ptr + ((d + 2) * input_stride_z + y * input_stride_y + x * input_stride_x)));
-                    }
-                }
-            }
-        }
-        out_ptr += 2 * kernel_area;
+        x_begin = std::min(kernel_width, std::max(0, (-top_left_x + dilation_x - 1) / dilation_x));
+        x_end   = std::max(x_begin, std::min(kernel_width, (input_w - top_left_x + dilation_x - 1) / dilation_x));
     }
+    const bool is_contiguous_row = (dilation_x == 1) && (input_stride_x == static_cast<int>(sizeof(T)));
 
-    // Left over
-    for (; d < kernel_depth; d++)
+    // Linearize volume, one row of the kernel at a time
+    for (int d = 0; d < kernel_depth; ++d)
     {
         for (int y = top_left_y; y < y_e; y += dilation_y)
         {
             if ((y < 0 || y >= input_h) && has_pads)
             {
                 // All the values will be the offset (will be zeros when not quantized)
-                memset(static_cast<void *>(out_ptr), pad_value, kernel_width * sizeof(T));
-                out_ptr += kernel_width;
+                std::fill_n(out_ptr, kernel_width, pad);
             }
             else
             {
-                for (int x = top_left_x; x < x_e; x += dilation_x, ++out_ptr)
+                const uint8_t *row_ptr = in_ptr + d * input_stride_z + y * input_stride_y +
+                                         (top_left_x + x_begin * dilation_x) * input_stride_x;
+
+                std::fill_n(out_ptr, x_begin, pad);
+                if (is_contiguous_row)
                 {
-                    if ((x < 0 || x >= input_w) && has_pads)
-                    {
-                        *out_ptr = pad_value;
-                    }
-                    else
+                    std::memcpy(out_ptr + x_begin, row_ptr, (x_end - x_begin) * sizeof(T));
+                }
+                else
+                {
+                    for (int x = x_begin; x < x_end; ++x, row_ptr += dilation_x * input_stride_x)
                     {
-                        *out_ptr = *(reinterpret_cast<const T *>(
-                            in_ptr + (d * input_stride_z + y * input_stride_y + x * input_stride_x)));
+                        out_ptr[x] = *reinterpret_cast<const T *>(row_ptr);
                     }
                 }
+                std::fill_n(out_ptr + x_end, kernel_width - x_end, pad);
             }
+            out_ptr += kernel_width;
         }
     }
 
@@ -166,7 +136,7 @@ void linearize_volume_nhwc(const uint8_t *const in_ptr,
     const int end_y        = start_y + kernel_height * dilation_y;
     const int pad_quant    = kernel_width * input_c;
     const int element_size = static_cast<int>(sizeof(T));
-    if ((start_y >= 0) && (end_y < input_h) && (start_x >= 0) && (end_x < input_w) && (dilation_x == 1) &&
+    if ((start_y >= 0) && (end_y <= input_h) && (start_x >= 0) && (end_x <= input_w) && (dilation_x == 1) &&
         (input_stride_y == input_c * element_size))
     {
         for (int y = start_y; y < end_y; y += dilation_y)
@@ -186,7 +156,7 @@ void linearize_volume_nhwc(const uint8_t *const in_ptr,
                 memset(static_cast<void *>(out_ptr), pad_value, pad_quant * element_size);
                 out_ptr += pad_quant;
             }
-            else if (dilation_x > 1 || start_x < 0 || end_x >= input_w || input_stride_y != input_c * element_size)
+            else if (dilation_x > 1 || start_x < 0 || end_x > input_w || input_stride_y != input_c * element_size)
             {
                 for (int x = start_x; x < end_x; x += dilation_x)
                 {
@@ -243,7 +213,7 @@ void linearize_volume_nhwc(const uint8_t *const in_ptr,
     const int element_size       = static_cast<int>(sizeof(T));
     const int channel_chunk_size = input_c * element_size;
 
-    if ((start_y >= 0) && (end_y < input_h) && (start_x >= 0) && (end_x < input_w) && (dilation_x == 1) &&
+    if ((start_y >= 0) && (end_y <= input_h) && (start_x >= 0) && (end_x <= input_w) && (dilation_x == 1) &&
         (input_stride_y == channel_chunk_size))
     {
         for (int y = start_y; y < end_y; y += dilation_y)
@@ -266,7 +236,7 @@ void linearize_volume_nhwc(const uint8_t *const in_ptr,
                 memset(static_cast<void *>(out_ptr), pad_value, pad_quant * element_size);
                 out_ptr += pad_quant;
             }
-            else if (dilation_x > 1 || start_x < 0 || end_x >= input_w || input_stride_y != channel_chunk_size)
+            else if (dilation_x > 1 || start_x < 0 || end_x > input_w || input_stride_y != channel_chunk_size)
             {
                 for (int x = start_x; x < end_x; x += dilation_x)
                 {
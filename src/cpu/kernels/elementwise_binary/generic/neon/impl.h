@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, 2024 Arm Limited.
+ * Copyright (c) 2021-2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -313,6 +313,69 @@ void elementwise_arithm_op(const ITensor *in1, const ITensor *in2, ITensor *out,
         &elementwise_arithm_op_loop<op, scalar_type, VectorType>);
 }
 
+template <ArithmeticOperation op, typename ScalarType>
+inline int elementwise_arithm_op_8bit_loop(int               window_start_x,
+                                           int               window_end_x,
+                                           int               window_step_x,
+                                           const ScalarType *input1_ptr,
+                                           const ScalarType *input2_ptr,
+                                           ScalarType       *output_ptr)
+{
+    ARM_COMPUTE_UNUSED(window_step_x);
+    using VectorType = wrapper::traits::neon_vector<ScalarType, 16>;
+
+    int x = window_start_x;
+    for (; x <= (window_end_x - 16); x += 16)
+    {
+        const auto a = wrapper::vloadq(input1_ptr + x);
+        const auto b = wrapper::vloadq(input2_ptr + x);
+        wrapper::vstore(output_ptr + x, elementwise_arithm_op<op, VectorType>(a, b));
+    }
+    return x;
+}
+
+template <ArithmeticOperation op, typename ScalarType>
+inline int elementwise_arithm_op_8bit_broadcast_loop(int               window_start_x,
+                                                     int               window_end_x,
+                                                     int               window_step_x,
+                                                     const ScalarType *non_broadcast_input_ptr,
+                                                     const ScalarType &broadcast_value,
+                                                     ScalarType       *output_ptr,
+                                                     const bool        reorder)
+{
+    ARM_COMPUTE_UNUSED(window_step_x);
+    using VectorType = wrapper::traits::neon_vector<ScalarType, 16>;
+
+    int x = window_start_x;
+    for (; x <= (window_end_x - 16); x += 16)
+    {
+        const auto a = wrapper::vloadq(non_broadcast_input_ptr + x);
+        wrapper::vstore(output_ptr + x,
+                        elementwise_arithm_op_broadcast<op, ScalarType, VectorType>(a, broadcast_value, reorder));
+    }
+    return x;
+}
+
+/** Computes the minimum or maximum of two quantized tensors with the same quantization info as the output.
+ *
+ * The dequantization is increasing, so the quantized result is the minimum or maximum of the quantized values and no
+ * conversion to float is needed.
+ */
+template <ArithmeticOperation op, typename ScalarType>
+void elementwise_min_max_op_quantized_integer(const ITensor *in1,
+                                              const ITensor *in2,
+                                              ITensor       *out,
+                                              const Window  &window)
+{
+    static_assert(op == ArithmeticOperation::MIN || op == ArithmeticOperation::MAX,
+                  "Only the minimum and maximum are computed on the quantized values");
+
+    // The loops step by the 16 elements of a vector rather than by the step chosen by elementwise_op
+    elementwise_op<ScalarType, ScalarType, wrapper::traits::neon_vector<ScalarType, 16>>(
+        in1, in2, out, window, &elementwise_arithm_op_scalar<op, ScalarType>,
+        &elementwise_arithm_op_8bit_broadcast_loop<op, ScalarType>, &elementwise_arithm_op_8bit_loop<op, ScalarType>);
+}
+
 template <ComparisonOperation op, typename InputScalarType>
 inline uint8_t elementwise_comp_op_scalar(const InputScalarType &a, const InputScalarType &b)
 {
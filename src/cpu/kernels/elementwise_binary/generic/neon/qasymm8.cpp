@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,6 +67,21 @@ template void neon_qasymm8_elementwise_binary<ArithmeticOperation::PRELU>(const
                                                                           ITensor       *out,
                                                                           const Window  &window);
 
+template <ArithmeticOperation op>
+void neon_qasymm8_integer_elementwise_binary(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
+{
+    return elementwise_min_max_op_quantized_integer<op, uint8_t>(in1, in2, out, window);
+}
+
+template void neon_qasymm8_integer_elementwise_binary<ArithmeticOperation::MIN>(const ITensor *in1,
+                                                                                const ITensor *in2,
+                                                                                ITensor       *out,
+                                                                                const Window  &window);
+template void neon_qasymm8_integer_elementwise_binary<ArithmeticOperation::MAX>(const ITensor *in1,
+                                                                                const ITensor *in2,
+                                                                                ITensor       *out,
+                                                                                const Window  &window);
+
 template <ComparisonOperation op>
 void neon_qasymm8_comparison_elementwise_binary(const ITensor *in1,
                                                 const ITensor *in2,
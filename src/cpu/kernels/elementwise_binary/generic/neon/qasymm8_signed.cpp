@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -68,6 +68,24 @@ template void neon_qasymm8_signed_elementwise_binary<ArithmeticOperation::PRELU>
                                                                                  ITensor       *out,
                                                                                  const Window  &window);
 
+template <ArithmeticOperation op>
+void neon_qasymm8_signed_integer_elementwise_binary(const ITensor *in1,
+                                                    const ITensor *in2,
+                                                    ITensor       *out,
+                                                    const Window  &window)
+{
+    return elementwise_min_max_op_quantized_integer<op, int8_t>(in1, in2, out, window);
+}
+
+template void neon_qasymm8_signed_integer_elementwise_binary<ArithmeticOperation::MIN>(const ITensor *in1,
+                                                                                       const ITensor *in2,
+                                                                                       ITensor       *out,
+                                                                                       const Window  &window);
+template void neon_qasymm8_signed_integer_elementwise_binary<ArithmeticOperation::MAX>(const ITensor *in1,
+                                                                                       const ITensor *in2,
+                                                                                       ITensor       *out,
+                                                                                       const Window  &window);
+
 template <ComparisonOperation op>
 void neon_qasymm8_signed_comparison_elementwise_binary(const ITensor *in1,
                                                        const ITensor *in2,
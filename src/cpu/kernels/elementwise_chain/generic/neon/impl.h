@@ -0,0 +1,394 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_ELEMENTWISE_CHAIN_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_ELEMENTWISE_CHAIN_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
+
+#include "src/core/NEON/NEAsymm.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <arm_neon.h>
+#include <cmath>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace elementwise_chain
+{
+/** Number of fp32 registers every operation of the chain is applied to before the next one */
+constexpr int block_regs = 4;
+/** Number of elements evaluated at once */
+constexpr int block_size = 4 * block_regs;
+
+using Block = float32x4_t[block_regs];
+
+// The chain is always evaluated in fp32, the narrower types are converted on load and store
+inline void load(const float *ptr, Block &v)
+{
+    for (int i = 0; i < block_regs; ++i)
+    {
+        v[i] = vld1q_f32(ptr + 4 * i);
+    }
+}
+
+inline void store(float *ptr, const Block &v, const UniformQuantizationInfo &)
+{
+    for (int i = 0; i < block_regs; ++i)
+    {
+        vst1q_f32(ptr + 4 * i, v[i]);
+    }
+}
+
+inline void store(uint8_t *ptr, const Block &v, const UniformQuantizationInfo &qinfo)
+{
+    vst1q_u8(ptr, vquantize(float32x4x4_t{{v[0], v[1], v[2], v[3]}}, qinfo));
+}
+
+inline void store(int8_t *ptr, const Block &v, const UniformQuantizationInfo &qinfo)
+{
+    vst1q_s8(ptr, vquantize_signed(float32x4x4_t{{v[0], v[1], v[2], v[3]}}, qinfo));
+}
+
+inline void store_scalar(float *ptr, float v, const UniformQuantizationInfo &)
+{
+    *ptr = v;
+}
+
+inline void store_scalar(uint8_t *ptr, float v, const UniformQuantizationInfo &qinfo)
+{
+    *ptr = quantize_qasymm8(v, qinfo);
+}
+
+inline void store_scalar(int8_t *ptr, float v, const UniformQuantizationInfo &qinfo)
+{
+    *ptr = quantize_qasymm8_signed(v, qinfo);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline void load(const float16_t *ptr, Block &v)
+{
+    for (int i = 0; i < block_regs; i += 2)
+    {
+        const float16x8_t h = vld1q_f16(ptr + 4 * i);
+        v[i]                = vcvt_f32_f16(vget_low_f16(h));
+        v[i + 1]            = vcvt_f32_f16(vget_high_f16(h));
+    }
+}
+
+inline void store(float16_t *ptr, const Block &v, const UniformQuantizationInfo &)
+{
+    for (int i = 0; i < block_regs; i += 2)
+    {
+        vst1q_f16(ptr + 4 * i, vcombine_f16(vcvt_f16_f32(v[i]), vcvt_f16_f32(v[i + 1])));
+    }
+}
+
+inline void store_scalar(float16_t *ptr, float v, const UniformQuantizationInfo &)
+{
+    *ptr = static_cast<float16_t>(v);
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+inline float32x4_t apply_binary(ElementwiseChainOpType type, float32x4_t x, float32x4_t y)
+{
+    switch (type)
+    {
+        case ElementwiseChainOpType::ADD:
+            return vaddq_f32(x, y);
+        case ElementwiseChainOpType::SUB:
+            return vsubq_f32(x, y);
+        case ElementwiseChainOpType::MUL:
+            return vmulq_f32(x, y);
+        case ElementwiseChainOpType::DIV:
+            return wrapper::vdiv(x, y);
+        case ElementwiseChainOpType::MIN:
+            return vminq_f32(x, y);
+        case ElementwiseChainOpType::MAX:
+            return vmaxq_f32(x, y);
+        case ElementwiseChainOpType::SQUARED_DIFF:
+        {
+            const float32x4_t d = vsubq_f32(x, y);
+            return vmulq_f32(d, d);
+        }
+        default:
+            return x;
+    }
+}
+
+inline float32x4_t apply_unary(ElementwiseChainOpType type, float32x4_t x)
+{
+    switch (type)
+    {
+        case ElementwiseChainOpType::EXP:
+            return wrapper::vexpq(x);
+        case ElementwiseChainOpType::NEG:
+            return vnegq_f32(x);
+        case ElementwiseChainOpType::ABS:
+            return vabsq_f32(x);
+        case ElementwiseChainOpType::RSQRT:
+            return wrapper::vinvsqrt(x);
+        default:
+            return x;
+    }
+}
+
+inline float32x4_t activate(ActivationLayerInfo::ActivationFunction act, float32x4_t a, float32x4_t b, float32x4_t x)
+{
+    using ActFunction       = ActivationLayerInfo::ActivationFunction;
+    const float32x4_t zero  = vdupq_n_f32(0.f);
+    const float32x4_t one   = vdupq_n_f32(1.f);
+    const float32x4_t three = vdupq_n_f32(3.f);
+    const float32x4_t six   = vdupq_n_f32(6.f);
+    switch (act)
+    {
+        case ActFunction::LINEAR:
+            return vmlaq_f32(b, a, x);
+        case ActFunction::RELU:
+            return vmaxq_f32(zero, x);
+        case ActFunction::BOUNDED_RELU:
+            return vminq_f32(a, vmaxq_f32(zero, x));
+        case ActFunction::LU_BOUNDED_RELU:
+            return vminq_f32(a, vmaxq_f32(b, x));
+        case ActFunction::LEAKY_RELU:
+            return vbslq_f32(vcgtq_f32(x, zero), x, vmulq_f32(a, x));
+        case ActFunction::LOGISTIC:
+            return wrapper::vinv(vaddq_f32(one, wrapper::vexpq(vnegq_f32(x))));
+        case ActFunction::TANH:
+            return vmulq_f32(a, wrapper::vtanh(vmulq_f32(b, x)));
+        case ActFunction::ABS:
+            return vabsq_f32(x);
+        case ActFunction::SQUARE:
+            return vmulq_f32(x, x);
+        case ActFunction::HARD_SWISH:
+        {
+            const float32x4_t gate = vminq_f32(vmaxq_f32(vaddq_f32(x, three), zero), six);
+            return vmulq_f32(x, vmulq_f32(gate, vdupq_n_f32(1.f / 6.f)));
+        }
+        case ActFunction::SWISH:
+            return vmulq_f32(x, wrapper::vinv(vaddq_f32(one, wrapper::vexpq(vnegq_f32(vmulq_f32(a, x))))));
+#ifdef __aarch64__
+        case ActFunction::GELU:
+        {
+            const float32x4_t erf_x = wrapper::verf(vmulq_f32(x, vdupq_n_f32(0.70710678118f)));
+            return vmulq_f32(x, vmulq_f32(vdupq_n_f32(0.5f), vaddq_f32(one, erf_x)));
+        }
+#endif // __aarch64__
+        default:
+            return x;
+    }
+}
+
+inline float apply_binary(ElementwiseChainOpType type, float x, float y)
+{
+    switch (type)
+    {
+        case ElementwiseChainOpType::ADD:
+            return x + y;
+        case ElementwiseChainOpType::SUB:
+            return x - y;
+        case ElementwiseChainOpType::MUL:
+            return x * y;
+        case ElementwiseChainOpType::DIV:
+            return x / y;
+        case ElementwiseChainOpType::MIN:
+            return std::min(x, y);
+        case ElementwiseChainOpType::MAX:
+            return std::max(x, y);
+        case ElementwiseChainOpType::SQUARED_DIFF:
+            return (x - y) * (x - y);
+        default:
+            return x;
+    }
+}
+
+inline float apply_unary(ElementwiseChainOpType type, float x)
+{
+    switch (type)
+    {
+        case ElementwiseChainOpType::EXP:
+            return std::exp(x);
+        case ElementwiseChainOpType::NEG:
+            return -x;
+        case ElementwiseChainOpType::ABS:
+            return std::abs(x);
+        case ElementwiseChainOpType::RSQRT:
+            return 1.f / std::sqrt(x);
+        default:
+            return x;
+    }
+}
+
+inline float activate(ActivationLayerInfo::ActivationFunction act, float a, float b, float x)
+{
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+    switch (act)
+    {
+        case ActFunction::LINEAR:
+            return a * x + b;
+        case ActFunction::RELU:
+            return std::max(0.f, x);
+        case ActFunction::BOUNDED_RELU:
+            return std::min(a, std::max(0.f, x));
+        case ActFunction::LU_BOUNDED_RELU:
+            return std::min(a, std::max(b, x));
+        case ActFunction::LEAKY_RELU:
+            return x > 0.f ? x : a * x;
+        case ActFunction::LOGISTIC:
+            return 1.f / (1.f + std::exp(-x));
+        case ActFunction::TANH:
+            return a * std::tanh(b * x);
+        case ActFunction::ABS:
+            return std::abs(x);
+        case ActFunction::SQUARE:
+            return x * x;
+        case ActFunction::HARD_SWISH:
+            return x * std::min(std::max(x + 3.f, 0.f), 6.f) / 6.f;
+        case ActFunction::SWISH:
+            return x / (1.f + std::exp(-a * x));
+        case ActFunction::GELU:
+            return x * 0.5f * (1.f + std::erf(x * 0.70710678118f));
+        default:
+            return x;
+    }
+}
+
+/** Evaluate an elementwise chain
+ *
+ * Every block of @ref block_size elements is loaded once, goes through all the operations in registers and is stored
+ * once, so the intermediate values of the chain never reach memory. The operands holding a single row are broadcast
+ * to every row of the input.
+ *
+ * @tparam T  Data type of the input and the operands
+ * @tparam TO Data type of the destination
+ */
+template <typename T, typename TO>
+void neon_elementwise_chain(const ITensor                      *src,
+                            const std::vector<const ITensor *> &operands,
+                            ITensor                            *dst,
+                            const ElementwiseChainInfo         &chain,
+                            const Window                       &window)
+{
+    const UniformQuantizationInfo dst_qinfo      = dst->info()->quantization_info().uniform();
+    const int                     window_start_x = static_cast<int>(window.x().start());
+    const int                     window_end_x   = static_cast<int>(window.x().end());
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    std::vector<const T *> operand_ptrs(operands.size(), nullptr);
+    std::vector<bool>      broadcast(operands.size(), false);
+    for (size_t i = 0; i < operands.size(); ++i)
+    {
+        broadcast[i] = operands[i]->info()->tensor_shape().total_size() != src->info()->tensor_shape().total_size();
+        if (broadcast[i])
+        {
+            operand_ptrs[i] = reinterpret_cast<const T *>(operands[i]->ptr_to_element(Coordinates()));
+        }
+    }
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const auto in  = reinterpret_cast<const T *>(src->ptr_to_element(id));
+            const auto out = reinterpret_cast<TO *>(dst->ptr_to_element(id));
+            for (size_t i = 0; i < operands.size(); ++i)
+            {
+                if (!broadcast[i])
+                {
+                    operand_ptrs[i] = reinterpret_cast<const T *>(operands[i]->ptr_to_element(id));
+                }
+            }
+
+            int x = window_start_x;
+            for (; x <= (window_end_x - block_size); x += block_size)
+            {
+                Block v;
+                load(in + x, v);
+                for (const auto &op : chain)
+                {
+                    if (is_binary_elementwise_chain_op(op.type))
+                    {
+                        Block w;
+                        load(operand_ptrs[op.operand] + x, w);
+                        for (int i = 0; i < block_regs; ++i)
+                        {
+                            v[i] = op.reversed ? apply_binary(op.type, w[i], v[i]) : apply_binary(op.type, v[i], w[i]);
+                        }
+                    }
+                    else if (op.type == ElementwiseChainOpType::ACTIVATION)
+                    {
+                        const float32x4_t a = vdupq_n_f32(op.act_info.a());
+                        const float32x4_t b = vdupq_n_f32(op.act_info.b());
+                        for (int i = 0; i < block_regs; ++i)
+                        {
+                            v[i] = activate(op.act_info.activation(), a, b, v[i]);
+                        }
+                    }
+                    else
+                    {
+                        for (int i = 0; i < block_regs; ++i)
+                        {
+                            v[i] = apply_unary(op.type, v[i]);
+                        }
+                    }
+                }
+                store(out + x, v, dst_qinfo);
+            }
+
+            // Compute left-over elements
+            for (; x < window_end_x; ++x)
+            {
+                float v = static_cast<float>(in[x]);
+                for (const auto &op : chain)
+                {
+                    if (is_binary_elementwise_chain_op(op.type))
+                    {
+                        const float w = static_cast<float>(operand_ptrs[op.operand][x]);
+                        v             = op.reversed ? apply_binary(op.type, w, v) : apply_binary(op.type, v, w);
+                    }
+                    else if (op.type == ElementwiseChainOpType::ACTIVATION)
+                    {
+                        v = activate(op.act_info.activation(), op.act_info.a(), op.act_info.b(), v);
+                    }
+                    else
+                    {
+                        v = apply_unary(op.type, v);
+                    }
+                }
+                store_scalar(out + x, v, dst_qinfo);
+            }
+        });
+}
+} // namespace elementwise_chain
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_ELEMENTWISE_CHAIN_GENERIC_NEON_IMPL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023 Arm Limited.
+ * Copyright (c) 2018-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -89,13 +89,13 @@ inline void elementwise_op(const ITensor *in, ITensor *out, const Window &window
     const auto window_start_x = static_cast<int>(window.x().start());
     const auto window_end_x   = static_cast<int>(window.x().end());
 
-    Window win = window;
+    Window win = window.collapse_if_possible(window, Window::DimZ);
     win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator input(in, win);
     Iterator output(out, win);
 
-    execute_window_loop(
+    execute_window_loop_dims<3>(
         win,
         [&](const Coordinates &)
         {
@@ -125,13 +125,13 @@ inline void elementwise_op<int8_t>(const ITensor *in, ITensor *out, const Window
     const UniformQuantizationInfo qi_out            = out->info()->quantization_info().uniform();
     const auto                    min_clamped_value = vdupq_n_f32((-128 - qi_out.offset) * qi_out.scale);
     const auto                    max_clamped_value = vdupq_n_f32((127 - qi_out.offset) * qi_out.scale);
-    Window                        win               = window;
+    Window                        win               = window.collapse_if_possible(window, Window::DimZ);
     win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator input(in, win);
     Iterator output(out, win);
 
-    execute_window_loop(
+    execute_window_loop_dims<3>(
         win,
         [&](const Coordinates &)
         {
@@ -218,13 +218,13 @@ inline void elementwise_op<uint8_t>(const ITensor *in, ITensor *out, const Windo
     const auto                    vconst_0_f32      = vdupq_n_f32(0);
     const auto                    min_clamped_value = vdupq_n_f32((0 - qi_out.offset) * qi_out.scale);
     const auto                    max_clamped_value = vdupq_n_f32((255 - qi_out.offset) * qi_out.scale);
-    Window                        win               = window;
+    Window                        win               = window.collapse_if_possible(window, Window::DimZ);
     win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator input(in, win);
     Iterator output(out, win);
 
-    execute_window_loop(
+    execute_window_loop_dims<3>(
         win,
         [&](const Coordinates &)
         {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,14 +38,14 @@ void neon_q8_elementwise_unary(
 {
     ARM_COMPUTE_UNUSED(op);
 
-    auto       win          = window;
+    auto       win          = window.collapse_if_possible(window, Window::DimZ);
     const auto window_end_x = window.x().end();
     win.set(0, Window::Dimension(0, 1, 1));
 
     Iterator src_it(in, win);
     Iterator dst_it(out, win);
 
-    execute_window_loop(
+    execute_window_loop_dims<3>(
         win,
         [&](const Coordinates &)
         {
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_EMBEDDING_BAG_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_EMBEDDING_BAG_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace embedding_bag
+{
+/** Number of rows ahead of the current one that are prefetched */
+constexpr unsigned int prefetch_distance = 4;
+/** Size in bytes of a cache line */
+constexpr unsigned int cache_line_size = 64;
+
+inline void prefetch_row(const uint8_t *row, size_t row_size)
+{
+    for (size_t offset = 0; offset < row_size; offset += cache_line_size)
+    {
+        __builtin_prefetch(row + offset);
+    }
+}
+
+inline float32x4_t multiply_add(float32x4_t acc, float32x4_t a, float32x4_t b)
+{
+#ifdef __aarch64__
+    return vfmaq_f32(acc, a, b);
+#else  // __aarch64__
+    return vmlaq_f32(acc, a, b);
+#endif // __aarch64__
+}
+
+/** Add @p weight times a table row to the fp32 accumulators
+ *
+ * Quantized rows are accumulated without their offset, which is removed once per bag when storing.
+ */
+inline void accumulate_row(const float *row, float weight, float *acc, int len)
+{
+    const float32x4_t w = vdupq_n_f32(weight);
+    int               x = 0;
+    for (; x <= len - 8; x += 8)
+    {
+        vst1q_f32(acc + x, multiply_add(vld1q_f32(acc + x), vld1q_f32(row + x), w));
+        vst1q_f32(acc + x + 4, multiply_add(vld1q_f32(acc + x + 4), vld1q_f32(row + x + 4), w));
+    }
+    for (; x < len; ++x)
+    {
+        acc[x] += row[x] * weight;
+    }
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline void accumulate_row(const float16_t *row, float weight, float *acc, int len)
+{
+    const float32x4_t w = vdupq_n_f32(weight);
+    int               x = 0;
+    for (; x <= len - 8; x += 8)
+    {
+        const float16x8_t v = vld1q_f16(row + x);
+        vst1q_f32(acc + x, multiply_add(vld1q_f32(acc + x), vcvt_f32_f16(vget_low_f16(v)), w));
+        vst1q_f32(acc + x + 4, multiply_add(vld1q_f32(acc + x + 4), vcvt_f32_f16(vget_high_f16(v)), w));
+    }
+    for (; x < len; ++x)
+    {
+        acc[x] += static_cast<float>(row[x]) * weight;
+    }
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+inline void accumulate_s16x8(int16x8_t v, float32x4_t w, float *acc)
+{
+    vst1q_f32(acc, multiply_add(vld1q_f32(acc), vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))), w));
+    vst1q_f32(acc + 4, multiply_add(vld1q_f32(acc + 4), vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))), w));
+}
+
+inline void accumulate_row(const uint8_t *row, float weight, float *acc, int len)
+{
+    const float32x4_t w = vdupq_n_f32(weight);
+    int               x = 0;
+    for (; x <= len - 16; x += 16)
+    {
+        const uint8x16_t v = vld1q_u8(row + x);
+        accumulate_s16x8(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(v))), w, acc + x);
+        accumulate_s16x8(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(v))), w, acc + x + 8);
+    }
+    for (; x < len; ++x)
+    {
+        acc[x] += static_cast<float>(row[x]) * weight;
+    }
+}
+
+inline void accumulate_row(const int8_t *row, float weight, float *acc, int len)
+{
+    const float32x4_t w = vdupq_n_f32(weight);
+    int               x = 0;
+    for (; x <= len - 16; x += 16)
+    {
+        const int8x16_t v = vld1q_s8(row + x);
+        accumulate_s16x8(vmovl_s8(vget_low_s8(v)), w, acc + x);
+        accumulate_s16x8(vmovl_s8(vget_high_s8(v)), w, acc + x + 8);
+    }
+    for (; x < len; ++x)
+    {
+        acc[x] += static_cast<float>(row[x]) * weight;
+    }
+}
+
+/** Write @p acc * @p scale + @p shift to the destination row */
+inline void store_row(const float *acc, float scale, float shift, float *dst, int len)
+{
+    const float32x4_t vscale = vdupq_n_f32(scale);
+    const float32x4_t vshift = vdupq_n_f32(shift);
+    int               x      = 0;
+    for (; x <= len - 4; x += 4)
+    {
+        vst1q_f32(dst + x, multiply_add(vshift, vld1q_f32(acc + x), vscale));
+    }
+    for (; x < len; ++x)
+    {
+        dst[x] = acc[x] * scale + shift;
+    }
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline void store_row(const float *acc, float scale, float shift, float16_t *dst, int len)
+{
+    const float32x4_t vscale = vdupq_n_f32(scale);
+    const float32x4_t vshift = vdupq_n_f32(shift);
+    int               x      = 0;
+    for (; x <= len - 4; x += 4)
+    {
+        vst1_f16(dst + x, vcvt_f16_f32(multiply_add(vshift, vld1q_f32(acc + x), vscale)));
+    }
+    for (; x < len; ++x)
+    {
+        dst[x] = static_cast<float16_t>(acc[x] * scale + shift);
+    }
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+/** Gather and pool the rows of each bag in the window
+ *
+ * Bag b pools the table rows indexed by indices[offsets[b]] up to, excluding, indices[offsets[b + 1]], or the end
+ * of @p indices for the last bag. Out of range indices contribute zero rows, as in @ref NEGatherKernel.
+ * Each row is scaled by its weight if @p weights is given, then the bag sum is divided by the number of indices
+ * with @p use_mean. The rows of the next indices are prefetched while the current one is accumulated, as the
+ * lookups are random accesses into a table much larger than the caches.
+ *
+ * @param[in] qscale  Dequantization scale of the table, 1 for floating-point tables.
+ * @param[in] qoffset Dequantization offset of the table, 0 for floating-point tables.
+ */
+template <typename T, typename TOut>
+void neon_embedding_bag(const ITensor *table,
+                        const ITensor *indices,
+                        const ITensor *offsets,
+                        const ITensor *weights,
+                        ITensor       *dst,
+                        bool           use_mean,
+                        float          qscale,
+                        float          qoffset,
+                        const Window  &window)
+{
+    const int      len         = static_cast<int>(table->info()->dimension(0));
+    const uint32_t num_rows    = static_cast<uint32_t>(table->info()->dimension(1));
+    const uint32_t num_indices = static_cast<uint32_t>(indices->info()->dimension(0));
+    const uint32_t num_bags    = static_cast<uint32_t>(offsets->info()->dimension(0));
+    const size_t   row_stride  = table->info()->strides_in_bytes()[1];
+    const size_t   row_size    = len * sizeof(T);
+
+    const uint8_t *table_ptr   = table->buffer() + table->info()->offset_first_element_in_bytes();
+    const auto    *indices_ptr = reinterpret_cast<const uint32_t *>(indices->ptr_to_element(Coordinates(0)));
+    const auto    *offsets_ptr = reinterpret_cast<const uint32_t *>(offsets->ptr_to_element(Coordinates(0)));
+    const float   *weights_ptr =
+        weights != nullptr ? reinterpret_cast<const float *>(weights->ptr_to_element(Coordinates(0))) : nullptr;
+
+    std::vector<float> acc(len);
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator dst_it(dst, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const uint32_t bag   = static_cast<uint32_t>(id.y());
+            const uint32_t begin = std::min(offsets_ptr[bag], num_indices);
+            const uint32_t end   = bag + 1 < num_bags ? std::min(offsets_ptr[bag + 1], num_indices) : num_indices;
+
+            std::fill(acc.begin(), acc.end(), 0.f);
+            float weight_sum = 0.f;
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                if (i + prefetch_distance < end && indices_ptr[i + prefetch_distance] < num_rows)
+                {
+                    prefetch_row(table_ptr + indices_ptr[i + prefetch_distance] * row_stride, row_size);
+                }
+
+                const uint32_t row = indices_ptr[i];
+                if (row < num_rows)
+                {
+                    const float weight = weights_ptr != nullptr ? weights_ptr[i] : 1.f;
+                    accumulate_row(reinterpret_cast<const T *>(table_ptr + row * row_stride), weight, acc.data(), len);
+                    weight_sum += weight;
+                }
+            }
+
+            // dst = qscale * (acc - qoffset * weight_sum) / count
+            const uint32_t count = end > begin ? end - begin : 1;
+            const float    scale = use_mean ? qscale / count : qscale;
+            store_row(acc.data(), scale, -qoffset * weight_sum * scale, reinterpret_cast<TOut *>(dst_it.ptr()), len);
+        },
+        dst_it);
+}
+} // namespace embedding_bag
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_EMBEDDING_BAG_GENERIC_NEON_IMPL_H
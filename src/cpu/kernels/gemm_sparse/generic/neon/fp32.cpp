@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/gemm_sparse/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_gemm_sparse_matrix_mul(const ITensor *lhs,
+                                      const ITensor *rhs_values,
+                                      const ITensor *rhs_metadata,
+                                      const ITensor *bias,
+                                      ITensor       *dst,
+                                      float          alpha,
+                                      const Window  &window)
+{
+    return sparse::neon_gemm_sparse_matrix_mul<float>(lhs, rhs_values, rhs_metadata, bias, dst, alpha, window);
+}
+
+void neon_fp32_gemv_block_sparse(const ITensor *src,
+                                 const ITensor *values,
+                                 const ITensor *columns,
+                                 const ITensor *offsets,
+                                 const ITensor *bias,
+                                 ITensor       *dst,
+                                 const Window  &window)
+{
+    return sparse::neon_gemv_block_sparse<float>(src, values, columns, offsets, bias, dst, window);
+}
+} // namespace cpu
+} // namespace arm_compute
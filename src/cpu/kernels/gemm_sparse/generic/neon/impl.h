@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_GEMM_SPARSE_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_GEMM_SPARSE_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <array>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace sparse
+{
+/** Number of output columns sharing a block of the compressed matrix B */
+constexpr unsigned int block_outputs = 4;
+/** Number of rows of B, i.e. activations, out of which each column keeps 2 values */
+constexpr unsigned int group_depth = 4;
+/** Number of consecutive activations multiplied by a block of the block-sparse weights */
+constexpr unsigned int block_depth = 4;
+
+/** Byte shuffle moving, into each lane, the activation selected by the 2-bit field of that lane in @p metadata */
+inline const uint8_t *gather_indices(uint8_t metadata)
+{
+    static const auto table = []()
+    {
+        std::array<std::array<uint8_t, 16>, 256> t{};
+        for (unsigned int m = 0; m < 256; ++m)
+        {
+            for (unsigned int lane = 0; lane < 4; ++lane)
+            {
+                const unsigned int k = (m >> (2 * lane)) & 0x3;
+                for (unsigned int b = 0; b < 4; ++b)
+                {
+                    t[m][4 * lane + b] = static_cast<uint8_t>(4 * k + b);
+                }
+            }
+        }
+        return t;
+    }();
+    return table[metadata].data();
+}
+
+/** Pick, for each lane, one of the four activations of @p a as encoded by @p indices */
+inline float32x4_t gather_activations(float32x4_t a, const uint8_t *indices)
+{
+#ifdef __aarch64__
+    return vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(a), vld1q_u8(indices)));
+#else  // __aarch64__
+    const uint8x16_t  bytes = vreinterpretq_u8_f32(a);
+    const uint8x8x2_t table = {{vget_low_u8(bytes), vget_high_u8(bytes)}};
+    return vreinterpretq_f32_u8(vcombine_u8(vtbl2_u8(table, vld1_u8(indices)), vtbl2_u8(table, vld1_u8(indices + 8))));
+#endif // __aarch64__
+}
+
+// The accumulation is always done in fp32
+inline float32x4_t load_f32x4(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+inline void store_f32x4(float *ptr, float32x4_t v)
+{
+    vst1q_f32(ptr, v);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline float32x4_t load_f32x4(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline void store_f32x4(float16_t *ptr, float32x4_t v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+inline float32x4_t multiply_add(float32x4_t acc, float32x4_t a, float32x4_t b)
+{
+#ifdef __aarch64__
+    return vfmaq_f32(acc, a, b);
+#else  // __aarch64__
+    return vmlaq_f32(acc, a, b);
+#endif // __aarch64__
+}
+
+inline float reduce_add(float32x4_t v)
+{
+#ifdef __aarch64__
+    return vaddvq_f32(v);
+#else  // __aarch64__
+    const float32x2_t r = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpadd_f32(r, r), 0);
+#endif // __aarch64__
+}
+
+/** Offset in bytes of a row, with all the dimensions of @p info above the first one flattened into rows */
+inline size_t row_offset(const ITensorInfo &info, size_t row)
+{
+    size_t offset = info.offset_first_element_in_bytes();
+    for (size_t d = 1; d < info.num_dimensions(); ++d)
+    {
+        offset += (row % info.dimension(d)) * info.strides_in_bytes()[d];
+        row /= info.dimension(d);
+    }
+    return offset;
+}
+
+/** Sparse GEMM: dst = alpha * lhs * B + bias, with B given by its non-zero values and their metadata
+ *
+ * Each group of 4 activations is loaded once into a register, then each of the two taps of the group gathers the
+ * activations matching its values with a single table lookup before the multiply-accumulate.
+ */
+template <typename T>
+void neon_gemm_sparse_matrix_mul(const ITensor *lhs,
+                                 const ITensor *rhs_values,
+                                 const ITensor *rhs_metadata,
+                                 const ITensor *bias,
+                                 ITensor       *dst,
+                                 float          alpha,
+                                 const Window  &window)
+{
+    const unsigned int depth       = lhs->info()->dimension(0);
+    const unsigned int n           = dst->info()->dimension(0);
+    const unsigned int num_groups  = rhs_metadata->info()->dimension(0) / 2;
+    const unsigned int full_groups = depth / group_depth;
+
+    const uint8_t *values_ptr      = rhs_values->buffer() + rhs_values->info()->offset_first_element_in_bytes();
+    const size_t   values_stride   = rhs_values->info()->strides_in_bytes().y();
+    const uint8_t *metadata_ptr    = rhs_metadata->buffer() + rhs_metadata->info()->offset_first_element_in_bytes();
+    const size_t   metadata_stride = rhs_metadata->info()->strides_in_bytes().y();
+    const T       *bias_ptr =
+        bias != nullptr ? reinterpret_cast<const T *>(bias->buffer() + bias->info()->offset_first_element_in_bytes())
+                        : nullptr;
+
+    for (int row = window.y().start(); row < window.y().end(); ++row)
+    {
+        const auto *a   = reinterpret_cast<const T *>(lhs->buffer() + row_offset(*lhs->info(), row));
+        auto       *out = reinterpret_cast<T *>(dst->buffer() + row_offset(*dst->info(), row));
+
+        // The last group is partial when K is not a multiple of 4, it is read from a zero padded copy
+        T a_tail[group_depth] = {};
+        std::copy(a + full_groups * group_depth, a + depth, a_tail);
+
+        for (unsigned int x = window.x().start(); x < static_cast<unsigned int>(window.x().end()); x += block_outputs)
+        {
+            const auto    *v    = reinterpret_cast<const T *>(values_ptr + (x / block_outputs) * values_stride);
+            const uint8_t *meta = metadata_ptr + (x / block_outputs) * metadata_stride;
+
+            // One accumulator per tap so that consecutive multiply-accumulates do not depend on each other
+            float32x4_t acc0 = vdupq_n_f32(0.f);
+            float32x4_t acc1 = vdupq_n_f32(0.f);
+            for (unsigned int g = 0; g < num_groups; ++g)
+            {
+                const float32x4_t ag = load_f32x4(g < full_groups ? a + g * group_depth : a_tail);
+                acc0 = multiply_add(acc0, load_f32x4(v + 8 * g), gather_activations(ag, gather_indices(meta[2 * g])));
+                acc1 = multiply_add(acc1, load_f32x4(v + 8 * g + 4),
+                                    gather_activations(ag, gather_indices(meta[2 * g + 1])));
+            }
+
+            const float32x4_t  res   = vmulq_n_f32(vaddq_f32(acc0, acc1), alpha);
+            const unsigned int valid = std::min(block_outputs, n - x);
+            if (valid == block_outputs)
+            {
+                store_f32x4(out + x, bias_ptr != nullptr ? vaddq_f32(res, load_f32x4(bias_ptr + x)) : res);
+            }
+            else
+            {
+                float tmp[block_outputs];
+                vst1q_f32(tmp, res);
+                for (unsigned int i = 0; i < valid; ++i)
+                {
+                    out[x + i] =
+                        static_cast<T>(tmp[i] + (bias_ptr != nullptr ? static_cast<float>(bias_ptr[x + i]) : 0.f));
+                }
+            }
+        }
+    }
+}
+
+/** Block-sparse GEMV: dst = src * B + bias, with each column of B stored as its non-zero blocks of 4 rows
+ *
+ * Each window step along X is a chunk of consecutive outputs holding about as much work as the other chunks, so the
+ * threads stay balanced however the non-zero weights are spread across the outputs.
+ */
+template <typename T>
+void neon_gemv_block_sparse(const ITensor *src,
+                            const ITensor *values,
+                            const ITensor *columns,
+                            const ITensor *offsets,
+                            const ITensor *bias,
+                            ITensor       *dst,
+                            const Window  &window)
+{
+    const unsigned int depth       = src->info()->dimension(0);
+    const unsigned int full_blocks = depth / block_depth;
+
+    const auto *a   = reinterpret_cast<const T *>(src->buffer() + src->info()->offset_first_element_in_bytes());
+    const auto *v   = reinterpret_cast<const T *>(values->buffer() + values->info()->offset_first_element_in_bytes());
+    const auto *col = reinterpret_cast<const uint16_t *>(columns->buffer() +
+                                                         columns->info()->offset_first_element_in_bytes());
+    const auto *rows =
+        reinterpret_cast<const int32_t *>(offsets->buffer() + offsets->info()->offset_first_element_in_bytes());
+    const auto *chunks = rows + dst->info()->dimension(0) + 1;
+    const T *bias_ptr =
+        bias != nullptr ? reinterpret_cast<const T *>(bias->buffer() + bias->info()->offset_first_element_in_bytes())
+                        : nullptr;
+    auto *out = reinterpret_cast<T *>(dst->buffer() + dst->info()->offset_first_element_in_bytes());
+
+    // The last block is partial when K is not a multiple of 4, it is read from a zero padded copy
+    T a_tail[block_depth] = {};
+    std::copy(a + full_blocks * block_depth, a + depth, a_tail);
+    const auto block_src = [&](uint16_t block) { return block < full_blocks ? a + block * block_depth : a_tail; };
+
+    for (int c = window.x().start(); c < window.x().end(); ++c)
+    {
+        for (int32_t n = chunks[c]; n < chunks[c + 1]; ++n)
+        {
+            // Two accumulators so that consecutive multiply-accumulates do not depend on each other
+            float32x4_t acc0 = vdupq_n_f32(0.f);
+            float32x4_t acc1 = vdupq_n_f32(0.f);
+            int32_t     b    = rows[n];
+            for (; b + 1 < rows[n + 1]; b += 2)
+            {
+                acc0 = multiply_add(acc0, load_f32x4(v + b * block_depth), load_f32x4(block_src(col[b])));
+                acc1 = multiply_add(acc1, load_f32x4(v + (b + 1) * block_depth), load_f32x4(block_src(col[b + 1])));
+            }
+            if (b < rows[n + 1])
+            {
+                acc0 = multiply_add(acc0, load_f32x4(v + b * block_depth), load_f32x4(block_src(col[b])));
+            }
+
+            const float res = reduce_add(vaddq_f32(acc0, acc1));
+            out[n]          = static_cast<T>(bias_ptr != nullptr ? res + static_cast<float>(bias_ptr[n]) : res);
+        }
+    }
+}
+} // namespace sparse
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_GEMM_SPARSE_GENERIC_NEON_IMPL_H
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_GEMM_SPARSE_LIST_H
+#define ACL_SRC_CPU_KERNELS_GEMM_SPARSE_LIST_H
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_GEMM_SPARSE_MATRIX_MUL_KERNEL(func_name)                                                     \
+    void func_name(const ITensor *lhs, const ITensor *rhs_values, const ITensor *rhs_metadata, const ITensor *bias, \
+                   ITensor *dst, float alpha, const Window &window)
+
+DECLARE_GEMM_SPARSE_MATRIX_MUL_KERNEL(neon_fp32_gemm_sparse_matrix_mul);
+DECLARE_GEMM_SPARSE_MATRIX_MUL_KERNEL(neon_fp16_gemm_sparse_matrix_mul);
+
+#undef DECLARE_GEMM_SPARSE_MATRIX_MUL_KERNEL
+
+#define DECLARE_GEMV_BLOCK_SPARSE_KERNEL(func_name)                                                            \
+    void func_name(const ITensor *src, const ITensor *values, const ITensor *columns, const ITensor *offsets, \
+                   const ITensor *bias, ITensor *dst, const Window &window)
+
+DECLARE_GEMV_BLOCK_SPARSE_KERNEL(neon_fp32_gemv_block_sparse);
+DECLARE_GEMV_BLOCK_SPARSE_KERNEL(neon_fp16_gemv_block_sparse);
+
+#undef DECLARE_GEMV_BLOCK_SPARSE_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_GEMM_SPARSE_LIST_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,8 @@
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/cpu/kernels/instancenorm/generic/neon/impl.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace cpu
@@ -175,6 +177,163 @@ void instance_normalization_nchw_fp16(
         },
         input_it);
 }
+
+inline float16x8_t load_channels_fp16(const float16_t *ptr, float16_t)
+{
+    return wrapper::vloadq(ptr);
+}
+
+inline float32x4_t load_channels_fp16(const float16_t *ptr, float)
+{
+    return wrapper::vcvt<float>(wrapper::vload(ptr));
+}
+
+inline void store_channels_fp16(float16_t *ptr, const float16x8_t &value)
+{
+    wrapper::vstore(ptr, value);
+}
+
+inline void store_channels_fp16(float16_t *ptr, const float32x4_t &value)
+{
+    wrapper::vstore(ptr, wrapper::vcvt<float16_t>(value));
+}
+
+template <typename AccType>
+void instance_normalization_nhwc_fp16(
+    const ITensor *input, ITensor *output, float gamma, float beta, float epsilon, const Window &window)
+{
+    /** SIMD vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<AccType, wrapper::traits::BitWidth::W128>;
+    using VectorType   = typename wrapper::traits::neon_bitvector<AccType, wrapper::traits::BitWidth::W128>::type;
+
+    constexpr int window_step_x   = 16 / sizeof(AccType);
+    constexpr int max_block_size  = 32;
+    constexpr int max_num_vectors = max_block_size / window_step_x;
+
+    // The channels are handled in blocks of the window step along X, each block being reduced over the plane with
+    // its sums kept in registers before the plane is normalized in a second sweep.
+    const int block_size = window.x().step();
+    ARM_COMPUTE_ERROR_ON(block_size > max_block_size);
+
+    const int          num_channels   = input->info()->dimension(0);
+    const int          width          = input->info()->dimension(1);
+    const int          height         = input->info()->dimension(2);
+    const size_t       in_stride_y    = input->info()->strides_in_bytes().y();
+    const size_t       in_stride_z    = input->info()->strides_in_bytes().z();
+    const size_t       out_stride_y   = output->info()->strides_in_bytes().y();
+    const size_t       out_stride_z   = output->info()->strides_in_bytes().z();
+    const unsigned int elements_plane = width * height;
+    const int          window_end_x   = std::min(static_cast<int>(window.x().end()), num_channels);
+
+    // Sums and statistics of the channels of a block
+    VectorType vec_sum[max_num_vectors];
+    VectorType vec_sum_squares[max_num_vectors];
+    VectorType vec_mean[max_num_vectors];
+    VectorType vec_multip[max_num_vectors];
+    AccType    sum_left_over[window_step_x];
+    AccType    sum_squares_left_over[window_step_x];
+    AccType    mean[max_block_size];
+    AccType    multip[max_block_size];
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input_it(input, win);
+    Iterator output_it(output, win);
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            for (int c = window.x().start(); c < window_end_x; c += block_size)
+            {
+                const int num_block_channels = std::min(block_size, window_end_x - c);
+                const int num_vectors        = num_block_channels / window_step_x;
+                const int num_left_over      = num_block_channels - num_vectors * window_step_x;
+
+                for (int x = 0; x < num_left_over; ++x)
+                {
+                    sum_left_over[x]         = static_cast<AccType>(0.f);
+                    sum_squares_left_over[x] = static_cast<AccType>(0.f);
+                }
+                for (int v = 0; v < num_vectors; ++v)
+                {
+                    vec_sum[v]         = wrapper::vdup_n(static_cast<AccType>(0.f), ExactTagType{});
+                    vec_sum_squares[v] = wrapper::vdup_n(static_cast<AccType>(0.f), ExactTagType{});
+                }
+
+                for (int h = 0; h < height; ++h)
+                {
+                    for (int w = 0; w < width; ++w)
+                    {
+                        const auto input_ptr = reinterpret_cast<const float16_t *>(input_it.ptr() + w * in_stride_y +
+                                                                                    h * in_stride_z) +
+                                               c;
+                        for (int v = 0; v < num_vectors; ++v)
+                        {
+                            vector_float_sum_fp16(vec_sum[v], vec_sum_squares[v],
+                                                  load_channels_fp16(input_ptr + v * window_step_x, AccType{}));
+                        }
+                        for (int x = 0; x < num_left_over; ++x)
+                        {
+                            const auto value = static_cast<AccType>(input_ptr[num_vectors * window_step_x + x]);
+                            sum_left_over[x] += value;
+                            sum_squares_left_over[x] += value * value;
+                        }
+                    }
+                }
+
+                // Turn the sums of each channel into its mean and multiplier
+                for (int v = 0; v < num_vectors; ++v)
+                {
+                    wrapper::vstore(mean + v * window_step_x, vec_sum[v]);
+                    wrapper::vstore(multip + v * window_step_x, vec_sum_squares[v]);
+                }
+                for (int x = 0; x < num_left_over; ++x)
+                {
+                    mean[num_vectors * window_step_x + x]   = sum_left_over[x];
+                    multip[num_vectors * window_step_x + x] = sum_squares_left_over[x];
+                }
+                for (int x = 0; x < num_block_channels; ++x)
+                {
+                    const auto mean_h_w = mean[x] / elements_plane;
+                    const auto var_h_w  = multip[x] / elements_plane - mean_h_w * mean_h_w;
+                    mean[x]             = mean_h_w;
+                    multip[x]           = gamma / std::sqrt(var_h_w + epsilon);
+                }
+
+                for (int v = 0; v < num_vectors; ++v)
+                {
+                    vec_mean[v]   = wrapper::vloadq(mean + v * window_step_x);
+                    vec_multip[v] = wrapper::vloadq(multip + v * window_step_x);
+                }
+                const auto vec_beta = wrapper::vdup_n(static_cast<AccType>(beta), ExactTagType{});
+
+                for (int h = 0; h < height; ++h)
+                {
+                    for (int w = 0; w < width; ++w)
+                    {
+                        const auto input_ptr = reinterpret_cast<const float16_t *>(input_it.ptr() + w * in_stride_y +
+                                                                                    h * in_stride_z) +
+                                               c;
+                        const auto output_ptr =
+                            reinterpret_cast<float16_t *>(output_it.ptr() + w * out_stride_y + h * out_stride_z) + c;
+                        for (int v = 0; v < num_vectors; ++v)
+                        {
+                            const auto vec_val = load_channels_fp16(input_ptr + v * window_step_x, AccType{});
+                            store_channels_fp16(output_ptr + v * window_step_x,
+                                                vector_float_norm_fp16(vec_val, vec_mean[v], vec_multip[v], vec_beta));
+                        }
+                        for (int x = num_vectors * window_step_x; x < num_block_channels; ++x)
+                        {
+                            const auto val = static_cast<AccType>(input_ptr[x]);
+                            output_ptr[x]  = static_cast<float16_t>((val - mean[x]) * multip[x] + beta);
+                        }
+                    }
+                }
+            }
+        },
+        input_it, output_it);
+}
 } // namespace
 
 void neon_fp16_instancenorm(ITensor      *input,
@@ -185,6 +344,14 @@ void neon_fp16_instancenorm(ITensor      *input,
                             bool          use_mixed_precision,
                             const Window &window)
 {
+    if (input->info()->data_layout() == DataLayout::NHWC)
+    {
+        if (use_mixed_precision)
+        {
+            return instance_normalization_nhwc_fp16<float>(input, output, gamma, beta, epsilon, window);
+        }
+        return instance_normalization_nhwc_fp16<float16_t>(input, output, gamma, beta, epsilon, window);
+    }
     if (use_mixed_precision)
     {
         return instance_normalization_nchw_fp16<float>(input, output, gamma, beta, epsilon, window);
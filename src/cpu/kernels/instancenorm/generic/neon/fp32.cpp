@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,10 @@ void neon_fp32_instancenorm(ITensor      *input,
                             const Window &window)
 {
     ARM_COMPUTE_UNUSED(use_mixed_precision);
+    if (input->info()->data_layout() == DataLayout::NHWC)
+    {
+        return instance_normalization_nhwc<float>(input, output, gamma, beta, epsilon, window);
+    }
     return instance_normalization_nchw<float>(input, output, gamma, beta, epsilon, window);
 }
 } // namespace cpu
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023 Arm Limited.
+ * Copyright (c) 2019-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,8 @@
 
 #include "src/core/NEON/wrapper/wrapper.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 class ITensor;
@@ -150,7 +152,145 @@ void instance_normalization_nchw(
         input_it);
 }
 
+template <typename T, typename AccType>
+void instance_normalization_nhwc(
+    ITensor *input, ITensor *output, float gamma, float beta, float epsilon, const Window &window)
+{
+    /** SIMD vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+    using VectorType   = typename wrapper::traits::neon_bitvector<AccType, wrapper::traits::BitWidth::W128>::type;
+
+    constexpr int window_step_x   = 16 / sizeof(T);
+    constexpr int max_num_vectors = 4;
+
+    // The channels are handled in blocks of the window step along X, each block being reduced over the plane with
+    // its sums kept in registers before the plane is normalized in a second sweep.
+    const int block_size = window.x().step();
+    ARM_COMPUTE_ERROR_ON(block_size > max_num_vectors * window_step_x);
+
+    const int          num_channels   = input->info()->dimension(0);
+    const int          width          = input->info()->dimension(1);
+    const int          height         = input->info()->dimension(2);
+    const size_t       in_stride_y    = input->info()->strides_in_bytes().y();
+    const size_t       in_stride_z    = input->info()->strides_in_bytes().z();
+    const size_t       out_stride_y   = output->info()->strides_in_bytes().y();
+    const size_t       out_stride_z   = output->info()->strides_in_bytes().z();
+    const unsigned int elements_plane = width * height;
+    const int          window_end_x   = std::min(static_cast<int>(window.x().end()), num_channels);
+
+    // Sums and statistics of the channels of a block
+    VectorType vec_sum[max_num_vectors];
+    VectorType vec_sum_squares[max_num_vectors];
+    VectorType vec_mean[max_num_vectors];
+    VectorType vec_multip[max_num_vectors];
+    AccType    sum_left_over[window_step_x];
+    AccType    sum_squares_left_over[window_step_x];
+    AccType    mean[max_num_vectors * window_step_x];
+    AccType    multip[max_num_vectors * window_step_x];
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input_it(input, win);
+    Iterator output_it(output, win);
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            for (int c = window.x().start(); c < window_end_x; c += block_size)
+            {
+                const int num_block_channels = std::min(block_size, window_end_x - c);
+                const int num_vectors        = num_block_channels / window_step_x;
+                const int num_left_over      = num_block_channels - num_vectors * window_step_x;
+
+                for (int x = 0; x < num_left_over; ++x)
+                {
+                    sum_left_over[x]         = static_cast<AccType>(0.f);
+                    sum_squares_left_over[x] = static_cast<AccType>(0.f);
+                }
+                for (int v = 0; v < num_vectors; ++v)
+                {
+                    vec_sum[v]         = wrapper::vdup_n(static_cast<AccType>(0.f), ExactTagType{});
+                    vec_sum_squares[v] = wrapper::vdup_n(static_cast<AccType>(0.f), ExactTagType{});
+                }
+
+                for (int h = 0; h < height; ++h)
+                {
+                    for (int w = 0; w < width; ++w)
+                    {
+                        const auto input_ptr = reinterpret_cast<const T *>(input_it.ptr() + w * in_stride_y +
+                                                                            h * in_stride_z) +
+                                               c;
+                        for (int v = 0; v < num_vectors; ++v)
+                        {
+                            vector_float_sum(vec_sum[v], vec_sum_squares[v],
+                                             wrapper::vloadq(input_ptr + v * window_step_x));
+                        }
+                        for (int x = 0; x < num_left_over; ++x)
+                        {
+                            const auto value = static_cast<AccType>(input_ptr[num_vectors * window_step_x + x]);
+                            sum_left_over[x] += value;
+                            sum_squares_left_over[x] += value * value;
+                        }
+                    }
+                }
+
+                // Turn the sums of each channel into its mean and multiplier
+                for (int v = 0; v < num_vectors; ++v)
+                {
+                    wrapper::vstore(mean + v * window_step_x, vec_sum[v]);
+                    wrapper::vstore(multip + v * window_step_x, vec_sum_squares[v]);
+                }
+                for (int x = 0; x < num_left_over; ++x)
+                {
+                    mean[num_vectors * window_step_x + x]   = sum_left_over[x];
+                    multip[num_vectors * window_step_x + x] = sum_squares_left_over[x];
+                }
+                for (int x = 0; x < num_block_channels; ++x)
+                {
+                    const auto mean_h_w = mean[x] / elements_plane;
+                    const auto var_h_w  = multip[x] / elements_plane - mean_h_w * mean_h_w;
+                    mean[x]             = mean_h_w;
+                    multip[x]           = gamma / std::sqrt(var_h_w + epsilon);
+                }
+
+                for (int v = 0; v < num_vectors; ++v)
+                {
+                    vec_mean[v]   = wrapper::vloadq(mean + v * window_step_x);
+                    vec_multip[v] = wrapper::vloadq(multip + v * window_step_x);
+                }
+                const auto vec_beta = wrapper::vdup_n(static_cast<AccType>(beta), ExactTagType{});
+
+                for (int h = 0; h < height; ++h)
+                {
+                    for (int w = 0; w < width; ++w)
+                    {
+                        const auto input_ptr = reinterpret_cast<const T *>(input_it.ptr() + w * in_stride_y +
+                                                                            h * in_stride_z) +
+                                               c;
+                        const auto output_ptr =
+                            reinterpret_cast<T *>(output_it.ptr() + w * out_stride_y + h * out_stride_z) + c;
+                        for (int v = 0; v < num_vectors; ++v)
+                        {
+                            const auto vec_val = wrapper::vloadq(input_ptr + v * window_step_x);
+                            wrapper::vstore(output_ptr + v * window_step_x,
+                                            vector_float_norm(vec_val, vec_mean[v], vec_multip[v], vec_beta));
+                        }
+                        for (int x = num_vectors * window_step_x; x < num_block_channels; ++x)
+                        {
+                            const auto val = static_cast<AccType>(input_ptr[x]);
+                            output_ptr[x]  = static_cast<T>((val - mean[x]) * multip[x] + beta);
+                        }
+                    }
+                }
+            }
+        },
+        input_it, output_it);
+}
+
 template void instance_normalization_nchw<float>(
     ITensor *input, ITensor *output, float gamma, float beta, float epsilon, const Window &window);
+template void instance_normalization_nhwc<float>(
+    ITensor *input, ITensor *output, float gamma, float beta, float epsilon, const Window &window);
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,10 @@ template <typename T, typename AccType = T>
 void instance_normalization_nchw(
     ITensor *input, ITensor *output, float gamma, float beta, float epsilon, const Window &window);
 
+template <typename T, typename AccType = T>
+void instance_normalization_nhwc(
+    ITensor *input, ITensor *output, float gamma, float beta, float epsilon, const Window &window);
+
 template <typename InputType, typename AccType = InputType>
 void vector_float_sum(AccType &result, AccType &result_square, const InputType &inputs);
 
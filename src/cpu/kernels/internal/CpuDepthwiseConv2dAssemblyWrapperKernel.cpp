@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -85,6 +85,7 @@ void create_arm_dwc(const ITensorInfo                                      *src,
     arm_conv::depthwise::DepthwiseArgs args(&cpu_info, kernel_rows, kernel_cols, stride_rows, stride_cols,
                                             dilation_rows, dilation_cols, n_batches, src_rows, src_cols, n_channels,
                                             dst_rows, dst_cols, info.depth_multiplier, padding, activation, nullptr);
+    args.fast_mode = info.enable_fast_math;
 
     // Configure assembly pooling kernel
     auto dwc_kernel_asm = arm_conv::depthwise::depthwise<TSrc, TWeights, TDst>(args);
@@ -349,12 +350,17 @@ void CpuDepthwiseConv2dAssemblyWrapperKernel::run_op(ITensorPack &tensors, const
     const auto src_padding = src->info()->padding();
     const auto dst_padding = dst->info()->padding();
 
+    // Sub-tensors of a subset of the rows keep the batch stride of their parent
     const size_t ld_src_col   = src_shape[0] + src_padding.left + src_padding.right;
     const size_t ld_src_row   = ld_src_col * (src_shape[1] + src_padding.top + src_padding.bottom);
-    const size_t ld_src_batch = ld_src_row * src_shape[2];
+    const size_t ld_src_batch = src->info()->num_dimensions() > 3
+                                    ? src->info()->strides_in_bytes()[3] / src->info()->element_size()
+                                    : ld_src_row * src_shape[2];
     const size_t ld_dst_col   = dst_shape[0] + dst_padding.left + dst_padding.right;
     const size_t ld_dst_row   = ld_dst_col * (dst_shape[1] + dst_padding.top + dst_padding.bottom);
-    const size_t ld_dst_batch = ld_dst_row * dst_shape[2];
+    const size_t ld_dst_batch = dst->info()->num_dimensions() > 3
+                                    ? dst->info()->strides_in_bytes()[3] / dst->info()->element_size()
+                                    : ld_dst_row * dst_shape[2];
 
     _kernel_asm->execute(src_ptr, ld_src_col, ld_src_row, ld_src_batch, parameters_ptr, dst_ptr, ld_dst_col, ld_dst_row,
                          ld_dst_batch, working_space, info.thread_id, info.num_threads);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -44,6 +44,20 @@ void neon_fp16_l2_normalize_yz(
 {
     return l2_normalize_yz<float16_t, 8>(in, sum, out, epsilon, window, axis);
 }
+
+void neon_fp16_l2_normalize_fused_x(
+    const ITensor *in, const ITensor *unused_sum, ITensor *out, float epsilon, const Window &window, size_t unused_axis)
+{
+    ARM_COMPUTE_UNUSED(unused_sum, unused_axis);
+    return l2_normalize_fused_x<float16_t, 8>(in, out, epsilon, window);
+}
+
+void neon_fp16_l2_normalize_fused_yz(
+    const ITensor *in, const ITensor *unused_sum, ITensor *out, float epsilon, const Window &window, size_t axis)
+{
+    ARM_COMPUTE_UNUSED(unused_sum);
+    return l2_normalize_fused_yz<float16_t, 8>(in, out, epsilon, window, axis);
+}
 } // namespace cpu
 } // namespace arm_compute
 #endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,5 +43,19 @@ void neon_fp32_l2_normalize_yz(
     return l2_normalize_yz<float, 4>(in, sum, out, epsilon, window, axis);
 }
 
+void neon_fp32_l2_normalize_fused_x(
+    const ITensor *in, const ITensor *unused_sum, ITensor *out, float epsilon, const Window &window, size_t unused_axis)
+{
+    ARM_COMPUTE_UNUSED(unused_sum, unused_axis);
+    return l2_normalize_fused_x<float, 4>(in, out, epsilon, window);
+}
+
+void neon_fp32_l2_normalize_fused_yz(
+    const ITensor *in, const ITensor *unused_sum, ITensor *out, float epsilon, const Window &window, size_t axis)
+{
+    ARM_COMPUTE_UNUSED(unused_sum);
+    return l2_normalize_fused_yz<float, 4>(in, out, epsilon, window, axis);
+}
+
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -126,6 +126,171 @@ void l2_normalize_yz(
         },
         input_it, sum_it, output_it);
 }
+
+template <typename T, int S>
+void l2_normalize_fused_x(const ITensor *in, ITensor *out, float epsilon, const Window &window)
+{
+    using ExactTagType = typename wrapper::traits::neon_vector<T, S>::tag_type;
+
+    // The rows are not split along X, each of them being reduced and then scaled while it is in the cache
+    const int window_step_x = 16 / data_size_from_type(in->info()->data_type());
+    const int row_size      = static_cast<int>(in->info()->dimension(0));
+
+    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input_it(in, win_collapsed);
+    Iterator output_it(out, win_collapsed);
+
+    execute_window_loop(
+        win_collapsed,
+        [&](const Coordinates &)
+        {
+            const auto in_ptr  = reinterpret_cast<const T *>(input_it.ptr());
+            const auto out_ptr = reinterpret_cast<T *>(output_it.ptr());
+
+            // Compute the sum of squares over vector steps
+            auto vec_sum = wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{});
+            int  x       = 0;
+            for (; x <= (row_size - window_step_x); x += window_step_x)
+            {
+                const auto vec_in = wrapper::vloadq(in_ptr + x);
+                vec_sum           = wrapper::vadd(vec_sum, wrapper::vmul(vec_in, vec_in));
+            }
+            auto carry_sum = wrapper::vpadd(wrapper::vgethigh(vec_sum), wrapper::vgetlow(vec_sum));
+            for (int i = 0; i < S / 4; ++i)
+            {
+                carry_sum = wrapper::vpadd(carry_sum, carry_sum);
+            }
+            T sum_value = wrapper::vgetlane(carry_sum, 0);
+
+            // Compute the sum of squares of the left-over elements
+            for (; x < row_size; ++x)
+            {
+                sum_value += in_ptr[x] * in_ptr[x];
+            }
+
+            const T    norm_value     = static_cast<T>(1.f) / std::sqrt(std::max(sum_value, static_cast<T>(epsilon)));
+            const auto vec_norm_value = wrapper::vdup_n(norm_value, ExactTagType{});
+
+            // Compute elements over vector steps
+            x = 0;
+            for (; x <= (row_size - window_step_x); x += window_step_x)
+            {
+                wrapper::vstore(out_ptr + x, wrapper::vmul(wrapper::vloadq(in_ptr + x), vec_norm_value));
+            }
+
+            // Compute left-over elements
+            for (; x < row_size; ++x)
+            {
+                out_ptr[x] = in_ptr[x] * norm_value;
+            }
+        },
+        input_it, output_it);
+}
+
+/** Normalize N vectors of columns along the reduction axis, their sums of squares being kept in registers */
+template <typename T, int S, int N>
+void l2_normalize_fused_columns(const T *in_ptr,
+                                T       *out_ptr,
+                                int      axis_size,
+                                size_t   in_stride_axis,
+                                size_t   out_stride_axis,
+                                float    epsilon)
+{
+    using ExactTagType = typename wrapper::traits::neon_vector<T, S>::tag_type;
+    using VectorType   = typename wrapper::traits::neon_vector<T, S>::type;
+
+    VectorType vec_sum[N];
+    for (int v = 0; v < N; ++v)
+    {
+        vec_sum[v] = wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{});
+    }
+    for (int i = 0; i < axis_size; ++i)
+    {
+        const auto ptr = reinterpret_cast<const T *>(reinterpret_cast<const uint8_t *>(in_ptr) + i * in_stride_axis);
+        for (int v = 0; v < N; ++v)
+        {
+            const auto vec_in = wrapper::vloadq(ptr + v * S);
+            vec_sum[v]        = wrapper::vadd(vec_sum[v], wrapper::vmul(vec_in, vec_in));
+        }
+    }
+
+    const auto vec_eps = wrapper::vdup_n(static_cast<T>(epsilon), ExactTagType{});
+    for (int v = 0; v < N; ++v)
+    {
+        vec_sum[v] = wrapper::vinvsqrt(wrapper::vmax(vec_sum[v], vec_eps));
+    }
+    for (int i = 0; i < axis_size; ++i)
+    {
+        const auto src = reinterpret_cast<const T *>(reinterpret_cast<const uint8_t *>(in_ptr) + i * in_stride_axis);
+        const auto dst = reinterpret_cast<T *>(reinterpret_cast<uint8_t *>(out_ptr) + i * out_stride_axis);
+        for (int v = 0; v < N; ++v)
+        {
+            wrapper::vstore(dst + v * S, wrapper::vmul(wrapper::vloadq(src + v * S), vec_sum[v]));
+        }
+    }
+}
+
+template <typename T, int S>
+void l2_normalize_fused_yz(const ITensor *in, ITensor *out, float epsilon, const Window &window, size_t axis)
+{
+    // Number of vectors of columns reduced together, so that a cache line is fully used on each step along the axis
+    constexpr int num_vectors = 4;
+
+    const int  window_step_x   = 16 / data_size_from_type(in->info()->data_type());
+    const auto window_start_x  = static_cast<int>(window.x().start());
+    const auto window_end_x    = static_cast<int>(window.x().end());
+    const int  axis_size       = static_cast<int>(in->info()->dimension(axis));
+    const auto in_stride_axis  = in->info()->strides_in_bytes()[axis];
+    const auto out_stride_axis = out->info()->strides_in_bytes()[axis];
+
+    // The reduction axis is not split, the columns being reduced and then scaled along it
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(axis, Window::Dimension(0, 1, 1));
+
+    Iterator input_it(in, win);
+    Iterator output_it(out, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto in_ptr  = reinterpret_cast<const T *>(input_it.ptr());
+            const auto out_ptr = reinterpret_cast<T *>(output_it.ptr());
+
+            int x = window_start_x;
+            for (; x <= (window_end_x - num_vectors * window_step_x); x += num_vectors * window_step_x)
+            {
+                l2_normalize_fused_columns<T, S, num_vectors>(in_ptr + x, out_ptr + x, axis_size, in_stride_axis,
+                                                              out_stride_axis, epsilon);
+            }
+            for (; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                l2_normalize_fused_columns<T, S, 1>(in_ptr + x, out_ptr + x, axis_size, in_stride_axis,
+                                                    out_stride_axis, epsilon);
+            }
+
+            // Compute left-over elements
+            for (; x < window_end_x; ++x)
+            {
+                T sum_value = static_cast<T>(0.f);
+                for (int i = 0; i < axis_size; ++i)
+                {
+                    const T value = *reinterpret_cast<const T *>(input_it.ptr() + i * in_stride_axis + x * sizeof(T));
+                    sum_value += value * value;
+                }
+                const T norm_value = static_cast<T>(1.f) / std::sqrt(std::max(sum_value, static_cast<T>(epsilon)));
+                for (int i = 0; i < axis_size; ++i)
+                {
+                    const T value = *reinterpret_cast<const T *>(input_it.ptr() + i * in_stride_axis + x * sizeof(T));
+                    *reinterpret_cast<T *>(output_it.ptr() + i * out_stride_axis + x * sizeof(T)) = value * norm_value;
+                }
+            }
+        },
+        input_it, output_it);
+}
 } // namespace cpu
 } // namespace arm_compute
 #endif //SRC_CORE_NEON_KERNELS_L2NORMLAYER_LIST_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,10 @@ DECLARE_L2NORMLAYER_KERNEL(neon_fp16_l2_normalize_x);
 DECLARE_L2NORMLAYER_KERNEL(neon_fp16_l2_normalize_yz);
 DECLARE_L2NORMLAYER_KERNEL(neon_fp32_l2_normalize_x);
 DECLARE_L2NORMLAYER_KERNEL(neon_fp32_l2_normalize_yz);
+DECLARE_L2NORMLAYER_KERNEL(neon_fp16_l2_normalize_fused_x);
+DECLARE_L2NORMLAYER_KERNEL(neon_fp16_l2_normalize_fused_yz);
+DECLARE_L2NORMLAYER_KERNEL(neon_fp32_l2_normalize_fused_x);
+DECLARE_L2NORMLAYER_KERNEL(neon_fp32_l2_normalize_fused_yz);
 
 #undef DECLARE_L2NORMLAYER_KERNEL
 } // namespace cpu
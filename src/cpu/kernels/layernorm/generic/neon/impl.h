@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "support/Bfloat16.h"
+
+#include <arm_neon.h>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace layernorm
+{
+// The statistics and the normalization are computed in fp32 whatever the storage type
+inline float32x4_t load_f32x4(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+inline void store_f32x4(float *ptr, float32x4_t v)
+{
+    vst1q_f32(ptr, v);
+}
+
+inline float32x4_t load_f32x4(const bfloat16 *ptr)
+{
+    return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(reinterpret_cast<const uint16_t *>(ptr)), 16));
+}
+
+inline void store_f32x4(bfloat16 *ptr, float32x4_t v)
+{
+    // Round to nearest even, as the scalar conversion does
+    uint32x4_t       bits = vreinterpretq_u32_f32(v);
+    const uint32x4_t lsb  = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+    bits                  = vaddq_u32(bits, vaddq_u32(lsb, vdupq_n_u32(0x7fff)));
+    vst1_u16(reinterpret_cast<uint16_t *>(ptr), vshrn_n_u32(bits, 16));
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline float32x4_t load_f32x4(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline void store_f32x4(float16_t *ptr, float32x4_t v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+template <typename T>
+inline T from_float(float v)
+{
+    return static_cast<T>(v);
+}
+
+template <>
+inline bfloat16 from_float<bfloat16>(float v)
+{
+    return bfloat16(v);
+}
+
+inline float32x4_t multiply_add(float32x4_t acc, float32x4_t a, float32x4_t b)
+{
+#ifdef __aarch64__
+    return vfmaq_f32(acc, a, b);
+#else  // __aarch64__
+    return vmlaq_f32(acc, a, b);
+#endif // __aarch64__
+}
+
+inline float reduce_add(float32x4_t v)
+{
+#ifdef __aarch64__
+    return vaddvq_f32(v);
+#else  // __aarch64__
+    float32x2_t sum = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    sum             = vpadd_f32(sum, sum);
+    return vget_lane_f32(sum, 0);
+#endif // __aarch64__
+}
+
+/** Running mean and sum of squared deviations of a row (Welford) */
+struct RowStats
+{
+    float count{0.f};
+    float mean{0.f};
+    float m2{0.f};
+
+    void add(float x)
+    {
+        count += 1.f;
+        const float delta = x - mean;
+        mean += delta / count;
+        m2 += delta * (x - mean);
+    }
+};
+
+/** Mean and variance of a row in a single pass
+ *
+ * Each lane keeps its own Welford statistics, which are merged with the parallel formula of Chan et al.
+ * With @p residual, the sum with @p src is written to @p sum so the normalization pass reads a single input.
+ */
+template <typename T>
+RowStats row_stats(const T *src, const T *residual, T *sum, int len)
+{
+    constexpr int step = 8;
+
+    float32x4_t mean0 = vdupq_n_f32(0.f);
+    float32x4_t mean1 = vdupq_n_f32(0.f);
+    float32x4_t m2_0  = vdupq_n_f32(0.f);
+    float32x4_t m2_1  = vdupq_n_f32(0.f);
+    float       count = 0.f;
+
+    int x = 0;
+    for (; x <= len - step; x += step)
+    {
+        float32x4_t v0 = load_f32x4(src + x);
+        float32x4_t v1 = load_f32x4(src + x + 4);
+        if (residual != nullptr)
+        {
+            v0 = vaddq_f32(v0, load_f32x4(residual + x));
+            v1 = vaddq_f32(v1, load_f32x4(residual + x + 4));
+            store_f32x4(sum + x, v0);
+            store_f32x4(sum + x + 4, v1);
+        }
+
+        count += 1.f;
+        const float32x4_t inv_count = vdupq_n_f32(1.f / count);
+        const float32x4_t delta0    = vsubq_f32(v0, mean0);
+        const float32x4_t delta1    = vsubq_f32(v1, mean1);
+        mean0                       = multiply_add(mean0, delta0, inv_count);
+        mean1                       = multiply_add(mean1, delta1, inv_count);
+        m2_0                        = multiply_add(m2_0, delta0, vsubq_f32(v0, mean0));
+        m2_1                        = multiply_add(m2_1, delta1, vsubq_f32(v1, mean1));
+    }
+
+    RowStats stats{};
+    if (count > 0.f)
+    {
+        // All the lanes hold the same number of elements
+        const float       lane_mean = (reduce_add(mean0) + reduce_add(mean1)) / step;
+        const float32x4_t vmean     = vdupq_n_f32(lane_mean);
+        const float32x4_t dev0      = vsubq_f32(mean0, vmean);
+        const float32x4_t dev1      = vsubq_f32(mean1, vmean);
+        const float       dev2      = reduce_add(vaddq_f32(vmulq_f32(dev0, dev0), vmulq_f32(dev1, dev1)));
+
+        stats.count = count * step;
+        stats.mean  = lane_mean;
+        stats.m2    = reduce_add(vaddq_f32(m2_0, m2_1)) + count * dev2;
+    }
+
+    for (; x < len; ++x)
+    {
+        float v = static_cast<float>(src[x]);
+        if (residual != nullptr)
+        {
+            v += static_cast<float>(residual[x]);
+            sum[x] = from_float<T>(v);
+        }
+        stats.add(v);
+    }
+    return stats;
+}
+
+/** Mean of the squares of a row, with the same handling of @p residual as @ref row_stats */
+template <typename T>
+float row_mean_square(const T *src, const T *residual, T *sum, int len)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.f);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+
+    int x = 0;
+    for (; x <= len - 8; x += 8)
+    {
+        float32x4_t v0 = load_f32x4(src + x);
+        float32x4_t v1 = load_f32x4(src + x + 4);
+        if (residual != nullptr)
+        {
+            v0 = vaddq_f32(v0, load_f32x4(residual + x));
+            v1 = vaddq_f32(v1, load_f32x4(residual + x + 4));
+            store_f32x4(sum + x, v0);
+            store_f32x4(sum + x + 4, v1);
+        }
+        acc0 = multiply_add(acc0, v0, v0);
+        acc1 = multiply_add(acc1, v1, v1);
+    }
+
+    float sum_squares = reduce_add(vaddq_f32(acc0, acc1));
+    for (; x < len; ++x)
+    {
+        float v = static_cast<float>(src[x]);
+        if (residual != nullptr)
+        {
+            v += static_cast<float>(residual[x]);
+            sum[x] = from_float<T>(v);
+        }
+        sum_squares += v * v;
+    }
+    return sum_squares / len;
+}
+
+/** Normalize a row as (x * scale + shift) * gamma + beta, @p gamma and @p beta can be nullptr */
+template <typename T>
+void normalize_row(const T *src, const T *gamma, const T *beta, T *dst, float scale, float shift, int len)
+{
+    const float32x4_t vscale = vdupq_n_f32(scale);
+    const float32x4_t vshift = vdupq_n_f32(shift);
+
+    int x = 0;
+    for (; x <= len - 4; x += 4)
+    {
+        float32x4_t v = multiply_add(vshift, load_f32x4(src + x), vscale);
+        if (gamma != nullptr)
+        {
+            v = vmulq_f32(v, load_f32x4(gamma + x));
+        }
+        if (beta != nullptr)
+        {
+            v = vaddq_f32(v, load_f32x4(beta + x));
+        }
+        store_f32x4(dst + x, v);
+    }
+    for (; x < len; ++x)
+    {
+        float v = static_cast<float>(src[x]) * scale + shift;
+        if (gamma != nullptr)
+        {
+            v *= static_cast<float>(gamma[x]);
+        }
+        if (beta != nullptr)
+        {
+            v += static_cast<float>(beta[x]);
+        }
+        dst[x] = from_float<T>(v);
+    }
+}
+
+template <typename T>
+void neon_layer_norm(const ITensor *src,
+                     const ITensor *residual,
+                     const ITensor *gamma,
+                     const ITensor *beta,
+                     ITensor       *dst,
+                     float          epsilon,
+                     bool           use_rms_norm,
+                     const Window  &window)
+{
+    const int len = static_cast<int>(src->info()->dimension(0));
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // Without a residual the source is iterated twice, only the first iterator is read
+    Iterator src_it(src, win);
+    Iterator residual_it(residual != nullptr ? residual : src, win);
+    Iterator dst_it(dst, win);
+
+    const auto *gamma_ptr =
+        gamma != nullptr ? reinterpret_cast<const T *>(gamma->ptr_to_element(Coordinates())) : nullptr;
+    const auto *beta_ptr = beta != nullptr ? reinterpret_cast<const T *>(beta->ptr_to_element(Coordinates())) : nullptr;
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto *src_ptr      = reinterpret_cast<const T *>(src_it.ptr());
+            const auto *residual_ptr = residual != nullptr ? reinterpret_cast<const T *>(residual_it.ptr()) : nullptr;
+            auto       *dst_ptr      = reinterpret_cast<T *>(dst_it.ptr());
+
+            // With a residual the statistics pass leaves the sum in the destination, normalized in place
+            const T *in_ptr = residual != nullptr ? dst_ptr : src_ptr;
+            if (use_rms_norm)
+            {
+                const float scale = 1.f / std::sqrt(row_mean_square(src_ptr, residual_ptr, dst_ptr, len) + epsilon);
+                normalize_row(in_ptr, gamma_ptr, beta_ptr, dst_ptr, scale, 0.f, len);
+            }
+            else
+            {
+                const RowStats stats = row_stats(src_ptr, residual_ptr, dst_ptr, len);
+                const float    scale = 1.f / std::sqrt(stats.m2 / len + epsilon);
+                normalize_row(in_ptr, gamma_ptr, beta_ptr, dst_ptr, scale, -stats.mean * scale, len);
+            }
+        },
+        src_it, residual_it, dst_it);
+}
+} // namespace layernorm
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_LAYERNORM_GENERIC_NEON_IMPL_H
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_LSTM_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_LSTM_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/kernels/NELSTMCellKernel.h"
+#include "src/core/NEON/NEMath.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace lstm
+{
+// All the gating is computed in fp32, the last partial vector of a row goes through a zero padded copy
+inline float32x4_t load_f32x4(const float *ptr, int len)
+{
+    if (len == 4)
+    {
+        return vld1q_f32(ptr);
+    }
+    float tmp[4] = {0.f, 0.f, 0.f, 0.f};
+    std::copy_n(ptr, len, tmp);
+    return vld1q_f32(tmp);
+}
+
+inline void store_f32x4(float *ptr, float32x4_t v, int len)
+{
+    if (len == 4)
+    {
+        vst1q_f32(ptr, v);
+        return;
+    }
+    float tmp[4];
+    vst1q_f32(tmp, v);
+    std::copy_n(tmp, len, ptr);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline float32x4_t load_f32x4(const float16_t *ptr, int len)
+{
+    if (len == 4)
+    {
+        return vcvt_f32_f16(vld1_f16(ptr));
+    }
+    float16_t tmp[4] = {0, 0, 0, 0};
+    std::copy_n(ptr, len, tmp);
+    return vcvt_f32_f16(vld1_f16(tmp));
+}
+
+inline void store_f32x4(float16_t *ptr, float32x4_t v, int len)
+{
+    if (len == 4)
+    {
+        vst1_f16(ptr, vcvt_f16_f32(v));
+        return;
+    }
+    float16_t tmp[4];
+    vst1_f16(tmp, vcvt_f16_f32(v));
+    std::copy_n(tmp, len, ptr);
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+inline float reduce_add(float32x4_t v)
+{
+#ifdef __aarch64__
+    return vaddvq_f32(v);
+#else  // __aarch64__
+    float32x2_t sum = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    sum             = vpadd_f32(sum, sum);
+    return vget_lane_f32(sum, 0);
+#endif // __aarch64__
+}
+
+inline float32x4_t multiply_add(float32x4_t acc, float32x4_t a, float32x4_t b)
+{
+#ifdef __aarch64__
+    return vfmaq_f32(acc, a, b);
+#else  // __aarch64__
+    return vmlaq_f32(acc, a, b);
+#endif // __aarch64__
+}
+
+inline float32x4_t sigmoid(float32x4_t x)
+{
+    return vinvq_f32(vaddq_f32(vdupq_n_f32(1.f), vexpq_f32(vnegq_f32(x))));
+}
+
+inline float32x4_t activation(float32x4_t x, const ActivationLayerInfo &info)
+{
+    switch (info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+            return sigmoid(x);
+        case ActivationLayerInfo::ActivationFunction::TANH:
+            return vmulq_f32(vdupq_n_f32(info.a()), vtanhq_f32(vmulq_f32(vdupq_n_f32(info.b()), x)));
+        case ActivationLayerInfo::ActivationFunction::RELU:
+            return vmaxq_f32(vdupq_n_f32(0.f), x);
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+            return vminq_f32(vdupq_n_f32(info.a()), vmaxq_f32(vdupq_n_f32(0.f), x));
+        case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+            return vminq_f32(vdupq_n_f32(info.a()), vmaxq_f32(vdupq_n_f32(info.b()), x));
+        case ActivationLayerInfo::ActivationFunction::IDENTITY:
+            return x;
+        default:
+            ARM_COMPUTE_ERROR("Activation function not supported by the LSTM cell");
+    }
+}
+
+/** Layer normalization of one gate over a row, with its weights and bias */
+template <typename T>
+struct GateNorm
+{
+    float    mean{0.f};
+    float    stddev_inv{1.f};
+    const T *weights{nullptr};
+    const T *bias{nullptr};
+
+    float32x4_t apply(float32x4_t v, int x, int len) const
+    {
+        const float32x4_t norm = vmulq_f32(vsubq_f32(v, vdupq_n_f32(mean)), vdupq_n_f32(stddev_inv));
+        return multiply_add(load_f32x4(bias + x, len), norm, load_f32x4(weights + x, len));
+    }
+};
+
+template <typename T>
+T *row_ptr(const ITensor *tensor, int y)
+{
+    return tensor == nullptr ? nullptr : reinterpret_cast<T *>(tensor->ptr_to_element(Coordinates(0, y)));
+}
+
+/** Load a gate, adding the precomputed contribution of the input to it when there is one */
+template <typename T>
+float32x4_t load_gate(const T *gates, const T *input_gates, int offset, int len)
+{
+    const float32x4_t v = load_f32x4(gates + offset, len);
+    return input_gates == nullptr ? v : vaddq_f32(v, load_f32x4(input_gates + offset, len));
+}
+
+/** Add the input contribution and the peephole to a gate in place, and compute its layer normalization statistics
+ *
+ * The padding lanes of the last vector are zero so they do not contribute to the sums.
+ */
+template <typename T>
+void accumulate_gate(T           *gates,
+                     const T     *input_gates,
+                     int          offset,
+                     const T     *cell_state,
+                     const T     *peephole,
+                     int          units,
+                     float        epsilon,
+                     GateNorm<T> &norm)
+{
+    float32x4_t sum    = vdupq_n_f32(0.f);
+    float32x4_t sum_sq = vdupq_n_f32(0.f);
+    for (int x = 0; x < units; x += 4)
+    {
+        const int   len = std::min(4, units - x);
+        float32x4_t v   = load_gate(gates, input_gates, offset + x, len);
+        if (peephole != nullptr)
+        {
+            v = multiply_add(v, load_f32x4(cell_state + x, len), load_f32x4(peephole + x, len));
+        }
+        if (peephole != nullptr || input_gates != nullptr)
+        {
+            store_f32x4(gates + offset + x, v, len);
+        }
+        sum    = vaddq_f32(sum, v);
+        sum_sq = multiply_add(sum_sq, v, v);
+    }
+
+    norm.mean            = reduce_add(sum) / units;
+    const float variance = reduce_add(sum_sq) / units - norm.mean * norm.mean;
+    norm.stddev_inv      = 1.f / std::sqrt(variance + epsilon);
+}
+
+template <typename T>
+void neon_lstm_cell(const LSTMCellArguments<ITensor> &tensors, const LSTMCellKernelInfo &info, const Window &window)
+{
+    const int   units        = static_cast<int>(tensors.cell_state_out->info()->dimension(0));
+    const bool  has_cifg     = info.has_cifg_opt;
+    const bool  has_peephole = info.has_peephole_opt;
+    const bool  layer_norm   = info.use_layer_norm;
+    const bool  clip         = info.cell_threshold != 0.f;
+    const auto &act_info     = info.activation_info;
+
+    // Gates are laid out as [input, forget, cell, output] and the scratch buffer as
+    // [input, cell state, forget, output], neither of them holds the input gate with CIFG
+    const int gate_i    = 0;
+    const int gate_f    = has_cifg ? 0 : units;
+    const int gate_c    = gate_f + units;
+    const int gate_o    = gate_c + units;
+    const int scratch_i = 0;
+    const int scratch_c = has_cifg ? 0 : units;
+    const int scratch_f = scratch_c + units;
+    const int scratch_o = scratch_f + units;
+
+    const T *w_ci = has_peephole && !has_cifg ? row_ptr<T>(tensors.cell_to_input_weights, 0) : nullptr;
+    const T *w_cf = has_peephole ? row_ptr<T>(tensors.cell_to_forget_weights, 0) : nullptr;
+    const T *w_co = has_peephole ? row_ptr<T>(tensors.cell_to_output_weights, 0) : nullptr;
+
+    GateNorm<T> norm_i{};
+    GateNorm<T> norm_f{};
+    GateNorm<T> norm_c{};
+    GateNorm<T> norm_o{};
+    if (layer_norm)
+    {
+        norm_i.weights = has_cifg ? nullptr : row_ptr<T>(tensors.input_layer_norm_weights, 0);
+        norm_i.bias    = has_cifg ? nullptr : row_ptr<T>(tensors.input_gate_bias, 0);
+        norm_f.weights = row_ptr<T>(tensors.forget_layer_norm_weights, 0);
+        norm_f.bias    = row_ptr<T>(tensors.forget_gate_bias, 0);
+        norm_c.weights = row_ptr<T>(tensors.cell_layer_norm_weights, 0);
+        norm_c.bias    = row_ptr<T>(tensors.cell_bias, 0);
+        norm_o.weights = row_ptr<T>(tensors.output_layer_norm_weights, 0);
+        norm_o.bias    = row_ptr<T>(tensors.output_gate_bias, 0);
+    }
+
+    const float32x4_t ones       = vdupq_n_f32(1.f);
+    const float32x4_t cell_upper = vdupq_n_f32(info.cell_threshold);
+    const float32x4_t cell_lower = vdupq_n_f32(-info.cell_threshold);
+
+    for (int y = window.y().start(); y < window.y().end(); y += window.y().step())
+    {
+        T       *gates      = row_ptr<T>(tensors.gates, y);
+        const T *row_inputs = row_ptr<T>(tensors.input_gates, y);
+        const T *c_in       = row_ptr<T>(tensors.cell_state_in, y);
+        T       *c_out      = row_ptr<T>(tensors.cell_state_out, y);
+        T       *h_out      = row_ptr<T>(tensors.output_state_out, y);
+        T       *scratch    = row_ptr<T>(tensors.scratch_buffer, y);
+
+        // Layer normalization needs the statistics of the whole row, so the input contributions and the peepholes
+        // are added to the gates first, and must not be added again below
+        if (layer_norm)
+        {
+            if (!has_cifg)
+            {
+                accumulate_gate<T>(gates, row_inputs, gate_i, c_in, w_ci, units, info.epsilon, norm_i);
+            }
+            accumulate_gate<T>(gates, row_inputs, gate_f, c_in, w_cf, units, info.epsilon, norm_f);
+            accumulate_gate<T>(gates, row_inputs, gate_c, c_in, nullptr, units, info.epsilon, norm_c);
+        }
+        const T *inputs = layer_norm ? nullptr : row_inputs;
+
+        for (int x = 0; x < units; x += 4)
+        {
+            const int         len = std::min(4, units - x);
+            const float32x4_t c   = load_f32x4(c_in + x, len);
+
+            float32x4_t f = load_gate(gates, inputs, gate_f + x, len);
+            f             = layer_norm ? norm_f.apply(f, x, len)
+                                       : (w_cf != nullptr ? multiply_add(f, c, load_f32x4(w_cf + x, len)) : f);
+            f             = sigmoid(f);
+
+            float32x4_t i;
+            if (has_cifg)
+            {
+                i = vsubq_f32(ones, f);
+            }
+            else
+            {
+                i = load_gate(gates, inputs, gate_i + x, len);
+                i = layer_norm ? norm_i.apply(i, x, len)
+                               : (w_ci != nullptr ? multiply_add(i, c, load_f32x4(w_ci + x, len)) : i);
+                i = sigmoid(i);
+                if (scratch != nullptr)
+                {
+                    store_f32x4(scratch + scratch_i + x, i, len);
+                }
+            }
+
+            float32x4_t g = load_gate(gates, inputs, gate_c + x, len);
+            g             = activation(layer_norm ? norm_c.apply(g, x, len) : g, act_info);
+
+            float32x4_t c_new = multiply_add(vmulq_f32(f, c), g, i);
+            if (clip)
+            {
+                c_new = vminq_f32(cell_upper, vmaxq_f32(cell_lower, c_new));
+            }
+
+            // c_in is not read past x anymore, so c_out can alias it
+            store_f32x4(c_out + x, c_new, len);
+            if (scratch != nullptr)
+            {
+                store_f32x4(scratch + scratch_c + x, c_new, len);
+                store_f32x4(scratch + scratch_f + x, f, len);
+            }
+
+            if (!layer_norm)
+            {
+                float32x4_t o = load_gate(gates, inputs, gate_o + x, len);
+                o             = w_co != nullptr ? multiply_add(o, c_new, load_f32x4(w_co + x, len)) : o;
+                o             = sigmoid(o);
+                if (scratch != nullptr)
+                {
+                    store_f32x4(scratch + scratch_o + x, o, len);
+                }
+                store_f32x4(h_out + x, vmulq_f32(o, activation(c_new, act_info)), len);
+            }
+        }
+
+        // The output gate peeps at the new cell state, its statistics can only be computed once the row is done
+        if (layer_norm)
+        {
+            accumulate_gate<T>(gates, row_inputs, gate_o, c_out, w_co, units, info.epsilon, norm_o);
+            for (int x = 0; x < units; x += 4)
+            {
+                const int         len   = std::min(4, units - x);
+                const float32x4_t c_new = load_f32x4(c_out + x, len);
+                const float32x4_t o     = sigmoid(norm_o.apply(load_f32x4(gates + gate_o + x, len), x, len));
+                if (scratch != nullptr)
+                {
+                    store_f32x4(scratch + scratch_o + x, o, len);
+                }
+                store_f32x4(h_out + x, vmulq_f32(o, activation(c_new, act_info)), len);
+            }
+        }
+    }
+}
+} // namespace lstm
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_LSTM_GENERIC_NEON_IMPL_H
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_MULTI_AXIS_REDUCTION_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_MULTI_AXIS_REDUCTION_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/Window.h"
+
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace multi_axis_reduction
+{
+/** Maximum number of dimensions of the reduced tensors */
+constexpr unsigned int max_dims = 4;
+
+/** Accumulators of the reduction, quantized values are summed exactly as integers */
+template <typename T>
+using acc_type = typename std::conditional<std::is_integral<T>::value, int32_t, float>::type;
+
+/** Add a source row to the accumulators */
+inline void accumulate_row(const float *src, float *acc, int len)
+{
+    int x = 0;
+    for (; x <= len - 8; x += 8)
+    {
+        vst1q_f32(acc + x, vaddq_f32(vld1q_f32(acc + x), vld1q_f32(src + x)));
+        vst1q_f32(acc + x + 4, vaddq_f32(vld1q_f32(acc + x + 4), vld1q_f32(src + x + 4)));
+    }
+    for (; x < len; ++x)
+    {
+        acc[x] += src[x];
+    }
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline void accumulate_row(const float16_t *src, float *acc, int len)
+{
+    int x = 0;
+    for (; x <= len - 8; x += 8)
+    {
+        const float16x8_t v = vld1q_f16(src + x);
+        vst1q_f32(acc + x, vaddq_f32(vld1q_f32(acc + x), vcvt_f32_f16(vget_low_f16(v))));
+        vst1q_f32(acc + x + 4, vaddq_f32(vld1q_f32(acc + x + 4), vcvt_f32_f16(vget_high_f16(v))));
+    }
+    for (; x < len; ++x)
+    {
+        acc[x] += static_cast<float>(src[x]);
+    }
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+inline void accumulate_s16x8(int16x8_t v, int32_t *acc)
+{
+    vst1q_s32(acc, vaddw_s16(vld1q_s32(acc), vget_low_s16(v)));
+    vst1q_s32(acc + 4, vaddw_s16(vld1q_s32(acc + 4), vget_high_s16(v)));
+}
+
+inline void accumulate_row(const uint8_t *src, int32_t *acc, int len)
+{
+    int x = 0;
+    for (; x <= len - 16; x += 16)
+    {
+        const uint8x16_t v = vld1q_u8(src + x);
+        accumulate_s16x8(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(v))), acc + x);
+        accumulate_s16x8(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(v))), acc + x + 8);
+    }
+    for (; x < len; ++x)
+    {
+        acc[x] += src[x];
+    }
+}
+
+inline void accumulate_row(const int8_t *src, int32_t *acc, int len)
+{
+    int x = 0;
+    for (; x <= len - 16; x += 16)
+    {
+        const int8x16_t v = vld1q_s8(src + x);
+        accumulate_s16x8(vmovl_s8(vget_low_s8(v)), acc + x);
+        accumulate_s16x8(vmovl_s8(vget_high_s8(v)), acc + x + 8);
+    }
+    for (; x < len; ++x)
+    {
+        acc[x] += src[x];
+    }
+}
+
+inline float sum_lanes(float32x4_t v)
+{
+    return vgetq_lane_f32(v, 0) + vgetq_lane_f32(v, 1) + vgetq_lane_f32(v, 2) + vgetq_lane_f32(v, 3);
+}
+
+/** Sum a whole source row */
+inline float sum_row(const float *src, int len)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.f);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+    int         x    = 0;
+    for (; x <= len - 8; x += 8)
+    {
+        acc0 = vaddq_f32(acc0, vld1q_f32(src + x));
+        acc1 = vaddq_f32(acc1, vld1q_f32(src + x + 4));
+    }
+    float sum = sum_lanes(vaddq_f32(acc0, acc1));
+    for (; x < len; ++x)
+    {
+        sum += src[x];
+    }
+    return sum;
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline float sum_row(const float16_t *src, int len)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.f);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+    int         x    = 0;
+    for (; x <= len - 8; x += 8)
+    {
+        const float16x8_t v = vld1q_f16(src + x);
+        acc0                = vaddq_f32(acc0, vcvt_f32_f16(vget_low_f16(v)));
+        acc1                = vaddq_f32(acc1, vcvt_f32_f16(vget_high_f16(v)));
+    }
+    float sum = sum_lanes(vaddq_f32(acc0, acc1));
+    for (; x < len; ++x)
+    {
+        sum += static_cast<float>(src[x]);
+    }
+    return sum;
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+inline int32_t sum_row(const uint8_t *src, int len)
+{
+    uint32x4_t acc = vdupq_n_u32(0);
+    int        x   = 0;
+    for (; x <= len - 16; x += 16)
+    {
+        acc = vpadalq_u16(acc, vpaddlq_u8(vld1q_u8(src + x)));
+    }
+    int32_t sum = static_cast<int32_t>(vgetq_lane_u32(acc, 0) + vgetq_lane_u32(acc, 1) + vgetq_lane_u32(acc, 2) +
+                                       vgetq_lane_u32(acc, 3));
+    for (; x < len; ++x)
+    {
+        sum += src[x];
+    }
+    return sum;
+}
+
+inline int32_t sum_row(const int8_t *src, int len)
+{
+    int32x4_t acc = vdupq_n_s32(0);
+    int       x   = 0;
+    for (; x <= len - 16; x += 16)
+    {
+        acc = vpadalq_s16(acc, vpaddlq_s8(vld1q_s8(src + x)));
+    }
+    int32_t sum = vgetq_lane_s32(acc, 0) + vgetq_lane_s32(acc, 1) + vgetq_lane_s32(acc, 2) + vgetq_lane_s32(acc, 3);
+    for (; x < len; ++x)
+    {
+        sum += src[x];
+    }
+    return sum;
+}
+
+/** Convert a rescaled accumulator to the destination type, quantized values are rounded and saturated */
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value, T>::type finalize(float value)
+{
+    return static_cast<T>(utility::clamp<int32_t, T>(static_cast<int32_t>(support::cpp11::lround(value))));
+}
+
+template <typename T>
+inline typename std::enable_if<!std::is_integral<T>::value, T>::type finalize(float value)
+{
+    return static_cast<T>(value);
+}
+
+/** Reduce the axes in @p axis_mask of an up to 4D tensor in a single pass
+ *
+ * The window spans the destination rows, i.e. all the coordinates of the preserved dimensions but X. A thread
+ * accumulates every source row reduced to each destination row it owns:
+ * - If X is preserved, the rows are added to a row of accumulators, vectorised along X.
+ * - If X is reduced, each row is summed to a single accumulator.
+ *
+ * The accumulators are then rescaled once as dst = acc * scale + shift, which averages them with @p use_mean and
+ * requantizes them for quantized tensors, removing the source offset from the sums.
+ *
+ * @param[in]  src       Source tensor.
+ * @param[out] dst       Destination tensor.
+ * @param[in]  axis_mask Bit mask of the reduced dimensions.
+ * @param[in]  keep_dims Whether @p dst keeps the reduced dimensions with length 1, or drops them.
+ * @param[in]  use_mean  Average the reduced values instead of summing them.
+ * @param[in]  window    Region of the destination rows to compute.
+ */
+template <typename T>
+void neon_multi_axis_reduction(
+    const ITensor *src, ITensor *dst, uint32_t axis_mask, bool keep_dims, bool use_mean, const Window &window)
+{
+    using AccType = acc_type<T>;
+
+    const ITensorInfo &src_info = *src->info();
+    const ITensorInfo &dst_info = *dst->info();
+
+    // Map each source dimension to its destination stride, reduced dimensions do not move in the destination
+    size_t   shape[max_dims];
+    size_t   src_strides[max_dims];
+    size_t   dst_strides[max_dims];
+    size_t   count   = 1;
+    uint32_t dst_dim = 0;
+    for (uint32_t d = 0; d < max_dims; ++d)
+    {
+        const bool is_reduced = (axis_mask & (1U << d)) != 0;
+        shape[d]              = src_info.dimension(d);
+        src_strides[d]        = src_info.strides_in_bytes()[d];
+        dst_strides[d]        = is_reduced ? 0 : dst_info.strides_in_bytes()[keep_dims ? d : dst_dim];
+        count *= is_reduced ? shape[d] : 1;
+        dst_dim += (keep_dims || !is_reduced) ? 1 : 0;
+    }
+
+    // Offsets of all the source rows reduced to the same destination row
+    std::vector<size_t> reduced_offsets(1, 0);
+    for (uint32_t d = 1; d < max_dims; ++d)
+    {
+        if ((axis_mask & (1U << d)) != 0)
+        {
+            const size_t num_offsets = reduced_offsets.size();
+            for (size_t i = 1; i < shape[d]; ++i)
+            {
+                for (size_t j = 0; j < num_offsets; ++j)
+                {
+                    reduced_offsets.push_back(reduced_offsets[j] + i * src_strides[d]);
+                }
+            }
+        }
+    }
+
+    float scale = use_mean ? 1.f / count : 1.f;
+    float shift = 0.f;
+    if (std::is_integral<T>::value)
+    {
+        const UniformQuantizationInfo src_qinfo = src_info.quantization_info().uniform();
+        const UniformQuantizationInfo dst_qinfo = dst_info.quantization_info().uniform();
+        scale *= src_qinfo.scale / dst_qinfo.scale;
+        shift = dst_qinfo.offset - static_cast<float>(count) * src_qinfo.offset * scale;
+    }
+
+    const bool     reduce_x = (axis_mask & 1U) != 0;
+    const int      len      = static_cast<int>(shape[0]);
+    const uint8_t *src_base = src->buffer() + src_info.offset_first_element_in_bytes();
+    uint8_t       *dst_base = dst->buffer() + dst_info.offset_first_element_in_bytes();
+
+    std::vector<AccType> acc(reduce_x ? 0 : len);
+    for (int row = window.y().start(); row < window.y().end(); row += window.y().step())
+    {
+        // Decode the coordinates of the preserved dimensions of the row
+        size_t src_offset = 0;
+        size_t dst_offset = 0;
+        size_t index      = row;
+        for (uint32_t d = 1; d < max_dims; ++d)
+        {
+            if ((axis_mask & (1U << d)) == 0)
+            {
+                const size_t coord = index % shape[d];
+                index /= shape[d];
+                src_offset += coord * src_strides[d];
+                dst_offset += coord * dst_strides[d];
+            }
+        }
+
+        T *dst_ptr = reinterpret_cast<T *>(dst_base + dst_offset);
+        if (reduce_x)
+        {
+            AccType sum = 0;
+            for (const size_t offset : reduced_offsets)
+            {
+                sum += sum_row(reinterpret_cast<const T *>(src_base + src_offset + offset), len);
+            }
+            *dst_ptr = finalize<T>(sum * scale + shift);
+        }
+        else
+        {
+            std::fill(acc.begin(), acc.end(), AccType(0));
+            for (const size_t offset : reduced_offsets)
+            {
+                accumulate_row(reinterpret_cast<const T *>(src_base + src_offset + offset), acc.data(), len);
+            }
+            for (int x = 0; x < len; ++x)
+            {
+                dst_ptr[x] = finalize<T>(acc[x] * scale + shift);
+            }
+        }
+    }
+}
+} // namespace multi_axis_reduction
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_MULTI_AXIS_REDUCTION_GENERIC_NEON_IMPL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,7 +41,7 @@ void neon_normalize_float16_8_0_2D(
 void neon_normalize_float16_8_0(
     const Window &window, const ITensor *in, const ITensor *in_squared, ITensor *out, NormalizationLayerInfo ninfo)
 {
-    arm_compute::normalize_float<float16_t, 8, 0, false>(window, in, in_squared, out, ninfo);
+    arm_compute::normalize_float_running_sum<float16_t, 8, 0>(window, in, in_squared, out, ninfo);
 }
 
 void neon_normalize_float16_8_1_2D(
@@ -53,13 +53,13 @@ void neon_normalize_float16_8_1_2D(
 void neon_normalize_float16_8_1(
     const Window &window, const ITensor *in, const ITensor *in_squared, ITensor *out, NormalizationLayerInfo ninfo)
 {
-    arm_compute::normalize_float<float16_t, 8, 1, false>(window, in, in_squared, out, ninfo);
+    arm_compute::normalize_float_running_sum<float16_t, 8, 1>(window, in, in_squared, out, ninfo);
 }
 
 void neon_normalize_float16_8_2(
     const Window &window, const ITensor *in, const ITensor *in_squared, ITensor *out, NormalizationLayerInfo ninfo)
 {
-    arm_compute::normalize_float<float16_t, 8, 2, false>(window, in, in_squared, out, ninfo);
+    arm_compute::normalize_float_running_sum<float16_t, 8, 2>(window, in, in_squared, out, ninfo);
 }
 
 } // namespace cpu
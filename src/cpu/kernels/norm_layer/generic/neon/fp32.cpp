@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,7 +39,7 @@ void neon_normalize_float32_4_0_2D(
 void neon_normalize_float32_4_0(
     const Window &window, const ITensor *in, const ITensor *in_squared, ITensor *out, NormalizationLayerInfo ninfo)
 {
-    arm_compute::normalize_float<float, 4, 0, false>(window, in, in_squared, out, ninfo);
+    arm_compute::normalize_float_running_sum<float, 4, 0>(window, in, in_squared, out, ninfo);
 }
 
 void neon_normalize_float32_4_1_2D(
@@ -51,13 +51,13 @@ void neon_normalize_float32_4_1_2D(
 void neon_normalize_float32_4_1(
     const Window &window, const ITensor *in, const ITensor *in_squared, ITensor *out, NormalizationLayerInfo ninfo)
 {
-    arm_compute::normalize_float<float, 4, 1, false>(window, in, in_squared, out, ninfo);
+    arm_compute::normalize_float_running_sum<float, 4, 1>(window, in, in_squared, out, ninfo);
 }
 
 void neon_normalize_float32_4_2(
     const Window &window, const ITensor *in, const ITensor *in_squared, ITensor *out, NormalizationLayerInfo ninfo)
 {
-    arm_compute::normalize_float<float, 4, 2, false>(window, in, in_squared, out, ninfo);
+    arm_compute::normalize_float_running_sum<float, 4, 2>(window, in, in_squared, out, ninfo);
 }
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023 Arm Limited.
+ * Copyright (c) 2017-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,9 @@
 #include "src/core/NEON/NEMath.h"
 #include "src/core/NEON/wrapper/wrapper.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace arm_compute
 {
 /** Function to perform normalization depending on the given template
@@ -173,5 +176,185 @@ void normalize_float(
         input, input_squared, output);
 }
 
+/** Loads the sums of squares of a vector of elements, the sums being accumulated in F32 */
+template <typename T>
+inline typename std::enable_if<std::is_same<T, float>::value, float32x4_t>::type load_square_sums(const float *ptr)
+{
+    return wrapper::vloadq(ptr);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template <typename T>
+inline typename std::enable_if<std::is_same<T, float16_t>::value, float16x8_t>::type
+load_square_sums(const float *ptr)
+{
+    return wrapper::vcombine(wrapper::vcvt<float16_t>(wrapper::vloadq(ptr)),
+                             wrapper::vcvt<float16_t>(wrapper::vloadq(ptr + 4)));
+}
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+/** Function to perform a 1D normalization with a running sum of squares along the normalized dimension.
+ *
+ * The sum of a window is updated from the sum of the previous one by adding the square entering the window and
+ * subtracting the square leaving it, instead of adding all the squares of the window. The sums are accumulated in F32
+ * and a row of them is normalized at once.
+ *
+ * @param[in] window     Region on which to execute the kernel.
+ * @param[in] in         Source tensor. 3 lower dims represent a single input with dimensions [width, height, IFM],
+ *                       and an optional 4th dimension for batch of inputs. Data types supported: FP16/F32. Data layouts supported: NCHW/NHWC.
+ * @param[in] in_squared Source with each element has been squared. 3 lower dims represent a single input with dimensions [width, height, IFM],
+ *                       Data type and layout supported: same as @p input.
+ * @param[in] out        Destination tensor. Output will have the same number of dimensions as input. Data type and layout supported: same as @p input.
+ * @param[in] ninfo      Normalization layer information like the normalization type, normalization size and other parameters.
+ */
+template <typename T, unsigned int S, unsigned int dim>
+void normalize_float_running_sum(
+    const Window &window, const ITensor *in, const ITensor *in_squared, ITensor *out, NormalizationLayerInfo ninfo)
+{
+    /** SIMD vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_vector<T, S>::tag_type;
+
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+    const int  window_step_x  = S;
+    const int  num_x          = window_end_x - window_start_x;
+    if (num_x <= 0)
+    {
+        return;
+    }
+
+    const int radius    = ninfo.norm_size() / 2;
+    const int max_slice = in->info()->dimension(dim) - 1;
+
+    const auto coeff_vec = wrapper::vdup_n(static_cast<T>(ninfo.scale_coeff()), ExactTagType{});
+    const auto beta_vec  = wrapper::vdup_n(static_cast<T>(ninfo.beta()), ExactTagType{});
+    const auto kappa_vec = wrapper::vdup_n(static_cast<T>(ninfo.kappa()), ExactTagType{});
+
+    // Sums of squares of the elements of a row
+    std::vector<float> sums(num_x);
+
+    auto normalize_row = [&](const T *input_ptr, T *output_ptr)
+    {
+        int x = 0;
+        for (; x <= num_x - window_step_x; x += window_step_x)
+        {
+            const auto accu             = load_square_sums<T>(sums.data() + x);
+            const auto normalized       = wrapper::vpow(wrapper::vmla(kappa_vec, coeff_vec, accu), beta_vec);
+            const auto normalized_pixel = wrapper::vmul(wrapper::vloadq(input_ptr + window_start_x + x),
+                                                        wrapper::vinv(normalized));
+            wrapper::vstore(output_ptr + window_start_x + x, normalized_pixel);
+        }
+        for (; x < num_x; ++x)
+        {
+            const auto normalized = std::pow(static_cast<T>(sums[x]) * static_cast<T>(ninfo.scale_coeff()) +
+                                                 static_cast<T>(ninfo.kappa()),
+                                             ninfo.beta());
+            output_ptr[window_start_x + x] = input_ptr[window_start_x + x] / normalized;
+        }
+    };
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    if (dim == 0)
+    {
+        Iterator input(in, win);
+        Iterator input_squared(in_squared, win);
+        Iterator output(out, win);
+
+        execute_window_loop(
+            win,
+            [&](const Coordinates &)
+            {
+                const auto input_squared_ptr = reinterpret_cast<const T *>(input_squared.ptr());
+
+                float sum = 0.f;
+                for (int i = std::max(window_start_x - radius, 0); i <= std::min(window_start_x + radius, max_slice);
+                     ++i)
+                {
+                    sum += static_cast<float>(input_squared_ptr[i]);
+                }
+                sums[0] = sum;
+                for (int x = window_start_x + 1; x < window_end_x; ++x)
+                {
+                    if (x + radius <= max_slice)
+                    {
+                        sum += static_cast<float>(input_squared_ptr[x + radius]);
+                    }
+                    if (x - radius - 1 >= 0)
+                    {
+                        sum -= static_cast<float>(input_squared_ptr[x - radius - 1]);
+                    }
+                    sums[x - window_start_x] = sum;
+                }
+
+                normalize_row(reinterpret_cast<const T *>(input.ptr()), reinterpret_cast<T *>(output.ptr()));
+            },
+            input, input_squared, output);
+    }
+    else
+    {
+        // The slices of the window are walked in order to update the sums of a row from the previous slice
+        const int slice_start = window[dim].start();
+        const int slice_end   = window[dim].end();
+        if (slice_start >= slice_end)
+        {
+            return;
+        }
+        win.set(dim, Window::Dimension(0, 1, 1));
+
+        const size_t input_stride_slice         = in->info()->strides_in_bytes()[dim];
+        const size_t input_squared_stride_slice = in_squared->info()->strides_in_bytes()[dim];
+        const size_t output_stride_slice        = out->info()->strides_in_bytes()[dim];
+
+        Iterator input(in, win);
+        Iterator input_squared(in_squared, win);
+        Iterator output(out, win);
+
+        execute_window_loop(
+            win,
+            [&](const Coordinates &)
+            {
+                auto squared_slice = [&](int slice)
+                {
+                    return reinterpret_cast<const T *>(input_squared.ptr() + slice * input_squared_stride_slice) +
+                           window_start_x;
+                };
+                auto accumulate_slice = [&](int slice, float sign)
+                {
+                    const T *input_squared_ptr = squared_slice(slice);
+                    for (int x = 0; x < num_x; ++x)
+                    {
+                        sums[x] += sign * static_cast<float>(input_squared_ptr[x]);
+                    }
+                };
+
+                std::fill(sums.begin(), sums.end(), 0.f);
+                for (int i = std::max(slice_start - radius, 0); i <= std::min(slice_start + radius, max_slice); ++i)
+                {
+                    accumulate_slice(i, 1.f);
+                }
+
+                for (int slice = slice_start; slice < slice_end; ++slice)
+                {
+                    if (slice > slice_start)
+                    {
+                        if (slice + radius <= max_slice)
+                        {
+                            accumulate_slice(slice + radius, 1.f);
+                        }
+                        if (slice - radius - 1 >= 0)
+                        {
+                            accumulate_slice(slice - radius - 1, -1.f);
+                        }
+                    }
+                    normalize_row(reinterpret_cast<const T *>(input.ptr() + slice * input_stride_slice),
+                                  reinterpret_cast<T *>(output.ptr() + slice * output_stride_slice));
+                }
+            },
+            input, input_squared, output);
+    }
+}
+
 } // namespace arm_compute
 #endif // ACL_SRC_CPU_KERNELS_NORM_LAYER_GENERIC_NEON_IMPL_H
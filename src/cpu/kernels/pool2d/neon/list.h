@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023 Arm Limited.
+ * Copyright (c) 2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -56,6 +56,8 @@ DECLARE_POOLING_KERNEL(poolingMxN_fp16_neon_nchw);
 DECLARE_POOLING_KERNEL(pooling2_fp32_neon_nchw);
 DECLARE_POOLING_KERNEL(pooling3_fp32_neon_nchw);
 DECLARE_POOLING_KERNEL(pooling7_fp32_neon_nchw);
+DECLARE_POOLING_KERNEL(pooling_global_fp32_neon_nchw);
+DECLARE_POOLING_KERNEL(poolingMxN_large_fp32_neon_nchw);
 DECLARE_POOLING_KERNEL(poolingMxN_fp32_neon_nchw);
 #endif /* defined(ENABLE_NCHW_KERNELS) */
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,7 +31,9 @@
 #include "src/cpu/kernels/pool2d/neon/impl.h"
 #include "src/cpu/kernels/pool2d/neon/list.h"
 
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 #ifdef ENABLE_NCHW_KERNELS
 namespace arm_compute
@@ -456,6 +458,275 @@ void pooling7_fp32_neon_nchw(const ITensor    *src,
         },
         in, out);
 }
+
+namespace
+{
+template <PoolingType pool_type>
+inline float32x4_t pool_accumulate(float32x4_t acc, float32x4_t data)
+{
+    return pool_type == PoolingType::MAX ? vmaxq_f32(acc, data)
+           : pool_type == PoolingType::L2 ? vmlaq_f32(acc, data, data)
+                                          : vaddq_f32(acc, data);
+}
+
+template <PoolingType pool_type>
+inline float pool_accumulate(float acc, float data)
+{
+    return pool_type == PoolingType::MAX ? std::max(acc, data)
+           : pool_type == PoolingType::L2 ? acc + data * data
+                                          : acc + data;
+}
+
+template <PoolingType pool_type>
+inline float pool_reduce(float32x4_t acc)
+{
+    float32x2_t res = vget_low_f32(acc);
+    if (pool_type == PoolingType::MAX)
+    {
+        res = vpmax_f32(res, vget_high_f32(acc));
+        res = vpmax_f32(res, res);
+    }
+    else
+    {
+        res = vpadd_f32(res, vget_high_f32(acc));
+        res = vpadd_f32(res, res);
+    }
+    return vget_lane_f32(res, 0);
+}
+
+template <PoolingType pool_type>
+void pooling_global_fp32_neon_nchw_impl(const ITensor *src, ITensor *dst0, float min_value, const Window &window)
+{
+    const int      src_w    = src->info()->dimension(0);
+    const int      src_h    = src->info()->dimension(1);
+    const auto    &strides  = src->info()->strides_in_bytes();
+    const uint8_t *src_base = src->buffer() + src->info()->offset_first_element_in_bytes();
+    const float    init     = (pool_type == PoolingType::MAX) ? min_value : 0.f;
+    const float    scale    = 1.f / (src_w * src_h);
+
+    Iterator out(dst0, window);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const uint8_t *plane = src_base + id.z() * strides.z() + id[3] * strides[3];
+
+            // Independent accumulators so that consecutive loads do not wait on the same reduction
+            float32x4_t acc0 = vdupq_n_f32(init);
+            float32x4_t acc1 = acc0;
+            float32x4_t acc2 = acc0;
+            float32x4_t acc3 = acc0;
+            float       res  = init;
+
+            for (int y = 0; y < src_h; ++y)
+            {
+                const auto in_row = reinterpret_cast<const float *>(plane + y * strides.y());
+
+                int x = 0;
+                for (; x <= src_w - 16; x += 16)
+                {
+                    acc0 = pool_accumulate<pool_type>(acc0, vld1q_f32(in_row + x));
+                    acc1 = pool_accumulate<pool_type>(acc1, vld1q_f32(in_row + x + 4));
+                    acc2 = pool_accumulate<pool_type>(acc2, vld1q_f32(in_row + x + 8));
+                    acc3 = pool_accumulate<pool_type>(acc3, vld1q_f32(in_row + x + 12));
+                }
+                for (; x <= src_w - 4; x += 4)
+                {
+                    acc0 = pool_accumulate<pool_type>(acc0, vld1q_f32(in_row + x));
+                }
+                for (; x < src_w; ++x)
+                {
+                    res = pool_accumulate<pool_type>(res, in_row[x]);
+                }
+            }
+
+            if (pool_type == PoolingType::MAX)
+            {
+                res = std::max(res, pool_reduce<pool_type>(vmaxq_f32(vmaxq_f32(acc0, acc1), vmaxq_f32(acc2, acc3))));
+            }
+            else
+            {
+                res += pool_reduce<pool_type>(vaddq_f32(vaddq_f32(acc0, acc1), vaddq_f32(acc2, acc3)));
+                res *= scale;
+            }
+
+            // Calculate square-root in case of l2 pooling
+            if (pool_type == PoolingType::L2)
+            {
+                res = std::sqrt(res);
+            }
+
+            *(reinterpret_cast<float *>(out.ptr())) = res;
+        },
+        out);
+}
+
+template <PoolingType pool_type>
+void poolingMxN_large_fp32_neon_nchw_impl(const ITensor    *src,
+                                          ITensor          *dst0,
+                                          PoolingLayerInfo &pool_info,
+                                          const Window     &window)
+{
+    const int pool_size_x = pool_info.is_global_pooling ? src->info()->tensor_shape().x() : pool_info.pool_size.width;
+    const int pool_size_y = pool_info.is_global_pooling ? src->info()->tensor_shape().y() : pool_info.pool_size.height;
+    const int pool_pad_right               = pool_info.pad_stride_info.pad_right();
+    const int pool_pad_top                 = pool_info.pad_stride_info.pad_top();
+    const int pool_pad_left                = pool_info.pad_stride_info.pad_left();
+    const int pool_pad_bottom              = pool_info.pad_stride_info.pad_bottom();
+    int       pool_stride_x                = 0;
+    int       pool_stride_y                = 0;
+    std::tie(pool_stride_x, pool_stride_y) = pool_info.pad_stride_info.stride();
+    const int   src_w                      = src->info()->dimension(0);
+    const int   src_h                      = src->info()->dimension(1);
+    const int   upper_bound_w              = src_w + (pool_info.exclude_padding ? 0 : pool_pad_right);
+    const int   upper_bound_h              = src_h + (pool_info.exclude_padding ? 0 : pool_pad_bottom);
+    const float min_value                  = get_initial_min<float>(pool_info.use_inf_as_limit);
+    const float fill_value                 = (pool_type == PoolingType::MAX) ? min_value : 0.0f;
+
+    const auto    &strides  = src->info()->strides_in_bytes();
+    const uint8_t *src_base = src->buffer() + src->info()->offset_first_element_in_bytes();
+
+    // Each iteration computes a whole output row: the pooled input rows are first reduced column by column,
+    // then every output reads its pool_size_x columns (or two prefix sums) instead of rescanning the whole region
+    const int          x_start  = window.x().start();
+    const int          x_end    = window.x().end();
+    const int          row_w    = (x_end - 1) * pool_stride_x + pool_size_x;
+    const int          num_cols = std::max(0, std::min(row_w - pool_pad_left, src_w));
+    std::vector<float> cols(row_w);
+    std::vector<float> prefix(row_w + 1, 0.f);
+
+    Window win_rows(window);
+    win_rows.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator out(dst0, win_rows);
+
+    execute_window_loop(
+        win_rows,
+        [&](const Coordinates &id)
+        {
+            const uint8_t *plane   = src_base + id.z() * strides.z() + id[3] * strides[3];
+            const int      y_in    = id.y() * pool_stride_y - pool_pad_top;
+            const int      y_begin = std::max(y_in, 0);
+            const int      y_end   = std::min(y_in + pool_size_y, src_h);
+
+            // Padded columns and rows hold the fill value
+            std::fill(cols.begin(), cols.end(), fill_value);
+            float *col = cols.data() + pool_pad_left;
+            for (int y = y_begin; y < y_end; ++y)
+            {
+                const auto in_row = reinterpret_cast<const float *>(plane + y * strides.y());
+
+                int x = 0;
+                for (; x <= num_cols - 4; x += 4)
+                {
+                    vst1q_f32(col + x, pool_accumulate<pool_type>(vld1q_f32(col + x), vld1q_f32(in_row + x)));
+                }
+                for (; x < num_cols; ++x)
+                {
+                    col[x] = pool_accumulate<pool_type>(col[x], in_row[x]);
+                }
+            }
+
+            auto out_row = reinterpret_cast<float *>(out.ptr());
+            int  x       = x_start;
+            if (pool_type == PoolingType::MAX)
+            {
+                if (pool_stride_x == 1)
+                {
+                    for (; x <= x_end - 4; x += 4)
+                    {
+                        float32x4_t res = vld1q_f32(cols.data() + x);
+                        for (int k = 1; k < pool_size_x; ++k)
+                        {
+                            res = vmaxq_f32(res, vld1q_f32(cols.data() + x + k));
+                        }
+                        vst1q_f32(out_row + x, res);
+                    }
+                }
+                for (; x < x_end; ++x)
+                {
+                    const float *region = cols.data() + x * pool_stride_x;
+                    out_row[x]          = *std::max_element(region, region + pool_size_x);
+                }
+            }
+            else
+            {
+                for (int c = 0; c < row_w; ++c)
+                {
+                    prefix[c + 1] = prefix[c] + cols[c];
+                }
+                for (; x < x_end; ++x)
+                {
+                    Coordinates pos(id);
+                    pos.set(Window::DimX, x);
+                    const float scale = calculate_avg_scale_pool2d(
+                        pool_info.exclude_padding, DataLayout::NCHW, pos, pool_size_x, pool_size_y, upper_bound_w,
+                        upper_bound_h, pool_pad_left, pool_pad_top, pool_stride_x, pool_stride_y);
+
+                    const int begin = x * pool_stride_x;
+                    float     res   = (prefix[begin + pool_size_x] - prefix[begin]) * scale;
+
+                    // Calculate square-root in case of l2 pooling
+                    if (pool_type == PoolingType::L2)
+                    {
+                        res = std::sqrt(res);
+                    }
+                    out_row[x] = res;
+                }
+            }
+        },
+        out);
+}
+} // namespace
+
+void pooling_global_fp32_neon_nchw(const ITensor    *src,
+                                   ITensor          *dst0,
+                                   ITensor          *dst1,
+                                   PoolingLayerInfo &pool_info,
+                                   const Window     &window_src,
+                                   const Window     &window)
+{
+    ARM_COMPUTE_UNUSED(dst1, window_src);
+    const float min_value = get_initial_min<float>(pool_info.use_inf_as_limit);
+    switch (pool_info.pool_type)
+    {
+        case PoolingType::MAX:
+            pooling_global_fp32_neon_nchw_impl<PoolingType::MAX>(src, dst0, min_value, window);
+            break;
+        case PoolingType::AVG:
+            pooling_global_fp32_neon_nchw_impl<PoolingType::AVG>(src, dst0, min_value, window);
+            break;
+        case PoolingType::L2:
+            pooling_global_fp32_neon_nchw_impl<PoolingType::L2>(src, dst0, min_value, window);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Pool operation not supported");
+    }
+}
+
+void poolingMxN_large_fp32_neon_nchw(const ITensor    *src,
+                                     ITensor          *dst0,
+                                     ITensor          *dst1,
+                                     PoolingLayerInfo &pool_info,
+                                     const Window     &window_src,
+                                     const Window     &window)
+{
+    ARM_COMPUTE_UNUSED(dst1, window_src);
+    switch (pool_info.pool_type)
+    {
+        case PoolingType::MAX:
+            poolingMxN_large_fp32_neon_nchw_impl<PoolingType::MAX>(src, dst0, pool_info, window);
+            break;
+        case PoolingType::AVG:
+            poolingMxN_large_fp32_neon_nchw_impl<PoolingType::AVG>(src, dst0, pool_info, window);
+            break;
+        case PoolingType::L2:
+            poolingMxN_large_fp32_neon_nchw_impl<PoolingType::L2>(src, dst0, pool_info, window);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Pool operation not supported");
+    }
+}
 } // namespace cpu
 } // namespace arm_compute
 
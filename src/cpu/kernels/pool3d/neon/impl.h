@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -74,13 +74,18 @@ void max_poolingMxNxD_fp_neon_ndhwc(const ITensor      *src,
 
     const uint8_t *in_ptr_start = src->buffer() + src->info()->offset_first_element_in_bytes();
 
+    const int output_dim_h = dst0->info()->dimension(2);
+    const int output_dim_d = dst0->info()->dimension(3);
+
     Iterator out(dst0, window_out);
 
     vector_type vres;
     execute_window_loop(
         window_out,
-        [&](const Coordinates &id)
+        [&](const Coordinates &collapsed_id)
         {
+            const Coordinates id = expand_pool3d_coordinates(collapsed_id, output_dim_h, output_dim_d);
+
             // Computing the theoretical input starting/ending points
             const int in_idx_width  = static_cast<int>(id.y()) * pool_stride_x - pool_pad_left;
             const int in_idx_height = static_cast<int>(id.z()) * pool_stride_y - pool_pad_top;
@@ -103,6 +108,37 @@ void max_poolingMxNxD_fp_neon_ndhwc(const ITensor      *src,
 
             int x_off = window_start_x;
 
+            // Four vectors of channels at a time, for each point of the pooling region
+            for (; x_off <= (window_end_x - 4 * window_step_x); x_off += 4 * window_step_x) // C
+            {
+                vector_type vacc[4];
+                for (auto &v : vacc)
+                {
+                    v = wrapper::vdup_n(static_cast<T>(-std::numeric_limits<float>::infinity()), tag_type());
+                }
+                for (int z = pool_start_z; z < pool_end_z; ++z)
+                {
+                    const uint8_t *in_ptr_z = in_ptr_n + (z + in_idx_depth) * w_stride;
+                    for (int y = pool_start_y; y < pool_end_y; ++y)
+                    {
+                        const uint8_t *in_ptr_y = in_ptr_z + (y + in_idx_height) * z_stride;
+                        for (int x = pool_start_x; x < pool_end_x; ++x)
+                        {
+                            const T *in_ptr_x =
+                                reinterpret_cast<const T *>(in_ptr_y + (x + in_idx_width) * y_stride) + x_off;
+                            for (int v = 0; v < 4; ++v)
+                            {
+                                vacc[v] = wrapper::vmax(vacc[v], wrapper::vloadq(in_ptr_x + v * window_step_x));
+                            }
+                        }
+                    }
+                }
+                for (int v = 0; v < 4; ++v)
+                {
+                    wrapper::vstore(reinterpret_cast<T *>(out.ptr()) + x_off + v * window_step_x, vacc[v]);
+                }
+            }
+
             for (; x_off <= (window_end_x - window_step_x); x_off += window_step_x) // C
             {
                 vres = wrapper::vdup_n(static_cast<T>(-std::numeric_limits<float>::infinity()), tag_type());
@@ -193,13 +229,18 @@ void avg_poolingMxNxD_fp_neon_ndhwc(const ITensor      *src,
 
     const uint8_t *in_ptr_start = src->buffer() + src->info()->offset_first_element_in_bytes();
 
+    const int output_dim_h = dst0->info()->dimension(2);
+    const int output_dim_d = dst0->info()->dimension(3);
+
     Iterator out(dst0, window_out);
 
     vector_type vres;
     execute_window_loop(
         window_out,
-        [&](const Coordinates &id)
+        [&](const Coordinates &collapsed_id)
         {
+            const Coordinates id = expand_pool3d_coordinates(collapsed_id, output_dim_h, output_dim_d);
+
             // Computing the theoretical input starting/ending points
             const int in_idx_width  = static_cast<int>(id.y()) * pool_stride_x - pool_pad_left;
             const int in_idx_height = static_cast<int>(id.z()) * pool_stride_y - pool_pad_top;
@@ -229,6 +270,38 @@ void avg_poolingMxNxD_fp_neon_ndhwc(const ITensor      *src,
 
             int x_off = window_start_x;
 
+            // Four vectors of channels at a time, for each point of the pooling region
+            for (; x_off <= (window_end_x - 4 * window_step_x); x_off += 4 * window_step_x) // C
+            {
+                vector_type vacc[4];
+                for (auto &v : vacc)
+                {
+                    v = wrapper::vdup_n(static_cast<T>(0.0f), tag_type());
+                }
+                for (int z = pool_start_z; z < pool_end_z; ++z)
+                {
+                    const uint8_t *in_ptr_z = in_ptr_n + (z + in_idx_depth) * w_stride;
+                    for (int y = pool_start_y; y < pool_end_y; ++y)
+                    {
+                        const uint8_t *in_ptr_y = in_ptr_z + (y + in_idx_height) * z_stride;
+                        for (int x = pool_start_x; x < pool_end_x; ++x)
+                        {
+                            const T *in_ptr_x =
+                                reinterpret_cast<const T *>(in_ptr_y + (x + in_idx_width) * y_stride) + x_off;
+                            for (int v = 0; v < 4; ++v)
+                            {
+                                vacc[v] = wrapper::vadd(vacc[v], wrapper::vloadq(in_ptr_x + v * window_step_x));
+                            }
+                        }
+                    }
+                }
+                for (int v = 0; v < 4; ++v)
+                {
+                    wrapper::vstore(reinterpret_cast<T *>(out.ptr()) + x_off + v * window_step_x,
+                                    wrapper::vmul(vacc[v], scale_v));
+                }
+            }
+
             for (; x_off <= (window_end_x - window_step_x); x_off += window_step_x) // C
             {
                 // Perform pooling
@@ -328,13 +401,18 @@ void l2_poolingMxNxD_fp_neon_ndhwc(const ITensor      *src,
 
     const uint8_t *in_ptr_start = src->buffer() + src->info()->offset_first_element_in_bytes();
 
+    const int output_dim_h = dst0->info()->dimension(2);
+    const int output_dim_d = dst0->info()->dimension(3);
+
     Iterator out(dst0, window_out);
 
     vector_type vres;
     execute_window_loop(
         window_out,
-        [&](const Coordinates &id)
+        [&](const Coordinates &collapsed_id)
         {
+            const Coordinates id = expand_pool3d_coordinates(collapsed_id, output_dim_h, output_dim_d);
+
             // Computing the theoretical input starting/ending points
             const int in_idx_width  = static_cast<int>(id.y()) * pool_stride_x - pool_pad_left;
             const int in_idx_height = static_cast<int>(id.z()) * pool_stride_y - pool_pad_top;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, 2024 Arm Limited.
+ * Copyright (c) 2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -81,6 +81,9 @@ void avg_poolingMxNxD_q8_neon_ndhwc(
     const int window_end_x   = input_dim_c;
     const int window_start_x = 0;
 
+    const int output_dim_h = dst0->info()->dimension(2);
+    const int output_dim_d = dst0->info()->dimension(3);
+
     Iterator out(dst0, window_out);
 
     const UniformQuantizationInfo src_qinfo = src->info()->quantization_info().uniform();
@@ -92,8 +95,10 @@ void avg_poolingMxNxD_q8_neon_ndhwc(
 
     execute_window_loop(
         window_out,
-        [&](const Coordinates &id)
+        [&](const Coordinates &collapsed_id)
         {
+            const Coordinates id = expand_pool3d_coordinates(collapsed_id, output_dim_h, output_dim_d);
+
             // Computing the theoretical input starting/ending points
             const int in_idx_width  = static_cast<int>(id.y()) * pool_stride_x - pool_pad_left;
             const int in_idx_height = static_cast<int>(id.z()) * pool_stride_y - pool_pad_top;
@@ -271,6 +276,9 @@ void max_poolingMxNxD_q8_neon_ndhwc(
     const int window_end_x   = input_dim_c;
     const int window_start_x = 0;
 
+    const int output_dim_h = dst0->info()->dimension(2);
+    const int output_dim_d = dst0->info()->dimension(3);
+
     Iterator out(dst0, window_out);
 
     const UniformQuantizationInfo src_qinfo = src->info()->quantization_info().uniform();
@@ -283,8 +291,10 @@ void max_poolingMxNxD_q8_neon_ndhwc(
 
     execute_window_loop(
         window_out,
-        [&](const Coordinates &id)
+        [&](const Coordinates &collapsed_id)
         {
+            const Coordinates id = expand_pool3d_coordinates(collapsed_id, output_dim_h, output_dim_d);
+
             // Computing the theoretical input starting/ending points
             const int in_idx_width  = static_cast<int>(id.y()) * pool_stride_x - pool_pad_left;
             const int in_idx_height = static_cast<int>(id.z()) * pool_stride_y - pool_pad_top;
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_PREPROCESS_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_PREPROCESS_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/scale/neon/area.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace preprocess
+{
+/** Full range BT.601 coefficients of the chroma components */
+constexpr float r_v_coef = 1.402f;
+constexpr float g_u_coef = 0.344136f;
+constexpr float g_v_coef = 0.714136f;
+constexpr float b_u_coef = 1.772f;
+
+inline float32x4_t u8_to_f32(uint16x4_t v)
+{
+    return vcvtq_f32_u32(vmovl_u16(v));
+}
+
+inline float32x4_t clamp_u8_range(float32x4_t v)
+{
+    return vminq_f32(vmaxq_f32(v, vdupq_n_f32(0.f)), vdupq_n_f32(255.f));
+}
+
+inline void store_rgb(float *rgb, float32x4_t y, float32x4_t u, float32x4_t v)
+{
+    float32x4x3_t pixels;
+    pixels.val[0] = clamp_u8_range(vmlaq_n_f32(y, v, r_v_coef));
+    pixels.val[1] = clamp_u8_range(vmlsq_n_f32(vmlsq_n_f32(y, u, g_u_coef), v, g_v_coef));
+    pixels.val[2] = clamp_u8_range(vmlaq_n_f32(y, u, b_u_coef));
+    vst3q_f32(rgb, pixels);
+}
+
+/** Convert the pixels [@p begin, @p end) of a semi-planar 4:2:0 row to interleaved RGB values in [0, 255]
+ *
+ * @param[in]  y_row   Luma row.
+ * @param[in]  uv_row  Interleaved chroma row shared by two luma rows, UV for NV12 and VU for NV21.
+ * @param[in]  is_nv21 True if the chroma components are stored as VU.
+ * @param[in]  begin   First pixel to convert, must be even.
+ * @param[in]  end     End of the pixels to convert.
+ * @param[out] rgb     Row of 3 values per pixel, indexed from the start of the row.
+ */
+inline void yuv420sp_to_rgb(
+    const uint8_t *y_row, const uint8_t *uv_row, bool is_nv21, int begin, int end, float *rgb)
+{
+    const int u_idx = is_nv21 ? 1 : 0;
+    const int v_idx = 1 - u_idx;
+
+    int x = begin;
+    for (; x <= end - 8; x += 8)
+    {
+        // Each chroma pair is shared by two neighbouring pixels
+        const uint8x8_t   luma   = vld1_u8(y_row + x);
+        const uint8x8_t   chroma = vld1_u8(uv_row + x);
+        const uint8x8x2_t split  = vuzp_u8(chroma, chroma);
+        const uint16x8_t  u      = vmovl_u8(vzip_u8(split.val[u_idx], split.val[u_idx]).val[0]);
+        const uint16x8_t  v      = vmovl_u8(vzip_u8(split.val[v_idx], split.val[v_idx]).val[0]);
+        const uint16x8_t  y      = vmovl_u8(luma);
+
+        const float32x4_t offset = vdupq_n_f32(128.f);
+        store_rgb(rgb + 3 * x, u8_to_f32(vget_low_u16(y)), vsubq_f32(u8_to_f32(vget_low_u16(u)), offset),
+                  vsubq_f32(u8_to_f32(vget_low_u16(v)), offset));
+        store_rgb(rgb + 3 * (x + 4), u8_to_f32(vget_high_u16(y)), vsubq_f32(u8_to_f32(vget_high_u16(u)), offset),
+                  vsubq_f32(u8_to_f32(vget_high_u16(v)), offset));
+    }
+    for (; x < end; ++x)
+    {
+        const float y  = y_row[x];
+        const float u  = uv_row[(x & ~1) + u_idx] - 128.f;
+        const float v  = uv_row[(x & ~1) + v_idx] - 128.f;
+        rgb[3 * x]     = std::min(std::max(y + r_v_coef * v, 0.f), 255.f);
+        rgb[3 * x + 1] = std::min(std::max(y - g_u_coef * u - g_v_coef * v, 0.f), 255.f);
+        rgb[3 * x + 2] = std::min(std::max(y + b_u_coef * u, 0.f), 255.f);
+    }
+}
+
+/** Convert an image to RGB, resize it with area interpolation and normalize it in a single pass
+ *
+ * Packed RGB888 and RGBA8888 rows are reduced directly from their U8 values. Semi-planar YUV rows are converted to
+ * RGB once per source row, only over the columns covered by the window, before being reduced. The reduced rows are
+ * reordered to BGR when requested, then follow the vertical pass and normalization of @ref area::scale_area_rows.
+ */
+template <typename TOut>
+void neon_preprocess(const ITensor *src,
+                     ITensor       *dst,
+                     Format         format,
+                     bool           bgr,
+                     const float   *channel_scale,
+                     const float   *channel_bias,
+                     const Window  &window)
+{
+    const ITensorInfo &src_info = *src->info();
+    const bool         is_yuv   = format == Format::NV12 || format == Format::NV21;
+
+    const int in_w = static_cast<int>(is_yuv ? src_info.dimension(0) : src_info.dimension(1));
+    const int in_h = static_cast<int>(is_yuv ? src_info.dimension(1) * 2 / 3 : src_info.dimension(2));
+
+    const float           wr      = static_cast<float>(in_w) / dst->info()->dimension(1);
+    const area::AreaSpans columns = area::compute_area_spans(in_w, wr, window.y().start(), window.y().end());
+
+    const int      num_columns = window.y().end() - window.y().start();
+    const size_t   row_stride  = src_info.strides_in_bytes()[is_yuv ? 1 : 2];
+    const uint8_t *src_base    = src->buffer() + src_info.offset_first_element_in_bytes();
+
+    // Source columns read by the window, the first one is even to share the chroma pairs
+    const int          first_column = columns.starts.front() & ~1;
+    const int          last_column  = columns.starts.back() + columns.counts.back();
+    std::vector<float> rgb(is_yuv ? static_cast<size_t>(in_w) * 3 : 0);
+
+    const auto reduce_source_row = [&](int n, int source_row, float *hrow)
+    {
+        ARM_COMPUTE_UNUSED(n);
+        if (is_yuv)
+        {
+            const uint8_t *y_row  = src_base + source_row * row_stride;
+            const uint8_t *uv_row = src_base + (in_h + source_row / 2) * row_stride;
+            yuv420sp_to_rgb(y_row, uv_row, format == Format::NV21, first_column, last_column, rgb.data());
+            area::reduce_row<float>(reinterpret_cast<const uint8_t *>(rgb.data()), 3 * sizeof(float), columns, 3,
+                                    hrow);
+        }
+        else
+        {
+            area::reduce_row<uint8_t>(src_base + source_row * row_stride, src_info.strides_in_bytes()[1], columns, 3,
+                                      hrow);
+        }
+        if (bgr)
+        {
+            for (int x = 0; x < num_columns; ++x)
+            {
+                std::swap(hrow[3 * x], hrow[3 * x + 2]);
+            }
+        }
+    };
+
+    area::scale_area_rows<TOut>(dst, in_h, columns, channel_scale, channel_bias, window, reduce_source_row);
+}
+} // namespace preprocess
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_PREPROCESS_GENERIC_NEON_IMPL_H
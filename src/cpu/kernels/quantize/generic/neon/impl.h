@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -120,7 +120,7 @@ void run_quantize_qsymm8(const ITensor *src, ITensor *dst, const Window &window)
 
     Iterator input(src, win_collapsed);
     Iterator output(dst, win_collapsed);
-    execute_window_loop(
+    execute_window_loop_dims<3>(
         win_collapsed,
         [&](const Coordinates &)
         {
@@ -161,7 +161,7 @@ void run_requantize_offset_only_convert(const ITensor *src, ITensor *dst, const
 
     Iterator input(src, win_collapsed);
     Iterator output(dst, win_collapsed);
-    execute_window_loop(
+    execute_window_loop_dims<3>(
         win_collapsed,
         [&](const Coordinates &)
         {
@@ -212,7 +212,7 @@ void run_requantize_offset_only(const ITensor *src, ITensor *dst, const Window &
 
     Iterator input(src, win_collapsed);
     Iterator output(dst, win_collapsed);
-    execute_window_loop(
+    execute_window_loop_dims<3>(
         win_collapsed,
         [&](const Coordinates &)
         {
@@ -277,7 +277,7 @@ void run_quantize_qasymm8(const ITensor *src, ITensor *dst, const Window &window
 
     Iterator input(src, win_collapsed);
     Iterator output(dst, win_collapsed);
-    execute_window_loop(
+    execute_window_loop_dims<3>(
         win_collapsed,
         [&](const Coordinates &)
         {
@@ -336,7 +336,7 @@ void run_quantize_qasymm16(const ITensor *src, ITensor *dst, const Window &windo
 
     Iterator input(src, win_collapsed);
     Iterator output(dst, win_collapsed);
-    execute_window_loop(
+    execute_window_loop_dims<3>(
         win_collapsed,
         [&](const Coordinates &)
         {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,15 @@ void reduce_RedOpX_reduceX_float16_8(const Window            &window,
     return Reducer<RedOpX<float16_t, 8>>::reduceX(window, input, output, RedOpX<float16_t, 8>(), op);
 }
 
+void reduce_ArgMinMaxX_float16_8(const Window            &window,
+                                 const ITensor           *input,
+                                 ITensor                 *output,
+                                 const ReductionOperation op)
+{
+    using ArgOp = ArgMinMaxX<float16_t, RedOpX<float16_t, 8>>;
+    return Reducer<ArgOp>::reduceX(window, input, output, ArgOp(), op);
+}
+
 void reduce_RedOpYZW_reduceY_float16_8(const Window            &window,
                                        const ITensor           *input,
                                        ITensor                 *output,
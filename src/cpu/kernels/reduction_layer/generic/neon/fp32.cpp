@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,6 +45,15 @@ void reduce_RedOpX_reduceX_float32_4(const Window            &window,
     return Reducer<RedOpX<float, 4>>::reduceX(window, input, output, RedOpX<float, 4>(), op);
 }
 
+void reduce_ArgMinMaxX_float32_4(const Window            &window,
+                                 const ITensor           *input,
+                                 ITensor                 *output,
+                                 const ReductionOperation op)
+{
+    using ArgOp = ArgMinMaxX<float, RedOpX<float, 4>>;
+    return Reducer<ArgOp>::reduceX(window, input, output, ArgOp(), op);
+}
+
 void reduce_RedOpYZW_reduceY_float32_4(const Window            &window,
                                        const ITensor           *input,
                                        ITensor                 *output,
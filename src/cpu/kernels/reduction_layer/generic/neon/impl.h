@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -893,6 +893,221 @@ struct RedOpX_quantized
     }
 };
 
+/** Mask of the lanes of @p a holding a better candidate than the ones of @p b
+ *
+ * The comparison is strict so that each lane keeps the first position of its extremum.
+ */
+template <bool IsMax, typename V>
+inline auto arg_min_max_better(const V &a, const V &b) -> decltype(wrapper::vcgt(a, b))
+{
+    return IsMax ? wrapper::vcgt(a, b) : wrapper::vclt(a, b);
+}
+
+/** Merge a candidate into the extremum of a row, the smallest index winning the ties */
+template <bool IsMax, typename T>
+inline void arg_min_max_merge(T value, uint32_t index, T &best, uint32_t &best_index)
+{
+    const bool better = IsMax ? (value > best) : (value < best);
+    if (better || (value == best && index < best_index))
+    {
+        best       = value;
+        best_index = index;
+    }
+}
+
+/** Half of a lane mask, widened to 16 bits */
+inline uint16x8_t arg_min_max_mask_half(const uint8x16_t &mask, int half)
+{
+    const uint8x8_t m = half == 0 ? vget_low_u8(mask) : vget_high_u8(mask);
+    return vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(m)));
+}
+
+inline uint16x8_t arg_min_max_mask_half(const uint16x8_t &mask, int half)
+{
+    ARM_COMPUTE_UNUSED(half);
+    return mask;
+}
+
+/** Index of the extremum of a row of 32-bit elements
+ *
+ * Two vectors of values and their element indices are tracked per iteration to hide the latency of the selects.
+ */
+template <bool IsMax, typename T>
+inline typename std::enable_if<sizeof(T) == 4, uint32_t>::type
+arg_min_max_row(const T *src, int start, int end)
+{
+    constexpr int num_lanes = 4;
+    constexpr int step      = 2 * num_lanes;
+
+    T        best       = src[start];
+    uint32_t best_index = start;
+    int      x          = start;
+    if (end - start >= step)
+    {
+        const uint32_t lane_offsets[num_lanes] = {0, 1, 2, 3};
+        const uint32x4_t vec_step              = vdupq_n_u32(step);
+
+        auto       best0     = wrapper::vloadq(src + x);
+        auto       best1     = wrapper::vloadq(src + x + num_lanes);
+        uint32x4_t index0    = vaddq_u32(vdupq_n_u32(x), vld1q_u32(lane_offsets));
+        uint32x4_t index1    = vaddq_u32(index0, vdupq_n_u32(num_lanes));
+        uint32x4_t best_idx0 = index0;
+        uint32x4_t best_idx1 = index1;
+        for (x += step; x <= end - step; x += step)
+        {
+            index0 = vaddq_u32(index0, vec_step);
+            index1 = vaddq_u32(index1, vec_step);
+
+            const auto vec0  = wrapper::vloadq(src + x);
+            const auto vec1  = wrapper::vloadq(src + x + num_lanes);
+            const auto mask0 = arg_min_max_better<IsMax>(vec0, best0);
+            const auto mask1 = arg_min_max_better<IsMax>(vec1, best1);
+            best0            = wrapper::vbsl(mask0, vec0, best0);
+            best1            = wrapper::vbsl(mask1, vec1, best1);
+            best_idx0        = vbslq_u32(mask0, index0, best_idx0);
+            best_idx1        = vbslq_u32(mask1, index1, best_idx1);
+        }
+
+        T        values[step];
+        uint32_t indices[step];
+        wrapper::vstore(values, best0);
+        wrapper::vstore(values + num_lanes, best1);
+        vst1q_u32(indices, best_idx0);
+        vst1q_u32(indices + num_lanes, best_idx1);
+        best       = values[0];
+        best_index = indices[0];
+        for (int i = 1; i < step; ++i)
+        {
+            arg_min_max_merge<IsMax>(values[i], indices[i], best, best_index);
+        }
+    }
+
+    // Compute left-over elements
+    for (; x < end; ++x)
+    {
+        if (IsMax ? (src[x] > best) : (src[x] < best))
+        {
+            best       = src[x];
+            best_index = x;
+        }
+    }
+    return best_index;
+}
+
+/** Index of the extremum of a row of 8 or 16-bit elements
+ *
+ * Only the block of vector each lane found its extremum in is tracked, on 16 bits, the index of the element being
+ * rebuilt from it and the lane once the row is reduced. This keeps the selects as narrow as the values, but limits
+ * the rows to 65536 vectors, see @ref arg_min_max_row_fits.
+ */
+template <bool IsMax, typename T>
+inline typename std::enable_if<sizeof(T) < 4, uint32_t>::type
+arg_min_max_row(const T *src, int start, int end)
+{
+    constexpr int num_lanes  = 16 / sizeof(T);
+    constexpr int num_halves = num_lanes / 8;
+
+    T        best       = src[start];
+    uint32_t best_index = start;
+    int      x          = start;
+    if (end - start >= num_lanes)
+    {
+        auto       best_vec = wrapper::vloadq(src + x);
+        uint16x8_t block    = vdupq_n_u16(0);
+        uint16x8_t best_blocks[num_halves];
+        for (int h = 0; h < num_halves; ++h)
+        {
+            best_blocks[h] = block;
+        }
+        for (x += num_lanes; x <= end - num_lanes; x += num_lanes)
+        {
+            block = vaddq_u16(block, vdupq_n_u16(1));
+
+            const auto vec  = wrapper::vloadq(src + x);
+            const auto mask = arg_min_max_better<IsMax>(vec, best_vec);
+            best_vec        = wrapper::vbsl(mask, vec, best_vec);
+            for (int h = 0; h < num_halves; ++h)
+            {
+                best_blocks[h] = vbslq_u16(arg_min_max_mask_half(mask, h), block, best_blocks[h]);
+            }
+        }
+
+        T        values[num_lanes];
+        uint16_t blocks[num_lanes];
+        wrapper::vstore(values, best_vec);
+        for (int h = 0; h < num_halves; ++h)
+        {
+            vst1q_u16(blocks + 8 * h, best_blocks[h]);
+        }
+        best       = values[0];
+        best_index = start + blocks[0] * num_lanes;
+        for (int i = 1; i < num_lanes; ++i)
+        {
+            arg_min_max_merge<IsMax>(values[i], start + blocks[i] * num_lanes + i, best, best_index);
+        }
+    }
+
+    // Compute left-over elements
+    for (; x < end; ++x)
+    {
+        if (IsMax ? (src[x] > best) : (src[x] < best))
+        {
+            best       = src[x];
+            best_index = x;
+        }
+    }
+    return best_index;
+}
+
+/** Check whether the rows of @p row_size elements can be reduced by @ref arg_min_max_row */
+template <typename T>
+inline bool arg_min_max_row_fits(int row_size)
+{
+    return sizeof(T) == 4 || row_size / static_cast<int>(16 / sizeof(T)) <= 65536;
+}
+
+/** ARG_IDX_MIN and ARG_IDX_MAX along X
+ *
+ * The value and the index of the extremum of each lane are tracked in parallel and reduced horizontally once per
+ * row, with the operation resolved before the loops. The rows too long for @ref arg_min_max_row are reduced by
+ * @p Fallback.
+ */
+template <typename T, typename Fallback>
+struct ArgMinMaxX
+{
+    inline void operator()(
+        const Window &in_window, Window &out_window, const ITensor *in, ITensor *out, const ReductionOperation op)
+    {
+        ARM_COMPUTE_ERROR_ON(op != ReductionOperation::ARG_IDX_MIN && op != ReductionOperation::ARG_IDX_MAX);
+
+        const auto window_start_x = static_cast<int>(in_window.x().start());
+        const auto window_end_x   = static_cast<int>(in_window.x().end());
+        if (window_end_x <= window_start_x || !arg_min_max_row_fits<T>(window_end_x - window_start_x))
+        {
+            Fallback()(in_window, out_window, in, out, op);
+            return;
+        }
+
+        const auto row_fn =
+            op == ReductionOperation::ARG_IDX_MAX ? &arg_min_max_row<true, T> : &arg_min_max_row<false, T>;
+
+        Window in_win_no_pad = in_window;
+        in_win_no_pad.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+        Iterator input(in, in_win_no_pad);
+        Iterator output(out, out_window);
+
+        execute_window_loop(
+            in_win_no_pad,
+            [&](const Coordinates &)
+            {
+                *reinterpret_cast<uint32_t *>(output.ptr()) =
+                    row_fn(reinterpret_cast<const T *>(input.ptr()), window_start_x, window_end_x);
+            },
+            input, output);
+    }
+};
+
 template <typename T, int S>
 struct RedOpYZW
 {
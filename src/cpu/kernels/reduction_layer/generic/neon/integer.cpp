@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,15 @@ void reduce_RedOpX_reduceX_S32_4(const Window            &window,
     return Reducer<RedOpX<int32_t, 4>>::reduceX(window, input, output, RedOpX<int32_t, 4>(), op);
 }
 
+void reduce_ArgMinMaxX_S32_4(const Window            &window,
+                             const ITensor           *input,
+                             ITensor                 *output,
+                             const ReductionOperation op)
+{
+    using ArgOp = ArgMinMaxX<int32_t, RedOpX<int32_t, 4>>;
+    return Reducer<ArgOp>::reduceX(window, input, output, ArgOp(), op);
+}
+
 void reduce_RedOpYZW_reduceY_S32_4(const Window            &window,
                                    const ITensor           *input,
                                    ITensor                 *output,
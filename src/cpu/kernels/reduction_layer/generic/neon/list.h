@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,26 +36,31 @@ namespace cpu
 
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_complex_reduceZ_float32_4_2_SUM);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpX_reduceX_float32_4);
+DECLARE_REDUCTION_KERNEL(reduce_ArgMinMaxX_float32_4);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceY_float32_4);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceZ_float32_4);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceW_float32_4);
 
 DECLARE_REDUCTION_KERNEL(reduce_RedOpX_reduceX_float16_8);
+DECLARE_REDUCTION_KERNEL(reduce_ArgMinMaxX_float16_8);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceY_float16_8);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceZ_float16_8);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceW_float16_8);
 
 DECLARE_REDUCTION_KERNEL(reduce_RedOpX_reduceX_S32_4);
+DECLARE_REDUCTION_KERNEL(reduce_ArgMinMaxX_S32_4);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceY_S32_4);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceZ_S32_4);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceW_S32_4);
 
 DECLARE_REDUCTION_KERNEL(reduce_RedOpX_reduceX_qasymm8);
+DECLARE_REDUCTION_KERNEL(reduce_ArgMinMaxX_qasymm8);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceY_qasymm8);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceZ_qasymm8);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceW_qasymm8);
 
 DECLARE_REDUCTION_KERNEL(reduce_RedOpX_reduceX_qasymm8_signed);
+DECLARE_REDUCTION_KERNEL(reduce_ArgMinMaxX_qasymm8_signed);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceY_qasymm8_signed);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceZ_qasymm8_signed);
 DECLARE_REDUCTION_KERNEL(reduce_RedOpYZW_reduceW_qasymm8_signed);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,15 @@ void reduce_RedOpX_reduceX_qasymm8(const Window            &window,
     return Reducer<RedOpX_quantized<uint8_t>>::reduceX(window, input, output, RedOpX_quantized<uint8_t>(), op);
 }
 
+void reduce_ArgMinMaxX_qasymm8(const Window            &window,
+                               const ITensor           *input,
+                               ITensor                 *output,
+                               const ReductionOperation op)
+{
+    using ArgOp = ArgMinMaxX<uint8_t, RedOpX_quantized<uint8_t>>;
+    return Reducer<ArgOp>::reduceX(window, input, output, ArgOp(), op);
+}
+
 void reduce_RedOpYZW_reduceY_qasymm8(const Window            &window,
                                      const ITensor           *input,
                                      ITensor                 *output,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023 Arm Limited.
+ * Copyright (c) 2019-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,9 @@
 #include "arm_compute/core/CPP/CPPTypes.h"
 #include "arm_compute/core/Helpers.h"
 
+#include <arm_neon.h>
+#include <vector>
+
 namespace arm_compute
 {
 class ITensor;
@@ -264,6 +267,161 @@ inline input_data_type roi_align_1x1_qasymm8(const ITensor          *input,
         return res;
     }
 }
+/** Accumulates the bilinear interpolation of all the channels of an NHWC point
+ *
+ * @param[in, out] acc          Accumulators of the channels
+ * @param[in]      data1        Channels of the top left neighbour
+ * @param[in]      data2        Channels of the top right neighbour
+ * @param[in]      data3        Channels of the bottom left neighbour
+ * @param[in]      data4        Channels of the bottom right neighbour
+ * @param[in]      w1           Weight of the top left neighbour
+ * @param[in]      w2           Weight of the top right neighbour
+ * @param[in]      w3           Weight of the bottom left neighbour
+ * @param[in]      w4           Weight of the bottom right neighbour
+ * @param[in]      num_channels Number of channels
+ */
+template <typename input_data_type>
+inline void accumulate_bilinear_channels(float                 *acc,
+                                         const input_data_type *data1,
+                                         const input_data_type *data2,
+                                         const input_data_type *data3,
+                                         const input_data_type *data4,
+                                         float                  w1,
+                                         float                  w2,
+                                         float                  w3,
+                                         float                  w4,
+                                         int                    num_channels)
+{
+    for (int c = 0; c < num_channels; ++c)
+    {
+        acc[c] += w1 * float(data1[c]) + w2 * float(data2[c]) + w3 * float(data3[c]) + w4 * float(data4[c]);
+    }
+}
+
+template <>
+inline void accumulate_bilinear_channels<float>(float       *acc,
+                                                const float *data1,
+                                                const float *data2,
+                                                const float *data3,
+                                                const float *data4,
+                                                float        w1,
+                                                float        w2,
+                                                float        w3,
+                                                float        w4,
+                                                int          num_channels)
+{
+    int c = 0;
+    for (; c <= num_channels - 4; c += 4)
+    {
+        float32x4_t sum = vld1q_f32(acc + c);
+        sum             = vmlaq_n_f32(sum, vld1q_f32(data1 + c), w1);
+        sum             = vmlaq_n_f32(sum, vld1q_f32(data2 + c), w2);
+        sum             = vmlaq_n_f32(sum, vld1q_f32(data3 + c), w3);
+        sum             = vmlaq_n_f32(sum, vld1q_f32(data4 + c), w4);
+        vst1q_f32(acc + c, sum);
+    }
+    for (; c < num_channels; ++c)
+    {
+        acc[c] += w1 * data1[c] + w2 * data2[c] + w3 * data3[c] + w4 * data4[c];
+    }
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template <>
+inline void accumulate_bilinear_channels<float16_t>(float           *acc,
+                                                    const float16_t *data1,
+                                                    const float16_t *data2,
+                                                    const float16_t *data3,
+                                                    const float16_t *data4,
+                                                    float            w1,
+                                                    float            w2,
+                                                    float            w3,
+                                                    float            w4,
+                                                    int              num_channels)
+{
+    int c = 0;
+    for (; c <= num_channels - 4; c += 4)
+    {
+        float32x4_t sum = vld1q_f32(acc + c);
+        sum             = vmlaq_n_f32(sum, vcvt_f32_f16(vld1_f16(data1 + c)), w1);
+        sum             = vmlaq_n_f32(sum, vcvt_f32_f16(vld1_f16(data2 + c)), w2);
+        sum             = vmlaq_n_f32(sum, vcvt_f32_f16(vld1_f16(data3 + c)), w3);
+        sum             = vmlaq_n_f32(sum, vcvt_f32_f16(vld1_f16(data4 + c)), w4);
+        vst1q_f32(acc + c, sum);
+    }
+    for (; c < num_channels; ++c)
+    {
+        acc[c] += w1 * float(data1[c]) + w2 * float(data2[c]) + w3 * float(data3[c]) + w4 * float(data4[c]);
+    }
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Average pooling over an aligned window of all the channels of an NHWC input
+ *
+ * The sampling points and their weights don't depend on the channel, so all the channels of a point are interpolated
+ * at once from the contiguous channels of its neighbours. The averages are written to @p acc, in the quantized domain
+ * of the input for quantized types, and false is returned if the region is empty.
+ */
+template <typename input_data_type>
+inline bool roi_align_1x1_nhwc(const ITensor *input,
+                               float         *acc,
+                               unsigned int   roi_batch,
+                               int            num_channels,
+                               float          region_start_x,
+                               float          bin_size_x,
+                               int            grid_size_x,
+                               float          region_end_x,
+                               float          region_start_y,
+                               float          bin_size_y,
+                               int            grid_size_y,
+                               float          region_end_y)
+{
+    if ((region_end_x <= region_start_x) || (region_end_y <= region_start_y))
+    {
+        return false;
+    }
+
+    std::fill_n(acc, num_channels, 0.f);
+    for (int iy = 0; iy < grid_size_y; ++iy)
+    {
+        for (int ix = 0; ix < grid_size_x; ++ix)
+        {
+            // Align the window in the middle of every bin
+            float y = region_start_y + (iy + 0.5) * bin_size_y / float(grid_size_y);
+            float x = region_start_x + (ix + 0.5) * bin_size_x / float(grid_size_x);
+
+            // Interpolation in the [0,0] [0,1] [1,0] [1,1] square
+            const int y_low  = y;
+            const int x_low  = x;
+            const int y_high = y_low + 1;
+            const int x_high = x_low + 1;
+
+            const float ly = y - y_low;
+            const float lx = x - x_low;
+            const float hy = 1. - ly;
+            const float hx = 1. - lx;
+
+            const auto *data1 = reinterpret_cast<const input_data_type *>(
+                input->ptr_to_element(Coordinates(0, x_low, y_low, roi_batch)));
+            const auto *data2 = reinterpret_cast<const input_data_type *>(
+                input->ptr_to_element(Coordinates(0, x_high, y_low, roi_batch)));
+            const auto *data3 = reinterpret_cast<const input_data_type *>(
+                input->ptr_to_element(Coordinates(0, x_low, y_high, roi_batch)));
+            const auto *data4 = reinterpret_cast<const input_data_type *>(
+                input->ptr_to_element(Coordinates(0, x_high, y_high, roi_batch)));
+            accumulate_bilinear_channels<input_data_type>(acc, data1, data2, data3, data4, hy * hx, hy * lx, ly * hx,
+                                                          ly * lx, num_channels);
+        }
+    }
+
+    const float scale = 1.f / (grid_size_x * grid_size_y);
+    for (int c = 0; c < num_channels; ++c)
+    {
+        acc[c] *= scale;
+    }
+    return true;
+}
+
 inline float compute_region_coordinate(int p, float bin_size, float roi_anchor, float max_value)
 {
     const float region_start = p * bin_size + roi_anchor;
@@ -283,8 +441,8 @@ void roi_align(const ITensor      *input,
     const DataLayout data_layout    = input->info()->data_layout();
     const size_t     values_per_roi = rois->info()->dimension(0);
 
-    const int roi_list_start = window.x().start();
-    const int roi_list_end   = window.x().end();
+    const int roi_list_start = window.y().start();
+    const int roi_list_end   = window.y().end();
 
     const unsigned int idx_width  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
     const unsigned int idx_height = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
@@ -301,6 +459,9 @@ void roi_align(const ITensor      *input,
 
     const auto             *rois_ptr   = reinterpret_cast<const roi_data_type *>(rois->buffer());
     const QuantizationInfo &rois_qinfo = rois->info()->quantization_info();
+
+    // Averages of all the channels of an output point of an NHWC input
+    std::vector<float> channel_acc(data_layout == DataLayout::NHWC ? input_chanels : 0);
     for (int roi_indx = roi_list_start; roi_indx < roi_list_end; ++roi_indx)
     {
         const unsigned int roi_batch = rois_ptr[values_per_roi * roi_indx];
@@ -327,6 +488,55 @@ void roi_align(const ITensor      *input,
         float       bin_size_x   = roi_dims_x / pool_info.pooled_width();
         float       bin_size_y   = roi_dims_y / pool_info.pooled_height();
 
+        if (data_layout == DataLayout::NHWC)
+        {
+            const UniformQuantizationInfo input_qinfo  = input->info()->quantization_info().uniform();
+            const UniformQuantizationInfo output_qinfo = output->info()->quantization_info().uniform();
+            for (int py = 0; py < pooled_h; ++py)
+            {
+                for (int px = 0; px < pooled_w; ++px)
+                {
+                    const float region_start_x = compute_region_coordinate(px, bin_size_x, roi_anchor_x, input_width);
+                    const float region_start_y = compute_region_coordinate(py, bin_size_y, roi_anchor_y, input_height);
+                    const float region_end_x = compute_region_coordinate(px + 1, bin_size_x, roi_anchor_x, input_width);
+                    const float region_end_y =
+                        compute_region_coordinate(py + 1, bin_size_y, roi_anchor_y, input_height);
+                    const int roi_bin_grid_x =
+                        (pool_info.sampling_ratio() > 0) ? pool_info.sampling_ratio() : int(ceil(bin_size_x));
+                    const int roi_bin_grid_y =
+                        (pool_info.sampling_ratio() > 0) ? pool_info.sampling_ratio() : int(ceil(bin_size_y));
+
+                    const bool is_valid = roi_align_1x1_nhwc<input_data_type>(
+                        input, channel_acc.data(), roi_batch, input_chanels, region_start_x, bin_size_x,
+                        roi_bin_grid_x, region_end_x, region_start_y, bin_size_y, roi_bin_grid_y, region_end_y);
+
+                    auto out_ptr =
+                        reinterpret_cast<input_data_type *>(output->ptr_to_element(Coordinates(0, px, py, roi_indx)));
+                    for (int ch = 0; ch < input_chanels; ++ch)
+                    {
+                        if (!is_qasymm)
+                        {
+                            out_ptr[ch] = is_valid ? input_data_type(channel_acc[ch]) : input_data_type(0);
+                        }
+                        else if (!is_valid)
+                        {
+                            out_ptr[ch] = input_data_type(output_qinfo.offset);
+                        }
+                        else
+                        {
+                            // Dequantization is affine, so the average of the dequantized values is the dequantized
+                            // average
+                            const float avg = (channel_acc[ch] - input_qinfo.offset) * input_qinfo.scale;
+                            out_ptr[ch]     = is_data_type_quantized_asymmetric_signed(data_type)
+                                                  ? input_data_type(quantize_qasymm8_signed(avg, output_qinfo))
+                                                  : input_data_type(quantize_qasymm8(avg, output_qinfo));
+                        }
+                    }
+                }
+            }
+            continue;
+        }
+
         // Iterate through all feature maps
         for (int ch = 0; ch < input_chanels; ++ch)
         {
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_SCALE_NEON_AREA_H
+#define ACL_SRC_CPU_KERNELS_SCALE_NEON_AREA_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/Window.h"
+
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace area
+{
+/** Source pixels covered by the destination pixels along one axis
+ *
+ * Destination pixel o covers the source interval [o * ratio, (o + 1) * ratio). Each source pixel it overlaps is
+ * weighted by the length of the overlap, the weights of a destination pixel sum to 1.
+ */
+struct AreaSpans
+{
+    std::vector<int>   starts{};  /**< First source pixel of each destination pixel */
+    std::vector<int>   counts{};  /**< Number of source pixels of each destination pixel */
+    std::vector<int>   offsets{}; /**< Offset of the first weight of each destination pixel in @ref weights */
+    std::vector<float> weights{}; /**< Weights of the source pixels of all the destination pixels */
+};
+
+inline AreaSpans compute_area_spans(int in_len, float ratio, int out_begin, int out_end)
+{
+    AreaSpans spans;
+    for (int o = out_begin; o < out_end; ++o)
+    {
+        const float f0    = std::min(o * ratio, static_cast<float>(in_len));
+        const float f1    = std::min((o + 1) * ratio, static_cast<float>(in_len));
+        const int   start = std::min(static_cast<int>(std::floor(f0)), in_len - 1);
+        const int   end   = std::max(std::min(static_cast<int>(std::ceil(f1)), in_len), start + 1);
+
+        spans.starts.push_back(start);
+        spans.counts.push_back(end - start);
+        spans.offsets.push_back(static_cast<int>(spans.weights.size()));
+        if (f1 <= f0)
+        {
+            spans.weights.push_back(1.f);
+            continue;
+        }
+        const float inv_len = 1.f / (f1 - f0);
+        for (int i = start; i < end; ++i)
+        {
+            spans.weights.push_back((std::min(i + 1.f, f1) - std::max(static_cast<float>(i), f0)) * inv_len);
+        }
+    }
+    return spans;
+}
+
+inline float32x4_t multiply_add(float32x4_t acc, float32x4_t a, float32x4_t b)
+{
+#ifdef __aarch64__
+    return vfmaq_f32(acc, a, b);
+#else  // __aarch64__
+    return vmlaq_f32(acc, a, b);
+#endif // __aarch64__
+}
+
+/** Add @p weight times the channels of a source pixel to the fp32 accumulators */
+inline void accumulate_pixel(const float *src, float weight, float *acc, int len)
+{
+    const float32x4_t w = vdupq_n_f32(weight);
+    int               c = 0;
+    for (; c <= len - 4; c += 4)
+    {
+        vst1q_f32(acc + c, multiply_add(vld1q_f32(acc + c), vld1q_f32(src + c), w));
+    }
+    for (; c < len; ++c)
+    {
+        acc[c] += src[c] * weight;
+    }
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline void accumulate_pixel(const float16_t *src, float weight, float *acc, int len)
+{
+    const float32x4_t w = vdupq_n_f32(weight);
+    int               c = 0;
+    for (; c <= len - 4; c += 4)
+    {
+        vst1q_f32(acc + c, multiply_add(vld1q_f32(acc + c), vcvt_f32_f16(vld1_f16(src + c)), w));
+    }
+    for (; c < len; ++c)
+    {
+        acc[c] += static_cast<float>(src[c]) * weight;
+    }
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+inline void accumulate_s16x8(int16x8_t v, float32x4_t w, float *acc)
+{
+    vst1q_f32(acc, multiply_add(vld1q_f32(acc), vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))), w));
+    vst1q_f32(acc + 4, multiply_add(vld1q_f32(acc + 4), vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))), w));
+}
+
+inline void accumulate_pixel(const uint8_t *src, float weight, float *acc, int len)
+{
+    const float32x4_t w = vdupq_n_f32(weight);
+    int               c = 0;
+    for (; c <= len - 8; c += 8)
+    {
+        accumulate_s16x8(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src + c))), w, acc + c);
+    }
+    for (; c < len; ++c)
+    {
+        acc[c] += static_cast<float>(src[c]) * weight;
+    }
+}
+
+inline void accumulate_pixel(const int8_t *src, float weight, float *acc, int len)
+{
+    const float32x4_t w = vdupq_n_f32(weight);
+    int               c = 0;
+    for (; c <= len - 8; c += 8)
+    {
+        accumulate_s16x8(vmovl_s8(vld1_s8(src + c)), w, acc + c);
+    }
+    for (; c < len; ++c)
+    {
+        acc[c] += static_cast<float>(src[c]) * weight;
+    }
+}
+
+/** Convert a rescaled average to the destination type, integer values are rounded and saturated */
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value, T>::type finalize(float value)
+{
+    return static_cast<T>(utility::clamp<int32_t, T>(static_cast<int32_t>(support::cpp11::lround(value))));
+}
+
+template <typename T>
+inline typename std::enable_if<!std::is_integral<T>::value, T>::type finalize(float value)
+{
+    return static_cast<T>(value);
+}
+
+/** Reduce a row of source pixels horizontally to the destination columns described by @p columns
+ *
+ * @param[in]  row          First pixel of the source row.
+ * @param[in]  pixel_stride Stride in bytes between two source pixels.
+ * @param[in]  columns      Source pixels covered by each destination column.
+ * @param[in]  channels     Number of channels of each pixel.
+ * @param[out] hrow         Zero initialized reduced row, with @p channels values per destination column.
+ */
+template <typename T>
+void reduce_row(const uint8_t *row, size_t pixel_stride, const AreaSpans &columns, int channels, float *hrow)
+{
+    for (size_t x = 0; x < columns.starts.size(); ++x)
+    {
+        const float *weights = columns.weights.data() + columns.offsets[x];
+        for (int i = 0; i < columns.counts[x]; ++i)
+        {
+            const auto *pixel = reinterpret_cast<const T *>(row + (columns.starts[x] + i) * pixel_stride);
+            accumulate_pixel(pixel, weights[i], hrow + x * channels, channels);
+        }
+    }
+}
+
+/** Resize to an NHWC destination with area interpolation in two separable passes
+ *
+ * Each source row is first reduced horizontally to the destination columns of the window by @p reduce_source_row,
+ * into a ring buffer holding the source rows of the current destination row. The destination rows are then the
+ * weighted sums of the buffered rows, so each source pixel is read once even when downscaling by a large ratio. Each
+ * destination channel c is finally written as average * channel_scale[c] + channel_bias[c], which requantizes or
+ * normalizes it.
+ *
+ * @param[out] dst               Destination tensor with shape [C, resized W, resized H, N].
+ * @param[in]  in_h              Height of the source.
+ * @param[in]  columns           Source pixels covered by each destination column of the window.
+ * @param[in]  channel_scale     Per channel scale of the averages.
+ * @param[in]  channel_bias      Per channel bias added to the scaled averages.
+ * @param[in]  window            Region of the destination to compute, the channels are not split.
+ * @param[in]  reduce_source_row Callable taking a batch, a source row and a zero initialized reduced row to fill.
+ */
+template <typename TOut, typename RowReducer>
+void scale_area_rows(ITensor          *dst,
+                     int               in_h,
+                     const AreaSpans  &columns,
+                     const float      *channel_scale,
+                     const float      *channel_bias,
+                     const Window     &window,
+                     const RowReducer &reduce_source_row)
+{
+    const ITensorInfo &dst_info = *dst->info();
+
+    const int   channels = static_cast<int>(dst_info.dimension(0));
+    const float hr       = static_cast<float>(in_h) / dst_info.dimension(2);
+    const int   x_begin  = window.y().start();
+    const int   x_end    = window.y().end();
+    const int   row_size = (x_end - x_begin) * channels;
+
+    // A destination row never needs more than ceil(hr) + 1 source rows
+    const int          ring_size = static_cast<int>(std::ceil(hr)) + 2;
+    std::vector<float> ring(static_cast<size_t>(ring_size) * row_size);
+    std::vector<int>   ring_rows(ring_size, -1);
+    std::vector<float> acc(row_size);
+
+    const size_t dst_stride_w = dst_info.strides_in_bytes()[1];
+    const size_t dst_stride_h = dst_info.strides_in_bytes()[2];
+    const size_t dst_stride_n = dst_info.strides_in_bytes()[3];
+    uint8_t     *dst_base     = dst->buffer() + dst_info.offset_first_element_in_bytes();
+
+    for (int n = window[3].start(); n < window[3].end(); ++n)
+    {
+        std::fill(ring_rows.begin(), ring_rows.end(), -1);
+        for (int y = window.z().start(); y < window.z().end(); ++y)
+        {
+            const AreaSpans rows = compute_area_spans(in_h, hr, y, y + 1);
+            std::fill(acc.begin(), acc.end(), 0.f);
+            for (int k = 0; k < rows.counts[0]; ++k)
+            {
+                const int source_row = rows.starts[0] + k;
+                const int slot       = source_row % ring_size;
+                float    *hrow       = ring.data() + static_cast<size_t>(slot) * row_size;
+
+                // Horizontal pass, computed once per source row
+                if (ring_rows[slot] != source_row)
+                {
+                    ring_rows[slot] = source_row;
+                    std::fill(hrow, hrow + row_size, 0.f);
+                    reduce_source_row(n, source_row, hrow);
+                }
+
+                // Vertical pass
+                accumulate_pixel(hrow, rows.weights[k], acc.data(), row_size);
+            }
+
+            uint8_t *dst_row = dst_base + n * dst_stride_n + y * dst_stride_h + x_begin * dst_stride_w;
+            for (int x = 0; x < x_end - x_begin; ++x)
+            {
+                auto        *dst_ptr = reinterpret_cast<TOut *>(dst_row + x * dst_stride_w);
+                const float *avg     = acc.data() + x * channels;
+                for (int c = 0; c < channels; ++c)
+                {
+                    dst_ptr[c] = finalize<TOut>(avg[c] * channel_scale[c] + channel_bias[c]);
+                }
+            }
+        }
+    }
+}
+
+/** Resize an NHWC tensor with area interpolation, see @ref scale_area_rows
+ *
+ * @param[in]  src           Source tensor with shape [C, W, H, N].
+ * @param[out] dst           Destination tensor with shape [C, resized W, resized H, N].
+ * @param[in]  channel_scale Per channel scale of the averages.
+ * @param[in]  channel_bias  Per channel bias added to the scaled averages.
+ * @param[in]  window        Region of the destination to compute, the channels are not split.
+ */
+template <typename TIn, typename TOut>
+void scale_area_nhwc(const ITensor *src,
+                     ITensor       *dst,
+                     const float   *channel_scale,
+                     const float   *channel_bias,
+                     const Window  &window)
+{
+    const ITensorInfo &src_info = *src->info();
+
+    const int       channels = static_cast<int>(src_info.dimension(0));
+    const int       in_w     = static_cast<int>(src_info.dimension(1));
+    const float     wr       = static_cast<float>(in_w) / dst->info()->dimension(1);
+    const AreaSpans columns  = compute_area_spans(in_w, wr, window.y().start(), window.y().end());
+
+    const size_t   src_stride_w = src_info.strides_in_bytes()[1];
+    const size_t   src_stride_h = src_info.strides_in_bytes()[2];
+    const size_t   src_stride_n = src_info.strides_in_bytes()[3];
+    const uint8_t *src_base     = src->buffer() + src_info.offset_first_element_in_bytes();
+
+    scale_area_rows<TOut>(dst, static_cast<int>(src_info.dimension(2)), columns, channel_scale, channel_bias, window,
+                          [&](int n, int source_row, float *hrow)
+                          {
+                              reduce_row<TIn>(src_base + n * src_stride_n + source_row * src_stride_h, src_stride_w,
+                                              columns, channels, hrow);
+                          });
+}
+
+/** Area interpolation of an NHWC tensor, requantizing quantized values to the destination quantization */
+template <typename T>
+void area_neon_scale(const ITensor *src, ITensor *dst, const Window &window)
+{
+    const size_t channels = src->info()->dimension(0);
+    float        scale    = 1.f;
+    float        bias     = 0.f;
+    if (is_data_type_quantized_asymmetric(src->info()->data_type()))
+    {
+        const UniformQuantizationInfo src_qinfo = src->info()->quantization_info().uniform();
+        const UniformQuantizationInfo dst_qinfo = dst->info()->quantization_info().uniform();
+        scale                                   = src_qinfo.scale / dst_qinfo.scale;
+        bias                                    = dst_qinfo.offset - src_qinfo.offset * scale;
+    }
+    const std::vector<float> channel_scale(channels, scale);
+    const std::vector<float> channel_bias(channels, bias);
+    scale_area_nhwc<T, T>(src, dst, channel_scale.data(), channel_bias.data(), window);
+}
+} // namespace area
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_SCALE_NEON_AREA_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include "src/core/helpers/ScaleHelpers.h"
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/core/utils/ScaleUtils.h"
+#include "src/cpu/kernels/scale/neon/area.h"
 #include "support/Rounding.h"
 
 #include <arm_neon.h>
@@ -755,6 +756,10 @@ void u8_neon_scale(const ITensor      *src,
     {
         u8_neon_scale_nearest(src, dst, offsets, sampling_offset, align_corners, window);
     }
+    else if (policy == InterpolationPolicy::AREA)
+    {
+        area::area_neon_scale<uint8_t>(src, dst, window);
+    }
 }
 
 void s16_neon_scale(const ITensor      *src,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/core/utils/ScaleUtils.h"
+#include "src/cpu/kernels/scale/neon/area.h"
 #include "support/Rounding.h"
 
 namespace arm_compute
@@ -610,6 +611,10 @@ void common_neon_scale(const ITensor      *src,
     {
         nearest_neon_scale<T>(src, dst, offsets, sampling_offset, align_corners, window);
     }
+    else if (policy == InterpolationPolicy::AREA)
+    {
+        area::area_neon_scale<T>(src, dst, window);
+    }
 }
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -401,6 +401,10 @@ void qasymm8_neon_scale(const ITensor      *src,
     {
         nearest_neon_scale<uint8_t>(src, dst, offsets, sampling_offset, align_corners, window);
     }
+    else if (policy == InterpolationPolicy::AREA)
+    {
+        area::area_neon_scale<uint8_t>(src, dst, window);
+    }
 }
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,7 @@
 #include "src/core/NEON/NEMath.h"
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/cpu/CpuTypes.h"
+#include "src/cpu/kernels/scatter/list.h"
 
 #include <cstdint>
 
@@ -39,6 +40,80 @@ namespace arm_compute
 {
 namespace cpu
 {
+/** Reduce a block of updates into a block of the destination */
+template <arm_compute::ScatterFunction sf, typename ScalarType>
+inline void scatter_block(const uint8_t *upt_ptr, uint8_t *dst_ptr, const int data_block_length)
+{
+    constexpr int vec_size = 16 / sizeof(ScalarType);
+
+    int x = 0;
+    for (; x <= (data_block_length - vec_size); x += vec_size)
+    {
+        ScalarType *dst_vec_ptr    = reinterpret_cast<ScalarType *>(dst_ptr) + x;
+        const auto  update_val_vec = wrapper::vloadq(reinterpret_cast<const ScalarType *>(upt_ptr) + x);
+        const auto  dst_val_vec    = wrapper::vloadq(dst_vec_ptr);
+
+        switch (sf)
+        {
+            case ScatterFunction::Update:
+                wrapper::vstore(dst_vec_ptr, update_val_vec);
+                break;
+            case ScatterFunction::Add:
+                wrapper::vstore(dst_vec_ptr, wrapper::vadd(dst_val_vec, update_val_vec));
+                break;
+            case ScatterFunction::Sub:
+                wrapper::vstore(dst_vec_ptr, wrapper::vsub(dst_val_vec, update_val_vec));
+                break;
+            case ScatterFunction::Max:
+                wrapper::vstore(dst_vec_ptr, wrapper::vmax(dst_val_vec, update_val_vec));
+                break;
+            case ScatterFunction::Min:
+                wrapper::vstore(dst_vec_ptr, wrapper::vmin(dst_val_vec, update_val_vec));
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
+        }
+    }
+
+    for (; x < data_block_length; ++x)
+    {
+        const ScalarType update_val = *(reinterpret_cast<const ScalarType *>(upt_ptr) + x);
+        const ScalarType dst_val    = *(reinterpret_cast<ScalarType *>(dst_ptr) + x);
+        ScalarType       output_val;
+        switch (sf)
+        {
+            case ScatterFunction::Update:
+                output_val = update_val;
+                break;
+            case ScatterFunction::Add:
+                output_val = dst_val + update_val;
+                break;
+            case ScatterFunction::Sub:
+                output_val = dst_val - update_val;
+                break;
+            case ScatterFunction::Max:
+                output_val = std::max(dst_val, update_val);
+                break;
+            case ScatterFunction::Min:
+                output_val = std::min(dst_val, update_val);
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
+        }
+        *(reinterpret_cast<ScalarType *>(dst_ptr) + x) = output_val;
+    }
+}
+
+/** Scatter the updates into the destination
+ *
+ * When the data part of the destination has more than one dimension, the window spans it and every index is
+ * applied to the slice of the data part owned by the thread.
+ *
+ * Otherwise each index updates a whole destination block (a row, or a single element for scalar blocks) and the
+ * Y dimension of the window spans the destination blocks instead. Every thread scans all the indices but only
+ * applies the ones that fall in the blocks it owns, so colliding indices are never applied by two threads at once
+ * and the updates of a block keep the order of the indices, as in the serial case.
+ */
 template <arm_compute::ScatterFunction sf, typename ScalarType>
 void scatter_neon(
     const ITensor *updates, const ITensor *indices, ITensor *dst, const Window &window, const int data_block_length)
@@ -68,108 +143,67 @@ void scatter_neon(
     TensorShape  ind_collapsed = idx_info->tensor_shape().collapsed_from(1);
     const size_t num_indices   = ind_collapsed[1];
 
-    Iterator updates_it(updates, window);
-    Iterator dst_it(dst, window);
+    uint8_t *idx_ptr_raw_base = indices->ptr_to_element(arm_compute::Coordinates(0));
 
-    constexpr int vec_size         = 16 / sizeof(ScalarType);
-    uint8_t      *idx_ptr_raw_base = indices->ptr_to_element(arm_compute::Coordinates(0));
+    // Flattened destination block of an index, or -1 if it is out of bounds
+    const auto block_index = [&](const uint8_t *idx_ptr_raw) -> int32_t
+    {
+        const int32_t *idx_ptr = reinterpret_cast<const int32_t *>(idx_ptr_raw);
 
-    execute_window_loop(
-        window,
-        [&](const Coordinates &)
+        int32_t index = 0;
+        for (int i = 0; i < index_len; ++i)
         {
-            uint8_t *idx_ptr_raw = idx_ptr_raw_base;
-            for (size_t index_element = 0; index_element < num_indices; ++index_element)
+            if (idx_ptr[i] >= dst_shape[i] || idx_ptr[i] < 0)
             {
-                int32_t *idx_ptr = reinterpret_cast<int32_t *>(idx_ptr_raw);
-
-                // Out of bounds check
-                bool out_of_bounds = false;
-                for (int i = 0; i < index_len; ++i)
-                {
-                    if (idx_ptr[i] >= dst_shape[i] || idx_ptr[i] < 0)
-                    {
-                        out_of_bounds = true;
-                    }
-                }
+                return -1;
+            }
+            index = index * dst_shape[i] + idx_ptr[i];
+        }
+        return index;
+    };
 
-                idx_ptr_raw += indices_strides_y;
+    if (scatter_partitions_blocks(dst_dims, index_len))
+    {
+        const int32_t block_start = window.y().start();
+        const int32_t block_end   = window.y().end();
 
-                if (out_of_bounds)
-                {
-                    continue;
-                }
+        const uint8_t *upt_base = updates->buffer() + updates_info->offset_first_element_in_bytes();
+        uint8_t       *dst_base = dst->buffer() + dst_info->offset_first_element_in_bytes();
 
-                int32_t index = 0;
-                for (int i = 0; i < index_len; ++i)
-                {
-                    index = index * dst_shape[i] + idx_ptr[i];
-                }
+        const uint8_t *idx_ptr_raw = idx_ptr_raw_base;
+        for (size_t index_element = 0; index_element < num_indices; ++index_element, idx_ptr_raw += indices_strides_y)
+        {
+            const int32_t index = block_index(idx_ptr_raw);
+            if (index < block_start || index >= block_end)
+            {
+                continue;
+            }
 
-                const uint8_t *upt_from_index_ptr = updates_it.ptr() + index_element * upt_block_stride;
+            scatter_block<sf, ScalarType>(upt_base + index_element * upt_block_stride,
+                                          dst_base + index * out_block_stride, data_block_length);
+        }
+        return;
+    }
 
-                uint8_t *dst_from_index_ptr = dst_it.ptr() + index * out_block_stride;
+    Iterator updates_it(updates, window);
+    Iterator dst_it(dst, window);
 
-                int x = 0;
-                for (; x <= (data_block_length - vec_size); x += vec_size)
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            const uint8_t *idx_ptr_raw = idx_ptr_raw_base;
+            for (size_t index_element = 0; index_element < num_indices;
+                 ++index_element, idx_ptr_raw += indices_strides_y)
+            {
+                const int32_t index = block_index(idx_ptr_raw);
+                if (index < 0)
                 {
-                    const auto update_val_vec =
-                        wrapper::vloadq(reinterpret_cast<const ScalarType *>(upt_from_index_ptr) + x);
-                    const auto dst_val_vec = wrapper::vloadq(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x);
-
-                    switch (sf)
-                    {
-                        case ScatterFunction::Update:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x, update_val_vec);
-                            break;
-                        case ScatterFunction::Add:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x,
-                                            wrapper::vadd(dst_val_vec, update_val_vec));
-                            break;
-                        case ScatterFunction::Sub:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x,
-                                            wrapper::vsub(dst_val_vec, update_val_vec));
-                            break;
-                        case ScatterFunction::Max:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x,
-                                            wrapper::vmax(dst_val_vec, update_val_vec));
-                            break;
-                        case ScatterFunction::Min:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x,
-                                            wrapper::vmin(dst_val_vec, update_val_vec));
-                            break;
-                        default:
-                            ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
-                    }
+                    continue;
                 }
 
-                for (; x < data_block_length; ++x)
-                {
-                    const ScalarType update_val = *(reinterpret_cast<const ScalarType *>(upt_from_index_ptr) + x);
-                    const ScalarType dst_val    = *(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x);
-                    ScalarType       output_val;
-                    switch (sf)
-                    {
-                        case ScatterFunction::Update:
-                            output_val = update_val;
-                            break;
-                        case ScatterFunction::Add:
-                            output_val = dst_val + update_val;
-                            break;
-                        case ScatterFunction::Sub:
-                            output_val = dst_val - update_val;
-                            break;
-                        case ScatterFunction::Max:
-                            output_val = std::max(dst_val, update_val);
-                            break;
-                        case ScatterFunction::Min:
-                            output_val = std::min(dst_val, update_val);
-                            break;
-                        default:
-                            ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
-                    }
-                    *(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x) = output_val;
-                }
+                scatter_block<sf, ScalarType>(updates_it.ptr() + index_element * upt_block_stride,
+                                              dst_it.ptr() + index * out_block_stride, data_block_length);
             }
         },
         updates_it, dst_it);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,16 @@ namespace arm_compute
 {
 namespace cpu
 {
+/** Whether the scatter is split across the destination blocks rather than across the data part of the destination
+ *
+ * This is the case when the data part has at most one dimension, so the window over the data part would be a single
+ * iteration.
+ */
+inline bool scatter_partitions_blocks(int dst_dims, int index_len)
+{
+    return dst_dims - index_len <= 1;
+}
+
 #define DECLARE_SCATTER_KERNEL(func_name)                                                                         \
     void func_name(const ITensor *src, const ITensor *indices, ITensor *dst, const ScatterFunction &scatter_func, \
                    const Window &window, const int data_block_length)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,6 +42,10 @@ void neon_fp32_softmax(const ITensor *in,
     ARM_COMPUTE_UNUSED(lut_ptr);
     if (axis == 0)
     {
+        if (use_online_softmax<float>(in))
+        {
+            return neon_softmax_x_online<float, IS_LOG>(in, out, beta, window);
+        }
         return neon_softmax_x_float<float, IS_LOG>(in, tmp, out, beta, axis, window);
     }
     else
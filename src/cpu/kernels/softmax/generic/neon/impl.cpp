@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,9 @@
 #include "src/cpu/kernels/softmax/generic/neon/impl.h"
 
 #include "support/SaturateCast.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
 
 namespace arm_compute
 {
@@ -599,6 +602,156 @@ void neon_softmax_non_x_quantized(
         in_it, out_it);
 }
 
+#ifdef __aarch64__
+namespace
+{
+/** Bytes of a vector of 8-bit values, ordered like the values */
+inline uint8x16_t to_ordered_bytes(const uint8x16_t &v)
+{
+    return v;
+}
+
+inline uint8x16_t to_ordered_bytes(const int8x16_t &v)
+{
+    return veorq_u8(vreinterpretq_u8_s8(v), vdupq_n_u8(0x80));
+}
+
+inline uint8_t to_ordered_byte(qasymm8_t v)
+{
+    return v;
+}
+
+inline uint8_t to_ordered_byte(qasymm8_signed_t v)
+{
+    return static_cast<uint8_t>(v) ^ 0x80;
+}
+} // namespace
+
+template <typename T>
+void neon_softmax_x_quantized_lut(const ITensor *in, ITensor *out, const float *exp_lut, const Window &window)
+{
+    static_assert(std::is_same<T, qasymm8_t>::value || std::is_same<T, qasymm8_signed_t>::value,
+                  "quantized type should be either qasymm8_t or qasymm8_signed_t.");
+
+    constexpr bool is_qasymm8_signed = std::is_same<T, qasymm8_signed_t>::value;
+    constexpr int  vec_size          = 16;
+
+    const int input_width = in->info()->valid_region().shape.x();
+
+    Iterator in_it(in, window);
+    Iterator out_it(out, window);
+
+    // Quantized probability of each distance to the max of the row, looked up 64 entries at a time
+    alignas(16) uint8_t prob_lut[256] = {0};
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            /* Get pointers */
+            const T *in_ptr  = reinterpret_cast<const T *>(in_it.ptr());
+            T       *out_ptr = reinterpret_cast<T *>(out_it.ptr());
+
+            /* Compute Max and Min, on the bytes ordered like the values */
+            uint8_t max_val = 0;
+            uint8_t min_val = 255;
+            {
+                uint8x16_t vec_max = vdupq_n_u8(0);
+                uint8x16_t vec_min = vdupq_n_u8(255);
+                int        x       = 0;
+                for (; x <= (input_width - vec_size); x += vec_size)
+                {
+                    const uint8x16_t current_value = to_ordered_bytes(wrapper::vloadq(in_ptr + x));
+                    vec_max                        = vmaxq_u8(vec_max, current_value);
+                    vec_min                        = vminq_u8(vec_min, current_value);
+                }
+                max_val = vmaxvq_u8(vec_max);
+                min_val = vminvq_u8(vec_min);
+
+                // Compute left-over elements
+                for (; x < input_width; ++x)
+                {
+                    max_val = std::max(to_ordered_byte(in_ptr[x]), max_val);
+                    min_val = std::min(to_ordered_byte(in_ptr[x]), min_val);
+                }
+            } // Compute Max and Min
+
+            /* Sum the exponentials of the distances to the max, looked up in the table */
+            float sum = 0.f;
+            {
+                float sums[4] = {0.f, 0.f, 0.f, 0.f};
+                int   x       = 0;
+                for (; x <= (input_width - 4); x += 4)
+                {
+                    sums[0] += exp_lut[max_val - to_ordered_byte(in_ptr[x])];
+                    sums[1] += exp_lut[max_val - to_ordered_byte(in_ptr[x + 1])];
+                    sums[2] += exp_lut[max_val - to_ordered_byte(in_ptr[x + 2])];
+                    sums[3] += exp_lut[max_val - to_ordered_byte(in_ptr[x + 3])];
+                }
+                for (; x < input_width; ++x)
+                {
+                    sums[0] += exp_lut[max_val - to_ordered_byte(in_ptr[x])];
+                }
+                sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+            } // Sum the exponentials
+
+            const float sum_transformed = 256.f / sum;
+            const auto  quantize        = [&](int distance)
+            {
+                return utils::cast::saturate_cast<T>(support::cpp11::nearbyint(exp_lut[distance] * sum_transformed) -
+                                                     (is_qasymm8_signed ? 128.f : 0.f));
+            };
+
+            /* Normalize exponentials */
+            const int range = max_val - min_val;
+            if (input_width <= range)
+            {
+                // Fewer elements than distances: quantizing them directly is cheaper than filling the table
+                for (int x = 0; x < input_width; ++x)
+                {
+                    out_ptr[x] = quantize(max_val - to_ordered_byte(in_ptr[x]));
+                }
+                return;
+            }
+
+            for (int distance = 0; distance <= range; ++distance)
+            {
+                prob_lut[distance] = static_cast<uint8_t>(quantize(distance));
+            }
+
+            const int        num_tables = range / 64 + 1;
+            uint8x16x4_t     tables[4];
+            const uint8x16_t vec_max = vdupq_n_u8(max_val);
+            for (int t = 0; t < num_tables; ++t)
+            {
+                tables[t] = {{vld1q_u8(prob_lut + 64 * t), vld1q_u8(prob_lut + 64 * t + 16),
+                              vld1q_u8(prob_lut + 64 * t + 32), vld1q_u8(prob_lut + 64 * t + 48)}};
+            }
+
+            int x = 0;
+            for (; x <= (input_width - vec_size); x += vec_size)
+            {
+                const uint8x16_t distance = vsubq_u8(vec_max, to_ordered_bytes(wrapper::vloadq(in_ptr + x)));
+
+                // Out of range indices select 0, so each table only contributes the distances it holds
+                uint8x16_t result = vqtbl4q_u8(tables[0], distance);
+                for (int t = 1; t < num_tables; ++t)
+                {
+                    result = vorrq_u8(result, vqtbl4q_u8(tables[t], vsubq_u8(distance, vdupq_n_u8(64 * t))));
+                }
+                vst1q_u8(reinterpret_cast<uint8_t *>(out_ptr + x), result);
+            }
+
+            // Compute left-over elements
+            for (; x < input_width; ++x)
+            {
+                out_ptr[x] = static_cast<T>(prob_lut[max_val - to_ordered_byte(in_ptr[x])]);
+            }
+        },
+        in_it, out_it);
+}
+#endif // __aarch64__
+
 template void neon_softmax_x_quantized<qasymm8_signed_t, true>(
     const ITensor *in, void *const tmp, ITensor *out, float beta, int axis, const Window &window);
 
@@ -611,6 +764,16 @@ template void neon_softmax_x_quantized<qasymm8_t, true>(
 template void neon_softmax_x_quantized<qasymm8_t, false>(
     const ITensor *in, void *const tmp, ITensor *out, float beta, int axis, const Window &window);
 
+#ifdef __aarch64__
+template void neon_softmax_x_quantized_lut<qasymm8_signed_t>(const ITensor *in,
+                                                             ITensor       *out,
+                                                             const float   *exp_lut,
+                                                             const Window  &window);
+
+template void
+neon_softmax_x_quantized_lut<qasymm8_t>(const ITensor *in, ITensor *out, const float *exp_lut, const Window &window);
+#endif // __aarch64__
+
 template void neon_softmax_non_x_quantized<qasymm8_signed_t, true>(
     const ITensor *in, void *const tmp, ITensor *out, float beta, int axis, const Window &window);
 
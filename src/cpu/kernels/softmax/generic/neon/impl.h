@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,9 @@
 
 #include "src/core/NEON/NEMath.h"
 #include "src/core/NEON/wrapper/wrapper.h"
+#include "support/Bfloat16.h"
+
+#include <cmath>
 
 namespace arm_compute
 {
@@ -415,10 +418,202 @@ void neon_softmax_non_x_float(
         },
         in_it, out_it);
 }
+
+/** Rows of at least this many bytes are normalized with @ref neon_softmax_x_online
+ *
+ * Shorter rows stay in the L1 cache between the passes of @ref neon_softmax_x_float, which computes each exponential
+ * once, whereas the online version computes them twice to save a pass over memory.
+ */
+constexpr size_t online_softmax_min_row_bytes = 32 * 1024;
+
+template <typename T>
+inline bool use_online_softmax(const ITensor *in)
+{
+    return in->info()->valid_region().shape.x() * sizeof(T) >= online_softmax_min_row_bytes;
+}
+
+// The online softmax computes in fp32 whatever the storage type
+inline float32x4_t softmax_load_f32x4(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+inline void softmax_store_f32x4(float *ptr, float32x4_t v)
+{
+    vst1q_f32(ptr, v);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline float32x4_t softmax_load_f32x4(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline void softmax_store_f32x4(float16_t *ptr, float32x4_t v)
+{
+    vst1_f16(ptr, vcvt_f16_f32(v));
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+inline float softmax_reduce_max(float32x4_t v)
+{
+#ifdef __aarch64__
+    return vmaxvq_f32(v);
+#else  // __aarch64__
+    float32x2_t res = vpmax_f32(vget_high_f32(v), vget_low_f32(v));
+    res             = vpmax_f32(res, res);
+    return vget_lane_f32(res, 0);
+#endif // __aarch64__
+}
+
+inline float softmax_reduce_add(float32x4_t v)
+{
+#ifdef __aarch64__
+    return vaddvq_f32(v);
+#else  // __aarch64__
+    float32x2_t res = vpadd_f32(vget_high_f32(v), vget_low_f32(v));
+    res             = vpadd_f32(res, res);
+    return vget_lane_f32(res, 0);
+#endif // __aarch64__
+}
+
+inline float32x4_t softmax_load_f32x4(const bfloat16 *ptr)
+{
+    return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(reinterpret_cast<const uint16_t *>(ptr)), 16));
+}
+
+inline void softmax_store_f32x4(bfloat16 *ptr, float32x4_t v)
+{
+    // Round to nearest even, as the scalar conversion does
+    uint32x4_t       bits = vreinterpretq_u32_f32(v);
+    const uint32x4_t lsb  = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+    bits                  = vaddq_u32(bits, vaddq_u32(lsb, vdupq_n_u32(0x7fff)));
+    vst1_u16(reinterpret_cast<uint16_t *>(ptr), vshrn_n_u32(bits, 16));
+}
+
+/** Softmax along X reading each row twice and writing it once
+ *
+ * The first pass keeps a running maximum and a running sum of exponentials per lane, rescaling the sum by
+ * @f$ e^{\beta (m_{old} - m_{new})} @f$ whenever the maximum grows. The lanes are merged the same way, then the
+ * second pass recomputes the exponentials and writes the normalized result, so the output is never read back.
+ */
+template <typename T, bool IS_LOG>
+void neon_softmax_x_online(const ITensor *in, ITensor *out, float beta, const Window &window)
+{
+    const int input_width = in->info()->valid_region().shape.x();
+
+    Iterator in_it(in, window);
+    Iterator out_it(out, window);
+
+    // Four vectors per step amortize the rescaling of the sum
+    constexpr int vec_size = 16;
+
+    const float32x4_t beta_vec = vdupq_n_f32(beta);
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            const T *in_ptr  = reinterpret_cast<const T *>(in_it.ptr());
+            T       *out_ptr = reinterpret_cast<T *>(out_it.ptr());
+
+            /* Compute max and sum of exponentials */
+            float max_val = static_cast<float>(in_ptr[0]);
+            float sum     = 0.f;
+            {
+                float32x4_t vec_max = vdupq_n_f32(max_val);
+                float32x4_t vec_sum = vdupq_n_f32(0.f);
+
+                int x = 0;
+                for (; x <= (input_width - vec_size); x += vec_size)
+                {
+                    float32x4_t v[4];
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        v[i] = softmax_load_f32x4(in_ptr + x + 4 * i);
+                    }
+                    const float32x4_t new_max =
+                        vmaxq_f32(vec_max, vmaxq_f32(vmaxq_f32(v[0], v[1]), vmaxq_f32(v[2], v[3])));
+
+                    vec_sum = vmulq_f32(vec_sum, vexpq_f32(vmulq_f32(vsubq_f32(vec_max, new_max), beta_vec)));
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        vec_sum = vaddq_f32(vec_sum, vexpq_f32(vmulq_f32(vsubq_f32(v[i], new_max), beta_vec)));
+                    }
+                    vec_max = new_max;
+                }
+
+                // Merge the lanes, rescaling each partial sum to the maximum of the row
+                max_val = softmax_reduce_max(vec_max);
+                vec_sum = vmulq_f32(vec_sum, vexpq_f32(vmulq_f32(vsubq_f32(vec_max, vdupq_n_f32(max_val)), beta_vec)));
+                sum     = softmax_reduce_add(vec_sum);
+
+                // Compute left-over elements
+                for (; x < input_width; ++x)
+                {
+                    const float element = static_cast<float>(in_ptr[x]);
+                    if (element > max_val)
+                    {
+                        sum     = sum * std::exp((max_val - element) * beta);
+                        max_val = element;
+                    }
+                    sum += std::exp((element - max_val) * beta);
+                }
+            } // Compute max and sum of exponentials
+
+            /* Normalize exponentials */
+            {
+                const float       sum_transformed = IS_LOG ? std::log(sum) : 1.f / sum;
+                const float32x4_t vec_max         = vdupq_n_f32(max_val);
+                const float32x4_t vec_transformed = vdupq_n_f32(sum_transformed);
+
+                int x = 0;
+                for (; x <= (input_width - 4); x += 4)
+                {
+                    const float32x4_t element =
+                        vmulq_f32(vsubq_f32(softmax_load_f32x4(in_ptr + x), vec_max), beta_vec);
+                    if (IS_LOG)
+                    {
+                        softmax_store_f32x4(out_ptr + x, vsubq_f32(element, vec_transformed));
+                    }
+                    else
+                    {
+                        softmax_store_f32x4(out_ptr + x, vmulq_f32(vexpq_f32(element), vec_transformed));
+                    }
+                }
+
+                // Compute left-over elements
+                for (; x < input_width; ++x)
+                {
+                    const float element = (static_cast<float>(in_ptr[x]) - max_val) * beta;
+                    const float result  = IS_LOG ? element - sum_transformed : std::exp(element) * sum_transformed;
+                    out_ptr[x]          = static_cast<T>(result);
+                }
+            } // Normalize exponentials
+        },
+        in_it, out_it);
+}
+
 template <typename T, bool IS_LOG>
 void neon_softmax_x_quantized(
     const ITensor *in, void *const tmp, ITensor *out, float beta, int axis, const Window &window);
 
+#ifdef __aarch64__
+/** Softmax along X of 8-bit values using a table of exponentials
+ *
+ * The difference between the max of a row and each of its values can only take 256 values, so the exponentials are
+ * looked up in @p exp_lut and the quantized probabilities of the distances found in the row are computed once, then
+ * looked up with TBL.
+ *
+ * @param[in]  in      Source tensor. Data types supported: QASYMM8/QASYMM8_SIGNED.
+ * @param[out] out     Destination tensor. Data types supported: same as @p in.
+ * @param[in]  exp_lut exp(-beta * scale * d) for each distance d in [0, 255].
+ * @param[in]  window  Region on which to execute the kernel.
+ */
+template <typename T>
+void neon_softmax_x_quantized_lut(const ITensor *in, ITensor *out, const float *exp_lut, const Window &window);
+#endif // __aarch64__
+
 template <typename T, bool IS_LOG>
 void neon_softmax_non_x_quantized(
     const ITensor *in, void *const tmp, ITensor *out, float beta, int axis, const Window &window);
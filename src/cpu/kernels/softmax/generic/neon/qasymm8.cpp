@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,6 +39,13 @@ void neon_qasymm8_softmax(const ITensor *in,
                           const void    *lut_ptr)
 {
     ARM_COMPUTE_UNUSED(lut_ptr);
+#ifdef __aarch64__
+    // The table of exponentials is only provided to the softmax along X
+    if (lut_ptr != nullptr && !IS_LOG)
+    {
+        return neon_softmax_x_quantized_lut<qasymm8_t>(in, out, static_cast<const float *>(lut_ptr), window);
+    }
+#endif // __aarch64__
     if (axis == 0)
     {
         return neon_softmax_x_quantized<qasymm8_t, IS_LOG>(in, tmp, out, beta, axis, window);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -76,6 +76,8 @@ void sme2_qasymm8_signed_softmax_lut_512VL(const ITensor *in,
 
 #ifdef ARM_COMPUTE_ENABLE_BF16
 
+DECLARE_SOFTMAX_KERNEL(neon_bf16_softmax);
+
 void sve_softmax_bf16(const ITensor *in,
                       void *const    tmp,
                       ITensor       *out,
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_TOPKV_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_TOPKV_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace topkv
+{
+#if defined(__aarch64__)
+/** Whether any lane of a comparison mask is set */
+template <typename M>
+inline bool any_lane(const M &mask)
+{
+    return wrapper::vmaxv(mask) != 0;
+}
+#else  // defined(__aarch64__)
+/** Whether any lane of a comparison mask is set */
+inline bool any_lane(const uint64x2_t &mask)
+{
+    return (vgetq_lane_u64(mask, 0) | vgetq_lane_u64(mask, 1)) != 0;
+}
+inline bool any_lane(const uint32x4_t &mask)
+{
+    return any_lane(vreinterpretq_u64_u32(mask));
+}
+inline bool any_lane(const uint16x8_t &mask)
+{
+    return any_lane(vreinterpretq_u64_u16(mask));
+}
+inline bool any_lane(const uint8x16_t &mask)
+{
+    return any_lane(vreinterpretq_u64_u8(mask));
+}
+#endif // defined(__aarch64__)
+
+/** Selects the k largest elements of each row, in decreasing order
+ *
+ * The first k elements of a row seed a heap whose top is the smallest candidate. The rest of the row is then
+ * scanned in blocks of vectors which are only looked at element by element when one of their lanes is greater than
+ * that threshold. Past the first few blocks the threshold is rarely exceeded, so most of the row is filtered at the
+ * cost of a vector max and compare.
+ *
+ * Elements with equal values are ordered by increasing index. Quantized values are compared as they are stored, the
+ * order being the same as the one of the dequantized values.
+ */
+template <typename T>
+void neon_topkv(const ITensor *src, ITensor *values, ITensor *indices, unsigned int k, const Window &window)
+{
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+    using Candidate    = std::pair<T, uint32_t>;
+
+    constexpr unsigned int vec_size   = 16 / sizeof(T);
+    constexpr unsigned int block_size = 4 * vec_size;
+
+    const unsigned int num_elements = src->info()->dimension(0);
+
+    // The heap is ordered so that its front is the candidate ranked last
+    const auto ranks_before = [](const Candidate &a, const Candidate &b)
+    { return (a.first > b.first) || (!(b.first > a.first) && a.second < b.second); };
+    std::vector<Candidate> heap;
+    heap.reserve(k);
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator src_it(src, win);
+    Iterator values_it(values, win);
+    Iterator indices_it(indices, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto src_ptr     = reinterpret_cast<const T *>(src_it.ptr());
+            const auto values_ptr  = reinterpret_cast<T *>(values_it.ptr());
+            const auto indices_ptr = reinterpret_cast<uint32_t *>(indices_it.ptr());
+
+            heap.clear();
+            for (unsigned int i = 0; i < k; ++i)
+            {
+                heap.emplace_back(src_ptr[i], i);
+            }
+            std::make_heap(heap.begin(), heap.end(), ranks_before);
+
+            // As the remaining elements come after all the candidates, they only replace the last one when greater
+            const auto push = [&](unsigned int i)
+            {
+                if (src_ptr[i] > heap.front().first)
+                {
+                    std::pop_heap(heap.begin(), heap.end(), ranks_before);
+                    heap.back() = Candidate(src_ptr[i], i);
+                    std::push_heap(heap.begin(), heap.end(), ranks_before);
+                }
+            };
+
+            unsigned int i         = k;
+            auto         threshold = wrapper::vdup_n(heap.front().first, ExactTagType{});
+            for (; i + block_size <= num_elements; i += block_size)
+            {
+                const auto max01 =
+                    wrapper::vmax(wrapper::vloadq(src_ptr + i), wrapper::vloadq(src_ptr + i + vec_size));
+                const auto max23 = wrapper::vmax(wrapper::vloadq(src_ptr + i + 2 * vec_size),
+                                                 wrapper::vloadq(src_ptr + i + 3 * vec_size));
+                if (any_lane(wrapper::vcgt(wrapper::vmax(max01, max23), threshold)))
+                {
+                    for (unsigned int j = i; j < i + block_size; ++j)
+                    {
+                        push(j);
+                    }
+                    threshold = wrapper::vdup_n(heap.front().first, ExactTagType{});
+                }
+            }
+            for (; i < num_elements; ++i)
+            {
+                push(i);
+            }
+
+            std::sort_heap(heap.begin(), heap.end(), ranks_before);
+            for (unsigned int j = 0; j < k; ++j)
+            {
+                values_ptr[j]  = heap[j].first;
+                indices_ptr[j] = heap[j].second;
+            }
+        },
+        src_it, values_it, indices_it);
+}
+} // namespace topkv
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_TOPKV_GENERIC_NEON_IMPL_H
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_WOQ_GEMM_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_WOQ_GEMM_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEFp8.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <type_traits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace woq
+{
+/** Number of outputs, i.e. weight rows, sharing each load of the activations */
+constexpr unsigned int block_outputs = 4;
+/** Number of weights dequantized at once, the group size must be a multiple of it */
+constexpr unsigned int block_depth = 16;
+
+// Activations are widened to fp32, the accumulation is always done in fp32
+inline float32x4_t load_f32x4(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline float32x4_t load_f32x4(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+inline float reduce_add(float32x4_t v)
+{
+#ifdef __aarch64__
+    return vaddvq_f32(v);
+#else  // __aarch64__
+    float32x2_t sum = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    sum             = vpadd_f32(sum, sum);
+    return vget_lane_f32(sum, 0);
+#endif // __aarch64__
+}
+
+inline float32x4_t multiply_add(float32x4_t acc, float32x4_t a, float32x4_t b)
+{
+#ifdef __aarch64__
+    return vfmaq_f32(acc, a, b);
+#else  // __aarch64__
+    return vmlaq_f32(acc, a, b);
+#endif // __aarch64__
+}
+
+/** Load @ref block_depth int8 weights */
+inline int8x16_t load_weights(const int8_t *ptr)
+{
+    return vld1q_s8(ptr);
+}
+
+/** Load @ref block_depth int4 weights packed two per byte, the even one in the low nibble, and sign extend them */
+inline int8x16_t load_weights(const uint8_t *ptr)
+{
+    const uint8x8_t   packed = vld1_u8(ptr);
+    const uint8x8x2_t zipped = vzip_u8(vand_u8(packed, vdup_n_u8(0x0F)), vshr_n_u8(packed, 4));
+    const uint8x16_t  nibble = vcombine_u8(zipped.val[0], zipped.val[1]);
+
+    // (v ^ 8) - 8 maps the 4-bit two's complement values onto [-8, 7]
+    return vsubq_s8(vreinterpretq_s8_u8(veorq_u8(nibble, vdupq_n_u8(8))), vdupq_n_s8(8));
+}
+
+/** acc += w * x over @ref block_depth elements, with @p w converted to fp32 in registers */
+inline float32x4_t dequantize_multiply_add(float32x4_t acc, int8x16_t w, const float32x4_t (&x)[4])
+{
+    const int16x8_t lo = vmovl_s8(vget_low_s8(w));
+    const int16x8_t hi = vmovl_s8(vget_high_s8(w));
+
+    acc = multiply_add(acc, vcvtq_f32_s32(vmovl_s16(vget_low_s16(lo))), x[0]);
+    acc = multiply_add(acc, vcvtq_f32_s32(vmovl_s16(vget_high_s16(lo))), x[1]);
+    acc = multiply_add(acc, vcvtq_f32_s32(vmovl_s16(vget_low_s16(hi))), x[2]);
+    acc = multiply_add(acc, vcvtq_f32_s32(vmovl_s16(vget_high_s16(hi))), x[3]);
+    return acc;
+}
+
+#ifdef __aarch64__
+/** Storage of an FP8 E4M3 weight */
+struct fp8_e4m3_t
+{
+    uint8_t bits;
+};
+
+/** Storage of an FP8 E5M2 weight */
+struct fp8_e5m2_t
+{
+    uint8_t bits;
+};
+
+/** Load @ref block_depth E4M3 weights as the bits of fp16 numbers @ref fp8_e4m3_f16_scale times smaller */
+inline uint16x8x2_t load_weights(const fp8_e4m3_t *ptr)
+{
+    return vfp8_e4m3_to_f16_bits(vld1q_u8(reinterpret_cast<const uint8_t *>(ptr)));
+}
+
+/** Load @ref block_depth E5M2 weights as the bits of fp16 numbers */
+inline uint16x8x2_t load_weights(const fp8_e5m2_t *ptr)
+{
+    return vfp8_e5m2_to_f16_bits(vld1q_u8(reinterpret_cast<const uint8_t *>(ptr)));
+}
+
+/** acc += w * x over @ref block_depth elements, with the fp16 bits @p w converted to fp32 in registers */
+inline float32x4_t dequantize_multiply_add(float32x4_t acc, uint16x8x2_t w, const float32x4_t (&x)[4])
+{
+    acc = multiply_add(acc, vcvt_f32_f16_bits(vget_low_u16(w.val[0])), x[0]);
+    acc = multiply_add(acc, vcvt_f32_f16_bits(vget_high_u16(w.val[0])), x[1]);
+    acc = multiply_add(acc, vcvt_f32_f16_bits(vget_low_u16(w.val[1])), x[2]);
+    acc = multiply_add(acc, vcvt_f32_f16_bits(vget_high_u16(w.val[1])), x[3]);
+    return acc;
+}
+#endif // __aarch64__
+
+/** Factor the values returned by load_weights() must be multiplied by to get the actual weights */
+template <typename TW>
+constexpr float weights_scale()
+{
+    return 1.f;
+}
+
+#ifdef __aarch64__
+template <>
+constexpr float weights_scale<fp8_e4m3_t>()
+{
+    return fp8_e4m3_f16_scale;
+}
+#endif // __aarch64__
+
+/** Compute @p rows consecutive outputs of one activation row
+ *
+ * @param[in]  x            Activation row of @p depth elements.
+ * @param[in]  w            First weight row, as stored: int8_t for int8 weights, uint8_t for packed int4 weights,
+ *                          fp8_e4m3_t or fp8_e5m2_t for FP8 weights.
+ * @param[in]  w_stride     Stride in bytes between the weight rows.
+ * @param[in]  scales       Scale of the first group of the first weight row.
+ * @param[in]  scale_stride Stride in bytes between the scales of two consecutive groups.
+ * @param[in]  bias         Bias of the first output, can be nullptr.
+ * @param[out] out          First output.
+ */
+template <unsigned int rows, typename T, typename TW>
+void compute_outputs(const T     *x,
+                     const TW    *w,
+                     size_t       w_stride,
+                     const float *scales,
+                     size_t       scale_stride,
+                     const T     *bias,
+                     T           *out,
+                     unsigned int depth,
+                     unsigned int group_size)
+{
+    // Packed int4 weights take half a byte each
+    constexpr unsigned int weights_per_byte = std::is_same<TW, uint8_t>::value ? 2 : 1;
+
+    float32x4_t total[rows];
+    for (unsigned int r = 0; r < rows; ++r)
+    {
+        total[r] = vdupq_n_f32(0.f);
+    }
+
+    for (unsigned int g = 0; g < depth; g += group_size)
+    {
+        float32x4_t acc[rows];
+        for (unsigned int r = 0; r < rows; ++r)
+        {
+            acc[r] = vdupq_n_f32(0.f);
+        }
+
+        for (unsigned int k = g; k < g + group_size; k += block_depth)
+        {
+            const float32x4_t xk[4] = {load_f32x4(x + k), load_f32x4(x + k + 4), load_f32x4(x + k + 8),
+                                       load_f32x4(x + k + 12)};
+            for (unsigned int r = 0; r < rows; ++r)
+            {
+                const auto *w_row = reinterpret_cast<const TW *>(reinterpret_cast<const uint8_t *>(w) + r * w_stride);
+                acc[r]            = dequantize_multiply_add(acc[r], load_weights(w_row + k / weights_per_byte), xk);
+            }
+        }
+
+        // The per-group scale is applied once per group rather than per weight
+        const float *group_scales =
+            reinterpret_cast<const float *>(reinterpret_cast<const uint8_t *>(scales) + (g / group_size) * scale_stride);
+        for (unsigned int r = 0; r < rows; ++r)
+        {
+            total[r] = vmlaq_n_f32(total[r], acc[r], group_scales[r] * weights_scale<TW>());
+        }
+    }
+
+    for (unsigned int r = 0; r < rows; ++r)
+    {
+        const float res = reduce_add(total[r]) + (bias != nullptr ? static_cast<float>(bias[r]) : 0.f);
+        out[r]          = static_cast<T>(res);
+    }
+}
+
+template <typename T, typename TW>
+void compute_row(const T     *x,
+                 const TW    *w,
+                 size_t       w_stride,
+                 const float *scales,
+                 size_t       scale_stride,
+                 const T     *bias,
+                 T           *out,
+                 unsigned int depth,
+                 unsigned int group_size,
+                 unsigned int n_start,
+                 unsigned int n_end)
+{
+    for (unsigned int n = n_start; n < n_end; n += block_outputs)
+    {
+        const auto *w_n    = reinterpret_cast<const TW *>(reinterpret_cast<const uint8_t *>(w) + n * w_stride);
+        const T    *bias_n = bias != nullptr ? bias + n : nullptr;
+        switch (std::min(block_outputs, n_end - n))
+        {
+            case 4:
+                compute_outputs<4>(x, w_n, w_stride, scales + n, scale_stride, bias_n, out + n, depth, group_size);
+                break;
+            case 3:
+                compute_outputs<3>(x, w_n, w_stride, scales + n, scale_stride, bias_n, out + n, depth, group_size);
+                break;
+            case 2:
+                compute_outputs<2>(x, w_n, w_stride, scales + n, scale_stride, bias_n, out + n, depth, group_size);
+                break;
+            default:
+                compute_outputs<1>(x, w_n, w_stride, scales + n, scale_stride, bias_n, out + n, depth, group_size);
+                break;
+        }
+    }
+}
+
+/** Weight-only quantized GEMM: dst = src * dequantize(weights)^T + bias
+ *
+ * Each weight row holds the K weights of one output, as int8, packed int4 or, on aarch64, FP8 numbers. The weights
+ * are converted to fp32 in registers and the per-group scales are applied to the partial sums of each group, so the
+ * weights are only read once, in their quantized form.
+ */
+template <typename T>
+void neon_weight_only_quantized_gemm(const ITensor *src,
+                                     const ITensor *weights,
+                                     const ITensor *scales,
+                                     const ITensor *bias,
+                                     ITensor       *dst,
+                                     unsigned int   group_size,
+                                     const Window  &window)
+{
+    const unsigned int depth   = src->info()->dimension(0);
+    const unsigned int n_start = window.x().start();
+    const unsigned int n_end   = std::min<unsigned int>(window.x().end(), dst->info()->dimension(0));
+    const DataType     w_dt    = weights->info()->data_type();
+
+    const uint8_t *w_ptr        = weights->buffer() + weights->info()->offset_first_element_in_bytes();
+    const size_t   w_stride     = weights->info()->strides_in_bytes().y();
+    const auto    *scale_ptr    = reinterpret_cast<const float *>(scales->buffer() +
+                                                              scales->info()->offset_first_element_in_bytes());
+    const size_t   scale_stride = scales->info()->strides_in_bytes().y();
+    const T       *bias_ptr =
+        bias != nullptr ? reinterpret_cast<const T *>(bias->buffer() + bias->info()->offset_first_element_in_bytes())
+                        : nullptr;
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator src_it(src, win);
+    Iterator dst_it(dst, win);
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const auto *x   = reinterpret_cast<const T *>(src_it.ptr());
+            auto       *out = reinterpret_cast<T *>(dst_it.ptr());
+            switch (w_dt)
+            {
+                case DataType::U8:
+                    compute_row(x, w_ptr, w_stride, scale_ptr, scale_stride, bias_ptr, out, depth, group_size,
+                                n_start, n_end);
+                    break;
+#ifdef __aarch64__
+                case DataType::FP8_E4M3:
+                    compute_row(x, reinterpret_cast<const fp8_e4m3_t *>(w_ptr), w_stride, scale_ptr, scale_stride,
+                                bias_ptr, out, depth, group_size, n_start, n_end);
+                    break;
+                case DataType::FP8_E5M2:
+                    compute_row(x, reinterpret_cast<const fp8_e5m2_t *>(w_ptr), w_stride, scale_ptr, scale_stride,
+                                bias_ptr, out, depth, group_size, n_start, n_end);
+                    break;
+#endif // __aarch64__
+                default:
+                    compute_row(x, reinterpret_cast<const int8_t *>(w_ptr), w_stride, scale_ptr, scale_stride,
+                                bias_ptr, out, depth, group_size, n_start, n_end);
+                    break;
+            }
+        },
+        src_it, dst_it);
+}
+} // namespace woq
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_WOQ_GEMM_GENERIC_NEON_IMPL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,9 @@
  */
 #include "src/cpu/operators/CpuCast.h"
 
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Scheduler.h"
+
 #include "src/common/utils/Log.h"
 #include "src/cpu/kernels/CpuCastKernel.h"
 
@@ -30,17 +33,25 @@ namespace arm_compute
 {
 namespace cpu
 {
-void CpuCast::configure(const ITensorInfo *src, ITensorInfo *dst, ConvertPolicy policy)
+void CpuCast::configure(const ITensorInfo *src, ITensorInfo *dst, ConvertPolicy policy, float scale, float offset)
 {
-    ARM_COMPUTE_LOG_PARAMS(src, dst, policy);
+    ARM_COMPUTE_LOG_PARAMS(src, dst, policy, scale, offset);
     auto k = std::make_unique<kernels::CpuCastKernel>();
-    k->configure(src, dst, policy);
+    k->configure(src, dst, policy, scale, offset);
     _kernel = std::move(k);
 }
 
-Status CpuCast::validate(const ITensorInfo *src, const ITensorInfo *dst, ConvertPolicy policy)
+Status
+CpuCast::validate(const ITensorInfo *src, const ITensorInfo *dst, ConvertPolicy policy, float scale, float offset)
+{
+    return kernels::CpuCastKernel::validate(src, dst, policy, scale, offset);
+}
+void CpuCast::run(ITensorPack &tensors)
 {
-    return kernels::CpuCastKernel::validate(src, dst, policy);
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+    ScopedScheduler scope(_ctx != nullptr ? _ctx->scheduler() : nullptr);
+    auto split_dimension = static_cast<kernels::CpuCastKernel *>(_kernel.get())->get_split_dimension_hint();
+    NEScheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
 }
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023 Arm Limited.
+ * Copyright (c) 2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,25 +49,35 @@ public:
      * |U8             | U16, S16, S32, F32, F16                        |
      * |U16            | U8, U32                                        |
      * |S16            | QASYMM8_SIGNED, U8, S32                        |
-     * |F16            | QASYMM8_SIGNED, QASYMM8, F32, S32, U8          |
+     * |F16            | QASYMM8_SIGNED, QASYMM8, F32, S32, U8, FP8     |
      * |S32            | QASYMM8_SIGNED, QASYMM8, F16, F32, U8          |
-     * |F32            | QASYMM8_SIGNED, QASYMM8, F16, S32, U8|
+     * |F32            | QASYMM8_SIGNED, QASYMM8, F16, S32, U8, FP8     |
      * |S64            | F32                                            |
+     * |FP8_E4M3       | F16, F32                                       |
+     * |FP8_E5M2       | F16, F32                                       |
      *
      * @param[in]  src    The source tensor to convert. Data types supported: U8/S8/U16/S16/U32/S32/S64/F16/F32.
      * @param[out] dst    The destination tensor. Data types supported: U8/S8/U16/S16/U32/S32/F16/F32.
      * @param[in]  policy Conversion policy.
+     * @param[in]  scale  (Optional) Scale applied to the converted values, dst = src * scale + offset. Defaults to 1.
+     * @param[in]  offset (Optional) Offset added to the scaled values. Defaults to 0.
      *
+     * @note A scale or offset is only supported when casting F32 to or from QASYMM8_SIGNED/QASYMM8/U8/S32.
      *
      */
-    void configure(const ITensorInfo *src, ITensorInfo *dst, ConvertPolicy policy);
+    void configure(
+        const ITensorInfo *src, ITensorInfo *dst, ConvertPolicy policy, float scale = 1.f, float offset = 0.f);
     /** Static function to check if given info will lead to a valid configuration
      *
      * Similar to @ref CpuCast::configure()
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, ConvertPolicy policy);
+    static Status validate(
+        const ITensorInfo *src, const ITensorInfo *dst, ConvertPolicy policy, float scale = 1.f, float offset = 0.f);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
 };
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,84 +21,217 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/operators/CpuConv2d.h"
 
+#include "arm_compute/core/utils/TrustedConfigure.h"
+#include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEFFTConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuDirectConv2d.h"
 #include "src/cpu/operators/CpuGemm.h"
 #include "src/cpu/operators/CpuGemmConv2d.h"
 #include "src/cpu/operators/CpuGemmDirectConv2d.h"
 #include "src/cpu/operators/CpuWinogradConv2d.h"
+#include "src/cpu/utils/CpuConvMethodTuner.h"
+#include "utils/TypePrinter.h"
+
+#include <chrono>
+#include <cstring>
+#include <limits>
 
 namespace arm_compute
 {
 namespace cpu
 {
-CpuConv2d::CpuConv2d() : _function()
+namespace
+{
+/** Validates the operator running a convolution method
+ *
+ * @return a status
+ */
+Status validate_conv2d_method(ConvolutionMethod          method,
+                              const ITensorInfo         *input,
+                              const ITensorInfo         *weights,
+                              const ITensorInfo         *biases,
+                              const ITensorInfo         *output,
+                              const PadStrideInfo       &conv_info,
+                              const WeightsInfo         &weights_info,
+                              const Size2D              &dilation,
+                              const ActivationLayerInfo &act_info,
+                              bool                       enable_fast_math)
 {
+    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, 1);
+    switch (method)
+    {
+        case ConvolutionMethod::WINOGRAD:
+            ARM_COMPUTE_RETURN_ERROR_ON(dilation != Size2D(1U, 1U));
+            return CpuWinogradConv2d::validate(input, weights, biases, output, conv_info, act_info, enable_fast_math);
+        case ConvolutionMethod::GEMM:
+            return CpuGemmConv2d::validate(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
+                                           enable_fast_math);
+        case ConvolutionMethod::GEMM_CONV2D:
+            return CpuGemmDirectConv2d::validate(input, weights, biases, output, info);
+        case ConvolutionMethod::DIRECT:
+            ARM_COMPUTE_RETURN_ERROR_ON(dilation != Size2D(1U, 1U));
+            return CpuDirectConv2d::validate(input, weights, biases, output, conv_info, act_info);
+        default:
+            ARM_COMPUTE_ERROR("Not supported.");
+            break;
+    }
+    return Status{};
 }
 
-CpuConv2d::~CpuConv2d() = default;
-
-void CpuConv2d::configure(ITensorInfo               *input,
-                          ITensorInfo               *weights,
-                          const ITensorInfo         *biases,
-                          ITensorInfo               *output,
-                          const PadStrideInfo       &conv_info,
-                          const WeightsInfo         &weights_info,
-                          const Size2D              &dilation,
-                          const ActivationLayerInfo &act_info,
-                          bool                       enable_fast_math,
-                          unsigned int               num_groups)
+/** Creates and configures the operator running a convolution method
+ *
+ * @return The configured operator
+ */
+std::unique_ptr<ICpuOperator> create_conv2d_method(ConvolutionMethod          method,
+                                                   ITensorInfo               *input,
+                                                   ITensorInfo               *weights,
+                                                   const ITensorInfo         *biases,
+                                                   ITensorInfo               *output,
+                                                   const PadStrideInfo       &conv_info,
+                                                   const WeightsInfo         &weights_info,
+                                                   const Size2D              &dilation,
+                                                   const ActivationLayerInfo &act_info,
+                                                   bool                       enable_fast_math,
+                                                   unsigned int               num_groups)
 {
-    // Perform validate step
-    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_UNUSED(num_groups);
-    ARM_COMPUTE_ERROR_THROW_ON(CpuConv2d::validate(input, weights, biases, output, conv_info, weights_info, dilation,
-                                                   act_info, enable_fast_math, num_groups));
-
-    ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
-                           enable_fast_math, num_groups);
-
-    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch (CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info,
-                                              enable_fast_math))
+    switch (method)
     {
         case ConvolutionMethod::WINOGRAD:
         {
             auto f = std::make_unique<CpuWinogradConv2d>();
             f->configure(input, weights, biases, output, conv_info, act_info, enable_fast_math);
-            _function = std::move(f);
-            break;
+            return f;
         }
         case ConvolutionMethod::GEMM:
         {
             auto f = std::make_unique<CpuGemmConv2d>();
-            f->configure(input, weights, biases, output, conv_info, weights_info, dilation, act_info, enable_fast_math);
-            _function = std::move(f);
-            break;
+            f->configure(input, weights, biases, output, conv_info, weights_info, dilation, act_info, enable_fast_math,
+                         num_groups);
+            return f;
         }
         case ConvolutionMethod::GEMM_CONV2D:
         {
             auto f = std::make_unique<CpuGemmDirectConv2d>();
-            f->configure(input, weights, biases, output, info);
-            _function = std::move(f);
-            break;
+            f->configure(input, weights, biases, output,
+                         Conv2dInfo(conv_info, dilation, act_info, enable_fast_math, num_groups));
+            return f;
         }
         case ConvolutionMethod::DIRECT:
         {
             auto f = std::make_unique<CpuDirectConv2d>();
             f->configure(input, weights, biases, output, conv_info, act_info);
-            _function = std::move(f);
-            break;
+            return f;
         }
         default:
             ARM_COMPUTE_ERROR("Not supported.");
             break;
     }
+    return nullptr;
+}
+
+/** Times a convolution method on zero-filled tensors shaped as the given info
+ *
+ * The operator is prepared and run once before being timed, the best of a few runs is returned.
+ *
+ * @return The time of the method in nanoseconds
+ */
+int64_t time_conv2d_method(ConvolutionMethod          method,
+                           const ITensorInfo         *input,
+                           const ITensorInfo         *weights,
+                           const ITensorInfo         *output,
+                           const PadStrideInfo       &conv_info,
+                           const Size2D              &dilation,
+                           const ActivationLayerInfo &act_info,
+                           bool                       enable_fast_math)
+{
+    constexpr unsigned int num_iterations = 3;
+
+    // The operators may extend the padding of the infos they are configured with
+    auto src_info     = input->clone();
+    auto weights_info = weights->clone();
+    auto dst_info     = output->clone();
+    src_info->set_is_resizable(true);
+    weights_info->set_is_resizable(true);
+    dst_info->set_is_resizable(true);
+
+    auto op = create_conv2d_method(method, src_info.get(), weights_info.get(), nullptr, dst_info.get(), conv_info,
+                                   WeightsInfo(), dilation, act_info, enable_fast_math, 1);
+
+    Tensor src, wei, dst;
+    src.allocator()->init(*src_info);
+    wei.allocator()->init(*weights_info);
+    dst.allocator()->init(*dst_info);
+    for (Tensor *t : {&src, &wei, &dst})
+    {
+        t->allocator()->allocate();
+        std::memset(t->buffer(), 0, t->info()->total_size());
+    }
+
+    ITensorPack pack{{ACL_SRC_0, &src}, {ACL_SRC_1, &wei}, {ACL_DST, &dst}};
+
+    // Without a memory manager, the workspace tensors are all allocated for the whole measurement
+    MemoryGroup mg;
+    auto        workspace = manage_workspace<Tensor>(op->workspace(), mg, pack);
+
+    // Warm-up run, not measured
+    op->prepare(pack);
+    op->run(pack);
+
+    int64_t best_time = std::numeric_limits<int64_t>::max();
+    for (unsigned int i = 0; i < num_iterations; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        op->run(pack);
+        const auto end = std::chrono::steady_clock::now();
+        best_time      = std::min<int64_t>(best_time,
+                                           std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+    return best_time;
+}
+} // namespace
+
+CpuConv2d::CpuConv2d() : _function()
+{
+}
+
+CpuConv2d::~CpuConv2d() = default;
+
+void CpuConv2d::configure(ITensorInfo               *input,
+                          ITensorInfo               *weights,
+                          const ITensorInfo         *biases,
+                          ITensorInfo               *output,
+                          const PadStrideInfo       &conv_info,
+                          const WeightsInfo         &weights_info,
+                          const Size2D              &dilation,
+                          const ActivationLayerInfo &act_info,
+                          bool                       enable_fast_math,
+                          unsigned int               num_groups)
+{
+    // Perform validate step
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(CpuConv2d::validate(input, weights, biases, output, conv_info, weights_info,
+                                                             dilation, act_info, enable_fast_math, num_groups));
+    const TrustedConfigureScope trusted_configure{};
+
+    ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
+                           enable_fast_math, num_groups);
+
+    // Grouped convolutions are only run by the GEMM method
+    _method = (num_groups > 1) ? ConvolutionMethod::GEMM
+                               : CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info,
+                                                                   dilation, act_info, enable_fast_math);
+    _function = create_conv2d_method(_method, input, weights, biases, output, conv_info, weights_info, dilation,
+                                     act_info, enable_fast_math, num_groups);
 
     _aux_mem = _function->workspace();
 }
@@ -114,31 +247,18 @@ Status CpuConv2d::validate(const ITensorInfo         *input,
                            bool                       enable_fast_math,
                            unsigned int               num_groups)
 {
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1), "Grouping (num_groups != 1) is not supported on Neon");
-
-    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch (CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info,
-                                              enable_fast_math))
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups == 0);
+    if (num_groups > 1)
     {
-        case ConvolutionMethod::WINOGRAD:
-            ARM_COMPUTE_RETURN_ON_ERROR(
-                CpuWinogradConv2d::validate(input, weights, biases, output, conv_info, act_info, enable_fast_math));
-            break;
-        case ConvolutionMethod::GEMM:
-            ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmConv2d::validate(input, weights, biases, output, conv_info, weights_info,
-                                                                dilation, act_info, enable_fast_math));
-            break;
-        case ConvolutionMethod::GEMM_CONV2D:
-            ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmDirectConv2d::validate(input, weights, biases, output, info));
-            break;
-        case ConvolutionMethod::DIRECT:
-            ARM_COMPUTE_RETURN_ON_ERROR(CpuDirectConv2d::validate(input, weights, biases, output, conv_info, act_info));
-            break;
-        default:
-            ARM_COMPUTE_ERROR("Not supported.");
-            break;
+        return CpuGemmConv2d::validate(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
+                                       enable_fast_math, num_groups);
     }
 
+    const ConvolutionMethod method = CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info,
+                                                                       dilation, act_info, enable_fast_math);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_conv2d_method(method, input, weights, biases, output, conv_info, weights_info,
+                                                       dilation, act_info, enable_fast_math));
+
     return Status{};
 }
 
@@ -152,7 +272,20 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo         *i
                                                     bool                       enable_fast_math)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, weights);
-    ARM_COMPUTE_UNUSED(weights_info);
+
+    // Only the GEMM based convolution runs on compressed 2:4 structured-sparse weights
+    if (weights_info.sparse_weights() && weights->are_values_constant() &&
+        (input->data_type() == DataType::F32 || input->data_type() == DataType::F16))
+    {
+        return ConvolutionMethod::GEMM;
+    }
+
+    ConvolutionMethod measured_method = ConvolutionMethod::GEMM;
+    if (CpuConv2d::get_measured_convolution_method(input, weights, output, conv_info, dilation, act_info,
+                                                   enable_fast_math, measured_method))
+    {
+        return measured_method;
+    }
 
     const size_t idx_w = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
     const size_t idx_h = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
@@ -289,6 +422,61 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo         *i
     }
 }
 
+bool CpuConv2d::get_measured_convolution_method(const ITensorInfo         *input,
+                                                const ITensorInfo         *weights,
+                                                const ITensorInfo         *output,
+                                                const PadStrideInfo       &conv_info,
+                                                const Size2D              &dilation,
+                                                const ActivationLayerInfo &act_info,
+                                                bool                       enable_fast_math,
+                                                ConvolutionMethod         &method)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, weights);
+
+    CpuConvMethodTuner &tuner = CpuConvMethodTuner::get();
+    const std::string   key   = CpuConvMethodTuner::make_key(input, weights, conv_info, dilation, act_info,
+                                                             enable_fast_math);
+
+    // Entries from a file measured on a different build may refer to methods not available here
+    if (tuner.find(key, method))
+    {
+        return bool(validate_conv2d_method(method, input, weights, nullptr, output, conv_info, WeightsInfo(), dilation,
+                                           act_info, enable_fast_math));
+    }
+
+    // Output might not be initialized when it is an internal tensor of the layer using the convolution
+    if (!tuner.is_tuning_enabled() || output->total_size() == 0)
+    {
+        return false;
+    }
+
+    int64_t best_time = std::numeric_limits<int64_t>::max();
+    for (const ConvolutionMethod candidate : {ConvolutionMethod::GEMM, ConvolutionMethod::GEMM_CONV2D,
+                                              ConvolutionMethod::WINOGRAD, ConvolutionMethod::DIRECT})
+    {
+        if (!bool(validate_conv2d_method(candidate, input, weights, nullptr, output, conv_info, WeightsInfo(), dilation,
+                                         act_info, enable_fast_math)))
+        {
+            continue;
+        }
+        const int64_t time =
+            time_conv2d_method(candidate, input, weights, output, conv_info, dilation, act_info, enable_fast_math);
+        ARM_COMPUTE_LOG_MSG_WITH_FORMAT_ACL(arm_compute::logging::LogLevel::INFO, "Convolution %s measured %s: %lld ns",
+                                            key.c_str(), to_string(candidate).c_str(), static_cast<long long>(time));
+        if (time < best_time)
+        {
+            best_time = time;
+            method    = candidate;
+        }
+    }
+    if (best_time == std::numeric_limits<int64_t>::max())
+    {
+        return false;
+    }
+    tuner.add(key, method);
+    return true;
+}
+
 void CpuConv2d::run(ITensorPack &tensors)
 {
     prepare(tensors);
@@ -304,5 +492,60 @@ experimental::MemoryRequirements CpuConv2d::workspace() const
 {
     return _aux_mem;
 }
+
+OperatorDescription CpuConv2d::describe() const
+{
+    OperatorDescription desc{};
+    desc.name   = "CpuConv2d";
+    desc.method = to_string(_method);
+    if (_function != nullptr)
+    {
+        desc.children.emplace_back(_function->describe());
+    }
+    return desc;
+}
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_conv2d(const AclTensorDescriptor &src,
+                                                              const AclTensorDescriptor &weights,
+                                                              const AclTensorDescriptor *biases,
+                                                              const AclTensorDescriptor &dst,
+                                                              const AclConv2dDescriptor &conv,
+                                                              bool                       is_validate)
+{
+    if (!detail::is_valid_pad_stride(conv.pad_stride))
+    {
+        return std::make_tuple(nullptr, StatusCode::InvalidArgument);
+    }
+
+    const DataLayout layout       = detail::convert_to_legacy_data_layout(conv.data_layout);
+    TensorInfo       src_info     = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo       weights_info = detail::convert_to_legacy_tensor_info(weights);
+    TensorInfo       biases_info  = (biases != nullptr) ? detail::convert_to_legacy_tensor_info(*biases) : TensorInfo();
+    TensorInfo       dst_info     = detail::convert_to_legacy_tensor_info(dst);
+    src_info.set_data_layout(layout).set_is_resizable(false);
+    weights_info.set_data_layout(layout).set_is_resizable(false);
+    biases_info.set_is_resizable(false);
+    dst_info.set_data_layout(layout).set_is_resizable(false);
+    const ITensorInfo  *biases_to_use = (biases != nullptr) ? &biases_info : nullptr;
+    const PadStrideInfo conv_info     = detail::convert_to_pad_stride_info(conv.pad_stride);
+    const Size2D        dilation      = detail::convert_to_dilation(conv.dilation_x, conv.dilation_y);
+    const auto          act           = detail::convert_to_activation_info(conv.act);
+
+    if (!bool(CpuConv2d::validate(&src_info, &weights_info, biases_to_use, &dst_info, conv_info, WeightsInfo(),
+                                  dilation, act, conv.enable_fast_math)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto conv_op = std::make_unique<cpu::CpuConv2d>();
+    conv_op->configure(&src_info, &weights_info, biases_to_use, &dst_info, conv_info, WeightsInfo(), dilation, act,
+                       conv.enable_fast_math);
+
+    return detail::make_operator(static_cast<IContext *>(this), std::move(conv_op));
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -106,7 +106,8 @@ public:
      * @param[in]  act_info         (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
      * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                              available which may introduce a drop of accuracy as well. Default is false
-     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups > 1 is only supported for
+     *                              NHWC F16/F32 with initialized outputs, the IFM of the weights being the one of a group
      */
     void configure(ITensorInfo               *src,
                    ITensorInfo               *weights,
@@ -161,14 +162,41 @@ public:
                                                     const Size2D              &dilation         = Size2D(1U, 1U),
                                                     const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
                                                     bool                       enable_fast_math = false);
+    /** Static function to get the convolution method measured as the fastest for the given info
+     *
+     * The methods are recorded by @ref CpuConvMethodTuner. When tuning is enabled, the valid methods of a convolution
+     * missing from its table are timed on the current number of threads and the fastest one is recorded first.
+     *
+     * @param[in]  src              Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights          Weights tensor info. Data type supported: Same as @p src, also could be
+     *                              QSYMM8_PER_CHANNEL or QASYMM8_SIGNED if input is QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  dst              Destination tensor info. Must be initialized for the methods to be timed.
+     * @param[in]  conv_info        Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  dilation         Dilation, in elements, across x and y.
+     * @param[in]  act_info         Activation layer information in case of a fused activation.
+     * @param[in]  enable_fast_math Enable fast math computation.
+     * @param[out] method           Measured convolution method. Only set when one is available
+     *
+     * @return True if a measured method valid for the given info is available
+     */
+    static bool get_measured_convolution_method(const ITensorInfo         *src,
+                                                const ITensorInfo         *weights,
+                                                const ITensorInfo         *dst,
+                                                const PadStrideInfo       &conv_info,
+                                                const Size2D              &dilation,
+                                                const ActivationLayerInfo &act_info,
+                                                bool                       enable_fast_math,
+                                                ConvolutionMethod         &method);
     // Inherited methods overridden:
     void                             run(ITensorPack &tensors) override;
     void                             prepare(ITensorPack &constants) override;
     experimental::MemoryRequirements workspace() const override;
+    OperatorDescription              describe() const override;
 
 private:
     std::unique_ptr<ICpuOperator>    _function;
     experimental::MemoryRequirements _aux_mem{};
+    ConvolutionMethod                _method{ConvolutionMethod::GEMM};
 };
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,9 @@
  */
 #include "src/cpu/operators/CpuCopy.h"
 
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Scheduler.h"
+
 #include "src/common/utils/Log.h"
 #include "src/cpu/kernels/CpuCopyKernel.h"
 
@@ -42,5 +45,12 @@ Status CpuCopy::validate(const ITensorInfo *src, const ITensorInfo *dst)
 {
     return kernels::CpuCopyKernel::validate(src, dst);
 }
+void CpuCopy::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+    ScopedScheduler scope(_ctx != nullptr ? _ctx->scheduler() : nullptr);
+    auto split_dimension = static_cast<kernels::CpuCopyKernel *>(_kernel.get())->get_split_dimension_hint();
+    NEScheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,11 +21,15 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/operators/CpuDepthwiseConv2d.h"
 
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/utils/misc/InfoHelpers.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
@@ -83,8 +87,9 @@ void CpuDepthwiseConv2d::CpuDepthwiseConv2dOptimizedInternal::configure(ITensorI
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
     // Perform validation step
-    ARM_COMPUTE_ERROR_THROW_ON(
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(
         CpuDepthwiseConv2dOptimizedInternal::validate(src, weights, (biases == nullptr) ? nullptr : biases, dst, info));
+    const TrustedConfigureScope trusted_configure{};
 
     _is_quantized      = is_data_type_quantized_asymmetric(src->data_type());
     _has_bias          = biases != nullptr;
@@ -290,8 +295,9 @@ void CpuDepthwiseConv2d::CpuDepthwiseConv2dGeneric::configure(ITensorInfo
                                                               const ConvolutionInfo &info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
-    ARM_COMPUTE_ERROR_THROW_ON(
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(
         CpuDepthwiseConv2d::validate(src, weights, (biases == nullptr) ? nullptr : biases, dst, info));
+    const TrustedConfigureScope trusted_configure{};
 
     _is_nchw     = src->data_layout() == DataLayout::NCHW;
     _is_prepared = !_is_nchw;
@@ -558,5 +564,47 @@ void CpuDepthwiseConv2d::prepare(ITensorPack &tensors)
             ARM_COMPUTE_ERROR("DepthwiseConvolutionFunction not properly configured");
     }
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_depthwise_conv2d(const AclTensorDescriptor          &src,
+                                                                        const AclTensorDescriptor          &weights,
+                                                                        const AclTensorDescriptor          *biases,
+                                                                        const AclTensorDescriptor          &dst,
+                                                                        const AclDepthwiseConv2dDescriptor &conv,
+                                                                        bool                                is_validate)
+{
+    if (!detail::is_valid_pad_stride(conv.pad_stride) || conv.depth_multiplier <= 0)
+    {
+        return std::make_tuple(nullptr, StatusCode::InvalidArgument);
+    }
+
+    const DataLayout layout       = detail::convert_to_legacy_data_layout(conv.data_layout);
+    TensorInfo       src_info     = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo       weights_info = detail::convert_to_legacy_tensor_info(weights);
+    TensorInfo       biases_info  = (biases != nullptr) ? detail::convert_to_legacy_tensor_info(*biases) : TensorInfo();
+    TensorInfo       dst_info     = detail::convert_to_legacy_tensor_info(dst);
+    src_info.set_data_layout(layout).set_is_resizable(false);
+    weights_info.set_data_layout(layout).set_is_resizable(false);
+    biases_info.set_is_resizable(false);
+    dst_info.set_data_layout(layout).set_is_resizable(false);
+    const ITensorInfo    *biases_to_use = (biases != nullptr) ? &biases_info : nullptr;
+    const ConvolutionInfo info{detail::convert_to_pad_stride_info(conv.pad_stride),
+                               static_cast<unsigned int>(conv.depth_multiplier),
+                               detail::convert_to_activation_info(conv.act),
+                               detail::convert_to_dilation(conv.dilation_x, conv.dilation_y)};
+
+    if (!bool(CpuDepthwiseConv2d::validate(&src_info, &weights_info, biases_to_use, &dst_info, info)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto conv_op = std::make_unique<cpu::CpuDepthwiseConv2d>();
+    conv_op->configure(&src_info, &weights_info, biases_to_use, &dst_info, info);
+
+    return detail::make_operator(static_cast<IContext *>(this), std::move(conv_op));
+}
 } // namespace cpu
 } // namespace arm_compute
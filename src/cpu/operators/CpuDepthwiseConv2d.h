@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -100,7 +100,6 @@ private:
     *
     * @note At the moment 3x3 and 5x5 convolution of stride 1, 2 are supported
     *
-    * -# @ref NEFillBorderKernel (if pad_x or pad_y > 0) and no assembly kernel implementation is present
     * -# @ref CpuDepthwiseConv2d3x3Kernel if 3x3 and no assembly kernel implementation is present
     * -# @ref CpuDepthwiseConv2dAssemblyDispatch if assembly kernel implementation is present
     * -# @ref CpuActivation if fused activation is required
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,9 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/operators/CpuDequantize.h"
 
 #include "arm_compute/core/TensorInfo.h"
@@ -53,5 +56,30 @@ void CpuDequantize::run(ITensorPack &tensors)
     prepare(tensors);
     NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, _kernel->window(), tensors);
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_dequantize(const AclTensorDescriptor       &src,
+                                                                  const AclTensorDescriptor       &dst,
+                                                                  const AclQuantizationDescriptor &qinfo,
+                                                                  bool                             is_validate)
+{
+    TensorInfo src_info = detail::convert_to_legacy_tensor_info(src, qinfo);
+    TensorInfo dst_info = detail::convert_to_legacy_tensor_info(dst);
+    src_info.set_is_resizable(false);
+    dst_info.set_is_resizable(false);
+
+    if (!bool(CpuDequantize::validate(&src_info, &dst_info)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto dequantize_op = std::make_unique<cpu::CpuDequantize>();
+    dequantize_op->configure(&src_info, &dst_info);
+
+    return detail::make_operator(static_cast<IContext *>(this), std::move(dequantize_op));
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,9 @@ namespace cpu
 /** Basic function to execute dynamic GEMM. This function calls the following kernels:
  *
  *  -# @ref cpu::kernels::CpuDynamicGemmKernel
+ *
+ * @note When the values of b and c are constant, b is packed on the first run only and the packing is reused by later
+ *       runs with any number of rows in a, as long as the packed RHS workspace is kept.
  */
 class CpuDynamicGemm : public ICpuOperator
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,7 +21,15 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
+#include "src/cpu/CpuContext.h"
+#include "src/cpu/operators/CpuAdd.h"
 #include "src/cpu/operators/CpuElementwise.h"
+#include "src/cpu/operators/CpuMul.h"
+#include "src/cpu/operators/CpuSub.h"
 
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/WindowHelpers.h"
@@ -33,10 +41,10 @@ namespace cpu
 {
 void CpuElementwiseBase::run(ITensorPack &tensors)
 {
-    // If the kernel has been configured, use the window from the kernel.
+    // If the kernel has been configured, use the window and split dimension from the kernel.
     if (_kernel->is_window_configured())
     {
-        ICpuOperator::run(tensors);
+        NEScheduler::get().schedule_op(_kernel.get(), _split_dimension, _kernel->window(), tensors);
         return;
     }
 
@@ -52,7 +60,8 @@ void CpuElementwiseArithmetic<op>::configure(const ITensorInfo *src0, const ITen
     ARM_COMPUTE_LOG_PARAMS(src0, src1, dst);
     auto k = std::make_unique<kernels::CpuArithmeticKernel>();
     k->configure(op, src0, src1, dst);
-    _kernel = std::move(k);
+    _split_dimension = k->get_split_dimension_hint();
+    _kernel          = std::move(k);
 }
 
 template <ArithmeticOperation op>
@@ -71,7 +80,8 @@ void CpuElementwiseDivision::configure(const ITensorInfo *src0, const ITensorInf
     ARM_COMPUTE_LOG_PARAMS(src0, src1, dst);
     auto k = std::make_unique<kernels::CpuDivisionKernel>();
     k->configure(src0, src1, dst);
-    _kernel = std::move(k);
+    _split_dimension = k->get_split_dimension_hint();
+    _kernel          = std::move(k);
 }
 
 Status CpuElementwiseDivision::validate(const ITensorInfo *src0, const ITensorInfo *src1, const ITensorInfo *dst)
@@ -84,7 +94,8 @@ void CpuElementwisePower::configure(const ITensorInfo *src0, const ITensorInfo *
     ARM_COMPUTE_LOG_PARAMS(src0, src1, dst);
     auto k = std::make_unique<kernels::CpuPowerKernel>();
     k->configure(src0, src1, dst);
-    _kernel = std::move(k);
+    _split_dimension = k->get_split_dimension_hint();
+    _kernel          = std::move(k);
 }
 
 Status CpuElementwisePower::validate(const ITensorInfo *src0, const ITensorInfo *src1, const ITensorInfo *dst)
@@ -98,7 +109,8 @@ void CpuElementwiseComparisonStatic<COP>::configure(const ITensorInfo *src0, con
     ARM_COMPUTE_LOG_PARAMS(src0, src1, dst);
     auto k = std::make_unique<kernels::CpuComparisonKernel>();
     k->configure(COP, src0, src1, dst);
-    _kernel = std::move(k);
+    _split_dimension = k->get_split_dimension_hint();
+    _kernel          = std::move(k);
 }
 
 template <ComparisonOperation COP>
@@ -116,7 +128,8 @@ void CpuElementwiseComparison::configure(const ITensorInfo  *src0,
     ARM_COMPUTE_LOG_PARAMS(src0, src1, dst);
     auto k = std::make_unique<kernels::CpuComparisonKernel>();
     k->configure(op, src0, src1, dst);
-    _kernel = std::move(k);
+    _split_dimension = k->get_split_dimension_hint();
+    _kernel          = std::move(k);
 }
 
 Status CpuElementwiseComparison::validate(const ITensorInfo  *src0,
@@ -134,5 +147,99 @@ template class CpuElementwiseComparisonStatic<ComparisonOperation::Greater>;
 template class CpuElementwiseComparisonStatic<ComparisonOperation::GreaterEqual>;
 template class CpuElementwiseComparisonStatic<ComparisonOperation::Less>;
 template class CpuElementwiseComparisonStatic<ComparisonOperation::LessEqual>;
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_elementwise(const AclTensorDescriptor      &src0,
+                                                                   const AclTensorDescriptor      &src1,
+                                                                   const AclTensorDescriptor      &dst,
+                                                                   const AclElementwiseDescriptor &info,
+                                                                   bool                            is_validate)
+{
+    TensorInfo src0_info = detail::convert_to_legacy_tensor_info(src0);
+    TensorInfo src1_info = detail::convert_to_legacy_tensor_info(src1);
+    TensorInfo dst_info  = detail::convert_to_legacy_tensor_info(dst);
+    src0_info.set_is_resizable(false);
+    src1_info.set_is_resizable(false);
+    dst_info.set_is_resizable(false);
+    const ActivationLayerInfo act = detail::convert_to_activation_info(info.act);
+
+    std::unique_ptr<experimental::IOperator> elementwise_op{nullptr};
+    Status                                   status{};
+    switch (info.op)
+    {
+        case AclElementwiseOp::AclElementwiseAdd:
+            status = CpuAdd::validate(&src0_info, &src1_info, &dst_info, ConvertPolicy::SATURATE, act);
+            if (bool(status) && !is_validate)
+            {
+                auto op = std::make_unique<cpu::CpuAdd>();
+                op->configure(&src0_info, &src1_info, &dst_info, ConvertPolicy::SATURATE, act);
+                elementwise_op = std::move(op);
+            }
+            break;
+        case AclElementwiseOp::AclElementwiseSub:
+            status = CpuSub::validate(&src0_info, &src1_info, &dst_info, ConvertPolicy::SATURATE, act);
+            if (bool(status) && !is_validate)
+            {
+                auto op = std::make_unique<cpu::CpuSub>();
+                op->configure(&src0_info, &src1_info, &dst_info, ConvertPolicy::SATURATE, act);
+                elementwise_op = std::move(op);
+            }
+            break;
+        case AclElementwiseOp::AclElementwiseMul:
+            status = CpuMul::validate(&src0_info, &src1_info, &dst_info, 1.f, ConvertPolicy::SATURATE,
+                                      RoundingPolicy::TO_ZERO, act);
+            if (bool(status) && !is_validate)
+            {
+                auto op = std::make_unique<cpu::CpuMul>();
+                op->configure(&src0_info, &src1_info, &dst_info, 1.f, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO,
+                              act);
+                elementwise_op = std::move(op);
+            }
+            break;
+        case AclElementwiseOp::AclElementwiseDiv:
+            status = CpuElementwiseDivision::validate(&src0_info, &src1_info, &dst_info);
+            if (bool(status) && !is_validate)
+            {
+                auto op = std::make_unique<cpu::CpuElementwiseDivision>();
+                op->configure(&src0_info, &src1_info, &dst_info);
+                elementwise_op = std::move(op);
+            }
+            break;
+        case AclElementwiseOp::AclElementwiseMax:
+            status = CpuElementwiseMax::validate(&src0_info, &src1_info, &dst_info);
+            if (bool(status) && !is_validate)
+            {
+                auto op = std::make_unique<cpu::CpuElementwiseMax>();
+                op->configure(&src0_info, &src1_info, &dst_info);
+                elementwise_op = std::move(op);
+            }
+            break;
+        case AclElementwiseOp::AclElementwiseMin:
+            status = CpuElementwiseMin::validate(&src0_info, &src1_info, &dst_info);
+            if (bool(status) && !is_validate)
+            {
+                auto op = std::make_unique<cpu::CpuElementwiseMin>();
+                op->configure(&src0_info, &src1_info, &dst_info);
+                elementwise_op = std::move(op);
+            }
+            break;
+        default:
+            return std::make_tuple(nullptr, StatusCode::InvalidArgument);
+    }
+
+    // Only addition, subtraction and multiplication fuse an activation
+    const bool is_fused_act_supported = info.op == AclElementwiseOp::AclElementwiseAdd ||
+                                        info.op == AclElementwiseOp::AclElementwiseSub ||
+                                        info.op == AclElementwiseOp::AclElementwiseMul;
+    if (!bool(status) || (act.enabled() && !is_fused_act_supported))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    return detail::make_operator(static_cast<IContext *>(this), std::move(elementwise_op));
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUELEMENTWISECHAIN_H
+#define ACL_SRC_CPU_OPERATORS_CPUELEMENTWISECHAIN_H
+
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to evaluate a chain of elementwise operations in a single pass
+ *
+ * This function runs the following kernels:
+ * -# @ref kernels::CpuElementwiseChainKernel
+ */
+class CpuElementwiseChain : public ICpuOperator
+{
+public:
+    /** Set the input and output tensors.
+     *
+     * The input is expected at ACL_SRC_0, the operands at ACL_SRC_VEC + i and the destination at ACL_DST of the packs.
+     *
+     * @param[in]  src      Input tensor info of the chain. Data types supported: F32/F16.
+     * @param[in]  operands Operand tensor infos of the binary operations, with the shape of @p src or holding a single
+     *                      row of it. Data types supported: same as @p src.
+     * @param[out] dst      Destination tensor info with the shape of @p src. Data types supported: same as @p src, or
+     *                      QASYMM8/QASYMM8_SIGNED if @p src is F32 to quantize the result of the chain.
+     * @param[in]  chain    Operations to apply, in order.
+     */
+    void configure(const ITensorInfo                      *src,
+                   const std::vector<const ITensorInfo *> &operands,
+                   ITensorInfo                            *dst,
+                   const ElementwiseChainInfo             &chain);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuElementwiseChain::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                      *src,
+                           const std::vector<const ITensorInfo *> &operands,
+                           const ITensorInfo                      *dst,
+                           const ElementwiseChainInfo             &chain);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUELEMENTWISECHAIN_H
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuEmbeddingBag.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuEmbeddingBagKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuEmbeddingBag::configure(const ITensorInfo *table,
+                                const ITensorInfo *indices,
+                                const ITensorInfo *offsets,
+                                const ITensorInfo *weights,
+                                ITensorInfo       *dst,
+                                ReductionOperation op)
+{
+    ARM_COMPUTE_LOG_PARAMS(table, indices, offsets, weights, dst, op);
+
+    auto k = std::make_unique<kernels::CpuEmbeddingBagKernel>();
+    k->configure(table, indices, offsets, weights, dst, op);
+    _kernel = std::move(k);
+}
+
+Status CpuEmbeddingBag::validate(const ITensorInfo *table,
+                                 const ITensorInfo *indices,
+                                 const ITensorInfo *offsets,
+                                 const ITensorInfo *weights,
+                                 const ITensorInfo *dst,
+                                 ReductionOperation op)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(table, indices, offsets, dst);
+    return kernels::CpuEmbeddingBagKernel::validate(table, indices, offsets, weights, dst, op);
+}
+
+void CpuEmbeddingBag::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+    NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, _kernel->window(), tensors);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUEMBEDDINGBAG_H
+#define ACL_SRC_CPU_OPERATORS_CPUEMBEDDINGBAG_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/cpu/ICpuOperator.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to gather and pool bags of embedding rows
+ *
+ * Replaces a @ref NEGatherKernel to an intermediate tensor followed by a reduction with a single kernel.
+ *
+ * This function runs the following kernels:
+ * -# @ref kernels::CpuEmbeddingBagKernel
+ */
+class CpuEmbeddingBag : public ICpuOperator
+{
+public:
+    /** Set the input and output tensors.
+     *
+     * @param[in]  table   Embedding table info with shape [embedding size, number of embeddings].
+     *                     Data types supported: F32/F16/QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  indices 1D tensor info of the rows to gather, out of range indices gather zeros.
+     *                     Data types supported: U32/S32.
+     * @param[in]  offsets 1D tensor info of the first index of each bag, with shape [number of bags].
+     *                     Data types supported: U32/S32.
+     * @param[in]  weights (Optional) Per index weights with the same shape as @p indices. Can be nullptr.
+     *                     Only supported with @ref ReductionOperation::SUM. Data types supported: F32.
+     * @param[out] dst     Destination tensor info with shape [embedding size, number of bags].
+     *                     Data types supported: F16 if @p table is F16, F32 otherwise.
+     * @param[in]  op      Pooling of the rows of a bag. Supported: @ref ReductionOperation::SUM,
+     *                     @ref ReductionOperation::MEAN_SUM.
+     */
+    void configure(const ITensorInfo *table,
+                   const ITensorInfo *indices,
+                   const ITensorInfo *offsets,
+                   const ITensorInfo *weights,
+                   ITensorInfo       *dst,
+                   ReductionOperation op);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuEmbeddingBag::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *table,
+                           const ITensorInfo *indices,
+                           const ITensorInfo *offsets,
+                           const ITensorInfo *weights,
+                           const ITensorInfo *dst,
+                           ReductionOperation op);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUEMBEDDINGBAG_H
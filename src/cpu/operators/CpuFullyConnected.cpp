@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, 2025 Arm Limited.
+ * Copyright (c) 2021-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/ITensorPack.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
@@ -34,13 +35,19 @@
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/utils/quantization/AsymmHelpers.h"
+#include "src/cpu/kernels/CpuQuantizeKernel.h"
+#include "src/cpu/kernels/CpuRowAbsMaxKernel.h"
 #include "src/cpu/kernels/CpuTransposeKernel.h"
+#include "src/cpu/kernels/CpuUnpackInt4Kernel.h"
 #include "src/cpu/operators/CpuConvertFullyConnectedWeights.h"
 #include "src/cpu/operators/CpuFlatten.h"
 #include "src/cpu/operators/CpuGemm.h"
 #include "src/cpu/operators/CpuGemmLowpMatrixMultiplyCore.h"
+#include "src/cpu/operators/CpuGemvBlockSparse.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace cpu
@@ -50,6 +57,39 @@ using namespace arm_compute::misc::shape_calculator;
 
 namespace
 {
+/** Check whether a layer quantizes its floating-point src at run time to multiply it by int8 weights */
+bool is_dynamically_quantized(const ITensorInfo *src, const ITensorInfo *weights)
+{
+    return src->data_type() == DataType::F32 && weights->data_type() == DataType::QASYMM8_SIGNED;
+}
+
+/** Tensor info of the src of a dynamically quantized layer, its scale is recomputed at every run */
+TensorInfo dynamic_quantized_src_info(const ITensorInfo *src)
+{
+    return TensorInfo(src->clone()
+                          ->set_is_resizable(true)
+                          .reset_padding()
+                          .set_data_type(DataType::QASYMM8_SIGNED)
+                          .set_quantization_info(QuantizationInfo(1.f, 0, true)));
+}
+
+/** Check whether the transpose of the weights can be left to the floating-point GEMM
+ *
+ * Non-constant weights would otherwise be transposed into a temporary tensor at every run before being packed by the
+ * GEMM. The GEMM takes them untransposed instead and, with the assembly kernels accepting a transposed B, transposes
+ * them while packing them. The weights must not need any other transformation after the transpose.
+ */
+bool transpose_weights_in_mm(const ITensorInfo             *src,
+                             const ITensorInfo             *weights,
+                             const FullyConnectedLayerInfo &fc_info,
+                             const WeightsInfo             &weights_info,
+                             bool                           needs_weights_conversion)
+{
+    return !weights->are_values_constant() && is_data_type_float(src->data_type()) &&
+           !is_dynamically_quantized(src, weights) && !fc_info.sparse_weights && !fc_info.block_sparse_weights &&
+           weights_info.weight_format() == WeightFormat::UNSPECIFIED && !needs_weights_conversion;
+}
+
 Status get_gemmlowp_output_stage_info(const ITensorInfo         *src,
                                       const ITensorInfo         *weights,
                                       const ITensorInfo         *dst,
@@ -89,9 +129,34 @@ Status validate_mm(const ITensorInfo         *src,
                    const ITensorInfo         *dst,
                    const ActivationLayerInfo &act,
                    bool                       enable_fast_math,
-                   WeightFormat               weight_format)
+                   WeightFormat               weight_format,
+                   bool                       sparse_weights,
+                   bool                       block_sparse_weights,
+                   bool                       transpose_weights)
 {
-    if (is_data_type_quantized_asymmetric(src->data_type()))
+    if (is_dynamically_quantized(src, weights))
+    {
+#ifndef __aarch64__
+        ARM_COMPUTE_RETURN_ERROR_MSG("Dynamically quantized fully connected layers are only supported on aarch64");
+#endif /* __aarch64__ */
+        // The product is dequantized by the optimized assembly kernels, which need the weights to be reshaped once
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!weights->are_values_constant(),
+                                        "Dynamically quantized fully connected layers need constant weights");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->quantization_info().uniform().offset != 0,
+                                        "Dynamically quantized fully connected layers need symmetric weights");
+
+        const TensorInfo quantized_src = dynamic_quantized_src_info(src);
+        TensorInfo       src_abs_max{};
+        ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuRowAbsMaxKernel::validate(src, &src_abs_max));
+        ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuQuantizeKernel::validate(src, &quantized_src));
+
+        GEMMInfo gemm_info;
+        gemm_info.set_activation_info(act);
+        gemm_info.set_fast_math(enable_fast_math);
+        ARM_COMPUTE_RETURN_ON_ERROR(
+            CpuGemmLowpMatrixMultiplyCore::validate(&quantized_src, weights, biases, dst, gemm_info));
+    }
+    else if (is_data_type_quantized_asymmetric(src->data_type()))
     {
         // Since we need negative offsets for computing convolution, we need to change QuantizationInfo()
         // Extract and negate src and weights offset
@@ -113,13 +178,15 @@ Status validate_mm(const ITensorInfo         *src,
         ARM_COMPUTE_RETURN_ON_ERROR(
             CpuGemmLowpMatrixMultiplyCore::validate(&src_info, &weights_info, biases, dst, gemm_info));
     }
-    else
+    else if (!(block_sparse_weights && bool(CpuGemvBlockSparse::validate(src, weights, biases, dst, act))))
     {
         GEMMInfo gemm_info;
         gemm_info.set_weight_format(weight_format);
         gemm_info.set_fixed_format(weight_format != WeightFormat::UNSPECIFIED);
         gemm_info.set_fast_math(enable_fast_math);
         gemm_info.set_activation_info(act);
+        gemm_info.set_sparse_weights(sparse_weights);
+        gemm_info.set_pretranspose_B(transpose_weights);
         ARM_COMPUTE_RETURN_ON_ERROR(CpuGemm::validate(src, weights, biases, dst, 1.f, 1.0f, gemm_info));
     }
 
@@ -133,21 +200,33 @@ CpuFullyConnected::CpuFullyConnected()
       _transpose_weights(nullptr),
       _mm_gemm(nullptr),
       _mm_gemmlowp(nullptr),
+      _mm_sparse_gemv(nullptr),
+      _src_abs_max(nullptr),
+      _quantize_src(nullptr),
+      _unpack_weights(nullptr),
       _flattened_src(),
       _converted_weights(),
       _reshaped_weights(),
       _trans_weights(),
+      _src_abs_max_info(),
+      _quantized_src(),
+      _unpacked_weights(),
       _trans_weights_idx(AuxTensorIdx::Count),
       _aux_mem(Count),
+      _needs_weights_unpack(false),
       _needs_weights_conversion(false),
       _needs_weights_reshape(false),
+      _transpose_weights_in_mm(false),
       _is_fc_after_conv(false),
       _is_quantized_asymmetric(false),
+      _is_dynamically_quantized(false),
       _is_prepared(false),
       _enable_fast_math(false),
       _fixed_format(false),
       _weight_format(arm_compute::WeightFormat::UNSPECIFIED),
-      _dynamic_weights(false)
+      _dynamic_weights(false),
+      _sparse_weights(false),
+      _block_sparse_weights(false)
 {
 }
 
@@ -159,7 +238,26 @@ void CpuFullyConnected::configure_mm(const ITensorInfo         *src,
                                      ITensorInfo               *dst,
                                      const ActivationLayerInfo &act)
 {
-    if (_is_quantized_asymmetric)
+    if (_is_dynamically_quantized)
+    {
+        // The src is quantized before the multiplication with a symmetric scale covering its whole range, this scale
+        // is only known at run time and reaches the assembly kernels through the dynamic quantization info
+        _quantized_src = dynamic_quantized_src_info(src);
+
+        _src_abs_max = std::make_unique<kernels::CpuRowAbsMaxKernel>();
+        _src_abs_max->configure(src, &_src_abs_max_info);
+
+        _quantize_src = std::make_unique<kernels::CpuQuantizeKernel>();
+        _quantize_src->configure(src, &_quantized_src);
+
+        // The int8 product is dequantized, biased and activated by the merge of the assembly kernels
+        GEMMInfo gemm_info;
+        gemm_info.set_activation_info(act);
+        gemm_info.set_fast_math(_enable_fast_math);
+        _mm_gemmlowp = std::make_unique<CpuGemmLowpMatrixMultiplyCore>();
+        _mm_gemmlowp->configure(&_quantized_src, weights, biases, dst, gemm_info);
+    }
+    else if (_is_quantized_asymmetric)
     {
         // Since we need negative offsets for computing convolution, we need to change QuantizationInfo()
         // Extract and negate src and weights offset
@@ -184,6 +282,12 @@ void CpuFullyConnected::configure_mm(const ITensorInfo         *src,
         _mm_gemmlowp = std::make_unique<CpuGemmLowpMatrixMultiplyCore>();
         _mm_gemmlowp->configure(&src_info, &weights_info, biases, dst, gemm_info);
     }
+    else if (_block_sparse_weights && bool(CpuGemvBlockSparse::validate(src, weights, biases, dst, act)))
+    {
+        // A single row of activations multiplied by pruned weights only goes through their non-zero blocks
+        _mm_sparse_gemv = std::make_unique<CpuGemvBlockSparse>();
+        _mm_sparse_gemv->configure(src, weights, biases, dst, act);
+    }
     else
     {
         // Configure matrix multiply kernel
@@ -192,6 +296,8 @@ void CpuFullyConnected::configure_mm(const ITensorInfo         *src,
         gemm_info.set_fast_math(_enable_fast_math);
         gemm_info.set_fixed_format(_fixed_format);
         gemm_info.set_weight_format(_weight_format);
+        gemm_info.set_sparse_weights(_sparse_weights);
+        gemm_info.set_pretranspose_B(_transpose_weights_in_mm);
         _mm_gemm = std::make_unique<CpuGemm>();
         _mm_gemm->configure(src, weights, biases, dst, 1.f, 1.0f, gemm_info);
     }
@@ -203,7 +309,8 @@ void CpuFullyConnected::configure_conv_fc(const ITensorInfo         *src,
                                           ITensorInfo               *dst,
                                           const ActivationLayerInfo &act)
 {
-    ARM_COMPUTE_ERROR_ON((weights->dimension(1) != (src->dimension(0) * src->dimension(1) * src->dimension(2))));
+    ARM_COMPUTE_ERROR_ON((weights->dimension(_transpose_weights_in_mm ? 0 : 1) !=
+                          (src->dimension(0) * src->dimension(1) * src->dimension(2))));
 
     // If the fully connected layer is called after a convolution layer, the src tensor must be linearized
 
@@ -223,7 +330,7 @@ void CpuFullyConnected::configure_fc_fc(const ITensorInfo         *src,
                                         ITensorInfo               *dst,
                                         const ActivationLayerInfo &act)
 {
-    ARM_COMPUTE_ERROR_ON(src->dimension(0) != weights->dimension(1));
+    ARM_COMPUTE_ERROR_ON(src->dimension(0) != weights->dimension(_transpose_weights_in_mm ? 0 : 1));
 
     // Configure matrix multiply kernel
     configure_mm(src, weights, biases, dst, act);
@@ -238,21 +345,27 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
 {
     // Perform validate step
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
-    ARM_COMPUTE_ERROR_THROW_ON(
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(
         CpuFullyConnected::validate(src, weights, biases != nullptr ? biases : nullptr, dst, fc_info, weights_info));
+    const TrustedConfigureScope trusted_configure{};
     ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, fc_info);
 
+    _needs_weights_unpack     = weights->data_type() == DataType::U8;
     _needs_weights_conversion = false;
     _needs_weights_reshape    = fc_info.transpose_weights ? !fc_info.are_weights_reshaped : false;
     _needs_weights_reshape    = _needs_weights_reshape && !fc_info.retain_internal_weights;
+    _transpose_weights_in_mm  = false;
     _is_fc_after_conv         = true;
     _is_quantized_asymmetric  = is_data_type_quantized_asymmetric(src->data_type());
+    _is_dynamically_quantized = is_dynamically_quantized(src, weights);
     _is_prepared              = false;
     _trans_weights_idx        = AuxTensorIdx::Count;
     _enable_fast_math         = fc_info.enable_fast_math;
     _fixed_format             = weights_info.weight_format() != WeightFormat::UNSPECIFIED;
     _weight_format            = weights_info.weight_format();
-    _dynamic_weights          = !weights->are_values_constant() && _needs_weights_reshape;
+    _dynamic_weights      = !weights->are_values_constant() && (_needs_weights_reshape || _needs_weights_unpack);
+    _sparse_weights       = fc_info.sparse_weights;
+    _block_sparse_weights = fc_info.block_sparse_weights;
 
     // With the Fully Connected layer we can have 4 different cases:
     //  1) Convolution layer -> Fully Connected layer without batches
@@ -262,6 +375,17 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
 
     const ITensorInfo *weights_to_use = weights;
 
+    // Unpack packed 4-bit weights before any other transformation
+    if (_needs_weights_unpack)
+    {
+        _unpack_weights = std::make_unique<kernels::CpuUnpackInt4Kernel>();
+        _unpack_weights->configure(weights, &_unpacked_weights);
+        _unpacked_weights.set_are_values_constant(weights->are_values_constant());
+
+        weights_to_use     = &_unpacked_weights;
+        _trans_weights_idx = AuxTensorIdx::UnpackedWeights;
+    }
+
     // Check if we have a fully connected layer with batches
     const bool is_batched_fc_layer = dst->dimension(1) > 1;
     if (is_batched_fc_layer)
@@ -275,12 +399,22 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
         _is_fc_after_conv = src->num_dimensions() > 1;
     }
 
+    // Leave the transpose of dynamic weights to the matrix multiplication
+    const bool needs_weights_conversion = _is_fc_after_conv && (src->data_layout() != fc_info.weights_trained_layout);
+    if (_needs_weights_reshape &&
+        transpose_weights_in_mm(src, weights_to_use, fc_info, weights_info, needs_weights_conversion))
+    {
+        _transpose_weights_in_mm = true;
+        _needs_weights_reshape   = false;
+        _dynamic_weights         = !weights->are_values_constant() && _needs_weights_unpack;
+    }
+
     // Reshape weights if needed
     if (_needs_weights_reshape)
     {
         // Reshape the weights
         _transpose_weights = std::make_unique<kernels::CpuTransposeKernel>();
-        _transpose_weights->configure(weights, &_reshaped_weights);
+        _transpose_weights->configure(weights_to_use, &_reshaped_weights);
         _reshaped_weights.set_are_values_constant(weights->are_values_constant());
 
         weights_to_use     = &_reshaped_weights;
@@ -288,7 +422,7 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
     }
 
     // Convert weights if needed
-    if (_is_fc_after_conv && (src->data_layout() != fc_info.weights_trained_layout))
+    if (needs_weights_conversion)
     {
         // Convert weights
         _convert_weights = std::make_unique<CpuConvertFullyConnectedWeights>();
@@ -313,21 +447,25 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
     }
 
     // Retain the tensorinfo with the weights to use
-    if (_needs_weights_reshape || _needs_weights_conversion)
+    if (_needs_weights_unpack || _needs_weights_reshape || _needs_weights_conversion)
     {
         _trans_weights = *weights_to_use;
     }
 
     // Set auxiliary memory requirements
-    auto gemm_mem_req = (_is_quantized_asymmetric) ? _mm_gemmlowp->workspace() : _mm_gemm->workspace();
+    auto gemm_mem_req = (_is_quantized_asymmetric || _is_dynamically_quantized) ? _mm_gemmlowp->workspace()
+                        : _mm_sparse_gemv != nullptr                         ? _mm_sparse_gemv->workspace()
+                                                                             : _mm_gemm->workspace();
     for (unsigned int i = 0; i < gemm_mem_req.size(); ++i)
     {
         _aux_mem[i] = gemm_mem_req[i];
     }
 
-    if (_aux_mem[Pretranspose].size > 0)
+    if (_aux_mem[Pretranspose].size > 0 || (_mm_gemm != nullptr && _mm_gemm->isSparseWeightsKernel()) ||
+        _mm_sparse_gemv != nullptr)
     {
-        // Release permuted weights at the end of prepare as they are further transposed by the assembly dispatch
+        // Release permuted weights at the end of prepare as they are further transposed by the assembly dispatch, or
+        // compressed by the sparse GEMM or GEMV
         // Do not release them if biases are dynamic and data type is quantized, since the weights tensor will be used for biases offset calculation
         // Keep all the auxiliary tensors in case of dynamic weights as they are recalculated every time.
         _aux_mem[TransposedWeights] = MemoryInfo(
@@ -355,6 +493,19 @@ void CpuFullyConnected::configure(const ITensorInfo      *src,
     }
     _aux_mem[FlattenedSrc] =
         MemoryInfo(offset_int_vec(FlattenedSrc), MemoryLifetime::Temporary, _flattened_src.total_size());
+    _aux_mem[SrcAbsMax] =
+        MemoryInfo(offset_int_vec(SrcAbsMax), MemoryLifetime::Temporary, _src_abs_max_info.total_size());
+    _aux_mem[QuantizedSrc] =
+        MemoryInfo(offset_int_vec(QuantizedSrc), MemoryLifetime::Temporary, _quantized_src.total_size());
+
+    // Unpacked weights that are further transformed are only needed during prepare, otherwise they are the weights of
+    // the matrix multiplication and live as long as the transposed weights would
+    const bool unpacked_weights_transformed = _needs_weights_reshape || _needs_weights_conversion;
+    _aux_mem[UnpackedWeights] =
+        MemoryInfo(offset_int_vec(UnpackedWeights),
+                   unpacked_weights_transformed && !_dynamic_weights ? MemoryLifetime::Prepare
+                                                                     : _aux_mem[TransposedWeights].lifetime,
+                   _unpacked_weights.total_size());
 }
 
 Status CpuFullyConnected::has_opt_impl(arm_compute::WeightFormat &expected_weight_format,
@@ -384,6 +535,18 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
     ARM_COMPUTE_UNUSED(fc_info.retain_internal_weights);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
 
+    // Packed 4-bit weights are unpacked and validated as such
+    TensorInfo unpacked_weights{};
+    if (weights->data_type() == DataType::U8)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8_SIGNED);
+        unpacked_weights = kernels::CpuUnpackInt4Kernel::unpacked_info(*weights);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(unpacked_weights.data_type() != DataType::QASYMM8_SIGNED,
+                                        "Packed 4-bit weights must be quantized per tensor");
+        ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuUnpackInt4Kernel::validate(weights, &unpacked_weights));
+        weights = &unpacked_weights;
+    }
+
     if (is_fixed_format(weights_info.weight_format()))
     {
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
@@ -401,6 +564,10 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(weights, DataType::BFLOAT16);
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(dst, DataType::F32);
     }
+    else if (is_dynamically_quantized(src, weights))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+    }
     else
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights, dst);
@@ -460,14 +627,17 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
         is_fc_after_conv = src->num_dimensions() > 1;
     }
 
-    if (!weights_reshaped)
+    const bool needs_weights_conversion = is_fc_after_conv && (src->data_layout() != fc_info.weights_trained_layout);
+    const bool transpose_weights =
+        !weights_reshaped && transpose_weights_in_mm(src, weights, fc_info, weights_info, needs_weights_conversion);
+    if (!weights_reshaped && !transpose_weights)
     {
         // Validate reshape weights kernel
         ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuTransposeKernel::validate(weights, &reshaped_weights));
         weights_to_use = &reshaped_weights;
     }
 
-    if (is_fc_after_conv && (src->data_layout() != fc_info.weights_trained_layout))
+    if (needs_weights_conversion)
     {
         // Validate convert weights kernel
         ARM_COMPUTE_RETURN_ON_ERROR(CpuConvertFullyConnectedWeights::validate(
@@ -478,8 +648,8 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
     if (is_fc_after_conv)
     {
         // Fully Connected layer after a Convolution Layer without batches
-        ARM_COMPUTE_RETURN_ERROR_ON(
-            (weights_to_use->dimension(1) != (src->dimension(0) * src->dimension(1) * src->dimension(2))));
+        ARM_COMPUTE_RETURN_ERROR_ON((weights_to_use->dimension(transpose_weights ? 0 : 1) !=
+                                     (src->dimension(0) * src->dimension(1) * src->dimension(2))));
 
         // Validate flatten kernel
         ARM_COMPUTE_RETURN_ON_ERROR(CpuFlatten::validate(src, &flatten_src));
@@ -488,11 +658,12 @@ Status CpuFullyConnected::validate(const ITensorInfo      *src,
     else
     {
         // Fully Connected layer after a Fully Connected Layer without batches
-        ARM_COMPUTE_RETURN_ERROR_ON(src->dimension(0) != weights_to_use->dimension(1));
+        ARM_COMPUTE_RETURN_ERROR_ON(src->dimension(0) != weights_to_use->dimension(transpose_weights ? 0 : 1));
     }
     // Validate matrix multiply kernel
     ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(src_to_use, weights_to_use, biases, dst, fc_info.activation_info,
-                                            fc_info.enable_fast_math, weights_info.weight_format()));
+                                            fc_info.enable_fast_math, weights_info.weight_format(),
+                                            fc_info.sparse_weights, fc_info.block_sparse_weights, transpose_weights));
 
     return Status{};
 }
@@ -510,6 +681,8 @@ void CpuFullyConnected::run(ITensorPack &tensors)
 
     CpuAuxTensorHandler flattened_src(offset_int_vec(FlattenedSrc), _flattened_src, tensors, false);
     CpuAuxTensorHandler transformed_wei(offset_int_vec(_trans_weights_idx), _trans_weights, tensors, false);
+    CpuAuxTensorHandler src_abs_max(offset_int_vec(SrcAbsMax), _src_abs_max_info, tensors, false);
+    CpuAuxTensorHandler quantized_src(offset_int_vec(QuantizedSrc), _quantized_src, tensors, false);
 
     // Linearize src if it comes from a convolutional layer
     if (_is_fc_after_conv)
@@ -518,18 +691,43 @@ void CpuFullyConnected::run(ITensorPack &tensors)
         _flatten->run(flatten_pack);
     }
 
+    const ITensor *src_to_use = (_is_fc_after_conv) ? flattened_src.get() : src;
+
+    // Quantize src with a symmetric scale mapping its largest absolute value to the int8 range
+    if (_is_dynamically_quantized)
+    {
+        ITensorPack abs_max_pack{{ACL_SRC, src_to_use}, {ACL_DST, src_abs_max.get()}};
+        NEScheduler::get().schedule_op(_src_abs_max.get(), Window::DimX, _src_abs_max->window(), abs_max_pack);
+
+        const size_t num_rows    = _src_abs_max_info.tensor_shape().total_size();
+        const auto  *row_abs_max = reinterpret_cast<const float *>(src_abs_max.get()->buffer() +
+                                                                  _src_abs_max_info.offset_first_element_in_bytes());
+        const float  abs_max     = *std::max_element(row_abs_max, row_abs_max + num_rows);
+        const float  scale       = abs_max > 0.f ? abs_max / 127.f : 1.f;
+        quantized_src.get()->info()->set_quantization_info(QuantizationInfo(scale, 0, true));
+
+        ITensorPack quantize_pack{{ACL_SRC, src_to_use}, {ACL_DST, quantized_src.get()}};
+        NEScheduler::get().schedule_op(_quantize_src.get(), _quantize_src->get_split_dimension_hint(),
+                                       _quantize_src->window(), quantize_pack);
+        src_to_use = quantized_src.get();
+    }
+
     ITensorPack gemm_pack = tensors;
-    gemm_pack.add_const_tensor(ACL_SRC_0, (_is_fc_after_conv) ? flattened_src.get() : src);
-    if (_needs_weights_reshape || _needs_weights_conversion)
+    gemm_pack.add_const_tensor(ACL_SRC_0, src_to_use);
+    if (_needs_weights_unpack || _needs_weights_reshape || _needs_weights_conversion)
     {
         gemm_pack.add_const_tensor(ACL_SRC_1, transformed_wei.get());
     }
 
     // Run matrix multiply
-    if (_is_quantized_asymmetric)
+    if (_is_quantized_asymmetric || _is_dynamically_quantized)
     {
         _mm_gemmlowp->run(gemm_pack);
     }
+    else if (_mm_sparse_gemv != nullptr)
+    {
+        _mm_sparse_gemv->run(gemm_pack);
+    }
     else
     {
         _mm_gemm->run(gemm_pack);
@@ -549,15 +747,27 @@ void CpuFullyConnected::prepare(ITensorPack &tensors)
 
         CpuAuxTensorHandler reshaped_weights(offset_int_vec(TransposedWeights), _reshaped_weights, tensors, false);
         CpuAuxTensorHandler converted_weights(offset_int_vec(ConvertedWeights), _converted_weights, tensors, false);
+        CpuAuxTensorHandler unpacked_weights(offset_int_vec(UnpackedWeights), _unpacked_weights, tensors, false);
 
         // Pointer to current weights
         const ITensor *cur_weights = weights;
 
+        // Unpack packed 4-bit weights (happens only once)
+        if (_needs_weights_unpack)
+        {
+            ITensorPack unpack_pack{{ACL_SRC, cur_weights}, {ACL_DST, unpacked_weights.get()}};
+            NEScheduler::get().schedule_op(_unpack_weights.get(), Window::DimY, _unpack_weights->window(),
+                                           unpack_pack);
+
+            cur_weights->mark_as_unused();
+            cur_weights = unpacked_weights.get();
+        }
+
         // Reshape of the weights (happens only once)
         if (_needs_weights_reshape)
         {
             // Run reshape weights kernel and mark weights as unused
-            ITensorPack transpose_pack{{ACL_SRC, weights}, {ACL_DST, reshaped_weights.get()}};
+            ITensorPack transpose_pack{{ACL_SRC, cur_weights}, {ACL_DST, reshaped_weights.get()}};
             NEScheduler::get().schedule_op(_transpose_weights.get(), Window::DimY, _transpose_weights->window(),
                                            transpose_pack);
 
@@ -579,7 +789,11 @@ void CpuFullyConnected::prepare(ITensorPack &tensors)
         gemm_pack.add_const_tensor(ACL_SRC_1, cur_weights);
 
         // Prepare GEMM prepare and release unused weights
-        if (!_is_quantized_asymmetric)
+        if (_mm_sparse_gemv != nullptr)
+        {
+            _mm_sparse_gemv->prepare(gemm_pack);
+        }
+        else if (!(_is_quantized_asymmetric || _is_dynamically_quantized))
         {
             _mm_gemm->prepare(gemm_pack);
         }
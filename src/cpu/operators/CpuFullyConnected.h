@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,14 +40,21 @@ class CpuConvertFullyConnectedWeights;
 class CpuFlatten;
 class CpuGemm;
 class CpuGemmLowpMatrixMultiplyCore;
+class CpuGemvBlockSparse;
 namespace kernels
 {
+class CpuQuantizeKernel;
+class CpuRowAbsMaxKernel;
 class CpuTransposeKernel;
+class CpuUnpackInt4Kernel;
 } // namespace kernels
 /** Basic function to compute a Fully Connected layer. This function calls the following kernels:
  *  -# @ref kernels::CpuIm2ColKernel (called when the input comes from a convolutional layer)
+ *  -# @ref kernels::CpuUnpackInt4Kernel (if the weights are packed 4-bit values) (called once)
  *  -# @ref kernels::CpuTransposeKernel (if @p are_weights_reshaped is set to false and transpose_weights is set to true ) (called once)
- *  -# @ref CpuGemm or @ref CpuGemmLowpMatrixMultiplyCore (if quantized asymmetric)
+ *  -# @ref kernels::CpuRowAbsMaxKernel and @ref kernels::CpuQuantizeKernel (if dynamically quantized)
+ *  -# @ref CpuGemm or @ref CpuGemmLowpMatrixMultiplyCore (if quantized asymmetric or dynamically quantized)
+ *  -# @ref CpuGemvBlockSparse instead of @ref CpuGemm (if block_sparse_weights is set, the weights are constant and the batch is 1)
  *  -# @ref kernels::CpuGemmMatrixAdditionKernel or @ref CpuGemmLowpOutputStage (if quantized asymmetric) (if @p biases is not equal to nullptr)
  *
  * @note  The fully connected layer accepts "weights" tensors only with 2 dimensions.
@@ -72,13 +79,23 @@ public:
      * |F32            |F32                |F32    |F32            |
      * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
+     * |QASYMM8_SIGNED |U8                 |S32    |QASYMM8_SIGNED |
+     * |F32            |QASYMM8_SIGNED     |F32    |F32            |
+     *
+     * U8 weights hold two 4-bit two's complement values per byte along their first dimension, the even index in the
+     * low nibble, quantized with the per-tensor quantization info of @p weights. They are unpacked to QASYMM8_SIGNED
+     * before being reshaped, once if they are constant.
+     *
+     * When @p src is F32 and @p weights are QASYMM8_SIGNED the layer is dynamically quantized: at every run the src is
+     * quantized symmetrically with a scale computed from its largest absolute value, the int8 product is computed by
+     * @ref CpuGemmLowpMatrixMultiplyCore and dequantized to F32 while it is written to @p dst.
      *
      * @param[in]  src          Source tensor info. Data type supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
      * @param[in]  weights      Weights tensor info. The weights must be 2 dimensional.
      *                          If this function is called after a Convolution Layer, the (transposed) weights will have as many rows as the product of the first 3 input's dimensions.
      *                          If it is called after another FullyConnected Layer, the (transposed) weights will have as many rows as the input's first dimension.
-     *                          Data type supported: Same as @p src.
-     * @param[in]  biases       Bias tensor info. Can be nullptr. Data type supported: Same as @p weights, S32 if @p weights is QASYMM8/QASYMM8_SIGNED.
+     *                          Data type supported: Same as @p src, QASYMM8_SIGNED if @p src is F32, U8 (packed 4-bit) if @p src is QASYMM8_SIGNED.
+     * @param[in]  biases       Bias tensor info. Can be nullptr. Data type supported: Same as @p src, S32 if @p src is QASYMM8/QASYMM8_SIGNED.
      * @param[out] dst          Destination tensor info. Its shape should be equal to the output of a matrix multiplication between:
      *                          - The output of im2col on the input and the (transposed) 2D weights, if the function is called after a Convolution Layer
      *                          - The input tensor and the (transposed) 2D weights, if the function is called after another FullyConnected Layer.
@@ -153,10 +170,14 @@ private:
         GemmTemp6,
         GemmTemp7,
         GemmTemp8,
-        // Slots above (0-9) reserved for either CpuGemm or CpuGemmLowpMatrixMultiplyCore
+        GemmTemp9,
+        // Slots above (0-10) reserved for either CpuGemm or CpuGemmLowpMatrixMultiplyCore
         TransposedWeights,
         ConvertedWeights,
         FlattenedSrc,
+        SrcAbsMax,
+        QuantizedSrc,
+        UnpackedWeights,
         Count
     };
 
@@ -165,24 +186,36 @@ private:
     std::unique_ptr<kernels::CpuTransposeKernel>     _transpose_weights;
     std::unique_ptr<CpuGemm>                         _mm_gemm;
     std::unique_ptr<CpuGemmLowpMatrixMultiplyCore>   _mm_gemmlowp;
+    std::unique_ptr<CpuGemvBlockSparse>              _mm_sparse_gemv;
+    std::unique_ptr<kernels::CpuRowAbsMaxKernel>     _src_abs_max;
+    std::unique_ptr<kernels::CpuQuantizeKernel>      _quantize_src;
+    std::unique_ptr<kernels::CpuUnpackInt4Kernel>    _unpack_weights;
 
     TensorInfo   _flattened_src;
     TensorInfo   _converted_weights;
     TensorInfo   _reshaped_weights;
     TensorInfo   _trans_weights;
+    TensorInfo   _src_abs_max_info;
+    TensorInfo   _quantized_src;
+    TensorInfo   _unpacked_weights;
     AuxTensorIdx _trans_weights_idx;
 
     experimental::MemoryRequirements _aux_mem;
 
+    bool                      _needs_weights_unpack;
     bool                      _needs_weights_conversion;
     bool                      _needs_weights_reshape;
+    bool                      _transpose_weights_in_mm;
     bool                      _is_fc_after_conv;
     bool                      _is_quantized_asymmetric;
+    bool                      _is_dynamically_quantized;
     bool                      _is_prepared;
     bool                      _enable_fast_math;
     bool                      _fixed_format;
     arm_compute::WeightFormat _weight_format;
     bool                      _dynamic_weights;
+    bool                      _sparse_weights;
+    bool                      _block_sparse_weights;
 
 #ifdef ARM_COMPUTE_ASSERTS_ENABLED
     int _asrt_run_count{};
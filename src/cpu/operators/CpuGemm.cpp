@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,10 +21,14 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/operators/CpuGemm.h"
 
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
@@ -59,6 +63,47 @@ cpu::AsmGemmInfo init_assembly_metadata(const GEMMInfo &info)
 
     return asm_info;
 }
+
+/** Output shape of the sparse path, B is given as [N, K] or as [K, N] when it has to be pretransposed */
+TensorShape compute_sparse_dst_shape(const ITensorInfo *a, const ITensorInfo *b, const GEMMInfo &info)
+{
+    const int        n = info.pretranspose_B() ? b->dimension(1) : b->dimension(0);
+    const TensorInfo b_nk =
+        b->clone()->set_tensor_shape(info.pretranspose_B() ? compute_transposed_shape(*b) : b->tensor_shape());
+    return compute_mm_shape(*a, b_nk, false,
+                            GEMMReshapeInfo(a->dimension(1), n, a->dimension(0), 1, 1, info.depth_output_gemm3d(),
+                                            info.reinterpret_input_as_3d()));
+}
+
+/** Check if the 2:4 structured-sparse path can run. When it cannot, the sparse_weights hint is ignored and one of the
+ *  dense paths runs instead
+ */
+Status validate_sparse(const ITensorInfo *a,
+                       const ITensorInfo *b,
+                       const ITensorInfo *c,
+                       const ITensorInfo *d,
+                       float              beta,
+                       const GEMMInfo    &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(!info.sparse_weights());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!b->are_values_constant(), "B is compressed at prepare() so it must be constant");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.accumulate() || info.fixed_format() || b->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(c != nullptr && beta != 0.f && (beta != 1.f || c->num_dimensions() > 1),
+                                    "Only a bias vector can be added to the sparse product");
+
+    const TensorInfo values =
+        b->clone()->set_tensor_shape(compute_sparse_rhs_values_shape(*b, info.pretranspose_B()));
+    const TensorInfo metadata = b->clone()
+                                    ->set_tensor_shape(compute_sparse_rhs_metadata_shape(*b, info.pretranspose_B()))
+                                    .set_data_type(DataType::U8);
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        cpu::kernels::CpuGemmSparseRhsCompressKernel::validate(b, &values, &metadata, info.pretranspose_B()));
+
+    TensorInfo dst = *d->clone();
+    auto_init_if_empty(dst, a->clone()->set_tensor_shape(compute_sparse_dst_shape(a, b, info)));
+    return cpu::kernels::CpuGemmSparseMatrixMultiplyKernel::validate(a, &values, &metadata,
+                                                                     beta == 1.f ? c : nullptr, &dst, 1.f);
+}
 } // namespace
 
 void CpuGemm::configure(const ITensorInfo *a,
@@ -70,19 +115,22 @@ void CpuGemm::configure(const ITensorInfo *a,
                         const GEMMInfo    &gemm_info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, d);
-    ARM_COMPUTE_ERROR_THROW_ON(CpuGemm::validate(a, b, c, d, alpha, beta, gemm_info));
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(CpuGemm::validate(a, b, c, d, alpha, beta, gemm_info));
+    const TrustedConfigureScope trusted_configure{};
     ARM_COMPUTE_LOG_PARAMS(a, b, c, d, alpha, beta, gemm_info);
 
-    const cpu::AsmGemmInfo asm_info  = init_assembly_metadata(gemm_info);
-    const bool             is_c_bias = beta == 1 && c != nullptr;
+    const cpu::AsmGemmInfo asm_info   = init_assembly_metadata(gemm_info);
+    const bool             is_c_bias  = beta == 1 && c != nullptr;
+    const bool             run_sparse = bool(validate_sparse(a, b, c, d, beta, gemm_info));
     const bool             run_optimised =
-        bool(cpu::CpuGemmAssemblyDispatch::validate(a, b, (is_c_bias) ? c : nullptr, d, asm_info)) &&
+        !run_sparse && bool(cpu::CpuGemmAssemblyDispatch::validate(a, b, (is_c_bias) ? c : nullptr, d, asm_info)) &&
         (c == nullptr || beta == 0.f || beta == 1.f) && // Optimized GeMM doesn't support beta coefficient.
         !(!b->are_values_constant() &&
           b->tensor_shape().z() > 1); // Disable batch matmul as optimized GeMM handles batching differently.
 
     // Check if we need to reshape the matrix B only on the first run
     _is_prepared                      = false;
+    _run_sparse                       = run_sparse;
     _reshape_b_only_on_first_run      = b->are_values_constant();
     _run_vector_matrix_multiplication = a->dimension(1) < 2;
     _run_alpha_scale                  = alpha != 1.f;
@@ -93,7 +141,22 @@ void CpuGemm::configure(const ITensorInfo *a,
         (!run_optimised ||
          (run_optimised && !cpu::CpuGemmAssemblyDispatch::is_activation_supported(gemm_info.activation_info())));
 
-    if (run_optimised)
+    if (_run_sparse)
+    {
+        // B is compressed once at prepare(), alpha and the bias are applied by the sparse matrix multiply kernel
+        _run_interleave_transpose = false;
+        _sparse_compress_kernel   = std::make_unique<cpu::kernels::CpuGemmSparseRhsCompressKernel>();
+        _sparse_compress_kernel->configure(b, &_sparse_values, &_sparse_metadata, gemm_info.pretranspose_B());
+        _aux_mem[SparseValues] =
+            MemoryInfo(offset_int_vec(SparseValues), MemoryLifetime::Persistent, _sparse_values.total_size());
+        _aux_mem[SparseMetadata] =
+            MemoryInfo(offset_int_vec(SparseMetadata), MemoryLifetime::Persistent, _sparse_metadata.total_size());
+
+        auto_init_if_empty(*d, a->clone()->set_tensor_shape(compute_sparse_dst_shape(a, b, gemm_info)));
+        _sparse_mm_kernel = std::make_unique<cpu::kernels::CpuGemmSparseMatrixMultiplyKernel>();
+        _sparse_mm_kernel->configure(a, &_sparse_values, &_sparse_metadata, is_c_bias ? c : nullptr, d, alpha);
+    }
+    else if (run_optimised)
     {
         _run_interleave_transpose   = false;
         const ITensorInfo *c_to_use = is_c_bias ? c : nullptr;
@@ -328,13 +391,14 @@ Status CpuGemm::validate(const ITensorInfo *a,
 
     // Note we use b instead of b_to_use here because asm_info also captures the pretranspose_b() flag
     // so we pass the original b to CpuGemmAssemblyDispatch
+    const bool run_sparse = bool(validate_sparse(a, b, c, d, beta, gemm_info));
     const bool run_optimised =
-        bool(cpu::CpuGemmAssemblyDispatch::validate(a, b, is_c_bias ? c : nullptr, d, asm_info)) &&
+        !run_sparse && bool(cpu::CpuGemmAssemblyDispatch::validate(a, b, is_c_bias ? c : nullptr, d, asm_info)) &&
         (c == nullptr || beta == 0.f || beta == 1.f) && // Optimized GeMM doesn't support beta coefficient.
         !(!b->are_values_constant() &&
           b->tensor_shape().z() > 1); // Disable batch matmul as optimized GeMM handles batching differently.
 
-    if (!run_optimised)
+    if (!run_sparse && !run_optimised)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.reinterpret_input_as_3d(),
                                         "CpuGemm cannot reinterpret the input tensor as 3D");
@@ -420,7 +484,21 @@ void CpuGemm::run(ITensorPack &tensors)
     auto c = tensors.get_const_tensor(ACL_SRC_2);
     auto d = tensors.get_tensor(ACL_DST);
 
-    if (_asm_glue && _asm_glue->is_configured())
+    if (_run_sparse)
+    {
+        CpuAuxTensorHandler values(offset_int_vec(SparseValues), _sparse_values, tensors);
+        CpuAuxTensorHandler metadata(offset_int_vec(SparseMetadata), _sparse_metadata, tensors);
+
+        ITensorPack mm_pack{{ACL_SRC_0, a},
+                            {ACL_SRC_1, values.get()},
+                            {ACL_SRC_2, metadata.get()},
+                            {ACL_SRC_3, _run_bias_addition ? c : nullptr},
+                            {ACL_DST, d}};
+        // A single row is split across its columns, e.g. for a fully connected layer running with batch 1
+        const size_t split_dim = a->info()->dimension(1) < 2 ? Window::DimX : Window::DimY;
+        NEScheduler::get().schedule_op(_sparse_mm_kernel.get(), split_dim, _sparse_mm_kernel->window(), mm_pack);
+    }
+    else if (_asm_glue && _asm_glue->is_configured())
     {
         // Pass c to asm dispatch only if it's the bias tensor
         ITensorPack asm_pack = tensors;
@@ -507,7 +585,17 @@ void CpuGemm::prepare(ITensorPack &tensors)
 {
     if (!_is_prepared)
     {
-        if (_asm_glue && _asm_glue->is_configured())
+        if (_run_sparse)
+        {
+            const ITensor      *b = tensors.get_const_tensor(ACL_SRC_1);
+            CpuAuxTensorHandler values(offset_int_vec(SparseValues), _sparse_values, tensors);
+            CpuAuxTensorHandler metadata(offset_int_vec(SparseMetadata), _sparse_metadata, tensors);
+
+            ITensorPack compress_pack{{ACL_SRC, b}, {ACL_DST_0, values.get()}, {ACL_DST_1, metadata.get()}};
+            NEScheduler::get().schedule_op(_sparse_compress_kernel.get(), Window::DimY,
+                                           _sparse_compress_kernel->window(), compress_pack);
+        }
+        else if (_asm_glue && _asm_glue->is_configured())
         {
             _asm_glue->prepare(tensors);
         }
@@ -547,6 +635,66 @@ experimental::MemoryRequirements CpuGemm::workspace() const
     return _aux_mem;
 }
 
+OperatorDescription CpuGemm::describe() const
+{
+    OperatorDescription desc{};
+    desc.name = "CpuGemm";
+    if (_run_sparse)
+    {
+        desc.method = "Sparse2:4";
+        desc.kernels.emplace_back(_sparse_compress_kernel->name());
+        desc.kernels.emplace_back(_sparse_mm_kernel->name());
+        desc.workspace_bytes = _aux_mem[SparseValues].size + _aux_mem[SparseMetadata].size;
+    }
+    else if (_asm_glue && _asm_glue->is_configured())
+    {
+        desc.method = "Assembly";
+        desc.children.emplace_back(_asm_glue->describe());
+    }
+    else
+    {
+        desc.method = _run_vector_matrix_multiplication ? "VectorMatrix" : "InterleaveTranspose";
+        if (_pretranspose_b_func != nullptr)
+        {
+            desc.children.emplace_back(_pretranspose_b_func->describe());
+        }
+        if (_interleave_kernel != nullptr)
+        {
+            desc.kernels.emplace_back(_interleave_kernel->name());
+        }
+        if (_transpose1xW_b_kernel != nullptr)
+        {
+            desc.kernels.emplace_back(_transpose1xW_b_kernel->name());
+        }
+        if (_mm_kernel != nullptr)
+        {
+            desc.kernels.emplace_back(_mm_kernel->name());
+        }
+        // The slots below InterleavedLHS are reserved for the assembly dispatch, it reports them itself
+        for (unsigned int slot = InterleavedLHS; slot < Count; ++slot)
+        {
+            desc.workspace_bytes += _aux_mem[slot].size;
+        }
+    }
+    if (_run_addition && _ma_kernel != nullptr)
+    {
+        desc.kernels.emplace_back(_ma_kernel->name());
+    }
+    if (_run_bias_addition && _add_bias != nullptr)
+    {
+        desc.children.emplace_back(_add_bias->describe());
+    }
+    if (_run_alpha_scale && _alpha_scale_func != nullptr)
+    {
+        desc.children.emplace_back(_alpha_scale_func->describe());
+    }
+    if (_run_activation && _activation_func != nullptr)
+    {
+        desc.children.emplace_back(_activation_func->describe());
+    }
+    return desc;
+}
+
 Status CpuGemm::has_opt_impl(arm_compute::WeightFormat &expected_weight_format,
                              const ITensorInfo         *a,
                              const ITensorInfo         *b,
@@ -563,5 +711,63 @@ bool CpuGemm::isVarWeightsKernel() const
 {
     return _asm_glue && _asm_glue->isVarWeightsKernel();
 }
+
+bool CpuGemm::isSparseWeightsKernel() const
+{
+    return _run_sparse;
+}
+
+Status CpuGemm::export_pretransposed_weights(ITensorPack &tensors, std::vector<uint8_t> &blob) const
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!_asm_glue || !_asm_glue->is_configured(),
+                                    "Only assembly kernels pretranspose the weights");
+    return _asm_glue->export_pretransposed_weights(tensors, blob);
+}
+
+Status CpuGemm::import_pretransposed_weights(const std::vector<uint8_t> &blob)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!_asm_glue || !_asm_glue->is_configured(),
+                                    "Only assembly kernels pretranspose the weights");
+    ARM_COMPUTE_RETURN_ON_ERROR(_asm_glue->import_pretransposed_weights(blob));
+
+    const auto asm_mem_req = _asm_glue->workspace();
+    for (unsigned int slot = 0; slot < asm_mem_req.size(); ++slot)
+    {
+        _aux_mem[slot] = asm_mem_req[slot];
+    }
+    return Status{};
+}
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_gemm(const AclTensorDescriptor &a,
+                                                            const AclTensorDescriptor &b,
+                                                            const AclTensorDescriptor *c,
+                                                            const AclTensorDescriptor &d,
+                                                            const AclGemmDescriptor   &gemm,
+                                                            bool                       is_validate)
+{
+    TensorInfo a_info = detail::convert_to_legacy_tensor_info(a);
+    TensorInfo b_info = detail::convert_to_legacy_tensor_info(b);
+    TensorInfo c_info = (c != nullptr) ? detail::convert_to_legacy_tensor_info(*c) : TensorInfo();
+    TensorInfo d_info = detail::convert_to_legacy_tensor_info(d);
+    a_info.set_is_resizable(false);
+    b_info.set_is_resizable(false);
+    c_info.set_is_resizable(false);
+    d_info.set_is_resizable(false);
+    const ITensorInfo *c_to_use = (c != nullptr) ? &c_info : nullptr;
+
+    if (!bool(CpuGemm::validate(&a_info, &b_info, c_to_use, &d_info, gemm.alpha, gemm.beta)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto gemm_op = std::make_unique<cpu::CpuGemm>();
+    gemm_op->configure(&a_info, &b_info, c_to_use, &d_info, gemm.alpha, gemm.beta);
+
+    return detail::make_operator(static_cast<IContext *>(this), std::move(gemm_op));
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,13 +33,17 @@
 #include "src/cpu/kernels/CpuGemmInterleave4x4Kernel.h"
 #include "src/cpu/kernels/CpuGemmMatrixAdditionKernel.h"
 #include "src/cpu/kernels/CpuGemmMatrixMultiplyKernel.h"
+#include "src/cpu/kernels/CpuGemmSparseMatrixMultiplyKernel.h"
+#include "src/cpu/kernels/CpuGemmSparseRhsCompressKernel.h"
 #include "src/cpu/kernels/CpuGemmTranspose1xWKernel.h"
 #include "src/cpu/operators/CpuActivation.h"
 #include "src/cpu/operators/CpuAdd.h"
 #include "src/cpu/operators/CpuTranspose.h"
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -47,7 +51,10 @@ namespace cpu
 {
 /** Basic function to execute GEMM. This function calls the following kernels:
  *
- * If optimized assembly is available:
+ * If B is constant and 2:4 structured-sparse (see GEMMInfo::sparse_weights()):
+ *  -# @ref cpu::kernels::CpuGemmSparseRhsCompressKernel (only once, at prepare)
+ *  -# @ref cpu::kernels::CpuGemmSparseMatrixMultiplyKernel
+ * Else if optimized assembly is available:
  *  -# @ref cpu::CpuGemmAssemblyDispatch
  *  -# @ref cpu::CpuActivation (if alpha != 1.0)
  * Else:
@@ -133,6 +140,7 @@ public:
     void                             run(ITensorPack &tensors) override;
     void                             prepare(ITensorPack &constants) override;
     experimental::MemoryRequirements workspace() const override;
+    OperatorDescription              describe() const override;
 
     /** Indicates if the convolution executes in variable weights mode.
      *
@@ -141,6 +149,30 @@ public:
      * utilizes the data as it is given by the user.
      */
     bool isVarWeightsKernel() const;
+    /** Indicates if the GEMM runs on the 2:4 structured-sparse weights compressed at prepare()
+     *
+     * In that case the weights tensor is not read again after prepare().
+     */
+    bool isSparseWeightsKernel() const;
+    /** Exports the pretransposed weights of the assembly kernel
+     *
+     * Similar to @ref CpuGemmAssemblyDispatch::export_pretransposed_weights
+     *
+     * @param[in]  tensors Tensor pack holding the workspace the operator was prepared with
+     * @param[out] blob    Exported pretransposed weights
+     *
+     * @return a status
+     */
+    Status export_pretransposed_weights(ITensorPack &tensors, std::vector<uint8_t> &blob) const;
+    /** Imports pretransposed weights into the assembly kernel, the workspace has to be queried again on success
+     *
+     * Similar to @ref CpuGemmAssemblyDispatch::import_pretransposed_weights
+     *
+     * @param[in] blob Pretransposed weights exported by @ref export_pretransposed_weights
+     *
+     * @return a status
+     */
+    Status import_pretransposed_weights(const std::vector<uint8_t> &blob);
 
 private:
     enum AuxTensorIdx
@@ -150,24 +182,32 @@ private:
         PreTransposedRHS,
         Transposed1xWRHS,
         TempResult,
-        Count
+        Count,
+        /* The sparse path doesn't reshape B, its compressed B reuses the slots of the reshaped B */
+        SparseValues   = Transposed1xWRHS,
+        SparseMetadata = PreTransposedRHS
     };
 
-    std::unique_ptr<kernels::CpuGemmInterleave4x4Kernel>  _interleave_kernel{nullptr};
-    std::unique_ptr<CpuTranspose>                         _pretranspose_b_func{nullptr};
-    std::unique_ptr<kernels::CpuGemmTranspose1xWKernel>   _transpose1xW_b_kernel{nullptr};
-    std::unique_ptr<kernels::CpuGemmMatrixMultiplyKernel> _mm_kernel{nullptr};
-    std::unique_ptr<CpuGemmAssemblyDispatch>              _asm_glue{nullptr};
-    std::unique_ptr<kernels::CpuGemmMatrixAdditionKernel> _ma_kernel{nullptr};
-    std::unique_ptr<CpuActivation>                        _alpha_scale_func{nullptr};
-    std::unique_ptr<CpuAdd>                               _add_bias{nullptr};
-    std::unique_ptr<CpuActivation>                        _activation_func{nullptr};
+    std::unique_ptr<kernels::CpuGemmInterleave4x4Kernel>        _interleave_kernel{nullptr};
+    std::unique_ptr<CpuTranspose>                               _pretranspose_b_func{nullptr};
+    std::unique_ptr<kernels::CpuGemmTranspose1xWKernel>         _transpose1xW_b_kernel{nullptr};
+    std::unique_ptr<kernels::CpuGemmMatrixMultiplyKernel>       _mm_kernel{nullptr};
+    std::unique_ptr<kernels::CpuGemmSparseRhsCompressKernel>    _sparse_compress_kernel{nullptr};
+    std::unique_ptr<kernels::CpuGemmSparseMatrixMultiplyKernel> _sparse_mm_kernel{nullptr};
+    std::unique_ptr<CpuGemmAssemblyDispatch>                    _asm_glue{nullptr};
+    std::unique_ptr<kernels::CpuGemmMatrixAdditionKernel>       _ma_kernel{nullptr};
+    std::unique_ptr<CpuActivation>                              _alpha_scale_func{nullptr};
+    std::unique_ptr<CpuAdd>                                     _add_bias{nullptr};
+    std::unique_ptr<CpuActivation>                              _activation_func{nullptr};
 
     TensorInfo _tmp_a{};
     TensorInfo _pretransposed_b{};
     TensorInfo _tmp_b{};
     TensorInfo _tmp_d{};
+    TensorInfo _sparse_values{};
+    TensorInfo _sparse_metadata{};
 
+    bool _run_sparse{false};
     bool _run_vector_matrix_multiplication{false};
     bool _run_interleave_transpose{
         true}; /**< If we run CpuGemmInterleave4x4Kernel on lhs and CpuGemmTranspose1xWKernel on rhs */
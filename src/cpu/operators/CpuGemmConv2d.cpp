@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
@@ -39,6 +40,7 @@
 #include "src/cpu/kernels/CpuIm2ColKernel.h"
 #include "src/cpu/kernels/CpuWeightsReshapeKernel.h"
 #include "src/cpu/operators/CpuGemm.h"
+#include "src/cpu/operators/CpuGemmDirectConv2d.h"
 #include "src/cpu/operators/CpuGemmLowpMatrixMultiplyCore.h"
 #include "src/cpu/operators/CpuGemmLowpOutputStage.h"
 #include "src/cpu/operators/CpuReshape.h"
@@ -208,6 +210,35 @@ CpuGemmConv2d::SkipInfo CpuGemmConv2d::skip_im_col_info(const ITensorInfo
     return {false, false};
 }
 
+bool CpuGemmConv2d::use_gemm_direct_conv2d(const ITensorInfo         *src,
+                                           const ITensorInfo         *weights,
+                                           const ITensorInfo         *biases,
+                                           const ITensorInfo         *dst,
+                                           const PadStrideInfo       &conv_info,
+                                           const WeightsInfo         &weights_info,
+                                           const Size2D              &dilation,
+                                           const ActivationLayerInfo &act_info,
+                                           bool                       enable_fast_math)
+{
+    // Fixed format and reshaped weights are consumed by the GEMM as they are. Dynamic quantization parameters are
+    // only updated on the GEMM path.
+    if (src->data_layout() != DataLayout::NHWC || weights_info.are_reshaped() ||
+        weights_info.weight_format() != arm_compute::WeightFormat::UNSPECIFIED ||
+        src->quantization_info().is_dynamic() || weights->quantization_info().is_dynamic() || dst->total_size() == 0)
+    {
+        return false;
+    }
+
+    // The input is already read in place when im2col is skipped
+    if (skip_im_col_info(src, weights, conv_info, dilation, act_info).skip_im2col)
+    {
+        return false;
+    }
+
+    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, 1);
+    return bool(CpuGemmDirectConv2d::validate(src, weights, biases, dst, info));
+}
+
 CpuGemmConv2d::CpuGemmConv2d()
     : _weights_reshape(nullptr),
       _weights_reshape_and_transpose_kernel(nullptr),
@@ -216,6 +247,7 @@ CpuGemmConv2d::CpuGemmConv2d()
       _mm_gemmlowp(),
       _col2im_kernel(),
       _reshape(),
+      _gemm_direct_conv2d(),
       _im2col_output(),
       _weights_reshaped(),
       _gemm_output(),
@@ -241,11 +273,13 @@ void CpuGemmConv2d::configure_mm(const ITensorInfo         *src,
                                  bool                       enable_fast_math,
                                  int                        gemm_3d_depth,
                                  bool                       fixed_format,
-                                 arm_compute::WeightFormat  weight_format)
+                                 arm_compute::WeightFormat  weight_format,
+                                 bool                       sparse_weights)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights);
-    ARM_COMPUTE_ERROR_THROW_ON(validate_mm(src, weights, biases, dst, act_info, enable_fast_math, gemm_3d_depth,
-                                           _skip_im2col, fixed_format, weight_format));
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(validate_mm(src, weights, biases, dst, act_info, enable_fast_math,
+                                                     gemm_3d_depth, _skip_im2col, fixed_format, weight_format,
+                                                     sparse_weights));
 
     // Supported activations in GEMM
     const std::set<ActivationLayerInfo::ActivationFunction> supported_acts = {
@@ -311,12 +345,13 @@ void CpuGemmConv2d::configure_mm(const ITensorInfo         *src,
     else
     {
         // Create GEMMInfo structure
-        const GEMMInfo gemm_info =
+        GEMMInfo gemm_info =
             GEMMInfo(false, false, true /* Reshape weights only for the first run */, gemm_3d_depth,
                      _skip_im2col /* Reinterpret the input as 3D if im2col is skipped */, false,
                      GEMMLowpOutputStageInfo(), false, enable_fast_math, false, act_info, fixed_format, weight_format,
                      true /*pretranspose_B. For fp gemm (wt path 1 - 3), We always pretranspose B (for wt path 1 this
                      flag is ignored)*/);
+        gemm_info.set_sparse_weights(sparse_weights);
         // Configure matrix multiply function
         _mm_gemm = std::make_unique<CpuGemm>();
         _mm_gemm->configure(src, weights, biases, dst, 1.0f, 1.0f, gemm_info);
@@ -337,7 +372,8 @@ Status CpuGemmConv2d::validate_mm(const ITensorInfo         *src,
                                   int                        gemm_3d_depth,
                                   bool                       skip_im2col,
                                   bool                       fixed_format,
-                                  arm_compute::WeightFormat  weight_format)
+                                  arm_compute::WeightFormat  weight_format,
+                                  bool                       sparse_weights)
 {
     const DataType data_type             = src->data_type();
     const bool     is_quantized          = is_data_type_quantized_asymmetric(data_type);
@@ -389,12 +425,13 @@ Status CpuGemmConv2d::validate_mm(const ITensorInfo         *src,
     else
     {
         // Create GEMMInfo structure
-        const GEMMInfo gemm_info =
+        GEMMInfo gemm_info =
             GEMMInfo(false, false, true /* Reshape weights only for the first run */, gemm_3d_depth,
                      skip_im2col /* Reinterpret the input as 3D if im2col is skipped */, false,
                      GEMMLowpOutputStageInfo(), false, enable_fast_math, false, act_info, fixed_format, weight_format,
                      true /*pretranspose_B. For fp gemm (wt path 1 - 3), We always pretranspose B (for wt path 1 this
                      flag is ignored)*/);
+        gemm_info.set_sparse_weights(sparse_weights);
 
         // Perform validation step on Matrix multiply function
         return CpuGemm::validate(src, weights, biases, dst, 1.0f, 1.0f, gemm_info);
@@ -434,12 +471,24 @@ void CpuGemmConv2d::configure(const ITensorInfo         *src,
                               unsigned int               num_groups)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
-    ARM_COMPUTE_UNUSED(num_groups, weights_info);
-    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmConv2d::validate(src, weights, biases, dst, conv_info, weights_info, dilation,
-                                                       act_info, enable_fast_math, num_groups));
+    ARM_COMPUTE_UNUSED(weights_info);
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(CpuGemmConv2d::validate(src, weights, biases, dst, conv_info, weights_info,
+                                                                 dilation, act_info, enable_fast_math, num_groups));
+    const TrustedConfigureScope trusted_configure{};
     ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, conv_info, weights_info, dilation, act_info, enable_fast_math,
                            num_groups);
 
+    if (num_groups > 1 || use_gemm_direct_conv2d(src, weights, biases, dst, conv_info, weights_info, dilation,
+                                                 act_info, enable_fast_math))
+    {
+        // Grouped convolutions only run natively as the multis of the assembly GEMM
+        _gemm_direct_conv2d = std::make_unique<CpuGemmDirectConv2d>();
+        _gemm_direct_conv2d->configure(src, weights, biases, dst,
+                                       Conv2dInfo(conv_info, dilation, act_info, enable_fast_math, num_groups));
+        _aux_mem = _gemm_direct_conv2d->workspace();
+        return;
+    }
+
     const DataType   data_type   = src->data_type();
     const DataLayout data_layout = src->data_layout();
     const int        idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
@@ -562,7 +611,7 @@ void CpuGemmConv2d::configure(const ITensorInfo         *src,
      *           2. Take in an additional "original_weights" tensor info at configure
      */
     configure_mm(gemm_input_to_use, &_weights_reshaped, biases, gemm_output_to_use, act_info, enable_fast_math,
-                 gemm_3d_depth, fixed_format, weights_info.weight_format());
+                 gemm_3d_depth, fixed_format, weights_info.weight_format(), weights_info.sparse_weights());
 
     // Can only decide isVarWeightsKernel after gemm is configured
     _run_wt = !isVarWeightsKernel();
@@ -678,7 +727,13 @@ Status CpuGemmConv2d::validate(const ITensorInfo         *src,
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, weights);
     }
 
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups > 1, "Grouping (num_groups != 1) is not supported");
+    if (num_groups > 1)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_info.weight_format() != arm_compute::WeightFormat::UNSPECIFIED,
+                                        "Grouping is not supported with fixed format weights");
+        return CpuGemmDirectConv2d::validate(src, weights, biases, dst,
+                                             Conv2dInfo(conv_info, dilation, act_info, enable_fast_math, num_groups));
+    }
 
     const DataLayout data_layout = src->data_layout();
     const DataType   data_type   = src->data_type();
@@ -793,7 +848,7 @@ Status CpuGemmConv2d::validate(const ITensorInfo         *src,
     // See note_CpuGemmConv2d_weight_use_in_configure regarding the choice of the weights
     ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info,
                                             enable_fast_math, skip_col2im ? conv_h : 0, skip_im2col, fixed_format,
-                                            weights_info.weight_format()));
+                                            weights_info.weight_format(), weights_info.sparse_weights()));
 
     // Validate Col2Im/ReshapeLayer
     if (!skip_col2im && (data_layout == DataLayout::NCHW))
@@ -859,6 +914,12 @@ void CpuGemmConv2d::update_quantization_parameters(ITensorPack &tensors)
 
 void CpuGemmConv2d::run(ITensorPack &tensors)
 {
+    if (_gemm_direct_conv2d != nullptr)
+    {
+        _gemm_direct_conv2d->run(tensors);
+        return;
+    }
+
     prepare(tensors);
 
     auto src               = tensors.get_const_tensor(ACL_SRC_0);
@@ -888,8 +949,10 @@ void CpuGemmConv2d::run(ITensorPack &tensors)
     // Handle the case where output has top/bottom padding
     const ITensor *out_to_use = out_has_padding ? gemm_output.get() : dst;
     Tensor         gemm3d;
-    _gemm_output_3d.extend_padding(out_to_use->info()->padding());
-    gemm3d.allocator()->soft_init(_gemm_output_3d);
+    // Padding is extended on a copy so that concurrent runs leave the operator unchanged
+    TensorInfo gemm_output_3d = _gemm_output_3d;
+    gemm_output_3d.extend_padding(out_to_use->info()->padding());
+    gemm3d.allocator()->soft_init(gemm_output_3d);
     gemm3d.allocator()->import_memory(out_to_use->buffer());
     auto gemm_output_to_use = gemm_output.get();
 
@@ -957,6 +1020,12 @@ void CpuGemmConv2d::run(ITensorPack &tensors)
 
 void CpuGemmConv2d::prepare(ITensorPack &tensors)
 {
+    if (_gemm_direct_conv2d != nullptr)
+    {
+        _gemm_direct_conv2d->prepare(tensors);
+        return;
+    }
+
     if (!_is_prepared)
     {
         auto weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
@@ -1050,6 +1119,45 @@ experimental::MemoryRequirements CpuGemmConv2d::workspace() const
 {
     return _aux_mem;
 }
+
+OperatorDescription CpuGemmConv2d::describe() const
+{
+    OperatorDescription desc{};
+    desc.name = "CpuGemmConv2d";
+    if (_gemm_direct_conv2d != nullptr)
+    {
+        desc.method = "GemmDirectConv2d";
+        desc.children.emplace_back(_gemm_direct_conv2d->describe());
+        return desc;
+    }
+    desc.method = _skip_im2col ? "Gemm" : "Im2ColGemm";
+    if (!_skip_im2col && _im2col_kernel != nullptr)
+    {
+        desc.kernels.emplace_back(_im2col_kernel->name());
+    }
+    if (_run_wt && _weights_reshape_and_transpose_kernel != nullptr)
+    {
+        desc.kernels.emplace_back(_weights_reshape_and_transpose_kernel->name());
+    }
+    if (!_skip_col2im && _col2im_kernel != nullptr)
+    {
+        desc.kernels.emplace_back(_col2im_kernel->name());
+    }
+    if (_is_quantized && _mm_gemmlowp != nullptr)
+    {
+        desc.children.emplace_back(_mm_gemmlowp->describe());
+    }
+    else if (_mm_gemm != nullptr)
+    {
+        desc.children.emplace_back(_mm_gemm->describe());
+    }
+    // The slots below Im2ColOutput are shared with the GEMM, it reports them itself
+    for (unsigned int slot = Im2ColOutput; slot < Count; ++slot)
+    {
+        desc.workspace_bytes += _aux_mem[slot].size;
+    }
+    return desc;
+}
 bool CpuGemmConv2d::isVarWeightsKernel() const
 {
     return _mm_gemm && _mm_gemm->isVarWeightsKernel();
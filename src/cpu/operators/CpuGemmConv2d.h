@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,7 @@ namespace arm_compute
 namespace cpu
 {
 class CpuGemm;
+class CpuGemmDirectConv2d;
 class CpuGemmLowpMatrixMultiplyCore;
 class CpuGemmLowpOutputStage;
 class CpuReshape;
@@ -47,7 +48,12 @@ class CpuCol2ImKernel;
 class CpuWeightsReshapeKernel;
 } // namespace kernels
 
-/** Basic function to compute the convolution layer. @ref note_CpuGemmConv2d_weight_transformation */
+/** Basic function to compute the convolution layer. @ref note_CpuGemmConv2d_weight_transformation
+ *
+ * NHWC convolutions that would need im2col, such as strided or dilated ones, run on @ref CpuGemmDirectConv2d when it
+ * supports them. The assembly kernels then address the source through the convolution parameters, so no im2col
+ * workspace is requested.
+ */
 class CpuGemmConv2d : public ICpuOperator
 {
 public:
@@ -97,7 +103,8 @@ public:
      * @param[in]  act_info         (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
      * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                              available which may introduce a drop of accuracy as well. Default is false
-     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups > 1 is only supported for
+     *                              NHWC F16/F32 with initialized outputs, the IFM of the weights being the one of a group
      */
     void configure(const ITensorInfo         *src,
                    const ITensorInfo         *weights,
@@ -153,6 +160,7 @@ public:
     void                             run(ITensorPack &tensors) override;
     void                             prepare(ITensorPack &tensors) override;
     experimental::MemoryRequirements workspace() const override;
+    OperatorDescription              describe() const override;
 
 private:
     /** Configures the appropriate matrix multiply routine
@@ -169,6 +177,7 @@ private:
      * @param[in]  gemm_3d_depth    (Optional) Depth of GEMM 3D (Defaults to 1)
      * @param[in]  fixed_format     (Optional) Select GEMM execution with variable weights.
      * @param[in]  weight_format    (Optional) The layout to be used for the weights tensor when running GEMM with variable weights.
+     * @param[in]  sparse_weights   (Optional) The weights are 2:4 structured-sparse along the input channels.
      */
     void configure_mm(const ITensorInfo         *src,
                       const ITensorInfo         *weights,
@@ -178,7 +187,8 @@ private:
                       bool                       enable_fast_math = false,
                       int                        gemm_3d_depth    = 1,
                       bool                       fixed_format     = false,
-                      arm_compute::WeightFormat  weight_format    = arm_compute::WeightFormat::UNSPECIFIED);
+                      arm_compute::WeightFormat  weight_format    = arm_compute::WeightFormat::UNSPECIFIED,
+                      bool                       sparse_weights   = false);
     /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMConvolutionLayer matrix multiply routines
      *
      * @param[in] src              Input tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/BFLOAT16/F16/F32.
@@ -194,6 +204,7 @@ private:
      * @param[in] skip_im2col      (Optional) Flag which specifies if im2col has to be skipped. i.e. 1x1 convolution with NHWC data layout. (Default to false)
      * @param[in] fixed_format     (Optional) Select GEMM execution with variable weights.
      * @param[in] weight_format    (Optional) The layout to be used for the weights tensor when running GEMM with variable weights.
+     * @param[in] sparse_weights   (Optional) The weights are 2:4 structured-sparse along the input channels.
      *
      * @return a status
      */
@@ -206,7 +217,8 @@ private:
                               int                        gemm_3d_depth    = 1,
                               bool                       skip_im2col      = false,
                               bool                       fixed_format     = false,
-                              arm_compute::WeightFormat  weight_format    = arm_compute::WeightFormat::UNSPECIFIED);
+                              arm_compute::WeightFormat  weight_format    = arm_compute::WeightFormat::UNSPECIFIED,
+                              bool                       sparse_weights   = false);
     /** Static function to check if GEMM3D is supported in @ref NEGEMM or in @ref CpuGemmMLowpMatrixMultiplyCore
      *
      * @param[in] src           Input tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/BFLOAT16/F16/F32.
@@ -245,6 +257,30 @@ private:
                                      const Size2D              &dilation,
                                      const ActivationLayerInfo &act_info);
 
+    /** Check if the convolution runs on @ref CpuGemmDirectConv2d instead of im2col and GEMM
+     *
+     * @param[in] src              Source tensor info.
+     * @param[in] weights          Weights tensor info.
+     * @param[in] biases           Biases tensor info.
+     * @param[in] dst              Destination tensor info.
+     * @param[in] conv_info        Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] weights_info     Specifies if the weights tensor has been reshaped with CpuWeightsReshapeKernel.
+     * @param[in] dilation         Dilation, in elements, across x and y.
+     * @param[in] act_info         Activation layer information in case of a fused activation.
+     * @param[in] enable_fast_math Enable fast math computation.
+     *
+     * @return True if the source is NHWC, im2col cannot be skipped and @ref CpuGemmDirectConv2d validates.
+     */
+    static bool use_gemm_direct_conv2d(const ITensorInfo         *src,
+                                       const ITensorInfo         *weights,
+                                       const ITensorInfo         *biases,
+                                       const ITensorInfo         *dst,
+                                       const PadStrideInfo       &conv_info,
+                                       const WeightsInfo         &weights_info,
+                                       const Size2D              &dilation,
+                                       const ActivationLayerInfo &act_info,
+                                       bool                       enable_fast_math);
+
     /** Indicates if the convolution executes in variable weights mode.
      *
      * Similar to @ref CpuGemm::isVarWeightsKernel
@@ -255,8 +291,8 @@ private:
         GemmAsmPretransposedRHS  = 2, // CpuGemmAssemblyDispatch::Pretranspose
         GemmTransposed1xWRHS     = 5, // CpuGemm::Transposed1xWRHS
         GemmLowpTransposed1xWRHS = 6, // CpuGemmLowpMatrixMultiplyCore::TmpB
-        /* Slots 0 - 9 reserved and shared by CpuGemmLowpMatrixMultiplyCore and CpuGemm */
-        Im2ColOutput = 10,
+        /* Slots 0 - 10 reserved and shared by CpuGemmLowpMatrixMultiplyCore and CpuGemm */
+        Im2ColOutput = 11,
         WeightsReshaped,
         GemmOutput,
         Count
@@ -285,6 +321,7 @@ private:
     std::unique_ptr<CpuGemmLowpMatrixMultiplyCore>    _mm_gemmlowp;
     std::unique_ptr<kernels::CpuCol2ImKernel>         _col2im_kernel;
     std::unique_ptr<CpuReshape>                       _reshape;
+    std::unique_ptr<CpuGemmDirectConv2d>              _gemm_direct_conv2d;
 
     TensorInfo _im2col_output;
     TensorInfo _weights_reshaped;
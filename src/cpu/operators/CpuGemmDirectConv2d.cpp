@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/runtime/FunctionDescriptors.h"
 
 #include "src/common/utils/Log.h"
@@ -87,11 +88,14 @@ cpu::AsmGemmInfo init_assembly_metadata(const Conv2dInfo &info, bool is_indirect
     asm_info.reinterpret_input_as_3d = true;
     asm_info.padding_top             = info.conv_info.pad_top();
     asm_info.padding_left            = info.conv_info.pad_left();
+    asm_info.dilation                = info.dilation;
+    asm_info.num_groups              = info.num_groups;
     asm_info.padding_value           = 0.f;
     asm_info.negated_offsets         = false;
     asm_info.fast_mode               = info.enable_fast_math;
     asm_info.fixed_format            = info.weights_info.weight_format() != WeightFormat::UNSPECIFIED;
     asm_info.weight_format           = info.weights_info.weight_format();
+    asm_info.accumulate              = info.accumulate;
     return asm_info;
 }
 } // namespace
@@ -99,10 +103,12 @@ cpu::AsmGemmInfo init_assembly_metadata(const Conv2dInfo &info, bool is_indirect
 CpuGemmDirectConv2d::CpuGemmDirectConv2d()
     : _gemm_asm_func(std::make_unique<CpuGemmAssemblyDispatch>()),
       _activation_func(std::make_unique<CpuActivation>()),
+      _bias_add_func(std::make_unique<CpuAdd>()),
       _weights_permute_func(std::make_unique<CpuPermute>()),
       _aux_mem(AuxTensorIdx::Count),
       _perm_weights(),
       _run_activation(false),
+      _run_bias_addition(false),
       _is_prepared(false)
 {
 }
@@ -116,12 +122,14 @@ void CpuGemmDirectConv2d::configure(const ITensorInfo *src,
                                     const Conv2dInfo  &info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
-    ARM_COMPUTE_ERROR_THROW_ON(
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(
         CpuGemmDirectConv2d::validate(src, weights, biases != nullptr ? biases : nullptr, dst, info));
+    const TrustedConfigureScope trusted_configure{};
     ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, info);
 
-    _run_activation = info.act_info.enabled() && !_gemm_asm_func->is_activation_supported(info.act_info);
-    _is_prepared    = false;
+    _run_activation    = info.act_info.enabled() && !_gemm_asm_func->is_activation_supported(info.act_info);
+    _run_bias_addition = info.accumulate && biases != nullptr;
+    _is_prepared       = false;
 
     _weights_permute_func->configure(weights, &_perm_weights, PermutationVector{3, 0, 1, 2});
 
@@ -131,7 +139,14 @@ void CpuGemmDirectConv2d::configure(const ITensorInfo *src,
     {
         asm_info.output_stage = calculate_output_stage_metadata(src, weights, dst, info.act_info);
     }
-    _gemm_asm_func->configure(src, &_perm_weights, biases, dst, asm_info);
+    // The assembly kernels ignore the bias when accumulating, it is added to the destination beforehand instead
+    _gemm_asm_func->configure(src, &_perm_weights, _run_bias_addition ? nullptr : biases, dst, asm_info);
+
+    // Configure bias addition
+    if (_run_bias_addition)
+    {
+        _bias_add_func->configure(dst, biases, dst, ConvertPolicy::SATURATE);
+    }
 
     // Configure activation
     if (_run_activation)
@@ -176,13 +191,22 @@ Status CpuGemmDirectConv2d::validate(const ITensorInfo *src,
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, weights);
     }
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.num_groups > 1, "Grouping (num_groups != 1) is not supported on Neon");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_layout() != DataLayout::NHWC, "Data layout supported is NHWC");
     const DataType    data_type = src->data_type();
     const TensorShape i_shape   = src->tensor_shape();
     const TensorShape w_shape   = weights->tensor_shape();
-    ARM_COMPUTE_RETURN_ERROR_ON(w_shape[0] != i_shape[0]);
-    ARM_COMPUTE_RETURN_ERROR_ON(info.dilation != Size2D(1U, 1U));
+    ARM_COMPUTE_RETURN_ERROR_ON(info.num_groups == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(w_shape[0] * info.num_groups != i_shape[0]);
+    if (info.num_groups > 1)
+    {
+        // Each group is a multi of the assembly GEMM, reading its input channels in place
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_fixed_format(info.weights_info.weight_format()),
+                                        "Grouping is not supported with fixed format weights");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->total_size() == 0,
+                                        "The destination must be initialized for grouped convolutions");
+        ARM_COMPUTE_RETURN_ERROR_ON((w_shape[3] % info.num_groups) != 0);
+    }
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
     // Validate biases
     if (biases != nullptr)
@@ -199,15 +223,41 @@ Status CpuGemmDirectConv2d::validate(const ITensorInfo *src,
         ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
     }
 
+    const bool run_bias_addition = info.accumulate && biases != nullptr;
+    if (info.accumulate)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_data_type_float(data_type), "Accumulation is only supported for F16/F32");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->total_size() == 0,
+                                        "The destination must be initialized to accumulate into it");
+        if (run_bias_addition)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(CpuAdd::validate(dst, biases, dst, ConvertPolicy::SATURATE));
+        }
+    }
+
     cpu::AsmGemmInfo asm_info = init_assembly_metadata(info, false);
-    ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuGemmAssemblyDispatch::validate(src, weights, biases, dst, asm_info));
+    const ITensorInfo *asm_biases = run_bias_addition ? nullptr : biases;
+    ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuGemmAssemblyDispatch::validate(src, weights, asm_biases, dst, asm_info));
     return Status{};
 }
 void CpuGemmDirectConv2d::run(ITensorPack &tensors)
 {
     prepare(tensors);
 
-    _gemm_asm_func->run(tensors);
+    if (_run_bias_addition)
+    {
+        ITensor    *io = tensors.get_tensor(ACL_DST);
+        ITensorPack pack{{ACL_SRC_0, io}, {ACL_SRC_1, tensors.get_const_tensor(ACL_SRC_2)}, {ACL_DST, io}};
+        _bias_add_func->run(pack);
+
+        ITensorPack gemm_pack = tensors;
+        gemm_pack.remove_tensor(ACL_SRC_2);
+        _gemm_asm_func->run(gemm_pack);
+    }
+    else
+    {
+        _gemm_asm_func->run(tensors);
+    }
     if (_run_activation)
     {
         ITensor    *io = tensors.get_tensor(ACL_DST);
@@ -248,5 +298,29 @@ experimental::MemoryRequirements CpuGemmDirectConv2d::workspace() const
 {
     return _aux_mem;
 }
+
+OperatorDescription CpuGemmDirectConv2d::describe() const
+{
+    OperatorDescription desc{};
+    desc.name = "CpuGemmDirectConv2d";
+    if (_gemm_asm_func != nullptr)
+    {
+        desc.children.emplace_back(_gemm_asm_func->describe());
+    }
+    if (_run_bias_addition && _bias_add_func != nullptr)
+    {
+        desc.children.emplace_back(_bias_add_func->describe());
+    }
+    if (_run_activation && _activation_func != nullptr)
+    {
+        desc.children.emplace_back(_activation_func->describe());
+    }
+    // The slots below PermutedWeights are reserved for the assembly dispatch, it reports them itself
+    for (unsigned int slot = PermutedWeights; slot < Count; ++slot)
+    {
+        desc.workspace_bytes += _aux_mem[slot].size;
+    }
+    return desc;
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023 Arm Limited.
+ * Copyright (c) 2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuOperator.h"
 #include "src/cpu/operators/CpuActivation.h"
+#include "src/cpu/operators/CpuAdd.h"
 #include "src/cpu/operators/CpuPermute.h"
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
@@ -69,6 +70,12 @@ public:
      * @param[in] dst     Destination tensor info. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                    Data types supported: Same as @p input.
      * @param[in] info    Contains padding and stride information described in @ref PadStrideInfo.
+     *                    If @ref Conv2dInfo::accumulate is set, the result is added to the content of @p dst, which
+     *                    must then be already initialized. Only supported for F16/F32. The activation, if any, is
+     *                    applied to the sum.
+     *                    With @ref Conv2dInfo::num_groups > 1, the IFM of @p weights is the one of a group and each
+     *                    group runs as a multi of the same GEMM. Only supported for F16/F32, with an initialized
+     *                    @p dst and weights of @ref WeightFormat::UNSPECIFIED.
      */
     void configure(const ITensorInfo *src,
                    const ITensorInfo *weights,
@@ -91,6 +98,7 @@ public:
     void                             run(ITensorPack &tensors) override;
     void                             prepare(ITensorPack &constants) override;
     experimental::MemoryRequirements workspace() const override;
+    OperatorDescription              describe() const override;
 
 private:
     enum AuxTensorIdx
@@ -105,10 +113,12 @@ private:
 
     std::unique_ptr<CpuGemmAssemblyDispatch> _gemm_asm_func;
     std::unique_ptr<CpuActivation>           _activation_func;
+    std::unique_ptr<CpuAdd>                  _bias_add_func;
     std::unique_ptr<CpuPermute>              _weights_permute_func;
     experimental::MemoryRequirements         _aux_mem;
     TensorInfo                               _perm_weights;
     bool                                     _run_activation;
+    bool                                     _run_bias_addition;
     bool                                     _is_prepared;
 };
 } // namespace cpu
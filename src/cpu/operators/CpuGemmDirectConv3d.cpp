@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuGemmDirectConv3d.h"
+
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+
+#include <set>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+GEMMLowpOutputStageInfo calculate_output_stage_metadata(const ITensorInfo         *src,
+                                                        const ITensorInfo         *weights,
+                                                        const ITensorInfo         *dst,
+                                                        const ActivationLayerInfo &act)
+{
+    const QuantizationInfo        iqinfo    = src->quantization_info();
+    const QuantizationInfo        wqinfo    = weights->quantization_info();
+    const QuantizationInfo        oqinfo    = (dst->total_size() == 0) ? iqinfo : dst->quantization_info();
+    const UniformQuantizationInfo uoqinfo   = oqinfo.uniform();
+    const DataType                data_type = src->data_type();
+    // Merge activation with output stage
+    const std::set<ActivationLayerInfo::ActivationFunction> supported_acts = {
+        ActivationLayerInfo::ActivationFunction::RELU, ActivationLayerInfo::ActivationFunction::BOUNDED_RELU,
+        ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU};
+    PixelValue type_min{};
+    PixelValue type_max{};
+    std::tie(type_min, type_max) = get_min_max(data_type);
+    int32_t min_activation       = type_min.get<int32_t>();
+    int32_t max_activation       = type_max.get<int32_t>();
+    if (act.enabled() && supported_acts.count(act.activation()) != 0)
+    {
+        std::tie(min_activation, max_activation) = get_quantized_activation_min_max(act, data_type, uoqinfo);
+    }
+    GEMMLowpOutputStageInfo os_info;
+    os_info.type               = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
+    os_info.gemmlowp_offset    = uoqinfo.offset;
+    os_info.gemmlowp_min_bound = min_activation;
+    os_info.gemmlowp_max_bound = max_activation;
+    quantization::calculate_quantized_multipliers(iqinfo, wqinfo, oqinfo, os_info);
+    return os_info;
+}
+
+AsmGemmInfo init_assembly_metadata(const ITensorInfo *src,
+                                   const ITensorInfo *weights,
+                                   const ITensorInfo *dst,
+                                   const Conv3dInfo  &info)
+{
+    AsmGemmInfo asm_info;
+    asm_info.method          = AsmConvMethod::Indirect3d;
+    asm_info.activation_info = info.act_info;
+    asm_info.padding_3d      = info.padding;
+    asm_info.stride_3d       = info.stride;
+    asm_info.negated_offsets = false;
+    asm_info.fast_mode       = info.enable_fast_math;
+    if (is_data_type_quantized(src->data_type()))
+    {
+        asm_info.output_stage = calculate_output_stage_metadata(src, weights, dst, info.act_info);
+    }
+    return asm_info;
+}
+
+bool is_activation_fused(const ITensorInfo *src, const ActivationLayerInfo &act)
+{
+    // Quantized activations are merged in the output stage bounds
+    return !act.enabled() || is_data_type_quantized(src->data_type()) ||
+           CpuGemmAssemblyDispatch::is_activation_supported(act);
+}
+} // namespace
+
+CpuGemmDirectConv3d::CpuGemmDirectConv3d()
+    : _gemm_asm_func(std::make_unique<CpuGemmAssemblyDispatch>()),
+      _activation_func(std::make_unique<CpuActivation>()),
+      _run_activation(false),
+      _is_prepared(false)
+{
+}
+
+CpuGemmDirectConv3d::~CpuGemmDirectConv3d() = default;
+
+void CpuGemmDirectConv3d::configure(const ITensorInfo *src,
+                                    const ITensorInfo *weights,
+                                    const ITensorInfo *biases,
+                                    ITensorInfo       *dst,
+                                    const Conv3dInfo  &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmDirectConv3d::validate(src, weights, biases, dst, info));
+    ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, info);
+
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(misc::shape_calculator::compute_conv3d_shape(
+                                 src->tensor_shape(), weights->tensor_shape(), info)));
+
+    _run_activation = !is_activation_fused(src, info.act_info);
+    _is_prepared    = false;
+
+    _gemm_asm_func->configure(src, weights, biases, dst, init_assembly_metadata(src, weights, dst, info));
+
+    if (_run_activation)
+    {
+        _activation_func->configure(dst, nullptr, info.act_info);
+    }
+}
+
+Status CpuGemmDirectConv3d::validate(const ITensorInfo *src,
+                                     const ITensorInfo *weights,
+                                     const ITensorInfo *biases,
+                                     const ITensorInfo *dst,
+                                     const Conv3dInfo  &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_layout() != DataLayout::NDHWC, "Data layout supported is NDHWC");
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                         DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.dilation != Size3D(1U, 1U, 1U));
+    // Weight layout is D, H, W, Cin, Cout
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 5);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(1) != src->dimension(0));
+
+    if (biases != nullptr)
+    {
+        if (is_data_type_quantized(src->data_type()))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::S32);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, biases);
+        }
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+    }
+
+    const TensorShape dst_shape =
+        misc::shape_calculator::compute_conv3d_shape(src->tensor_shape(), weights->tensor_shape(), info);
+    const TensorInfo dst_info = (dst->total_size() != 0) ? *dst : src->clone()->set_tensor_shape(dst_shape);
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), dst_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+    }
+
+    if (!is_activation_fused(src, info.act_info))
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuActivation::validate(&dst_info, nullptr, info.act_info));
+    }
+
+    ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmAssemblyDispatch::validate(src, weights, biases, &dst_info,
+                                                                  init_assembly_metadata(src, weights, dst, info)));
+    return Status{};
+}
+
+void CpuGemmDirectConv3d::run(ITensorPack &tensors)
+{
+    prepare(tensors);
+
+    _gemm_asm_func->run(tensors);
+    if (_run_activation)
+    {
+        ITensor    *io = tensors.get_tensor(ACL_DST);
+        ITensorPack pack{{ACL_SRC, io}, {ACL_DST, io}};
+        _activation_func->run(pack);
+    }
+}
+
+void CpuGemmDirectConv3d::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        _gemm_asm_func->prepare(tensors);
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuGemmDirectConv3d::workspace() const
+{
+    return _gemm_asm_func->workspace();
+}
+} // namespace cpu
+} // namespace arm_compute
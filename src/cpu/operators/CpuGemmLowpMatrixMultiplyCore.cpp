@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 #include "arm_compute/core/KernelDescriptors.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/TensorAllocator.h"
@@ -44,10 +45,13 @@
 #include "src/cpu/kernels/CpuGemmLowpOffsetContributionKernel.h"
 #include "src/cpu/kernels/CpuGemmLowpOffsetContributionOutputStageKernel.h"
 #include "src/cpu/kernels/CpuGemmTranspose1xWKernel.h"
+#include "src/cpu/kernels/CpuUnpackInt4Kernel.h"
 #include "src/cpu/operators/CpuActivation.h"
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
+#include <cstring>
+
 using namespace arm_compute::misc::shape_calculator;
 using namespace arm_compute::experimental;
 
@@ -84,6 +88,7 @@ CpuGemmLowpMatrixMultiplyCore::CpuGemmLowpMatrixMultiplyCore()
       _activation_func(),
       _convert_to_signed_asymm(),
       _convert_from_signed_asymm(),
+      _unpack_b_kernel(),
       _vector_sum_col(),
       _vector_sum_row(),
       _tmp_a(),
@@ -91,8 +96,11 @@ CpuGemmLowpMatrixMultiplyCore::CpuGemmLowpMatrixMultiplyCore()
       _mm_result_s32(),
       _signed_a(),
       _signed_output(),
+      _unpacked_b(),
+      _folded_bias(),
       _a_offset(0),
       _b_offset(0),
+      _dequantize_scale(1.f),
       _run_vector_matrix_multiplication(false),
       _assembly_path(false),
       _fused_assembly_path(false),
@@ -101,6 +109,9 @@ CpuGemmLowpMatrixMultiplyCore::CpuGemmLowpMatrixMultiplyCore()
       _fuse_output_stage(false),
       _run_activation(false),
       _flip_signedness(false),
+      _unpack_b(false),
+      _keep_unpacked_b(false),
+      _fold_a_offset(false),
       _gemm_info(),
       _aux_mem(Count)
 {
@@ -111,9 +122,19 @@ void CpuGemmLowpMatrixMultiplyCore::configure(
     const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, ITensorInfo *dst, const GEMMInfo &gemm_info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, dst);
-    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmLowpMatrixMultiplyCore::validate(a, b, c, dst, gemm_info));
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(CpuGemmLowpMatrixMultiplyCore::validate(a, b, c, dst, gemm_info));
+    const TrustedConfigureScope trusted_configure{};
     ARM_COMPUTE_LOG_PARAMS(a, b, c, dst, gemm_info);
 
+    // Packed 4-bit b is unpacked to 8-bit and multiplied as such
+    _unpack_b = b->data_type() == DataType::U8;
+    if (_unpack_b)
+    {
+        _unpack_b_kernel = std::make_unique<kernels::CpuUnpackInt4Kernel>();
+        _unpack_b_kernel->configure(b, &_unpacked_b);
+        b = &_unpacked_b;
+    }
+
     const ITensorInfo *matrix_a = a;
     const ITensorInfo *matrix_b = b;
     GEMMInfo           info     = gemm_info;
@@ -125,6 +146,7 @@ void CpuGemmLowpMatrixMultiplyCore::configure(
     _reshape_b_only_on_first_run      = b->are_values_constant();
     _is_prepared                      = false;
     _fused_assembly_path              = false;
+    _fold_a_offset                    = false;
     _flip_signedness = is_data_type_quantized_per_channel(b->data_type()) && (a->data_type() == DataType::QASYMM8) &&
                        _reshape_b_only_on_first_run;
     _gemm_info = gemm_info;
@@ -220,6 +242,25 @@ void CpuGemmLowpMatrixMultiplyCore::configure(
         }
     }
 #endif /* __aarch64__ */
+
+    // This scale is needed for the s8_f32 kernel where the multiplication output is dequantized to F32/F16.
+    _dequantize_scale = dst->data_type() == DataType::F32 || dst->data_type() == DataType::F16
+                            ? a->quantization_info().uniform().scale * b->quantization_info().uniform().scale
+                            : 1.0f;
+
+    // When b is constant and has no offset, the a offset contribution is a constant per column of dst. The assembly
+    // kernel then adds it with the bias while it writes dst, instead of a separate offset contribution pass.
+    const bool dst_has_foldable_bias =
+        dst->data_type() == DataType::S32 ||
+        (dst->data_type() == DataType::F32 && (c == nullptr || c->are_values_constant()));
+    _fold_a_offset = _assembly_path && !_fused_assembly_path && !_fuse_output_stage && a_offset_kernel_needed &&
+                     !b_offset_kernel_needed && !a->quantization_info().is_dynamic() && _reshape_b_only_on_first_run &&
+                     b->num_dimensions() <= 2 && dst_has_foldable_bias;
+    if (_fold_a_offset)
+    {
+        _folded_bias = TensorInfo(compute_reductionA_shape(*b), 1, dst->data_type());
+    }
+
     if (!(_assembly_path || _run_vector_matrix_multiplication))
     {
         matrix_a = &_tmp_a;
@@ -287,11 +328,6 @@ void CpuGemmLowpMatrixMultiplyCore::configure(
         }
         else
         {
-            // This scale is needed for the s8_f32 kernel where the multiplication output is dequantized to F32/F16.
-            const float dequantize_scale =
-                dst->data_type() == DataType::F32 || dst->data_type() == DataType::F16
-                    ? a->quantization_info().uniform().scale * b->quantization_info().uniform().scale
-                    : 1.0f;
             // Configure matrix multiply kernel
             if (!_assembly_path)
             {
@@ -299,10 +335,14 @@ void CpuGemmLowpMatrixMultiplyCore::configure(
                 _mm_kernel->configure(matrix_a, matrix_b, dst);
             }
             // Configure offset contribution kernel
-            _offset_contribution_kernel = std::make_unique<kernels::CpuGemmLowpOffsetContributionKernel>();
-            _offset_contribution_kernel->configure(dst, a_offset_kernel_needed ? &_vector_sum_col : nullptr,
-                                                   b_offset_kernel_needed ? &_vector_sum_row : nullptr,
-                                                   a_to_use->dimension(0), _a_offset, _b_offset, dequantize_scale);
+            if (!_fold_a_offset)
+            {
+                _offset_contribution_kernel = std::make_unique<kernels::CpuGemmLowpOffsetContributionKernel>();
+                _offset_contribution_kernel->configure(dst, a_offset_kernel_needed ? &_vector_sum_col : nullptr,
+                                                       b_offset_kernel_needed ? &_vector_sum_row : nullptr,
+                                                       a_to_use->dimension(0), _a_offset, _b_offset,
+                                                       _dequantize_scale);
+            }
         }
     }
     // Configure activation
@@ -341,6 +381,16 @@ void CpuGemmLowpMatrixMultiplyCore::configure(
     _aux_mem[SignedA] = MemoryInfo(offset_int_vec(SignedA), MemoryLifetime::Temporary, _signed_a.total_size());
     _aux_mem[SignedOutput] =
         MemoryInfo(offset_int_vec(SignedOutput), MemoryLifetime::Temporary, _signed_output.total_size());
+
+    // A constant unpacked b is only needed at run time if it is not reshaped in prepare
+    const bool b_reshaped_in_prepare =
+        _assembly_path ? _aux_mem[AsmPretransposedB].size > 0 : !_run_vector_matrix_multiplication;
+    _keep_unpacked_b = !(_reshape_b_only_on_first_run && b_reshaped_in_prepare);
+    _aux_mem[UnpackedB] = MemoryInfo(offset_int_vec(UnpackedB),
+                                     !_reshape_b_only_on_first_run ? MemoryLifetime::Temporary
+                                     : _keep_unpacked_b            ? MemoryLifetime::Persistent
+                                                                   : MemoryLifetime::Prepare,
+                                     _unpacked_b.total_size());
 }
 
 Status CpuGemmLowpMatrixMultiplyCore::validate(const ITensorInfo *a,
@@ -349,6 +399,17 @@ Status CpuGemmLowpMatrixMultiplyCore::validate(const ITensorInfo *a,
                                                const ITensorInfo *output,
                                                const GEMMInfo    &gemm_info)
 {
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, output);
+
+    // Packed 4-bit b is unpacked to 8-bit and multiplied as such
+    TensorInfo unpacked_b{};
+    if (b->data_type() == DataType::U8)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuUnpackInt4Kernel::validate(b, &unpacked_b));
+        unpacked_b = kernels::CpuUnpackInt4Kernel::unpacked_info(*b);
+        b          = &unpacked_b;
+    }
+
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(b, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
                                                          DataType::QSYMM8, DataType::QSYMM8_PER_CHANNEL);
@@ -598,9 +659,42 @@ Status CpuGemmLowpMatrixMultiplyCore::validate(const ITensorInfo *a,
     return Status{};
 }
 
+void CpuGemmLowpMatrixMultiplyCore::unpack_b(ITensorPack &tensors, ITensor *unpacked_b)
+{
+    ITensorPack pack = {{TensorType::ACL_SRC, tensors.get_const_tensor(TensorType::ACL_SRC_1)},
+                        {TensorType::ACL_DST, unpacked_b}};
+    NEScheduler::get().schedule_op(_unpack_b_kernel.get(), Window::DimY, _unpack_b_kernel->window(), pack);
+}
+
 void CpuGemmLowpMatrixMultiplyCore::run(ITensorPack &tensors)
 {
-    prepare(tensors);
+    if (!_unpack_b)
+    {
+        run_unpacked(tensors);
+        return;
+    }
+
+    // Once prepared, a constant b is only unpacked again if it was not kept
+    const bool          needs_unpack = !_is_prepared || !_reshape_b_only_on_first_run;
+    CpuAuxTensorHandler unpacked_b(offset_int_vec(UnpackedB), _unpacked_b, tensors, false,
+                                   !needs_unpack && !_keep_unpacked_b);
+    if (needs_unpack)
+    {
+        unpack_b(tensors, unpacked_b.get());
+        if (_reshape_b_only_on_first_run)
+        {
+            tensors.get_const_tensor(TensorType::ACL_SRC_1)->mark_as_unused();
+        }
+    }
+
+    ITensorPack unpacked_tensors = tensors;
+    unpacked_tensors.add_const_tensor(TensorType::ACL_SRC_1, unpacked_b.get());
+    run_unpacked(unpacked_tensors);
+}
+
+void CpuGemmLowpMatrixMultiplyCore::run_unpacked(ITensorPack &tensors)
+{
+    prepare_unpacked(tensors);
 
     auto a        = tensors.get_const_tensor(TensorType::ACL_SRC_0);
     auto b        = tensors.get_const_tensor(TensorType::ACL_SRC_1);
@@ -617,6 +711,9 @@ void CpuGemmLowpMatrixMultiplyCore::run(ITensorPack &tensors)
     CpuAuxTensorHandler mm_result_s32(offset_int_vec(MMResultS32), _mm_result_s32, tensors, false);
     CpuAuxTensorHandler signed_a(offset_int_vec(SignedA), _signed_a, tensors, false);
     CpuAuxTensorHandler signed_output(offset_int_vec(SignedOutput), _signed_output, tensors, false);
+    // The folded bias lives in the memory of the column sums
+    CpuAuxTensorHandler folded_bias(offset_int_vec(VectorSumCol), _folded_bias, tensors, false, !_fold_a_offset,
+                                    !_fold_a_offset);
 
     const QuantizationInfo a_qinfo = a->info()->quantization_info();
     const QuantizationInfo b_qinfo = b->info()->quantization_info();
@@ -654,6 +751,15 @@ void CpuGemmLowpMatrixMultiplyCore::run(ITensorPack &tensors)
             asm_glue_tensors.add_const_tensor(TensorType::ACL_SRC_0, a_to_use);
             asm_glue_tensors.add_const_tensor(TensorType::ACL_SRC_1, b);
             asm_glue_tensors.add_tensor(TensorType::ACL_DST, output_to_use);
+            if (_fold_a_offset)
+            {
+                asm_glue_tensors.add_const_tensor(TensorType::ACL_SRC_2, folded_bias.get());
+            }
+            else if (output_to_use->info()->data_type() == DataType::S32)
+            {
+                // An S32 dst has no bias, the assembly kernel would add it
+                asm_glue_tensors.remove_tensor(TensorType::ACL_SRC_2);
+            }
         }
         _asm_glue->run(asm_glue_tensors);
     }
@@ -688,7 +794,7 @@ void CpuGemmLowpMatrixMultiplyCore::run(ITensorPack &tensors)
         NEScheduler::get().schedule_op(_mm_kernel.get(), Window::DimY, _mm_kernel->window(), pack_mm);
     }
 
-    if (!_fused_assembly_path)
+    if (!(_fused_assembly_path || _fold_a_offset))
     {
         // Run matrix A reduction kernel only if _b_offset is not equal to 0
         if (_b_offset != 0)
@@ -764,6 +870,29 @@ void CpuGemmLowpMatrixMultiplyCore::run(ITensorPack &tensors)
 }
 
 void CpuGemmLowpMatrixMultiplyCore::prepare(ITensorPack &tensors)
+{
+    if (!_unpack_b)
+    {
+        prepare_unpacked(tensors);
+    }
+    else if (!_is_prepared)
+    {
+        CpuAuxTensorHandler unpacked_b(offset_int_vec(UnpackedB), _unpacked_b, tensors, false);
+        unpack_b(tensors, unpacked_b.get());
+
+        ITensorPack unpacked_tensors = tensors;
+        unpacked_tensors.add_const_tensor(TensorType::ACL_SRC_1, unpacked_b.get());
+        prepare_unpacked(unpacked_tensors);
+
+        // Only the unpacked values are read from now on
+        if (_reshape_b_only_on_first_run)
+        {
+            tensors.get_const_tensor(TensorType::ACL_SRC_1)->mark_as_unused();
+        }
+    }
+}
+
+void CpuGemmLowpMatrixMultiplyCore::prepare_unpacked(ITensorPack &tensors)
 {
     if (!_is_prepared)
     {
@@ -793,15 +922,103 @@ void CpuGemmLowpMatrixMultiplyCore::prepare(ITensorPack &tensors)
             ITensorPack         pack = {{TensorType::ACL_SRC, original_b}, {TensorType::ACL_DST, vector_sum_col.get()}};
             NEScheduler::get().schedule_op(_mtx_b_reduction_kernel.get(), Window::DimX,
                                            _mtx_b_reduction_kernel->window(), pack);
+
+            if (_fold_a_offset)
+            {
+                fold_a_offset(vector_sum_col.get(), tensors.get_const_tensor(TensorType::ACL_SRC_2));
+            }
         }
         _is_prepared = true;
     }
 }
+
+void CpuGemmLowpMatrixMultiplyCore::fold_a_offset(ITensor *vector_sum_col, const ITensor *c)
+{
+    const size_t n       = _vector_sum_col.dimension(0);
+    uint8_t     *sum_col = vector_sum_col->buffer() + vector_sum_col->info()->offset_first_element_in_bytes();
+    const float *bias    = nullptr;
+    if (c != nullptr)
+    {
+        bias = reinterpret_cast<const float *>(c->buffer() + c->info()->offset_first_element_in_bytes());
+    }
+
+    // Each value is read before it is overwritten, so the column sums are replaced in place
+    for (size_t i = 0; i < n; ++i)
+    {
+        int32_t col;
+        std::memcpy(&col, sum_col + i * sizeof(int32_t), sizeof(int32_t));
+        const int32_t a_offset_term = col * _a_offset;
+        if (_folded_bias.data_type() == DataType::S32)
+        {
+            std::memcpy(sum_col + i * sizeof(int32_t), &a_offset_term, sizeof(int32_t));
+        }
+        else
+        {
+            const float folded =
+                static_cast<float>(a_offset_term) * _dequantize_scale + (bias != nullptr ? bias[i] : 0.f);
+            std::memcpy(sum_col + i * sizeof(float), &folded, sizeof(float));
+        }
+    }
+}
+
 experimental::MemoryRequirements CpuGemmLowpMatrixMultiplyCore::workspace() const
 {
     return _aux_mem;
 }
 
+OperatorDescription CpuGemmLowpMatrixMultiplyCore::describe() const
+{
+    OperatorDescription desc{};
+    desc.name = "CpuGemmLowpMatrixMultiplyCore";
+    if (_asm_glue != nullptr && _asm_glue->is_configured())
+    {
+        desc.method = _fused_assembly_path ? "FusedAssembly" : "Assembly";
+        desc.children.emplace_back(_asm_glue->describe());
+    }
+    else
+    {
+        desc.method = _run_vector_matrix_multiplication ? "VectorMatrix" : "InterleaveTranspose";
+        if (_mtx_a_reshape_kernel != nullptr)
+        {
+            desc.kernels.emplace_back(_mtx_a_reshape_kernel->name());
+        }
+        if (_mtx_b_reshape_kernel != nullptr)
+        {
+            desc.kernels.emplace_back(_mtx_b_reshape_kernel->name());
+        }
+        if (_mm_kernel != nullptr)
+        {
+            desc.kernels.emplace_back(_mm_kernel->name());
+        }
+    }
+    if (_mtx_a_reduction_kernel != nullptr)
+    {
+        desc.kernels.emplace_back(_mtx_a_reduction_kernel->name());
+    }
+    if (_mtx_b_reduction_kernel != nullptr)
+    {
+        desc.kernels.emplace_back(_mtx_b_reduction_kernel->name());
+    }
+    if (_offset_contribution_output_stage_kernel != nullptr)
+    {
+        desc.kernels.emplace_back(_offset_contribution_output_stage_kernel->name());
+    }
+    else if (_offset_contribution_kernel != nullptr)
+    {
+        desc.kernels.emplace_back(_offset_contribution_kernel->name());
+    }
+    if (_run_activation && _activation_func != nullptr)
+    {
+        desc.children.emplace_back(_activation_func->describe());
+    }
+    // The slots below VectorSumCol are reserved for the assembly dispatch, it reports them itself
+    for (unsigned int slot = VectorSumCol; slot < Count; ++slot)
+    {
+        desc.workspace_bytes += _aux_mem[slot].size;
+    }
+    return desc;
+}
+
 void CpuGemmLowpMatrixMultiplyCore::update_quantization_parameters(const GEMMLowpOutputStageInfo &output_info,
                                                                    const QuantizationInfo        &a,
                                                                    const QuantizationInfo        &b,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -46,6 +46,7 @@ class CpuGemmLowpMatrixAReductionKernel;
 class CpuGemmLowpMatrixBReductionKernel;
 class CpuGemmTranspose1xWKernel;
 class CpuConvertQuantizedSignednessKernel;
+class CpuUnpackInt4Kernel;
 } // namespace kernels
 class CpuGemmAssemblyDispatch;
 class CpuActivation;
@@ -96,6 +97,13 @@ public:
      * |QASYMM8_SIGNED |QSYMM8             |S32      |S32            |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |F32      |F32            |
      * |QASYMM8_SIGNED |QASYMM8_SIGNED     |F32      |F16            |
+     * |QASYMM8_SIGNED |U8                 |S32      |QASYMM8_SIGNED |
+     * |QASYMM8_SIGNED |U8                 |S32      |S32            |
+     *
+     * @note A U8 @p b holds packed 4-bit weights: two 4-bit two's complement values per byte along its first
+     *       dimension, the even index in the low nibble, whose quantization info describes the unpacked values.
+     *       They are unpacked to QSYMM8_PER_CHANNEL when there is one scale per column, QASYMM8_SIGNED otherwise,
+     *       once if @p b is constant and at every run if it is not. Only the packed tensor has to be stored.
      *
      * @note GEMM_LOWP:  low precision GEMM kernel
      *  This kernel performs the following computations:
@@ -107,7 +115,7 @@ public:
      * @note The @p output type is S32 if @p gemm_info.type == GEMMLowpOutputStageType::NONE. It is QASYMM8/QASYMM8_SIGNED/F32/F16 otherwise
      *
      * @param[in]  a         First input tensor info (Matrix A). Data type supported: QASYMM8/QASYMM8_SIGNED.
-     * @param[in]  b         Second input tensor info (Matrix B). Data type supported: QASYMM8/QASYMM8_SIGNED/QSYMM8/QSYMM8_PER_CHANNEL.
+     * @param[in]  b         Second input tensor info (Matrix B). Data type supported: QASYMM8/QASYMM8_SIGNED/QSYMM8/QSYMM8_PER_CHANNEL/U8.
      * @param[in]  c         Third input tensor info (Matrix C). It can be a nullptr. Data type supported: S32/F32
      * @param[out] dst       Output tensor info. Data type supported: Data type supported: S32/QASYMM8/QASYMM8_SIGNED/F32/F16
      * @param[in]  gemm_info (Optional) Specifies if the matrix A and/or matrix B have been reshaped and
@@ -134,6 +142,7 @@ public:
     void                             run(ITensorPack &tensors) override;
     void                             prepare(ITensorPack &tensors) override;
     experimental::MemoryRequirements workspace() const override;
+    OperatorDescription              describe() const override;
     void                             update_quantization_parameters(const GEMMLowpOutputStageInfo &output_info,
                                                                     const QuantizationInfo        &a,
                                                                     const QuantizationInfo        &b,
@@ -141,16 +150,31 @@ public:
                                                                     const bool                     negated_offsets);
 
 private:
+    /** Run the multiplication once b holds 8-bit values */
+    void run_unpacked(ITensorPack &tensors);
+    /** Prepare the multiplication once b holds 8-bit values */
+    void prepare_unpacked(ITensorPack &tensors);
+    /** Unpack the 4-bit b of @p tensors into @p unpacked_b */
+    void unpack_b(ITensorPack &tensors, ITensor *unpacked_b);
+    /** Turn the column sums of b into the bias of the assembly kernel that adds the a offset contribution
+     *
+     * @param[in, out] vector_sum_col Column sums of b, overwritten with the folded bias
+     * @param[in]      c              Bias to add to a floating-point dst. It can be a nullptr.
+     */
+    void fold_a_offset(ITensor *vector_sum_col, const ITensor *c);
+
     enum AuxTensorIdx
     {
         /* Slots 0 - 2 reserved for CpuGemmAssemblyDispatch */
-        VectorSumCol = 3,
+        AsmPretransposedB = 2, // CpuGemmAssemblyDispatch::Pretranspose
+        VectorSumCol      = 3,
         VectorSumRow,
         TmpA,
         TmpB,
         MMResultS32,
         SignedA,
         SignedOutput,
+        UnpackedB,
         Count
     };
 
@@ -165,6 +189,7 @@ private:
     std::unique_ptr<CpuActivation>                                           _activation_func;
     std::unique_ptr<kernels::CpuConvertQuantizedSignednessKernel>            _convert_to_signed_asymm;
     std::unique_ptr<kernels::CpuConvertQuantizedSignednessKernel>            _convert_from_signed_asymm;
+    std::unique_ptr<kernels::CpuUnpackInt4Kernel>                            _unpack_b_kernel;
 
     TensorInfo _vector_sum_col;
     TensorInfo _vector_sum_row;
@@ -173,8 +198,11 @@ private:
     TensorInfo _mm_result_s32;
     TensorInfo _signed_a;
     TensorInfo _signed_output;
+    TensorInfo _unpacked_b;
+    TensorInfo _folded_bias;
     int32_t    _a_offset;
     int32_t    _b_offset;
+    float      _dequantize_scale;
 
     bool                             _run_vector_matrix_multiplication;
     bool                             _assembly_path;
@@ -184,6 +212,9 @@ private:
     bool                             _fuse_output_stage;
     bool                             _run_activation;
     bool                             _flip_signedness;
+    bool                             _unpack_b;
+    bool                             _keep_unpacked_b;
+    bool                             _fold_a_offset;
     GEMMInfo                         _gemm_info;
     experimental::MemoryRequirements _aux_mem{};
 };
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuGemvBlockSparse.h"
+
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+using namespace arm_compute::experimental;
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+/** Number of chunks of outputs given to each thread, a few so that the scheduler can still even out a slow thread */
+constexpr unsigned int chunks_per_thread = 4;
+
+unsigned int num_chunks(const ITensorInfo &weights)
+{
+    const unsigned int max_chunks = NEScheduler::get().num_threads() * chunks_per_thread;
+    return std::max(1U, std::min<unsigned int>(weights.dimension(0), max_chunks));
+}
+} // namespace
+
+void CpuGemvBlockSparse::configure(const ITensorInfo         *src,
+                                   const ITensorInfo         *weights,
+                                   const ITensorInfo         *biases,
+                                   ITensorInfo               *dst,
+                                   const ActivationLayerInfo &act)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGemvBlockSparse::validate(src, weights, biases, dst, act));
+    ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, act);
+
+    _is_prepared = false;
+
+    _pack_kernel = std::make_unique<kernels::CpuGemvBlockSparsePackKernel>();
+    _pack_kernel->configure(weights, &_values, &_columns, &_offsets, num_chunks(*weights));
+
+    // The packed weights replace the original ones, which can be released once they are packed
+    _aux_mem[PackedValues] =
+        MemoryInfo(offset_int_vec(PackedValues), MemoryLifetime::Persistent, _values.total_size());
+    _aux_mem[PackedColumns] =
+        MemoryInfo(offset_int_vec(PackedColumns), MemoryLifetime::Persistent, _columns.total_size());
+    _aux_mem[PackedOffsets] =
+        MemoryInfo(offset_int_vec(PackedOffsets), MemoryLifetime::Persistent, _offsets.total_size());
+
+    _gemv_kernel = std::make_unique<kernels::CpuGemvBlockSparseKernel>();
+    _gemv_kernel->configure(src, &_values, &_columns, &_offsets, biases, dst);
+
+    if (act.enabled())
+    {
+        _activation = std::make_unique<CpuActivation>();
+        _activation->configure(dst, nullptr, act);
+    }
+}
+
+Status CpuGemvBlockSparse::validate(const ITensorInfo         *src,
+                                    const ITensorInfo         *weights,
+                                    const ITensorInfo         *biases,
+                                    const ITensorInfo         *dst,
+                                    const ActivationLayerInfo &act)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!weights->are_values_constant(),
+                                    "The weights are packed at prepare() so they must be constant");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) != weights->dimension(1),
+                                    "The number of activations does not match the weights");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->dimension(0) != weights->dimension(0),
+                                    "The number of outputs does not match the weights");
+
+    const TensorInfo values  = weights->clone()->set_tensor_shape(compute_block_sparse_rhs_values_shape(*weights));
+    const TensorInfo columns = TensorInfo(compute_block_sparse_rhs_columns_shape(*weights), 1, DataType::U16);
+    const TensorInfo offsets =
+        TensorInfo(compute_block_sparse_rhs_offsets_shape(*weights, num_chunks(*weights)), 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemvBlockSparsePackKernel::validate(weights, &values, &columns, &offsets,
+                                                                                num_chunks(*weights)));
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        kernels::CpuGemvBlockSparseKernel::validate(src, &values, &columns, &offsets, biases, dst));
+
+    if (act.enabled())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuActivation::validate(dst, nullptr, act));
+    }
+
+    return Status{};
+}
+
+void CpuGemvBlockSparse::run(ITensorPack &tensors)
+{
+    prepare(tensors);
+
+    CpuAuxTensorHandler values(offset_int_vec(PackedValues), _values, tensors);
+    CpuAuxTensorHandler columns(offset_int_vec(PackedColumns), _columns, tensors);
+    CpuAuxTensorHandler offsets(offset_int_vec(PackedOffsets), _offsets, tensors);
+
+    ITensor    *dst = tensors.get_tensor(ACL_DST);
+    ITensorPack gemv_pack{{ACL_SRC_0, tensors.get_const_tensor(ACL_SRC_0)},
+                          {ACL_SRC_1, values.get()},
+                          {ACL_SRC_2, columns.get()},
+                          {ACL_SRC_3, offsets.get()},
+                          {ACL_SRC_4, tensors.get_const_tensor(ACL_SRC_2)},
+                          {ACL_DST, dst}};
+    NEScheduler::get().schedule_op(_gemv_kernel.get(), Window::DimX, _gemv_kernel->window(), gemv_pack);
+
+    if (_activation != nullptr)
+    {
+        ITensorPack act_pack{{ACL_SRC, dst}, {ACL_DST, dst}};
+        _activation->run(act_pack);
+    }
+}
+
+void CpuGemvBlockSparse::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        CpuAuxTensorHandler values(offset_int_vec(PackedValues), _values, tensors);
+        CpuAuxTensorHandler columns(offset_int_vec(PackedColumns), _columns, tensors);
+        CpuAuxTensorHandler offsets(offset_int_vec(PackedOffsets), _offsets, tensors);
+
+        ITensorPack pack{{ACL_SRC, tensors.get_const_tensor(ACL_SRC_1)},
+                         {ACL_DST_0, values.get()},
+                         {ACL_DST_1, columns.get()},
+                         {ACL_DST_2, offsets.get()}};
+        NEScheduler::get().schedule_op(_pack_kernel.get(), Window::DimX, _pack_kernel->window(), pack);
+
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuGemvBlockSparse::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
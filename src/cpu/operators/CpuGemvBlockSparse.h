@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUGEMVBLOCKSPARSE_H
+#define ACL_SRC_CPU_OPERATORS_CPUGEMVBLOCKSPARSE_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuGemvBlockSparseKernel.h"
+#include "src/cpu/kernels/CpuGemvBlockSparsePackKernel.h"
+#include "src/cpu/operators/CpuActivation.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to multiply a vector by a pruned matrix stored as 1x4 blocks
+ *
+ * Computes @f[ dst = act(src \cdot weights + bias) @f] for a single row of activations, e.g. a fully connected layer
+ * at batch 1, whose weights are mostly zero without any particular structure. The weights are packed once at
+ * prepare() into their blocks of 4 consecutive values along K holding a non-zero value, then each run only reads and
+ * multiplies these blocks, so a layer pruned to 10% of its weights does about a tenth of the work of a dense GEMV.
+ *
+ * This function runs the following kernels:
+ * -# @ref kernels::CpuGemvBlockSparsePackKernel (called once)
+ * -# @ref kernels::CpuGemvBlockSparseKernel
+ * -# @ref CpuActivation (if the activation is enabled)
+ */
+class CpuGemvBlockSparse : public ICpuOperator
+{
+public:
+    /** Set the input and output tensors.
+     *
+     * Valid data type configurations:
+     * |src0           |src1               |src2   |dst            |
+     * |:--------------|:------------------|:------|:--------------|
+     * |F16            |F16                |F16    |F16            |
+     * |F32            |F32                |F32    |F32            |
+     *
+     * @param[in]  src     Source tensor info with shape [K] or [K, 1]. Data types supported: F16/F32.
+     * @param[in]  weights Weights tensor info with shape [N, K]. Its values must be constant. Data type supported: Same as @p src.
+     * @param[in]  biases  (Optional) Bias tensor info with shape [N]. Can be nullptr. Data type supported: Same as @p src.
+     * @param[out] dst     Destination tensor info with shape [N] or [N, 1]. Data type supported: Same as @p src.
+     * @param[in]  act     (Optional) Activation to apply to the output.
+     */
+    void configure(const ITensorInfo         *src,
+                   const ITensorInfo         *weights,
+                   const ITensorInfo         *biases,
+                   ITensorInfo               *dst,
+                   const ActivationLayerInfo &act = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuGemvBlockSparse::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *src,
+                           const ITensorInfo         *weights,
+                           const ITensorInfo         *biases,
+                           const ITensorInfo         *dst,
+                           const ActivationLayerInfo &act = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        PackedValues = 0,
+        PackedColumns,
+        PackedOffsets,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuGemvBlockSparsePackKernel> _pack_kernel{nullptr};
+    std::unique_ptr<kernels::CpuGemvBlockSparseKernel>     _gemv_kernel{nullptr};
+    std::unique_ptr<CpuActivation>                         _activation{nullptr};
+
+    TensorInfo _values{};
+    TensorInfo _columns{};
+    TensorInfo _offsets{};
+
+    experimental::MemoryRequirements _aux_mem{Count};
+    bool                             _is_prepared{false};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUGEMVBLOCKSPARSE_H
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPULAYERNORM_H
+#define ACL_SRC_CPU_OPERATORS_CPULAYERNORM_H
+
+#include "src/cpu/ICpuOperator.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to run a layer or RMS normalization with fused affine transform and residual addition
+ *
+ * Replaces the chain of @ref CpuMeanStdDevNormalization, multiplication and addition with a single kernel.
+ *
+ * This function runs the following kernels:
+ * -# @ref kernels::CpuLayerNormKernel
+ */
+class CpuLayerNorm : public ICpuOperator
+{
+public:
+    /** Set the input and output tensors.
+     *
+     * @param[in]  src          Source tensor info, normalized along X. Data types supported: F32/F16/BFLOAT16.
+     * @param[in]  residual     (Optional) Tensor info added to @p src before the normalization. Can be nullptr.
+     *                          Data type and shape supported: same as @p src.
+     * @param[in]  gamma        (Optional) Scale tensor info with shape [src.dimension(0)]. Can be nullptr.
+     *                          Data type supported: same as @p src.
+     * @param[in]  beta         (Optional) Offset tensor info with shape [src.dimension(0)]. Can be nullptr.
+     *                          Data type supported: same as @p src.
+     * @param[out] dst          Destination tensor info. Can be @p src or @p residual for in-place computation.
+     *                          Data type and shape supported: same as @p src.
+     * @param[in]  epsilon      Small float added to the variance to avoid a division by zero.
+     * @param[in]  use_rms_norm Normalize by the root mean square instead of the mean and standard deviation.
+     */
+    void configure(const ITensorInfo *src,
+                   const ITensorInfo *residual,
+                   const ITensorInfo *gamma,
+                   const ITensorInfo *beta,
+                   ITensorInfo       *dst,
+                   float              epsilon,
+                   bool               use_rms_norm);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuLayerNorm::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *residual,
+                           const ITensorInfo *gamma,
+                           const ITensorInfo *beta,
+                           const ITensorInfo *dst,
+                           float              epsilon,
+                           bool               use_rms_norm);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPULAYERNORM_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,12 +22,16 @@
  * SOFTWARE.
  */
 
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/operators/CpuMatMul.h"
 
 #include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/function_info/MatMulInfo.h"
 #include "arm_compute/runtime/NEON/functions/NEMatMul.h"
@@ -40,6 +44,8 @@
 #include "src/core/utils/quantization/AsymmHelpers.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
+#include <cstring>
+
 using namespace arm_compute::experimental;
 
 namespace arm_compute
@@ -48,6 +54,62 @@ namespace cpu
 {
 namespace
 {
+/** Check whether the transpose of rhs can be left to the assembly kernels
+ *
+ * The floating-point kernels accepting a transposed B transpose rhs while packing it, instead of a separate transpose
+ * of the whole rhs at every run. The assembly dispatch transposes rhs itself for the kernels that do not.
+ */
+bool transpose_rhs_in_gemm(const ITensorInfo *lhs, const MatMulInfo &info, const CpuMatMulSettings &settings)
+{
+    return info.adj_rhs() && is_data_type_float(lhs->data_type()) && !settings.fixed_format();
+}
+
+/** Epilogue of a MatMul split between the assembly kernels and the elementwise chain kernel */
+struct EpilogueSplit
+{
+    const ITensorInfo   *bias{nullptr};   /**< Row added by the assembly kernels, if any */
+    unsigned int         bias_operand{0}; /**< Index of the bias in the operands of the epilogue */
+    ActivationLayerInfo  act_info{};      /**< Activation applied by the assembly kernels */
+    ElementwiseChainInfo chain{};         /**< Operations left to the elementwise chain kernel */
+    bool                 quantize{false}; /**< Whether the chain quantizes an accumulator into dst */
+};
+
+/** Move the head of an epilogue into the assembly kernels
+ *
+ * They add a bias and apply a ReLU-like activation while writing each tile of the product, so a leading addition of a
+ * single row and a following supported activation cost nothing. The elementwise chain kernel evaluates the rest of the
+ * epilogue in one pass over the product, from an accumulator of the type of @p lhs when @p dst is quantized.
+ */
+EpilogueSplit split_epilogue(const ITensorInfo                      *lhs,
+                             const std::vector<const ITensorInfo *> &operands,
+                             const ITensorInfo                      *dst,
+                             const ElementwiseChainInfo             &epilogue)
+{
+    EpilogueSplit split{};
+    auto          op = epilogue.begin();
+    if (op != epilogue.end() && op->type == ElementwiseChainOpType::ADD && op->operand < operands.size() &&
+        operands[op->operand] != nullptr && operands[op->operand]->tensor_shape().total_size_upper(1) == 1)
+    {
+        split.bias         = operands[op->operand];
+        split.bias_operand = op->operand;
+        ++op;
+    }
+    if (op != epilogue.end() && op->type == ElementwiseChainOpType::ACTIVATION &&
+        CpuGemmAssemblyDispatch::is_activation_supported(op->act_info))
+    {
+        split.act_info = op->act_info;
+        ++op;
+    }
+    split.chain.assign(op, epilogue.end());
+
+    split.quantize = dst->data_type() != lhs->data_type();
+    if (split.quantize && split.chain.empty())
+    {
+        split.chain.emplace_back(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::IDENTITY));
+    }
+    return split;
+}
+
 Status get_gemmlowp_output_stage_info(const ITensorInfo         *src,
                                       const ITensorInfo         *weights,
                                       const ITensorInfo         *dst,
@@ -80,6 +142,157 @@ Status get_gemmlowp_output_stage_info(const ITensorInfo         *src,
 
     return Status{};
 }
+
+/** Initialise the collapsed tensor infos of one block of @p rows rhs rows in incremental mode
+ *
+ * lhs and dst use the [x, y, 1, batches] layout and rhs the [x, y, batches] layout expected by the assembly kernels.
+ */
+void init_incremental_block_infos(const ITensorInfo &lhs,
+                                  const ITensorInfo &rhs,
+                                  const ITensorInfo &dst,
+                                  size_t             rows,
+                                  bool               adj_rhs,
+                                  TensorInfo        &lhs_block,
+                                  TensorInfo        &rhs_block,
+                                  TensorInfo        &dst_block)
+{
+    const size_t batches = lhs.tensor_shape().total_size_upper(2);
+
+    lhs_block = TensorInfo(TensorShape(adj_rhs ? lhs.dimension(0) : rows, lhs.dimension(1), 1, batches), 1,
+                           lhs.data_type());
+    rhs_block = TensorInfo(TensorShape(rhs.dimension(0), rows, batches), 1, rhs.data_type());
+    dst_block = TensorInfo(TensorShape(adj_rhs ? rows : dst.dimension(0), dst.dimension(1), 1, batches), 1,
+                           dst.data_type());
+
+    lhs_block.set_are_values_constant(false);
+    rhs_block.set_are_values_constant(false);
+}
+
+Status validate_incremental(const ITensorInfo         *lhs,
+                            const ITensorInfo         *rhs,
+                            const ITensorInfo         *dst,
+                            const MatMulInfo          &info,
+                            const CpuMatMulSettings   &settings,
+                            const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lhs, 1, DataType::F32, DataType::F16, DataType::BFLOAT16);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.adj_lhs(), "Incremental mode does not support adj_lhs");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(settings.fixed_format(), "Incremental mode does not support fixed format kernels");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(act_info.enabled(), "Incremental mode does not support fused activations");
+
+    const size_t capacity = rhs->dimension(1);
+    const size_t k        = info.adj_rhs() ? rhs->dimension(0) : capacity;
+    const size_t n        = info.adj_rhs() ? capacity : rhs->dimension(0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->dimension(0) != k,
+                                    "The product AB is defined only if the number of columns in A is equal to the "
+                                    "number of rows in B (after transpose)");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->dimension(0) != n || dst->dimension(1) != lhs->dimension(1),
+                                    "Output must be initialised to the shape of the product at full capacity");
+    for (unsigned int i = 2; i < Coordinates::num_max_dimensions; i++)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->dimension(i) != rhs->dimension(i) || lhs->dimension(i) != dst->dimension(i),
+                                        "Broadcasting in Batch dimension is unsupported by this operator.");
+    }
+
+    // Every block shares the same configuration, so validating the smallest one covers them all
+    TensorInfo lhs_block{};
+    TensorInfo rhs_block{};
+    TensorInfo dst_block{};
+    init_incremental_block_infos(*lhs, *rhs, *dst, CpuMatMul::incremental_block_rows, info.adj_rhs(), lhs_block,
+                                 rhs_block, dst_block);
+
+    const ITensorInfo *rhs_to_use = &rhs_block;
+    TensorInfo         rhs_transposed{};
+    if (info.adj_rhs())
+    {
+        auto_init_if_empty(rhs_transposed, rhs_block.clone()->set_tensor_shape(
+                                               misc::shape_calculator::compute_transposed_shape(rhs_block)));
+        ARM_COMPUTE_RETURN_ON_ERROR(cpu::kernels::CpuTransposeKernel::validate(&rhs_block, &rhs_transposed));
+        rhs_to_use = &rhs_transposed;
+    }
+
+    auto gemm_info       = AsmGemmInfo();
+    gemm_info.fast_mode  = settings.fast_math();
+    gemm_info.accumulate = !info.adj_rhs();
+
+    return cpu::CpuGemmAssemblyDispatch::validate(&lhs_block, rhs_to_use, nullptr, &dst_block, gemm_info);
+}
+
+/** Create a view of @p height rows of @p width elements of every batch of @p info, starting at element (@p x, @p y)
+ *
+ * The view uses the collapsed [x, y, 1, batches] layout when @p four_d is true and [x, y, batches] otherwise, and keeps
+ * the strides of @p info so it can address a tensor configured at a larger capacity.
+ */
+TensorInfo make_collapsed_view(const ITensorInfo &info, size_t x, size_t y, size_t width, size_t height, bool four_d)
+{
+    const size_t batches      = info.tensor_shape().total_size_upper(2);
+    Strides      strides      = info.strides_in_bytes();
+    const size_t batch_stride = info.num_dimensions() > 2 ? strides[2] : strides[1] * info.dimension(1);
+    const size_t offset       = info.offset_first_element_in_bytes() + x * strides[0] + y * strides[1];
+
+    strides.set(2, batch_stride);
+    if (four_d)
+    {
+        strides.set(3, batch_stride);
+    }
+
+    const TensorShape shape = four_d ? TensorShape(width, height, 1, batches) : TensorShape(width, height, batches);
+
+    TensorInfo view{};
+    view.init(shape, 1, info.data_type(), strides, offset, info.total_size());
+    return view;
+}
+
+/** Copy a region of @p height rows of @p width elements of every batch from @p src to @p dst
+ *
+ * Both tensors must be in a collapsed layout whose batch stride is at index 2, as produced by @ref make_collapsed_view.
+ */
+void copy_region(const ITensor &src,
+                 size_t         src_x,
+                 size_t         src_y,
+                 ITensor       &dst,
+                 size_t         dst_x,
+                 size_t         dst_y,
+                 size_t         width,
+                 size_t         height,
+                 size_t         batches)
+{
+    const Strides &src_strides = src.info()->strides_in_bytes();
+    const Strides &dst_strides = dst.info()->strides_in_bytes();
+    const size_t   row_bytes   = width * src.info()->element_size();
+
+    const uint8_t *src_ptr =
+        src.buffer() + src.info()->offset_first_element_in_bytes() + src_x * src_strides[0] + src_y * src_strides[1];
+    uint8_t *dst_ptr =
+        dst.buffer() + dst.info()->offset_first_element_in_bytes() + dst_x * dst_strides[0] + dst_y * dst_strides[1];
+
+    for (size_t b = 0; b < batches; ++b)
+    {
+        for (size_t row = 0; row < height; ++row)
+        {
+            std::memcpy(dst_ptr + b * dst_strides[2] + row * dst_strides[1],
+                        src_ptr + b * src_strides[2] + row * src_strides[1], row_bytes);
+        }
+    }
+}
+
+/** Zero every row of every batch of @p dst, which must be in the layout described in @ref copy_region */
+void zero_rows(ITensor &dst)
+{
+    const ITensorInfo &info      = *dst.info();
+    const Strides     &strides   = info.strides_in_bytes();
+    const size_t       batches   = info.tensor_shape().total_size_upper(2);
+    const size_t       row_bytes = info.dimension(0) * info.element_size();
+    uint8_t           *ptr       = dst.buffer() + info.offset_first_element_in_bytes();
+
+    for (size_t b = 0; b < batches; ++b)
+    {
+        for (size_t row = 0; row < info.dimension(1); ++row)
+        {
+            std::memset(ptr + b * strides[2] + row * strides[1], 0, row_bytes);
+        }
+    }
+}
 } // namespace
 
 CpuMatMul::CpuMatMul()
@@ -109,6 +322,11 @@ Status CpuMatMul::validate(const ITensorInfo         *lhs,
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(lhs);
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_BF16_UNSUPPORTED(lhs);
 
+    if (info.incremental())
+    {
+        return validate_incremental(lhs, rhs, dst, info, settings, act_info);
+    }
+
     const auto adj_lhs = info.adj_lhs();
     const auto adj_rhs = info.adj_rhs();
 
@@ -131,11 +349,15 @@ Status CpuMatMul::validate(const ITensorInfo         *lhs,
         // Assign lhs_to_use pointer to use transposed TensorInfo
         lhs_to_use = &lhs_transposed;
     }
+    const bool transpose_rhs = transpose_rhs_in_gemm(lhs, info, settings);
     if (adj_rhs)
     {
         auto_init_if_empty(rhs_transposed,
                            rhs->clone()->set_tensor_shape(misc::shape_calculator::compute_transposed_shape(*rhs)));
-        ARM_COMPUTE_RETURN_ON_ERROR(cpu::kernels::CpuTransposeKernel::validate(rhs_to_use, &rhs_transposed));
+        if (!transpose_rhs)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(cpu::kernels::CpuTransposeKernel::validate(rhs_to_use, &rhs_transposed));
+        }
         // Assign rhs_to_use pointer to use transposed TensorInfo
         rhs_to_use = &rhs_transposed;
     }
@@ -169,8 +391,37 @@ Status CpuMatMul::validate(const ITensorInfo         *lhs,
         gemm_info.weight_format = expected_weight_format;
     }
 
+    // The assembly kernels get rhs as it is when they transpose it
+    gemm_info.transpose_b = transpose_rhs;
     ARM_COMPUTE_RETURN_ON_ERROR(
-        cpu::CpuGemmAssemblyDispatch::validate(lhs_to_use, rhs_to_use, nullptr, dst, gemm_info));
+        cpu::CpuGemmAssemblyDispatch::validate(lhs_to_use, transpose_rhs ? rhs : rhs_to_use, nullptr, dst, gemm_info));
+
+    return Status{};
+}
+
+Status CpuMatMul::validate(const ITensorInfo                      *lhs,
+                           const ITensorInfo                      *rhs,
+                           const std::vector<const ITensorInfo *> &operands,
+                           const ITensorInfo                      *dst,
+                           const MatMulInfo                       &info,
+                           const CpuMatMulSettings                &settings,
+                           const ElementwiseChainInfo             &epilogue)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lhs, rhs, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lhs, 1, DataType::F32, DataType::F16);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.incremental(), "Incremental mode does not support epilogues");
+
+    const EpilogueSplit split = split_epilogue(lhs, operands, dst, epilogue);
+    const TensorInfo    acc(dst->tensor_shape(), 1, lhs->data_type());
+    const ITensorInfo  *gemm_dst = split.quantize ? &acc : dst;
+    ARM_COMPUTE_RETURN_ON_ERROR(CpuMatMul::validate(lhs, rhs, gemm_dst, info, settings, split.act_info));
+
+    // The whole epilogue is checked, the operations applied by the assembly kernels being supported by the chain too
+    const ElementwiseChainInfo &chain = epilogue.empty() ? split.chain : epilogue;
+    if (!chain.empty())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuElementwiseChainKernel::validate(gemm_dst, operands, dst, chain));
+    }
 
     return Status{};
 }
@@ -184,12 +435,72 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, rhs, dst);
     ARM_COMPUTE_LOG_PARAMS(lhs, rhs, dst, info, settings);
-    ARM_COMPUTE_ERROR_THROW_ON(CpuMatMul::validate(lhs, rhs, dst, info, settings));
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(CpuMatMul::validate(lhs, rhs, dst, info, settings, act_info));
+    const TrustedConfigureScope trusted_configure{};
+
+    _adj_lhs     = info.adj_lhs();
+    _adj_rhs     = info.adj_rhs();
+    _fast_math   = settings.fast_math();
+    _incremental = info.incremental();
+
+    _transpose_rhs_in_gemm = !_incremental && transpose_rhs_in_gemm(lhs, info, settings);
+
+    if (_incremental)
+    {
+        _gemm_info.fast_mode = settings.fast_math();
+        configure_incremental(lhs, rhs, dst);
+        return;
+    }
+
+    configure_gemm(lhs, rhs, nullptr, dst, settings, act_info);
+}
+
+void CpuMatMul::configure(ITensorInfo                            *lhs,
+                          ITensorInfo                            *rhs,
+                          const std::vector<const ITensorInfo *> &operands,
+                          ITensorInfo                            *dst,
+                          const MatMulInfo                       &info,
+                          const CpuMatMulSettings                &settings,
+                          const ElementwiseChainInfo             &epilogue)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(lhs, rhs, dst);
+    ARM_COMPUTE_LOG_PARAMS(lhs, rhs, dst, info, settings);
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(CpuMatMul::validate(lhs, rhs, operands, dst, info, settings, epilogue));
+    const TrustedConfigureScope trusted_configure{};
 
-    _adj_lhs   = info.adj_lhs();
-    _adj_rhs   = info.adj_rhs();
-    _fast_math = settings.fast_math();
+    _adj_lhs               = info.adj_lhs();
+    _adj_rhs               = info.adj_rhs();
+    _fast_math             = settings.fast_math();
+    _transpose_rhs_in_gemm = transpose_rhs_in_gemm(lhs, info, settings);
 
+    const EpilogueSplit split = split_epilogue(lhs, operands, dst, epilogue);
+    _epilogue_acc             = split.quantize ? TensorInfo(dst->tensor_shape(), 1, lhs->data_type()) : TensorInfo();
+    _has_asm_bias             = split.bias != nullptr;
+    _asm_bias_operand         = split.bias_operand;
+    _num_epilogue_operands    = operands.size();
+
+    ITensorInfo *gemm_dst = split.quantize ? &_epilogue_acc : dst;
+    configure_gemm(lhs, rhs, split.bias, gemm_dst, settings, split.act_info);
+
+    if (!split.chain.empty())
+    {
+        _epilogue_kernel = std::make_unique<kernels::CpuElementwiseChainKernel>();
+        _epilogue_kernel->configure(gemm_dst, operands, dst, split.chain);
+    }
+    if (split.quantize)
+    {
+        _aux_mem[EpilogueAcc] =
+            MemoryInfo(offset_int_vec(EpilogueAcc), MemoryLifetime::Temporary, _epilogue_acc.total_size());
+    }
+}
+
+void CpuMatMul::configure_gemm(const ITensorInfo         *lhs,
+                               const ITensorInfo         *rhs,
+                               const ITensorInfo         *bias,
+                               const ITensorInfo         *dst,
+                               const CpuMatMulSettings   &settings,
+                               const ActivationLayerInfo &act_info)
+{
     // 1. Create and reshape tensors
     // ------------------------------------------------------
     // a. Clone TensorInfo to prevent changing original tensor values during setup
@@ -223,7 +534,7 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
         _aux_mem[TransposeLHS] = MemoryInfo(offset_int_vec(TransposeLHS), MemoryLifetime::Temporary, lhs->total_size());
     }
 
-    if (_adj_rhs)
+    if (_adj_rhs && !_transpose_rhs_in_gemm)
     {
         // Setup transpose RHS
         _transpose_kernel_rhs = std::make_unique<cpu::kernels::CpuTransposeKernel>();
@@ -240,9 +551,10 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
     _gemm_info.fast_mode       = settings.fast_math();
     _gemm_info.fixed_format    = settings.fixed_format();
     _gemm_info.negated_offsets = false;
+    _gemm_info.transpose_b     = _transpose_rhs_in_gemm;
 
     lhs_to_use = (_adj_lhs) ? _lhs_transposed : lhs_to_use;
-    rhs_to_use = (_adj_rhs) ? _rhs_transposed : rhs_to_use;
+    rhs_to_use = (_adj_rhs && !_transpose_rhs_in_gemm) ? _rhs_transposed : rhs_to_use;
 
     // Quantized-specific configuration
     if (is_data_type_quantized(lhs->data_type()))
@@ -256,7 +568,7 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
         _gemm_info.weight_format                         = WeightFormat::ANY;
         arm_compute::WeightFormat expected_weight_format = WeightFormat::ANY;
         Status ret = cpu::CpuGemmAssemblyDispatch::has_opt_impl(expected_weight_format, &lhs_to_use, &rhs_to_use,
-                                                                nullptr, dst, _gemm_info);
+                                                                bias, dst, _gemm_info);
         ARM_COMPUTE_ERROR_THROW_ON(ret);
 
         // Set gemm weights info to the one returned by has_opt_impl because the user query the kernel for the format to be set.
@@ -267,8 +579,7 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
 
     // Configure Asm Kernel
     _asm_glue = std::make_unique<cpu::CpuGemmAssemblyDispatch>();
-    _asm_glue->configure(&lhs_to_use, &rhs_to_use, nullptr, &dst_to_use,
-                         _gemm_info); // c is nullptr as bias not supported in MatMul
+    _asm_glue->configure(&lhs_to_use, &rhs_to_use, bias, &dst_to_use, _gemm_info);
 
     ARM_COMPUTE_EXIT_ON_MSG(!_asm_glue->is_configured(), "Error in CpuGemmAssemblyDispatch configuration");
     // Specify memory requirements for intermediate tensors
@@ -282,19 +593,217 @@ void CpuMatMul::configure(ITensorInfo               *lhs,
     }
 }
 
+void CpuMatMul::configure_incremental(const ITensorInfo *lhs, const ITensorInfo *rhs, const ITensorInfo *dst)
+{
+    _original_rhs_shape = rhs->tensor_shape();
+    _valid_rhs_rows     = rhs->dimension(1);
+
+    // Without adj_rhs the rhs rows are the accumulation dimension, so every block adds its contribution to dst
+    _gemm_info.accumulate = !_adj_rhs;
+
+    // Blocks of incremental_block_rows * 2^i rows up to the capacity. The smallest block is always created as it also
+    // processes the zero-padded tail.
+    size_t transposed_size = 0;
+    for (size_t rows = incremental_block_rows; rows == incremental_block_rows || rows <= _valid_rhs_rows; rows *= 2)
+    {
+        IncrementalBlock block{};
+        block.rows = rows;
+
+        TensorInfo lhs_block{};
+        TensorInfo rhs_block{};
+        TensorInfo dst_block{};
+        init_incremental_block_infos(*lhs, *rhs, *dst, rows, _adj_rhs, lhs_block, rhs_block, dst_block);
+
+        const ITensorInfo *rhs_to_use = &rhs_block;
+        if (_adj_rhs)
+        {
+            block.transpose_rhs = std::make_unique<cpu::kernels::CpuTransposeKernel>();
+            block.transpose_rhs->configure(&rhs_block, &block.rhs_transposed);
+            rhs_to_use      = &block.rhs_transposed;
+            transposed_size = std::max(transposed_size, block.rhs_transposed.total_size());
+        }
+
+        block.asm_glue = std::make_unique<cpu::CpuGemmAssemblyDispatch>();
+        block.asm_glue->configure(&lhs_block, rhs_to_use, nullptr, &dst_block, _gemm_info);
+        ARM_COMPUTE_EXIT_ON_MSG(!block.asm_glue->is_configured(), "Error in CpuGemmAssemblyDispatch configuration");
+
+        // Blocks run one after the other, so they share the assembly slots sized for the largest requirement
+        int idx = 0;
+        for (const auto &aux : block.asm_glue->workspace())
+        {
+            MemoryInfo &merged = _aux_mem[idx++];
+            if (aux.size > merged.size)
+            {
+                merged.slot     = aux.slot;
+                merged.lifetime = aux.lifetime;
+                merged.size     = aux.size;
+            }
+            merged.alignment = std::max(merged.alignment, aux.alignment);
+        }
+
+        if (rows == incremental_block_rows)
+        {
+            _tail_rhs = rhs_block;
+            _tail_lhs = _adj_rhs ? TensorInfo() : lhs_block;
+            _tail_dst = _adj_rhs ? dst_block : TensorInfo();
+        }
+
+        _incremental_blocks.push_back(std::move(block));
+    }
+
+    if (_adj_rhs)
+    {
+        _rhs_transposed = TensorInfo(TensorShape(transposed_size), 1, DataType::U8);
+        _aux_mem[TransposeRHS] = MemoryInfo(offset_int_vec(TransposeRHS), MemoryLifetime::Temporary, transposed_size);
+    }
+    _aux_mem[IncrementalTailLHS] =
+        MemoryInfo(offset_int_vec(IncrementalTailLHS), MemoryLifetime::Temporary, _tail_lhs.total_size());
+    _aux_mem[IncrementalTailRHS] =
+        MemoryInfo(offset_int_vec(IncrementalTailRHS), MemoryLifetime::Temporary, _tail_rhs.total_size());
+    _aux_mem[IncrementalTailDst] =
+        MemoryInfo(offset_int_vec(IncrementalTailDst), MemoryLifetime::Temporary, _tail_dst.total_size());
+}
+
+void CpuMatMul::set_valid_rhs_rows(size_t rows)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_incremental, "Valid rhs rows can only be set in incremental mode");
+    ARM_COMPUTE_ERROR_ON_MSG(rows > _original_rhs_shape.y(), "Valid rhs rows exceed the configured capacity");
+    _valid_rhs_rows = rows;
+}
+
+void CpuMatMul::run_incremental_block(IncrementalBlock &block,
+                                      ITensorPack      &tensors,
+                                      const ITensor    *lhs,
+                                      const ITensor    *rhs,
+                                      ITensor          *dst,
+                                      ITensor          *rhs_transposed)
+{
+    ITensorPack asm_tensors(tensors);
+    asm_tensors.add_const_tensor(TensorType::ACL_SRC_0, lhs);
+    asm_tensors.add_tensor(TensorType::ACL_DST, dst);
+
+    CpuAuxTensorHandler transposed(block.rhs_transposed, *rhs_transposed, !_adj_rhs);
+    if (_adj_rhs)
+    {
+        ITensorPack rhs_transpose_pack = {{TensorType::ACL_SRC, rhs}, {TensorType::ACL_DST, transposed.get()}};
+        NEScheduler::get().schedule_op(block.transpose_rhs.get(), Window::DimY, block.transpose_rhs->window(),
+                                       rhs_transpose_pack);
+        asm_tensors.add_const_tensor(TensorType::ACL_SRC_1, transposed.get());
+    }
+    else
+    {
+        asm_tensors.add_const_tensor(TensorType::ACL_SRC_1, rhs);
+    }
+
+    block.asm_glue->run(asm_tensors);
+}
+
+void CpuMatMul::run_incremental(ITensorPack &tensors)
+{
+    auto lhs = tensors.get_const_tensor(ACL_SRC_0);
+    auto rhs = tensors.get_const_tensor(ACL_SRC_1);
+    auto dst = tensors.get_tensor(ACL_DST);
+
+    const ITensorInfo &lhs_info  = *lhs->info();
+    const ITensorInfo &rhs_info  = *rhs->info();
+    const ITensorInfo &dst_info  = *dst->info();
+    const size_t       m         = lhs_info.dimension(1);
+    const size_t       batches   = lhs_info.tensor_shape().total_size_upper(2);
+    const size_t       tail_rows = _valid_rhs_rows % incremental_block_rows;
+    const size_t       tail_row  = _valid_rhs_rows - tail_rows;
+
+    CpuAuxTensorHandler rhs_transposed(offset_int_vec(TransposeRHS), _rhs_transposed, tensors, false, !_adj_rhs);
+    CpuAuxTensorHandler tail_lhs(offset_int_vec(IncrementalTailLHS), _tail_lhs, tensors, false, tail_rows == 0);
+    CpuAuxTensorHandler tail_rhs(offset_int_vec(IncrementalTailRHS), _tail_rhs, tensors, false, tail_rows == 0);
+    CpuAuxTensorHandler tail_dst(offset_int_vec(IncrementalTailDst), _tail_dst, tensors, false, tail_rows == 0);
+
+    TensorInfo          lhs_full_info = make_collapsed_view(lhs_info, 0, 0, lhs_info.dimension(0), m, true);
+    TensorInfo          rhs_full_info = make_collapsed_view(rhs_info, 0, 0, rhs_info.dimension(0), rhs_info.dimension(1), false);
+    TensorInfo          dst_full_info = make_collapsed_view(dst_info, 0, 0, dst_info.dimension(0), m, true);
+    CpuAuxTensorHandler lhs_full(lhs_full_info, *lhs);
+    CpuAuxTensorHandler rhs_full(rhs_full_info, *rhs);
+    CpuAuxTensorHandler dst_full(dst_full_info, *dst);
+
+    if (!_adj_rhs)
+    {
+        // Blocks accumulate into dst
+        zero_rows(*dst_full.get());
+    }
+
+    // Process the full blocks, largest first. The capacity is less than twice the largest block, so each block size
+    // is used at most once.
+    size_t row = 0;
+    for (auto block = _incremental_blocks.rbegin(); block != _incremental_blocks.rend(); ++block)
+    {
+        if (tail_row - row < block->rows)
+        {
+            continue;
+        }
+
+        const size_t lhs_x     = _adj_rhs ? 0 : row;
+        const size_t lhs_width = _adj_rhs ? lhs_info.dimension(0) : block->rows;
+        const size_t dst_x     = _adj_rhs ? row : 0;
+        const size_t dst_width = _adj_rhs ? block->rows : dst_info.dimension(0);
+
+        TensorInfo lhs_view_info = make_collapsed_view(lhs_info, lhs_x, 0, lhs_width, m, true);
+        TensorInfo rhs_view_info = make_collapsed_view(rhs_info, 0, row, rhs_info.dimension(0), block->rows, false);
+        TensorInfo dst_view_info = make_collapsed_view(dst_info, dst_x, 0, dst_width, m, true);
+
+        CpuAuxTensorHandler lhs_view(lhs_view_info, *lhs);
+        CpuAuxTensorHandler rhs_view(rhs_view_info, *rhs);
+        CpuAuxTensorHandler dst_view(dst_view_info, *dst);
+
+        run_incremental_block(*block, tensors, lhs_view.get(), rhs_view.get(), dst_view.get(), rhs_transposed.get());
+        row += block->rows;
+    }
+
+    // Process the remaining rows with the smallest block on zero-padded copies, so the rows past the valid ones are
+    // never read from the user tensors
+    if (tail_rows != 0)
+    {
+        IncrementalBlock &block = _incremental_blocks.front();
+
+        std::memset(tail_rhs.get()->buffer(), 0, _tail_rhs.total_size());
+        copy_region(*rhs_full.get(), 0, tail_row, *tail_rhs.get(), 0, 0, rhs_info.dimension(0), tail_rows, batches);
+
+        if (_adj_rhs)
+        {
+            run_incremental_block(block, tensors, lhs_full.get(), tail_rhs.get(), tail_dst.get(), rhs_transposed.get());
+            copy_region(*tail_dst.get(), 0, 0, *dst_full.get(), tail_row, 0, tail_rows, m, batches);
+        }
+        else
+        {
+            std::memset(tail_lhs.get()->buffer(), 0, _tail_lhs.total_size());
+            copy_region(*lhs_full.get(), tail_row, 0, *tail_lhs.get(), 0, 0, tail_rows, m, batches);
+            run_incremental_block(block, tensors, tail_lhs.get(), tail_rhs.get(), dst_full.get(), rhs_transposed.get());
+        }
+    }
+}
+
 void CpuMatMul::run(ITensorPack &tensors)
 {
+    if (_incremental)
+    {
+        run_incremental(tensors);
+        return;
+    }
+
     // Retrieve tensors from tensor pack
     auto lhs = tensors.get_tensor(ACL_SRC_0);
     auto rhs = tensors.get_const_tensor(ACL_SRC_1);
     auto dst = tensors.get_tensor(ACL_DST);
 
+    // A quantized epilogue reads the product from an accumulator, the others apply to it in place in dst
+    const bool          use_acc = _epilogue_acc.total_size() != 0;
+    CpuAuxTensorHandler epilogue_acc(offset_int_vec(EpilogueAcc), _epilogue_acc, tensors, false, !use_acc, !use_acc);
+    ITensor            *gemm_dst = use_acc ? epilogue_acc.get() : dst;
+
     // Reshape LHS and DST to ensure compatibility with GEMM asm kernel (Batch dimensions is 4th for lhs and dst within asm)
     // Collapse RHS (necessary to support dimensions larger than 3 in gemm assembly)
     lhs->info()->set_tensor_shape(
         TensorShape(_original_lhs_shape.x(), _original_lhs_shape.y(), 1,
                     _original_lhs_shape.collapsed_from(2).z())); // Collapsed 3+ dimensions into z
-    dst->info()->set_tensor_shape(
+    gemm_dst->info()->set_tensor_shape(
         TensorShape(_original_dst_shape.x(), _original_dst_shape.y(), 1,
                     _original_dst_shape.collapsed_from(2).z())); // Collapsed 3+ dimensions into z
     rhs->info()->set_tensor_shape(_original_rhs_shape.collapsed_from(2));
@@ -305,6 +814,12 @@ void CpuMatMul::run(ITensorPack &tensors)
 
     // Create tensor pack for asm kernel
     ITensorPack asm_tensors(tensors);
+    asm_tensors.add_tensor(TensorType::ACL_DST, gemm_dst);
+    if (_has_asm_bias)
+    {
+        const auto bias = static_cast<TensorType>(TensorType::ACL_SRC_VEC + _asm_bias_operand);
+        asm_tensors.add_const_tensor(TensorType::ACL_SRC_2, tensors.get_const_tensor(bias));
+    }
 
     // Run transpose lhs if necessary
     if (_adj_lhs)
@@ -314,8 +829,8 @@ void CpuMatMul::run(ITensorPack &tensors)
                                        lhs_transpose_pack);
         asm_tensors.add_const_tensor(TensorType::ACL_SRC_0, lhs_transposed.get());
     }
-    // Run transpose rhs if necessary
-    if (_adj_rhs)
+    // Run transpose rhs if necessary, the assembly kernels otherwise transpose it themselves
+    if (_adj_rhs && !_transpose_rhs_in_gemm)
     {
         ITensorPack rhs_transpose_pack = {{TensorType::ACL_SRC, rhs}, {TensorType::ACL_DST, rhs_transposed.get()}};
         NEScheduler::get().schedule_op(_transpose_kernel_rhs.get(), Window::DimY, _transpose_kernel_rhs->window(),
@@ -326,14 +841,57 @@ void CpuMatMul::run(ITensorPack &tensors)
     _asm_glue->run(asm_tensors);
 
     // Undo reshape of tensors
-    dst->info()->set_tensor_shape(_original_dst_shape);
+    gemm_dst->info()->set_tensor_shape(_original_dst_shape);
     lhs->info()->set_tensor_shape(_original_lhs_shape);
     rhs->info()->set_tensor_shape(_original_rhs_shape);
+
+    if (_epilogue_kernel != nullptr)
+    {
+        ITensorPack epilogue_pack = {{TensorType::ACL_SRC_0, gemm_dst}, {TensorType::ACL_DST, dst}};
+        for (size_t i = 0; i < _num_epilogue_operands; ++i)
+        {
+            const auto operand = static_cast<TensorType>(TensorType::ACL_SRC_VEC + i);
+            epilogue_pack.add_const_tensor(operand, tensors.get_const_tensor(operand));
+        }
+        NEScheduler::get().schedule_op(_epilogue_kernel.get(), _epilogue_kernel->get_split_dimension(),
+                                       _epilogue_kernel->window(), epilogue_pack);
+    }
 }
 
 experimental::MemoryRequirements CpuMatMul::workspace() const
 {
     return _aux_mem;
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_matmul(const AclTensorDescriptor &lhs,
+                                                              const AclTensorDescriptor &rhs,
+                                                              const AclTensorDescriptor &dst,
+                                                              const AclMatMulDescriptor &matmul,
+                                                              bool                       is_validate)
+{
+    TensorInfo lhs_info = detail::convert_to_legacy_tensor_info(lhs);
+    TensorInfo rhs_info = detail::convert_to_legacy_tensor_info(rhs);
+    TensorInfo dst_info = detail::convert_to_legacy_tensor_info(dst);
+    lhs_info.set_is_resizable(false);
+    rhs_info.set_is_resizable(false);
+    dst_info.set_is_resizable(false);
+    const MatMulInfo          info = MatMulInfo().adj_lhs(matmul.adj_lhs).adj_rhs(matmul.adj_rhs);
+    const CpuMatMulSettings   settings{};
+    const ActivationLayerInfo act = detail::convert_to_activation_info(matmul.act);
+
+    if (!bool(CpuMatMul::validate(&lhs_info, &rhs_info, &dst_info, info, settings, act)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto matmul_op = std::make_unique<cpu::CpuMatMul>();
+    matmul_op->configure(&lhs_info, &rhs_info, &dst_info, info, settings, act);
+
+    return detail::make_operator(static_cast<IContext *>(this), std::move(matmul_op));
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,12 +25,16 @@
 #define ACL_SRC_CPU_OPERATORS_CPUMATMUL_H
 
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
 
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuElementwiseChainKernel.h"
 #include "src/cpu/kernels/CpuTransposeKernel.h"
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 // Forward Declarations
@@ -45,6 +49,14 @@ namespace cpu
  *  -# @ref cpu::kernels::CpuTransposeKernel
  * Then :
  *  -# @ref cpu::CpuGemmAssemblyDispatch
+ *
+ * If an epilogue is given that the assembly kernels cannot apply on their own :
+ *  -# @ref cpu::kernels::CpuElementwiseChainKernel
+ *
+ * In incremental mode (see @ref MatMulInfo::incremental) the rhs is configured at its capacity and only its first
+ * valid rows are used. The valid rows are processed in blocks whose sizes are powers of two times
+ * @ref incremental_block_rows, each with its own pre-configured assembly GEMM, so a change in the number of valid rows
+ * never requires a reconfiguration. The last partial block goes through zero-padded auxiliary tensors.
  */
 class CpuMatMul : public ICpuOperator
 {
@@ -85,6 +97,59 @@ public:
                            const MatMulInfo          &info,
                            const CpuMatMulSettings   &settings,
                            const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Configure operator with an epilogue applied to the product before it is stored
+     *
+     * The epilogue is an elementwise chain whose input is the product, e.g. a bias, a GELU or SiLU, the gate of a
+     * gated feed-forward layer and a residual connection. A leading addition of a single row, i.e. a bias, and a
+     * following activation supported by the assembly kernels are applied by them while writing the product. The rest
+     * is evaluated in a single pass over the product, in place in @p dst unless @p dst is quantized.
+     *
+     * The operands are expected at ACL_SRC_VEC + i of the packs.
+     *
+     * @param[in]  lhs      Left-hand side tensor info. Data types supported: F16/F32.
+     * @param[in]  rhs      Right-hand side tensor info. Data types supported: same as @p lhs.
+     * @param[in]  operands Operand tensor infos of the binary operations of @p epilogue, with the shape of @p dst or
+     *                      holding a single row of it. Data types supported: same as @p lhs.
+     * @param[out] dst      Output tensor info. Data types supported: same as @p lhs, or QASYMM8/QASYMM8_SIGNED if
+     *                      @p lhs is F32 to quantize the result of the epilogue.
+     * @param[in]  info     Contains MatMul operation information described in @ref MatMulInfo. Must not be incremental.
+     * @param[in]  settings The settings for matmul operation (i.e fast math)
+     * @param[in]  epilogue Operations applied to the product, in order, as supported by
+     *                      @ref cpu::kernels::CpuElementwiseChainKernel. Can be empty to only quantize the product.
+     */
+    void configure(ITensorInfo                            *lhs,
+                   ITensorInfo                            *rhs,
+                   const std::vector<const ITensorInfo *> &operands,
+                   ITensorInfo                            *dst,
+                   const MatMulInfo                       &info,
+                   const CpuMatMulSettings                &settings,
+                   const ElementwiseChainInfo             &epilogue);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuMatMul::configure() with an epilogue
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                      *lhs,
+                           const ITensorInfo                      *rhs,
+                           const std::vector<const ITensorInfo *> &operands,
+                           const ITensorInfo                      *dst,
+                           const MatMulInfo                       &info,
+                           const CpuMatMulSettings                &settings,
+                           const ElementwiseChainInfo             &epilogue);
+
+    /** Set the number of rhs rows used by the following runs in incremental mode
+     *
+     * The rows are those of the rhs tensor as passed to configure(), i.e. before any adjoint: the accumulation
+     * dimension K when adj_rhs is false and the output columns N when adj_rhs is true. With adj_rhs set, the output
+     * columns past @p rows are left unchanged.
+     *
+     * @param[in] rows Number of valid rhs rows. Must not exceed the number of rows the operator was configured with.
+     */
+    void set_valid_rhs_rows(size_t rows);
+
+    /** Number of rhs rows of the smallest block processed in incremental mode */
+    static constexpr size_t incremental_block_rows = 64;
 
     // Inherited methods overridden:
     void                             run(ITensorPack &tensors) override;
@@ -96,17 +161,48 @@ private:
         /* Slots 0 - 2 reserved for CpuGemmAssemblyDispatch */
         TransposeLHS = 3,
         TransposeRHS,
+        IncrementalTailLHS,
+        IncrementalTailRHS,
+        IncrementalTailDst,
+        EpilogueAcc,
         Count
     };
 
+    /** A block of rhs rows processed by one pre-configured assembly GEMM in incremental mode */
+    struct IncrementalBlock
+    {
+        size_t                                       rows{0};
+        std::unique_ptr<kernels::CpuTransposeKernel> transpose_rhs{nullptr};
+        std::unique_ptr<CpuGemmAssemblyDispatch>     asm_glue{nullptr};
+        TensorInfo                                   rhs_transposed{};
+    };
+
+    void configure_gemm(const ITensorInfo         *lhs,
+                        const ITensorInfo         *rhs,
+                        const ITensorInfo         *bias,
+                        const ITensorInfo         *dst,
+                        const CpuMatMulSettings   &settings,
+                        const ActivationLayerInfo &act_info);
+    void configure_incremental(const ITensorInfo *lhs, const ITensorInfo *rhs, const ITensorInfo *dst);
+    void run_incremental(ITensorPack &tensors);
+    void run_incremental_block(IncrementalBlock &block,
+                               ITensorPack            &tensors,
+                               const ITensor          *lhs,
+                               const ITensor          *rhs,
+                               ITensor                *dst,
+                               ITensor                *rhs_transposed);
+
     // Define unique pointers to kernels/operators used by matmul
     std::unique_ptr<kernels::CpuTransposeKernel> _transpose_kernel_lhs{nullptr};
     std::unique_ptr<kernels::CpuTransposeKernel> _transpose_kernel_rhs{nullptr};
     std::unique_ptr<CpuGemmAssemblyDispatch>     _asm_glue{nullptr};
 
+    std::unique_ptr<kernels::CpuElementwiseChainKernel> _epilogue_kernel{nullptr};
+
     // TensorInfo for tensors stored in auxillary memory
     TensorInfo _lhs_transposed{};
     TensorInfo _rhs_transposed{};
+    TensorInfo _epilogue_acc{};
 
     // Original tensor shapes prior to reshaping tensors and collapsing dimensions
     TensorShape _original_lhs_shape{};
@@ -116,7 +212,17 @@ private:
     // Note : adj_lhs means the same as transposing lhs
     bool                             _adj_lhs{false};
     bool                             _adj_rhs{false};
+    bool                             _transpose_rhs_in_gemm{false};
     bool                             _fast_math{false};
+    bool                             _incremental{false};
+    bool                             _has_asm_bias{false};
+    unsigned int                     _asm_bias_operand{0};
+    size_t                           _num_epilogue_operands{0};
+    size_t                           _valid_rhs_rows{0};
+    std::vector<IncrementalBlock>    _incremental_blocks{};
+    TensorInfo                       _tail_lhs{};
+    TensorInfo                       _tail_rhs{};
+    TensorInfo                       _tail_dst{};
     AsmGemmInfo                      _gemm_info{};
     experimental::MemoryRequirements _aux_mem{Count};
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,8 @@
 #include "arm_compute/core/CoreTypes.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Scheduler.h"
 
 #include "src/common/utils/Log.h"
 #include "src/cpu/kernels/CpuCopyKernel.h"
@@ -80,7 +82,8 @@ void CpuPermute::configure(const ITensorInfo *src, ITensorInfo *dst, const Permu
     {
         auto k = std::make_unique<kernels::CpuCopyKernel>();
         k->configure(src, dst);
-        _kernel = std::move(k);
+        _split_dimension = k->get_split_dimension_hint();
+        _kernel          = std::move(k);
     }
     else if (prefer_transpose(perm))
     {
@@ -110,5 +113,12 @@ Status CpuPermute::validate(const ITensorInfo *src, const ITensorInfo *dst, cons
 
     return kernels::CpuPermuteKernel::validate(src, dst, perm);
 }
+
+void CpuPermute::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+    ScopedScheduler scope(_ctx != nullptr ? _ctx->scheduler() : nullptr);
+    NEScheduler::get().schedule_op(_kernel.get(), _split_dimension, _kernel->window(), tensors);
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,8 @@
 #ifndef ARM_COMPUTE_CPU_PERMUTE_H
 #define ARM_COMPUTE_CPU_PERMUTE_H
 
+#include "arm_compute/core/Window.h"
+
 #include "src/cpu/ICpuOperator.h"
 
 namespace arm_compute
@@ -36,7 +38,7 @@ class CpuPermute : public ICpuOperator
 public:
     /** Configure operator for a given list of arguments
      *
-     * @note Arbitrary permutation vectors are supported with rank not greater than 4
+     * @note Arbitrary permutation vectors are supported with rank not greater than 6
      *
      * @param[in]  src  Source tensor to permute. Data types supported: All
      * @param[out] dst  Destintation tensor. Data types supported: Same as @p src
@@ -50,6 +52,12 @@ public:
      * @return a status
      */
     static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const PermutationVector &perm);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+
+private:
+    size_t _split_dimension{Window::DimY};
 };
 } // namespace cpu
 } // namespace arm_compute
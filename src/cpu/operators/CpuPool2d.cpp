@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023 Arm Limited.
+ * Copyright (c) 2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,9 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/operators/CpuPool2d.h"
 
 #include "arm_compute/core/ITensor.h"
@@ -141,5 +144,38 @@ experimental::MemoryRequirements CpuPool2d::workspace() const
 {
     return _aux_mem;
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_pool2d(const AclTensorDescriptor &src,
+                                                              const AclTensorDescriptor &dst,
+                                                              const AclPool2dDescriptor &pool,
+                                                              bool                       is_validate)
+{
+    const bool is_valid_window = pool.is_global || detail::is_valid_pad_stride(pool.pad_stride);
+    if (pool.type == AclPoolingType::AclPoolingTypeNone || !is_valid_window)
+    {
+        return std::make_tuple(nullptr, StatusCode::InvalidArgument);
+    }
+
+    const DataLayout       layout    = detail::convert_to_legacy_data_layout(pool.data_layout);
+    TensorInfo             src_info  = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo             dst_info  = detail::convert_to_legacy_tensor_info(dst);
+    const PoolingLayerInfo pool_info = detail::convert_to_pooling_info(pool);
+    src_info.set_data_layout(layout).set_is_resizable(false);
+    dst_info.set_data_layout(layout).set_is_resizable(false);
+
+    if (!bool(CpuPool2d::validate(&src_info, &dst_info, pool_info)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto pool_op = std::make_unique<cpu::CpuPool2d>();
+    pool_op->configure(&src_info, &dst_info, pool_info);
+
+    return detail::make_operator(static_cast<IContext *>(this), std::move(pool_op));
+}
 } // namespace cpu
 } // namespace arm_compute
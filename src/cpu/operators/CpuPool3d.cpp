@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -61,7 +61,8 @@ void CpuPool3d::run(ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No tensors provided");
 
-    Scheduler::get().schedule_op(_kernel.get(), Window::DimY, _kernel->window(), tensors);
+    const auto split_dimension = static_cast<kernels::CpuPool3dKernel *>(_kernel.get())->get_split_dimension();
+    Scheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
 }
 
 experimental::MemoryRequirements CpuPool3d::workspace() const
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024 Arm Limited.
+ * Copyright (c) 2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,9 @@
  * SOFTWARE.
  */
 
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/operators/CpuQuantize.h"
 
 #include "arm_compute/core/Types.h"
@@ -58,5 +61,30 @@ void CpuQuantize::run(ITensorPack &tensors)
     auto split_dimension = static_cast<kernels::CpuQuantizeKernel *>(_kernel.get())->get_split_dimension_hint();
     NEScheduler::get().schedule_op(_kernel.get(), split_dimension, _kernel->window(), tensors);
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_quantize(const AclTensorDescriptor       &src,
+                                                                const AclTensorDescriptor       &dst,
+                                                                const AclQuantizationDescriptor &qinfo,
+                                                                bool                             is_validate)
+{
+    TensorInfo src_info = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo dst_info = detail::convert_to_legacy_tensor_info(dst, qinfo);
+    src_info.set_is_resizable(false);
+    dst_info.set_is_resizable(false);
+
+    if (!bool(CpuQuantize::validate(&src_info, &dst_info)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto quantize_op = std::make_unique<cpu::CpuQuantize>();
+    quantize_op->configure(&src_info, &dst_info);
+
+    return detail::make_operator(static_cast<IContext *>(this), std::move(quantize_op));
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPURESIZENORMALIZE_H
+#define ACL_SRC_CPU_OPERATORS_CPURESIZENORMALIZE_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/cpu/ICpuOperator.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to resize, normalize and quantize images in a single pass
+ *
+ * Replaces a @ref CpuScale followed by a normalization and a quantization with a single kernel.
+ *
+ * This function runs the following kernels:
+ * -# @ref kernels::CpuResizeNormalizeKernel
+ */
+class CpuResizeNormalize : public ICpuOperator
+{
+public:
+    /** Set the source and destination tensors.
+     *
+     * @param[in]  src     Source image info with NHWC layout. Data types supported: U8/F32.
+     * @param[out] dst     Destination tensor info with NHWC layout, the same number of channels and batches as
+     *                     @p src and the resized width and height. Data types supported: F32/QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  mean    Mean of each channel, or a single mean for all the channels.
+     * @param[in]  std_dev Standard deviation of each channel, or a single one for all the channels. Must not be 0.
+     */
+    void configure(const ITensorInfo        *src,
+                   ITensorInfo              *dst,
+                   const std::vector<float> &mean,
+                   const std::vector<float> &std_dev);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuResizeNormalize::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo        *src,
+                           const ITensorInfo        *dst,
+                           const std::vector<float> &mean,
+                           const std::vector<float> &std_dev);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPURESIZENORMALIZE_H
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuScaledDotProductAttention.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/kernels/CpuScaledDotProductAttentionKernel.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+namespace cpu
+{
+CpuScaledDotProductAttention::CpuScaledDotProductAttention()
+    : _kernel(), _accumulators(), _aux_mem(InternalTensorIdx::COUNT)
+{
+}
+
+void CpuScaledDotProductAttention::configure(const ITensorInfo *q,
+                                             const ITensorInfo *k,
+                                             const ITensorInfo *v,
+                                             ITensorInfo       *dst,
+                                             float              scale,
+                                             bool               is_causal)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(q, k, v, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuScaledDotProductAttention::validate(q, k, v, dst, scale, is_causal));
+    ARM_COMPUTE_LOG_PARAMS(q, k, v, dst, scale, is_causal);
+
+    _accumulators = TensorInfo();
+
+    auto kernel = std::make_unique<kernels::CpuScaledDotProductAttentionKernel>();
+    kernel->configure(q, k, v, dst, &_accumulators, scale, is_causal);
+    _kernel = std::move(kernel);
+
+    _aux_mem[InternalTensorIdx::ACCUMULATORS] = MemoryInfo(offset_int_vec(InternalTensorIdx::ACCUMULATORS),
+                                                           MemoryLifetime::Temporary, _accumulators.total_size());
+
+    // Split the query rows among the threads unless there are more heads to go around, e.g. when decoding
+    const size_t row_blocks = (dst->dimension(1) + 3) / 4;
+    _split_dimension        = (row_blocks >= dst->dimension(2)) ? Window::DimY : Window::DimZ;
+}
+
+Status CpuScaledDotProductAttention::validate(const ITensorInfo *q,
+                                              const ITensorInfo *k,
+                                              const ITensorInfo *v,
+                                              const ITensorInfo *dst,
+                                              float              scale,
+                                              bool               is_causal)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(q, k, v, dst);
+
+    const TensorInfo accumulators;
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        kernels::CpuScaledDotProductAttentionKernel::validate(q, k, v, dst, &accumulators, scale, is_causal));
+
+    return Status{};
+}
+
+void CpuScaledDotProductAttention::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    CpuAuxTensorHandler accumulators(offset_int_vec(InternalTensorIdx::ACCUMULATORS), _accumulators, tensors, true);
+
+    ITensorPack pack = {{TensorType::ACL_SRC_0, tensors.get_const_tensor(TensorType::ACL_SRC_0)},
+                        {TensorType::ACL_SRC_1, tensors.get_const_tensor(TensorType::ACL_SRC_1)},
+                        {TensorType::ACL_SRC_2, tensors.get_const_tensor(TensorType::ACL_SRC_2)},
+                        {TensorType::ACL_DST_0, tensors.get_tensor(TensorType::ACL_DST)},
+                        {TensorType::ACL_DST_1, accumulators.get()}};
+
+    NEScheduler::get().schedule_op(_kernel.get(), _split_dimension, _kernel->window(), pack);
+}
+
+experimental::MemoryRequirements CpuScaledDotProductAttention::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
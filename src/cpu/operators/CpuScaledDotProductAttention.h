@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUSCALEDDOTPRODUCTATTENTION_H
+#define ACL_SRC_CPU_OPERATORS_CPUSCALEDDOTPRODUCTATTENTION_H
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/cpu/ICpuKernel.h"
+#include "src/cpu/ICpuOperator.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to compute a fused scaled dot product attention
+ *
+ * Computes, for every head:
+ * @f[ dst = softmax(scale * Q K^T) V @f]
+ *
+ * Unlike a MatMul -> Mul -> Softmax -> MatMul chain, the Sq x Skv scores are never written to memory: the keys are
+ * visited in blocks and the softmax is computed online (flash-attention style), so the traffic no longer grows with
+ * the square of the sequence length.
+ *
+ * This function runs the following kernels:
+ * -# @ref kernels::CpuScaledDotProductAttentionKernel
+ */
+class CpuScaledDotProductAttention : public ICpuOperator
+{
+public:
+    CpuScaledDotProductAttention();
+    /** Set the input and output tensors.
+     *
+     * @param[in]  q         Queries tensor info with shape [D, Sq, H, B]. Data types supported: F32/F16/BFLOAT16.
+     * @param[in]  k         Keys tensor info with shape [D, Skv, H, B]. Data type supported: same as @p q.
+     * @param[in]  v         Values tensor info with shape [Dv, Skv, H, B]. Data type supported: same as @p q.
+     * @param[out] dst       Destination tensor info with shape [Dv, Sq, H, B]. Data type supported: same as @p q.
+     * @param[in]  scale     Scale applied to the scores before the softmax, usually 1 / sqrt(D).
+     * @param[in]  is_causal (Optional) Whether query i only attends to the keys up to i + Skv - Sq. Defaults to false.
+     */
+    void configure(const ITensorInfo *q,
+                   const ITensorInfo *k,
+                   const ITensorInfo *v,
+                   ITensorInfo       *dst,
+                   float              scale,
+                   bool               is_causal = false);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuScaledDotProductAttention::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *q,
+                           const ITensorInfo *k,
+                           const ITensorInfo *v,
+                           const ITensorInfo *dst,
+                           float              scale,
+                           bool               is_causal = false);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum InternalTensorIdx
+    {
+        ACCUMULATORS = 0,
+        COUNT
+    };
+
+    std::unique_ptr<ICPPKernel>      _kernel;
+    TensorInfo                       _accumulators;
+    experimental::MemoryRequirements _aux_mem{};
+    size_t                           _split_dimension{Window::DimY};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUSCALEDDOTPRODUCTATTENTION_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,9 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/operators/CpuSoftmax.h"
 
 #include "arm_compute/core/Helpers.h"
@@ -32,6 +35,7 @@
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/helpers/SoftmaxHelpers.h"
+#include "src/core/helpers/Utils.h"
 #include "src/cpu/kernels/CpuSoftmaxKernel.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
@@ -55,7 +59,9 @@ void CpuSoftmaxGeneric::configure(const ITensorInfo *src, ITensorInfo *dst, floa
     const unsigned int actual_axis =
         static_cast<unsigned int>(wrap_around(axis, static_cast<int32_t>(src->num_dimensions())));
 
-    _axis = actual_axis;
+    _axis             = actual_axis;
+    _has_shape_bounds = has_shape_bounds(*src);
+    _src_bounds       = TensorInfo(*src);
 
     const ITensorInfo *tmp_input = src;
 
@@ -94,6 +100,8 @@ CpuSoftmaxGeneric::validate(const ITensorInfo *src, const ITensorInfo *dst, floa
     ARM_COMPUTE_UNUSED(beta);
     ARM_COMPUTE_RETURN_ERROR_ON(axis < static_cast<int32_t>(-src->num_dimensions()) ||
                                 static_cast<int32_t>(src->num_dimensions()) <= axis);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->is_dynamic() && !has_shape_bounds(*src),
+                                    "Dynamic shapes must declare their bounds");
 
     // Create intermediate tensor info
     TensorInfo tensor_info_tmp;
@@ -124,13 +132,23 @@ void CpuSoftmaxGeneric::run(ITensorPack &tensors)
 
     softmax_pack = {{TensorType::ACL_SRC_0, src}, {TensorType::ACL_DST_0, dst}, {TensorType::ACL_DST_1, tmp.get()}};
 
+    // Within the declared bounds only the window depends on the shape, the kernel and workspace are kept as is
+    Window window = _softmax_kernel->window();
+    if (_has_shape_bounds && src->info()->tensor_shape() != _src_bounds.tensor_shape())
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(!is_within_shape_bounds(src->info()->tensor_shape(), _src_bounds),
+                                 "Source shape is outside of the configured bounds");
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(src->info(), dst->info());
+        window = kernels::CpuSoftmaxKernel::calculate_window(*dst->info(), _axis);
+    }
+
     if (_axis == 0)
     {
-        NEScheduler::get().schedule_op(_softmax_kernel.get(), Window::DimY, _softmax_kernel->window(), softmax_pack);
+        NEScheduler::get().schedule_op(_softmax_kernel.get(), Window::DimY, window, softmax_pack);
     }
     else
     {
-        NEScheduler::get().schedule_op(_softmax_kernel.get(), Window::DimX, _softmax_kernel->window(), softmax_pack);
+        NEScheduler::get().schedule_op(_softmax_kernel.get(), Window::DimX, window, softmax_pack);
     }
 }
 
@@ -139,5 +157,29 @@ experimental::MemoryRequirements CpuSoftmaxGeneric::workspace() const
     return _aux_mem;
 }
 
+std::tuple<IOperator *, StatusCode> CpuContext::create_softmax(const AclTensorDescriptor  &src,
+                                                               const AclTensorDescriptor  &dst,
+                                                               const AclSoftmaxDescriptor &softmax,
+                                                               bool                        is_validate)
+{
+    TensorInfo src_info = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo dst_info = detail::convert_to_legacy_tensor_info(dst);
+    src_info.set_is_resizable(false);
+    dst_info.set_is_resizable(false);
+
+    if (!bool(CpuSoftmaxGeneric::validate(&src_info, &dst_info, softmax.beta, softmax.axis, softmax.is_log)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto softmax_op = std::make_unique<cpu::CpuSoftmaxGeneric>();
+    softmax_op->configure(&src_info, &dst_info, softmax.beta, softmax.axis, softmax.is_log);
+
+    return detail::make_operator(static_cast<IContext *>(this), std::move(softmax_op));
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -65,6 +65,10 @@ public:
      * @param[in]     axis   (Optional) The dimension in which to apply the function. E.g. for input of shape 4x5x6 and
      *                       axis=1, softmax will be applied to 4x6=24 vectors of size 5. Defaults to 0
      * @param[in]     is_log True if the operation is log-softmax
+     *
+     * @note @p src can declare shape bounds, see @ref has_shape_bounds(): its shape is then the largest one accepted,
+     *       the workspace is sized for it, and @ref CpuSoftmaxGeneric::run() accepts any shape whose dynamic
+     *       dimensions are at most the configured ones without configuring or selecting kernels again.
      */
     void configure(const ITensorInfo *src, ITensorInfo *dst, float beta = 1.0f, int32_t axis = 0, bool is_log = false);
     /** Static function to check if given info will lead to a valid configuration
@@ -96,6 +100,9 @@ private:
     experimental::MemoryRequirements _aux_mem{};
 
     unsigned int _axis = 0;
+
+    bool       _has_shape_bounds{false};
+    TensorInfo _src_bounds{};
 };
 
 } // namespace cpu
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuWeightOnlyQuantizedGemm.h"
+
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuWeightOnlyQuantizedGemmKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuWeightOnlyQuantizedGemm::configure(const ITensorInfo *src,
+                                           const ITensorInfo *weights,
+                                           const ITensorInfo *scales,
+                                           const ITensorInfo *bias,
+                                           ITensorInfo       *dst,
+                                           unsigned int       group_size)
+{
+    ARM_COMPUTE_LOG_PARAMS(src, weights, scales, bias, dst, group_size);
+
+    auto k = std::make_unique<kernels::CpuWeightOnlyQuantizedGemmKernel>();
+    k->configure(src, weights, scales, bias, dst, group_size);
+    _kernel = std::move(k);
+
+    // Split the outputs among the threads, each one then streams its own part of the weights. Only split the rows when
+    // there are too few outputs to go around.
+    const size_t output_blocks = (dst->dimension(0) + 3) / 4;
+    const size_t rows          = dst->tensor_shape().total_size_upper(1);
+    _split_dimension = (output_blocks >= NEScheduler::get().num_threads() || output_blocks >= rows) ? Window::DimX
+                                                                                                  : Window::DimY;
+}
+
+Status CpuWeightOnlyQuantizedGemm::validate(const ITensorInfo *src,
+                                            const ITensorInfo *weights,
+                                            const ITensorInfo *scales,
+                                            const ITensorInfo *bias,
+                                            const ITensorInfo *dst,
+                                            unsigned int       group_size)
+{
+    return kernels::CpuWeightOnlyQuantizedGemmKernel::validate(src, weights, scales, bias, dst, group_size);
+}
+
+void CpuWeightOnlyQuantizedGemm::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+    NEScheduler::get().schedule_op(_kernel.get(), _split_dimension, _kernel->window(), tensors);
+}
+} // namespace cpu
+} // namespace arm_compute
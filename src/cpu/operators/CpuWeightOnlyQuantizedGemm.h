@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUWEIGHTONLYQUANTIZEDGEMM_H
+#define ACL_SRC_CPU_OPERATORS_CPUWEIGHTONLYQUANTIZEDGEMM_H
+
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/ICpuOperator.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to compute a GEMM with weight-only quantized weights
+ *
+ * Computes @f[ dst = src \cdot dequantize(weights)^T + bias @f] for F32/F16 activations and int8, packed int4 or
+ * FP8 weights with one fp32 scale per group of weights. Unlike @ref CpuGemmLowpMatrixMultiplyCore the activations
+ * are not quantized, and unlike a dequantize followed by @ref CpuGemm the weights are never expanded in memory: they
+ * are read once in their 1 or 0.5 byte per element form, which is what bounds a decoder fully connected layer at
+ * batch 1.
+ *
+ * This function runs the following kernels:
+ * -# @ref kernels::CpuWeightOnlyQuantizedGemmKernel
+ */
+class CpuWeightOnlyQuantizedGemm : public ICpuOperator
+{
+public:
+    /** Set the input and output tensors.
+     *
+     * @param[in]  src        Activations tensor info with shape [K, M, batches]. Data types supported: F32/F16.
+     * @param[in]  weights    Weights tensor info, one row of K weights per output. Data types supported:
+     *                        - S8 with shape [K, N] for int8 weights
+     *                        - U8 with shape [K / 2, N] for int4 weights, packed two per byte with the even index in
+     *                          the low nibble, as 4-bit two's complement values
+     *                        - FP8_E4M3/FP8_E5M2 with shape [K, N] for FP8 weights, only on aarch64. The weights
+     *                          must be finite
+     * @param[in]  scales     Scales tensor info with shape [N, K / @p group_size]. Data type supported: F32.
+     * @param[in]  bias       (Optional) Bias tensor info with shape [N]. Can be nullptr. Data type supported: same as @p src.
+     * @param[out] dst        Destination tensor info with shape [N, M, batches]. Data type supported: same as @p src.
+     * @param[in]  group_size Number of consecutive weights sharing a scale. Must be a multiple of 16 that divides K.
+     */
+    void configure(const ITensorInfo *src,
+                   const ITensorInfo *weights,
+                   const ITensorInfo *scales,
+                   const ITensorInfo *bias,
+                   ITensorInfo       *dst,
+                   unsigned int       group_size);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuWeightOnlyQuantizedGemm::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *weights,
+                           const ITensorInfo *scales,
+                           const ITensorInfo *bias,
+                           const ITensorInfo *dst,
+                           unsigned int       group_size);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+
+private:
+    size_t _split_dimension{Window::DimX};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUWEIGHTONLYQUANTIZEDGEMM_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,8 +25,10 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/math/Math.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/FunctionDescriptors.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
@@ -40,12 +42,15 @@
 #include "src/core/NEON/kernels/convolution/common/utils.hpp"
 #include "src/core/utils/AssemblyUtils.h"
 #include "src/cpu/kernels/assembly/arm_gemm.hpp"
+#include "src/cpu/kernels/assembly/arm_gemm_compute_iface.hpp"
 #include "src/cpu/kernels/CpuWinogradConv2dKernel.h"
 #include "src/cpu/operators/CpuActivation.h"
 #include "src/cpu/operators/CpuPermute.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 #include "support/Cast.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 namespace cpu
@@ -53,8 +58,138 @@ namespace cpu
 using namespace arm_compute::experimental;
 using namespace arm_compute::utils::cast;
 
+class CpuWinogradConv2d::IFusedGemm
+{
+public:
+    virtual ~IFusedGemm() = default;
+    /** Size of the working space of the GEMM of one thread */
+    virtual size_t working_size() const = 0;
+    /** Size of the pretransposed weights shared by the GEMMs of all the threads, 0 if they read the weights as is */
+    virtual size_t pretransposed_size() const = 0;
+    /** Pretransposes the transformed weights, or keeps a pointer to them when they are read as is */
+    virtual void prepare(void *pretransposed, const void *weights, int ld_weights, int multi_stride_weights) = 0;
+    /** Sets the working space of the GEMM of a thread */
+    virtual void set_working_space(unsigned int thread, void *working_space) = 0;
+    /** Multiplies one row of tiles, of every batch, with the weights */
+    virtual void run_tile_row(unsigned int thread,
+                              const void  *a,
+                              int          lda,
+                              int          batch_stride_a,
+                              int          multi_stride_a,
+                              void        *d,
+                              int          ldd,
+                              int          batch_stride_d,
+                              int          multi_stride_d) = 0;
+};
+
 namespace
 {
+/** GEMMs of the fused mode, one per thread as the arrays of an arm_gemm kernel are set on the kernel itself */
+template <typename T>
+class FusedGemm final : public CpuWinogradConv2d::IFusedGemm
+{
+public:
+    FusedGemm(const arm_gemm::GemmArgs &args, unsigned int num_threads)
+    {
+        for (unsigned int t = 0; t < num_threads; ++t)
+        {
+            auto gemm = arm_gemm::gemm<T, T, T>(args);
+            if (gemm == nullptr)
+            {
+                _gemms.clear();
+                return;
+            }
+            _gemms.push_back(std::move(gemm));
+        }
+    }
+
+    bool is_valid() const
+    {
+        return !_gemms.empty();
+    }
+
+    size_t working_size() const override
+    {
+        // Forcing 128-byte alignment (required by 32-bit kernels)
+        return ceil_to_multiple(_gemms[0]->get_working_size(), static_cast<size_t>(128));
+    }
+
+    size_t pretransposed_size() const override
+    {
+        return _gemms[0]->B_pretranspose_required() ? _gemms[0]->get_B_pretransposed_array_size() : 0;
+    }
+
+    void prepare(void *pretransposed, const void *weights, int ld_weights, int multi_stride_weights) override
+    {
+        if (_gemms[0]->B_pretranspose_required())
+        {
+            // All the GEMMs have the same arguments, so they share the weights pretransposed by the first one
+            _gemms[0]->pretranspose_B_array(pretransposed, reinterpret_cast<const T *>(weights), ld_weights,
+                                            multi_stride_weights, false);
+            for (size_t t = 1; t < _gemms.size(); ++t)
+            {
+                _gemms[t]->set_pretransposed_B_data(pretransposed);
+            }
+        }
+        else
+        {
+            _weights              = reinterpret_cast<const T *>(weights);
+            _ld_weights           = ld_weights;
+            _multi_stride_weights = multi_stride_weights;
+        }
+    }
+
+    void set_working_space(unsigned int thread, void *working_space) override
+    {
+        if (_gemms[thread]->get_working_size() > 0)
+        {
+            _gemms[thread]->set_working_space(working_space);
+        }
+    }
+
+    void run_tile_row(unsigned int thread,
+                      const void  *a,
+                      int          lda,
+                      int          batch_stride_a,
+                      int          multi_stride_a,
+                      void        *d,
+                      int          ldd,
+                      int          batch_stride_d,
+                      int          multi_stride_d) override
+    {
+        auto &gemm = _gemms[thread];
+        gemm->set_arrays(reinterpret_cast<const T *>(a), lda, batch_stride_a, multi_stride_a, _weights, _ld_weights,
+                         _multi_stride_weights, reinterpret_cast<T *>(d), ldd, batch_stride_d, multi_stride_d,
+                         nullptr, 0);
+        gemm->execute(arm_gemm::to_ndcoord(arm_gemm::to_window(gemm->get_window_size())), arm_gemm::ndcoord_t{}, 0);
+    }
+
+private:
+    std::vector<arm_gemm::UniqueGemmCommon<T, T, T>> _gemms{};
+    const T                                         *_weights{nullptr};
+    int                                              _ld_weights{0};
+    int                                              _multi_stride_weights{0};
+};
+
+/** Creates the GEMMs of the fused mode, returns nullptr when the GEMM of a row of tiles isn't supported */
+std::unique_ptr<CpuWinogradConv2d::IFusedGemm>
+create_fused_gemm(DataType data_type, const arm_gemm::GemmArgs &args, unsigned int num_threads)
+{
+    if (data_type == DataType::F32)
+    {
+        auto gemm = std::make_unique<FusedGemm<float>>(args, num_threads);
+        return gemm->is_valid() ? std::move(gemm) : nullptr;
+    }
+#if defined(__aarch64__) && defined(ENABLE_FP16_KERNELS)
+    if (data_type == DataType::F16)
+    {
+        auto gemm = std::make_unique<FusedGemm<__fp16>>(args, num_threads);
+        return gemm->is_valid() ? std::move(gemm) : nullptr;
+    }
+#endif // defined(__aarch64__) && defined(ENABLE_FP16_KERNELS)
+    return nullptr;
+}
+
 inline Tensor4DShape internal_get_shape(const ITensorInfo *in)
 {
     const DataLayout data_layout = in->data_layout();
@@ -140,6 +275,31 @@ inline bool fuse_function_supported(const ActivationLayerInfo &act_info)
     return act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU ||
            act_info.activation() == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU;
 }
+
+/** Whether to stream the rows of tiles through the transforms and the GEMM instead of running them one after the other
+ *
+ * Streaming pays off when the transformed tensors are too large to stay in the caches between the stages, as long as
+ * the data of a row of tiles fits in half of an L2 cache and there is at least a row per thread.
+ */
+bool use_fused_mode(const arm_conv::winograd::WinogradImpl &impl,
+                    const arm_conv::ConvolutionArgs        &args,
+                    DataLayout                              data_layout,
+                    size_t                                  element_size,
+                    unsigned int                            num_threads)
+{
+    const auto        &wds          = impl.winograd_spec;
+    const unsigned int tile_rows    = impl.output_transform->get_output_rows();
+    const unsigned int tile_cols    = impl.output_transform->get_output_cols();
+    const unsigned int n_tile_rows  = (args.output_shape.rows + tile_rows - 1) / tile_rows;
+    const unsigned int n_tile_cols  = (args.output_shape.cols + tile_cols - 1) / tile_cols;
+    const size_t       l2_size      = CPUInfo::get().get_L2_cache_size();
+    const size_t       tile_row_size = static_cast<size_t>(args.n_batches) * impl.gemm_args->_nmulti * n_tile_cols *
+                                      (wds.input_ld_row + wds.output_ld_row) * element_size;
+
+    // In NCHW the permuted tensors share their memory with the transformed ones, which are all live at once when fused
+    return data_layout == DataLayout::NHWC && n_tile_rows >= num_threads && tile_row_size <= l2_size / 2 &&
+           wds.input_matrix_size_bytes + wds.output_matrix_size_bytes > num_threads * l2_size;
+}
 } // namespace
 
 CpuWinogradConv2d::CpuWinogradConv2d()
@@ -164,7 +324,11 @@ CpuWinogradConv2d::CpuWinogradConv2d()
       _input_nhwc(),
       _output_nhwc(),
       _is_prepared{false},
-      _run_activation{false}
+      _run_activation{false},
+      _fused_gemm{nullptr},
+      _fused_gemm_workspace(),
+      _fused_output_workspace_offset{0},
+      _fused_gemm_threads{0}
 {
 }
 
@@ -179,7 +343,8 @@ void CpuWinogradConv2d::configure(const ITensorInfo         *src,
                                   bool                       enable_fast_math)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
-    ARM_COMPUTE_ERROR_THROW_ON(validate(src, weights, biases, dst, conv_info, act_info, enable_fast_math));
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(validate(src, weights, biases, dst, conv_info, act_info, enable_fast_math));
+    const TrustedConfigureScope trusted_configure{};
     ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, conv_info, act_info, enable_fast_math);
     ARM_COMPUTE_UNUSED(biases);
     const DataType data_type = src->data_type();
@@ -203,13 +368,36 @@ void CpuWinogradConv2d::configure(const ITensorInfo         *src,
                            (_winograd_impl.output_transform != nullptr) && (_winograd_impl.gemm_args != nullptr));
     if (has_impl)
     {
-        // Determine how much working space is required, allocate it.
-        const size_t input_workspace_size =
-            _winograd_impl.input_transform->get_working_space_size(*_conv_args, nthreads);
+        const uint32_t n_tile_rows =
+            (_conv_args->output_shape.rows + _winograd_impl.output_transform->get_output_rows() - 1) /
+            _winograd_impl.output_transform->get_output_rows();
+        if (use_fused_mode(_winograd_impl, *_conv_args, _data_layout, src->element_size(), nthreads))
+        {
+            // The GEMM of a row of tiles runs on a single thread
+            arm_gemm::GemmArgs row_args = *_winograd_impl.gemm_args;
+            row_args._Msize =
+                (_conv_args->output_shape.cols + _winograd_impl.output_transform->get_output_cols() - 1) /
+                _winograd_impl.output_transform->get_output_cols();
+            row_args._maxthreads = 1;
+            _fused_gemm          = create_fused_gemm(data_type, row_args, nthreads);
+        }
+
+        // Determine how much working space is required, allocate it. In the fused mode the transforms of a row of
+        // tiles are run as the thread of that row, and both transforms run at the same time.
+        const uint32_t transform_threads = _fused_gemm != nullptr ? n_tile_rows : nthreads;
+        const size_t   input_workspace_size =
+            _winograd_impl.input_transform->get_working_space_size(*_conv_args, transform_threads);
         const size_t output_workspace_size =
-            _winograd_impl.output_transform->get_working_space_size(*_conv_args, nthreads);
+            _winograd_impl.output_transform->get_working_space_size(*_conv_args, transform_threads);
+
+        _fused_output_workspace_offset = ceil_to_multiple(input_workspace_size, static_cast<size_t>(64));
+        _fused_gemm_threads            = nthreads;
+        const size_t io_workspace_size = _fused_gemm != nullptr
+                                             ? _fused_output_workspace_offset + output_workspace_size
+                                             : std::max(input_workspace_size, output_workspace_size);
 
-        TensorInfo input_workspace_info(TensorShape(input_workspace_size), 1, DataType::U8);
+        TensorInfo input_workspace_info(TensorShape(_fused_gemm != nullptr ? io_workspace_size : input_workspace_size),
+                                        1, DataType::U8);
         TensorInfo output_workspace_info(TensorShape(output_workspace_size), 1, DataType::U8);
         _input_workspace  = input_workspace_info;
         _output_workspace = output_workspace_info;
@@ -279,9 +467,12 @@ void CpuWinogradConv2d::configure(const ITensorInfo         *src,
         _transform_input_kernel =
             std::make_unique<CpuWinogradConv2dTransformInputKernel>(_winograd_impl, *_conv_args, nthreads);
 
-        // Configure GEMM function
-        _gemm_function->configure(&_winograd_transformed_input, &_winograd_transformed_weights, nullptr,
-                                  &_winograd_transformed_output, 1.0f, 0.f);
+        // Configure GEMM function, the fused mode runs its own GEMMs
+        if (_fused_gemm == nullptr)
+        {
+            _gemm_function->configure(&_winograd_transformed_input, &_winograd_transformed_weights, nullptr,
+                                      &_winograd_transformed_output, 1.0f, 0.f);
+        }
 
         // Configure output transform kernel
         _transform_output_kernel =
@@ -294,10 +485,13 @@ void CpuWinogradConv2d::configure(const ITensorInfo         *src,
             _activation_func->configure(dst, nullptr, act_info);
         }
 
-        const auto mm_mem_req = _gemm_function->workspace();
-        for (unsigned int slot = 0; slot < mm_mem_req.size(); ++slot)
+        if (_fused_gemm == nullptr)
         {
-            _aux_mem[slot] = mm_mem_req[slot];
+            const auto mm_mem_req = _gemm_function->workspace();
+            for (unsigned int slot = 0; slot < mm_mem_req.size(); ++slot)
+            {
+                _aux_mem[slot] = mm_mem_req[slot];
+            }
         }
 
         // Request temporary memory. Overlap memory needed for Input/Output transformations as they run on different non-overlapping time-steps.
@@ -305,12 +499,34 @@ void CpuWinogradConv2d::configure(const ITensorInfo         *src,
                                                  wds.input_matrix_size_bytes, storage_alignment);
         _aux_mem[TransformedOutput] = MemoryInfo(offset_int_vec(TransformedOutput), MemoryLifetime::Temporary,
                                                  wds.output_matrix_size_bytes, storage_alignment);
-        _aux_mem[WorkspaceIO]       = MemoryInfo(offset_int_vec(WorkspaceIO), MemoryLifetime::Temporary,
-                                                 std::max(input_workspace_size, output_workspace_size));
+        _aux_mem[WorkspaceIO] =
+            MemoryInfo(offset_int_vec(WorkspaceIO), MemoryLifetime::Temporary, io_workspace_size);
         _aux_mem[PermutedWeights] =
             MemoryInfo(offset_int_vec(PermutedWeights), MemoryLifetime::Prepare, _weights_hwio.total_size());
         _aux_mem[TransformedWeights] = MemoryInfo(offset_int_vec(TransformedWeights), MemoryLifetime::Prepare,
                                                   wds.weight_matrix_size_bytes, storage_alignment);
+        if (_fused_gemm != nullptr)
+        {
+            const size_t gemm_workspace_size = nthreads * _fused_gemm->working_size();
+            const size_t pretransposed_size  = _fused_gemm->pretransposed_size();
+            if (gemm_workspace_size > 0)
+            {
+                _fused_gemm_workspace        = TensorInfo(TensorShape(gemm_workspace_size), 1, DataType::U8);
+                _aux_mem[FusedGemmWorkspace] = MemoryInfo(offset_int_vec(FusedGemmWorkspace),
+                                                          MemoryLifetime::Temporary, gemm_workspace_size, 4096);
+            }
+            if (pretransposed_size > 0)
+            {
+                _aux_mem[FusedGemmPretransposedWeights] =
+                    MemoryInfo(offset_int_vec(FusedGemmPretransposedWeights), MemoryLifetime::Persistent,
+                               pretransposed_size, storage_alignment);
+            }
+            else
+            {
+                // The GEMMs read the transformed weights on every run
+                _aux_mem[TransformedWeights].lifetime = MemoryLifetime::Persistent;
+            }
+        }
         if (_data_layout == DataLayout::NCHW)
         {
             _aux_mem[PermutedInput].merge(offset_int_vec(PermutedInput), src->total_size());
@@ -384,6 +600,18 @@ void CpuWinogradConv2d::run(ITensorPack &tensors)
     CpuAuxTensorHandler output_workspace(offset_int_vec(WorkspaceIO), _output_workspace, tensors, true);
     CpuAuxTensorHandler output_nhwc(offset_int_vec(PermutedOutput), _output_nhwc, tensors, true);
 
+    if (_fused_gemm != nullptr)
+    {
+        run_fused(tensors, winograd_input_transformed.get(), winograd_output_transformed.get(),
+                  input_workspace.get());
+        if (_run_activation)
+        {
+            ITensorPack pack{{ACL_SRC, output}, {ACL_DST, output}};
+            _activation_func->run(pack);
+        }
+        return;
+    }
+
     ITensorPack transform_input_pack{{ACL_SRC, is_nchw ? input_nhwc.get() : src},
                                      {ACL_DST, winograd_input_transformed.get()},
                                      {ACL_INT, input_workspace.get()}};
@@ -419,6 +647,86 @@ void CpuWinogradConv2d::run(ITensorPack &tensors)
     }
 }
 
+void CpuWinogradConv2d::run_fused(ITensorPack &tensors,
+                                  ITensor     *input_transformed,
+                                  ITensor     *output_transformed,
+                                  ITensor     *io_workspace)
+{
+    const ITensor *src    = tensors.get_const_tensor(ACL_SRC_0);
+    const ITensor *biases = tensors.get_const_tensor(ACL_SRC_2);
+    ITensor       *dst    = tensors.get_tensor(ACL_DST);
+
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+    ARM_COMPUTE_ERROR_ON_MSG(num_threads > _fused_gemm_threads,
+                             "The fused Winograd GEMMs were configured for fewer threads than the scheduler runs");
+
+    CpuAuxTensorHandler gemm_workspace(offset_int_vec(FusedGemmWorkspace), _fused_gemm_workspace, tensors, true);
+    if (_aux_mem[FusedGemmWorkspace].size > 0)
+    {
+        for (unsigned int t = 0; t < num_threads; ++t)
+        {
+            _fused_gemm->set_working_space(t, gemm_workspace.get()->buffer() + t * _fused_gemm->working_size());
+        }
+    }
+
+    const auto &args = *_conv_args;
+    const auto &wds  = _winograd_impl.winograd_spec;
+
+    const unsigned int n_tile_rows = (args.output_shape.rows + _winograd_impl.output_transform->get_output_rows() - 1) /
+                                     _winograd_impl.output_transform->get_output_rows();
+    const unsigned int n_tile_cols = (args.output_shape.cols + _winograd_impl.output_transform->get_output_cols() - 1) /
+                                     _winograd_impl.output_transform->get_output_cols();
+
+    // Strides in elements, the source and destination are NHWC
+    const size_t element_size     = src->info()->element_size();
+    const auto   src_strides      = src->info()->strides_in_bytes();
+    const auto   dst_strides      = dst->info()->strides_in_bytes();
+    const size_t src_col_stride   = src_strides[1] / element_size;
+    const size_t src_row_stride   = src_strides[2] / element_size;
+    const size_t src_batch_stride = src_strides[3] / element_size;
+    const size_t dst_col_stride   = dst_strides[1] / element_size;
+    const size_t dst_row_stride   = dst_strides[2] / element_size;
+    const size_t dst_batch_stride = dst_strides[3] / element_size;
+
+    const void *src_ptr  = src->buffer() + src->info()->offset_first_element_in_bytes();
+    void       *dst_ptr  = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+    const void *bias_ptr = nullptr;
+    if (biases != nullptr)
+    {
+        bias_ptr = biases->buffer() + biases->info()->offset_first_element_in_bytes();
+    }
+    uint8_t *input_ptr     = input_transformed->buffer() + input_transformed->info()->offset_first_element_in_bytes();
+    uint8_t *output_ptr    = output_transformed->buffer() + output_transformed->info()->offset_first_element_in_bytes();
+    uint8_t *in_workspace  = io_workspace->buffer();
+    uint8_t *out_workspace = in_workspace + _fused_output_workspace_offset;
+
+    // Each thread runs the three stages on its rows of tiles. The transforms are given the row as thread id out of
+    // as many threads as rows, so that they only process that row.
+    std::vector<IScheduler::Workload> workloads(num_threads);
+    for (unsigned int t = 0; t < num_threads; ++t)
+    {
+        workloads[t] = [&, t](const ThreadInfo &)
+        {
+            for (unsigned int row = t; row < n_tile_rows; row += num_threads)
+            {
+                _winograd_impl.input_transform->execute(args, src_ptr, src_batch_stride, src_row_stride,
+                                                        src_col_stride, input_ptr, wds, in_workspace, row, n_tile_rows);
+
+                const size_t a_offset = static_cast<size_t>(row) * n_tile_cols * wds.input_ld_row * element_size;
+                const size_t d_offset = static_cast<size_t>(row) * n_tile_cols * wds.output_ld_row * element_size;
+                _fused_gemm->run_tile_row(t, input_ptr + a_offset, wds.input_ld_row, wds.input_ld_batch,
+                                          wds.input_ld_matrix, output_ptr + d_offset, wds.output_ld_row,
+                                          wds.output_ld_batch, wds.output_ld_matrix);
+
+                _winograd_impl.output_transform->execute(args, output_ptr, wds, bias_ptr, dst_ptr, dst_batch_stride,
+                                                         dst_row_stride, dst_col_stride, out_workspace, row,
+                                                         n_tile_rows);
+            }
+        };
+    }
+    NEScheduler::get().run_tagged_workloads(workloads, "CpuWinogradConv2d/fused");
+}
+
 void CpuWinogradConv2d::prepare(ITensorPack &tensors)
 {
     if (!_is_prepared)
@@ -463,9 +771,26 @@ void CpuWinogradConv2d::prepare(ITensorPack &tensors)
             *_conv_args, permuted_weights_ptr, permuted_weight_row_stride, permuted_weight_col_stride,
             permuted_weight_channel_stride, win_wght_transf_ptr, _winograd_impl.winograd_spec, 0, 1 // Thread 1 of 1
         );
-        ITensorPack gemm_pack = tensors;
-        gemm_pack.add_const_tensor(ACL_SRC_1, winograd_transformed_weights.get());
-        _gemm_function->prepare(gemm_pack);
+        if (_fused_gemm != nullptr)
+        {
+            void *pretransposed_ptr = nullptr;
+            if (_aux_mem[FusedGemmPretransposedWeights].size > 0)
+            {
+                ITensor *pretransposed = utils::cast::polymorphic_cast<ITensor *>(
+                    tensors.get_tensor(offset_int_vec(FusedGemmPretransposedWeights)));
+                ARM_COMPUTE_ERROR_ON_NULLPTR(pretransposed);
+                pretransposed_ptr = pretransposed->buffer();
+            }
+            _fused_gemm->prepare(pretransposed_ptr, win_wght_transf_ptr,
+                                 _winograd_impl.winograd_spec.weight_ld_row,
+                                 _winograd_impl.winograd_spec.weight_ld_matrix);
+        }
+        else
+        {
+            ITensorPack gemm_pack = tensors;
+            gemm_pack.add_const_tensor(ACL_SRC_1, winograd_transformed_weights.get());
+            _gemm_function->prepare(gemm_pack);
+        }
         _is_prepared = 1;
     }
 }
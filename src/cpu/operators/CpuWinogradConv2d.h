@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,6 +50,10 @@ public:
     ~CpuWinogradConv2d();
 
     /** Set the input and output tensors.
+     *
+     * Large NHWC convolutions whose transformed tensors don't fit in the caches run in a fused mode: each thread
+     * transforms one row of tiles, multiplies it and transforms the result back before moving to its next row, so
+     * that the transformed tiles are still in its L2 cache when the next stage reads them.
      *
      * Valid data layouts:
      * - NHWC
@@ -100,7 +104,16 @@ public:
     void                             prepare(ITensorPack &constants) override;
     experimental::MemoryRequirements workspace() const override;
 
+    /** Interface of the GEMMs of the fused mode, which multiply one row of tiles at a time */
+    class IFusedGemm;
+
 private:
+    /** Runs the transforms and the GEMM of each row of tiles one after the other, on the same thread */
+    void run_fused(ITensorPack &tensors,
+                   ITensor     *input_transformed,
+                   ITensor     *output_transformed,
+                   ITensor     *io_workspace);
+
     enum AuxTensorIdx
     {
         /** Slot 0 - 6 reserved for CpuGemm */
@@ -109,6 +122,8 @@ private:
         WorkspaceIO,
         TransformedWeights,
         PermutedWeights,
+        FusedGemmWorkspace,
+        FusedGemmPretransposedWeights,
         Count,
         PermutedInput  = TransformedOutput,
         PermutedOutput = TransformedInput
@@ -135,6 +150,10 @@ private:
     TensorInfo                       _output_nhwc;
     bool                             _is_prepared;
     bool                             _run_activation;
+    std::unique_ptr<IFusedGemm>      _fused_gemm;
+    TensorInfo                       _fused_gemm_workspace;
+    size_t                           _fused_output_workspace_offset;
+    unsigned int                     _fused_gemm_threads;
 };
 } // namespace cpu
 } // namespace arm_compute
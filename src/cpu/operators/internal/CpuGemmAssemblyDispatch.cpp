@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025 Arm Limited.
+ * Copyright (c) 2018-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,9 +24,13 @@
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/utils/math/Math.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
 
+#include "src/common/cpuinfo/CpuModel.h"
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/utils/AssemblyUtils.h"
@@ -34,8 +38,21 @@
 #include "src/cpu/kernels/assembly/CpuGemmAssemblyWrapperKernel.h"
 #include "src/cpu/operators/CpuTranspose.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
+#include "src/cpu/utils/CpuCycleCounter.h"
+#include "src/cpu/utils/CpuGemmProfile.h"
+#include "src/cpu/utils/CpuGemmTuner.h"
+#include "src/cpu/utils/CpuSharedWeightsCache.h"
+#include "utils/TypePrinter.h"
 
 #include <arm_neon.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
 
 namespace arm_compute
 {
@@ -70,24 +87,16 @@ void run_parallel_pretranspose_B_array(arm_gemm::GemmCommon<TypeInput, TypeWeigh
     // The window size is also the total workload size
     const unsigned int wsize = gemm_asm->get_B_pretranspose_window_size();
 
-    const int workload_size       = std::min(wsize, num_threads);
-    const int chunks_per_workload = std::floor(wsize / workload_size);
+    const int workload_size = std::min(wsize, num_threads);
 
     std::vector<IScheduler::Workload> workloads(workload_size);
     for (int t = 0; t < workload_size; ++t)
     {
         workloads[t] = [=](const ThreadInfo &info)
         {
-            const unsigned int start = ((info.thread_id) * chunks_per_workload);
-            unsigned int       end;
-            if (info.thread_id < workload_size - 1)
-            {
-                end = ((info.thread_id + 1) * chunks_per_workload);
-            }
-            else
-            {
-                end = wsize;
-            }
+            // Spread the remainder of the window over the threads instead of leaving it all to the last one
+            const size_t start = static_cast<size_t>(info.thread_id) * wsize / workload_size;
+            const size_t end   = static_cast<size_t>(info.thread_id + 1) * wsize / workload_size;
             ARM_COMPUTE_ERROR_ON(start > end);
             if (start < end)
             {
@@ -98,12 +107,377 @@ void run_parallel_pretranspose_B_array(arm_gemm::GemmCommon<TypeInput, TypeWeigh
     }
     NEScheduler::get().run_tagged_workloads(workloads, "CpuGemmAssemblyDispatch/pretranspose_B_array");
 }
+
+/** Select the scheduling hint compatible with the window exposed by arm_gemm
+ *
+ * @param[in] window Window of the assembly kernel
+ *
+ * @return Hint splitting along X by default, along Y or both dimensions if the window is 2D
+ */
+IScheduler::Hints scheduling_hint_for_window(const Window &window)
+{
+    // The default case is when we split among the X dimension
+    IScheduler::Hints scheduling_hint = IScheduler::Hints(Window::DimX);
+    // If arm_gemm exposes a 2D window, perform 2D scheduling
+    if (window.num_iterations(Window::DimY) > 1 && window.num_iterations(Window::DimX) > 1)
+    {
+        scheduling_hint = IScheduler::Hints(IScheduler::split_dimensions_all);
+    }
+    // Split among Y
+    else if (window.num_iterations(Window::DimY) > 1)
+    {
+        scheduling_hint = IScheduler::Hints(Window::DimY);
+    }
+    return scheduling_hint;
+}
+
+/** Number of sections of K the threads compute partial results over, see arm_gemm::get_gemm_split_k()
+ *
+ * Only F32 GEMMs without output stage are split, the partial results being summed in F32.
+ *
+ * @return 1 if K is not to be split
+ */
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+unsigned int split_k_sections(const arm_gemm::GemmArgs &args, const OutputStage &os)
+{
+    ARM_COMPUTE_UNUSED(args, os);
+    return 1;
+}
+
+template <>
+unsigned int split_k_sections<float, float, float, arm_gemm::Nothing>(const arm_gemm::GemmArgs &args,
+                                                                      const arm_gemm::Nothing  &os)
+{
+    return arm_gemm::get_gemm_split_k<float, float, float, arm_gemm::Nothing>(args, os);
+}
+
+/** Sum the partial results of the sections of K, add the bias and apply the activation
+ *
+ * The elements of the output are split evenly between the threads, so that a single row is split too.
+ *
+ * @param[in]  partials       Partial results, stored as [sections][batches * m][n]
+ * @param[in]  sections       Number of sections of K
+ * @param[in]  m              Number of rows of each batch
+ * @param[in]  n              Number of columns
+ * @param[in]  batches        Number of batches
+ * @param[in]  bias           Bias of each column, may be nullptr
+ * @param[in]  act            Activation to apply
+ * @param[out] dst            Output matrix
+ * @param[in]  ldd            Stride of @p dst in y, in elements
+ * @param[in]  batch_stride_d Stride of @p dst between the batches, in elements
+ */
+void run_split_k_reduction(const float                *partials,
+                           unsigned int                sections,
+                           size_t                      m,
+                           size_t                      n,
+                           size_t                      batches,
+                           const float                *bias,
+                           const arm_gemm::Activation &act,
+                           float                      *dst,
+                           size_t                      ldd,
+                           size_t                      batch_stride_d)
+{
+    const size_t total = batches * m * n;
+    const float  lower = act.type == arm_gemm::Activation::Type::None ? std::numeric_limits<float>::lowest() : 0.f;
+    const float  upper =
+        act.type == arm_gemm::Activation::Type::BoundedReLU ? act.param1 : std::numeric_limits<float>::max();
+
+    // Chunks of 16 elements at least, so that the threads do not share cache lines of the output
+    const size_t       chunk       = 16;
+    const unsigned int num_threads = static_cast<unsigned int>(
+        std::max<size_t>(1, std::min<size_t>(NEScheduler::get().num_threads(), total / chunk)));
+
+    std::vector<IScheduler::Workload> workloads(num_threads);
+    for (unsigned int t = 0; t < num_threads; ++t)
+    {
+        workloads[t] = [=](const ThreadInfo &)
+        {
+            const size_t begin = t == 0 ? 0 : (total / chunk * t / num_threads) * chunk;
+            const size_t end   = t == num_threads - 1 ? total : (total / chunk * (t + 1) / num_threads) * chunk;
+            for (size_t i = begin; i < end;)
+            {
+                const size_t row = i / n;
+                const size_t col = i % n;
+                const size_t len = std::min(end - i, n - col);
+                float       *out = dst + (row / m) * batch_stride_d + (row % m) * ldd + col;
+                for (size_t x = 0; x < len; ++x)
+                {
+                    out[x] = partials[i + x] + (bias != nullptr ? bias[col + x] : 0.f);
+                }
+                for (unsigned int s = 1; s < sections; ++s)
+                {
+                    const float *in = partials + s * total + i;
+                    for (size_t x = 0; x < len; ++x)
+                    {
+                        out[x] += in[x];
+                    }
+                }
+                for (size_t x = 0; x < len; ++x)
+                {
+                    out[x] = std::min(std::max(out[x], lower), upper);
+                }
+                i += len;
+            }
+        };
+    }
+    NEScheduler::get().run_tagged_workloads(workloads, "CpuGemmAssemblyDispatch/split_k_reduction");
+}
+
+template <typename T>
+void run_split_k_reduction(const T *,
+                           unsigned int,
+                           size_t,
+                           size_t,
+                           size_t,
+                           const T *,
+                           const arm_gemm::Activation &,
+                           T *,
+                           size_t,
+                           size_t)
+{
+    ARM_COMPUTE_ERROR("K is only split for F32 GEMMs");
+}
+
+/** Name of the strategy family of an arm_gemm kernel */
+const char *gemm_method_to_string(arm_gemm::GemmMethod method)
+{
+    switch (method)
+    {
+        case arm_gemm::GemmMethod::GEMV_BATCHED:
+            return "GEMV_BATCHED";
+        case arm_gemm::GemmMethod::GEMV_PRETRANSPOSED:
+            return "GEMV_PRETRANSPOSED";
+        case arm_gemm::GemmMethod::GEMV_NATIVE_TRANSPOSED:
+            return "GEMV_NATIVE_TRANSPOSED";
+        case arm_gemm::GemmMethod::GEMM_NATIVE:
+            return "GEMM_NATIVE";
+        case arm_gemm::GemmMethod::GEMM_HYBRID:
+            return "GEMM_HYBRID";
+        case arm_gemm::GemmMethod::GEMM_INTERLEAVED:
+            return "GEMM_INTERLEAVED";
+        case arm_gemm::GemmMethod::GEMM_HYBRID_QUANTIZED:
+            return "GEMM_HYBRID_QUANTIZED";
+        default:
+            return "DEFAULT";
+    }
+}
+
+/** Name of the dimension a scheduling hint splits the workload along */
+std::string split_dimension_to_string(const IScheduler::Hints &hint)
+{
+    if (hint.split_dimension() == IScheduler::split_dimensions_all)
+    {
+        return "All";
+    }
+    return hint.split_dimension() == Window::DimY ? "Y" : "X";
+}
+
+/** Measure the execution time of an arm_gemm kernel on zero-filled buffers
+ *
+ * @param[in] gemm_asm GemmCommon kernel to time
+ * @param[in] args     Arguments the kernel was instantiated with
+ *
+ * @return Fastest of a few runs, in nanoseconds
+ */
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+int64_t time_arm_gemm(arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput> *gemm_asm, const arm_gemm::GemmArgs &args)
+{
+    constexpr unsigned int num_iterations = 3;
+
+    const size_t M = args._Msize;
+    const size_t N = args._Nsize;
+    const size_t K = args._Ksize;
+
+    std::vector<TypeInput>  a(K * M * args._nbatches * args._nmulti);
+    std::vector<TypeWeight> b(N * K * args._nmulti);
+    std::vector<TypeOutput> d(N * M * args._nbatches * args._nmulti);
+
+    // Same alignments as the memory requested by the fallback
+    std::vector<uint8_t> workspace(gemm_asm->get_working_size() + 4096);
+    void                *workspace_ptr  = workspace.data();
+    size_t               workspace_size = workspace.size();
+    gemm_asm->set_working_space(std::align(4096, workspace_size - 4096, workspace_ptr, workspace_size));
+
+    std::vector<uint8_t> pretranspose;
+    if (gemm_asm->B_pretranspose_required())
+    {
+        pretranspose.resize(gemm_asm->get_B_pretransposed_array_size() + 128);
+        void  *pretranspose_ptr  = pretranspose.data();
+        size_t pretranspose_size = pretranspose.size();
+        gemm_asm->pretranspose_B_array(std::align(128, pretranspose_size - 128, pretranspose_ptr, pretranspose_size),
+                                       b.data(), N, N * K, false);
+    }
+
+    gemm_asm->set_arrays(a.data(), K, K * M, K * M * args._nbatches, b.data(), N, N * K, d.data(), N, N * M,
+                         N * M * args._nbatches, nullptr, 0);
+
+    kernel::CpuGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput> wrapper;
+    wrapper.configure(gemm_asm, "");
+
+    const IScheduler::Hints scheduling_hint = scheduling_hint_for_window(wrapper.window());
+    unsigned int            num_threads     = std::min<unsigned int>(gemm_asm->get_window_size().total_size(),
+                                                                     NEScheduler::get().num_threads());
+    if (scheduling_hint.split_dimension() != IScheduler::split_dimensions_all)
+    {
+        num_threads =
+            std::min<unsigned int>(wrapper.window().num_iterations(scheduling_hint.split_dimension()), num_threads);
+    }
+    gemm_asm->set_nthreads(num_threads);
+
+    // Warm-up run, not measured
+    NEScheduler::get().schedule(&wrapper, scheduling_hint);
+
+    int64_t best_time = std::numeric_limits<int64_t>::max();
+    for (unsigned int i = 0; i < num_iterations; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        NEScheduler::get().schedule(&wrapper, scheduling_hint);
+        const auto end = std::chrono::steady_clock::now();
+        best_time      = std::min<int64_t>(best_time,
+                                           std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+    return best_time;
+}
+
+/** Time the compatible arm_gemm kernels of a problem and return the fastest configuration
+ *
+ * Along with the default block sizes of each kernel, halved and doubled inner (K) block sizes are tried on the
+ * kernels which block K.
+ *
+ * @param[in]  args Arguments of the GEMM problem
+ * @param[out] best Fastest configuration found
+ *
+ * @return True if at least one kernel could be timed
+ */
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+bool tune_arm_gemm(const arm_gemm::GemmArgs &args, arm_gemm::GemmConfig &best)
+{
+    int64_t best_time = std::numeric_limits<int64_t>::max();
+
+    const auto kernels = arm_gemm::get_compatible_kernels<TypeInput, TypeWeight, TypeOutput>(args);
+    for (const auto &kernel : kernels)
+    {
+        std::vector<arm_gemm::GemmConfig> candidates(1);
+        candidates[0].method = kernel.method;
+        candidates[0].filter = kernel.name;
+
+        for (size_t i = 0; i < candidates.size(); ++i)
+        {
+            arm_gemm::GemmConfig cfg = candidates[i];
+            cfg.weight_format        = args._cfg != nullptr ? args._cfg->weight_format : arm_gemm::WeightFormat::ANY;
+
+            arm_gemm::GemmArgs candidate_args = args;
+            candidate_args._cfg               = &cfg;
+
+            auto gemm_asm = arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput>(candidate_args);
+            if (gemm_asm == nullptr)
+            {
+                continue;
+            }
+
+            // Add the block size variants once the default blocking of the kernel is known
+            const unsigned int k_block = gemm_asm->get_config().inner_block_size;
+            if (i == 0 && k_block != 0)
+            {
+                for (const unsigned int variant : {k_block / 2, k_block * 2})
+                {
+                    if (variant >= 16 && variant < args._Ksize)
+                    {
+                        arm_gemm::GemmConfig variant_cfg = candidates[0];
+                        variant_cfg.inner_block_size     = variant;
+                        candidates.push_back(variant_cfg);
+                    }
+                }
+            }
+
+            const int64_t time = time_arm_gemm<TypeInput, TypeWeight, TypeOutput>(gemm_asm.get(), candidate_args);
+            if (time < best_time)
+            {
+                best_time = time;
+                best      = candidates[i];
+            }
+        }
+    }
+    return best_time != std::numeric_limits<int64_t>::max();
+}
+
+/** Apply the tuned kernel configuration of a GEMM problem, tuning it first if needed and enabled
+ *
+ * Problems without a tuned configuration keep the arm_gemm heuristics.
+ *
+ * @param[in]     args  Arguments of the GEMM problem
+ * @param[in,out] cfg   Configuration pointed to by @p args, updated with the tuned kernel
+ * @param[in]     types Tag identifying the data types of the problem
+ */
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+void apply_tuned_gemm_config(const arm_gemm::GemmArgs &args, arm_gemm::GemmConfig &cfg, const std::string &types)
+{
+    // Fixed-format and indirect kernels are selected by the caller and run on memory we cannot emulate here
+    if (args._fixed_format || args._indirect_input || args._Ksections > 1)
+    {
+        return;
+    }
+
+    CpuGemmTuner     &tuner = CpuGemmTuner::get();
+    const std::string key   = CpuGemmTuner::make_key(args, types);
+
+    arm_gemm::GemmConfig tuned;
+    if (!tuner.find(key, tuned))
+    {
+        if (!tuner.is_tuning_enabled() || !tune_arm_gemm<TypeInput, TypeWeight, TypeOutput>(args, tuned))
+        {
+            return;
+        }
+        tuner.add(key, tuned);
+    }
+
+    // Entries from a file tuned on a different build may refer to kernels not available here
+    const auto kernels = arm_gemm::get_compatible_kernels<TypeInput, TypeWeight, TypeOutput>(args);
+    if (std::none_of(kernels.begin(), kernels.end(),
+                     [&](const arm_gemm::KernelDescription &k) { return k.name == tuned.filter; }))
+    {
+        return;
+    }
+
+    cfg.method           = tuned.method;
+    cfg.filter           = tuned.filter;
+    cfg.inner_block_size = tuned.inner_block_size;
+    cfg.outer_block_size = tuned.outer_block_size;
+}
 } // namespace
 
 using namespace arm_compute::experimental;
 
 namespace
 {
+/** Adds the wall-clock time of its scope to a run counter while the reports are enabled */
+class ScopedRunTimer final
+{
+public:
+    ScopedRunTimer(std::atomic<uint64_t> &runs, std::atomic<uint64_t> &ns)
+        : _runs(runs), _ns(ns), _enabled(is_cycle_counting_enabled()), _start(std::chrono::steady_clock::now())
+    {
+    }
+    ScopedRunTimer(const ScopedRunTimer &)            = delete;
+    ScopedRunTimer &operator=(const ScopedRunTimer &) = delete;
+    ~ScopedRunTimer()
+    {
+        if (_enabled)
+        {
+            const auto elapsed = std::chrono::steady_clock::now() - _start;
+            _ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                          std::memory_order_relaxed);
+            _runs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::atomic<uint64_t>                &_runs;
+    std::atomic<uint64_t>                &_ns;
+    const bool                            _enabled;
+    std::chrono::steady_clock::time_point _start;
+};
+
 struct Params
 {
     unsigned int M;
@@ -126,10 +500,26 @@ Params extract_parameters(const ITensorInfo *a, const ITensorInfo *b, const ITen
              /* sections */ 1,
              /* indirect */ false};
 
+    if (info.method == AsmConvMethod::Indirect3d)
+    {
+        // Each output point of a volume is a row of the GEMM, each kernel point a section of its depth
+        const TensorShape &d_shape = d->tensor_shape();
+        const TensorShape &b_shape = b->tensor_shape();
+        p.M        = d_shape[1] * d_shape[2] * d_shape[3];
+        p.batches  = d_shape.total_size_upper(4);
+        p.indirect = true;
+        p.sections = b_shape[2] * b_shape[3] * b_shape[4];
+        return p;
+    }
+
     if (info.method == AsmConvMethod::Conv || info.method == AsmConvMethod::Indirect)
     {
         p.indirect = true;
         p.sections = b->tensor_shape()[2] * b->tensor_shape()[3];
+        // The groups are side by side along the channels of the input, the weights and the output
+        p.multis = info.num_groups;
+        p.N /= info.num_groups;
+        p.K /= info.num_groups;
     }
     else
     {
@@ -192,6 +582,10 @@ public:
     void                             prepare(ITensorPack &tensors) override;
     bool                             is_configured() const override;
     experimental::MemoryRequirements workspace() const override;
+    Status export_pretransposed_weights(ITensorPack &tensors, std::vector<uint8_t> &blob) const override;
+    Status import_pretransposed_weights(const std::vector<uint8_t> &blob) override;
+    AsmGemmReport                    report() const override;
+    OperatorDescription              describe() const override;
     bool                             isVarWeightsKernel() const override
     {
         if (!_gemm_kernel_asm)
@@ -258,8 +652,75 @@ private:
      * @param[in]  info GEMM meta-data
      */
     void configure_indirect(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const AsmGemmInfo &info);
-    /** Prepare the indirect buffer */
-    void prepare_indirect_buffer(ITensorPack &tensors);
+    /** Point the indirect buffer to the rows of @p a
+     *
+     * The buffer is built on the first run and only rebased when the address of @p a changes.
+     *
+     * @param[in] a Input tensor containing the NHWC input.
+     */
+    void fill_indirect_buffer(const ITensor *a);
+    /** Move the pointers of the indirect buffer from the current input, @ref _indirect_src, to @p src
+     *
+     * @param[in] src First element of the new input.
+     */
+    void rebase_indirect_buffer(const TypeInput *src);
+    /** Configure the indirect buffer of a volume
+     *
+     * @param[in] a    Input tensor containing the NDHWC volume.
+     * @param[in] b    Input tensor containing the weights [OFM, IFM, kernel_x, kernel_y, kernel_z].
+     * @param[in] d    Output tensor to store the NDHWC output volume.
+     * @param[in] info GEMM meta-data
+     */
+    void
+    configure_indirect_3d(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const AsmGemmInfo &info);
+    /** Point the indirect buffer of a volume to the rows of @p a
+     *
+     * The buffer is built on the first run and only rebased when the address of the volume changes. Rows of the output
+     * are shared between threads.
+     *
+     * @param[in] a Input tensor containing the NDHWC volume.
+     */
+    void fill_indirect_buffer_3d(const ITensor *a);
+    /** Key identifying the pretransposed B array of a given B in the shared weights cache */
+    std::string pretranspose_cache_key(const ITensor &b) const;
+    /** Stride between the multis of @p b, in elements. The groups of a convolution are consecutive output channels */
+    int multi_stride_b(const ITensor &b) const;
+    /** Header of exported pretransposed weights, identifying the kernel, the problem and the CPU they are valid for */
+    std::string pretranspose_export_header() const;
+    /** Checks if the pretransposed B array can be exported and imported
+     *
+     * @return a status
+     */
+    Status validate_pretranspose_export() const;
+    /** Create the kernels reading the replicas of the pretransposed B array on the other NUMA nodes
+     *
+     * Only done when enabled with @ref IScheduler::set_numa_weights_replication and the threads of the scheduler
+     * run on several nodes. The replicas use the kernel selected for @ref _gemm_kernel_asm, which keeps the
+     * replica of the node of the first thread.
+     *
+     * @param[in] args Arguments the assembly kernel has been created with
+     * @param[in] os   Output stage the assembly kernel has been created with
+     */
+    void configure_numa_replicas(const arm_gemm::GemmArgs &args, const OutputStage &os);
+    /** Pretranspose B into the array of each node, the threads of a node transforming the array of their node
+     *
+     * The replicas are allocated before being transformed, so that their pages are placed on the node of the threads
+     * first writing them.
+     *
+     * @param[in] pretranspose   Pretransposed B array of @ref _gemm_kernel_asm
+     * @param[in] b              Matrix B to transform
+     * @param[in] ldb            Stride of @p b in y, in elements
+     * @param[in] multi_stride_b Stride of @p b between the multis, in elements
+     * @param[in] transpose      Whether @p b has to be transposed by the transformation
+     */
+    void prepare_numa_replicas(ITensor *pretranspose, const TypeWeight *b, int ldb, int multi_stride_b, bool transpose);
+    /** Check whether the run can use the replicas of the pretransposed B array
+     *
+     * The threads are only known to be on the nodes found on configuration if their number has not changed since.
+     */
+    bool use_numa_replicas() const;
+    /** Run the assembly kernels, each thread executing its part of the window through the kernel of its node */
+    void run_numa_replicas();
 
     /** Operator to transpose B before gemm or pretranspose_B_array*/
     std::unique_ptr<CpuTranspose> _pre_pretranspose_b{nullptr};
@@ -294,6 +755,46 @@ private:
     bool                                  _is_c_constant{true};
     bool                                  _run_pre_pretranspose_b{false};
     bool                                  _B_pre_pretranspose_required{false};
+    bool                                  _share_pretranspose{false};
+    std::shared_ptr<ITensor>              _shared_pretranspose{nullptr};
+    /** Pretransposed B array imported with import_pretransposed_weights() */
+    Tensor _imported_pretranspose{};
+    bool   _import_pretranspose{false};
+    /** Shape and data type of B, part of the header of exported pretransposed weights */
+    TensorShape _b_shape{};
+    DataType    _b_data_type{DataType::UNKNOWN};
+    /** Depth of the input, kernel and output volumes of indirect 3D convolutions */
+    int64_t _input_depth{0};
+    int64_t _kernel_depth{0};
+    int64_t _output_depth{0};
+    /** Input the indirect buffer points to */
+    const TypeInput *_indirect_src{nullptr};
+    /** Serialises the runs updating the state of the shared assembly kernel */
+    std::mutex _run_mutex{};
+    /** Whether the strides of the stateless execution have been captured by the assembly kernel */
+    bool _stateless_arrays_set{false};
+    /** Static part of the performance report, set on configuration */
+    AsmGemmReport _report{};
+    /** Measurements of the runs, see @ref CpuGemmAssemblyDispatch::report */
+    std::atomic<uint64_t> _measured_runs{0};
+    std::atomic<uint64_t> _measured_ns{0};
+    std::atomic<uint64_t> _measured_cycles{0};
+    /** Kernels reading the replicas of the pretransposed B array on the NUMA nodes of the threads but the first one */
+    std::vector<std::unique_ptr<arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput>>> _numa_kernels{};
+    /** Replicas of the pretransposed B array, one per kernel of @ref _numa_kernels */
+    std::vector<std::unique_ptr<Tensor>> _numa_pretranspose{};
+    /** Kernel used by each thread id: 0 for @ref _gemm_kernel_asm, i + 1 for the i-th kernel of @ref _numa_kernels */
+    std::vector<unsigned int> _numa_thread_kernel{};
+    /** Number of sections K is split into, the sections being the multis of the assembly kernel */
+    unsigned int _split_k{1};
+    /** Rows of each batch, columns and batches of the problem split over K */
+    unsigned int _split_k_m{0};
+    unsigned int _split_k_n{0};
+    unsigned int _split_k_batches{0};
+    /** Activation applied once the partial results of the sections are summed */
+    arm_gemm::Activation _split_k_act{};
+    /** Offset in bytes of the partial results of the sections of K in the workspace, after the one of arm_gemm */
+    size_t _split_k_partials_offset{0};
 };
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
@@ -317,10 +818,34 @@ Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::set_requantize_data(co
 }
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
-void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare_indirect_buffer(ITensorPack &tensors)
+void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::rebase_indirect_buffer(const TypeInput *src)
+{
+    const TypeInput *pad = _indirect_pad.data();
+    for (auto &ptr : _indirect_buf)
+    {
+        if (ptr != pad)
+        {
+            ptr = src + (ptr - _indirect_src);
+        }
+    }
+    _indirect_src = src;
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::fill_indirect_buffer(const ITensor *a)
 {
-    auto             a              = tensors.get_const_tensor(TensorType::ACL_SRC_0);
-    const TypeInput *A_ptr          = reinterpret_cast<TypeInput *>(a->buffer());
+    const auto *A_ptr = reinterpret_cast<const TypeInput *>(a->buffer() + a->info()->offset_first_element_in_bytes());
+    if (A_ptr == _indirect_src)
+    {
+        return;
+    }
+    if (_indirect_src != nullptr)
+    {
+        rebase_indirect_buffer(A_ptr);
+        return;
+    }
+    _indirect_src = A_ptr;
+
     const int        multis         = 1;
     const int        batches        = a->info()->tensor_shape().total_size_upper(3);
     const size_t     stride_A       = a->info()->strides_in_bytes().y() / sizeof(TypeInput);
@@ -347,8 +872,10 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare_indirect_
                     {
                         for (int64_t kernel_x = 0; kernel_x < _cp.kernel_width; kernel_x++)
                         {
-                            int64_t input_x   = (output_x * _cp.output_stride_w) + kernel_x - _cp.padding_left;
-                            int64_t input_y   = (output_y * _cp.output_stride_h) + kernel_y - _cp.padding_top;
+                            int64_t input_x =
+                                (output_x * _cp.output_stride_w) + kernel_x * _cp.dilation_w - _cp.padding_left;
+                            int64_t input_y =
+                                (output_y * _cp.output_stride_h) + kernel_y * _cp.dilation_h - _cp.padding_top;
                             int64_t kernel_xy = (kernel_y * _cp.kernel_width) + kernel_x;
                             int64_t input_xy  = (input_y * _cp.input_width) + input_x;
 
@@ -386,7 +913,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
 
     const auto input_width    = static_cast<int64_t>(a->tensor_shape()[1]);
     const auto input_height   = static_cast<int64_t>(a->tensor_shape()[2]);
-    const auto input_channels = static_cast<int64_t>(a->tensor_shape()[0]);
+    const auto input_channels = static_cast<int64_t>(a->tensor_shape()[0] / info.num_groups);
     const auto kernel_width   = static_cast<int64_t>(b->tensor_shape()[2]);
     const auto kernel_height  = static_cast<int64_t>(b->tensor_shape()[3]);
     const auto output_width   = static_cast<int64_t>(d->tensor_shape()[1]);
@@ -401,8 +928,8 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
            output_height,
            info.ps_info.stride().first,
            info.ps_info.stride().second,
-           1,
-           1,
+           static_cast<int64_t>(info.dilation.x()),
+           static_cast<int64_t>(info.dilation.y()),
            info.padding_top,
            info.padding_left,
            zeropad};
@@ -428,6 +955,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
         _indirect_buf = std::vector<const TypeInput *>(multi_size * multis);
         _indirect_arg = std::vector<const TypeInput *const *>(sizeof(TypeInput **) * kernel_hw * multis * batches);
         _indirect_pad = std::vector<TypeInput>(_cp.input_channels, TypeInput(zeropad));
+        _indirect_src = nullptr;
 
         // Set indirect argument
         int64_t pos = 0;
@@ -446,6 +974,138 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirec
     }
 }
 
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_indirect_3d(const ITensorInfo *a,
+                                                                                     const ITensorInfo *b,
+                                                                                     const ITensorInfo *d,
+                                                                                     const AsmGemmInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON(info.method != AsmConvMethod::Indirect3d);
+
+    float zeropad = 0.f;
+    if (is_data_type_quantized(a->data_type()))
+    {
+        zeropad = a->quantization_info().uniform().offset;
+    }
+
+    // The width and height of the volume are kept in the 2D convolution parameters
+    _cp = {static_cast<int64_t>(a->tensor_shape()[1]),
+           static_cast<int64_t>(a->tensor_shape()[2]),
+           static_cast<int64_t>(a->tensor_shape()[0]),
+           static_cast<int64_t>(b->tensor_shape()[2]),
+           static_cast<int64_t>(b->tensor_shape()[3]),
+           static_cast<int64_t>(d->tensor_shape()[1]),
+           static_cast<int64_t>(d->tensor_shape()[2]),
+           static_cast<int64_t>(info.stride_3d.width),
+           static_cast<int64_t>(info.stride_3d.height),
+           1,
+           1,
+           static_cast<int64_t>(info.padding_3d.top),
+           static_cast<int64_t>(info.padding_3d.left),
+           zeropad};
+    _input_depth  = static_cast<int64_t>(a->tensor_shape()[3]);
+    _kernel_depth = static_cast<int64_t>(b->tensor_shape()[4]);
+    _output_depth = static_cast<int64_t>(d->tensor_shape()[3]);
+
+    const size_t batches       = d->tensor_shape().total_size_upper(4);
+    const size_t kernel_points = _cp.kernel_width * _cp.kernel_height * _kernel_depth;
+    const size_t output_points = _cp.output_width * _cp.output_height * _output_depth;
+    const size_t batch_stride  = kernel_points * output_points;
+    _indirect_buf              = std::vector<const TypeInput *>(batch_stride * batches);
+    _indirect_arg              = std::vector<const TypeInput *const *>(kernel_points * batches);
+    _indirect_pad              = std::vector<TypeInput>(_cp.input_channels, TypeInput(zeropad));
+    _indirect_src              = nullptr;
+
+    // One pointer per output point for each kernel point of each batch
+    for (size_t bt = 0; bt < batches; ++bt)
+    {
+        for (size_t k = 0; k < kernel_points; ++k)
+        {
+            _indirect_arg[bt * kernel_points + k] = &_indirect_buf[bt * batch_stride + k * output_points];
+        }
+    }
+
+    _gemm_kernel_asm->set_indirect_parameters(a->tensor_shape()[0], _indirect_arg.data());
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::fill_indirect_buffer_3d(const ITensor *a)
+{
+    const auto *src = reinterpret_cast<const TypeInput *>(a->buffer() + a->info()->offset_first_element_in_bytes());
+    if (src == _indirect_src)
+    {
+        return;
+    }
+    if (_indirect_src != nullptr)
+    {
+        rebase_indirect_buffer(src);
+        return;
+    }
+    _indirect_src = src;
+
+    const ITensorInfo &info          = *a->info();
+    const size_t       stride_w      = info.strides_in_bytes()[1] / sizeof(TypeInput);
+    const size_t       stride_h      = info.strides_in_bytes()[2] / sizeof(TypeInput);
+    const size_t       stride_d      = info.strides_in_bytes()[3] / sizeof(TypeInput);
+    const size_t       stride_n      = info.strides_in_bytes()[4] / sizeof(TypeInput);
+    const int64_t      batches       = info.tensor_shape().total_size_upper(4);
+    const int64_t      kernel_points = _cp.kernel_width * _cp.kernel_height * _kernel_depth;
+    const int64_t      output_points = _cp.output_width * _cp.output_height * _output_depth;
+    const int64_t      rows          = batches * _output_depth * _cp.output_height;
+    const int64_t      stride_z      = static_cast<int64_t>(_gemm_info.stride_3d.depth);
+    const int64_t      padding_front = static_cast<int64_t>(_gemm_info.padding_3d.front);
+
+    // Rows of the output volume (batch, depth, row) are shared between the threads
+    const unsigned int num_threads = std::max<unsigned int>(
+        1U, std::min<unsigned int>(NEScheduler::get().num_threads(), static_cast<unsigned int>(rows)));
+    std::vector<IScheduler::Workload> workloads(num_threads);
+    for (unsigned int t = 0; t < num_threads; ++t)
+    {
+        workloads[t] = [&, t](const ThreadInfo &)
+        {
+            for (int64_t row = t; row < rows; row += num_threads)
+            {
+                const int64_t output_y = row % _cp.output_height;
+                const int64_t output_z = (row / _cp.output_height) % _output_depth;
+                const int64_t bt       = row / (_cp.output_height * _output_depth);
+
+                const TypeInput **buf = _indirect_buf.data() + bt * kernel_points * output_points +
+                                        (output_z * _cp.output_height + output_y) * _cp.output_width;
+                for (int64_t kernel_z = 0; kernel_z < _kernel_depth; ++kernel_z)
+                {
+                    const int64_t input_z = output_z * stride_z + kernel_z - padding_front;
+                    for (int64_t kernel_y = 0; kernel_y < _cp.kernel_height; ++kernel_y)
+                    {
+                        const int64_t input_y = output_y * _cp.output_stride_h + kernel_y - _cp.padding_top;
+                        const bool    valid_zy =
+                            input_z >= 0 && input_z < _input_depth && input_y >= 0 && input_y < _cp.input_height;
+                        for (int64_t kernel_x = 0; kernel_x < _cp.kernel_width; ++kernel_x)
+                        {
+                            const int64_t kernel_xyz =
+                                (kernel_z * _cp.kernel_height + kernel_y) * _cp.kernel_width + kernel_x;
+                            const TypeInput **kernel_buf = buf + kernel_xyz * output_points;
+                            for (int64_t output_x = 0; output_x < _cp.output_width; ++output_x)
+                            {
+                                const int64_t input_x = output_x * _cp.output_stride_w + kernel_x - _cp.padding_left;
+                                if (valid_zy && input_x >= 0 && input_x < _cp.input_width)
+                                {
+                                    kernel_buf[output_x] = src + bt * stride_n + input_z * stride_d +
+                                                           input_y * stride_h + input_x * stride_w;
+                                }
+                                else
+                                {
+                                    kernel_buf[output_x] = _indirect_pad.data();
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        };
+    }
+    NEScheduler::get().run_tagged_workloads(workloads, "CpuGemmAssemblyDispatch/indirect_3d");
+}
+
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
 void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const ITensorInfo *a,
                                                                          const ITensorInfo *b,
@@ -456,8 +1116,28 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
                                                                          const OutputStage &os)
 {
     _is_b_constant = b->are_values_constant();
+    _b_shape       = b->tensor_shape();
+    _b_data_type   = b->data_type();
     _is_c_constant = c ? c->are_values_constant() : true;
 
+    // GEMMs too small in M and N to keep the threads busy are computed as partial results over sections of K
+    const arm_gemm::GemmArgs problem_args = args;
+    if (gemm_info.method == AsmConvMethod::Im2Col && !gemm_info.fixed_format && !gemm_info.transpose_b &&
+        !gemm_info.reinterpret_input_as_3d && gemm_info.depth_output_gemm3d == 0 && gemm_info.num_groups <= 1)
+    {
+        _split_k = split_k_sections<TypeInput, TypeWeight, TypeOutput, OutputStage>(args, os);
+    }
+    if (_split_k > 1)
+    {
+        _split_k_m       = args._Msize;
+        _split_k_n       = args._Nsize;
+        _split_k_batches = args._nbatches;
+        _split_k_act     = args._act;
+        args._Ksize /= _split_k;
+        args._nmulti = _split_k;
+        args._act    = arm_gemm::Activation();
+    }
+
     _gemm_kernel_asm = arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput, OutputStage>(args, os);
     if (_gemm_kernel_asm == nullptr)
     {
@@ -471,8 +1151,29 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
     auto acl_gemm_wrapper = std::make_unique<kernel::CpuGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput>>();
     ARM_COMPUTE_ERROR_ON(acl_gemm_wrapper == nullptr);
     acl_gemm_wrapper->configure(_gemm_kernel_asm.get(), gemm_cfg.filter);
-    const size_t       workspace_size = _gemm_kernel_asm->get_working_size();
+    acl_gemm_wrapper->set_cycle_counter(&_measured_cycles);
+
+    // The kernel selected for the same arguments is the one just instantiated
+    const arm_gemm::KernelDescription desc =
+        arm_gemm::get_gemm_method<TypeInput, TypeWeight, TypeOutput, OutputStage>(args, os);
+    const uint64_t problems  = static_cast<uint64_t>(problem_args._nbatches) * problem_args._nmulti;
+    const uint64_t k_total   = static_cast<uint64_t>(problem_args._Ksize) * problem_args._Ksections;
+    _report.kernel_name      = desc.name;
+    _report.estimated_cycles = desc.cycle_estimate == UINT64_MAX ? 0 : desc.cycle_estimate;
+    _report.macs             = problems * problem_args._Msize * problem_args._Nsize * k_total;
+    _report.bytes            = problems * problem_args._Msize * k_total * sizeof(TypeInput) +
+                    static_cast<uint64_t>(problem_args._nmulti) * problem_args._Nsize * k_total * sizeof(TypeWeight) +
+                    problems * problem_args._Msize * problem_args._Nsize * sizeof(TypeOutput);
+
+    size_t             workspace_size = _gemm_kernel_asm->get_working_size();
     const unsigned int alignment      = 4096;
+    if (_split_k > 1)
+    {
+        // The partial results of the sections of K follow the workspace of arm_gemm
+        const size_t outputs     = static_cast<size_t>(_split_k_batches) * _split_k_m * _split_k_n;
+        _split_k_partials_offset = ceil_to_multiple<size_t, size_t>(workspace_size, 128);
+        workspace_size           = _split_k_partials_offset + _split_k * outputs * sizeof(TypeOutput);
+    }
     _workspace_info                   = TensorInfo(TensorShape(workspace_size), 1, DataType::U8);
     _aux_mem[AsmGemmWorkspace] =
         MemoryInfo(offset_int_vec(AsmGemmWorkspace), MemoryLifetime::Temporary, workspace_size, alignment);
@@ -539,8 +1240,15 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
         const unsigned int alignment           = 128;
         const size_t       B_pretranspose_size = _gemm_kernel_asm->get_B_pretransposed_array_size();
         _pretranspose_info                     = TensorInfo(TensorShape(B_pretranspose_size), 1, DataType::U8);
-        MemoryLifetime lifetime = _is_b_constant ? MemoryLifetime::Persistent : MemoryLifetime::Temporary;
-        _aux_mem[Pretranspose]  = MemoryInfo(offset_int_vec(Pretranspose), lifetime, B_pretranspose_size, alignment);
+
+        // Constant non-quantized weights can be shared with other operators, the array is then owned by the cache
+        _share_pretranspose = _is_b_constant && std::is_same<OutputStage, arm_gemm::Nothing>::value &&
+                              !std::is_integral<TypeInput>::value && CpuSharedWeightsCache::get().is_enabled();
+        if (!_share_pretranspose)
+        {
+            MemoryLifetime lifetime = _is_b_constant ? MemoryLifetime::Persistent : MemoryLifetime::Temporary;
+            _aux_mem[Pretranspose] = MemoryInfo(offset_int_vec(Pretranspose), lifetime, B_pretranspose_size, alignment);
+        }
     }
 
     // Handle indirect GEMM convolution
@@ -548,6 +1256,10 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
     {
         configure_indirect(a, b, d, gemm_info);
     }
+    else if (gemm_info.method == AsmConvMethod::Indirect3d)
+    {
+        configure_indirect_3d(a, b, d, gemm_info);
+    }
 
     if (std::is_same<OutputStage, arm_gemm::DequantizeFloat>::value)
     {
@@ -555,6 +1267,137 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure(const I
         _gemm_kernel_asm->set_dequantize_scale(a->quantization_info().uniform().scale *
                                                b->quantization_info().uniform().scale);
     }
+
+    // Only constant weights owned by the operator and transformed once can be replicated
+    if (NEScheduler::get().numa_weights_replication() && _B_pretranspose_required && _is_b_constant &&
+        !_share_pretranspose && !gemm_info.fixed_format && gemm_info.method == AsmConvMethod::Im2Col &&
+        std::is_same<OutputStage, arm_gemm::Nothing>::value)
+    {
+        configure_numa_replicas(args, os);
+    }
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::configure_numa_replicas(const arm_gemm::GemmArgs &args,
+                                                                                       const OutputStage        &os)
+{
+    // Each thread executes one contiguous range of the window, which must then be 1D and hold a range per thread
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+    if (scheduling_hint_for_window(_optimised_kernel->window()).split_dimension() != Window::DimX ||
+        _gemm_kernel_asm->get_window_size().total_size() < num_threads)
+    {
+        return;
+    }
+
+    // The kernel of a node is the one of the first thread running on it
+    std::map<unsigned int, unsigned int> node_kernel;
+    std::vector<unsigned int>            thread_kernel;
+    for (const auto node : NEScheduler::get().thread_numa_nodes(num_threads))
+    {
+        const unsigned int kernel = node_kernel.emplace(node, node_kernel.size()).first->second;
+        thread_kernel.push_back(kernel);
+    }
+    if (node_kernel.size() < 2)
+    {
+        return;
+    }
+
+    // Force the kernel selected for the first node, so that all the replicas have the same layout
+    arm_gemm::GemmConfig cfg(_gemm_kernel_asm->get_config().method);
+    cfg.filter                      = _gemm_kernel_asm->get_config().filter;
+    arm_gemm::GemmArgs replica_args = args;
+    replica_args._cfg               = &cfg;
+
+    std::vector<std::unique_ptr<arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput>>> kernels;
+    for (size_t i = 1; i < node_kernel.size(); ++i)
+    {
+        auto kernel = arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput, OutputStage>(replica_args, os);
+        if (kernel == nullptr ||
+            kernel->get_B_pretransposed_array_size() != _gemm_kernel_asm->get_B_pretransposed_array_size())
+        {
+            return;
+        }
+        kernels.push_back(std::move(kernel));
+    }
+    _numa_kernels       = std::move(kernels);
+    _numa_thread_kernel = std::move(thread_kernel);
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare_numa_replicas(
+    ITensor *pretranspose, const TypeWeight *b, int ldb, int multi_stride_b, bool transpose)
+{
+    // Forcing 128-byte alignment (required by 32-bit kernels)
+    const unsigned int     alignment = 128;
+    std::vector<uint8_t *> buffers{pretranspose->buffer()};
+    _numa_pretranspose.clear();
+    for (size_t i = 0; i < _numa_kernels.size(); ++i)
+    {
+        auto replica = std::make_unique<Tensor>();
+        replica->allocator()->init(_pretranspose_info, alignment);
+        replica->allocator()->allocate();
+        buffers.push_back(replica->buffer());
+        _numa_pretranspose.push_back(std::move(replica));
+    }
+
+    // The threads of a node share the window of the pretranspose of its array
+    const unsigned int        num_threads = _numa_thread_kernel.size();
+    std::vector<unsigned int> thread_rank(num_threads);
+    std::vector<unsigned int> kernel_threads(buffers.size(), 0);
+    for (unsigned int t = 0; t < num_threads; ++t)
+    {
+        thread_rank[t] = kernel_threads[_numa_thread_kernel[t]]++;
+    }
+
+    std::vector<IScheduler::Workload> workloads(num_threads);
+    for (unsigned int t = 0; t < num_threads; ++t)
+    {
+        const unsigned int k      = _numa_thread_kernel[t];
+        auto              *kernel = k == 0 ? _gemm_kernel_asm.get() : _numa_kernels[k - 1].get();
+        const size_t       wsize  = kernel->get_B_pretranspose_window_size();
+        const size_t       start  = thread_rank[t] * wsize / kernel_threads[k];
+        const size_t       end    = (thread_rank[t] + 1) * wsize / kernel_threads[k];
+        uint8_t           *dst    = buffers[k];
+        workloads[t]              = [=](const ThreadInfo &)
+        {
+            if (start < end)
+            {
+                kernel->pretranspose_B_array_part(dst, b, ldb, multi_stride_b, transpose, start, end);
+            }
+        };
+    }
+    NEScheduler::get().run_tagged_workloads(workloads, "CpuGemmAssemblyDispatch/pretranspose_B_array_numa");
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+bool Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::use_numa_replicas() const
+{
+    return !_numa_kernels.empty() && _numa_thread_kernel.size() == NEScheduler::get().num_threads();
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run_numa_replicas()
+{
+    const Window       window      = _optimised_kernel->window();
+    const unsigned int num_threads = _numa_thread_kernel.size();
+    const size_t       size        = window.x().end() - window.x().start();
+
+    std::vector<IScheduler::Workload> workloads(num_threads);
+    for (unsigned int t = 0; t < num_threads; ++t)
+    {
+        Window win = window;
+        win.set(Window::DimX, Window::Dimension(window.x().start() + t * size / num_threads,
+                                                window.x().start() + (t + 1) * size / num_threads));
+        const arm_gemm::ndcoord_t range = arm_gemm::to_ndcoord(win);
+        workloads[t]                    = [this, range](const ThreadInfo &info)
+        {
+            // The kernel is picked after the thread the workload runs on, which owns its slice of the workspace
+            const unsigned int k      = _numa_thread_kernel[info.thread_id];
+            auto              *kernel = k == 0 ? _gemm_kernel_asm.get() : _numa_kernels[k - 1].get();
+            kernel->execute(range, arm_gemm::ndcoord_t{}, info.thread_id);
+        };
+    }
+    NEScheduler::get().run_tagged_workloads(workloads, "CpuGemmAssemblyDispatch/run_numa");
 }
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
@@ -574,6 +1417,15 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
         }
         const ITensor *b_to_use = b;
 
+        // Imported pretransposed weights replace the whole transformation of B
+        if (_import_pretranspose)
+        {
+            _gemm_kernel_asm->set_pretransposed_B_data(_imported_pretranspose.buffer());
+            b->mark_as_unused();
+            _is_prepared = true;
+            return;
+        }
+
         // Pre-pretranspose B if required
         CpuAuxTensorHandler pre_pretransposed_b(
             offset_int_vec(PrePretransposedB), _pre_pretransposed_b_info, tensors,
@@ -599,31 +1451,238 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::prepare(ITensorPa
             const int  ldb     = b_to_use->info()->strides_in_bytes().y() / b_to_use->info()->element_size();
             const auto in1_ptr = reinterpret_cast<const TypeWeight *>(
                 b_to_use->buffer() + b_to_use->info()->offset_first_element_in_bytes());
-            const int multi_stride_b = b_to_use->info()->strides_in_bytes().z() / b_to_use->info()->element_size();
+            const int multi_stride_b = this->multi_stride_b(*b_to_use);
 
-            CpuAuxTensorHandler pretranspose(offset_int_vec(Pretranspose), _pretranspose_info, tensors, false);
+            const bool kernel_supports_transpose = _gemm_kernel_asm->B_pretranspose_supports_transpose();
+            const bool transpose                 = _B_pre_pretranspose_required && kernel_supports_transpose;
+            if (_share_pretranspose)
+            {
+                // Forcing 128-byte alignment (required by 32-bit kernels)
+                const unsigned int alignment = 128;
+                _shared_pretranspose         = CpuSharedWeightsCache::get().acquire(
+                    pretranspose_cache_key(*b), _pretranspose_info, alignment,
+                    [&](ITensor &pretranspose)
+                    {
+                        run_parallel_pretranspose_B_array<TypeInput, TypeWeight, TypeOutput>(
+                            _gemm_kernel_asm.get(), &pretranspose, in1_ptr, ldb, multi_stride_b,
+                            NEScheduler::get().num_threads(), transpose);
+                    });
+                _gemm_kernel_asm->set_pretransposed_B_data(_shared_pretranspose->buffer());
+            }
+            else
+            {
+                CpuAuxTensorHandler pretranspose(offset_int_vec(Pretranspose), _pretranspose_info, tensors, false);
 
-            ARM_COMPUTE_ERROR_ON(pretranspose.get()->buffer() == nullptr);
+                ARM_COMPUTE_ERROR_ON(pretranspose.get()->buffer() == nullptr);
 
-            const bool kernel_supports_transpose = _gemm_kernel_asm->B_pretranspose_supports_transpose();
-            run_parallel_pretranspose_B_array<TypeInput, TypeWeight, TypeOutput>(
-                _gemm_kernel_asm.get(), pretranspose.get(), in1_ptr, ldb, multi_stride_b,
-                NEScheduler::get().num_threads(), _B_pre_pretranspose_required && kernel_supports_transpose);
+                if (use_numa_replicas())
+                {
+                    prepare_numa_replicas(pretranspose.get(), in1_ptr, ldb, multi_stride_b, transpose);
+                }
+                else
+                {
+                    // The threads are no longer the ones the replicas were planned for
+                    _numa_kernels.clear();
+                    run_parallel_pretranspose_B_array<TypeInput, TypeWeight, TypeOutput>(
+                        _gemm_kernel_asm.get(), pretranspose.get(), in1_ptr, ldb, multi_stride_b,
+                        NEScheduler::get().num_threads(), transpose);
+                }
+            }
 
             b->mark_as_unused();
             // Note that we don't need to mark b_to_use as unused, as if it's been assigned to pre_pretransposed_b,
             // its memory will be auto-managed by the handler
         }
 
-        if (_gemm_info.method == AsmConvMethod::Indirect)
-        {
-            prepare_indirect_buffer(tensors);
-        }
-
         _is_prepared = true;
     }
 }
 
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+int Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::multi_stride_b(const ITensor &b) const
+{
+    if (_split_k > 1)
+    {
+        // The sections of K are consecutive blocks of rows of B
+        return b.info()->strides_in_bytes().y() / b.info()->element_size() * (_b_shape.y() / _split_k);
+    }
+    if (_gemm_info.num_groups > 1)
+    {
+        return b.info()->dimension(0) / _gemm_info.num_groups;
+    }
+    return b.info()->strides_in_bytes().z() / b.info()->element_size();
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+std::string Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::pretranspose_cache_key(const ITensor &b) const
+{
+    // The layout of the pretransposed array depends on the kernel and its blocking
+    const arm_gemm::GemmConfig config = _gemm_kernel_asm->get_config();
+
+    std::stringstream key;
+    key << static_cast<int>(config.method) << ':' << config.filter << ':' << config.inner_block_size << ':'
+        << config.outer_block_size << ':' << _pretranspose_info.total_size() << ':' << _gemm_info.transpose_b << ':'
+        << static_cast<int>(b.info()->data_type());
+    for (size_t d = 0; d < b.info()->num_dimensions(); ++d)
+    {
+        key << ':' << b.info()->dimension(d) << '/' << b.info()->strides_in_bytes()[d];
+    }
+    key << ':' << std::hex << CpuSharedWeightsCache::hash(b);
+    return key.str();
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+std::string Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::pretranspose_export_header() const
+{
+    // The layout of the pretransposed array depends on the kernel and its blocking, the CPU model covers the
+    // microarchitecture specific kernel selection and the vector lengths
+    const arm_gemm::GemmConfig config = _gemm_kernel_asm->get_config();
+    const CPUInfo             &ci     = CPUInfo::get();
+
+    std::stringstream header;
+    header << "ACL_PRETRANSPOSED_B:1:" << cpuinfo::cpu_model_to_string(ci.get_cpu_model()) << ':'
+           << ci.get_sme2_vector_length_in_bytes() << ':' << static_cast<int>(config.method) << ':' << config.filter
+           << ':' << config.inner_block_size << ':' << config.outer_block_size << ':'
+           << _pretranspose_info.total_size() << ':' << _gemm_info.transpose_b << ':'
+           << static_cast<int>(_b_data_type);
+    for (size_t d = 0; d < _b_shape.num_dimensions(); ++d)
+    {
+        header << ':' << _b_shape[d];
+    }
+    return header.str();
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+Status Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::validate_pretranspose_export() const
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_configured(), "The operator is not configured");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!_B_pretranspose_required, "The kernel does not pretranspose the weights");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!_is_b_constant, "Only constant weights can be exported");
+    // Quantized pretransposed arrays embed column sums depending on the quantization parameters
+    const bool is_quantized =
+        !std::is_same<OutputStage, arm_gemm::Nothing>::value || std::is_integral<TypeInput>::value;
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_quantized, "Only non-quantized weights can be exported");
+    return Status{};
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+Status Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::export_pretransposed_weights(
+    ITensorPack &tensors, std::vector<uint8_t> &blob) const
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_pretranspose_export());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!_is_prepared, "The weights can only be exported once prepared");
+
+    const uint8_t *pretransposed = nullptr;
+    if (_import_pretranspose)
+    {
+        pretransposed = _imported_pretranspose.buffer();
+    }
+    else if (_share_pretranspose)
+    {
+        pretransposed = _shared_pretranspose->buffer();
+    }
+    else
+    {
+        const ITensor *pretranspose = tensors.get_const_tensor(offset_int_vec(Pretranspose));
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(pretranspose == nullptr || pretranspose->buffer() == nullptr,
+                                        "The pack does not hold the pretransposed weights");
+        pretransposed = pretranspose->buffer();
+    }
+
+    const std::string header = pretranspose_export_header();
+    const size_t      size   = _pretranspose_info.total_size();
+    blob.resize(header.size() + 1 + size);
+    std::copy(header.begin(), header.end(), blob.begin());
+    blob[header.size()] = '\0';
+    std::copy(pretransposed, pretransposed + size, blob.begin() + header.size() + 1);
+    return Status{};
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+Status
+Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::import_pretransposed_weights(const std::vector<uint8_t> &blob)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_pretranspose_export());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_is_prepared, "The weights must be imported before the operator is prepared");
+
+    const std::string header = pretranspose_export_header();
+    const size_t      size   = _pretranspose_info.total_size();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(blob.size() != header.size() + 1 + size ||
+                                        !std::equal(header.begin(), header.end(), blob.begin()) ||
+                                        blob[header.size()] != '\0',
+                                    "The weights were exported for a different kernel, problem or CPU");
+
+    // Forcing 128-byte alignment (required by 32-bit kernels)
+    const unsigned int alignment = 128;
+    _imported_pretranspose.allocator()->init(_pretranspose_info, alignment);
+    _imported_pretranspose.allocator()->allocate();
+    std::copy(blob.begin() + header.size() + 1, blob.end(), _imported_pretranspose.buffer());
+    _import_pretranspose = true;
+
+    // B is no longer transformed, its workspace is not needed
+    _aux_mem[PrePretransposedB] = MemoryInfo();
+    _aux_mem[Pretranspose]      = MemoryInfo();
+    _numa_kernels.clear();
+    return Status{};
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+AsmGemmReport Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::report() const
+{
+    AsmGemmReport report   = _report;
+    report.runs            = _measured_runs.load();
+    report.measured_ns     = _measured_ns.load();
+    report.measured_cycles = _measured_cycles.load();
+    return report;
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
+OperatorDescription Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::describe() const
+{
+    OperatorDescription desc{};
+    desc.name = "CpuGemmAssemblyDispatch";
+    switch (_gemm_info.method)
+    {
+        case AsmConvMethod::Indirect:
+            desc.method = "Indirect";
+            break;
+        case AsmConvMethod::Conv:
+            desc.method = "Conv";
+            break;
+        case AsmConvMethod::Indirect3d:
+            desc.method = "Indirect3d";
+            break;
+        default:
+            desc.method = "Im2Col";
+            break;
+    }
+    if (_gemm_kernel_asm != nullptr)
+    {
+        const arm_gemm::GemmConfig cfg = _gemm_kernel_asm->get_config();
+        std::stringstream          ss;
+        ss << gemm_method_to_string(cfg.method) << " inner_block_size=" << cfg.inner_block_size
+           << " outer_block_size=" << cfg.outer_block_size
+           << " weight_format=" << to_string(assembly_utils::map_to_arm_compute_weight_format(cfg.weight_format));
+        desc.gemm_strategy    = cfg.filter.empty() ? _report.kernel_name : cfg.filter;
+        desc.gemm_config      = ss.str();
+        desc.estimated_cycles = _report.estimated_cycles;
+    }
+    if (_optimised_kernel != nullptr)
+    {
+        desc.kernels.emplace_back(_optimised_kernel->name());
+        desc.split_dimension = split_dimension_to_string(scheduling_hint_for_window(_optimised_kernel->window()));
+    }
+    if (_run_pre_pretranspose_b && _pre_pretranspose_b != nullptr)
+    {
+        desc.children.emplace_back(_pre_pretranspose_b->describe());
+    }
+    for (const auto &mem : _aux_mem)
+    {
+        desc.workspace_bytes += mem.size;
+    }
+    return desc;
+}
+
 template <typename TypeInput, typename TypeWeight, typename TypeOutput, class OutputStage>
 bool Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::is_configured() const
 {
@@ -645,30 +1704,56 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     auto d = tensors.get_tensor(TensorType::ACL_DST);
     ARM_COMPUTE_ERROR_ON_NULLPTR(a, d);
 
+    const bool is_dynamic_dequantize =
+        std::is_same<OutputStage, arm_gemm::DequantizeFloat>::value &&
+        (a->info()->quantization_info().is_dynamic() || b->info()->quantization_info().is_dynamic());
+    const bool is_dynamic_bias = c && !_is_c_constant && c->info()->data_type() == DataType::S32;
+
+    // Fixed-format kernels run through the stateless execution of arm_gemm, with the operands and the workspace
+    // of the call packed. Every other run updates the state of the shared assembly kernel and is serialised so
+    // that a prepared operator can be run from several threads at once.
+    const bool is_stateless = _gemm_info.fixed_format && _gemm_info.method != AsmConvMethod::Indirect &&
+                              _gemm_info.method != AsmConvMethod::Indirect3d && !is_dynamic_dequantize &&
+                              !is_dynamic_bias;
+    std::unique_lock<std::mutex> lock(_run_mutex, std::defer_lock);
+    if (!is_stateless)
+    {
+        lock.lock();
+    }
+
     // Only update at runtime if the src quantization is dynamic
-    if (std::is_same<OutputStage, arm_gemm::DequantizeFloat>::value &&
-        (a->info()->quantization_info().is_dynamic() || b->info()->quantization_info().is_dynamic()))
+    if (is_dynamic_dequantize)
     {
         // Output dequantization is just the two src scales multiplied together
         _gemm_kernel_asm->set_dequantize_scale(a->info()->quantization_info().uniform().scale *
                                                b->info()->quantization_info().uniform().scale);
     }
 
-    int       lda = a->info()->strides_in_bytes().y() / a->info()->element_size();
-    int       ldb = 0;
-    const int ldd = d->info()->strides_in_bytes().y() / d->info()->element_size();
+    int lda = a->info()->strides_in_bytes().y() / a->info()->element_size();
+    int ldb = 0;
+    int ldd = d->info()->strides_in_bytes().y() / d->info()->element_size();
 
     const size_t a_batch_idx = _gemm_info.reinterpret_input_as_3d != 0 ? 3 : 2;
     const size_t a_multi_idx = a_batch_idx + 1;
-    const size_t d_batch_idx = _gemm_info.depth_output_gemm3d != 0 ? 3 : 2;
+    const size_t d_batch_idx = _gemm_info.method == AsmConvMethod::Indirect3d ? 4
+                               : _gemm_info.depth_output_gemm3d != 0         ? 3
+                                                                             : 2;
     const size_t d_multi_idx = d_batch_idx + 1;
 
-    int       batch_stride_a = a->info()->strides_in_bytes()[a_batch_idx] / a->info()->element_size();
-    const int batch_stride_d = d->info()->strides_in_bytes()[d_batch_idx] / d->info()->element_size();
+    int batch_stride_a = a->info()->strides_in_bytes()[a_batch_idx] / a->info()->element_size();
+    int batch_stride_d = d->info()->strides_in_bytes()[d_batch_idx] / d->info()->element_size();
 
-    int       multi_stride_a = a->info()->strides_in_bytes()[a_multi_idx] / a->info()->element_size();
-    int       multi_stride_b = 0;
-    const int multi_stride_d = d->info()->strides_in_bytes()[d_multi_idx] / d->info()->element_size();
+    int multi_stride_a = a->info()->strides_in_bytes()[a_multi_idx] / a->info()->element_size();
+    int multi_stride_b = 0;
+    int multi_stride_d = d->info()->strides_in_bytes()[d_multi_idx] / d->info()->element_size();
+    int multi_stride_c = 0;
+    if (_gemm_info.num_groups > 1)
+    {
+        // Each group reads its slice of the input channels and writes its slice of the output channels and the bias
+        multi_stride_a = a->info()->dimension(0) / _gemm_info.num_groups;
+        multi_stride_d = d->info()->dimension(0) / _gemm_info.num_groups;
+        multi_stride_c = multi_stride_d;
+    }
 
     auto in0_ptr = reinterpret_cast<const TypeInput *>(a->buffer() + a->info()->offset_first_element_in_bytes());
     const TypeWeight *in1_ptr = nullptr;
@@ -693,7 +1778,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     if (b_to_use && !_gemm_kernel_asm->B_is_pretransposed())
     {
         ldb            = b_to_use->info()->strides_in_bytes().y() / b_to_use->info()->element_size();
-        multi_stride_b = b_to_use->info()->strides_in_bytes().z() / b_to_use->info()->element_size();
+        multi_stride_b = this->multi_stride_b(*b_to_use);
         in1_ptr        = reinterpret_cast<const TypeWeight *>(b_to_use->buffer() +
                                                        b_to_use->info()->offset_first_element_in_bytes());
     }
@@ -716,7 +1801,7 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
             const int  ldb            = b_to_use->info()->strides_in_bytes().y() / b_to_use->info()->element_size();
             const auto b_ptr          = reinterpret_cast<const TypeWeight *>(b_to_use->buffer() +
                                                                     b_to_use->info()->offset_first_element_in_bytes());
-            const int  multi_stride_b = b_to_use->info()->strides_in_bytes().z() / b_to_use->info()->element_size();
+            const int  multi_stride_b = this->multi_stride_b(*b_to_use);
 
             CpuAuxTensorHandler pretranspose(offset_int_vec(Pretranspose), _pretranspose_info, tensors, true);
             ARM_COMPUTE_ERROR_ON(pretranspose.get()->buffer() == nullptr);
@@ -736,23 +1821,11 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     }
 
     // The scheduling_hint needs to be compatible with the window exposed by arm_gemm
-    // The default case is when we split among the X dimension
-    IScheduler::Hints scheduling_hint = IScheduler::Hints(Window::DimX);
-    // If arm_gemm exposes a 2D window, perform 2D scheduling
-    if (_optimised_kernel->window().num_iterations(Window::DimY) > 1 &&
-        _optimised_kernel->window().num_iterations(Window::DimX) > 1)
-    {
-        scheduling_hint = IScheduler::Hints(IScheduler::split_dimensions_all);
-    }
-    // Split among Y
-    else if (_optimised_kernel->window().num_iterations(Window::DimY) > 1)
-    {
-        scheduling_hint = IScheduler::Hints(Window::DimY);
-    }
+    const IScheduler::Hints scheduling_hint = scheduling_hint_for_window(_optimised_kernel->window());
 
     // Set workspace if needed and reset number of threads as buffer manager gets re-created with max_threads
     CpuAuxTensorHandler workspace(offset_int_vec(AsmGemmWorkspace), _workspace_info, tensors, false);
-    if (workspace.get()->buffer() != nullptr)
+    if (workspace.get()->buffer() != nullptr && !is_stateless)
     {
         _gemm_kernel_asm->set_working_space(reinterpret_cast<void *>(workspace.get()->buffer()));
         const unsigned int split_dim   = scheduling_hint.split_dimension();
@@ -769,19 +1842,35 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
             num_threads                       = std::min(num_iterations, num_threads);
         }
         _gemm_kernel_asm->set_nthreads(num_threads);
+        for (auto &kernel : _numa_kernels)
+        {
+            // The threads of the replicas have their own ids, hence their own slices of the same workspace
+            kernel->set_working_space(reinterpret_cast<void *>(workspace.get()->buffer()));
+            kernel->set_nthreads(num_threads);
+        }
     }
 
     // Prepare assembly kernel
     prepare(tensors);
 
     // Setup up matrix bias in the assembly kernel, it's just a pointer to matrix C.
+    // An S32 bias is applied by the requantization, unless the output is S32 and not requantized.
     TypeOutput *bias = nullptr;
-    if (c && c->info()->data_type() != DataType::S32)
+    if (c && (c->info()->data_type() != DataType::S32 || std::is_same<OutputStage, arm_gemm::Nothing>::value))
     {
         bias = reinterpret_cast<TypeOutput *>(c->buffer() + c->info()->offset_first_element_in_bytes());
     }
 
     if (_gemm_info.method == AsmConvMethod::Indirect)
+    {
+        fill_indirect_buffer(a);
+    }
+    else if (_gemm_info.method == AsmConvMethod::Indirect3d)
+    {
+        fill_indirect_buffer_3d(a);
+    }
+
+    if (_gemm_info.method == AsmConvMethod::Indirect || _gemm_info.method == AsmConvMethod::Indirect3d)
     {
         in0_ptr        = nullptr;
         lda            = 0;
@@ -789,9 +1878,50 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
         multi_stride_a = 0;
     }
 
+    // The sections of K read consecutive blocks of columns of A and write their partial results to the workspace,
+    // they are summed once all of them are computed
+    TypeOutput *const split_k_partials =
+        _split_k > 1 ? reinterpret_cast<TypeOutput *>(workspace.get()->buffer() + _split_k_partials_offset) : nullptr;
+    TypeOutput *const split_k_dst            = out_ptr;
+    const TypeOutput *split_k_bias           = bias;
+    const int         split_k_ldd            = ldd;
+    const int         split_k_batch_stride_d = batch_stride_d;
+    if (_split_k > 1)
+    {
+        multi_stride_a = _b_shape.y() / _split_k;
+        out_ptr        = split_k_partials;
+        ldd            = _split_k_n;
+        batch_stride_d = _split_k_m * _split_k_n;
+        multi_stride_d = _split_k_batches * batch_stride_d;
+        bias           = nullptr;
+        multi_stride_c = 0;
+    }
+
     // Set gemm parameters
-    _gemm_kernel_asm->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b, out_ptr,
-                                 ldd, batch_stride_d, multi_stride_d, bias, 0);
+    if (!is_stateless)
+    {
+        _gemm_kernel_asm->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b,
+                                     out_ptr, ldd, batch_stride_d, multi_stride_d, bias, multi_stride_c);
+        for (auto &kernel : _numa_kernels)
+        {
+            kernel->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b, out_ptr,
+                               ldd, batch_stride_d, multi_stride_d, bias, multi_stride_c);
+        }
+    }
+    else
+    {
+        // The stateless execution only takes the strides from the kernel, they are the same for every call
+        std::lock_guard<std::mutex> guard(_run_mutex);
+        if (!_stateless_arrays_set)
+        {
+            _gemm_kernel_asm->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b,
+                                         out_ptr, ldd, batch_stride_d, multi_stride_d, bias, multi_stride_c);
+            _stateless_arrays_set = true;
+        }
+    }
+
+    // Only the execution of the kernel is measured
+    ScopedRunTimer timer(_measured_runs, _measured_ns);
 
     // Need to pack the input/output pointers separately to use the thread-safe,
     // stateless-execution interface for fixed-format kernels.
@@ -833,7 +1963,20 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
     }
 
     // Schedule
-    NEScheduler::get().schedule(_optimised_kernel.get(), scheduling_hint);
+    if (use_numa_replicas())
+    {
+        run_numa_replicas();
+    }
+    else
+    {
+        NEScheduler::get().schedule(_optimised_kernel.get(), scheduling_hint);
+    }
+
+    if (_split_k > 1)
+    {
+        run_split_k_reduction(split_k_partials, _split_k, _split_k_m, _split_k_n, _split_k_batches, split_k_bias,
+                              _split_k_act, split_k_dst, split_k_ldd, split_k_batch_stride_d);
+    }
 }
 
 template <typename TypeInput, typename TypeWeight, typename TypeOutput>
@@ -859,6 +2002,11 @@ void create_arm_gemm(std::unique_ptr<CpuGemmAssemblyDispatch::IFallback> &arm_ge
     arm_gemm::GemmArgs args(&ci, p.M, p.N, p.K, p.sections, p.batches, p.multis, p.indirect, activation, num_threads,
                             info.fixed_format, fast_mode, info.accumulate, &cfg);
 
+    // Prefer the kernel measured fastest for this problem over the static heuristics
+    const std::string types = string_from_data_type(a->data_type()) + "," + string_from_data_type(b->data_type()) +
+                              "," + string_from_data_type(d->data_type());
+    apply_tuned_gemm_config<TypeInput, TypeWeight, TypeOutput>(args, cfg, types);
+
     // Create arm_gemm fallback
     auto fallback = std::make_unique<Fallback<TypeInput, TypeWeight, TypeOutput>>();
     fallback->configure(a, b, c, d, args, info);
@@ -967,6 +2115,9 @@ Status CpuGemmAssemblyDispatch::has_opt_impl(arm_compute::WeightFormat &expected
     const CPUInfo       &ci          = NEScheduler::get().cpu_info();
     unsigned int         num_threads = NEScheduler::get().num_threads();
 
+    // Register the calibrated kernel figures, if any, before arm_gemm ranks its kernels
+    CpuGemmProfile::get();
+
     // If fast_mode is disabled, we must enable it when fp32 accumulation is not set for fp16.
     bool is_fp16 =
         a->data_type() == DataType::F16 && b->data_type() == DataType::F16 && d->data_type() == DataType::F16;
@@ -1087,6 +2238,16 @@ Status CpuGemmAssemblyDispatch::validate(
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_BF16_UNSUPPORTED(a);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(!(info.reshape_b_only_on_first_run),
                                     "Assembly kernel will not be executed when reshape_b_only_on_first_run is false");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.num_groups == 0);
+    if (info.num_groups > 1)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.method != AsmConvMethod::Conv,
+                                        "Grouping is only supported by the Conv method");
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F16, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.fixed_format, "Grouping is not supported with fixed format weights");
+        ARM_COMPUTE_RETURN_ERROR_ON((a->dimension(0) % info.num_groups) != 0 ||
+                                    (d->dimension(0) % info.num_groups) != 0);
+    }
 
 #ifndef __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->element_size() == 1, "8bit integer types only supported for aarch64");
@@ -1159,6 +2320,9 @@ void CpuGemmAssemblyDispatch::configure(
         return;
     }
 
+    // Register the calibrated kernel figures, if any, before arm_gemm ranks its kernels
+    CpuGemmProfile::get();
+
     switch (a->data_type())
     {
         case DataType::F32:
@@ -1261,6 +2425,40 @@ experimental::MemoryRequirements CpuGemmAssemblyDispatch::workspace() const
     return _arm_gemm->workspace();
 }
 
+Status CpuGemmAssemblyDispatch::export_pretransposed_weights(ITensorPack &tensors, std::vector<uint8_t> &blob) const
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_arm_gemm == nullptr, "The operator is not configured");
+    return _arm_gemm->export_pretransposed_weights(tensors, blob);
+}
+
+Status CpuGemmAssemblyDispatch::import_pretransposed_weights(const std::vector<uint8_t> &blob)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_arm_gemm == nullptr, "The operator is not configured");
+    return _arm_gemm->import_pretransposed_weights(blob);
+}
+
+AsmGemmReport CpuGemmAssemblyDispatch::report() const
+{
+    ARM_COMPUTE_ERROR_ON(_arm_gemm == nullptr);
+    return _arm_gemm->report();
+}
+
+OperatorDescription CpuGemmAssemblyDispatch::describe() const
+{
+    if (_arm_gemm == nullptr)
+    {
+        OperatorDescription desc{};
+        desc.name = "CpuGemmAssemblyDispatch";
+        return desc;
+    }
+    return _arm_gemm->describe();
+}
+
+void CpuGemmAssemblyDispatch::enable_reports(bool enabled)
+{
+    set_cycle_counting_enabled(enabled);
+}
+
 void CpuGemmAssemblyDispatch::update_quantization_parameters(const GEMMLowpOutputStageInfo &output_info,
                                                              const QuantizationInfo        &a,
                                                              const QuantizationInfo        &b,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025 Arm Limited.
+ * Copyright (c) 2018-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,10 @@
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuOperator.h"
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 namespace arm_compute
 {
 namespace cpu
@@ -38,7 +42,8 @@ enum class AsmConvMethod
 {
     Im2Col,
     Indirect,
-    Conv
+    Conv,
+    Indirect3d /**< Indirect GEMM over a NDHWC volume, the kernel points are the GEMM sections */
 };
 
 struct AsmGemmInfo
@@ -52,6 +57,10 @@ struct AsmGemmInfo
     bool                      depth_output_gemm3d{false};
     int64_t                   padding_top{0};
     int64_t                   padding_left{0};
+    Size2D                    dilation{1U, 1U}; /**< Dilation of the kernel for the Conv and Indirect methods */
+    unsigned int              num_groups{1U}; /**< Groups of the Conv method, each one is a multi of the GEMM */
+    Padding3D                 padding_3d{}; /**< Padding of the volume for @ref AsmConvMethod::Indirect3d */
+    Size3D                    stride_3d{1U, 1U, 1U}; /**< Strides of the volume for @ref AsmConvMethod::Indirect3d */
     float                     padding_value{0.f};
     bool                      fast_mode{false};
     bool                      fixed_format{false};
@@ -68,6 +77,18 @@ struct AsmGemmInfo
     bool transpose_b{false};
 };
 
+/** Performance report of an assembly GEMM, comparing the throughput achieved to the one expected by arm_gemm */
+struct AsmGemmReport
+{
+    std::string kernel_name{};       /**< Name of the arm_gemm kernel */
+    uint64_t    macs{0};             /**< Multiply-accumulates of a run */
+    uint64_t    bytes{0};            /**< Bytes of the A, B and D matrices read or written by a run */
+    uint64_t    estimated_cycles{0}; /**< Cycles of a run estimated by arm_gemm, 0 if the kernel has no estimate */
+    uint64_t    runs{0};             /**< Number of runs measured */
+    uint64_t    measured_ns{0};      /**< Wall-clock time of the measured runs, in nanoseconds */
+    uint64_t    measured_cycles{0};  /**< CPU cycles of the measured runs counted by the PMU, 0 if it cannot be read */
+};
+
 /** Assembly kernel glue */
 class CpuGemmAssemblyDispatch : public ICpuOperator
 {
@@ -92,6 +113,10 @@ public:
                                                                                 const QuantizationInfo &,
                                                                                 const bool,
                                                                                 const bool) = 0;
+        virtual Status export_pretransposed_weights(ITensorPack &tensors, std::vector<uint8_t> &blob) const = 0;
+        virtual Status import_pretransposed_weights(const std::vector<uint8_t> &blob)                   = 0;
+        virtual AsmGemmReport report() const                                                             = 0;
+        virtual OperatorDescription describe() const                                                     = 0;
         virtual ~IFallback()                                                                = default;
     };
 
@@ -197,11 +222,53 @@ public:
                                         const QuantizationInfo        &b,
                                         const bool                     is_prepared,
                                         const bool                     negated_offsets);
+    /** Exports the pretransposed weights so that they can be imported by another operator without pretransposing them
+     *
+     * The blob starts with a header identifying the kernel, its blocking and the CPU the weights were pretransposed
+     * for, followed by the pretransposed B array.
+     *
+     * @note Only available once prepared, for kernels pretransposing constant non-quantized weights
+     *
+     * @param[in]  tensors Tensor pack holding the workspace the operator was prepared with
+     * @param[out] blob    Exported pretransposed weights
+     *
+     * @return a status
+     */
+    Status export_pretransposed_weights(ITensorPack &tensors, std::vector<uint8_t> &blob) const;
+    /** Imports weights exported by @ref export_pretransposed_weights, prepare() then skips the pretranspose of B
+     *
+     * The import fails when the blob was exported for a different kernel, problem size or CPU.
+     *
+     * @note Must be called after configure() and before the first prepare(). The Pretranspose workspace is no longer
+     *       requested on success, so the memory requirements have to be queried again.
+     *
+     * @param[in] blob Pretransposed weights. Copied, the blob can be released afterwards.
+     *
+     * @return a status
+     */
+    Status import_pretransposed_weights(const std::vector<uint8_t> &blob);
+    /** Reports the throughput achieved by the assembly kernel against the estimate of arm_gemm
+     *
+     * The estimated and measured cycles are both summed over the threads the kernel runs on. The runs are only
+     * measured while reports are enabled, the preparation of the weights is not included.
+     *
+     * @return The report of the runs measured so far
+     */
+    AsmGemmReport report() const;
+    /** Enables or disables the measurement of the runs of all the assembly GEMMs
+     *
+     * @note Disabled by default, unless the environment variable ARM_COMPUTE_CPU_GEMM_REPORT is set to 1. The PMU is
+     *       read around the work of each thread when enabled.
+     *
+     * @param[in] enabled Whether to measure the runs
+     */
+    static void enable_reports(bool enabled);
 
     // Inherited methods overridden:
     void                             prepare(ITensorPack &tensors) override;
     void                             run(ITensorPack &tensors) override;
     experimental::MemoryRequirements workspace() const override;
+    OperatorDescription              describe() const override;
 
 private:
     std::unique_ptr<IFallback> _arm_gemm; /**< Interface for the arm_gemm fallback */
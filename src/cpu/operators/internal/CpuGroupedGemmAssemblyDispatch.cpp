@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/internal/CpuGroupedGemmAssemblyDispatch.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/core/utils/AssemblyUtils.h"
+#include "src/cpu/kernels/assembly/arm_gemm.hpp"
+#include "src/cpu/kernels/assembly/CpuGroupedGemmAssemblyWrapperKernel.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+#include "src/cpu/utils/CpuGemmProfile.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+using namespace arm_compute::experimental;
+
+namespace
+{
+/** First id of the per-problem tensors, past the ids used for the auxiliary tensors */
+constexpr int grouped_tensor_id_base = 2 * ACL_INT_VEC;
+/** Number of ids reserved for each problem */
+constexpr int grouped_tensor_id_stride = ACL_DST_END + 1;
+
+/** Round @p size up to a multiple of @p alignment */
+size_t align_up(size_t size, size_t alignment)
+{
+    return ((size + alignment - 1) / alignment) * alignment;
+}
+
+/** Grouped arm_gemm fallback */
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+class GroupedFallback : public CpuGroupedGemmAssemblyDispatch::IFallback
+{
+public:
+    /** Initialise the arm_gemm kernel of every problem
+     *
+     * @param[in] problems   Problems to compute.
+     * @param[in] activation Activation fused in every problem.
+     * @param[in] info       GEMM meta-data.
+     */
+    void configure(const std::vector<AsmGemmProblem> &problems,
+                   arm_gemm::Activation               activation,
+                   const AsmGemmInfo                 &info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    bool                             is_configured() const override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        AsmGemmWorkspace = 0,
+        Pretranspose,
+        Count
+    };
+
+    /** Pretranspose the B of every problem requiring it, as a single parallel job */
+    void pretranspose_B(ITensorPack &tensors);
+
+    /** Assembly Gemm kernel of each problem */
+    std::vector<arm_gemm::UniqueGemmCommon<TypeInput, TypeWeight, TypeOutput>> _gemms{};
+    /** Optimised Arm® Neon™ kernel running all the problems */
+    std::unique_ptr<kernel::CpuGroupedGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput>> _optimised_kernel{
+        nullptr};
+    /** Offset of the working space of each problem in the workspace tensor */
+    std::vector<size_t> _workspace_offsets{};
+    /** Offset of the pretransposed B of each problem in the pretranspose tensor */
+    std::vector<size_t> _pretranspose_offsets{};
+    /** Assembly GEMM workspace tensor info */
+    TensorInfo _workspace_info{};
+    /** Pre-transpose tensor info */
+    TensorInfo _pretranspose_info{};
+    /** Number of threads the kernels were created for */
+    unsigned int                     _num_threads{1};
+    bool                             _is_b_constant{true};
+    bool                             _is_prepared{false};
+    experimental::MemoryRequirements _aux_mem{Count};
+};
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+void GroupedFallback<TypeInput, TypeWeight, TypeOutput>::configure(const std::vector<AsmGemmProblem> &problems,
+                                                                   arm_gemm::Activation               activation,
+                                                                   const AsmGemmInfo                 &info)
+{
+    const CPUInfo &ci = NEScheduler::get().cpu_info();
+    _num_threads      = NEScheduler::get().num_threads();
+
+    // If fast_mode is disabled, we must enable it when fp32 accumulation is not set for fp16.
+    const bool is_fp16   = problems[0].a->data_type() == DataType::F16;
+    const bool fast_mode = info.fast_mode || (is_fp16 && !info.use_fp32_acc);
+
+    // Forcing 128-byte alignment of each problem's buffers (required by 32-bit kernels)
+    const size_t alignment         = 128;
+    size_t       workspace_size    = 0;
+    size_t       pretranspose_size = 0;
+
+    std::vector<arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput> *> kernels;
+    for (const auto &p : problems)
+    {
+        const unsigned int M       = p.d->tensor_shape().y();
+        const unsigned int N       = p.d->tensor_shape().x();
+        const unsigned int K       = p.a->tensor_shape().x();
+        const unsigned int multis  = p.b->tensor_shape().z();
+        const unsigned int batches = p.d->tensor_shape().total_size_upper(2) / multis;
+
+        // Any thread can run tiles of any problem, so every kernel is sized for all the threads
+        arm_gemm::GemmArgs args(&ci, M, N, K, 1, batches, multis, false, activation, _num_threads, false, fast_mode,
+                                info.accumulate);
+        auto gemm = arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput>(args);
+        if (gemm == nullptr)
+        {
+            //configuration not supported: Leave function unconfigured:
+            _gemms.clear();
+            return;
+        }
+
+        _workspace_offsets.push_back(workspace_size);
+        workspace_size += align_up(gemm->get_working_size(), alignment);
+
+        _pretranspose_offsets.push_back(pretranspose_size);
+        if (gemm->B_pretranspose_required())
+        {
+            pretranspose_size += align_up(gemm->get_B_pretransposed_array_size(), alignment);
+        }
+
+        _is_b_constant = _is_b_constant && p.b->are_values_constant();
+        kernels.push_back(gemm.get());
+        _gemms.push_back(std::move(gemm));
+    }
+
+    _optimised_kernel = std::make_unique<kernel::CpuGroupedGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput>>();
+    _optimised_kernel->configure(kernels, _gemms[0]->get_config().filter);
+
+    _workspace_info = TensorInfo(TensorShape(workspace_size), 1, DataType::U8);
+    _aux_mem[AsmGemmWorkspace] =
+        MemoryInfo(offset_int_vec(AsmGemmWorkspace), MemoryLifetime::Temporary, workspace_size, 4096);
+
+    if (pretranspose_size > 0)
+    {
+        _pretranspose_info      = TensorInfo(TensorShape(pretranspose_size), 1, DataType::U8);
+        MemoryLifetime lifetime = _is_b_constant ? MemoryLifetime::Persistent : MemoryLifetime::Temporary;
+        _aux_mem[Pretranspose] = MemoryInfo(offset_int_vec(Pretranspose), lifetime, pretranspose_size, alignment);
+    }
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+void GroupedFallback<TypeInput, TypeWeight, TypeOutput>::pretranspose_B(ITensorPack &tensors)
+{
+    if (_pretranspose_info.total_size() == 0)
+    {
+        return;
+    }
+
+    CpuAuxTensorHandler pretranspose(offset_int_vec(Pretranspose), _pretranspose_info, tensors, false);
+    ARM_COMPUTE_ERROR_ON(pretranspose.get()->buffer() == nullptr);
+    uint8_t *const dst = pretranspose.get()->buffer();
+
+    // Lay the pretranspose windows of all the problems end to end, like the GEMM tiles
+    std::vector<unsigned int>       offsets(1, 0U);
+    std::vector<const TypeWeight *> srcs(_gemms.size(), nullptr);
+    std::vector<int>                lds(_gemms.size(), 0);
+    std::vector<int>                multi_strides(_gemms.size(), 0);
+    for (size_t i = 0; i < _gemms.size(); ++i)
+    {
+        unsigned int wsize = 0;
+        if (_gemms[i]->B_pretranspose_required())
+        {
+            const ITensor *b = tensors.get_const_tensor(CpuGroupedGemmAssemblyDispatch::tensor_id(i, ACL_SRC_1));
+            ARM_COMPUTE_ERROR_ON_NULLPTR(b);
+            srcs[i] = reinterpret_cast<const TypeWeight *>(b->buffer() + b->info()->offset_first_element_in_bytes());
+            lds[i]  = b->info()->strides_in_bytes().y() / b->info()->element_size();
+            multi_strides[i] = b->info()->strides_in_bytes().z() / b->info()->element_size();
+            wsize            = _gemms[i]->get_B_pretranspose_window_size();
+        }
+        offsets.push_back(offsets.back() + wsize);
+    }
+
+    const unsigned int total         = offsets.back();
+    const unsigned int workload_size = std::max(1U, std::min(total, NEScheduler::get().num_threads()));
+
+    std::vector<IScheduler::Workload> workloads(workload_size);
+    for (unsigned int t = 0; t < workload_size; ++t)
+    {
+        workloads[t] = [&, t](const ThreadInfo &)
+        {
+            const unsigned int start = (total * t) / workload_size;
+            const unsigned int end   = (total * (t + 1)) / workload_size;
+            for (size_t i = 0; i < _gemms.size(); ++i)
+            {
+                const unsigned int first = std::max(start, offsets[i]);
+                const unsigned int last  = std::min(end, offsets[i + 1]);
+                if (first < last)
+                {
+                    _gemms[i]->pretranspose_B_array_part(dst + _pretranspose_offsets[i], srcs[i], lds[i],
+                                                         multi_strides[i], false, first - offsets[i],
+                                                         last - offsets[i]);
+                }
+            }
+        };
+    }
+    NEScheduler::get().run_tagged_workloads(workloads, "CpuGroupedGemmAssemblyDispatch/pretranspose_B_array");
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+void GroupedFallback<TypeInput, TypeWeight, TypeOutput>::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        if (_is_b_constant)
+        {
+            pretranspose_B(tensors);
+            for (size_t i = 0; i < _gemms.size(); ++i)
+            {
+                if (_gemms[i]->B_pretranspose_required())
+                {
+                    tensors.get_const_tensor(CpuGroupedGemmAssemblyDispatch::tensor_id(i, ACL_SRC_1))
+                        ->mark_as_unused();
+                }
+            }
+        }
+        _is_prepared = true;
+    }
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+bool GroupedFallback<TypeInput, TypeWeight, TypeOutput>::is_configured() const
+{
+    return _optimised_kernel != nullptr;
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+experimental::MemoryRequirements GroupedFallback<TypeInput, TypeWeight, TypeOutput>::workspace() const
+{
+    return _aux_mem;
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+void GroupedFallback<TypeInput, TypeWeight, TypeOutput>::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(NEScheduler::get().num_threads() > _num_threads,
+                             "The grouped GEMM was configured for fewer threads than the scheduler runs");
+
+    // Weights changing between runs are pretransposed on every run
+    if (!_is_b_constant)
+    {
+        pretranspose_B(tensors);
+    }
+    prepare(tensors);
+
+    CpuAuxTensorHandler workspace(offset_int_vec(AsmGemmWorkspace), _workspace_info, tensors, false);
+
+    for (size_t i = 0; i < _gemms.size(); ++i)
+    {
+        auto *const gemm = _gemms[i].get();
+
+        const ITensor *a = tensors.get_const_tensor(CpuGroupedGemmAssemblyDispatch::tensor_id(i, ACL_SRC_0));
+        const ITensor *b = tensors.get_const_tensor(CpuGroupedGemmAssemblyDispatch::tensor_id(i, ACL_SRC_1));
+        const ITensor *c = tensors.get_const_tensor(CpuGroupedGemmAssemblyDispatch::tensor_id(i, ACL_SRC_2));
+        ITensor       *d = tensors.get_tensor(CpuGroupedGemmAssemblyDispatch::tensor_id(i, ACL_DST));
+        ARM_COMPUTE_ERROR_ON_NULLPTR(a, d);
+
+        if (gemm->get_working_size() > 0)
+        {
+            gemm->set_working_space(workspace.get()->buffer() + _workspace_offsets[i]);
+        }
+
+        const ITensorInfo *a_info         = a->info();
+        const ITensorInfo *d_info         = d->info();
+        const int          lda            = a_info->strides_in_bytes().y() / a_info->element_size();
+        const int          batch_stride_a = a_info->strides_in_bytes()[2] / a_info->element_size();
+        const int          multi_stride_a = a_info->strides_in_bytes()[3] / a_info->element_size();
+        const int          ldd            = d_info->strides_in_bytes().y() / d_info->element_size();
+        const int          batch_stride_d = d_info->strides_in_bytes()[2] / d_info->element_size();
+        const int          multi_stride_d = d_info->strides_in_bytes()[3] / d_info->element_size();
+
+        const TypeWeight *in1_ptr        = nullptr;
+        int               ldb            = 0;
+        int               multi_stride_b = 0;
+        if (b != nullptr && !gemm->B_is_pretransposed())
+        {
+            ldb            = b->info()->strides_in_bytes().y() / b->info()->element_size();
+            multi_stride_b = b->info()->strides_in_bytes().z() / b->info()->element_size();
+            in1_ptr = reinterpret_cast<const TypeWeight *>(b->buffer() + b->info()->offset_first_element_in_bytes());
+        }
+
+        TypeOutput *bias = nullptr;
+        if (c != nullptr)
+        {
+            bias = reinterpret_cast<TypeOutput *>(c->buffer() + c->info()->offset_first_element_in_bytes());
+        }
+
+        const auto in0_ptr = reinterpret_cast<const TypeInput *>(a->buffer() + a_info->offset_first_element_in_bytes());
+        auto       out_ptr = reinterpret_cast<TypeOutput *>(d->buffer() + d_info->offset_first_element_in_bytes());
+        gemm->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b, out_ptr, ldd,
+                         batch_stride_d, multi_stride_d, bias, 0);
+    }
+
+    // A single job over the tiles of all the problems
+    NEScheduler::get().schedule(_optimised_kernel.get(), IScheduler::Hints(Window::DimX));
+}
+
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+void create_grouped_arm_gemm(std::unique_ptr<CpuGroupedGemmAssemblyDispatch::IFallback> &arm_gemm,
+                             const std::vector<AsmGemmProblem>                          &problems,
+                             arm_gemm::Activation                                        activation,
+                             const AsmGemmInfo                                          &info)
+{
+    auto fallback = std::make_unique<GroupedFallback<TypeInput, TypeWeight, TypeOutput>>();
+    fallback->configure(problems, activation, info);
+    arm_gemm = std::move(fallback);
+}
+} // namespace
+
+CpuGroupedGemmAssemblyDispatch::CpuGroupedGemmAssemblyDispatch() : _arm_gemm(nullptr)
+{
+}
+
+Status CpuGroupedGemmAssemblyDispatch::validate(const std::vector<AsmGemmProblem> &problems, const AsmGemmInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(problems.empty(), "No problem to compute");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.method != AsmConvMethod::Im2Col, "Indirect methods cannot be grouped");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.fixed_format, "Fixed format kernels cannot be grouped");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.transpose_b, "Transposed B cannot be grouped");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.reinterpret_input_as_3d || info.depth_output_gemm3d,
+                                    "3D input or output cannot be grouped");
+
+    const AsmGemmProblem &first = problems[0];
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(first.a, first.b, first.d);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(first.a, 1, DataType::BFLOAT16, DataType::F16,
+                                                         DataType::F32);
+    for (const auto &p : problems)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(p.a, p.b, p.d);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(first.a, p.a, p.b, p.d);
+        if (p.c != nullptr)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(p.d, p.c);
+            ARM_COMPUTE_RETURN_ERROR_ON(p.c->dimension(0) != p.d->dimension(0));
+        }
+        ARM_COMPUTE_RETURN_ERROR_ON(p.a->dimension(0) != p.b->dimension(1));
+        ARM_COMPUTE_RETURN_ERROR_ON(p.d->dimension(0) != p.b->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(p.d->dimension(1) != p.a->dimension(1));
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmAssemblyDispatch::validate(p.a, p.b, nullptr, p.d, info));
+    }
+    return Status{};
+}
+
+int CpuGroupedGemmAssemblyDispatch::tensor_id(size_t problem, TensorType type)
+{
+    return grouped_tensor_id_base + static_cast<int>(problem) * grouped_tensor_id_stride + type;
+}
+
+void CpuGroupedGemmAssemblyDispatch::configure(const std::vector<AsmGemmProblem> &problems, const AsmGemmInfo &info)
+{
+    arm_gemm::Activation act = assembly_utils::map_to_arm_gemm_activation(info.activation_info);
+
+    //If we don't support a combination of data types, silently return: it is the caller's responsibility to check if configure() was successful via is_configured()
+    if (!CpuGroupedGemmAssemblyDispatch::validate(problems, info))
+    {
+        return;
+    }
+
+    // Register the calibrated kernel figures, if any, before arm_gemm ranks its kernels
+    CpuGemmProfile::get();
+
+    switch (problems[0].a->data_type())
+    {
+        case DataType::F32:
+            create_grouped_arm_gemm<float, float, float>(_arm_gemm, problems, act, info);
+            break;
+#if defined(ARM_COMPUTE_ENABLE_BF16)
+        case DataType::BFLOAT16:
+            create_grouped_arm_gemm<bfloat16, bfloat16, bfloat16>(_arm_gemm, problems, act, info);
+            break;
+#endif /* defined(ARM_COMPUTE_ENABLE_BF16) */
+#ifdef ENABLE_FP16_KERNELS
+        case DataType::F16:
+            create_grouped_arm_gemm<float16_t, float16_t, float16_t>(_arm_gemm, problems, act, info);
+            break;
+#endif /* ENABLE_FP16_KERNELS */
+        default:
+            break;
+    }
+}
+
+void CpuGroupedGemmAssemblyDispatch::prepare(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON(_arm_gemm == nullptr);
+    _arm_gemm->prepare(tensors);
+}
+
+bool CpuGroupedGemmAssemblyDispatch::is_configured() const
+{
+    return _arm_gemm && _arm_gemm->is_configured();
+}
+
+void CpuGroupedGemmAssemblyDispatch::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON(_arm_gemm == nullptr);
+    _arm_gemm->run(tensors);
+}
+
+experimental::MemoryRequirements CpuGroupedGemmAssemblyDispatch::workspace() const
+{
+    ARM_COMPUTE_ERROR_ON(_arm_gemm == nullptr);
+    return _arm_gemm->workspace();
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_INTERNAL_CPUGROUPEDGEMMASSEMBLYDISPATCH_H
+#define ACL_SRC_CPU_OPERATORS_INTERNAL_CPUGROUPEDGEMMASSEMBLYDISPATCH_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+#include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** One problem of a grouped GEMM: d = a * b (+ c) */
+struct AsmGemmProblem
+{
+    const ITensorInfo *a{nullptr}; /**< Matrix A [K, M, Batch, Multi] */
+    const ITensorInfo *b{nullptr}; /**< Matrix B [N, K, Multi] */
+    const ITensorInfo *c{nullptr}; /**< Optional bias [N], added to every row of d */
+    ITensorInfo       *d{nullptr}; /**< Output [N, M, Batch, Multi] */
+};
+
+/** Assembly glue running many small independent GEMMs as a single scheduler job
+ *
+ * Each problem gets its own arm_gemm kernel, sized for its own shape, but the tiles of all the problems are split
+ * across the threads in one dispatch instead of one dispatch per problem. This is meant for workloads such as
+ * mixture-of-experts or per-head attention where hundreds of GEMMs are each too small to keep every core busy.
+ *
+ * The tensors of problem i are passed in the packs under @ref tensor_id (i, ACL_SRC_0/ACL_SRC_1/ACL_SRC_2/ACL_DST).
+ */
+class CpuGroupedGemmAssemblyDispatch : public ICpuOperator
+{
+public:
+    /** Constructor */
+    CpuGroupedGemmAssemblyDispatch();
+    /** Default destructor */
+    ~CpuGroupedGemmAssemblyDispatch() = default;
+
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGroupedGemmAssemblyDispatch);
+
+    class IFallback
+    {
+    public:
+        virtual void                             run(ITensorPack &tensors)     = 0;
+        virtual void                             prepare(ITensorPack &tensors) = 0;
+        virtual experimental::MemoryRequirements workspace() const             = 0;
+        virtual bool                             is_configured() const         = 0;
+        virtual ~IFallback()                                                   = default;
+    };
+
+public:
+    /** Configure the operator for a group of problems
+     *
+     * All the problems must have the same data types and, each one on its own, be supported by @ref
+     * CpuGemmAssemblyDispatch. Only plain (non-indirect, non-fixed-format, non-quantized) GEMMs can be grouped.
+     *
+     * @param[in] problems Problems to compute. Shapes can differ between problems.
+     * @param[in] info     GEMM meta-data shared by all the problems
+     */
+    void configure(const std::vector<AsmGemmProblem> &problems, const AsmGemmInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuGroupedGemmAssemblyDispatch::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<AsmGemmProblem> &problems, const AsmGemmInfo &info);
+    /** Id of a tensor of a given problem in the tensor packs
+     *
+     * @param[in] problem Index of the problem
+     * @param[in] type    ACL_SRC_0 (a), ACL_SRC_1 (b), ACL_SRC_2 (c) or ACL_DST (d)
+     *
+     * @return Id to use in the packs passed to @ref prepare and @ref run
+     */
+    static int tensor_id(size_t problem, TensorType type);
+    /** Was the function successfully configured ?
+     *
+     * @return True if the function is configured and ready to run
+     */
+    bool is_configured() const;
+
+    // Inherited methods overridden:
+    void                             prepare(ITensorPack &tensors) override;
+    void                             run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    std::unique_ptr<IFallback> _arm_gemm; /**< Interface for the arm_gemm fallback */
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_INTERNAL_CPUGROUPEDGEMMASSEMBLYDISPATCH_H
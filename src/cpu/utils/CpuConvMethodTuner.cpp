@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/utils/CpuConvMethodTuner.h"
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/DataLayoutUtils.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/cpuinfo/CpuModel.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace cpu
+{
+CpuConvMethodTuner &CpuConvMethodTuner::get()
+{
+    static CpuConvMethodTuner tuner;
+    return tuner;
+}
+
+CpuConvMethodTuner::CpuConvMethodTuner() : _mtx(), _table(), _filename(), _tuning_enabled(false)
+{
+    const auto env_mode = utility::getenv("ARM_COMPUTE_CPU_CONV_TUNER_MODE");
+    _tuning_enabled     = !env_mode.empty() && (std::strtol(env_mode.c_str(), nullptr, 10) != 0);
+    _filename           = utility::getenv("ARM_COMPUTE_CPU_CONV_TUNER_FILE");
+
+    // A missing file is expected the first time a new network is measured
+    if (!_filename.empty() && std::ifstream(_filename).good())
+    {
+        load_from_file(_filename);
+    }
+}
+
+bool CpuConvMethodTuner::is_tuning_enabled() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    return _tuning_enabled;
+}
+
+void CpuConvMethodTuner::set_tuning_enabled(bool enabled)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    _tuning_enabled = enabled;
+}
+
+bool CpuConvMethodTuner::find(const std::string &key, ConvolutionMethod &method) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    const auto it = _table.find(key);
+    if (it == _table.end())
+    {
+        return false;
+    }
+    method = it->second;
+    return true;
+}
+
+void CpuConvMethodTuner::add(const std::string &key, ConvolutionMethod method)
+{
+    std::string filename;
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+        _table[key] = method;
+        filename    = _filename;
+    }
+    if (!filename.empty())
+    {
+        save_to_file(filename);
+    }
+}
+
+void CpuConvMethodTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if (!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    // Each row is: key;method
+    std::string line;
+    while (!std::getline(fs, line).fail())
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+        const size_t pos = line.rfind(';');
+        if (pos == std::string::npos || pos + 1 == line.size())
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
+        }
+        _table[line.substr(0, pos)] = static_cast<ConvolutionMethod>(std::stoi(line.substr(pos + 1)));
+    }
+}
+
+bool CpuConvMethodTuner::save_to_file(const std::string &filename) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    if (_table.empty() || filename.empty())
+    {
+        return false;
+    }
+
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    for (const auto &entry : _table)
+    {
+        fs << entry.first << ";" << static_cast<int>(entry.second) << std::endl;
+    }
+    fs.close();
+    return true;
+}
+
+size_t CpuConvMethodTuner::num_entries() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    return _table.size();
+}
+
+std::string CpuConvMethodTuner::make_key(const ITensorInfo         *input,
+                                         const ITensorInfo         *weights,
+                                         const PadStrideInfo       &conv_info,
+                                         const Size2D              &dilation,
+                                         const ActivationLayerInfo &act_info,
+                                         bool                       enable_fast_math)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights);
+
+    std::stringstream key;
+    key << cpuinfo::cpu_model_to_string(CPUInfo::get().get_cpu_model()) << ":"
+        << string_from_data_type(input->data_type()) << "x" << string_from_data_type(weights->data_type()) << ":"
+        << string_from_data_layout(input->data_layout()) << ":i";
+    for (size_t d = 0; d < input->num_dimensions(); ++d)
+    {
+        key << input->dimension(d) << "x";
+    }
+    key << ":w";
+    for (size_t d = 0; d < weights->num_dimensions(); ++d)
+    {
+        key << weights->dimension(d) << "x";
+    }
+    key << ":p" << conv_info.pad_left() << "x" << conv_info.pad_right() << "x" << conv_info.pad_top() << "x"
+        << conv_info.pad_bottom() << ":s" << conv_info.stride().first << "x" << conv_info.stride().second << ":d"
+        << dilation.x() << "x" << dilation.y() << ":a"
+        << (act_info.enabled() ? static_cast<int>(act_info.activation()) : -1) << ":f" << enable_fast_math << ":t"
+        << NEScheduler::get().num_threads();
+    return key.str();
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_UTILS_CPUCONVMETHODTUNER_H
+#define ACL_SRC_CPU_UTILS_CPUCONVMETHODTUNER_H
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "support/Mutex.h"
+
+#include <map>
+#include <string>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Table of the fastest convolution methods measured for given convolutions
+ *
+ * @ref CpuConv2d picks the method of a convolution with shape heuristics tuned on a few networks. When tuning is
+ * enabled, each valid method of a convolution missing from the table is timed the first time the method is queried
+ * and the fastest one is recorded here. Convolutions already in the table use the recorded method instead of the
+ * heuristics.
+ *
+ * Entries are keyed by CPU model, shapes, convolution parameters and number of threads. The tuner is controlled by
+ * two environment variables:
+ * - ARM_COMPUTE_CPU_CONV_TUNER_FILE: file the table is loaded from on start-up and saved to when new convolutions are
+ *   measured
+ * - ARM_COMPUTE_CPU_CONV_TUNER_MODE: set to 1 to measure the convolutions missing from the table. Otherwise only the
+ *   entries already in the table are used
+ */
+class CpuConvMethodTuner final
+{
+public:
+    /** Access the tuner singleton
+     *
+     * @return The tuner
+     */
+    static CpuConvMethodTuner &get();
+    /** Prevent instances of this class from being copied */
+    CpuConvMethodTuner(const CpuConvMethodTuner &) = delete;
+    /** Prevent instances of this class from being copied */
+    CpuConvMethodTuner &operator=(const CpuConvMethodTuner &) = delete;
+    /** Checks if convolutions missing from the table should be measured
+     *
+     * @return True if tuning is enabled
+     */
+    bool is_tuning_enabled() const;
+    /** Enables or disables the measurement of new convolutions
+     *
+     * @param[in] enabled True to measure the convolutions missing from the table
+     */
+    void set_tuning_enabled(bool enabled);
+    /** Looks up the measured method of a convolution
+     *
+     * @param[in]  key    Key of the convolution, see @ref make_key
+     * @param[out] method Fastest method measured
+     *
+     * @return True if the convolution is in the table
+     */
+    bool find(const std::string &key, ConvolutionMethod &method) const;
+    /** Records the measured method of a convolution
+     *
+     * @note The table is saved to the tuning file, if any
+     *
+     * @param[in] key    Key of the convolution, see @ref make_key
+     * @param[in] method Fastest method measured
+     */
+    void add(const std::string &key, ConvolutionMethod method);
+    /** Loads the measured methods from a file, overwriting the entries with the same key
+     *
+     * @param[in] filename File to load from
+     */
+    void load_from_file(const std::string &filename);
+    /** Saves the measured methods to a file
+     *
+     * @param[in] filename File to save to
+     *
+     * @return True if the table was saved
+     */
+    bool save_to_file(const std::string &filename) const;
+    /** Returns the number of convolutions in the table
+     *
+     * @return Number of entries
+     */
+    size_t num_entries() const;
+    /** Builds the key identifying a convolution on the current CPU with the current number of threads
+     *
+     * @param[in] input            Source tensor info
+     * @param[in] weights          Weights tensor info
+     * @param[in] conv_info        Padding and stride information
+     * @param[in] dilation         Dilation, in elements, across x and y
+     * @param[in] act_info         Fused activation
+     * @param[in] enable_fast_math Whether fast math is enabled
+     *
+     * @return The key of the convolution
+     */
+    static std::string make_key(const ITensorInfo         *input,
+                                const ITensorInfo         *weights,
+                                const PadStrideInfo       &conv_info,
+                                const Size2D              &dilation,
+                                const ActivationLayerInfo &act_info,
+                                bool                       enable_fast_math);
+
+private:
+    CpuConvMethodTuner();
+
+    mutable arm_compute::Mutex               _mtx;
+    std::map<std::string, ConvolutionMethod> _table;
+    std::string                              _filename;
+    bool                                     _tuning_enabled;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_UTILS_CPUCONVMETHODTUNER_H
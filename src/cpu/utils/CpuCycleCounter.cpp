@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/utils/CpuCycleCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__) && !defined(BARE_METAL)
+#include <asm/unistd.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(__linux__) && !defined(BARE_METAL) */
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+bool cycle_counting_from_env()
+{
+    const char *env = std::getenv("ARM_COMPUTE_CPU_GEMM_REPORT");
+    return env != nullptr && std::strcmp(env, "1") == 0;
+}
+
+std::atomic<bool> &cycle_counting_flag()
+{
+    static std::atomic<bool> enabled{cycle_counting_from_env()};
+    return enabled;
+}
+
+#if defined(__linux__) && !defined(BARE_METAL)
+/** Cycle counter of the calling thread, closed when the thread exits */
+class ThreadCycleCounter final
+{
+public:
+    ThreadCycleCounter()
+    {
+        perf_event_attr attr{};
+        attr.type           = PERF_TYPE_HARDWARE;
+        attr.size           = sizeof(perf_event_attr);
+        attr.config         = PERF_COUNT_HW_CPU_CYCLES;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+
+        // Count the calling thread only, on any CPU
+        _fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+    ThreadCycleCounter(const ThreadCycleCounter &)            = delete;
+    ThreadCycleCounter &operator=(const ThreadCycleCounter &) = delete;
+    ~ThreadCycleCounter()
+    {
+        if (_fd >= 0)
+        {
+            close(_fd);
+        }
+    }
+    bool read_cycles(uint64_t &cycles) const
+    {
+        return _fd >= 0 && read(_fd, &cycles, sizeof(cycles)) == static_cast<ssize_t>(sizeof(cycles));
+    }
+
+private:
+    int _fd{-1};
+};
+#endif /* defined(__linux__) && !defined(BARE_METAL) */
+} // namespace
+
+void set_cycle_counting_enabled(bool enabled)
+{
+    cycle_counting_flag().store(enabled);
+}
+
+bool is_cycle_counting_enabled()
+{
+    return cycle_counting_flag().load(std::memory_order_relaxed);
+}
+
+bool read_thread_cycles(uint64_t &cycles)
+{
+#if defined(__linux__) && !defined(BARE_METAL)
+    static thread_local ThreadCycleCounter counter;
+    return counter.read_cycles(cycles);
+#else  /* defined(__linux__) && !defined(BARE_METAL) */
+    cycles = 0;
+    return false;
+#endif /* defined(__linux__) && !defined(BARE_METAL) */
+}
+} // namespace cpu
+} // namespace arm_compute
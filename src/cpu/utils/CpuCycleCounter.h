@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_UTILS_CPUCYCLECOUNTER_H
+#define ACL_SRC_CPU_UTILS_CPUCYCLECOUNTER_H
+
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Enables or disables the counting of the cycles spent in the assembly GEMM kernels
+ *
+ * @note Disabled by default, unless the environment variable ARM_COMPUTE_CPU_GEMM_REPORT is set to 1
+ *
+ * @param[in] enabled Whether to count the cycles
+ */
+void set_cycle_counting_enabled(bool enabled);
+/** Checks if the cycles spent in the assembly GEMM kernels are counted
+ *
+ * @return True if the cycles are counted
+ */
+bool is_cycle_counting_enabled();
+/** Reads the number of CPU cycles spent by the calling thread in user space
+ *
+ * The cycles are counted by the PMU of the cores the thread runs on, through a counter opened for the thread on its
+ * first call.
+ *
+ * @param[out] cycles Cycles spent by the thread since the counter was opened
+ *
+ * @return True if the PMU can be read, false otherwise, e.g. on bare metal or when perf events are not allowed
+ */
+bool read_thread_cycles(uint64_t &cycles);
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_UTILS_CPUCYCLECOUNTER_H
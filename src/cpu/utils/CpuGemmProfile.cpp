@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/utils/CpuGemmProfile.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/cpuinfo/CpuModel.h"
+#include "src/core/NEON/kernels/arm_gemm/performance_parameters.hpp"
+#include "src/cpu/kernels/assembly/arm_gemm.hpp"
+#include "src/cpu/kernels/assembly/CpuGemmAssemblyWrapperKernel.h"
+#include "support/StringSupport.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#if defined(__linux__) && !defined(BARE_METAL)
+#include <sched.h>
+#endif /* defined(__linux__) && !defined(BARE_METAL) */
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+/** Clock of the current core in cycles per nanosecond
+ *
+ * Only the ratios between the figures of different kernels drive the kernel selection, so 1 is returned when the
+ * clock cannot be read.
+ */
+float cycles_per_ns()
+{
+#if defined(__linux__) && !defined(BARE_METAL)
+    const int cpu = sched_getcpu();
+    if (cpu >= 0)
+    {
+        std::ifstream fs("/sys/devices/system/cpu/cpu" + support::cpp11::to_string(cpu) +
+                         "/cpufreq/cpuinfo_max_freq");
+        unsigned long khz = 0;
+        if (fs >> khz && khz > 0)
+        {
+            return static_cast<float>(khz) / 1e6f;
+        }
+    }
+#endif /* defined(__linux__) && !defined(BARE_METAL) */
+    return 1.f;
+}
+
+bool cpu_model_from_string(const std::string &str, CPUModel &model)
+{
+#define X(m)                                                 \
+    if (str == cpuinfo::cpu_model_to_string(CPUModel::m))   \
+    {                                                        \
+        model = CPUModel::m;                                 \
+        return true;                                         \
+    }
+    ARM_COMPUTE_CPU_MODEL_LIST
+#undef X
+    return false;
+}
+
+/** Measure the single-threaded execution time of an arm_gemm kernel on zero-filled buffers
+ *
+ * @param[in] gemm_asm GemmCommon kernel to time
+ * @param[in] args     Arguments the kernel was instantiated with
+ * @param[in] ci       CPU information
+ *
+ * @return Fastest of a few runs, in nanoseconds
+ */
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+double time_kernel(arm_gemm::GemmCommon<TypeInput, TypeWeight, TypeOutput> *gemm_asm,
+                   const arm_gemm::GemmArgs                                 &args,
+                   const CPUInfo                                            &ci)
+{
+    constexpr unsigned int num_iterations = 3;
+
+    const size_t M = args._Msize;
+    const size_t N = args._Nsize;
+    const size_t K = args._Ksize;
+
+    std::vector<TypeInput>  a(K * M);
+    std::vector<TypeWeight> b(N * K);
+    std::vector<TypeOutput> d(N * M);
+
+    std::vector<uint8_t> workspace(gemm_asm->get_working_size() + 4096);
+    void                *workspace_ptr  = workspace.data();
+    size_t               workspace_size = workspace.size();
+    gemm_asm->set_working_space(std::align(4096, workspace_size - 4096, workspace_ptr, workspace_size));
+
+    std::vector<uint8_t> pretranspose;
+    if (gemm_asm->B_pretranspose_required())
+    {
+        pretranspose.resize(gemm_asm->get_B_pretransposed_array_size() + 128);
+        void  *pretranspose_ptr  = pretranspose.data();
+        size_t pretranspose_size = pretranspose.size();
+        gemm_asm->pretranspose_B_array(std::align(128, pretranspose_size - 128, pretranspose_ptr, pretranspose_size),
+                                       b.data(), N, N * K, false);
+    }
+
+    gemm_asm->set_arrays(a.data(), K, K * M, K * M, b.data(), N, N * K, d.data(), N, N * M, N * M, nullptr, 0);
+    gemm_asm->set_nthreads(1);
+
+    kernel::CpuGemmAssemblyWrapperKernel<TypeInput, TypeWeight, TypeOutput> wrapper;
+    wrapper.configure(gemm_asm, "");
+
+    ThreadInfo info;
+    info.cpu_info = &ci;
+
+    // Warm-up run, not measured
+    wrapper.run(wrapper.window(), info);
+
+    double best_time = std::numeric_limits<double>::max();
+    for (unsigned int i = 0; i < num_iterations; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        wrapper.run(wrapper.window(), info);
+        const auto end = std::chrono::steady_clock::now();
+        best_time      = std::min<double>(best_time,
+                                          std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+    return std::max(best_time, 1.);
+}
+
+/** Calibrate the GEMM and hybrid kernels supporting the given data types
+ *
+ * The multiply-accumulate throughput is measured on a problem with a large K, where the preparation of the inputs
+ * and the merge of the outputs are negligible. For interleaved kernels, the time left over by the kernel on a problem
+ * with a single K block gives the throughput of the preparation and merge, which are not told apart.
+ *
+ * @param[in]  ci        CPU information
+ * @param[in]  cpns      Clock of the current core in cycles per nanosecond
+ * @param[out] entries   Calibrated figures, keyed by kernel name
+ */
+template <typename TypeInput, typename TypeWeight, typename TypeOutput>
+void calibrate_kernels(const CPUInfo &ci, float cpns, std::map<std::string, CpuGemmProfile::Entry> &entries)
+{
+    constexpr unsigned int M       = 192;
+    constexpr unsigned int N       = 192;
+    constexpr unsigned int K       = 1024;
+    constexpr unsigned int small_K = 32;
+
+    const arm_gemm::GemmArgs args(&ci, M, N, K, 1, 1, 1, false, arm_gemm::Activation(), 1);
+    const auto               kernels = arm_gemm::get_compatible_kernels<TypeInput, TypeWeight, TypeOutput>(args);
+
+    for (const auto &kernel : kernels)
+    {
+        if (kernel.method != arm_gemm::GemmMethod::GEMM_INTERLEAVED &&
+            kernel.method != arm_gemm::GemmMethod::GEMM_HYBRID)
+        {
+            continue;
+        }
+
+        arm_gemm::GemmConfig cfg(kernel.method);
+        cfg.filter = kernel.name;
+
+        arm_gemm::GemmArgs kernel_args = args;
+        kernel_args._cfg               = &cfg;
+
+        auto gemm_asm = arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput>(kernel_args);
+        // The filter is a substring match and may select a kernel with a longer name
+        if (gemm_asm == nullptr || gemm_asm->get_config().filter != kernel.name ||
+            entries.find(kernel.name) != entries.end())
+        {
+            continue;
+        }
+
+        CpuGemmProfile::Entry entry;
+        const double          cycles =
+            time_kernel<TypeInput, TypeWeight, TypeOutput>(gemm_asm.get(), kernel_args, ci) * cpns;
+        entry.kernel_macs_cycle = static_cast<float>(static_cast<double>(M) * N * K / cycles);
+
+        if (kernel.method == arm_gemm::GemmMethod::GEMM_INTERLEAVED)
+        {
+            arm_gemm::GemmArgs small_args = kernel_args;
+            small_args._Ksize             = small_K;
+
+            auto small_gemm_asm = arm_gemm::gemm<TypeInput, TypeWeight, TypeOutput>(small_args);
+            if (small_gemm_asm != nullptr && small_gemm_asm->get_config().filter == kernel.name)
+            {
+                const double small_cycles =
+                    time_kernel<TypeInput, TypeWeight, TypeOutput>(small_gemm_asm.get(), small_args, ci) * cpns;
+                const double kernel_cycles = static_cast<double>(M) * N * small_K / entry.kernel_macs_cycle;
+                const double bytes =
+                    static_cast<double>(M) * small_K * sizeof(TypeInput) + static_cast<double>(M) * N * sizeof(TypeOutput);
+                if (small_cycles > kernel_cycles)
+                {
+                    entry.prepare_bytes_cycle = static_cast<float>(bytes / (small_cycles - kernel_cycles));
+                    entry.merge_bytes_cycle   = entry.prepare_bytes_cycle;
+                }
+            }
+        }
+
+        entries[kernel.name] = entry;
+    }
+}
+} // namespace
+
+CpuGemmProfile &CpuGemmProfile::get()
+{
+    static CpuGemmProfile profile;
+    return profile;
+}
+
+CpuGemmProfile::CpuGemmProfile() : _mtx(), _entries()
+{
+    const std::string filename = utility::getenv("ARM_COMPUTE_CPU_GEMM_PROFILE");
+    const auto        env_cal  = utility::getenv("ARM_COMPUTE_CPU_GEMM_CALIBRATE");
+    const bool        calibrate_on_start = !env_cal.empty() && (std::strtol(env_cal.c_str(), nullptr, 10) != 0);
+
+    // A missing file is expected before the first calibration
+    if (!filename.empty() && std::ifstream(filename).good())
+    {
+        load_from_file(filename);
+    }
+
+    const CPUInfo &ci = NEScheduler::get().cpu_info();
+    if (calibrate_on_start && !has_model(ci.get_cpu_model()) && calibrate(ci) > 0 && !filename.empty())
+    {
+        save_to_file(filename);
+    }
+}
+
+size_t CpuGemmProfile::calibrate(const CPUInfo &ci)
+{
+    const float                                  cpns = cycles_per_ns();
+    std::map<std::string, CpuGemmProfile::Entry> entries;
+
+    calibrate_kernels<float, float, float>(ci, cpns, entries);
+#ifdef __aarch64__
+    calibrate_kernels<int8_t, int8_t, int32_t>(ci, cpns, entries);
+    calibrate_kernels<uint8_t, uint8_t, uint32_t>(ci, cpns, entries);
+#endif /* __aarch64__ */
+#if defined(ENABLE_FP16_KERNELS)
+    if (ci.has_fp16())
+    {
+        calibrate_kernels<float16_t, float16_t, float16_t>(ci, cpns, entries);
+    }
+#endif /* ENABLE_FP16_KERNELS */
+
+    for (const auto &entry : entries)
+    {
+        set(ci.get_cpu_model(), entry.first, entry.second);
+    }
+    return entries.size();
+}
+
+void CpuGemmProfile::set(CPUModel model, const std::string &kernel_name, const Entry &entry)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    _entries[std::make_pair(model, kernel_name)] = entry;
+    arm_gemm::set_performance_parameters_override(
+        model, kernel_name,
+        arm_gemm::PerformanceParameters(entry.kernel_macs_cycle, entry.prepare_bytes_cycle, entry.merge_bytes_cycle));
+}
+
+bool CpuGemmProfile::has_model(CPUModel model) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    return std::any_of(_entries.begin(), _entries.end(),
+                       [model](const decltype(_entries)::value_type &e) { return e.first.first == model; });
+}
+
+void CpuGemmProfile::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if (!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+
+    // Each row is: CPU model;kernel name;kernel MACs/cycle;prepare bytes/cycle;merge bytes/cycle
+    std::string line;
+    while (!std::getline(fs, line).fail())
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+        std::istringstream       ss(line);
+        std::vector<std::string> fields;
+        std::string              field;
+        while (std::getline(ss, field, ';'))
+        {
+            fields.push_back(field);
+        }
+
+        CPUModel model = CPUModel::GENERIC;
+        if (fields.size() != 5 || !cpu_model_from_string(fields[0], model))
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
+        }
+
+        Entry entry;
+        entry.kernel_macs_cycle   = std::stof(fields[2]);
+        entry.prepare_bytes_cycle = std::stof(fields[3]);
+        entry.merge_bytes_cycle   = std::stof(fields[4]);
+        set(model, fields[1], entry);
+    }
+}
+
+bool CpuGemmProfile::save_to_file(const std::string &filename) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    if (_entries.empty() || filename.empty())
+    {
+        return false;
+    }
+
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    for (const auto &entry : _entries)
+    {
+        fs << cpuinfo::cpu_model_to_string(entry.first.first) << ";" << entry.first.second << ";"
+           << entry.second.kernel_macs_cycle << ";" << entry.second.prepare_bytes_cycle << ";"
+           << entry.second.merge_bytes_cycle << std::endl;
+    }
+    fs.close();
+    return true;
+}
+
+void CpuGemmProfile::clear()
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    _entries.clear();
+    arm_gemm::clear_performance_parameters_overrides();
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_UTILS_CPUGEMMPROFILE_H
+#define ACL_SRC_CPU_UTILS_CPUGEMMPROFILE_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+
+#include "support/Mutex.h"
+
+#include <map>
+#include <string>
+#include <utility>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Performance parameters of the arm_gemm kernels calibrated at runtime
+ *
+ * arm_gemm ranks its GEMM and hybrid kernels by cycle estimates derived from per-kernel figures only available for a
+ * few CPU models; other cores, which are detected as one of the generic models, use generic figures. The profile
+ * measures those figures on the running core and registers them with arm_gemm, so that the estimates match the
+ * actual silicon.
+ *
+ * The profile is controlled by two environment variables:
+ * - ARM_COMPUTE_CPU_GEMM_PROFILE: file the profile is loaded from on start-up and saved to after a calibration
+ * - ARM_COMPUTE_CPU_GEMM_CALIBRATE: set to 1 to calibrate the current CPU model on start-up if the profile has no
+ *   figures for it
+ *
+ * @note A generic CPU model covers several cores, a calibrated profile should only be loaded on the machine it was
+ *       calibrated on.
+ */
+class CpuGemmProfile final
+{
+public:
+    /** Performance figures of a kernel, see arm_gemm::PerformanceParameters */
+    struct Entry
+    {
+        float kernel_macs_cycle{0.f};   /**< Multiply-accumulates per cycle of the kernel */
+        float prepare_bytes_cycle{0.f}; /**< Bytes per cycle of the input preparation, 0 to keep the built-in value */
+        float merge_bytes_cycle{0.f};   /**< Bytes per cycle of the output merge, 0 to keep the built-in value */
+    };
+
+    /** Access the profile singleton, loading and calibrating it on first use
+     *
+     * @return The profile
+     */
+    static CpuGemmProfile &get();
+    /** Prevent instances of this class from being copied */
+    CpuGemmProfile(const CpuGemmProfile &) = delete;
+    /** Prevent instances of this class from being copied */
+    CpuGemmProfile &operator=(const CpuGemmProfile &) = delete;
+    /** Measures the performance figures of the kernels available on the current CPU and registers them
+     *
+     * @note Runs single-threaded microbenchmarks, taking from a fraction of a second to a few seconds
+     *
+     * @param[in] ci CPU information
+     *
+     * @return Number of kernels calibrated
+     */
+    size_t calibrate(const CPUInfo &ci);
+    /** Sets and registers the figures of a kernel on a given CPU model
+     *
+     * @param[in] model       CPU model
+     * @param[in] kernel_name Name of the kernel, as reported by arm_gemm
+     * @param[in] entry       Performance figures
+     */
+    void set(CPUModel model, const std::string &kernel_name, const Entry &entry);
+    /** Checks if the profile has figures for a CPU model
+     *
+     * @param[in] model CPU model
+     *
+     * @return True if at least one kernel is calibrated on @p model
+     */
+    bool has_model(CPUModel model) const;
+    /** Loads and registers a profile, overwriting the figures already present for the same kernels
+     *
+     * @param[in] filename File to load from
+     */
+    void load_from_file(const std::string &filename);
+    /** Saves the profile to a file
+     *
+     * @param[in] filename File to save to
+     *
+     * @return True if the profile was saved
+     */
+    bool save_to_file(const std::string &filename) const;
+    /** Clears the profile and the figures registered with arm_gemm */
+    void clear();
+
+private:
+    CpuGemmProfile();
+
+    mutable arm_compute::Mutex                          _mtx;
+    std::map<std::pair<CPUModel, std::string>, Entry> _entries;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_UTILS_CPUGEMMPROFILE_H
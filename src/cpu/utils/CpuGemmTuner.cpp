@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/utils/CpuGemmTuner.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include "src/common/cpuinfo/CpuModel.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+CpuGemmTuner &CpuGemmTuner::get()
+{
+    static CpuGemmTuner tuner;
+    return tuner;
+}
+
+CpuGemmTuner::CpuGemmTuner() : _mtx(), _table(), _filename(), _tuning_enabled(false)
+{
+    const auto env_mode = utility::getenv("ARM_COMPUTE_CPU_GEMM_TUNER_MODE");
+    _tuning_enabled     = !env_mode.empty() && (std::strtol(env_mode.c_str(), nullptr, 10) != 0);
+    _filename           = utility::getenv("ARM_COMPUTE_CPU_GEMM_TUNER_FILE");
+
+    // A missing file is expected the first time a new problem set is tuned
+    if (!_filename.empty() && std::ifstream(_filename).good())
+    {
+        load_from_file(_filename);
+    }
+}
+
+bool CpuGemmTuner::is_tuning_enabled() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    return _tuning_enabled;
+}
+
+void CpuGemmTuner::set_tuning_enabled(bool enabled)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    _tuning_enabled = enabled;
+}
+
+bool CpuGemmTuner::find(const std::string &key, arm_gemm::GemmConfig &cfg) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    const auto it = _table.find(key);
+    if (it == _table.end())
+    {
+        return false;
+    }
+    cfg.method           = it->second.method;
+    cfg.filter           = it->second.filter;
+    cfg.inner_block_size = it->second.inner_block_size;
+    cfg.outer_block_size = it->second.outer_block_size;
+    return true;
+}
+
+void CpuGemmTuner::add(const std::string &key, const arm_gemm::GemmConfig &cfg)
+{
+    std::string filename;
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+        _table[key] = cfg;
+        filename    = _filename;
+    }
+    if (!filename.empty())
+    {
+        save_to_file(filename);
+    }
+}
+
+void CpuGemmTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if (!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    // Each row is: key;method;kernel name;inner block size;outer block size
+    std::string line;
+    while (!std::getline(fs, line).fail())
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+        std::istringstream       ss(line);
+        std::vector<std::string> fields;
+        std::string              field;
+        while (std::getline(ss, field, ';'))
+        {
+            fields.push_back(field);
+        }
+        if (fields.size() != 5)
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
+        }
+
+        arm_gemm::GemmConfig cfg;
+        cfg.method           = static_cast<arm_gemm::GemmMethod>(std::stoi(fields[1]));
+        cfg.filter           = fields[2];
+        cfg.inner_block_size = static_cast<unsigned int>(std::stoul(fields[3]));
+        cfg.outer_block_size = static_cast<unsigned int>(std::stoul(fields[4]));
+        _table[fields[0]]    = cfg;
+    }
+}
+
+bool CpuGemmTuner::save_to_file(const std::string &filename) const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    if (_table.empty() || filename.empty())
+    {
+        return false;
+    }
+
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    for (const auto &entry : _table)
+    {
+        fs << entry.first << ";" << static_cast<int>(entry.second.method) << ";" << entry.second.filter << ";"
+           << entry.second.inner_block_size << ";" << entry.second.outer_block_size << std::endl;
+    }
+    fs.close();
+    return true;
+}
+
+size_t CpuGemmTuner::num_entries() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    return _table.size();
+}
+
+std::string CpuGemmTuner::make_key(const arm_gemm::GemmArgs &args, const std::string &types)
+{
+    ARM_COMPUTE_ERROR_ON(args._ci == nullptr);
+
+    std::stringstream key;
+    key << cpuinfo::cpu_model_to_string(args._ci->get_cpu_model()) << ":" << types << ":" << args._Msize << "x"
+        << args._Nsize << "x" << args._Ksize << "x" << args._Ksections << "x" << args._nbatches << "x" << args._nmulti
+        << ":t" << args._maxthreads << ":a" << static_cast<int>(args._act.type) << ":f" << args._fast_mode << ":c"
+        << args._accumulate;
+    return key.str();
+}
+} // namespace cpu
+} // namespace arm_compute
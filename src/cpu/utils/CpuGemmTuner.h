@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_UTILS_CPUGEMMTUNER_H
+#define ACL_SRC_CPU_UTILS_CPUGEMMTUNER_H
+
+#include "src/cpu/kernels/assembly/arm_gemm.hpp"
+#include "support/Mutex.h"
+
+#include <map>
+#include <string>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Table of the fastest arm_gemm configurations measured for given GEMM problems
+ *
+ * arm_gemm selects its kernels with static cycle estimates which do not always pick the fastest kernel on a given
+ * core. When tuning is enabled, the assembly dispatch times the compatible kernels of a GEMM problem the first time it
+ * is configured and records the fastest one here. Problems already in the table use the recorded kernel instead of
+ * the heuristics.
+ *
+ * Entries are keyed by CPU model and problem shape. The tuner is controlled by two environment variables:
+ * - ARM_COMPUTE_CPU_GEMM_TUNER_FILE: file the table is loaded from on start-up and saved to when new problems are tuned
+ * - ARM_COMPUTE_CPU_GEMM_TUNER_MODE: set to 1 to tune the problems missing from the table. Otherwise only the entries
+ *   already in the table are used
+ */
+class CpuGemmTuner final
+{
+public:
+    /** Access the tuner singleton
+     *
+     * @return The tuner
+     */
+    static CpuGemmTuner &get();
+    /** Prevent instances of this class from being copied */
+    CpuGemmTuner(const CpuGemmTuner &) = delete;
+    /** Prevent instances of this class from being copied */
+    CpuGemmTuner &operator=(const CpuGemmTuner &) = delete;
+    /** Checks if problems missing from the table should be tuned
+     *
+     * @return True if tuning is enabled
+     */
+    bool is_tuning_enabled() const;
+    /** Enables or disables the tuning of new problems
+     *
+     * @param[in] enabled True to tune the problems missing from the table
+     */
+    void set_tuning_enabled(bool enabled);
+    /** Looks up the tuned configuration of a problem
+     *
+     * @param[in]  key Key of the problem, see @ref make_key
+     * @param[out] cfg Tuned configuration. Only the method, filter and block sizes are set
+     *
+     * @return True if the problem is in the table
+     */
+    bool find(const std::string &key, arm_gemm::GemmConfig &cfg) const;
+    /** Records the tuned configuration of a problem
+     *
+     * @note The table is saved to the tuning file, if any
+     *
+     * @param[in] key Key of the problem, see @ref make_key
+     * @param[in] cfg Fastest configuration measured
+     */
+    void add(const std::string &key, const arm_gemm::GemmConfig &cfg);
+    /** Loads the tuned configurations from a file, overwriting the entries with the same key
+     *
+     * @param[in] filename File to load from
+     */
+    void load_from_file(const std::string &filename);
+    /** Saves the tuned configurations to a file
+     *
+     * @param[in] filename File to save to
+     *
+     * @return True if the table was saved
+     */
+    bool save_to_file(const std::string &filename) const;
+    /** Returns the number of problems in the table
+     *
+     * @return Number of entries
+     */
+    size_t num_entries() const;
+    /** Builds the key identifying a problem on the current CPU
+     *
+     * @param[in] args  Arguments of the GEMM problem
+     * @param[in] types Tag identifying the input, weights and output data types
+     *
+     * @return The key of the problem
+     */
+    static std::string make_key(const arm_gemm::GemmArgs &args, const std::string &types);
+
+private:
+    CpuGemmTuner();
+
+    mutable arm_compute::Mutex                  _mtx;
+    std::map<std::string, arm_gemm::GemmConfig> _table;
+    std::string                                 _filename;
+    bool                                        _tuning_enabled;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_UTILS_CPUGEMMTUNER_H
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/utils/CpuSharedWeightsCache.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+CpuSharedWeightsCache &CpuSharedWeightsCache::get()
+{
+    static CpuSharedWeightsCache cache;
+    return cache;
+}
+
+CpuSharedWeightsCache::CpuSharedWeightsCache() : _mtx(), _entries(), _enabled(false)
+{
+    const auto env_v = utility::getenv("ARM_COMPUTE_SHARED_WEIGHTS_CACHE");
+    _enabled         = !env_v.empty() && (std::strtol(env_v.c_str(), nullptr, 10) != 0);
+}
+
+bool CpuSharedWeightsCache::is_enabled() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    return _enabled;
+}
+
+void CpuSharedWeightsCache::set_enabled(bool enabled)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    _enabled = enabled;
+}
+
+std::shared_ptr<ITensor> CpuSharedWeightsCache::acquire(const std::string       &key,
+                                                        const TensorInfo        &info,
+                                                        size_t                   alignment,
+                                                        const TransformFunction &transform)
+{
+    ARM_COMPUTE_ERROR_ON(!transform);
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    // Drop the entries no longer referenced
+    for (auto it = _entries.begin(); it != _entries.end();)
+    {
+        it = it->second.expired() ? _entries.erase(it) : std::next(it);
+    }
+
+    auto it = _entries.find(key);
+    if (it != _entries.end())
+    {
+        return it->second.lock();
+    }
+
+    auto tensor = std::make_shared<Tensor>();
+    tensor->allocator()->init(info, alignment);
+    tensor->allocator()->allocate();
+    transform(*tensor);
+
+    _entries.emplace(key, tensor);
+    return tensor;
+}
+
+size_t CpuSharedWeightsCache::num_entries() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    size_t                                      num_alive = 0;
+    for (const auto &entry : _entries)
+    {
+        num_alive += entry.second.expired() ? 0 : 1;
+    }
+    return num_alive;
+}
+
+uint64_t CpuSharedWeightsCache::hash(const ITensor &tensor)
+{
+    // 64-bit FNV-1a over words, followed by the remaining bytes
+    constexpr uint64_t prime = 0x100000001b3ULL;
+    uint64_t           h     = 0xcbf29ce484222325ULL;
+
+    const uint8_t *data = tensor.buffer();
+    const size_t   size = tensor.info()->total_size();
+    size_t         i    = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, data + i, sizeof(uint64_t));
+        h = (h ^ word) * prime;
+    }
+    for (; i < size; ++i)
+    {
+        h = (h ^ data[i]) * prime;
+    }
+    return h ^ size;
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_UTILS_CPUSHAREDWEIGHTSCACHE_H
+#define ACL_SRC_CPU_UTILS_CPUSHAREDWEIGHTSCACHE_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "support/Mutex.h"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Process-wide cache of transformed constant weights
+ *
+ * Operators transforming identical constant weights in the same way (e.g. several instances of a model in a process)
+ * share a single copy of the transformed weights. Entries are reference counted: an entry is released once the last
+ * operator holding it is destroyed.
+ *
+ * The cache is disabled by default and can be enabled by setting the ARM_COMPUTE_SHARED_WEIGHTS_CACHE environment
+ * variable to 1.
+ */
+class CpuSharedWeightsCache final
+{
+public:
+    /** Function transforming the weights into the given tensor */
+    using TransformFunction = std::function<void(ITensor &)>;
+
+    /** Access the cache singleton
+     *
+     * @return The cache
+     */
+    static CpuSharedWeightsCache &get();
+    /** Prevent instances of this class from being copied */
+    CpuSharedWeightsCache(const CpuSharedWeightsCache &) = delete;
+    /** Prevent instances of this class from being copied */
+    CpuSharedWeightsCache &operator=(const CpuSharedWeightsCache &) = delete;
+    /** Checks if the transformed weights should be shared
+     *
+     * @return True if the cache is enabled
+     */
+    bool is_enabled() const;
+    /** Enables or disables the cache
+     *
+     * @note Only affects operators configured afterwards
+     *
+     * @param[in] enabled True to share the transformed weights
+     */
+    void set_enabled(bool enabled);
+    /** Returns the transformed weights for a given key, transforming them if not already cached
+     *
+     * @param[in] key       Key identifying the source weights and the transformation
+     * @param[in] info      Info of the transformed weights tensor
+     * @param[in] alignment Alignment of the transformed weights memory
+     * @param[in] transform Function filling the transformed weights. Only called on a cache miss
+     *
+     * @return The transformed weights, kept alive as long as a reference to them is held
+     */
+    std::shared_ptr<ITensor>
+    acquire(const std::string &key, const TensorInfo &info, size_t alignment, const TransformFunction &transform);
+    /** Returns the number of transformed weights currently cached
+     *
+     * @return Number of entries still referenced
+     */
+    size_t num_entries() const;
+    /** Computes a hash of the tensor data
+     *
+     * @note The whole tensor buffer, padding included, contributes to the hash
+     *
+     * @param[in] tensor Tensor to hash
+     *
+     * @return A 64-bit hash of the tensor buffer
+     */
+    static uint64_t hash(const ITensor &tensor);
+
+private:
+    CpuSharedWeightsCache();
+
+    mutable arm_compute::Mutex                     _mtx;
+    std::map<std::string, std::weak_ptr<ITensor>> _entries;
+    bool                                           _enabled;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_UTILS_CPUSHAREDWEIGHTSCACHE_H
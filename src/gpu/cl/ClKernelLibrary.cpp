@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024 Arm Limited.
+ * Copyright (c) 2016-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -202,6 +202,7 @@ const std::map<std::string, std::string> ClKernelLibrary::_kernel_program_map =
     {"cast_down", "common/cast.cl"},
     {"cast_up", "common/cast.cl"},
     {"convert_fc_weights", "common/convert_fc_weights.cl"},
+    {"copy_program", "common/copy_program.cl"},
     {"copy_tensor", "common/copy_tensor.cl"},
     {"crop_tensor", "common/crop_tensor.cl"},
     {"deconvolution_reshape", "common/deconvolution_layer.cl"},
@@ -333,6 +334,7 @@ const std::map<std::string, std::string> ClKernelLibrary::_kernel_program_map =
     {"range", "common/range.cl"},
     {"range_quantized", "common/range.cl"},
     {"reduction_operation_x", "common/reduction_operation.cl"},
+    {"reduction_operation_x_local", "common/reduction_operation.cl"},
     {"reduction_operation_non_parallel_x", "common/reduction_operation.cl"},
     {"reduction_operation_y", "common/reduction_operation.cl"},
     {"reduction_operation_z", "common/reduction_operation.cl"},
@@ -343,6 +345,8 @@ const std::map<std::string, std::string> ClKernelLibrary::_kernel_program_map =
     {"roi_align_layer", "common/roi_align_layer.cl"},
     {"roi_align_layer_quantized", "common/roi_align_layer_quantized.cl"},
     {"roi_pooling_layer", "common/roi_pooling_layer.cl"},
+    {"scaled_dot_product_attention_mmul", "common/scaled_dot_product_attention.cl"},
+    {"scaled_dot_product_attention_native", "common/scaled_dot_product_attention.cl"},
     {"select_same_rank", "common/select.cl"},
     {"select_different_rank_2", "common/select.cl"},
     {"select_different_rank_n", "common/select.cl"},
@@ -466,6 +470,7 @@ const std::map<std::string, std::string> ClKernelLibrary::_kernel_program_map =
     {"winograd_input_transform_2x2_7x7_stepz1_nhwc", "nhwc/winograd_input_transform.cl"},
     {"winograd_input_transform_2x1_7x1_stepz1_nhwc", "nhwc/winograd_input_transform.cl"},
     {"winograd_input_transform_1x2_1x7_stepz1_nhwc", "nhwc/winograd_input_transform.cl"},
+    {"winograd_fused_conv2d_4x4_3x3_nhwc", "nhwc/winograd_fused_conv2d.cl"},
     {"winograd_output_transform_4x1_3x1_nhwc", "nhwc/winograd_output_transform.cl"},
     {"winograd_output_transform_1x4_1x3_nhwc", "nhwc/winograd_output_transform.cl"},
     {"winograd_output_transform_4x4_3x3_nhwc", "nhwc/winograd_output_transform.cl"},
@@ -531,6 +536,10 @@ const std::map<std::string, std::string> ClKernelLibrary::_program_source_map =
     {
         "common/convolution_layer.cl",
 #include "./cl_kernels/common/convolution_layer.clembed"
+    },
+    {
+        "common/copy_program.cl",
+#include "./cl_kernels/common/copy_program.clembed"
     },
     {
         "common/copy_tensor.cl",
@@ -551,6 +560,10 @@ const std::map<std::string, std::string> ClKernelLibrary::_program_source_map =
     {
         "common/dequantization_layer.cl",
 #include "./cl_kernels/common/dequantization_layer.clembed"
+    },
+    {
+        "common/elementwise_chain.cl",
+#include "./cl_kernels/common/elementwise_chain.clembed"
     },
     {
         "common/elementwise_operation.cl",
@@ -727,6 +740,10 @@ const std::map<std::string, std::string> ClKernelLibrary::_program_source_map =
     {
         "common/roi_pooling_layer.cl",
 #include "./cl_kernels/common/roi_pooling_layer.clembed"
+    },
+    {
+        "common/scaled_dot_product_attention.cl",
+#include "./cl_kernels/common/scaled_dot_product_attention.clembed"
     },
     {
         "common/select.cl",
@@ -959,6 +976,10 @@ const std::map<std::string, std::string> ClKernelLibrary::_program_source_map =
     {
         "nhwc/winograd_filter_transform.cl",
 #include "./cl_kernels/nhwc/winograd_filter_transform.clembed"
+    },
+    {
+        "nhwc/winograd_fused_conv2d.cl",
+#include "./cl_kernels/nhwc/winograd_fused_conv2d.clembed"
     },
     {
         "nhwc/winograd_input_transform.cl",
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -77,8 +77,30 @@ StatusCode ClTensor::allocate()
 StatusCode ClTensor::import(void *handle, ImportMemoryType type)
 {
     ARM_COMPUTE_ASSERT(_legacy_tensor.get() != nullptr);
-    ARM_COMPUTE_UNUSED(type, handle);
 
+    Status st{};
+    switch (type)
+    {
+        case ImportMemoryType::DmaBuf:
+            if (handle == nullptr)
+            {
+                return StatusCode::InvalidArgument;
+            }
+            st = _legacy_tensor->allocator()->import_dma_buf(*static_cast<const int *>(handle));
+            break;
+        case ImportMemoryType::AndroidHardwareBuffer:
+            st = _legacy_tensor->allocator()->import_android_hardware_buffer(static_cast<AHardwareBuffer *>(handle));
+            break;
+        default:
+            // Host pointers are not imported by OpenCL tensors
+            return StatusCode::Success;
+    }
+
+    if (!bool(st))
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL(std::string("[ClTensor:import]: ").append(st.error_description()).c_str());
+        return StatusCode::UnsupportedConfig;
+    }
     return StatusCode::Success;
 }
 
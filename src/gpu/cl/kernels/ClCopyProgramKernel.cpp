@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/gpu/cl/kernels/ClCopyProgramKernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/StringUtils.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "support/Cast.h"
+#include "support/StringSupport.h"
+
+#include <set>
+
+namespace arm_compute
+{
+namespace opencl
+{
+namespace kernels
+{
+namespace
+{
+constexpr size_t max_copy_program_dims = 4;
+
+Status validate_stage(const TensorShape &input_shape, const CopyProgramStage &stage)
+{
+    switch (stage.type)
+    {
+        case CopyProgramStageType::RESHAPE:
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(stage.shape.total_size() != input_shape.total_size(),
+                                            "A reshape must keep the number of elements");
+            break;
+        case CopyProgramStageType::PERMUTE:
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON(stage.perm.num_dimensions() > max_copy_program_dims);
+            std::set<uint32_t> dims;
+            for (size_t i = 0; i < stage.perm.num_dimensions(); ++i)
+            {
+                ARM_COMPUTE_RETURN_ERROR_ON_MSG(stage.perm[i] >= stage.perm.num_dimensions() ||
+                                                    !dims.insert(stage.perm[i]).second,
+                                                "Invalid permutation vector");
+            }
+            break;
+        }
+        case CopyProgramStageType::SLICE:
+            for (size_t i = 0; i < max_copy_program_dims; ++i)
+            {
+                const int stride = i < stage.strides.num_dimensions() ? stage.strides[i] : 1;
+                ARM_COMPUTE_RETURN_ERROR_ON_MSG(stride <= 0, "Slice strides must be positive");
+                ARM_COMPUTE_RETURN_ERROR_ON_MSG(stage.starts[i] < 0 || stage.shape[i] == 0 ||
+                                                    stage.starts[i] + (static_cast<int>(stage.shape[i]) - 1) * stride >=
+                                                        static_cast<int>(input_shape[i]),
+                                                "The slice is out of the input of the stage");
+            }
+            break;
+        default:
+            ARM_COMPUTE_RETURN_ERROR_MSG("Unsupported copy program stage");
+    }
+    return Status{};
+}
+
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const CopyProgramInfo &program)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->data_type() == DataType::UNKNOWN);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(program.empty() || program.size() > ClCopyProgramKernel::max_num_stages,
+                                    "Unsupported number of stages");
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > max_copy_program_dims);
+
+    TensorShape shape = src->tensor_shape();
+    for (const auto &stage : program)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_stage(shape, stage));
+        shape = misc::shape_calculator::compute_copy_program_shape(shape, {stage});
+        ARM_COMPUTE_RETURN_ERROR_ON(shape.num_dimensions() > max_copy_program_dims);
+    }
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), shape);
+    }
+
+    return Status{};
+}
+
+/** Encode a stage as expected by copy_program_stage() in common/copy_program.cl */
+cl_int16 encode_stage(const TensorShape &input_shape, const CopyProgramStage &stage)
+{
+    cl_int16 encoded{};
+    switch (stage.type)
+    {
+        case CopyProgramStageType::RESHAPE:
+            encoded.s[0] = 0;
+            for (size_t i = 0; i < max_copy_program_dims; ++i)
+            {
+                encoded.s[1 + i] = input_shape[i];
+                encoded.s[5 + i] = stage.shape[i];
+            }
+            break;
+        case CopyProgramStageType::PERMUTE:
+            encoded.s[0] = 1;
+            for (size_t i = 0; i < max_copy_program_dims; ++i)
+            {
+                encoded.s[1 + i] = i < stage.perm.num_dimensions() ? stage.perm[i] : i;
+            }
+            break;
+        case CopyProgramStageType::SLICE:
+            encoded.s[0] = 2;
+            for (size_t i = 0; i < max_copy_program_dims; ++i)
+            {
+                encoded.s[1 + i] = stage.starts[i];
+                encoded.s[5 + i] = i < stage.strides.num_dimensions() ? stage.strides[i] : 1;
+            }
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported copy program stage");
+    }
+    return encoded;
+}
+} // namespace
+
+ClCopyProgramKernel::ClCopyProgramKernel()
+{
+    _type = CLKernelType::ELEMENTWISE;
+}
+
+void ClCopyProgramKernel::configure(const ClCompileContext &compile_context,
+                                    const ITensorInfo      *src,
+                                    ITensorInfo            *dst,
+                                    const CopyProgramInfo  &program)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_LOG_PARAMS(src, dst);
+
+    // Destination auto initialization if not yet initialized
+    const TensorShape dst_shape = misc::shape_calculator::compute_copy_program_shape(src->tensor_shape(), program);
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(dst_shape));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, program));
+
+    auto padding_info = get_padding_info({src, dst});
+
+    // Unused stages are passed as zeros, the kernel does not evaluate them
+    _stages.assign(max_num_stages, cl_int16{});
+    TensorShape shape = src->tensor_shape();
+    for (size_t i = 0; i < program.size(); ++i)
+    {
+        _stages[i] = encode_stage(shape, program[i]);
+        shape      = misc::shape_calculator::compute_copy_program_shape(shape, {program[i]});
+    }
+
+    CLBuildOptions build_opts;
+    build_opts.add_option("-DDATA_TYPE=" + get_cl_unsigned_type_from_element_size(src->element_size()));
+    build_opts.add_option("-DNUM_STAGES=" + support::cpp11::to_string(program.size()));
+
+    const std::string kernel_name("copy_program");
+    _kernel = create_kernel(compile_context, kernel_name, build_opts.options());
+
+    // Configure kernel window
+    Window win = calculate_max_window(*dst, Steps());
+    IClKernel::configure_internal(win.collapse(win, Window::DimZ));
+
+    // Set config_id for enabling LWS tuning
+    _config_id = kernel_name;
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(src->element_size());
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(program.size());
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(dst->dimension(0));
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(dst->dimension(1));
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(dst->tensor_shape().total_size_upper(2));
+
+    ARM_COMPUTE_ERROR_ON(has_padding_changed(padding_info));
+}
+
+Status ClCopyProgramKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, const CopyProgramInfo &program)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, program));
+    return Status{};
+}
+
+void ClCopyProgramKernel::run_op(ITensorPack &tensors, const Window &window, ::cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
+
+    const auto src =
+        utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC));
+    auto dst = utils::cast::polymorphic_downcast<ICLTensor *>(tensors.get_tensor(TensorType::ACL_DST));
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    unsigned int idx = 0;
+    add_4d_tensor_nhwc_argument(idx, src);
+    add_4d_tensor_nhwc_argument(idx, dst);
+    for (const auto &stage : _stages)
+    {
+        _kernel.setArg<cl_int16>(idx++, stage);
+    }
+
+    // The coordinates of the elements are computed from the global ids: the window must not be split
+    enqueue(queue, *this, window, lws_hint());
+}
+} // namespace kernels
+} // namespace opencl
+} // namespace arm_compute
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_GPU_CL_KERNELS_CLCOPYPROGRAMKERNEL_H
+#define ACL_SRC_GPU_CL_KERNELS_CLCOPYPROGRAMKERNEL_H
+
+#include "arm_compute/function_info/CopyProgramInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/gpu/cl/ClCompileContext.h"
+#include "src/gpu/cl/IClKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace opencl
+{
+namespace kernels
+{
+/** OpenCL kernel performing a sequence of data movements in a single pass
+ *
+ * The stages of the program are passed to the kernel as arguments: programs with the same element size and number of
+ * stages share the same OpenCL program whatever their shapes.
+ */
+class ClCopyProgramKernel : public IClKernel
+{
+public:
+    /** Maximum number of stages of a program */
+    static constexpr size_t max_num_stages = 8;
+
+    ClCopyProgramKernel();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(ClCopyProgramKernel);
+    /** Initialise the kernel's input and output.
+     *
+     * Valid data type configurations:
+     * |src            |dst            |
+     * |:--------------|:--------------|
+     * |All            |All            |
+     *
+     * @param[in]  compile_context The compile context to be used.
+     * @param[in]  src             Source tensor info, up to 4D. Data types supported: All.
+     * @param[out] dst             Destination tensor info, up to 4D. Data types supported: same as @p src.
+     * @param[in]  program         Data movements to apply, in order. Up to @ref max_num_stages stages, whose intermediate
+     *                             shapes are up to 4D.
+     */
+    void configure(const ClCompileContext &compile_context,
+                   const ITensorInfo      *src,
+                   ITensorInfo            *dst,
+                   const CopyProgramInfo  &program);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref ClCopyProgramKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const CopyProgramInfo &program);
+
+    // Inherited methods overridden:
+    void run_op(ITensorPack &tensors, const Window &window, ::cl::CommandQueue &queue) override;
+
+private:
+    std::vector<cl_int16> _stages{};
+};
+} // namespace kernels
+} // namespace opencl
+} // namespace arm_compute
+#endif // ACL_SRC_GPU_CL_KERNELS_CLCOPYPROGRAMKERNEL_H
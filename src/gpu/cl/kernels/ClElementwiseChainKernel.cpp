@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/gpu/cl/kernels/ClElementwiseChainKernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/ActivationFunctionUtils.h"
+#include "arm_compute/core/utils/helpers/AdjustVecSize.h"
+#include "arm_compute/core/utils/StringUtils.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/CL/CLValidate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/gpu/cl/ClKernelLibrary.h"
+#include "support/Cast.h"
+#include "support/StringSupport.h"
+
+namespace arm_compute
+{
+namespace opencl
+{
+namespace kernels
+{
+namespace
+{
+// Program holding the helpers the generated kernels are appended to
+const std::string chain_program_name = "common/elementwise_chain.cl";
+
+bool is_activation_supported(ActivationLayerInfo::ActivationFunction act)
+{
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+    switch (act)
+    {
+        case ActFunction::IDENTITY:
+        case ActFunction::LINEAR:
+        case ActFunction::RELU:
+        case ActFunction::BOUNDED_RELU:
+        case ActFunction::LU_BOUNDED_RELU:
+        case ActFunction::LEAKY_RELU:
+        case ActFunction::SOFT_RELU:
+        case ActFunction::ELU:
+        case ActFunction::LOGISTIC:
+        case ActFunction::TANH:
+        case ActFunction::ABS:
+        case ActFunction::SQUARE:
+        case ActFunction::SQRT:
+        case ActFunction::HARD_SWISH:
+        case ActFunction::GELU:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Expression of an operation applied to the running value v of the chain */
+std::string op_expression(const ElementwiseChainOp &op)
+{
+    const std::string operand = "CHAIN_LOAD(op" + support::cpp11::to_string(op.operand) + ")";
+    const std::string lhs     = op.reversed ? operand : "v";
+    const std::string rhs     = op.reversed ? "v" : operand;
+    switch (op.type)
+    {
+        case ElementwiseChainOpType::ADD:
+            return lhs + " + " + rhs;
+        case ElementwiseChainOpType::SUB:
+            return lhs + " - " + rhs;
+        case ElementwiseChainOpType::MUL:
+            return lhs + " * " + rhs;
+        case ElementwiseChainOpType::DIV:
+            return lhs + " / " + rhs;
+        case ElementwiseChainOpType::MIN:
+            return "fmin(" + lhs + ", " + rhs + ")";
+        case ElementwiseChainOpType::MAX:
+            return "fmax(" + lhs + ", " + rhs + ")";
+        case ElementwiseChainOpType::SQUARED_DIFF:
+            return "(" + lhs + " - " + rhs + ") * (" + lhs + " - " + rhs + ")";
+        case ElementwiseChainOpType::EXP:
+            return "exp(v)";
+        case ElementwiseChainOpType::NEG:
+            return "-v";
+        case ElementwiseChainOpType::ABS:
+            return "fabs(v)";
+        case ElementwiseChainOpType::RSQRT:
+            return "rsqrt(v)";
+        case ElementwiseChainOpType::ACTIVATION:
+            return "ACTIVATION(" + lower_string(string_from_activation_func(op.act_info.activation())) +
+                   ", float, VEC_SIZE, v, " + float_to_string_with_full_precision(op.act_info.a()) + ", " +
+                   float_to_string_with_full_precision(op.act_info.b()) + ")";
+        default:
+            ARM_COMPUTE_ERROR("Unsupported elementwise chain operation");
+    }
+}
+
+Status validate_arguments(const ITensorInfo                      *src,
+                          const std::vector<const ITensorInfo *> &operands,
+                          const ITensorInfo                      *dst,
+                          const ElementwiseChainInfo             &chain)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32, DataType::F16);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(chain.empty(), "The chain must hold at least one operation");
+
+    for (const auto *operand : operands)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(operand);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, operand);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, operand); // No broadcasting
+    }
+
+    for (const auto &op : chain)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_binary_elementwise_chain_op(op.type) && op.operand >= operands.size(),
+                                        "Binary operation without operand");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(op.type == ElementwiseChainOpType::ACTIVATION &&
+                                            !is_activation_supported(op.act_info.activation()),
+                                        "Unsupported activation function in the chain");
+    }
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_F16_UNSUPPORTED(dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F32, DataType::F16, DataType::QASYMM8,
+                                                             DataType::QASYMM8_SIGNED);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+    }
+
+    return Status{};
+}
+} // namespace
+
+ClElementwiseChainKernel::ClElementwiseChainKernel()
+{
+    _type = CLKernelType::ELEMENTWISE;
+}
+
+std::string ClElementwiseChainKernel::generate_kernel_source(const ElementwiseChainInfo &chain, size_t num_operands)
+{
+    std::string src = "\n__kernel void elementwise_chain(TENSOR3D_T(src, BUFFER),\n";
+    for (size_t i = 0; i < num_operands; ++i)
+    {
+        src += "                                TENSOR3D_T(op" + support::cpp11::to_string(i) + ", BUFFER),\n";
+    }
+    src += "                                TENSOR3D_T(dst, BUFFER))\n{\n";
+    src += "    CHAIN_COORDS;\n";
+    src += "    CHAIN_VEC_TYPE v = CHAIN_LOAD(src);\n";
+    for (const auto &op : chain)
+    {
+        src += "    v = " + op_expression(op) + ";\n";
+    }
+    src += "    CHAIN_STORE(v);\n}\n";
+    return src;
+}
+
+void ClElementwiseChainKernel::configure(const ClCompileContext                 &compile_context,
+                                         const ITensorInfo                      *src,
+                                         const std::vector<const ITensorInfo *> &operands,
+                                         ITensorInfo                            *dst,
+                                         const ElementwiseChainInfo             &chain)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_LOG_PARAMS(src, operands, dst);
+
+    // Destination auto initialization if not yet initialized
+    auto_init_if_empty(*dst, *src->clone());
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, operands, dst, chain));
+
+    auto padding_info = get_padding_info({src, dst});
+
+    _num_operands = operands.size();
+
+    const unsigned int vec_size = adjust_vec_size(16 / src->element_size(), dst->dimension(0));
+    const DataType     dst_dt   = dst->data_type();
+
+    CLBuildOptions build_opts;
+    build_opts.add_option("-DDATA_TYPE=" + get_cl_type_from_data_type(src->data_type()));
+    build_opts.add_option("-DDST_DATA_TYPE=" + get_cl_type_from_data_type(dst_dt));
+    build_opts.add_option("-DVEC_SIZE=" + support::cpp11::to_string(vec_size));
+    build_opts.add_option("-DVEC_SIZE_LEFTOVER=" + support::cpp11::to_string(dst->dimension(0) % vec_size));
+    if (is_data_type_quantized_asymmetric(dst_dt))
+    {
+        const UniformQuantizationInfo oq_info = dst->quantization_info().uniform();
+        build_opts.add_option("-DDST_SCALE=" + float_to_string_with_full_precision(oq_info.scale));
+        build_opts.add_option("-DDST_OFFSET=" + support::cpp11::to_string(oq_info.offset));
+    }
+
+    // The program is named after the generated kernel: a chain configured again, or by another function, reuses the
+    // program already built by the compile context
+    const std::string kernel_src   = generate_kernel_source(chain, operands.size());
+    const auto        helpers      = ClKernelLibrary::get().program(chain_program_name);
+    const std::string program_name = chain_program_name + kernel_src;
+    ARM_COMPUTE_ERROR_ON_MSG(helpers.is_binary, "The elementwise chain helpers must be given as source");
+
+    const std::string kernel_name("elementwise_chain");
+    _kernel = static_cast<cl::Kernel>(compile_context.create_kernel(kernel_name, program_name,
+                                                                     helpers.program + kernel_src,
+                                                                     ClKernelLibrary::get().kernel_path(),
+                                                                     build_opts.options(), false /* is_binary */));
+
+    // Configure kernel window
+    Window win = calculate_max_window(*dst, Steps(vec_size));
+    IClKernel::configure_internal(win.collapse(win, Window::DimZ));
+
+    // Set config_id for enabling LWS tuning
+    _config_id = kernel_name;
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(std::hash<std::string>{}(kernel_src));
+    _config_id += "_";
+    _config_id += lower_string(string_from_data_type(src->data_type()));
+    _config_id += "_";
+    _config_id += lower_string(string_from_data_type(dst_dt));
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(dst->dimension(0));
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(dst->dimension(1));
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(dst->tensor_shape().total_size_upper(2));
+
+    ARM_COMPUTE_ERROR_ON(has_padding_changed(padding_info));
+}
+
+Status ClElementwiseChainKernel::validate(const ITensorInfo                      *src,
+                                          const std::vector<const ITensorInfo *> &operands,
+                                          const ITensorInfo                      *dst,
+                                          const ElementwiseChainInfo             &chain)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, operands, dst, chain));
+    return Status{};
+}
+
+void ClElementwiseChainKernel::run_op(ITensorPack &tensors, const Window &window, ::cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
+
+    const auto src =
+        utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC_0));
+    auto dst = utils::cast::polymorphic_downcast<ICLTensor *>(tensors.get_tensor(TensorType::ACL_DST));
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    unsigned int idx = 0;
+    add_3d_tensor_nhw_argument(idx, src);
+    for (size_t i = 0; i < _num_operands; ++i)
+    {
+        const auto operand = utils::cast::polymorphic_downcast<const ICLTensor *>(
+            tensors.get_const_tensor(static_cast<TensorType>(TensorType::ACL_SRC_VEC + i)));
+        ARM_COMPUTE_ERROR_ON(operand == nullptr);
+        add_3d_tensor_nhw_argument(idx, operand);
+    }
+    add_3d_tensor_nhw_argument(idx, dst);
+
+    enqueue(queue, *this, window.collapse(ICLKernel::window(), Window::DimZ), lws_hint());
+}
+} // namespace kernels
+} // namespace opencl
+} // namespace arm_compute
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_GPU_CL_KERNELS_CLELEMENTWISECHAINKERNEL_H
+#define ACL_SRC_GPU_CL_KERNELS_CLELEMENTWISECHAINKERNEL_H
+
+#include "arm_compute/function_info/ElementwiseChainInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/gpu/cl/ClCompileContext.h"
+#include "src/gpu/cl/IClKernel.h"
+
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace opencl
+{
+namespace kernels
+{
+/** OpenCL kernel evaluating a chain of elementwise operations in a single pass
+ *
+ * The source of the kernel is generated from the operations of the chain and appended to the helpers of
+ * common/elementwise_chain.cl. The program is named after the chain, so that configuring the same chain again reuses
+ * the program built by the @ref ClCompileContext.
+ */
+class ClElementwiseChainKernel : public IClKernel
+{
+public:
+    ClElementwiseChainKernel();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(ClElementwiseChainKernel);
+    /** Initialise the kernel's inputs and output.
+     *
+     * Valid data type configurations:
+     * |src            |operands       |dst            |
+     * |:--------------|:--------------|:--------------|
+     * |F32            |F32            |F32            |
+     * |F32            |F32            |F16            |
+     * |F32            |F32            |QASYMM8        |
+     * |F32            |F32            |QASYMM8_SIGNED |
+     * |F16            |F16            |F16            |
+     * |F16            |F16            |F32            |
+     * |F16            |F16            |QASYMM8        |
+     * |F16            |F16            |QASYMM8_SIGNED |
+     *
+     * @param[in]  compile_context The compile context to be used.
+     * @param[in]  src             Input tensor info of the chain. Data types supported: F32/F16.
+     * @param[in]  operands        Operand tensor infos of the binary operations, indexed by @ref ElementwiseChainOp::operand,
+     *                             with the shape of @p src (no broadcasting). Data types supported: same as @p src.
+     * @param[out] dst             Destination tensor info with the shape of @p src. Data types supported: F32/F16 to cast
+     *                             the result of the chain, QASYMM8/QASYMM8_SIGNED to quantize it.
+     * @param[in]  chain           Operations to apply, in order.
+     */
+    void configure(const ClCompileContext                 &compile_context,
+                   const ITensorInfo                      *src,
+                   const std::vector<const ITensorInfo *> &operands,
+                   ITensorInfo                            *dst,
+                   const ElementwiseChainInfo             &chain);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref ClElementwiseChainKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                      *src,
+                           const std::vector<const ITensorInfo *> &operands,
+                           const ITensorInfo                      *dst,
+                           const ElementwiseChainInfo             &chain);
+    /** Generate the elementwise_chain kernel evaluating a chain
+     *
+     * @param[in] chain        Operations to apply, in order
+     * @param[in] num_operands Number of operand tensors of the binary operations
+     *
+     * @return The source of the kernel, to be appended to common/elementwise_chain.cl
+     */
+    static std::string generate_kernel_source(const ElementwiseChainInfo &chain, size_t num_operands);
+
+    // Inherited methods overridden:
+    void run_op(ITensorPack &tensors, const Window &window, ::cl::CommandQueue &queue) override;
+
+private:
+    size_t _num_operands{0};
+};
+} // namespace kernels
+} // namespace opencl
+} // namespace arm_compute
+#endif // ACL_SRC_GPU_CL_KERNELS_CLELEMENTWISECHAINKERNEL_H
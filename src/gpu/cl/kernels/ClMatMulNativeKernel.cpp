@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -82,8 +82,25 @@ Status validate_matmul_kernel_info(const MatMulKernelInfo &matmul_kernel_info)
     return Status{};
 }
 
-Status validate_export_to_cl_image(const ITensorInfo *rhs, const MatMulKernelInfo &matmul_kernel_info)
+Status validate_export_to_cl_image(const ITensorInfo      *lhs,
+                                   const ITensorInfo      *rhs,
+                                   const MatMulKernelInfo &matmul_kernel_info)
 {
+    ARM_COMPUTE_RETURN_ERROR_ON(matmul_kernel_info.export_lhs_to_cl_image && lhs->lock_paddings());
+    if (matmul_kernel_info.export_lhs_to_cl_image)
+    {
+        // The cl_image is created from the beginning of the cl_buffer
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(lhs->offset_first_element_in_bytes() != 0,
+                                        "Export to CLImage requires the Lhs tensor to start at the buffer origin");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(matmul_kernel_info.adj_lhs,
+                                        "Export to CLImage is only supported for Lhs non-transposed");
+        const int k0 = matmul_kernel_info.k0;
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(k0 != 4 && k0 != 8 && k0 != 16,
+                                        "K0 can only be: 4, 8, and 16 for Lhs non-transposed");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!export_to_cl_image(lhs),
+                                        "Export to CLImage is not supported for this device/configuration");
+    }
+
     ARM_COMPUTE_RETURN_ERROR_ON(matmul_kernel_info.export_rhs_to_cl_image && rhs->lock_paddings());
     if (matmul_kernel_info.export_rhs_to_cl_image)
     {
@@ -125,7 +142,7 @@ Status ClMatMulNativeKernel::validate(const ITensorInfo         *lhs,
     ARM_COMPUTE_RETURN_ON_ERROR(validate_matmul_kernel_info(matmul_kernel_info));
     ARM_COMPUTE_RETURN_ON_ERROR(
         validate_matmul_input_shapes(lhs->tensor_shape(), rhs->tensor_shape(), matmul_kernel_info));
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_export_to_cl_image(rhs, matmul_kernel_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_export_to_cl_image(lhs, rhs, matmul_kernel_info));
 
     const TensorShape expected_output_shape =
         misc::shape_calculator::compute_matmul_shape(lhs->tensor_shape(), rhs->tensor_shape(), matmul_kernel_info);
@@ -172,6 +189,7 @@ void ClMatMulNativeKernel::configure(const ClCompileContext    &compile_context,
     int n0 = adjust_vec_size(matmul_kernel_info.n0, n);
 
     _export_rhs_to_cl_image = matmul_kernel_info.export_rhs_to_cl_image && !rhs->lock_paddings();
+    _export_lhs_to_cl_image = matmul_kernel_info.export_lhs_to_cl_image && !lhs->lock_paddings();
 
     // Configure kernel window
     Window win = calculate_max_window(*dst, Steps(n0, m0));
@@ -182,16 +200,20 @@ void ClMatMulNativeKernel::configure(const ClCompileContext    &compile_context,
     const unsigned int partial_store_m0 = m % m0;
     const unsigned int partial_store_n0 = n % n0;
 
+    // The dimension K and the leftover rows are kernel arguments so that a new M or K does not build a new program
+    _k                = k;
+    _partial_store_m0 = partial_store_m0;
+
     CLBuildOptions build_opts;
     build_opts.add_option("-DDATA_TYPE=" + get_cl_type_from_data_type(lhs->data_type()));
     build_opts.add_option("-DM0=" + support::cpp11::to_string(m0));
     build_opts.add_option("-DN0=" + support::cpp11::to_string(n0));
     build_opts.add_option("-DK0=" + support::cpp11::to_string(matmul_kernel_info.k0));
-    build_opts.add_option("-DPARTIAL_STORE_M0=" + support::cpp11::to_string(partial_store_m0));
     build_opts.add_option("-DPARTIAL_STORE_N0=" + support::cpp11::to_string(partial_store_n0));
-    build_opts.add_option("-DK=" + support::cpp11::to_string(k));
     build_opts.add_option_if(bias != nullptr, "-DBIAS");
     build_opts.add_option_if_else(_export_rhs_to_cl_image, "-DRHS_TENSOR_TYPE=IMAGE", "-DRHS_TENSOR_TYPE=BUFFER");
+    build_opts.add_option_if_else(_export_lhs_to_cl_image, "-DLHS_TENSOR_TYPE=IMAGE", "-DLHS_TENSOR_TYPE=BUFFER");
+    build_opts.add_option_if(_export_lhs_to_cl_image, "-DEXPORT_LHS_TO_CL_IMAGE");
 
     // Define values for activation function
     build_opts.add_option(("-DA_VAL=" + float_to_string_with_full_precision(act_info.a())));
@@ -210,6 +232,11 @@ void ClMatMulNativeKernel::configure(const ClCompileContext    &compile_context,
         gemm::update_padding_for_cl_image(rhs);
     }
 
+    if (_export_lhs_to_cl_image)
+    {
+        gemm::update_padding_for_cl_image(lhs);
+    }
+
     // Create kernel
     _kernel = create_kernel(compile_context, kernel_name, build_opts.options());
 
@@ -228,6 +255,8 @@ void ClMatMulNativeKernel::configure(const ClCompileContext    &compile_context,
     _config_id += "_";
     _config_id += support::cpp11::to_string(_export_rhs_to_cl_image);
     _config_id += "_";
+    _config_id += support::cpp11::to_string(_export_lhs_to_cl_image);
+    _config_id += "_";
     _config_id += support::cpp11::to_string(m0);
     _config_id += "_";
     _config_id += support::cpp11::to_string(n0);
@@ -253,6 +282,20 @@ void ClMatMulNativeKernel::run_op(ITensorPack &tensors, const Window &window, cl
     unsigned int idx              = 0;
     Window       window_collapsed = window.collapse(ICLKernel::window(), Window::DimZ);
 
+    cl::Image2D lhs_cl_image;
+    if (_export_lhs_to_cl_image)
+    {
+        const size_t      image_w = lhs->info()->dimension(0) / 4;
+        const size_t      image_h = lhs->info()->tensor_shape().total_size() / lhs->info()->dimension(0);
+        const TensorShape shape2d(image_w, image_h);
+        const size_t      image_row_pitch = lhs->info()->strides_in_bytes()[1];
+
+        // Export cl_buffer to cl_image
+        lhs_cl_image = create_image2d_from_buffer(CLKernelLibrary::get().context(), lhs->cl_buffer(), shape2d,
+                                                  lhs->info()->data_type(), image_row_pitch, CLImage2DType::ReadOnly);
+        _kernel.setArg(idx++, lhs_cl_image);
+    }
+
     add_3d_tensor_nhw_argument(idx, lhs);
 
     cl::Image2D rhs_cl_image;
@@ -275,6 +318,8 @@ void ClMatMulNativeKernel::run_op(ITensorPack &tensors, const Window &window, cl
         add_3d_tensor_nhw_argument(idx, bias);
     }
     add_3d_tensor_nhw_argument(idx, dst);
+    _kernel.setArg<cl_int>(idx++, _k);
+    _kernel.setArg<cl_int>(idx++, _partial_store_m0);
 
     enqueue(queue, *this, window_collapsed, lws_hint());
 }
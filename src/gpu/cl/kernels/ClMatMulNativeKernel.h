@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -78,6 +78,9 @@ public:
 
 private:
     bool _export_rhs_to_cl_image{false};
+    bool _export_lhs_to_cl_image{false};
+    int  _k{0};
+    int  _partial_store_m0{0};
 };
 } // namespace kernels
 } // namespace opencl
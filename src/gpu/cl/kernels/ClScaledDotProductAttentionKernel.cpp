@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/gpu/cl/kernels/ClScaledDotProductAttentionKernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/helpers/AdjustVecSize.h"
+#include "arm_compute/core/utils/StringUtils.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/CL/CLUtils.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "support/Cast.h"
+#include "support/StringSupport.h"
+
+namespace arm_compute
+{
+namespace opencl
+{
+namespace kernels
+{
+namespace
+{
+// Block size dimensions for the MMUL extension
+constexpr int mmul_m0 = 4;
+constexpr int mmul_n0 = 4;
+constexpr int mmul_k0 = 4;
+
+bool is_valid_vector_size(int size)
+{
+    return size == 1 || size == 2 || size == 3 || size == 4 || size == 8 || size == 16;
+}
+
+Status validate_kernel_info(const ITensorInfo                           *q,
+                            const ITensorInfo                           *v,
+                            const ClScaledDotProductAttentionKernelInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.n0 < 1, "Only positive integers are supported for N0");
+    if (info.use_mmul)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!arm_matrix_multiply_supported(CLKernelLibrary::get().get_device()),
+                                        "The extension cl_arm_matrix_multiply is not supported on the target platform");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG_VAR((q->dimension(0) % mmul_k0) != 0,
+                                            "The depth of the queries must be a multiple of %d", mmul_k0);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG_VAR((v->dimension(0) % mmul_n0) != 0,
+                                            "The depth of the values must be a multiple of %d", mmul_n0);
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.m0 < 1, "Only positive integers are supported for M0");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_valid_vector_size(info.n0), "Only 1,2,3,4,8,16 are supported for N0");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_valid_vector_size(info.k0), "Only 1,2,3,4,8,16 are supported for K0");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_valid_vector_size(info.dv0), "Only 1,2,3,4,8,16 are supported for DV0");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG((q->dimension(0) % info.k0) != 0,
+                                        "The depth of the queries must be a multiple of K0");
+    }
+    return Status{};
+}
+} // namespace
+
+ClScaledDotProductAttentionKernel::ClScaledDotProductAttentionKernel()
+{
+    _type = CLKernelType::GEMM;
+}
+
+Status ClScaledDotProductAttentionKernel::validate(const ITensorInfo                           *q,
+                                                   const ITensorInfo                           *k,
+                                                   const ITensorInfo                           *v,
+                                                   const ITensorInfo                           *dst,
+                                                   float                                        scale,
+                                                   bool                                         is_causal,
+                                                   const ClScaledDotProductAttentionKernelInfo &info)
+{
+    ARM_COMPUTE_UNUSED(scale);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(q, k, v, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(q, 1, DataType::F32, DataType::F16);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(q, k, v);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(q->num_dimensions() > 4, "Only up to 4 dimensions are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(k->dimension(0) != q->dimension(0), "Queries and keys must have the same depth");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(v->dimension(1) != k->dimension(1), "Keys and values must have the same length");
+    for (size_t d = 2; d < TensorShape::num_max_dimensions; ++d)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(k->dimension(d) != q->dimension(d) || v->dimension(d) != q->dimension(d),
+                                        "Queries, keys and values must have the same heads and batches");
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_causal && k->dimension(1) < q->dimension(1),
+                                    "A causal attention needs at least as many keys as queries");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_kernel_info(q, v, info));
+
+    if (dst->total_size() != 0)
+    {
+        const TensorShape dst_shape = TensorShape(q->tensor_shape()).set(0, v->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(q, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), dst_shape);
+    }
+
+    return Status{};
+}
+
+void ClScaledDotProductAttentionKernel::configure(const ClCompileContext                      &compile_context,
+                                                  const ITensorInfo                           *q,
+                                                  const ITensorInfo                           *k,
+                                                  const ITensorInfo                           *v,
+                                                  ITensorInfo                                 *dst,
+                                                  float                                        scale,
+                                                  bool                                         is_causal,
+                                                  const ClScaledDotProductAttentionKernelInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(q, k, v, dst);
+    ARM_COMPUTE_LOG_PARAMS(q, k, v, dst, scale, is_causal);
+
+    // dst tensor auto initialization if not yet initialized
+    auto_init_if_empty(*dst, q->clone()->set_tensor_shape(TensorShape(q->tensor_shape()).set(0, v->dimension(0))));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate(q, k, v, dst, scale, is_causal, info));
+
+    const int d   = q->dimension(0);
+    const int sq  = q->dimension(1);
+    const int skv = k->dimension(1);
+    const int dv  = v->dimension(0);
+
+    _use_mmul = info.use_mmul;
+
+    CLBuildOptions build_opts;
+    build_opts.add_option("-DDATA_TYPE=" + get_cl_type_from_data_type(q->data_type()));
+    build_opts.add_option("-DN0=" + support::cpp11::to_string(info.n0));
+    build_opts.add_option("-DD=" + support::cpp11::to_string(d));
+    build_opts.add_option("-DSKV=" + support::cpp11::to_string(skv));
+    build_opts.add_option("-DSCALE=" + float_to_string_with_full_precision(scale));
+    build_opts.add_option_if(is_causal, "-DIS_CAUSAL");
+    build_opts.add_option_if(is_causal, "-DCAUSAL_OFFSET=" + support::cpp11::to_string(skv - sq));
+
+    std::string kernel_name("scaled_dot_product_attention");
+    int         m0  = mmul_m0;
+    int         dv0 = mmul_n0;
+    if (_use_mmul)
+    {
+        kernel_name += "_mmul";
+
+        build_opts.add_option("-DDV=" + support::cpp11::to_string(dv));
+        build_opts.add_option("-DSQ=" + support::cpp11::to_string(sq));
+        build_opts.add_option("-DMMUL_M0=" + support::cpp11::to_string(mmul_m0));
+        build_opts.add_option("-DMMUL_N0=" + support::cpp11::to_string(mmul_n0));
+        build_opts.add_option("-DMMUL_K0=" + support::cpp11::to_string(mmul_k0));
+
+        // One work-group of mmul_m0 x mmul_n0 work-items per block of mmul_m0 query rows
+        Window win = calculate_max_window(*dst, Steps(1, 1));
+        win        = win.collapse(win, Window::DimZ);
+        win.set(Window::DimX, Window::Dimension(0, mmul_m0 * mmul_n0, 1));
+        win.set(Window::DimY, Window::Dimension(0, ceil_to_multiple(sq, mmul_m0) / mmul_m0, 1));
+        IClKernel::configure_internal(win);
+    }
+    else
+    {
+        kernel_name += "_native";
+
+        m0  = std::min(info.m0, sq);
+        dv0 = adjust_vec_size(info.dv0, dv);
+
+        build_opts.add_option("-DM0=" + support::cpp11::to_string(m0));
+        build_opts.add_option("-DK0=" + support::cpp11::to_string(info.k0));
+        build_opts.add_option("-DDV0=" + support::cpp11::to_string(dv0));
+        build_opts.add_option("-DPARTIAL_STORE_M0=" + support::cpp11::to_string(sq % m0));
+        build_opts.add_option("-DPARTIAL_STORE_DV0=" + support::cpp11::to_string(dv % dv0));
+
+        Window win = calculate_max_window(*dst, Steps(dv0, m0));
+        win        = win.collapse(win, Window::DimZ);
+        IClKernel::configure_internal(win);
+    }
+
+    // A macro guard to compile ONLY the kernel of interest
+    build_opts.add_option("-D" + upper_string(kernel_name));
+
+    // Create kernel
+    _kernel = create_kernel(compile_context, kernel_name, build_opts.options());
+
+    // Set config_id for enabling LWS tuning
+    _config_id = kernel_name;
+    _config_id += "_";
+    _config_id += lower_string(string_from_data_type(q->data_type()));
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(d);
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(dv);
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(sq);
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(skv);
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(dst->tensor_shape().total_size_upper(2));
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(is_causal);
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(m0);
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(info.n0);
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(dv0);
+}
+
+void ClScaledDotProductAttentionKernel::run_op(ITensorPack &tensors, const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
+
+    const ICLTensor *q =
+        utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC_0));
+    const ICLTensor *k =
+        utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC_1));
+    const ICLTensor *v =
+        utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC_2));
+    ICLTensor *dst = utils::cast::polymorphic_downcast<ICLTensor *>(tensors.get_tensor(TensorType::ACL_DST));
+    ARM_COMPUTE_ERROR_ON_NULLPTR(q, k, v, dst);
+    ARM_COMPUTE_LOG_PARAMS(q, k, v, dst);
+
+    unsigned int idx = 0;
+    add_3d_tensor_nhw_argument(idx, q);
+    add_3d_tensor_nhw_argument(idx, k);
+    add_3d_tensor_nhw_argument(idx, v);
+    add_3d_tensor_nhw_argument(idx, dst);
+
+    if (_use_mmul)
+    {
+        // The work-items of a MMUL block share the scores of their rows through local memory: one block per work-group
+        enqueue(queue, *this, window, cl::NDRange(mmul_m0 * mmul_n0, 1, 1), false);
+    }
+    else
+    {
+        enqueue(queue, *this, window, lws_hint());
+    }
+}
+} // namespace kernels
+} // namespace opencl
+} // namespace arm_compute
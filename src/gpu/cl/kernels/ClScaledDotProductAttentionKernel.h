@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_GPU_CL_KERNELS_CLSCALEDDOTPRODUCTATTENTIONKERNEL_H
+#define ACL_SRC_GPU_CL_KERNELS_CLSCALEDDOTPRODUCTATTENTIONKERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/gpu/cl/ClCompileContext.h"
+#include "src/gpu/cl/IClKernel.h"
+
+namespace arm_compute
+{
+namespace opencl
+{
+namespace kernels
+{
+/** Variant and block sizes of @ref ClScaledDotProductAttentionKernel */
+struct ClScaledDotProductAttentionKernelInfo
+{
+    bool use_mmul{false}; /**< Use the Arm® matrix multiply extension (cl_arm_matrix_multiply) */
+    int  m0{1};           /**< Number of query rows processed by a work-item. Native variant only */
+    int  n0{1};           /**< Number of keys (blocks of 4 keys for the MMUL variant) visited at once */
+    int  k0{1};           /**< Number of elements of the depth of the queries loaded at once. Native variant only */
+    int  dv0{1};          /**< Number of output columns processed by a work-item. Native variant only */
+};
+
+/** OpenCL kernel to compute a fused scaled dot product attention
+ *
+ * Computes, for every head: @f[ dst = softmax(scale * Q K^T) V @f]
+ *
+ * The keys are visited in blocks and the softmax is computed online, so the Sq x Skv scores are kept in registers
+ * (and local memory for the MMUL variant) instead of being written to global memory.
+ */
+class ClScaledDotProductAttentionKernel : public IClKernel
+{
+public:
+    ClScaledDotProductAttentionKernel();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(ClScaledDotProductAttentionKernel);
+    /** Initialise the kernel's inputs and output.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |q              |k              |v              |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|
+     * |F32            |F32            |F32            |F32            |
+     * |F16            |F16            |F16            |F16            |
+     *
+     * @param[in]  compile_context The compile context to be used.
+     * @param[in]  q               Queries tensor info with shape [D, Sq, H, B]. Data types supported: F32/F16.
+     * @param[in]  k               Keys tensor info with shape [D, Skv, H, B]. Data type supported: same as @p q.
+     * @param[in]  v               Values tensor info with shape [Dv, Skv, H, B]. Data type supported: same as @p q.
+     * @param[out] dst             Destination tensor info with shape [Dv, Sq, H, B]. Data type supported: same as @p q.
+     * @param[in]  scale           Scale applied to the scores before the softmax, usually 1 / sqrt(D).
+     * @param[in]  is_causal       Whether query i only attends to the keys up to i + Skv - Sq.
+     * @param[in]  info            Variant and block sizes of the kernel
+     */
+    void configure(const ClCompileContext                      &compile_context,
+                   const ITensorInfo                           *q,
+                   const ITensorInfo                           *k,
+                   const ITensorInfo                           *v,
+                   ITensorInfo                                 *dst,
+                   float                                        scale,
+                   bool                                         is_causal,
+                   const ClScaledDotProductAttentionKernelInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref ClScaledDotProductAttentionKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                           *q,
+                           const ITensorInfo                           *k,
+                           const ITensorInfo                           *v,
+                           const ITensorInfo                           *dst,
+                           float                                        scale,
+                           bool                                         is_causal,
+                           const ClScaledDotProductAttentionKernelInfo &info);
+
+    // Inherited methods overridden:
+    void run_op(ITensorPack &tensors, const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    bool _use_mmul{false};
+};
+} // namespace kernels
+} // namespace opencl
+} // namespace arm_compute
+#endif // ACL_SRC_GPU_CL_KERNELS_CLSCALEDDOTPRODUCTATTENTIONKERNEL_H
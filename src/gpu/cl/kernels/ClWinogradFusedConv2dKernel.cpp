@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/gpu/cl/kernels/ClWinogradFusedConv2dKernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/ActivationFunctionUtils.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/StringUtils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/CL/CLValidate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "support/Cast.h"
+#include "support/StringSupport.h"
+
+using namespace arm_compute::misc::shape_calculator;
+
+namespace arm_compute
+{
+namespace opencl
+{
+namespace kernels
+{
+namespace
+{
+constexpr unsigned int max_wg_size = 16;
+
+// Number of channels processed by each work-item, it must divide both the input and output channels
+unsigned int fused_n0(unsigned int src_channels, unsigned int dst_channels)
+{
+    for (unsigned int n0 : {4U, 2U})
+    {
+        if ((src_channels % n0) == 0 && (dst_channels % n0) == 0)
+        {
+            return n0;
+        }
+    }
+    return 1U;
+}
+
+TensorShape fused_dst_shape(const ITensorInfo &src, const ITensorInfo &weights, const WinogradInfo &winograd_info)
+{
+    const Size2D num_tiles =
+        compute_winograd_convolution_tiles(winograd_info.input_dimensions, winograd_info.kernel_size,
+                                           winograd_info.output_tile_size, winograd_info.convolution_info);
+
+    // Shape of the output of the batched matrix multiplication the kernel replaces
+    const TensorShape mm_shape(weights.dimension(0), num_tiles.area(), weights.dimension(2),
+                               src.tensor_shape().total_size_upper(3));
+    return compute_winograd_output_transform_shape(TensorInfo(mm_shape, 1, src.data_type()), winograd_info);
+}
+
+Status validate_arguments(const ITensorInfo  *src,
+                          const ITensorInfo  *weights,
+                          const ITensorInfo  *bias,
+                          const ITensorInfo  *dst,
+                          const WinogradInfo &winograd_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32, DataType::F16);
+    ARM_COMPUTE_RETURN_ERROR_ON_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->data_layout() != DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(winograd_info.output_data_layout != DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(winograd_info.output_tile_size != Size2D(4U, 4U) ||
+                                        winograd_info.kernel_size != Size2D(3U, 3U),
+                                    "Winograd fused convolution only supports F(4x4, 3x3)");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(winograd_info.convolution_info.stride() != std::make_pair(1U, 1U),
+                                    "Winograd fused convolution only supports unit strides");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(
+        (winograd_info.convolution_info.pad_left() > 1U) || (winograd_info.convolution_info.pad_top() > 1U),
+        "Winograd only supports padding up to half kernel size");
+
+    // The transformed weights are [OFM, IFM, 36]
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(1) != src->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(2) != 36U);
+
+    if (bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != bias->dimension(0));
+    }
+
+    // Checks performed when output is configured
+    if (dst->total_size() != 0)
+    {
+        const TensorInfo tensor_info_dst =
+            src->clone()->set_tensor_shape(fused_dst_shape(*src, *weights, winograd_info));
+
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(dst, &tensor_info_dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->data_layout() != DataLayout::NHWC);
+    }
+
+    // The work-items address the tensors as rows of channels
+    ARM_COMPUTE_RETURN_ERROR_ON(src->has_padding() || ((dst->total_size() != 0) && dst->has_padding()));
+
+    return Status{};
+}
+
+Window configure_fused_window(unsigned int dst_channels, unsigned int n0, unsigned int wg_size, const Size2D &num_tiles,
+                              size_t total_batches)
+{
+    // The work-items of a work-group share one tile, so dimension X is made of whole work-groups
+    const unsigned int num_blocks = DIV_CEIL(dst_channels, n0);
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(num_blocks, wg_size), 1));
+    win.set(Window::DimY, Window::Dimension(0, num_tiles.area(), 1));
+    win.set(Window::DimZ, Window::Dimension(0, total_batches, 1));
+    return win;
+}
+} // namespace
+
+ClWinogradFusedConv2dKernel::ClWinogradFusedConv2dKernel()
+{
+    _type = CLKernelType::WINOGRAD;
+}
+
+void ClWinogradFusedConv2dKernel::configure(const ClCompileContext    &compile_context,
+                                            ITensorInfo               *src,
+                                            ITensorInfo               *weights,
+                                            ITensorInfo               *bias,
+                                            ITensorInfo               *dst,
+                                            const WinogradInfo        &winograd_info,
+                                            const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+
+    // Output tensor auto initialization if not yet initialized
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(fused_dst_shape(*src, *weights, winograd_info)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, weights, bias, dst, winograd_info));
+
+    auto padding_info = get_padding_info({src, weights, bias, dst});
+
+    const int idx_width  = get_data_layout_dimension_index(DataLayout::NHWC, DataLayoutDimension::WIDTH);
+    const int idx_height = get_data_layout_dimension_index(DataLayout::NHWC, DataLayoutDimension::HEIGHT);
+
+    const unsigned int src_channels  = src->dimension(0);
+    const unsigned int dst_channels  = dst->dimension(0);
+    const size_t       total_batches = src->tensor_shape().total_size_upper(3);
+    const Size2D       num_tiles =
+        compute_winograd_convolution_tiles(winograd_info.input_dimensions, winograd_info.kernel_size,
+                                           winograd_info.output_tile_size, winograd_info.convolution_info);
+    const unsigned int n0 = fused_n0(src_channels, dst_channels);
+
+    // The more work-items share a tile, the fewer times its input transform is computed
+    const unsigned int num_blocks = DIV_CEIL(dst_channels, n0);
+    _wg_size                      = std::min(max_wg_size, num_blocks);
+    while ((_wg_size & (_wg_size - 1)) != 0)
+    {
+        _wg_size &= _wg_size - 1;
+    }
+
+    _src_width  = src->dimension(idx_width);
+    _src_height = src->dimension(idx_height);
+    _dst_width  = dst->dimension(idx_width);
+    _dst_height = dst->dimension(idx_height);
+
+    // Set build options
+    CLBuildOptions build_opts;
+    build_opts.add_option("-DACTIVATION_TYPE=" + lower_string(string_from_activation_func(act_info.activation())));
+    build_opts.add_option_if(act_info.enabled(), "-DA_VAL=" + float_to_string_with_full_precision(act_info.a()));
+    build_opts.add_option_if(act_info.enabled(), "-DB_VAL=" + float_to_string_with_full_precision(act_info.b()));
+
+    // Conditions of -cl-fast-relaxed-math causing accuracy issues can be traced from COMPMID-5324
+    const GPUTarget gpu_target   = get_target();
+    const auto      act_function = act_info.activation();
+    if ((gpu_target != GPUTarget::G71 && (gpu_target & GPUTarget::GPU_ARCH_MASK) == GPUTarget::BIFROST) &&
+        (act_function == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU ||
+         act_function == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU))
+    {
+        // -cl-fast-relaxed-math also sets -cl-finite-math-only and -cl-unsafe-math-optimizations
+        // to disable -cl-finite-math-only, we only include -cl-unsafe-math-optimizations
+        build_opts.add_option("-cl-unsafe-math-optimizations");
+    }
+    else
+    {
+        build_opts.add_option("-cl-fast-relaxed-math");
+    }
+
+    // F16 is accumulated in F32 as in the mixed precision batched matrix multiplication
+    build_opts.add_option("-DDATA_TYPE=" + get_cl_type_from_data_type(src->data_type()));
+    build_opts.add_option("-DACC_DATA_TYPE=float");
+    build_opts.add_option("-DN0=" + support::cpp11::to_string(n0));
+    build_opts.add_option("-DSRC_CHANNELS=" + support::cpp11::to_string(src_channels));
+    build_opts.add_option("-DDST_CHANNELS=" + support::cpp11::to_string(dst_channels));
+    build_opts.add_option("-DPAD_LEFT=" + support::cpp11::to_string(winograd_info.convolution_info.pad_left()));
+    build_opts.add_option("-DPAD_TOP=" + support::cpp11::to_string(winograd_info.convolution_info.pad_top()));
+    build_opts.add_option("-DNUM_TILES_X=" + support::cpp11::to_string(num_tiles.width));
+    build_opts.add_option_if(bias != nullptr, std::string("-DHAS_BIAS"));
+    build_opts.add_option_if(total_batches > 1, "-DIS_BATCHED");
+
+    // Create kernel
+    const std::string kernel_name = "winograd_fused_conv2d_" + winograd_info.output_tile_size.to_string() + "_" +
+                                    winograd_info.kernel_size.to_string() + "_nhwc";
+
+    // A macro guard to compile ONLY the kernel of interest
+    build_opts.add_option("-D" + upper_string(kernel_name));
+
+    // The local memory is sized for the work-group, so halve it until the compiled kernel can run that many work-items
+    build_opts.add_option("-DWG_SIZE=" + support::cpp11::to_string(_wg_size));
+    _kernel = create_kernel(compile_context, kernel_name, build_opts.options());
+    while (_wg_size > 1 && CLKernelLibrary::get().max_local_workgroup_size(_kernel) < _wg_size)
+    {
+        _wg_size /= 2;
+
+        std::set<std::string> opts = build_opts.options();
+        opts.erase("-DWG_SIZE=" + support::cpp11::to_string(_wg_size * 2));
+        opts.emplace("-DWG_SIZE=" + support::cpp11::to_string(_wg_size));
+        _kernel = create_kernel(compile_context, kernel_name, opts);
+    }
+
+    IClKernel::configure_internal(configure_fused_window(dst_channels, n0, _wg_size, num_tiles, total_batches));
+
+    // Set config_id for enabling LWS tuning
+    _config_id = kernel_name;
+    _config_id += "_";
+    _config_id += lower_string(string_from_data_type(src->data_type()));
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(src->dimension(0));
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(src->dimension(1));
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(src->dimension(2));
+    _config_id += "_";
+    _config_id += support::cpp11::to_string(dst->dimension(0));
+
+    ARM_COMPUTE_ERROR_ON(has_padding_changed(padding_info));
+}
+
+Status ClWinogradFusedConv2dKernel::validate(const ITensorInfo         *src,
+                                             const ITensorInfo         *weights,
+                                             const ITensorInfo         *bias,
+                                             const ITensorInfo         *dst,
+                                             const WinogradInfo        &winograd_info,
+                                             const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_UNUSED(act_info);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, weights, bias, dst, winograd_info));
+    return Status{};
+}
+
+void ClWinogradFusedConv2dKernel::run_op(ITensorPack &tensors, const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IClKernel::window(), window);
+
+    const auto src =
+        utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC_0));
+    const auto weights =
+        utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC_1));
+    const auto bias =
+        utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC_2));
+    auto dst = utils::cast::polymorphic_downcast<ICLTensor *>(tensors.get_tensor(TensorType::ACL_DST));
+
+    // The tensors are addressed from their first element, the work-items compute their own offsets
+    Window slice_tensor;
+    slice_tensor.use_tensor_dimensions(TensorShape(1U, 1U, 1U, 1U));
+
+    unsigned int idx = 0;
+    add_4D_tensor_argument(idx, src, slice_tensor);
+    add_4D_tensor_argument(idx, weights, slice_tensor);
+    if (bias != nullptr)
+    {
+        Window slice_biases;
+        slice_biases.use_tensor_dimensions(bias->info()->tensor_shape());
+        add_1D_tensor_argument(idx, bias, slice_biases);
+    }
+    add_4D_tensor_argument(idx, dst, slice_tensor);
+    _kernel.setArg<cl_int>(idx++, _src_width);
+    _kernel.setArg<cl_int>(idx++, _src_height);
+    _kernel.setArg<cl_int>(idx++, _dst_width);
+    _kernel.setArg<cl_int>(idx++, _dst_height);
+
+    // The work-items of a work-group share the transformed input tile through local memory
+    enqueue(queue, *this, window, cl::NDRange(_wg_size, 1, 1));
+}
+} // namespace kernels
+} // namespace opencl
+} // namespace arm_compute
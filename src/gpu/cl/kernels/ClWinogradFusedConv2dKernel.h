@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_GPU_CL_KERNELS_CLWINOGRADFUSEDCONV2DKERNEL_H
+#define ACL_SRC_GPU_CL_KERNELS_CLWINOGRADFUSEDCONV2DKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/gpu/cl/ClCompileContext.h"
+#include "src/gpu/cl/IClKernel.h"
+
+namespace arm_compute
+{
+namespace opencl
+{
+namespace kernels
+{
+/** Interface for the kernel computing a Winograd convolution from the transformed weights in a single pass
+ *
+ * The input transform runs on one tile at a time in local memory and the output transform is applied to the result of
+ * the matrix multiplication in registers, so neither the transformed input nor the output of the batched matrix
+ * multiplication go through global memory.
+ */
+class ClWinogradFusedConv2dKernel : public IClKernel
+{
+public:
+    ClWinogradFusedConv2dKernel();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(ClWinogradFusedConv2dKernel);
+    /** Set the input and output tensor.
+     *
+     * @note Winograd fused convolution supports the following configurations for NHWC data layout
+     *       F(output tile, kernel size):F(4x4, 3x3)
+     *
+     *       Strides: only unit strides
+     *
+     * @param[in]  compile_context The compile context to be used.
+     * @param[in]  src             Source tensor info with shape [IFM, width, height, batches]. Data types supported: F16/F32.
+     * @param[in]  weights         Transformed weights tensor info with shape [OFM, IFM, 36], as computed by @ref ClWinogradFilterTransformKernel.
+     *                             Data types supported: Same as @p src
+     * @param[in]  bias            Biases tensor info. Biases are 1D tensor with dimensions [OFM]. It can be a nullptr. Data type supported: Same as @p src
+     * @param[out] dst             Destination tensor info with shape [OFM, width, height, batches]. Data types supported: Same as @p src
+     * @param[in]  winograd_info   Contains Winograd's information described in @ref WinogradInfo
+     * @param[in]  act_info        (Optional) Activation layer information in case of a fused activation.
+     */
+    void configure(const ClCompileContext    &compile_context,
+                   ITensorInfo               *src,
+                   ITensorInfo               *weights,
+                   ITensorInfo               *bias,
+                   ITensorInfo               *dst,
+                   const WinogradInfo        &winograd_info,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to ClWinogradFusedConv2dKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *src,
+                           const ITensorInfo         *weights,
+                           const ITensorInfo         *bias,
+                           const ITensorInfo         *dst,
+                           const WinogradInfo        &winograd_info,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run_op(ITensorPack &tensors, const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    int32_t      _src_width{0};
+    int32_t      _src_height{0};
+    int32_t      _dst_width{0};
+    int32_t      _dst_height{0};
+    unsigned int _wg_size{1};
+};
+} // namespace kernels
+} // namespace opencl
+} // namespace arm_compute
+#endif // ACL_SRC_GPU_CL_KERNELS_CLWINOGRADFUSEDCONV2DKERNEL_H
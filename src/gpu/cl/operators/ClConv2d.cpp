@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #include "src/gpu/cl/operators/ClConv2d.h"
 
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
 #include "arm_compute/runtime/CL/functions/CLFFTConvolutionLayer.h"
@@ -33,6 +34,7 @@
 #include "src/gpu/cl/operators/ClGemmConv2d.h"
 #include "src/gpu/cl/operators/ClIndirectConv2d.h"
 #include "src/gpu/cl/operators/ClWinogradConv2d.h"
+#include "utils/TypePrinter.h"
 
 #include <memory>
 
@@ -86,11 +88,14 @@ void ClConv2d::configure(const CLCompileContext &compile_context,
                          const WeightsInfo      &weights_info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
-    ARM_COMPUTE_ERROR_THROW_ON(
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(
         ClConv2d::validate(src, weights, ((biases != nullptr) ? biases : nullptr), dst, conv2d_info, weights_info));
+    const TrustedConfigureScope trusted_configure{};
     ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, conv2d_info, weights_info);
 
-    switch (ClConv2d::get_convolution_method(src, weights, dst, conv2d_info, weights_info, CLScheduler::get().target()))
+    _method =
+        ClConv2d::get_convolution_method(src, weights, dst, conv2d_info, weights_info, CLScheduler::get().target());
+    switch (_method)
     {
         case ConvolutionMethod::WINOGRAD:
         {
@@ -429,5 +434,17 @@ experimental::MemoryRequirements ClConv2d::workspace() const
 {
     return _aux_mem;
 }
+
+OperatorDescription ClConv2d::describe() const
+{
+    OperatorDescription desc{};
+    desc.name   = "ClConv2d";
+    desc.method = to_string(_method);
+    if (_operator != nullptr)
+    {
+        desc.children.emplace_back(_operator->describe());
+    }
+    return desc;
+}
 } // namespace opencl
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -157,10 +157,12 @@ public:
     void                             run(ITensorPack &tensors) override;
     void                             prepare(ITensorPack &tensors) override;
     experimental::MemoryRequirements workspace() const override;
+    OperatorDescription              describe() const override;
 
 private:
     std::unique_ptr<IClOperator>     _operator;
     experimental::MemoryRequirements _aux_mem{};
+    ConvolutionMethod                _method{ConvolutionMethod::GEMM};
 };
 } // namespace opencl
 } // namespace arm_compute
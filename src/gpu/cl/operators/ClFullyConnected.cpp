@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023 Arm Limited.
+ * Copyright (c) 2017-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include "arm_compute/core/Size2D.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
 
@@ -156,7 +157,7 @@ Status validate_mm(const ITensorInfo             &src,
                                              fc_info.retain_internal_weights, // retain_internal_weights
                                              gemmlowp_output_stage,           // gemmlowp_output_stage
                                              fc_info.fp_mixed_precision,      // fp_mixed_precision
-                                             false,                           // fast_math
+                                             fc_info.enable_fast_math,        // fast_math
                                              true,                            // broadcast_bias
                                              ActivationLayerInfo());          // activation_info
 
@@ -252,7 +253,7 @@ void ClFullyConnected::configure_mm(const CLCompileContext        &compile_conte
                                              fc_info.retain_internal_weights, // retain_internal_weights
                                              gemmlowp_output_stage,           // gemmlowp_output_stage
                                              fc_info.fp_mixed_precision,      // fp_mixed_precision
-                                             false,                           // fast_math
+                                             fc_info.enable_fast_math,        // fast_math
                                              true,                            // broadcast_bias
                                              fc_info.activation_info);        // activation_info
 
@@ -338,7 +339,8 @@ void ClFullyConnected::configure(const CLCompileContext &compile_context,
     const GPUTarget gpu_target = get_arch_from_target(CLScheduler::get().target());
 
     // Perform validate step
-    ARM_COMPUTE_ERROR_THROW_ON(ClFullyConnected::validate(src, weights, biases, dst, fc_info));
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(ClFullyConnected::validate(src, weights, biases, dst, fc_info));
+    const TrustedConfigureScope trusted_configure{};
     ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, fc_info);
 
     _transpose_weights  = fc_info.transpose_weights ? !fc_info.are_weights_reshaped : false;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
 #include "arm_compute/runtime/ITensorAllocator.h"
@@ -46,6 +47,7 @@
 #include "src/gpu/cl/utils/ClAuxTensorHandler.h"
 #include "src/runtime/CL/gemm/CLGEMMKernelSelection.h"
 #include "src/runtime/CL/gemm_auto_heuristics/CLGEMMAutoHeuristics.h"
+#include "src/runtime/CL/gemm_auto_heuristics/CLGEMMConfigTuner.h"
 #include "support/Cast.h"
 #include "utils/TypePrinter.h"
 
@@ -61,19 +63,39 @@ using namespace arm_compute::opencl::kernels;
 
 namespace
 {
+// Identify the reshape of the RHS matrix so that the reshaped weights can be shared by several operators
+std::string rhs_reshape_id(const ITensorInfo &b, const GEMMRHSMatrixInfo &rhs_info, const ITensorInfo &reshaped_b)
+{
+    return "gemm_reshape_rhs_" + to_string(b.tensor_shape()) + "_" + string_from_data_type(b.data_type()) + "_" +
+           to_string(rhs_info) + "_" + to_string(reshaped_b.tensor_shape());
+}
+
 inline bool validate_gemm_kernel(CLGEMMKernelType kernel_type)
 {
     return kernel_type == CLGEMMKernelType::NATIVE ? false : true;
 }
+// FP16 GEMMs accumulate in FP32 when asked to, unless fast math allows to trade the accuracy for speed
+inline bool use_fp32_accumulation(const ITensorInfo &a, const GEMMInfo &gemm_info)
+{
+    return a.data_type() == DataType::F16 && gemm_info.fp_mixed_precision() && !gemm_info.fast_math();
+}
 //Automatically select between mlgo (prioritized) and default heuristics for gemm kernel type
-inline CLGEMMKernelType
-auto_select_gemm_kernel(auto_heuristics::CommonQuery query, bool reshape_b_only_on_first_run, bool constant_weights)
+inline CLGEMMKernelType auto_select_gemm_kernel(auto_heuristics::CommonQuery query,
+                                                bool                         reshape_b_only_on_first_run,
+                                                bool                         constant_weights,
+                                                bool                         fp32_accumulation)
 {
     if (!constant_weights)
     {
         return CLGEMMKernelType::NATIVE;
     }
 
+    // The reshaped kernel is the only one implementing wider accumulators
+    if (fp32_accumulation)
+    {
+        return CLGEMMKernelType::RESHAPED;
+    }
+
     auto gemm_kernel = auto_heuristics::select_mlgo_gemm_kernel(query, reshape_b_only_on_first_run);
     if (bool(gemm_kernel))
     {
@@ -134,20 +156,32 @@ auto_select_gemm_config_reshaped_only_rhs(auto_heuristics::CommonQuery query,
                                           const ITensorInfo           *output)
 {
     auto config = auto_heuristics::select_mlgo_gemm_config_reshaped_only_rhs(query);
-    if (config)
+    if (config &&
+        validate_lhs_rhs_info_reshaped_only_rhs(config.lhs_info, config.rhs_info, a, b, c, output, kernel_info))
     {
-        if (validate_lhs_rhs_info_reshaped_only_rhs(config.lhs_info, config.rhs_info, a, b, c, output, kernel_info))
-        {
-            ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE(
-                "Use reshaped_only_rhs config from mlgo heuristics: LHS info: %s ; RHS info: %s ",
-                to_string(config.lhs_info).c_str(), to_string(config.rhs_info).c_str());
-            return {config.lhs_info, config.rhs_info};
-        }
+        ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE(
+            "Use reshaped_only_rhs config from mlgo heuristics: LHS info: %s ; RHS info: %s ",
+            to_string(config.lhs_info).c_str(), to_string(config.rhs_info).c_str());
+    }
+    else
+    {
+        config = auto_heuristics::select_default_gemm_config_reshaped_only_rhs(query);
+        ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE(
+            "Use reshaped_only_rhs config from default heuristics: LHS info: %s ; RHS info: %s ",
+            to_string(config.lhs_info).c_str(), to_string(config.rhs_info).c_str());
+    }
+
+    // Search around the selected config for a faster one, the winner is recorded in the mlgo heuristics
+    if (auto_heuristics::is_gemm_config_tuning_enabled())
+    {
+        const auto validate = [&](const GEMMLHSMatrixInfo &lhs_info, const GEMMRHSMatrixInfo &rhs_info)
+        { return validate_lhs_rhs_info_reshaped_only_rhs(lhs_info, rhs_info, a, b, c, output, kernel_info); };
+        config = auto_heuristics::tune_gemm_config_reshaped_only_rhs(query, config, validate, a, b, c, output,
+                                                                     kernel_info);
+        ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE(
+            "Use reshaped_only_rhs config from tuning: LHS info: %s ; RHS info: %s ",
+            to_string(config.lhs_info).c_str(), to_string(config.rhs_info).c_str());
     }
-    config = auto_heuristics::select_default_gemm_config_reshaped_only_rhs(query);
-    ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE(
-        "Use reshaped_only_rhs config from default heuristics: LHS info: %s ; RHS info: %s ",
-        to_string(config.lhs_info).c_str(), to_string(config.rhs_info).c_str());
     return {config.lhs_info, config.rhs_info};
 }
 
@@ -201,21 +235,35 @@ auto_select_gemm_config_reshaped(auto_heuristics::CommonQuery query,
                                  bool                         reinterpret_input_as_3d)
 {
     auto config = auto_heuristics::select_mlgo_gemm_config_reshaped(query);
-    if (config)
+    if (config && validate_lhs_rhs_info_reshaped(config.lhs_info, config.rhs_info, a, b, c, output, kernel_info,
+                                                 reinterpret_input_as_3d))
+    {
+        ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE(
+            "Use reshaped config from mlgo heuristics: LHS info: %s ; RHS info: %s ",
+            to_string(config.lhs_info).c_str(), to_string(config.rhs_info).c_str());
+    }
+    else
+    {
+        config = auto_heuristics::select_default_gemm_config_reshaped(query);
+        ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE(
+            "Use reshaped config from default heuristics: LHS info: %s ; RHS info: %s ",
+            to_string(config.lhs_info).c_str(), to_string(config.rhs_info).c_str());
+    }
+
+    // Search around the selected config for a faster one, the winner is recorded in the mlgo heuristics
+    if (auto_heuristics::is_gemm_config_tuning_enabled())
     {
-        if (validate_lhs_rhs_info_reshaped(config.lhs_info, config.rhs_info, a, b, c, output, kernel_info,
-                                           reinterpret_input_as_3d))
+        const auto validate = [&](const GEMMLHSMatrixInfo &lhs_info, const GEMMRHSMatrixInfo &rhs_info)
         {
-            ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE(
-                "Use reshaped config from mlgo heuristics: LHS info: %s ; RHS info: %s ",
-                to_string(config.lhs_info).c_str(), to_string(config.rhs_info).c_str());
-            return {config.lhs_info, config.rhs_info};
-        }
+            return validate_lhs_rhs_info_reshaped(lhs_info, rhs_info, a, b, c, output, kernel_info,
+                                                  reinterpret_input_as_3d);
+        };
+        config = auto_heuristics::tune_gemm_config_reshaped(query, config, validate, a, b, c, output, kernel_info,
+                                                            reinterpret_input_as_3d);
+        ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE(
+            "Use reshaped config from tuning: LHS info: %s ; RHS info: %s ", to_string(config.lhs_info).c_str(),
+            to_string(config.rhs_info).c_str());
     }
-    config = auto_heuristics::select_default_gemm_config_reshaped(query);
-    ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE(
-        "Use reshaped config from default heuristics: LHS info: %s ; RHS info: %s ", to_string(config.lhs_info).c_str(),
-        to_string(config.rhs_info).c_str());
     return {config.lhs_info, config.rhs_info};
 }
 } // namespace
@@ -232,7 +280,8 @@ ClGemm::ClGemm()
       _reshape_b_only_on_first_run(false),
       _gemm_kernel_type(CLGEMMKernelType::NATIVE),
       _is_prepared(false),
-      _aux_mem(AuxTensorIdx::Count)
+      _aux_mem(AuxTensorIdx::Count),
+      _weights_transform_id()
 {
 }
 
@@ -302,6 +351,7 @@ void ClGemm::configure_reshaped(const CLCompileContext &compile_context,
     kernel_info.reinterpret_input_as_3d = false;
     kernel_info.broadcast_bias          = broadcast_bias;
     kernel_info.activation_info         = gemm_info.activation_info();
+    kernel_info.fp_mixed_precision      = use_fp32_accumulation(*a, gemm_info);
 
     // Set the target for the kernels
     _reshape_lhs_kernel->set_target(gpu_target);
@@ -317,6 +367,7 @@ void ClGemm::configure_reshaped(const CLCompileContext &compile_context,
 
     _reshape_lhs_kernel->configure(compile_context, a, &_tmp_a, lhs_info, gemm_info.reinterpret_input_as_3d());
     _reshape_rhs_kernel->configure(compile_context, b, &_tmp_b, rhs_info);
+    _weights_transform_id = _reshape_b_only_on_first_run ? rhs_reshape_id(*b, rhs_info, _tmp_b) : "";
 
     // Configure and tune matrix multiply kernel
     _mm_reshaped_kernel->configure(compile_context, &_tmp_a, &_tmp_b, c, output, alpha, beta, lhs_info, rhs_info,
@@ -369,6 +420,7 @@ void ClGemm::configure_reshaped_only_rhs(const CLCompileContext &compile_context
 
     // Transpose matrix
     _reshape_rhs_kernel->configure(compile_context, b, &_tmp_b, rhs_info);
+    _weights_transform_id = _reshape_b_only_on_first_run ? rhs_reshape_id(*b, rhs_info, _tmp_b) : "";
 
     // Configure two variants of CLGEMMMatrixMultiplyReshapedOnlyRHSKernel (has_pad_y = false/true)
     // During the prepare stage we check the padding requirement for the lhs and dst tensors. If they do not have
@@ -429,6 +481,7 @@ void ClGemm::configure_reshaped_only_rhs_mmul(const CLCompileContext &compile_co
 
     // Reshape Rhs matrix
     _reshape_rhs_kernel->configure(compile_context, b, &_tmp_b, rhs_info);
+    _weights_transform_id = _reshape_b_only_on_first_run ? rhs_reshape_id(*b, rhs_info, _tmp_b) : "";
 
     // Configure matrix multiply kernel with no y padding support
     kernel_info.has_pad_y = false;
@@ -515,6 +568,7 @@ Status ClGemm::validate_reshaped(const ITensorInfo *a,
     kernel_info.reinterpret_input_as_3d = false;
     kernel_info.broadcast_bias          = broadcast_bias;
     kernel_info.activation_info         = gemm_info.activation_info();
+    kernel_info.fp_mixed_precision      = use_fp32_accumulation(*a, gemm_info);
 
     GEMMLHSMatrixInfo lhs_info;
     GEMMRHSMatrixInfo rhs_info;
@@ -666,12 +720,14 @@ void ClGemm::configure(const CLCompileContext &compile_context,
     ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, output);
 
     // Perform validation step
-    ARM_COMPUTE_ERROR_THROW_ON(validate(a, b, c, output, alpha, beta, gemm_info));
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(validate(a, b, c, output, alpha, beta, gemm_info));
+    const TrustedConfigureScope trusted_configure{};
     ARM_COMPUTE_LOG_PARAMS(a, b, c, output, alpha, beta, gemm_info);
 
     // Check if we need to reshape the matrix B only on the first run
     _reshape_b_only_on_first_run = gemm_info.reshape_b_only_on_first_run();
     _is_prepared                 = gemm_info.retain_internal_weights();
+    _weights_transform_id.clear();
 
     bool               reinterpret_input_as_3d = gemm_info.reinterpret_input_as_3d();
     const unsigned int m          = reinterpret_input_as_3d ? (a->dimension(1) * a->dimension(2)) : a->dimension(1);
@@ -682,7 +738,7 @@ void ClGemm::configure(const CLCompileContext &compile_context,
     // Select GEMMType
     _gemm_kernel_type = auto_select_gemm_kernel(
         auto_heuristics::CommonQuery{CLScheduler::get().target(), a->data_type(), m, n, k, batch_size},
-        _reshape_b_only_on_first_run, b->are_values_constant());
+        _reshape_b_only_on_first_run, b->are_values_constant(), use_fp32_accumulation(*a, gemm_info));
 
     const bool fuse_add_c = (!(helpers::float_ops::is_zero(beta)) && c != nullptr);
 
@@ -745,7 +801,7 @@ Status ClGemm::validate(const ITensorInfo *a,
             k,
             batch_size,
         },
-        gemm_info.reshape_b_only_on_first_run(), b->are_values_constant());
+        gemm_info.reshape_b_only_on_first_run(), b->are_values_constant(), use_fp32_accumulation(*a, gemm_info));
 
     const bool fuse_add_c = (!(helpers::float_ops::is_zero(beta)) && c != nullptr);
 
@@ -919,5 +975,39 @@ experimental::MemoryRequirements ClGemm::workspace() const
 {
     return _aux_mem;
 }
+
+OperatorDescription ClGemm::describe() const
+{
+    OperatorDescription desc = ICLOperator::describe();
+    desc.name                = "ClGemm";
+    desc.method              = to_string(_gemm_kernel_type);
+    switch (_gemm_kernel_type)
+    {
+        case CLGEMMKernelType::NATIVE:
+            desc.kernels.emplace_back(_mm_native_kernel->config_id());
+            break;
+        case CLGEMMKernelType::RESHAPED:
+            desc.kernels.emplace_back(_reshape_lhs_kernel->config_id());
+            desc.kernels.emplace_back(_reshape_rhs_kernel->config_id());
+            desc.kernels.emplace_back(_mm_reshaped_kernel->config_id());
+            break;
+        case CLGEMMKernelType::RESHAPED_ONLY_RHS:
+            desc.kernels.emplace_back(_reshape_rhs_kernel->config_id());
+            desc.kernels.emplace_back(_mm_reshaped_only_rhs_kernel->config_id());
+            break;
+        case CLGEMMKernelType::RESHAPED_ONLY_RHS_MMUL:
+            desc.kernels.emplace_back(_reshape_rhs_kernel->config_id());
+            desc.kernels.emplace_back(_mm_reshaped_only_rhs_mmul_kernel->config_id());
+            break;
+        default:
+            break;
+    }
+    return desc;
+}
+
+std::string ClGemm::weights_transform_id() const
+{
+    return _weights_transform_id;
+}
 } // namespace opencl
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,7 @@
 #include "src/gpu/cl/kernels/ClGemmReshapeRhsMatrixKernel.h"
 
 #include <memory>
+#include <string>
 
 namespace arm_compute
 {
@@ -78,6 +79,8 @@ public:
      *
      * @note Batched GEMM only allows RHS tensor's rank to be <= 3
      * @note Batched GEMM only supports broadcasting cases where RHS rank < LHS rank but not the other way around
+     * @note F16 GEMMs accumulate in F32 if GEMMInfo::fp_mixed_precision is set, unless GEMMInfo::fast_math is set too
+     *       or B is not constant
      *
      * @param[in]  compile_context The compile context to be used.
      * @param[in]  a               First input tensor  (Matrix or Vector A). Data types supported: F16/F32
@@ -112,10 +115,20 @@ public:
                            float              beta,
                            const GEMMInfo    &gemm_info);
 
+    /** Identifier of the transformation applied to matrix B by @ref ClGemm::prepare
+     *
+     * Operators with the same identifier compute the same persistent auxiliary tensors from the same matrix B.
+     * When matrix B is not passed to @ref ClGemm::prepare, these tensors are assumed to be already computed.
+     *
+     * @return The identifier, empty if no persistent auxiliary tensor is computed from matrix B
+     */
+    std::string weights_transform_id() const;
+
     // Inherited methods overridden:
     void                             run(ITensorPack &tensors) override;
     void                             prepare(ITensorPack &constants) override;
     experimental::MemoryRequirements workspace() const override;
+    OperatorDescription              describe() const override;
 
 private:
     void configure_native(const CLCompileContext &compile_context,
@@ -201,6 +214,7 @@ private:
     CLGEMMKernelType                                                        _gemm_kernel_type;
     bool                                                                    _is_prepared;
     experimental::MemoryRequirements                                        _aux_mem{};
+    std::string                                                             _weights_transform_id;
 };
 } // namespace opencl
 } // namespace arm_compute
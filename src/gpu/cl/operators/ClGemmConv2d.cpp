@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023 Arm Limited.
+ * Copyright (c) 2017-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
 
@@ -44,6 +45,7 @@
 #include "src/gpu/cl/operators/ClGemmLowpMatrixMultiplyCore.h"
 #include "src/gpu/cl/utils/ClAuxTensorHandler.h"
 #include "support/Cast.h"
+#include "utils/TypePrinter.h"
 
 namespace arm_compute
 {
@@ -83,7 +85,7 @@ void ClGemmConv2d::configure_mm(const ClCompileContext        &compile_context,
                                 const ActivationLayerInfo     &act_info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights);
-    ARM_COMPUTE_ERROR_THROW_ON(
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(
         validate_mm(src, weights, biases, dst, gemmlowp_output_stage, gemm_3d_depth, _skip_im2col, act_info));
 
     const GEMMInfo &gemm_info = GEMMInfo(false,                 // is_a_reshaped
@@ -195,7 +197,8 @@ void ClGemmConv2d::configure(const CLCompileContext &compile_context,
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
 
-    ARM_COMPUTE_ERROR_THROW_ON(ClGemmConv2d::validate(src, weights, biases, dst, conv2d_info, weights_info));
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(ClGemmConv2d::validate(src, weights, biases, dst, conv2d_info, weights_info));
+    const TrustedConfigureScope trusted_configure{};
     ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, conv2d_info, weights_info);
 
     const DataType   data_type   = src->data_type();
@@ -640,20 +643,28 @@ void ClGemmConv2d::prepare(ITensorPack &tensors)
 {
     if (!_is_prepared)
     {
-        // Run weights reshaping and mark original weights tensor as unused
-        ICLTensor *weights_reshaped_p =
-            utils::cast::polymorphic_downcast<ICLTensor *>(tensors.get_tensor(offset_int_vec(WeightsReshaped)));
-        CLAuxTensorHandler weights_reshaped(_weights_reshaped, *weights_reshaped_p);
-        auto               weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
-        ITensorPack        pack    = {{TensorType::ACL_SRC, weights}, {TensorType::ACL_DST, weights_reshaped.get()}};
-
-        if (_append_bias)
+        // If the weights are not provided, assume that the persistent auxiliary tensors are already computed
+        auto weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+        if (weights != nullptr)
         {
-            const auto biases = tensors.get_const_tensor(TensorType::ACL_SRC_2);
-            pack.add_const_tensor(TensorType::ACL_BIAS, biases);
+            // Run weights reshaping and mark original weights tensor as unused
+            ICLTensor *weights_reshaped_p =
+                utils::cast::polymorphic_downcast<ICLTensor *>(tensors.get_tensor(offset_int_vec(WeightsReshaped)));
+            CLAuxTensorHandler weights_reshaped(_weights_reshaped, *weights_reshaped_p);
+            ITensorPack pack = {{TensorType::ACL_SRC, weights}, {TensorType::ACL_DST, weights_reshaped.get()}};
+
+            if (_append_bias)
+            {
+                const auto biases = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+                pack.add_const_tensor(TensorType::ACL_BIAS, biases);
+            }
+            CLScheduler::get().enqueue_op(*_weights_reshape_kernel.get(), pack, true);
+            tensors.add_const_tensor(TensorType::ACL_SRC_1, weights_reshaped.get());
+        }
+        else
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(weights_transform_id().empty(), "The weights must be provided");
         }
-        CLScheduler::get().enqueue_op(*_weights_reshape_kernel.get(), pack, true);
-        tensors.add_const_tensor(TensorType::ACL_SRC_1, weights_reshaped.get());
 
         // Prepare GEMM
         _is_quantized ? _mm_gemmlowp->prepare(tensors) : _mm_gemm->prepare(tensors);
@@ -664,5 +675,16 @@ experimental::MemoryRequirements ClGemmConv2d::workspace() const
 {
     return _aux_mem;
 }
+
+std::string ClGemmConv2d::weights_transform_id() const
+{
+    // The quantized GEMM also computes the output stage from the weights and the biases can be appended to them
+    if (_is_quantized || _append_bias || _mm_gemm == nullptr)
+    {
+        return "";
+    }
+    return "conv2d_reshape_weights_" + to_string(_weights_reshaped.tensor_shape()) + "_" +
+           string_from_data_type(_weights_reshaped.data_type()) + "_" + _mm_gemm->weights_transform_id();
+}
 } // namespace opencl
 } // namespace arm_compute
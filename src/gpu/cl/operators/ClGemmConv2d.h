@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023 Arm Limited.
+ * Copyright (c) 2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,7 @@
 #include "src/gpu/cl/IClOperator.h"
 
 #include <memory>
+#include <string>
 
 namespace arm_compute
 {
@@ -121,6 +122,15 @@ public:
                            const Conv2dInfo  &conv2d_info,
                            const WeightsInfo &weights_info = WeightsInfo());
 
+    /** Identifier of the transformation applied to the weights by @ref ClGemmConv2d::prepare
+     *
+     * Operators with the same identifier compute the same persistent auxiliary tensors from the same weights.
+     * When the weights are not passed to @ref ClGemmConv2d::prepare, these tensors are assumed to be already computed.
+     *
+     * @return The identifier, empty if the persistent auxiliary tensors cannot be shared
+     */
+    std::string weights_transform_id() const;
+
     // Inherited methods overridden:
     void                             run(ITensorPack &tensors) override;
     void                             prepare(ITensorPack &constants) override;
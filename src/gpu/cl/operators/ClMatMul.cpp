@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
 
 #include "src/common/utils/Log.h"
@@ -96,7 +97,8 @@ void ClMatMul::configure(const CLCompileContext    &compile_context,
     ARM_COMPUTE_LOG_PARAMS(lhs, rhs, dst, matmul_info);
 
     // Perform validation step
-    ARM_COMPUTE_ERROR_THROW_ON(validate(lhs, rhs, dst, matmul_info));
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(validate(lhs, rhs, dst, matmul_info));
+    const TrustedConfigureScope trusted_configure{};
 
     const GPUTarget        gpu_target    = CLScheduler::get().target();
     const auto             kernel_config = ClMatMulNativeKernelConfigurationFactory::create(gpu_target);
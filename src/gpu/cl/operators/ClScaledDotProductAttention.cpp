@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/gpu/cl/operators/ClScaledDotProductAttention.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/gpu/cl/kernels/ClScaledDotProductAttentionKernel.h"
+#include "src/runtime/heuristics/matmul_native/ClScaledDotProductAttentionKernelConfig.h"
+
+namespace arm_compute
+{
+namespace opencl
+{
+using namespace arm_compute::opencl::kernels;
+
+ClScaledDotProductAttention::ClScaledDotProductAttention()
+{
+}
+
+Status ClScaledDotProductAttention::validate(const ITensorInfo *q,
+                                             const ITensorInfo *k,
+                                             const ITensorInfo *v,
+                                             const ITensorInfo *dst,
+                                             float              scale,
+                                             bool               is_causal)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(q, k, v, dst);
+
+    const ClScaledDotProductAttentionKernelInfo kernel_info =
+        cl_matmul::configure_scaled_dot_product_attention(CLScheduler::get().target(), q, k, v);
+
+    return ClScaledDotProductAttentionKernel::validate(q, k, v, dst, scale, is_causal, kernel_info);
+}
+
+void ClScaledDotProductAttention::configure(const CLCompileContext &compile_context,
+                                            const ITensorInfo      *q,
+                                            const ITensorInfo      *k,
+                                            const ITensorInfo      *v,
+                                            ITensorInfo            *dst,
+                                            float                   scale,
+                                            bool                    is_causal)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(q, k, v, dst);
+    ARM_COMPUTE_LOG_PARAMS(q, k, v, dst, scale, is_causal);
+
+    const GPUTarget                             gpu_target = CLScheduler::get().target();
+    const ClScaledDotProductAttentionKernelInfo kernel_info =
+        cl_matmul::configure_scaled_dot_product_attention(gpu_target, q, k, v);
+
+    auto kernel = std::make_unique<ClScaledDotProductAttentionKernel>();
+    kernel->set_target(gpu_target);
+    kernel->configure(compile_context, q, k, v, dst, scale, is_causal, kernel_info);
+    _kernel = std::move(kernel);
+}
+
+void ClScaledDotProductAttention::run(ITensorPack &tensors)
+{
+    CLScheduler::get().enqueue_op(*_kernel, tensors, /* flush */ true);
+}
+} // namespace opencl
+} // namespace arm_compute
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_GPU_CL_OPERATORS_CLSCALEDDOTPRODUCTATTENTION_H
+#define ACL_SRC_GPU_CL_OPERATORS_CLSCALEDDOTPRODUCTATTENTION_H
+
+#include "src/gpu/cl/IClKernel.h"
+#include "src/gpu/cl/IClOperator.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace opencl
+{
+/** Basic operator to execute a fused scaled dot product attention on OpenCL. This operator calls the following OpenCL kernels:
+ *
+ *  -# @ref kernels::ClScaledDotProductAttentionKernel
+ */
+class ClScaledDotProductAttention : public IClOperator
+{
+public:
+    /** Constructor */
+    ClScaledDotProductAttention();
+    /** Default destructor */
+    ~ClScaledDotProductAttention() = default;
+    /** Initialise the kernel's inputs and output
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |q              |k              |v              |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|
+     * |F32            |F32            |F32            |F32            |
+     * |F16            |F16            |F16            |F16            |
+     *
+     * @param[in]  compile_context The compile context to be used.
+     * @param[in]  q               Queries tensor info with shape [D, Sq, H, B]. Data types supported: F32/F16.
+     * @param[in]  k               Keys tensor info with shape [D, Skv, H, B]. Data type supported: same as @p q.
+     * @param[in]  v               Values tensor info with shape [Dv, Skv, H, B]. Data type supported: same as @p q.
+     * @param[out] dst             Destination tensor info with shape [Dv, Sq, H, B]. Data type supported: same as @p q.
+     * @param[in]  scale           Scale applied to the scores before the softmax, usually 1 / sqrt(D).
+     * @param[in]  is_causal       (Optional) Whether query i only attends to the keys up to i + Skv - Sq.
+     */
+    void configure(const CLCompileContext &compile_context,
+                   const ITensorInfo      *q,
+                   const ITensorInfo      *k,
+                   const ITensorInfo      *v,
+                   ITensorInfo            *dst,
+                   float                   scale,
+                   bool                    is_causal = false);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref ClScaledDotProductAttention::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *q,
+                           const ITensorInfo *k,
+                           const ITensorInfo *v,
+                           const ITensorInfo *dst,
+                           float              scale,
+                           bool               is_causal = false);
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+
+private:
+    std::unique_ptr<opencl::IClKernel> _kernel{nullptr};
+};
+} // namespace opencl
+} // namespace arm_compute
+#endif // ACL_SRC_GPU_CL_OPERATORS_CLSCALEDDOTPRODUCTATTENTION_H
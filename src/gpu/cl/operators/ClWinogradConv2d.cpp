@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022 Arm Limited.
+ * Copyright (c) 2018-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
 
@@ -34,6 +35,7 @@
 #include "src/core/CL/kernels/CLFillBorderKernel.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/gpu/cl/kernels/ClWinogradFilterTransformKernel.h"
+#include "src/gpu/cl/kernels/ClWinogradFusedConv2dKernel.h"
 #include "src/gpu/cl/kernels/ClWinogradInputTransformKernel.h"
 #include "src/gpu/cl/kernels/ClWinogradOutputTransformKernel.h"
 #include "src/gpu/cl/utils/ClAuxTensorHandler.h"
@@ -99,6 +101,26 @@ bool check_support_fast_math(const Size2D &output_tile, const Size2D &kernel_siz
     return std::find(fast_math_winograd.begin(), fast_math_winograd.end(), p) != fast_math_winograd.end();
 }
 
+// Whether the convolution runs as a single kernel, without the transformed input and the batched matrix multiplication
+// output in global memory. The fused kernel reads the transformed weights once per tile, so it is only used when they
+// fit comfortably in the GPU's L2 cache; otherwise the reshaped batched matrix multiplication reuses them better.
+// The fused kernel does not handle padded tensors, so a padded destination stays on the reshaped path too.
+bool use_fused_winograd(const ITensorInfo  *src,
+                        const ITensorInfo  *weights,
+                        const ITensorInfo  *dst,
+                        const WinogradInfo &winograd_info)
+{
+    constexpr size_t max_fused_weights_size = 256 * 1024;
+
+    const TensorShape weights_shape =
+        misc::shape_calculator::compute_winograd_filter_transform_shape(*weights, winograd_info);
+    const size_t weights_size = weights_shape.total_size() * src->element_size();
+
+    return src->data_layout() == DataLayout::NHWC && winograd_info.output_tile_size == Size2D(4U, 4U) &&
+           winograd_info.kernel_size == Size2D(3U, 3U) && !src->has_padding() &&
+           (dst->total_size() == 0 || !dst->has_padding()) && weights_size <= max_fused_weights_size;
+}
+
 Status validate_arguments(const ITensorInfo         *src,
                           const ITensorInfo         *weights,
                           const ITensorInfo         *biases,
@@ -135,6 +157,21 @@ Status validate_arguments(const ITensorInfo         *src,
     const WinogradInfo winograd_info =
         WinogradInfo(output_tile, kernel_size, input_dims, conv_info, src->data_layout());
 
+    if (use_fused_winograd(src, weights, dst, winograd_info))
+    {
+        // Validate filter transform
+        const TensorShape input1_shape =
+            misc::shape_calculator::compute_winograd_filter_transform_shape(*weights, winograd_info);
+        const TensorInfo input1 = weights->clone()->set_tensor_shape(input1_shape);
+        ARM_COMPUTE_RETURN_ON_ERROR(
+            kernels::ClWinogradFilterTransformKernel::validate(weights, &input1, winograd_info));
+
+        // Validate the fused input transform, batched matrix multiply and output transform
+        ARM_COMPUTE_RETURN_ON_ERROR(
+            kernels::ClWinogradFusedConv2dKernel::validate(src, &input1, biases, dst, winograd_info, act_info));
+        return Status{};
+    }
+
     // Validate input transform
     const TensorShape input0_shape =
         misc::shape_calculator::compute_winograd_input_transform_shape(*src, winograd_info);
@@ -169,11 +206,13 @@ ClWinogradConv2d::ClWinogradConv2d()
       _input_transform(std::make_unique<kernels::ClWinogradInputTransformKernel>()),
       _filter_transform(std::make_unique<kernels::ClWinogradFilterTransformKernel>()),
       _output_transform(std::make_unique<kernels::ClWinogradOutputTransformKernel>()),
+      _fused_conv(std::make_unique<kernels::ClWinogradFusedConv2dKernel>()),
       _border_handler(),
       _input0(),
       _input1(),
       _batched_mm_output(),
       _is_prepared(false),
+      _is_fused(false),
       _aux_mem()
 {
 }
@@ -189,7 +228,9 @@ void ClWinogradConv2d::configure(const ClCompileContext    &compile_context,
                                  const ActivationLayerInfo &act_info,
                                  bool                       enable_fast_math)
 {
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, weights, biases, dst, conv_info, act_info, enable_fast_math));
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(
+        validate_arguments(src, weights, biases, dst, conv_info, act_info, enable_fast_math));
+    const TrustedConfigureScope trusted_configure{};
     ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, conv_info, act_info, enable_fast_math);
 
     // Get indices for the width and height
@@ -213,6 +254,21 @@ void ClWinogradConv2d::configure(const ClCompileContext    &compile_context,
         WinogradInfo(output_tile, kernel_size, input_dims, conv_info, src->data_layout());
 
     _is_prepared = false;
+    _is_fused    = use_fused_winograd(src, weights, dst, winograd_info);
+
+    if (_is_fused)
+    {
+        // Configure filter transform
+        _filter_transform->configure(compile_context, weights, &_input1, winograd_info);
+
+        // Configure the fused input transform, batched matrix multiply and output transform
+        _fused_conv->set_target(CLScheduler::get().target());
+        _fused_conv->configure(compile_context, src, &_input1, biases, dst, winograd_info, act_info);
+
+        _aux_mem.clear();
+        _aux_mem.push_back(MemoryInfo(offset_int_vec(3), MemoryLifetime::Persistent, _input1.total_size()));
+        return;
+    }
 
     // Configure input transform
     _input_transform->configure(compile_context, src, &_input0, winograd_info);
@@ -256,6 +312,28 @@ Status ClWinogradConv2d::validate(const ITensorInfo         *src,
 
 void ClWinogradConv2d::run(ITensorPack &tensors)
 {
+    if (_is_fused)
+    {
+        auto src =
+            utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC_0));
+        auto biases =
+            utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC_2));
+        auto dst = utils::cast::polymorphic_downcast<ICLTensor *>(tensors.get_tensor(TensorType::ACL_DST));
+
+        CLAuxTensorHandler input1(offset_int_vec(3), _input1, tensors, true);
+
+        prepare(tensors);
+
+        ITensorPack pack_fc{
+            {TensorType::ACL_SRC_0, src},
+            {TensorType::ACL_SRC_1, input1.get()},
+            {TensorType::ACL_SRC_2, biases},
+            {TensorType::ACL_DST, dst},
+        };
+        CLScheduler::get().enqueue_op(*_fused_conv, pack_fc);
+        return;
+    }
+
     const bool is_gemm_reshaped = _aux_mem[3].lifetime == MemoryLifetime::Prepare;
 
     auto src    = utils::cast::polymorphic_downcast<const ICLTensor *>(tensors.get_const_tensor(TensorType::ACL_SRC_0));
@@ -311,9 +389,12 @@ void ClWinogradConv2d::prepare(ITensorPack &tensors)
         weights->mark_as_unused();
 
         // Prepare GEMM and release reshaped weights if marked unused by ClGemm
-        ITensorPack mm_prepare_pack = tensors;
-        mm_prepare_pack.add_tensor(ACL_SRC_1, input1.get());
-        _batched_mm.prepare(mm_prepare_pack);
+        if (!_is_fused)
+        {
+            ITensorPack mm_prepare_pack = tensors;
+            mm_prepare_pack.add_tensor(ACL_SRC_1, input1.get());
+            _batched_mm.prepare(mm_prepare_pack);
+        }
 
         CLScheduler::get().queue().finish();
         _is_prepared = true;
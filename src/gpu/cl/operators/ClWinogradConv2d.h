@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,6 +42,7 @@ namespace kernels
 class ClWinogradInputTransformKernel;
 class ClWinogradFilterTransformKernel;
 class ClWinogradOutputTransformKernel;
+class ClWinogradFusedConv2dKernel;
 } // namespace kernels
 /** Basic function to execute Winograd-based convolution on OpenCL. This function calls the following OpenCL functions/kernels:
  *
@@ -50,6 +51,11 @@ class ClWinogradOutputTransformKernel;
  *  -# @ref ClGemm
  *  -# @ref kernels::ClWinogradOutputTransformKernel
  *
+ * NHWC F(4x4, 3x3) convolutions with small transformed weights call instead:
+ *
+ *  -# @ref kernels::ClWinogradFilterTransformKernel (only once)
+ *  -# @ref kernels::ClWinogradFusedConv2dKernel
+ *
  */
 class ClWinogradConv2d : public IClOperator
 {
@@ -126,11 +132,13 @@ private:
     std::unique_ptr<kernels::ClWinogradInputTransformKernel>  _input_transform;
     std::unique_ptr<kernels::ClWinogradFilterTransformKernel> _filter_transform;
     std::unique_ptr<kernels::ClWinogradOutputTransformKernel> _output_transform;
+    std::unique_ptr<kernels::ClWinogradFusedConv2dKernel>     _fused_conv;
     CLFillBorderKernel                                        _border_handler;
     TensorInfo                                                _input0;
     TensorInfo                                                _input1;
     TensorInfo                                                _batched_mm_output;
     bool                                                      _is_prepared;
+    bool                                                      _is_fused;
     experimental::MemoryRequirements                          _aux_mem{};
 };
 } // namespace opencl
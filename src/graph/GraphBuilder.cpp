@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -234,6 +234,12 @@ NodeID GraphBuilder::add_bounding_box_transform_node(
     return nid;
 }
 
+NodeID GraphBuilder::add_cast_node(
+    Graph &g, NodeParams params, NodeIdxPair input, DataType out_data_type, ConvertPolicy policy)
+{
+    return create_simple_single_input_output_node<CastLayerNode>(g, params, input, out_data_type, policy);
+}
+
 NodeID GraphBuilder::add_channel_shuffle_node(Graph &g, NodeParams params, NodeIdxPair input, unsigned int num_groups)
 {
     return create_simple_single_input_output_node<ChannelShuffleLayerNode>(g, params, input, num_groups);
@@ -377,7 +383,8 @@ NodeID GraphBuilder::add_depthwise_convolution_node(Graph                     &g
                                                     ITensorAccessorUPtr        weights_accessor,
                                                     ITensorAccessorUPtr        bias_accessor,
                                                     const QuantizationInfo    &quant_info,
-                                                    const QuantizationInfo    &out_quant_info)
+                                                    const QuantizationInfo    &out_quant_info,
+                                                    FastMathHint               fast_math_hint)
 {
     check_nodeidx_pair(input, g);
     ARM_COMPUTE_ERROR_ON((kernel_spatial_extend.width == 0) || (kernel_spatial_extend.height == 0));
@@ -418,7 +425,8 @@ NodeID GraphBuilder::add_depthwise_convolution_node(Graph                     &g
     }
 
     // Create convolution node and connect
-    NodeID conv_nid = g.add_node<DepthwiseConvolutionLayerNode>(conv_info, depth_multiplier, method, out_quant_info);
+    NodeID conv_nid = g.add_node<DepthwiseConvolutionLayerNode>(conv_info, depth_multiplier, method, out_quant_info,
+                                                                 fast_math_hint);
     g.add_connection(input.node_id, input.index, conv_nid, 0);
     g.add_connection(w_nid, 0, conv_nid, 1);
     if (has_bias)
@@ -503,13 +511,17 @@ NodeID GraphBuilder::add_dummy_node(Graph &g, NodeParams params, NodeIdxPair inp
     return create_simple_single_input_output_node<DummyNode>(g, params, input, shape);
 }
 
-NodeID GraphBuilder::add_elementwise_node(
-    Graph &g, NodeParams params, NodeIdxPair input0, NodeIdxPair input1, EltwiseOperation operation)
+NodeID GraphBuilder::add_elementwise_node(Graph                  &g,
+                                          NodeParams              params,
+                                          NodeIdxPair             input0,
+                                          NodeIdxPair             input1,
+                                          EltwiseOperation        operation,
+                                          const QuantizationInfo &out_quant_info)
 {
     check_nodeidx_pair(input0, g);
     check_nodeidx_pair(input1, g);
 
-    NodeID nid = g.add_node<EltwiseLayerNode>(descriptors::EltwiseLayerDescriptor{operation});
+    NodeID nid = g.add_node<EltwiseLayerNode>(descriptors::EltwiseLayerDescriptor{operation, out_quant_info});
 
     g.add_connection(input0.node_id, input0.index, nid, 0);
     g.add_connection(input1.node_id, input1.index, nid, 1);
@@ -726,9 +738,11 @@ NodeID GraphBuilder::add_priorbox_node(
 NodeID GraphBuilder::add_quantization_node(Graph                  &g,
                                            NodeParams              params,
                                            NodeIdxPair             input,
-                                           const QuantizationInfo &out_quant_info)
+                                           const QuantizationInfo &out_quant_info,
+                                           DataType                out_data_type)
 {
-    return create_simple_single_input_output_node<QuantizationLayerNode>(g, params, input, out_quant_info);
+    return create_simple_single_input_output_node<QuantizationLayerNode>(g, params, input, out_quant_info,
+                                                                         out_data_type);
 }
 
 NodeID GraphBuilder::add_reduction_operation_node(
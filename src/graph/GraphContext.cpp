@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,11 +27,13 @@
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/Utils.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace graph
 {
-GraphContext::GraphContext() : _config(), _memory_managers(), _weights_managers()
+GraphContext::GraphContext() : _config(), _memory_managers(), _weights_managers(), _num_pools(1)
 {
 }
 
@@ -98,9 +100,9 @@ std::map<Target, WeightsManagerContext> &GraphContext::weights_managers()
     return _weights_managers;
 }
 
-void GraphContext::finalize()
+void GraphContext::finalize(size_t num_pools)
 {
-    const size_t num_pools = 1;
+    _num_pools = std::max(_num_pools, num_pools);
     for (auto &mm_obj : _memory_managers)
     {
         ARM_COMPUTE_ERROR_ON(!mm_obj.second.allocator);
@@ -108,12 +110,12 @@ void GraphContext::finalize()
         // Finalize intra layer memory manager
         if (mm_obj.second.intra_mm != nullptr)
         {
-            mm_obj.second.intra_mm->populate(*mm_obj.second.allocator, num_pools);
+            mm_obj.second.intra_mm->populate(*mm_obj.second.allocator, _num_pools);
         }
         // Finalize cross layer memory manager
         if (mm_obj.second.cross_mm != nullptr)
         {
-            mm_obj.second.cross_mm->populate(*mm_obj.second.allocator, num_pools);
+            mm_obj.second.cross_mm->populate(*mm_obj.second.allocator, _num_pools);
         }
     }
 }
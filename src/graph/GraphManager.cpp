@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,23 +23,381 @@
  */
 #include "arm_compute/graph/GraphManager.h"
 
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/detail/CrossLayerMemoryManagerHelpers.h"
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/mutators/NodeExecutionMethodMutator.h"
+#include "arm_compute/graph/nodes/ConcatenateLayerNode.h"
+#include "arm_compute/graph/nodes/InputNode.h"
 #include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/printers/DotGraphPrinter.h"
 #include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/Scheduler.h"
 
 #include "src/common/utils/Log.h"
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <sstream>
 
 namespace arm_compute
 {
 namespace graph
 {
-GraphManager::GraphManager() : _workloads()
+namespace
+{
+/** Pipeline stages run on their own CPU threads, each with its own scheduler */
+bool use_pipeline_stages(const GraphContext &ctx, Target target)
+{
+    if (ctx.config().num_pipeline_stages <= 1)
+    {
+        return false;
+    }
+#ifdef ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    if (target != Target::NEON)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Pipeline stages are only supported on the NEON target, executing as a single stage"
+                                   << std::endl);
+        return false;
+    }
+    return true;
+#else  // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    ARM_COMPUTE_UNUSED(target);
+    ARM_COMPUTE_LOG_GRAPH_INFO("Pipeline stages require thread local schedulers, executing as a single stage"
+                               << std::endl);
+    return false;
+#endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+}
+
+/** The branches of the stages are executed sequentially */
+bool use_parallel_branches(const GraphContext &ctx, Target target)
+{
+    if (ctx.config().num_parallel_branches <= 1 || use_pipeline_stages(ctx, target))
+    {
+        return false;
+    }
+    if (target == Target::CL)
+    {
+        // The backend enqueues the branches on concurrent command queues
+        return true;
+    }
+#ifdef ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    if (target != Target::NEON)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO(
+            "Parallel branches are only supported on the NEON and CL targets, executing sequentially" << std::endl);
+        return false;
+    }
+    return true;
+#else  // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    ARM_COMPUTE_LOG_GRAPH_INFO("Parallel branches require thread local schedulers, executing sequentially"
+                               << std::endl);
+    return false;
+#endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+}
+
+/** Concurrent branches and pipeline stages need a memory pool each for their function auxiliary memory */
+size_t num_memory_pools(const GraphContext &ctx, Target target)
+{
+    if (use_pipeline_stages(ctx, target))
+    {
+        return static_cast<size_t>(ctx.config().num_pipeline_stages);
+    }
+    return use_parallel_branches(ctx, target) ? static_cast<size_t>(ctx.config().num_parallel_branches) : 1U;
+}
+
+/** Lazy preparation needs the tasks to be executed in order by the graph manager */
+bool use_lazy_prepare(const GraphContext &ctx, bool run_parallel_branches)
+{
+    return ctx.config().use_lazy_prepare && !run_parallel_branches && !ctx.config().use_kernel_replay;
+}
+
+std::vector<TensorShape> get_input_shapes(Graph &g)
+{
+    std::vector<TensorShape> shapes;
+    for (auto &node_id : g.nodes(NodeType::Input))
+    {
+        shapes.push_back(g.node(node_id)->output(0)->desc().shape);
+    }
+    return shapes;
+}
+
+std::set<TensorID> get_const_tensor_ids(Graph &g)
+{
+    std::set<TensorID> ids;
+    for (auto &node_id : g.nodes(NodeType::Const))
+    {
+        ids.insert(g.node(node_id)->output_id(0));
+    }
+    return ids;
+}
+
+/** The transition manager assumes that tensor lifetimes follow the sequential execution order */
+bool use_transition_manager(const GraphContext &ctx, bool run_parallel_branches)
+{
+    return ctx.config().use_transition_memory_manager && !run_parallel_branches;
+}
+
+/** Allocates and fills again the output of a const node once the functions reading it were prepared */
+void refill_released_const_tensor(INode &node)
+{
+    Tensor *tensor = node.output(0);
+    if (tensor == nullptr || tensor->bound_edges().empty() || tensor->handle() == nullptr ||
+        tensor->handle()->is_subtensor() || !tensor->handle()->tensor().info()->is_resizable())
+    {
+        return;
+    }
+    ARM_COMPUTE_ERROR_ON_MSG(tensor->accessor() == nullptr, "Cannot fill again a released const tensor!");
+    tensor->handle()->tensor().mark_as_used();
+    detail::import_or_allocate_const_tensors(node);
+    detail::call_tensor_accessor(tensor);
+}
+
+/** Allocates and fills again the const tensors released once the functions reading them were prepared */
+void refill_released_const_tensors(Graph &g)
+{
+    for (auto &node_id : g.nodes(NodeType::Const))
+    {
+        refill_released_const_tensor(*g.node(node_id));
+    }
+}
+
+/** Describes the inputs, outputs, target and parameters of a node to detect its edits */
+std::string node_signature(INode &node)
+{
+    std::stringstream ss;
+    ss << node.assigned_target();
+    auto add_tensor = [&](Tensor *tensor)
+    {
+        if (tensor == nullptr)
+        {
+            ss << ";-";
+            return;
+        }
+        const TensorDescriptor &desc = tensor->desc();
+        ss << ";" << tensor->id() << ":" << desc.shape << ":" << desc.data_type << ":" << desc.layout << ":"
+           << desc.target << ":" << desc.quant_info << ":" << static_cast<const void *>(tensor->handle());
+    };
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        add_tensor(node.input(i));
+    }
+    ss << "|";
+    for (size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        add_tensor(node.output(i));
+    }
+    DotGraphVisitor visitor;
+    node.accept(visitor);
+    ss << "|" << visitor.info();
+    return ss.str();
+}
+
+/** Returns the parent handles of the tensors a node reads and writes */
+std::vector<ITensorHandle *> get_node_parent_handles(INode &node)
+{
+    std::vector<ITensorHandle *> handles;
+    auto add_handle = [&](Tensor *tensor)
+    {
+        if (tensor != nullptr && tensor->handle() != nullptr)
+        {
+            handles.push_back(tensor->handle()->parent_handle());
+        }
+    };
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        add_handle(node.input(i));
+    }
+    for (size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        add_handle(node.output(i));
+    }
+    return handles;
+}
+
+/** Checks if the readers that an edit gave to the inputs overwritten in place run before the nodes overwriting them
+ *
+ * @param[in] g                     Graph to check
+ * @param[in] order                 Execution order of the nodes
+ * @param[in] run_parallel_branches Whether the independent nodes may run concurrently
+ */
+bool reads_inputs_before_overwrite(Graph &g, const std::vector<NodeID> &order, bool run_parallel_branches)
+{
+    // The aliased outputs of these nodes overwrite their input
+    const std::set<NodeType> aliasing_nodes = {NodeType::DequantizationLayer, NodeType::QuantizationLayer};
+
+    std::map<NodeID, size_t> positions;
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        positions.emplace(order[i], i);
+    }
+    for (auto &node_id : order)
+    {
+        INode  *node   = g.node(node_id);
+        Tensor *output = node->num_outputs() != 0 ? node->output(0) : nullptr;
+        if (output == nullptr || output->handle() == nullptr)
+        {
+            continue;
+        }
+        for (size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            const Edge *input_edge = node->input_edge(i);
+            Tensor     *input      = input_edge != nullptr ? input_edge->tensor() : nullptr;
+            if (input == nullptr)
+            {
+                continue;
+            }
+            const bool is_alias = aliasing_nodes.find(node->type()) != std::end(aliasing_nodes) &&
+                                  input->handle() != nullptr && output->handle()->is_subtensor() &&
+                                  input->handle()->parent_handle() == output->handle()->parent_handle();
+            const bool overwrites_input = input == output || is_alias;
+            if (!overwrites_input)
+            {
+                continue;
+            }
+            for (auto &eid : input->bound_edges())
+            {
+                const Edge *edge = g.edge(eid);
+                if (edge != nullptr && eid != input_edge->id() && edge->producer_id() == input_edge->producer_id() &&
+                    edge->consumer() != nullptr &&
+                    (run_parallel_branches || positions.at(edge->consumer_id()) > positions.at(node_id)))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/** Checks if the nodes in the given order access the transition handles like their planned lifetimes allow
+ *
+ * The handles whose planned lifetimes are disjoint may share their memory, so their accesses must not overlap.
+ * The managed handles cannot be accessed outside of the tasks.
+ */
+bool follows_transition_plan(Graph &g, const std::vector<NodeID> &order, const detail::TransitionLifetimes &lifetimes)
+{
+    const std::set<NodeType> outside_task_types = {NodeType::Input, NodeType::Output, NodeType::Const};
+
+    std::map<ITensorHandle *, std::pair<int, int>> accesses;
+    int                                            task_idx = 0;
+    for (auto &nid : order)
+    {
+        INode     *node         = g.node(nid);
+        const bool outside_task = outside_task_types.find(node->type()) != std::end(outside_task_types);
+        for (auto *handle : get_node_parent_handles(*node))
+        {
+            if (lifetimes.find(handle) == std::end(lifetimes))
+            {
+                continue;
+            }
+            if (outside_task)
+            {
+                return false;
+            }
+            accesses.emplace(handle, std::make_pair(task_idx, task_idx)).first->second.second = task_idx;
+        }
+        task_idx += outside_task ? 0 : 1;
+    }
+
+    for (auto &first : accesses)
+    {
+        for (auto &second : accesses)
+        {
+            if (lifetimes.at(first.first).second < lifetimes.at(second.first).first &&
+                first.second.second >= second.second.first)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/** Sorts the nodes topologically, keeping the order of the previous tasks and running the other nodes early */
+std::vector<NodeID> sort_keeping_task_order(Graph &g, const std::map<NodeID, int> &task_positions)
+{
+    std::vector<unsigned int>        num_pending_inputs(g.nodes().size(), 0);
+    std::set<std::pair<int, NodeID>> ready;
+    auto priority = [&](NodeID nid)
+    {
+        auto position = task_positions.find(nid);
+        return position != std::end(task_positions) ? position->second : -1;
+    };
+    for (auto &node : g.nodes())
+    {
+        if (node == nullptr)
+        {
+            continue;
+        }
+        for (auto &eid : node->input_edges())
+        {
+            const Edge *edge = g.edge(eid);
+            if (edge != nullptr && edge->producer() != nullptr)
+            {
+                ++num_pending_inputs[node->id()];
+            }
+        }
+        if (num_pending_inputs[node->id()] == 0)
+        {
+            ready.emplace(priority(node->id()), node->id());
+        }
+    }
+
+    std::vector<NodeID> order;
+    while (!ready.empty())
+    {
+        const NodeID nid = ready.begin()->second;
+        ready.erase(ready.begin());
+        order.push_back(nid);
+        for (auto &eid : g.node(nid)->output_edges())
+        {
+            const Edge *edge = g.edge(eid);
+            if (edge != nullptr && edge->consumer() != nullptr && --num_pending_inputs[edge->consumer_id()] == 0)
+            {
+                ready.emplace(priority(edge->consumer_id()), edge->consumer_id());
+            }
+        }
+    }
+    return order;
+}
+
+/** Records the time elapsed between consecutive phases */
+class PhaseTimer
+{
+public:
+    void mark(const char *phase)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        _timings.emplace_back(phase, std::chrono::duration<double, std::milli>(now - _last).count());
+        _last = now;
+    }
+    FinalizePhaseTimings &timings()
+    {
+        return _timings;
+    }
+
+private:
+    std::chrono::steady_clock::time_point _last{std::chrono::steady_clock::now()};
+    FinalizePhaseTimings                  _timings{};
+};
+
+std::mutex           last_finalize_mutex;
+FinalizePhaseTimings last_finalize_phase_timings;
+} // namespace
+
+GraphManager::GraphManager() : _workloads(), _parallel_executors(), _workload_runners()
 {
 }
 
@@ -53,8 +411,17 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
         ARM_COMPUTE_ERROR("Graph is already registered!");
     }
 
+    PhaseTimer timer;
+
+    // Enable fast math before the fusions so that the fused nodes inherit it
+    if (ctx.config().use_fast_math)
+    {
+        force_fast_math_to_graph(graph);
+    }
+
     // Apply IR mutating passes
     pm.run_type(graph, IGraphMutator::MutationType::IR);
+    timer.mark("ir_mutate");
 
     // Force target to all graph construct
     Target forced_target = target;
@@ -75,36 +442,121 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
         forced_target = get_default_target();
         ARM_COMPUTE_LOG_GRAPH_INFO("Switching target from " << target << " to " << forced_target << std::endl);
     }
-    force_target_to_graph(graph, forced_target);
+    if (ctx.config().use_heterogeneous_targets)
+    {
+        assign_heterogeneous_targets(graph, forced_target);
+    }
+    else
+    {
+        force_target_to_graph(graph, forced_target);
+    }
+    timer.mark("assign_targets");
+
+    // Check if independent branches can be executed concurrently
+    const bool run_parallel_branches = use_parallel_branches(ctx, forced_target);
+    if (run_parallel_branches && forced_target == Target::CL && ctx.config().use_function_memory_manager)
+    {
+        // The function memory pools are acquired on the host and would be shared by kernels running concurrently
+        GraphConfig config                 = ctx.config();
+        config.use_function_memory_manager = false;
+        ctx.set_config(config);
+    }
+
+    // Check if the nodes are split into pipeline stages, which must not share transient memory
+    const bool run_pipeline_stages = use_pipeline_stages(ctx, forced_target);
+    if (run_pipeline_stages && (ctx.config().use_transition_memory_manager || ctx.config().use_lazy_prepare))
+    {
+        GraphConfig config                   = ctx.config();
+        config.use_transition_memory_manager = false;
+        config.use_lazy_prepare              = false;
+        ctx.set_config(config);
+    }
 
     // Setup backend context
     setup_requested_backend_context(ctx, forced_target);
+    if (ctx.config().use_heterogeneous_targets && forced_target != Target::NEON &&
+        std::any_of(graph.nodes().begin(), graph.nodes().end(), [](const std::unique_ptr<INode> &node)
+                    { return node != nullptr && node->assigned_target() == Target::NEON; }))
+    {
+        setup_requested_backend_context(ctx, Target::NEON);
+    }
+    timer.mark("backend_setup");
 
     // Configure all tensors
     detail::configure_all_tensors(graph);
+    timer.mark("configure_tensors");
 
     // Apply backend mutating passes
     pm.run_type(graph, IGraphMutator::MutationType::Backend);
 
+    // Use the const tensors shared with the other graphs built from the same model
+    if (ctx.config().shared_weights != nullptr)
+    {
+        detail::share_const_tensors(graph, *ctx.config().shared_weights);
+    }
+
+    // Fill the constants while the nodes are validated and configured
+    std::shared_ptr<detail::ConstTensorUpload> const_upload = nullptr;
+    if (ctx.config().use_async_const_upload)
+    {
+        const_upload = detail::start_const_tensor_upload(graph);
+    }
+
+    timer.mark("backend_mutate");
+
     // Perform topological sort
     std::vector<NodeID> topological_sorted_nodes = dfs(graph);
 
     // Validate all nodes
     detail::validate_all_nodes(graph);
+    timer.mark("validate_nodes");
 
-    // Configure all nodes
-    auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
+    // Configure all nodes, the ones validated by their backend trust their arguments
+    ExecutionWorkload                              workload;
+    std::unique_ptr<detail::PipelineStageExecutor> stage_executor = nullptr;
+    {
+        const TrustedConfigureScope trusted_configure(ctx.config().use_trusted_configure);
+        if (run_pipeline_stages)
+        {
+            // The stages read the tensors produced by the other stages from their own copies
+            stage_executor = std::make_unique<detail::PipelineStageExecutor>(
+                graph, topological_sorted_nodes, static_cast<unsigned int>(ctx.config().num_pipeline_stages));
+            workload = stage_executor->configure_all_nodes(graph, ctx, topological_sorted_nodes);
+        }
+        else
+        {
+            workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
+        }
+    }
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
+    timer.mark("configure_nodes");
 
     // Allocate const tensors and call accessors
     detail::allocate_const_tensors(graph);
-    detail::call_all_const_node_accessors(graph);
+    if (const_upload != nullptr)
+    {
+        detail::call_all_const_node_accessors(graph, *const_upload);
+    }
+    else
+    {
+        detail::call_all_const_node_accessors(graph);
+    }
+    timer.mark("const_tensors");
 
-    // Prepare graph
-    detail::prepare_all_tasks(workload);
+    // Prepare graph, unless the nodes are prepared on their first execution
+    if (!use_lazy_prepare(ctx, run_parallel_branches))
+    {
+        detail::prepare_all_tasks(workload);
+    }
+    if (const_upload != nullptr)
+    {
+        // The uploads are ordered before the weights transformations enqueued by the prepare stage
+        detail::finish_const_tensor_upload(*const_upload);
+    }
+    timer.mark("prepare");
 
     // Setup tensor memory (Allocate all tensors or setup transition manager)
-    if (ctx.config().use_transition_memory_manager)
+    if (use_transition_manager(ctx, run_parallel_branches))
     {
         detail::configure_transition_manager(graph, ctx, workload);
     }
@@ -112,12 +564,27 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     {
         detail::allocate_all_tensors(graph);
     }
+    timer.mark("allocate_tensors");
 
     // Finalize Graph context
-    ctx.finalize();
+    ctx.finalize(num_memory_pools(ctx, forced_target));
+    timer.mark("context_finalize");
 
     // Register graph
     _workloads.insert(std::make_pair(graph.id(), std::move(workload)));
+    _targets.insert(std::make_pair(graph.id(), forced_target));
+    if (stage_executor != nullptr)
+    {
+        _stage_executors.insert(std::make_pair(graph.id(), std::move(stage_executor)));
+    }
+    record_workload(graph);
+    setup_executors(graph, forced_target);
+    timer.mark("executor_setup");
+
+    {
+        std::lock_guard<std::mutex> lock(last_finalize_mutex);
+        last_finalize_phase_timings = std::move(timer.timings());
+    }
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Created workload for graph with ID : " << graph.id() << std::endl);
 }
 
@@ -129,6 +596,23 @@ void GraphManager::execute_graph(Graph &graph)
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    // Stream the requests through the pipeline stages
+    auto stages = _stage_executors.find(graph.id());
+    if (stages != std::end(_stage_executors))
+    {
+        stages->second->run_stream(it->second);
+        return;
+    }
+
+    // Keep several requests in flight
+    const int pipeline_depth = it->second.ctx->config().pipeline_depth;
+    if (pipeline_depth > 1)
+    {
+        detail::call_all_tasks_pipelined(it->second, static_cast<unsigned int>(pipeline_depth),
+                                         [&](ExecutionWorkload &workload) { run_tasks(graph, workload); });
+        return;
+    }
+
     while (true)
     {
         // Call input accessors
@@ -138,7 +622,7 @@ void GraphManager::execute_graph(Graph &graph)
         }
 
         // Run graph
-        detail::call_all_tasks(it->second);
+        run_tasks(graph, it->second);
 
         // Call output accessors
         if (!detail::call_all_output_node_accessors(it->second))
@@ -148,12 +632,513 @@ void GraphManager::execute_graph(Graph &graph)
     }
 }
 
+void GraphManager::reshape_inputs(Graph &graph, const std::vector<TensorShape> &input_shapes)
+{
+    ARM_COMPUTE_LOG_INFO_WITH_FUNCNAME_ACL("Initiate graph reshape!");
+
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+    ARM_COMPUTE_ERROR_ON_MSG(input_shapes.size() != graph.nodes(NodeType::Input).size(),
+                             "Expected a shape for each input of the graph!");
+    ARM_COMPUTE_ERROR_ON_MSG(_stage_executors.find(graph.id()) != std::end(_stage_executors),
+                             "Cannot reshape a graph executed in pipeline stages!");
+    if (get_input_shapes(graph) == input_shapes)
+    {
+        return;
+    }
+
+    GraphContext &ctx    = *it->second.ctx;
+    const Target  target = _targets.at(graph.id());
+
+    // The executors refer to the tasks of the current workload
+    _parallel_executors.erase(graph.id());
+    _workload_runners.erase(graph.id());
+    _lazy_preparers.erase(graph.id());
+
+    // Put the current workload aside with the tensors its functions were configured with. The functions keep the
+    // weights transformations that the weights manager shares with the functions configured for the new shapes.
+    auto               &others    = _other_workloads[graph.id()];
+    auto               &tensors   = graph.tensors();
+    const auto          const_ids = get_const_tensor_ids(graph);
+    InputShapesWorkload current   = extract_workload(graph);
+
+    auto previous = std::find_if(std::begin(others), std::end(others), [&](const InputShapesWorkload &w)
+                                 { return w.input_shapes == input_shapes; });
+    if (previous != std::end(others))
+    {
+        // Swap the workload configured for these shapes back in
+        for (auto &tensor : tensors)
+        {
+            if (tensor != nullptr && const_ids.find(tensor->id()) == std::end(const_ids))
+            {
+                tensor->desc() = previous->descriptors[tensor->id()];
+                tensor->set_handle(std::move(previous->handles[tensor->id()]));
+            }
+        }
+        it->second           = std::move(previous->workload);
+        _records[graph.id()] = std::move(previous->record);
+        others.erase(previous);
+    }
+    else
+    {
+        // Forward the new shapes through the graph
+        const std::vector<NodeID> &input_ids = graph.nodes(NodeType::Input);
+        for (size_t i = 0; i < input_ids.size(); ++i)
+        {
+            arm_compute::utils::cast::polymorphic_downcast<InputNode *>(graph.node(input_ids[i]))
+                ->set_shape(input_shapes[i]);
+        }
+        std::vector<NodeID> topological_sorted_nodes = dfs(graph);
+        for (auto &node_id : topological_sorted_nodes)
+        {
+            graph.node(node_id)->forward_descriptors();
+        }
+
+        it->second = configure_workload(graph, ctx, target, topological_sorted_nodes);
+        record_workload(graph);
+    }
+    others.emplace_back(std::move(current));
+
+    setup_executors(graph, target);
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Reshaped the inputs of the graph with ID : " << graph.id() << std::endl);
+}
+
+void GraphManager::update_graph(Graph &graph, const std::vector<NodeID> &edited_nodes)
+{
+    ARM_COMPUTE_LOG_INFO_WITH_FUNCNAME_ACL("Initiate graph update!");
+
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+    ARM_COMPUTE_ERROR_ON_MSG(_stage_executors.find(graph.id()) != std::end(_stage_executors),
+                             "Cannot update a graph executed in pipeline stages!");
+
+    GraphContext   &ctx    = *it->second.ctx;
+    const Target    target = _targets.at(graph.id());
+    WorkloadRecord &record = _records.at(graph.id());
+
+    // The executors refer to the tasks of the current workload
+    _parallel_executors.erase(graph.id());
+    _workload_runners.erase(graph.id());
+    _lazy_preparers.erase(graph.id());
+
+    // The workloads of the other input shapes were configured for the graph before the edit
+    auto &retired = _retired_workloads[graph.id()];
+    for (auto &other : _other_workloads[graph.id()])
+    {
+        retired.emplace_back(std::move(other));
+    }
+    _other_workloads.erase(graph.id());
+
+    // Run the added nodes on the target of the graph
+    for (auto &node : graph.nodes())
+    {
+        if (node != nullptr && node->assigned_target() == Target::UNSPECIFIED)
+        {
+            node->set_assigned_target(target);
+        }
+    }
+    for (auto &tensor : graph.tensors())
+    {
+        if (tensor != nullptr && tensor->desc().target == Target::UNSPECIFIED)
+        {
+            tensor->desc().target = target;
+        }
+    }
+
+    // Forward the edited descriptors through the graph
+    for (auto &node_id : dfs(graph))
+    {
+        graph.node(node_id)->forward_descriptors();
+    }
+    detail::configure_all_tensors(graph);
+    NodeExecutionMethodMutator().mutate(graph);
+
+    // Find the nodes to configure again
+    std::set<NodeID> nodes_to_configure;
+    for (auto &node : graph.nodes())
+    {
+        if (node == nullptr)
+        {
+            continue;
+        }
+        auto previous = record.nodes.find(node->id());
+        if (previous == std::end(record.nodes) || previous->second != node_signature(*node) ||
+            std::find(edited_nodes.begin(), edited_nodes.end(), node->id()) != edited_nodes.end())
+        {
+            nodes_to_configure.insert(node->id());
+        }
+    }
+
+    // Keep the execution order of the previous tasks
+    std::map<NodeID, int> task_positions;
+    for (size_t i = 0; i < record.task_nodes.size(); ++i)
+    {
+        if (nodes_to_configure.find(record.task_nodes[i]) == std::end(nodes_to_configure))
+        {
+            task_positions.emplace(record.task_nodes[i], static_cast<int>(i));
+        }
+    }
+    const std::vector<NodeID> node_order = sort_keeping_task_order(graph, task_positions);
+    ARM_COMPUTE_ERROR_ON_MSG(static_cast<std::ptrdiff_t>(node_order.size()) !=
+                                 std::count_if(graph.nodes().begin(), graph.nodes().end(),
+                                               [](const std::unique_ptr<INode> &node) { return node != nullptr; }),
+                             "The edited graph has a cycle!");
+
+    const bool run_parallel_branches = use_parallel_branches(ctx, target);
+    ARM_COMPUTE_ERROR_ON_MSG(!reads_inputs_before_overwrite(graph, node_order, run_parallel_branches),
+                             "A node added by the edit reads a tensor after a node overwrites it in place!");
+
+    if (record.has_transition_plan && !follows_transition_plan(graph, node_order, record.lifetimes))
+    {
+        // The previous workload stays alive as the memory managers refer to its tensors
+        ARM_COMPUTE_LOG_GRAPH_INFO("Configuring all the nodes of the graph with ID : "
+                                   << graph.id() << " again, the edit does not fit its memory plan" << std::endl);
+        retired.emplace_back(extract_workload(graph));
+        it->second = configure_workload(graph, ctx, target, node_order);
+        record_workload(graph);
+        setup_executors(graph, target);
+        return;
+    }
+
+    // Validate and configure the edited nodes, the other nodes keep their tasks
+    for (auto &node_id : nodes_to_configure)
+    {
+        INode                    *node    = graph.node(node_id);
+        backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(node->assigned_target());
+        Status                    status  = backend.validate_node(*node);
+        ARM_COMPUTE_ERROR_ON_MSG(!bool(status), status.error_description().c_str());
+    }
+    ARM_COMPUTE_ERROR_ON(record.task_nodes.size() != it->second.tasks.size());
+    std::map<NodeID, ExecutionTask> previous_tasks;
+    for (size_t i = 0; i < record.task_nodes.size(); ++i)
+    {
+        previous_tasks.emplace(record.task_nodes[i], std::move(it->second.tasks[i]));
+    }
+    ExecutionWorkload workload;
+    {
+        const TrustedConfigureScope trusted_configure(ctx.config().use_trusted_configure);
+        workload = detail::configure_edited_nodes(graph, ctx, node_order, nodes_to_configure, previous_tasks);
+    }
+    ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
+
+    // Fill the added constants, and the ones released by the previous functions when they are read again
+    for (auto &node_id : nodes_to_configure)
+    {
+        INode *node = graph.node(node_id);
+        if (node->type() == NodeType::Const && record.nodes.find(node_id) == std::end(record.nodes))
+        {
+            detail::import_or_allocate_const_tensors(*node);
+            detail::call_tensor_accessor(node->output(0));
+        }
+        for (size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            const Edge *input_edge = node->input_edge(i);
+            if (input_edge != nullptr && input_edge->producer() != nullptr &&
+                input_edge->producer()->type() == NodeType::Const)
+            {
+                refill_released_const_tensor(*input_edge->producer());
+            }
+        }
+    }
+
+    if (!use_lazy_prepare(ctx, run_parallel_branches))
+    {
+        for (auto &task : workload.tasks)
+        {
+            if (nodes_to_configure.find(task.node->id()) != std::end(nodes_to_configure))
+            {
+                task.prepare();
+                detail::release_unused_tensors(graph);
+            }
+        }
+    }
+
+    // The added tensors are not managed
+    detail::allocate_all_tensors(graph);
+
+    // Create the memory pools again, sized for the functions of both workloads
+    for (auto &mm_obj : ctx.memory_managers())
+    {
+        if (mm_obj.second.intra_mm != nullptr)
+        {
+            mm_obj.second.intra_mm->clear();
+        }
+        if (mm_obj.second.cross_mm != nullptr)
+        {
+            mm_obj.second.cross_mm->clear();
+        }
+    }
+    ctx.finalize(num_memory_pools(ctx, target));
+
+    it->second = std::move(workload);
+    record.nodes.clear();
+    for (auto &node : graph.nodes())
+    {
+        if (node != nullptr)
+        {
+            record.nodes.emplace(node->id(), node_signature(*node));
+        }
+    }
+    record.task_nodes.clear();
+    for (auto &task : it->second.tasks)
+    {
+        record.task_nodes.push_back(task.node->id());
+    }
+
+    setup_executors(graph, target);
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Updated " << nodes_to_configure.size() << " nodes of the graph with ID : "
+                                             << graph.id() << std::endl);
+}
+
+FinalizePhaseTimings GraphManager::last_finalize_timings()
+{
+    std::lock_guard<std::mutex> lock(last_finalize_mutex);
+    return last_finalize_phase_timings;
+}
+
+void GraphManager::warm_up(Graph &graph, bool run_dummy_iteration)
+{
+    ARM_COMPUTE_LOG_INFO_WITH_FUNCNAME_ACL("Initiate graph warm up!");
+
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+
+    // Fault in the pages of the tensors allocated outside of the memory pools
+    const auto const_ids = get_const_tensor_ids(graph);
+    for (auto &tensor : graph.tensors())
+    {
+        if (tensor == nullptr || tensor->handle() == nullptr || tensor->handle()->is_subtensor() ||
+            const_ids.find(tensor->id()) != std::end(const_ids))
+        {
+            continue;
+        }
+        ITensorHandle *handle = tensor->handle();
+        handle->map(true);
+        if (handle->tensor().buffer() != nullptr)
+        {
+            std::memset(handle->tensor().buffer(), 0, handle->tensor().info()->total_size());
+        }
+        handle->unmap();
+    }
+
+    if (run_dummy_iteration)
+    {
+        // Prepares the nodes left unprepared and touches the memory pools
+        run_tasks(graph, it->second);
+        sync_backends();
+    }
+    else
+    {
+        auto preparer = _lazy_preparers.find(graph.id());
+        if (preparer != std::end(_lazy_preparers) && !preparer->second->is_prepared())
+        {
+            detail::prepare_all_tasks(it->second);
+        }
+    }
+}
+
 void GraphManager::invalidate_graph(Graph &graph)
 {
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    _stage_executors.erase(graph.id());
+    _parallel_executors.erase(graph.id());
+    _workload_runners.erase(graph.id());
+    _lazy_preparers.erase(graph.id());
     _workloads.erase(it);
+    _other_workloads.erase(graph.id());
+    _records.erase(graph.id());
+    _retired_workloads.erase(graph.id());
+    _targets.erase(graph.id());
+}
+
+void GraphManager::run_tasks(Graph &graph, ExecutionWorkload &workload)
+{
+    auto stages   = _stage_executors.find(graph.id());
+    auto executor = _parallel_executors.find(graph.id());
+    auto runner   = _workload_runners.find(graph.id());
+    auto preparer = _lazy_preparers.find(graph.id());
+    if (stages != std::end(_stage_executors))
+    {
+        stages->second->run(workload);
+    }
+    else if (executor != std::end(_parallel_executors))
+    {
+        executor->second->run(workload);
+    }
+    else if (preparer != std::end(_lazy_preparers))
+    {
+        preparer->second->run(workload);
+    }
+    else if (runner != std::end(_workload_runners))
+    {
+        runner->second(workload, detail::call_all_tasks);
+    }
+    else
+    {
+        detail::call_all_tasks(workload);
+    }
+}
+
+GraphManager::InputShapesWorkload GraphManager::extract_workload(Graph &graph)
+{
+    auto               &tensors   = graph.tensors();
+    const auto          const_ids = get_const_tensor_ids(graph);
+    InputShapesWorkload current;
+    current.input_shapes = get_input_shapes(graph);
+    current.workload     = std::move(_workloads.at(graph.id()));
+    current.record       = std::move(_records.at(graph.id()));
+    current.descriptors.resize(tensors.size());
+    current.handles.resize(tensors.size());
+    for (auto &tensor : tensors)
+    {
+        if (tensor != nullptr && const_ids.find(tensor->id()) == std::end(const_ids))
+        {
+            current.descriptors[tensor->id()] = tensor->desc();
+            current.handles[tensor->id()]     = tensor->extract_handle();
+        }
+    }
+    return current;
+}
+
+ExecutionWorkload GraphManager::configure_workload(Graph                     &graph,
+                                                   GraphContext              &ctx,
+                                                   Target                     target,
+                                                   const std::vector<NodeID> &node_order)
+{
+    // Create the tensors and run the backend passes again, they may disable the concatenations
+    for (auto &node_id : graph.nodes(NodeType::ConcatenateLayer))
+    {
+        arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(graph.node(node_id))
+            ->set_enabled(true);
+    }
+    detail::configure_all_tensors(graph);
+    PassManager pm = create_default_pass_manager(target, ctx.config());
+    pm.run_type(graph, IGraphMutator::MutationType::Backend);
+
+    detail::validate_all_nodes(graph);
+    ExecutionWorkload workload;
+    {
+        const TrustedConfigureScope trusted_configure(ctx.config().use_trusted_configure);
+        workload = detail::configure_all_nodes(graph, ctx, node_order);
+    }
+    ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
+
+    // The functions transforming their weights without the weights manager read them again when prepared
+    refill_released_const_tensors(graph);
+    for (auto &node : graph.nodes())
+    {
+        if (node != nullptr && node->type() == NodeType::Input)
+        {
+            detail::allocate_all_output_tensors(*node);
+        }
+        else if (node != nullptr && node->type() == NodeType::Output)
+        {
+            detail::allocate_all_input_tensors(*node);
+        }
+    }
+
+    const bool run_parallel_branches = use_parallel_branches(ctx, target);
+    if (!use_lazy_prepare(ctx, run_parallel_branches))
+    {
+        detail::prepare_all_tasks(workload);
+    }
+    if (use_transition_manager(ctx, run_parallel_branches))
+    {
+        detail::configure_transition_manager(graph, ctx, workload);
+    }
+    else
+    {
+        detail::allocate_all_tensors(graph);
+    }
+
+    // Create the memory pools again, sized for the functions of all the workloads
+    for (auto &mm_obj : ctx.memory_managers())
+    {
+        if (mm_obj.second.intra_mm != nullptr)
+        {
+            mm_obj.second.intra_mm->clear();
+        }
+        if (mm_obj.second.cross_mm != nullptr)
+        {
+            mm_obj.second.cross_mm->clear();
+        }
+    }
+    ctx.finalize(num_memory_pools(ctx, target));
+
+    return workload;
+}
+
+void GraphManager::record_workload(Graph &graph)
+{
+    ExecutionWorkload &workload = _workloads.at(graph.id());
+    WorkloadRecord     record;
+    for (auto &node : graph.nodes())
+    {
+        if (node != nullptr)
+        {
+            record.nodes.emplace(node->id(), node_signature(*node));
+        }
+    }
+    for (auto &task : workload.tasks)
+    {
+        record.task_nodes.push_back(task.node->id());
+    }
+    record.has_transition_plan =
+        use_transition_manager(*workload.ctx, use_parallel_branches(*workload.ctx, _targets.at(graph.id())));
+    if (record.has_transition_plan)
+    {
+        record.lifetimes = detail::compute_transition_lifetimes(graph, *workload.ctx, workload);
+    }
+    _records[graph.id()] = std::move(record);
+}
+
+void GraphManager::setup_executors(Graph &graph, Target target)
+{
+    ExecutionWorkload &workload              = _workloads.at(graph.id());
+    GraphContext      &ctx                   = *workload.ctx;
+    const bool         run_parallel_branches = use_parallel_branches(ctx, target);
+
+    // Start the pipeline stages, or create the executor of the concurrent branches or the backend runner
+    auto stages = _stage_executors.find(graph.id());
+    if (stages != std::end(_stage_executors))
+    {
+        const unsigned int num_stages        = stages->second->num_stages();
+        const unsigned int threads_per_stage = std::max(1U, Scheduler::get().num_threads() / num_stages);
+        stages->second->start(threads_per_stage);
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Executing " << num_stages << " pipeline stages with " << threads_per_stage
+                                                   << " threads each" << std::endl);
+    }
+    else if (run_parallel_branches && target == Target::NEON)
+    {
+        const unsigned int num_branches       = static_cast<unsigned int>(ctx.config().num_parallel_branches);
+        const unsigned int threads_per_branch = std::max(1U, Scheduler::get().num_threads() / num_branches);
+        _parallel_executors.insert(std::make_pair(
+            graph.id(), std::make_unique<detail::ParallelTaskExecutor>(workload, num_branches, threads_per_branch)));
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Executing up to " << num_branches << " branches with " << threads_per_branch
+                                                         << " threads each" << std::endl);
+    }
+    else
+    {
+        // Let the backend run the workload, for example to replay it
+        WorkloadRunner runner = backends::BackendRegistry::get().get_backend(target).create_workload_runner(ctx);
+        if (runner)
+        {
+            _workload_runners.insert(std::make_pair(graph.id(), std::move(runner)));
+        }
+    }
+
+    if (use_lazy_prepare(ctx, run_parallel_branches))
+    {
+        // Only CPU functions can be prepared ahead by another thread
+        const bool         cpu_only = target == Target::NEON;
+        const unsigned int distance =
+            cpu_only ? static_cast<unsigned int>(std::max(0, ctx.config().lazy_prepare_distance)) : 0U;
+        _lazy_preparers.insert(
+            std::make_pair(graph.id(), std::make_unique<detail::LazyPrepareExecutor>(workload, distance)));
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Preparing nodes on first use, " << distance << " nodes ahead" << std::endl);
+    }
 }
 } // namespace graph
 } // namespace arm_compute
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphProfiler.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/TypePrinter.h"
+
+#include <iomanip>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Process ID of the host threads in the exported traces, the devices use the following ones */
+constexpr int host_pid = 0;
+
+double elapsed_us(IKernelProfiler::Clock::time_point origin)
+{
+    return std::chrono::duration<double, std::micro>(IKernelProfiler::Clock::now() - origin).count();
+}
+
+template <typename T>
+std::string stream_to_string(const T &value)
+{
+    std::stringstream ss;
+    ss << value;
+    return ss.str();
+}
+
+std::string quote(const std::string &str)
+{
+    std::string quoted = "\"";
+    for (const char c : str)
+    {
+        if (c == '"' || c == '\\')
+        {
+            quoted += '\\';
+            quoted += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            quoted += ' ';
+        }
+        else
+        {
+            quoted += c;
+        }
+    }
+    return quoted + "\"";
+}
+
+void print_complete_event(std::ostream &os, const std::string &name, double start_us, double end_us, int pid, int tid)
+{
+    os << "{\"name\":" << quote(name) << ",\"ph\":\"X\",\"ts\":" << start_us
+       << ",\"dur\":" << (end_us - start_us) << ",\"pid\":" << pid << ",\"tid\":" << tid;
+}
+} // namespace
+
+GraphProfiler::GraphProfiler()
+    : _real_function(),
+      _kernel_profilers(),
+      _profiles(),
+      _threads(),
+      _origin(IKernelProfiler::Clock::now()),
+      _mtx(),
+      _running(false)
+{
+}
+
+GraphProfiler::~GraphProfiler()
+{
+    stop();
+}
+
+void GraphProfiler::start()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_running, "The profiler is already running");
+
+    for (auto &backend : backends::BackendRegistry::get().backends())
+    {
+        if (backend.second != nullptr && backend.second->is_backend_supported())
+        {
+            std::unique_ptr<IKernelProfiler> kernel_profiler = backend.second->create_kernel_profiler();
+            if (kernel_profiler != nullptr)
+            {
+                kernel_profiler->start();
+                _kernel_profilers.push_back(std::move(kernel_profiler));
+            }
+        }
+    }
+
+    _real_function                       = TaskExecutor::get().execute_function;
+    TaskExecutor::get().execute_function = [this](ExecutionTask &task) { execute(task); };
+    _running                             = true;
+}
+
+void GraphProfiler::stop()
+{
+    if (!_running)
+    {
+        return;
+    }
+
+    TaskExecutor::get().execute_function = _real_function;
+    _real_function                       = nullptr;
+    _running                             = false;
+
+    for (auto &kernel_profiler : _kernel_profilers)
+    {
+        kernel_profiler->stop();
+        kernel_profiler->collect(_origin, _profiles);
+    }
+    _kernel_profilers.clear();
+}
+
+void GraphProfiler::clear()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_running, "Cannot clear a running profiler");
+    _profiles.clear();
+    _threads.clear();
+    _origin = IKernelProfiler::Clock::now();
+}
+
+const std::vector<NodeProfile> &GraphProfiler::profiles() const
+{
+    return _profiles;
+}
+
+void GraphProfiler::execute(ExecutionTask &task)
+{
+    int index = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+
+        NodeProfile profile;
+        if (task.node != nullptr)
+        {
+            profile.id     = task.node->id();
+            profile.name   = task.node->name();
+            profile.type   = task.node->type();
+            profile.target = task.node->assigned_target();
+        }
+        const auto thread = _threads.emplace(std::this_thread::get_id(), static_cast<unsigned int>(_threads.size()));
+        profile.thread    = thread.first->second;
+        profile.start_us  = elapsed_us(_origin);
+
+        index = static_cast<int>(_profiles.size());
+        _profiles.push_back(std::move(profile));
+    }
+
+    for (auto &kernel_profiler : _kernel_profilers)
+    {
+        kernel_profiler->set_current_profile(index);
+    }
+    _real_function(task);
+    for (auto &kernel_profiler : _kernel_profilers)
+    {
+        kernel_profiler->set_current_profile(-1);
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    _profiles[index].end_us = elapsed_us(_origin);
+}
+
+void GraphProfiler::export_chrome_trace(std::ostream &os) const
+{
+    std::ios_base::fmtflags flags     = os.flags();
+    std::streamsize         precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+
+    std::map<Target, int> device_pids;
+    os << "{\"traceEvents\":[\n";
+    os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << host_pid << ",\"args\":{\"name\":\"Host\"}}";
+    for (const auto &profile : _profiles)
+    {
+        os << ",\n";
+        print_complete_event(os, profile.name.empty() ? stream_to_string(profile.type) : profile.name,
+                             profile.start_us, profile.end_us, host_pid, static_cast<int>(profile.thread));
+        os << ",\"cat\":\"node\",\"args\":{\"id\":" << profile.id
+           << ",\"type\":" << quote(stream_to_string(profile.type))
+           << ",\"target\":" << quote(stream_to_string(profile.target)) << ",\"kernels\":[";
+        for (size_t i = 0; i < profile.kernels.size(); ++i)
+        {
+            os << (i == 0 ? "" : ",") << quote(profile.kernels[i].name);
+        }
+        os << "]}}";
+
+        if (profile.kernels.empty())
+        {
+            continue;
+        }
+        auto pid = device_pids.find(profile.target);
+        if (pid == device_pids.end())
+        {
+            pid = device_pids.emplace(profile.target, host_pid + 1 + static_cast<int>(device_pids.size())).first;
+            os << ",\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid->second
+               << ",\"args\":{\"name\":" << quote(stream_to_string(profile.target)) << "}}";
+        }
+        for (const auto &kernel : profile.kernels)
+        {
+            os << ",\n";
+            print_complete_event(os, kernel.name, kernel.start_us, kernel.end_us, pid->second, 0);
+            os << ",\"cat\":\"kernel\",\"args\":{\"node\":" << quote(profile.name) << "}}";
+        }
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    os.flags(flags);
+    os.precision(precision);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/SharedWeightsContext.h"
+
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Tensor.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Handle of a graph to the backend tensor of a constant shared with other graphs
+ *
+ * Only the graph which owns the constant allocates and fills the backend tensor, which is never released as the
+ * graphs finalized later read it to prepare their functions.
+ */
+class SharedTensorHandle final : public ITensorHandle
+{
+public:
+    SharedTensorHandle(ITensorHandle *shared_handle, bool is_owner)
+        : _shared_handle(shared_handle), _is_owner(is_owner)
+    {
+    }
+
+    void allocate() override
+    {
+        if (_is_owner)
+        {
+            _shared_handle->allocate();
+        }
+    }
+    void free() override
+    {
+        // noop
+    }
+    void manage(IMemoryGroup *mg) override
+    {
+        ARM_COMPUTE_UNUSED(mg);
+        // noop
+    }
+    void map(bool blocking) override
+    {
+        _shared_handle->map(blocking);
+    }
+    void unmap() override
+    {
+        _shared_handle->unmap();
+    }
+    void release_if_unused() override
+    {
+        // noop
+    }
+    arm_compute::ITensor &tensor() override
+    {
+        return _shared_handle->tensor();
+    }
+    const arm_compute::ITensor &tensor() const override
+    {
+        return _shared_handle->tensor();
+    }
+    ITensorHandle *parent_handle() override
+    {
+        return this;
+    }
+    bool is_subtensor() const override
+    {
+        return false;
+    }
+    Target target() const override
+    {
+        return _shared_handle->target();
+    }
+
+private:
+    ITensorHandle *_shared_handle;
+    bool           _is_owner;
+};
+
+bool are_descriptors_equal(const TensorDescriptor &a, const TensorDescriptor &b)
+{
+    return a.shape == b.shape && a.data_type == b.data_type && a.quant_info == b.quant_info && a.layout == b.layout &&
+           a.target == b.target;
+}
+} // namespace
+
+SharedWeightsContext::SharedWeightsContext() : _tensors(), _weights_managers()
+{
+}
+
+SharedWeightsContext::~SharedWeightsContext()
+{
+    for (auto &shared : _tensors)
+    {
+        backends::BackendRegistry::get().get_backend(shared.second.desc.target).unregister_persistent_tensor(
+            *shared.second.handle);
+    }
+}
+
+std::shared_ptr<arm_compute::IWeightsManager> SharedWeightsContext::weights_manager(Target target)
+{
+    auto it = _weights_managers.find(target);
+    if (it == std::end(_weights_managers))
+    {
+        std::shared_ptr<arm_compute::IWeightsManager> wm =
+            backends::BackendRegistry::get().get_backend(target).create_weights_manager();
+        it = _weights_managers.emplace(target, std::move(wm)).first;
+    }
+    return it->second;
+}
+
+std::unique_ptr<ITensorHandle>
+SharedWeightsContext::share_tensor(const std::string &name, const Tensor &tensor, bool &is_owner)
+{
+    auto it  = _tensors.find(name);
+    is_owner = (it == std::end(_tensors));
+    if (is_owner)
+    {
+        SharedTensor shared;
+        shared.desc   = tensor.desc();
+        shared.handle = backends::BackendRegistry::get().get_backend(tensor.desc().target).create_tensor(tensor);
+        ARM_COMPUTE_ERROR_ON_MSG(!shared.handle, "Couldn't create backend handle!");
+        // Let the backend share the weights transformed from the constant, which is kept alive by the context
+        backends::BackendRegistry::get().get_backend(shared.desc.target).register_persistent_tensor(*shared.handle);
+        it = _tensors.emplace(name, std::move(shared)).first;
+    }
+    else if (!are_descriptors_equal(it->second.desc, tensor.desc()))
+    {
+        return nullptr;
+    }
+
+    // The functions of the graphs finalized earlier mark the weights as unused once they have transformed them
+    it->second.handle->tensor().mark_as_used();
+
+    return std::make_unique<SharedTensorHandle>(it->second.handle.get(), is_owner);
+}
+
+size_t SharedWeightsContext::num_tensors() const
+{
+    return _tensors.size();
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019,2021 Arm Limited.
+ * Copyright (c) 2018-2019,2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,6 +72,11 @@ std::unique_ptr<ITensorAccessor> Tensor::extract_accessor()
     return std::move(_accessor);
 }
 
+std::unique_ptr<ITensorHandle> Tensor::extract_handle()
+{
+    return std::move(_handle);
+}
+
 bool Tensor::call_accessor()
 {
     // Early exit guard
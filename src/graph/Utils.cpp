@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,14 +23,72 @@
  */
 #include "arm_compute/graph/Utils.h"
 
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/mutators/GraphMutators.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
 
 namespace arm_compute
 {
 namespace graph
 {
+namespace
+{
+/** Number of multiply-accumulates under which a fully connected layer is faster on the CPU than the GPU kernel launch
+ * and the synchronizations around it */
+constexpr size_t small_fully_connected_macs = 1 << 18;
+/** Number of elements under which an argmin/argmax layer is faster on the CPU */
+constexpr size_t small_reduction_elements = 1 << 16;
+
+bool runs_faster_on_cpu(const INode &node)
+{
+    switch (node.type())
+    {
+        // Sorting and non-maximum suppression are sequential
+        case NodeType::DetectionOutputLayer:
+        case NodeType::DetectionPostProcessLayer:
+            return true;
+        case NodeType::ArgMinMaxLayer:
+        {
+            const Tensor *input = node.input(0);
+            return input != nullptr && input->desc().shape.total_size() <= small_reduction_elements;
+        }
+        case NodeType::FullyConnectedLayer:
+        {
+            const Tensor *input   = node.input(0);
+            const Tensor *weights = node.input(1);
+            if (input == nullptr || weights == nullptr || weights->desc().shape[0] == 0)
+            {
+                return false;
+            }
+            const size_t num_batches = input->desc().shape.total_size() / weights->desc().shape[0];
+            return weights->desc().shape.total_size() * num_batches <= small_fully_connected_macs;
+        }
+        default:
+            return false;
+    }
+}
+
+bool all_consumers_on_target(const Graph &g, const std::set<EdgeID> &edges, Target target)
+{
+    return std::all_of(edges.begin(), edges.end(),
+                       [&](EdgeID eid)
+                       {
+                           const Edge *e = g.edge(eid);
+                           return e == nullptr || e->consumer() == nullptr ||
+                                  e->consumer()->assigned_target() == target;
+                       });
+}
+} // namespace
+
 bool is_target_supported(Target target)
 {
     return backends::BackendRegistry::get().contains(target) &&
@@ -71,9 +129,99 @@ void force_target_to_graph(Graph &g, Target target)
     }
 }
 
+void assign_heterogeneous_targets(Graph &g, Target target)
+{
+    force_target_to_graph(g, target);
+    if (target != Target::CL || !is_target_supported(Target::NEON))
+    {
+        return;
+    }
+
+    // Place the compute nodes with the cost model
+    for (auto &node : g.nodes())
+    {
+        if (node != nullptr && runs_faster_on_cpu(*node))
+        {
+            node->set_assigned_target(Target::NEON);
+        }
+    }
+
+    // Inputs and constants follow their consumers, outputs follow their producer
+    for (auto &node : g.nodes())
+    {
+        if (node == nullptr)
+        {
+            continue;
+        }
+        if ((node->type() == NodeType::Input || node->type() == NodeType::Const) && !node->output_edges().empty() &&
+            all_consumers_on_target(g, node->output_edges(), Target::NEON))
+        {
+            node->set_assigned_target(Target::NEON);
+        }
+        else if (node->type() == NodeType::Output && !node->input_edges().empty())
+        {
+            const Edge *e = g.edge(node->input_edges()[0]);
+            if (e != nullptr && e->producer() != nullptr)
+            {
+                node->set_assigned_target(e->producer()->assigned_target());
+            }
+        }
+    }
+
+    // A tensor stays on the GPU unless all the nodes accessing it run on the CPU
+    for (auto &node : g.nodes())
+    {
+        if (node == nullptr)
+        {
+            continue;
+        }
+        for (size_t i = 0; i < node->num_outputs(); ++i)
+        {
+            Tensor *tensor = node->output(i);
+            if (tensor != nullptr)
+            {
+                const bool on_cpu = node->assigned_target() == Target::NEON &&
+                                    all_consumers_on_target(g, tensor->bound_edges(), Target::NEON);
+                tensor->desc().target = on_cpu ? Target::NEON : target;
+            }
+        }
+    }
+}
+
+void force_fast_math_to_graph(Graph &g)
+{
+    using arm_compute::utils::cast::polymorphic_downcast;
+
+    for (auto &node : g.nodes())
+    {
+        if (node == nullptr)
+        {
+            continue;
+        }
+        switch (node->type())
+        {
+            case NodeType::ConvolutionLayer:
+                polymorphic_downcast<ConvolutionLayerNode *>(node.get())->set_fast_math_hint(FastMathHint::Enabled);
+                break;
+            case NodeType::DepthwiseConvolutionLayer:
+                polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node.get())
+                    ->set_fast_math_hint(FastMathHint::Enabled);
+                break;
+            case NodeType::FullyConnectedLayer:
+                polymorphic_downcast<FullyConnectedLayerNode *>(node.get())->set_fast_math_hint(FastMathHint::Enabled);
+                break;
+            case NodeType::FusedConvolutionBatchNormalizationLayer:
+                polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node.get())
+                    ->set_fast_math_hint(FastMathHint::Enabled);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
 PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
 {
-    ARM_COMPUTE_UNUSED(target);
     PassManager pm;
 
     // Passes that mutate graph IR
@@ -94,6 +242,21 @@ PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
             }
         }
     }
+    if (target == Target::NEON)
+    {
+        // The CPU functions have their fastest paths in NHWC
+        pm.append(std::make_unique<DataLayoutMutator>());
+    }
+    if (cfg.use_mixed_precision)
+    {
+        pm.append(std::make_unique<MixedPrecisionMutator>(cfg.mixed_precision_policy, target));
+    }
+    if (target == Target::NEON)
+    {
+        // The concatenated weights of the fused layers are computed by the constant folding
+        pm.append(std::make_unique<HorizontalFusionMutator>());
+    }
+    pm.append(std::make_unique<ConstantFoldingMutator>(target));
     pm.append(std::make_unique<NodeFusionMutator>());
     pm.append(std::make_unique<GroupedConvolutionMutator>());
     pm.append(std::make_unique<InPlaceOperationMutator>());
@@ -101,6 +264,7 @@ PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
     // Passes that mutate backend information
     pm.append(std::make_unique<DepthConcatSubTensorMutator>());
     pm.append(std::make_unique<SplitLayerSubTensorMutator>());
+    pm.append(std::make_unique<SliceLayerSubTensorMutator>());
     pm.append(std::make_unique<NodeExecutionMethodMutator>());
 
     return pm;
@@ -229,5 +393,164 @@ void configure_tensor(Tensor *tensor)
     }
 }
 
+bool compute_receptive_field(Graph &g, ReceptiveFieldInfo &info)
+{
+    using arm_compute::utils::cast::polymorphic_downcast;
+
+    // Mapping of a tensor to the graph input
+    struct SpatialField
+    {
+        bool  is_spatial{false}; /**< False for the constants, broadcast along the spatial dimensions */
+        float step{1.f};         /**< Input pixels per pixel of the tensor */
+        float halo_x{0.f};       /**< Input columns read on each side, beyond the ones the pixel maps to */
+        float halo_y{0.f};       /**< Input rows read on each side, beyond the ones the pixel maps to */
+    };
+
+    // Pixels of its input read on each side by a window of a convolution or pooling
+    const auto window_extent = [](unsigned int kernel, unsigned int pad_before)
+    { return static_cast<float>(std::max(pad_before, kernel - std::min(kernel, pad_before + 1))); };
+
+    std::map<TensorID, SpatialField> fields{};
+    unsigned int                     num_inputs = 0;
+    bool                             has_output = false;
+    SpatialField                     output{};
+    float                            max_step = 1.f;
+    for (NodeID id : dfs(g))
+    {
+        INode *node = g.node(id);
+        if (node == nullptr)
+        {
+            continue;
+        }
+
+        // The pixels of the inputs must map to the same input pixels
+        SpatialField in{};
+        for (size_t idx = 0; idx < node->num_inputs(); ++idx)
+        {
+            const Tensor *tensor = node->input(idx);
+            if (tensor == nullptr || !fields[tensor->id()].is_spatial)
+            {
+                continue;
+            }
+            const SpatialField &field = fields[tensor->id()];
+            if (in.is_spatial && field.step != in.step)
+            {
+                return false;
+            }
+            in.is_spatial = true;
+            in.step       = field.step;
+            in.halo_x     = std::max(in.halo_x, field.halo_x);
+            in.halo_y     = std::max(in.halo_y, field.halo_y);
+        }
+
+        SpatialField out = in;
+        switch (node->type())
+        {
+            case NodeType::Input:
+                out = SpatialField{true, 1.f, 0.f, 0.f};
+                ++num_inputs;
+                break;
+            case NodeType::Const:
+                out = SpatialField{};
+                break;
+            case NodeType::ConvolutionLayer:
+            case NodeType::DepthwiseConvolutionLayer:
+            case NodeType::PoolingLayer:
+            case NodeType::DeconvolutionLayer:
+            {
+                PadStrideInfo pad_stride{};
+                Size2D        kernel{};
+                if (node->type() == NodeType::PoolingLayer)
+                {
+                    const PoolingLayerInfo pool_info = polymorphic_downcast<PoolingLayerNode *>(node)->pooling_info();
+                    if (pool_info.is_global_pooling)
+                    {
+                        return false;
+                    }
+                    pad_stride = pool_info.pad_stride_info;
+                    kernel     = pool_info.pool_size;
+                }
+                else
+                {
+                    const TensorDescriptor &weights = node->input(1)->desc();
+                    kernel     = Size2D(get_dimension_size(weights, DataLayoutDimension::WIDTH),
+                                        get_dimension_size(weights, DataLayoutDimension::HEIGHT));
+                    pad_stride = node->type() == NodeType::ConvolutionLayer
+                                     ? polymorphic_downcast<ConvolutionLayerNode *>(node)->convolution_info()
+                                 : node->type() == NodeType::DepthwiseConvolutionLayer
+                                     ? polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node)->convolution_info()
+                                     : polymorphic_downcast<DeconvolutionLayerNode *>(node)->deconvolution_info();
+                }
+                const unsigned int stride = pad_stride.stride().first;
+                if (!in.is_spatial || stride != pad_stride.stride().second)
+                {
+                    return false;
+                }
+                if (node->type() == NodeType::DeconvolutionLayer)
+                {
+                    // An output pixel reads the input pixels whose upsampled window covers it
+                    const unsigned int extent_x = kernel.width - 1 + pad_stride.pad_left();
+                    const unsigned int extent_y = kernel.height - 1 + pad_stride.pad_top();
+                    out.halo_x += in.step * static_cast<float>(DIV_CEIL(extent_x, stride) + 1);
+                    out.halo_y += in.step * static_cast<float>(DIV_CEIL(extent_y, stride) + 1);
+                    out.step = in.step / static_cast<float>(stride);
+                }
+                else
+                {
+                    out.halo_x += in.step * window_extent(kernel.width, pad_stride.pad_left());
+                    out.halo_y += in.step * window_extent(kernel.height, pad_stride.pad_top());
+                    out.step = in.step * static_cast<float>(stride);
+                }
+                break;
+            }
+            case NodeType::ConcatenateLayer:
+                if (polymorphic_downcast<ConcatenateLayerNode *>(node)->concatenation_axis() !=
+                    DataLayoutDimension::CHANNEL)
+                {
+                    return false;
+                }
+                break;
+            case NodeType::ActivationLayer:
+            case NodeType::BatchNormalizationLayer:
+            case NodeType::ChannelShuffleLayer:
+            case NodeType::DequantizationLayer:
+            case NodeType::EltwiseLayer:
+            case NodeType::PReluLayer:
+            case NodeType::PrintLayer:
+            case NodeType::QuantizationLayer:
+            case NodeType::UnaryEltwiseLayer:
+                break;
+            case NodeType::Output:
+                if (!in.is_spatial || (has_output && in.step != output.step))
+                {
+                    return false;
+                }
+                has_output    = true;
+                output.step   = in.step;
+                output.halo_x = std::max(output.halo_x, in.halo_x);
+                output.halo_y = std::max(output.halo_y, in.halo_y);
+                break;
+            default:
+                return false;
+        }
+
+        max_step = out.is_spatial ? std::max(max_step, out.step) : max_step;
+        for (size_t idx = 0; idx < node->num_outputs(); ++idx)
+        {
+            fields[node->output_id(idx)] = out;
+        }
+    }
+
+    if (num_inputs != 1 || !has_output)
+    {
+        return false;
+    }
+    info.halo_x    = static_cast<unsigned int>(std::ceil(output.halo_x));
+    info.halo_y    = static_cast<unsigned int>(std::ceil(output.halo_y));
+    info.alignment = static_cast<unsigned int>(std::ceil(max_step));
+    info.scale     = 1.f / output.step;
+    return true;
+}
+
 } // namespace graph
 } // namespace arm_compute
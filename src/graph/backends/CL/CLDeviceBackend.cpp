@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,8 @@
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/graph/backends/BackendRegistrar.h"
 #include "arm_compute/graph/backends/CL/CLFunctionFactory.h"
+#include "arm_compute/graph/backends/CL/CLKernelProfiler.h"
+#include "arm_compute/graph/backends/CL/CLMultiQueueTaskExecutor.h"
 #include "arm_compute/graph/backends/CL/CLNodeValidator.h"
 #include "arm_compute/graph/backends/CL/CLSubTensorHandle.h"
 #include "arm_compute/graph/backends/CL/CLTensorHandle.h"
@@ -33,13 +35,18 @@
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/SharedWeightsContext.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
 #include "arm_compute/runtime/CL/CLBufferAllocator.h"
+#include "arm_compute/runtime/CL/CLRecordedQueue.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/Utils.h"
 #include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/OffsetLifetimeManager.h"
+#include "arm_compute/runtime/PackedOffsetLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
 
 #include "support/ToolchainSupport.h"
@@ -68,7 +75,9 @@ CLDeviceBackend::CLDeviceBackend()
       _gemm_heuristics(),
       _allocator(nullptr),
       _tuner_file(),
-      _backend_type(CLBackendType::Native)
+      _program_cache_file(),
+      _backend_type(CLBackendType::Native),
+      _weights_cache()
 {
 }
 
@@ -91,6 +100,7 @@ void CLDeviceBackend::initialize_backend()
 {
     // Setup Scheduler
     CLScheduler::get().default_init(&_tuner, &_gemm_heuristics, _backend_type);
+    CLScheduler::get().set_weights_cache(&_weights_cache);
     // Create allocator with new context
     _allocator = std::make_unique<CLBufferAllocator>();
 }
@@ -101,6 +111,11 @@ void CLDeviceBackend::release_backend_context(GraphContext &ctx)
     _context_count--;
     if (_context_count == 0) // No more context using the backend: free resources
     {
+        // Store the programs compiled for the graphs of the context to speed-up the next start
+        if (!_program_cache_file.empty())
+        {
+            save_program_cache_to_file(_program_cache_file);
+        }
         _allocator = nullptr;
     }
 }
@@ -124,9 +139,22 @@ void CLDeviceBackend::setup_backend_context(GraphContext &ctx)
         _tuner.load_from_file(_tuner_file);
     }
 
+    // Load the programs compiled on a previous run if available
+    _program_cache_file = ctx.config().program_cache_file;
+    if (!_program_cache_file.empty() && file_exists(_program_cache_file))
+    {
+        restore_program_cache_from_file(_program_cache_file);
+    }
+
     set_kernel_tuning(ctx.config().use_tuner);
     set_kernel_tuning_mode(ctx.config().tuner_mode);
 
+    // Let the scheduler adjust the flush cadence of the command queue instead of doubling it up to a fixed size
+    if (ctx.config().use_adaptive_job_chaining)
+    {
+        CLScheduler::get().enable_adaptive_job_chaining();
+    }
+
     // Attempt to load mlgo heuristics
     ARM_COMPUTE_ERROR_ON(CLScheduler::get().gemm_heuristics() == nullptr);
     CLScheduler::get().gemm_heuristics()->reload_from_file(ctx.config().mlgo_file);
@@ -134,22 +162,29 @@ void CLDeviceBackend::setup_backend_context(GraphContext &ctx)
     // Setup a management backend
     if (ctx.memory_management_ctx(Target::CL) == nullptr)
     {
+        // Offset pools carve the tensors out of a single buffer per memory manager as sub-buffers
+        const bool use_offsets = ctx.config().use_cl_offset_memory_pools;
+
         MemoryManagerContext mm_ctx;
-        mm_ctx.target      = Target::CL;
-        mm_ctx.intra_mm    = create_memory_manager(MemoryManagerAffinity::Buffer);
-        mm_ctx.cross_mm    = create_memory_manager(MemoryManagerAffinity::Buffer);
+        mm_ctx.target = Target::CL;
+        mm_ctx.intra_mm =
+            create_memory_manager(use_offsets ? MemoryManagerAffinity::Offset : MemoryManagerAffinity::Buffer);
+        mm_ctx.cross_mm =
+            create_memory_manager(use_offsets ? MemoryManagerAffinity::PackedOffset : MemoryManagerAffinity::Buffer);
         mm_ctx.cross_group = std::make_shared<MemoryGroup>(mm_ctx.cross_mm);
         mm_ctx.allocator   = _allocator.get();
 
         ctx.insert_memory_management_ctx(std::move(mm_ctx));
     }
 
-    // Create function level weights manager
+    // Create function level weights manager, or use the one of the weights shared with other graphs
     if (ctx.weights_management_ctx(Target::CL) == nullptr)
     {
+        const auto           &shared_weights = ctx.config().shared_weights;
         WeightsManagerContext wm_ctx;
         wm_ctx.target = Target::CL;
-        wm_ctx.wm     = create_weights_manager();
+        wm_ctx.wm     = (shared_weights != nullptr) ? shared_weights->weights_manager(Target::CL)
+                                                    : create_weights_manager();
 
         ctx.insert_weights_management_ctx(std::move(wm_ctx));
     }
@@ -206,17 +241,28 @@ arm_compute::Status CLDeviceBackend::validate_node(INode &node)
     return CLNodeValidator::validate(&node);
 }
 
+bool CLDeviceBackend::is_node_validated(const INode &node)
+{
+    return CLNodeValidator::is_validated(node);
+}
+
 std::shared_ptr<arm_compute::IMemoryManager> CLDeviceBackend::create_memory_manager(MemoryManagerAffinity affinity)
 {
-    if (affinity == MemoryManagerAffinity::Offset)
+    std::shared_ptr<ILifetimeManager> lifetime_mgr = nullptr;
+    if (affinity == MemoryManagerAffinity::Buffer)
     {
-        ARM_COMPUTE_LOG_GRAPH_WARNING("CL Backend does not support offset affinity memory management!");
-        return nullptr;
+        lifetime_mgr = std::make_shared<BlobLifetimeManager>();
     }
-
-    auto lifetime_mgr = std::make_shared<BlobLifetimeManager>();
-    auto pool_mgr     = std::make_shared<PoolManager>();
-    auto mm           = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+    else if (affinity == MemoryManagerAffinity::PackedOffset)
+    {
+        lifetime_mgr = std::make_shared<PackedOffsetLifetimeManager>();
+    }
+    else
+    {
+        lifetime_mgr = std::make_shared<OffsetLifetimeManager>();
+    }
+    auto pool_mgr = std::make_shared<PoolManager>();
+    auto mm       = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
 
     return mm;
 }
@@ -231,6 +277,73 @@ void CLDeviceBackend::sync()
 {
     CLScheduler::get().sync();
 }
+
+WorkloadRunner CLDeviceBackend::create_workload_runner(GraphContext &ctx)
+{
+    // Enqueue independent branches on concurrent command queues
+    if (ctx.config().num_parallel_branches > 1)
+    {
+        if (ctx.config().use_kernel_replay)
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Kernel replay is not supported with parallel branches, ignoring it"
+                                       << std::endl);
+        }
+        auto executor = std::make_shared<CLMultiQueueTaskExecutor>(
+            static_cast<unsigned int>(ctx.config().num_parallel_branches));
+        return [executor](ExecutionWorkload &workload, const std::function<void(ExecutionWorkload &)> &run_tasks)
+        {
+            ARM_COMPUTE_UNUSED(run_tasks);
+            executor->run(workload);
+        };
+    }
+
+    if (!ctx.config().use_kernel_replay)
+    {
+        return {};
+    }
+
+    // Record the kernels on the first run and replay them afterwards
+    auto recording = std::make_shared<CLRecordedQueue>();
+    bool recorded  = false;
+    return [recording, recorded](ExecutionWorkload                              &workload,
+                                 const std::function<void(ExecutionWorkload &)> &run_tasks) mutable
+    {
+        if (!recorded)
+        {
+            recording->begin_recording();
+            run_tasks(workload);
+            recorded = true;
+            if (!recording->end_recording())
+            {
+                ARM_COMPUTE_LOG_GRAPH_INFO("The kernels of the graph cannot be replayed" << std::endl);
+            }
+        }
+        else if (!recording->replay())
+        {
+            run_tasks(workload);
+        }
+    };
+}
+
+std::unique_ptr<IKernelProfiler> CLDeviceBackend::create_kernel_profiler()
+{
+    // No kernel can be enqueued before a graph initialized the scheduler
+    if (!CLScheduler::get().is_initialised())
+    {
+        return nullptr;
+    }
+    return std::make_unique<CLKernelProfiler>();
+}
+
+void CLDeviceBackend::register_persistent_tensor(ITensorHandle &handle)
+{
+    _weights_cache.register_weights(&handle.tensor());
+}
+
+void CLDeviceBackend::unregister_persistent_tensor(ITensorHandle &handle)
+{
+    _weights_cache.unregister_weights(&handle.tensor());
+}
 } // namespace backends
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -243,6 +243,8 @@ std::unique_ptr<IFunction> CLFunctionFactory::create(INode *node, GraphContext &
         case NodeType::BoundingBoxTransformLayer:
             return detail::create_bounding_box_transform_layer<CLBoundingBoxTransform, CLTargetInfo>(
                 *polymorphic_downcast<BoundingBoxTransformLayerNode *>(node));
+        case NodeType::CastLayer:
+            return detail::create_cast_layer<CLCast, CLTargetInfo>(*polymorphic_downcast<CastLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
             return detail::create_channel_shuffle_layer<CLChannelShuffleLayer, CLTargetInfo>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
@@ -289,6 +291,12 @@ std::unique_ptr<IFunction> CLFunctionFactory::create(INode *node, GraphContext &
             return detail::create_fused_depthwise_convolution_batch_normalization_layer<CLFusedLayerTypes,
                                                                                         CLTargetInfo>(
                 *polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node), ctx);
+        case NodeType::FusedCopyProgramLayer:
+            return detail::create_fused_copy_program_layer<CLCopyProgram, CLTargetInfo>(
+                *polymorphic_downcast<FusedCopyProgramNode *>(node));
+        case NodeType::FusedElementwiseChainLayer:
+            return detail::create_fused_elementwise_chain_layer<CLElementwiseChain, CLTargetInfo>(
+                *polymorphic_downcast<FusedElementwiseChainNode *>(node));
         case NodeType::GenerateProposalsLayer:
             return detail::create_generate_proposals_layer<CLGenerateProposalsLayer, CLTargetInfo>(
                 *polymorphic_downcast<GenerateProposalsLayerNode *>(node), ctx);
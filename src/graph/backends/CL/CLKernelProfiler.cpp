@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/backends/CL/CLKernelProfiler.h"
+
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+
+#include <sstream>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+namespace
+{
+/** Profile the kernels enqueued from the current thread belong to */
+thread_local int current_profile = -1;
+} // namespace
+
+CLKernelProfiler::CLKernelProfiler() : _real_function(nullptr), _events(), _mtx()
+{
+}
+
+CLKernelProfiler::~CLKernelProfiler()
+{
+    stop();
+}
+
+void CLKernelProfiler::start()
+{
+    ARM_COMPUTE_ERROR_ON(_real_function != nullptr);
+
+    // Kernel events only hold timings on queues created with profiling enabled
+    cl::CommandQueue            queue = CLScheduler::get().queue();
+    cl_command_queue_properties props = queue.getInfo<CL_QUEUE_PROPERTIES>();
+    if ((props & CL_QUEUE_PROFILING_ENABLE) == 0)
+    {
+        queue.finish();
+        CLScheduler::get().set_queue(cl::CommandQueue(CLScheduler::get().context(), CLKernelLibrary::get().get_device(),
+                                                      props | CL_QUEUE_PROFILING_ENABLE));
+    }
+
+    _real_function   = CLSymbols::get().clEnqueueNDRangeKernel_ptr;
+    auto interceptor = [this](cl_command_queue command_queue, cl_kernel kernel, cl_uint work_dim, const size_t *gwo,
+                              const size_t *gws, const size_t *lws, cl_uint num_events_in_wait_list,
+                              const cl_event *event_wait_list, cl_event *event)
+    {
+        const int profile = current_profile;
+        if (profile < 0)
+        {
+            return _real_function(command_queue, kernel, work_dim, gwo, gws, lws, num_events_in_wait_list,
+                                  event_wait_list, event);
+        }
+
+        cl_event     tmp    = nullptr;
+        const cl_int retval = _real_function(command_queue, kernel, work_dim, gwo, gws, lws, num_events_in_wait_list,
+                                             event_wait_list, &tmp);
+        if (retval != CL_SUCCESS)
+        {
+            return retval;
+        }
+
+        std::stringstream ss;
+        ss << cl::Kernel(kernel, true).getInfo<CL_KERNEL_FUNCTION_NAME>();
+        if (gws != nullptr)
+        {
+            ss << " GWS[" << gws[0] << "," << (work_dim > 1 ? gws[1] : 1) << "," << (work_dim > 2 ? gws[2] : 1) << "]";
+        }
+        if (lws != nullptr)
+        {
+            ss << " LWS[" << lws[0] << "," << (work_dim > 1 ? lws[1] : 1) << "," << (work_dim > 2 ? lws[2] : 1) << "]";
+        }
+        if (event != nullptr)
+        {
+            // Return the event of the intercepted call
+            clRetainEvent(tmp);
+            *event = tmp;
+        }
+
+        std::lock_guard<std::mutex> lock(_mtx);
+        _events.push_back(KernelEvent{profile, ss.str(), cl::Event(tmp)});
+        return retval;
+    };
+    CLSymbols::get().clEnqueueNDRangeKernel_ptr = interceptor;
+}
+
+void CLKernelProfiler::stop()
+{
+    if (_real_function != nullptr)
+    {
+        CLSymbols::get().clEnqueueNDRangeKernel_ptr = _real_function;
+        _real_function                              = nullptr;
+    }
+}
+
+void CLKernelProfiler::set_current_profile(int profile)
+{
+    current_profile = profile;
+}
+
+void CLKernelProfiler::collect(Clock::time_point origin, std::vector<NodeProfile> &profiles)
+{
+    // The device and host clocks are not in sync: use a marker enqueued now as a common reference
+    cl::Event         marker;
+    cl_ulong          device_now = 0;
+    Clock::time_point host_now   = Clock::now();
+    cl::CommandQueue  queue      = CLScheduler::get().queue();
+    queue.enqueueMarker(&marker);
+    queue.finish();
+    if (marker.getProfilingInfo(CL_PROFILING_COMMAND_QUEUED, &device_now) != CL_SUCCESS)
+    {
+        ARM_COMPUTE_LOG_GRAPH_WARNING("Kernel timings are not available, the queue has no profiling enabled"
+                                      << std::endl);
+        _events.clear();
+        return;
+    }
+    const double host_now_us = std::chrono::duration<double, std::micro>(host_now - origin).count();
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    for (auto &kernel_event : _events)
+    {
+        cl_ulong start = 0;
+        cl_ulong end   = 0;
+        if (kernel_event.event.wait() != CL_SUCCESS ||
+            kernel_event.event.getProfilingInfo(CL_PROFILING_COMMAND_START, &start) != CL_SUCCESS ||
+            kernel_event.event.getProfilingInfo(CL_PROFILING_COMMAND_END, &end) != CL_SUCCESS ||
+            kernel_event.profile >= static_cast<int>(profiles.size()))
+        {
+            continue;
+        }
+
+        KernelProfile kernel;
+        kernel.name     = kernel_event.name;
+        kernel.start_us = host_now_us + (static_cast<double>(start) - static_cast<double>(device_now)) / 1000.0;
+        kernel.end_us   = host_now_us + (static_cast<double>(end) - static_cast<double>(device_now)) / 1000.0;
+        profiles[kernel_event.profile].kernels.push_back(std::move(kernel));
+    }
+    _events.clear();
+}
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
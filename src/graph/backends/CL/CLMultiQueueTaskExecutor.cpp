@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/backends/CL/CLMultiQueueTaskExecutor.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+namespace
+{
+/** Restores the scheduler's queue and releases the task events at the end of a run, including on failure */
+struct RunScope
+{
+    RunScope(cl::CommandQueue queue, std::size_t num_tasks) : main_queue(std::move(queue)), events(num_tasks, nullptr)
+    {
+    }
+    ~RunScope()
+    {
+        CLScheduler::get().set_queue(main_queue);
+        for (auto &event : events)
+        {
+            if (event != nullptr)
+            {
+                clReleaseEvent(event);
+            }
+        }
+    }
+
+    cl::CommandQueue      main_queue;
+    std::vector<cl_event> events;
+};
+
+/** Makes a queue wait for events enqueued on other queues */
+void enqueue_wait(cl::CommandQueue &queue, const std::vector<cl_event> &events)
+{
+    if (events.empty())
+    {
+        return;
+    }
+    if (clEnqueueBarrierWithWaitList(queue(), static_cast<cl_uint>(events.size()), events.data(), nullptr) !=
+        CL_SUCCESS)
+    {
+        // Order the commands on the host instead
+        clWaitForEvents(static_cast<cl_uint>(events.size()), events.data());
+    }
+}
+
+/** Enqueues a marker signalling the completion of the commands already enqueued on a queue */
+cl_event enqueue_marker(cl::CommandQueue &queue)
+{
+    cl_event event = nullptr;
+    if (clEnqueueMarkerWithWaitList(queue(), 0, nullptr, &event) != CL_SUCCESS)
+    {
+        queue.finish();
+        return nullptr;
+    }
+    // The waiting queues can only make progress once the marker is submitted to the device
+    queue.flush();
+    return event;
+}
+} // namespace
+
+CLMultiQueueTaskExecutor::CLMultiQueueTaskExecutor(unsigned int num_queues)
+    : _queues(), _task_queue(), _waits(), _needs_event()
+{
+    ARM_COMPUTE_ERROR_ON(num_queues == 0);
+
+    const cl::Device &device = CLKernelLibrary::get().get_device();
+    if (num_queues > 1 && get_cl_version(device) < CLVersion::CL12)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Concurrent command queues require OpenCL 1.2, enqueueing sequentially"
+                                   << std::endl);
+        num_queues = 1;
+    }
+
+    // The first queue is the scheduler's one, fetched at every run as it can be replaced
+    _queues.resize(num_queues);
+    const cl::CommandQueue &main_queue = CLScheduler::get().queue();
+    for (unsigned int i = 1; i < num_queues; ++i)
+    {
+        _queues[i] = cl::CommandQueue(CLScheduler::get().context(), device,
+                                      main_queue.getInfo<CL_QUEUE_PROPERTIES>());
+    }
+}
+
+unsigned int CLMultiQueueTaskExecutor::num_queues() const
+{
+    return static_cast<unsigned int>(_queues.size());
+}
+
+void CLMultiQueueTaskExecutor::assign_queues(const ExecutionWorkload &workload)
+{
+    const auto               predecessors = detail::extract_task_predecessors(workload);
+    const std::size_t        num_tasks    = workload.tasks.size();
+    const std::size_t        no_task      = num_tasks;
+    std::vector<std::size_t> last_task(_queues.size(), no_task);
+    unsigned int             next_queue = 0;
+
+    _task_queue.assign(num_tasks, 0);
+    _waits.assign(num_tasks, {});
+    _needs_event.assign(num_tasks, false);
+    for (std::size_t i = 0; i < num_tasks; ++i)
+    {
+        // Continue the queue of a predecessor which was the last task enqueued on it, e.g. the previous node of a
+        // chain, otherwise start a new branch on the next queue
+        auto it = std::find_if(predecessors[i].begin(), predecessors[i].end(),
+                               [&](std::size_t p) { return last_task[_task_queue[p]] == p; });
+        unsigned int queue = 0;
+        if (it != predecessors[i].end())
+        {
+            queue = _task_queue[*it];
+        }
+        else
+        {
+            queue      = next_queue;
+            next_queue = (next_queue + 1) % _queues.size();
+        }
+        _task_queue[i]   = queue;
+        last_task[queue] = i;
+
+        // In-order queues already serialize the predecessors enqueued on the same queue
+        for (const auto &p : predecessors[i])
+        {
+            if (_task_queue[p] != queue)
+            {
+                _waits[i].push_back(p);
+                _needs_event[p] = true;
+            }
+        }
+    }
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Enqueueing " << num_tasks << " tasks on " << _queues.size() << " command queues"
+                                                << std::endl);
+}
+
+void CLMultiQueueTaskExecutor::run(ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr);
+
+    if (_task_queue.size() != workload.tasks.size())
+    {
+        assign_queues(workload);
+    }
+
+    // Acquire memory for the transition buffers
+    for (auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        if (mm_ctx.second.cross_group != nullptr)
+        {
+            mm_ctx.second.cross_group->acquire();
+        }
+    }
+
+    {
+        RunScope scope(CLScheduler::get().queue(), workload.tasks.size());
+        _queues[0] = scope.main_queue;
+
+        std::vector<cl_event> waits;
+        for (std::size_t i = 0; i < workload.tasks.size(); ++i)
+        {
+            cl::CommandQueue &queue = _queues[_task_queue[i]];
+
+            waits.clear();
+            for (const auto &p : _waits[i])
+            {
+                if (scope.events[p] != nullptr)
+                {
+                    waits.push_back(scope.events[p]);
+                }
+            }
+            enqueue_wait(queue, waits);
+
+            // The functions of the task enqueue their kernels on the scheduler's queue
+            CLScheduler::get().set_queue(queue);
+            workload.tasks[i]();
+
+            if (_needs_event[i])
+            {
+                scope.events[i] = enqueue_marker(queue);
+            }
+        }
+
+        // Join the other queues into the scheduler's one
+        waits.clear();
+        for (std::size_t q = 1; q < _queues.size(); ++q)
+        {
+            const cl_event event = enqueue_marker(_queues[q]);
+            if (event != nullptr)
+            {
+                waits.push_back(event);
+            }
+        }
+        enqueue_wait(scope.main_queue, waits);
+        for (auto &event : waits)
+        {
+            clReleaseEvent(event);
+        }
+    }
+
+    // Release memory for the transition buffers
+    for (auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        if (mm_ctx.second.cross_group != nullptr)
+        {
+            mm_ctx.second.cross_group->release();
+        }
+    }
+}
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
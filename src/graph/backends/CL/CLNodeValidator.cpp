@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -70,6 +70,8 @@ Status CLNodeValidator::validate(INode *node)
         case NodeType::BoundingBoxTransformLayer:
             return detail::validate_bounding_box_transform_layer<CLBoundingBoxTransform>(
                 *polymorphic_downcast<BoundingBoxTransformLayerNode *>(node));
+        case NodeType::CastLayer:
+            return detail::validate_cast_layer<CLCast>(*polymorphic_downcast<CastLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
             return detail::validate_channel_shuffle_layer<CLChannelShuffleLayer>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
@@ -92,6 +94,12 @@ Status CLNodeValidator::validate(INode *node)
         case NodeType::DetectionPostProcessLayer:
             return detail::validate_detection_post_process_layer<CPPDetectionPostProcessLayer>(
                 *polymorphic_downcast<DetectionPostProcessLayerNode *>(node));
+        case NodeType::FusedCopyProgramLayer:
+            return detail::validate_fused_copy_program_layer<CLCopyProgram>(
+                *polymorphic_downcast<FusedCopyProgramNode *>(node));
+        case NodeType::FusedElementwiseChainLayer:
+            return detail::validate_fused_elementwise_chain_layer<CLElementwiseChain>(
+                *polymorphic_downcast<FusedElementwiseChainNode *>(node));
         case NodeType::GenerateProposalsLayer:
             return detail::validate_generate_proposals_layer<CLGenerateProposalsLayer>(
                 *polymorphic_downcast<GenerateProposalsLayerNode *>(node));
@@ -136,6 +144,45 @@ Status CLNodeValidator::validate(INode *node)
             return Status{};
     }
 }
+
+bool CLNodeValidator::is_validated(const INode &node)
+{
+    // Must list the node types checked by validate()
+    switch (node.type())
+    {
+        case NodeType::ArgMinMaxLayer:
+        case NodeType::BoundingBoxTransformLayer:
+        case NodeType::CastLayer:
+        case NodeType::ChannelShuffleLayer:
+        case NodeType::ConvolutionLayer:
+        case NodeType::DepthToSpaceLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::DequantizationLayer:
+        case NodeType::DetectionOutputLayer:
+        case NodeType::DetectionPostProcessLayer:
+        case NodeType::FusedCopyProgramLayer:
+        case NodeType::FusedElementwiseChainLayer:
+        case NodeType::GenerateProposalsLayer:
+        case NodeType::L2NormalizeLayer:
+        case NodeType::NormalizePlanarYUVLayer:
+        case NodeType::PadLayer:
+        case NodeType::PermuteLayer:
+        case NodeType::PReluLayer:
+        case NodeType::PriorBoxLayer:
+        case NodeType::QuantizationLayer:
+        case NodeType::ReductionOperationLayer:
+        case NodeType::ReorgLayer:
+        case NodeType::ReshapeLayer:
+        case NodeType::ROIAlignLayer:
+        case NodeType::SliceLayer:
+        case NodeType::StridedSliceLayer:
+        case NodeType::EltwiseLayer:
+        case NodeType::UnaryEltwiseLayer:
+            return true;
+        default:
+            return false;
+    }
+}
 } // namespace backends
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/graph/backends/CL/CLTensorHandle.h"
 
+#include "arm_compute/runtime/CL/CLScheduler.h"
 #include "arm_compute/runtime/IMemoryGroup.h"
 
 namespace arm_compute
@@ -46,6 +47,28 @@ void CLTensorHandle::free()
     _tensor.allocator()->free();
 }
 
+std::function<void()> CLTensorHandle::enqueue_host_copy(void *host, bool to_handle)
+{
+    ARM_COMPUTE_ERROR_ON(host == nullptr);
+
+    // The copy is ordered with the kernels by the in-order queue, the host only waits for its event when it needs the
+    // memory again
+    cl::CommandQueue &queue = CLScheduler::get().queue();
+    const size_t      size  = _tensor.info()->total_size();
+    cl::Event         event;
+    if (to_handle)
+    {
+        queue.enqueueWriteBuffer(_tensor.cl_buffer(), CL_FALSE, 0, size, host, nullptr, &event);
+    }
+    else
+    {
+        queue.enqueueReadBuffer(_tensor.cl_buffer(), CL_FALSE, 0, size, host, nullptr, &event);
+    }
+    queue.flush();
+
+    return [event]() { event.wait(); };
+}
+
 void CLTensorHandle::manage(IMemoryGroup *mg)
 {
     if (mg != nullptr)
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/backends/NEON/NEAliasTensorHandle.h"
+
+#include "arm_compute/core/Error.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+NEAliasTensorHandle::AliasTensor::AliasTensor(arm_compute::ITensor *parent, const ITensorInfo &info)
+    : _parent(parent), _info(info)
+{
+    ARM_COMPUTE_ERROR_ON(_parent == nullptr);
+    ARM_COMPUTE_ERROR_ON(_parent->info()->has_padding() || _info.has_padding());
+    ARM_COMPUTE_ERROR_ON(_parent->info()->total_size() != _info.total_size());
+    // The parent's padding can't be extended behind the alias
+    _info.set_is_resizable(false);
+}
+
+ITensorInfo *NEAliasTensorHandle::AliasTensor::info() const
+{
+    return &_info;
+}
+
+ITensorInfo *NEAliasTensorHandle::AliasTensor::info()
+{
+    return &_info;
+}
+
+uint8_t *NEAliasTensorHandle::AliasTensor::buffer() const
+{
+    return _parent->buffer();
+}
+
+NEAliasTensorHandle::NEAliasTensorHandle(ITensorHandle *parent_handle, const ITensorInfo &info)
+    : _alias(&parent_handle->tensor(), info), _parent_handle(parent_handle)
+{
+}
+
+void NEAliasTensorHandle::allocate()
+{
+    // noop
+}
+
+void NEAliasTensorHandle::free()
+{
+    // noop
+}
+
+void NEAliasTensorHandle::manage(IMemoryGroup *mg)
+{
+    ARM_COMPUTE_UNUSED(mg);
+    // noop
+}
+
+void NEAliasTensorHandle::map(bool blocking)
+{
+    ARM_COMPUTE_UNUSED(blocking);
+}
+
+void NEAliasTensorHandle::unmap()
+{
+    // noop
+}
+
+void NEAliasTensorHandle::release_if_unused()
+{
+    // noop
+}
+
+const arm_compute::ITensor &NEAliasTensorHandle::tensor() const
+{
+    return _alias;
+}
+
+arm_compute::ITensor &NEAliasTensorHandle::tensor()
+{
+    return _alias;
+}
+
+ITensorHandle *NEAliasTensorHandle::parent_handle()
+{
+    ARM_COMPUTE_ERROR_ON(_parent_handle == nullptr);
+    return _parent_handle->parent_handle();
+}
+
+bool NEAliasTensorHandle::is_subtensor() const
+{
+    return true;
+}
+
+Target NEAliasTensorHandle::target() const
+{
+    return Target::NEON;
+}
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021,2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,24 +25,32 @@
 
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/graph/backends/BackendRegistrar.h"
+#include "arm_compute/graph/backends/NEON/NEAliasTensorHandle.h"
 #include "arm_compute/graph/backends/NEON/NEFunctionFactory.h"
 #include "arm_compute/graph/backends/NEON/NENodeValidator.h"
 #include "arm_compute/graph/backends/NEON/NESubTensorHandle.h"
 #include "arm_compute/graph/backends/NEON/NETensorHandle.h"
+#include "arm_compute/graph/backends/ValidateHelpers.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/ConvolutionLayerNode.h"
+#include "arm_compute/graph/SharedWeightsContext.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
 #include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
 #include "arm_compute/runtime/OffsetLifetimeManager.h"
+#include "arm_compute/runtime/PackedOffsetLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/Scheduler.h"
 
+#include "support/Cast.h"
+
 namespace arm_compute
 {
 namespace graph
@@ -81,19 +89,21 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         MemoryManagerContext mm_ctx;
         mm_ctx.target      = Target::NEON;
         mm_ctx.intra_mm    = create_memory_manager(MemoryManagerAffinity::Offset);
-        mm_ctx.cross_mm    = create_memory_manager(MemoryManagerAffinity::Offset);
+        mm_ctx.cross_mm    = create_memory_manager(MemoryManagerAffinity::PackedOffset);
         mm_ctx.cross_group = std::make_shared<MemoryGroup>(mm_ctx.cross_mm);
         mm_ctx.allocator   = &_allocator;
 
         ctx.insert_memory_management_ctx(std::move(mm_ctx));
     }
 
-    // Create function level weights manager
+    // Create function level weights manager, or use the one of the weights shared with other graphs
     if (ctx.weights_management_ctx(Target::NEON) == nullptr)
     {
+        const auto           &shared_weights = ctx.config().shared_weights;
         WeightsManagerContext wm_ctx;
         wm_ctx.target = Target::NEON;
-        wm_ctx.wm     = create_weights_manager();
+        wm_ctx.wm     = (shared_weights != nullptr) ? shared_weights->weights_manager(Target::NEON)
+                                                    : create_weights_manager();
 
         ctx.insert_weights_management_ctx(std::move(wm_ctx));
     }
@@ -133,6 +143,24 @@ NEDeviceBackend::create_subtensor(ITensorHandle *parent, TensorShape shape, Coor
     return std::make_unique<NESubTensorHandle>(parent, shape, coords, extend_parent);
 }
 
+std::unique_ptr<ITensorHandle> NEDeviceBackend::create_alias_tensor(ITensorHandle *parent, const Tensor &tensor)
+{
+    const TensorDescriptor &tensor_desc = tensor.desc();
+    ARM_COMPUTE_ERROR_ON(tensor_desc.target != Target::NEON);
+
+    TensorInfo info(tensor_desc.shape, 1, tensor_desc.data_type, tensor_desc.quant_info);
+    info.set_data_layout(tensor_desc.layout);
+
+    // Only dense tensors of the same size can be reinterpreted
+    if (parent == nullptr || parent->is_subtensor() || parent->tensor().info()->has_padding() ||
+        parent->tensor().info()->total_size() != info.total_size())
+    {
+        return nullptr;
+    }
+
+    return std::make_unique<NEAliasTensorHandle>(parent, info);
+}
+
 std::unique_ptr<arm_compute::IFunction> NEDeviceBackend::configure_node(INode &node, GraphContext &ctx)
 {
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Configuring CPU node with ID : " << node.id() << std::endl);
@@ -150,6 +178,58 @@ arm_compute::Status NEDeviceBackend::validate_node(INode &node)
     return NENodeValidator::validate(&node);
 }
 
+bool NEDeviceBackend::is_node_validated(const INode &node)
+{
+    return NENodeValidator::is_validated(node);
+}
+
+bool NEDeviceBackend::measured_convolution_method(INode &node, ConvolutionMethod &method)
+{
+    ARM_COMPUTE_ERROR_ON(node.assigned_target() != Target::NEON);
+
+    // Grouped convolutions are only run by the GEMM method
+    auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(&node);
+    if (conv_node->num_groups() != 1)
+    {
+        return false;
+    }
+
+    const arm_compute::ITensorInfo *input   = detail::get_backing_tensor_info(node.input(0));
+    const arm_compute::ITensorInfo *weights = detail::get_backing_tensor_info(node.input(1));
+    const arm_compute::ITensorInfo *output  = detail::get_backing_tensor_info(node.output(0));
+    if (input == nullptr || weights == nullptr || output == nullptr)
+    {
+        return false;
+    }
+
+    arm_compute::ConvolutionMethod measured = arm_compute::ConvolutionMethod::GEMM;
+    if (!NEConvolutionLayer::get_measured_convolution_method(input, weights, output, conv_node->convolution_info(),
+                                                              Size2D(1U, 1U), conv_node->fused_activation(),
+                                                              conv_node->fast_math_hint() == FastMathHint::Enabled,
+                                                              measured))
+    {
+        return false;
+    }
+
+    // The methods without a dedicated function are run by the generic convolution layer
+    switch (measured)
+    {
+        case arm_compute::ConvolutionMethod::GEMM:
+            method = ConvolutionMethod::GEMM;
+            break;
+        case arm_compute::ConvolutionMethod::DIRECT:
+            method = ConvolutionMethod::Direct;
+            break;
+        case arm_compute::ConvolutionMethod::WINOGRAD:
+            method = ConvolutionMethod::Winograd;
+            break;
+        default:
+            method = ConvolutionMethod::Default;
+            break;
+    }
+    return true;
+}
+
 std::shared_ptr<arm_compute::IMemoryManager> NEDeviceBackend::create_memory_manager(MemoryManagerAffinity affinity)
 {
     std::shared_ptr<ILifetimeManager> lifetime_mgr = nullptr;
@@ -157,6 +237,10 @@ std::shared_ptr<arm_compute::IMemoryManager> NEDeviceBackend::create_memory_mana
     {
         lifetime_mgr = std::make_shared<BlobLifetimeManager>();
     }
+    else if (affinity == MemoryManagerAffinity::PackedOffset)
+    {
+        lifetime_mgr = std::make_shared<PackedOffsetLifetimeManager>();
+    }
     else
     {
         lifetime_mgr = std::make_shared<OffsetLifetimeManager>();
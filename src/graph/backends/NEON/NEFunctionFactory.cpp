@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021,2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -113,6 +113,232 @@ std::unique_ptr<IFunction> create_normalization_layer<NENormalizationLayer, NETa
 
     return func;
 }
+
+/** Create a backend convolution function writing into a channel slice of its destination
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend convolution function honouring the row stride of its output
+ */
+std::unique_ptr<IFunction> create_channel_slice_convolution_layer(ConvolutionLayerNode &node, GraphContext &ctx)
+{
+    validate_node<NETargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType *input   = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *weights = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType *biases  = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType *output  = get_backing_tensor<NETargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(weights == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    if (is_data_type_quantized_asymmetric(input->info()->data_type()) && biases != nullptr)
+    {
+        biases->info()->set_data_type(DataType::S32);
+    }
+
+    const PadStrideInfo       conv_info = node.convolution_info();
+    const ActivationLayerInfo fused_act = node.fused_activation();
+    const bool                fast_math = node.fast_math_hint() == FastMathHint::Enabled;
+
+    // The merge stage of the assembly GEMM writes each output row at the row stride of the whole concatenation
+    auto func = std::make_unique<NEGEMMConv2d>(get_memory_manager(ctx, NETargetInfo::TargetType));
+    func->configure(input, weights, biases, output, Conv2dInfo(conv_info, Size2D(1U, 1U), fused_act, fast_math, 1U));
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Input shape: "
+                               << input->info()->tensor_shape() << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape() << " Output slice of: "
+                               << node.output(0)->handle()->parent_handle()->tensor().info()->tensor_shape()
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "") << std::endl);
+
+    return func;
+}
+
+/** Create a backend depthwise convolution function allowed to compute in BF16
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend depthwise convolution layer function
+ */
+std::unique_ptr<IFunction> create_fast_math_depthwise_convolution_layer(DepthwiseConvolutionLayerNode &node)
+{
+    validate_node<NETargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType *input   = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *weights = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType *biases  = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType *output  = get_backing_tensor<NETargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(weights == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    const PadStrideInfo       conv_info        = node.convolution_info();
+    const unsigned int        depth_multiplier = node.depth_multiplier();
+    const ActivationLayerInfo fused_act        = node.fused_activation();
+
+    // Create and configure function
+    auto func = std::make_unique<NEDepthwiseConvolutionLayer>();
+    func->configure(input, weights, biases, output, conv_info, depth_multiplier, fused_act, Size2D(1U, 1U), true);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Input shape: "
+                               << input->info()->tensor_shape() << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Depth multiplier: " << depth_multiplier << " Fast math: enabled"
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "") << std::endl);
+
+    return func;
+}
+
+/** Create a backend convolution function accumulating into its addend
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused convolution eltwise add function
+ */
+std::unique_ptr<IFunction> create_fused_convolution_eltwise_add_layer(FusedConvolutionEltwiseAddNode &node,
+                                                                      GraphContext                   &ctx)
+{
+    validate_node<NETargetInfo>(node, 4 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType *input   = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *weights = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType *biases  = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType *output  = get_backing_tensor<NETargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(weights == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    const PadStrideInfo       conv_info = node.convolution_info();
+    const ActivationLayerInfo fused_act = node.fused_activation();
+    const bool                fast_math = node.fast_math_hint() == FastMathHint::Enabled;
+
+    // The output is the addend, the convolution accumulates into it
+    Conv2dInfo info(conv_info, Size2D(1U, 1U), fused_act, fast_math, 1U);
+    info.accumulate = true;
+
+    // Create and configure function
+    auto func = std::make_unique<NEGEMMConv2d>(get_memory_manager(ctx, NETargetInfo::TargetType));
+    func->configure(input, weights, biases, output, info);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Input shape: "
+                               << input->info()->tensor_shape() << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "") << std::endl);
+
+    return func;
+}
+
+/** Create a backend convolution function pooling its output on the fly
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused convolution pooling function
+ */
+std::unique_ptr<IFunction> create_fused_convolution_pooling_layer(FusedConvolutionPoolingNode &node, GraphContext &ctx)
+{
+    validate_node<NETargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType *input   = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *weights = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType *biases  = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType *output  = get_backing_tensor<NETargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(weights == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    const ActivationLayerInfo fused_act = node.fused_activation();
+    const bool                fast_math = node.fast_math_hint() == FastMathHint::Enabled;
+    const Conv2dInfo          conv_info(node.convolution_info(), Size2D(1U, 1U), fused_act, fast_math, 1U);
+
+    // Create and configure function
+    auto func = std::make_unique<NEConvolutionPoolingLayer>(get_memory_manager(ctx, NETargetInfo::TargetType));
+    func->configure(input, weights, biases, output, conv_info, node.pooling_info());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Input shape: "
+                               << input->info()->tensor_shape() << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "") << std::endl);
+
+    return func;
+}
+
+/** Create a backend depthwise convolution function feeding a pointwise convolution on the fly
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused depthwise separable convolution function
+ */
+std::unique_ptr<IFunction>
+create_fused_depthwise_separable_convolution_layer(FusedDepthwiseSeparableConvolutionNode &node, GraphContext &ctx)
+{
+    validate_node<NETargetInfo>(node, 7 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType *input             = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *expansion_weights = get_backing_tensor<NETargetInfo>(node.input(5));
+    NETargetInfo::TensorType *expansion_biases  = get_backing_tensor<NETargetInfo>(node.input(6));
+    NETargetInfo::TensorType *depthwise_weights = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType *depthwise_biases  = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType *pointwise_weights = get_backing_tensor<NETargetInfo>(node.input(3));
+    NETargetInfo::TensorType *pointwise_biases  = get_backing_tensor<NETargetInfo>(node.input(4));
+    NETargetInfo::TensorType *output            = get_backing_tensor<NETargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(depthwise_weights == nullptr);
+    ARM_COMPUTE_ERROR_ON(pointwise_weights == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    const ActivationLayerInfo fused_act = node.fused_activation();
+    const bool                fast_math = node.fast_math_hint() == FastMathHint::Enabled;
+    const ConvolutionInfo     depthwise_info{node.depthwise_convolution_info(),
+                                             static_cast<unsigned int>(node.depth_multiplier()),
+                                             node.depthwise_activation(), Size2D(1U, 1U)};
+    const Conv2dInfo          pointwise_info(node.pointwise_convolution_info(), Size2D(1U, 1U), fused_act, fast_math,
+                                             1U);
+    const Conv2dInfo          expansion_info(PadStrideInfo(1, 1, 0, 0), Size2D(1U, 1U), node.expansion_activation(),
+                                             fast_math, 1U);
+
+    // Create and configure function
+    auto func =
+        std::make_unique<NEDepthwiseSeparableConvolutionLayer>(get_memory_manager(ctx, NETargetInfo::TargetType));
+    func->configure(input, expansion_weights, expansion_biases, depthwise_weights, depthwise_biases,
+                    pointwise_weights, pointwise_biases, output, expansion_info, depthwise_info, pointwise_info);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << (expansion_weights != nullptr
+                                       ? " Expansion weights shape: " +
+                                             to_string(expansion_weights->info()->tensor_shape())
+                                       : "")
+                               << " Depthwise weights shape: " << depthwise_weights->info()->tensor_shape()
+                               << " Pointwise weights shape: " << pointwise_weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "") << std::endl);
+
+    return func;
+}
 } // namespace detail
 
 std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &ctx)
@@ -134,12 +360,20 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
         case NodeType::BatchNormalizationLayer:
             return detail::create_batch_normalization_layer<NEBatchNormalizationLayer, NETargetInfo>(
                 *polymorphic_downcast<BatchNormalizationLayerNode *>(node));
+        case NodeType::CastLayer:
+            return detail::create_cast_layer<NECast, NETargetInfo>(*polymorphic_downcast<CastLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
             return detail::create_channel_shuffle_layer<NEChannelShuffleLayer, NETargetInfo>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
         case NodeType::ConvolutionLayer:
-            return detail::create_convolution_layer<NEConvolutionLayerFunctions, NETargetInfo>(
-                *polymorphic_downcast<ConvolutionLayerNode *>(node), ctx);
+        {
+            auto *conv_node = polymorphic_downcast<ConvolutionLayerNode *>(node);
+            if (is_channel_slice(conv_node->output(0)))
+            {
+                return detail::create_channel_slice_convolution_layer(*conv_node, ctx);
+            }
+            return detail::create_convolution_layer<NEConvolutionLayerFunctions, NETargetInfo>(*conv_node, ctx);
+        }
         case NodeType::DepthToSpaceLayer:
             return detail::create_depth_to_space_layer<NEDepthToSpaceLayer, NETargetInfo>(
                 *polymorphic_downcast<DepthToSpaceLayerNode *>(node));
@@ -150,8 +384,16 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_concatenate_layer<NEConcatenateLayer, NETargetInfo>(
                 *polymorphic_downcast<ConcatenateLayerNode *>(node));
         case NodeType::DepthwiseConvolutionLayer:
-            return detail::create_depthwise_convolution_layer<NEDepthwiseConvolutionLayer, NETargetInfo>(
-                *polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node));
+        {
+            auto *dwc_node = polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node);
+            // Only the F32 functions have a BF16 path, the quantized ones keep the common helper managing their biases
+            if (dwc_node->fast_math_hint() == FastMathHint::Enabled &&
+                dwc_node->input(0)->desc().data_type == DataType::F32)
+            {
+                return detail::create_fast_math_depthwise_convolution_layer(*dwc_node);
+            }
+            return detail::create_depthwise_convolution_layer<NEDepthwiseConvolutionLayer, NETargetInfo>(*dwc_node);
+        }
         case NodeType::DequantizationLayer:
             return detail::create_dequantization_layer<NEDequantizationLayer, NETargetInfo>(
                 *polymorphic_downcast<DequantizationLayerNode *>(node));
@@ -180,6 +422,18 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_fused_depthwise_convolution_batch_normalization_layer<NEFusedLayerTypes,
                                                                                         NETargetInfo>(
                 *polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node), ctx);
+        case NodeType::FusedConvolutionEltwiseAddLayer:
+            return detail::create_fused_convolution_eltwise_add_layer(
+                *polymorphic_downcast<FusedConvolutionEltwiseAddNode *>(node), ctx);
+        case NodeType::FusedConvolutionPoolingLayer:
+            return detail::create_fused_convolution_pooling_layer(
+                *polymorphic_downcast<FusedConvolutionPoolingNode *>(node), ctx);
+        case NodeType::FusedDepthwiseSeparableConvolutionLayer:
+            return detail::create_fused_depthwise_separable_convolution_layer(
+                *polymorphic_downcast<FusedDepthwiseSeparableConvolutionNode *>(node), ctx);
+        case NodeType::FusedElementwiseChainLayer:
+            return detail::create_fused_elementwise_chain_layer<NEElementwiseChain, NETargetInfo>(
+                *polymorphic_downcast<FusedElementwiseChainNode *>(node));
         case NodeType::L2NormalizeLayer:
             return detail::create_l2_normalize_layer<NEL2NormalizeLayer, NETargetInfo>(
                 *polymorphic_downcast<L2NormalizeLayerNode *>(node), ctx);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/graph/backends/NEON/NENodeValidator.h"
 
+#include "arm_compute/graph/backends/Utils.h"
 #include "arm_compute/graph/backends/ValidateHelpers.h"
 #include "arm_compute/graph/nodes/Nodes.h"
 #include "arm_compute/runtime/CPP/CPPFunctions.h"
@@ -54,6 +55,105 @@ struct NEUnaryEltwiseLayerFunctions
     using ExpLayer = NEExpLayer;
 };
 
+namespace
+{
+Status validate_channel_slice_convolution_layer(ConvolutionLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating ConvolutionLayer node with ID : "
+                                  << node.id() << " and Name: " << node.name() << " writing into a channel slice"
+                                  << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.num_groups() != 1, "Grouped convolutions cannot write into a channel slice");
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input   = detail::get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *weights = detail::get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *biases  = detail::get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *output  = detail::get_backing_tensor_info(node.output(0));
+
+    if (is_data_type_quantized_asymmetric(input->data_type()) && biases != nullptr)
+    {
+        biases->set_data_type(DataType::S32);
+    }
+
+    const Conv2dInfo info(node.convolution_info(), Size2D(1U, 1U), node.fused_activation(),
+                          node.fast_math_hint() == FastMathHint::Enabled, 1U);
+
+    return NEGEMMConv2d::validate(input, weights, biases, output, info);
+}
+
+Status validate_fused_convolution_eltwise_add_layer(FusedConvolutionEltwiseAddNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedConvolutionEltwiseAddLayer node with ID : "
+                                  << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input   = detail::get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *weights = detail::get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *biases  = detail::get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *output  = detail::get_backing_tensor_info(node.output(0));
+
+    Conv2dInfo info(node.convolution_info(), Size2D(1U, 1U), node.fused_activation(),
+                    node.fast_math_hint() == FastMathHint::Enabled, 1U);
+    info.accumulate = true;
+
+    return NEGEMMConv2d::validate(input, weights, biases, output, info);
+}
+
+Status validate_fused_convolution_pooling_layer(FusedConvolutionPoolingNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedConvolutionPoolingLayer node with ID : "
+                                  << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input   = detail::get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *weights = detail::get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *biases  = detail::get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *output  = detail::get_backing_tensor_info(node.output(0));
+
+    const Conv2dInfo info(node.convolution_info(), Size2D(1U, 1U), node.fused_activation(),
+                          node.fast_math_hint() == FastMathHint::Enabled, 1U);
+
+    return NEConvolutionPoolingLayer::validate(input, weights, biases, output, info, node.pooling_info());
+}
+
+Status validate_fused_depthwise_separable_convolution_layer(FusedDepthwiseSeparableConvolutionNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedDepthwiseSeparableConvolutionLayer node with ID : "
+                                  << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 7);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input             = detail::get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *expansion_weights = detail::get_backing_tensor_info(node.input(5));
+    arm_compute::ITensorInfo *expansion_biases  = detail::get_backing_tensor_info(node.input(6));
+    arm_compute::ITensorInfo *depthwise_weights = detail::get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *depthwise_biases  = detail::get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *pointwise_weights = detail::get_backing_tensor_info(node.input(3));
+    arm_compute::ITensorInfo *pointwise_biases  = detail::get_backing_tensor_info(node.input(4));
+    arm_compute::ITensorInfo *output            = detail::get_backing_tensor_info(node.output(0));
+
+    const ConvolutionInfo depthwise_info{node.depthwise_convolution_info(),
+                                         static_cast<unsigned int>(node.depth_multiplier()),
+                                         node.depthwise_activation(), Size2D(1U, 1U)};
+    const Conv2dInfo      pointwise_info(node.pointwise_convolution_info(), Size2D(1U, 1U), node.fused_activation(),
+                                         node.fast_math_hint() == FastMathHint::Enabled, 1U);
+    const Conv2dInfo      expansion_info(PadStrideInfo(1, 1, 0, 0), Size2D(1U, 1U), node.expansion_activation(),
+                                         node.fast_math_hint() == FastMathHint::Enabled, 1U);
+
+    return NEDepthwiseSeparableConvolutionLayer::validate(input, expansion_weights, expansion_biases,
+                                                          depthwise_weights, depthwise_biases, pointwise_weights,
+                                                          pointwise_biases, output, expansion_info, depthwise_info,
+                                                          pointwise_info);
+}
+} // namespace
+
 Status NENodeValidator::validate(INode *node)
 {
     if (node == nullptr)
@@ -70,13 +170,21 @@ Status NENodeValidator::validate(INode *node)
         case NodeType::BoundingBoxTransformLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
                                             "Unsupported operation : BoundingBoxTransformLayer");
+        case NodeType::CastLayer:
+            return detail::validate_cast_layer<NECast>(*polymorphic_downcast<CastLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
             return detail::validate_channel_shuffle_layer<NEChannelShuffleLayer>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
         case NodeType::ConvolutionLayer:
+        {
+            auto *conv_node = polymorphic_downcast<ConvolutionLayerNode *>(node);
+            if (is_channel_slice(conv_node->output(0)))
+            {
+                return validate_channel_slice_convolution_layer(*conv_node);
+            }
             return detail::validate_convolution_layer<NEConvolutionLayer, NEDirectConvolutionLayer,
-                                                      NEGEMMConvolutionLayer, NEWinogradConvolutionLayer>(
-                *polymorphic_downcast<ConvolutionLayerNode *>(node));
+                                                      NEGEMMConvolutionLayer, NEWinogradConvolutionLayer>(*conv_node);
+        }
         case NodeType::DepthToSpaceLayer:
             return detail::validate_depth_to_space_layer<NEDepthToSpaceLayer>(
                 *polymorphic_downcast<DepthToSpaceLayerNode *>(node));
@@ -92,6 +200,17 @@ Status NENodeValidator::validate(INode *node)
         case NodeType::DetectionPostProcessLayer:
             return detail::validate_detection_post_process_layer<NEDetectionPostProcessLayer>(
                 *polymorphic_downcast<DetectionPostProcessLayerNode *>(node));
+        case NodeType::FusedConvolutionEltwiseAddLayer:
+            return validate_fused_convolution_eltwise_add_layer(
+                *polymorphic_downcast<FusedConvolutionEltwiseAddNode *>(node));
+        case NodeType::FusedConvolutionPoolingLayer:
+            return validate_fused_convolution_pooling_layer(*polymorphic_downcast<FusedConvolutionPoolingNode *>(node));
+        case NodeType::FusedDepthwiseSeparableConvolutionLayer:
+            return validate_fused_depthwise_separable_convolution_layer(
+                *polymorphic_downcast<FusedDepthwiseSeparableConvolutionNode *>(node));
+        case NodeType::FusedElementwiseChainLayer:
+            return detail::validate_fused_elementwise_chain_layer<NEElementwiseChain>(
+                *polymorphic_downcast<FusedElementwiseChainNode *>(node));
         case NodeType::GenerateProposalsLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
                                             "Unsupported operation : GenerateProposalsLayer");
@@ -137,6 +256,43 @@ Status NENodeValidator::validate(INode *node)
             return Status{};
     }
 }
+
+bool NENodeValidator::is_validated(const INode &node)
+{
+    // Must list the node types checked by validate()
+    switch (node.type())
+    {
+        case NodeType::ArgMinMaxLayer:
+        case NodeType::CastLayer:
+        case NodeType::ChannelShuffleLayer:
+        case NodeType::ConvolutionLayer:
+        case NodeType::DepthToSpaceLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::DequantizationLayer:
+        case NodeType::DetectionOutputLayer:
+        case NodeType::DetectionPostProcessLayer:
+        case NodeType::FusedConvolutionEltwiseAddLayer:
+        case NodeType::FusedConvolutionPoolingLayer:
+        case NodeType::FusedDepthwiseSeparableConvolutionLayer:
+        case NodeType::FusedElementwiseChainLayer:
+        case NodeType::L2NormalizeLayer:
+        case NodeType::PadLayer:
+        case NodeType::PermuteLayer:
+        case NodeType::PReluLayer:
+        case NodeType::PriorBoxLayer:
+        case NodeType::QuantizationLayer:
+        case NodeType::ReductionOperationLayer:
+        case NodeType::ReorgLayer:
+        case NodeType::ReshapeLayer:
+        case NodeType::SliceLayer:
+        case NodeType::StridedSliceLayer:
+        case NodeType::EltwiseLayer:
+        case NodeType::UnaryEltwiseLayer:
+            return true;
+        default:
+            return false;
+    }
+}
 } // namespace backends
 } // namespace graph
 } // namespace arm_compute
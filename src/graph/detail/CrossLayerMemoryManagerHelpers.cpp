@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,12 +30,16 @@
 #include "arm_compute/graph/GraphManager.h"
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/Types.h"
+#include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/PackedOffsetLifetimeManager.h"
 
 #include "support/Cast.h"
 
 #include <algorithm>
+#include <limits>
 #include <map>
 
 namespace arm_compute
@@ -262,9 +266,73 @@ void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload
             {
                 // Manage and allocate tensors
                 configure_handle_lifetime(tasks_handles, hc.second);
+
+                // Report how close the packed transition memory is to the memory of the tensors alive together
+                const auto *packed_mgr =
+                    dynamic_cast<const PackedOffsetLifetimeManager *>(mm_ctx->cross_mm->lifetime_manager());
+                if (packed_mgr != nullptr)
+                {
+                    ARM_COMPUTE_LOG_GRAPH_INFO("Transition memory for target " << hc.first << " : "
+                                                                               << packed_mgr->info().size
+                                                                               << " bytes, lower bound : "
+                                                                               << packed_mgr->lower_bound_size()
+                                                                               << " bytes" << std::endl);
+                    ARM_COMPUTE_UNUSED(packed_mgr);
+                }
+            }
+        }
+    }
+}
+
+TransitionLifetimes compute_transition_lifetimes(Graph &g, GraphContext &ctx, ExecutionWorkload &workload)
+{
+    std::set<ITensorHandle *> const_tensors = get_const_handles(g);
+
+    // Only the handles of the targets with a transition manager are managed
+    auto is_managed = [&](ITensorHandle *handle)
+    {
+        MemoryManagerContext *mm_ctx = ctx.memory_management_ctx(handle->target());
+        return mm_ctx != nullptr && mm_ctx->cross_mm != nullptr && mm_ctx->cross_group != nullptr;
+    };
+
+    std::vector<TaskHandles> tasks_handles;
+    HandleCounter            handle_count;
+    for (auto &task : workload.tasks)
+    {
+        tasks_handles.push_back(get_transition_handles(ctx, task, const_tensors));
+        for (const auto &handle : tasks_handles.back().input_handles)
+        {
+            ++handle_count[handle.first];
+        }
+    }
+
+    // Follow the acquisitions and releases of configure_handle_lifetime()
+    TransitionLifetimes lifetimes;
+    for (size_t i = 0; i < tasks_handles.size(); ++i)
+    {
+        const int task_idx = static_cast<int>(i);
+        auto      acquire  = [&](const std::vector<std::pair<ITensorHandle *, IMemoryGroup *>> &handles)
+        {
+            for (const auto &handle : handles)
+            {
+                if (is_managed(handle.first) && lifetimes.find(handle.first) == std::end(lifetimes))
+                {
+                    lifetimes.emplace(handle.first, std::make_pair(task_idx, std::numeric_limits<int>::max()));
+                }
+            }
+        };
+        acquire(tasks_handles[i].input_handles);
+        acquire(tasks_handles[i].output_handles);
+
+        for (const auto &handle : tasks_handles[i].input_handles)
+        {
+            if (--handle_count[handle.first] == 0 && is_managed(handle.first))
+            {
+                lifetimes[handle.first].second = task_idx;
             }
         }
     }
+    return lifetimes;
 }
 } // namespace detail
 } // namespace graph
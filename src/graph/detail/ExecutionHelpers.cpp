@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,12 +23,35 @@
  */
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
 
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/utils/TrustedConfigure.h"
+#include "arm_compute/core/Window.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/SharedWeightsContext.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/PoolManager.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
 
 namespace arm_compute
 {
@@ -36,6 +59,314 @@ namespace graph
 {
 namespace detail
 {
+namespace
+{
+using StagingSlot = std::vector<std::unique_ptr<arm_compute::Tensor>>;
+using CopyFences  = std::vector<std::function<void()>>;
+
+/** Collects the tasks a node depends on
+ *
+ * Nodes without a task (e.g. inputs, constants or nodes optimized out) are traversed so that dependencies through
+ * them are preserved.
+ */
+void collect_predecessors(const Graph                         &g,
+                          const INode                         &node,
+                          const std::map<NodeID, std::size_t> &node_to_task,
+                          std::set<std::size_t>               &predecessors,
+                          std::set<NodeID>                    &visited)
+{
+    for (const auto &eid : node.input_edges())
+    {
+        const Edge *e = g.edge(eid);
+        if (e == nullptr || e->producer() == nullptr || !visited.insert(e->producer_id()).second)
+        {
+            continue;
+        }
+        const auto it = node_to_task.find(e->producer_id());
+        if (it != node_to_task.end())
+        {
+            predecessors.insert(it->second);
+        }
+        else
+        {
+            collect_predecessors(g, *e->producer(), node_to_task, predecessors, visited);
+        }
+    }
+}
+
+/** Shared state of a pipelined execution */
+struct PipelineState
+{
+    std::mutex              mtx{};
+    std::condition_variable cv{};
+    std::deque<unsigned int> free_inputs{};      /**< Input staging slots available to the input accessors */
+    std::deque<unsigned int> ready_inputs{};     /**< Input staging slots ready to be computed */
+    std::deque<unsigned int> free_outputs{};     /**< Output staging slots available to the computation */
+    std::deque<unsigned int> ready_outputs{};    /**< Output staging slots ready for the output accessors */
+    bool                     inputs_done{false}; /**< The input accessors have no more data */
+    bool                     compute_done{false}; /**< No more requests will be computed */
+    bool                     stop{false};         /**< Stop the stream (output accessors request or failure) */
+    std::exception_ptr       exception{nullptr};  /**< First failure of the stream */
+};
+
+/** Runs a stage of the pipeline, stopping the stream in case of failure */
+template <typename F>
+void run_stage(PipelineState &state, F &&stage)
+{
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        stage();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(state.mtx);
+        if (state.exception == nullptr)
+        {
+            state.exception = std::current_exception();
+        }
+        state.stop = true;
+        state.cv.notify_all();
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+}
+
+/** Initializes staging copies of the given graph tensors for each slot */
+void init_staging_slots(std::vector<StagingSlot> &slots, const std::vector<Tensor *> &tensors, MemoryGroup &group)
+{
+    for (auto &slot : slots)
+    {
+        for (auto *tensor : tensors)
+        {
+            auto staging = std::make_unique<arm_compute::Tensor>();
+            if (tensor != nullptr && tensor->handle() != nullptr)
+            {
+                staging->allocator()->init(TensorInfo(*tensor->handle()->tensor().info()));
+                group.manage(staging.get());
+            }
+            slot.push_back(std::move(staging));
+        }
+    }
+    // All the staging tensors are alive at the same time
+    for (auto &slot : slots)
+    {
+        for (auto &staging : slot)
+        {
+            if (staging->info()->total_size() != 0)
+            {
+                staging->allocator()->allocate();
+            }
+        }
+    }
+}
+
+/** Calls the accessors of the given graph tensors on a staging slot */
+bool call_staging_accessors(const std::vector<Tensor *> &tensors, StagingSlot &slot)
+{
+    bool is_valid = true;
+    for (size_t i = 0; i < tensors.size(); ++i)
+    {
+        const bool valid = (tensors[i] != nullptr) && (tensors[i]->accessor() != nullptr) &&
+                           (slot[i]->buffer() != nullptr) && tensors[i]->accessor()->access_tensor(*slot[i]);
+        is_valid = is_valid && valid;
+    }
+    return is_valid;
+}
+
+/** Copies data between graph tensors and a staging slot
+ *
+ * Backends with an asynchronous queue only enqueue the copies: the staging slot must not be accessed until the
+ * returned fences have been waited for. Other backends copy through a blocking map, after synchronizing the backends
+ * when reading back outputs.
+ *
+ * @return The fences of the copies left in flight
+ */
+CopyFences copy_staging_slot(const std::vector<Tensor *> &tensors, StagingSlot &slot, bool to_graph)
+{
+    CopyFences fences;
+    bool       synced = to_graph;
+    for (size_t i = 0; i < tensors.size(); ++i)
+    {
+        if (tensors[i] == nullptr || tensors[i]->handle() == nullptr)
+        {
+            continue;
+        }
+        ITensorHandle *handle = tensors[i]->handle();
+        ARM_COMPUTE_ERROR_ON(slot[i]->info()->total_size() != handle->tensor().info()->total_size());
+        auto fence = handle->enqueue_host_copy(slot[i]->buffer(), to_graph);
+        if (fence)
+        {
+            fences.push_back(std::move(fence));
+            continue;
+        }
+        if (!synced)
+        {
+            sync_backends();
+            synced = true;
+        }
+        handle->map(true);
+        ITensor      &tensor = handle->tensor();
+        const size_t  size   = tensor.info()->total_size();
+        if (to_graph)
+        {
+            std::memcpy(tensor.buffer(), slot[i]->buffer(), size);
+        }
+        else
+        {
+            std::memcpy(slot[i]->buffer(), tensor.buffer(), size);
+        }
+        handle->unmap();
+    }
+    return fences;
+}
+
+/** Waits for the copies of a staging slot left in flight */
+void wait_copy_fences(CopyFences &fences)
+{
+    for (auto &fence : fences)
+    {
+        fence();
+    }
+    fences.clear();
+}
+
+/** Wrapper mapping the tensors a CPU function accesses on another target around its execution */
+class CrossTargetFunction final : public IFunction
+{
+public:
+    /** Constructor
+     *
+     * @param[in] func    Function to wrap
+     * @param[in] handles Handles of the tensors to map
+     */
+    CrossTargetFunction(std::unique_ptr<IFunction> func, std::vector<ITensorHandle *> handles)
+        : _func(std::move(func)), _handles(std::move(handles))
+    {
+    }
+    void run() override
+    {
+        map_handles();
+        _func->run();
+        unmap_handles();
+    }
+    void prepare() override
+    {
+        map_handles();
+        _func->prepare();
+        unmap_handles();
+    }
+
+private:
+    void map_handles()
+    {
+        for (auto &handle : _handles)
+        {
+            handle->map(true);
+        }
+    }
+    void unmap_handles()
+    {
+        for (auto &handle : _handles)
+        {
+            handle->unmap();
+        }
+    }
+
+    std::unique_ptr<IFunction>   _func;
+    std::vector<ITensorHandle *> _handles;
+};
+
+/** Collects the handles of the tensors a node accesses which do not belong to its target */
+std::vector<ITensorHandle *> collect_cross_target_handles(const INode &node)
+{
+    std::vector<ITensorHandle *> handles;
+    auto add_handle = [&](Tensor *tensor)
+    {
+        ITensorHandle *handle = (tensor != nullptr) ? tensor->handle() : nullptr;
+        if (handle != nullptr && handle->target() != node.assigned_target() &&
+            std::find(handles.begin(), handles.end(), handle) == handles.end())
+        {
+            handles.push_back(handle);
+        }
+    };
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        add_handle(node.input(i));
+    }
+    for (size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        add_handle(node.output(i));
+    }
+    return handles;
+}
+
+/** Copies a host tensor into a mapped tensor of the same shape, row by row as their paddings can differ */
+void copy_rows(const ITensor &src, ITensor &dst)
+{
+    Window win;
+    win.use_tensor_dimensions(src.info()->tensor_shape(), Window::DimY);
+    Iterator     in(&src, win);
+    Iterator     out(&dst, win);
+    const size_t row_size = src.info()->dimension(0) * src.info()->element_size();
+    execute_window_loop(
+        win, [&](const Coordinates &) { std::memcpy(out.ptr(), in.ptr(), row_size); }, in, out);
+}
+} // namespace
+
+/** Const tensors filled on host staging copies by worker threads */
+struct ConstTensorUpload
+{
+    /** Destructor, the threads and the copies are waited for in case the upload is abandoned */
+    ~ConstTensorUpload()
+    {
+        join();
+        wait_copy_fences(fences);
+    }
+    /** Waits for the worker threads to fill all the staging copies */
+    void join()
+    {
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+        workers.clear();
+    }
+    /** Fills the staging copies left until there are none, called by each worker thread */
+    void fill()
+    {
+        for (size_t i = next++; i < tensors.size(); i = next++)
+        {
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            try
+            {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+                staging[i]->allocator()->allocate();
+                tensors[i]->accessor()->access_tensor(*staging[i]);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (exception == nullptr)
+                {
+                    exception = std::current_exception();
+                }
+            }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        }
+    }
+
+    std::vector<Tensor *>    tensors{};           /**< Const tensors being uploaded */
+    StagingSlot              staging{};           /**< Host staging copy of each const tensor */
+    std::vector<std::thread> workers{};           /**< Threads calling the accessors */
+    std::atomic<size_t>      next{0};             /**< Index of the next staging copy to fill */
+    CopyFences               fences{};            /**< Uploads left in flight */
+    std::mutex               mtx{};               /**< Protects the exception */
+    std::exception_ptr       exception{nullptr};  /**< First failure of the accessors */
+};
+
 void validate_all_nodes(Graph &g)
 {
     auto &nodes = g.nodes();
@@ -70,6 +401,43 @@ void configure_all_tensors(Graph &g)
     }
 }
 
+void share_const_tensors(Graph &g, SharedWeightsContext &shared_weights)
+{
+    // Constants are matched by name, which has to identify a single node of the graph
+    std::map<std::string, unsigned int> num_nodes_per_name;
+    for (auto &node_id : g.nodes(NodeType::Const))
+    {
+        ++num_nodes_per_name[g.node(node_id)->name()];
+    }
+
+    for (auto &node_id : g.nodes(NodeType::Const))
+    {
+        INode  *node   = g.node(node_id);
+        Tensor *tensor = node->output(0);
+        if (node->name().empty() || num_nodes_per_name[node->name()] != 1 || tensor == nullptr ||
+            tensor->bound_edges().empty() || tensor->handle() == nullptr || tensor->handle()->is_subtensor())
+        {
+            continue;
+        }
+
+        bool                           is_owner = false;
+        std::unique_ptr<ITensorHandle> handle   = shared_weights.share_tensor(node->name(), *tensor, is_owner);
+        if (handle == nullptr)
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Not sharing the const node " << node->name()
+                                                                        << " as its descriptor doesn't match\n");
+            continue;
+        }
+
+        tensor->set_handle(std::move(handle));
+        if (!is_owner)
+        {
+            // The shared tensor is already filled
+            tensor->extract_accessor();
+        }
+    }
+}
+
 void allocate_all_input_tensors(INode &node)
 {
     for (unsigned int i = 0; i < node.num_inputs(); ++i)
@@ -96,6 +464,27 @@ void allocate_all_output_tensors(INode &node)
     }
 }
 
+void import_or_allocate_const_tensors(INode &node)
+{
+    for (unsigned int i = 0; i < node.num_outputs(); ++i)
+    {
+        Tensor *tensor = node.output(i);
+        if (tensor != nullptr && !tensor->bound_edges().empty())
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(!tensor->handle(), "Tensor handle is not configured!");
+
+            // Alias the accessor memory if possible to avoid a copy of the constant data
+            ITensorAccessor *accessor = tensor->accessor();
+            void            *memory   = accessor != nullptr ? accessor->import_memory(*tensor->handle()->tensor().info())
+                                                            : nullptr;
+            if (memory == nullptr || !tensor->handle()->import_memory(memory))
+            {
+                tensor->handle()->allocate();
+            }
+        }
+    }
+}
+
 void allocate_const_tensors(Graph &g)
 {
     for (auto &node : g.nodes())
@@ -105,6 +494,8 @@ void allocate_const_tensors(Graph &g)
             switch (node->type())
             {
                 case NodeType::Const:
+                    import_or_allocate_const_tensors(*node);
+                    break;
                 case NodeType::Input:
                     allocate_all_output_tensors(*node);
                     break;
@@ -131,6 +522,49 @@ void allocate_all_tensors(Graph &g)
     }
 }
 
+void add_node_task(INode &node, GraphContext &ctx, ExecutionWorkload &workload)
+{
+    Target                    assigned_target = node.assigned_target();
+    backends::IDeviceBackend &backend         = backends::BackendRegistry::get().get_backend(assigned_target);
+
+    // Only the functions the backend has validated for the node can skip validating their arguments again
+    std::unique_ptr<IFunction> func = nullptr;
+    {
+        const TrustedConfigureScope trusted_configure(is_configure_trusted() && backend.is_node_validated(node));
+        func = backend.configure_node(node, ctx);
+    }
+    if (func != nullptr && assigned_target == Target::NEON)
+    {
+        // Tensors shared with nodes on other targets are mapped while the CPU function accesses them
+        std::vector<ITensorHandle *> handles = collect_cross_target_handles(node);
+        if (!handles.empty())
+        {
+            func = std::make_unique<CrossTargetFunction>(std::move(func), std::move(handles));
+        }
+    }
+    if (func != nullptr || is_utility_node(&node))
+    {
+        workload.tasks.emplace_back(ExecutionTask(std::move(func), &node));
+    }
+}
+
+void add_workload_io_tensors(Graph &g, ExecutionWorkload &workload)
+{
+    for (auto &node : g.nodes())
+    {
+        if (node != nullptr && node->type() == NodeType::Input)
+        {
+            workload.inputs.push_back(node->output(0));
+        }
+
+        if (node != nullptr && node->type() == NodeType::Output)
+        {
+            workload.outputs.push_back(node->input(0));
+            continue;
+        }
+    }
+}
+
 ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order)
 {
     ExecutionWorkload workload;
@@ -146,31 +580,52 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
         auto node = g.node(node_id);
         if (node != nullptr)
         {
-            Target                     assigned_target = node->assigned_target();
-            backends::IDeviceBackend  &backend         = backends::BackendRegistry::get().get_backend(assigned_target);
-            std::unique_ptr<IFunction> func            = backend.configure_node(*node, ctx);
-            if (func != nullptr || is_utility_node(node))
-            {
-                workload.tasks.emplace_back(ExecutionTask(std::move(func), node));
-            }
+            add_node_task(*node, ctx, workload);
         }
     }
 
     // Add inputs and outputs
-    for (auto &node : g.nodes())
+    add_workload_io_tensors(g, workload);
+
+    return workload;
+}
+
+ExecutionWorkload configure_edited_nodes(Graph                           &g,
+                                         GraphContext                    &ctx,
+                                         const std::vector<NodeID>       &node_order,
+                                         const std::set<NodeID>          &nodes_to_configure,
+                                         std::map<NodeID, ExecutionTask> &previous_tasks)
+{
+    ExecutionWorkload workload;
+    workload.graph = &g;
+    workload.ctx   = &ctx;
+    workload.tasks.reserve(node_order.size());
+
+    for (auto &node_id : node_order)
     {
-        if (node != nullptr && node->type() == NodeType::Input)
+        auto node = g.node(node_id);
+        if (node == nullptr)
         {
-            workload.inputs.push_back(node->output(0));
+            continue;
         }
-
-        if (node != nullptr && node->type() == NodeType::Output)
+        if (nodes_to_configure.find(node_id) != std::end(nodes_to_configure))
         {
-            workload.outputs.push_back(node->input(0));
-            continue;
+            add_node_task(*node, ctx, workload);
+        }
+        else
+        {
+            // Keep the function configured and prepared for the unchanged node
+            auto previous = previous_tasks.find(node_id);
+            if (previous != std::end(previous_tasks))
+            {
+                workload.tasks.emplace_back(std::move(previous->second));
+                previous_tasks.erase(previous);
+            }
         }
     }
 
+    add_workload_io_tensors(g, workload);
+
     return workload;
 }
 
@@ -207,6 +662,89 @@ void call_all_const_node_accessors(Graph &g)
     }
 }
 
+std::shared_ptr<ConstTensorUpload> start_const_tensor_upload(Graph &g)
+{
+    auto upload = std::make_shared<ConstTensorUpload>();
+    for (auto &node : g.nodes())
+    {
+        if (node == nullptr || node->type() != NodeType::Const || node->num_outputs() == 0)
+        {
+            continue;
+        }
+        // The CPU tensors are filled in place, without a copy
+        Tensor *tensor = node->output(0);
+        if (tensor == nullptr || tensor->bound_edges().empty() || tensor->desc().target == Target::NEON ||
+            tensor->accessor() == nullptr || !tensor->accessor()->access_tensor_data() ||
+            tensor->handle() == nullptr || tensor->handle()->is_subtensor())
+        {
+            continue;
+        }
+        auto staging = std::make_unique<arm_compute::Tensor>();
+        staging->allocator()->init(TensorInfo(*tensor->handle()->tensor().info()));
+        upload->tensors.push_back(tensor);
+        upload->staging.push_back(std::move(staging));
+    }
+
+    const size_t num_threads =
+        std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1U), upload->tensors.size());
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        upload->workers.emplace_back([upload_ptr = upload.get()]() { upload_ptr->fill(); });
+    }
+    return upload;
+}
+
+void call_all_const_node_accessors(Graph &g, ConstTensorUpload &upload)
+{
+    upload.join();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    if (upload.exception != nullptr)
+    {
+        std::rethrow_exception(upload.exception);
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+    const std::set<Tensor *> staged(upload.tensors.begin(), upload.tensors.end());
+    for (auto &node : g.nodes())
+    {
+        if (node != nullptr && node->type() == NodeType::Const && node->num_outputs() &&
+            !node->output(0)->bound_edges().empty() && staged.count(node->output(0)) == 0)
+        {
+            call_tensor_accessor(node->output(0));
+        }
+    }
+
+    for (size_t i = 0; i < upload.tensors.size(); ++i)
+    {
+        ITensorHandle     *handle   = upload.tensors[i]->handle();
+        const ITensorInfo &src_info = *upload.staging[i]->info();
+        const ITensorInfo &dst_info = *handle->tensor().info();
+        // Configuring the nodes can have extended the padding of the tensor after the staging copy was created
+        if (src_info.total_size() == dst_info.total_size() &&
+            src_info.strides_in_bytes() == dst_info.strides_in_bytes() &&
+            src_info.offset_first_element_in_bytes() == dst_info.offset_first_element_in_bytes())
+        {
+            auto fence = handle->enqueue_host_copy(upload.staging[i]->buffer(), true);
+            if (fence)
+            {
+                upload.fences.push_back(std::move(fence));
+                continue;
+            }
+        }
+        handle->map(true);
+        copy_rows(*upload.staging[i], handle->tensor());
+        handle->unmap();
+        upload.staging[i]->allocator()->free();
+    }
+}
+
+void finish_const_tensor_upload(ConstTensorUpload &upload)
+{
+    wait_copy_fences(upload.fences);
+    upload.staging.clear();
+    upload.tensors.clear();
+}
+
 bool call_all_input_node_accessors(ExecutionWorkload &workload)
 {
     bool is_valid = true;
@@ -229,6 +767,29 @@ void prepare_all_tasks(ExecutionWorkload &workload)
     }
 }
 
+std::vector<std::vector<std::size_t>> extract_task_predecessors(const ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+
+    // Map nodes to their tasks
+    std::map<NodeID, std::size_t> node_to_task;
+    for (std::size_t i = 0; i < workload.tasks.size(); ++i)
+    {
+        ARM_COMPUTE_ERROR_ON(workload.tasks[i].node == nullptr);
+        node_to_task.emplace(workload.tasks[i].node->id(), i);
+    }
+
+    std::vector<std::vector<std::size_t>> predecessors(workload.tasks.size());
+    for (std::size_t i = 0; i < workload.tasks.size(); ++i)
+    {
+        std::set<std::size_t> task_predecessors;
+        std::set<NodeID>      visited;
+        collect_predecessors(*workload.graph, *workload.tasks[i].node, node_to_task, task_predecessors, visited);
+        predecessors[i].assign(task_predecessors.begin(), task_predecessors.end());
+    }
+    return predecessors;
+}
+
 void call_all_tasks(ExecutionWorkload &workload)
 {
     ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr);
@@ -272,6 +833,174 @@ bool call_all_output_node_accessors(ExecutionWorkload &workload)
 
     return is_valid;
 }
+
+void call_all_tasks_pipelined(ExecutionWorkload                              &workload,
+                              unsigned int                                    depth,
+                              const std::function<void(ExecutionWorkload &)> &run_tasks)
+{
+    ARM_COMPUTE_ERROR_ON(depth == 0);
+    ARM_COMPUTE_ERROR_ON(!run_tasks);
+
+    // Allocate the staging tensors of the in-flight requests
+    Allocator   allocator{};
+    auto        mm = std::make_shared<MemoryManagerOnDemand>(std::make_shared<BlobLifetimeManager>(),
+                                                             std::make_shared<PoolManager>());
+    MemoryGroup group(mm);
+
+    std::vector<StagingSlot> input_slots(depth);
+    std::vector<StagingSlot> output_slots(depth);
+    init_staging_slots(input_slots, workload.inputs, group);
+    init_staging_slots(output_slots, workload.outputs, group);
+    mm->populate(allocator, 1);
+    MemoryGroupResourceScope scope_mg(group);
+
+    // Copies between the staging slots and the graph tensors still in flight on the device
+    std::vector<CopyFences> input_fences(depth);
+    std::vector<CopyFences> output_fences(depth);
+
+    PipelineState state{};
+    for (unsigned int i = 0; i < depth; ++i)
+    {
+        state.free_inputs.push_back(i);
+        state.free_outputs.push_back(i);
+    }
+
+    // Input accessors stage
+    std::thread input_thread(
+        [&]()
+        {
+            run_stage(state,
+                      [&]()
+                      {
+                          std::unique_lock<std::mutex> lock(state.mtx);
+                          while (true)
+                          {
+                              state.cv.wait(lock, [&]
+                                            { return state.stop || state.compute_done || !state.free_inputs.empty(); });
+                              if (state.stop || state.compute_done)
+                              {
+                                  break;
+                              }
+                              const unsigned int slot = state.free_inputs.front();
+                              state.free_inputs.pop_front();
+                              lock.unlock();
+
+                              // The upload of the previous request of the slot may still be reading it
+                              wait_copy_fences(input_fences[slot]);
+                              const bool is_valid = call_staging_accessors(workload.inputs, input_slots[slot]);
+
+                              lock.lock();
+                              if (!is_valid)
+                              {
+                                  state.inputs_done = true;
+                                  state.cv.notify_all();
+                                  break;
+                              }
+                              state.ready_inputs.push_back(slot);
+                              state.cv.notify_all();
+                          }
+                      });
+        });
+
+    // Output accessors stage
+    std::thread output_thread(
+        [&]()
+        {
+            run_stage(state,
+                      [&]()
+                      {
+                          std::unique_lock<std::mutex> lock(state.mtx);
+                          while (true)
+                          {
+                              state.cv.wait(lock, [&]
+                                            { return state.stop || state.compute_done || !state.ready_outputs.empty(); });
+                              if (state.stop || state.ready_outputs.empty())
+                              {
+                                  break;
+                              }
+                              const unsigned int slot = state.ready_outputs.front();
+                              state.ready_outputs.pop_front();
+                              lock.unlock();
+
+                              wait_copy_fences(output_fences[slot]);
+                              const bool is_valid = call_staging_accessors(workload.outputs, output_slots[slot]);
+
+                              lock.lock();
+                              state.free_outputs.push_back(slot);
+                              state.stop = state.stop || !is_valid;
+                              state.cv.notify_all();
+                          }
+                      });
+        });
+
+    // Compute stage
+    run_stage(state,
+              [&]()
+              {
+                  std::unique_lock<std::mutex> lock(state.mtx);
+                  while (true)
+                  {
+                      state.cv.wait(lock,
+                                    [&] { return state.stop || state.inputs_done || !state.ready_inputs.empty(); });
+                      if (state.stop || state.ready_inputs.empty())
+                      {
+                          break;
+                      }
+                      const unsigned int input_slot = state.ready_inputs.front();
+                      state.ready_inputs.pop_front();
+                      lock.unlock();
+
+                      // Asynchronous uploads and readbacks are ordered with the computation by the device queue:
+                      // the next request is enqueued without waiting for this one to complete
+                      input_fences[input_slot] = copy_staging_slot(workload.inputs, input_slots[input_slot], true);
+
+                      lock.lock();
+                      state.free_inputs.push_back(input_slot);
+                      state.cv.notify_all();
+                      lock.unlock();
+
+                      run_tasks(workload);
+
+                      lock.lock();
+                      state.cv.wait(lock, [&] { return state.stop || !state.free_outputs.empty(); });
+                      if (state.stop)
+                      {
+                          break;
+                      }
+                      const unsigned int output_slot = state.free_outputs.front();
+                      state.free_outputs.pop_front();
+                      lock.unlock();
+
+                      output_fences[output_slot] =
+                          copy_staging_slot(workload.outputs, output_slots[output_slot], false);
+
+                      lock.lock();
+                      state.ready_outputs.push_back(output_slot);
+                      state.cv.notify_all();
+                  }
+              });
+
+    // Stop reading inputs and let the output accessors drain the computed requests
+    {
+        std::lock_guard<std::mutex> lock(state.mtx);
+        state.compute_done = true;
+        state.cv.notify_all();
+    }
+    input_thread.join();
+    output_thread.join();
+
+    // The staging slots are released on return, wait for the copies of a stopped stream
+    for (unsigned int i = 0; i < depth; ++i)
+    {
+        wait_copy_fences(input_fences[i]);
+        wait_copy_fences(output_fences[i]);
+    }
+
+    if (state.exception != nullptr)
+    {
+        std::rethrow_exception(state.exception);
+    }
+}
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
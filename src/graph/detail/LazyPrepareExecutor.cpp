@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/LazyPrepareExecutor.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SchedulerFactory.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+namespace
+{
+/** Release the inputs of a node that are no longer used, e.g. weights transformed while preparing it */
+void release_unused_inputs(INode &node)
+{
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        Tensor *tensor = node.input(i);
+        if (tensor != nullptr && tensor->handle() != nullptr)
+        {
+            tensor->handle()->release_if_unused();
+        }
+    }
+}
+} // namespace
+
+LazyPrepareExecutor::LazyPrepareExecutor(ExecutionWorkload &workload, unsigned int prefetch_distance)
+    : _workload(&workload), _prefetch_distance(prefetch_distance), _state(workload.tasks.size(), TaskState::Unprepared)
+{
+    ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+
+#ifdef ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    // Prepare ahead on a single thread, the CPU threads are left to the execution of the workload
+    if (_prefetch_distance > 0 && !_state.empty())
+    {
+        _thread = std::thread(&LazyPrepareExecutor::prepare_thread, this, 1U);
+    }
+#else  // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    // The scheduler cannot be used by two threads at the same time, the tasks are prepared on first use
+    _prefetch_distance = 0;
+#endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+}
+
+LazyPrepareExecutor::~LazyPrepareExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop = true;
+    }
+    _cv_request.notify_all();
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+bool LazyPrepareExecutor::is_prepared() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _num_prepared == _state.size();
+}
+
+void LazyPrepareExecutor::run(ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_ERROR_ON(&workload != _workload);
+
+    if (is_prepared())
+    {
+        call_all_tasks(workload);
+        return;
+    }
+
+    // Acquire memory for the transition buffers
+    for (auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        if (mm_ctx.second.cross_group != nullptr)
+        {
+            mm_ctx.second.cross_group->acquire();
+        }
+    }
+
+    // Execute tasks, preparing them on first use
+    for (std::size_t i = 0; i < workload.tasks.size(); ++i)
+    {
+        ensure_prepared(i);
+        workload.tasks[i]();
+    }
+
+    // Release memory for the transition buffers
+    for (auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        if (mm_ctx.second.cross_group != nullptr)
+        {
+            mm_ctx.second.cross_group->release();
+        }
+    }
+}
+
+std::size_t LazyPrepareExecutor::find_unprepared(std::size_t end) const
+{
+    std::size_t task_id = _first_unprepared;
+    while (task_id < end && _state[task_id] != TaskState::Unprepared)
+    {
+        ++task_id;
+    }
+    return task_id;
+}
+
+void LazyPrepareExecutor::prepare_task(std::size_t task_id)
+{
+    ExecutionTask &task = _workload->tasks[task_id];
+    task.prepare();
+    if (task.node != nullptr)
+    {
+        release_unused_inputs(*task.node);
+    }
+}
+
+void LazyPrepareExecutor::ensure_prepared(std::size_t task_id)
+{
+    std::unique_lock<std::mutex> lock(_mtx);
+
+    // Let the prepare thread work ahead of this task
+    const std::size_t limit = std::min(_state.size(), task_id + 1 + _prefetch_distance);
+    if (limit > _limit)
+    {
+        _limit = limit;
+        _cv_request.notify_one();
+    }
+
+    if (_state[task_id] == TaskState::Preparing)
+    {
+        _cv_prepared.wait(lock, [&] { return _state[task_id] != TaskState::Preparing; });
+    }
+    if (_state[task_id] == TaskState::Prepared)
+    {
+        return;
+    }
+
+    // Not prepared ahead, prepare it now
+    _state[task_id] = TaskState::Preparing;
+    lock.unlock();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        prepare_task(task_id);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch (...)
+    {
+        lock.lock();
+        _state[task_id]   = TaskState::Unprepared;
+        _first_unprepared = std::min(_first_unprepared, task_id);
+        throw;
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+    lock.lock();
+    _state[task_id] = TaskState::Prepared;
+    ++_num_prepared;
+}
+
+void LazyPrepareExecutor::prepare_thread(unsigned int num_threads)
+{
+#ifdef ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    std::shared_ptr<IScheduler> scheduler = SchedulerFactory::create();
+    scheduler->set_num_threads(num_threads);
+    Scheduler::set(scheduler);
+#else  // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    ARM_COMPUTE_UNUSED(num_threads);
+#endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+
+    std::unique_lock<std::mutex> lock(_mtx);
+    while (true)
+    {
+        _cv_request.wait(lock, [&] { return _stop || find_unprepared(_limit) < _limit; });
+        if (_stop)
+        {
+            break;
+        }
+
+        const std::size_t task_id = find_unprepared(_limit);
+        _first_unprepared         = task_id + 1;
+        _state[task_id]           = TaskState::Preparing;
+        lock.unlock();
+
+        bool failed = false;
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            prepare_task(task_id);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch (...)
+        {
+            failed = true;
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+        lock.lock();
+        if (failed)
+        {
+            // Leave the task to the executing thread, which reports the failure, and stop working ahead
+            _state[task_id]   = TaskState::Unprepared;
+            _first_unprepared = std::min(_first_unprepared, task_id);
+            _cv_prepared.notify_all();
+            break;
+        }
+        _state[task_id] = TaskState::Prepared;
+        ++_num_prepared;
+        _cv_prepared.notify_all();
+        if (_num_prepared == _state.size())
+        {
+            break;
+        }
+    }
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/ParallelTaskExecutor.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SchedulerFactory.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+ParallelTaskExecutor::ParallelTaskExecutor(const ExecutionWorkload &workload,
+                                           unsigned int             num_branches,
+                                           unsigned int             num_threads_per_branch)
+    : _successors(workload.tasks.size()), _num_predecessors(workload.tasks.size(), 0), _threads()
+{
+    ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+    ARM_COMPUTE_ERROR_ON(num_branches == 0);
+
+    // Extract task dependencies
+    const auto predecessors = extract_task_predecessors(workload);
+    for (std::size_t i = 0; i < workload.tasks.size(); ++i)
+    {
+        for (const auto &p : predecessors[i])
+        {
+            _successors[p].push_back(i);
+        }
+        _num_predecessors[i] = static_cast<unsigned int>(predecessors[i].size());
+    }
+
+    // Spawn branch threads
+    _threads.reserve(num_branches);
+    for (unsigned int i = 0; i < num_branches; ++i)
+    {
+        _threads.emplace_back(&ParallelTaskExecutor::branch_thread, this, std::max(1U, num_threads_per_branch));
+    }
+}
+
+ParallelTaskExecutor::~ParallelTaskExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop = true;
+    }
+    _cv_ready.notify_all();
+    for (auto &t : _threads)
+    {
+        t.join();
+    }
+}
+
+unsigned int ParallelTaskExecutor::num_branches() const
+{
+    return static_cast<unsigned int>(_threads.size());
+}
+
+void ParallelTaskExecutor::run(ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr);
+    ARM_COMPUTE_ERROR_ON(workload.tasks.size() != _successors.size());
+
+    // Acquire memory for the transition buffers
+    for (auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        if (mm_ctx.second.cross_group != nullptr)
+        {
+            mm_ctx.second.cross_group->acquire();
+        }
+    }
+
+    std::exception_ptr exception = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(_mtx);
+        _workload      = &workload;
+        _pending       = _num_predecessors;
+        _num_completed = 0;
+        _num_running   = 0;
+        _exception     = nullptr;
+        _ready.clear();
+        for (std::size_t i = 0; i < _pending.size(); ++i)
+        {
+            if (_pending[i] == 0)
+            {
+                _ready.push_back(i);
+            }
+        }
+        _cv_ready.notify_all();
+
+        // Wait for all the tasks or, in case of failure, for the running ones to complete
+        _cv_done.wait(lock,
+                      [&]
+                      {
+                          return _num_completed == _pending.size() ||
+                                 (_exception != nullptr && _num_running == 0);
+                      });
+        exception = _exception;
+        _workload = nullptr;
+        _ready.clear();
+    }
+
+    // Release memory for the transition buffers
+    for (auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        if (mm_ctx.second.cross_group != nullptr)
+        {
+            mm_ctx.second.cross_group->release();
+        }
+    }
+
+    if (exception != nullptr)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+void ParallelTaskExecutor::branch_thread(unsigned int num_threads)
+{
+#ifdef ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    // Each branch owns a scheduler so that branches do not serialize on a shared thread pool
+    std::shared_ptr<IScheduler> scheduler = SchedulerFactory::create();
+    scheduler->set_num_threads(num_threads);
+    Scheduler::set(scheduler);
+#else  // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    ARM_COMPUTE_UNUSED(num_threads);
+#endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+
+    std::unique_lock<std::mutex> lock(_mtx);
+    while (true)
+    {
+        _cv_ready.wait(lock, [&] { return _stop || (!_ready.empty() && _exception == nullptr); });
+        if (_stop)
+        {
+            break;
+        }
+
+        const std::size_t task_id = _ready.front();
+        _ready.pop_front();
+        ++_num_running;
+        ExecutionTask &task = _workload->tasks[task_id];
+        lock.unlock();
+
+        std::exception_ptr exception = nullptr;
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            task();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+        lock.lock();
+        --_num_running;
+        if (exception != nullptr && _exception == nullptr)
+        {
+            _exception = exception;
+        }
+        else if (exception == nullptr)
+        {
+            complete_task(task_id);
+        }
+        _cv_done.notify_one();
+    }
+}
+
+void ParallelTaskExecutor::complete_task(std::size_t task_id)
+{
+    ++_num_completed;
+    bool has_ready = false;
+    for (const auto &s : _successors[task_id])
+    {
+        if (--_pending[s] == 0)
+        {
+            _ready.push_back(s);
+            has_ready = true;
+        }
+    }
+    if (has_ready)
+    {
+        _cv_ready.notify_all();
+    }
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
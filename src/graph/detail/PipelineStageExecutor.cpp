@@ -0,0 +1,676 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/PipelineStageExecutor.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/Workload.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SchedulerFactory.h"
+
+#include "src/runtime/SchedulerUtils.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+namespace
+{
+/** Estimates the cost of a node from the number of elements it accesses and of multiply-accumulates it computes */
+double estimate_node_cost(const INode &node)
+{
+    double num_read    = 0.;
+    double num_written = 0.;
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Tensor *input = node.input(i);
+        num_read += (input != nullptr) ? static_cast<double>(input->desc().shape.total_size()) : 0.;
+    }
+    for (size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        const Tensor *output = node.output(i);
+        num_written += (output != nullptr) ? static_cast<double>(output->desc().shape.total_size()) : 0.;
+    }
+
+    // Multiply-accumulates computed for each output element by the nodes with weights
+    double        macs_per_output = 1.;
+    const Tensor *weights         = (node.num_inputs() > 1) ? node.input(1) : nullptr;
+    const Tensor *output          = (node.num_outputs() > 0) ? node.output(0) : nullptr;
+    if (weights != nullptr && output != nullptr)
+    {
+        const TensorDescriptor &desc        = weights->desc();
+        const double            num_weights = static_cast<double>(desc.shape.total_size());
+        switch (node.type())
+        {
+            case NodeType::ConvolutionLayer:
+            case NodeType::DeconvolutionLayer:
+            case NodeType::FusedConvolutionBatchNormalizationLayer:
+            case NodeType::FusedConvolutionEltwiseAddLayer:
+            case NodeType::FusedConvolutionPoolingLayer:
+                // Weights are [kernel_x, kernel_y, IFM, OFM] in any order of their first three dimensions
+                macs_per_output = num_weights / std::max<size_t>(1U, desc.shape[3]);
+                break;
+            case NodeType::DepthwiseConvolutionLayer:
+            case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+                macs_per_output =
+                    num_weights / std::max<size_t>(1U, get_dimension_size(desc, DataLayoutDimension::CHANNEL));
+                break;
+            case NodeType::FullyConnectedLayer:
+                macs_per_output = num_weights / std::max<size_t>(1U, output->desc().shape[0]);
+                break;
+            default:
+                break;
+        }
+    }
+    return num_read + num_written * macs_per_output;
+}
+
+/** Returns the handle owning the memory a handle accesses */
+ITensorHandle *get_root_handle(ITensorHandle *handle)
+{
+    while (handle != nullptr && handle->parent_handle() != nullptr && handle->parent_handle() != handle)
+    {
+        handle = handle->parent_handle();
+    }
+    return handle;
+}
+
+/** Splits a sequence into contiguous stages minimizing the cost of the most expensive one
+ *
+ * @param[in] costs      Cost of each element of the sequence.
+ * @param[in] cuts       Sorted positions, in [1, costs.size()), where a stage can start.
+ * @param[in] num_stages Maximum number of stages.
+ *
+ * @return The position of the first element of each stage
+ */
+std::vector<size_t> split_balanced(const std::vector<double> &costs, const std::vector<size_t> &cuts, size_t num_stages)
+{
+    // Candidate stage boundaries
+    std::vector<size_t> bounds{0U};
+    bounds.insert(bounds.end(), cuts.begin(), cuts.end());
+    bounds.push_back(costs.size());
+    const size_t num_bounds = bounds.size();
+    num_stages              = std::max<size_t>(1U, std::min(num_stages, num_bounds - 1));
+
+    std::vector<double> prefix(costs.size() + 1, 0.);
+    std::partial_sum(costs.begin(), costs.end(), prefix.begin() + 1);
+
+    // cost[s][j]: lowest cost of the most expensive stage when splitting [0, bounds[j]) into s + 1 stages
+    constexpr double                 inf = std::numeric_limits<double>::infinity();
+    std::vector<std::vector<double>> cost(num_stages, std::vector<double>(num_bounds, inf));
+    std::vector<std::vector<size_t>> prev(num_stages, std::vector<size_t>(num_bounds, 0U));
+    for (size_t j = 1; j < num_bounds; ++j)
+    {
+        cost[0][j] = prefix[bounds[j]];
+    }
+    for (size_t s = 1; s < num_stages; ++s)
+    {
+        for (size_t j = s + 1; j < num_bounds; ++j)
+        {
+            for (size_t i = s; i < j; ++i)
+            {
+                const double c = std::max(cost[s - 1][i], prefix[bounds[j]] - prefix[bounds[i]]);
+                if (c < cost[s][j])
+                {
+                    cost[s][j] = c;
+                    prev[s][j] = i;
+                }
+            }
+        }
+    }
+
+    std::vector<size_t> starts(num_stages, 0U);
+    size_t              j = num_bounds - 1;
+    for (size_t s = num_stages - 1; s > 0; --s)
+    {
+        j         = prev[s][j];
+        starts[s] = bounds[j];
+    }
+    return starts;
+}
+
+/** Calls the accessor of a graph tensor on another handle of the tensor */
+bool call_accessor_on_handle(Tensor &tensor, ITensorHandle &handle)
+{
+    ITensorAccessor *accessor = tensor.accessor();
+    if (accessor == nullptr)
+    {
+        return false;
+    }
+    const bool access_data = accessor->access_tensor_data();
+    if (access_data)
+    {
+        handle.map(true);
+        if (handle.tensor().buffer() == nullptr)
+        {
+            return false;
+        }
+    }
+    const bool retval = accessor->access_tensor(handle.tensor());
+    if (access_data)
+    {
+        handle.unmap();
+    }
+    return retval;
+}
+
+/** Exchanges the handle of a graph tensor with another one */
+void swap_handle(Tensor &tensor, std::unique_ptr<ITensorHandle> &handle)
+{
+    std::unique_ptr<ITensorHandle> current = tensor.extract_handle();
+    tensor.set_handle(std::move(handle));
+    handle = std::move(current);
+}
+} // namespace
+
+PipelineStageExecutor::PipelineStageExecutor(Graph &g, const std::vector<NodeID> &node_order, unsigned int num_stages)
+    : _node_stages(), _imports(), _task_ranges(), _threads()
+{
+    ARM_COMPUTE_ERROR_ON(num_stages == 0);
+
+    // The inputs are read by the first stage, the other nodes follow in topological order
+    std::vector<INode *> sequence;
+    for (auto &node_id : node_order)
+    {
+        INode *node = g.node(node_id);
+        if (node != nullptr && node->type() == NodeType::Input)
+        {
+            sequence.push_back(node);
+        }
+    }
+    for (auto &node_id : node_order)
+    {
+        INode *node = g.node(node_id);
+        if (node != nullptr && node->type() != NodeType::Input && node->type() != NodeType::Output &&
+            node->type() != NodeType::Const)
+        {
+            sequence.push_back(node);
+        }
+    }
+
+    // A stage cannot start between two nodes writing to the same memory
+    std::map<ITensorHandle *, std::pair<size_t, size_t>> writers;
+    std::vector<double>                                  costs;
+    for (size_t pos = 0; pos < sequence.size(); ++pos)
+    {
+        costs.push_back(estimate_node_cost(*sequence[pos]));
+        for (size_t i = 0; i < sequence[pos]->num_outputs(); ++i)
+        {
+            Tensor        *output = sequence[pos]->output(i);
+            ITensorHandle *root   = (output != nullptr) ? get_root_handle(output->handle()) : nullptr;
+            if (root != nullptr)
+            {
+                auto it = writers.emplace(root, std::make_pair(pos, pos)).first;
+                it->second.second = pos;
+            }
+        }
+    }
+    std::vector<bool> blocked(sequence.size() + 1, false);
+    for (const auto &span : writers)
+    {
+        for (size_t pos = span.second.first + 1; pos <= span.second.second; ++pos)
+        {
+            blocked[pos] = true;
+        }
+    }
+    std::vector<size_t> cuts;
+    for (size_t pos = 1; pos < sequence.size(); ++pos)
+    {
+        if (!blocked[pos])
+        {
+            cuts.push_back(pos);
+        }
+    }
+
+    // Balance the estimated costs of the stages
+    const std::vector<size_t> starts = split_balanced(costs, cuts, num_stages);
+    for (size_t pos = 0; pos < sequence.size(); ++pos)
+    {
+        const auto stage = std::upper_bound(starts.begin(), starts.end(), pos) - starts.begin() - 1;
+        _node_stages.emplace(sequence[pos]->id(), static_cast<unsigned int>(stage));
+    }
+    for (auto &node_id : node_order)
+    {
+        INode *node = g.node(node_id);
+        if (node != nullptr && node->type() == NodeType::Output)
+        {
+            _node_stages.emplace(node_id, static_cast<unsigned int>(starts.size() - 1));
+        }
+    }
+    _imports.resize(starts.size());
+    _task_ranges.resize(starts.size(), std::make_pair(0U, 0U));
+
+    if (starts.size() < num_stages)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("The nodes can only be split into " << starts.size() << " pipeline stages"
+                                                                       << std::endl);
+    }
+    std::vector<size_t> bounds = starts;
+    bounds.push_back(sequence.size());
+    for (size_t stage = 0; stage + 1 < bounds.size(); ++stage)
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Pipeline stage " << stage << ": " << bounds[stage + 1] - bounds[stage]
+                                                        << " nodes, estimated cost "
+                                                        << std::accumulate(costs.begin() + bounds[stage],
+                                                                           costs.begin() + bounds[stage + 1], 0.)
+                                                        << std::endl);
+    }
+}
+
+PipelineStageExecutor::~PipelineStageExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop = true;
+    }
+    _cv.notify_all();
+    for (auto &t : _threads)
+    {
+        t.join();
+    }
+}
+
+unsigned int PipelineStageExecutor::num_stages() const
+{
+    return static_cast<unsigned int>(_imports.size());
+}
+
+ExecutionWorkload
+PipelineStageExecutor::configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order)
+{
+    // Create a copy of each tensor read by a stage from another one
+    for (auto &node_id : node_order)
+    {
+        INode *node = g.node(node_id);
+        auto   it   = _node_stages.find(node_id);
+        if (node == nullptr || it == std::end(_node_stages))
+        {
+            continue;
+        }
+        auto &imports = _imports[it->second];
+        for (size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            Tensor *input = node->input(i);
+            if (input == nullptr || input->handle() == nullptr ||
+                std::any_of(imports.begin(), imports.end(),
+                            [&](const StageImport &import) { return import.tensor == input; }))
+            {
+                continue;
+            }
+            // The constants are read-only and shared by all the stages
+            const INode *producer = nullptr;
+            for (auto &eid : input->bound_edges())
+            {
+                const Edge *e = g.edge(eid);
+                if (e != nullptr && e->tensor() == input && e->producer() != nullptr &&
+                    _node_stages.find(e->producer_id()) != std::end(_node_stages))
+                {
+                    producer = e->producer();
+                }
+            }
+            if (producer == nullptr || _node_stages.at(producer->id()) == it->second)
+            {
+                continue;
+            }
+            ARM_COMPUTE_ERROR_ON(_node_stages.at(producer->id()) > it->second);
+
+            StageImport import;
+            import.tensor   = input;
+            import.producer = _node_stages.at(producer->id());
+            import.handle   = backends::BackendRegistry::get().get_backend(input->desc().target).create_tensor(*input);
+            imports.push_back(std::move(import));
+        }
+    }
+
+    ExecutionWorkload workload;
+    workload.graph = &g;
+    workload.ctx   = &ctx;
+    workload.tasks.reserve(node_order.size());
+
+    // Configure the nodes of each stage with the copies of the stage
+    std::vector<unsigned int> task_stages;
+    for (auto &node_id : node_order)
+    {
+        INode *node = g.node(node_id);
+        auto   it   = _node_stages.find(node_id);
+        if (node == nullptr || it == std::end(_node_stages))
+        {
+            continue;
+        }
+        const unsigned int stage = it->second;
+        for (auto &import : _imports[stage])
+        {
+            swap_handle(*import.tensor, import.handle);
+        }
+        const size_t num_tasks = workload.tasks.size();
+        add_node_task(*node, ctx, workload);
+        for (auto &import : _imports[stage])
+        {
+            swap_handle(*import.tensor, import.handle);
+        }
+
+        if (workload.tasks.size() != num_tasks)
+        {
+            task_stages.push_back(stage);
+        }
+    }
+    ARM_COMPUTE_ERROR_ON(!std::is_sorted(task_stages.begin(), task_stages.end()));
+    for (unsigned int s = 0; s < num_stages(); ++s)
+    {
+        const auto range = std::equal_range(task_stages.begin(), task_stages.end(), s);
+        _task_ranges[s]  = std::make_pair(static_cast<size_t>(range.first - task_stages.begin()),
+                                         static_cast<size_t>(range.second - task_stages.begin()));
+    }
+
+    add_workload_io_tensors(g, workload);
+
+    return workload;
+}
+
+void PipelineStageExecutor::start(unsigned int num_threads_per_stage)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_threads.empty(), "The stages are already started!");
+
+    // A stage can run ahead of each of the following ones by as many requests as there are stages
+    _ring_size = std::max(2U, num_stages());
+    for (auto &imports : _imports)
+    {
+        for (auto &import : imports)
+        {
+            import.handle->allocate();
+            const ITensorInfo &info = *import.tensor->handle()->tensor().info();
+            for (unsigned int i = 0; i < _ring_size; ++i)
+            {
+                TensorInfo buffer_info(info.tensor_shape(), 1, info.data_type(), info.quantization_info());
+                buffer_info.set_data_layout(info.data_layout());
+                auto buffer = std::make_unique<arm_compute::Tensor>();
+                buffer->allocator()->init(buffer_info);
+                buffer->allocator()->allocate();
+                import.ring.push_back(std::move(buffer));
+            }
+        }
+    }
+
+    // Bind each stage to its own cores, filling the clusters one after the other
+#ifndef BARE_METAL
+    const std::vector<int> cores = scheduler_utils::affinity_cores(IScheduler::AffinityPolicy::CLUSTER_COMPACT,
+                                                                   scheduler_utils::read_core_topology());
+#else  /* BARE_METAL */
+    const std::vector<int> cores{};
+#endif /* BARE_METAL */
+    const unsigned int num_threads = std::max(1U, num_threads_per_stage);
+    _threads.reserve(num_stages());
+    for (unsigned int s = 0; s < num_stages(); ++s)
+    {
+        std::vector<int> stage_cores;
+        for (unsigned int i = 0; i < num_threads && !cores.empty(); ++i)
+        {
+            stage_cores.push_back(cores[(s * num_threads + i) % cores.size()]);
+        }
+        _threads.emplace_back(&PipelineStageExecutor::stage_thread, this, s, num_threads, std::move(stage_cores));
+    }
+}
+
+void PipelineStageExecutor::run(ExecutionWorkload &workload)
+{
+    run_frames(workload, false);
+}
+
+void PipelineStageExecutor::run_stream(ExecutionWorkload &workload)
+{
+    run_frames(workload, true);
+}
+
+void PipelineStageExecutor::run_frames(ExecutionWorkload &workload, bool call_accessors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_threads.empty(), "The stages are not started!");
+
+    std::exception_ptr exception = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(_mtx);
+        _workload       = &workload;
+        _call_accessors = call_accessors;
+        _num_frames     = call_accessors ? std::numeric_limits<unsigned int>::max() : 1U;
+        _num_finished   = 0;
+        _received.assign(num_stages(), 0U);
+        _completed.assign(num_stages(), 0U);
+        _exception = nullptr;
+        _stop_run  = false;
+        ++_generation;
+        _cv.notify_all();
+
+        _cv.wait(lock, [&] { return _num_finished == num_stages(); });
+        exception = _exception;
+        _workload = nullptr;
+    }
+
+    if (exception != nullptr)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+void PipelineStageExecutor::stage_thread(unsigned int stage, unsigned int num_threads, std::vector<int> cores)
+{
+#ifdef ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    // Each stage owns a scheduler so that the stages do not synchronize on a shared thread pool
+    std::shared_ptr<IScheduler> scheduler = SchedulerFactory::create();
+#if ARM_COMPUTE_CPP_SCHEDULER
+    if (!cores.empty())
+    {
+        scheduler->set_num_threads_with_affinity(
+            num_threads, [cores](int thread_id, int) { return cores[static_cast<size_t>(thread_id) % cores.size()]; });
+    }
+    else
+    {
+        scheduler->set_num_threads(num_threads);
+    }
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    // Only the C++ scheduler binds its threads
+    ARM_COMPUTE_UNUSED(cores);
+    scheduler->set_num_threads(num_threads);
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+    Scheduler::set(scheduler);
+#else  // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+    ARM_COMPUTE_UNUSED(num_threads, cores);
+#endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+
+    unsigned int                 generation = 0;
+    std::unique_lock<std::mutex> lock(_mtx);
+    while (true)
+    {
+        _cv.wait(lock, [&] { return _stop || _generation != generation; });
+        if (_stop)
+        {
+            break;
+        }
+        generation = _generation;
+        lock.unlock();
+
+        std::exception_ptr exception = nullptr;
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            run_stage(stage);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+        lock.lock();
+        if (exception != nullptr)
+        {
+            _exception = (_exception == nullptr) ? exception : _exception;
+            _stop_run  = true;
+        }
+        ++_num_finished;
+        _cv.notify_all();
+    }
+}
+
+void PipelineStageExecutor::run_stage(unsigned int stage)
+{
+    const bool is_last = (stage + 1 == num_stages());
+    for (unsigned int frame = 0;; ++frame)
+    {
+        // Get the next request
+        if (stage == 0)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                if (_stop_run || frame >= _num_frames)
+                {
+                    return;
+                }
+            }
+            if (_call_accessors && !call_all_input_node_accessors(*_workload))
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                _num_frames = frame;
+                _cv.notify_all();
+                return;
+            }
+        }
+        else if (!receive_imports(stage, frame))
+        {
+            return;
+        }
+
+        for (size_t i = _task_ranges[stage].first; i < _task_ranges[stage].second; ++i)
+        {
+            _workload->tasks[i]();
+        }
+
+        // Pass the request on
+        if (!send_exports(stage, frame))
+        {
+            return;
+        }
+        if (is_last && _call_accessors)
+        {
+            bool is_valid = true;
+            for (auto *output : _workload->outputs)
+            {
+                ITensorHandle *handle = (output != nullptr) ? stage_handle(output, stage) : nullptr;
+                is_valid              = (handle != nullptr) && call_accessor_on_handle(*output, *handle) && is_valid;
+            }
+            if (!is_valid)
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                _stop_run = true;
+                _cv.notify_all();
+                return;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(_mtx);
+        _completed[stage] = frame + 1;
+        _cv.notify_all();
+    }
+}
+
+bool PipelineStageExecutor::receive_imports(unsigned int stage, unsigned int frame)
+{
+    {
+        // All the stages producing the tensors of the request are done once the previous stage is
+        std::unique_lock<std::mutex> lock(_mtx);
+        _cv.wait(lock, [&] { return _stop_run || _completed[stage - 1] > frame || _num_frames <= frame; });
+        if (_stop_run || _completed[stage - 1] <= frame)
+        {
+            return false;
+        }
+    }
+
+    for (auto &import : _imports[stage])
+    {
+        import.handle->tensor().copy_from(*import.ring[frame % _ring_size]);
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    _received[stage] = frame + 1;
+    _cv.notify_all();
+    return true;
+}
+
+bool PipelineStageExecutor::send_exports(unsigned int stage, unsigned int frame)
+{
+    for (unsigned int consumer = stage + 1; consumer < num_stages(); ++consumer)
+    {
+        auto &imports = _imports[consumer];
+        if (std::none_of(imports.begin(), imports.end(),
+                         [&](const StageImport &import) { return import.producer == stage; }))
+        {
+            continue;
+        }
+
+        {
+            // Wait for the consumer to have copied in the request previously written to the buffers
+            std::unique_lock<std::mutex> lock(_mtx);
+            _cv.wait(lock, [&] { return _stop_run || _received[consumer] + _ring_size > frame; });
+            if (_stop_run)
+            {
+                return false;
+            }
+        }
+
+        for (auto &import : imports)
+        {
+            if (import.producer == stage)
+            {
+                import.ring[frame % _ring_size]->copy_from(import.tensor->handle()->tensor());
+            }
+        }
+    }
+    return true;
+}
+
+ITensorHandle *PipelineStageExecutor::stage_handle(Tensor *tensor, unsigned int stage)
+{
+    for (auto &import : _imports[stage])
+    {
+        if (import.tensor == tensor)
+        {
+            return import.handle.get();
+        }
+    }
+    return tensor->handle();
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
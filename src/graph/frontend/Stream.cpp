@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,6 +48,21 @@ void Stream::run()
     _manager.execute_graph(_g);
 }
 
+void Stream::warm_up(bool run_dummy_iteration)
+{
+    _manager.warm_up(_g, run_dummy_iteration);
+}
+
+void Stream::reshape_inputs(const std::vector<TensorShape> &input_shapes)
+{
+    _manager.reshape_inputs(_g, input_shapes);
+}
+
+void Stream::update(const std::vector<NodeID> &edited_nodes)
+{
+    _manager.update_graph(_g, edited_nodes);
+}
+
 void Stream::add_layer(ILayer &layer)
 {
     auto nid   = layer.create_layer(*this);
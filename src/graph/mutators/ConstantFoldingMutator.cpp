@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ConstantFoldingMutator.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include "src/graph/mutators/MutatorUtils.h"
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Reads the values of a tensor
+ *
+ * @param[in] tensor Tensor to read
+ *
+ * @return Values of the tensor without padding
+ */
+std::vector<uint8_t> read_values(ITensor &tensor)
+{
+    std::vector<uint8_t> values(tensor.info()->tensor_shape().total_size() * tensor.info()->element_size());
+    copy_tensor_values(tensor, values.data(), false);
+    return values;
+}
+
+/** Accessor filling a tensor with values computed when the graph was finalized */
+class ConstantAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] values Values of the tensor without padding
+     */
+    ConstantAccessor(std::vector<uint8_t> values) : _values(std::move(values))
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        ARM_COMPUTE_ERROR_ON(_values.size() !=
+                             tensor.info()->tensor_shape().total_size() * tensor.info()->element_size());
+        copy_tensor_values(tensor, _values.data(), true);
+        return true;
+    }
+
+private:
+    std::vector<uint8_t> _values;
+};
+
+/** Checks if a node can be replaced by constants
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the outputs of the node only depend on constants, or on the shape of its inputs
+ */
+bool is_foldable(const INode &node)
+{
+    const std::set<NodeType> kept_types = {NodeType::Const, NodeType::Input, NodeType::Output, NodeType::PrintLayer};
+    if (kept_types.count(node.type()) != 0 || node.num_inputs() == 0)
+    {
+        return false;
+    }
+
+    // Tensors read by the user are kept
+    for (size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        Tensor *tensor = node.output(i);
+        if (tensor == nullptr || tensor->accessor() != nullptr)
+        {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Edge *edge = node.input_edge(i);
+        if (edge == nullptr ||
+            (node.type() != NodeType::PriorBoxLayer && edge->producer()->type() != NodeType::Const))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Runs a node on the CPU backend and replaces it by constant nodes holding its outputs
+ *
+ * @param[in,out] g       Graph the node belongs to
+ * @param[in]     node    Node to fold
+ * @param[in]     backend CPU backend
+ * @param[in]     ctx     Context to configure the node with
+ *
+ * @return True if the node has been folded
+ */
+bool fold_node(Graph &g, INode &node, backends::IDeviceBackend &backend, GraphContext &ctx)
+{
+    // Create temporary CPU tensors for the inputs and outputs of the node
+    std::vector<Tensor *> tensors;
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        tensors.push_back(node.input(i));
+    }
+    for (size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        tensors.push_back(node.output(i));
+    }
+    std::sort(tensors.begin(), tensors.end());
+    tensors.erase(std::unique(tensors.begin(), tensors.end()), tensors.end());
+
+    std::vector<Target> targets;
+    for (Tensor *tensor : tensors)
+    {
+        targets.push_back(tensor->desc().target);
+        tensor->desc().target = Target::NEON;
+        tensor->set_handle(backend.create_tensor(*tensor));
+    }
+    const Target node_target = node.assigned_target();
+    node.set_assigned_target(Target::NEON);
+
+    std::unique_ptr<IFunction>        func = nullptr;
+    std::vector<std::vector<uint8_t>> outputs;
+    if (bool(backend.validate_node(node)))
+    {
+        func = backend.configure_node(node, ctx);
+    }
+    if (func != nullptr)
+    {
+        for (Tensor *tensor : tensors)
+        {
+            tensor->handle()->allocate();
+        }
+
+        // Accessors may only load their data once, so the constants read by other nodes keep a copy of it
+        for (size_t i = 0; i < node.num_inputs(); ++i)
+        {
+            Tensor *tensor = node.input(i);
+            if (node.input_edge(i)->producer()->type() == NodeType::Const && tensor->accessor() != nullptr)
+            {
+                tensor->call_accessor();
+                tensor->set_accessor(std::make_unique<ConstantAccessor>(read_values(tensor->handle()->tensor())));
+            }
+        }
+
+        func->run();
+        for (size_t i = 0; i < node.num_outputs(); ++i)
+        {
+            outputs.push_back(read_values(node.output(i)->handle()->tensor()));
+        }
+    }
+
+    // Release the temporary tensors
+    func = nullptr;
+    node.set_assigned_target(node_target);
+    for (size_t i = 0; i < tensors.size(); ++i)
+    {
+        tensors[i]->set_handle(nullptr);
+        tensors[i]->desc().target = targets[i];
+    }
+    if (outputs.empty())
+    {
+        return false;
+    }
+
+    // Replace the outputs by constants
+    const NodeParams                      params = node.common_node_params();
+    std::vector<TensorDescriptor>         descs;
+    std::vector<std::vector<NodeIdxPair>> consumers(node.num_outputs());
+    for (size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        descs.push_back(node.output(i)->desc());
+        for (const EdgeID eid : node.output(i)->bound_edges())
+        {
+            const Edge *edge = g.edge(eid);
+            consumers[i].push_back(NodeIdxPair{edge->consumer_id(), edge->consumer_idx()});
+        }
+    }
+    g.remove_node(node.id());
+
+    for (size_t i = 0; i < descs.size(); ++i)
+    {
+        if (consumers[i].empty())
+        {
+            continue;
+        }
+
+        NodeParams const_params = params;
+        if (descs.size() > 1)
+        {
+            const_params.name += "_" + std::to_string(i);
+        }
+        const NodeID const_id = GraphBuilder::add_const_node(g, const_params, descs[i],
+                                                             std::make_unique<ConstantAccessor>(std::move(outputs[i])));
+        for (const auto &consumer : consumers[i])
+        {
+            g.add_connection(const_id, 0, consumer.node_id, consumer.index);
+        }
+    }
+    return true;
+}
+
+/** Removes the nodes without a path to an output node
+ *
+ * @note Input nodes are kept as their accessors are called by the user
+ *
+ * @param[in,out] g Graph to remove the nodes from
+ *
+ * @return Number of removed nodes
+ */
+unsigned int remove_dead_nodes(Graph &g)
+{
+    const std::vector<NodeID> &outputs = g.nodes(NodeType::Output);
+    if (outputs.empty())
+    {
+        return 0;
+    }
+
+    std::set<NodeID>    alive(outputs.begin(), outputs.end());
+    std::vector<NodeID> to_visit(outputs.begin(), outputs.end());
+    while (!to_visit.empty())
+    {
+        const INode *node = g.node(to_visit.back());
+        to_visit.pop_back();
+        for (size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            const Edge *edge = node->input_edge(i);
+            if (edge != nullptr && alive.insert(edge->producer_id()).second)
+            {
+                to_visit.push_back(edge->producer_id());
+            }
+        }
+    }
+
+    unsigned int num_removed = 0;
+    for (auto &node : g.nodes())
+    {
+        if (node != nullptr && node->type() != NodeType::Input && alive.count(node->id()) == 0)
+        {
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Removing dead node with ID : " << node->id() << std::endl);
+            g.remove_node(node->id());
+            ++num_removed;
+        }
+    }
+    return num_removed;
+}
+} // namespace
+
+ConstantFoldingMutator::ConstantFoldingMutator(Target target) : _target(target)
+{
+}
+
+const char *ConstantFoldingMutator::name()
+{
+    return "ConstantFoldingMutator";
+}
+
+IGraphMutator::MutationType ConstantFoldingMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void ConstantFoldingMutator::mutate(Graph &g)
+{
+    // Constant subgraphs are only evaluated for the graphs running on the CPU backend
+    if (_target == Target::NEON && is_target_supported(Target::NEON))
+    {
+        backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(Target::NEON);
+        GraphContext              ctx;
+
+        // Folded nodes are replaced by constants, which lets their consumers be folded in turn
+        unsigned int num_folded = 0;
+        for (const NodeID id : dfs(g))
+        {
+            INode *node = g.node(id);
+            if (node != nullptr && is_foldable(*node) && fold_node(g, *node, backend, ctx))
+            {
+                ++num_folded;
+            }
+        }
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folded " << num_folded << " constant nodes" << std::endl);
+    }
+
+    const unsigned int num_removed = remove_dead_nodes(g);
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Removed " << num_removed << " dead nodes" << std::endl);
+    ARM_COMPUTE_UNUSED(num_removed);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,471 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/DataLayoutMutator.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/utils/DataLayoutUtils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Permutation converting a shape to the given data layout from the other one
+ *
+ * @param[in] layout Destination data layout
+ *
+ * @return Permutation vector
+ */
+PermutationVector permutation_to(DataLayout layout)
+{
+    return layout == DataLayout::NHWC ? PermutationVector(2U, 0U, 1U) : PermutationVector(1U, 2U, 0U);
+}
+
+/** Checks if a tensor holds images in the given layout
+ *
+ * @note Tensors of less than three dimensions have the same shape in both layouts
+ *
+ * @param[in] tensor Tensor to check
+ * @param[in] layout Data layout
+ *
+ * @return True if the tensor has at least three dimensions and the given layout
+ */
+bool is_image(const Tensor *tensor, DataLayout layout)
+{
+    return tensor != nullptr && tensor->desc().layout == layout && tensor->desc().shape.num_dimensions() > 2;
+}
+
+/** Checks if a node is a constant
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the node is a constant node
+ */
+bool is_const(const INode *node)
+{
+    return node != nullptr && node->type() == NodeType::Const;
+}
+
+/** Checks if a NCHW node can be computed in NHWC
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the node gives the same result once its tensors and parameters are converted to NHWC
+ */
+bool is_layout_agnostic(const INode &node)
+{
+    // Nodes whose parameters are expressed with DataLayoutDimension or converted by this pass
+    static const std::set<NodeType> agnostic_types = {
+        NodeType::ActivationLayer,           NodeType::BatchNormalizationLayer, NodeType::ChannelShuffleLayer,
+        NodeType::ConcatenateLayer,          NodeType::ConvolutionLayer,        NodeType::DeconvolutionLayer,
+        NodeType::DepthwiseConvolutionLayer, NodeType::DequantizationLayer,     NodeType::EltwiseLayer,
+        NodeType::FullyConnectedLayer,       NodeType::NormalizationLayer,      NodeType::PadLayer,
+        NodeType::PoolingLayer,              NodeType::PReluLayer,              NodeType::QuantizationLayer,
+        NodeType::ResizeLayer,               NodeType::SplitLayer};
+    if (agnostic_types.count(node.type()) == 0)
+    {
+        return false;
+    }
+
+    // Operands of less than three dimensions would be broadcast or concatenated along other dimensions
+    const bool is_elementwise = node.type() == NodeType::EltwiseLayer || node.type() == NodeType::PReluLayer ||
+                                node.type() == NodeType::ConcatenateLayer;
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Edge *edge = node.input_edge(i);
+        if (edge == nullptr)
+        {
+            continue;
+        }
+
+        // Constant parameters of less than three dimensions, such as biases, are left as they are
+        if (!is_image(edge->tensor(), DataLayout::NCHW) && (is_elementwise || !is_const(edge->producer())))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Checks if the functions computing a node permute or reshape its NCHW tensors
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the node has a faster path in NHWC
+ */
+bool has_nhwc_path(const INode &node)
+{
+    switch (node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::DeconvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::PoolingLayer:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Checks if computing a region of connected nodes in NHWC removes more permutes than it adds
+ *
+ * The region saves the permutes of the tensors of the nodes having a faster path in NHWC, but has to permute the
+ * non-constant tensors crossing its boundary, which are counted once whatever their number of readers.
+ *
+ * @param[in] g      Graph the region belongs to
+ * @param[in] region Nodes of the region
+ *
+ * @return True if the region has to be computed in NHWC
+ */
+bool is_conversion_profitable(Graph &g, const std::vector<NodeID> &region)
+{
+    const std::set<NodeID> members(region.begin(), region.end());
+    std::set<TensorID>     boundary;
+    size_t                 saved = 0;
+    for (const NodeID id : region)
+    {
+        const INode *node = g.node(id);
+        if (has_nhwc_path(*node))
+        {
+            saved += node->input(0)->desc().shape.total_size() + node->output(0)->desc().shape.total_size();
+        }
+        for (size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            const Edge *edge = node->input_edge(i);
+            if (edge != nullptr && members.count(edge->producer_id()) == 0 && !is_const(edge->producer()) &&
+                is_image(edge->tensor(), DataLayout::NCHW))
+            {
+                boundary.insert(edge->tensor_id());
+            }
+        }
+        for (const EdgeID eid : node->output_edges())
+        {
+            const Edge *edge = g.edge(eid);
+            if (edge != nullptr && members.count(edge->consumer_id()) == 0 &&
+                is_image(edge->tensor(), DataLayout::NCHW))
+            {
+                boundary.insert(edge->tensor_id());
+            }
+        }
+    }
+
+    size_t added = 0;
+    for (const TensorID tid : boundary)
+    {
+        added += g.tensor(tid)->desc().shape.total_size();
+    }
+    return saved > added;
+}
+
+/** Converts the layout dependent parameters of a node to NHWC
+ *
+ * @param[in,out] node Node to convert
+ */
+void convert_parameters(INode &node)
+{
+    const PermutationVector perm = permutation_to(DataLayout::NHWC);
+    switch (node.type())
+    {
+        case NodeType::PadLayer:
+        {
+            auto              *pad_node = arm_compute::utils::cast::polymorphic_downcast<PadLayerNode *>(&node);
+            const PaddingList &padding  = pad_node->padding();
+            PaddingList        converted(std::max<size_t>(padding.size(), perm.num_dimensions()), PaddingInfo(0, 0));
+            for (size_t i = 0; i < converted.size(); ++i)
+            {
+                const size_t src = i < perm.num_dimensions() ? perm[i] : i;
+                converted[i]     = src < padding.size() ? padding[src] : PaddingInfo(0, 0);
+            }
+            pad_node->set_padding(converted);
+            break;
+        }
+        case NodeType::PoolingLayer:
+        {
+            auto            *pool_node = arm_compute::utils::cast::polymorphic_downcast<PoolingLayerNode *>(&node);
+            PoolingLayerInfo info      = pool_node->pooling_info();
+            if (info.data_layout != DataLayout::UNKNOWN)
+            {
+                info.data_layout = DataLayout::NHWC;
+                pool_node->set_pooling_info(info);
+            }
+            break;
+        }
+        case NodeType::SplitLayer:
+        {
+            auto     *split_node = arm_compute::utils::cast::polymorphic_downcast<SplitLayerNode *>(&node);
+            const int num_dims   = static_cast<int>(split_node->input(0)->desc().shape.num_dimensions());
+            const int axis       = wrap_around(static_cast<int>(split_node->axis()), num_dims);
+            for (unsigned int i = 0; i < perm.num_dimensions(); ++i)
+            {
+                if (static_cast<int>(perm[i]) == axis)
+                {
+                    split_node->set_axis(i);
+                }
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+/** Removes the pairs of consecutive permute nodes cancelling each other
+ *
+ * @param[in,out] g Graph to remove the permute nodes from
+ */
+void remove_cancelling_permutes(Graph &g)
+{
+    const std::vector<NodeID> permute_ids = g.nodes(NodeType::PermuteLayer);
+    for (const NodeID id : permute_ids)
+    {
+        auto *second = arm_compute::utils::cast::polymorphic_downcast<PermuteLayerNode *>(g.node(id));
+        if (second == nullptr || second->input_edge(0) == nullptr || second->output(0) == nullptr)
+        {
+            continue;
+        }
+
+        // The first permute must only be read by the second one
+        auto *first = second->input_edge(0)->producer();
+        if (first == nullptr || first->type() != NodeType::PermuteLayer || first->output_edges().size() != 1 ||
+            first->output(0)->accessor() != nullptr || first->input_edge(0) == nullptr)
+        {
+            continue;
+        }
+
+        // The pair must give back its input tensor
+        const Edge *source_edge   = first->input_edge(0);
+        Tensor     *source_tensor = source_edge->tensor();
+        Tensor     *output_tensor = second->output(0);
+
+        const TensorShape expected(2U, 3U, 4U, 5U, 6U, 7U);
+        TensorShape       shape = expected;
+        permute(shape, arm_compute::utils::cast::polymorphic_downcast<PermuteLayerNode *>(first)->permutation_vector());
+        permute(shape, second->permutation_vector());
+        if (shape != expected || output_tensor->desc().layout != source_tensor->desc().layout ||
+            (output_tensor->accessor() != nullptr && source_tensor->accessor() != nullptr))
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Removing cancelling permute nodes with ID : " << first->id() << " and " << id
+                                                                                     << std::endl);
+
+        const NodeIdxPair              source{source_edge->producer_id(), source_edge->producer_idx()};
+        const NodeID                   first_id      = first->id();
+        const std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*second);
+        auto                           accessor      = output_tensor->extract_accessor();
+
+        g.remove_node(id);
+        g.remove_node(first_id);
+        for (const auto &driving_node : driving_nodes)
+        {
+            g.add_connection(source.node_id, source.index, driving_node.node_id, driving_node.index);
+        }
+        if (accessor != nullptr)
+        {
+            source_tensor->set_accessor(std::move(accessor));
+        }
+    }
+}
+} // namespace
+
+const char *DataLayoutMutator::name()
+{
+    return "DataLayoutMutator";
+}
+
+IGraphMutator::MutationType DataLayoutMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void DataLayoutMutator::mutate(Graph &g)
+{
+    // Group the connected nodes that can be computed in NHWC
+    std::set<NodeID> candidates;
+    for (const auto &node : g.nodes())
+    {
+        if (node != nullptr && is_layout_agnostic(*node))
+        {
+            candidates.insert(node->id());
+        }
+    }
+
+    std::set<NodeID> converted;
+    std::set<NodeID> visited;
+    for (const NodeID seed : candidates)
+    {
+        if (!visited.insert(seed).second)
+        {
+            continue;
+        }
+
+        std::vector<NodeID> region{seed};
+        for (size_t i = 0; i < region.size(); ++i)
+        {
+            const INode        *node = g.node(region[i]);
+            std::vector<NodeID> neighbours;
+            for (size_t j = 0; j < node->num_inputs(); ++j)
+            {
+                if (node->input_edge(j) != nullptr)
+                {
+                    neighbours.push_back(node->input_edge(j)->producer_id());
+                }
+            }
+            for (const EdgeID eid : node->output_edges())
+            {
+                neighbours.push_back(g.edge(eid)->consumer_id());
+            }
+            for (const NodeID neighbour : neighbours)
+            {
+                if (candidates.count(neighbour) != 0 && visited.insert(neighbour).second)
+                {
+                    region.push_back(neighbour);
+                }
+            }
+        }
+
+        if (is_conversion_profitable(g, region))
+        {
+            converted.insert(region.begin(), region.end());
+        }
+    }
+
+    if (!converted.empty())
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Computing " << converted.size() << " NCHW nodes in NHWC" << std::endl);
+
+        // Record the shapes read by the nodes left in NCHW
+        std::vector<TensorShape> original_shapes(g.tensors().size());
+        for (const auto &tensor : g.tensors())
+        {
+            if (tensor != nullptr)
+            {
+                original_shapes[tensor->id()] = tensor->desc().shape;
+            }
+        }
+
+        // Constants are loaded in the layout of their tensor, so they are converted in place
+        for (const NodeID id : g.nodes(NodeType::Const))
+        {
+            INode  *node   = g.node(id);
+            Tensor *tensor = node != nullptr ? node->output(0) : nullptr;
+            if (!is_image(tensor, DataLayout::NCHW) ||
+                std::none_of(tensor->bound_edges().begin(), tensor->bound_edges().end(), [&](const EdgeID eid)
+                             { return converted.count(g.edge(eid)->consumer_id()) != 0; }))
+            {
+                continue;
+            }
+            permute(tensor->desc().shape, permutation_to(DataLayout::NHWC));
+            tensor->desc().layout = DataLayout::NHWC;
+            converted.insert(id);
+        }
+
+        for (const NodeID id : converted)
+        {
+            convert_parameters(*g.node(id));
+        }
+
+        // Permute the tensors crossing the boundaries and propagate the converted descriptors in topological order
+        std::map<std::pair<TensorID, DataLayout>, NodeID> permutes;
+        for (const NodeID id : dfs(g))
+        {
+            INode *node = g.node(id);
+            if (node == nullptr || node->num_inputs() == 0)
+            {
+                continue;
+            }
+
+            const bool       is_converted = converted.count(id) != 0;
+            const DataLayout layout       = is_converted ? DataLayout::NHWC : DataLayout::NCHW;
+
+            std::vector<std::pair<size_t, NodeIdxPair>> inputs_to_permute;
+            for (size_t i = 0; i < node->num_inputs(); ++i)
+            {
+                const Edge *edge = node->input_edge(i);
+                if (edge == nullptr)
+                {
+                    continue;
+                }
+
+                const Tensor *tensor         = edge->tensor();
+                const bool    from_converted = converted.count(edge->producer_id()) != 0;
+                if ((is_converted && !from_converted && is_image(tensor, DataLayout::NCHW)) ||
+                    (!is_converted && from_converted && tensor->desc().shape != original_shapes[tensor->id()]))
+                {
+                    inputs_to_permute.emplace_back(i, NodeIdxPair{edge->producer_id(), edge->producer_idx()});
+                }
+            }
+
+            // Disconnect the inputs first so that descriptors are propagated once all inputs have the same layout
+            for (const auto &input : inputs_to_permute)
+            {
+                g.remove_connection(node->input_edge_id(input.first));
+            }
+            for (const auto &input : inputs_to_permute)
+            {
+                INode         *producer = g.node(input.second.node_id);
+                const TensorID tid      = producer->output_id(input.second.index);
+                auto           it       = permutes.find(std::make_pair(tid, layout));
+                if (it == permutes.end())
+                {
+                    const NodeParams params{producer->name() + "_" + string_from_data_layout(layout),
+                                            node->assigned_target()};
+                    const NodeID     permute_id =
+                        GraphBuilder::add_permute_node(g, params, input.second, permutation_to(layout), layout);
+                    it = permutes.emplace(std::make_pair(tid, layout), permute_id).first;
+                }
+                g.add_connection(it->second, 0, id, input.first);
+
+                // Output accessors read the tensor in the layout it was created with
+                if (node->type() == NodeType::Output)
+                {
+                    node->input(0)->set_accessor(g.tensor(tid)->extract_accessor());
+                }
+            }
+
+            if (is_converted)
+            {
+                node->forward_descriptors();
+            }
+        }
+    }
+
+    remove_cancelling_permutes(g);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/nodes/ConcatenateLayerNode.h"
 #include "arm_compute/graph/Utils.h"
 
@@ -37,6 +38,56 @@ namespace arm_compute
 {
 namespace graph
 {
+namespace
+{
+/** Checks if the inputs of a concatenation along the channels of NHWC tensors can be views of its output
+ *
+ * The rows of such views are strided by the channels of the whole output, only the convolutions computed by the
+ * assembly GEMM of the CPU honour this stride when writing their result. The backend validates the convolutions
+ * once they write into the views.
+ *
+ * @param[in] g    Graph the concatenation belongs to
+ * @param[in] node Concatenation node
+ *
+ * @return True if all the inputs are produced by convolutions which are their only readers
+ */
+bool are_channel_views_supported(const Graph &g, const INode &node)
+{
+    for (const auto &eid : node.input_edges())
+    {
+        const Edge  *edge     = g.edge(eid);
+        Tensor      *tensor   = edge->tensor();
+        const INode *producer = edge->producer();
+        if (producer == nullptr || producer->type() != NodeType::ConvolutionLayer ||
+            producer->assigned_target() != Target::NEON || tensor->accessor() != nullptr ||
+            tensor->bound_edges().size() != 1 || tensor->handle() == nullptr || tensor->handle()->is_subtensor())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Validates the producers of the inputs of a concatenation once they write into the views of its output
+ *
+ * @param[in] node Concatenation node
+ *
+ * @return True if all the producers are valid
+ */
+bool are_channel_views_valid(const INode &node)
+{
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        INode *producer = node.input_edge(i)->producer();
+        if (!bool(backends::BackendRegistry::get().get_backend(producer->assigned_target()).validate_node(*producer)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
 const char *DepthConcatSubTensorMutator::name()
 {
     return "DepthConcatSubTensorMutator";
@@ -67,10 +118,17 @@ void DepthConcatSubTensorMutator::mutate(Graph &g)
             // Get output tensor
             auto output_tensor = node->output(0);
 
-            // Check concatenation axis (Sub-tensor optimization is supported for concatenation axis >=2)
+            // Check concatenation axis (Sub-tensor optimization is supported for concatenation axis >=2, or for the
+            // channels of NHWC tensors produced by convolutions)
             auto *concat_node = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(node);
-            if (output_tensor == nullptr ||
-                get_dimension_idx(output_tensor->desc().layout, concat_node->concatenation_axis()) < 2)
+            if (output_tensor == nullptr)
+            {
+                continue;
+            }
+            const DataLayout layout            = output_tensor->desc().layout;
+            const size_t     concat_idx        = get_dimension_idx(layout, concat_node->concatenation_axis());
+            const bool       is_channel_concat = layout == DataLayout::NHWC && concat_idx == 0;
+            if (concat_idx < 2 && !is_channel_concat)
             {
                 continue;
             }
@@ -85,6 +143,12 @@ void DepthConcatSubTensorMutator::mutate(Graph &g)
                                        (g.edge(eid)->tensor()->desc().quant_info == output_tensor->desc().quant_info);
                             });
 
+            if (is_channel_concat)
+            {
+                is_valid = is_valid && output_tensor->desc().target == Target::NEON &&
+                           are_channel_views_supported(g, *node);
+            }
+
             // Create subtensors
             if (is_valid && is_target_supported(output_tensor->desc().target))
             {
@@ -99,11 +163,27 @@ void DepthConcatSubTensorMutator::mutate(Graph &g)
 
                     backends::IDeviceBackend &backend =
                         backends::BackendRegistry::get().get_backend(input_tensor->desc().target);
+                    const Coordinates coords = is_channel_concat ? Coordinates(depth, 0, 0) : Coordinates(0, 0, depth);
                     std::unique_ptr<ITensorHandle> handle =
-                        backend.create_subtensor(output_tensor->handle(), input_shape, Coordinates(0, 0, depth), false);
+                        backend.create_subtensor(output_tensor->handle(), input_shape, coords, false);
                     input_tensor->set_handle(std::move(handle));
 
-                    depth += input_shape.z();
+                    depth += is_channel_concat ? input_shape.x() : input_shape.z();
+                }
+
+                // Fall back to the concatenation if a convolution cannot write into its view
+                if (is_channel_concat && !are_channel_views_valid(*node))
+                {
+                    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Reverted the sub-tensors of the node with ID : " << node->id()
+                                                                                                      << std::endl);
+                    for (unsigned int i = 0; i < node->input_edges().size(); ++i)
+                    {
+                        auto                     *input_tensor = node->input(i);
+                        backends::IDeviceBackend &backend =
+                            backends::BackendRegistry::get().get_backend(input_tensor->desc().target);
+                        input_tensor->set_handle(backend.create_tensor(*input_tensor));
+                    }
+                    continue;
                 }
 
                 auto *dc_node = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(node);
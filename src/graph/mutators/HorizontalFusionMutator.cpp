@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/HorizontalFusionMutator.h"
+
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Returns the dimension of a layout stored at a given index
+ *
+ * @param[in] layout Data layout
+ * @param[in] idx    Index of the dimension
+ *
+ * @return The layout dimension
+ */
+DataLayoutDimension dimension_at(DataLayout layout, size_t idx)
+{
+    for (const auto dim : {DataLayoutDimension::WIDTH, DataLayoutDimension::HEIGHT, DataLayoutDimension::CHANNEL,
+                           DataLayoutDimension::BATCHES})
+    {
+        if (get_dimension_idx(layout, dim) == idx)
+        {
+            return dim;
+        }
+    }
+    ARM_COMPUTE_ERROR("Unsupported dimension index");
+    return DataLayoutDimension::WIDTH;
+}
+
+/** Returns the index of the dimension of the weights along the outputs of a layer */
+size_t weights_outputs_idx(const INode &node)
+{
+    if (node.type() == NodeType::ConvolutionLayer)
+    {
+        return get_dimension_idx(node.input(1)->desc().layout, DataLayoutDimension::BATCHES);
+    }
+    return arm_compute::utils::cast::polymorphic_downcast<const FullyConnectedLayerNode *>(&node)
+                   ->info()
+                   .transpose_weights
+               ? 1
+               : 0;
+}
+
+/** Returns the index of the dimension of the output of a layer along its outputs */
+size_t output_outputs_idx(const INode &node)
+{
+    if (node.type() == NodeType::ConvolutionLayer)
+    {
+        return get_dimension_idx(node.output(0)->desc().layout, DataLayoutDimension::CHANNEL);
+    }
+    return 0;
+}
+
+/** Returns the fused activation of a layer */
+ActivationLayerInfo fused_activation(const INode &node)
+{
+    if (node.type() == NodeType::ConvolutionLayer)
+    {
+        return arm_compute::utils::cast::polymorphic_downcast<const ConvolutionLayerNode *>(&node)->fused_activation();
+    }
+    return arm_compute::utils::cast::polymorphic_downcast<const FullyConnectedLayerNode *>(&node)
+        ->info()
+        .activation_info;
+}
+
+/** Checks if a layer can be fused with its siblings
+ *
+ * The layers whose output is folded into another node by the @ref NodeFusionMutator are kept as they are, as well as
+ * the pointwise convolutions reading a depthwise convolution.
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the node is a convolution or fully connected layer with constant weights
+ */
+bool is_candidate(const INode &node)
+{
+    if (node.type() != NodeType::ConvolutionLayer && node.type() != NodeType::FullyConnectedLayer)
+    {
+        return false;
+    }
+    if (node.type() == NodeType::ConvolutionLayer &&
+        arm_compute::utils::cast::polymorphic_downcast<const ConvolutionLayerNode *>(&node)->num_groups() != 1)
+    {
+        return false;
+    }
+
+    const Edge *input_edge   = node.input_edge(0);
+    const Edge *weights_edge = node.input_edge(1);
+    const Edge *bias_edge    = node.input_edge(2);
+    if (input_edge == nullptr || weights_edge == nullptr || weights_edge->producer()->type() != NodeType::Const ||
+        (bias_edge != nullptr && bias_edge->producer()->type() != NodeType::Const) || node.output(0) == nullptr)
+    {
+        return false;
+    }
+
+    // Each output gets a share of the requantization of the fused layer, which the quantized layers do not honour
+    if (is_data_type_quantized(node.output(0)->desc().data_type) ||
+        is_data_type_quantized(node.input(1)->desc().data_type))
+    {
+        return false;
+    }
+
+    const std::set<NodeType> fused_producers = {NodeType::DepthwiseConvolutionLayer, NodeType::ChannelShuffleLayer};
+    if (node.type() == NodeType::ConvolutionLayer && fused_producers.count(input_edge->producer()->type()) != 0)
+    {
+        return false;
+    }
+    const std::set<NodeType> fused_consumers = {NodeType::BatchNormalizationLayer, NodeType::EltwiseLayer,
+                                                NodeType::PoolingLayer, NodeType::ChannelShuffleLayer};
+    for (const EdgeID eid : node.output(0)->bound_edges())
+    {
+        const Edge *edge = node.graph()->edge(eid);
+        if (edge != nullptr && fused_consumers.count(edge->consumer()->type()) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Checks if two sibling layers can be computed by the same layer
+ *
+ * @param[in] a First layer
+ * @param[in] b Second layer
+ *
+ * @return True if the layers only differ by their number of outputs
+ */
+bool are_fusable(const INode &a, const INode &b)
+{
+    if (a.type() != b.type() || (a.input_edge(2) == nullptr) != (b.input_edge(2) == nullptr))
+    {
+        return false;
+    }
+
+    const TensorDescriptor &wa = a.input(1)->desc();
+    const TensorDescriptor &wb = b.input(1)->desc();
+    const size_t            n  = weights_outputs_idx(a);
+    if (wa.data_type != wb.data_type || wa.layout != wb.layout ||
+        wa.shape.num_dimensions() != wb.shape.num_dimensions() ||
+        a.output(0)->desc().data_type != b.output(0)->desc().data_type ||
+        a.output(0)->desc().layout != b.output(0)->desc().layout || !(fused_activation(a) == fused_activation(b)))
+    {
+        return false;
+    }
+    for (size_t d = 0; d < wa.shape.num_dimensions(); ++d)
+    {
+        if (d != n && wa.shape[d] != wb.shape[d])
+        {
+            return false;
+        }
+    }
+
+    if (a.type() == NodeType::ConvolutionLayer)
+    {
+        const auto         *ca = arm_compute::utils::cast::polymorphic_downcast<const ConvolutionLayerNode *>(&a);
+        const auto         *cb = arm_compute::utils::cast::polymorphic_downcast<const ConvolutionLayerNode *>(&b);
+        const PadStrideInfo pa = ca->convolution_info();
+        const PadStrideInfo pb = cb->convolution_info();
+        return pa.stride() == pb.stride() && pa.pad_left() == pb.pad_left() && pa.pad_right() == pb.pad_right() &&
+               pa.pad_top() == pb.pad_top() && pa.pad_bottom() == pb.pad_bottom() && pa.round() == pb.round() &&
+               ca->convolution_method() == cb->convolution_method() && ca->fast_math_hint() == cb->fast_math_hint();
+    }
+
+    const auto *fa = arm_compute::utils::cast::polymorphic_downcast<const FullyConnectedLayerNode *>(&a);
+    const auto *fb = arm_compute::utils::cast::polymorphic_downcast<const FullyConnectedLayerNode *>(&b);
+    const FullyConnectedLayerInfo ia = fa->info();
+    const FullyConnectedLayerInfo ib = fb->info();
+    return !ia.are_weights_reshaped && !ib.are_weights_reshaped && ia.transpose_weights == ib.transpose_weights &&
+           ia.weights_trained_layout == ib.weights_trained_layout &&
+           ia.retain_internal_weights == ib.retain_internal_weights && ia.enable_fast_math == ib.enable_fast_math &&
+           ia.sparse_weights == ib.sparse_weights && ia.block_sparse_weights == ib.block_sparse_weights &&
+           fa->fast_math_hint() == fb->fast_math_hint();
+}
+
+/** Returns the activation layer reading a layer which can be fused into it
+ *
+ * @param[in] node Layer to check
+ *
+ * @return The activation layer if it is the only reader of the layer, nullptr otherwise
+ */
+ActivationLayerNode *fusable_activation(INode &node)
+{
+    const std::set<Activation> supported_fused_activations = {
+        Activation::ABS,        Activation::BOUNDED_RELU, Activation::ELU,
+        Activation::HARD_SWISH, Activation::IDENTITY,     Activation::LEAKY_RELU,
+        Activation::LINEAR,     Activation::LOGISTIC,     Activation::LU_BOUNDED_RELU,
+        Activation::RELU,       Activation::SOFT_RELU,    Activation::SQRT,
+        Activation::SQUARE,     Activation::TANH};
+
+    Tensor *output = node.output(0);
+    if (fused_activation(node).enabled() || output->accessor() != nullptr || output->bound_edges().size() != 1)
+    {
+        return nullptr;
+    }
+    INode *consumer = node.graph()->edge(*output->bound_edges().begin())->consumer();
+    if (consumer->type() != NodeType::ActivationLayer)
+    {
+        return nullptr;
+    }
+    auto *act_node = arm_compute::utils::cast::polymorphic_downcast<ActivationLayerNode *>(consumer);
+    if (supported_fused_activations.count(act_node->activation_info().activation()) == 0 ||
+        act_node->output(0)->desc().quant_info != output->desc().quant_info)
+    {
+        return nullptr;
+    }
+    return act_node;
+}
+
+/** Replaces sibling layers by a single layer computing all their outputs
+ *
+ * @param[in,out] g     Graph the layers belong to
+ * @param[in]     group Ids of the layers to fuse, which read the same input
+ */
+void fuse_siblings(Graph &g, const std::vector<NodeID> &group)
+{
+    const INode      &first  = *g.node(group[0]);
+    const Edge       *input  = first.input_edge(0);
+    const NodeIdxPair source = {input->producer_id(), input->producer_idx()};
+    const bool        has_bias = first.input_edge(2) != nullptr;
+    const Target      target   = first.assigned_target();
+
+    NodeParams params = first.common_node_params();
+    if (!params.name.empty())
+    {
+        params.name.append("_fused");
+    }
+
+    // The activations read by all the layers are fused as well
+    std::vector<ActivationLayerNode *> activations;
+    for (const NodeID nid : group)
+    {
+        activations.push_back(fusable_activation(*g.node(nid)));
+    }
+    const bool fuse_activations =
+        std::all_of(activations.begin(), activations.end(),
+                    [&](const ActivationLayerNode *n)
+                    { return n != nullptr && n->activation_info() == activations[0]->activation_info(); });
+
+    std::vector<NodeIdxPair>              weights;
+    std::vector<NodeIdxPair>              biases;
+    std::vector<int>                      size_splits;
+    std::vector<std::vector<NodeIdxPair>> consumers;
+    std::vector<ITensorAccessorUPtr>      accessors;
+    unsigned int                          num_outputs = 0;
+    for (size_t i = 0; i < group.size(); ++i)
+    {
+        INode *node = g.node(group[i]);
+        weights.push_back({node->input_edge(1)->producer_id(), node->input_edge(1)->producer_idx()});
+        if (has_bias)
+        {
+            biases.push_back({node->input_edge(2)->producer_id(), node->input_edge(2)->producer_idx()});
+        }
+        size_splits.push_back(static_cast<int>(node->output(0)->desc().shape[output_outputs_idx(*node)]));
+        num_outputs += size_splits.back();
+
+        INode *last = fuse_activations ? activations[i] : node;
+        consumers.push_back(get_driving_nodes(*last));
+        accessors.push_back(last->output(0)->extract_accessor());
+    }
+
+    // Concatenate the weights and biases along the outputs, the constant folding computes them once
+    const DataLayoutDimension weights_axis = dimension_at(first.input(1)->desc().layout, weights_outputs_idx(first));
+    const NodeID              weights_nid =
+        GraphBuilder::add_concatenate_node(g, params, weights, descriptors::ConcatLayerDescriptor(weights_axis));
+    NodeID bias_nid = EmptyNodeID;
+    if (has_bias)
+    {
+        bias_nid = GraphBuilder::add_concatenate_node(
+            g, params, biases, descriptors::ConcatLayerDescriptor(dimension_at(first.input(2)->desc().layout, 0)));
+    }
+
+    NodeID fused_nid = EmptyNodeID;
+    if (first.type() == NodeType::ConvolutionLayer)
+    {
+        const auto *conv = arm_compute::utils::cast::polymorphic_downcast<const ConvolutionLayerNode *>(&first);
+        fused_nid        = g.add_node<ConvolutionLayerNode>(conv->convolution_info(), 1, conv->convolution_method(),
+                                                            conv->fast_math_hint());
+        auto *fused      = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(g.node(fused_nid));
+        fused->set_fused_activation(fuse_activations ? activations[0]->activation_info() : conv->fused_activation());
+    }
+    else
+    {
+        const auto *fc = arm_compute::utils::cast::polymorphic_downcast<const FullyConnectedLayerNode *>(&first);
+        FullyConnectedLayerInfo fc_info = fc->info();
+        if (fuse_activations)
+        {
+            fc_info.activation_info = activations[0]->activation_info();
+        }
+        fused_nid = g.add_node<FullyConnectedLayerNode>(num_outputs, QuantizationInfo(), fc_info, fc->fast_math_hint());
+    }
+    g.node(fused_nid)->set_common_node_parameters(params);
+    g.add_connection(source.node_id, source.index, fused_nid, 0);
+    g.add_connection(weights_nid, 0, fused_nid, 1);
+    if (has_bias)
+    {
+        g.add_connection(bias_nid, 0, fused_nid, 2);
+    }
+
+    const int    axis      = static_cast<int>(output_outputs_idx(first));
+    const NodeID split_nid = g.add_node<SplitLayerNode>(group.size(), axis, size_splits);
+    g.node(split_nid)->set_common_node_parameters(params);
+    g.add_connection(fused_nid, 0, split_nid, 0);
+
+    for (size_t i = 0; i < group.size(); ++i)
+    {
+        if (fuse_activations)
+        {
+            g.remove_node(activations[i]->id());
+        }
+        g.remove_node(group[i]);
+        for (const auto &consumer : consumers[i])
+        {
+            g.add_connection(split_nid, i, consumer.node_id, consumer.index);
+        }
+        g.node(split_nid)->output(i)->set_accessor(std::move(accessors[i]));
+    }
+
+    for (const NodeID nid : {weights_nid, bias_nid, fused_nid, split_nid})
+    {
+        if (nid != EmptyNodeID)
+        {
+            g.node(nid)->set_assigned_target(target);
+        }
+    }
+}
+} // namespace
+
+const char *HorizontalFusionMutator::name()
+{
+    return "HorizontalFusionMutator";
+}
+
+IGraphMutator::MutationType HorizontalFusionMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void HorizontalFusionMutator::mutate(Graph &g)
+{
+    // The fused layers are added to the end of the node list, only the original ones are visited
+    const size_t num_tensors = g.tensors().size();
+    for (size_t tid = 0; tid < num_tensors; ++tid)
+    {
+        const Tensor *tensor = g.tensor(tid);
+        if (tensor == nullptr || tensor->bound_edges().size() < 2)
+        {
+            continue;
+        }
+
+        // Group the sibling layers reading the tensor whose parameters match
+        std::vector<std::vector<NodeID>> groups;
+        for (const EdgeID eid : tensor->bound_edges())
+        {
+            const Edge  *edge     = g.edge(eid);
+            const INode *consumer = (edge != nullptr) ? edge->consumer() : nullptr;
+            if (consumer == nullptr || edge->consumer_idx() != 0 || !is_candidate(*consumer))
+            {
+                continue;
+            }
+            auto group = std::find_if(groups.begin(), groups.end(), [&](const std::vector<NodeID> &grp)
+                                      { return are_fusable(*g.node(grp[0]), *consumer); });
+            if (group == groups.end())
+            {
+                groups.push_back({consumer->id()});
+            }
+            else
+            {
+                group->push_back(consumer->id());
+            }
+        }
+
+        for (const auto &group : groups)
+        {
+            if (group.size() > 1)
+            {
+                ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing " << group.size() << " layers reading the tensor with ID : "
+                                                        << tid << std::endl);
+                fuse_siblings(g, group);
+            }
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
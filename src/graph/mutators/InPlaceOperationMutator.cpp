@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,8 @@
 
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/nodes/DepthwiseConvolutionLayerNode.h"
@@ -155,8 +157,8 @@ void try_in_place_depthwiseconv(std::unique_ptr<INode> &node)
     }
 }
 
-// Try to mutate the node to perform the elementwise in-place calculation
-void try_in_place_elementwise(std::unique_ptr<INode> &node)
+// Try to mutate the node to perform the elementwise in-place calculation on the operand which isn't used afterwards
+void try_in_place_elementwise(Graph &g, std::unique_ptr<INode> &node)
 {
     // Get input edge
     Edge *input0_edge = node->input_edge(0);
@@ -185,11 +187,13 @@ void try_in_place_elementwise(std::unique_ptr<INode> &node)
     const auto qinfo_out = current_output_tensor->desc().quant_info;
 
     // Can do in place, if the input has same shape as output, has same quntisation info as output, has same data type as output and input doesn't have accessor.
-    bool input0_can_in_place = !arm_compute::detail::have_different_dimensions(out_shape, shape0, 0) &&
+    bool input0_can_in_place = output_edges_are_separate_tensors(g, input0_edge) &&
+                               !arm_compute::detail::have_different_dimensions(out_shape, shape0, 0) &&
                                (qinfo0 == qinfo_out) &&
                                (input0_tensor->desc().data_type == current_output_tensor->desc().data_type) &&
                                (input0_tensor->accessor() == nullptr);
-    bool input1_can_in_place = !arm_compute::detail::have_different_dimensions(out_shape, shape1, 0) &&
+    bool input1_can_in_place = output_edges_are_separate_tensors(g, input1_edge) &&
+                               !arm_compute::detail::have_different_dimensions(out_shape, shape1, 0) &&
                                (qinfo1 == qinfo_out) &&
                                (input1_tensor->desc().data_type == current_output_tensor->desc().data_type) &&
                                (input1_tensor->accessor() == nullptr);
@@ -208,6 +212,52 @@ void try_in_place_elementwise(std::unique_ptr<INode> &node)
                                       "or the quantization info are different.\n");
     }
 }
+
+// Try to make the output of a node, which reads and writes each element at the same offset, alias its input memory
+void try_alias_output(Graph &g, INode &node)
+{
+    Edge   *input_edge    = node.input_edge(0);
+    Tensor *output_tensor = node.output(0);
+    if (input_edge == nullptr || output_tensor == nullptr || !output_edges_are_separate_tensors(g, input_edge))
+    {
+        return;
+    }
+
+    Tensor *input_tensor = input_edge->tensor();
+    ARM_COMPUTE_ERROR_ON(input_tensor == nullptr);
+    const TensorDescriptor &input_desc  = input_tensor->desc();
+    const TensorDescriptor &output_desc = output_tensor->desc();
+
+    // Only the CPU kernels of these operators are padding-free and element-wise
+    bool can_alias = node.assigned_target() == Target::NEON && input_desc.target == output_desc.target &&
+                     input_tensor->accessor() == nullptr && input_tensor->handle() != nullptr &&
+                     input_desc.shape.total_size() == output_desc.shape.total_size() &&
+                     data_size_from_type(input_desc.data_type) == data_size_from_type(output_desc.data_type);
+
+    // Sub-tensors are created after this pass and would replace the handles of the aliased tensors
+    can_alias &= input_edge->producer()->type() != NodeType::SplitLayer;
+    for (auto &output_edge_id : node.output_edges())
+    {
+        const INode *consumer = g.edge(output_edge_id)->consumer();
+        can_alias &= consumer->type() != NodeType::ConcatenateLayer && consumer->type() != NodeType::SplitLayer;
+    }
+
+    if (!can_alias)
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented in-place operation as the output of the node with ID : "
+                                      << node.id() << " can't alias its input.\n");
+        return;
+    }
+
+    backends::IDeviceBackend      &backend = backends::BackendRegistry::get().get_backend(output_desc.target);
+    std::unique_ptr<ITensorHandle> handle  = backend.create_alias_tensor(input_tensor->handle(), *output_tensor);
+    if (handle != nullptr)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Aliasing the input of the node with ID : " << node.id() << " and name : "
+                                                                             << node.name() << std::endl);
+        output_tensor->set_handle(std::move(handle));
+    }
+}
 } // namespace
 
 const char *InPlaceOperationMutator::name()
@@ -228,25 +278,31 @@ void InPlaceOperationMutator::mutate(Graph &g)
                                          NodeType::UnaryEltwiseLayer,
                                          NodeType::DepthwiseConvolutionLayer,
                                          NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer,
-                                         NodeType::PrintLayer};
+                                         NodeType::PrintLayer,
+                                         NodeType::SoftmaxLayer};
 
     // Not interested in the order of nodes
     for (auto &node : g.nodes())
     {
-        if (node && in_place_nodes.find(node->type()) != std::end(in_place_nodes))
+        // The softmax kernels of the CL backend reduce and write the same rows from different work-items
+        const bool is_cl_softmax =
+            node && node->type() == NodeType::SoftmaxLayer && node->assigned_target() != Target::NEON;
+
+        if (node && in_place_nodes.find(node->type()) != std::end(in_place_nodes) && !is_cl_softmax)
         {
             // Get input edge
             Edge *input_edge = node->input_edge(0);
 
+            if (node->type() == NodeType::EltwiseLayer)
+            {
+                // Either operand can be overwritten when it isn't used afterwards
+                try_in_place_elementwise(g, node);
+            }
             // Check if parent has a single output if yes then force in place calculation else not
-            if ((input_edge != nullptr) && output_edges_are_separate_tensors(g, input_edge))
+            else if ((input_edge != nullptr) && output_edges_are_separate_tensors(g, input_edge))
             {
-                if (node->type() == NodeType::EltwiseLayer)
-                {
-                    try_in_place_elementwise(node);
-                }
-                else if (node->type() == NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer ||
-                         node->type() == NodeType::DepthwiseConvolutionLayer)
+                if (node->type() == NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer ||
+                    node->type() == NodeType::DepthwiseConvolutionLayer)
                 {
                     try_in_place_depthwiseconv(node);
                 }
@@ -273,6 +329,19 @@ void InPlaceOperationMutator::mutate(Graph &g)
             }
         }
     }
+
+    // The inputs of these nodes are final once the other nodes have switched to in-place computation. The producers
+    // are visited first as an aliased tensor can't be aliased again.
+    const std::set<NodeType> alias_nodes = {NodeType::DequantizationLayer, NodeType::FlattenLayer,
+                                            NodeType::QuantizationLayer, NodeType::ReshapeLayer};
+    for (auto &node_id : dfs(g))
+    {
+        INode *node = g.node(node_id);
+        if (node != nullptr && alias_nodes.find(node->type()) != std::end(alias_nodes))
+        {
+            try_alias_output(g, *node);
+        }
+    }
 }
 } // namespace graph
 } // namespace arm_compute
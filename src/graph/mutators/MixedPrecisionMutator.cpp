@@ -0,0 +1,576 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/MixedPrecisionMutator.h"
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+using Range = std::pair<float, float>;
+
+/** Accessor converting the F32 values loaded by another accessor to the data type of the tensor
+ *
+ * @note Quantized values use the quantization info of the tensor, S32 values are divided by its scale
+ */
+class ConvertingAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] accessor Accessor loading the F32 values
+     */
+    ConvertingAccessor(std::unique_ptr<ITensorAccessor> accessor) : _accessor(std::move(accessor))
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        const TensorInfo    info(tensor.info()->tensor_shape(), 1, DataType::F32, tensor.info()->data_layout());
+        arm_compute::Tensor values;
+        values.allocator()->init(info);
+        values.allocator()->allocate();
+        if (!_accessor->access_tensor(values))
+        {
+            return false;
+        }
+
+        const DataType                data_type = tensor.info()->data_type();
+        const UniformQuantizationInfo qinfo     = tensor.info()->quantization_info().uniform();
+
+        Window window;
+        window.use_tensor_dimensions(info.tensor_shape());
+        Iterator src(&values, window);
+        Iterator dst(&tensor, window);
+        execute_window_loop(
+            window,
+            [&](const Coordinates &)
+            {
+                const float value = *reinterpret_cast<const float *>(src.ptr());
+                switch (data_type)
+                {
+                    case DataType::F16:
+                        *reinterpret_cast<half *>(dst.ptr()) = half(value);
+                        break;
+                    case DataType::QASYMM8_SIGNED:
+                        *reinterpret_cast<int8_t *>(dst.ptr()) = quantize_qasymm8_signed(value, qinfo);
+                        break;
+                    case DataType::S32:
+                        *reinterpret_cast<int32_t *>(dst.ptr()) =
+                            static_cast<int32_t>(std::lround(value / qinfo.scale));
+                        break;
+                    default:
+                        *reinterpret_cast<float *>(dst.ptr()) = value;
+                        break;
+                }
+            },
+            src, dst);
+        return true;
+    }
+
+private:
+    std::unique_ptr<ITensorAccessor> _accessor;
+};
+
+/** Asymmetric quantization info covering a range
+ *
+ * @param[in] range Range to cover, extended to contain zero
+ *
+ * @return Quantization info of a QASYMM8_SIGNED tensor holding the range
+ */
+QuantizationInfo activation_quantization_info(const Range &range)
+{
+    const float min    = std::min(range.first, 0.f);
+    const float max    = std::max(range.second, 0.f);
+    const float scale  = max > min ? (max - min) / 255.f : 1.f;
+    const int   offset = static_cast<int>(std::lround(-128.f - min / scale));
+    return QuantizationInfo(scale, std::max(-128, std::min(127, offset)));
+}
+
+/** Symmetric quantization info covering a range
+ *
+ * @param[in] range Range to cover
+ *
+ * @return Quantization info of QASYMM8_SIGNED weights holding the range
+ */
+QuantizationInfo weights_quantization_info(const Range &range)
+{
+    const float max = std::max(std::abs(range.first), std::abs(range.second));
+    return QuantizationInfo(max > 0.f ? max / 127.f : 1.f, 0);
+}
+
+/** Checks if a node is a convolution or a fully connected layer
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the node has weights and an optional bias as second and third inputs
+ */
+bool has_weights(const INode &node)
+{
+    const std::set<NodeType> types = {NodeType::ConvolutionLayer, NodeType::DeconvolutionLayer,
+                                      NodeType::DepthwiseConvolutionLayer, NodeType::FullyConnectedLayer};
+    return types.count(node.type()) != 0;
+}
+
+/** Checks if a node only moves, selects or combines values and can be computed in the data type of its inputs
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the node follows the data type of its inputs
+ */
+bool follows_inputs(const INode &node)
+{
+    const std::set<NodeType> types = {
+        NodeType::ActivationLayer,     NodeType::BatchNormalizationLayer, NodeType::ChannelShuffleLayer,
+        NodeType::ConcatenateLayer,    NodeType::DepthToSpaceLayer,       NodeType::EltwiseLayer,
+        NodeType::FlattenLayer,        NodeType::NormalizationLayer,      NodeType::PadLayer,
+        NodeType::PermuteLayer,        NodeType::PoolingLayer,            NodeType::PReluLayer,
+        NodeType::ReshapeLayer,        NodeType::ResizeLayer,             NodeType::SoftmaxLayer,
+        NodeType::SplitLayer};
+    return types.count(node.type()) != 0;
+}
+
+/** Checks if a node keeps the quantization info of its input, so that it can be computed in 8-bit without requantizing
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the output of the node can share the quantization info of its input
+ */
+bool propagates_int8(const INode &node)
+{
+    switch (node.type())
+    {
+        case NodeType::FlattenLayer:
+        case NodeType::PoolingLayer:
+        case NodeType::ReshapeLayer:
+            return true;
+        case NodeType::ActivationLayer:
+        {
+            const auto act = arm_compute::utils::cast::polymorphic_downcast<const ActivationLayerNode *>(&node)
+                                 ->activation_info()
+                                 .activation();
+            return act == ActivationLayerInfo::ActivationFunction::RELU ||
+                   act == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU ||
+                   act == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU;
+        }
+        default:
+            return false;
+    }
+}
+
+/** Checks if the tensor of an edge is a constant only read by the consumer of the edge
+ *
+ * @param[in] edge Edge to check
+ *
+ * @return True if the producer of the edge is a constant node with a single consumer
+ */
+bool is_private_const(const Edge *edge)
+{
+    return edge != nullptr && edge->producer()->type() == NodeType::Const && edge->tensor()->bound_edges().size() == 1;
+}
+
+/** Collects the calibrated range of each tensor
+ *
+ * Tensors produced by nodes without a calibrated range inherit the range of their input when the producer keeps
+ * the quantization info of its input.
+ *
+ * @param[in] g      Graph to collect the ranges of
+ * @param[in] policy Mixed precision policy
+ *
+ * @return Range of the tensors having one
+ */
+std::map<TensorID, Range> collect_ranges(Graph &g, const MixedPrecisionPolicy &policy)
+{
+    std::map<TensorID, Range> ranges;
+    for (const NodeID id : dfs(g))
+    {
+        const INode *node = g.node(id);
+        if (node == nullptr || node->num_outputs() == 0)
+        {
+            continue;
+        }
+
+        const auto range = policy.output_ranges.find(node->name());
+        if (range != policy.output_ranges.end())
+        {
+            ranges[node->output_id(0)] = range->second;
+        }
+        else if (propagates_int8(*node) && node->input_edge(0) != nullptr &&
+                 ranges.count(node->input_edge(0)->tensor_id()) != 0)
+        {
+            ranges[node->output_id(0)] = ranges[node->input_edge(0)->tensor_id()];
+        }
+    }
+    return ranges;
+}
+
+/** Checks if a node can be computed in QASYMM8_SIGNED
+ *
+ * @param[in] node   Node to check
+ * @param[in] policy Mixed precision policy
+ * @param[in] ranges Calibrated range of the tensors
+ *
+ * @return True if the node is a convolution or fully connected layer with constant weights and calibrated ranges
+ */
+bool can_run_in_int8(const INode &node, const MixedPrecisionPolicy &policy, const std::map<TensorID, Range> &ranges)
+{
+    if (node.type() == NodeType::ConvolutionLayer)
+    {
+        if (arm_compute::utils::cast::polymorphic_downcast<const ConvolutionLayerNode *>(&node)->num_groups() != 1)
+        {
+            return false;
+        }
+    }
+    else if (node.type() != NodeType::FullyConnectedLayer)
+    {
+        return false;
+    }
+
+    const Edge *input = node.input_edge(0);
+    const Edge *bias  = node.input_edge(2);
+    return input != nullptr && ranges.count(input->tensor_id()) != 0 && policy.output_ranges.count(node.name()) != 0 &&
+           policy.weights_ranges.count(node.name()) != 0 && is_private_const(node.input_edge(1)) &&
+           (bias == nullptr || is_private_const(bias));
+}
+
+/** Selects the nodes computed in QASYMM8_SIGNED
+ *
+ * @param[in] g      Graph to select the nodes of
+ * @param[in] policy Mixed precision policy
+ * @param[in] ranges Calibrated range of the tensors
+ *
+ * @return Nodes explicitly asked to be computed in 8-bit, then the least sensitive ones fitting in the accuracy budget
+ */
+std::set<NodeID>
+select_int8_nodes(Graph &g, const MixedPrecisionPolicy &policy, const std::map<TensorID, Range> &ranges)
+{
+    std::set<NodeID>                      selected;
+    std::vector<std::pair<float, NodeID>> candidates;
+    float                                 loss = 0.f;
+    for (const auto &node : g.nodes())
+    {
+        if (node == nullptr || !can_run_in_int8(*node, policy, ranges))
+        {
+            continue;
+        }
+
+        const auto sensitivity = policy.int8_sensitivity.find(node->name());
+        const auto data_type   = policy.layer_data_types.find(node->name());
+        if (data_type != policy.layer_data_types.end())
+        {
+            if (data_type->second == DataType::QASYMM8_SIGNED)
+            {
+                selected.insert(node->id());
+                loss += sensitivity != policy.int8_sensitivity.end() ? sensitivity->second : 0.f;
+            }
+        }
+        else if (sensitivity != policy.int8_sensitivity.end())
+        {
+            candidates.emplace_back(sensitivity->second, node->id());
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+    for (const auto &candidate : candidates)
+    {
+        if (loss + candidate.first > policy.accuracy_budget)
+        {
+            break;
+        }
+        loss += candidate.first;
+        selected.insert(candidate.second);
+    }
+    return selected;
+}
+
+/** Checks if every input of a graph is F32
+ *
+ * @param[in] g Graph to check
+ *
+ * @return True if the pass can be applied else false
+ */
+bool is_mutation_supported(Graph &g)
+{
+    const std::vector<NodeID> &inputs = g.nodes(NodeType::Input);
+    return !inputs.empty() && std::all_of(inputs.begin(), inputs.end(),
+                                          [&](const NodeID id)
+                                          {
+                                              const Tensor *tensor = g.node(id)->output(0);
+                                              return tensor != nullptr && tensor->desc().data_type == DataType::F32;
+                                          });
+}
+} // namespace
+
+MixedPrecisionMutator::MixedPrecisionMutator(MixedPrecisionPolicy policy, Target target)
+    : _policy(std::move(policy)), _target(target)
+{
+}
+
+const char *MixedPrecisionMutator::name()
+{
+    return "MixedPrecisionMutator";
+}
+
+IGraphMutator::MutationType MixedPrecisionMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void MixedPrecisionMutator::mutate(Graph &g)
+{
+    if (!is_mutation_supported(g))
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Mixed precision mutator couldn't be applied" << std::endl);
+        return;
+    }
+
+    const bool is_cpu    = _target == Target::NEON;
+    const bool has_fp16  = !is_cpu || CPUInfo::get().has_fp16();
+    const bool has_bf16  = !is_cpu || CPUInfo::get().has_bf16();
+    auto       float_for = [&](DataType data_type)
+    { return data_type == DataType::F16 && has_fp16 ? DataType::F16 : DataType::F32; };
+
+    const std::map<TensorID, Range> ranges     = collect_ranges(g, _policy);
+    const std::set<NodeID>          int8_nodes = select_int8_nodes(g, _policy, ranges);
+
+    std::map<TensorID, DataType> original_types;
+    for (const auto &tensor : g.tensors())
+    {
+        if (tensor != nullptr)
+        {
+            original_types[tensor->id()] = tensor->desc().data_type;
+        }
+    }
+
+    // Select the data type of each node and convert its inputs in topological order, so that the data type of the
+    // inputs is final when a node follows it
+    std::map<std::pair<TensorID, DataType>, NodeID> conversions;
+    for (const NodeID id : dfs(g))
+    {
+        INode *node = g.node(id);
+        if (node == nullptr || node->num_inputs() == 0)
+        {
+            continue;
+        }
+
+        const auto explicit_type = _policy.layer_data_types.find(node->name());
+        const bool is_int8       = int8_nodes.count(id) != 0;
+        const bool is_explicit =
+            explicit_type != _policy.layer_data_types.end() && explicit_type->second != DataType::QASYMM8_SIGNED;
+        const DataType requested = is_explicit ? explicit_type->second : _policy.default_data_type;
+
+        DataType data_type = DataType::UNKNOWN;
+        if (is_int8)
+        {
+            data_type = DataType::QASYMM8_SIGNED;
+        }
+        else if (is_explicit || has_weights(*node))
+        {
+            data_type = float_for(requested);
+        }
+        else if (follows_inputs(*node))
+        {
+            std::set<DataType> input_types;
+            for (size_t i = 0; i < node->num_inputs(); ++i)
+            {
+                const Edge *edge = node->input_edge(i);
+                if (edge != nullptr && edge->producer()->type() != NodeType::Const)
+                {
+                    input_types.insert(edge->tensor()->desc().data_type);
+                }
+            }
+
+            if (input_types.size() == 1 && *input_types.begin() == DataType::QASYMM8_SIGNED && propagates_int8(*node))
+            {
+                data_type = DataType::QASYMM8_SIGNED;
+            }
+            else if (input_types.count(DataType::F32) != 0)
+            {
+                data_type = DataType::F32;
+            }
+            else
+            {
+                data_type = input_types.count(DataType::F16) != 0 ? DataType::F16 : float_for(requested);
+            }
+        }
+
+        // BF16 arithmetic is enabled through fast math
+        if (data_type == DataType::F32 && requested == DataType::BFLOAT16 && has_bf16)
+        {
+            if (node->type() == NodeType::ConvolutionLayer)
+            {
+                arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(node)->set_fast_math_hint(
+                    FastMathHint::Enabled);
+            }
+            else if (node->type() == NodeType::FullyConnectedLayer)
+            {
+                arm_compute::utils::cast::polymorphic_downcast<FullyConnectedLayerNode *>(node)->set_fast_math_hint(
+                    FastMathHint::Enabled);
+            }
+            else if (node->type() == NodeType::DepthwiseConvolutionLayer)
+            {
+                arm_compute::utils::cast::polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node)
+                    ->set_fast_math_hint(FastMathHint::Enabled);
+            }
+        }
+
+        // Quantization info of the input and the weights of 8-bit nodes
+        QuantizationInfo input_qinfo;
+        QuantizationInfo weights_qinfo;
+        if (is_int8)
+        {
+            input_qinfo   = activation_quantization_info(ranges.at(node->input_edge(0)->tensor_id()));
+            weights_qinfo = weights_quantization_info(_policy.weights_ranges.at(node->name()));
+        }
+
+        std::vector<std::pair<size_t, DataType>> inputs_to_convert;
+        for (size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            Edge *edge = node->input_edge(i);
+            if (edge == nullptr)
+            {
+                continue;
+            }
+
+            Tensor  *tensor      = edge->tensor();
+            DataType target_type = data_type == DataType::UNKNOWN ? original_types[tensor->id()] : data_type;
+            if (is_int8 && i == 2)
+            {
+                target_type = DataType::S32;
+            }
+            if (tensor->desc().data_type == target_type)
+            {
+                continue;
+            }
+
+            // Constants only read by this node are converted when loaded, other tensors are converted by a new node
+            if (is_private_const(edge) && tensor->desc().data_type == DataType::F32)
+            {
+                tensor->desc().data_type = target_type;
+                if (is_int8)
+                {
+                    tensor->desc().quant_info =
+                        i == 1 ? weights_qinfo
+                               : QuantizationInfo(input_qinfo.uniform().scale * weights_qinfo.uniform().scale);
+                }
+                auto accessor = tensor->extract_accessor();
+                if (accessor != nullptr)
+                {
+                    tensor->set_accessor(std::make_unique<ConvertingAccessor>(std::move(accessor)));
+                }
+            }
+            else
+            {
+                inputs_to_convert.emplace_back(i, target_type);
+            }
+        }
+
+        // Disconnect the inputs first so that descriptors are propagated once all inputs are converted
+        std::vector<NodeIdxPair> sources;
+        for (const auto &input : inputs_to_convert)
+        {
+            const Edge *edge = node->input_edge(input.first);
+            sources.push_back(NodeIdxPair{edge->producer_id(), edge->producer_idx()});
+            g.remove_connection(node->input_edge_id(input.first));
+        }
+        for (size_t k = 0; k < inputs_to_convert.size(); ++k)
+        {
+            const size_t   idx         = inputs_to_convert[k].first;
+            const DataType target_type = inputs_to_convert[k].second;
+            INode         *producer    = g.node(sources[k].node_id);
+            const TensorID tid         = producer->output_id(sources[k].index);
+            const DataType source_type = g.tensor(tid)->desc().data_type;
+
+            auto it = conversions.find(std::make_pair(tid, target_type));
+            if (it == conversions.end())
+            {
+                const NodeParams params{producer->name() + "_" + string_from_data_type(target_type),
+                                        node->assigned_target()};
+                NodeID           conversion_id = EmptyNodeID;
+                if (target_type == DataType::QASYMM8_SIGNED)
+                {
+                    conversion_id = g.add_node<QuantizationLayerNode>(activation_quantization_info(ranges.at(tid)),
+                                                                      DataType::QASYMM8_SIGNED);
+                }
+                else if (is_data_type_quantized(source_type))
+                {
+                    conversion_id = g.add_node<DequantizationLayerNode>(target_type);
+                }
+                else
+                {
+                    conversion_id = g.add_node<CastLayerNode>(target_type);
+                }
+                g.node(conversion_id)->set_common_node_parameters(params);
+                g.add_connection(sources[k].node_id, sources[k].index, conversion_id, 0);
+                it = conversions.emplace(std::make_pair(tid, target_type), conversion_id).first;
+            }
+            g.add_connection(it->second, 0, id, idx);
+
+            // Output accessors read the tensor in the data type it was created with
+            if (node->type() == NodeType::Output)
+            {
+                node->input(0)->set_accessor(g.tensor(tid)->extract_accessor());
+            }
+        }
+
+        if (is_int8)
+        {
+            const QuantizationInfo output_qinfo = activation_quantization_info(_policy.output_ranges.at(node->name()));
+            if (node->type() == NodeType::ConvolutionLayer)
+            {
+                arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(node)->set_output_quant_info(
+                    output_qinfo);
+            }
+            else
+            {
+                arm_compute::utils::cast::polymorphic_downcast<FullyConnectedLayerNode *>(node)->set_output_quant_info(
+                    output_qinfo);
+            }
+        }
+        node->forward_descriptors();
+    }
+}
+} // namespace graph
+} // namespace arm_compute
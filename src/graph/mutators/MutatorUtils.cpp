@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,10 @@
  */
 #include "src/graph/mutators/MutatorUtils.h"
 
+#include "arm_compute/core/Helpers.h"
+
+#include <cstring>
+
 namespace arm_compute
 {
 namespace graph
@@ -48,5 +52,31 @@ bool is_padding_in_height_or_width(const DataLayout &layout, const PaddingList &
 
     return false;
 }
+
+void copy_tensor_values(ITensor &tensor, uint8_t *buffer, bool to_tensor)
+{
+    const ITensorInfo &info     = *tensor.info();
+    const size_t       row_size = info.dimension(0) * info.element_size();
+
+    Window window;
+    window.use_tensor_dimensions(info.tensor_shape());
+    window.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator it(&tensor, window);
+    execute_window_loop(
+        window,
+        [&](const Coordinates &)
+        {
+            if (to_tensor)
+            {
+                std::memcpy(it.ptr(), buffer, row_size);
+            }
+            else
+            {
+                std::memcpy(buffer, it.ptr(), row_size);
+            }
+            buffer += row_size;
+        },
+        it);
+}
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,8 +24,11 @@
 #ifndef ARM_COMPUTE_GRAPH_MUTATOR_UTILS_H
 #define ARM_COMPUTE_GRAPH_MUTATOR_UTILS_H
 
+#include "arm_compute/core/ITensor.h"
 #include "arm_compute/graph/Utils.h"
 
+#include <cstdint>
+
 namespace arm_compute
 {
 namespace graph
@@ -36,6 +39,14 @@ namespace graph
  * @param[in] padding_list List of padding pairs
  */
 bool is_padding_in_height_or_width(const DataLayout &layout, const PaddingList &padding_list);
+
+/** Copies the values of a tensor from or to a contiguous buffer
+ *
+ * @param[in]     tensor    Tensor to copy the values of
+ * @param[in,out] buffer    Buffer holding the values without padding
+ * @param[in]     to_tensor True to copy the buffer to the tensor, false to copy the tensor to the buffer
+ */
+void copy_tensor_values(ITensor &tensor, uint8_t *buffer, bool to_tensor);
 } // namespace graph
 } // namespace arm_compute
 
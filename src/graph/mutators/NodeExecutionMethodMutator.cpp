@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -66,6 +66,30 @@ void set_default_on_invalid_method(Graph &g, NodeType node_type, Setter &&setter
         }
     }
 }
+
+/** Sets the convolution methods measured by the backends on the convolution layer nodes
+ *
+ * @param[in, out] g Graph to extract the nodes from
+ */
+void set_measured_convolution_method(Graph &g)
+{
+    for (auto &node_id : g.nodes(NodeType::ConvolutionLayer))
+    {
+        INode *node = g.node(node_id);
+        if (node != nullptr)
+        {
+            backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(node->assigned_target());
+            ConvolutionMethod         method  = ConvolutionMethod::Default;
+            if (backend.measured_convolution_method(*node, method))
+            {
+                ARM_COMPUTE_LOG_GRAPH_INFO("Set measured ConvolutionLayer method of node with ID : "
+                                           << node->id() << " and Name: " << node->name() << std::endl);
+                auto *casted_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(node);
+                casted_node->set_convolution_method(method);
+            }
+        }
+    }
+}
 } // namespace
 
 const char *NodeExecutionMethodMutator::name()
@@ -80,7 +104,8 @@ IGraphMutator::MutationType NodeExecutionMethodMutator::type() const
 
 void NodeExecutionMethodMutator::mutate(Graph &g)
 {
-    // Convolution Layer
+    // Convolution Layer, the measured methods take precedence over the hints
+    set_measured_convolution_method(g);
     set_default_on_invalid_method(g, NodeType::ConvolutionLayer,
                                   [](INode *n)
                                   {
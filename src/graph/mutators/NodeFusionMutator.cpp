@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,18 +23,27 @@
  */
 #include "arm_compute/graph/mutators/NodeFusionMutator.h"
 
+#include "arm_compute/core/CPP/CPPTypes.h"
 #include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/utils/helpers/tensor_transform.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/ITensorAccessor.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/nodes/FusedConvolutionBatchNormalizationNode.h"
 #include "arm_compute/graph/nodes/Nodes.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "src/graph/mutators/MutatorUtils.h"
 #include "support/Cast.h"
 
+#include <array>
+#include <cmath>
+#include <cstring>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <set>
 
 namespace arm_compute
@@ -316,6 +325,565 @@ void fuse_pad_with_convolution(Graph &g, const Edge *output_edge)
     }
 }
 
+void fuse_softmax_with_arg_min_max(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *softmax_node = arm_compute::utils::cast::polymorphic_downcast<SoftmaxLayerNode *>(output_edge->producer());
+    auto *arg_node     = arm_compute::utils::cast::polymorphic_downcast<ArgMinMaxLayerNode *>(output_edge->consumer());
+
+    // With a positive beta the softmax preserves the order of the values along the axis it normalises, so the arg
+    // min/max of its output, e.g. the class predicted by a classifier, is the one of the logits. With quantized
+    // probabilities this also resolves the ties created by their rounding on the logits.
+    if (softmax_node->beta() <= 0.f || arg_node->axis() != 0 || softmax_node->output(0)->accessor() != nullptr)
+    {
+        return;
+    }
+
+    // Update drivers of the arg min/max node
+    std::vector<NodeIdxPair> softmax_driver_nodes = get_driver_nodes(*softmax_node);
+    g.remove_node(softmax_node->id());
+    for (auto &driver_node : softmax_driver_nodes)
+    {
+        g.add_connection(driver_node.node_id, driver_node.index, arg_node->id(), 0);
+    }
+}
+
+/** Accessor reordering the slices of a tensor along a dimension once another accessor has filled it */
+class PermutedSlicesAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] accessor  Accessor filling the tensor
+     * @param[in] dimension Dimension to reorder the slices of
+     * @param[in] sources   Index of the filled slice each slice is taken from
+     */
+    PermutedSlicesAccessor(ITensorAccessorUPtr accessor, size_t dimension, std::vector<unsigned int> sources)
+        : _accessor(std::move(accessor)), _dimension(dimension), _sources(std::move(sources))
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        if (!_accessor->access_tensor(tensor) || !_accessor->access_tensor_data())
+        {
+            return false;
+        }
+
+        const ITensorInfo &info       = *tensor.info();
+        const TensorShape &shape      = info.tensor_shape();
+        const size_t       slice_size = shape.total_size_lower(_dimension) * info.element_size();
+        const size_t       num_slices = shape[_dimension];
+        ARM_COMPUTE_ERROR_ON(_sources.size() != num_slices);
+
+        std::vector<uint8_t> values(shape.total_size() * info.element_size());
+        std::vector<uint8_t> permuted(values.size());
+        copy_tensor_values(tensor, values.data(), false);
+        for (size_t outer = 0; outer < shape.total_size_upper(_dimension + 1); ++outer)
+        {
+            const size_t offset = outer * num_slices * slice_size;
+            for (size_t i = 0; i < num_slices; ++i)
+            {
+                std::memcpy(permuted.data() + offset + i * slice_size,
+                            values.data() + offset + _sources[i] * slice_size, slice_size);
+            }
+        }
+        copy_tensor_values(tensor, permuted.data(), true);
+        return true;
+    }
+    bool access_tensor_data() override
+    {
+        return _accessor->access_tensor_data();
+    }
+
+private:
+    ITensorAccessorUPtr       _accessor;
+    size_t                    _dimension;
+    std::vector<unsigned int> _sources;
+};
+
+/** Index of the input channel of a channel shuffle read by each of its output channels */
+std::vector<unsigned int> channel_shuffle_sources(unsigned int num_channels, unsigned int num_groups)
+{
+    const unsigned int        channels_per_group = num_channels / num_groups;
+    std::vector<unsigned int> sources(num_channels);
+    for (unsigned int c = 0; c < num_channels; ++c)
+    {
+        sources[c] = (c % num_groups) * channels_per_group + c / num_groups;
+    }
+    return sources;
+}
+
+/** Checks if the values of a constant input of a node can be reordered when they are loaded
+ *
+ * @param[in] node Node reading the constant
+ * @param[in] idx  Index of the input
+ *
+ * @return True if the input is a constant only read by @p node and filled by an accessor, or if it is not connected
+ */
+bool is_permutable_const_input(const INode &node, size_t idx)
+{
+    const Edge *edge = node.input_edge(idx);
+    if (edge == nullptr)
+    {
+        return true;
+    }
+    const INode *producer = edge->producer();
+    return producer->type() == NodeType::Const && producer->output_edges().size() == 1 &&
+           edge->tensor() != nullptr && edge->tensor()->accessor() != nullptr;
+}
+
+/** Reorders the values of a constant input of a node along a dimension when they are loaded
+ *
+ * The constant is renamed, so that it is not shared with the constants of other graphs holding the original values.
+ *
+ * @param[in,out] g         Graph the node belongs to
+ * @param[in]     node      Node reading the constant, checked with @ref is_permutable_const_input
+ * @param[in]     idx       Index of the input
+ * @param[in]     dimension Dimension to reorder
+ * @param[in]     sources   Index of the original slice each slice is taken from
+ */
+void permute_const_input(Graph &g, INode &node, size_t idx, size_t dimension, std::vector<unsigned int> sources)
+{
+    const Edge *edge = node.input_edge(idx);
+    if (edge == nullptr)
+    {
+        return;
+    }
+    Tensor *tensor = edge->tensor();
+    tensor->set_accessor(
+        std::make_unique<PermutedSlicesAccessor>(tensor->extract_accessor(), dimension, std::move(sources)));
+    INode     *producer = g.node(edge->producer_id());
+    NodeParams params   = producer->common_node_params();
+    params.name += "/channel_shuffled";
+    producer->set_common_node_parameters(params);
+}
+
+void fuse_convolution_with_channel_shuffle(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(output_edge->producer());
+    auto *shuffle_node =
+        arm_compute::utils::cast::polymorphic_downcast<ChannelShuffleLayerNode *>(output_edge->consumer());
+
+    // The groups of a grouped convolution would be mixed, per-channel quantization scales would have to follow
+    const Tensor *weights = conv_node->input(1);
+    if (conv_node->num_groups() != 1 || conv_node->output(0)->accessor() != nullptr || weights == nullptr ||
+        weights->desc().data_type == DataType::QSYMM8_PER_CHANNEL || !is_permutable_const_input(*conv_node, 1) ||
+        !is_permutable_const_input(*conv_node, 2))
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing convolution node with ID : " << output_edge->producer_id()
+                                                                       << " with ChannelShuffle Layer node with ID : "
+                                                                       << output_edge->consumer_id() << std::endl);
+
+    // Each kernel of the convolution is moved to the output channel the shuffle writes its result to
+    const unsigned int num_kernels = weights->desc().shape[3];
+    permute_const_input(g, *conv_node, 1, 3, channel_shuffle_sources(num_kernels, shuffle_node->num_groups()));
+    permute_const_input(g, *conv_node, 2, 0, channel_shuffle_sources(num_kernels, shuffle_node->num_groups()));
+
+    transfer_driving_nodes_and_remove_old_node(g, conv_node, shuffle_node, false);
+}
+
+void fuse_channel_shuffle_with_convolution(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *shuffle_node =
+        arm_compute::utils::cast::polymorphic_downcast<ChannelShuffleLayerNode *>(output_edge->producer());
+    auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(output_edge->consumer());
+
+    const Tensor *weights = conv_node->input(1);
+    if (output_edge->consumer_idx() != 0 || conv_node->num_groups() != 1 ||
+        shuffle_node->output(0)->accessor() != nullptr || weights == nullptr ||
+        !is_permutable_const_input(*conv_node, 1))
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing ChannelShuffle Layer node with ID : "
+                                  << output_edge->producer_id() << " with convolution node with ID : "
+                                  << output_edge->consumer_id() << std::endl);
+
+    // The convolution reads the channels in place, each of its input channels taking the weights of the shuffled one
+    const size_t       channel_idx  = get_dimension_idx(weights->desc().layout, DataLayoutDimension::CHANNEL);
+    const unsigned int num_channels = weights->desc().shape[channel_idx];
+    const std::vector<unsigned int> shuffled = channel_shuffle_sources(num_channels, shuffle_node->num_groups());
+    std::vector<unsigned int>       sources(num_channels);
+    for (unsigned int c = 0; c < num_channels; ++c)
+    {
+        sources[shuffled[c]] = c;
+    }
+    permute_const_input(g, *conv_node, 1, channel_idx, std::move(sources));
+
+    // Update drivers of the convolution node
+    std::vector<NodeIdxPair> shuffle_driver_nodes = get_driver_nodes(*shuffle_node);
+    g.remove_node(shuffle_node->id());
+    for (auto &driver_node : shuffle_driver_nodes)
+    {
+        g.add_connection(driver_node.node_id, driver_node.index, conv_node->id(), 0);
+    }
+}
+
+/** Loads the values an accessor fills a tensor of the given descriptor with
+ *
+ * @param[in]  accessor Accessor filling the tensor
+ * @param[in]  desc     Descriptor of the tensor. Data types supported: F16/F32
+ * @param[out] values   Values of the tensor, converted to F32
+ *
+ * @return True if the accessor succeeded
+ */
+bool load_values(ITensorAccessor &accessor, const TensorDescriptor &desc, std::vector<float> &values)
+{
+    TensorInfo info(desc.shape, 1, desc.data_type);
+    info.set_data_layout(desc.layout);
+    arm_compute::Tensor tensor;
+    tensor.allocator()->init(info);
+    tensor.allocator()->allocate();
+    if (!accessor.access_tensor(tensor))
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> raw(desc.shape.total_size() * info.element_size());
+    copy_tensor_values(tensor, raw.data(), false);
+    values.resize(desc.shape.total_size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = desc.data_type == DataType::F16 ? static_cast<float>(reinterpret_cast<const half *>(raw.data())[i])
+                                                    : reinterpret_cast<const float *>(raw.data())[i];
+    }
+    return true;
+}
+
+/** Weights and bias of a linear layer into which the batch normalization of its input is folded
+ *
+ * The layer computes b[o] + sum_c W[o, c] * (s[c] * x[c] + t[c]), with s = gamma / sqrt(var + epsilon) and
+ * t = beta - mean * s, so it reads x directly with the weights W[o, c] * s[c] and the bias b[o] + sum_c W[o, c] * t[c].
+ * As the folded bias depends on the original weights, both are computed when either of them is first loaded.
+ */
+class BatchNormalizationFold
+{
+public:
+    /** Constructor
+     *
+     * @param[in] weights      Accessor filling the weights of the layer
+     * @param[in] weights_desc Descriptor of the weights
+     * @param[in] channel_dim  Dimension of the weights along the channels of the batch normalization
+     * @param[in] output_dim   Dimension of the weights along the outputs of the layer
+     * @param[in] bias         Accessor filling the bias of the layer, nullptr if the layer has no bias
+     * @param[in] params       Accessors filling the mean, variance, beta and gamma,
+     *                         nullptr for a zero beta or a unit gamma
+     * @param[in] params_desc  Descriptor of the parameters
+     * @param[in] epsilon      Epsilon of the batch normalization
+     */
+    BatchNormalizationFold(ITensorAccessorUPtr                 weights,
+                           const TensorDescriptor             &weights_desc,
+                           size_t                              channel_dim,
+                           size_t                              output_dim,
+                           ITensorAccessorUPtr                 bias,
+                           std::array<ITensorAccessorUPtr, 4> &&params,
+                           const TensorDescriptor             &params_desc,
+                           float                               epsilon)
+        : _weights(std::move(weights)),
+          _weights_desc(weights_desc),
+          _channel_dim(channel_dim),
+          _output_dim(output_dim),
+          _bias(std::move(bias)),
+          _params(std::move(params)),
+          _params_desc(params_desc),
+          _epsilon(epsilon)
+    {
+    }
+
+    /** Copies the folded weights, or the folded bias, to a tensor
+     *
+     * @param[in,out] tensor Tensor to fill
+     * @param[in]     bias   True to fill the bias, false to fill the weights
+     *
+     * @return True if the accessors of the original values succeeded
+     */
+    bool write(ITensor &tensor, bool bias)
+    {
+        // Dummy accessors leave the values untouched, so there is nothing to fold
+        if (!_weights->access_tensor_data())
+        {
+            return true;
+        }
+        // The weights and the bias can be filled concurrently when the constants are uploaded asynchronously
+        std::lock_guard<std::mutex> lock(_mtx);
+        if (!_folded)
+        {
+            _valid  = fold();
+            _folded = true;
+        }
+        if (!_valid)
+        {
+            return false;
+        }
+
+        const std::vector<float> &values = bias ? _folded_bias : _folded_weights;
+        const ITensorInfo        &info   = *tensor.info();
+        ARM_COMPUTE_ERROR_ON(info.tensor_shape().total_size() != values.size());
+        std::vector<uint8_t> raw(values.size() * info.element_size());
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (info.data_type() == DataType::F16)
+            {
+                reinterpret_cast<half *>(raw.data())[i] = static_cast<half>(values[i]);
+            }
+            else
+            {
+                reinterpret_cast<float *>(raw.data())[i] = values[i];
+            }
+        }
+        copy_tensor_values(tensor, raw.data(), true);
+        return true;
+    }
+    /** Checks if the accessors of the original values fill the tensors
+     *
+     * @return True if the values are filled
+     */
+    bool access_tensor_data() const
+    {
+        return _weights->access_tensor_data();
+    }
+
+private:
+    bool fold()
+    {
+        std::array<std::vector<float>, 4> params;
+        for (size_t i = 0; i < params.size(); ++i)
+        {
+            if (_params[i] == nullptr)
+            {
+                params[i].assign(_params_desc.shape.total_size(), i == 3 ? 1.f : 0.f);
+            }
+            else if (!load_values(*_params[i], _params_desc, params[i]))
+            {
+                return false;
+            }
+        }
+        if (!load_values(*_weights, _weights_desc, _folded_weights))
+        {
+            return false;
+        }
+
+        const TensorShape &shape       = _weights_desc.shape;
+        const size_t       num_outputs = shape[_output_dim];
+        if (_bias == nullptr)
+        {
+            _folded_bias.assign(num_outputs, 0.f);
+        }
+        else
+        {
+            TensorDescriptor bias_desc = _weights_desc;
+            bias_desc.shape            = TensorShape(num_outputs);
+            if (!load_values(*_bias, bias_desc, _folded_bias))
+            {
+                return false;
+            }
+        }
+
+        const size_t       num_channels = shape[_channel_dim];
+        std::vector<float> scale(num_channels);
+        std::vector<float> shift(num_channels);
+        for (size_t c = 0; c < num_channels; ++c)
+        {
+            scale[c] = params[3][c] / std::sqrt(params[1][c] + _epsilon);
+            shift[c] = params[2][c] - params[0][c] * scale[c];
+        }
+
+        const size_t channel_stride = shape.total_size_lower(_channel_dim);
+        const size_t output_stride  = shape.total_size_lower(_output_dim);
+        for (size_t i = 0; i < _folded_weights.size(); ++i)
+        {
+            const size_t c = (i / channel_stride) % num_channels;
+            const size_t o = (i / output_stride) % num_outputs;
+            _folded_bias[o] += _folded_weights[i] * shift[c];
+            _folded_weights[i] *= scale[c];
+        }
+        return true;
+    }
+
+    ITensorAccessorUPtr                _weights;
+    TensorDescriptor                   _weights_desc;
+    size_t                             _channel_dim;
+    size_t                             _output_dim;
+    ITensorAccessorUPtr                _bias;
+    std::array<ITensorAccessorUPtr, 4> _params;
+    TensorDescriptor                   _params_desc;
+    float                              _epsilon;
+    std::vector<float>                 _folded_weights{};
+    std::vector<float>                 _folded_bias{};
+    bool                               _folded{false};
+    bool                               _valid{false};
+    std::mutex                         _mtx{};
+};
+
+/** Accessor filling the weights or the bias of a @ref BatchNormalizationFold */
+class FoldedBatchNormalizationAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] fold Folded values, shared by the accessors of the weights and of the bias
+     * @param[in] bias True to fill the bias, false to fill the weights
+     */
+    FoldedBatchNormalizationAccessor(std::shared_ptr<BatchNormalizationFold> fold, bool bias)
+        : _fold(std::move(fold)), _bias(bias)
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        return _fold->write(tensor, _bias);
+    }
+    bool access_tensor_data() override
+    {
+        return _fold->access_tensor_data();
+    }
+
+private:
+    std::shared_ptr<BatchNormalizationFold> _fold;
+    bool                                    _bias;
+};
+
+/** Gets the dimensions of the weights of a convolution along its input channels and its outputs
+ *
+ * The padded borders would read zeros instead of the shift of the normalization, so only unpadded convolutions fold it.
+ *
+ * @return True if a batch normalization of the input can be folded into the weights
+ */
+bool get_fold_dimensions(const ConvolutionLayerNode &node,
+                         const TensorDescriptor &,
+                         size_t &channel_dim,
+                         size_t &output_dim)
+{
+    if (node.num_groups() != 1 || node.convolution_info().has_padding())
+    {
+        return false;
+    }
+    channel_dim = get_dimension_idx(node.input(1)->desc().layout, DataLayoutDimension::CHANNEL);
+    output_dim  = 3;
+    return true;
+}
+
+/** Gets the dimensions of the weights of a fully connected layer along its inputs and its outputs
+ *
+ * The normalized channels must be the inputs of the layer, i.e. the input must have no spatial extent.
+ *
+ * @return True if a batch normalization of the input can be folded into the weights
+ */
+bool get_fold_dimensions(const FullyConnectedLayerNode &node,
+                         const TensorDescriptor        &input,
+                         size_t                        &channel_dim,
+                         size_t                        &output_dim)
+{
+    const FullyConnectedLayerInfo fc_info = node.info();
+    const size_t channel_idx = get_dimension_idx(input.layout, DataLayoutDimension::CHANNEL);
+    const size_t width_idx   = get_dimension_idx(input.layout, DataLayoutDimension::WIDTH);
+    const size_t height_idx  = get_dimension_idx(input.layout, DataLayoutDimension::HEIGHT);
+    channel_dim              = fc_info.transpose_weights ? 0 : 1;
+    output_dim               = 1 - channel_dim;
+    return !fc_info.are_weights_reshaped && input.shape.num_dimensions() > channel_idx &&
+           input.shape[width_idx] == 1 && input.shape[height_idx] == 1 &&
+           node.input(1)->desc().shape[channel_dim] == input.shape[channel_idx];
+}
+
+template <typename N>
+void fuse_batch_normalization_with_linear_layer(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *bn_node =
+        arm_compute::utils::cast::polymorphic_downcast<BatchNormalizationLayerNode *>(output_edge->producer());
+    auto *node = arm_compute::utils::cast::polymorphic_downcast<N *>(output_edge->consumer());
+
+    // The normalization must be followed by the layer alone, and its parameters only be read by it
+    const Tensor *input   = bn_node->input(0);
+    const Tensor *weights = node->input(1);
+    if (output_edge->consumer_idx() != 0 || bn_node->fused_activation().enabled() ||
+        bn_node->output(0)->accessor() != nullptr || input == nullptr || weights == nullptr ||
+        !is_data_type_float(weights->desc().data_type) || bn_node->input_edge(1) == nullptr ||
+        bn_node->input_edge(2) == nullptr || !is_permutable_const_input(*node, 1) ||
+        !is_permutable_const_input(*node, 2))
+    {
+        return;
+    }
+    for (size_t idx = 1; idx < bn_node->num_inputs(); ++idx)
+    {
+        if (!is_permutable_const_input(*bn_node, idx))
+        {
+            return;
+        }
+    }
+    size_t channel_dim = 0;
+    size_t output_dim  = 0;
+    if (!get_fold_dimensions(*node, input->desc(), channel_dim, output_dim))
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing BatchNormalization Layer node with ID : "
+                                  << output_edge->producer_id() << " with " << node->name() << " node with ID : "
+                                  << output_edge->consumer_id() << std::endl);
+
+    std::array<ITensorAccessorUPtr, 4> params;
+    for (size_t i = 0; i < params.size(); ++i)
+    {
+        const Edge *edge = bn_node->input_edge(i + 1);
+        params[i]        = edge != nullptr ? edge->tensor()->extract_accessor() : nullptr;
+    }
+    Tensor             *weights_tensor = node->input_edge(1)->tensor();
+    const Edge         *bias_edge      = node->input_edge(2);
+    ITensorAccessorUPtr bias = bias_edge != nullptr ? bias_edge->tensor()->extract_accessor() : nullptr;
+    auto fold = std::make_shared<BatchNormalizationFold>(weights_tensor->extract_accessor(), weights->desc(),
+                                                         channel_dim, output_dim, std::move(bias), std::move(params),
+                                                         bn_node->input(1)->desc(), bn_node->epsilon());
+    weights_tensor->set_accessor(std::make_unique<FoldedBatchNormalizationAccessor>(fold, false));
+
+    // The constants are renamed, so that they are not shared with the constants of other graphs holding the original
+    // values
+    INode     *weights_node   = g.node(node->input_edge(1)->producer_id());
+    NodeParams weights_params = weights_node->common_node_params();
+    weights_params.name += "/batch_normalization_folded";
+    weights_node->set_common_node_parameters(weights_params);
+    if (bias_edge != nullptr)
+    {
+        bias_edge->tensor()->set_accessor(std::make_unique<FoldedBatchNormalizationAccessor>(fold, true));
+        INode     *bias_node   = g.node(bias_edge->producer_id());
+        NodeParams bias_params = bias_node->common_node_params();
+        bias_params.name += "/batch_normalization_folded";
+        bias_node->set_common_node_parameters(bias_params);
+    }
+    else
+    {
+        NodeParams bias_params = node->common_node_params();
+        bias_params.name       = bias_params.name.empty() ? "" : bias_params.name + "/batch_normalization_folded_bias";
+
+        TensorDescriptor bias_desc = weights->desc();
+        bias_desc.shape            = TensorShape(weights->desc().shape[output_dim]);
+        const NodeID bias_nid      = GraphBuilder::add_const_node(
+            g, bias_params, bias_desc, std::make_unique<FoldedBatchNormalizationAccessor>(fold, true));
+        g.add_connection(bias_nid, 0, node->id(), 2);
+    }
+
+    // Update drivers of the layer
+    std::vector<NodeIdxPair> bn_driver_nodes = get_driver_nodes(*bn_node);
+    g.remove_node(bn_node->id());
+    for (auto &driver_node : bn_driver_nodes)
+    {
+        g.add_connection(driver_node.node_id, driver_node.index, node->id(), 0);
+    }
+}
+
 template <typename N1, typename N2, typename F, typename... Args>
 void fuse_layer(Graph &g, std::function<bool(INode &)> const &prec, const F fuse_fcn, Args &&...optional_arguments)
 {
@@ -364,6 +932,720 @@ void fuse_layer(Graph &g, std::function<bool(INode &)> const &prec, const F fuse
         }
     }
 }
+
+/** Collects the nodes a node transitively depends on
+ *
+ * @param[in] node Node to collect the ancestors of
+ *
+ * @return The IDs of all the nodes executed before @p node
+ */
+std::set<NodeID> get_ancestors(const INode &node)
+{
+    std::set<NodeID>           ancestors;
+    std::vector<const INode *> to_visit{&node};
+    while (!to_visit.empty())
+    {
+        const INode *n = to_visit.back();
+        to_visit.pop_back();
+        for (size_t i = 0; i < n->num_inputs(); ++i)
+        {
+            const Edge *edge = n->input_edge(i);
+            if (edge != nullptr && edge->producer() != nullptr && ancestors.insert(edge->producer_id()).second)
+            {
+                to_visit.push_back(edge->producer());
+            }
+        }
+    }
+    return ancestors;
+}
+
+void fuse_convolution_with_eltwise_add(Graph                      &g,
+                                       const Edge                 *output_edge,
+                                       const std::set<Activation> &supported_fused_activations)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(output_edge->producer());
+    auto *eltwise_node = arm_compute::utils::cast::polymorphic_downcast<EltwiseLayerNode *>(output_edge->consumer());
+
+    // Accumulating into the destination is only supported by the NHWC assembly convolutions of the CPU on float data.
+    // The activation of the convolution must not be applied before the addition.
+    Tensor                 *conv_output = conv_node->output(0);
+    const Tensor           *weights     = conv_node->input(1);
+    const TensorDescriptor &desc        = conv_output->desc();
+    const ConvolutionMethod method      = conv_node->convolution_method();
+    if (eltwise_node->assigned_target() != Target::NEON || eltwise_node->eltwise_operation() != EltwiseOperation::Add ||
+        eltwise_node->fused_activation().enabled() || conv_node->fused_activation().enabled() ||
+        conv_node->num_groups() != 1 || (method != ConvolutionMethod::Default && method != ConvolutionMethod::GEMM) ||
+        desc.layout != DataLayout::NHWC || weights == nullptr || weights->desc().layout != DataLayout::NHWC ||
+        !is_data_type_float(desc.data_type) || (desc.data_type == DataType::F16 && !CPUInfo::get().has_fp16()) ||
+        conv_output->accessor() != nullptr)
+    {
+        return;
+    }
+
+    // The convolution writes into the memory of the addend, which must be a computed NEON tensor of the same shape
+    const Edge   *addend_edge = eltwise_node->input_edge(1 - output_edge->consumer_idx());
+    Tensor       *addend      = addend_edge != nullptr ? addend_edge->tensor() : nullptr;
+    const INode  *producer    = addend_edge != nullptr ? addend_edge->producer() : nullptr;
+    Tensor       *sum         = eltwise_node->output(0);
+    if (addend == nullptr || producer == nullptr || producer->type() == NodeType::Input ||
+        producer->type() == NodeType::Const || addend->accessor() != nullptr || addend->desc().target != Target::NEON ||
+        addend->desc().shape != desc.shape || addend->desc().data_type != desc.data_type ||
+        addend->desc().layout != desc.layout || sum == nullptr || sum->desc().shape != desc.shape)
+    {
+        return;
+    }
+
+    // Every other reader of the addend must have been executed before the convolution overwrites it
+    const std::set<NodeID> conv_ancestors = get_ancestors(*conv_node);
+    for (const auto &edge_id : addend->bound_edges())
+    {
+        const Edge *edge = g.edge(edge_id);
+        if (edge != nullptr && edge != addend_edge && conv_ancestors.count(edge->consumer_id()) == 0)
+        {
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of convolution with eltwise add as the addend is read "
+                                          "after the convolution\n");
+            return;
+        }
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing convolution node with ID : " << output_edge->producer_id()
+                                                                       << " with Eltwise Add node with ID : "
+                                                                       << output_edge->consumer_id() << std::endl);
+
+    // Fold the activation following the addition, it is applied to the accumulated result
+    INode              *last = eltwise_node;
+    ActivationLayerInfo fused_act{};
+    if (eltwise_node->output_edges().size() == 1 && sum->accessor() == nullptr)
+    {
+        INode *next = g.edge(*eltwise_node->output_edges().begin())->consumer();
+        if (next != nullptr && next->type() == NodeType::ActivationLayer && next->assigned_target() == Target::NEON)
+        {
+            const auto act_info =
+                arm_compute::utils::cast::polymorphic_downcast<ActivationLayerNode *>(next)->activation_info();
+            if (supported_fused_activations.count(act_info.activation()) != 0)
+            {
+                fused_act = act_info;
+                last      = next;
+            }
+        }
+    }
+
+    // Extract conv inputs
+    const Edge       *input_edge = conv_node->input_edge(0);
+    const Edge       *bias_edge  = conv_node->input_edge(2);
+    const NodeIdxPair input{input_edge->producer_id(), input_edge->producer_idx()};
+    const NodeIdxPair addend_src{addend_edge->producer_id(), addend_edge->producer_idx()};
+    const NodeID      weights_id = conv_node->input_edge(1)->producer_id();
+
+    // Create the fused node and let it accumulate in place into the addend
+    const NodeID fused_id = g.add_node<FusedConvolutionEltwiseAddNode>(conv_node->convolution_info(),
+                                                                       conv_node->fast_math_hint(), fused_act);
+    g.add_connection(input.node_id, input.index, fused_id, 0);
+    g.add_connection(weights_id, 0, fused_id, 1);
+    if (bias_edge != nullptr)
+    {
+        g.add_connection(bias_edge->producer_id(), 0, fused_id, 2);
+    }
+    g.add_connection(addend_src.node_id, addend_src.index, fused_id, 3);
+
+    auto fused_node = g.node(fused_id);
+    fused_node->set_output_tensor(addend->id(), 0);
+
+    std::string name = conv_node->name() + "+" + eltwise_node->name();
+    if (last != eltwise_node)
+    {
+        name += "+" + last->name();
+    }
+
+    transfer_driving_nodes_and_remove_old_node(g, fused_node, last, false);
+
+    fused_node->set_assigned_target(Target::NEON);
+    fused_node->set_common_node_parameters(NodeParams{name, Target::NEON});
+
+    // Remove the rest of the fused nodes
+    if (last != eltwise_node)
+    {
+        g.remove_node(eltwise_node->id());
+    }
+    g.remove_node(conv_node->id());
+}
+
+void fuse_convolution_with_pooling(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(output_edge->producer());
+    auto *pool_node = arm_compute::utils::cast::polymorphic_downcast<PoolingLayerNode *>(output_edge->consumer());
+
+    // Only 2x2 max pooling of stride 2 without padding is computed on the output bands of NHWC float convolutions
+    Tensor                 *conv_output = conv_node->output(0);
+    const Tensor           *weights     = conv_node->input(1);
+    const TensorDescriptor &desc        = conv_output->desc();
+    const ConvolutionMethod method      = conv_node->convolution_method();
+    const PoolingLayerInfo  pool_info   = pool_node->pooling_info();
+    const PadStrideInfo    &pool_stride = pool_info.pad_stride_info;
+    if (pool_node->assigned_target() != Target::NEON || pool_info.pool_type != PoolingType::MAX ||
+        pool_info.is_global_pooling || pool_info.pool_size != Size2D(2U, 2U) ||
+        pool_stride.stride() != std::make_pair(2U, 2U) || pool_stride.has_padding() || conv_node->num_groups() != 1 ||
+        (method != ConvolutionMethod::Default && method != ConvolutionMethod::GEMM) ||
+        desc.layout != DataLayout::NHWC || weights == nullptr || weights->desc().layout != DataLayout::NHWC ||
+        !is_data_type_float(desc.data_type) || (desc.data_type == DataType::F16 && !CPUInfo::get().has_fp16()) ||
+        conv_output->accessor() != nullptr)
+    {
+        return;
+    }
+
+    // The bands must hold at least one pair of rows to pool
+    const size_t idx_height = get_dimension_idx(desc.layout, DataLayoutDimension::HEIGHT);
+    if (desc.shape[idx_height] < 2U * pool_node->output(0)->desc().shape[idx_height])
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing convolution node with ID : " << output_edge->producer_id()
+                                                                       << " with Pooling Layer node with ID : "
+                                                                       << output_edge->consumer_id() << std::endl);
+
+    // Extract conv inputs
+    const Edge       *input_edge = conv_node->input_edge(0);
+    const Edge       *bias_edge  = conv_node->input_edge(2);
+    const NodeIdxPair input{input_edge->producer_id(), input_edge->producer_idx()};
+    const NodeID      weights_id = conv_node->input_edge(1)->producer_id();
+
+    // The activation fused into the convolution is applied before the pooling
+    const NodeID fused_id = g.add_node<FusedConvolutionPoolingNode>(
+        conv_node->convolution_info(), pool_info, conv_node->fast_math_hint(), conv_node->fused_activation());
+    g.add_connection(input.node_id, input.index, fused_id, 0);
+    g.add_connection(weights_id, 0, fused_id, 1);
+    if (bias_edge != nullptr)
+    {
+        g.add_connection(bias_edge->producer_id(), 0, fused_id, 2);
+    }
+
+    auto fused_node = g.node(fused_id);
+    transfer_driving_nodes_and_remove_old_node(g, fused_node, pool_node, true);
+
+    fused_node->set_assigned_target(Target::NEON);
+    fused_node->set_common_node_parameters(NodeParams{conv_node->name() + "+" + pool_node->name(), Target::NEON});
+
+    // The convolution output is no longer needed
+    g.remove_node(conv_node->id());
+}
+
+void fuse_depthwise_with_pointwise_convolution(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *dwc_node = arm_compute::utils::cast::polymorphic_downcast<DepthwiseConvolutionLayerNode *>(
+        output_edge->producer());
+    auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(output_edge->consumer());
+
+    // Only 1x1 convolutions of stride 1 without padding consume the depthwise output of NHWC float data band by band.
+    // The depthwise activation must be fused by the assembly kernels.
+    Tensor                   *dwc_output  = dwc_node->output(0);
+    const Tensor             *dwc_weights = dwc_node->input(1);
+    const Tensor             *weights     = conv_node->input(1);
+    const TensorDescriptor   &desc        = dwc_output->desc();
+    const ConvolutionMethod   method      = conv_node->convolution_method();
+    const PadStrideInfo       conv_info   = conv_node->convolution_info();
+    const ActivationLayerInfo dwc_act     = dwc_node->fused_activation();
+    if (conv_node->assigned_target() != Target::NEON || output_edge->consumer_idx() != 0 ||
+        conv_node->num_groups() != 1 || (method != ConvolutionMethod::Default && method != ConvolutionMethod::GEMM) ||
+        conv_info.stride() != std::make_pair(1U, 1U) || conv_info.has_padding() ||
+        dwc_node->depthwise_convolution_method() != DepthwiseConvolutionMethod::Default ||
+        desc.layout != DataLayout::NHWC || dwc_weights == nullptr || weights == nullptr ||
+        weights->desc().layout != DataLayout::NHWC ||
+        weights->desc().shape[get_dimension_idx(DataLayout::NHWC, DataLayoutDimension::WIDTH)] != 1U ||
+        weights->desc().shape[get_dimension_idx(DataLayout::NHWC, DataLayoutDimension::HEIGHT)] != 1U ||
+        !is_data_type_float(desc.data_type) || (desc.data_type == DataType::F16 && !CPUInfo::get().has_fp16()) ||
+        (dwc_act.enabled() && dwc_act.activation() != ActivationLayerInfo::ActivationFunction::RELU &&
+         dwc_act.activation() != ActivationLayerInfo::ActivationFunction::BOUNDED_RELU &&
+         dwc_act.activation() != ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU) ||
+        dwc_output->accessor() != nullptr)
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing depthwise convolution node with ID : "
+                                  << output_edge->producer_id() << " with Convolution Layer node with ID : "
+                                  << output_edge->consumer_id() << std::endl);
+
+    // Extract depthwise and pointwise inputs
+    const Edge       *input_edge     = dwc_node->input_edge(0);
+    const Edge       *dwc_bias_edge  = dwc_node->input_edge(2);
+    const Edge       *conv_bias_edge = conv_node->input_edge(2);
+    const NodeIdxPair input{input_edge->producer_id(), input_edge->producer_idx()};
+
+    const NodeID fused_id = g.add_node<FusedDepthwiseSeparableConvolutionNode>(
+        dwc_node->convolution_info(), dwc_node->depth_multiplier(), dwc_act, conv_info, conv_node->fast_math_hint(),
+        conv_node->fused_activation());
+    g.add_connection(input.node_id, input.index, fused_id, 0);
+    g.add_connection(dwc_node->input_edge(1)->producer_id(), 0, fused_id, 1);
+    if (dwc_bias_edge != nullptr)
+    {
+        g.add_connection(dwc_bias_edge->producer_id(), 0, fused_id, 2);
+    }
+    g.add_connection(conv_node->input_edge(1)->producer_id(), 0, fused_id, 3);
+    if (conv_bias_edge != nullptr)
+    {
+        g.add_connection(conv_bias_edge->producer_id(), 0, fused_id, 4);
+    }
+
+    auto fused_node = g.node(fused_id);
+    transfer_driving_nodes_and_remove_old_node(g, fused_node, conv_node, true);
+
+    fused_node->set_assigned_target(Target::NEON);
+    fused_node->set_common_node_parameters(NodeParams{dwc_node->name() + "+" + conv_node->name(), Target::NEON});
+
+    // The depthwise output is no longer needed
+    g.remove_node(dwc_node->id());
+}
+
+void fuse_expansion_with_depthwise_separable_convolution(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(output_edge->producer());
+    auto *fused_node = arm_compute::utils::cast::polymorphic_downcast<FusedDepthwiseSeparableConvolutionNode *>(
+        output_edge->consumer());
+
+    // The expansion convolution of inverted residual blocks is computed band by band as well, under the same
+    // restrictions as the pointwise convolution
+    Tensor                 *conv_output = conv_node->output(0);
+    const Tensor           *weights     = conv_node->input(1);
+    const ConvolutionMethod method      = conv_node->convolution_method();
+    const PadStrideInfo     conv_info   = conv_node->convolution_info();
+    if (conv_node->assigned_target() != Target::NEON || output_edge->consumer_idx() != 0 ||
+        fused_node->input_edge(5) != nullptr || conv_node->num_groups() != 1 ||
+        (method != ConvolutionMethod::Default && method != ConvolutionMethod::GEMM) ||
+        conv_info.stride() != std::make_pair(1U, 1U) || conv_info.has_padding() || weights == nullptr ||
+        weights->desc().layout != DataLayout::NHWC ||
+        weights->desc().shape[get_dimension_idx(DataLayout::NHWC, DataLayoutDimension::WIDTH)] != 1U ||
+        weights->desc().shape[get_dimension_idx(DataLayout::NHWC, DataLayoutDimension::HEIGHT)] != 1U ||
+        conv_output->desc().data_type != fused_node->output(0)->desc().data_type ||
+        conv_output->accessor() != nullptr)
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing convolution node with ID : "
+                                  << output_edge->producer_id()
+                                  << " with Fused Depthwise Separable Convolution node with ID : "
+                                  << output_edge->consumer_id() << std::endl);
+
+    // Extract the expansion inputs before the convolution is removed
+    const Edge       *input_edge = conv_node->input_edge(0);
+    const Edge       *bias_edge  = conv_node->input_edge(2);
+    const NodeIdxPair input{input_edge->producer_id(), input_edge->producer_idx()};
+    const NodeID      weights_id = conv_node->input_edge(1)->producer_id();
+    const NodeID      bias_id    = bias_edge != nullptr ? bias_edge->producer_id() : EmptyNodeID;
+    const std::string name       = conv_node->name() + "+" + fused_node->name();
+
+    fused_node->set_expansion_activation(conv_node->fused_activation());
+    g.remove_node(conv_node->id());
+
+    g.add_connection(input.node_id, input.index, fused_node->id(), 0);
+    g.add_connection(weights_id, 0, fused_node->id(), 5);
+    if (bias_id != EmptyNodeID)
+    {
+        g.add_connection(bias_id, 0, fused_node->id(), 6);
+    }
+    fused_node->set_common_node_parameters(NodeParams{name, Target::NEON});
+}
+
+/** Appends the operations computed by a node to an elementwise chain
+ *
+ * @param[in]     node        Node to append
+ * @param[in]     target      Target of the chain, NEON or CL
+ * @param[in]     running_idx Input index of the node receiving the running value of the chain
+ * @param[in]     operand     Index the operand of a binary node would get in the chain
+ * @param[in,out] chain       Chain to append the operations to
+ *
+ * @return True if the node can be evaluated as part of an elementwise chain
+ */
+bool append_to_elementwise_chain(const INode          &node,
+                                 Target                target,
+                                 unsigned int          running_idx,
+                                 unsigned int          operand,
+                                 ElementwiseChainInfo &chain)
+{
+    // Activations the fused ukernels can evaluate in registers
+    const std::set<Activation> supported_chain_activations = {
+        Activation::ABS,      Activation::BOUNDED_RELU,    Activation::HARD_SWISH,
+        Activation::IDENTITY, Activation::LEAKY_RELU,      Activation::LINEAR,
+        Activation::LOGISTIC, Activation::LU_BOUNDED_RELU, Activation::RELU,
+        Activation::SQUARE,   Activation::TANH};
+    // The generated CL kernels also evaluate the other activations of activation_float_helpers.h
+    const std::set<Activation> supported_cl_chain_activations = {Activation::ELU, Activation::GELU,
+                                                                 Activation::SOFT_RELU, Activation::SQRT};
+    const auto is_supported_activation = [&](Activation act)
+    {
+        return supported_chain_activations.count(act) != 0 ||
+               (target == Target::CL && supported_cl_chain_activations.count(act) != 0);
+    };
+
+    if ((target != Target::NEON && target != Target::CL) || node.assigned_target() != target ||
+        node.num_outputs() != 1 || node.output(0) == nullptr)
+    {
+        return false;
+    }
+
+    // Chains are evaluated on float data without broadcasting. CL nodes already running in F16 imply a device
+    // supporting it.
+    const TensorDescriptor &dst_desc = node.output(0)->desc();
+    if (!is_data_type_float(dst_desc.data_type) ||
+        (target == Target::NEON && dst_desc.data_type == DataType::F16 && !CPUInfo::get().has_fp16()))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Tensor *src = node.input(i);
+        if (src == nullptr || src->desc().data_type != dst_desc.data_type || src->desc().shape != dst_desc.shape)
+        {
+            return false;
+        }
+    }
+
+    switch (node.type())
+    {
+        case NodeType::ActivationLayer:
+        {
+            const auto *act_node = arm_compute::utils::cast::polymorphic_downcast<const ActivationLayerNode *>(&node);
+            const auto  act_info = act_node->activation_info();
+            if (!is_supported_activation(act_info.activation()))
+            {
+                return false;
+            }
+            chain.emplace_back(act_info);
+            return true;
+        }
+        case NodeType::EltwiseLayer:
+        {
+            const auto *eltwise_node = arm_compute::utils::cast::polymorphic_downcast<const EltwiseLayerNode *>(&node);
+            const auto  act_info     = eltwise_node->fused_activation();
+            if (act_info.enabled() && !is_supported_activation(act_info.activation()))
+            {
+                return false;
+            }
+
+            ElementwiseChainOpType op_type = ElementwiseChainOpType::ADD;
+            switch (eltwise_node->eltwise_operation())
+            {
+                case EltwiseOperation::Add:
+                    op_type = ElementwiseChainOpType::ADD;
+                    break;
+                case EltwiseOperation::Sub:
+                    op_type = ElementwiseChainOpType::SUB;
+                    break;
+                case EltwiseOperation::Mul:
+                    op_type = ElementwiseChainOpType::MUL;
+                    break;
+                case EltwiseOperation::Max:
+                    op_type = ElementwiseChainOpType::MAX;
+                    break;
+                case EltwiseOperation::Div:
+                    op_type = ElementwiseChainOpType::DIV;
+                    break;
+                case EltwiseOperation::Min:
+                    op_type = ElementwiseChainOpType::MIN;
+                    break;
+                default:
+                    return false;
+            }
+            chain.emplace_back(op_type, operand, running_idx == 1);
+            if (act_info.enabled())
+            {
+                chain.emplace_back(act_info);
+            }
+            return true;
+        }
+        case NodeType::UnaryEltwiseLayer:
+        {
+            const auto *unary_node =
+                arm_compute::utils::cast::polymorphic_downcast<const UnaryEltwiseLayerNode *>(&node);
+            if (unary_node->eltwise_descriptor().op != UnaryEltwiseOperation::Exp)
+            {
+                return false;
+            }
+            chain.emplace_back(ElementwiseChainOpType::EXP);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+void fuse_elementwise_chains(Graph &g)
+{
+    // Note that fused nodes may be added to the end of the node list, they are not chainable so they stop the walk.
+    for (unsigned int i = 0; i < g.nodes().size(); ++i)
+    {
+        INode *first = g.node(i);
+        if (first == nullptr)
+        {
+            continue;
+        }
+
+        // The chain starts from input 0 of its first node, the other inputs of binary nodes are operands
+        const Target             target = first->assigned_target();
+        ElementwiseChainInfo     chain;
+        std::vector<INode *>     chain_nodes;
+        std::vector<NodeIdxPair> operands;
+        if (!append_to_elementwise_chain(*first, target, 0, 0, chain))
+        {
+            continue;
+        }
+        chain_nodes.push_back(first);
+        if (first->num_inputs() == 2)
+        {
+            operands.push_back({first->input_edge(1)->producer_id(), first->input_edge(1)->producer_idx()});
+        }
+
+        // Walk forward while the running value has a single consumer and is not read back by an accessor
+        DataType         out_data_type = DataType::UNKNOWN;
+        QuantizationInfo out_quant_info;
+        INode           *last = first;
+        while (last->output_edges().size() == 1 && last->output(0)->accessor() == nullptr)
+        {
+            const Edge *edge = g.edge(*last->output_edges().begin());
+            INode      *next = edge->consumer();
+            if (next == nullptr || next->assigned_target() != target)
+            {
+                break;
+            }
+
+            // A float to 8-bit quantization ends the chain. The CL kernels also quantize from F16 and cast between
+            // float types on store.
+            const DataType running_dt = last->output(0)->desc().data_type;
+            if (next->type() == NodeType::QuantizationLayer ||
+                (target == Target::CL && next->type() == NodeType::CastLayer))
+            {
+                const TensorDescriptor &dst_desc = next->output(0)->desc();
+                const bool is_quantization = next->type() == NodeType::QuantizationLayer &&
+                                             (running_dt == DataType::F32 || target == Target::CL) &&
+                                             (dst_desc.data_type == DataType::QASYMM8 ||
+                                              dst_desc.data_type == DataType::QASYMM8_SIGNED);
+                const bool is_float_cast =
+                    next->type() == NodeType::CastLayer && is_data_type_float(dst_desc.data_type);
+                if (is_quantization || is_float_cast)
+                {
+                    out_data_type  = dst_desc.data_type;
+                    out_quant_info = dst_desc.quant_info;
+                    chain_nodes.push_back(next);
+                    last = next;
+                }
+                break;
+            }
+
+            const unsigned int running_idx = edge->consumer_idx();
+            if (!append_to_elementwise_chain(*next, target, running_idx, operands.size(), chain))
+            {
+                break;
+            }
+            if (next->num_inputs() == 2)
+            {
+                const Edge *operand_edge = next->input_edge(1 - running_idx);
+                operands.push_back({operand_edge->producer_id(), operand_edge->producer_idx()});
+            }
+            chain_nodes.push_back(next);
+            last = next;
+        }
+
+        // A single node is better served by its own function
+        if (chain_nodes.size() < 2)
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing " << chain_nodes.size()
+                                                << " elementwise nodes starting at node with ID : " << first->id()
+                                                << std::endl);
+
+        const Edge       *input_edge = first->input_edge(0);
+        const NodeIdxPair input{input_edge->producer_id(), input_edge->producer_idx()};
+        std::string       name = first->name();
+        for (size_t n = 1; n < chain_nodes.size(); ++n)
+        {
+            name += "+" + chain_nodes[n]->name();
+        }
+
+        // Create the fused node and connect the input and the operands of the chain
+        const NodeID fused_id = g.add_node<FusedElementwiseChainNode>(chain, operands.size(), out_data_type,
+                                                                      out_quant_info);
+        g.add_connection(input.node_id, input.index, fused_id, 0);
+        for (size_t op = 0; op < operands.size(); ++op)
+        {
+            g.add_connection(operands[op].node_id, operands[op].index, fused_id, op + 1);
+        }
+
+        auto fused_node = g.node(fused_id);
+
+        transfer_driving_nodes_and_remove_old_node(g, fused_node, last, true);
+
+        fused_node->set_assigned_target(target);
+        fused_node->set_common_node_parameters(NodeParams{name, target});
+
+        // Remove the rest of the chain, the last node was removed when transferring its driving nodes
+        for (size_t n = 0; n + 1 < chain_nodes.size(); ++n)
+        {
+            g.remove_node(chain_nodes[n]->id());
+        }
+    }
+}
+
+/** Append the data movement of a node to a copy program
+ *
+ * @param[in]     node    Node to append
+ * @param[in,out] program Program to append the data movement to
+ *
+ * @return True if the node can be performed as part of a copy program
+ */
+bool append_to_copy_program(const INode &node, CopyProgramInfo &program)
+{
+    // Copy programs move the elements of up to 4D tensors
+    constexpr size_t max_copy_program_dims = 4;
+
+    if (node.assigned_target() != Target::CL || node.num_inputs() != 1 || node.num_outputs() != 1 ||
+        node.input(0) == nullptr || node.output(0) == nullptr)
+    {
+        return false;
+    }
+
+    const TensorDescriptor &src_desc = node.input(0)->desc();
+    const TensorDescriptor &dst_desc = node.output(0)->desc();
+    if (src_desc.shape.num_dimensions() > max_copy_program_dims ||
+        dst_desc.shape.num_dimensions() > max_copy_program_dims)
+    {
+        return false;
+    }
+
+    switch (node.type())
+    {
+        case NodeType::FlattenLayer:
+        case NodeType::ReshapeLayer:
+            program.emplace_back(dst_desc.shape);
+            return true;
+        case NodeType::PermuteLayer:
+        {
+            const auto *permute_node = arm_compute::utils::cast::polymorphic_downcast<const PermuteLayerNode *>(&node);
+            program.emplace_back(permute_node->permutation_vector());
+            return true;
+        }
+        case NodeType::SliceLayer:
+        {
+            const auto *slice_node = arm_compute::utils::cast::polymorphic_downcast<const SliceLayerNode *>(&node);
+            const auto  ends       = slice_node->ends();
+            const auto  coords     = arm_compute::helpers::tensor_transform::calculate_strided_slice_coords(
+                src_desc.shape, slice_node->starts(), ends, BiStrides(), 0,
+                arm_compute::helpers::tensor_transform::construct_slice_end_mask(ends));
+            program.emplace_back(std::get<0>(coords), std::get<2>(coords), dst_desc.shape);
+            return true;
+        }
+        case NodeType::StridedSliceLayer:
+        {
+            const auto *slice_node =
+                arm_compute::utils::cast::polymorphic_downcast<const StridedSliceLayerNode *>(&node);
+            const StridedSliceLayerInfo info = slice_node->strided_slice_info();
+            // Shrunk dimensions change the rank of the output
+            if (info.shrink_axis_mask() != 0)
+            {
+                return false;
+            }
+            const auto coords = arm_compute::helpers::tensor_transform::calculate_strided_slice_coords(
+                src_desc.shape, slice_node->starts(), slice_node->ends(), slice_node->strides(), info.begin_mask(),
+                info.end_mask());
+            // Reversed slices walk the input backwards, the kernel only supports positive strides
+            const Coordinates &strides = std::get<2>(coords);
+            for (size_t i = 0; i < strides.num_dimensions(); ++i)
+            {
+                if (strides[i] <= 0)
+                {
+                    return false;
+                }
+            }
+            program.emplace_back(std::get<0>(coords), strides, dst_desc.shape);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+void fuse_copy_programs(Graph &g)
+{
+    // Number of stages the copy program kernel evaluates
+    constexpr size_t max_copy_program_stages = 8;
+
+    // Note that fused nodes may be added to the end of the node list, they are not fusable so they stop the walk.
+    for (unsigned int i = 0; i < g.nodes().size(); ++i)
+    {
+        INode *first = g.node(i);
+        if (first == nullptr)
+        {
+            continue;
+        }
+
+        CopyProgramInfo      program;
+        std::vector<INode *> program_nodes;
+        if (!append_to_copy_program(*first, program))
+        {
+            continue;
+        }
+        program_nodes.push_back(first);
+
+        // Walk forward while the intermediate tensor has a single consumer and is not read back by an accessor
+        INode *last = first;
+        while (program.size() < max_copy_program_stages && last->output_edges().size() == 1 &&
+               last->output(0)->accessor() == nullptr)
+        {
+            INode *next = g.edge(*last->output_edges().begin())->consumer();
+            if (next == nullptr || !append_to_copy_program(*next, program))
+            {
+                break;
+            }
+            program_nodes.push_back(next);
+            last = next;
+        }
+
+        // A single node is better served by its own function
+        if (program_nodes.size() < 2)
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing " << program_nodes.size()
+                                                << " data movement nodes starting at node with ID : " << first->id()
+                                                << std::endl);
+
+        const Edge       *input_edge = first->input_edge(0);
+        const NodeIdxPair input{input_edge->producer_id(), input_edge->producer_idx()};
+        std::string       name = first->name();
+        for (size_t n = 1; n < program_nodes.size(); ++n)
+        {
+            name += "+" + program_nodes[n]->name();
+        }
+
+        // Create the fused node and connect the input of the program
+        const NodeID fused_id = g.add_node<FusedCopyProgramNode>(program, last->output(0)->desc().layout);
+        g.add_connection(input.node_id, input.index, fused_id, 0);
+
+        auto fused_node = g.node(fused_id);
+
+        transfer_driving_nodes_and_remove_old_node(g, fused_node, last, true);
+
+        fused_node->set_assigned_target(Target::CL);
+        fused_node->set_common_node_parameters(NodeParams{name, Target::CL});
+
+        // Remove the rest of the program, the last node was removed when transferring its driving nodes
+        for (size_t n = 0; n + 1 < program_nodes.size(); ++n)
+        {
+            g.remove_node(program_nodes[n]->id());
+        }
+    }
+}
 } // namespace detail
 
 const char *NodeFusionMutator::name()
@@ -387,9 +1669,10 @@ void NodeFusionMutator::mutate(Graph &g)
         Activation::SQUARE,     Activation::TANH};
 
     // Preconditions
-    auto empty_prec     = [](INode &) { return true; };
-    auto cl_target_prec = [](INode &n) { return n.assigned_target() == Target::CL; };
-    auto qs8_prec       = [&g](INode &n)
+    auto empty_prec       = [](INode &) { return true; };
+    auto cl_target_prec   = [](INode &n) { return n.assigned_target() == Target::CL; };
+    auto neon_target_prec = [](INode &n) { return n.assigned_target() == Target::NEON; };
+    auto qs8_prec         = [&g](INode &n)
     {
         ARM_COMPUTE_ERROR_ON(n.output(0) == nullptr);
 
@@ -408,6 +1691,8 @@ void NodeFusionMutator::mutate(Graph &g)
                                                            detail::fuse_pad_with_convolution<ConvolutionLayerNode>);
     detail::fuse_layer<PadLayerNode, DepthwiseConvolutionLayerNode>(
         g, empty_prec, detail::fuse_pad_with_convolution<DepthwiseConvolutionLayerNode>);
+    // The arg max of a classifier is taken on its logits rather than on their softmax
+    detail::fuse_layer<SoftmaxLayerNode, ArgMinMaxLayerNode>(g, empty_prec, detail::fuse_softmax_with_arg_min_max);
     detail::fuse_layer<BatchNormalizationLayerNode, ActivationLayerNode>(
         g, empty_prec, detail::fuse_node_with_activation<BatchNormalizationLayerNode>, supported_fused_activations);
     detail::fuse_layer<ConvolutionLayerNode, ActivationLayerNode>(
@@ -418,11 +1703,37 @@ void NodeFusionMutator::mutate(Graph &g)
         g, empty_prec, detail::fuse_node_with_activation<FullyConnectedLayerNode>, supported_fused_activations);
     detail::fuse_layer<EltwiseLayerNode, ActivationLayerNode>(
         g, cl_target_prec, detail::fuse_node_with_activation<EltwiseLayerNode>, supported_fused_activations);
+    // Channel shuffles are folded into the weights of the convolution producing or reading their channels
+    detail::fuse_layer<ConvolutionLayerNode, ChannelShuffleLayerNode>(g, empty_prec,
+                                                                      detail::fuse_convolution_with_channel_shuffle);
+    detail::fuse_layer<ChannelShuffleLayerNode, ConvolutionLayerNode>(g, empty_prec,
+                                                                      detail::fuse_channel_shuffle_with_convolution);
     // The fusion of BatchNormalizationLayer must occur after the fusion of ActivationLayer. Because FusedConvolutionBatchNormalizationNode assumes the BatchNormalization is already fused with activation, if any
     detail::fuse_layer<ConvolutionLayerNode, BatchNormalizationLayerNode>(
         g, empty_prec, detail::fuse_convolution_with_batch_normalization);
     detail::fuse_layer<DepthwiseConvolutionLayerNode, BatchNormalizationLayerNode>(
         g, empty_prec, detail::fuse_depthwise_convolution_with_batch_normalization);
+    // Standalone BatchNormalizationLayers left are folded forward into the weights of the linear layer reading them
+    detail::fuse_layer<BatchNormalizationLayerNode, ConvolutionLayerNode>(
+        g, empty_prec, detail::fuse_batch_normalization_with_linear_layer<ConvolutionLayerNode>);
+    detail::fuse_layer<BatchNormalizationLayerNode, FullyConnectedLayerNode>(
+        g, empty_prec, detail::fuse_batch_normalization_with_linear_layer<FullyConnectedLayerNode>);
+    // Accumulate convolutions into the addend of a following addition, e.g. the skip connection of residual blocks
+    detail::fuse_layer<ConvolutionLayerNode, EltwiseLayerNode>(
+        g, neon_target_prec, detail::fuse_convolution_with_eltwise_add, supported_fused_activations);
+    // Pool the output of convolutions while it is still in the cache
+    detail::fuse_layer<ConvolutionLayerNode, PoolingLayerNode>(g, neon_target_prec,
+                                                               detail::fuse_convolution_with_pooling);
+    // Feed the depthwise output of depthwise separable blocks to the pointwise convolution while it is in the cache
+    detail::fuse_layer<DepthwiseConvolutionLayerNode, ConvolutionLayerNode>(
+        g, neon_target_prec, detail::fuse_depthwise_with_pointwise_convolution);
+    // Compute the expansion convolution of inverted residual blocks band by band too
+    detail::fuse_layer<ConvolutionLayerNode, FusedDepthwiseSeparableConvolutionNode>(
+        g, neon_target_prec, detail::fuse_expansion_with_depthwise_separable_convolution);
+    // Elementwise chains are fused last, so that activations already merged into their producers are left out
+    detail::fuse_elementwise_chains(g);
+    // Runs of data movements on CL are performed by a single copy program kernel
+    detail::fuse_copy_programs(g);
 }
 } // namespace graph
 } // namespace arm_compute
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/SliceLayerSubTensorMutator.h"
+
+#include "arm_compute/core/utils/helpers/tensor_transform.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/SliceLayerNode.h"
+#include "arm_compute/graph/nodes/StridedSliceLayerNode.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+#include "support/Iterable.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Computes the coordinates of the output of a slice node in its input
+ *
+ * @param[in]  node        Slice or strided slice node
+ * @param[out] view_coords Coordinates of the first element of the output in the input
+ *
+ * @return True if the output of the node is a view of its input
+ */
+bool compute_view_coords(INode &node, Coordinates &view_coords)
+{
+    const TensorShape &input_shape = node.input(0)->desc().shape;
+    if (node.type() == NodeType::SliceLayer)
+    {
+        auto         *slice_node = arm_compute::utils::cast::polymorphic_downcast<SliceLayerNode *>(&node);
+        const int32_t end_mask = arm_compute::helpers::tensor_transform::construct_slice_end_mask(slice_node->ends());
+        return arm_compute::helpers::tensor_transform::is_strided_slice_view(
+            input_shape, slice_node->starts(), slice_node->ends(), BiStrides(), 0, end_mask, 0, view_coords);
+    }
+
+    auto *strided_slice_node = arm_compute::utils::cast::polymorphic_downcast<StridedSliceLayerNode *>(&node);
+    const StridedSliceLayerInfo info = strided_slice_node->strided_slice_info();
+    return arm_compute::helpers::tensor_transform::is_strided_slice_view(
+        input_shape, strided_slice_node->starts(), strided_slice_node->ends(), strided_slice_node->strides(),
+        info.begin_mask(), info.end_mask(), info.shrink_axis_mask(), view_coords);
+}
+
+/** Checks if the function of a node is skipped when its output is a view of its input
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the node only moves data
+ */
+bool is_view_node(const INode &node)
+{
+    return node.type() == NodeType::SliceLayer || node.type() == NodeType::StridedSliceLayer ||
+           node.type() == NodeType::ReshapeLayer || node.type() == NodeType::FlattenLayer;
+}
+
+/** Checks if a consumer of a tensor writes into it
+ *
+ * The consumers whose outputs are views of the tensor don't write, but the consumers of those views may.
+ *
+ * @param[in] g      Graph the tensor belongs to
+ * @param[in] tensor Tensor to check
+ *
+ * @return True if a consumer runs in-place on the tensor or writes into an alias of it
+ */
+bool is_written_by_consumers(const Graph &g, Tensor &tensor)
+{
+    for (const auto &eid : tensor.bound_edges())
+    {
+        INode *consumer = g.edge(eid)->consumer();
+        for (unsigned int i = 0; i < consumer->num_outputs(); ++i)
+        {
+            Tensor *consumer_output = consumer->output(i);
+            if (consumer_output == &tensor)
+            {
+                return true;
+            }
+            const bool is_alias = consumer_output != nullptr && consumer_output->handle() != nullptr &&
+                                  consumer_output->handle()->is_subtensor() &&
+                                  consumer_output->handle()->parent_handle() == tensor.handle()->parent_handle();
+            if (is_alias && (!is_view_node(*consumer) || is_written_by_consumers(g, *consumer_output)))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/** Checks that the output of a slice node can be replaced by a view of its input
+ *
+ * The input must be a tensor of its own and the output must not be read by an accessor. Neither of them can be written
+ * by their consumers, as the writes would reach the other one.
+ *
+ * @param[in] g    Graph the node belongs to
+ * @param[in] node Slice or strided slice node
+ *
+ * @return True if the output can be a view
+ */
+bool can_use_view(const Graph &g, INode &node)
+{
+    Tensor *input  = node.input(0);
+    Tensor *output = node.output(0);
+    if (input == nullptr || output == nullptr || node.assigned_target() != Target::NEON ||
+        input->desc().target != Target::NEON || output->desc().target != Target::NEON ||
+        input->desc().quant_info != output->desc().quant_info || output->accessor() != nullptr ||
+        input->handle() == nullptr || input->handle()->is_subtensor() || output->handle() == nullptr ||
+        output->handle()->is_subtensor())
+    {
+        return false;
+    }
+    return !is_written_by_consumers(g, *input) && !is_written_by_consumers(g, *output);
+}
+
+/** Validates the consumers of the output of a slice node once it is a view
+ *
+ * @param[in] g    Graph the node belongs to
+ * @param[in] node Slice or strided slice node
+ *
+ * @return True if all the consumers are valid
+ */
+bool are_consumers_valid(const Graph &g, const INode &node)
+{
+    for (const auto &eid : node.output_edges())
+    {
+        INode *consumer = g.edge(eid)->consumer();
+        if (!bool(backends::BackendRegistry::get().get_backend(consumer->assigned_target()).validate_node(*consumer)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+const char *SliceLayerSubTensorMutator::name()
+{
+    return "SliceLayerSubTensorMutator";
+}
+
+IGraphMutator::MutationType SliceLayerSubTensorMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void SliceLayerSubTensorMutator::mutate(Graph &g)
+{
+    // Early exit if no slice layers exist in graph
+    if (g.nodes(NodeType::SliceLayer).empty() && g.nodes(NodeType::StridedSliceLayer).empty())
+    {
+        return;
+    }
+
+    // Should be in reverse order of execution, so that the consumers of a view are known when it is created
+    std::vector<NodeID> topological_sorted_node_ids = dfs(g);
+    for (auto &node_id : arm_compute::utils::iterable::reverse_iterate(topological_sorted_node_ids))
+    {
+        INode *node = g.node(node_id);
+        if (node == nullptr ||
+            (node->type() != NodeType::SliceLayer && node->type() != NodeType::StridedSliceLayer) ||
+            !can_use_view(g, *node))
+        {
+            continue;
+        }
+
+        Coordinates view_coords;
+        if (!compute_view_coords(*node, view_coords))
+        {
+            continue;
+        }
+
+        Tensor                   *input   = node->input(0);
+        Tensor                   *output  = node->output(0);
+        backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(output->desc().target);
+        std::unique_ptr<ITensorHandle> view =
+            backend.create_subtensor(input->handle(), output->desc().shape, view_coords, false);
+        if (view == nullptr)
+        {
+            continue;
+        }
+        std::unique_ptr<ITensorHandle> handle = output->extract_handle();
+        output->set_handle(std::move(view));
+
+        // Fall back to the copy if a consumer cannot read the view
+        if (!are_consumers_valid(g, *node))
+        {
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Reverted the sub-tensor of the node with ID : " << node->id() << std::endl);
+            output->set_handle(std::move(handle));
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Using a sub-tensor for the node with ID : " << node->id() << " and name : "
+                                                                                 << node->name() << std::endl);
+    }
+}
+} // namespace graph
+} // namespace arm_compute
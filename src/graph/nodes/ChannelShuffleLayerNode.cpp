@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 Arm Limited.
+ * Copyright (c) 2018, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -66,7 +66,7 @@ TensorDescriptor ChannelShuffleLayerNode::configure_output(size_t idx) const
 
 NodeType ChannelShuffleLayerNode::type() const
 {
-    return NodeType::ChannelShuffleLayer;
+    return ChannelShuffleLayerNode::node_type;
 }
 
 void ChannelShuffleLayerNode::accept(INodeVisitor &v)
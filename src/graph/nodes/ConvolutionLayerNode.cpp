@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -93,6 +93,11 @@ void ConvolutionLayerNode::set_convolution_info(PadStrideInfo info)
     _info = info;
 }
 
+void ConvolutionLayerNode::set_output_quant_info(QuantizationInfo out_quant_info)
+{
+    _out_quant_info = std::move(out_quant_info);
+}
+
 TensorDescriptor ConvolutionLayerNode::compute_output_descriptor(const TensorDescriptor &input_descriptor,
                                                                  const TensorDescriptor &weights_descriptor,
                                                                  const PadStrideInfo    &info)
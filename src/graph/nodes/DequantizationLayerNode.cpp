@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019 Arm Limited.
+ * Copyright (c) 2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,7 +32,7 @@ namespace arm_compute
 {
 namespace graph
 {
-DequantizationLayerNode::DequantizationLayerNode()
+DequantizationLayerNode::DequantizationLayerNode(DataType out_data_type) : _out_data_type(out_data_type)
 {
     _input_edges.resize(1, EmptyEdgeID);
     _outputs.resize(1, NullTensorID);
@@ -59,7 +59,7 @@ TensorDescriptor DequantizationLayerNode::configure_output(size_t idx) const
     ARM_COMPUTE_ERROR_ON(src == nullptr);
 
     TensorDescriptor output_desc = src->desc();
-    output_desc.data_type        = DataType::F32;
+    output_desc.data_type        = _out_data_type;
 
     return output_desc;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -57,6 +57,11 @@ void FullyConnectedLayerNode::set_fused_activation(ActivationLayerInfo fused_act
     _info.activation_info = fused_activation;
 }
 
+void FullyConnectedLayerNode::set_output_quant_info(QuantizationInfo out_quant_info)
+{
+    _out_quant_info = std::move(out_quant_info);
+}
+
 TensorDescriptor FullyConnectedLayerNode::compute_weights_descriptor(const TensorDescriptor &input_descriptor,
                                                                      unsigned int            num_outputs,
                                                                      FullyConnectedLayerInfo fc_info,
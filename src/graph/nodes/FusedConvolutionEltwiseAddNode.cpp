@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/nodes/FusedConvolutionEltwiseAddNode.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+FusedConvolutionEltwiseAddNode::FusedConvolutionEltwiseAddNode(PadStrideInfo       info,
+                                                               FastMathHint        fast_math_hint,
+                                                               ActivationLayerInfo fused_activation)
+    : _info(std::move(info)), _fast_math_hint(fast_math_hint), _fused_activation(fused_activation)
+{
+    _input_edges.resize(4, EmptyEdgeID);
+    _outputs.resize(1, NullTensorID);
+}
+
+FastMathHint FusedConvolutionEltwiseAddNode::fast_math_hint() const
+{
+    return _fast_math_hint;
+}
+
+PadStrideInfo FusedConvolutionEltwiseAddNode::convolution_info() const
+{
+    return _info;
+}
+
+ActivationLayerInfo FusedConvolutionEltwiseAddNode::fused_activation() const
+{
+    return _fused_activation;
+}
+
+void FusedConvolutionEltwiseAddNode::set_fused_activation(ActivationLayerInfo fused_activation)
+{
+    _fused_activation = fused_activation;
+}
+
+bool FusedConvolutionEltwiseAddNode::forward_descriptors()
+{
+    if ((input_id(3) != NullTensorID) && (output_id(0) != NullTensorID))
+    {
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor FusedConvolutionEltwiseAddNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    ARM_COMPUTE_ERROR_ON(idx >= _outputs.size());
+
+    // The result has the descriptor of the addend it is accumulated into
+    const Tensor *addend = input(3);
+    ARM_COMPUTE_ERROR_ON(addend == nullptr);
+
+    return addend->desc();
+}
+
+NodeType FusedConvolutionEltwiseAddNode::type() const
+{
+    return FusedConvolutionEltwiseAddNode::node_type;
+}
+
+void FusedConvolutionEltwiseAddNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
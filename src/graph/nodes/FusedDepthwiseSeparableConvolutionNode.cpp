@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/nodes/FusedDepthwiseSeparableConvolutionNode.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+#include "arm_compute/graph/nodes/ConvolutionLayerNode.h"
+#include "arm_compute/graph/nodes/DepthwiseConvolutionLayerNode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+FusedDepthwiseSeparableConvolutionNode::FusedDepthwiseSeparableConvolutionNode(PadStrideInfo       depthwise_info,
+                                                                               int                 depth_multiplier,
+                                                                               ActivationLayerInfo depthwise_activation,
+                                                                               PadStrideInfo       pointwise_info,
+                                                                               FastMathHint        fast_math_hint,
+                                                                               ActivationLayerInfo fused_activation)
+    : _depthwise_info(std::move(depthwise_info)),
+      _depth_multiplier(depth_multiplier),
+      _depthwise_activation(depthwise_activation),
+      _pointwise_info(std::move(pointwise_info)),
+      _fast_math_hint(fast_math_hint),
+      _fused_activation(fused_activation),
+      _expansion_activation()
+{
+    _input_edges.resize(7, EmptyEdgeID);
+    _outputs.resize(1, NullTensorID);
+}
+
+PadStrideInfo FusedDepthwiseSeparableConvolutionNode::depthwise_convolution_info() const
+{
+    return _depthwise_info;
+}
+
+int FusedDepthwiseSeparableConvolutionNode::depth_multiplier() const
+{
+    return _depth_multiplier;
+}
+
+ActivationLayerInfo FusedDepthwiseSeparableConvolutionNode::depthwise_activation() const
+{
+    return _depthwise_activation;
+}
+
+PadStrideInfo FusedDepthwiseSeparableConvolutionNode::pointwise_convolution_info() const
+{
+    return _pointwise_info;
+}
+
+FastMathHint FusedDepthwiseSeparableConvolutionNode::fast_math_hint() const
+{
+    return _fast_math_hint;
+}
+
+ActivationLayerInfo FusedDepthwiseSeparableConvolutionNode::fused_activation() const
+{
+    return _fused_activation;
+}
+
+void FusedDepthwiseSeparableConvolutionNode::set_fused_activation(ActivationLayerInfo fused_activation)
+{
+    _fused_activation = fused_activation;
+}
+
+ActivationLayerInfo FusedDepthwiseSeparableConvolutionNode::expansion_activation() const
+{
+    return _expansion_activation;
+}
+
+void FusedDepthwiseSeparableConvolutionNode::set_expansion_activation(ActivationLayerInfo expansion_activation)
+{
+    _expansion_activation = expansion_activation;
+}
+
+bool FusedDepthwiseSeparableConvolutionNode::forward_descriptors()
+{
+    if ((input_id(0) != NullTensorID) && (input_id(1) != NullTensorID) && (input_id(3) != NullTensorID) &&
+        (output_id(0) != NullTensorID))
+    {
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor FusedDepthwiseSeparableConvolutionNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    ARM_COMPUTE_ERROR_ON(idx >= _outputs.size());
+
+    const Tensor *src               = input(0);
+    const Tensor *depthwise_weights = input(1);
+    const Tensor *pointwise_weights = input(3);
+    ARM_COMPUTE_ERROR_ON(src == nullptr || depthwise_weights == nullptr || pointwise_weights == nullptr);
+
+    // The depthwise convolution is applied to the output of the expansion convolution, if any
+    const Tensor          *expansion_weights = input(5);
+    const TensorDescriptor src_desc =
+        expansion_weights != nullptr
+            ? ConvolutionLayerNode::compute_output_descriptor(src->desc(), expansion_weights->desc(),
+                                                              PadStrideInfo(1, 1, 0, 0))
+            : src->desc();
+
+    // The pointwise convolution is applied to the output of the depthwise convolution
+    const TensorDescriptor depthwise_desc = DepthwiseConvolutionLayerNode::compute_output_descriptor(
+        src_desc, depthwise_weights->desc(), _depthwise_info, _depth_multiplier);
+    return ConvolutionLayerNode::compute_output_descriptor(depthwise_desc, pointwise_weights->desc(),
+                                                           _pointwise_info);
+}
+
+NodeType FusedDepthwiseSeparableConvolutionNode::type() const
+{
+    return FusedDepthwiseSeparableConvolutionNode::node_type;
+}
+
+void FusedDepthwiseSeparableConvolutionNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
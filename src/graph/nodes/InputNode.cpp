@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 Arm Limited.
+ * Copyright (c) 2018, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,11 @@ InputNode::InputNode(TensorDescriptor desc) : _desc(std::move(desc))
     _outputs.resize(1, NullTensorID);
 }
 
+void InputNode::set_shape(const TensorShape &shape)
+{
+    _desc.shape = shape;
+}
+
 bool InputNode::forward_descriptors()
 {
     if (output_id(0) != NullTensorID)
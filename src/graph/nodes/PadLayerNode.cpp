@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,6 +42,11 @@ const PaddingList &PadLayerNode::padding() const
     return _padding;
 }
 
+void PadLayerNode::set_padding(const PaddingList &padding)
+{
+    _padding = padding;
+}
+
 PixelValue PadLayerNode::pad_value() const
 {
     return _pad_value;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,6 +43,11 @@ PoolingLayerInfo PoolingLayerNode::pooling_info() const
     return _info;
 }
 
+void PoolingLayerNode::set_pooling_info(PoolingLayerInfo info)
+{
+    _info = std::move(info);
+}
+
 TensorDescriptor PoolingLayerNode::compute_output_descriptor(const TensorDescriptor &input_descriptor,
                                                              PoolingLayerInfo        info)
 {
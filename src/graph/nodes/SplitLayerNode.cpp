@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,11 @@ unsigned int SplitLayerNode::axis() const
     return _axis;
 }
 
+void SplitLayerNode::set_axis(int axis)
+{
+    _axis = axis;
+}
+
 std::pair<TensorDescriptor, Coordinates> SplitLayerNode::compute_output_descriptor(
     const TensorDescriptor &input_descriptor, unsigned int num_splits, int axis, unsigned int idx)
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
 #include "arm_compute/runtime/IMemoryPool.h"
 #include "arm_compute/runtime/Types.h"
 
+#include <numeric>
 #include <vector>
 
 using namespace arm_compute;
@@ -46,6 +47,8 @@ BlobMemoryPool::~BlobMemoryPool()
 
 void BlobMemoryPool::acquire(MemoryMappings &handles)
 {
+    restore();
+
     // Set memory to handlers
     for (auto &handle : handles)
     {
@@ -68,6 +71,26 @@ MappingType BlobMemoryPool::mapping_type() const
     return MappingType::BLOBS;
 }
 
+size_t BlobMemoryPool::allocated_size() const
+{
+    return std::accumulate(std::begin(_blobs), std::end(_blobs), size_t(0),
+                           [](size_t total, const std::unique_ptr<IMemoryRegion> &b)
+                           { return total + ((b != nullptr) ? b->size() : 0); });
+}
+
+void BlobMemoryPool::trim()
+{
+    free_blobs();
+}
+
+void BlobMemoryPool::restore()
+{
+    if (_blobs.empty())
+    {
+        allocate_blobs(_blob_info);
+    }
+}
+
 std::unique_ptr<IMemoryPool> BlobMemoryPool::duplicate()
 {
     ARM_COMPUTE_ERROR_ON(!_allocator);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,7 +27,8 @@
 
 namespace arm_compute
 {
-CLGEMMHeuristicsHandle::CLGEMMHeuristicsHandle() : _heuristics(std::make_unique<mlgo::MLGOHeuristics>())
+CLGEMMHeuristicsHandle::CLGEMMHeuristicsHandle()
+    : _heuristics(std::make_unique<mlgo::MLGOHeuristics>()), _tune_gemm_configs(false)
 {
 }
 CLGEMMHeuristicsHandle::~CLGEMMHeuristicsHandle() = default;
@@ -36,9 +37,25 @@ bool CLGEMMHeuristicsHandle::reload_from_file(const std::string &filename)
 {
     return _heuristics->reload_from_file(filename);
 }
+bool CLGEMMHeuristicsHandle::save_to_file(const std::string &filename) const
+{
+    return _heuristics->save_to_file(filename);
+}
+void CLGEMMHeuristicsHandle::set_tune_gemm_configs(bool tune_gemm_configs)
+{
+    _tune_gemm_configs = tune_gemm_configs;
+}
+bool CLGEMMHeuristicsHandle::tune_gemm_configs() const
+{
+    return _tune_gemm_configs;
+}
 const mlgo::MLGOHeuristics *CLGEMMHeuristicsHandle::get() const
 {
     return _heuristics.get();
 }
+mlgo::MLGOHeuristics *CLGEMMHeuristicsHandle::get()
+{
+    return _heuristics.get();
+}
 
 } // namespace arm_compute
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLKernelProfiler.h"
+
+#include "arm_compute/core/Error.h"
+
+#include "src/core/CL/ICLKernel.h"
+
+#include <utility>
+
+namespace arm_compute
+{
+struct CLKernelProfiler::Impl : public ICLKernelEventListener
+{
+    void dispatched(ICLKernel &kernel, const cl::NDRange &gws, const cl::NDRange &lws, const cl::Event &event) override
+    {
+        CLKernelProfile profile{};
+        profile.name      = kernel.kernel().getInfo<CL_KERNEL_FUNCTION_NAME>();
+        profile.config_id = kernel.config_id();
+        profile.gws       = gws;
+        profile.lws       = lws;
+        profiles.emplace_back(std::move(profile));
+        events.emplace_back(event);
+    }
+
+    /** Read the timings of the dispatches whose event has not been resolved yet */
+    void resolve_events()
+    {
+        for (; num_resolved < events.size(); ++num_resolved)
+        {
+            const cl::Event &event   = events[num_resolved];
+            CLKernelProfile &profile = profiles[num_resolved];
+            event.wait();
+            profile.queued_ns = event.getProfilingInfo<CL_PROFILING_COMMAND_QUEUED>();
+            profile.start_ns  = event.getProfilingInfo<CL_PROFILING_COMMAND_START>();
+            profile.end_ns    = event.getProfilingInfo<CL_PROFILING_COMMAND_END>();
+        }
+    }
+
+    ICLHardwareCounterSampler   *sampler{nullptr};
+    std::vector<CLKernelProfile> profiles{};
+    std::vector<cl::Event>       events{};
+    size_t                       num_resolved{0};
+    size_t                       first_of_kernel{0};
+};
+
+CLKernelProfiler::CLKernelProfiler() : _impl(std::make_unique<Impl>())
+{
+}
+
+CLKernelProfiler::CLKernelProfiler(CLKernelProfiler &&) = default;
+
+CLKernelProfiler &CLKernelProfiler::operator=(CLKernelProfiler &&) = default;
+
+CLKernelProfiler::~CLKernelProfiler() = default;
+
+void CLKernelProfiler::set_counter_sampler(ICLHardwareCounterSampler *sampler)
+{
+    _impl->sampler = sampler;
+}
+
+const std::vector<CLKernelProfile> &CLKernelProfiler::profiles()
+{
+    _impl->resolve_events();
+    return _impl->profiles;
+}
+
+void CLKernelProfiler::clear()
+{
+    _impl->profiles.clear();
+    _impl->events.clear();
+    _impl->num_resolved    = 0;
+    _impl->first_of_kernel = 0;
+}
+
+void CLKernelProfiler::begin_kernel(cl::CommandQueue &queue)
+{
+    if (_impl->sampler != nullptr)
+    {
+        // Make sure the counters only cover this kernel
+        queue.finish();
+        _impl->sampler->begin_kernel();
+    }
+    _impl->first_of_kernel = _impl->profiles.size();
+    set_kernel_event_listener(_impl.get());
+}
+
+void CLKernelProfiler::end_kernel(cl::CommandQueue &queue)
+{
+    set_kernel_event_listener(nullptr);
+    if (_impl->sampler != nullptr)
+    {
+        queue.finish();
+        const auto counters = _impl->sampler->end_kernel();
+
+        // A kernel can be split in several dispatches, all of them share the counters of the kernel
+        for (size_t i = _impl->first_of_kernel; i < _impl->profiles.size(); ++i)
+        {
+            _impl->profiles[i].counters = counters;
+        }
+    }
+}
+} // namespace arm_compute
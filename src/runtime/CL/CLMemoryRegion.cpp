@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,44 @@
 
 namespace arm_compute
 {
+namespace
+{
+/** Sub-buffer of a @ref CLBufferMemoryRegion
+ *
+ * The memory belongs to the parent buffer, which the sub-buffer keeps a reference to, so releasing a subregion does not
+ * need to flush the commands that may use it.
+ */
+class CLSubBufferMemoryRegion final : public ICLMemoryRegion
+{
+public:
+    /** Constructor
+     *
+     * @param[in] buffer Sub-buffer
+     * @param[in] size   Size of the sub-buffer
+     */
+    CLSubBufferMemoryRegion(const cl::Buffer &buffer, size_t size) : ICLMemoryRegion(size)
+    {
+        _mem = buffer;
+    }
+
+    // Inherited methods overridden :
+    void *ptr() override
+    {
+        return nullptr;
+    }
+    void *map(cl::CommandQueue &q, bool blocking) override
+    {
+        _mapping = q.enqueueMapBuffer(_mem, blocking ? CL_TRUE : CL_FALSE, CL_MAP_READ | CL_MAP_WRITE, 0, _size);
+        return _mapping;
+    }
+    void unmap(cl::CommandQueue &q) override
+    {
+        q.enqueueUnmapMemObject(_mem, _mapping);
+        _mapping = nullptr;
+    }
+};
+} // namespace
+
 ICLMemoryRegion::ICLMemoryRegion(size_t size)
     : IMemoryRegion(size), _ctx(CLScheduler::get().context()), _mapping(nullptr), _mem()
 {
@@ -103,6 +141,32 @@ void CLBufferMemoryRegion::unmap(cl::CommandQueue &q)
     _mapping = nullptr;
 }
 
+std::unique_ptr<IMemoryRegion> CLBufferMemoryRegion::extract_subregion(size_t offset, size_t size)
+{
+    if (_mem.get() == nullptr || size == 0 || offset + size > _size)
+    {
+        return nullptr;
+    }
+
+    // Pools extract the same subregions at every acquisition, so the sub-buffers are only created once
+    auto it = _sub_buffers.find(std::make_pair(offset, size));
+    if (it == _sub_buffers.end())
+    {
+        const cl_buffer_region region{offset, size};
+        cl_int                 err = CL_SUCCESS;
+        const cl::Buffer       sub_buffer =
+            _mem.createSubBuffer(CL_MEM_READ_WRITE, CL_BUFFER_CREATE_TYPE_REGION, &region, &err);
+        if (err != CL_SUCCESS)
+        {
+            ARM_COMPUTE_ERROR_VAR(
+                "Failed to create a sub-buffer at offset %zu (error %d), the offset may not be aligned", region.origin,
+                err);
+        }
+        it = _sub_buffers.emplace(std::make_pair(offset, size), sub_buffer).first;
+    }
+    return std::make_unique<CLSubBufferMemoryRegion>(it->second, size);
+}
+
 ICLSVMMemoryRegion::ICLSVMMemoryRegion(cl_mem_flags flags, size_t size, size_t alignment)
     : ICLMemoryRegion(size), _ptr(nullptr)
 {
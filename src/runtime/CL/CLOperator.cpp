@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,5 +53,16 @@ MemoryRequirements ICLOperator::workspace() const
 {
     return {};
 }
+
+OperatorDescription ICLOperator::describe() const
+{
+    OperatorDescription desc = IOperator::describe();
+    if (_kernel != nullptr)
+    {
+        // The configuration ID starts with the name of the kernel and carries its configuration
+        desc.kernels.emplace_back(_kernel->config_id());
+    }
+    return desc;
+}
 } // namespace experimental
 } // namespace arm_compute
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLRecordedQueue.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+
+#include "src/core/CL/ICLKernel.h"
+
+#include <set>
+#include <vector>
+
+namespace arm_compute
+{
+struct CLRecordedQueue::Impl : public ICLKernelRecorder
+{
+    /** Kernel dispatch */
+    struct Dispatch
+    {
+        cl::Kernel  kernel; /**< Kernel dispatched */
+        cl::NDRange gws;    /**< Global workgroup size */
+        cl::NDRange lws;    /**< Local workgroup size */
+    };
+
+    ~Impl()
+    {
+        release_command_buffer();
+    }
+
+    void record(const cl::Kernel &kernel, const cl::NDRange &gws, const cl::NDRange &lws) override
+    {
+        dispatches.push_back(Dispatch{kernel, gws, lws});
+
+        if (command_buffer != nullptr)
+        {
+            const cl_int err = clCommandNDRangeKernelKHR(command_buffer, nullptr, nullptr, kernel(), gws.dimensions(),
+                                                         nullptr, gws.get(), lws.dimensions() != 0 ? lws.get() : nullptr,
+                                                         0, nullptr, nullptr, nullptr);
+            if (err != CL_SUCCESS)
+            {
+                // Keep the recording of the dispatches only
+                release_command_buffer();
+            }
+        }
+    }
+
+    void release_command_buffer()
+    {
+        if (command_buffer != nullptr)
+        {
+            clReleaseCommandBufferKHR(command_buffer);
+            command_buffer = nullptr;
+        }
+    }
+
+    /** Check whether the dispatches can be replayed without setting the kernel arguments */
+    bool dispatches_are_replayable() const
+    {
+        std::set<cl_kernel> kernels;
+        for (const auto &dispatch : dispatches)
+        {
+            if (!kernels.insert(dispatch.kernel()).second)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    cl::CommandQueue      queue{};
+    std::vector<Dispatch> dispatches{};
+    cl_command_buffer_khr command_buffer{nullptr};
+    bool                  is_recording{false};
+    bool                  is_replayable{false};
+};
+
+CLRecordedQueue::CLRecordedQueue() : _impl(std::make_unique<Impl>())
+{
+}
+
+CLRecordedQueue::CLRecordedQueue(CLRecordedQueue &&) = default;
+
+CLRecordedQueue &CLRecordedQueue::operator=(CLRecordedQueue &&) = default;
+
+CLRecordedQueue::~CLRecordedQueue()
+{
+    if (_impl != nullptr && _impl->is_recording)
+    {
+        set_kernel_recorder(nullptr);
+    }
+}
+
+void CLRecordedQueue::begin_recording()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_impl->is_recording, "A recording is already in progress");
+    clear();
+
+    _impl->queue = CLScheduler::get().queue();
+    if (command_buffer_supported(_impl->queue.getInfo<CL_QUEUE_DEVICE>()))
+    {
+        cl_command_queue queue = _impl->queue();
+        cl_int           err   = CL_SUCCESS;
+        _impl->command_buffer  = clCreateCommandBufferKHR(1, &queue, nullptr, &err);
+        if (err != CL_SUCCESS)
+        {
+            _impl->command_buffer = nullptr;
+        }
+    }
+
+    _impl->is_recording = true;
+    set_kernel_recorder(_impl.get());
+}
+
+bool CLRecordedQueue::end_recording()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_impl->is_recording, "No recording in progress");
+    set_kernel_recorder(nullptr);
+    _impl->is_recording = false;
+
+    if (_impl->command_buffer != nullptr && clFinalizeCommandBufferKHR(_impl->command_buffer) != CL_SUCCESS)
+    {
+        _impl->release_command_buffer();
+    }
+    _impl->is_replayable = _impl->command_buffer != nullptr || _impl->dispatches_are_replayable();
+
+    return _impl->is_replayable;
+}
+
+bool CLRecordedQueue::is_replayable() const
+{
+    return _impl->is_replayable;
+}
+
+bool CLRecordedQueue::replay()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_impl->is_recording, "Cannot replay a recording in progress");
+    if (!_impl->is_replayable)
+    {
+        return false;
+    }
+
+    if (_impl->command_buffer != nullptr)
+    {
+        cl_int err = clEnqueueCommandBufferKHR(0, nullptr, _impl->command_buffer, 0, nullptr, nullptr);
+        if (err == CL_INVALID_OPERATION)
+        {
+            // The previous replay of a command buffer without simultaneous use is still pending
+            _impl->queue.finish();
+            err = clEnqueueCommandBufferKHR(0, nullptr, _impl->command_buffer, 0, nullptr, nullptr);
+        }
+        if (err == CL_SUCCESS)
+        {
+            _impl->queue.flush();
+            return true;
+        }
+
+        _impl->release_command_buffer();
+        _impl->is_replayable = _impl->dispatches_are_replayable();
+        if (!_impl->is_replayable)
+        {
+            return false;
+        }
+    }
+
+    for (const auto &dispatch : _impl->dispatches)
+    {
+        _impl->queue.enqueueNDRangeKernel(dispatch.kernel, cl::NullRange, dispatch.gws, dispatch.lws);
+    }
+    _impl->queue.flush();
+
+    return true;
+}
+
+void CLRecordedQueue::clear()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_impl->is_recording, "Cannot clear a recording in progress");
+    _impl->release_command_buffer();
+    _impl->dispatches.clear();
+    _impl->is_replayable = false;
+}
+} // namespace arm_compute
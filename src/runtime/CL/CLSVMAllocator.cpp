@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLSVMAllocator.h"
+
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/CL/CLMemoryRegion.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+
+#include <cstddef>
+
+namespace arm_compute
+{
+CLSVMAllocator::CLSVMAllocator() : _fine_grained(false), _coarse_grained(false)
+{
+    // Devices older than OpenCL 2.0 fail the query and keep no SVM support
+    cl_device_svm_capabilities capabilities = 0;
+    if (clGetDeviceInfo(CLKernelLibrary::get().get_device().get(), CL_DEVICE_SVM_CAPABILITIES, sizeof(capabilities),
+                        &capabilities, nullptr) == CL_SUCCESS)
+    {
+        _fine_grained   = (capabilities & CL_DEVICE_SVM_FINE_GRAIN_BUFFER) != 0;
+        _coarse_grained = (capabilities & CL_DEVICE_SVM_COARSE_GRAIN_BUFFER) != 0;
+    }
+}
+
+bool CLSVMAllocator::is_fine_grained() const
+{
+    return _fine_grained;
+}
+
+void *CLSVMAllocator::allocate(size_t size, size_t alignment)
+{
+    ARM_COMPUTE_ERROR_ON(!_fine_grained && !_coarse_grained);
+    const cl_svm_mem_flags flags = _fine_grained ? CL_MEM_READ_WRITE | CL_MEM_SVM_FINE_GRAIN_BUFFER : CL_MEM_READ_WRITE;
+    return clSVMAlloc(CLScheduler::get().context().get(), flags, size, alignment);
+}
+
+void CLSVMAllocator::free(void *ptr)
+{
+    ARM_COMPUTE_ERROR_ON(ptr == nullptr);
+    clSVMFree(CLScheduler::get().context().get(), ptr);
+}
+
+std::unique_ptr<IMemoryRegion> CLSVMAllocator::make_region(size_t size, size_t alignment)
+{
+    std::unique_ptr<ICLMemoryRegion> region{};
+    if (_fine_grained)
+    {
+        region =
+            std::make_unique<CLFineSVMMemoryRegion>(CL_MEM_READ_WRITE | CL_MEM_SVM_FINE_GRAIN_BUFFER, size, alignment);
+    }
+    // Fall back to coarse-grain SVM, then to legacy buffer memory in case of failure
+    if (_coarse_grained && (region == nullptr || region->ptr() == nullptr))
+    {
+        region = std::make_unique<CLCoarseSVMMemoryRegion>(CL_MEM_READ_WRITE, size, alignment);
+    }
+    if (region == nullptr || region->ptr() == nullptr)
+    {
+        region = std::make_unique<CLBufferMemoryRegion>(CL_MEM_ALLOC_HOST_PTR | CL_MEM_READ_WRITE, size);
+    }
+    return region;
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024 Arm Limited.
+ * Copyright (c) 2016-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,10 +24,15 @@
 #include "arm_compute/runtime/CL/CLScheduler.h"
 
 #include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/runtime/CL/CLKernelProfiler.h"
 #include "arm_compute/runtime/CL/CLTuner.h"
+#include "arm_compute/runtime/CL/CLWeightsCache.h"
+#include "arm_compute/runtime/Tracer.h"
 
 #include "src/core/CL/ICLKernel.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 cl::Context &CLScheduler::context()
@@ -55,7 +60,8 @@ CLGEMMHeuristicsHandle *CLScheduler::gemm_heuristics() const
 
 void CLScheduler::set_queue(cl::CommandQueue queue)
 {
-    _queue = std::move(queue);
+    _queue        = std::move(queue);
+    _flush_marker = cl::Event();
 }
 
 void CLScheduler::set_target(GPUTarget target)
@@ -68,11 +74,46 @@ void CLScheduler::set_tuner(ICLTuner *tuner)
     _cl_tuner = tuner;
 }
 
+ICLTuner *CLScheduler::tuner() const
+{
+    return _cl_tuner;
+}
+
 void CLScheduler::sync()
 {
     _queue.finish();
 }
 
+void CLScheduler::set_kernel_profiler(CLKernelProfiler *profiler)
+{
+    if (profiler != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON(!_is_initialised);
+        const cl_command_queue_properties props = _queue.getInfo<CL_QUEUE_PROPERTIES>();
+        if ((props & CL_QUEUE_PROFILING_ENABLE) == 0)
+        {
+            _queue.finish();
+            _queue = cl::CommandQueue(context(), _queue.getInfo<CL_QUEUE_DEVICE>(), props | CL_QUEUE_PROFILING_ENABLE);
+        }
+    }
+    _kernel_profiler = profiler;
+}
+
+CLKernelProfiler *CLScheduler::kernel_profiler() const
+{
+    return _kernel_profiler;
+}
+
+void CLScheduler::set_weights_cache(CLWeightsCache *cache)
+{
+    _weights_cache = cache;
+}
+
+CLWeightsCache *CLScheduler::weights_cache() const
+{
+    return _weights_cache;
+}
+
 cl::Event CLScheduler::enqueue_sync_event()
 {
     cl::Event event;
@@ -106,8 +147,13 @@ CLScheduler::CLScheduler()
       _job_chaining_enabled(true),
       _job_chaining_size(1),
       _job_chaining_count(0),
+      _adaptive_job_chaining(false),
+      _max_job_chaining_size(16),
+      _flush_marker(),
       _enqueue_count(0),
-      _flush_count(0)
+      _flush_count(0),
+      _kernel_profiler(nullptr),
+      _weights_cache(nullptr)
 {
 }
 
@@ -161,6 +207,11 @@ void CLScheduler::default_reinit(ICLTuner *cl_tuner, CLGEMMHeuristicsHandle *gem
 
 void CLScheduler::set_context(cl::Context context)
 {
+    // The cached buffers belong to the previous context
+    if (_weights_cache != nullptr && context.get() != _context.get())
+    {
+        _weights_cache->clear();
+    }
     _context = std::move(context);
     CLKernelLibrary::get().set_context(_context);
 }
@@ -187,6 +238,9 @@ void CLScheduler::enqueue_common(ICLKernel &kernel, ITensorPack &tensors, bool f
         !_is_initialised, "The CLScheduler is not initialised yet! Please call the CLScheduler::get().default_init(), \
                              or CLScheduler::get()::init() and CLKernelLibrary::get()::init() function before running functions!");
 
+    // Most kernels identify their configuration, the others are traced under a common name
+    ARM_COMPUTE_TRACE_SCOPE("cl_enqueue", kernel.config_id().empty() ? "cl_kernel" : kernel.config_id().c_str());
+
     const bool inject_memory = !tensors.empty();
 
     // Tune the kernel if the CLTuner has been provided
@@ -195,9 +249,19 @@ void CLScheduler::enqueue_common(ICLKernel &kernel, ITensorPack &tensors, bool f
         inject_memory ? _cl_tuner->tune_kernel_dynamic(kernel, tensors) : _cl_tuner->tune_kernel_dynamic(kernel);
     }
 
+    if (_kernel_profiler != nullptr)
+    {
+        _kernel_profiler->begin_kernel(_queue);
+    }
+
     // Run kernel
     inject_memory ? kernel.run_op(tensors, kernel.window(), _queue) : kernel.run(kernel.window(), _queue);
 
+    if (_kernel_profiler != nullptr)
+    {
+        _kernel_profiler->end_kernel(_queue);
+    }
+
     flush_queue(flush);
 }
 
@@ -220,7 +284,11 @@ void CLScheduler::flush_queue(bool flush)
                 the CPU activity for job-scheduling.
                 For eg. job-chain size goes from 1, 2, 4, 8 and 16
             */
-            if (_job_chaining_size < 16)
+            if (_adaptive_job_chaining)
+            {
+                adapt_job_chaining_size();
+            }
+            else if (_job_chaining_size < _max_job_chaining_size)
             {
                 _job_chaining_size <<= 1;
             }
@@ -250,4 +318,28 @@ void CLScheduler::enable_job_chaining(int job_chaining_size)
     _job_chaining_enabled = true;
     _job_chaining_size    = job_chaining_size;
 }
+
+void CLScheduler::enable_adaptive_job_chaining(int max_job_chaining_size)
+{
+    ARM_COMPUTE_ERROR_ON(max_job_chaining_size < 1);
+    _job_chaining_enabled  = true;
+    _adaptive_job_chaining = true;
+    _max_job_chaining_size = max_job_chaining_size;
+    _job_chaining_size     = std::min(_job_chaining_size, max_job_chaining_size);
+}
+
+void CLScheduler::adapt_job_chaining_size()
+{
+    if (_flush_marker.get() != nullptr)
+    {
+        // The kernels flushed last time have completed before the next ones were submitted:
+        // the GPU is starved so flush sooner, otherwise batch one more kernel to reduce the driver overhead
+        cl_int     status = CL_QUEUED;
+        const bool is_idle =
+            _flush_marker.getInfo(CL_EVENT_COMMAND_EXECUTION_STATUS, &status) == CL_SUCCESS && status == CL_COMPLETE;
+        _job_chaining_size = is_idle ? std::max(1, _job_chaining_size / 2)
+                                     : std::min(_max_job_chaining_size, _job_chaining_size + 1);
+    }
+    _queue.enqueueMarker(&_flush_marker);
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021, 2024 Arm Limited.
+ * Copyright (c) 2016-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,11 +23,16 @@
  */
 #include "arm_compute/runtime/CL/CLTensorAllocator.h"
 
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/runtime/CL/CLRuntimeContext.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace arm_compute
 {
 const cl::Buffer CLTensorAllocator::_empty_buffer = cl::Buffer();
@@ -106,6 +111,27 @@ void populate_quantization_info(CLFloatArray           &scale,
                                                       num_elements * offset_element_size, qinfo.offset().data());
     }
 }
+/** Helper function used to wrap external memory in an OpenCL buffer with cl_arm_import_memory
+ *
+ * @param[in]  properties Zero-terminated import properties
+ * @param[in]  memory     Handle of the memory to import
+ * @param[in]  size       Size of the memory to import
+ * @param[out] buffer     Buffer wrapping the imported memory
+ *
+ * @return An error status
+ */
+Status import_external_memory(const cl_import_properties_arm *properties, void *memory, size_t size, cl::Buffer &buffer)
+{
+    cl_int       error = CL_SUCCESS;
+    const cl_mem mem   = clImportMemoryARM(CLScheduler::get().context().get(), CL_MEM_READ_WRITE, properties, memory,
+                                           size, &error);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG_VAR(error != CL_SUCCESS || mem == nullptr,
+                                        "clImportMemoryARM failed with error %d", error);
+
+    // The buffer owns the imported cl_mem, the external memory stays owned by the caller
+    buffer = cl::Buffer(mem);
+    return Status{};
+}
 } // namespace
 
 CLTensorAllocator::CLTensorAllocator(IMemoryManageable *owner, CLRuntimeContext *ctx)
@@ -145,8 +171,10 @@ void CLTensorAllocator::allocate()
     }
     else
     {
-        // Finalize memory management instead
-        _associated_memory_group->finalize_memory(_owner, _memory, info().total_size(), alignment());
+        // Finalize memory management instead, the tensors of offset pools being sub-buffers of the pool
+        const size_t sub_buffer_alignment = get_cl_sub_buffer_alignment(CLKernelLibrary::get().get_device());
+        _associated_memory_group->finalize_memory(_owner, _memory, info().total_size(),
+                                                  std::max(alignment(), sub_buffer_alignment));
     }
 
     // Allocate and fill the quantization parameter arrays
@@ -186,6 +214,44 @@ Status CLTensorAllocator::import_memory(cl::Buffer buffer)
     return Status{};
 }
 
+Status CLTensorAllocator::import_dma_buf(int fd)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(fd < 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(_associated_memory_group != nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(
+        !device_supports_extension(CLKernelLibrary::get().get_device(), "cl_arm_import_memory_dma_buf"),
+        "The device does not support importing dma-buf memory");
+
+    const cl_import_properties_arm properties[] = {CL_IMPORT_TYPE_ARM, CL_IMPORT_TYPE_DMA_BUF_ARM, 0};
+
+    cl::Buffer buffer;
+    ARM_COMPUTE_RETURN_ON_ERROR(import_external_memory(properties, &fd, info().total_size(), buffer));
+    return import_memory(buffer);
+}
+
+Status CLTensorAllocator::import_android_hardware_buffer(AHardwareBuffer *buffer, unsigned int plane)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(buffer == nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON(_associated_memory_group != nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!device_supports_extension(CLKernelLibrary::get().get_device(),
+                                                               "cl_arm_import_memory_android_hardware_buffer"),
+                                    "The device does not support importing Android hardware buffers");
+
+    std::vector<cl_import_properties_arm> properties{CL_IMPORT_TYPE_ARM, CL_IMPORT_TYPE_ANDROID_HARDWARE_BUFFER_ARM};
+    if (plane != 0)
+    {
+        properties.push_back(CL_IMPORT_ANDROID_HARDWARE_BUFFER_PLANE_INDEX_ARM);
+        properties.push_back(static_cast<cl_import_properties_arm>(plane));
+    }
+    properties.push_back(0);
+
+    // Hardware buffers can only be imported whole
+    cl::Buffer cl_buffer;
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        import_external_memory(properties.data(), buffer, CL_IMPORT_MEMORY_WHOLE_ALLOCATION_ARM, cl_buffer));
+    return import_memory(cl_buffer);
+}
+
 void CLTensorAllocator::set_associated_memory_group(IMemoryGroup *associated_memory_group)
 {
     ARM_COMPUTE_ERROR_ON(associated_memory_group == nullptr);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,7 +23,10 @@
  */
 #include "arm_compute/runtime/CL/CLTuner.h"
 
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/GPUTarget.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
 #include "arm_compute/runtime/CL/tuners/CLTuningParametersList.h"
 
@@ -31,22 +34,134 @@
 #include "src/core/CL/ICLKernel.h"
 #include "support/StringSupport.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <cstdlib>
 #include <fstream>
 #include <limits>
+#include <sstream>
 
 namespace arm_compute
 {
+namespace
+{
+/** Kernel ID of the rows starting the section of a device in a tuning file */
+const std::string device_row_id = "#device";
+
+/** Device a section of a tuning file has been tuned on */
+struct TunedDevice
+{
+    std::string  gpu_target{};     /**< Name of the GPU target */
+    std::string  driver_version{}; /**< Content of CL_DRIVER_VERSION */
+    unsigned int compute_units{0}; /**< Number of compute units */
+
+    /** Key of the device in the tuning file: "gpu_target;driver_version;compute_units" */
+    std::string to_string() const
+    {
+        return gpu_target + ";" + driver_version + ";" + support::cpp11::to_string(compute_units);
+    }
+
+    /** Parse the key of a device, returns false if it is malformed */
+    bool from_string(const std::string &key)
+    {
+        const size_t pos_target = key.find(';');
+        const size_t pos_driver = key.rfind(';');
+        if (pos_target == std::string::npos || pos_driver == pos_target)
+        {
+            return false;
+        }
+        gpu_target     = key.substr(0, pos_target);
+        driver_version = key.substr(pos_target + 1, pos_driver - pos_target - 1);
+        compute_units  = static_cast<unsigned int>(std::strtoul(key.c_str() + pos_driver + 1, nullptr, 10));
+        return true;
+    }
+};
+
+/** Device the kernels are tuned on, empty if OpenCL is not initialized */
+TunedDevice current_device()
+{
+    TunedDevice       device;
+    const cl::Device &cl_device = CLKernelLibrary::get().get_device();
+    if (cl_device() != nullptr)
+    {
+        device.gpu_target     = string_from_target(get_target_from_device(cl_device));
+        device.driver_version = cl_device.getInfo<CL_DRIVER_VERSION>();
+        device.compute_units  = CLKernelLibrary::get().get_num_compute_units();
+        // The fields of the key are separated by semicolons
+        std::replace(device.driver_version.begin(), device.driver_version.end(), ';', ' ');
+    }
+    return device;
+}
+
+/** Key of the section of a tuning file whose parameters are the closest to the current device
+ *
+ * Sections of another GPU target are never selected. Among the sections of the same target, the same driver version is
+ * preferred and then the nearest number of compute units.
+ *
+ * @return The key of the selected section, empty if no section matches the GPU target of the device
+ */
+std::string
+nearest_device_section(const std::map<std::string, std::unordered_map<std::string, CLTuningParams>> &sections,
+                       const TunedDevice                                                           &device)
+{
+    std::string  best_key{};
+    bool         best_same_driver = false;
+    unsigned int best_distance    = std::numeric_limits<unsigned int>::max();
+    for (const auto &section : sections)
+    {
+        TunedDevice tuned;
+        if (!tuned.from_string(section.first) || tuned.gpu_target != device.gpu_target)
+        {
+            continue;
+        }
+        const bool         same_driver = tuned.driver_version == device.driver_version;
+        const unsigned int distance    = tuned.compute_units > device.compute_units
+                                             ? tuned.compute_units - device.compute_units
+                                             : device.compute_units - tuned.compute_units;
+        if (best_key.empty() || (same_driver && !best_same_driver) ||
+            (same_driver == best_same_driver && distance < best_distance))
+        {
+            best_key         = section.first;
+            best_same_driver = same_driver;
+            best_distance    = distance;
+        }
+    }
+    return best_key;
+}
+} // namespace
+
 CLTuner::CLTuner(bool tune_new_kernels, CLTuningInfo tuning_info)
     : real_clEnqueueNDRangeKernel(nullptr),
       _tuning_params_table(),
       _lws_table(),
       _kernel_event(),
       _tune_new_kernels(tune_new_kernels),
-      _tuning_info(tuning_info)
+      _tuning_info(tuning_info),
+      _online_state(),
+      _device_tables()
 {
 }
 
+CLTuner::~CLTuner() = default;
+
+/** Progress of the incremental search of the kernels tuned online */
+struct CLTuner::OnlineState
+{
+    struct KernelSearch
+    {
+        std::unique_ptr<cl_tuner::ICLTuningParametersList> candidates{}; /**< Created once the gws is known */
+        size_t                                             next_candidate{0};
+        CLTuningParams                                     timed{};   /**< Parameters of the pending run */
+        cl::Event                                          pending{}; /**< Event of the pending run */
+        CLTuningParams                                     best{};
+        cl_ulong                                           best_time{std::numeric_limits<cl_ulong>::max()};
+        unsigned int                                       num_runs{0};
+    };
+
+    cl::CommandQueue                              queue{};
+    std::unordered_map<std::string, KernelSearch> kernels{};
+};
+
 struct CLTuner::IKernelData
 {
     virtual ~IKernelData()                                          = default;
@@ -115,7 +230,18 @@ void CLTuner::do_tune_kernel_dynamic(ICLKernel &kernel, IKernelData *data)
 
         if (p == _tuning_params_table.end())
         {
-            if (_tune_new_kernels)
+            if (_tune_new_kernels && _tuning_info.tune_online)
+            {
+                // Run with the best parameters found so far while the search goes on
+                const CLTuningParams best_tuning_params = tune_online_step(kernel, data, config_id);
+
+                kernel.set_lws_hint(best_tuning_params.get_lws());
+                if (_tuning_info.tune_wbsm)
+                {
+                    kernel.set_wbsm_hint(best_tuning_params.get_wbsm());
+                }
+            }
+            else if (_tune_new_kernels)
             {
                 // Find the optimal LWS for the kernel
                 CLTuningParams opt_tuning_params = find_optimal_tuning_params(kernel, data);
@@ -154,17 +280,8 @@ void CLTuner::add_tuning_params(const std::string &kernel_id, CLTuningParams opt
     _tuning_params_table.emplace(kernel_id, optimal_tuning_params);
 }
 
-CLTuningParams CLTuner::find_optimal_tuning_params(ICLKernel &kernel, IKernelData *data)
+cl::CommandQueue CLTuner::profiling_queue() const
 {
-    // Profiling queue
-    cl::CommandQueue queue_profiler;
-
-    // Extract real OpenCL function to intercept
-    if (real_clEnqueueNDRangeKernel == nullptr)
-    {
-        real_clEnqueueNDRangeKernel = CLSymbols::get().clEnqueueNDRangeKernel_ptr;
-    }
-
     // Get the default queue
     cl::CommandQueue default_queue = CLScheduler::get().queue();
 
@@ -174,14 +291,19 @@ CLTuningParams CLTuner::find_optimal_tuning_params(ICLKernel &kernel, IKernelDat
     if ((props & CL_QUEUE_PROFILING_ENABLE) == 0)
     {
         // Set the queue for profiling
-        queue_profiler = cl::CommandQueue(CLScheduler::get().context(), props | CL_QUEUE_PROFILING_ENABLE);
+        return cl::CommandQueue(CLScheduler::get().context(), props | CL_QUEUE_PROFILING_ENABLE);
     }
-    else
+    return default_queue;
+}
+
+void CLTuner::start_intercepting_enqueues()
+{
+    // Extract real OpenCL function to intercept
+    if (real_clEnqueueNDRangeKernel == nullptr)
     {
-        queue_profiler = default_queue;
+        real_clEnqueueNDRangeKernel = CLSymbols::get().clEnqueueNDRangeKernel_ptr;
     }
 
-    // Start intercepting enqueues:
     auto interceptor = [this](cl_command_queue command_queue, cl_kernel kernel, cl_uint work_dim, const size_t *gwo,
                               const size_t *gws, const size_t *lws, cl_uint num_events_in_wait_list,
                               const cl_event *event_wait_list, cl_event *event)
@@ -207,6 +329,15 @@ CLTuningParams CLTuner::find_optimal_tuning_params(ICLKernel &kernel, IKernelDat
         return retval;
     };
     CLSymbols::get().clEnqueueNDRangeKernel_ptr = interceptor;
+}
+
+CLTuningParams CLTuner::find_optimal_tuning_params(ICLKernel &kernel, IKernelData *data)
+{
+    // Profiling queue
+    cl::CommandQueue queue_profiler = profiling_queue();
+
+    // Start intercepting enqueues:
+    start_intercepting_enqueues();
 
     // Run the kernel with default lws to be used as baseline
     data->do_run(kernel, queue_profiler);
@@ -284,6 +415,132 @@ CLTuningParams CLTuner::find_optimal_tuning_params(ICLKernel &kernel, IKernelDat
     return opt_tuning_params;
 }
 
+CLTuningParams CLTuner::tune_online_step(ICLKernel &kernel, IKernelData *data, const std::string &config_id)
+{
+    if (_online_state == nullptr)
+    {
+        _online_state        = std::make_unique<OnlineState>();
+        _online_state->queue = profiling_queue();
+    }
+
+    auto it = _online_state->kernels.find(config_id);
+    if (it == _online_state->kernels.end())
+    {
+        // The parameters the kernel has been configured with are the baseline of the search
+        it               = _online_state->kernels.emplace(config_id, OnlineState::KernelSearch{}).first;
+        it->second.best  = CLTuningParams(kernel.lws_hint(), kernel.wbsm_hint());
+        it->second.timed = it->second.best;
+    }
+    OnlineState::KernelSearch &search = it->second;
+
+    // Collect the execution time of the pending run without waiting for it
+    if (search.pending() != nullptr)
+    {
+        const cl_int status = search.pending.getInfo<CL_EVENT_COMMAND_EXECUTION_STATUS>();
+        if (status > CL_COMPLETE)
+        {
+            return search.best;
+        }
+        if (status == CL_COMPLETE)
+        {
+            const cl_ulong start = search.pending.getProfilingInfo<CL_PROFILING_COMMAND_START>();
+            const cl_ulong end   = search.pending.getProfilingInfo<CL_PROFILING_COMMAND_END>();
+            if (end - start < search.best_time)
+            {
+                search.best_time = end - start;
+                search.best      = search.timed;
+            }
+        }
+        search.pending = nullptr;
+    }
+
+    // Only every other run is timed to bound the overhead on the production workload
+    if (search.num_runs++ % 2 != 0)
+    {
+        return search.best;
+    }
+
+    if (search.candidates != nullptr)
+    {
+        // Skip the candidates which cannot be run
+        bool found = false;
+        for (; !found && search.next_candidate < search.candidates->size(); ++search.next_candidate)
+        {
+            const CLTuningParams candidate = (*search.candidates)[search.next_candidate];
+            const cl::NDRange    lws       = candidate.get_lws();
+            found = (lws[0] * lws[1] * lws[2] <= kernel.get_max_workgroup_size()) &&
+                    !(lws[0] == 1 && lws[1] == 1 && lws[2] == 1);
+            search.timed = candidate;
+        }
+
+        if (!found)
+        {
+            // The search has converged: the parameters can now be saved along the ones tuned offline
+            const CLTuningParams best = search.best;
+            ARM_COMPUTE_LOG_MSG_WITH_FORMAT_ACL(arm_compute::logging::LogLevel::INFO,
+                                                "[CLTuner] Online tuning of '%s' done, LWS: %s, WBSM: %d",
+                                                config_id.c_str(), to_string(best.get_lws()).c_str(), best.get_wbsm());
+            add_tuning_params(config_id, best);
+            _online_state->kernels.erase(it);
+            return best;
+        }
+    }
+
+    kernel.set_lws_hint(search.timed.get_lws());
+    if (_tuning_info.tune_wbsm && CLKernelLibrary::get().is_wbsm_supported())
+    {
+        kernel.set_wbsm_hint(search.timed.get_wbsm());
+    }
+
+    cl::CommandQueue &queue          = _online_state->queue;
+    cl::CommandQueue  default_queue  = CLScheduler::get().queue();
+    const bool        separate_queue = queue() != default_queue();
+    if (separate_queue)
+    {
+        // The timed run must see the inputs produced by the work already enqueued on the default queue
+        cl_event inputs_ready = nullptr;
+        if (clEnqueueMarkerWithWaitList(default_queue(), 0, nullptr, &inputs_ready) == CL_SUCCESS)
+        {
+            clEnqueueBarrierWithWaitList(queue(), 1, &inputs_ready, nullptr);
+            clReleaseEvent(inputs_ready);
+        }
+        else
+        {
+            // OpenCL 1.1 devices cannot order commands across queues without blocking
+            default_queue.finish();
+        }
+    }
+
+    start_intercepting_enqueues();
+    data->do_run(kernel, queue);
+    CLSymbols::get().clEnqueueNDRangeKernel_ptr = real_clEnqueueNDRangeKernel;
+
+    search.pending = _kernel_event;
+    _kernel_event  = nullptr;
+
+    if (separate_queue && search.pending() != nullptr)
+    {
+        // The production run which follows writes the same outputs: order it after the timed run
+        const cl_event timed_run = search.pending();
+        if (clEnqueueBarrierWithWaitList(default_queue(), 1, &timed_run, nullptr) == CL_SUCCESS)
+        {
+            queue.flush();
+        }
+        else
+        {
+            queue.finish();
+        }
+    }
+
+    if (search.candidates == nullptr)
+    {
+        // The gws cached by the baseline run is the upper-bound of the search, see find_optimal_tuning_params()
+        search.candidates = cl_tuner::get_tuning_parameters_list(_tuning_info, kernel.get_cached_gws());
+    }
+
+    return search.best;
+}
+
 const std::unordered_map<std::string, CLTuningParams> &CLTuner::tuning_params_table() const
 {
     return _tuning_params_table;
@@ -304,7 +561,9 @@ void CLTuner::load_from_file(const std::string &filename)
     {
         ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
     }
+    // Rows before the first device section come from files without sections, they are applied to any device
     std::string line;
+    std::string section{};
     bool        header_line = true;
     while (!std::getline(fs, line).fail())
     {
@@ -338,13 +597,41 @@ void CLTuner::load_from_file(const std::string &filename)
         }
         std::string kernel_id = line.substr(0, pos);
         line.erase(0, pos + 1);
+        if (kernel_id == device_row_id)
+        {
+            TunedDevice device;
+            if (!device.from_string(line))
+            {
+                ARM_COMPUTE_ERROR_VAR("Malformed device '%s' in %s", line.c_str(), filename.c_str());
+            }
+            section = device.to_string();
+            continue;
+        }
         if (!tuning_params.from_string(_tuning_info, line))
         {
             ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s", line.c_str(), filename.c_str());
         }
-        add_tuning_params(kernel_id, tuning_params);
+        // Loading several files merges their sections, the rows read last win
+        _device_tables[section][kernel_id] = tuning_params;
     }
     fs.close();
+
+    // Use the parameters tuned on the current device, or else on the nearest device of the same GPU target, before
+    // the rows without device. Such rows are now considered tuned on the current device and saved in its section.
+    const TunedDevice device  = current_device();
+    const std::string nearest = nearest_device_section(_device_tables, device);
+    if (!nearest.empty())
+    {
+        for (const auto &kernel_data : _device_tables[nearest])
+        {
+            add_tuning_params(kernel_data.first, kernel_data.second);
+        }
+    }
+    for (const auto &kernel_data : _device_tables[""])
+    {
+        add_tuning_params(kernel_data.first, kernel_data.second);
+    }
+    _device_tables.erase("");
 }
 
 bool CLTuner::save_to_file(const std::string &filename) const
@@ -367,6 +654,23 @@ bool CLTuner::save_to_file(const std::string &filename) const
         header_string += "wbsm";
     }
     fs << header_string << std::endl;
+
+    // Keep the sections of the other devices, so that a single file can be shared by several devices
+    const std::string device_key = current_device().to_string();
+    for (auto const &device_table : _device_tables)
+    {
+        if (device_table.first == device_key)
+        {
+            continue;
+        }
+        fs << device_row_id << ";" << device_table.first << std::endl;
+        for (auto const &kernel_data : device_table.second)
+        {
+            CLTuningParams tun_pams(kernel_data.second);
+            fs << kernel_data.first << tun_pams.to_string(_tuning_info) << std::endl;
+        }
+    }
+    fs << device_row_id << ";" << device_key << std::endl;
     for (auto const &kernel_data : _tuning_params_table)
     {
         CLTuningParams tun_pams(kernel_data.second);
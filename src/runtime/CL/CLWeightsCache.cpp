@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLWeightsCache.h"
+
+namespace arm_compute
+{
+CLWeightsCache::CLWeightsCache() : _mtx(), _entries()
+{
+}
+
+CLWeightsCache::~CLWeightsCache() = default;
+
+void CLWeightsCache::register_weights(const ITensor *weights)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _entries[weights];
+}
+
+void CLWeightsCache::unregister_weights(const ITensor *weights)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _entries.erase(weights);
+}
+
+bool CLWeightsCache::is_registered(const ITensor *weights) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _entries.find(weights) != std::end(_entries);
+}
+
+bool CLWeightsCache::find(const ITensor *weights, const std::string &transform_id, Buffers &buffers) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    const auto                  it = _entries.find(weights);
+    if (it == std::end(_entries))
+    {
+        return false;
+    }
+    const auto transformed = it->second.find(transform_id);
+    if (transformed == std::end(it->second))
+    {
+        return false;
+    }
+    buffers = transformed->second;
+    return true;
+}
+
+void CLWeightsCache::insert(const ITensor *weights, const std::string &transform_id, const Buffers &buffers)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    auto                        it = _entries.find(weights);
+    if (it != std::end(_entries))
+    {
+        it->second.emplace(transform_id, buffers);
+    }
+}
+
+void CLWeightsCache::clear()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    for (auto &e : _entries)
+    {
+        e.second.clear();
+    }
+}
+
+size_t CLWeightsCache::size() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    size_t                      num_transformed = 0;
+    for (const auto &e : _entries)
+    {
+        num_transformed += e.second.size();
+    }
+    return num_transformed;
+}
+} // namespace arm_compute
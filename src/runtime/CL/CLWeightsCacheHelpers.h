@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_RUNTIME_CL_CLWEIGHTSCACHEHELPERS_H
+#define ACL_SRC_RUNTIME_CL_CLWEIGHTSCACHEHELPERS_H
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/CLWeightsCache.h"
+
+#include "src/core/helpers/MemoryHelpers.h"
+
+#include <string>
+
+namespace arm_compute
+{
+namespace weights_cache
+{
+/** Import the transformed weights of a function from the cache of @ref CLScheduler
+ *
+ * @note Nothing is imported unless the buffers of all the persistent tensors of @p workspace are cached
+ *
+ * @param[in]     weights      Weights tensor of the function
+ * @param[in]     transform_id Identifier of the transformation applied to @p weights by the operator of the function
+ * @param[in,out] workspace    Workspace of the function. Its persistent tensors must not be allocated yet.
+ *
+ * @return True if the persistent tensors of @p workspace have imported the cached buffers
+ */
+inline bool
+import_transformed_weights(const ITensor *weights, const std::string &transform_id, WorkspaceData<CLTensor> &workspace)
+{
+    CLWeightsCache *cache = CLScheduler::get().weights_cache();
+    if (cache == nullptr || transform_id.empty())
+    {
+        return false;
+    }
+
+    CLWeightsCache::Buffers buffers;
+    if (!cache->find(weights, transform_id, buffers))
+    {
+        return false;
+    }
+
+    for (const auto &ws : workspace)
+    {
+        if (ws.lifetime == experimental::MemoryLifetime::Persistent)
+        {
+            const auto buffer = buffers.find(ws.slot);
+            if (buffer == std::end(buffers) || ws.tensor->allocator()->is_allocated() ||
+                buffer->second.getInfo<CL_MEM_SIZE>() < ws.tensor->info()->total_size())
+            {
+                return false;
+            }
+        }
+    }
+
+    for (auto &ws : workspace)
+    {
+        if (ws.lifetime == experimental::MemoryLifetime::Persistent)
+        {
+            ARM_COMPUTE_ERROR_THROW_ON(ws.tensor->allocator()->import_memory(buffers[ws.slot]));
+        }
+    }
+    return true;
+}
+
+/** Store the transformed weights of a function into the cache of @ref CLScheduler
+ *
+ * @note Nothing is stored if the weights are not registered in the cache
+ *
+ * @param[in] weights      Weights tensor of the function
+ * @param[in] transform_id Identifier of the transformation applied to @p weights by the operator of the function
+ * @param[in] workspace    Workspace of the function, once the operator has been prepared
+ */
+inline void
+store_transformed_weights(const ITensor *weights, const std::string &transform_id, WorkspaceData<CLTensor> &workspace)
+{
+    CLWeightsCache *cache = CLScheduler::get().weights_cache();
+    if (cache == nullptr || transform_id.empty() || !cache->is_registered(weights))
+    {
+        return;
+    }
+
+    CLWeightsCache::Buffers buffers;
+    for (const auto &ws : workspace)
+    {
+        if (ws.lifetime == experimental::MemoryLifetime::Persistent && ws.tensor->allocator()->is_allocated())
+        {
+            buffers.emplace(ws.slot, ws.tensor->cl_buffer());
+        }
+    }
+
+    if (!buffers.empty())
+    {
+        cache->insert(weights, transform_id, buffers);
+    }
+}
+} // namespace weights_cache
+} // namespace arm_compute
+#endif // ACL_SRC_RUNTIME_CL_CLWEIGHTSCACHEHELPERS_H
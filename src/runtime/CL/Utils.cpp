@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited.
+ * Copyright (c) 2020-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,13 +26,19 @@
 #include "arm_compute/core/CL/CLKernelLibrary.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <future>
 #include <map>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace arm_compute
 {
-void restore_program_cache_from_file(const std::string &filename)
+void restore_program_cache_from_file(const std::string &filename, unsigned int num_threads)
 {
     std::ifstream cache_file(filename, std::ios::binary);
     if (cache_file.is_open())
@@ -42,6 +48,8 @@ void restore_program_cache_from_file(const std::string &filename)
             arm_compute::CLScheduler::get().default_init();
         }
 
+        // Read all the programs first
+        std::vector<std::pair<std::string, std::vector<unsigned char>>> entries;
         while (!cache_file.eof())
         {
             size_t name_len   = 0;
@@ -57,16 +65,63 @@ void restore_program_cache_from_file(const std::string &filename)
             std::string                name;
             cache_file.read(tmp.data(), name_len);
             name.assign(tmp.data(), name_len);
-            tmp.resize(binary_len);
             cache_file.read(reinterpret_cast<char *>(binary.data()), binary_len);
-            cl::Context             context = arm_compute::CLScheduler::get().context();
-            cl::Program::Binaries   binaries{binary};
-            std::vector<cl::Device> devices = context.getInfo<CL_CONTEXT_DEVICES>();
-            cl::Program             program(context, devices, binaries);
-            program.build();
-            CLKernelLibrary::get().add_built_program(name, program);
+            entries.emplace_back(std::move(name), std::move(binary));
         }
         cache_file.close();
+
+        // Then build them concurrently
+        cl::Context                context       = arm_compute::CLScheduler::get().context();
+        std::vector<cl::Device>    devices       = context.getInfo<CL_CONTEXT_DEVICES>();
+        std::vector<cl::Program>   programs(entries.size());
+        std::vector<unsigned       char>  is_built(entries.size(), 0);
+        std::atomic<size_t>        next_entry{0};
+        auto                       build_entries = [&]()
+        {
+            for (size_t i = next_entry++; i < entries.size(); i = next_entry++)
+            {
+                try
+                {
+                    cl::Program::Binaries binaries{entries[i].second};
+                    programs[i] = cl::Program(context, devices, binaries);
+                    is_built[i] = Program::build(programs[i]) ? 1 : 0;
+                }
+                catch (const cl::Error &)
+                {
+                    is_built[i] = 0;
+                }
+            }
+        };
+
+#ifndef NO_MULTI_THREADING
+        if (num_threads == 0)
+        {
+            num_threads = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+        const size_t num_workers = std::min(static_cast<size_t>(num_threads), entries.size());
+
+        std::vector<std::future<void>> workers;
+        for (size_t i = 1; i < num_workers; ++i)
+        {
+            workers.emplace_back(std::async(std::launch::async, build_entries));
+        }
+        build_entries();
+        for (auto &worker : workers)
+        {
+            worker.get();
+        }
+#else  /* NO_MULTI_THREADING */
+        ARM_COMPUTE_UNUSED(num_threads);
+        build_entries();
+#endif /* NO_MULTI_THREADING */
+
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            if (is_built[i] != 0)
+            {
+                CLKernelLibrary::get().add_built_program(entries[i].first, programs[i]);
+            }
+        }
     }
 }
 
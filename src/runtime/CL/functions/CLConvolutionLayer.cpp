@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/runtime/CL/functions/CLConvolutionLayer.h"
 
 #include "arm_compute/core/CL/CLKernelLibrary.h"
@@ -87,9 +88,10 @@ void CLConvolutionLayer::configure(const CLCompileContext    &compile_context,
                                    unsigned int               num_groups)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_ERROR_THROW_ON(CLConvolutionLayer::validate(
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(CLConvolutionLayer::validate(
         input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info,
         weights_info, dilation, act_info, enable_fast_math, num_groups));
+    const TrustedConfigureScope trusted_configure{};
     ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
                            enable_fast_math, num_groups);
 
@@ -229,4 +231,19 @@ void CLConvolutionLayer::prepare()
         _impl->is_prepared = true;
     }
 }
+
+OperatorDescription CLConvolutionLayer::describe() const
+{
+    OperatorDescription desc{};
+    desc.name = "CLConvolutionLayer";
+    if (_impl->op != nullptr)
+    {
+        desc.children.emplace_back(_impl->op->describe());
+    }
+    else if (_impl->func != nullptr)
+    {
+        desc.children.emplace_back(_impl->func->describe());
+    }
+    return desc;
+}
 } // namespace arm_compute
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/functions/CLCopyProgram.h"
+
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/CL/ICLKernel.h"
+#include "src/gpu/cl/operators/ClCopyProgram.h"
+
+namespace arm_compute
+{
+struct CLCopyProgram::Impl
+{
+    const ICLTensor                        *src{nullptr};
+    ICLTensor                              *dst{nullptr};
+    std::unique_ptr<opencl::ClCopyProgram> op{nullptr};
+};
+
+CLCopyProgram::CLCopyProgram() : _impl(std::make_unique<Impl>())
+{
+}
+CLCopyProgram::CLCopyProgram(CLCopyProgram &&)            = default;
+CLCopyProgram &CLCopyProgram::operator=(CLCopyProgram &&) = default;
+CLCopyProgram::~CLCopyProgram()                           = default;
+
+void CLCopyProgram::configure(const ICLTensor *src, ICLTensor *dst, const CopyProgramInfo &program)
+{
+    configure(CLKernelLibrary::get().get_compile_context(), src, dst, program);
+}
+
+void CLCopyProgram::configure(const CLCompileContext &compile_context,
+                              const ICLTensor        *src,
+                              ICLTensor              *dst,
+                              const CopyProgramInfo  &program)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    _impl->src = src;
+    _impl->dst = dst;
+    _impl->op  = std::make_unique<opencl::ClCopyProgram>();
+    _impl->op->configure(compile_context, src->info(), dst->info(), program);
+}
+
+Status CLCopyProgram::validate(const ITensorInfo *src, const ITensorInfo *dst, const CopyProgramInfo &program)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(src, dst);
+    return opencl::ClCopyProgram::validate(src, dst, program);
+}
+
+void CLCopyProgram::run()
+{
+    ITensorPack pack;
+    pack.add_tensor(TensorType::ACL_SRC, _impl->src);
+    pack.add_tensor(TensorType::ACL_DST, _impl->dst);
+    _impl->op->run(pack);
+}
+} // namespace arm_compute
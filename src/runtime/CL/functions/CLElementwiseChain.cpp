@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/functions/CLElementwiseChain.h"
+
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/CL/ICLKernel.h"
+#include "src/gpu/cl/operators/ClElementwiseChain.h"
+
+namespace arm_compute
+{
+struct CLElementwiseChain::Impl
+{
+    std::unique_ptr<opencl::ClElementwiseChain> op{nullptr};
+    ITensorPack                                 run_pack{};
+};
+
+CLElementwiseChain::CLElementwiseChain() : _impl(std::make_unique<Impl>())
+{
+}
+CLElementwiseChain::CLElementwiseChain(CLElementwiseChain &&)            = default;
+CLElementwiseChain &CLElementwiseChain::operator=(CLElementwiseChain &&) = default;
+CLElementwiseChain::~CLElementwiseChain()                                = default;
+
+void CLElementwiseChain::configure(const ICLTensor                      *src,
+                                   const std::vector<const ICLTensor *> &operands,
+                                   ICLTensor                            *dst,
+                                   const ElementwiseChainInfo           &chain)
+{
+    configure(CLKernelLibrary::get().get_compile_context(), src, operands, dst, chain);
+}
+
+void CLElementwiseChain::configure(const CLCompileContext               &compile_context,
+                                   const ICLTensor                      *src,
+                                   const std::vector<const ICLTensor *> &operands,
+                                   ICLTensor                            *dst,
+                                   const ElementwiseChainInfo           &chain)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+
+    std::vector<const ITensorInfo *> operand_infos;
+    for (const auto *operand : operands)
+    {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(operand);
+        operand_infos.push_back(operand->info());
+    }
+
+    _impl->op = std::make_unique<opencl::ClElementwiseChain>();
+    _impl->op->configure(compile_context, src->info(), operand_infos, dst->info(), chain);
+
+    _impl->run_pack = {{TensorType::ACL_SRC_0, src}, {TensorType::ACL_DST, dst}};
+    for (size_t i = 0; i < operands.size(); ++i)
+    {
+        _impl->run_pack.add_const_tensor(static_cast<TensorType>(TensorType::ACL_SRC_VEC + i), operands[i]);
+    }
+}
+
+Status CLElementwiseChain::validate(const ITensorInfo                      *src,
+                                    const std::vector<const ITensorInfo *> &operands,
+                                    const ITensorInfo                      *dst,
+                                    const ElementwiseChainInfo             &chain)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(src, dst);
+    return opencl::ClElementwiseChain::validate(src, operands, dst, chain);
+}
+
+void CLElementwiseChain::run()
+{
+    _impl->op->run(_impl->run_pack);
+}
+} // namespace arm_compute
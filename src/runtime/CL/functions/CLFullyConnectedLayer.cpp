@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/runtime/CL/functions/CLFullyConnectedLayer.h"
 
 #include "arm_compute/core/CL/CLKernelLibrary.h"
@@ -78,8 +79,9 @@ void CLFullyConnectedLayer::configure(const CLCompileContext &compile_context,
 {
     // Perform validate step
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_ERROR_THROW_ON(CLFullyConnectedLayer::validate(
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(CLFullyConnectedLayer::validate(
         input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr, output->info(), fc_info));
+    const TrustedConfigureScope trusted_configure{};
 
     _impl->op               = std::make_unique<opencl::ClFullyConnected>();
     _impl->original_weights = weights;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2024 Arm Limited.
+ * Copyright (c) 2017-2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/gpu/cl/operators/ClGemm.h"
+#include "src/runtime/CL/CLWeightsCacheHelpers.h"
 
 namespace arm_compute
 {
@@ -132,8 +133,23 @@ void CLGEMM::prepare()
 {
     if (!_impl->is_prepared)
     {
+        const std::string transform_id = _impl->op->weights_transform_id();
+        const bool        is_cached =
+            weights_cache::import_transformed_weights(_impl->b, transform_id, _impl->workspace_tensors);
+
         allocate_tensors(_impl->aux_mem_req, _impl->workspace_tensors);
-        _impl->op->prepare(_impl->prep_pack);
+        if (is_cached)
+        {
+            // Matrix B is not passed so that the operator does not reshape it again
+            ITensorPack prep_pack = _impl->prep_pack;
+            prep_pack.remove_tensor(ACL_SRC_1);
+            _impl->op->prepare(prep_pack);
+        }
+        else
+        {
+            _impl->op->prepare(_impl->prep_pack);
+            weights_cache::store_transformed_weights(_impl->b, transform_id, _impl->workspace_tensors);
+        }
 
         auto has_reshape =
             std::find_if(_impl->aux_mem_req.begin(), _impl->aux_mem_req.end(),
@@ -151,4 +167,15 @@ void CLGEMM::prepare()
         _impl->is_prepared = true;
     }
 }
+
+OperatorDescription CLGEMM::describe() const
+{
+    OperatorDescription desc{};
+    desc.name = "CLGEMM";
+    if (_impl->op != nullptr)
+    {
+        desc.children.emplace_back(_impl->op->describe());
+    }
+    return desc;
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@
 
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/gpu/cl/operators/ClGemmConv2d.h"
+#include "src/runtime/CL/CLWeightsCacheHelpers.h"
 #include "support/Cast.h"
 
 #include <cmath>
@@ -140,8 +141,23 @@ void CLGEMMConvolutionLayer::prepare()
 {
     if (!_impl->is_prepared)
     {
+        const std::string transform_id = _impl->op->weights_transform_id();
+        const bool        is_cached =
+            weights_cache::import_transformed_weights(_impl->weights, transform_id, _impl->workspace_tensors);
+
         allocate_tensors(_impl->aux_mem_req, _impl->workspace_tensors);
-        _impl->op->prepare(_impl->prep_pack);
+        if (is_cached)
+        {
+            // The weights are not passed so that the operator does not reshape them again
+            ITensorPack prep_pack = _impl->prep_pack;
+            prep_pack.remove_tensor(TensorType::ACL_SRC_1);
+            _impl->op->prepare(prep_pack);
+        }
+        else
+        {
+            _impl->op->prepare(_impl->prep_pack);
+            weights_cache::store_transformed_weights(_impl->weights, transform_id, _impl->workspace_tensors);
+        }
         auto has_reshape =
             std::find_if(_impl->aux_mem_req.begin(), _impl->aux_mem_req.end(),
                          [](const MemoryInfo &m) -> bool { return m.lifetime == MemoryLifetime::Persistent; });
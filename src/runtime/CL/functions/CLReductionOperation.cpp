@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,9 +38,35 @@
 
 namespace arm_compute
 {
+namespace
+{
+/** Operation reducing the partial results of the chunks of rows split into partitions */
+ReductionOperation partial_results_operation(ReductionOperation op)
+{
+    switch (op)
+    {
+        case ReductionOperation::SUM_SQUARE:
+        case ReductionOperation::MEAN_SUM:
+            return ReductionOperation::SUM;
+        default:
+            return op;
+    }
+}
+
+/** Shape of the partial results of the chunks of rows split into partitions */
+TensorShape partial_results_shape(const ITensorInfo &input, unsigned int num_partitions)
+{
+    TensorShape shape = input.tensor_shape();
+    shape.set(0, num_partitions);
+    return shape;
+}
+} // namespace
+
 CLReductionOperation::CLReductionOperation(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(std::move(memory_manager)),
       _unreshaped_output(),
+      _partial_results(),
+      _partial_kernel(),
       _reduction_kernel(),
       _reshape(),
       _reduction_axis(),
@@ -90,7 +116,20 @@ Status CLReductionOperation::validate(
         output_internal = &output_before_reshape;
     }
 
-    ARM_COMPUTE_RETURN_ON_ERROR(CLReductionOperationKernel::validate(input, output_internal, axis, op));
+    const unsigned int num_partitions = CLReductionOperationKernel::get_x_partitions(input, axis, op);
+    if (num_partitions > 1)
+    {
+        const TensorInfo partial_results =
+            input->clone()->set_tensor_shape(partial_results_shape(*input, num_partitions)).reset_padding();
+        ARM_COMPUTE_RETURN_ON_ERROR(
+            CLReductionOperationKernel::validate(input, &partial_results, axis, op, num_partitions));
+        ARM_COMPUTE_RETURN_ON_ERROR(CLReductionOperationKernel::validate(&partial_results, output_internal, axis,
+                                                                         partial_results_operation(op)));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(CLReductionOperationKernel::validate(input, output_internal, axis, op));
+    }
 
     if (is_reshape_required)
     {
@@ -149,7 +188,28 @@ void CLReductionOperation::configure(const CLCompileContext &compile_context,
     }
 
     _reduction_kernel = std::make_unique<CLReductionOperationKernel>();
-    _reduction_kernel->configure(compile_context, input, output_internal, axis, op);
+
+    // Rows too long for the device to be occupied by a work-group per row are reduced in chunks, then the chunks
+    const unsigned int num_partitions = CLReductionOperationKernel::get_x_partitions(input->info(), axis, op);
+    if (num_partitions > 1)
+    {
+        _partial_results.allocator()->init(input->info()
+                                               ->clone()
+                                               ->set_tensor_shape(partial_results_shape(*input->info(), num_partitions))
+                                               .reset_padding()
+                                               .set_is_resizable(true));
+        _memory_group.manage(&_partial_results);
+
+        _partial_kernel = std::make_unique<CLReductionOperationKernel>();
+        _partial_kernel->configure(compile_context, input, &_partial_results, axis, op, num_partitions);
+        _reduction_kernel->configure(compile_context, &_partial_results, output_internal, axis,
+                                     partial_results_operation(op));
+        _partial_results.allocator()->allocate();
+    }
+    else
+    {
+        _reduction_kernel->configure(compile_context, input, output_internal, axis, op);
+    }
 
     if (_is_reshape_required)
     {
@@ -162,6 +222,10 @@ void CLReductionOperation::run()
 {
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    if (_partial_kernel != nullptr)
+    {
+        CLScheduler::get().enqueue(*_partial_kernel, false);
+    }
     CLScheduler::get().enqueue(*_reduction_kernel, false);
 
     if (_is_reshape_required)
@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/runtime/CL/gemm_auto_heuristics/CLGEMMConfigTuner.h"
+
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/core/Log.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/CL/CLGEMMHeuristicsHandle.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+
+#include "src/gpu/cl/kernels/ClGemmMatrixMultiplyReshapedKernel.h"
+#include "src/gpu/cl/kernels/ClGemmMatrixMultiplyReshapedOnlyRhsKernel.h"
+#include "src/gpu/cl/kernels/gemm/ClGemmHelpers.h"
+#include "src/runtime/CL/mlgo/MLGOHeuristics.h"
+#include "src/runtime/CL/mlgo/Utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cl_gemm
+{
+namespace auto_heuristics
+{
+namespace
+{
+using namespace arm_compute::misc::shape_calculator;
+using namespace arm_compute::opencl::kernels;
+
+/** Maximum number of configs timed for a GEMM shape */
+constexpr unsigned int max_num_timed_configs = 64;
+/** Number of timed runs of a config, the fastest one is kept */
+constexpr unsigned int num_timed_runs = 4;
+
+const std::vector<unsigned int> m0_values{1, 2, 3, 4, 5, 6, 7, 8};
+const std::vector<unsigned int> n0_k0_values{2, 3, 4, 8, 16};
+const std::vector<unsigned int> v0_h0_values{1, 2, 4, 8, 16};
+
+/** Move a block parameter to the previous or the next of the supported values */
+unsigned int step(unsigned int value, const std::vector<unsigned int> &values, bool up)
+{
+    const auto it = std::lower_bound(values.begin(), values.end(), value);
+    if (up)
+    {
+        const auto next = (it != values.end() && *it == value) ? it + 1 : it;
+        return next != values.end() ? *next : value;
+    }
+    return it != values.begin() ? *(it - 1) : value;
+}
+
+std::vector<mlgo::GEMMConfigReshapedOnlyRHS> neighbours(const mlgo::GEMMConfigReshapedOnlyRHS &config)
+{
+    std::vector<mlgo::GEMMConfigReshapedOnlyRHS> moves(11, config);
+    moves[0].m0               = step(config.m0, m0_values, false);
+    moves[1].m0               = step(config.m0, m0_values, true);
+    moves[2].n0               = step(config.n0, n0_k0_values, false);
+    moves[3].n0               = step(config.n0, n0_k0_values, true);
+    moves[4].k0               = step(config.k0, n0_k0_values, false);
+    moves[5].k0               = step(config.k0, n0_k0_values, true);
+    moves[6].h0               = step(config.h0, v0_h0_values, false);
+    moves[7].h0               = step(config.h0, v0_h0_values, true);
+    moves[8].interleave_rhs   = !config.interleave_rhs;
+    moves[9].transpose_rhs    = !config.transpose_rhs;
+    moves[10].export_cl_image = !config.export_cl_image;
+    return moves;
+}
+
+std::vector<mlgo::GEMMConfigReshaped> neighbours(const mlgo::GEMMConfigReshaped &config)
+{
+    std::vector<mlgo::GEMMConfigReshaped> moves(14, config);
+    moves[0].m0               = step(config.m0, m0_values, false);
+    moves[1].m0               = step(config.m0, m0_values, true);
+    moves[2].n0               = step(config.n0, n0_k0_values, false);
+    moves[3].n0               = step(config.n0, n0_k0_values, true);
+    moves[4].k0               = step(config.k0, n0_k0_values, false);
+    moves[5].k0               = step(config.k0, n0_k0_values, true);
+    moves[6].v0               = step(config.v0, v0_h0_values, false);
+    moves[7].v0               = step(config.v0, v0_h0_values, true);
+    moves[8].h0               = step(config.h0, v0_h0_values, false);
+    moves[9].h0               = step(config.h0, v0_h0_values, true);
+    moves[10].interleave_lhs  = !config.interleave_lhs;
+    moves[11].interleave_rhs  = !config.interleave_rhs;
+    moves[12].transpose_rhs   = !config.transpose_rhs;
+    moves[13].export_cl_image = !config.export_cl_image;
+    return moves;
+}
+
+mlgo::GEMMConfigReshapedOnlyRHS to_mlgo_reshaped_only_rhs(const GEMMConfigResult &config)
+{
+    return mlgo::GEMMConfigReshapedOnlyRHS{config.lhs_info.m0,          config.rhs_info.n0,        config.rhs_info.k0,
+                                           config.rhs_info.h0,          config.rhs_info.interleave, config.rhs_info.transpose,
+                                           config.rhs_info.export_to_cl_image};
+}
+
+mlgo::GEMMConfigReshaped to_mlgo_reshaped(const GEMMConfigResult &config)
+{
+    return mlgo::GEMMConfigReshaped{config.lhs_info.m0,         config.rhs_info.n0,         config.rhs_info.k0,
+                                    config.lhs_info.v0,         config.rhs_info.h0,         config.lhs_info.interleave,
+                                    config.rhs_info.interleave, config.rhs_info.transpose, config.rhs_info.export_to_cl_image};
+}
+
+// Same conversions as the mlgo queries in CLGEMMAutoHeuristics.cpp
+GEMMConfigResult from_mlgo(const CommonQuery &query, const mlgo::GEMMConfigReshapedOnlyRHS &config)
+{
+    GEMMLHSMatrixInfo lhs_info;
+    GEMMRHSMatrixInfo rhs_info;
+    std::tie(lhs_info, rhs_info) = opencl::kernels::gemm::configure_lhs_rhs_info(
+        query.m, query.n, config.m0, config.n0, config.k0, 1, config.h0, false, config.interleave_rhs,
+        !config.transpose_rhs, config.transpose_rhs, config.export_cl_image);
+    return GEMMConfigResult{true, lhs_info, rhs_info};
+}
+
+GEMMConfigResult from_mlgo(const CommonQuery &query, const mlgo::GEMMConfigReshaped &config)
+{
+    GEMMLHSMatrixInfo lhs_info;
+    GEMMRHSMatrixInfo rhs_info;
+    std::tie(lhs_info, rhs_info) = opencl::kernels::gemm::configure_lhs_rhs_info(
+        query.m, query.n, config.m0, config.n0, config.k0, config.v0, config.h0, config.interleave_lhs,
+        config.interleave_rhs, !config.transpose_rhs, config.transpose_rhs, config.export_cl_image);
+    return GEMMConfigResult{true, lhs_info, rhs_info};
+}
+
+mlgo::Query to_mlgo_query(const CommonQuery &query)
+{
+    return mlgo::Query{string_from_target(query.gpu_target), query.data_type, query.m, query.n, query.k, query.b};
+}
+
+/** Temporary tensors of a matrix multiplication
+ *
+ * Their content is left uninitialized as the execution time of the GEMM kernels does not depend on it.
+ */
+struct GEMMTensors
+{
+    GEMMTensors(const TensorInfo &lhs_info, const TensorInfo &rhs_info, const ITensorInfo *bias_info, const ITensorInfo &dst_info)
+        : lhs(), rhs(), bias(), dst(), has_bias(bias_info != nullptr)
+    {
+        lhs.allocator()->init(lhs_info);
+        rhs.allocator()->init(rhs_info);
+        if (has_bias)
+        {
+            bias.allocator()->init(TensorInfo(bias_info->tensor_shape(), 1, bias_info->data_type()));
+        }
+        // The matrix multiplication kernel initializes the destination if it is empty
+        if (dst_info.total_size() != 0)
+        {
+            dst.allocator()->init(TensorInfo(dst_info.tensor_shape(), 1, dst_info.data_type()));
+        }
+    }
+
+    void allocate()
+    {
+        lhs.allocator()->allocate();
+        rhs.allocator()->allocate();
+        if (has_bias)
+        {
+            bias.allocator()->allocate();
+        }
+        dst.allocator()->allocate();
+    }
+
+    ITensorPack pack()
+    {
+        return ITensorPack{{TensorType::ACL_SRC_0, &lhs},
+                           {TensorType::ACL_SRC_1, &rhs},
+                           {TensorType::ACL_SRC_2, has_bias ? &bias : nullptr},
+                           {TensorType::ACL_DST, &dst}};
+    }
+
+    CLTensor lhs;
+    CLTensor rhs;
+    CLTensor bias;
+    CLTensor dst;
+    bool     has_bias;
+};
+
+/** Time the fastest of a few runs of a kernel */
+double time_kernel(ICLKernel &kernel, ITensorPack &tensors)
+{
+    cl::CommandQueue queue = CLScheduler::get().queue();
+
+    // The first run pays for the one-off costs, e.g. uploading the program to the device
+    kernel.run_op(tensors, kernel.window(), queue);
+    queue.finish();
+
+    double fastest = std::numeric_limits<double>::max();
+    for (unsigned int i = 0; i < num_timed_runs; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        kernel.run_op(tensors, kernel.window(), queue);
+        queue.finish();
+        fastest = std::min(fastest, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return fastest;
+}
+
+TensorInfo reshaped_rhs_info(const ITensorInfo *b, const GEMMRHSMatrixInfo &rhs_info)
+{
+    TensorInfo info(compute_rhs_reshaped_shape(*b, rhs_info), 1, b->data_type());
+    if (rhs_info.export_to_cl_image)
+    {
+        opencl::kernels::gemm::update_padding_for_cl_image(&info);
+    }
+    return info;
+}
+
+/** Hill climb from the prior config, moving to the first neighbour which runs faster */
+template <typename Config, typename TimeFunction>
+Config search(const CommonQuery &query, const Config &prior, const GEMMConfigValidator &validate, TimeFunction &&time)
+{
+    Config       best      = prior;
+    double       best_time = time(from_mlgo(query, prior));
+    unsigned int num_timed = 1;
+
+    std::set<std::string> visited{mlgo::to_string(prior)};
+    bool                  improved = true;
+    while (improved && num_timed < max_num_timed_configs)
+    {
+        improved = false;
+        for (const auto &candidate : neighbours(best))
+        {
+            if (!visited.insert(mlgo::to_string(candidate)).second)
+            {
+                continue;
+            }
+            const GEMMConfigResult config = from_mlgo(query, candidate);
+            if (!validate(config.lhs_info, config.rhs_info))
+            {
+                continue;
+            }
+            const double candidate_time = time(config);
+            if (candidate_time < best_time)
+            {
+                best      = candidate;
+                best_time = candidate_time;
+                improved  = true;
+            }
+            if (improved || ++num_timed == max_num_timed_configs)
+            {
+                break;
+            }
+        }
+    }
+    return best;
+}
+} // namespace
+
+bool is_gemm_config_tuning_enabled()
+{
+    const auto gemm_heuristics = CLScheduler::get().gemm_heuristics();
+    return gemm_heuristics != nullptr && gemm_heuristics->tune_gemm_configs();
+}
+
+GEMMConfigResult tune_gemm_config_reshaped_only_rhs(const CommonQuery         &query,
+                                                    const GEMMConfigResult    &prior,
+                                                    const GEMMConfigValidator &validate,
+                                                    const ITensorInfo         *a,
+                                                    const ITensorInfo         *b,
+                                                    const ITensorInfo         *c,
+                                                    const ITensorInfo         *output,
+                                                    const GEMMKernelInfo      &kernel_info)
+{
+    mlgo::MLGOHeuristics *heuristics = CLScheduler::get().gemm_heuristics()->get();
+    const mlgo::Query     mlgo_query = to_mlgo_query(query);
+    if (heuristics->query_tuned_gemm_config_reshaped_only_rhs(mlgo_query).first)
+    {
+        return prior;
+    }
+
+    const auto time = [&](const GEMMConfigResult &config)
+    {
+        GEMMTensors tensors(TensorInfo(a->tensor_shape(), 1, a->data_type()), reshaped_rhs_info(b, config.rhs_info), c,
+                            *output);
+
+        GEMMKernelInfo info = kernel_info;
+        info.lhs_info       = config.lhs_info;
+        info.rhs_info       = config.rhs_info;
+        info.has_pad_y      = false;
+
+        ClGemmMatrixMultiplyReshapedOnlyRhsKernel kernel;
+        kernel.set_target(query.gpu_target);
+        kernel.configure(CLKernelLibrary::get().get_compile_context(), tensors.lhs.info(), tensors.rhs.info(),
+                         tensors.has_bias ? tensors.bias.info() : nullptr, tensors.dst.info(), 1.f, 1.f,
+                         config.lhs_info, config.rhs_info, info);
+        tensors.allocate();
+        ITensorPack pack = tensors.pack();
+        return time_kernel(kernel, pack);
+    };
+
+    const auto prior_config = to_mlgo_reshaped_only_rhs(prior);
+    const auto best         = search(query, prior_config, validate, time);
+    heuristics->add_tuned_gemm_config_reshaped_only_rhs(mlgo_query, best);
+    ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Tuned reshaped_only_rhs config: %s", mlgo::to_string(best).c_str());
+
+    return best == prior_config ? prior : from_mlgo(query, best);
+}
+
+GEMMConfigResult tune_gemm_config_reshaped(const CommonQuery         &query,
+                                           const GEMMConfigResult    &prior,
+                                           const GEMMConfigValidator &validate,
+                                           const ITensorInfo         *a,
+                                           const ITensorInfo         *b,
+                                           const ITensorInfo         *c,
+                                           const ITensorInfo         *output,
+                                           const GEMMKernelInfo      &kernel_info,
+                                           bool                       reinterpret_input_as_3d)
+{
+    mlgo::MLGOHeuristics *heuristics = CLScheduler::get().gemm_heuristics()->get();
+    const mlgo::Query     mlgo_query = to_mlgo_query(query);
+    if (heuristics->query_tuned_gemm_config_reshaped(mlgo_query).first)
+    {
+        return prior;
+    }
+
+    const auto time = [&](const GEMMConfigResult &config)
+    {
+        const TensorInfo lhs_reshaped(compute_lhs_reshaped_shape(*a, config.lhs_info, reinterpret_input_as_3d), 1,
+                                      a->data_type());
+        GEMMTensors      tensors(lhs_reshaped, reshaped_rhs_info(b, config.rhs_info), c, *output);
+
+        GEMMKernelInfo info = kernel_info;
+        info.lhs_info       = config.lhs_info;
+        info.rhs_info       = config.rhs_info;
+
+        ClGemmMatrixMultiplyReshapedKernel kernel;
+        kernel.set_target(query.gpu_target);
+        kernel.configure(CLKernelLibrary::get().get_compile_context(), tensors.lhs.info(), tensors.rhs.info(),
+                         tensors.has_bias ? tensors.bias.info() : nullptr, tensors.dst.info(), 1.f, 1.f,
+                         config.lhs_info, config.rhs_info, info);
+        tensors.allocate();
+        ITensorPack pack = tensors.pack();
+        return time_kernel(kernel, pack);
+    };
+
+    const auto prior_config = to_mlgo_reshaped(prior);
+    const auto best         = search(query, prior_config, validate, time);
+    heuristics->add_tuned_gemm_config_reshaped(mlgo_query, best);
+    ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Tuned reshaped config: %s", mlgo::to_string(best).c_str());
+
+    return best == prior_config ? prior : from_mlgo(query, best);
+}
+} // namespace auto_heuristics
+} // namespace cl_gemm
+} // namespace arm_compute
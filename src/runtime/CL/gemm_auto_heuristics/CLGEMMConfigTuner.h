@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_RUNTIME_CL_GEMM_AUTO_HEURISTICS_CLGEMMCONFIGTUNER_H
+#define ACL_SRC_RUNTIME_CL_GEMM_AUTO_HEURISTICS_CLGEMMCONFIGTUNER_H
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include "src/runtime/CL/gemm_auto_heuristics/CLGEMMAutoHeuristics.h"
+
+#include <functional>
+
+namespace arm_compute
+{
+namespace cl_gemm
+{
+namespace auto_heuristics
+{
+/** Function checking that a GEMM config can be used to configure the kernels of a GEMM */
+using GEMMConfigValidator = std::function<bool(const GEMMLHSMatrixInfo &, const GEMMRHSMatrixInfo &)>;
+
+/** Check if the GEMM configs have to be tuned
+ *
+ * @return True if the tuning of the GEMM configurations is enabled in the heuristics handle of the scheduler
+ */
+bool is_gemm_config_tuning_enabled();
+
+/** Tune the gemm config of reshaped only rhs kernel around a prior config
+ *
+ * The search moves one of m0, n0, k0, h0, interleave_rhs, transpose_rhs and export_cl_image to its next value at a time,
+ * and keeps the move if the matrix multiplication kernel runs faster, until no move improves the execution time.
+ * The kernels run on temporary tensors, the winner is recorded in the mlgo heuristics of the scheduler so that the
+ * following queries of the same shape return it and it is saved with the heuristics.
+ *
+ * @param query       Query
+ * @param prior       Config selected by the mlgo or the default heuristics, where the search starts
+ * @param validate    Function validating the candidate configs
+ * @param a           Input tensor info of the lhs matrix
+ * @param b           Input tensor info of the rhs matrix, not reshaped
+ * @param c           (Optional) Input tensor info of the bias. Can be nullptr
+ * @param output      Output tensor info
+ * @param kernel_info GEMM kernel info the matrix multiplication kernel is configured with
+ *
+ * @return GEMMConfigResult. The tuned config, or @p prior if the query has already been tuned
+ */
+GEMMConfigResult tune_gemm_config_reshaped_only_rhs(const CommonQuery         &query,
+                                                    const GEMMConfigResult    &prior,
+                                                    const GEMMConfigValidator &validate,
+                                                    const ITensorInfo         *a,
+                                                    const ITensorInfo         *b,
+                                                    const ITensorInfo         *c,
+                                                    const ITensorInfo         *output,
+                                                    const GEMMKernelInfo      &kernel_info);
+
+/** Tune the gemm config of reshaped kernel around a prior config
+ *
+ * Same search as @ref tune_gemm_config_reshaped_only_rhs, with v0 and interleave_lhs in the moves as well.
+ *
+ * @param query                   Query
+ * @param prior                   Config selected by the mlgo or the default heuristics, where the search starts
+ * @param validate                Function validating the candidate configs
+ * @param a                       Input tensor info of the lhs matrix, not reshaped
+ * @param b                       Input tensor info of the rhs matrix, not reshaped
+ * @param c                       (Optional) Input tensor info of the bias. Can be nullptr
+ * @param output                  Output tensor info
+ * @param kernel_info             GEMM kernel info the matrix multiplication kernel is configured with
+ * @param reinterpret_input_as_3d Reinterpret the lhs matrix as 3D when reshaping it
+ *
+ * @return GEMMConfigResult. The tuned config, or @p prior if the query has already been tuned
+ */
+GEMMConfigResult tune_gemm_config_reshaped(const CommonQuery         &query,
+                                           const GEMMConfigResult    &prior,
+                                           const GEMMConfigValidator &validate,
+                                           const ITensorInfo         *a,
+                                           const ITensorInfo         *b,
+                                           const ITensorInfo         *c,
+                                           const ITensorInfo         *output,
+                                           const GEMMKernelInfo      &kernel_info,
+                                           bool                       reinterpret_input_as_3d);
+} // namespace auto_heuristics
+} // namespace cl_gemm
+} // namespace arm_compute
+
+#endif // ACL_SRC_RUNTIME_CL_GEMM_AUTO_HEURISTICS_CLGEMMCONFIGTUNER_H
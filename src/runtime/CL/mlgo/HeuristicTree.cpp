@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <ios>
 #include <set>
 namespace arm_compute
 {
@@ -83,6 +84,65 @@ bool evaluate(GEMMShape shape, Condition cond)
     }
 }
 
+
+const char *to_dotmlgo(ConditionalOp op)
+{
+    switch (op)
+    {
+        case ConditionalOp::LT:
+            return "<";
+        case ConditionalOp::LE:
+            return "<=";
+        case ConditionalOp::GT:
+            return ">";
+        case ConditionalOp::GE:
+            return ">=";
+        case ConditionalOp::EQ:
+        default:
+            return "==";
+    }
+}
+
+void write_leaf_value(std::ostream &os, GEMMType val)
+{
+    switch (val)
+    {
+        case GEMMType::NATIVE:
+            os << "gemm-type, native";
+            break;
+        case GEMMType::RESHAPED_ONLY_RHS:
+            os << "gemm-type, reshaped-only-rhs";
+            break;
+        case GEMMType::RESHAPED:
+        default:
+            os << "gemm-type, reshaped";
+            break;
+    }
+}
+
+void write_leaf_value(std::ostream &os, const GEMMConfigNative &val)
+{
+    os << "gemm-config-native, [" << val.m0 << ", " << val.n0 << ", " << val.k0 << "]";
+}
+
+void write_leaf_value(std::ostream &os, const GEMMConfigReshapedOnlyRHS &val)
+{
+    os << "gemm-config-reshaped-only-rhs, [" << val.m0 << ", " << val.n0 << ", " << val.k0 << ", " << val.h0 << ", "
+       << val.interleave_rhs << ", " << val.transpose_rhs << ", " << val.export_cl_image << "]";
+}
+
+void write_leaf_value(std::ostream &os, const GEMMConfigReshaped &val)
+{
+    os << "gemm-config-reshaped, [" << val.m0 << ", " << val.n0 << ", " << val.k0 << ", " << val.v0 << ", " << val.h0
+       << ", " << val.interleave_lhs << ", " << val.interleave_rhs << ", " << val.transpose_rhs << ", "
+       << val.export_cl_image << "]";
+}
+
+template <typename T>
+const T &leaf_value(const HeuristicTree::Node *node)
+{
+    return utils::cast::polymorphic_downcast<const HeuristicTree::LeafNode<T> *>(node)->value;
+}
 } // namespace
 
 constexpr size_t                HeuristicTree::_max_num_nodes;
@@ -224,6 +284,90 @@ bool HeuristicTree::check()
     return check_if_structurally_correct();
 }
 
+bool HeuristicTree::add_subtree(NodeID root_id, NodeID &next_id, const HeuristicTree &other)
+{
+    ARM_COMPUTE_ERROR_ON(other._heuristic_type != _heuristic_type);
+    if (other._tree.empty())
+    {
+        return false;
+    }
+    const NodeID offset = next_id;
+    next_id += other._tree.rbegin()->first + 1;
+    const auto new_id = [&](NodeID id) { return id == _root ? root_id : id + offset; };
+    for (const auto &node : other._tree)
+    {
+        const NodeID id    = new_id(node.first);
+        bool         added = false;
+        if (node.second->type() == NodeType::Branch)
+        {
+            const auto br_node = utils::cast::polymorphic_downcast<const BranchNode *>(node.second.get());
+            added = add_branch(id, br_node->condition, new_id(br_node->true_node), new_id(br_node->false_node));
+        }
+        else
+        {
+            switch (_heuristic_type)
+            {
+                case HeuristicType::GEMM_Type:
+                    added = add_leaf(id, leaf_value<GEMMType>(node.second.get()));
+                    break;
+                case HeuristicType::GEMM_Config_Native:
+                    added = add_leaf(id, leaf_value<GEMMConfigNative>(node.second.get()));
+                    break;
+                case HeuristicType::GEMM_Config_Reshaped_Only_RHS:
+                    added = add_leaf(id, leaf_value<GEMMConfigReshapedOnlyRHS>(node.second.get()));
+                    break;
+                case HeuristicType::GEMM_Config_Reshaped:
+                default:
+                    added = add_leaf(id, leaf_value<GEMMConfigReshaped>(node.second.get()));
+                    break;
+            }
+        }
+        if (!added)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void HeuristicTree::write(std::ostream &os) const
+{
+    os << "<heuristic, " << _id << ">\n";
+    for (const auto &node : _tree)
+    {
+        if (node.second->type() == NodeType::Branch)
+        {
+            const auto br_node = utils::cast::polymorphic_downcast<const BranchNode *>(node.second.get());
+            // Thresholds are written in fixed notation as the DotMLGO tokenizer reads a float only if it has a point
+            os << "b, " << node.first << ", var, " << br_node->condition.feature << ", "
+               << to_dotmlgo(br_node->condition.op) << ", num, " << std::fixed << br_node->condition.threshold
+               << std::defaultfloat << ", " << br_node->true_node << ", " << br_node->false_node << "\n";
+        }
+        else
+        {
+            os << "l, " << node.first << ", ";
+            switch (_heuristic_type)
+            {
+                case HeuristicType::GEMM_Type:
+                    write_leaf_value(os, leaf_value<GEMMType>(node.second.get()));
+                    break;
+                case HeuristicType::GEMM_Config_Native:
+                    write_leaf_value(os, leaf_value<GEMMConfigNative>(node.second.get()));
+                    break;
+                case HeuristicType::GEMM_Config_Reshaped_Only_RHS:
+                    write_leaf_value(os, leaf_value<GEMMConfigReshapedOnlyRHS>(node.second.get()));
+                    break;
+                case HeuristicType::GEMM_Config_Reshaped:
+                default:
+                    write_leaf_value(os, leaf_value<GEMMConfigReshaped>(node.second.get()));
+                    break;
+            }
+            os << "\n";
+        }
+    }
+    os << "</heuristic>\n";
+}
+
 /** Explicit template instantiation @relates HeuristicTree */
 template std::pair<bool, GEMMType> HeuristicTree::query<GEMMType>(GEMMShape shape) const;
 /** Explicit template instantiation @relates HeuristicTree */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 
 #include <map>
 #include <memory>
+#include <ostream>
 #include <string>
 #include <utility>
 
@@ -176,6 +177,37 @@ public:
      */
     bool check();
 
+    /** Get the number of nodes of the tree
+     * @return size_t
+     */
+    size_t num_nodes() const
+    {
+        return _tree.size();
+    }
+
+    /** Get the maximum number of nodes a tree can contain
+     * @return size_t
+     */
+    static constexpr size_t max_num_nodes()
+    {
+        return _max_num_nodes;
+    }
+
+    /** Add the nodes of another tree of the same heuristic type as a subtree
+     *
+     * @param root_id  ID given to the root of @p other
+     * @param next_id  First free node ID, added to the ID of every other node of @p other. Advanced past the added nodes
+     * @param other    Tree to copy the nodes from
+     * @return bool  If the addition succeeded or not
+     */
+    bool add_subtree(NodeID root_id, NodeID &next_id, const HeuristicTree &other);
+
+    /** Write the tree in the DotMLGO format
+     *
+     * @param os Output stream
+     */
+    void write(std::ostream &os) const;
+
 private:
     static constexpr size_t _max_query_depth{1000}; // Maximum depth of query
     static constexpr size_t _max_num_nodes{100000}; // Maximum number of nodes contained by the tree
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,8 @@
 #include "src/runtime/CL/mlgo/Utils.h"
 
 #include <fstream>
+#include <set>
+#include <vector>
 
 namespace arm_compute
 {
@@ -50,9 +52,149 @@ bool operator==(const GEMMConfigReshaped &lhs, const GEMMConfigReshaped &rhs)
                                                      rhs.interleave_rhs, rhs.transpose_rhs, rhs.export_cl_image);
 }
 
+namespace
+{
+const char *to_dotmlgo(DataType data_type)
+{
+    switch (data_type)
+    {
+        case DataType::F16:
+            return "f16";
+        case DataType::QASYMM8:
+            return "qasymm8";
+        case DataType::F32:
+        default:
+            return "f32";
+    }
+}
+
+const char *to_dotmlgo(HeuristicType heuristic_type)
+{
+    switch (heuristic_type)
+    {
+        case HeuristicType::GEMM_Type:
+            return "gemm-type";
+        case HeuristicType::GEMM_Config_Native:
+            return "gemm-config-native";
+        case HeuristicType::GEMM_Config_Reshaped_Only_RHS:
+            return "gemm-config-reshaped-only-rhs";
+        case HeuristicType::GEMM_Config_Reshaped:
+        default:
+            return "gemm-config-reshaped";
+    }
+}
+
+template <typename T>
+using TunedEntries = std::vector<std::pair<GEMMShape, T>>;
+
+/** Number of shape features the tuned configurations are matched on: m, n, k and b */
+constexpr size_t num_shape_features = 4;
+
+unsigned int shape_feature(const GEMMShape &shape, size_t level)
+{
+    const unsigned int features[num_shape_features] = {shape.m, shape.n, shape.k, shape.b};
+    return features[level];
+}
+
+/** Add the nodes matching the shapes of the tuned entries one feature at a time
+ *
+ * The shapes without a tuned configuration fall back to a copy of the prior tree or, if there is no prior tree, to one
+ * of the tuned configurations sharing the features matched so far.
+ */
+template <typename T>
+bool add_tuned_nodes(HeuristicTree         &tree,
+                     HeuristicTree::NodeID  id,
+                     HeuristicTree::NodeID &next_id,
+                     const TunedEntries<T> &entries,
+                     size_t                 level,
+                     const HeuristicTree   *prior)
+{
+    static const char *feature_names[num_shape_features] = {"m", "n", "k", "b"};
+    if (level == num_shape_features)
+    {
+        return tree.add_leaf(id, entries.front().second);
+    }
+
+    std::map<unsigned int, TunedEntries<T>> groups;
+    for (const auto &entry : entries)
+    {
+        groups[shape_feature(entry.first, level)].push_back(entry);
+    }
+    for (const auto &group : groups)
+    {
+        const HeuristicTree::NodeID match    = next_id++;
+        const HeuristicTree::NodeID no_match = next_id++;
+        const Condition cond{feature_names[level], ConditionalOp::EQ, static_cast<float>(group.first)};
+        if (!tree.add_branch(id, cond, match, no_match) ||
+            !add_tuned_nodes(tree, match, next_id, group.second, level + 1, prior))
+        {
+            return false;
+        }
+        id = no_match;
+    }
+    return prior != nullptr ? tree.add_subtree(id, next_id, *prior) : tree.add_leaf(id, entries.front().second);
+}
+
+/** Build the trees holding the tuned configurations of a heuristic type, one per IP target and data type */
+template <typename T, typename Key>
+void merge_tuned(HeuristicType                                        heuristic_type,
+                 const std::map<Key, T>                              &tuned,
+                 const std::map<HeuristicTree::Index, HeuristicTree> &trees,
+                 std::map<HeuristicTree::Index, HeuristicTree>       &merged,
+                 HeuristicTree::TreeID                               &next_tree_id)
+{
+    std::map<HeuristicTree::Index, TunedEntries<T>> entries;
+    for (const auto &t : tuned)
+    {
+        const auto &key = t.first;
+        entries[std::make_tuple(heuristic_type, std::get<0>(key), std::get<1>(key))].push_back(
+            std::make_pair(GEMMShape{std::get<2>(key), std::get<3>(key), std::get<4>(key), std::get<5>(key)}, t.second));
+    }
+
+    for (const auto &e : entries)
+    {
+        const auto                 prior_it = trees.find(e.first);
+        const HeuristicTree *const prior    = prior_it != trees.end() ? &prior_it->second : nullptr;
+
+        // Every branch list ends with a fall back: make sure copying the prior tree for each of them is affordable
+        size_t num_fall_backs = 1;
+        for (size_t level = 1; level < num_shape_features; ++level)
+        {
+            std::set<std::vector<unsigned int>> prefixes;
+            for (const auto &entry : e.second)
+            {
+                std::vector<unsigned int> prefix;
+                for (size_t f = 0; f < level; ++f)
+                {
+                    prefix.push_back(shape_feature(entry.first, f));
+                }
+                prefixes.insert(prefix);
+            }
+            num_fall_backs += prefixes.size();
+        }
+        const size_t max_tuned_nodes = 2 * num_shape_features * e.second.size();
+        const bool   copy_prior      = prior != nullptr &&
+                                (num_fall_backs * prior->num_nodes() + max_tuned_nodes < HeuristicTree::max_num_nodes());
+
+        const HeuristicTree::TreeID tree_id = prior != nullptr ? prior->id() : next_tree_id++;
+        HeuristicTree               tree(tree_id, heuristic_type, std::get<1>(e.first), std::get<2>(e.first));
+        HeuristicTree::NodeID       next_id = 1;
+        if (add_tuned_nodes(tree, 0, next_id, e.second, 0, copy_prior ? prior : nullptr))
+        {
+            merged.emplace(e.first, std::move(tree));
+        }
+        else
+        {
+            ARM_COMPUTE_LOG_INFO_MSG_CORE("Cannot merge the tuned configurations with their heuristic tree");
+        }
+    }
+}
+} // namespace
+
 constexpr size_t MLGOHeuristics::_max_num_trees;
 
-MLGOHeuristics::MLGOHeuristics() : _indices{}, _trees{}, _tree_valid{}, _valid{false}
+MLGOHeuristics::MLGOHeuristics()
+    : _indices{}, _trees{}, _tree_valid{}, _valid{false}, _tuned_reshaped_only_rhs{}, _tuned_reshaped{}
 {
 }
 
@@ -98,6 +240,11 @@ std::pair<bool, GEMMConfigReshapedOnlyRHS> MLGOHeuristics::query_gemm_config_res
     ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("MLGOHeuristics querying gemm config reshaped only rhs. %s.",
                                               to_string(query).c_str());
     const auto invalid = GEMMConfigReshapedOnlyRHS{};
+    const auto tuned   = query_tuned_gemm_config_reshaped_only_rhs(query);
+    if (tuned.first)
+    {
+        return tuned;
+    }
     if (!_valid)
     {
         ARM_COMPUTE_LOG_INFO_MSG_CORE("Invalid DotMLGO. Use default heuristics instead");
@@ -117,6 +264,11 @@ std::pair<bool, GEMMConfigReshaped> MLGOHeuristics::query_gemm_config_reshaped(c
     ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("MLGOHeuristics querying gemm config reshaped. %s.",
                                               to_string(query).c_str());
     const auto invalid = GEMMConfigReshaped{};
+    const auto tuned   = query_tuned_gemm_config_reshaped(query);
+    if (tuned.first)
+    {
+        return tuned;
+    }
     if (!_valid)
     {
         ARM_COMPUTE_LOG_INFO_MSG_CORE("Invalid DotMLGO. Use default heuristics instead");
@@ -132,6 +284,38 @@ std::pair<bool, GEMMConfigReshaped> MLGOHeuristics::query_gemm_config_reshaped(c
     return _trees.at(index).query<GEMMConfigReshaped>(shape_query);
 }
 
+void MLGOHeuristics::add_tuned_gemm_config_reshaped_only_rhs(const Query &query, const GEMMConfigReshapedOnlyRHS &config)
+{
+    _tuned_reshaped_only_rhs[TunedKey{query.ip_target, query.data_type, query.m, query.n, query.k, query.b}] = config;
+}
+
+void MLGOHeuristics::add_tuned_gemm_config_reshaped(const Query &query, const GEMMConfigReshaped &config)
+{
+    _tuned_reshaped[TunedKey{query.ip_target, query.data_type, query.m, query.n, query.k, query.b}] = config;
+}
+
+std::pair<bool, GEMMConfigReshapedOnlyRHS>
+MLGOHeuristics::query_tuned_gemm_config_reshaped_only_rhs(const Query &query) const
+{
+    const auto it =
+        _tuned_reshaped_only_rhs.find(TunedKey{query.ip_target, query.data_type, query.m, query.n, query.k, query.b});
+    if (it == _tuned_reshaped_only_rhs.end())
+    {
+        return {false, GEMMConfigReshapedOnlyRHS{}};
+    }
+    return {true, it->second};
+}
+
+std::pair<bool, GEMMConfigReshaped> MLGOHeuristics::query_tuned_gemm_config_reshaped(const Query &query) const
+{
+    const auto it = _tuned_reshaped.find(TunedKey{query.ip_target, query.data_type, query.m, query.n, query.k, query.b});
+    if (it == _tuned_reshaped.end())
+    {
+        return {false, GEMMConfigReshaped{}};
+    }
+    return {true, it->second};
+}
+
 bool MLGOHeuristics::check_heuristic_tree(HeuristicTree::TreeID id)
 {
     bool           status;
@@ -243,5 +427,66 @@ bool MLGOHeuristics::reload_from_stream(std::istream &in)
     return _valid = true;
 }
 
+bool MLGOHeuristics::save_to_file(const std::string &filename) const
+{
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    if (!fs.is_open())
+    {
+        ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Cannot open DotMLGO file %s", filename.c_str());
+        return false;
+    }
+    save_to_stream(fs);
+    return true;
+}
+
+void MLGOHeuristics::save_to_stream(std::ostream &os) const
+{
+    // The trees are only written if the heuristics were loaded successfully
+    static const std::map<HeuristicTree::Index, HeuristicTree> no_trees{};
+    const auto                                                &trees = _valid ? _trees : no_trees;
+
+    HeuristicTree::TreeID next_tree_id = (_valid && !_indices.empty()) ? _indices.rbegin()->first + 1 : 0;
+    std::map<HeuristicTree::Index, HeuristicTree> merged;
+    merge_tuned(HeuristicType::GEMM_Config_Reshaped_Only_RHS, _tuned_reshaped_only_rhs, trees, merged, next_tree_id);
+    merge_tuned(HeuristicType::GEMM_Config_Reshaped, _tuned_reshaped, trees, merged, next_tree_id);
+
+    std::vector<const HeuristicTree *> to_write;
+    for (const auto &t : trees)
+    {
+        const auto m = merged.find(t.first);
+        to_write.push_back(m != merged.end() ? &m->second : &t.second);
+    }
+    for (const auto &m : merged)
+    {
+        if (trees.find(m.first) == trees.end())
+        {
+            to_write.push_back(&m.second);
+        }
+    }
+
+    os << "<header>\n";
+    os << "gemm-version, [1, 2, 1]\n";
+    os << "ip-type, gpu\n";
+    os << "</header>\n";
+    os << "<heuristics-table>\n";
+    for (const auto t : to_write)
+    {
+        HeuristicType ht;
+        std::string   ip;
+        DataType      dt;
+        std::tie(ht, ip, dt) = t->index();
+        // The number of cores is not part of the index of the trees, it is not used by the queries
+        os << t->id() << ", " << ip << ", 0, " << to_dotmlgo(dt) << ", best-performance, static, " << to_dotmlgo(ht)
+           << ", [m, n, k, b]\n";
+    }
+    os << "</heuristics-table>\n";
+    for (const auto t : to_write)
+    {
+        t->write(os);
+    }
+}
+
 } // namespace mlgo
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 #include <iostream>
 #include <map>
 #include <string>
+#include <tuple>
 #include <utility>
 namespace arm_compute
 {
@@ -109,6 +110,53 @@ public:
      */
     bool reload_from_stream(std::istream &istream);
 
+    /** Save the heuristics to a dotmlgo file
+     *
+     * @param[in] filename Path to the dotmlgo file. (Content will be overwritten)
+     *
+     * @return bool Signals if the file was written
+     */
+    bool save_to_file(const std::string &filename) const;
+    /** Save the heuristics to an output stream
+     *
+     * The tuned configurations are merged in front of the trees of their index: a query matching exactly one of their
+     * shapes returns the tuned configuration, the other queries follow the original tree.
+     *
+     * @param[out] ostream Ostream to write the mlgo heuristics to
+     */
+    void save_to_stream(std::ostream &ostream) const;
+
+    /** Record the tuned gemm configuration for reshaped only rhs kernel of a query
+     *
+     * Tuned configurations take precedence over the heuristic trees when queried with the same shape
+     *
+     * @param[in] query  Query the configuration has been tuned for
+     * @param[in] config Tuned configuration
+     */
+    void add_tuned_gemm_config_reshaped_only_rhs(const Query &query, const GEMMConfigReshapedOnlyRHS &config);
+    /** Record the tuned gemm configuration for reshaped kernel of a query
+     *
+     * Tuned configurations take precedence over the heuristic trees when queried with the same shape
+     *
+     * @param[in] query  Query the configuration has been tuned for
+     * @param[in] config Tuned configuration
+     */
+    void add_tuned_gemm_config_reshaped(const Query &query, const GEMMConfigReshaped &config);
+    /** Query the tuned gemm configuration for reshaped only rhs kernel
+     *
+     * @param[in] query Query
+     *
+     * @return std::pair<bool, GEMMConfigReshapedOnlyRHS>   bool signals if a configuration has been tuned for the query
+     */
+    std::pair<bool, GEMMConfigReshapedOnlyRHS> query_tuned_gemm_config_reshaped_only_rhs(const Query &query) const;
+    /** Query the tuned gemm configuration for reshaped kernel
+     *
+     * @param[in] query Query
+     *
+     * @return std::pair<bool, GEMMConfigReshaped>   bool signals if a configuration has been tuned for the query
+     */
+    std::pair<bool, GEMMConfigReshaped> query_tuned_gemm_config_reshaped(const Query &query) const;
+
     /** Get the heuristic tree from tree id
      *
      * @param[in] id Tree id.
@@ -137,12 +185,17 @@ public:
 private:
     static constexpr size_t _max_num_trees{100}; /**< Max number of trees that can be added*/
 
+    /** Key of the tuned configurations: IP target, data type, m, n, k and b */
+    using TunedKey = std::tuple<std::string, DataType, unsigned int, unsigned int, unsigned int, unsigned int>;
+
 private:
     // There exists a one-to-one mappipng between TreeID and Index, either can be used to identify a @ref HeuristicTree
     std::map<HeuristicTree::TreeID, HeuristicTree::Index> _indices;    /**< A mapping from TreeID to Index */
     std::map<HeuristicTree::Index, HeuristicTree>         _trees;      /**< A mapping from Index to HeuristicTree */
     std::map<HeuristicTree::TreeID, bool>                 _tree_valid; /**< Result cache of the tree validity checks */
     bool                                                  _valid;      /**< Overall validity */
+    std::map<TunedKey, GEMMConfigReshapedOnlyRHS> _tuned_reshaped_only_rhs; /**< Tuned reshaped only rhs configs */
+    std::map<TunedKey, GEMMConfigReshaped>        _tuned_reshaped;          /**< Tuned reshaped configs */
 };
 
 } // namespace mlgo
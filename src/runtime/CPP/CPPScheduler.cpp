@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, 2025 Arm Limited.
+ * Copyright (c) 2016-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,15 +29,27 @@
 #include "arm_compute/core/Log.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/runtime/Tracer.h"
 
+#include "src/common/cpuinfo/CpuModel.h"
+#include "src/runtime/SchedulerAsyncQueue.h"
+#include "src/runtime/SchedulerUtils.h"
 #include "support/Mutex.h"
+#include "support/StringSupport.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cmath>
 #include <condition_variable>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <system_error>
 #include <thread>
 #include <vector>
@@ -74,41 +86,183 @@ private:
     const unsigned int _end;
 };
 
-/** Execute workloads[info.thread_id] first, then call the feeder to get the index of the next workload to run.
+struct PreemptionSlot;
+
+/** Parts of an indexed job shared between the threads */
+struct Jobs
+{
+    IScheduler::IndexedJob job;        /**< Function running one part */
+    void                  *context;    /**< State passed to @ref job */
+    unsigned int           size;       /**< Number of parts */
+    PreemptionSlot        *preemption; /**< High priority job to help between two parts, nullptr if none */
+};
+
+/** High priority job published to the threads running the current job
+ *
+ * The threads pull parts of the high priority job between two parts of their own one. Each thread taking part keeps
+ * a thread id of its own, below the number of threads of the scheduler.
+ */
+struct PreemptionSlot
+{
+    std::atomic<bool>         open{false};        /**< Whether the threads of the current job can pull parts */
+    std::atomic<unsigned int> num_helpers{0};     /**< Number of threads of the current job pulling parts */
+    std::atomic<unsigned int> next{0};            /**< Index of the next part to run */
+    const Jobs               *jobs{nullptr};      /**< Parts of the high priority job */
+    unsigned int              num_threads{0};     /**< Number of threads of the scheduler */
+    unsigned int              first_thread_id{0}; /**< Thread id of the first relay participant */
+    std::mutex                exception_mutex{};  /**< Protects @ref exception */
+    std::exception_ptr        exception{nullptr}; /**< First exception thrown by a helping thread */
+};
+
+/** Runs the parts of a high priority job until all of them have been pulled
  *
- * Will run workloads until the feeder reaches the end of its range.
+ * @param[in] slot Slot of the high priority job.
+ * @param[in] info Threading info of the calling thread. The number of threads is replaced by the scheduler's one.
+ */
+void pull_preempting_parts(PreemptionSlot &slot, const ThreadInfo &info)
+{
+    ThreadInfo part_info  = info;
+    part_info.num_threads = static_cast<int>(slot.num_threads);
+    unsigned int part     = slot.next.fetch_add(1U, std::memory_order_relaxed);
+    for (; part < slot.jobs->size; part = slot.next.fetch_add(1U, std::memory_order_relaxed))
+    {
+        ARM_COMPUTE_TRACE_SCOPE("workload", "preempting_workload");
+        slot.jobs->job(slot.jobs->context, part, part_info);
+    }
+}
+
+/** Indexed job making participant @p index of a parallel run pull the parts of a high priority job */
+void run_preempting_parts(void *context, unsigned int index, const ThreadInfo &info)
+{
+    auto      &slot      = *static_cast<PreemptionSlot *>(context);
+    ThreadInfo part_info = info;
+    part_info.thread_id  = static_cast<int>(slot.first_thread_id + index);
+    pull_preempting_parts(slot, part_info);
+}
+
+/** Helps the high priority job published in the slot, if any, between two parts of the current job
  *
- * @param[in]     workloads The array of workloads
- * @param[in,out] feeder    The feeder indicating which workload to execute next.
- * @param[in]     info      Threading and CPU info.
+ * @param[in] slot Slot of the high priority job.
+ * @param[in] info Threading info of the calling thread in the current job.
  */
-void process_workloads(std::vector<IScheduler::Workload> &workloads, ThreadFeeder &feeder, const ThreadInfo &info)
+void help_preempting_job(PreemptionSlot &slot, const ThreadInfo &info)
+{
+    if (!slot.open.load(std::memory_order_acquire))
+    {
+        return;
+    }
+    // Check the slot again once registered so that its owner waits for this thread before returning
+    slot.num_helpers.fetch_add(1U);
+    if (slot.open.load())
+    {
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            pull_preempting_parts(slot, info);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch (...)
+        {
+            // The exception belongs to the high priority job, not to the current one
+            std::lock_guard<std::mutex> lock(slot.exception_mutex);
+            if (slot.exception == nullptr)
+            {
+                slot.exception = std::current_exception();
+            }
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+    }
+    slot.num_helpers.fetch_sub(1U);
+}
+
+/** Execute part info.thread_id of the jobs first, then call the feeder to get the index of the next part to run.
+ *
+ * Will run parts until the feeder reaches the end of its range. A high priority job published in the preemption
+ * slot of the jobs is helped between two parts.
+ *
+ * @param[in]     jobs   The parts to run
+ * @param[in,out] feeder The feeder indicating which part to execute next.
+ * @param[in]     info   Threading and CPU info.
+ */
+void process_workloads(const Jobs &jobs, ThreadFeeder &feeder, const ThreadInfo &info)
 {
     unsigned int workload_index = info.thread_id;
     do
     {
-        ARM_COMPUTE_ERROR_ON(workload_index >= workloads.size());
-        workloads[workload_index](info);
+        ARM_COMPUTE_ERROR_ON(workload_index >= jobs.size);
+        {
+            ARM_COMPUTE_TRACE_SCOPE("workload", "workload");
+            jobs.job(jobs.context, workload_index, info);
+        }
+        if (jobs.preemption != nullptr)
+        {
+            help_preempting_job(*jobs.preemption, info);
+        }
     } while (feeder.get_next(workload_index));
 }
 
-/** Set thread affinity. Pin current thread to a particular core
+/** Priority of the jobs submitted by the current thread */
+thread_local CPPScheduler::Priority current_thread_priority = CPPScheduler::Priority::NORMAL;
+
+/** Relative capacity of a core
+ *
+ * @param[in] core Logical core id. If negative or unknown, a capacity of 1 is returned.
  *
- * @param[in] core_id ID of the core to which the current thread is pinned
+ * @return The capacity of the core's model relative to a big core
  */
-void set_thread_affinity(int core_id)
+float core_capacity(int core)
 {
-    if (core_id < 0)
+    const CPUInfo &info = CPUInfo::get();
+    if (core < 0 || static_cast<unsigned int>(core) >= info.get_cpu_num())
     {
-        return;
+        return 1.f;
     }
+    return cpuinfo::model_relative_capacity(info.get_cpu_model(static_cast<unsigned int>(core)));
+}
 
-#if !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__)
-    cpu_set_t set;
-    CPU_ZERO(&set);
-    CPU_SET(core_id, &set);
-    ARM_COMPUTE_EXIT_ON_MSG(sched_setaffinity(0, sizeof(set), &set), "Error setting thread affinity");
-#endif /* !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__) */
+/** NUMA node of a core
+ *
+ * @param[in] core Logical core id. If negative, node 0 is returned.
+ *
+ * @return The NUMA node of the core
+ */
+unsigned int core_numa_node(int core)
+{
+    return core < 0 ? 0U : CPUInfo::get().get_cpu_numa_node(static_cast<unsigned int>(core));
+}
+
+/** Busy-wait until the predicate is satisfied or the given duration has elapsed
+ *
+ * @param[in] pred     Predicate to poll.
+ * @param[in] spin_us  Maximum duration of the busy-wait in microseconds. If 0 the predicate is checked only once.
+ *
+ * @return The value of the predicate when leaving the busy-wait
+ */
+template <typename Predicate>
+bool spin_until(Predicate pred, unsigned int spin_us)
+{
+    if (spin_us == 0)
+    {
+        return pred();
+    }
+
+    const auto   deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(spin_us);
+    unsigned int iter     = 0;
+    while (!pred())
+    {
+#if defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield" ::: "memory");
+#elif defined(__x86_64__) || defined(__i386__)
+        __asm__ __volatile__("pause" ::: "memory");
+#endif /* defined(__aarch64__) || defined(__arm__) */
+        // Reading the clock is much more expensive than polling the predicate
+        if ((++iter % 64) == 0 && std::chrono::steady_clock::now() >= deadline)
+        {
+            return pred();
+        }
+    }
+    return true;
 }
 
 /** There are currently 2 scheduling modes supported by CPPScheduler
@@ -158,7 +312,7 @@ public:
     ~Thread();
 
     /** Set workloads */
-    void set_workload(std::vector<IScheduler::Workload> *workloads, ThreadFeeder &feeder, const ThreadInfo &info);
+    void set_workload(const Jobs *jobs, ThreadFeeder &feeder, const ThreadInfo &info);
 
     /** Request the worker thread to start executing workloads.
      *
@@ -176,6 +330,15 @@ public:
     /** Function ran by the worker thread. */
     void worker_thread();
 
+    /** Set how long the thread busy-waits before parking on its condition variable
+     *
+     * @param[in] spin_us Busy-wait duration in microseconds. 0 to park immediately.
+     */
+    void set_spin_duration(unsigned int spin_us)
+    {
+        _spin_us.store(spin_us, std::memory_order_relaxed);
+    }
+
     /** Set the scheduling strategy to be linear */
     void set_linear_mode()
     {
@@ -195,12 +358,13 @@ public:
 private:
     std::thread                        _thread{};
     ThreadInfo                         _info{};
-    std::vector<IScheduler::Workload> *_workloads{nullptr};
+    const Jobs                        *_jobs{nullptr};
     ThreadFeeder                      *_feeder{nullptr};
     std::mutex                         _m{};
     std::condition_variable            _cv{};
-    bool                               _wait_for_work{false};
-    bool                               _job_complete{true};
+    std::atomic<bool>                  _wait_for_work{false};
+    std::atomic<bool>                  _job_complete{true};
+    std::atomic<unsigned int>          _spin_us{0};
     std::exception_ptr                 _current_exception{nullptr};
     int                                _core_pin{-1};
     std::list<Thread>                 *_thread_pool{nullptr};
@@ -225,9 +389,9 @@ Thread::~Thread()
     }
 }
 
-void Thread::set_workload(std::vector<IScheduler::Workload> *workloads, ThreadFeeder &feeder, const ThreadInfo &info)
+void Thread::set_workload(const Jobs *jobs, ThreadFeeder &feeder, const ThreadInfo &info)
 {
-    _workloads = workloads;
+    _jobs      = jobs;
     _feeder    = &feeder;
     _info      = info;
 }
@@ -244,27 +408,34 @@ void Thread::start()
 
 std::exception_ptr Thread::wait()
 {
+    // Only park if the job did not complete within the spin duration
+    if (!spin_until([&] { return _job_complete.load(std::memory_order_acquire); },
+                    _spin_us.load(std::memory_order_relaxed)))
     {
         std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _job_complete; });
+        _cv.wait(lock, [&] { return _job_complete.load(std::memory_order_relaxed); });
     }
     return _current_exception;
 }
 
 void Thread::worker_thread()
 {
-    set_thread_affinity(_core_pin);
+    scheduler_utils::set_thread_affinity(_core_pin);
 
     while (true)
     {
+        // Poll for new work for a while before parking: this saves the futex round trip when kernels are short
+        spin_until([&] { return _wait_for_work.load(std::memory_order_acquire); },
+                   _spin_us.load(std::memory_order_relaxed));
+
         std::unique_lock<std::mutex> lock(_m);
-        _cv.wait(lock, [&] { return _wait_for_work; });
+        _cv.wait(lock, [&] { return _wait_for_work.load(std::memory_order_relaxed); });
         _wait_for_work = false;
 
         _current_exception = nullptr;
 
         // Exit if the worker thread has not been fed with workloads
-        if (_workloads == nullptr || _feeder == nullptr)
+        if (_jobs == nullptr || _feeder == nullptr)
         {
             return;
         }
@@ -285,7 +456,7 @@ void Thread::worker_thread()
         try
         {
 #endif /* ARM_COMPUTE_EXCEPTIONS_ENABLED */
-            process_workloads(*_workloads, *_feeder, _info);
+            process_workloads(*_jobs, *_feeder, _info);
 
 #ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
         }
@@ -294,12 +465,151 @@ void Thread::worker_thread()
             _current_exception = std::current_exception();
         }
 #endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
-        _workloads    = nullptr;
+        _jobs         = nullptr;
         _job_complete = true;
         lock.unlock();
         _cv.notify_one();
     }
 }
+
+/** Frequency scaling policies of the cores, i.e. their clusters */
+struct FrequencyPolicy
+{
+    std::string  cur_freq_path; /**< Path to the current frequency of the cores */
+    unsigned int max_freq;      /**< Maximum frequency of the cores in kHz */
+};
+
+/** Lists the cpufreq policies exposed by the kernel, none if cpufreq is not available */
+std::vector<FrequencyPolicy> frequency_policies()
+{
+    std::vector<FrequencyPolicy> policies;
+    for (unsigned int i = 0; i < CPUInfo::get().get_cpu_num(); ++i)
+    {
+        const std::string path = "/sys/devices/system/cpu/cpufreq/policy" + support::cpp11::to_string(i) + "/";
+        std::ifstream     file(path + "cpuinfo_max_freq", std::ios::in);
+        unsigned int      max_freq = 0;
+        if (file.is_open() && (file >> max_freq) && max_freq != 0)
+        {
+            policies.push_back(FrequencyPolicy{path + "scaling_cur_freq", max_freq});
+        }
+    }
+    return policies;
+}
+
+/** Current frequency of the cores relative to their maximum one, 0 if unknown */
+float frequency_ratio(const std::vector<FrequencyPolicy> &policies)
+{
+    uint64_t cur_freq = 0;
+    uint64_t max_freq = 0;
+    for (const auto &policy : policies)
+    {
+        std::ifstream file(policy.cur_freq_path, std::ios::in);
+        unsigned int  freq = 0;
+        if (file.is_open() && (file >> freq))
+        {
+            cur_freq += freq;
+            max_freq += policy.max_freq;
+        }
+    }
+    return max_freq == 0 ? 0.f : static_cast<float>(cur_freq) / static_cast<float>(max_freq);
+}
+
+/** Controller of the number of threads running the normal priority jobs in adaptive mode
+ *
+ * The time per job is averaged over epochs spanning many jobs, so that workloads repeating in steady state (e.g. the
+ * inferences of a model) give comparable measurements whatever their mix of kernels. At the end of each epoch, the
+ * controller probes the neighbouring thread counts whose measurement is missing or stale, and otherwise moves to the
+ * neighbouring count with the lowest time per job. A measurement becomes stale after a number of epochs, or as soon
+ * as the frequency of the cores has changed since it was made (e.g. when they are throttled as they heat up).
+ */
+class AdaptiveThreadCount
+{
+    static constexpr unsigned int max_age        = 16;   /**< Epochs after which a measurement is probed again */
+    static constexpr unsigned int min_epoch_jobs = 64;   /**< Minimum number of jobs of an epoch */
+    static constexpr unsigned int min_epoch_ms   = 200;  /**< Minimum busy time of an epoch */
+    static constexpr float        freq_tolerance = 0.1f; /**< Relative change of frequency invalidating a measurement */
+
+public:
+    /** Restarts the control over the given number of threads, all of them being active */
+    void reset(unsigned int max_threads)
+    {
+        _max_threads = std::max(max_threads, 1U);
+        _active      = _max_threads;
+        _times.assign(_max_threads + 1, 0.);
+        _freqs.assign(_max_threads + 1, 0.f);
+        _ages.assign(_max_threads + 1, max_age + 1);
+        _epoch_time = std::chrono::nanoseconds(0);
+        _epoch_jobs = 0;
+        if (_policies.empty())
+        {
+            _policies = frequency_policies();
+        }
+    }
+    /** Number of threads to run the next job on */
+    unsigned int active() const
+    {
+        return _active;
+    }
+    /** Records the duration of a job run on the active threads */
+    void record(std::chrono::nanoseconds duration)
+    {
+        _epoch_time += duration;
+        if (++_epoch_jobs >= min_epoch_jobs && _epoch_time >= std::chrono::milliseconds(min_epoch_ms))
+        {
+            end_epoch();
+        }
+    }
+
+private:
+    bool is_valid(unsigned int num_threads, float freq) const
+    {
+        return _ages[num_threads] <= max_age &&
+               (freq == 0.f || std::abs(freq - _freqs[num_threads]) <= freq_tolerance * _freqs[num_threads]);
+    }
+
+    void end_epoch()
+    {
+        const float freq = frequency_ratio(_policies);
+        for (auto &age : _ages)
+        {
+            age = std::min(age + 1, static_cast<unsigned int>(max_age + 1));
+        }
+        _times[_active] = static_cast<double>(_epoch_time.count()) / _epoch_jobs;
+        _freqs[_active] = freq;
+        _ages[_active]  = 0;
+        _epoch_time     = std::chrono::nanoseconds(0);
+        _epoch_jobs     = 0;
+
+        const unsigned int lower = std::max(_active - 1, 1U);
+        const unsigned int upper = std::min(_active + 1, _max_threads);
+        for (unsigned int num_threads : {lower, upper})
+        {
+            if (!is_valid(num_threads, freq))
+            {
+                _active = num_threads;
+                return;
+            }
+        }
+        unsigned int best = _active;
+        for (unsigned int num_threads : {lower, upper})
+        {
+            if (_times[num_threads] < _times[best])
+            {
+                best = num_threads;
+            }
+        }
+        _active = best;
+    }
+
+    unsigned int                 _max_threads{1};
+    unsigned int                 _active{1};
+    std::vector<double>          _times{};  // Time per job measured with each number of threads, in ns
+    std::vector<float>           _freqs{};  // Frequency ratio of the cores when each time was measured
+    std::vector<unsigned int>    _ages{};   // Epochs since each time was measured
+    std::chrono::nanoseconds     _epoch_time{0};
+    unsigned int                 _epoch_jobs{0};
+    std::vector<FrequencyPolicy> _policies{};
+};
 } //namespace
 
 struct CPPScheduler::Impl final
@@ -332,27 +642,79 @@ struct CPPScheduler::Impl final
         {
             _forced_mode = ModeToggle::None;
         }
+
+        const auto spin_env_v = utility::getenv("ARM_COMPUTE_CPP_SCHEDULER_SPIN_US");
+        if (!spin_env_v.empty())
+        {
+            set_spin_duration(static_cast<unsigned int>(std::strtoul(spin_env_v.c_str(), nullptr, 10)));
+        }
+
+        const auto adaptive_env_v = utility::getenv("ARM_COMPUTE_CPP_SCHEDULER_ADAPTIVE");
+        set_adaptive(!adaptive_env_v.empty() && adaptive_env_v != "0");
     }
     void set_num_threads(unsigned int num_threads, unsigned int thread_hint)
     {
         _num_threads = num_threads == 0 ? thread_hint : num_threads;
+        _threads.splice(_threads.end(), _reserved_threads);
         _threads.resize(_num_threads - 1);
-        auto_switch_mode(_num_threads);
+        _core_capacities.clear();
+        _core_numa_nodes.clear();
+        reserve_threads();
+        set_spin_duration(_spin_us);
+        auto_switch_mode(num_normal_threads());
+        set_adaptive(_use_adaptive);
     }
     void set_num_threads_with_affinity(unsigned int num_threads, unsigned int thread_hint, BindFunc func)
     {
         _num_threads = num_threads == 0 ? thread_hint : num_threads;
 
         // Set affinity on main thread
-        set_thread_affinity(func(0, thread_hint));
+        const int main_core = func(0, thread_hint);
+        scheduler_utils::set_thread_affinity(main_core);
 
         // Set affinity on worked threads
+        _reserved_threads.clear();
         _threads.clear();
+        _core_capacities.assign(1, core_capacity(main_core));
+        _core_numa_nodes.assign(1, core_numa_node(main_core));
         for (auto i = 1U; i < _num_threads; ++i)
         {
-            _threads.emplace_back(func(i, thread_hint));
+            const int core = func(i, thread_hint);
+            _threads.emplace_back(core);
+            _core_capacities.push_back(core_capacity(core));
+            _core_numa_nodes.push_back(core_numa_node(core));
+        }
+        reserve_threads();
+        set_spin_duration(_spin_us);
+        auto_switch_mode(num_normal_threads());
+        set_adaptive(_use_adaptive);
+    }
+    /** Enables the adaptive number of threads, restarting its control over the threads of the normal priority jobs */
+    void set_adaptive(bool enable)
+    {
+        _use_adaptive = enable;
+        if (enable)
+        {
+            _adaptive.reset(num_normal_threads());
+        }
+    }
+    /** Number of threads the next normal priority job runs on, the calling thread included */
+    unsigned int num_active_threads() const
+    {
+        return _use_adaptive ? std::min(_adaptive.active(), num_normal_threads()) : num_normal_threads();
+    }
+    /** Moves the last worker threads to the reserved ones, which keep the cores they are bound to */
+    void reserve_threads()
+    {
+        _threads.splice(_threads.end(), _reserved_threads);
+        const auto num_reserved = std::min(static_cast<size_t>(_num_reserved), _threads.size());
+        _reserved_threads.splice(_reserved_threads.end(), _threads, std::prev(_threads.end(), num_reserved),
+                                 _threads.end());
+        // The reserved threads are started one by one by the high priority jobs
+        for (auto &thread : _reserved_threads)
+        {
+            thread.set_linear_mode();
         }
-        auto_switch_mode(_num_threads);
     }
     void auto_switch_mode(unsigned int num_threads_to_use)
     {
@@ -371,6 +733,18 @@ struct CPPScheduler::Impl final
                                                       num_threads_to_use);
         }
     }
+    void set_spin_duration(unsigned int spin_us)
+    {
+        _spin_us = spin_us;
+        for (auto &thread : _threads)
+        {
+            thread.set_spin_duration(spin_us);
+        }
+        for (auto &thread : _reserved_threads)
+        {
+            thread.set_spin_duration(spin_us);
+        }
+    }
     void set_linear_mode()
     {
         for (auto &thread : _threads)
@@ -404,6 +778,11 @@ struct CPPScheduler::Impl final
     {
         return _num_threads;
     }
+    /** Number of threads the normal priority jobs run on, the calling thread included */
+    unsigned int num_normal_threads() const
+    {
+        return _num_threads - static_cast<unsigned int>(_reserved_threads.size());
+    }
     unsigned int wake_fanout() const
     {
         return _wake_fanout;
@@ -413,14 +792,36 @@ struct CPPScheduler::Impl final
         return _mode;
     }
 
-    void run_workloads(std::vector<IScheduler::Workload> &workloads);
+    /** Runs the jobs on the calling thread and the worker threads. The thread pool must be locked
+     *
+     * @param[in] jobs         Parts to run.
+     * @param[in] max_threads  Maximum number of threads to run the parts on, the calling thread included.
+     * @param[in] use_reserved Whether the reserved threads can run parts after the other worker threads.
+     */
+    void run_jobs(const Jobs &jobs, unsigned int max_threads, bool use_reserved);
+    /** Runs high priority jobs, preempting the job holding the thread pool at its granule boundaries
+     *
+     * @param[in] jobs Parts to run.
+     */
+    void run_high_priority_jobs(const Jobs &jobs);
 
-    unsigned int       _num_threads;
-    std::list<Thread>  _threads;
-    arm_compute::Mutex _run_workloads_mutex{};
-    Mode               _mode{Mode::Linear};
-    ModeToggle         _forced_mode{ModeToggle::None};
-    unsigned int       _wake_fanout{0};
+    unsigned int              _num_threads;
+    std::list<Thread>         _threads;
+    std::list<Thread>         _reserved_threads{};    // Worker threads only running high priority jobs
+    unsigned int              _num_reserved{0};       // Number of worker threads to reserve
+    arm_compute::Mutex        _run_workloads_mutex{};
+    arm_compute::Mutex        _high_priority_mutex{}; // Serializes the high priority jobs, locked before the pool
+    PreemptionSlot            _preemption{};
+    Mode                      _mode{Mode::Linear};
+    ModeToggle                _forced_mode{ModeToggle::None};
+    unsigned int              _wake_fanout{0};
+    unsigned int              _spin_us{0};
+    std::vector<float>        _core_capacities{}; // Capacity of the core of the main thread, then of each worker thread
+    std::vector<unsigned int> _core_numa_nodes{}; // NUMA node of the core of the main thread, then of each worker
+    bool                      _use_adaptive{false};
+    AdaptiveThreadCount       _adaptive{};
+    // Declared last so that pending asynchronous jobs complete before the thread pool is destroyed
+    SchedulerAsyncQueue       _async_queue{};
 };
 
 /*
@@ -441,6 +842,7 @@ CPPScheduler::~CPPScheduler() = default;
 void CPPScheduler::set_num_threads(unsigned int num_threads)
 {
     // No changes in the number of threads while current workloads are running
+    arm_compute::lock_guard<std::mutex> high_priority_lock(_impl->_high_priority_mutex);
     arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
     _impl->set_num_threads(num_threads, num_threads_hint());
 }
@@ -448,10 +850,87 @@ void CPPScheduler::set_num_threads(unsigned int num_threads)
 void CPPScheduler::set_num_threads_with_affinity(unsigned int num_threads, BindFunc func)
 {
     // No changes in the number of threads while current workloads are running
+    arm_compute::lock_guard<std::mutex> high_priority_lock(_impl->_high_priority_mutex);
     arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
     _impl->set_num_threads_with_affinity(num_threads, num_threads_hint(), func);
 }
 
+void CPPScheduler::set_spin_wait_duration(unsigned int spin_us)
+{
+    // No changes in the waiting policy while current workloads are running
+    arm_compute::lock_guard<std::mutex> high_priority_lock(_impl->_high_priority_mutex);
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->set_spin_duration(spin_us);
+}
+
+void CPPScheduler::set_num_reserved_threads(unsigned int num_reserved)
+{
+    // No changes in the thread pools while current workloads are running
+    arm_compute::lock_guard<std::mutex> high_priority_lock(_impl->_high_priority_mutex);
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->_num_reserved = num_reserved;
+    _impl->reserve_threads();
+    _impl->auto_switch_mode(_impl->num_normal_threads());
+    _impl->set_adaptive(_impl->_use_adaptive);
+}
+
+unsigned int CPPScheduler::num_reserved_threads() const
+{
+    return static_cast<unsigned int>(_impl->_reserved_threads.size());
+}
+
+void CPPScheduler::set_thread_priority(Priority priority)
+{
+    current_thread_priority = priority;
+}
+
+CPPScheduler::Priority CPPScheduler::thread_priority()
+{
+    return current_thread_priority;
+}
+
+void CPPScheduler::set_adaptive_threads(bool enable)
+{
+    // No changes in the number of active threads while current workloads are running
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->set_adaptive(enable);
+}
+
+bool CPPScheduler::adaptive_threads() const
+{
+    return _impl->_use_adaptive;
+}
+
+unsigned int CPPScheduler::num_active_threads() const
+{
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    return _impl->num_active_threads();
+}
+
+unsigned int CPPScheduler::spin_wait_duration() const
+{
+    return _impl->_spin_us;
+}
+
+void CPPScheduler::set_scheduling_mode(SchedulingMode mode)
+{
+    // No changes in the scheduling mode while current workloads are running
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    switch (mode)
+    {
+        case SchedulingMode::LINEAR:
+            _impl->_forced_mode = Impl::ModeToggle::Linear;
+            break;
+        case SchedulingMode::FANOUT:
+            _impl->_forced_mode = Impl::ModeToggle::Fanout;
+            break;
+        default:
+            _impl->_forced_mode = Impl::ModeToggle::None;
+            break;
+    }
+    _impl->auto_switch_mode(_impl->num_threads());
+}
+
 unsigned int CPPScheduler::num_threads() const
 {
     return _impl->num_threads();
@@ -460,57 +939,105 @@ unsigned int CPPScheduler::num_threads() const
 #ifndef DOXYGEN_SKIP_THIS
 void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
 {
+    run_indexed_jobs([](void *context, unsigned int index, const ThreadInfo &info)
+                     { (*static_cast<std::vector<IScheduler::Workload> *>(context))[index](info); },
+                     &workloads, static_cast<unsigned int>(workloads.size()));
+}
+
+void CPPScheduler::run_indexed_jobs(IndexedJob job, void *context, unsigned int num_jobs)
+{
+    if (current_thread_priority == Priority::HIGH)
+    {
+        _impl->run_high_priority_jobs(Jobs{job, context, num_jobs, nullptr});
+        return;
+    }
+
     // Mutex to ensure other threads won't interfere with the setup of the current thread's workloads
     // Other thread's workloads will be scheduled after the current thread's workloads have finished
     // This is not great because different threads workloads won't run in parallel but at least they
     // won't interfere each other and deadlock.
     arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
-    const unsigned int num_threads_to_use = std::min(_impl->num_threads(), static_cast<unsigned int>(workloads.size()));
+    if (!_impl->_use_adaptive)
+    {
+        _impl->run_jobs(Jobs{job, context, num_jobs, &_impl->_preemption}, _impl->num_normal_threads(), false);
+        return;
+    }
+
+    // The parts of the jobs are still split for all the threads, the active ones pulling them from the feeder
+    const auto start = std::chrono::steady_clock::now();
+    _impl->run_jobs(Jobs{job, context, num_jobs, &_impl->_preemption}, _impl->num_active_threads(), false);
+    if (num_jobs > 1)
+    {
+        _impl->_adaptive.record(std::chrono::steady_clock::now() - start);
+    }
+}
+
+void CPPScheduler::Impl::run_jobs(const Jobs &jobs, unsigned int max_threads, bool use_reserved)
+{
+    const unsigned int num_threads_to_use = std::min(max_threads, jobs.size);
     if (num_threads_to_use < 1)
     {
         return;
     }
+    // The worker threads of the pool come first, then the reserved ones, the calling thread takes the last id
+    const unsigned int num_workers =
+        std::min(num_threads_to_use - 1, static_cast<unsigned int>(_threads.size()));
+    const unsigned int num_reserved = use_reserved ? num_threads_to_use - 1 - num_workers : 0U;
+    ARM_COMPUTE_ERROR_ON(num_workers + num_reserved != num_threads_to_use - 1);
+    ARM_COMPUTE_ERROR_ON(num_reserved > _reserved_threads.size());
+
     // Re-adjust the mode if the actual number of threads to use is different from the number of threads created
-    _impl->auto_switch_mode(num_threads_to_use);
+    auto_switch_mode(num_workers + 1);
     int num_threads_to_start = 0;
-    switch (_impl->mode())
+    switch (mode())
     {
-        case CPPScheduler::Impl::Mode::Fanout:
+        case Mode::Fanout:
         {
-            num_threads_to_start = static_cast<int>(_impl->wake_fanout()) - 1;
+            num_threads_to_start = static_cast<int>(wake_fanout()) - 1;
             break;
         }
-        case CPPScheduler::Impl::Mode::Linear:
+        case Mode::Linear:
         default:
         {
-            num_threads_to_start = static_cast<int>(num_threads_to_use) - 1;
+            num_threads_to_start = static_cast<int>(num_workers);
             break;
         }
     }
-    ThreadFeeder feeder(num_threads_to_use, workloads.size());
+    ThreadFeeder feeder(num_threads_to_use, jobs.size);
     ThreadInfo   info;
-    info.cpu_info          = &cpu_info();
+    info.cpu_info          = &CPUInfo::get();
     info.num_threads       = num_threads_to_use;
     unsigned int t         = 0;
-    auto         thread_it = _impl->_threads.begin();
+    auto         thread_it = _threads.begin();
     // Set num_threads_to_use - 1 workloads to the threads as the remaining 1 is left to the main thread
-    for (; t < num_threads_to_use - 1; ++t, ++thread_it)
+    for (; t < num_workers; ++t, ++thread_it)
+    {
+        info.thread_id = t;
+        thread_it->set_workload(&jobs, feeder, info);
+    }
+    auto reserved_it = _reserved_threads.begin();
+    for (unsigned int r = 0; r < num_reserved; ++r, ++t, ++reserved_it)
     {
         info.thread_id = t;
-        thread_it->set_workload(&workloads, feeder, info);
+        reserved_it->set_workload(&jobs, feeder, info);
     }
-    thread_it = _impl->_threads.begin();
+    thread_it = _threads.begin();
     for (int i = 0; i < num_threads_to_start; ++i, ++thread_it)
     {
         thread_it->start();
     }
+    reserved_it = _reserved_threads.begin();
+    for (unsigned int r = 0; r < num_reserved; ++r, ++reserved_it)
+    {
+        reserved_it->start();
+    }
     info.thread_id                    = t; // Set main thread's thread_id
     std::exception_ptr last_exception = nullptr;
 #ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
     try
     {
 #endif                                              /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
-        process_workloads(workloads, feeder, info); // Main thread processes workloads
+        process_workloads(jobs, feeder, info); // Main thread processes workloads
 #ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
     }
     catch (...)
@@ -521,8 +1048,8 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
     try
     {
 #endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
-        thread_it = _impl->_threads.begin();
-        for (unsigned int i = 0; i < num_threads_to_use - 1; ++i, ++thread_it)
+        thread_it = _threads.begin();
+        for (unsigned int i = 0; i < num_workers; ++i, ++thread_it)
         {
             std::exception_ptr current_exception = thread_it->wait();
             if (current_exception)
@@ -530,6 +1057,15 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
                 last_exception = current_exception;
             }
         }
+        reserved_it = _reserved_threads.begin();
+        for (unsigned int r = 0; r < num_reserved; ++r, ++reserved_it)
+        {
+            std::exception_ptr current_exception = reserved_it->wait();
+            if (current_exception)
+            {
+                last_exception = current_exception;
+            }
+        }
         if (last_exception)
         {
             std::rethrow_exception(last_exception);
@@ -542,13 +1078,124 @@ void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
     }
 #endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
 }
+
+void CPPScheduler::Impl::run_high_priority_jobs(const Jobs &jobs)
+{
+    arm_compute::lock_guard<std::mutex> high_priority_lock(_high_priority_mutex);
+    if (jobs.size == 0)
+    {
+        return;
+    }
+
+    PreemptionSlot &slot = _preemption;
+    slot.jobs            = &jobs;
+    slot.num_threads     = _num_threads;
+    slot.exception       = nullptr;
+    slot.next.store(0U, std::memory_order_relaxed);
+
+    // The participants of the relay pull the parts of the high priority job from the slot
+    arm_compute::unique_lock<std::mutex> pool_lock(_run_workloads_mutex, std::try_to_lock);
+    if (pool_lock.owns_lock())
+    {
+        // Nothing to preempt: all the threads pull parts, the reserved ones included
+        slot.first_thread_id = 0;
+        run_jobs(Jobs{&run_preempting_parts, &slot, std::min(_num_threads, jobs.size), nullptr}, _num_threads, true);
+        return;
+    }
+
+    // The threads of the current job pull parts at their granule boundaries under thread ids below the reserved ones,
+    // which pull parts straight away
+    const auto   num_reserved = static_cast<unsigned int>(_reserved_threads.size());
+    const Jobs   relay{&run_preempting_parts, &slot, num_reserved, nullptr};
+    ThreadFeeder feeder(num_reserved, num_reserved);
+    ThreadInfo   info;
+    info.cpu_info        = &CPUInfo::get();
+    info.num_threads     = static_cast<int>(_num_threads);
+    slot.first_thread_id = _num_threads - num_reserved;
+    slot.open.store(true);
+    unsigned int r = 0;
+    for (auto &thread : _reserved_threads)
+    {
+        info.thread_id = static_cast<int>(r++);
+        thread.set_workload(&relay, feeder, info);
+        thread.start();
+    }
+
+    // Wait for the parts to be pulled, or for the current job to end
+    while (slot.next.load(std::memory_order_relaxed) < jobs.size && !pool_lock.try_lock())
+    {
+        std::this_thread::yield();
+    }
+    slot.open.store(false);
+    while (slot.num_helpers.load() != 0)
+    {
+        std::this_thread::yield();
+    }
+    std::exception_ptr last_exception = slot.exception;
+    for (auto &thread : _reserved_threads)
+    {
+        std::exception_ptr current_exception = thread.wait();
+        if (current_exception)
+        {
+            last_exception = current_exception;
+        }
+    }
+
+    // Without reserved threads, the parts left when the current job ended are run on the thread pool
+    if (last_exception == nullptr && slot.next.load(std::memory_order_relaxed) < jobs.size)
+    {
+        ARM_COMPUTE_ERROR_ON(!pool_lock.owns_lock());
+        slot.first_thread_id = 0;
+        run_jobs(Jobs{&run_preempting_parts, &slot, std::min(_num_threads, jobs.size), nullptr}, _num_threads, true);
+    }
+    if (last_exception)
+    {
+        std::rethrow_exception(last_exception);
+    }
+}
 #endif /* DOXYGEN_SKIP_THIS */
 
+std::vector<float> CPPScheduler::thread_capacities(unsigned int num_threads) const
+{
+    const auto &caps = _impl->_core_capacities;
+    if (caps.size() < num_threads)
+    {
+        return {};
+    }
+
+    // Worker thread i has thread id i and the main thread takes the last id, see run_workloads()
+    std::vector<float> capacities(caps.begin() + 1, caps.begin() + num_threads);
+    capacities.push_back(caps[0]);
+    return capacities;
+}
+
+std::vector<unsigned int> CPPScheduler::thread_numa_nodes(unsigned int num_threads) const
+{
+    const auto &nodes = _impl->_core_numa_nodes;
+    if (nodes.size() < num_threads || num_threads == 0)
+    {
+        return {};
+    }
+
+    // Same mapping from thread ids to cores as thread_capacities()
+    std::vector<unsigned int> thread_nodes(nodes.begin() + 1, nodes.begin() + num_threads);
+    thread_nodes.push_back(nodes[0]);
+    return thread_nodes;
+}
+
 void CPPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
 {
     schedule_common(kernel, hints, window, tensors);
 }
 
+IScheduler::CompletionHandle
+CPPScheduler::schedule_op_async(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
+{
+    // The job owns copies of the hints, window and pack so that the caller's ones can go out of scope
+    return _impl->_async_queue.enqueue([this, kernel, hints, window, tensors]() mutable
+                                       { schedule_common(kernel, hints, window, tensors); });
+}
+
 void CPPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
 {
     ITensorPack tensors;
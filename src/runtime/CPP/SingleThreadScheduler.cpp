@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/Tracer.h"
 
 namespace arm_compute
 {
@@ -37,6 +38,7 @@ void SingleThreadScheduler::set_num_threads(unsigned int num_threads)
 
 void SingleThreadScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
 {
+    ARM_COMPUTE_TRACE_SCOPE("kernel", kernel->name());
     const Window &max_window = kernel->window();
 
     if (hints.split_dimension() != IScheduler::split_dimensions_all)
@@ -59,6 +61,7 @@ void SingleThreadScheduler::schedule_op(ICPPKernel   *kernel,
                                         ITensorPack  &tensors)
 {
     ARM_COMPUTE_UNUSED(hints);
+    ARM_COMPUTE_TRACE_SCOPE("kernel", kernel->name());
     ThreadInfo info;
     info.cpu_info = &cpu_info();
     kernel->run_op(tensors, window, info);
@@ -0,0 +1,445 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/WorkStealingScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Log.h"
+
+#include "src/runtime/SchedulerAsyncQueue.h"
+#include "src/runtime/SchedulerUtils.h"
+#include "support/Mutex.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+/** Contiguous range of workload indices owned by a thread
+ *
+ * The owner consumes the range from the front while other threads steal from the back. Both ends are packed in a
+ * single 64-bit atomic so that either operation is a single compare-and-swap. During a run the range can only shrink,
+ * which rules out ABA issues.
+ */
+class WorkRange
+{
+public:
+    /** Set the range of workloads
+     *
+     * @note Must not be called while other threads access the range.
+     *
+     * @param[in] begin First workload index of the range.
+     * @param[in] end   One past the last workload index of the range.
+     */
+    void reset(unsigned int begin, unsigned int end)
+    {
+        _range.store(pack(begin, end), std::memory_order_relaxed);
+    }
+    /** Take the workload at the front of the range if there is one.
+     *
+     * @param[out] next Will contain the index of the workload if there is one.
+     *
+     * @return False if the range is empty and next wasn't set.
+     */
+    bool pop_front(unsigned int &next)
+    {
+        uint64_t current = _range.load(std::memory_order_relaxed);
+        while (begin_of(current) < end_of(current))
+        {
+            if (_range.compare_exchange_weak(current, pack(begin_of(current) + 1, end_of(current)),
+                                             std::memory_order_relaxed))
+            {
+                next = begin_of(current);
+                return true;
+            }
+        }
+        return false;
+    }
+    /** Take the workload at the back of the range if there is one.
+     *
+     * @param[out] next Will contain the index of the workload if there is one.
+     *
+     * @return False if the range is empty and next wasn't set.
+     */
+    bool steal_back(unsigned int &next)
+    {
+        uint64_t current = _range.load(std::memory_order_relaxed);
+        while (begin_of(current) < end_of(current))
+        {
+            if (_range.compare_exchange_weak(current, pack(begin_of(current), end_of(current) - 1),
+                                             std::memory_order_relaxed))
+            {
+                next = end_of(current) - 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    static constexpr uint64_t pack(unsigned int begin, unsigned int end)
+    {
+        return (static_cast<uint64_t>(end) << 32) | static_cast<uint64_t>(begin);
+    }
+    static constexpr unsigned int begin_of(uint64_t range)
+    {
+        return static_cast<unsigned int>(range & 0xFFFFFFFFu);
+    }
+    static constexpr unsigned int end_of(uint64_t range)
+    {
+        return static_cast<unsigned int>(range >> 32);
+    }
+
+    std::atomic<uint64_t> _range{0};
+    // Keep the ranges of different threads on different cache lines
+    char _padding[64 - sizeof(std::atomic<uint64_t>)]{};
+};
+
+/** Execute the workloads of the thread's own range, then steal workloads from the other threads.
+ *
+ * Ranges never grow during a run, hence once a victim has been found empty it does not need to be visited again.
+ *
+ * @param[in]     workloads The array of workloads
+ * @param[in,out] ranges    The ranges of all the threads taking part in the run (info.num_threads elements).
+ * @param[in]     info      Threading and CPU info.
+ */
+void process_workloads(std::vector<IScheduler::Workload> &workloads, WorkRange *ranges, const ThreadInfo &info)
+{
+    const unsigned int num_threads = static_cast<unsigned int>(info.num_threads);
+    const unsigned int thread_id   = static_cast<unsigned int>(info.thread_id);
+    unsigned int       index       = 0;
+
+    while (ranges[thread_id].pop_front(index))
+    {
+        ARM_COMPUTE_ERROR_ON(index >= workloads.size());
+        workloads[index](info);
+    }
+
+    for (unsigned int i = 1; i < num_threads; ++i)
+    {
+        WorkRange &victim = ranges[(thread_id + i) % num_threads];
+        while (victim.steal_back(index))
+        {
+            ARM_COMPUTE_ERROR_ON(index >= workloads.size());
+            workloads[index](info);
+        }
+    }
+}
+
+class Worker final
+{
+public:
+    /** Start a new thread
+     *
+     * Thread will be pinned to a given core id if value is non-negative
+     *
+     * @param[in] core_pin Core id to pin the thread on. If negative no thread pinning will take place
+     */
+    explicit Worker(int core_pin = -1);
+
+    Worker(const Worker &)            = delete;
+    Worker &operator=(const Worker &) = delete;
+    Worker(Worker &&)                 = delete;
+    Worker &operator=(Worker &&)      = delete;
+
+    /** Destructor. Make the thread join. */
+    ~Worker();
+
+    /** Set workloads */
+    void set_workload(std::vector<IScheduler::Workload> *workloads, WorkRange *ranges, const ThreadInfo &info);
+
+    /** Request the worker thread to start executing workloads.
+     *
+     * @note This function will return as soon as the workloads have been sent to the worker thread.
+     * wait() needs to be called to ensure the execution is complete.
+     */
+    void start();
+
+    /** Wait for the current kernel execution to complete. */
+    std::exception_ptr wait();
+
+    /** Function ran by the worker thread. */
+    void worker_thread();
+
+private:
+    std::thread                        _thread{};
+    ThreadInfo                         _info{};
+    std::vector<IScheduler::Workload> *_workloads{nullptr};
+    WorkRange                         *_ranges{nullptr};
+    std::mutex                         _m{};
+    std::condition_variable            _cv{};
+    bool                               _wait_for_work{false};
+    bool                               _job_complete{true};
+    std::exception_ptr                 _current_exception{nullptr};
+    int                                _core_pin{-1};
+};
+
+Worker::Worker(int core_pin) : _core_pin(core_pin)
+{
+    _thread = std::thread(&Worker::worker_thread, this);
+}
+
+Worker::~Worker()
+{
+    // Make sure worker thread has ended
+    if (_thread.joinable())
+    {
+        set_workload(nullptr, nullptr, ThreadInfo());
+        start();
+        _thread.join();
+    }
+}
+
+void Worker::set_workload(std::vector<IScheduler::Workload> *workloads, WorkRange *ranges, const ThreadInfo &info)
+{
+    _workloads = workloads;
+    _ranges    = ranges;
+    _info      = info;
+}
+
+void Worker::start()
+{
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        _wait_for_work = true;
+        _job_complete  = false;
+    }
+    _cv.notify_one();
+}
+
+std::exception_ptr Worker::wait()
+{
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        _cv.wait(lock, [&] { return _job_complete; });
+    }
+    return _current_exception;
+}
+
+void Worker::worker_thread()
+{
+    scheduler_utils::set_thread_affinity(_core_pin);
+
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(_m);
+        _cv.wait(lock, [&] { return _wait_for_work; });
+        _wait_for_work = false;
+
+        _current_exception = nullptr;
+
+        // Exit if the worker thread has not been fed with workloads
+        if (_workloads == nullptr || _ranges == nullptr)
+        {
+            return;
+        }
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            process_workloads(*_workloads, _ranges, _info);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch (...)
+        {
+            _current_exception = std::current_exception();
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        _workloads    = nullptr;
+        _job_complete = true;
+        lock.unlock();
+        _cv.notify_one();
+    }
+}
+} // namespace
+
+struct WorkStealingScheduler::Impl final
+{
+    explicit Impl(unsigned int thread_hint)
+        : _num_threads(thread_hint), _workers(_num_threads - 1), _ranges(std::make_unique<WorkRange[]>(_num_threads))
+    {
+    }
+    void set_num_threads(unsigned int num_threads, unsigned int thread_hint)
+    {
+        _num_threads = num_threads == 0 ? thread_hint : num_threads;
+        _workers.resize(_num_threads - 1);
+        _ranges = std::make_unique<WorkRange[]>(_num_threads);
+    }
+    void set_num_threads_with_affinity(unsigned int num_threads, unsigned int thread_hint, BindFunc func)
+    {
+        _num_threads = num_threads == 0 ? thread_hint : num_threads;
+
+        // Set affinity on main thread
+        scheduler_utils::set_thread_affinity(func(0, thread_hint));
+
+        // Set affinity on worker threads
+        _workers.clear();
+        for (auto i = 1U; i < _num_threads; ++i)
+        {
+            _workers.emplace_back(func(i, thread_hint));
+        }
+        _ranges = std::make_unique<WorkRange[]>(_num_threads);
+    }
+
+    unsigned int                 _num_threads;
+    std::list<Worker>            _workers;
+    std::unique_ptr<WorkRange[]> _ranges;
+    arm_compute::Mutex           _run_workloads_mutex{};
+    // Declared last so that pending asynchronous jobs complete before the thread pool is destroyed
+    SchedulerAsyncQueue          _async_queue{};
+};
+
+WorkStealingScheduler::WorkStealingScheduler() : _impl(std::make_unique<Impl>(num_threads_hint()))
+{
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() = default;
+
+void WorkStealingScheduler::set_num_threads(unsigned int num_threads)
+{
+    // No changes in the number of threads while current workloads are running
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->set_num_threads(num_threads, num_threads_hint());
+}
+
+void WorkStealingScheduler::set_num_threads_with_affinity(unsigned int num_threads, BindFunc func)
+{
+    // No changes in the number of threads while current workloads are running
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->set_num_threads_with_affinity(num_threads, num_threads_hint(), func);
+}
+
+unsigned int WorkStealingScheduler::num_threads() const
+{
+    return _impl->_num_threads;
+}
+
+#ifndef DOXYGEN_SKIP_THIS
+void WorkStealingScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
+{
+    // Workloads of different callers are serialised, see CPPScheduler::run_workloads()
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    const unsigned int num_workloads      = static_cast<unsigned int>(workloads.size());
+    const unsigned int num_threads_to_use = std::min(_impl->_num_threads, num_workloads);
+    if (num_threads_to_use < 1)
+    {
+        return;
+    }
+
+    // Give each thread an equally sized contiguous range of workloads
+    WorkRange *ranges = _impl->_ranges.get();
+    for (unsigned int t = 0; t < num_threads_to_use; ++t)
+    {
+        ranges[t].reset(t * num_workloads / num_threads_to_use, (t + 1) * num_workloads / num_threads_to_use);
+    }
+
+    ThreadInfo info;
+    info.cpu_info    = &cpu_info();
+    info.num_threads = num_threads_to_use;
+
+    unsigned int t         = 0;
+    auto         worker_it = _impl->_workers.begin();
+    // Start num_threads_to_use - 1 workers as the last range is left to the main thread
+    for (; t < num_threads_to_use - 1; ++t, ++worker_it)
+    {
+        info.thread_id = t;
+        worker_it->set_workload(&workloads, ranges, info);
+        worker_it->start();
+    }
+
+    info.thread_id                    = t; // Set main thread's thread_id
+    std::exception_ptr last_exception = nullptr;
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif                                           /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        process_workloads(workloads, ranges, info); // Main thread processes workloads
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch (...)
+    {
+        last_exception = std::current_exception();
+    }
+
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        worker_it = _impl->_workers.begin();
+        for (unsigned int i = 0; i < num_threads_to_use - 1; ++i, ++worker_it)
+        {
+            std::exception_ptr current_exception = worker_it->wait();
+            if (current_exception)
+            {
+                last_exception = current_exception;
+            }
+        }
+        if (last_exception)
+        {
+            std::rethrow_exception(last_exception);
+        }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch (const std::system_error &e)
+    {
+        std::cerr << "Caught system_error with code " << e.code() << " meaning " << e.what() << '\n';
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+}
+#endif /* DOXYGEN_SKIP_THIS */
+
+void WorkStealingScheduler::schedule_op(ICPPKernel   *kernel,
+                                        const Hints  &hints,
+                                        const Window &window,
+                                        ITensorPack  &tensors)
+{
+    schedule_common(kernel, hints, window, tensors);
+}
+
+IScheduler::CompletionHandle WorkStealingScheduler::schedule_op_async(ICPPKernel   *kernel,
+                                                                     const Hints  &hints,
+                                                                     const Window &window,
+                                                                     ITensorPack  &tensors)
+{
+    // The job owns copies of the hints, window and pack so that the caller's ones can go out of scope
+    return _impl->_async_queue.enqueue([this, kernel, hints, window, tensors]() mutable
+                                       { schedule_common(kernel, hints, window, tensors); });
+}
+
+void WorkStealingScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
+{
+    ITensorPack tensors;
+    schedule_common(kernel, hints, kernel->window(), tensors);
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,9 +28,10 @@
 #include "arm_compute/core/Validate.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/CPP/NMSHelpers.h"
 #include "src/core/helpers/AutoConfiguration.h"
 
-#include <list>
+#include <algorithm>
 
 namespace arm_compute
 {
@@ -326,84 +327,51 @@ void ApplyNMSFast(const std::vector<BBox>  &bboxes,
     ARM_COMPUTE_ERROR_ON_MSG(bboxes.size() != scores.size(), "bboxes and scores have different size.");
 
     // Get top_k scores (with corresponding indices).
-    std::list<std::pair<float, int>> score_index_vec;
-
-    // Generate index score pairs.
+    std::vector<int> score_index_vec;
     for (size_t i = 0; i < scores.size(); ++i)
     {
         if (scores[i] > score_threshold)
         {
-            score_index_vec.emplace_back(std::make_pair(scores[i], i));
+            score_index_vec.push_back(i);
         }
     }
 
-    // Sort the score pair according to the scores in descending order
-    score_index_vec.sort(SortScorePairDescend<int>);
-
-    // Keep top_k scores if needed.
+    // Sort the indices according to the scores in descending order, only the top_k ones are needed
     const int score_index_vec_size = score_index_vec.size();
-    if (top_k > -1 && top_k < score_index_vec_size)
+    const int num_sorted           = (top_k > -1 && top_k < score_index_vec_size) ? top_k : score_index_vec_size;
+    cpp::sort_by_score(score_index_vec, 0, num_sorted, scores);
+    score_index_vec.resize(num_sorted);
+
+    // Store the candidates contiguously, to compute their overlaps with all the kept boxes at once
+    const auto bbox_size = [](const BBox &b)
+    { return (b[2] < b[0] || b[3] < b[1]) ? 0.f : (b[2] - b[0]) * (b[3] - b[1]); };
+    cpp::NMSBoxes candidates;
+    cpp::NMSBoxes kept_boxes;
+    candidates.reserve(num_sorted);
+    kept_boxes.reserve(num_sorted);
+    for (int idx : score_index_vec)
     {
-        score_index_vec.resize(top_k);
+        const BBox &b = bboxes[idx];
+        candidates.push_back(b[0], b[1], b[2], b[3], bbox_size(b));
     }
 
     // Do nms.
-    float adaptive_threshold = nms_threshold;
+    float              adaptive_threshold = nms_threshold;
+    std::vector<float> overlaps(num_sorted);
     indices.clear();
 
-    while (!score_index_vec.empty())
+    for (int c = 0; c < num_sorted; ++c)
     {
-        const int idx  = score_index_vec.front().second;
-        bool      keep = true;
-        for (int kept_idx : indices)
-        {
-            if (keep)
-            {
-                // Compute the jaccard (intersection over union IoU) overlap between two bboxes.
-                BBox intersect_bbox = std::array<float, 4>({0, 0, 0, 0});
-                if (bboxes[kept_idx][0] > bboxes[idx][2] || bboxes[kept_idx][2] < bboxes[idx][0] ||
-                    bboxes[kept_idx][1] > bboxes[idx][3] || bboxes[kept_idx][3] < bboxes[idx][1])
-                {
-                    intersect_bbox = std::array<float, 4>({{0, 0, 0, 0}});
-                }
-                else
-                {
-                    intersect_bbox = std::array<float, 4>(
-                        {{std::max(bboxes[idx][0], bboxes[kept_idx][0]), std::max(bboxes[idx][1], bboxes[kept_idx][1]),
-                          std::min(bboxes[idx][2], bboxes[kept_idx][2]),
-                          std::min(bboxes[idx][3], bboxes[kept_idx][3])}});
-                }
-
-                float intersect_width  = intersect_bbox[2] - intersect_bbox[0];
-                float intersect_height = intersect_bbox[3] - intersect_bbox[1];
-
-                float overlap = 0.f;
-                if (intersect_width > 0 && intersect_height > 0)
-                {
-                    float intersect_size = intersect_width * intersect_height;
-                    float bbox1_size     = (bboxes[idx][2] < bboxes[idx][0] || bboxes[idx][3] < bboxes[idx][1])
-                                               ? 0.f
-                                               : (bboxes[idx][2] - bboxes[idx][0]) *
-                                                 (bboxes[idx][3] - bboxes[idx][1]); //BBoxSize(bboxes[idx]);
-                    float bbox2_size =
-                        (bboxes[kept_idx][2] < bboxes[kept_idx][0] || bboxes[kept_idx][3] < bboxes[kept_idx][1])
-                            ? 0.f
-                            : (bboxes[kept_idx][2] - bboxes[kept_idx][0]) *
-                                  (bboxes[kept_idx][3] - bboxes[kept_idx][1]); // BBoxSize(bboxes[kept_idx]);
-                    overlap = intersect_size / (bbox1_size + bbox2_size - intersect_size);
-                }
-                keep = (overlap <= adaptive_threshold);
-            }
-            else
-            {
-                break;
-            }
-        }
+        // Compute the jaccard (intersection over union IoU) overlaps with the kept bboxes.
+        cpp::compute_iou(candidates, c, kept_boxes, 0, kept_boxes.size(), 0.f, overlaps.data());
+        const bool keep = std::all_of(overlaps.begin(), overlaps.begin() + kept_boxes.size(),
+                                      [adaptive_threshold](float overlap) { return overlap <= adaptive_threshold; });
         if (keep)
         {
-            indices.push_back(idx);
+            indices.push_back(score_index_vec[c]);
+            kept_boxes.push_back(candidates.x1[c], candidates.y1[c], candidates.x2[c], candidates.y2[c],
+                                 candidates.areas[c]);
         }
-        score_index_vec.erase(score_index_vec.begin());
         if (keep && eta < 1.f && adaptive_threshold > 0.5f)
         {
             adaptive_threshold *= eta;
@@ -556,13 +524,28 @@ void CPPDetectionOutputLayer::run()
             {
                 ARM_COMPUTE_ERROR_VAR("Could not find predictions for label %d.", label);
             }
-            const std::vector<float> &scores = conf_scores.find(c)->second;
-            const std::vector<BBox>  &bboxes = decode_bboxes.find(label)->second;
-
-            ApplyNMSFast(bboxes, scores, _info.confidence_threshold(), _info.nms_threshold(), _info.eta(),
-                         _info.top_k(), indices[c]);
+            // Create the entries of the classes before running them in parallel, so that the map isn't modified
+            indices[c];
+        }
 
-            num_det += indices[c].size();
+        cpp::run_per_class(0, _info.num_classes(),
+                           [&](int c)
+                           {
+                               if (c == _info.background_label_id())
+                               {
+                                   return;
+                               }
+                               const int                 label  = _info.share_location() ? -1 : c;
+                               const std::vector<float> &scores = conf_scores.find(c)->second;
+                               const std::vector<BBox>  &bboxes = decode_bboxes.find(label)->second;
+
+                               ApplyNMSFast(bboxes, scores, _info.confidence_threshold(), _info.nms_threshold(),
+                                            _info.eta(), _info.top_k(), indices.find(c)->second);
+                           });
+
+        for (auto const &it : indices)
+        {
+            num_det += it.second.size();
         }
 
         int num_to_add = 0;
@@ -588,7 +571,8 @@ void CPPDetectionOutputLayer::run()
             }
 
             // Keep top k results per image.
-            std::sort(score_index_pairs.begin(), score_index_pairs.end(), SortScorePairDescend<std::pair<int, int>>);
+            std::partial_sort(score_index_pairs.begin(), score_index_pairs.begin() + _info.keep_top_k(),
+                              score_index_pairs.end(), SortScorePairDescend<std::pair<int, int>>);
             score_index_pairs.resize(_info.keep_top_k());
 
             // Store the new indices.
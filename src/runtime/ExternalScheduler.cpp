@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/ExternalScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+
+namespace arm_compute
+{
+namespace
+{
+/** Parts of an indexed job shared between the tasks of the executor */
+struct SharedJobs
+{
+    IScheduler::IndexedJob    job;
+    void                     *context;
+    unsigned int              num_jobs;
+    unsigned int              num_tasks;
+    const CPUInfo            *cpu_info;
+    std::atomic<unsigned int> next;
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    std::mutex         exception_mutex{};
+    std::exception_ptr exception{nullptr};
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+};
+
+/** Run part @p task_index, then the parts left by the other tasks until there are none */
+void run_task(void *context, unsigned int task_index)
+{
+    auto &jobs = *static_cast<SharedJobs *>(context);
+
+    ThreadInfo info;
+    info.cpu_info    = jobs.cpu_info;
+    info.num_threads = static_cast<int>(jobs.num_tasks);
+    info.thread_id   = static_cast<int>(task_index);
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        for (unsigned int index = task_index; index < jobs.num_jobs;
+             index              = jobs.next.fetch_add(1u, std::memory_order_relaxed))
+        {
+            jobs.job(jobs.context, index, info);
+        }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch (...)
+    {
+        // Stop handing out parts and keep the first exception to rethrow it on the calling thread
+        jobs.next.store(jobs.num_jobs, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(jobs.exception_mutex);
+        if (jobs.exception == nullptr)
+        {
+            jobs.exception = std::current_exception();
+        }
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+}
+} // namespace
+
+ExternalScheduler::ExternalScheduler(IExternalExecutor *executor) : _executor(executor)
+{
+    ARM_COMPUTE_ERROR_ON(executor == nullptr);
+}
+
+void ExternalScheduler::set_num_threads(unsigned int num_threads)
+{
+    _num_threads = num_threads;
+}
+
+unsigned int ExternalScheduler::num_threads() const
+{
+    return _num_threads == 0 ? std::max(_executor->concurrency(), 1u) : _num_threads;
+}
+
+void ExternalScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
+{
+    ITensorPack tensors;
+    schedule_common(kernel, hints, kernel->window(), tensors);
+}
+
+void ExternalScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
+{
+    schedule_common(kernel, hints, window, tensors);
+}
+
+void ExternalScheduler::run_workloads(std::vector<Workload> &workloads)
+{
+    run_indexed_jobs([](void *context, unsigned int index, const ThreadInfo &info)
+                     { (*static_cast<std::vector<IScheduler::Workload> *>(context))[index](info); },
+                     &workloads, static_cast<unsigned int>(workloads.size()));
+}
+
+void ExternalScheduler::run_indexed_jobs(IndexedJob job, void *context, unsigned int num_jobs)
+{
+    const unsigned int num_tasks = std::min(num_threads(), num_jobs);
+    if (num_tasks < 1)
+    {
+        return;
+    }
+
+    SharedJobs jobs{job, context, num_jobs, num_tasks, &cpu_info(), {num_tasks}};
+    if (num_tasks == 1)
+    {
+        // Nothing to run concurrently, skip the round trip through the executor
+        run_task(&jobs, 0);
+    }
+    else
+    {
+        _executor->run_and_wait(&run_task, &jobs, num_tasks);
+    }
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    if (jobs.exception != nullptr)
+    {
+        std::rethrow_exception(jobs.exception);
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+}
+} // namespace arm_compute
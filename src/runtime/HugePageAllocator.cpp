@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/HugePageAllocator.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#if defined(__linux__) && !defined(BARE_METAL)
+#include <sys/mman.h>
+#define ARM_COMPUTE_HUGE_PAGES_SUPPORTED
+#endif /* defined(__linux__) && !defined(BARE_METAL) */
+
+namespace arm_compute
+{
+namespace
+{
+constexpr size_t base_page_size = 4096;
+constexpr size_t page_size_2mb  = size_t(2) << 20;
+constexpr size_t page_size_1gb  = size_t(1) << 30;
+
+void *align_pointer(void *ptr, size_t alignment)
+{
+    const uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+    return reinterpret_cast<void *>(ceil_to_multiple(address, static_cast<uintptr_t>(alignment)));
+}
+
+#ifdef ARM_COMPUTE_HUGE_PAGES_SUPPORTED
+/** Map anonymous memory backed by huge pages
+ *
+ * @param[in]  size      Size to map
+ * @param[in]  alignment Alignment of the returned pointer
+ * @param[in]  page_size Huge pages to request
+ * @param[out] base      Start of the mapping
+ * @param[out] length    Length of the mapping
+ *
+ * @return A pointer inside the mapping, or nullptr if nothing could be mapped
+ */
+void *map_huge_pages(size_t size, size_t alignment, HugePageSize page_size, void *&base, size_t &length)
+{
+#if defined(MAP_HUGETLB)
+    if (page_size != HugePageSize::Transparent)
+    {
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif /* MAP_HUGE_SHIFT */
+        // Explicit huge page mappings are aligned to the huge page size
+        const size_t page  = page_size == HugePageSize::Explicit1GB ? page_size_1gb : page_size_2mb;
+        const int    flags = (page_size == HugePageSize::Explicit1GB ? 30 : 21) << MAP_HUGE_SHIFT;
+        length             = ceil_to_multiple(size, page) + (alignment > page ? alignment : 0);
+        base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | flags, -1, 0);
+        if (base != MAP_FAILED)
+        {
+            return align_pointer(base, alignment);
+        }
+    }
+#endif /* defined(MAP_HUGETLB) */
+
+    // Transparent huge pages only back the 2MB aligned parts of a mapping, so over-map to align the buffer
+    const size_t align = std::max(alignment, page_size_2mb);
+    length             = ceil_to_multiple(size, page_size_2mb) + align;
+    base               = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+    {
+        return nullptr;
+    }
+#if defined(MADV_HUGEPAGE)
+    madvise(base, length, MADV_HUGEPAGE);
+#endif /* defined(MADV_HUGEPAGE) */
+    return align_pointer(base, align);
+}
+#endif /* ARM_COMPUTE_HUGE_PAGES_SUPPORTED */
+
+/** Touch the pages of a buffer from the scheduler threads
+ *
+ * The buffer is split in contiguous chunks, one per thread, in the same way kernels split their windows, so that
+ * first touch places each page on the node of the thread most likely to use it.
+ */
+void first_touch(void *ptr, size_t size, size_t page)
+{
+    IScheduler        &scheduler   = Scheduler::get();
+    const unsigned int num_threads = std::max(scheduler.num_threads(), 1U);
+    const size_t       chunk       = ceil_to_multiple(DIV_CEIL(size, num_threads), page);
+
+    std::vector<IScheduler::Workload> workloads;
+    for (size_t offset = 0; offset < size; offset += chunk)
+    {
+        uint8_t     *start  = static_cast<uint8_t *>(ptr) + offset;
+        const size_t length = std::min(chunk, size - offset);
+        workloads.emplace_back(
+            [start, length](const ThreadInfo &)
+            {
+                for (size_t i = 0; i < length; i += base_page_size)
+                {
+                    start[i] = 0;
+                }
+            });
+    }
+    scheduler.run_tagged_workloads(workloads, "HugePageAllocator");
+}
+
+/** Memory region allocated from a @ref HugePageAllocator */
+class HugePageMemoryRegion final : public IMemoryRegion
+{
+public:
+    HugePageMemoryRegion(IAllocator *allocator, size_t size, size_t alignment)
+        : IMemoryRegion(size), _allocator(allocator), _ptr(size != 0 ? allocator->allocate(size, alignment) : nullptr)
+    {
+    }
+    HugePageMemoryRegion(const HugePageMemoryRegion &)            = delete;
+    HugePageMemoryRegion &operator=(const HugePageMemoryRegion &) = delete;
+    ~HugePageMemoryRegion()
+    {
+        if (_ptr != nullptr)
+        {
+            _allocator->free(_ptr);
+        }
+    }
+
+    void *buffer() override
+    {
+        return _ptr;
+    }
+    const void *buffer() const override
+    {
+        return _ptr;
+    }
+    std::unique_ptr<IMemoryRegion> extract_subregion(size_t offset, size_t size) override
+    {
+        if (_ptr != nullptr && (offset < _size) && (_size - offset >= size))
+        {
+            return std::make_unique<MemoryRegion>(static_cast<uint8_t *>(_ptr) + offset, size);
+        }
+        return nullptr;
+    }
+
+private:
+    IAllocator *_allocator;
+    void       *_ptr;
+};
+} // namespace
+
+HugePageAllocator::HugePageAllocator(HugePageSize page_size, bool first_touch)
+    : _page_size(page_size), _first_touch(first_touch), _mappings(), _mtx()
+{
+}
+
+HugePageAllocator::~HugePageAllocator()
+{
+    for (auto &mapping : _mappings)
+    {
+        ARM_COMPUTE_UNUSED(mapping);
+#ifdef ARM_COMPUTE_HUGE_PAGES_SUPPORTED
+        if (mapping.second.length != 0)
+        {
+            munmap(mapping.second.base, mapping.second.length);
+            continue;
+        }
+#endif /* ARM_COMPUTE_HUGE_PAGES_SUPPORTED */
+        ::operator delete(mapping.second.base);
+    }
+}
+
+void *HugePageAllocator::allocate(size_t size, size_t alignment)
+{
+    void  *base   = nullptr;
+    void  *ptr    = nullptr;
+    size_t length = 0;
+
+#ifdef ARM_COMPUTE_HUGE_PAGES_SUPPORTED
+    // Allocations are backed by the largest requested pages they fill
+    if (size >= page_size_2mb)
+    {
+        const HugePageSize page_size =
+            (_page_size == HugePageSize::Explicit1GB && size < page_size_1gb) ? HugePageSize::Transparent : _page_size;
+        ptr = map_huge_pages(size, alignment, page_size, base, length);
+        if (ptr != nullptr && _first_touch)
+        {
+            first_touch(ptr, size, page_size == HugePageSize::Explicit1GB ? page_size_1gb : page_size_2mb);
+        }
+    }
+#endif /* ARM_COMPUTE_HUGE_PAGES_SUPPORTED */
+
+    if (ptr == nullptr)
+    {
+        length = 0;
+        base   = ::operator new(size + alignment);
+        ptr    = alignment != 0 ? align_pointer(base, alignment) : base;
+        std::memset(ptr, 0, size);
+    }
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    _mappings.emplace(ptr, Mapping{base, length});
+    return ptr;
+}
+
+void HugePageAllocator::free(void *ptr)
+{
+    Mapping mapping{nullptr, 0};
+    {
+        arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+        auto                                        it = _mappings.find(ptr);
+        ARM_COMPUTE_ERROR_ON_MSG(it == _mappings.end(), "Memory was not allocated by this allocator");
+        if (it == _mappings.end())
+        {
+            return;
+        }
+        mapping = it->second;
+        _mappings.erase(it);
+    }
+
+#ifdef ARM_COMPUTE_HUGE_PAGES_SUPPORTED
+    if (mapping.length != 0)
+    {
+        munmap(mapping.base, mapping.length);
+        return;
+    }
+#endif /* ARM_COMPUTE_HUGE_PAGES_SUPPORTED */
+    ::operator delete(mapping.base);
+}
+
+std::unique_ptr<IMemoryRegion> HugePageAllocator::make_region(size_t size, size_t alignment)
+{
+    return std::make_unique<HugePageMemoryRegion>(this, size, alignment);
+}
+} // namespace arm_compute
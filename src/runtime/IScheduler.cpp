@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,12 +27,136 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Log.h"
 #include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/Tracer.h"
 
 #include "src/common/cpuinfo/CpuInfo.h"
 #include "src/runtime/SchedulerUtils.h"
 
+#include <algorithm>
+#include <chrono>
+
 namespace arm_compute
 {
+namespace
+{
+/** Time spent by a thread running the parts of a run, padded so that the threads do not share cache lines */
+struct ThreadTiming
+{
+    double   busy_us{0.0};
+    uint64_t num_parts{0};
+    char     padding[64 - sizeof(double) - sizeof(uint64_t)];
+};
+
+/** Jobs of a run, wrapped to time each of their parts */
+struct TimedJob
+{
+    IScheduler::IndexedJob     job;
+    void                      *context;
+    std::vector<ThreadTiming> *timings;
+};
+
+void run_timed_job(void *context, unsigned int index, const ThreadInfo &info)
+{
+    const TimedJob &timed = *static_cast<TimedJob *>(context);
+    const auto      start = std::chrono::steady_clock::now();
+    timed.job(timed.context, index, info);
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+    // The parts given the same thread id never run at the same time
+    const auto thread_id = static_cast<size_t>(info.thread_id);
+    if (info.thread_id >= 0 && thread_id < timed.timings->size())
+    {
+        (*timed.timings)[thread_id].busy_us += elapsed.count();
+        ++(*timed.timings)[thread_id].num_parts;
+    }
+}
+
+void run_workload(void *context, unsigned int index, const ThreadInfo &info)
+{
+    (*static_cast<std::vector<IScheduler::Workload> *>(context))[index](info);
+}
+} // namespace
+
+#ifndef BARE_METAL
+namespace
+{
+/** Part of a kernel window given to a thread */
+void run_window(ICPPKernel *kernel, ITensorPack &tensors, const Window &win, const ThreadInfo &info)
+{
+    if (tensors.empty())
+    {
+        kernel->run(win, info);
+    }
+    else
+    {
+        kernel->run_op(tensors, win, info);
+    }
+}
+
+/** State shared by the parts of a kernel window split along one dimension */
+struct SplitJob
+{
+    ICPPKernel                      *kernel;
+    ITensorPack                     *tensors;
+    const Window                    *window;
+    size_t                           split_dimension;
+    unsigned int                     num_windows;
+    const std::vector<unsigned int> *boundaries;
+};
+
+void run_split_job(void *context, unsigned int index, const ThreadInfo &info)
+{
+    const auto &job = *static_cast<const SplitJob *>(context);
+
+    Window win = job.boundaries->empty()
+                     ? job.window->split_window(job.split_dimension, index, job.num_windows)
+                     : scheduler_utils::narrow_window(*job.window, job.split_dimension, (*job.boundaries)[index],
+                                                      (*job.boundaries)[index + 1]);
+    win.validate();
+
+    run_window(job.kernel, *job.tensors, win, info);
+}
+
+/** State shared by the parts of a kernel window split along both DimX and DimY */
+struct Split2DJob
+{
+    ICPPKernel   *kernel;
+    ITensorPack  *tensors;
+    const Window *window;
+    unsigned int  m_threads;
+    unsigned int  n_threads;
+};
+
+void run_split_2d_job(void *context, unsigned int index, const ThreadInfo &info)
+{
+    const auto        &job = *static_cast<const Split2DJob *>(context);
+    const unsigned int mi  = index % job.m_threads;
+    const unsigned int ni  = index / job.m_threads;
+
+    //narrow the window to our mi-ni workload
+    Window win =
+        job.window->split_window(Window::DimX, mi, job.m_threads).split_window(Window::DimY, ni, job.n_threads);
+
+    win.validate();
+
+    Window thread_locator;
+    thread_locator.set(Window::DimX, Window::Dimension(mi, job.m_threads));
+    thread_locator.set(Window::DimY, Window::Dimension(ni, job.n_threads));
+
+    thread_locator.validate();
+
+    if (job.tensors->empty())
+    {
+        job.kernel->run_nd(win, info, thread_locator);
+    }
+    else
+    {
+        job.kernel->run_op(*job.tensors, win, info);
+    }
+}
+} // namespace
+#endif /* BARE_METAL */
+
 IScheduler::IScheduler()
 {
     // Work out the best possible number of execution threads
@@ -50,14 +174,148 @@ void IScheduler::set_num_threads_with_affinity(unsigned int num_threads, BindFun
     ARM_COMPUTE_ERROR("Feature for affinity setting is not implemented");
 }
 
+void IScheduler::set_num_threads_with_affinity_policy(unsigned int num_threads, AffinityPolicy policy)
+{
+#ifndef BARE_METAL
+    const std::vector<int> cores = scheduler_utils::affinity_cores(policy, scheduler_utils::read_core_topology());
+#else  /* BARE_METAL */
+    ARM_COMPUTE_UNUSED(policy);
+    const std::vector<int> cores{};
+#endif /* BARE_METAL */
+    if (cores.empty())
+    {
+        set_num_threads(num_threads);
+        return;
+    }
+
+    const auto num_cores = static_cast<unsigned int>(cores.size());
+    set_num_threads_with_affinity(num_threads == 0 ? num_cores : num_threads,
+                                  [cores, num_cores](int thread_id, int)
+                                  { return cores[static_cast<unsigned int>(thread_id) % num_cores]; });
+}
+
 unsigned int IScheduler::num_threads_hint() const
 {
     return _num_threads_hint;
 }
 
+IScheduler::CompletionHandle
+IScheduler::schedule_op_async(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
+{
+    schedule_op(kernel, hints, window, tensors);
+    return CompletionHandle();
+}
+
+void IScheduler::set_capacity_aware_split(bool enable)
+{
+    _capacity_aware_split = enable;
+}
+
+bool IScheduler::capacity_aware_split() const
+{
+    return _capacity_aware_split;
+}
+
+std::vector<float> IScheduler::thread_capacities(unsigned int num_threads) const
+{
+    ARM_COMPUTE_UNUSED(num_threads);
+    return {};
+}
+
+void IScheduler::set_numa_weights_replication(bool enable)
+{
+    _numa_weights_replication = enable;
+}
+
+bool IScheduler::numa_weights_replication() const
+{
+    return _numa_weights_replication;
+}
+
+std::vector<unsigned int> IScheduler::thread_numa_nodes(unsigned int num_threads) const
+{
+    ARM_COMPUTE_UNUSED(num_threads);
+    return {};
+}
+
+void IScheduler::set_statistics_enabled(bool enable)
+{
+    _statistics_enabled = enable;
+}
+
+bool IScheduler::statistics_enabled() const
+{
+    return _statistics_enabled;
+}
+
+std::map<std::string, IScheduler::KernelStatistics> IScheduler::statistics() const
+{
+    std::lock_guard<std::mutex> lock(_statistics_mutex);
+    return _statistics;
+}
+
+void IScheduler::reset_statistics()
+{
+    std::lock_guard<std::mutex> lock(_statistics_mutex);
+    _statistics.clear();
+}
+
+void IScheduler::run_recorded_jobs(IndexedJob job, void *context, unsigned int num_jobs, const char *tag)
+{
+    if (!_statistics_enabled)
+    {
+        run_indexed_jobs(job, context, num_jobs);
+        return;
+    }
+
+    std::vector<ThreadTiming> timings(std::max(num_threads(), 1U));
+    TimedJob                  timed{job, context, &timings};
+
+    const auto start = std::chrono::steady_clock::now();
+    run_indexed_jobs(&run_timed_job, &timed, num_jobs);
+    const std::chrono::duration<double, std::micro> wall = std::chrono::steady_clock::now() - start;
+
+    std::lock_guard<std::mutex> lock(_statistics_mutex);
+    KernelStatistics           &stats = _statistics[tag != nullptr ? tag : "untagged"];
+    if (stats.busy_time_us.size() < timings.size())
+    {
+        stats.busy_time_us.resize(timings.size(), 0.0);
+        stats.wait_time_us.resize(timings.size(), 0.0);
+        stats.num_parts.resize(timings.size(), 0);
+        stats.num_fed_parts.resize(timings.size(), 0);
+    }
+
+    double       max_busy_us  = 0.0;
+    double       sum_busy_us  = 0.0;
+    unsigned int num_involved = 0;
+    for (size_t t = 0; t < timings.size(); ++t)
+    {
+        if (timings[t].num_parts == 0)
+        {
+            continue;
+        }
+        stats.busy_time_us[t] += timings[t].busy_us;
+        stats.wait_time_us[t] += std::max(wall.count() - timings[t].busy_us, 0.0);
+        stats.num_parts[t] += timings[t].num_parts;
+        stats.num_fed_parts[t] += timings[t].num_parts - 1;
+        max_busy_us = std::max(max_busy_us, timings[t].busy_us);
+        sum_busy_us += timings[t].busy_us;
+        ++num_involved;
+    }
+
+    ++stats.num_runs;
+    stats.total_time_us += wall.count();
+    if (num_involved > 0)
+    {
+        stats.sum_max_busy_us += max_busy_us;
+        stats.sum_mean_busy_us += sum_busy_us / num_involved;
+    }
+}
+
 void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+    ARM_COMPUTE_TRACE_SCOPE("kernel", kernel->name());
 #ifndef BARE_METAL
     const Window &max_window = window;
     if (hints.split_dimension() == IScheduler::split_dimensions_all)
@@ -84,38 +342,29 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             n_threads = std::min<unsigned int>(n, n_threads);
         }
 
-        std::vector<IScheduler::Workload> workloads;
-        for (unsigned int ni = 0; ni != n_threads; ++ni)
+        // A single workload runs on the calling thread, without building workloads or waking the workers
+        if (m_threads * n_threads == 1)
         {
-            for (unsigned int mi = 0; mi != m_threads; ++mi)
+            ThreadInfo info;
+            info.cpu_info = &cpu_info();
+
+            Window thread_locator;
+            thread_locator.set(Window::DimX, Window::Dimension(0, 1));
+            thread_locator.set(Window::DimY, Window::Dimension(0, 1));
+
+            if (tensors.empty())
             {
-                workloads.push_back(
-                    [ni, mi, m_threads, n_threads, &max_window, &kernel, &tensors](const ThreadInfo &info)
-                    {
-                        //narrow the window to our mi-ni workload
-                        Window win = max_window.split_window(Window::DimX, mi, m_threads)
-                                         .split_window(Window::DimY, ni, n_threads);
-
-                        win.validate();
-
-                        Window thread_locator;
-                        thread_locator.set(Window::DimX, Window::Dimension(mi, m_threads));
-                        thread_locator.set(Window::DimY, Window::Dimension(ni, n_threads));
-
-                        thread_locator.validate();
-
-                        if (tensors.empty())
-                        {
-                            kernel->run_nd(win, info, thread_locator);
-                        }
-                        else
-                        {
-                            kernel->run_op(tensors, win, info);
-                        }
-                    });
+                kernel->run_nd(max_window, info, thread_locator);
             }
+            else
+            {
+                kernel->run_op(tensors, max_window, info);
+            }
+            return;
         }
-        run_workloads(workloads);
+
+        Split2DJob job{kernel, &tensors, &max_window, m_threads, n_threads};
+        run_recorded_jobs(&run_split_2d_job, &job, m_threads * n_threads, kernel->name());
     }
     else
     {
@@ -127,18 +376,17 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             return;
         }
 
-        if (!kernel->is_parallelisable() || num_threads == 1)
+        // Work that cannot be split runs on the calling thread, without building workloads or waking the workers
+        const auto run_on_calling_thread = [&]()
         {
             ThreadInfo info;
             info.cpu_info = &cpu_info();
-            if (tensors.empty())
-            {
-                kernel->run(max_window, info);
-            }
-            else
-            {
-                kernel->run_op(tensors, max_window, info);
-            }
+            run_window(kernel, tensors, max_window, info);
+        };
+
+        if (!kernel->is_parallelisable() || num_threads == 1)
+        {
+            run_on_calling_thread();
         }
         else
         {
@@ -162,26 +410,22 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             // Make sure the smallest window is larger than minimum workload size
             num_windows = adjust_num_of_windows(max_window, hints.split_dimension(), num_windows, *kernel, cpu_info());
 
-            std::vector<IScheduler::Workload> workloads(num_windows);
-            for (unsigned int t = 0; t < num_windows; ++t)
+            // The kernel's minimum workload size says the window is too small to be worth splitting
+            if (num_windows == 1)
             {
-                //Capture 't' by copy, all the other variables by reference:
-                workloads[t] = [t, &hints, &max_window, &num_windows, &kernel, &tensors](const ThreadInfo &info)
-                {
-                    Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
-                    win.validate();
-
-                    if (tensors.empty())
-                    {
-                        kernel->run(win, info);
-                    }
-                    else
-                    {
-                        kernel->run_op(tensors, win, info);
-                    }
-                };
+                run_on_calling_thread();
+                return;
             }
-            run_workloads(workloads);
+
+            // With a STATIC split workload t runs on thread t, so the windows can be sized after the threads' capacities
+            std::vector<unsigned int> boundaries{};
+            if (_capacity_aware_split && hints.strategy() == StrategyHint::STATIC)
+            {
+                boundaries = scheduler_utils::split_weighted(num_iterations, thread_capacities(num_windows));
+            }
+
+            SplitJob job{kernel, &tensors, &max_window, hints.split_dimension(), num_windows, &boundaries};
+            run_recorded_jobs(&run_split_job, &job, num_windows, kernel->name());
         }
     }
 #else  /* !BARE_METAL */
@@ -189,12 +433,26 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
 #endif /* !BARE_METAL */
 }
 
-void IScheduler::run_tagged_workloads(std::vector<Workload> &workloads, const char *tag)
+void IScheduler::run_indexed_jobs(IndexedJob job, void *context, unsigned int num_jobs)
 {
-    ARM_COMPUTE_UNUSED(tag);
+    std::vector<Workload> workloads(num_jobs);
+    for (unsigned int i = 0; i < num_jobs; ++i)
+    {
+        workloads[i] = [job, context, i](const ThreadInfo &info) { job(context, i, info); };
+    }
     run_workloads(workloads);
 }
 
+void IScheduler::run_tagged_workloads(std::vector<Workload> &workloads, const char *tag)
+{
+    if (!_statistics_enabled)
+    {
+        run_workloads(workloads);
+        return;
+    }
+    run_recorded_jobs(&run_workload, &workloads, static_cast<unsigned int>(workloads.size()), tag);
+}
+
 std::size_t IScheduler::adjust_num_of_windows(const Window     &window,
                                               std::size_t       split_dimension,
                                               std::size_t       init_num_windows,
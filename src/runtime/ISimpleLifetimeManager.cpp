@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -130,6 +130,22 @@ void ISimpleLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t
     }
 }
 
+size_t ISimpleLifetimeManager::group_size(const IMemoryGroup *group) const
+{
+    const auto group_it = _finalized_groups.find(const_cast<IMemoryGroup *>(group));
+    if (group_it == std::end(_finalized_groups))
+    {
+        return 0;
+    }
+
+    size_t size = 0;
+    for (const auto &e : group_it->second)
+    {
+        size += e.second.size;
+    }
+    return size;
+}
+
 bool ISimpleLifetimeManager::are_all_finalized() const
 {
     return !std::any_of(std::begin(_active_elements), std::end(_active_elements),
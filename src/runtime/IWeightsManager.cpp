@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021 Arm Limited.
+ * Copyright (c) 2019, 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,8 @@
  */
 #include "arm_compute/runtime/IWeightsManager.h"
 
+#include <set>
+
 namespace arm_compute
 {
 IWeightsManager::IWeightsManager() : _managed_weights(), _managed_counter(), _managed_weights_parents()
@@ -165,6 +167,33 @@ void IWeightsManager::release(const ITensor *weights)
     }
 }
 
+MemoryUsage IWeightsManager::usage() const
+{
+    // A transform can be registered for several weights, count it once
+    std::set<ITransformWeights *> transforms;
+    for (const auto &w : _managed_weights)
+    {
+        transforms.insert(std::begin(w.second), std::end(w.second));
+    }
+
+    MemoryUsage usage{};
+    for (ITransformWeights *t : transforms)
+    {
+        const ITensor *transformed = t->get_weights();
+        if (transformed == nullptr)
+        {
+            continue;
+        }
+        const size_t size = transformed->info()->total_size();
+        usage.planned_size += size;
+        if (!transformed->info()->is_resizable())
+        {
+            usage.allocated_size += size;
+        }
+    }
+    return usage;
+}
+
 void IWeightsManager::pre_mark_as_unused(const ITensor *weights)
 {
     if (weights == nullptr || !are_weights_managed(weights))
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2018, 2025 Arm Limited.
+ * Copyright (c) 2016-2018, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -66,6 +66,24 @@ void MemoryManagerOnDemand::populate(arm_compute::IAllocator &allocator, size_t
     _pool_mgr->register_pool(std::move(pool_template));
 }
 
+MemoryUsage MemoryManagerOnDemand::usage() const
+{
+    MemoryUsage usage{};
+    usage.planned_size   = _lifetime_mgr->pool_size();
+    usage.allocated_size = _pool_mgr->allocated_size();
+    return usage;
+}
+
+void MemoryManagerOnDemand::trim()
+{
+    _pool_mgr->trim_pools();
+}
+
+void MemoryManagerOnDemand::restore()
+{
+    _pool_mgr->restore_pools();
+}
+
 void MemoryManagerOnDemand::clear()
 {
     ARM_COMPUTE_ERROR_ON_MSG(!_pool_mgr, "Pool manager not specified correctly!");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited.
+ * Copyright (c) 2020-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,6 +50,7 @@ void INEOperator::run(ITensorPack &tensors)
 
 void INEOperator::run(ITensorPack &tensors, const Window &window)
 {
+    ScopedScheduler scope(_ctx != nullptr ? _ctx->scheduler() : nullptr);
     NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, window, tensors);
 }
 
@@ -62,5 +63,15 @@ MemoryRequirements INEOperator::workspace() const
 {
     return _workspace;
 }
+
+OperatorDescription INEOperator::describe() const
+{
+    OperatorDescription desc = IOperator::describe();
+    if (_kernel != nullptr)
+    {
+        desc.kernels.emplace_back(_kernel->name());
+    }
+    return desc;
+}
 } // namespace experimental
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/Scheduler.h"
 
 #include "src/cpu/operators/CpuActivation.h"
 
@@ -65,6 +66,9 @@ NEActivationLayer::validate(const ITensorInfo *input, const ITensorInfo *output,
 
 void NEActivationLayer::run()
 {
+    // The operator schedules through NEScheduler, which resolves to the context's scheduler in this scope
+    ScopedScheduler scope(_impl->ctx != nullptr ? _impl->ctx->scheduler() : nullptr);
+
     ITensorPack pack;
     pack.add_tensor(TensorType::ACL_SRC, _impl->src);
     pack.add_tensor(TensorType::ACL_DST, _impl->dst);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024 Arm Limited.
+ * Copyright (c) 2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,9 +26,12 @@
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuDirectConv3d.h"
+#include "src/cpu/operators/CpuGemmDirectConv3d.h"
 
 namespace arm_compute
 {
@@ -38,6 +41,11 @@ struct NEConv3D::Impl
 {
     std::unique_ptr<cpu::ICpuOperator> op{nullptr};
     ITensorPack                        run_pack{};
+    ITensorPack                        prep_pack{};
+    WorkspaceData<Tensor>              workspace{};
+    MemoryGroup                        memory_group{};
+    experimental::MemoryRequirements   aux_mem_req{};
+    bool                               is_prepared{false};
 };
 
 NEConv3D::NEConv3D() : _impl(std::make_unique<Impl>())
@@ -55,15 +63,28 @@ void NEConv3D::configure(
         input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info));
     ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info);
 
-    auto f = std::make_unique<cpu::CpuDirectConv3d>();
-    f->configure(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(),
-                 conv_info);
-    _impl->op = std::move(f);
+    const ITensorInfo *biases_info = (biases != nullptr) ? biases->info() : nullptr;
 
-    if (_impl->op != nullptr)
+    // Prefer the indirect GEMM when the assembly kernels support the configuration
+    if (bool(cpu::CpuGemmDirectConv3d::validate(input->info(), weights->info(), biases_info, output->info(), conv_info)))
+    {
+        auto f = std::make_unique<cpu::CpuGemmDirectConv3d>();
+        f->configure(input->info(), weights->info(), biases_info, output->info(), conv_info);
+        _impl->op = std::move(f);
+    }
+    else
     {
-        _impl->run_pack = {{ACL_SRC_0, input}, {ACL_SRC_1, weights}, {ACL_SRC_2, biases}, {ACL_DST, output}};
+        auto f = std::make_unique<cpu::CpuDirectConv3d>();
+        f->configure(input->info(), weights->info(), biases_info, output->info(), conv_info);
+        _impl->op = std::move(f);
     }
+
+    _impl->is_prepared = false;
+    _impl->run_pack    = {{ACL_SRC_0, input}, {ACL_SRC_1, weights}, {ACL_SRC_2, biases}, {ACL_DST, output}};
+    _impl->prep_pack   = {{ACL_SRC_1, weights}, {ACL_SRC_2, biases}};
+    _impl->aux_mem_req = _impl->op->workspace();
+    _impl->workspace   = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack,
+                                                  _impl->prep_pack, /* allocate_now */ false);
 }
 
 Status NEConv3D::validate(const ITensorInfo *input,
@@ -82,7 +103,23 @@ void NEConv3D::run()
 {
     if (_impl->op != nullptr)
     {
+        prepare();
+
+        MemoryGroupResourceScope scope_mg(_impl->memory_group);
         _impl->op->run(_impl->run_pack);
     }
 }
+
+void NEConv3D::prepare()
+{
+    if (!_impl->is_prepared)
+    {
+        allocate_tensors(_impl->aux_mem_req, _impl->workspace);
+        _impl->op->prepare(_impl->prep_pack);
+
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
+        _impl->is_prepared = true;
+    }
+}
 } // namespace arm_compute
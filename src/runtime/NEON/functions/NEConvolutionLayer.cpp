@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
 
 #include "arm_compute/core/PixelValue.h"
@@ -75,9 +76,10 @@ void NEConvolutionLayer::configure(ITensor                   *input,
     // Perform validate step
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_UNUSED(num_groups);
-    ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayer::validate(
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(NEConvolutionLayer::validate(
         input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info,
         weights_info, dilation, act_info, enable_fast_math, num_groups));
+    const TrustedConfigureScope trusted_configure{};
     ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
                            enable_fast_math, num_groups);
 
@@ -178,6 +180,19 @@ ConvolutionMethod NEConvolutionLayer::get_convolution_method(const ITensorInfo
                                                   enable_fast_math);
 }
 
+bool NEConvolutionLayer::get_measured_convolution_method(const ITensorInfo         *input,
+                                                         const ITensorInfo         *weights,
+                                                         const ITensorInfo         *output,
+                                                         const PadStrideInfo       &conv_info,
+                                                         const Size2D              &dilation,
+                                                         const ActivationLayerInfo &act_info,
+                                                         bool                       enable_fast_math,
+                                                         ConvolutionMethod         &method)
+{
+    return cpu::CpuConv2d::get_measured_convolution_method(input, weights, output, conv_info, dilation, act_info,
+                                                           enable_fast_math, method);
+}
+
 void NEConvolutionLayer::run()
 {
     prepare();
@@ -194,6 +209,26 @@ void NEConvolutionLayer::run()
     }
 }
 
+void NEConvolutionLayer::configure_workspace(experimental::RunWorkspace &workspace) const
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_impl->op == nullptr, "Only the operator-based methods support caller-owned workspaces");
+    workspace.configure(_impl->aux_mem_req);
+}
+
+void NEConvolutionLayer::run(const ITensor *input, ITensor *output, experimental::RunWorkspace &workspace) const
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_ON_MSG(_impl->op == nullptr, "Only the operator-based methods support caller-owned workspaces");
+    ARM_COMPUTE_ERROR_ON_MSG(!_impl->is_prepared, "The function must be prepared first");
+
+    // The pack of run() refers to the prepared weights, only the operands and the temporaries differ per call
+    ITensorPack pack = _impl->run_pack;
+    pack.add_const_tensor(ACL_SRC_0, input);
+    pack.add_tensor(ACL_DST, output);
+    workspace.add_to_pack(pack);
+    _impl->op->run(pack);
+}
+
 void NEConvolutionLayer::prepare()
 {
     if (!_impl->is_prepared)
@@ -214,4 +249,19 @@ void NEConvolutionLayer::prepare()
         _impl->is_prepared = true;
     }
 }
+
+OperatorDescription NEConvolutionLayer::describe() const
+{
+    OperatorDescription desc{};
+    desc.name = "NEConvolutionLayer";
+    if (_impl->op != nullptr)
+    {
+        desc.children.emplace_back(_impl->op->describe());
+    }
+    else if (_impl->func != nullptr)
+    {
+        desc.children.emplace_back(_impl->func->describe());
+    }
+    return desc;
+}
 } // namespace arm_compute
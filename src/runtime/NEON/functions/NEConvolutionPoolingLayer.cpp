@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEConvolutionPoolingLayer.h"
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/SubTensor.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuCopy.h"
+#include "src/cpu/operators/CpuFill.h"
+#include "src/cpu/operators/CpuGemmDirectConv2d.h"
+#include "src/cpu/operators/CpuPool2d.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+using namespace arm_compute::experimental;
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+/** Index of the height dimension of the NHWC tensors */
+constexpr size_t idx_height = 2;
+
+/** Partition of the convolution output in bands of rows */
+struct BandGeometry
+{
+    unsigned int rows{0};       /**< Convolution output rows computed by a band */
+    unsigned int num_bands{0};  /**< Number of bands covering the rows read by the pooling */
+    unsigned int input_rows{0}; /**< Input rows read by a band */
+    Conv2dInfo   conv_info{};   /**< Convolution descriptor of a band */
+};
+
+/** Splits the convolution output in bands of rows
+ *
+ * Half of the L2 cache is left to the bands, the rest holds the weights and the input rows streamed by the
+ * convolution. All the bands share the same geometry and have no padding at the top and bottom, so that a single
+ * convolution is configured and its weights are only transformed once.
+ *
+ * @param[in] input         Input of the convolution
+ * @param[in] weights       Weights of the convolution
+ * @param[in] pooled_height Height of the output of the pooling
+ * @param[in] conv_info     Convolution descriptor
+ *
+ * @return The geometry of the bands
+ */
+BandGeometry compute_band_geometry(const ITensorInfo &input,
+                                   const ITensorInfo &weights,
+                                   unsigned int       pooled_height,
+                                   const Conv2dInfo  &conv_info)
+{
+    const TensorShape  conv_shape  = compute_deep_convolution_shape(input, weights, conv_info.conv_info);
+    const unsigned int conv_rows   = conv_shape[idx_height];
+    const unsigned int pooled_rows = 2 * pooled_height;
+    const size_t       row_size    = conv_shape.total_size() / std::max(conv_rows, 1U) * input.element_size();
+    const size_t       band_rows   = CPUInfo::get().get_L2_cache_size() / 2 / std::max<size_t>(row_size, 1);
+
+    BandGeometry geometry{};
+    geometry.rows      = std::max(2U, static_cast<unsigned int>(std::min<size_t>(band_rows, conv_rows)) & ~1U);
+    geometry.conv_info = conv_info;
+    if (geometry.rows >= pooled_rows)
+    {
+        // A single band computes the whole convolution output
+        geometry.rows       = conv_rows;
+        geometry.num_bands  = 1;
+        geometry.input_rows = input.dimension(idx_height);
+        return geometry;
+    }
+
+    // Only the rows read by the pooling are computed
+    const PadStrideInfo &pad_stride = conv_info.conv_info;
+    geometry.num_bands              = DIV_CEIL(pooled_rows, geometry.rows);
+    geometry.input_rows             = (geometry.rows - 1) * pad_stride.stride().second + weights.dimension(idx_height);
+    geometry.conv_info.conv_info =
+        PadStrideInfo(pad_stride.stride().first, pad_stride.stride().second, pad_stride.pad_left(),
+                      pad_stride.pad_right(), 0, 0, pad_stride.round());
+    return geometry;
+}
+
+Status validate_arguments(const ITensorInfo      *input,
+                          const ITensorInfo      *weights,
+                          const ITensorInfo      *biases,
+                          const ITensorInfo      *output,
+                          const Conv2dInfo       &conv_info,
+                          const PoolingLayerInfo &pool_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_layout() != DataLayout::NHWC, "Data layout supported is NHWC");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.accumulate, "Accumulation is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(pool_info.pool_type != PoolingType::MAX || pool_info.is_global_pooling ||
+                                        pool_info.pool_size != Size2D(2U, 2U) ||
+                                        pool_info.pad_stride_info.stride() != std::make_pair(2U, 2U) ||
+                                        pool_info.pad_stride_info.has_padding() || pool_info.use_kernel_indices,
+                                    "Only 2x2 max pooling of stride 2 without padding is supported");
+
+    const TensorInfo conv_output =
+        input->clone()->set_tensor_shape(compute_deep_convolution_shape(*input, *weights, conv_info.conv_info));
+    const TensorShape pool_shape = compute_pool_shape(conv_output, pool_info);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(2 * pool_shape[idx_height] > conv_output.dimension(idx_height),
+                                    "The pooling windows must not go past the bottom of the convolution output");
+
+    if (output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), pool_shape);
+    }
+
+    // All the bands are computed by the same convolution and pooling
+    const BandGeometry geometry   = compute_band_geometry(*input, *weights, pool_shape[idx_height], conv_info);
+    const TensorInfo   band_input = input->clone()->set_tensor_shape(
+        TensorShape(input->tensor_shape()).set(idx_height, geometry.input_rows));
+    const TensorInfo conv_band = conv_output.clone()->set_tensor_shape(
+        TensorShape(conv_output.tensor_shape()).set(idx_height, geometry.rows));
+    const TensorInfo pool_band = conv_band.clone()->set_tensor_shape(compute_pool_shape(conv_band, pool_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        cpu::CpuGemmDirectConv2d::validate(&band_input, weights, biases, &conv_band, geometry.conv_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuPool2d::validate(&conv_band, &pool_band, pool_info));
+
+    return Status{};
+}
+} // namespace
+
+struct NEConvolutionPoolingLayer::Impl
+{
+    /** Tensors read and written by a band */
+    struct Band
+    {
+        ITensor                      *src{nullptr};         /**< Input of the convolution */
+        std::unique_ptr<SubTensor>    input_rows{nullptr};  /**< Input rows read by the band */
+        std::unique_ptr<SubTensor>    padded_rows{nullptr}; /**< Destination of the input rows in the padded input */
+        std::unique_ptr<cpu::CpuCopy> copy{nullptr};        /**< Copy to the padded input if reading past the borders */
+        std::unique_ptr<SubTensor>    dst{nullptr};         /**< Output rows written by the pooling */
+        bool                          is_tail{false};       /**< Last band, pooling fewer rows than the others */
+    };
+
+    const ITensor                            *weights{nullptr};
+    std::unique_ptr<cpu::CpuGemmDirectConv2d> conv{nullptr};
+    std::unique_ptr<cpu::CpuPool2d>           pool{nullptr};
+    std::unique_ptr<cpu::CpuPool2d>           pool_tail{nullptr};
+    std::unique_ptr<cpu::CpuFill>             fill{nullptr};
+    std::vector<Band>                         bands{};
+    Tensor                                    conv_band{};
+    Tensor                                    padded_input{};
+    std::unique_ptr<SubTensor>                conv_tail{nullptr};
+    ITensorPack                               conv_pack{};
+    ITensorPack                               conv_prep_pack{};
+    ITensorPack                               pool_pack{};
+    ITensorPack                               pool_tail_pack{};
+    WorkspaceData<Tensor>                     conv_workspace{};
+    WorkspaceData<Tensor>                     pool_workspace{};
+    WorkspaceData<Tensor>                     pool_tail_workspace{};
+    MemoryRequirements                        conv_aux_mem_req{};
+    MemoryGroup                               memory_group{};
+    bool                                      is_prepared{false};
+};
+
+NEConvolutionPoolingLayer::NEConvolutionPoolingLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+
+NEConvolutionPoolingLayer::~NEConvolutionPoolingLayer() = default;
+
+void NEConvolutionPoolingLayer::configure(ITensor                *input,
+                                          const ITensor          *weights,
+                                          const ITensor          *biases,
+                                          ITensor                *output,
+                                          const Conv2dInfo       &conv_info,
+                                          const PoolingLayerInfo &pool_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, conv_info, pool_info);
+
+    // Output auto initialization if not yet initialized
+    const TensorInfo conv_output = input->info()->clone()->set_tensor_shape(
+        compute_deep_convolution_shape(*input->info(), *weights->info(), conv_info.conv_info));
+    auto_init_if_empty(*output->info(),
+                       conv_output.clone()->set_tensor_shape(compute_pool_shape(conv_output, pool_info)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionPoolingLayer::validate(
+        input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr, output->info(), conv_info,
+        pool_info));
+
+    const unsigned int pooled_height = output->info()->dimension(idx_height);
+    const BandGeometry geometry = compute_band_geometry(*input->info(), *weights->info(), pooled_height, conv_info);
+    const TensorShape  input_shape  = input->info()->tensor_shape();
+    const TensorShape  output_shape = output->info()->tensor_shape();
+    const int          input_height = static_cast<int>(input_shape[idx_height]);
+    const unsigned int stride_y     = conv_info.conv_info.stride().second;
+    const unsigned int pool_rows    = geometry.rows / 2;
+
+    _impl->weights     = weights;
+    _impl->is_prepared = false;
+    _impl->bands.clear();
+
+    // The convolution output of a band is reused by the next one
+    _impl->conv_band.allocator()->init(
+        conv_output.clone()->set_tensor_shape(TensorShape(conv_output.tensor_shape()).set(idx_height, geometry.rows)));
+    _impl->memory_group.manage(&_impl->conv_band);
+
+    // Input of the bands reading past the input borders, it holds a zero padded copy of their input rows
+    if (geometry.num_bands > 1)
+    {
+        _impl->padded_input.allocator()->init(input->info()->clone()->set_tensor_shape(
+            TensorShape(input_shape).set(idx_height, geometry.input_rows)));
+    }
+
+    bool has_padded_bands = false;
+    for (unsigned int b = 0; b < geometry.num_bands; ++b)
+    {
+        Impl::Band band{};
+
+        // Input rows read by the band, bands reading past the input borders compute a zero padded copy of them
+        if (geometry.num_bands == 1)
+        {
+            band.src = input;
+        }
+        else
+        {
+            const int in_start = static_cast<int>(b * geometry.rows * stride_y) - conv_info.conv_info.pad_top();
+            const int in_end   = in_start + static_cast<int>(geometry.input_rows);
+            if (in_start >= 0 && in_end <= input_height)
+            {
+                band.input_rows = std::make_unique<SubTensor>(input, _impl->padded_input.info()->tensor_shape(),
+                                                              Coordinates(0, 0, in_start));
+                band.src = band.input_rows.get();
+            }
+            else
+            {
+                const int valid_start = std::max(in_start, 0);
+                const int valid_end   = std::min(in_end, input_height);
+                band.src              = &_impl->padded_input;
+                has_padded_bands      = true;
+                if (valid_end > valid_start)
+                {
+                    const TensorShape rows_shape = TensorShape(input_shape).set(idx_height, valid_end - valid_start);
+                    band.input_rows = std::make_unique<SubTensor>(input, rows_shape, Coordinates(0, 0, valid_start));
+                    band.padded_rows = std::make_unique<SubTensor>(&_impl->padded_input, rows_shape,
+                                                                   Coordinates(0, 0, valid_start - in_start));
+                }
+            }
+        }
+
+        // Output rows of the pooling, the last band may pool fewer rows than the others
+        const unsigned int dst_start = b * pool_rows;
+        const unsigned int dst_rows  = std::min(pool_rows, pooled_height - dst_start);
+        band.is_tail                 = geometry.num_bands > 1 && dst_rows < pool_rows;
+        band.dst                     = std::make_unique<SubTensor>(
+            output, TensorShape(output_shape).set(idx_height, dst_rows), Coordinates(0, 0, dst_start));
+
+        _impl->bands.emplace_back(std::move(band));
+    }
+
+    // Copy the input rows of the bands reading past the input borders to the zero padded input
+    if (has_padded_bands)
+    {
+        _impl->memory_group.manage(&_impl->padded_input);
+
+        _impl->fill = std::make_unique<cpu::CpuFill>();
+        _impl->fill->configure(_impl->padded_input.info(), PixelValue(0.0, input->info()->data_type()));
+        for (auto &band : _impl->bands)
+        {
+            if (band.padded_rows != nullptr)
+            {
+                band.copy = std::make_unique<cpu::CpuCopy>();
+                band.copy->configure(band.input_rows->info(), band.padded_rows->info());
+            }
+        }
+    }
+
+    // Configure the convolution shared by all the bands
+    _impl->conv = std::make_unique<cpu::CpuGemmDirectConv2d>();
+    _impl->conv->configure(geometry.num_bands == 1 ? input->info() : _impl->padded_input.info(), weights->info(),
+                           biases != nullptr ? biases->info() : nullptr, _impl->conv_band.info(), geometry.conv_info);
+    _impl->conv_aux_mem_req = _impl->conv->workspace();
+    _impl->conv_pack        = {{TensorType::ACL_SRC_2, biases}, {TensorType::ACL_DST, &_impl->conv_band}};
+    _impl->conv_prep_pack   = {{TensorType::ACL_SRC_1, weights}, {TensorType::ACL_SRC_2, biases}};
+    _impl->conv_workspace   = manage_workspace<Tensor>(_impl->conv_aux_mem_req, _impl->memory_group, _impl->conv_pack,
+                                                       _impl->conv_prep_pack, /* allocate_now */ false);
+
+    // Configure the pooling of the bands
+    _impl->pool = std::make_unique<cpu::CpuPool2d>();
+    _impl->pool->configure(_impl->conv_band.info(), _impl->bands.front().dst->info(), pool_info);
+    _impl->pool_pack      = {{TensorType::ACL_SRC, &_impl->conv_band}};
+    _impl->pool_workspace = manage_workspace<Tensor>(_impl->pool->workspace(), _impl->memory_group, _impl->pool_pack);
+
+    if (_impl->bands.back().is_tail)
+    {
+        const Impl::Band &tail       = _impl->bands.back();
+        const TensorShape tail_shape = TensorShape(_impl->conv_band.info()->tensor_shape())
+                                           .set(idx_height, 2 * tail.dst->info()->dimension(idx_height));
+        _impl->conv_tail = std::make_unique<SubTensor>(&_impl->conv_band, tail_shape, Coordinates());
+        _impl->pool_tail = std::make_unique<cpu::CpuPool2d>();
+        _impl->pool_tail->configure(_impl->conv_tail->info(), tail.dst->info(), pool_info);
+        _impl->pool_tail_pack      = {{TensorType::ACL_SRC, _impl->conv_tail.get()}};
+        _impl->pool_tail_workspace = manage_workspace<Tensor>(_impl->pool_tail->workspace(), _impl->memory_group,
+                                                              _impl->pool_tail_pack);
+    }
+
+    _impl->conv_band.allocator()->allocate();
+    if (has_padded_bands)
+    {
+        _impl->padded_input.allocator()->allocate();
+    }
+}
+
+Status NEConvolutionPoolingLayer::validate(const ITensorInfo      *input,
+                                           const ITensorInfo      *weights,
+                                           const ITensorInfo      *biases,
+                                           const ITensorInfo      *output,
+                                           const Conv2dInfo       &conv_info,
+                                           const PoolingLayerInfo &pool_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, weights, biases, output);
+    return validate_arguments(input, weights, biases, output, conv_info, pool_info);
+}
+
+void NEConvolutionPoolingLayer::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    for (auto &band : _impl->bands)
+    {
+        if (band.src == &_impl->padded_input)
+        {
+            ITensorPack fill_pack{{TensorType::ACL_SRC_DST, &_impl->padded_input}};
+            _impl->fill->run(fill_pack);
+            if (band.copy != nullptr)
+            {
+                ITensorPack copy_pack{{TensorType::ACL_SRC, band.input_rows.get()},
+                                      {TensorType::ACL_DST, band.padded_rows.get()}};
+                band.copy->run(copy_pack);
+            }
+        }
+
+        _impl->conv_pack.add_tensor(TensorType::ACL_SRC_0, band.src);
+        _impl->conv->run(_impl->conv_pack);
+
+        if (band.is_tail)
+        {
+            _impl->pool_tail_pack.add_tensor(TensorType::ACL_DST, band.dst.get());
+            _impl->pool_tail->run(_impl->pool_tail_pack);
+        }
+        else
+        {
+            _impl->pool_pack.add_tensor(TensorType::ACL_DST, band.dst.get());
+            _impl->pool->run(_impl->pool_pack);
+        }
+    }
+}
+
+void NEConvolutionPoolingLayer::prepare()
+{
+    if (!_impl->is_prepared)
+    {
+        allocate_tensors(_impl->conv_aux_mem_req, _impl->conv_workspace);
+        _impl->conv->prepare(_impl->conv_prep_pack);
+
+        auto has_reshape =
+            std::find_if(_impl->conv_aux_mem_req.begin(), _impl->conv_aux_mem_req.end(),
+                         [](const MemoryInfo &m) -> bool { return m.lifetime == MemoryLifetime::Persistent; });
+
+        if (has_reshape != std::end(_impl->conv_aux_mem_req))
+        {
+            _impl->weights->mark_as_unused();
+        }
+        else
+        {
+            _impl->conv_pack.add_const_tensor(ACL_SRC_1, _impl->weights);
+        }
+
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->conv_aux_mem_req, _impl->conv_workspace);
+        _impl->is_prepared = true;
+    }
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,8 @@
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/AutoConfiguration.h"
 
+#include <algorithm>
+
 using namespace arm_compute::misc::shape_calculator;
 
 namespace arm_compute
@@ -73,6 +75,163 @@ compute_upsample_info(const PadStrideInfo &info, uint32_t deconv_pad_x, uint32_t
                                         deconv_pad_bottom, DimensionRoundingType::FLOOR),
                           negative_padding);
 }
+
+/** Geometry of the sub-pixel deconvolution along one axis */
+struct SubPixelAxis
+{
+    int              kernel_size{0}; /**< Size of the kernel of every phase, zero taps included */
+    int              pad_before{0};  /**< Padding of the input before its first element */
+    int              pad_after{0};   /**< Padding of the input after its last element */
+    std::vector<int> taps{};         /**< Number of taps of the weights falling into each phase */
+    std::vector<int> slice_start{};  /**< First tap of each phase in the flipped weights */
+    std::vector<int> offset{};       /**< Position of the taps of each phase in its kernel */
+};
+
+/** Decompose a deconvolution along one axis into one convolution of unit stride over the input per phase of the output
+ *
+ * The output element o = t * stride + r receives the taps k = p + stride * m of the weights, where
+ * p = (r + pad_before) % stride, from the input elements t + (r + pad_before) / stride - m. Once flipped, the taps of a
+ * phase are the convolution kernel of that phase. The kernels are aligned into a common one by zero taps so that all
+ * the phases share the same padding.
+ *
+ * @param[in]  input_size  Size of the input along the axis.
+ * @param[in]  kernel_size Size of the weights along the axis.
+ * @param[in]  stride      Stride of the deconvolution along the axis.
+ * @param[in]  pad_before  Padding of the deconvolution before the axis.
+ * @param[in]  output_size Size of the output along the axis.
+ * @param[out] axis        Geometry of the decomposition.
+ *
+ * @return True if the decomposition exists and its kernels are smaller than the weights
+ */
+bool compute_sub_pixel_axis(
+    int input_size, int kernel_size, int stride, int pad_before, int output_size, SubPixelAxis &axis)
+{
+    if (kernel_size < stride || (output_size % stride) != 0)
+    {
+        return false;
+    }
+
+    std::vector<int> phase_pad_before(stride);
+    axis.taps.resize(stride);
+    axis.slice_start.resize(stride);
+    axis.offset.resize(stride);
+    for (int r = 0; r < stride; ++r)
+    {
+        const int phase     = (r + pad_before) % stride;
+        const int shift     = (r + pad_before) / stride;
+        axis.taps[r]        = (kernel_size - phase + stride - 1) / stride;
+        axis.slice_start[r] = (kernel_size - 1 - phase) % stride;
+        phase_pad_before[r] = axis.taps[r] - 1 - shift;
+    }
+
+    axis.pad_before = *std::max_element(phase_pad_before.begin(), phase_pad_before.end());
+    if (axis.pad_before < 0)
+    {
+        return false;
+    }
+    axis.kernel_size = 0;
+    for (int r = 0; r < stride; ++r)
+    {
+        axis.offset[r]   = axis.pad_before - phase_pad_before[r];
+        axis.kernel_size = std::max(axis.kernel_size, axis.offset[r] + axis.taps[r]);
+    }
+
+    // Trailing zero taps absorb any excess of the phases over output_size / stride elements
+    axis.pad_after = output_size / stride - 1 + axis.kernel_size - input_size - axis.pad_before;
+    if (axis.pad_after < 0)
+    {
+        axis.kernel_size -= axis.pad_after;
+        axis.pad_after = 0;
+    }
+    return axis.kernel_size < kernel_size;
+}
+
+Status validate_sub_pixel(const ITensorInfo   *input,
+                          const ITensorInfo   *weights,
+                          const ITensorInfo   *bias,
+                          const TensorShape   &output_shape,
+                          const QuantizationInfo &output_qinfo,
+                          const PadStrideInfo &info,
+                          bool                 enable_fast_math,
+                          const WeightsInfo   &weights_info,
+                          SubPixelAxis        &axis_x,
+                          SubPixelAxis        &axis_y)
+{
+    const DataLayout   data_layout = input->data_layout();
+    const unsigned int width_idx   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int height_idx  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const unsigned int channel_idx = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const int          stride      = static_cast<int>(info.stride().first);
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(stride < 2 || info.stride().second != info.stride().first,
+                                    "Sub-pixel deconvolution needs the same stride in both dimensions");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_data_type_quantized_per_channel(weights->data_type()),
+                                    "Sub-pixel deconvolution does not support per channel quantized weights");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(
+        !compute_sub_pixel_axis(input->dimension(width_idx), weights->dimension(width_idx), stride, info.pad_left(),
+                                output_shape[width_idx], axis_x) ||
+            !compute_sub_pixel_axis(input->dimension(height_idx), weights->dimension(height_idx), stride,
+                                    info.pad_top(), output_shape[height_idx], axis_y),
+        "Sub-pixel deconvolution is not worthwhile for this geometry");
+
+    const unsigned int num_phases = stride * stride;
+    const unsigned int num_ofm    = weights->dimension(3);
+
+    TensorShape phase_weights_shape = weights->tensor_shape();
+    phase_weights_shape.set(width_idx, axis_x.kernel_size);
+    phase_weights_shape.set(height_idx, axis_y.kernel_size);
+    phase_weights_shape.set(3, num_ofm * num_phases);
+    const TensorInfo phase_weights_info =
+        weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(phase_weights_shape);
+
+    BiStrides slice_strides(1, 1, 1, 1);
+    slice_strides.set(width_idx, stride);
+    slice_strides.set(height_idx, stride);
+    for (int ry = 0; ry < stride; ++ry)
+    {
+        for (int rx = 0; rx < stride; ++rx)
+        {
+            Coordinates starts(0, 0, 0, 0);
+            starts.set(width_idx, axis_x.slice_start[rx]);
+            starts.set(height_idx, axis_y.slice_start[ry]);
+            TensorShape slice_shape = weights->tensor_shape();
+            slice_shape.set(width_idx, axis_x.taps[rx]);
+            slice_shape.set(height_idx, axis_y.taps[ry]);
+            const TensorInfo slice_info =
+                weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(slice_shape);
+            ARM_COMPUTE_RETURN_ON_ERROR(
+                NEStridedSlice::validate(weights, &slice_info, starts, Coordinates(), slice_strides));
+        }
+    }
+
+    TensorInfo phase_bias_info;
+    if (bias != nullptr)
+    {
+        phase_bias_info = bias->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(
+            TensorShape(num_ofm * num_phases));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(std::vector<const ITensorInfo *>(num_phases, bias),
+                                                                 &phase_bias_info, Window::DimX));
+    }
+
+    TensorShape phase_output_shape = output_shape;
+    phase_output_shape.set(width_idx, output_shape[width_idx] / stride);
+    phase_output_shape.set(height_idx, output_shape[height_idx] / stride);
+    phase_output_shape.set(channel_idx, output_shape[channel_idx] * num_phases);
+    TensorInfo phase_output_info(phase_output_shape, 1, input->data_type(), output_qinfo);
+    phase_output_info.set_data_layout(data_layout);
+
+    const PadStrideInfo conv_info(1, 1, axis_x.pad_before, axis_x.pad_after, axis_y.pad_before, axis_y.pad_after,
+                                  DimensionRoundingType::FLOOR);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayer::validate(
+        input, &phase_weights_info, (bias != nullptr) ? &phase_bias_info : nullptr, &phase_output_info, conv_info,
+        weights_info, Size2D(1U, 1U), ActivationLayerInfo(), enable_fast_math));
+
+    TensorInfo output_info(output_shape, 1, input->data_type(), output_qinfo);
+    output_info.set_data_layout(data_layout);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEDepthToSpaceLayer::validate(&phase_output_info, &output_info, stride));
+
+    return Status{};
+}
 } // namespace
 
 NEDeconvolutionLayer::NEDeconvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) // NOLINT
@@ -80,14 +239,23 @@ NEDeconvolutionLayer::NEDeconvolutionLayer(std::shared_ptr<IMemoryManager> memor
       _conv_f(memory_manager),
       _upsample_f(),
       _flip_weights(),
+      _fill_phase_weights(),
+      _slice_weights(),
+      _concat_bias(),
+      _depth_to_space(std::make_unique<NEDepthToSpaceLayer>()),
       _scaled_output(),
       _weights_flipped(),
       _flip_axis(),
+      _phase_weights(),
+      _phase_weights_views(),
+      _phase_bias(),
+      _phase_output(),
       _original_weights(nullptr),
       _input(nullptr),
       _info(),
       _is_prepared(false),
-      _do_upsampling(true)
+      _do_upsampling(true),
+      _do_sub_pixel(false)
 {
 }
 
@@ -144,12 +312,11 @@ Status NEDeconvolutionLayer::validate(const ITensorInfo   *input,
         }
     }
 
+    const TensorShape output_shape = compute_deconvolution_output_shape(out_dims, *input, *weights);
     if (output->tensor_shape().total_size() > 0)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
 
-        const TensorShape output_shape = compute_deconvolution_output_shape(out_dims, *input, *weights);
-
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->dimension(Window::DimX) != output_shape.x(),
                                         "Output's width is invalid.");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->dimension(Window::DimY) != output_shape.y(),
@@ -189,6 +356,17 @@ Status NEDeconvolutionLayer::validate(const ITensorInfo   *input,
 
     if (do_upsampling)
     {
+        // The sub-pixel decomposition is preferred, the upsampling being the fallback when it does not apply
+        SubPixelAxis           axis_x;
+        SubPixelAxis           axis_y;
+        const QuantizationInfo output_qinfo =
+            output->tensor_shape().total_size() > 0 ? output->quantization_info() : input->quantization_info();
+        if (bool(validate_sub_pixel(input, weights, bias, output_shape, output_qinfo, info, enable_fast_math,
+                                    weights_info, axis_x, axis_y)))
+        {
+            return Status{};
+        }
+
         const PadStrideInfo conv_info(1, 1, 0, 0, 0, 0, DimensionRoundingType::CEIL);
         ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayer::validate(&scale_out_info, weights, bias, output, conv_info,
                                                                  weights_info, Size2D(1U, 1U), ActivationLayerInfo(),
@@ -267,8 +445,90 @@ void NEDeconvolutionLayer::configure(ITensor             *input,
     axis_data[0]   = static_cast<uint32_t>(width_idx);
     axis_data[1]   = static_cast<uint32_t>(height_idx);
 
+    SubPixelAxis axis_x;
+    SubPixelAxis axis_y;
+    _do_sub_pixel = _do_upsampling && bool(validate_sub_pixel(input->info(), weights->info(),
+                                                              (bias == nullptr) ? nullptr : bias->info(), output_shape,
+                                                              output->info()->quantization_info(), info,
+                                                              enable_fast_math, weights_info, axis_x, axis_y));
+
     // Setup convolution and upsampling, if needed
-    if (_do_upsampling)
+    if (_do_sub_pixel)
+    {
+        const int          stride      = static_cast<int>(stride_x);
+        const unsigned int num_phases  = stride_x * stride_y;
+        const unsigned int num_ofm     = weights->info()->dimension(3);
+        const unsigned int channel_idx = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+
+        // The kernels of the phases are stacked along the OFM, in the channel order of the depth to space
+        TensorShape phase_weights_shape = weights->info()->tensor_shape();
+        phase_weights_shape.set(width_idx, axis_x.kernel_size);
+        phase_weights_shape.set(height_idx, axis_y.kernel_size);
+        phase_weights_shape.set(3, num_ofm * num_phases);
+        _phase_weights.allocator()->init(
+            weights->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(phase_weights_shape));
+        _fill_phase_weights.configure(&_phase_weights, PixelValue(0.0, weights->info()->data_type(),
+                                                                  weights->info()->quantization_info()));
+
+        BiStrides slice_strides(1, 1, 1, 1);
+        slice_strides.set(width_idx, stride);
+        slice_strides.set(height_idx, stride);
+        _phase_weights_views.clear();
+        _phase_weights_views.reserve(num_phases);
+        _slice_weights.resize(num_phases);
+        for (int ry = 0; ry < stride; ++ry)
+        {
+            for (int rx = 0; rx < stride; ++rx)
+            {
+                const unsigned int phase      = ry * stride + rx;
+                TensorShape        view_shape = weights->info()->tensor_shape();
+                view_shape.set(width_idx, axis_x.taps[rx]);
+                view_shape.set(height_idx, axis_y.taps[ry]);
+                Coordinates view_coords(0, 0, 0, 0);
+                view_coords.set(width_idx, axis_x.offset[rx]);
+                view_coords.set(height_idx, axis_y.offset[ry]);
+                view_coords.set(3, phase * num_ofm);
+                _phase_weights_views.emplace_back(&_phase_weights, view_shape, view_coords);
+
+                Coordinates starts(0, 0, 0, 0);
+                starts.set(width_idx, axis_x.slice_start[rx]);
+                starts.set(height_idx, axis_y.slice_start[ry]);
+                _slice_weights[phase].configure(&_weights_flipped, &_phase_weights_views[phase], starts, Coordinates(),
+                                                slice_strides);
+            }
+        }
+
+        if (bias != nullptr)
+        {
+            _phase_bias.allocator()->init(
+                bias->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(
+                    TensorShape(num_ofm * num_phases)));
+            _concat_bias.configure(std::vector<const ITensor *>(num_phases, bias), &_phase_bias, Window::DimX);
+        }
+
+        _memory_group.manage(&_phase_output);
+        TensorShape phase_output_shape = output->info()->tensor_shape();
+        phase_output_shape.set(width_idx, phase_output_shape[width_idx] / stride_x);
+        phase_output_shape.set(height_idx, phase_output_shape[height_idx] / stride_y);
+        phase_output_shape.set(channel_idx, phase_output_shape[channel_idx] * num_phases);
+        TensorInfo phase_output_info(phase_output_shape, 1, input->info()->data_type(),
+                                     output->info()->quantization_info());
+        phase_output_info.set_data_layout(data_layout);
+        _phase_output.allocator()->init(phase_output_info);
+
+        const PadStrideInfo conv_info(1, 1, axis_x.pad_before, axis_x.pad_after, axis_y.pad_before, axis_y.pad_after,
+                                      DimensionRoundingType::FLOOR);
+        _conv_f.configure(input, &_phase_weights, (bias == nullptr) ? nullptr : &_phase_bias, &_phase_output,
+                          conv_info, weights_info, Size2D(1U, 1U), ActivationLayerInfo(), enable_fast_math);
+        _depth_to_space->configure(&_phase_output, output, stride);
+
+        _phase_output.allocator()->allocate();
+        if (bias != nullptr)
+        {
+            _phase_bias.allocator()->allocate();
+        }
+    }
+    else if (_do_upsampling)
     {
         _memory_group.manage(&_scaled_output);
 
@@ -301,6 +561,17 @@ void NEDeconvolutionLayer::run()
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    if (_do_sub_pixel)
+    {
+        if (_phase_bias.info()->total_size() > 0)
+        {
+            _concat_bias.run();
+        }
+        _conv_f.run();
+        _depth_to_space->run();
+        return;
+    }
+
     if (_do_upsampling)
     {
         _upsample_f.run();
@@ -319,9 +590,26 @@ void NEDeconvolutionLayer::prepare()
         _flip_weights.run();
         _original_weights->mark_as_unused();
 
+        if (_do_sub_pixel)
+        {
+            // Gather the taps of each phase, the kernels of the phases being aligned by zero taps
+            _phase_weights.allocator()->allocate();
+            _fill_phase_weights.run();
+            for (auto &slice : _slice_weights)
+            {
+                slice.run();
+            }
+            _weights_flipped.allocator()->free();
+        }
+
         // Prepare convolution
         _conv_f.prepare();
 
+        if (_do_sub_pixel && !_phase_weights.is_used())
+        {
+            _phase_weights.allocator()->free();
+        }
+
         _is_prepared = true;
     }
 }
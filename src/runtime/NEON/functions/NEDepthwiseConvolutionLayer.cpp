@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
+#include "src/cpu/kernels/CpuUnpackInt4Kernel.h"
 #include "src/cpu/operators/CpuDepthwiseConv2d.h"
 
 using namespace arm_compute::misc;
@@ -68,7 +69,8 @@ void NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayerOptimizedInternal::
     const PadStrideInfo       &conv_info,
     unsigned int               depth_multiplier,
     const ActivationLayerInfo &act_info,
-    const Size2D              &dilation)
+    const Size2D              &dilation,
+    bool                       enable_fast_math)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
 
@@ -80,7 +82,7 @@ void NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayerOptimizedInternal::
     _impl->permute = is_nhwc;
 
     _impl->op = std::make_unique<cpu::CpuDepthwiseConv2d>();
-    ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation};
+    ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation, enable_fast_math};
     _impl->op->configure(_impl->src->info(), _impl->weights->info(),
                          _impl->biases == nullptr ? nullptr : _impl->biases->info(), _impl->dst->info(), info);
 
@@ -94,7 +96,7 @@ void NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayerOptimizedInternal::
     {
         act_info_to_use = act_info;
     }
-    info = ConvolutionInfo{conv_info, depth_multiplier, act_info_to_use, dilation};
+    info = ConvolutionInfo{conv_info, depth_multiplier, act_info_to_use, dilation, enable_fast_math};
 
     auto dwc_optimized_func = std::make_unique<cpu::CpuDepthwiseConv2dAssemblyDispatch>();
 
@@ -157,9 +159,10 @@ NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayerOptimizedInternal::valid
                                                                                     const PadStrideInfo &conv_info,
                                                                                     unsigned int depth_multiplier,
                                                                                     const ActivationLayerInfo &act_info,
-                                                                                    const Size2D              &dilation)
+                                                                                    const Size2D              &dilation,
+                                                                                    bool enable_fast_math)
 {
-    ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation};
+    ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation, enable_fast_math};
     return cpu::CpuDepthwiseConv2d::validate(input, weights, biases, output, info);
 }
 
@@ -319,10 +322,14 @@ NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayer(std::shared_ptr<IMemory
 #ifndef DOXYGEN_SKIP_THIS
 struct NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayer::Impl
 {
-    DepthwiseConvolutionFunction                 depth_conv_func{DepthwiseConvolutionFunction::OPTIMIZED};
-    NEDepthwiseConvolutionLayerOptimizedInternal func_optimized{nullptr};
-    NEDepthwiseConvolutionLayerGeneric           func_generic{};
-    std::shared_ptr<cpu::CpuDepthwiseConv2d>     op{nullptr};
+    DepthwiseConvolutionFunction                       depth_conv_func{DepthwiseConvolutionFunction::OPTIMIZED};
+    NEDepthwiseConvolutionLayerOptimizedInternal       func_optimized{nullptr};
+    NEDepthwiseConvolutionLayerGeneric                 func_generic{};
+    std::shared_ptr<cpu::CpuDepthwiseConv2d>           op{nullptr};
+    std::unique_ptr<cpu::kernels::CpuUnpackInt4Kernel> unpack_weights{nullptr};
+    const ITensor                                     *weights{nullptr};
+    Tensor                                             unpacked_weights{};
+    bool                                               is_unpacked{false};
 };
 #endif // DOXYGEN_SKIP_THIS
 
@@ -333,28 +340,42 @@ void NEDepthwiseConvolutionLayer::configure(ITensor                   *input,
                                             const PadStrideInfo       &conv_info,
                                             unsigned int               depth_multiplier,
                                             const ActivationLayerInfo &act_info,
-                                            const Size2D              &dilation)
+                                            const Size2D              &dilation,
+                                            bool                       enable_fast_math)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
 
     ARM_COMPUTE_LOG_PARAMS(input, weights, output, conv_info, depth_multiplier, biases, act_info, dilation);
     ARM_COMPUTE_ERROR_THROW_ON(NEDepthwiseConvolutionLayer::validate(
         input->info(), weights->info(), (biases == nullptr) ? nullptr : biases->info(), output->info(), conv_info,
-        depth_multiplier, act_info, dilation));
+        depth_multiplier, act_info, dilation, enable_fast_math));
 
-    const ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation};
+    // Packed 4-bit weights are unpacked to 8-bit before the convolution, once if they are constant
+    const ITensor *weights_to_use = weights;
+    _impl->weights                = weights;
+    _impl->is_unpacked            = false;
+    if (weights->info()->data_type() == DataType::U8)
+    {
+        _impl->unpack_weights = std::make_unique<cpu::kernels::CpuUnpackInt4Kernel>();
+        _impl->unpack_weights->configure(weights->info(), _impl->unpacked_weights.info());
+        _impl->unpacked_weights.info()->set_are_values_constant(weights->info()->are_values_constant());
+        _impl->unpacked_weights.allocator()->allocate();
+        weights_to_use = &_impl->unpacked_weights;
+    }
+
+    const ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation, enable_fast_math};
     _impl->op              = std::make_shared<cpu::CpuDepthwiseConv2d>();
     _impl->depth_conv_func = _impl->op->get_depthwiseconvolution_function(
-        input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), info);
+        input->info(), weights_to_use->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), info);
     switch (_impl->depth_conv_func)
     {
         case DepthwiseConvolutionFunction::OPTIMIZED:
-            _impl->func_optimized.configure(input, weights, biases, output, conv_info, depth_multiplier, act_info,
-                                            dilation);
+            _impl->func_optimized.configure(input, weights_to_use, biases, output, conv_info, depth_multiplier,
+                                            act_info, dilation, enable_fast_math);
             break;
         case DepthwiseConvolutionFunction::GENERIC:
-            _impl->func_generic.configure(input, weights, biases, output, conv_info, depth_multiplier, act_info,
-                                          dilation);
+            _impl->func_generic.configure(input, weights_to_use, biases, output, conv_info, depth_multiplier,
+                                          act_info, dilation);
             break;
         default:
             ARM_COMPUTE_ERROR("Unsupported DepthwiseConvolutionFunction");
@@ -368,15 +389,49 @@ Status NEDepthwiseConvolutionLayer::validate(const ITensorInfo         *input,
                                              const PadStrideInfo       &conv_info,
                                              unsigned int               depth_multiplier,
                                              const ActivationLayerInfo &act_info,
-                                             const Size2D              &dilation)
+                                             const Size2D              &dilation,
+                                             bool                       enable_fast_math)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, weights, biases, output);
-    ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation};
-    return cpu::CpuDepthwiseConv2d::validate(input, weights, biases, output, info);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(weights);
+
+    const ITensorInfo *weights_to_use = weights;
+    TensorInfo         unpacked_weights{};
+    if (weights->data_type() == DataType::U8)
+    {
+        unpacked_weights = cpu::kernels::CpuUnpackInt4Kernel::unpacked_info(*weights);
+        ARM_COMPUTE_RETURN_ON_ERROR(cpu::kernels::CpuUnpackInt4Kernel::validate(weights, &unpacked_weights));
+        weights_to_use = &unpacked_weights;
+    }
+
+    ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation, enable_fast_math};
+    return cpu::CpuDepthwiseConv2d::validate(input, weights_to_use, biases, output, info);
+}
+
+void NEDepthwiseConvolutionLayer::unpack_weights()
+{
+    if (_impl->unpack_weights != nullptr && (!_impl->is_unpacked || !_impl->weights->info()->are_values_constant()))
+    {
+        ITensorPack pack{{TensorType::ACL_SRC, _impl->weights}, {TensorType::ACL_DST, &_impl->unpacked_weights}};
+        NEScheduler::get().schedule_op(_impl->unpack_weights.get(), Window::DimY, _impl->unpack_weights->window(),
+                                       pack);
+        _impl->is_unpacked = true;
+    }
+}
+
+void NEDepthwiseConvolutionLayer::release_unpacked_weights()
+{
+    // The convolution marks constant unpacked weights as unused once it has reshaped them
+    if (_impl->unpack_weights != nullptr && _impl->weights->info()->are_values_constant() &&
+        !_impl->unpacked_weights.is_used())
+    {
+        _impl->unpacked_weights.allocator()->free();
+    }
 }
 
 void NEDepthwiseConvolutionLayer::run()
 {
+    unpack_weights();
     switch (_impl->depth_conv_func)
     {
         case DepthwiseConvolutionFunction::OPTIMIZED:
@@ -388,10 +443,12 @@ void NEDepthwiseConvolutionLayer::run()
         default:
             ARM_COMPUTE_ERROR("DepthwiseConvolutionFunction not properly configured");
     }
+    release_unpacked_weights();
 }
 
 void NEDepthwiseConvolutionLayer::prepare()
 {
+    unpack_weights();
     switch (_impl->depth_conv_func)
     {
         case DepthwiseConvolutionFunction::OPTIMIZED:
@@ -403,5 +460,6 @@ void NEDepthwiseConvolutionLayer::prepare()
         default:
             ARM_COMPUTE_ERROR("DepthwiseConvolutionFunction not properly configured");
     }
+    release_unpacked_weights();
 }
 } // namespace arm_compute
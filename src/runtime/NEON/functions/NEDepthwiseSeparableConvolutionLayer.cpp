@@ -0,0 +1,598 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseSeparableConvolutionLayer.h"
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/SubTensor.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuDepthwiseConv2dAssemblyDispatch.h"
+#include "src/cpu/operators/CpuGemmDirectConv2d.h"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace arm_compute
+{
+using namespace arm_compute::experimental;
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+/** Index of the height dimension of the NHWC tensors */
+constexpr size_t idx_height = 2;
+
+/** Rows of the depthwise output computed by a band and input rows it reads */
+struct BandGeometry
+{
+    unsigned int  out_start{0}; /**< First depthwise output row computed by the band */
+    unsigned int  out_rows{0};  /**< Depthwise output rows computed by the band */
+    unsigned int  in_start{0};  /**< First input row read by the band */
+    unsigned int  in_rows{0};   /**< Input rows read by the band */
+    PadStrideInfo pad_stride{}; /**< Padding and strides of the depthwise convolution of the band */
+};
+
+/** Returns true if two bands can be computed by the same depthwise convolution */
+bool is_same_geometry(const BandGeometry &a, const BandGeometry &b)
+{
+    return a.out_rows == b.out_rows && a.in_rows == b.in_rows && a.pad_stride.pad_top() == b.pad_stride.pad_top() &&
+           a.pad_stride.pad_bottom() == b.pad_stride.pad_bottom();
+}
+
+/** Splits the depthwise output in bands of rows
+ *
+ * Half of the L2 cache is left to the depthwise output of a band, the rest holds the pointwise weights and the input
+ * rows read by the depthwise convolution. Each band reads the input rows in place: the rows past the input borders
+ * become the top and bottom padding of the band. Only the first and last bands are padded, so that the inner bands
+ * share the same depthwise convolution.
+ *
+ * @param[in] input           Input of the depthwise convolution
+ * @param[in] weights         Weights of the depthwise convolution
+ * @param[in] conv_info       Depthwise convolution descriptor
+ * @param[in] computes_inputs True if the input rows of each band are computed by the band, which then share the half
+ *                            of the L2 cache with its depthwise output
+ *
+ * @return The geometry of the bands, in order
+ */
+std::vector<BandGeometry> compute_band_geometry(const ITensorInfo     &input,
+                                                const ITensorInfo     &weights,
+                                                const ConvolutionInfo &conv_info,
+                                                bool                   computes_inputs)
+{
+    const TensorShape    dw_shape    = compute_depthwise_convolution_shape(input, weights, conv_info);
+    const PadStrideInfo &pad_stride  = conv_info.pad_stride_info;
+    const unsigned int   out_height  = dw_shape[idx_height];
+    const int            in_height   = static_cast<int>(input.dimension(idx_height));
+    const int            stride_y    = static_cast<int>(pad_stride.stride().second);
+    const int            kernel_span = (static_cast<int>(weights.dimension(idx_height)) - 1) *
+                                        static_cast<int>(conv_info.dilation.y()) +
+                                    1;
+    const size_t dw_row_size = dw_shape.total_size() / std::max(out_height, 1U) * input.element_size();
+    const size_t in_row_size =
+        computes_inputs ? input.tensor_shape().total_size() / std::max(in_height, 1) * input.element_size() : 0U;
+    // The input rows of a band grow by the stride for each depthwise output row
+    const size_t row_size  = dw_row_size + static_cast<size_t>(stride_y) * in_row_size;
+    const size_t band_rows = CPUInfo::get().get_L2_cache_size() / 2 / std::max<size_t>(row_size, 1);
+    const unsigned int rows = std::max(1U, static_cast<unsigned int>(std::min<size_t>(band_rows, out_height)));
+
+    std::vector<BandGeometry> bands{};
+    for (unsigned int out_start = 0; out_start < out_height; out_start += rows)
+    {
+        const unsigned int out_end   = std::min(out_start + rows, out_height);
+        const int          in_start  = static_cast<int>(out_start) * stride_y - static_cast<int>(pad_stride.pad_top());
+        const int          in_end    = static_cast<int>(out_end - 1) * stride_y -
+                                static_cast<int>(pad_stride.pad_top()) + kernel_span;
+        const int          valid_start = std::max(in_start, 0);
+        const int          valid_end   = std::min(in_end, in_height);
+
+        BandGeometry band{};
+        band.out_start  = out_start;
+        band.out_rows   = out_end - out_start;
+        band.in_start   = static_cast<unsigned int>(valid_start);
+        band.in_rows    = static_cast<unsigned int>(std::max(valid_end - valid_start, 0));
+        band.pad_stride = PadStrideInfo(pad_stride.stride().first, pad_stride.stride().second, pad_stride.pad_left(),
+                                        pad_stride.pad_right(), valid_start - in_start, in_end - valid_end,
+                                        DimensionRoundingType::FLOOR);
+        bands.emplace_back(band);
+    }
+    return bands;
+}
+
+/** Returns the shape of @p shape restricted to @p rows rows */
+TensorShape band_shape(const TensorShape &shape, unsigned int rows)
+{
+    return TensorShape(shape).set(idx_height, rows);
+}
+
+/** Returns the info of the output of a pointwise convolution of @p input */
+TensorInfo pointwise_output_info(const ITensorInfo &input, const ITensorInfo &weights, const Conv2dInfo &info)
+{
+    const TensorShape shape = compute_deep_convolution_shape(input, weights, info.conv_info);
+    return TensorInfo(input.clone()->set_tensor_shape(shape).reset_padding());
+}
+
+/** Checks the restrictions of the pointwise convolutions computed on bands of rows */
+Status validate_pointwise(const ITensorInfo *weights, const Conv2dInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.accumulate, "Accumulation is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(1) != 1 || weights->dimension(2) != 1 ||
+                                        info.conv_info.stride() != std::make_pair(1U, 1U) ||
+                                        info.conv_info.has_padding(),
+                                    "Only 1x1 pointwise convolutions of stride 1 without padding are supported");
+    return Status{};
+}
+
+Status validate_arguments(const ITensorInfo     *input,
+                          const ITensorInfo     *expansion_weights,
+                          const ITensorInfo     *expansion_biases,
+                          const ITensorInfo     *depthwise_weights,
+                          const ITensorInfo     *depthwise_biases,
+                          const ITensorInfo     *pointwise_weights,
+                          const ITensorInfo     *pointwise_biases,
+                          const ITensorInfo     *output,
+                          const Conv2dInfo      &expansion_info,
+                          const ConvolutionInfo &depthwise_info,
+                          const Conv2dInfo      &pointwise_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, depthwise_weights, pointwise_weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, depthwise_weights, pointwise_weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_layout() != DataLayout::NHWC, "Data layout supported is NHWC");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(depthwise_info.act_info.enabled() &&
+                                        !cpu::CpuDepthwiseConv2dAssemblyDispatch::is_activation_supported(
+                                            depthwise_info.act_info),
+                                    "The depthwise activation must be fused by the assembly kernels");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_pointwise(pointwise_weights, pointwise_info));
+
+    // The depthwise convolution reads the result of the expansion convolution, if any
+    TensorInfo dw_input(*input);
+    if (expansion_weights != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, expansion_weights);
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_pointwise(expansion_weights, expansion_info));
+        dw_input = pointwise_output_info(*input, *expansion_weights, expansion_info);
+    }
+
+    // A band is never entirely in the padding
+    const PadStrideInfo &pad_stride  = depthwise_info.pad_stride_info;
+    const unsigned int   kernel_span = (depthwise_weights->dimension(idx_height) - 1) * depthwise_info.dilation.y() + 1;
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(pad_stride.pad_top() >= kernel_span || pad_stride.pad_bottom() >= kernel_span,
+                                    "The depthwise padding must be smaller than the kernel");
+
+    const TensorInfo dw_output = dw_input.clone()
+                                     ->set_tensor_shape(compute_depthwise_convolution_shape(
+                                         dw_input, *depthwise_weights, depthwise_info))
+                                     .reset_padding();
+    const TensorShape output_shape =
+        compute_deep_convolution_shape(dw_output, *pointwise_weights, pointwise_info.conv_info);
+
+    if (output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
+    }
+
+    const std::vector<BandGeometry> bands =
+        compute_band_geometry(dw_input, *depthwise_weights, depthwise_info, expansion_weights != nullptr);
+    for (size_t b = 0; b < bands.size(); ++b)
+    {
+        const BandGeometry &band = bands[b];
+        if (b > 0 && is_same_geometry(band, bands[b - 1]))
+        {
+            continue;
+        }
+        const TensorInfo band_input =
+            dw_input.clone()->set_tensor_shape(band_shape(dw_input.tensor_shape(), band.in_rows));
+        const TensorInfo band_mid =
+            dw_output.clone()->set_tensor_shape(band_shape(dw_output.tensor_shape(), band.out_rows));
+        const TensorInfo band_output =
+            dw_output.clone()->set_tensor_shape(band_shape(output_shape, band.out_rows));
+        const ConvolutionInfo band_info{band.pad_stride, depthwise_info.depth_multiplier, depthwise_info.act_info,
+                                        depthwise_info.dilation};
+        if (expansion_weights != nullptr)
+        {
+            const TensorInfo band_src =
+                input->clone()->set_tensor_shape(band_shape(input->tensor_shape(), band.in_rows));
+            ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuGemmDirectConv2d::validate(&band_src, expansion_weights,
+                                                                           expansion_biases, &band_input,
+                                                                           expansion_info));
+        }
+        ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuDepthwiseConv2dAssemblyDispatch::validate(
+            &band_input, depthwise_weights, depthwise_biases, &band_mid, band_info));
+        ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuGemmDirectConv2d::validate(&band_mid, pointwise_weights, pointwise_biases,
+                                                                       &band_output, pointwise_info));
+    }
+
+    return Status{};
+}
+} // namespace
+
+struct NEDepthwiseSeparableConvolutionLayer::Impl
+{
+    /** Depthwise convolution shared by the bands with the same geometry */
+    struct DepthwiseConv
+    {
+        std::unique_ptr<cpu::CpuDepthwiseConv2dAssemblyDispatch> op{nullptr};
+        Tensor                                                   workspace{};      /**< Working space of the kernels */
+        Tensor                                                   packed_weights{}; /**< Packed weights and biases */
+    };
+
+    /** Pointwise convolution of the bands with the same number of rows */
+    struct PointwiseConv
+    {
+        std::unique_ptr<cpu::CpuGemmDirectConv2d> op{nullptr};
+        ITensorPack                               run_pack{};
+        ITensorPack                               prep_pack{};
+        WorkspaceData<Tensor>                     workspace{};
+        MemoryRequirements                        aux_mem_req{};
+    };
+
+    /** Tensors read and written by a band */
+    struct Band
+    {
+        std::unique_ptr<SubTensor> src{nullptr};     /**< Input rows read by the band */
+        std::unique_ptr<SubTensor> dst{nullptr};     /**< Output rows written by the pointwise convolution */
+        size_t                     depthwise{0};     /**< Index of the depthwise convolution of the band */
+        size_t                     expansion{0};     /**< Index of the expansion convolution of the band, if any */
+        bool                       is_tail{false};   /**< Last band, computing fewer rows than the others */
+    };
+
+    const ITensor                          *depthwise_weights{nullptr};
+    const ITensor                          *depthwise_biases{nullptr};
+    const ITensor                          *pointwise_weights{nullptr};
+    const ITensor                          *expansion_weights{nullptr};
+    std::vector<DepthwiseConv>              depthwise{};
+    PointwiseConv                           pointwise{};
+    PointwiseConv                           pointwise_tail{};
+    std::vector<PointwiseConv>              expansion{};      /**< Expansion convolution of each input row count */
+    std::vector<std::unique_ptr<SubTensor>> expanded_views{}; /**< Expanded rows written by each expansion */
+    std::vector<Band>                       bands{};
+    Tensor                                  mid{};
+    std::unique_ptr<SubTensor>              mid_tail{nullptr};
+    Tensor                                  expanded{};
+    MemoryGroup                             memory_group{};
+    bool                                    is_prepared{false};
+};
+
+NEDepthwiseSeparableConvolutionLayer::NEDepthwiseSeparableConvolutionLayer(
+    std::shared_ptr<IMemoryManager> memory_manager)
+    : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+
+NEDepthwiseSeparableConvolutionLayer::~NEDepthwiseSeparableConvolutionLayer() = default;
+
+void NEDepthwiseSeparableConvolutionLayer::configure(ITensor               *input,
+                                                     const ITensor         *depthwise_weights,
+                                                     const ITensor         *depthwise_biases,
+                                                     const ITensor         *pointwise_weights,
+                                                     const ITensor         *pointwise_biases,
+                                                     ITensor               *output,
+                                                     const ConvolutionInfo &depthwise_info,
+                                                     const Conv2dInfo      &pointwise_info)
+{
+    configure(input, nullptr, nullptr, depthwise_weights, depthwise_biases, pointwise_weights, pointwise_biases, output,
+              Conv2dInfo(), depthwise_info, pointwise_info);
+}
+
+void NEDepthwiseSeparableConvolutionLayer::configure(ITensor               *input,
+                                                     const ITensor         *expansion_weights,
+                                                     const ITensor         *expansion_biases,
+                                                     const ITensor         *depthwise_weights,
+                                                     const ITensor         *depthwise_biases,
+                                                     const ITensor         *pointwise_weights,
+                                                     const ITensor         *pointwise_biases,
+                                                     ITensor               *output,
+                                                     const Conv2dInfo      &expansion_info,
+                                                     const ConvolutionInfo &depthwise_info,
+                                                     const Conv2dInfo      &pointwise_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, depthwise_weights, pointwise_weights, output);
+    ARM_COMPUTE_LOG_PARAMS(input, expansion_weights, expansion_biases, depthwise_weights, depthwise_biases,
+                           pointwise_weights, pointwise_biases, output, expansion_info, depthwise_info,
+                           pointwise_info);
+
+    const bool has_expansion = expansion_weights != nullptr;
+
+    // Output auto initialization if not yet initialized
+    const TensorInfo dw_input  = has_expansion
+                                     ? pointwise_output_info(*input->info(), *expansion_weights->info(), expansion_info)
+                                     : TensorInfo(*input->info());
+    const TensorInfo dw_output = dw_input.clone()
+                                     ->set_tensor_shape(compute_depthwise_convolution_shape(
+                                         dw_input, *depthwise_weights->info(), depthwise_info))
+                                     .reset_padding();
+    auto_init_if_empty(*output->info(),
+                       dw_output.clone()->set_tensor_shape(compute_deep_convolution_shape(
+                           dw_output, *pointwise_weights->info(), pointwise_info.conv_info)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(NEDepthwiseSeparableConvolutionLayer::validate(
+        input->info(), has_expansion ? expansion_weights->info() : nullptr,
+        expansion_biases != nullptr ? expansion_biases->info() : nullptr, depthwise_weights->info(),
+        depthwise_biases != nullptr ? depthwise_biases->info() : nullptr, pointwise_weights->info(),
+        pointwise_biases != nullptr ? pointwise_biases->info() : nullptr, output->info(), expansion_info,
+        depthwise_info, pointwise_info));
+
+    const std::vector<BandGeometry> geometry =
+        compute_band_geometry(dw_input, *depthwise_weights->info(), depthwise_info, has_expansion);
+    const TensorShape  input_shape  = input->info()->tensor_shape();
+    const TensorShape  output_shape = output->info()->tensor_shape();
+    const unsigned int rows         = geometry.front().out_rows;
+
+    _impl->depthwise_weights = depthwise_weights;
+    _impl->depthwise_biases  = depthwise_biases;
+    _impl->pointwise_weights = pointwise_weights;
+    _impl->expansion_weights = expansion_weights;
+    _impl->is_prepared       = false;
+    _impl->depthwise.clear();
+    _impl->expansion.clear();
+    _impl->expanded_views.clear();
+    _impl->bands.clear();
+
+    // The depthwise output of a band is consumed by the pointwise convolution before the next band is computed
+    _impl->mid.allocator()->init(dw_output.clone()->set_tensor_shape(band_shape(dw_output.tensor_shape(), rows)));
+    _impl->memory_group.manage(&_impl->mid);
+
+    const BandGeometry &last = geometry.back();
+    if (last.out_rows < rows)
+    {
+        _impl->mid_tail = std::make_unique<SubTensor>(
+            &_impl->mid, band_shape(dw_output.tensor_shape(), last.out_rows), Coordinates());
+    }
+
+    // Likewise, the expanded rows of a band are consumed by its depthwise convolution
+    std::map<unsigned int, size_t> expansion_index{};
+    if (has_expansion)
+    {
+        const auto max_band = std::max_element(geometry.begin(), geometry.end(),
+                                               [](const BandGeometry &a, const BandGeometry &b)
+                                               { return a.in_rows < b.in_rows; });
+        _impl->expanded.allocator()->init(
+            dw_input.clone()->set_tensor_shape(band_shape(dw_input.tensor_shape(), max_band->in_rows)));
+        _impl->memory_group.manage(&_impl->expanded);
+    }
+
+    // Configure the pointwise convolutions of the bands
+    const auto configure_pointwise = [&](Impl::PointwiseConv &pw, ITensor *src, const ITensor *dst,
+                                         const ITensor *weights, const ITensor *biases, const Conv2dInfo &info)
+    {
+        pw.op = std::make_unique<cpu::CpuGemmDirectConv2d>();
+        pw.op->configure(src->info(), weights->info(), biases != nullptr ? biases->info() : nullptr, dst->info(),
+                         info);
+        pw.aux_mem_req = pw.op->workspace();
+        pw.run_pack    = {{TensorType::ACL_SRC_0, src}, {TensorType::ACL_SRC_2, biases}};
+        pw.prep_pack   = {{TensorType::ACL_SRC_1, weights}, {TensorType::ACL_SRC_2, biases}};
+        pw.workspace   = manage_workspace<Tensor>(pw.aux_mem_req, _impl->memory_group, pw.run_pack, pw.prep_pack,
+                                                  /* allocate_now */ false);
+    };
+
+    for (size_t b = 0; b < geometry.size(); ++b)
+    {
+        const BandGeometry &band_geometry = geometry[b];
+
+        Impl::Band band{};
+        band.is_tail = band_geometry.out_rows < rows;
+        band.src     = std::make_unique<SubTensor>(input, band_shape(input_shape, band_geometry.in_rows),
+                                                   Coordinates(0, 0, band_geometry.in_start));
+        band.dst     = std::make_unique<SubTensor>(output, band_shape(output_shape, band_geometry.out_rows),
+                                                   Coordinates(0, 0, band_geometry.out_start));
+
+        // Bands reading the same number of input rows share the expansion convolution and the view of its output
+        ITensor *dw_src = band.src.get();
+        if (has_expansion)
+        {
+            auto it = expansion_index.find(band_geometry.in_rows);
+            if (it == expansion_index.end())
+            {
+                _impl->expanded_views.emplace_back(std::make_unique<SubTensor>(
+                    &_impl->expanded, band_shape(dw_input.tensor_shape(), band_geometry.in_rows), Coordinates()));
+                _impl->expansion.emplace_back();
+                configure_pointwise(_impl->expansion.back(), band.src.get(), _impl->expanded_views.back().get(),
+                                    expansion_weights, expansion_biases, expansion_info);
+                it = expansion_index.emplace(band_geometry.in_rows, _impl->expansion.size() - 1).first;
+            }
+            band.expansion = it->second;
+            dw_src         = _impl->expanded_views[band.expansion].get();
+        }
+
+        // Bands with the same geometry share the depthwise convolution and its packed weights
+        if (b == 0 || !is_same_geometry(band_geometry, geometry[b - 1]))
+        {
+            const ConvolutionInfo band_info{band_geometry.pad_stride, depthwise_info.depth_multiplier,
+                                            depthwise_info.act_info, depthwise_info.dilation};
+            ITensor *mid = band.is_tail ? static_cast<ITensor *>(_impl->mid_tail.get()) : &_impl->mid;
+
+            Impl::DepthwiseConv dw{};
+            dw.op = std::make_unique<cpu::CpuDepthwiseConv2dAssemblyDispatch>();
+            dw.op->configure(dw_src->info(), depthwise_weights->info(),
+                             depthwise_biases != nullptr ? depthwise_biases->info() : nullptr, mid->info(), band_info);
+
+            const MemoryRequirements mem_req = dw.op->workspace();
+            dw.workspace.allocator()->init(
+                TensorInfo(TensorShape{mem_req[0].size + mem_req[0].alignment}, 1, DataType::S8), mem_req[0].alignment);
+            dw.packed_weights.allocator()->init(
+                TensorInfo(TensorShape{mem_req[1].size + mem_req[1].alignment}, 1, DataType::S8), mem_req[1].alignment);
+            _impl->depthwise.emplace_back(std::move(dw));
+        }
+        band.depthwise = _impl->depthwise.size() - 1;
+
+        _impl->bands.emplace_back(std::move(band));
+    }
+
+    configure_pointwise(_impl->pointwise, &_impl->mid, _impl->bands.front().dst.get(), pointwise_weights,
+                        pointwise_biases, pointwise_info);
+    if (_impl->bands.back().is_tail)
+    {
+        configure_pointwise(_impl->pointwise_tail, _impl->mid_tail.get(), _impl->bands.back().dst.get(),
+                            pointwise_weights, pointwise_biases, pointwise_info);
+    }
+
+    _impl->mid.allocator()->allocate();
+    if (has_expansion)
+    {
+        _impl->expanded.allocator()->allocate();
+    }
+    for (auto &dw : _impl->depthwise)
+    {
+        _impl->memory_group.manage(&dw.workspace);
+        dw.workspace.allocator()->allocate();
+    }
+}
+
+Status NEDepthwiseSeparableConvolutionLayer::validate(const ITensorInfo     *input,
+                                                      const ITensorInfo     *depthwise_weights,
+                                                      const ITensorInfo     *depthwise_biases,
+                                                      const ITensorInfo     *pointwise_weights,
+                                                      const ITensorInfo     *pointwise_biases,
+                                                      const ITensorInfo     *output,
+                                                      const ConvolutionInfo &depthwise_info,
+                                                      const Conv2dInfo      &pointwise_info)
+{
+    return validate(input, nullptr, nullptr, depthwise_weights, depthwise_biases, pointwise_weights, pointwise_biases,
+                    output, Conv2dInfo(), depthwise_info, pointwise_info);
+}
+
+Status NEDepthwiseSeparableConvolutionLayer::validate(const ITensorInfo     *input,
+                                                      const ITensorInfo     *expansion_weights,
+                                                      const ITensorInfo     *expansion_biases,
+                                                      const ITensorInfo     *depthwise_weights,
+                                                      const ITensorInfo     *depthwise_biases,
+                                                      const ITensorInfo     *pointwise_weights,
+                                                      const ITensorInfo     *pointwise_biases,
+                                                      const ITensorInfo     *output,
+                                                      const Conv2dInfo      &expansion_info,
+                                                      const ConvolutionInfo &depthwise_info,
+                                                      const Conv2dInfo      &pointwise_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, expansion_weights, expansion_biases, depthwise_weights,
+                                              depthwise_biases, pointwise_weights, pointwise_biases, output);
+    return validate_arguments(input, expansion_weights, expansion_biases, depthwise_weights, depthwise_biases,
+                              pointwise_weights, pointwise_biases, output, expansion_info, depthwise_info,
+                              pointwise_info);
+}
+
+void NEDepthwiseSeparableConvolutionLayer::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    for (auto &band : _impl->bands)
+    {
+        Impl::DepthwiseConv &dw  = _impl->depthwise[band.depthwise];
+        Impl::PointwiseConv &pw  = band.is_tail ? _impl->pointwise_tail : _impl->pointwise;
+        ITensor             *mid = band.is_tail ? static_cast<ITensor *>(_impl->mid_tail.get()) : &_impl->mid;
+
+        // Compute the expanded rows of the band again, halo included
+        ITensor *dw_src = band.src.get();
+        if (!_impl->expansion.empty())
+        {
+            Impl::PointwiseConv &ex = _impl->expansion[band.expansion];
+            dw_src                  = _impl->expanded_views[band.expansion].get();
+            ex.run_pack.add_tensor(TensorType::ACL_SRC_0, band.src.get());
+            ex.run_pack.add_tensor(TensorType::ACL_DST, dw_src);
+            ex.op->run(ex.run_pack);
+        }
+
+        ITensorPack dw_pack{{TensorType::ACL_SRC_0, dw_src},
+                            {TensorType::ACL_SRC_1, _impl->depthwise_weights},
+                            {TensorType::ACL_SRC_2, _impl->depthwise_biases},
+                            {TensorType::ACL_DST, mid},
+                            {TensorType::ACL_INT_0, &dw.workspace},
+                            {TensorType::ACL_INT_1, &dw.packed_weights}};
+        dw.op->run(dw_pack);
+
+        pw.run_pack.add_tensor(TensorType::ACL_DST, band.dst.get());
+        pw.op->run(pw.run_pack);
+    }
+}
+
+void NEDepthwiseSeparableConvolutionLayer::prepare()
+{
+    if (!_impl->is_prepared)
+    {
+        // Pack the depthwise weights of every band geometry before they are marked as unused
+        for (auto &dw : _impl->depthwise)
+        {
+            dw.packed_weights.allocator()->allocate();
+            ITensorPack prep_pack{{TensorType::ACL_SRC_1, _impl->depthwise_weights},
+                                  {TensorType::ACL_SRC_2, _impl->depthwise_biases},
+                                  {TensorType::ACL_INT_1, &dw.packed_weights}};
+            dw.op->prepare(prep_pack);
+        }
+
+        // Returns true if the weights of the pointwise convolution are reshaped
+        const auto prepare_pointwise = [](Impl::PointwiseConv &pw, const ITensor *weights) -> bool
+        {
+            allocate_tensors(pw.aux_mem_req, pw.workspace);
+            pw.op->prepare(pw.prep_pack);
+            const bool has_reshape = std::any_of(pw.aux_mem_req.begin(), pw.aux_mem_req.end(),
+                                                 [](const MemoryInfo &m) -> bool
+                                                 { return m.lifetime == MemoryLifetime::Persistent; });
+            if (!has_reshape)
+            {
+                pw.run_pack.add_const_tensor(ACL_SRC_1, weights);
+            }
+
+            // Release temporary tensors that are only used in prepare stage
+            release_temporaries<Tensor>(pw.aux_mem_req, pw.workspace);
+            return has_reshape;
+        };
+
+        bool has_reshape = false;
+        for (Impl::PointwiseConv *pw : {&_impl->pointwise, &_impl->pointwise_tail})
+        {
+            if (pw->op != nullptr)
+            {
+                has_reshape = prepare_pointwise(*pw, _impl->pointwise_weights);
+            }
+        }
+        if (has_reshape)
+        {
+            _impl->pointwise_weights->mark_as_unused();
+        }
+
+        bool has_expansion_reshape = false;
+        for (auto &ex : _impl->expansion)
+        {
+            has_expansion_reshape = prepare_pointwise(ex, _impl->expansion_weights);
+        }
+        if (has_expansion_reshape)
+        {
+            _impl->expansion_weights->mark_as_unused();
+        }
+        _impl->is_prepared = true;
+    }
+}
+} // namespace arm_compute
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEEmbeddingBag.h"
+
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/operators/CpuEmbeddingBag.h"
+
+namespace arm_compute
+{
+struct NEEmbeddingBag::Impl
+{
+    const ITensor                        *table{nullptr};
+    const ITensor                        *indices{nullptr};
+    const ITensor                        *offsets{nullptr};
+    const ITensor                        *weights{nullptr};
+    ITensor                              *output{nullptr};
+    std::unique_ptr<cpu::CpuEmbeddingBag> op{nullptr};
+};
+
+NEEmbeddingBag::NEEmbeddingBag() : _impl(std::make_unique<Impl>())
+{
+}
+
+NEEmbeddingBag::~NEEmbeddingBag() = default;
+
+void NEEmbeddingBag::configure(const ITensor     *table,
+                               const ITensor     *indices,
+                               const ITensor     *offsets,
+                               const ITensor     *weights,
+                               ITensor           *output,
+                               ReductionOperation op)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(table, indices, offsets, output);
+
+    _impl->table   = table;
+    _impl->indices = indices;
+    _impl->offsets = offsets;
+    _impl->weights = weights;
+    _impl->output  = output;
+    _impl->op      = std::make_unique<cpu::CpuEmbeddingBag>();
+    _impl->op->configure(table->info(), indices->info(), offsets->info(),
+                         weights != nullptr ? weights->info() : nullptr, output->info(), op);
+}
+
+Status NEEmbeddingBag::validate(const ITensorInfo *table,
+                                const ITensorInfo *indices,
+                                const ITensorInfo *offsets,
+                                const ITensorInfo *weights,
+                                const ITensorInfo *output,
+                                ReductionOperation op)
+{
+    return cpu::CpuEmbeddingBag::validate(table, indices, offsets, weights, output, op);
+}
+
+void NEEmbeddingBag::run()
+{
+    ITensorPack pack;
+    pack.add_const_tensor(TensorType::ACL_SRC_0, _impl->table);
+    pack.add_const_tensor(TensorType::ACL_SRC_1, _impl->indices);
+    pack.add_const_tensor(TensorType::ACL_SRC_2, _impl->offsets);
+    pack.add_const_tensor(TensorType::ACL_SRC_3, _impl->weights);
+    pack.add_tensor(TensorType::ACL_DST, _impl->output);
+    _impl->op->run(pack);
+}
+} // namespace arm_compute
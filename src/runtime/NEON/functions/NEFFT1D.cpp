@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024 Arm Limited.
+ * Copyright (c) 2019-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,8 +33,31 @@
 #include "src/core/NEON/kernels/NEFFTScaleKernel.h"
 #include "src/core/utils/helpers/fft.h"
 
+#include <initializer_list>
+
 namespace arm_compute
 {
+namespace
+{
+/** Returns the dimension of @p window with the most iterations out of @p candidates
+ *
+ * The FFT of a row or column is computed by a single thread, so the work is split along the dimension giving the
+ * most rows or columns to share between the threads.
+ */
+size_t split_dimension(const Window &window, std::initializer_list<size_t> candidates)
+{
+    size_t split = *candidates.begin();
+    for (size_t dim : candidates)
+    {
+        if (window.num_iterations(dim) > window.num_iterations(split))
+        {
+            split = dim;
+        }
+    }
+    return split;
+}
+} // namespace
+
 NEFFT1D::~NEFFT1D() = default;
 
 NEFFT1D::NEFFT1D(std::shared_ptr<IMemoryManager> memory_manager)
@@ -150,17 +173,22 @@ void NEFFT1D::run()
 {
     MemoryGroupResourceScope scope_mg(_memory_group);
 
-    NEScheduler::get().schedule(_digit_reverse_kernel.get(), (_axis == 0 ? Window::DimY : Window::DimZ));
+    NEScheduler::get().schedule(_digit_reverse_kernel.get(),
+                                split_dimension(_digit_reverse_kernel->window(), {Window::DimY, Window::DimZ}));
 
     for (unsigned int i = 0; i < _num_ffts; ++i)
     {
-        NEScheduler::get().schedule(_fft_kernels[i].get(), (_axis == 0 ? Window::DimY : Window::DimX));
+        const Window &win = _fft_kernels[i]->window();
+        NEScheduler::get().schedule(_fft_kernels[i].get(), _axis == 0
+                                                               ? split_dimension(win, {Window::DimY, Window::DimZ})
+                                                               : split_dimension(win, {Window::DimX, Window::DimZ}));
     }
 
     // Run output scaling
     if (_run_scale)
     {
-        NEScheduler::get().schedule(_scale_kernel.get(), Window::DimY);
+        NEScheduler::get().schedule(_scale_kernel.get(),
+                                    split_dimension(_scale_kernel->window(), {Window::DimY, Window::DimZ}));
     }
 }
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
 
 #include "arm_compute/core/ITensorPack.h"
@@ -72,9 +73,10 @@ void NEFullyConnectedLayer::configure(const ITensor          *input,
 {
     // Perform validate step
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_ERROR_THROW_ON(NEFullyConnectedLayer::validate(input->info(), weights->info(),
-                                                               biases != nullptr ? biases->info() : nullptr,
-                                                               output->info(), fc_info, weights_info));
+    ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(NEFullyConnectedLayer::validate(input->info(), weights->info(),
+                                                                         biases != nullptr ? biases->info() : nullptr,
+                                                                         output->info(), fc_info, weights_info));
+    const TrustedConfigureScope trusted_configure{};
     ARM_COMPUTE_LOG_PARAMS(input, weights, biases, output, fc_info);
 
     _impl->op               = std::make_unique<cpu::CpuFullyConnected>();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
 
 #include "arm_compute/core/ITensorPack.h"
@@ -123,14 +124,15 @@ void NEGEMM::configure(const ITensor  *a,
 
     if (_impl->is_dynamic)
     {
-        ARM_COMPUTE_ERROR_THROW_ON(cpu::CpuDynamicGemm::validate(
+        ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(cpu::CpuDynamicGemm::validate(
             a->info(), b->info(), (c != nullptr) ? c->info() : nullptr, d->info(), alpha, beta, gemm_info));
     }
     else
     {
-        ARM_COMPUTE_ERROR_THROW_ON(cpu::CpuGemm::validate(a->info(), b->info(), (c != nullptr) ? c->info() : nullptr,
-                                                          d->info(), alpha, beta, gemm_info));
+        ARM_COMPUTE_ERROR_THROW_ON_UNTRUSTED(cpu::CpuGemm::validate(
+            a->info(), b->info(), (c != nullptr) ? c->info() : nullptr, d->info(), alpha, beta, gemm_info));
     }
+    const TrustedConfigureScope trusted_configure{};
 
     // Check if we need to reshape the matrix B only on the first run
     _impl->is_prepared = false;
@@ -196,6 +198,28 @@ Status NEGEMM::has_opt_impl(arm_compute::WeightFormat &expected_weight_format,
     return cpu::CpuGemm::has_opt_impl(expected_weight_format, a, b, c, output, gemm_info);
 }
 
+Status NEGEMM::export_pretransposed_weights(std::vector<uint8_t> &blob)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_impl->op == nullptr, "The function is not configured");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_impl->is_dynamic, "Dynamic shapes do not pretranspose the weights");
+
+    prepare();
+    return static_cast<const cpu::CpuGemm *>(_impl->op.get())->export_pretransposed_weights(_impl->run_pack, blob);
+}
+
+Status NEGEMM::import_pretransposed_weights(const std::vector<uint8_t> &blob)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_impl->op == nullptr, "The function is not configured");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_impl->is_dynamic, "Dynamic shapes do not pretranspose the weights");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(_impl->is_prepared, "The weights must be imported before the first run");
+
+    ARM_COMPUTE_RETURN_ON_ERROR(static_cast<cpu::CpuGemm *>(_impl->op.get())->import_pretransposed_weights(blob));
+
+    // The persistent workspace of the pretransposed weights is no longer requested, it won't be allocated
+    _impl->aux_mem_req = _impl->op->workspace();
+    return Status{};
+}
+
 void NEGEMM::run()
 {
     prepare();
@@ -204,6 +228,26 @@ void NEGEMM::run()
     _impl->op->run(_impl->run_pack);
 }
 
+void NEGEMM::configure_workspace(experimental::RunWorkspace &workspace) const
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_impl->op == nullptr, "The function is not configured");
+    workspace.configure(_impl->aux_mem_req);
+}
+
+void NEGEMM::run(const ITensor *a, ITensor *d, experimental::RunWorkspace &workspace) const
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, d);
+    ARM_COMPUTE_ERROR_ON_MSG(!_impl->is_prepared, "The function must be prepared first");
+    ARM_COMPUTE_ERROR_ON_MSG(_impl->is_dynamic, "Dynamic shapes do not support runs with a caller-owned workspace");
+
+    // The pack of run() refers to the prepared weights, only the operands and the temporaries differ per call
+    ITensorPack pack = _impl->run_pack;
+    pack.add_const_tensor(ACL_SRC_0, a);
+    pack.add_tensor(ACL_DST, d);
+    workspace.add_to_pack(pack);
+    _impl->op->run(pack);
+}
+
 void NEGEMM::prepare()
 {
     if (_impl->is_dynamic)
@@ -234,4 +278,15 @@ void NEGEMM::prepare()
         _impl->is_prepared = true;
     }
 }
+
+OperatorDescription NEGEMM::describe() const
+{
+    OperatorDescription desc{};
+    desc.name = "NEGEMM";
+    if (_impl->op != nullptr)
+    {
+        desc.children.emplace_back(_impl->op->describe());
+    }
+    return desc;
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -139,4 +139,15 @@ void NEGEMMConvolutionLayer::prepare()
         _impl->is_prepared = true;
     }
 }
+
+OperatorDescription NEGEMMConvolutionLayer::describe() const
+{
+    OperatorDescription desc{};
+    desc.name = "NEGEMMConvolutionLayer";
+    if (_impl->op != nullptr)
+    {
+        desc.children.emplace_back(_impl->op->describe());
+    }
+    return desc;
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -180,4 +180,15 @@ void NEGEMMLowpMatrixMultiplyCore::prepare()
         _impl->is_prepared = true;
     }
 }
+
+OperatorDescription NEGEMMLowpMatrixMultiplyCore::describe() const
+{
+    OperatorDescription desc{};
+    desc.name = "NEGEMMLowpMatrixMultiplyCore";
+    if (_impl->op != nullptr)
+    {
+        desc.children.emplace_back(_impl->op->describe());
+    }
+    return desc;
+}
 } // namespace arm_compute
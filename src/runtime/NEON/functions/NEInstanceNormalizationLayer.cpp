@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024 Arm Limited.
+ * Copyright (c) 2019-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,13 +35,7 @@ namespace arm_compute
 NEInstanceNormalizationLayer::~NEInstanceNormalizationLayer() = default;
 
 NEInstanceNormalizationLayer::NEInstanceNormalizationLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)),
-      _normalization_kernel(),
-      _is_nchw(false),
-      _permute_input(),
-      _permute_output(),
-      _permuted_input(),
-      _permuted_output()
+    : _memory_group(std::move(memory_manager)), _normalization_kernel(), _is_nchw(false)
 {
 }
 
@@ -57,26 +51,8 @@ void NEInstanceNormalizationLayer::configure(ITensor *input, ITensor *output, fl
 
     _normalization_kernel = std::make_unique<NEInstanceNormalizationLayerKernel>();
 
-    if (!_is_nchw)
-    {
-        _memory_group.manage(&_permuted_input);
-        _memory_group.manage(&_permuted_output);
-
-        // Configure the function to transform the input tensor from NHWC -> NCHW
-        _permute_input.configure(input, &_permuted_input, PermutationVector(1U, 2U, 0U));
-        _permuted_input.info()->set_data_layout(DataLayout::NCHW);
-
-        _normalization_kernel->configure(&_permuted_input, &_permuted_output, kernel_descriptor);
-        _permuted_output.info()->set_data_layout(DataLayout::NCHW);
-
-        _permute_output.configure(&_permuted_output, output != nullptr ? output : input, PermutationVector(2U, 0U, 1U));
-        _permuted_input.allocator()->allocate();
-        _permuted_output.allocator()->allocate();
-    }
-    else
-    {
-        _normalization_kernel->configure(input, output, kernel_descriptor);
-    }
+    // NHWC tensors are normalized without being permuted, the channels being reduced in blocks along X
+    _normalization_kernel->configure(input, output, kernel_descriptor);
 }
 
 Status NEInstanceNormalizationLayer::validate(
@@ -84,26 +60,11 @@ Status NEInstanceNormalizationLayer::validate(
 {
     ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, output);
     return NEInstanceNormalizationLayerKernel::validate(
-        &input->clone()->set_data_layout(DataLayout::NCHW), &output->clone()->set_data_layout(DataLayout::NCHW),
-        InstanceNormalizationLayerKernelInfo{gamma, beta, epsilon, true});
+        input, output, InstanceNormalizationLayerKernelInfo{gamma, beta, epsilon, true});
 }
 
 void NEInstanceNormalizationLayer::run()
 {
-    MemoryGroupResourceScope scope_mg(_memory_group);
-
-    // Permute input
-    if (!_is_nchw)
-    {
-        _permute_input.run();
-    }
-
-    NEScheduler::get().schedule(_normalization_kernel.get(), Window::DimZ);
-
-    // Permute output
-    if (!_is_nchw)
-    {
-        _permute_output.run();
-    }
+    NEScheduler::get().schedule(_normalization_kernel.get(), _is_nchw ? Window::DimZ : Window::DimX);
 }
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,7 +28,6 @@
 
 #include "src/common/utils/Log.h"
 #include "src/core/NEON/kernels/NEL2NormalizeLayerKernel.h"
-#include "src/core/NEON/kernels/NEReductionOperationKernel.h"
 
 namespace arm_compute
 {
@@ -39,7 +38,7 @@ constexpr int max_input_tensor_dim = 3;
 NEL2NormalizeLayer::~NEL2NormalizeLayer() = default;
 
 NEL2NormalizeLayer::NEL2NormalizeLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _reduce_func(), _normalize_kernel(), _sumsq()
+    : _memory_group(std::move(memory_manager)), _normalize_kernel(), _split_dimension(Window::DimY)
 {
 }
 
@@ -47,48 +46,25 @@ void NEL2NormalizeLayer::configure(ITensor *input, ITensor *output, int axis, fl
 {
     ARM_COMPUTE_LOG_PARAMS(input, output, axis, epsilon);
 
-    // Manage intermediate buffers
-    _memory_group.manage(&_sumsq);
-
-    // Configure Kernels
-    const uint32_t actual_axis = wrap_around(axis, max_input_tensor_dim);
-    _reduce_func.configure(input, &_sumsq, actual_axis, ReductionOperation::SUM_SQUARE);
+    // The square sum is computed by the kernel, so no intermediate tensor is needed
     _normalize_kernel = std::make_unique<NEL2NormalizeLayerKernel>();
-    _normalize_kernel->configure(input, &_sumsq, output, axis, epsilon);
+    _normalize_kernel->configure(input, nullptr, output, axis, epsilon);
 
-    // Allocate intermediate tensors
-    _sumsq.allocator()->allocate();
+    // The kernel window is not split along the reduction axis
+    const uint32_t actual_axis = wrap_around(axis, max_input_tensor_dim);
+    _split_dimension           = actual_axis == Window::DimY ? Window::DimX : Window::DimY;
 }
 
 Status NEL2NormalizeLayer::validate(const ITensorInfo *input, const ITensorInfo *output, int axis, float epsilon)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, output);
-
-    TensorShape shape(input->tensor_shape());
-
-    // Create intermediate tensor info
-    TensorInfo sum_sq;
-    sum_sq.set_data_type(input->data_type());
-    sum_sq.set_tensor_shape(shape);
-
-    const uint32_t actual_axis = wrap_around(axis, max_input_tensor_dim);
-    ARM_COMPUTE_RETURN_ON_ERROR(
-        NEReductionOperation::validate(input, &sum_sq, actual_axis, ReductionOperation::SUM_SQUARE));
-
-    // Reduce shape on axis
-    shape.set(actual_axis, 1);
-    sum_sq.set_tensor_shape(shape);
-
-    ARM_COMPUTE_RETURN_ON_ERROR(NEL2NormalizeLayerKernel::validate(input, &sum_sq, output, axis, epsilon));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEL2NormalizeLayerKernel::validate(input, nullptr, output, axis, epsilon));
 
     return Status{};
 }
 
 void NEL2NormalizeLayer::run()
 {
-    MemoryGroupResourceScope scope_mg(_memory_group);
-
-    _reduce_func.run();
-    NEScheduler::get().schedule(_normalize_kernel.get(), Window::DimY);
+    NEScheduler::get().schedule(_normalize_kernel.get(), _split_dimension);
 }
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, 2024 Arm Limited.
+ * Copyright (c) 2018-2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,14 +29,73 @@
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/common/LSTMParams.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/NEON/kernels/NELSTMCellKernel.h"
 
 namespace arm_compute
 {
 using namespace arm_compute::misc::shape_calculator;
 using namespace arm_compute::utils::info_helpers;
 
+namespace
+{
+/** Gather the tensors read and written by the elementwise part of the fused cell */
+template <typename T, typename TParams>
+LSTMCellArguments<T> lstm_cell_arguments(T                         *gates,
+                                         const T                   *cell_state_in,
+                                         const LSTMParams<TParams> &lstm_params,
+                                         const T                   *forget_gate_bias,
+                                         const T                   *cell_bias,
+                                         const T                   *output_gate_bias,
+                                         T                         *cell_state_out,
+                                         T                         *output_state_out,
+                                         T                         *scratch_buffer)
+{
+    const bool has_input_gate = !lstm_params.has_cifg_opt();
+
+    LSTMCellArguments<T> args{};
+    args.gates         = gates;
+    args.cell_state_in = cell_state_in;
+    if (lstm_params.has_peephole_opt())
+    {
+        args.cell_to_input_weights  = has_input_gate ? lstm_params.cell_to_input_weights() : nullptr;
+        args.cell_to_forget_weights = lstm_params.cell_to_forget_weights();
+        args.cell_to_output_weights = lstm_params.cell_to_output_weights();
+    }
+    // Without layer normalization the biases are added by the gate GEMM
+    if (lstm_params.use_layer_norm())
+    {
+        args.input_layer_norm_weights  = has_input_gate ? lstm_params.input_layer_norm_weights() : nullptr;
+        args.forget_layer_norm_weights = lstm_params.forget_layer_norm_weights();
+        args.cell_layer_norm_weights   = lstm_params.cell_layer_norm_weights();
+        args.output_layer_norm_weights = lstm_params.output_layer_norm_weights();
+        args.input_gate_bias           = has_input_gate ? lstm_params.input_gate_bias() : nullptr;
+        args.forget_gate_bias          = forget_gate_bias;
+        args.cell_bias                 = cell_bias;
+        args.output_gate_bias          = output_gate_bias;
+    }
+    args.cell_state_out   = cell_state_out;
+    args.output_state_out = output_state_out;
+    args.scratch_buffer   = scratch_buffer;
+    return args;
+}
+
+template <typename TParams>
+LSTMCellKernelInfo
+lstm_cell_info(const LSTMParams<TParams> &lstm_params, const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    LSTMCellKernelInfo info{};
+    info.activation_info  = activation_info;
+    info.cell_threshold   = cell_threshold;
+    info.has_cifg_opt     = lstm_params.has_cifg_opt();
+    info.has_peephole_opt = lstm_params.has_peephole_opt();
+    info.use_layer_norm   = lstm_params.use_layer_norm();
+    return info;
+}
+} // namespace
+
 NELSTMLayer::~NELSTMLayer() = default;
 
 NELSTMLayer::NELSTMLayer(std::shared_ptr<IMemoryManager> memory_manager)
@@ -86,6 +145,12 @@ NELSTMLayer::NELSTMLayer(std::shared_ptr<IMemoryManager> memory_manager)
       _mean_std_norm_output_gate(),
       _pixelwise_mul_output_gate_coeff(),
       _accum_output_gate_bias(),
+      _concat_input_weights(),
+      _concat_recurrent_weights(),
+      _concat_gate_weights(),
+      _concat_gate_biases(),
+      _fully_connected_gates(),
+      _lstm_cell_kernel(),
       _input_gate_out1(),
       _input_gate_out2(),
       _input_gate_out3(),
@@ -115,13 +180,19 @@ NELSTMLayer::NELSTMLayer(std::shared_ptr<IMemoryManager> memory_manager)
       _cell_layer_norm_out2(),
       _output_layer_norm_out1(),
       _output_layer_norm_out2(),
+      _input_weights(),
+      _recurrent_weights(),
+      _gate_weights(),
+      _gate_biases(),
+      _gates(),
       _run_peephole_opt(false),
       _run_cifg_opt(false),
       _perform_cell_clipping(false),
       _has_projection_weights(false),
       _perform_projection_clipping(false),
       _is_prepared(false),
-      _is_layer_norm_lstm(false)
+      _is_layer_norm_lstm(false),
+      _is_fused(false)
 {
 }
 
@@ -172,6 +243,106 @@ void NELSTMLayer::configure(const ITensor             *input,
 
     const TensorShape cell_state_shape = cell_state_in->info()->tensor_shape();
 
+    // The four gates can be computed by a single fully connected layer on the concatenated weights, leaving every
+    // elementwise step of the cell to a single kernel. The unfused path below is kept for the other configurations.
+    const DataType     data_type = input->info()->data_type();
+    const unsigned int num_units = cell_state_shape[0];
+    const unsigned int num_gates = lstm_params.has_cifg_opt() ? 3 : 4;
+    const unsigned int fc_depth  = input->info()->dimension(0) + output_state_in->info()->dimension(0);
+
+    const TensorInfo         fc_input_info(TensorShape(fc_depth, cell_state_shape[1]), 1, data_type);
+    const TensorInfo         gate_weights_info(TensorShape(fc_depth, num_gates * num_units), 1, data_type);
+    const TensorInfo         gate_biases_info(TensorShape(num_gates * num_units), 1, data_type);
+    const TensorInfo         gates_info(TensorShape(num_gates * num_units, cell_state_shape[1]), 1, data_type);
+    const TensorInfo         cell_output_info(cell_state_shape, 1, data_type);
+    const LSTMCellKernelInfo cell_info = lstm_cell_info(lstm_params, activation_info, cell_threshold);
+
+    _is_fused =
+        bool(NEFullyConnectedLayer::validate(&fc_input_info, &gate_weights_info,
+                                             _is_layer_norm_lstm ? nullptr : &gate_biases_info, &gates_info)) &&
+        bool(NELSTMCellKernel::validate(
+            lstm_cell_arguments<const ITensorInfo>(
+                &gates_info, cell_state_in->info(), lstm_params_info, forget_gate_bias->info(), cell_bias->info(),
+                output_gate_bias->info(), cell_state_out->info(),
+                lstm_params.has_projection() ? &cell_output_info : output_state_out->info(), scratch_buffer->info()),
+            cell_info));
+
+    if (_is_fused)
+    {
+        _run_cifg_opt = lstm_params.has_cifg_opt();
+
+        // Gate weights are [input_size + output_size, num_gates * num_units], with the gates in the order
+        // [input, forget, cell, output] and the input gate dropped with CIFG
+        std::vector<const ITensor *> input_weights;
+        std::vector<const ITensor *> recurrent_weights;
+        std::vector<const ITensor *> gate_biases;
+        if (!_run_cifg_opt)
+        {
+            input_weights.emplace_back(lstm_params.input_to_input_weights());
+            recurrent_weights.emplace_back(lstm_params.recurrent_to_input_weights());
+            gate_biases.emplace_back(lstm_params.input_gate_bias());
+        }
+        input_weights.insert(input_weights.end(),
+                             {input_to_forget_weights, input_to_cell_weights, input_to_output_weights});
+        recurrent_weights.insert(recurrent_weights.end(),
+                                 {recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights});
+        gate_biases.insert(gate_biases.end(), {forget_gate_bias, cell_bias, output_gate_bias});
+
+        _concat_input_weights.configure(input_weights, &_input_weights, Window::DimY);
+        _concat_recurrent_weights.configure(recurrent_weights, &_recurrent_weights, Window::DimY);
+        _concat_gate_weights.configure({&_input_weights, &_recurrent_weights}, &_gate_weights, Window::DimX);
+        _input_weights.allocator()->allocate();
+        _recurrent_weights.allocator()->allocate();
+        _gate_weights.allocator()->allocate();
+        if (!_is_layer_norm_lstm)
+        {
+            _concat_gate_biases.configure(gate_biases, &_gate_biases, Window::DimX);
+            _gate_biases.allocator()->allocate();
+        }
+
+        _memory_group.manage(&_forget_gate_out1);
+        _concat_inputs_forget_gate.configure({input, output_state_in}, &_forget_gate_out1, Window::DimX);
+
+        _gates.allocator()->init(gates_info);
+        _memory_group.manage(&_gates);
+        _fully_connected_gates.configure(&_forget_gate_out1, &_gate_weights,
+                                         _is_layer_norm_lstm ? nullptr : &_gate_biases, &_gates);
+        _forget_gate_out1.allocator()->allocate();
+
+        ITensor *output_state_out_tmp = output_state_out;
+        if (lstm_params.has_projection())
+        {
+            _output_state1.allocator()->init(cell_output_info);
+            _memory_group.manage(&_output_state1);
+            output_state_out_tmp = &_output_state1;
+        }
+
+        _lstm_cell_kernel = std::make_unique<NELSTMCellKernel>();
+        _lstm_cell_kernel->configure(lstm_cell_arguments<ITensor>(&_gates, cell_state_in, lstm_params,
+                                                                  forget_gate_bias, cell_bias, output_gate_bias,
+                                                                  cell_state_out, output_state_out_tmp, scratch_buffer),
+                                     cell_info);
+        _gates.allocator()->allocate();
+
+        if (lstm_params.has_projection())
+        {
+            _has_projection_weights = true;
+            _fully_connected_output_state.configure(output_state_out_tmp, lstm_params.projection_weights(),
+                                                    lstm_params.projection_bias(), output_state_out);
+            _output_state1.allocator()->allocate();
+            if (projection_threshold != 0.f)
+            {
+                _perform_projection_clipping = true;
+                _projection_clip.configure(output_state_out, nullptr,
+                                           ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU,
+                                                               -projection_threshold, projection_threshold));
+            }
+        }
+
+        _copy_output.configure(output_state_out, output);
+        return;
+    }
+
     // Configure block that calculates the forget gate
     // forget_gate = Activation(input * input_to_forget_weights + output_state_in * recurrent_to_forget_weights + PixelWiseMul(cell_state, cell_to_forget_weights) + forget_gate_bias)
     // We optimize this as follows:
@@ -774,6 +945,24 @@ void NELSTMLayer::run()
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    if (_is_fused)
+    {
+        _concat_inputs_forget_gate.run();
+        _fully_connected_gates.run();
+        NEScheduler::get().schedule(_lstm_cell_kernel.get(), Window::DimY);
+
+        if (_has_projection_weights)
+        {
+            _fully_connected_output_state.run();
+            if (_perform_projection_clipping)
+            {
+                _projection_clip.run();
+            }
+        }
+        _copy_output.run();
+        return;
+    }
+
     _concat_inputs_forget_gate.run();
     _fully_connected_forget_gate.run();
 
@@ -878,6 +1067,21 @@ void NELSTMLayer::run()
 
 void NELSTMLayer::prepare()
 {
+    if (!_is_prepared && _is_fused)
+    {
+        _concat_input_weights.run();
+        _concat_recurrent_weights.run();
+        _concat_gate_weights.run();
+        if (!_is_layer_norm_lstm)
+        {
+            _concat_gate_biases.run();
+        }
+
+        // Only the concatenated weights are read from now on
+        _input_weights.allocator()->free();
+        _recurrent_weights.allocator()->free();
+        _is_prepared = true;
+    }
     if (!_is_prepared)
     {
         _concat_weights_forget_gate.run();
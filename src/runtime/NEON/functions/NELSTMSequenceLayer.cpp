@@ -0,0 +1,489 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NELSTMSequenceLayer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/InfoHelpers.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEConcatenateLayer.h"
+#include "arm_compute/runtime/NEON/functions/NECopy.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NETranspose.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/NEON/kernels/NELSTMCellKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+using namespace arm_compute::utils::info_helpers;
+
+namespace
+{
+/** Index of the timestep dimension of the input and output sequences */
+constexpr size_t idx_time = 2;
+
+/** Pointer to the first element of a tensor, or of its slice at timestep @p t for a sequence */
+uint8_t *slice_ptr(const ITensor *tensor, unsigned int t = 0)
+{
+    return tensor->buffer() + tensor->info()->offset_first_element_in_bytes() +
+           t * tensor->info()->strides_in_bytes()[idx_time];
+}
+
+/** Per gate tensors in the order [input, forget, cell, output], without the input gate with CIFG */
+template <typename T>
+std::vector<const T *> gate_vector(const T *input_gate, const T *forget_gate, const T *cell_gate, const T *output_gate)
+{
+    std::vector<const T *> gates;
+    if (input_gate != nullptr)
+    {
+        gates.emplace_back(input_gate);
+    }
+    gates.insert(gates.end(), {forget_gate, cell_gate, output_gate});
+    return gates;
+}
+
+/** Gather the tensors read and written by the elementwise part of a timestep
+ *
+ * The cell state is updated in place, the scratch buffer is not written.
+ */
+template <typename T, typename TParams>
+LSTMCellArguments<T> lstm_cell_arguments(T                         *gates,
+                                         const T                   *input_gates,
+                                         T                         *cell_state,
+                                         const LSTMParams<TParams> &lstm_params,
+                                         const T                   *forget_gate_bias,
+                                         const T                   *cell_bias,
+                                         const T                   *output_gate_bias,
+                                         T                         *output_state)
+{
+    const bool has_input_gate = !lstm_params.has_cifg_opt();
+
+    LSTMCellArguments<T> args{};
+    args.gates         = gates;
+    args.input_gates   = input_gates;
+    args.cell_state_in = cell_state;
+    if (lstm_params.has_peephole_opt())
+    {
+        args.cell_to_input_weights  = has_input_gate ? lstm_params.cell_to_input_weights() : nullptr;
+        args.cell_to_forget_weights = lstm_params.cell_to_forget_weights();
+        args.cell_to_output_weights = lstm_params.cell_to_output_weights();
+    }
+    // Without layer normalization the biases are added by the input GEMM
+    if (lstm_params.use_layer_norm())
+    {
+        args.input_layer_norm_weights  = has_input_gate ? lstm_params.input_layer_norm_weights() : nullptr;
+        args.forget_layer_norm_weights = lstm_params.forget_layer_norm_weights();
+        args.cell_layer_norm_weights   = lstm_params.cell_layer_norm_weights();
+        args.output_layer_norm_weights = lstm_params.output_layer_norm_weights();
+        args.input_gate_bias           = has_input_gate ? lstm_params.input_gate_bias() : nullptr;
+        args.forget_gate_bias          = forget_gate_bias;
+        args.cell_bias                 = cell_bias;
+        args.output_gate_bias          = output_gate_bias;
+    }
+    args.cell_state_out   = cell_state;
+    args.output_state_out = output_state;
+    return args;
+}
+
+template <typename TParams>
+LSTMCellKernelInfo
+lstm_cell_info(const LSTMParams<TParams> &lstm_params, const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    LSTMCellKernelInfo info{};
+    info.activation_info  = activation_info;
+    info.cell_threshold   = cell_threshold;
+    info.has_cifg_opt     = lstm_params.has_cifg_opt();
+    info.has_peephole_opt = lstm_params.has_peephole_opt();
+    info.use_layer_norm   = lstm_params.use_layer_norm();
+    return info;
+}
+
+/** The input GEMM reads the sequence as a single [input_size, batch_size * num_timesteps] matrix */
+GEMMInfo input_gemm_info(unsigned int num_timesteps)
+{
+    return GEMMInfo(false, false, true /* Reshape weights only for the first run */, num_timesteps,
+                    true /* Reinterpret the input as 3D */);
+}
+} // namespace
+
+struct NELSTMSequenceLayer::Impl
+{
+    MemoryGroup                       memory_group{};
+    NEConcatenateLayer                concat_input_weights{};
+    NETranspose                       transpose_input_weights{};
+    NEConcatenateLayer                concat_recurrent_weights{};
+    NEConcatenateLayer                concat_gate_biases{};
+    NEGEMM                            input_gemm{};
+    NEFullyConnectedLayer             recurrent_fc{};
+    std::unique_ptr<NELSTMCellKernel> cell_kernel{nullptr};
+    NEFullyConnectedLayer             projection_fc{};
+    NEActivationLayer                 projection_clip{};
+    NECopy                            copy_cell_state{};
+    NECopy                            copy_output_state{};
+    Tensor                            input_weights{};
+    Tensor                            input_weights_transposed{};
+    Tensor                            recurrent_weights{};
+    Tensor                            gate_biases{};
+    Tensor                            input_gates{};
+    Tensor                            gates{};
+    Tensor                            cell_output{};
+    Tensor                            step_input_gates{}; /**< Imported slice of @ref input_gates at each timestep */
+    Tensor                            step_output_state_in{}; /**< Imported output state of the previous timestep */
+    Tensor                            step_output{}; /**< Imported slice of the output at each timestep */
+    const ITensor                    *output_state_in{nullptr};
+    ITensor                          *output{nullptr};
+    unsigned int                      num_timesteps{0};
+    bool                              copy_cell_state_in{false};
+    bool                              has_projection{false};
+    bool                              perform_projection_clipping{false};
+    bool                              is_layer_norm_lstm{false};
+    bool                              is_prepared{false};
+};
+
+NELSTMSequenceLayer::NELSTMSequenceLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+
+NELSTMSequenceLayer::~NELSTMSequenceLayer() = default;
+
+void NELSTMSequenceLayer::configure(const ITensor             *input,
+                                    const ITensor             *input_to_forget_weights,
+                                    const ITensor             *input_to_cell_weights,
+                                    const ITensor             *input_to_output_weights,
+                                    const ITensor             *recurrent_to_forget_weights,
+                                    const ITensor             *recurrent_to_cell_weights,
+                                    const ITensor             *recurrent_to_output_weights,
+                                    const ITensor             *forget_gate_bias,
+                                    const ITensor             *cell_bias,
+                                    const ITensor             *output_gate_bias,
+                                    const ITensor             *output_state_in,
+                                    const ITensor             *cell_state_in,
+                                    ITensor                   *output_state_out,
+                                    ITensor                   *cell_state_out,
+                                    ITensor                   *output,
+                                    const LSTMParams<ITensor> &lstm_params,
+                                    const ActivationLayerInfo &activation_info,
+                                    float                      cell_threshold,
+                                    float                      projection_threshold)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, input_to_forget_weights, input_to_cell_weights, input_to_output_weights,
+                                 recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights,
+                                 forget_gate_bias, cell_bias, output_gate_bias, output_state_in, cell_state_in,
+                                 output_state_out, cell_state_out, output);
+    ARM_COMPUTE_LOG_PARAMS(input, input_to_forget_weights, input_to_cell_weights, input_to_output_weights,
+                           recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights,
+                           forget_gate_bias, cell_bias, output_gate_bias, output_state_in, cell_state_in,
+                           output_state_out, cell_state_out, output, lstm_params, activation_info, cell_threshold,
+                           projection_threshold);
+
+    LSTMParams<ITensorInfo> lstm_params_info{};
+    build_lstm_params_tensor_info(lstm_params, &lstm_params_info);
+
+    ARM_COMPUTE_ERROR_THROW_ON(NELSTMSequenceLayer::validate(
+        input->info(), input_to_forget_weights->info(), input_to_cell_weights->info(), input_to_output_weights->info(),
+        recurrent_to_forget_weights->info(), recurrent_to_cell_weights->info(), recurrent_to_output_weights->info(),
+        forget_gate_bias->info(), cell_bias->info(), output_gate_bias->info(), output_state_in->info(),
+        cell_state_in->info(), output_state_out->info(), cell_state_out->info(), output->info(), lstm_params_info,
+        activation_info, cell_threshold, projection_threshold));
+
+    const DataType     data_type     = input->info()->data_type();
+    const bool         has_cifg      = lstm_params.has_cifg_opt();
+    const unsigned int num_units     = cell_state_in->info()->dimension(0);
+    const unsigned int num_gates     = has_cifg ? 3 : 4;
+    const unsigned int batch_size    = input->info()->dimension(1);
+    const unsigned int num_timesteps = input->info()->dimension(idx_time);
+
+    _impl->output_state_in             = output_state_in;
+    _impl->output                      = output;
+    _impl->num_timesteps               = num_timesteps;
+    _impl->copy_cell_state_in          = cell_state_in != cell_state_out;
+    _impl->has_projection              = lstm_params.has_projection();
+    _impl->perform_projection_clipping = lstm_params.has_projection() && projection_threshold != 0.f;
+    _impl->is_layer_norm_lstm          = lstm_params.use_layer_norm();
+
+    // The gate weights are concatenated in the order [input, forget, cell, output] and reshaped once
+    _impl->concat_input_weights.configure(
+        gate_vector<ITensor>(has_cifg ? nullptr : lstm_params.input_to_input_weights(), input_to_forget_weights,
+                             input_to_cell_weights, input_to_output_weights),
+        &_impl->input_weights, Window::DimY);
+    _impl->transpose_input_weights.configure(&_impl->input_weights, &_impl->input_weights_transposed);
+    _impl->concat_recurrent_weights.configure(
+        gate_vector<ITensor>(has_cifg ? nullptr : lstm_params.recurrent_to_input_weights(),
+                             recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights),
+        &_impl->recurrent_weights, Window::DimY);
+    _impl->input_weights.allocator()->allocate();
+    _impl->input_weights_transposed.allocator()->allocate();
+    _impl->recurrent_weights.allocator()->allocate();
+
+    // With layer normalization the biases are added after the normalization, by the cell kernel
+    if (!_impl->is_layer_norm_lstm)
+    {
+        _impl->concat_gate_biases.configure(gate_vector<ITensor>(has_cifg ? nullptr : lstm_params.input_gate_bias(),
+                                                                 forget_gate_bias, cell_bias, output_gate_bias),
+                                            &_impl->gate_biases, Window::DimX);
+        _impl->gate_biases.allocator()->allocate();
+    }
+
+    // The input contribution to the gates of every timestep
+    _impl->input_gates.allocator()->init(
+        TensorInfo(TensorShape(num_gates * num_units, batch_size, num_timesteps), 1, data_type));
+    _impl->memory_group.manage(&_impl->input_gates);
+    _impl->input_gemm.configure(input, &_impl->input_weights_transposed,
+                                _impl->is_layer_norm_lstm ? nullptr : &_impl->gate_biases, &_impl->input_gates, 1.f,
+                                1.f, input_gemm_info(num_timesteps));
+
+    // Each timestep reads and writes slices of the sequences, their memory is imported at run time
+    const TensorInfo gates_info(TensorShape(num_gates * num_units, batch_size), 1, data_type);
+    _impl->step_input_gates.allocator()->init(gates_info);
+    const TensorInfo output_state_info(TensorShape(output_state_in->info()->dimension(0), batch_size), 1, data_type);
+    _impl->step_output_state_in.allocator()->init(output_state_info);
+    _impl->step_output.allocator()->init(output_state_info);
+
+    _impl->gates.allocator()->init(gates_info);
+    _impl->memory_group.manage(&_impl->gates);
+    _impl->recurrent_fc.configure(&_impl->step_output_state_in, &_impl->recurrent_weights, nullptr, &_impl->gates);
+
+    ITensor *cell_output = &_impl->step_output;
+    if (_impl->has_projection)
+    {
+        _impl->cell_output.allocator()->init(TensorInfo(cell_state_in->info()->tensor_shape(), 1, data_type));
+        _impl->memory_group.manage(&_impl->cell_output);
+        cell_output = &_impl->cell_output;
+    }
+
+    _impl->cell_kernel = std::make_unique<NELSTMCellKernel>();
+    _impl->cell_kernel->configure(lstm_cell_arguments<ITensor>(&_impl->gates, &_impl->step_input_gates,
+                                                               cell_state_out, lstm_params, forget_gate_bias,
+                                                               cell_bias, output_gate_bias, cell_output),
+                                  lstm_cell_info(lstm_params, activation_info, cell_threshold));
+    _impl->gates.allocator()->allocate();
+    _impl->input_gates.allocator()->allocate();
+
+    if (_impl->has_projection)
+    {
+        _impl->projection_fc.configure(&_impl->cell_output, lstm_params.projection_weights(),
+                                       lstm_params.projection_bias(), &_impl->step_output);
+        _impl->cell_output.allocator()->allocate();
+        if (_impl->perform_projection_clipping)
+        {
+            _impl->projection_clip.configure(
+                &_impl->step_output, nullptr,
+                ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, -projection_threshold,
+                                    projection_threshold));
+        }
+    }
+
+    if (_impl->copy_cell_state_in)
+    {
+        // The cell state is updated in place, the copy only reads the input cell state
+        _impl->copy_cell_state.configure(const_cast<ITensor *>(cell_state_in), cell_state_out);
+    }
+    // The output state of the last timestep is read back from its slice of the output
+    _impl->copy_output_state.configure(&_impl->step_output, output_state_out);
+}
+
+Status NELSTMSequenceLayer::validate(const ITensorInfo             *input,
+                                     const ITensorInfo             *input_to_forget_weights,
+                                     const ITensorInfo             *input_to_cell_weights,
+                                     const ITensorInfo             *input_to_output_weights,
+                                     const ITensorInfo             *recurrent_to_forget_weights,
+                                     const ITensorInfo             *recurrent_to_cell_weights,
+                                     const ITensorInfo             *recurrent_to_output_weights,
+                                     const ITensorInfo             *forget_gate_bias,
+                                     const ITensorInfo             *cell_bias,
+                                     const ITensorInfo             *output_gate_bias,
+                                     const ITensorInfo             *output_state_in,
+                                     const ITensorInfo             *cell_state_in,
+                                     const ITensorInfo             *output_state_out,
+                                     const ITensorInfo             *cell_state_out,
+                                     const ITensorInfo             *output,
+                                     const LSTMParams<ITensorInfo> &lstm_params,
+                                     const ActivationLayerInfo     &activation_info,
+                                     float                          cell_threshold,
+                                     float                          projection_threshold)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, input_to_forget_weights, input_to_cell_weights, input_to_output_weights,
+                                        recurrent_to_forget_weights, recurrent_to_cell_weights,
+                                        recurrent_to_output_weights, forget_gate_bias, cell_bias, output_gate_bias,
+                                        output_state_in, cell_state_in, output_state_out, cell_state_out, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(
+        input, input_to_forget_weights, input_to_cell_weights, input_to_output_weights, recurrent_to_forget_weights,
+        recurrent_to_cell_weights, recurrent_to_output_weights, forget_gate_bias, cell_bias, output_gate_bias,
+        output_state_in, cell_state_in, output_state_out, cell_state_out, output);
+
+    const bool has_cifg = lstm_params.has_cifg_opt();
+    if (!has_cifg)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lstm_params.input_to_input_weights(),
+                                            lstm_params.recurrent_to_input_weights(), lstm_params.input_gate_bias());
+    }
+
+    const DataType     data_type     = input->data_type();
+    const unsigned int input_size    = input->dimension(0);
+    const unsigned int batch_size    = input->dimension(1);
+    const unsigned int num_timesteps = input->dimension(idx_time);
+    const unsigned int output_size   = output_state_in->dimension(0);
+    const unsigned int num_units     = cell_state_in->dimension(0);
+    const unsigned int num_gates     = has_cifg ? 3 : 4;
+
+    // Check dimensions
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(output_state_in->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_state_in->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(output_state_in->dimension(1) != batch_size);
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_state_in->dimension(1) != batch_size);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(output_state_in, output_state_out);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(cell_state_in, cell_state_out);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(),
+                                                       TensorShape(output_size, batch_size, num_timesteps));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->has_padding() || output->has_padding() || output_state_in->has_padding(),
+                                    "The sequences and the input output state must not be padded");
+
+    // Validate the gate weights and biases concatenation
+    const TensorInfo input_weights_info(TensorShape(input_size, num_gates * num_units), 1, data_type);
+    const TensorInfo input_weights_transposed_info(TensorShape(num_gates * num_units, input_size), 1, data_type);
+    const TensorInfo recurrent_weights_info(TensorShape(output_size, num_gates * num_units), 1, data_type);
+    const TensorInfo gate_biases_info(TensorShape(num_gates * num_units), 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(
+        gate_vector<ITensorInfo>(has_cifg ? nullptr : lstm_params.input_to_input_weights(), input_to_forget_weights,
+                                 input_to_cell_weights, input_to_output_weights),
+        &input_weights_info, Window::DimY));
+    ARM_COMPUTE_RETURN_ON_ERROR(NETranspose::validate(&input_weights_info, &input_weights_transposed_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConcatenateLayer::validate(
+        gate_vector<ITensorInfo>(has_cifg ? nullptr : lstm_params.recurrent_to_input_weights(),
+                                 recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights),
+        &recurrent_weights_info, Window::DimY));
+    if (!lstm_params.use_layer_norm())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(
+            NEConcatenateLayer::validate(gate_vector<ITensorInfo>(has_cifg ? nullptr : lstm_params.input_gate_bias(),
+                                                                  forget_gate_bias, cell_bias, output_gate_bias),
+                                         &gate_biases_info, Window::DimX));
+    }
+
+    // Validate the input GEMM over the whole sequence and the recurrent fully connected layer of a timestep
+    const TensorInfo input_gates_info(TensorShape(num_gates * num_units, batch_size, num_timesteps), 1, data_type);
+    const TensorInfo gates_info(TensorShape(num_gates * num_units, batch_size), 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(input, &input_weights_transposed_info,
+                                                 lstm_params.use_layer_norm() ? nullptr : &gate_biases_info,
+                                                 &input_gates_info, 1.f, 1.f, input_gemm_info(num_timesteps)));
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        NEFullyConnectedLayer::validate(output_state_in, &recurrent_weights_info, nullptr, &gates_info));
+
+    // Validate the elementwise part of the cell, writing the output state or the input of the projection
+    const TensorInfo cell_output_info(cell_state_in->tensor_shape(), 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NELSTMCellKernel::validate(
+        lstm_cell_arguments<const ITensorInfo>(&gates_info, &gates_info, cell_state_out, lstm_params,
+                                               forget_gate_bias, cell_bias, output_gate_bias,
+                                               lstm_params.has_projection() ? &cell_output_info : output_state_out),
+        lstm_cell_info(lstm_params, activation_info, cell_threshold)));
+
+    if (lstm_params.has_projection())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(&cell_output_info,
+                                                                    lstm_params.projection_weights(),
+                                                                    lstm_params.projection_bias(), output_state_out));
+        if (projection_threshold != 0.f)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(
+                output_state_out, nullptr,
+                ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, -projection_threshold,
+                                    projection_threshold)));
+        }
+    }
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NECopy::validate(cell_state_in, cell_state_out));
+    ARM_COMPUTE_RETURN_ON_ERROR(NECopy::validate(output_state_out, output_state_out));
+
+    return Status{};
+}
+
+void NELSTMSequenceLayer::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+
+    if (_impl->copy_cell_state_in)
+    {
+        _impl->copy_cell_state.run();
+    }
+
+    _impl->input_gemm.run();
+
+    for (unsigned int t = 0; t < _impl->num_timesteps; ++t)
+    {
+        // The recurrent layer reads the output state of the previous timestep from its slice of the output
+        _impl->step_output_state_in.allocator()->import_memory(t == 0 ? slice_ptr(_impl->output_state_in)
+                                                                      : slice_ptr(_impl->output, t - 1));
+        _impl->step_input_gates.allocator()->import_memory(slice_ptr(&_impl->input_gates, t));
+        _impl->step_output.allocator()->import_memory(slice_ptr(_impl->output, t));
+
+        _impl->recurrent_fc.run();
+        NEScheduler::get().schedule(_impl->cell_kernel.get(), Window::DimY);
+
+        if (_impl->has_projection)
+        {
+            _impl->projection_fc.run();
+            if (_impl->perform_projection_clipping)
+            {
+                _impl->projection_clip.run();
+            }
+        }
+    }
+
+    // step_output still holds the output of the last timestep
+    _impl->copy_output_state.run();
+}
+
+void NELSTMSequenceLayer::prepare()
+{
+    if (!_impl->is_prepared)
+    {
+        _impl->concat_input_weights.run();
+        _impl->transpose_input_weights.run();
+        _impl->concat_recurrent_weights.run();
+        if (!_impl->is_layer_norm_lstm)
+        {
+            _impl->concat_gate_biases.run();
+        }
+
+        // Only the transposed input weights are read from now on
+        _impl->input_weights.allocator()->free();
+        _impl->is_prepared = true;
+    }
+}
+} // namespace arm_compute
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NELayerNorm.h"
+
+#include "arm_compute/core/Validate.h"
+
+#include "src/common/utils/Log.h"
+#include "src/cpu/operators/CpuLayerNorm.h"
+
+namespace arm_compute
+{
+struct NELayerNorm::Impl
+{
+    const ITensor                      *input{nullptr};
+    const ITensor                      *residual{nullptr};
+    const ITensor                      *gamma{nullptr};
+    const ITensor                      *beta{nullptr};
+    ITensor                            *output{nullptr};
+    std::unique_ptr<cpu::CpuLayerNorm> op{nullptr};
+};
+
+NELayerNorm::NELayerNorm() : _impl(std::make_unique<Impl>())
+{
+}
+
+NELayerNorm::~NELayerNorm() = default;
+
+void NELayerNorm::configure(const ITensor *input,
+                            const ITensor *residual,
+                            const ITensor *gamma,
+                            const ITensor *beta,
+                            ITensor       *output,
+                            float          epsilon,
+                            bool           use_rms_norm)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    _impl->input    = input;
+    _impl->residual = residual;
+    _impl->gamma    = gamma;
+    _impl->beta     = beta;
+    _impl->output   = output;
+    _impl->op       = std::make_unique<cpu::CpuLayerNorm>();
+    _impl->op->configure(input->info(), residual != nullptr ? residual->info() : nullptr,
+                         gamma != nullptr ? gamma->info() : nullptr, beta != nullptr ? beta->info() : nullptr,
+                         output->info(), epsilon, use_rms_norm);
+}
+
+Status NELayerNorm::validate(const ITensorInfo *input,
+                             const ITensorInfo *residual,
+                             const ITensorInfo *gamma,
+                             const ITensorInfo *beta,
+                             const ITensorInfo *output,
+                             float              epsilon,
+                             bool               use_rms_norm)
+{
+    return cpu::CpuLayerNorm::validate(input, residual, gamma, beta, output, epsilon, use_rms_norm);
+}
+
+void NELayerNorm::run()
+{
+    ITensorPack pack;
+    pack.add_const_tensor(TensorType::ACL_SRC_0, _impl->input);
+    pack.add_const_tensor(TensorType::ACL_SRC_1, _impl->residual);
+    pack.add_const_tensor(TensorType::ACL_SRC_2, _impl->gamma);
+    pack.add_const_tensor(TensorType::ACL_SRC_3, _impl->beta);
+    pack.add_tensor(TensorType::ACL_DST, _impl->output);
+    _impl->op->run(pack);
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025 Arm Limited.
+ * Copyright (c) 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -78,6 +78,54 @@ Status NEMatMul::validate(const ITensorInfo         *lhs,
     return cpu::CpuMatMul::validate(lhs, rhs, output, info, settings, act_info);
 }
 
+void NEMatMul::configure(ITensor                            *lhs,
+                         ITensor                            *rhs,
+                         const std::vector<const ITensor *> &operands,
+                         ITensor                            *dst,
+                         const MatMulInfo                   &info,
+                         const CpuMatMulSettings            &settings,
+                         const ElementwiseChainInfo         &epilogue)
+{
+    _impl->lhs    = lhs;
+    _impl->rhs    = rhs;
+    _impl->output = dst;
+
+    ARM_COMPUTE_ERROR_ON_NULLPTR(_impl->lhs, _impl->rhs, _impl->output);
+
+    std::vector<const ITensorInfo *> operand_infos(operands.size());
+    for (size_t i = 0; i < operands.size(); ++i)
+    {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(operands[i]);
+        operand_infos[i] = operands[i]->info();
+    }
+
+    _impl->op = std::make_unique<cpu::CpuMatMul>();
+    _impl->op->configure(lhs->info(), rhs->info(), operand_infos, dst->info(), info, settings, epilogue);
+    _impl->run_pack = {{ACL_SRC_0, lhs}, {ACL_SRC_1, rhs}, {ACL_DST, dst}};
+    for (size_t i = 0; i < operands.size(); ++i)
+    {
+        _impl->run_pack.add_const_tensor(static_cast<TensorType>(TensorType::ACL_SRC_VEC + i), operands[i]);
+    }
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->op->workspace(), _impl->memory_group, _impl->run_pack);
+}
+
+Status NEMatMul::validate(const ITensorInfo                      *lhs,
+                          const ITensorInfo                      *rhs,
+                          const std::vector<const ITensorInfo *> &operands,
+                          const ITensorInfo                      *dst,
+                          const MatMulInfo                       &info,
+                          const CpuMatMulSettings                &settings,
+                          const ElementwiseChainInfo             &epilogue)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(lhs, rhs, dst);
+    return cpu::CpuMatMul::validate(lhs, rhs, operands, dst, info, settings, epilogue);
+}
+
+void NEMatMul::set_valid_rhs_rows(size_t rows)
+{
+    _impl->op->set_valid_rhs_rows(rows);
+}
+
 void NEMatMul::run()
 {
     MemoryGroupResourceScope scope_mg(_impl->memory_group);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2024 Arm Limited.
+ * Copyright (c) 2018-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,12 +24,15 @@
 #include "arm_compute/runtime/NEON/functions/NEReduceMean.h"
 
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensorPack.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/NEON/kernels/NEReductionOperationKernel.h"
+#include "src/cpu/kernels/CpuMultiAxisReductionKernel.h"
 
 namespace arm_compute
 {
@@ -106,6 +109,9 @@ NEReduceMean::NEReduceMean(std::shared_ptr<IMemoryManager> memory_manager)
       _reduction_kernels(),
       _reduced_outs(),
       _reshape(),
+      _multi_axis_kernel(),
+      _input(nullptr),
+      _output(nullptr),
       _reduction_ops(),
       _keep_dims()
 {
@@ -131,9 +137,23 @@ void NEReduceMean::configure(ITensor *input, const Coordinates &reduction_axis,
     auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(output_shape));
 
     _reduction_ops = reduction_axis.num_dimensions();
+    _keep_dims     = keep_dims;
+
+    // Reduce several axes in a single pass, without intermediate tensors nor reshape
+    if (_reduction_ops > 1 &&
+        bool(cpu::kernels::CpuMultiAxisReductionKernel::validate(input->info(), output->info(), reduction_axis,
+                                                                 keep_dims, ReductionOperation::MEAN_SUM)))
+    {
+        _input             = input;
+        _output            = output;
+        _multi_axis_kernel = std::make_unique<cpu::kernels::CpuMultiAxisReductionKernel>();
+        _multi_axis_kernel->configure(input->info(), output->info(), reduction_axis, keep_dims,
+                                      ReductionOperation::MEAN_SUM);
+        return;
+    }
+
     _reduction_kernels.resize(_reduction_ops);
     _reduced_outs.resize(_reduction_ops - (keep_dims ? 1 : 0));
-    _keep_dims = keep_dims;
 
     ITensor *tmp_input  = input;
     ITensor *tmp_output = output;
@@ -195,6 +215,13 @@ void NEReduceMean::configure(ITensor *input, const Coordinates &reduction_axis,
 
 void NEReduceMean::run()
 {
+    if (_multi_axis_kernel != nullptr)
+    {
+        ITensorPack pack = {{TensorType::ACL_SRC, _input}, {TensorType::ACL_DST, _output}};
+        NEScheduler::get().schedule_op(_multi_axis_kernel.get(), Window::DimY, _multi_axis_kernel->window(), pack);
+        return;
+    }
+
     MemoryGroupResourceScope scope_mg(_memory_group);
     for (auto &kernel : _reduction_kernels)
     {
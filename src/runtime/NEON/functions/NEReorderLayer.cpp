@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,7 +52,7 @@ void NEReorderLayer::configure(const ITensor            *input,
 void NEReorderLayer::run()
 {
     // Run Reorder
-    NEScheduler::get().schedule(_reorder_kernel.get(), Window::DimX);
+    NEScheduler::get().schedule(_reorder_kernel.get(), IScheduler::Hints(IScheduler::split_dimensions_all));
 }
 
 Status NEReorderLayer::validate(const ITensorInfo        *input,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -93,6 +93,18 @@ Status NESlice::validate(const ITensorInfo *input,
     return experimental::NESlice::validate(input, output, starts, ends);
 }
 
+bool NESlice::is_view(const ITensorInfo *input,
+                      const Coordinates &starts,
+                      const Coordinates &ends,
+                      Coordinates       &view_coords)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input);
+    const int32_t slice_end_mask = arm_compute::helpers::tensor_transform::construct_slice_end_mask(ends);
+    return arm_compute::helpers::tensor_transform::is_strided_slice_view(input->tensor_shape(), starts, ends,
+                                                                          BiStrides(), 0, slice_end_mask, 0,
+                                                                          view_coords);
+}
+
 void NESlice::configure(const ITensor *input, ITensor *output, const Coordinates &starts, const Coordinates &ends)
 {
     _impl->src = input;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/helpers/tensor_transform.h"
 #include "arm_compute/core/Validate.h"
 
 #include "src/common/utils/Log.h"
@@ -114,4 +115,18 @@ Status NEStridedSlice::validate(const ITensorInfo *input,
     return experimental::NEStridedSlice::validate(input, output, starts, ends, strides, begin_mask, end_mask,
                                                   shrink_axis_mask);
 }
+
+bool NEStridedSlice::is_view(const ITensorInfo *input,
+                             const Coordinates &starts,
+                             const Coordinates &ends,
+                             const BiStrides   &strides,
+                             int32_t            begin_mask,
+                             int32_t            end_mask,
+                             int32_t            shrink_axis_mask,
+                             Coordinates       &view_coords)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input);
+    return arm_compute::helpers::tensor_transform::is_strided_slice_view(
+        input->tensor_shape(), starts, ends, strides, begin_mask, end_mask, shrink_axis_mask, view_coords);
+}
 } // namespace arm_compute
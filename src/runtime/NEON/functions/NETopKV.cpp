@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NETopKV.h"
+
+#include "arm_compute/core/Validate.h"
+
+#include "src/cpu/operators/CpuTopKV.h"
+
+namespace arm_compute
+{
+struct NETopKV::Impl
+{
+    const ITensor                 *src{nullptr};
+    ITensor                       *values{nullptr};
+    ITensor                       *indices{nullptr};
+    std::unique_ptr<cpu::CpuTopKV> op{nullptr};
+};
+
+NETopKV::NETopKV() : _impl(std::make_unique<Impl>())
+{
+}
+NETopKV::NETopKV(NETopKV &&)            = default;
+NETopKV &NETopKV::operator=(NETopKV &&) = default;
+NETopKV::~NETopKV()                     = default;
+
+void NETopKV::configure(const ITensor *input, ITensor *values, ITensor *indices, unsigned int k)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, values, indices);
+
+    _impl->src     = input;
+    _impl->values  = values;
+    _impl->indices = indices;
+
+    _impl->op = std::make_unique<cpu::CpuTopKV>();
+    _impl->op->configure(_impl->src->info(), _impl->values->info(), _impl->indices->info(), k);
+}
+
+Status NETopKV::validate(const ITensorInfo *input, const ITensorInfo *values, const ITensorInfo *indices, unsigned int k)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, values, indices);
+    return cpu::CpuTopKV::validate(input, values, indices, k);
+}
+
+void NETopKV::run()
+{
+    ITensorPack pack;
+    pack.add_tensor(TensorType::ACL_SRC, _impl->src);
+    pack.add_tensor(TensorType::ACL_DST_0, _impl->values);
+    pack.add_tensor(TensorType::ACL_DST_1, _impl->indices);
+    _impl->op->run(pack);
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,27 +27,113 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/Tracer.h"
 
+#include "src/runtime/SchedulerAsyncQueue.h"
+
+#include <algorithm>
 #include <omp.h>
 
 namespace arm_compute
 {
+namespace
+{
+/** State shared by the parts of a kernel window split along one dimension */
+struct SplitJob
+{
+    ICPPKernel   *kernel;
+    ITensorPack  *tensors;
+    const Window *window;
+    size_t        split_dimension;
+    unsigned int  num_windows;
+};
+
+void run_split_job(void *context, unsigned int index, const ThreadInfo &info)
+{
+    const auto &job = *static_cast<const SplitJob *>(context);
+
+    Window win = job.window->split_window(job.split_dimension, index, job.num_windows);
+    win.validate();
+    job.kernel->run_op(*job.tensors, win, info);
+}
+
+/** Run the parts one after the other on the calling thread
+ *
+ * The parts never overlap in time, so any thread id below @p max_threads is safe to use.
+ */
+void run_serially(
+    IScheduler::IndexedJob job, void *context, unsigned int num_jobs, unsigned int max_threads, ThreadInfo info)
+{
+    info.num_threads = std::min(max_threads, num_jobs);
+    for (unsigned int wid = 0; wid < num_jobs; ++wid)
+    {
+        info.thread_id = static_cast<int>(wid % info.num_threads);
+        job(context, wid, info);
+    }
+}
+
+/** Run the parts in a parallel region of @p team_size threads, @p info.num_threads being the number of ids to use */
+void run_in_team(
+    IScheduler::IndexedJob job, void *context, unsigned int num_jobs, unsigned int team_size, ThreadInfo info)
+{
+    if (num_jobs <= static_cast<unsigned int>(info.num_threads))
+    {
+#pragma omp parallel for firstprivate(info) num_threads(team_size) default(shared) proc_bind(close) \
+    schedule(static, 1)
+        for (unsigned int wid = 0; wid < num_jobs; ++wid)
+        {
+            info.thread_id = wid;
+            job(context, wid, info);
+        }
+    }
+    else
+    {
+        // More parts than threads, e.g. with StrategyHint::DYNAMIC: the threads pick the next part once they are done,
+        // so the id is the one of the thread rather than the one of the part
+#pragma omp parallel for firstprivate(info) num_threads(team_size) default(shared) proc_bind(close) \
+    schedule(dynamic, 1)
+        for (unsigned int wid = 0; wid < num_jobs; ++wid)
+        {
+            info.thread_id = omp_get_thread_num();
+            job(context, wid, info);
+        }
+    }
+}
+
+/** Run the parts as tasks, executed by the threads of the enclosing team, and wait for them */
+void run_as_tasks(IScheduler::IndexedJob job, void *context, unsigned int num_jobs, ThreadInfo info)
+{
+    info.num_threads = omp_get_num_threads();
+#pragma omp taskloop firstprivate(info) default(shared) grainsize(1)
+    for (unsigned int wid = 0; wid < num_jobs; ++wid)
+    {
+        info.thread_id = omp_get_thread_num();
+        job(context, wid, info);
+    }
+}
+} // namespace
+
 #if !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && \
     (defined(__arm__) || defined(__aarch64__)) && defined(__ANDROID__)
 OMPScheduler::OMPScheduler() // NOLINT
     : _num_threads(cpu_info().get_cpu_num_excluding_little()),
-      _nonlittle_num_cpus(cpu_info().get_cpu_num_excluding_little())
+      _nonlittle_num_cpus(cpu_info().get_cpu_num_excluding_little()),
+      _async_queue(std::make_unique<SchedulerAsyncQueue>())
 {
 }
 #else  /* !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && \
     (defined(__arm__) || defined(__aarch64__)) && defined(__ANDROID__)*/
 OMPScheduler::OMPScheduler() // NOLINT
-    : _num_threads(omp_get_max_threads()), _nonlittle_num_cpus(cpu_info().get_cpu_num_excluding_little())
+    : _num_threads(omp_get_max_threads()),
+      _nonlittle_num_cpus(cpu_info().get_cpu_num_excluding_little()),
+      _async_queue(std::make_unique<SchedulerAsyncQueue>())
 {
 }
 #endif /* !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && \
     (defined(__arm__) || defined(__aarch64__)) && defined(__ANDROID__)*/
 
+OMPScheduler::~OMPScheduler() = default;
+
 unsigned int OMPScheduler::num_threads() const
 {
     return _num_threads;
@@ -67,6 +153,12 @@ void OMPScheduler::set_num_threads(unsigned int num_threads)
     (defined(__arm__) || defined(__aarch64__)) && defined(__ANDROID__)*/
 }
 
+void OMPScheduler::set_nested_policy(NestedPolicy policy, unsigned int num_threads)
+{
+    _nested_policy      = policy;
+    _nested_num_threads = num_threads;
+}
+
 void OMPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
 {
     ITensorPack tensors;
@@ -75,16 +167,15 @@ void OMPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
 
 void OMPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
 {
-    // The rest of the logic in this function does not handle the
-    // split_dimensions_all case so we defer to IScheduler::schedule_common()
-    if (hints.split_dimension() == IScheduler::split_dimensions_all)
+    // The rest of the logic in this function does not handle the split_dimensions_all case nor the split in more
+    // windows than threads of the dynamic strategy, so we defer to IScheduler::schedule_common()
+    if (hints.split_dimension() == IScheduler::split_dimensions_all || hints.strategy() == StrategyHint::DYNAMIC)
     {
         return schedule_common(kernel, hints, window, tensors);
     }
 
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
-    ARM_COMPUTE_ERROR_ON_MSG(hints.strategy() == StrategyHint::DYNAMIC,
-                             "Dynamic scheduling is not supported in OMPScheduler");
+    ARM_COMPUTE_TRACE_SCOPE("kernel", kernel->name());
 
     const Window      &max_window     = window;
     const unsigned int num_iterations = max_window.num_iterations(hints.split_dimension());
@@ -104,37 +195,70 @@ void OMPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Win
     }
     else
     {
-        const unsigned int                num_windows = num_threads;
-        std::vector<IScheduler::Workload> workloads(num_windows);
-        for (unsigned int t = 0; t < num_windows; t++)
-        {
-            //Capture 't' by copy, all the other variables by reference:
-            workloads[t] = [t, &hints, &max_window, &num_windows, &kernel, &tensors](const ThreadInfo &info)
-            {
-                Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
-                win.validate();
-                kernel->run_op(tensors, win, info);
-            };
-        }
-        run_workloads(workloads);
+        SplitJob job{kernel, &tensors, &max_window, hints.split_dimension(), num_threads};
+        run_recorded_jobs(&run_split_job, &job, num_threads, kernel->name());
     }
 }
+IScheduler::CompletionHandle
+OMPScheduler::schedule_op_async(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
+{
+    // The job owns copies of the hints, window and pack so that the caller's ones can go out of scope
+    return _async_queue->enqueue([this, kernel, hints, window, tensors]() mutable
+                                 { schedule_op(kernel, hints, window, tensors); });
+}
+
 #ifndef DOXYGEN_SKIP_THIS
 void OMPScheduler::run_workloads(std::vector<arm_compute::IScheduler::Workload> &workloads)
 {
-    const unsigned int amount_of_work     = static_cast<unsigned int>(workloads.size());
-    const unsigned int num_threads_to_use = std::min(_num_threads, amount_of_work);
+    run_indexed_jobs([](void *context, unsigned int index, const ThreadInfo &info)
+                     { (*static_cast<std::vector<IScheduler::Workload> *>(context))[index](info); },
+                     &workloads, static_cast<unsigned int>(workloads.size()));
+}
 
-    if (num_threads_to_use < 1)
+void OMPScheduler::run_indexed_jobs(IndexedJob job, void *context, unsigned int num_jobs)
+{
+    if (num_jobs == 0)
     {
         return;
     }
 
     ThreadInfo info;
-    info.cpu_info    = &cpu_info();
-    info.num_threads = num_threads_to_use;
+    info.cpu_info = &cpu_info();
 
-    ARM_COMPUTE_ERROR_ON(amount_of_work > _num_threads);
+    // A parallel region opened from each thread of an enclosing team would oversubscribe the cores
+    if (omp_in_parallel())
+    {
+        switch (_nested_policy)
+        {
+            case NestedPolicy::TEAM:
+            {
+                const unsigned int requested = _nested_num_threads == 0 ? omp_get_max_threads() : _nested_num_threads;
+                const unsigned int team_size = std::min({requested, _num_threads, num_jobs});
+                if (team_size > 1 && omp_get_active_level() < omp_get_max_active_levels())
+                {
+                    info.num_threads = team_size;
+                    run_in_team(job, context, num_jobs, team_size, info);
+                    return;
+                }
+                break;
+            }
+            case NestedPolicy::TASKLOOP:
+                if (static_cast<unsigned int>(omp_get_num_threads()) <= _num_threads)
+                {
+                    run_as_tasks(job, context, num_jobs, info);
+                    return;
+                }
+                break;
+            case NestedPolicy::SERIAL:
+            default:
+                break;
+        }
+        run_serially(job, context, num_jobs, _num_threads, info);
+        return;
+    }
+
+    const unsigned int num_threads_to_use = std::min(_num_threads, num_jobs);
+    info.num_threads                      = num_threads_to_use;
 
 #if !defined(__ANDROID__)
     // Use fixed number of omp threads in the thread pool because changing this
@@ -147,13 +271,7 @@ void OMPScheduler::run_workloads(std::vector<arm_compute::IScheduler::Workload>
     const unsigned int omp_num_threads = num_threads_to_use;
 #endif /* __ANDROID__ */
 
-#pragma omp parallel for firstprivate(info) num_threads(omp_num_threads) default(shared) proc_bind(close) \
-    schedule(static, 1)
-    for (unsigned int wid = 0; wid < amount_of_work; ++wid)
-    {
-        info.thread_id = wid;
-        workloads[wid](info);
-    }
+    run_in_team(job, context, num_jobs, omp_num_threads, info);
 }
 #endif /* DOXYGEN_SKIP_THIS */
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,6 +47,11 @@ OffsetLifetimeManager::OffsetLifetimeManager() : _blob(0)
 {
 }
 
+size_t OffsetLifetimeManager::pool_size() const
+{
+    return _blob.size;
+}
+
 const OffsetLifetimeManager::info_type &OffsetLifetimeManager::info() const
 {
     return _blob;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,7 +47,7 @@ const BlobInfo &OffsetMemoryPool::info() const
 
 void OffsetMemoryPool::acquire(MemoryMappings &handles)
 {
-    ARM_COMPUTE_ERROR_ON(_blob == nullptr);
+    restore();
 
     // Set memory to handlers
     for (auto &handle : handles)
@@ -71,6 +71,24 @@ MappingType OffsetMemoryPool::mapping_type() const
     return MappingType::OFFSETS;
 }
 
+size_t OffsetMemoryPool::allocated_size() const
+{
+    return (_blob != nullptr) ? _blob->size() : 0;
+}
+
+void OffsetMemoryPool::trim()
+{
+    _blob = nullptr;
+}
+
+void OffsetMemoryPool::restore()
+{
+    if (_blob == nullptr)
+    {
+        _blob = _allocator->make_region(_blob_info.size, _blob_info.alignment);
+    }
+}
+
 std::unique_ptr<IMemoryPool> OffsetMemoryPool::duplicate()
 {
     ARM_COMPUTE_ERROR_ON(!_allocator);
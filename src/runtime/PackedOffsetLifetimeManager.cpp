@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/PackedOffsetLifetimeManager.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemoryGroup.h"
+#include "arm_compute/runtime/OffsetMemoryPool.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+size_t align_offset(size_t offset, size_t alignment)
+{
+    const size_t remainder = (alignment != 0U) ? offset % alignment : 0U;
+    return (remainder != 0U) ? offset + (alignment - remainder) : offset;
+}
+
+/** Placement of a tensor in the blob */
+struct Placement
+{
+    IMemory *handle;    /**< Tensor's memory handle */
+    size_t   size;      /**< Tensor's size */
+    size_t   alignment; /**< Alignment requirement */
+    size_t   start;     /**< Start event of the lifetime */
+    size_t   end;       /**< End event of the lifetime */
+    size_t   offset;    /**< Offset in the blob */
+};
+} // namespace
+
+PackedOffsetLifetimeManager::PackedOffsetLifetimeManager()
+    : _blob(0), _lower_bound_size(0), _num_events(0), _lifetimes()
+{
+}
+
+size_t PackedOffsetLifetimeManager::pool_size() const
+{
+    return _blob.size;
+}
+
+const PackedOffsetLifetimeManager::info_type &PackedOffsetLifetimeManager::info() const
+{
+    return _blob;
+}
+
+size_t PackedOffsetLifetimeManager::lower_bound_size() const
+{
+    return _lower_bound_size;
+}
+
+void PackedOffsetLifetimeManager::start_lifetime(void *obj)
+{
+    ISimpleLifetimeManager::start_lifetime(obj);
+    _lifetimes[obj] = std::make_pair(_num_events++, std::numeric_limits<size_t>::max());
+}
+
+void PackedOffsetLifetimeManager::end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment)
+{
+    ARM_COMPUTE_ERROR_ON(_lifetimes.find(obj) == std::end(_lifetimes));
+    _lifetimes[obj].second = _num_events++;
+
+    // Places the tensors of the group once all of them are finalized
+    ISimpleLifetimeManager::end_lifetime(obj, obj_memory, size, alignment);
+}
+
+std::unique_ptr<IMemoryPool> PackedOffsetLifetimeManager::create_pool(IAllocator *allocator)
+{
+    ARM_COMPUTE_ERROR_ON(allocator == nullptr);
+    return std::make_unique<OffsetMemoryPool>(allocator, _blob);
+}
+
+MappingType PackedOffsetLifetimeManager::mapping_type() const
+{
+    return MappingType::OFFSETS;
+}
+
+void PackedOffsetLifetimeManager::update_blobs_and_mappings()
+{
+    ARM_COMPUTE_ERROR_ON(!are_all_finalized());
+    ARM_COMPUTE_ERROR_ON(_active_group == nullptr);
+
+    std::vector<Placement> tensors;
+    for (const auto &active_element : _active_elements)
+    {
+        const Element &element  = active_element.second;
+        const auto    &lifetime = _lifetimes.at(active_element.first);
+        tensors.push_back(Placement{element.handle, element.size, element.alignment, lifetime.first, lifetime.second, 0});
+        _blob.alignment = std::max(_blob.alignment, element.alignment);
+    }
+
+    // The tensors alive when a tensor starts its lifetime must all be held at the same time
+    size_t lower_bound_size = 0;
+    for (const auto &tensor : tensors)
+    {
+        size_t alive_size = 0;
+        for (const auto &other : tensors)
+        {
+            alive_size += (other.start <= tensor.start && tensor.start < other.end) ? other.size : 0;
+        }
+        lower_bound_size = std::max(lower_bound_size, alive_size);
+    }
+
+    // Place the largest tensors first, each one in the tightest gap it fits in
+    std::vector<Placement *> order;
+    for (auto &tensor : tensors)
+    {
+        order.push_back(&tensor);
+    }
+    std::stable_sort(std::begin(order), std::end(order),
+                     [](const Placement *a, const Placement *b) { return a->size > b->size; });
+
+    std::vector<const Placement *> placed;
+    size_t                         blob_size = 0;
+    for (Placement *tensor : order)
+    {
+        std::vector<const Placement *> overlapping;
+        std::copy_if(std::begin(placed), std::end(placed), std::back_inserter(overlapping),
+                     [&](const Placement *p) { return p->start < tensor->end && tensor->start < p->end; });
+        std::sort(std::begin(overlapping), std::end(overlapping),
+                  [](const Placement *a, const Placement *b) { return a->offset < b->offset; });
+
+        size_t best_offset = std::numeric_limits<size_t>::max();
+        size_t best_gap    = std::numeric_limits<size_t>::max();
+        size_t gap_start   = 0;
+        for (const Placement *p : overlapping)
+        {
+            const size_t offset = align_offset(gap_start, tensor->alignment);
+            if (offset + tensor->size <= p->offset && p->offset - offset < best_gap)
+            {
+                best_offset = offset;
+                best_gap    = p->offset - offset;
+            }
+            gap_start = std::max(gap_start, p->offset + p->size);
+        }
+        tensor->offset = (best_offset != std::numeric_limits<size_t>::max())
+                             ? best_offset
+                             : align_offset(gap_start, tensor->alignment);
+
+        placed.push_back(tensor);
+        blob_size = std::max(blob_size, tensor->offset + tensor->size);
+    }
+
+    _blob.owners      = std::max(_blob.owners, tensors.size());
+    _blob.size        = std::max(_blob.size, blob_size);
+    _lower_bound_size = std::max(_lower_bound_size, lower_bound_size);
+
+    // Calculate group mappings
+    auto &group_mappings = _active_group->mappings();
+    for (const auto &tensor : tensors)
+    {
+        group_mappings[tensor.handle] = tensor.offset;
+    }
+
+    // Reset state
+    _lifetimes.clear();
+    _num_events = 0;
+}
+} // namespace arm_compute
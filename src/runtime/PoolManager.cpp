@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,64 +25,156 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/IMemoryPool.h"
+#include "arm_compute/runtime/Tracer.h"
 
 #include <algorithm>
+#include <iterator>
 #include <list>
+#include <vector>
 
 using namespace arm_compute;
 
-PoolManager::PoolManager() : _free_pools(), _occupied_pools(), _sem(), _mtx()
+namespace
 {
+// Index marking the bottom of the stack
+constexpr uint32_t empty_stack = UINT32_MAX;
+
+uint64_t make_head(uint32_t tag, uint32_t index)
+{
+    return (static_cast<uint64_t>(tag) << 32) | index;
+}
+
+uint32_t head_tag(uint64_t head)
+{
+    return static_cast<uint32_t>(head >> 32);
+}
+
+uint32_t head_index(uint64_t head)
+{
+    return static_cast<uint32_t>(head);
+}
+} // namespace
+
+PoolManager::PoolManager()
+    : _pools(), _pool_ptrs(), _next(), _head(make_head(0, empty_stack)), _num_free(0), _sem(), _mtx()
+{
+}
+
+void PoolManager::reset_free_pools()
+{
+    _pool_ptrs.clear();
+    _next = std::make_unique<std::atomic<uint32_t>[]>(_pools.size());
+    for (auto &pool : _pools)
+    {
+        const auto index = static_cast<uint32_t>(_pool_ptrs.size());
+        _next[index].store(index == 0 ? empty_stack : index - 1, std::memory_order_relaxed);
+        _pool_ptrs.push_back(pool.get());
+    }
+    _head.store(make_head(0, _pool_ptrs.empty() ? empty_stack : static_cast<uint32_t>(_pool_ptrs.size() - 1)));
+    _num_free.store(static_cast<int>(_pool_ptrs.size()));
+    _sem = _pool_ptrs.empty() ? nullptr : std::make_unique<arm_compute::Semaphore>(0);
+}
+
+bool PoolManager::try_claim_pool()
+{
+    int num_free = _num_free.load(std::memory_order_relaxed);
+    while (num_free > 0)
+    {
+        if (_num_free.compare_exchange_weak(num_free, num_free - 1, std::memory_order_acquire))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t PoolManager::pop_pool()
+{
+    // The claim guarantees a pool is pushed for this thread, it may only not be visible yet
+    uint64_t head = _head.load(std::memory_order_acquire);
+    while (true)
+    {
+        if (head_index(head) == empty_stack)
+        {
+            head = _head.load(std::memory_order_acquire);
+            continue;
+        }
+        const uint64_t next_head =
+            make_head(head_tag(head) + 1, _next[head_index(head)].load(std::memory_order_relaxed));
+        if (_head.compare_exchange_weak(head, next_head, std::memory_order_acquire, std::memory_order_acquire))
+        {
+            return head_index(head);
+        }
+    }
+}
+
+void PoolManager::push_pool(uint32_t index)
+{
+    uint64_t head = _head.load(std::memory_order_relaxed);
+    do
+    {
+        _next[index].store(head_index(head), std::memory_order_relaxed);
+    } while (!_head.compare_exchange_weak(head, make_head(head_tag(head) + 1, index), std::memory_order_release,
+                                          std::memory_order_relaxed));
+
+    // A negative count means a thread waits for this pool
+    if (_num_free.fetch_add(1, std::memory_order_acq_rel) < 0)
+    {
+        _sem->signal();
+    }
 }
 
 IMemoryPool *PoolManager::lock_pool()
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
+    ARM_COMPUTE_ERROR_ON_MSG(_pool_ptrs.empty(), "Haven't setup any pools!");
+    // Includes the time spent waiting for a pool to be released
+    ARM_COMPUTE_TRACE_SCOPE("memory", "lock_pool");
 
-    _sem->wait();
-    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty(), "Empty pool must exist as semaphore has been signalled");
-    _occupied_pools.splice(std::begin(_occupied_pools), _free_pools, std::begin(_free_pools));
-    return _occupied_pools.front().get();
+    // Claim a pool, or wait for one to be pushed back when they are all occupied
+    if (_num_free.fetch_sub(1, std::memory_order_acquire) <= 0)
+    {
+        _sem->wait();
+    }
+    return _pool_ptrs[pop_pool()];
 }
 
 void PoolManager::unlock_pool(IMemoryPool *pool)
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_free_pools.empty() && _occupied_pools.empty(), "Haven't setup any pools!");
+    ARM_COMPUTE_ERROR_ON_MSG(_pool_ptrs.empty(), "Haven't setup any pools!");
+    ARM_COMPUTE_TRACE_INSTANT("memory", "unlock_pool");
 
-    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
-    auto it = std::find_if(std::begin(_occupied_pools), std::end(_occupied_pools),
-                           [pool](const std::unique_ptr<IMemoryPool> &pool_it) { return pool_it.get() == pool; });
-    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_occupied_pools), "Pool to be unlocked couldn't be found!");
-    _free_pools.splice(std::begin(_free_pools), _occupied_pools, it);
-    _sem->signal();
+    const auto it = std::find(std::begin(_pool_ptrs), std::end(_pool_ptrs), pool);
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_pool_ptrs), "Pool to be unlocked couldn't be found!");
+    push_pool(static_cast<uint32_t>(std::distance(std::begin(_pool_ptrs), it)));
 }
 
 void PoolManager::register_pool(std::unique_ptr<IMemoryPool> pool)
 {
     arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to register a new one!");
+    ARM_COMPUTE_ERROR_ON_MSG(_num_free.load() != static_cast<int>(_pool_ptrs.size()),
+                             "All pools should be free in order to register a new one!");
 
     // Set pool
-    _free_pools.push_front(std::move(pool));
+    _pools.push_front(std::move(pool));
 
-    // Update semaphore
-    _sem = std::make_unique<arm_compute::Semaphore>(_free_pools.size());
+    // Update the free pools
+    reset_free_pools();
 }
 
 std::unique_ptr<IMemoryPool> PoolManager::release_pool()
 {
     arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to release one!");
+    ARM_COMPUTE_ERROR_ON_MSG(_num_free.load() != static_cast<int>(_pool_ptrs.size()),
+                             "All pools should be free in order to release one!");
 
-    if (!_free_pools.empty())
+    if (!_pools.empty())
     {
-        std::unique_ptr<IMemoryPool> pool = std::move(_free_pools.front());
-        ARM_COMPUTE_ERROR_ON(_free_pools.front() != nullptr);
-        _free_pools.pop_front();
+        std::unique_ptr<IMemoryPool> pool = std::move(_pools.front());
+        ARM_COMPUTE_ERROR_ON(_pools.front() != nullptr);
+        _pools.pop_front();
 
-        // Update semaphore
-        _sem = std::make_unique<arm_compute::Semaphore>(_free_pools.size());
+        // Update the free pools
+        reset_free_pools();
 
         return pool;
     }
@@ -93,16 +185,62 @@ std::unique_ptr<IMemoryPool> PoolManager::release_pool()
 void PoolManager::clear_pools()
 {
     arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
-    ARM_COMPUTE_ERROR_ON_MSG(!_occupied_pools.empty(), "All pools should be free in order to clear the PoolManager!");
-    _free_pools.clear();
+    ARM_COMPUTE_ERROR_ON_MSG(_num_free.load() != static_cast<int>(_pool_ptrs.size()),
+                             "All pools should be free in order to clear the PoolManager!");
+    _pools.clear();
 
-    // Update semaphore
-    _sem = nullptr;
+    // Update the free pools
+    reset_free_pools();
 }
 
 size_t PoolManager::num_pools() const
 {
     arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
 
-    return _free_pools.size() + _occupied_pools.size();
+    return _pools.size();
+}
+
+size_t PoolManager::allocated_size() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    size_t size = 0;
+    for (const auto &pool : _pools)
+    {
+        size += pool->allocated_size();
+    }
+    return size;
+}
+
+void PoolManager::trim_pools()
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    // Occupied pools are in use and keep their memory, the free ones are claimed while they are trimmed
+    std::vector<uint32_t> free_pools;
+    while (try_claim_pool())
+    {
+        free_pools.push_back(pop_pool());
+    }
+    for (const auto index : free_pools)
+    {
+        _pool_ptrs[index]->trim();
+        push_pool(index);
+    }
+}
+
+void PoolManager::restore_pools()
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+
+    std::vector<uint32_t> free_pools;
+    while (try_claim_pool())
+    {
+        free_pools.push_back(pop_pool());
+    }
+    for (const auto index : free_pools)
+    {
+        _pool_ptrs[index]->restore();
+        push_pool(index);
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2024 Arm Limited.
+ * Copyright (c) 2017-2020, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,24 +37,33 @@
 
 using namespace arm_compute;
 
+namespace
+{
 #if !ARM_COMPUTE_CPP_SCHEDULER && ARM_COMPUTE_OPENMP_SCHEDULER
-Scheduler::Type Scheduler::_scheduler_type = Scheduler::Type::OMP;
+constexpr Scheduler::Type default_scheduler_type = Scheduler::Type::OMP;
 #elif ARM_COMPUTE_CPP_SCHEDULER && !ARM_COMPUTE_OPENMP_SCHEDULER
-Scheduler::Type Scheduler::_scheduler_type                            = Scheduler::Type::CPP;
+constexpr Scheduler::Type default_scheduler_type = Scheduler::Type::CPP;
 #elif ARM_COMPUTE_CPP_SCHEDULER && ARM_COMPUTE_OPENMP_SCHEDULER
-Scheduler::Type Scheduler::_scheduler_type = Scheduler::Type::CPP;
+constexpr Scheduler::Type default_scheduler_type = Scheduler::Type::CPP;
 #else  /* ARM_COMPUTE_*_SCHEDULER */
-Scheduler::Type Scheduler::_scheduler_type = Scheduler::Type::ST;
+constexpr Scheduler::Type default_scheduler_type = Scheduler::Type::ST;
 #endif /* ARM_COMPUTE_*_SCHEDULER */
+} // namespace
 
 #ifndef ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+Scheduler::Type             Scheduler::_scheduler_type   = default_scheduler_type;
 std::shared_ptr<IScheduler> Scheduler::_custom_scheduler = nullptr;
 #else  // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
+// The active scheduler is selected per thread so that a thread installing its own scheduler does not affect the others
+Scheduler::Type thread_local             Scheduler::_scheduler_type   = default_scheduler_type;
 std::shared_ptr<IScheduler> thread_local Scheduler::_custom_scheduler = nullptr;
 #endif // ARM_COMPUTE_THREAD_LOCAL_SCHEDULER
 
 namespace
 {
+/** Scheduler bound to the calling thread by ScopedScheduler, if any */
+thread_local IScheduler *bound_scheduler = nullptr;
+
 std::map<Scheduler::Type, std::unique_ptr<IScheduler>> init()
 {
     std::map<Scheduler::Type, std::unique_ptr<IScheduler>> m;
@@ -97,6 +106,11 @@ Scheduler::Type Scheduler::get_type()
 
 IScheduler &Scheduler::get()
 {
+    if (bound_scheduler != nullptr)
+    {
+        return *bound_scheduler;
+    }
+
     if (_scheduler_type == Type::CUSTOM)
     {
         if (_custom_scheduler == nullptr)
@@ -133,3 +147,16 @@ void Scheduler::set(std::shared_ptr<IScheduler> scheduler)
     _custom_scheduler = std::move(scheduler);
     set(Type::CUSTOM);
 }
+
+ScopedScheduler::ScopedScheduler(IScheduler *scheduler) : _previous(bound_scheduler)
+{
+    if (scheduler != nullptr)
+    {
+        bound_scheduler = scheduler;
+    }
+}
+
+ScopedScheduler::~ScopedScheduler()
+{
+    bound_scheduler = _previous;
+}
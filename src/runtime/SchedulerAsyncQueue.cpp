@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/runtime/SchedulerAsyncQueue.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <utility>
+
+namespace arm_compute
+{
+#ifndef BARE_METAL
+SchedulerAsyncQueue::~SchedulerAsyncQueue()
+{
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        _stop = true;
+    }
+    _cv.notify_all();
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+IScheduler::CompletionHandle SchedulerAsyncQueue::enqueue(Job job)
+{
+    Entry entry;
+    entry.job   = std::move(job);
+    auto handle = IScheduler::CompletionHandle(entry.promise.get_future().share());
+    {
+        std::lock_guard<std::mutex> lock(_m);
+        ARM_COMPUTE_ERROR_ON(_stop);
+        _entries.emplace_back(std::move(entry));
+        if (!_thread.joinable())
+        {
+            _thread = std::thread(&SchedulerAsyncQueue::dispatch_thread, this);
+        }
+    }
+    _cv.notify_all();
+    return handle;
+}
+
+void SchedulerAsyncQueue::wait_idle()
+{
+    std::unique_lock<std::mutex> lock(_m);
+    _cv.wait(lock, [&] { return _entries.empty() && !_busy; });
+}
+
+void SchedulerAsyncQueue::dispatch_thread()
+{
+    std::unique_lock<std::mutex> lock(_m);
+    while (true)
+    {
+        _cv.wait(lock, [&] { return _stop || !_entries.empty(); });
+        // Drain the queue before honouring a stop request
+        if (_entries.empty())
+        {
+            return;
+        }
+
+        Entry entry = std::move(_entries.front());
+        _entries.pop_front();
+        _busy = true;
+        lock.unlock();
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            entry.job();
+            entry.promise.set_value();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch (...)
+        {
+            entry.promise.set_exception(std::current_exception());
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+        lock.lock();
+        _busy = false;
+        _cv.notify_all();
+    }
+}
+#endif /* BARE_METAL */
+} // namespace arm_compute
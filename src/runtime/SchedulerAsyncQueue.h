@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_RUNTIME_SCHEDULERASYNCQUEUE_H
+#define ACL_SRC_RUNTIME_SCHEDULERASYNCQUEUE_H
+
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace arm_compute
+{
+/** Single threaded FIFO queue used by the schedulers to implement IScheduler::schedule_op_async()
+ *
+ * Jobs are executed one after the other by a dedicated dispatch thread, which then acts as the "main" thread of the
+ * scheduler's thread pool while the submitting thread carries on. The dispatch thread is only created on the first
+ * submission so schedulers that never run asynchronous work do not pay for it.
+ */
+class SchedulerAsyncQueue final
+{
+public:
+    /** Signature of the jobs to execute */
+    using Job = std::function<void()>;
+
+    /** Default constructor */
+    SchedulerAsyncQueue() = default;
+    /** Prevent instances of this class from being copied */
+    SchedulerAsyncQueue(const SchedulerAsyncQueue &) = delete;
+    /** Prevent instances of this class from being copied */
+    SchedulerAsyncQueue &operator=(const SchedulerAsyncQueue &) = delete;
+    /** Destructor: waits for the pending jobs to complete and joins the dispatch thread */
+    ~SchedulerAsyncQueue();
+
+    /** Append a job to the queue
+     *
+     * @param[in] job Job to execute.
+     *
+     * @return Handle that completes once the job has been executed
+     */
+    IScheduler::CompletionHandle enqueue(Job job);
+
+    /** Block until all the jobs submitted so far have been executed */
+    void wait_idle();
+
+private:
+    struct Entry
+    {
+        Job                job;
+        std::promise<void> promise;
+    };
+
+    void dispatch_thread();
+
+    std::thread             _thread{};
+    std::mutex              _m{};
+    std::condition_variable _cv{};
+    std::deque<Entry>       _entries{};
+    bool                    _busy{false};
+    bool                    _stop{false};
+};
+} // namespace arm_compute
+#endif // ACL_SRC_RUNTIME_SCHEDULERASYNCQUEUE_H
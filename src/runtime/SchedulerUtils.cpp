@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,9 +23,21 @@
  */
 #include "src/runtime/SchedulerUtils.h"
 
+#include "arm_compute/core/CPP/CPPTypes.h"
 #include "arm_compute/core/Error.h"
 
+#include "src/common/cpuinfo/CpuModel.h"
+#include "support/StringSupport.h"
+
+#include <algorithm>
 #include <cmath>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <tuple>
+#if !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__)
+#include <sched.h>
+#endif /* !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__) */
 
 namespace arm_compute
 {
@@ -77,6 +89,247 @@ std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std:
         return {1, std::min<unsigned>(n, max_threads)};
     }
 }
+
+std::vector<unsigned int> split_weighted(unsigned int num_iterations, const std::vector<float> &weights)
+{
+    const unsigned int num_chunks = static_cast<unsigned int>(weights.size());
+    if (num_chunks == 0 || num_iterations < num_chunks)
+    {
+        return {};
+    }
+
+    const auto minmax = std::minmax_element(weights.begin(), weights.end());
+    if (*minmax.first <= 0.f || *minmax.first == *minmax.second)
+    {
+        return {};
+    }
+
+    // Give one iteration to every chunk and distribute the others proportionally to the weights
+    const float        total_weight = std::accumulate(weights.begin(), weights.end(), 0.f);
+    const unsigned int to_share     = num_iterations - num_chunks;
+
+    std::vector<unsigned int> boundaries(num_chunks + 1, 0U);
+    float                     acc_weight = 0.f;
+    for (unsigned int i = 0; i < num_chunks; ++i)
+    {
+        acc_weight += weights[i];
+        const auto shared = static_cast<unsigned int>(std::lround(to_share * (acc_weight / total_weight)));
+        boundaries[i + 1] = std::min(shared, to_share) + i + 1;
+    }
+    boundaries[num_chunks] = num_iterations;
+    return boundaries;
+}
+
+Window narrow_window(const Window &window, std::size_t dimension, unsigned int it_begin, unsigned int it_end)
+{
+    ARM_COMPUTE_ERROR_ON(it_begin > it_end);
+
+    const Window::Dimension &dim   = window[dimension];
+    const int                start = dim.start() + static_cast<int>(it_begin) * dim.step();
+    const int                end   = std::min(dim.end(), dim.start() + static_cast<int>(it_end) * dim.step());
+
+    Window out(window);
+    out.set(dimension, Window::Dimension(start, end, dim.step()));
+    return out;
+}
+
+void set_thread_affinity(int core_id)
+{
+    if (core_id < 0)
+    {
+        return;
+    }
+
+#if !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core_id, &set);
+    ARM_COMPUTE_EXIT_ON_MSG(sched_setaffinity(0, sizeof(set), &set), "Error setting thread affinity");
+#endif /* !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__) */
+}
+
+namespace
+{
+/** Read the first integer of a sysfs file, e.g. the first core of a list of cores
+ *
+ * @param[in]  path  Path of the file.
+ * @param[out] value Value read, left untouched if the file cannot be read
+ *
+ * @returns True if the value has been read
+ */
+bool read_first_int(const std::string &path, int &value)
+{
+    std::ifstream file(path, std::ios::in);
+    int           read_value = 0;
+    if (file.is_open() && (file >> read_value))
+    {
+        value = read_value;
+        return true;
+    }
+    return false;
+}
+
+/** Rank of each core among the logical cores of its physical core, 0 for the first one */
+std::vector<int> sibling_ranks(const std::vector<CoreTopology> &cores)
+{
+    std::vector<int> ranks(cores.size(), 0);
+    for (size_t i = 0; i < cores.size(); ++i)
+    {
+        for (size_t j = 0; j < cores.size(); ++j)
+        {
+            if (cores[j].physical == cores[i].physical && cores[j].id < cores[i].id)
+            {
+                ++ranks[i];
+            }
+        }
+    }
+    return ranks;
+}
+
+/** Highest capacity of the cores sharing the given group id */
+float group_capacity(const std::vector<CoreTopology> &cores, int CoreTopology::*group, int id)
+{
+    float capacity = 0.f;
+    for (const auto &core : cores)
+    {
+        if (core.*group == id)
+        {
+            capacity = std::max(capacity, core.capacity);
+        }
+    }
+    return capacity;
+}
+} // namespace
+
+std::vector<CoreTopology> read_core_topology()
+{
+    const CPUInfo &info = CPUInfo::get();
+    const auto     num_cores = info.get_cpu_num();
+
+    std::vector<CoreTopology> cores;
+    std::vector<int>          sysfs_capacities;
+    bool                      has_sysfs = false;
+    for (unsigned int i = 0; i < num_cores; ++i)
+    {
+        const std::string path = "/sys/devices/system/cpu/cpu" + support::cpp11::to_string(i) + "/";
+        const int         id   = static_cast<int>(i);
+        CoreTopology      core{id, cpuinfo::model_relative_capacity(info.get_cpu_model(i)), id, 0, 0};
+
+        has_sysfs = read_first_int(path + "topology/thread_siblings_list", core.physical) || has_sysfs;
+        if (!read_first_int(path + "topology/cluster_id", core.cluster) || core.cluster < 0)
+        {
+            core.cluster = 0;
+            read_first_int(path + "cpufreq/related_cpus", core.cluster);
+        }
+        if (!read_first_int(path + "cache/index3/shared_cpu_list", core.l3))
+        {
+            read_first_int(path + "topology/physical_package_id", core.l3);
+        }
+
+        // The capacities of the scheduler of the kernel are more accurate than the ones of the models
+        int sysfs_capacity = 0;
+        read_first_int(path + "cpu_capacity", sysfs_capacity);
+        sysfs_capacities.push_back(sysfs_capacity);
+        cores.push_back(core);
+    }
+
+    const int max_capacity = sysfs_capacities.empty()
+                                 ? 0
+                                 : *std::max_element(sysfs_capacities.begin(), sysfs_capacities.end());
+    if (max_capacity > 0 && std::all_of(sysfs_capacities.begin(), sysfs_capacities.end(), [](int c) { return c > 0; }))
+    {
+        for (size_t i = 0; i < cores.size(); ++i)
+        {
+            cores[i].capacity = static_cast<float>(sysfs_capacities[i]) / static_cast<float>(max_capacity);
+        }
+    }
+    return has_sysfs ? cores : std::vector<CoreTopology>();
+}
+
+std::vector<int> affinity_cores(IScheduler::AffinityPolicy policy, const std::vector<CoreTopology> &cores)
+{
+    const std::vector<int> ranks = sibling_ranks(cores);
+    std::vector<size_t>    order(cores.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    // Cores of equal capacity are ordered by id, the SMT siblings after the first logical cores of the physical ones
+    auto by_capacity = [&](size_t a, size_t b)
+    {
+        return std::make_tuple(ranks[a], -cores[a].capacity, cores[a].id) <
+               std::make_tuple(ranks[b], -cores[b].capacity, cores[b].id);
+    };
+
+    float max_capacity = 0.f;
+    for (const auto &core : cores)
+    {
+        max_capacity = std::max(max_capacity, core.capacity);
+    }
+
+    switch (policy)
+    {
+        case IScheduler::AffinityPolicy::BIG_CORES:
+        {
+            order.erase(std::remove_if(order.begin(), order.end(),
+                                       [&](size_t i) { return cores[i].capacity < max_capacity; }),
+                        order.end());
+            std::sort(order.begin(), order.end(), by_capacity);
+            break;
+        }
+        case IScheduler::AffinityPolicy::PHYSICAL_CORES:
+        {
+            order.erase(std::remove_if(order.begin(), order.end(), [&](size_t i) { return ranks[i] != 0; }),
+                        order.end());
+            std::sort(order.begin(), order.end(), by_capacity);
+            break;
+        }
+        case IScheduler::AffinityPolicy::CLUSTER_COMPACT:
+        {
+            std::sort(order.begin(), order.end(),
+                      [&](size_t a, size_t b)
+                      {
+                          const float cap_a = group_capacity(cores, &CoreTopology::cluster, cores[a].cluster);
+                          const float cap_b = group_capacity(cores, &CoreTopology::cluster, cores[b].cluster);
+                          return std::make_tuple(-cap_a, cores[a].cluster, ranks[a], cores[a].id) <
+                                 std::make_tuple(-cap_b, cores[b].cluster, ranks[b], cores[b].id);
+                      });
+            break;
+        }
+        case IScheduler::AffinityPolicy::SPREAD_L3:
+        {
+            // Index of each core within its L3 domain, the domains taking their cores in turn
+            std::sort(order.begin(), order.end(), by_capacity);
+            std::vector<int> index_in_domain(cores.size(), 0);
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                for (size_t j = 0; j < i; ++j)
+                {
+                    if (cores[order[j]].l3 == cores[order[i]].l3)
+                    {
+                        ++index_in_domain[order[i]];
+                    }
+                }
+            }
+            std::sort(order.begin(), order.end(),
+                      [&](size_t a, size_t b)
+                      {
+                          const float cap_a = group_capacity(cores, &CoreTopology::l3, cores[a].l3);
+                          const float cap_b = group_capacity(cores, &CoreTopology::l3, cores[b].l3);
+                          return std::make_tuple(index_in_domain[a], -cap_a, cores[a].l3) <
+                                 std::make_tuple(index_in_domain[b], -cap_b, cores[b].l3);
+                      });
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Unsupported affinity policy");
+    }
+
+    std::vector<int> ids;
+    for (size_t i : order)
+    {
+        ids.push_back(cores[i].id);
+    }
+    return ids;
+}
 #endif /* #ifndef BARE_METAL */
 } // namespace scheduler_utils
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,8 +24,12 @@
 #ifndef SRC_COMPUTE_SCHEDULER_UTILS_H
 #define SRC_COMPUTE_SCHEDULER_UTILS_H
 
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/IScheduler.h"
+
 #include <cstddef>
 #include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -40,6 +44,63 @@ namespace scheduler_utils
  * @returns [m_nthreads, n_nthreads] A pair of the threads that should be used in each dimension
  */
 std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std::size_t n);
+
+/** Split a number of iterations in contiguous chunks whose sizes are proportional to the given weights
+ *
+ * Every chunk gets at least one iteration.
+ *
+ * @param[in] num_iterations Number of iterations to split.
+ * @param[in] weights        Relative weight of each chunk.
+ *
+ * @returns The weights.size() + 1 boundaries of the chunks (chunk i is [boundaries[i], boundaries[i + 1])),
+ *          or an empty vector if the weights are uniform or there are fewer iterations than chunks.
+ */
+std::vector<unsigned int> split_weighted(unsigned int num_iterations, const std::vector<float> &weights);
+
+/** Restrict a window to a range of iterations along one of its dimensions
+ *
+ * @param[in] window    Window to narrow.
+ * @param[in] dimension Dimension to narrow.
+ * @param[in] it_begin  First iteration of the range.
+ * @param[in] it_end    One past the last iteration of the range.
+ *
+ * @returns The narrowed window
+ */
+Window narrow_window(const Window &window, std::size_t dimension, unsigned int it_begin, unsigned int it_end);
+
+/** Set thread affinity. Pin current thread to a particular core
+ *
+ * @param[in] core_id ID of the core to which the current thread is pinned. If negative no thread pinning will take place
+ */
+void set_thread_affinity(int core_id);
+
+/** Topology of a logical core */
+struct CoreTopology
+{
+    int   id;       /**< Logical core id */
+    float capacity; /**< Capacity relative to the biggest cores */
+    int   physical; /**< Id of the first logical core of the physical core, shared by the SMT siblings */
+    int   cluster;  /**< Id of the cluster of the core */
+    int   l3;       /**< Id of the L3 cache domain of the core */
+};
+
+/** Read the topology of the logical cores from sysfs
+ *
+ * Missing entries fall back to a core without SMT siblings, its cluster being its frequency domain and its L3 domain
+ * its package.
+ *
+ * @returns The topology of each logical core of @ref CPUInfo, or an empty vector if sysfs is not available
+ */
+std::vector<CoreTopology> read_core_topology();
+
+/** Select and order the logical cores to bind the threads to following an affinity policy
+ *
+ * @param[in] policy Affinity policy to follow.
+ * @param[in] cores  Topology of the logical cores.
+ *
+ * @returns The ids of the selected cores, thread i being bound to the i-th one
+ */
+std::vector<int> affinity_cores(IScheduler::AffinityPolicy policy, const std::vector<CoreTopology> &cores);
 } // namespace scheduler_utils
 } // namespace arm_compute
 #endif /* SRC_COMPUTE_SCHEDULER_UTILS_H */
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/SubTensorViews.h"
+
+#include "arm_compute/core/Error.h"
+
+namespace arm_compute
+{
+namespace
+{
+std::vector<SubTensor> create_views(ITensor *parent, const std::vector<TensorShape> &shapes, size_t axis)
+{
+    std::vector<SubTensor> views;
+    views.reserve(shapes.size());
+
+    Coordinates coords{};
+    for (const auto &shape : shapes)
+    {
+        views.emplace_back(parent, shape, coords);
+        coords.set(axis, coords[axis] + static_cast<int>(shape[axis]));
+    }
+    return views;
+}
+} // namespace
+
+std::vector<SubTensor>
+create_concatenate_views(ITensor *output, const std::vector<TensorShape> &input_shapes, size_t axis)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output);
+    ARM_COMPUTE_ERROR_ON(input_shapes.empty());
+    ARM_COMPUTE_ERROR_ON(axis >= TensorShape::num_max_dimensions);
+
+    const TensorShape &output_shape = output->info()->tensor_shape();
+    size_t             concat_size  = 0;
+    for (const auto &shape : input_shapes)
+    {
+        for (size_t d = 0; d < TensorShape::num_max_dimensions; ++d)
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(d != axis && shape[d] != output_shape[d],
+                                     "Inputs must match the output outside the concatenation axis");
+        }
+        concat_size += shape[axis];
+    }
+    ARM_COMPUTE_ERROR_ON_MSG(concat_size != output_shape[axis],
+                             "The inputs must add up to the output along the concatenation axis");
+    ARM_COMPUTE_UNUSED(output_shape, concat_size);
+
+    return create_views(output, input_shapes, axis);
+}
+
+std::vector<SubTensor> create_split_views(ITensor *input, const std::vector<size_t> &split_sizes, size_t axis)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input);
+    ARM_COMPUTE_ERROR_ON(split_sizes.empty());
+    ARM_COMPUTE_ERROR_ON(axis >= TensorShape::num_max_dimensions);
+
+    const TensorShape       &input_shape = input->info()->tensor_shape();
+    std::vector<TensorShape> shapes;
+    shapes.reserve(split_sizes.size());
+
+    size_t split_size_sum = 0;
+    for (const auto size : split_sizes)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(size == 0, "Empty splits are not supported");
+        shapes.emplace_back(TensorShape(input_shape).set(axis, size, false));
+        split_size_sum += size;
+    }
+    ARM_COMPUTE_ERROR_ON_MSG(split_size_sum != input_shape[axis],
+                             "The split sizes must add up to the input along the split axis");
+    ARM_COMPUTE_UNUSED(split_size_sum);
+
+    return create_views(input, shapes, axis);
+}
+
+std::vector<SubTensor> create_split_views(ITensor *input, unsigned int num_splits, size_t axis)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input);
+    ARM_COMPUTE_ERROR_ON(num_splits == 0);
+    ARM_COMPUTE_ERROR_ON(axis >= TensorShape::num_max_dimensions);
+
+    const size_t axis_size = input->info()->tensor_shape()[axis];
+    ARM_COMPUTE_ERROR_ON_MSG(axis_size % num_splits != 0, "The number of splits must divide the split axis");
+
+    return create_split_views(input, std::vector<size_t>(num_splits, axis_size / num_splits), axis);
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2020, 2024 Arm Limited.
+ * Copyright (c) 2016-2020, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -65,7 +65,8 @@ bool validate_subtensor_shape(const TensorInfo &parent_info, const TensorInfo &c
 }
 } // namespace
 
-TensorAllocator::TensorAllocator(IMemoryManageable *owner) : _owner(owner), _associated_memory_group(nullptr), _memory()
+TensorAllocator::TensorAllocator(IMemoryManageable *owner)
+    : _owner(owner), _associated_memory_group(nullptr), _memory(), _backing_allocator(nullptr)
 {
 }
 
@@ -78,11 +79,13 @@ TensorAllocator::TensorAllocator(TensorAllocator &&o) noexcept
     : ITensorAllocator(std::move(o)),
       _owner(o._owner),
       _associated_memory_group(o._associated_memory_group),
-      _memory(std::move(o._memory))
+      _memory(std::move(o._memory)),
+      _backing_allocator(o._backing_allocator)
 {
     o._owner                   = nullptr;
     o._associated_memory_group = nullptr;
     o._memory                  = Memory();
+    o._backing_allocator       = nullptr;
 }
 
 TensorAllocator &TensorAllocator::operator=(TensorAllocator &&o) noexcept
@@ -98,6 +101,9 @@ TensorAllocator &TensorAllocator::operator=(TensorAllocator &&o) noexcept
         _memory   = std::move(o._memory);
         o._memory = Memory();
 
+        _backing_allocator   = o._backing_allocator;
+        o._backing_allocator = nullptr;
+
         ITensorAllocator::operator=(std::move(o));
     }
     return *this;
@@ -136,7 +142,14 @@ void TensorAllocator::allocate()
     const size_t alignment_to_use = (alignment() != 0) ? alignment() : 64;
     if (_associated_memory_group == nullptr)
     {
-        _memory.set_owned_region(std::make_unique<MemoryRegion>(info().total_size(), alignment_to_use));
+        if (_backing_allocator != nullptr)
+        {
+            _memory.set_owned_region(_backing_allocator->make_region(info().total_size(), alignment_to_use));
+        }
+        else
+        {
+            _memory.set_owned_region(std::make_unique<MemoryRegion>(info().total_size(), alignment_to_use));
+        }
     }
     else
     {
@@ -177,6 +190,13 @@ void TensorAllocator::set_associated_memory_group(IMemoryGroup *associated_memor
     _associated_memory_group = associated_memory_group;
 }
 
+void TensorAllocator::set_backing_allocator(IAllocator *backing_allocator)
+{
+    ARM_COMPUTE_ERROR_ON(_memory.region() != nullptr && _memory.region()->buffer() != nullptr);
+
+    _backing_allocator = backing_allocator;
+}
+
 uint8_t *TensorAllocator::lock()
 {
     ARM_COMPUTE_ERROR_ON(_memory.region() == nullptr);
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/Tracer.h"
+
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+namespace arm_compute
+{
+static_assert((Tracer::capacity & (Tracer::capacity - 1)) == 0, "The capacity of the ring buffer must be a power of 2");
+
+/** Slot of the ring buffer, written and read as a sequence lock */
+struct Tracer::Slot
+{
+    std::atomic<uint64_t> sequence{0}; /**< Index of the event + 1 once written, 0 while being written */
+    const char           *category{nullptr};
+    char                  name[max_name_length + 1]{};
+    uint64_t              timestamp_ns{0};
+    uint32_t              thread_id{0};
+    Phase                 phase{Phase::INSTANT};
+};
+
+namespace
+{
+uint32_t current_thread_index()
+{
+    static std::atomic<uint32_t> num_threads{0};
+    thread_local const uint32_t  index = num_threads.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+uint64_t now_ns()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+void write_escaped(std::ostream &os, const std::string &str)
+{
+    for (const char c : str)
+    {
+        if (c == '"' || c == '\\')
+        {
+            os << '\\';
+        }
+        os << c;
+    }
+}
+
+const char *phase_to_string(Tracer::Phase phase)
+{
+    switch (phase)
+    {
+        case Tracer::Phase::BEGIN:
+            return "B";
+        case Tracer::Phase::END:
+            return "E";
+        case Tracer::Phase::INSTANT:
+        default:
+            return "i";
+    }
+}
+} // namespace
+
+Tracer &Tracer::get()
+{
+    static Tracer tracer;
+    return tracer;
+}
+
+Tracer::Tracer() : _slots(new Slot[capacity])
+{
+}
+
+Tracer::~Tracer()
+{
+    const std::string file = utility::getenv("ARM_COMPUTE_TRACE_FILE");
+    if (!file.empty())
+    {
+        std::ofstream os(file);
+        dump(os);
+    }
+}
+
+void Tracer::set_enabled(bool enabled)
+{
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Tracer::record(const char *category, const char *name, Phase phase)
+{
+    if (!is_enabled())
+    {
+        return;
+    }
+
+    const uint64_t index = _next.fetch_add(1, std::memory_order_relaxed);
+    Slot          &slot  = _slots[index & (capacity - 1)];
+
+    // Mark the slot as being written before overwriting it
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.category = category;
+    std::strncpy(slot.name, name != nullptr ? name : "", max_name_length);
+    slot.name[max_name_length] = '\0';
+    slot.timestamp_ns          = now_ns();
+    slot.thread_id             = current_thread_index();
+    slot.phase                 = phase;
+
+    slot.sequence.store(index + 1, std::memory_order_release);
+}
+
+std::vector<Tracer::Event> Tracer::events() const
+{
+    const uint64_t     end   = _next.load(std::memory_order_acquire);
+    const uint64_t     begin = end > capacity ? end - capacity : 0;
+    std::vector<Event> events;
+    events.reserve(static_cast<size_t>(end - begin));
+    for (uint64_t index = begin; index < end; ++index)
+    {
+        const Slot &slot = _slots[index & (capacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != index + 1)
+        {
+            // Being written, or already overwritten by a newer event
+            continue;
+        }
+        Event event{slot.category != nullptr ? slot.category : "", std::string(slot.name), slot.timestamp_ns,
+                    slot.thread_id, slot.phase};
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == index + 1)
+        {
+            events.push_back(std::move(event));
+        }
+    }
+    return events;
+}
+
+void Tracer::dump(std::ostream &os) const
+{
+    os << R"({"traceEvents":[)";
+    bool first = true;
+    for (const auto &event : events())
+    {
+        os << (first ? "" : ",") << R"({"name":")";
+        write_escaped(os, event.name);
+        os << R"(","cat":")" << event.category << R"(","ph":")" << phase_to_string(event.phase)
+           << R"(","ts":)" << event.timestamp_ns / 1000 << "." << event.timestamp_ns % 1000 / 100
+           << R"(,"pid":0,"tid":)" << event.thread_id;
+        if (event.phase == Phase::INSTANT)
+        {
+            os << R"(,"s":"t")";
+        }
+        os << "}";
+        first = false;
+    }
+    os << "]}\n";
+}
+
+void Tracer::clear()
+{
+    // The cleared slots no longer match the index of any event, so they are skipped when read
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        _slots[i].sequence.store(0, std::memory_order_relaxed);
+    }
+}
+
+TraceScope::TraceScope(const char *category, const char *name)
+    : _category(category), _recorded(Tracer::get().is_enabled())
+{
+    if (_recorded)
+    {
+        Tracer::get().record(category, name, Tracer::Phase::BEGIN);
+    }
+}
+
+TraceScope::~TraceScope()
+{
+    if (_recorded)
+    {
+        Tracer::get().record(_category, "", Tracer::Phase::END);
+    }
+}
+} // namespace arm_compute
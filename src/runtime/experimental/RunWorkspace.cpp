@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/experimental/RunWorkspace.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace experimental
+{
+struct RunWorkspace::Impl
+{
+    /** Temporary tensor of the function */
+    struct Element
+    {
+        int                     slot{0};
+        std::unique_ptr<Tensor> tensor{nullptr};
+    };
+
+    std::vector<Element> elements{};
+    size_t               total_size{0};
+};
+
+RunWorkspace::RunWorkspace() : impl_(std::make_unique<Impl>())
+{
+}
+
+RunWorkspace::RunWorkspace(RunWorkspace &&)            = default;
+RunWorkspace &RunWorkspace::operator=(RunWorkspace &&) = default;
+RunWorkspace::~RunWorkspace()                          = default;
+
+void RunWorkspace::configure(const MemoryRequirements &mem_reqs)
+{
+    impl_->elements.clear();
+    impl_->total_size = 0;
+    for (const auto &req : mem_reqs)
+    {
+        if (req.size == 0 || req.lifetime != MemoryLifetime::Temporary)
+        {
+            continue;
+        }
+
+        Impl::Element e;
+        e.slot   = req.slot;
+        e.tensor = std::make_unique<Tensor>();
+        e.tensor->allocator()->init(TensorInfo(TensorShape(req.size), 1, DataType::U8), req.alignment);
+        e.tensor->allocator()->allocate();
+        impl_->total_size += req.size;
+        impl_->elements.push_back(std::move(e));
+    }
+}
+
+size_t RunWorkspace::total_size() const
+{
+    return impl_->total_size;
+}
+
+void RunWorkspace::add_to_pack(ITensorPack &pack)
+{
+    for (auto &e : impl_->elements)
+    {
+        pack.add_tensor(e.slot, e.tensor.get());
+    }
+}
+} // namespace experimental
+} // namespace arm_compute
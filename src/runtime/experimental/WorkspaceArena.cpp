@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/experimental/WorkspaceArena.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace experimental
+{
+namespace
+{
+/** Default alignment of tensor allocations, used when a workspace tensor does not request one */
+constexpr size_t default_alignment = 64;
+
+size_t align_offset(size_t offset, size_t alignment)
+{
+    const size_t remainder = offset % alignment;
+    return (remainder != 0U) ? offset + (alignment - remainder) : offset;
+}
+} // namespace
+
+struct WorkspaceArena::Impl
+{
+    /** Workspace tensor of one operator, viewing the arena at an offset */
+    struct Element
+    {
+        size_t                  index{0};
+        int                     slot{0};
+        size_t                  offset{0};
+        std::unique_ptr<Tensor> tensor{nullptr};
+    };
+
+    std::vector<Element> elements{};
+    size_t               total_size{0};
+    size_t               alignment{default_alignment};
+    Tensor               arena{};
+    bool                 is_bound{false};
+
+    void bind(uint8_t *memory)
+    {
+        for (auto &e : elements)
+        {
+            e.tensor->allocator()->import_memory(memory + e.offset);
+        }
+        is_bound = true;
+    }
+};
+
+WorkspaceArena::WorkspaceArena() : impl_(std::make_unique<Impl>())
+{
+}
+
+WorkspaceArena::WorkspaceArena(WorkspaceArena &&)            = default;
+WorkspaceArena &WorkspaceArena::operator=(WorkspaceArena &&) = default;
+WorkspaceArena::~WorkspaceArena()                            = default;
+
+void WorkspaceArena::configure(const std::vector<const IOperator *> &operators)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(impl_->is_bound, "The arena is already allocated");
+
+    struct Request
+    {
+        size_t index;
+        int    slot;
+        size_t size;
+        bool   is_persistent;
+        size_t region;
+    };
+
+    // Temporary and prepare-only tensors of different operators are never alive together, so the n-th largest of
+    // each operator shares the n-th region. Persistent tensors are alive through every run and get a region each.
+    std::vector<size_t>  shared_sizes;
+    std::vector<size_t>  persistent_sizes;
+    std::vector<Request> requests;
+    size_t               alignment = default_alignment;
+    for (size_t index = 0; index < operators.size(); ++index)
+    {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(operators[index]);
+
+        std::vector<MemoryInfo> shared;
+        for (const auto &info : operators[index]->workspace())
+        {
+            if (info.size == 0)
+            {
+                continue;
+            }
+            alignment = std::max(alignment, info.alignment);
+            if (info.lifetime == MemoryLifetime::Persistent)
+            {
+                requests.push_back({index, info.slot, info.size, true, persistent_sizes.size()});
+                persistent_sizes.push_back(info.size);
+            }
+            else
+            {
+                shared.push_back(info);
+            }
+        }
+
+        std::stable_sort(shared.begin(), shared.end(),
+                         [](const MemoryInfo &a, const MemoryInfo &b) { return a.size > b.size; });
+        for (size_t rank = 0; rank < shared.size(); ++rank)
+        {
+            if (rank == shared_sizes.size())
+            {
+                shared_sizes.push_back(0);
+            }
+            shared_sizes[rank] = std::max(shared_sizes[rank], shared[rank].size);
+            requests.push_back({index, shared[rank].slot, shared[rank].size, false, rank});
+        }
+    }
+
+    // Lay the shared regions out first, then the persistent ones
+    std::vector<size_t> shared_offsets(shared_sizes.size());
+    std::vector<size_t> persistent_offsets(persistent_sizes.size());
+    size_t              offset = 0;
+    for (size_t region = 0; region < shared_sizes.size(); ++region)
+    {
+        shared_offsets[region] = offset;
+        offset                 = align_offset(offset + shared_sizes[region], alignment);
+    }
+    for (size_t region = 0; region < persistent_sizes.size(); ++region)
+    {
+        persistent_offsets[region] = offset;
+        offset                     = align_offset(offset + persistent_sizes[region], alignment);
+    }
+
+    impl_->elements.clear();
+    for (const auto &r : requests)
+    {
+        Impl::Element e;
+        e.index  = r.index;
+        e.slot   = r.slot;
+        e.offset = r.is_persistent ? persistent_offsets[r.region] : shared_offsets[r.region];
+        e.tensor = std::make_unique<Tensor>();
+        e.tensor->allocator()->init(TensorInfo(TensorShape(r.size), 1, DataType::U8));
+        impl_->elements.push_back(std::move(e));
+    }
+    impl_->total_size = offset;
+    impl_->alignment  = alignment;
+}
+
+size_t WorkspaceArena::total_size() const
+{
+    return impl_->total_size;
+}
+
+size_t WorkspaceArena::alignment() const
+{
+    return impl_->alignment;
+}
+
+void WorkspaceArena::allocate()
+{
+    if (impl_->total_size == 0)
+    {
+        impl_->is_bound = true;
+        return;
+    }
+    impl_->arena.allocator()->init(TensorInfo(TensorShape(impl_->total_size), 1, DataType::U8), impl_->alignment);
+    impl_->arena.allocator()->allocate();
+    impl_->bind(impl_->arena.buffer());
+}
+
+void WorkspaceArena::import_memory(void *memory)
+{
+    ARM_COMPUTE_ERROR_ON(memory == nullptr && impl_->total_size != 0);
+    ARM_COMPUTE_ERROR_ON_MSG(!utility::check_aligned(memory, impl_->alignment), "Arena memory is not aligned");
+    impl_->bind(static_cast<uint8_t *>(memory));
+}
+
+void WorkspaceArena::add_to_pack(size_t index, ITensorPack &pack)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!impl_->is_bound, "The arena must be allocated or imported first");
+    for (auto &e : impl_->elements)
+    {
+        if (e.index == index)
+        {
+            pack.add_tensor(e.slot, e.tensor.get());
+        }
+    }
+}
+} // namespace experimental
+} // namespace arm_compute
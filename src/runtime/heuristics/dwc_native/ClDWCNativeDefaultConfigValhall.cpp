@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -89,7 +89,6 @@ DWCComputeKernelInfo ClDWCNativeDefaultConfigValhall::configure_G78_f32(const IT
         const size_t      kernel_c  = wei_shape[idx_c];
         const size_t      kernel_w  = wei_shape[idx_w];
 
-        desc.export_input_to_cl_image   = false;
         desc.export_weights_to_cl_image = use_cl_image_for_weights(wei, depth_multiplier);
 
         if (depth_multiplier == 1)
@@ -118,6 +117,8 @@ DWCComputeKernelInfo ClDWCNativeDefaultConfigValhall::configure_G78_f32(const IT
 
         desc.n0 = adjust_vec_size(desc.n0, kernel_c);
 
+        desc.export_input_to_cl_image = use_cl_image_for_input(src, wei, depth_multiplier, desc.n0);
+
         // Set m0 only if stride_x == 1 and dilation_x == 1
         if (conv_info.stride().first == 1 && dilation.x() == 1)
         {
@@ -158,7 +159,6 @@ DWCComputeKernelInfo ClDWCNativeDefaultConfigValhall::configure_G78_f16(const IT
         const size_t      kernel_c  = wei_shape[idx_c];
         const size_t      kernel_w  = wei_shape[idx_w];
 
-        desc.export_input_to_cl_image   = false;
         desc.export_weights_to_cl_image = use_cl_image_for_weights(wei, depth_multiplier);
 
         if (depth_multiplier == 1)
@@ -194,6 +194,8 @@ DWCComputeKernelInfo ClDWCNativeDefaultConfigValhall::configure_G78_f16(const IT
 
         desc.n0 = adjust_vec_size(desc.n0, kernel_c);
 
+        desc.export_input_to_cl_image = use_cl_image_for_input(src, wei, depth_multiplier, desc.n0);
+
         // Set m0 only if stride_x == 1 and dilation_x == 1
         if (conv_info.stride().first == 1 && dilation.x() == 1)
         {
@@ -266,7 +268,6 @@ DWCComputeKernelInfo ClDWCNativeDefaultConfigValhall::configure_G77_f16(const IT
         const size_t      kernel_c  = wei_shape[idx_c];
         const size_t      kernel_w  = wei_shape[idx_w];
 
-        desc.export_input_to_cl_image   = false;
         desc.export_weights_to_cl_image = use_cl_image_for_weights(wei, depth_multiplier);
 
         if (depth_multiplier == 1)
@@ -302,6 +303,8 @@ DWCComputeKernelInfo ClDWCNativeDefaultConfigValhall::configure_G77_f16(const IT
 
         desc.n0 = adjust_vec_size(desc.n0, kernel_c);
 
+        desc.export_input_to_cl_image = use_cl_image_for_input(src, wei, depth_multiplier, desc.n0);
+
         // Set m0 only if stride_x == 1 and dilation_x == 1
         if (conv_info.stride().first == 1 && dilation.x() == 1)
         {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -57,5 +57,27 @@ bool use_cl_image_for_weights(const ITensorInfo *weights, unsigned int depth_mul
 
     return true;
 }
+
+bool use_cl_image_for_input(const ITensorInfo *src,
+                            const ITensorInfo *weights,
+                            unsigned int       depth_multiplier,
+                            unsigned int       n0)
+{
+    // The cl image is created from the start of the buffer and is read by blocks of 4 channels
+    if (depth_multiplier != 1 || (n0 % 4) != 0 || src->lock_paddings() || src->offset_first_element_in_bytes() != 0 ||
+        !export_to_cl_image(src))
+    {
+        return false;
+    }
+
+    const size_t idx_w    = get_data_layout_dimension_index(weights->data_layout(), DataLayoutDimension::WIDTH);
+    const size_t idx_h    = get_data_layout_dimension_index(weights->data_layout(), DataLayoutDimension::HEIGHT);
+    const size_t kernel_w = weights->tensor_shape()[idx_w];
+    const size_t kernel_h = weights->tensor_shape()[idx_h];
+
+    // Neighbouring work-items only read the same input rows through the texture cache when the kernel covers more
+    // than one element. With a 1x1 kernel, every input element is read once and the cl buffer storage is preferred.
+    return (kernel_w * kernel_h) > 1;
+}
 } // namespace cl_dwc
 } // namespace arm_compute
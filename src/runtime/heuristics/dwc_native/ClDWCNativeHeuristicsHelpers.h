@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,20 @@ namespace cl_dwc
  */
 bool use_cl_image_for_weights(const ITensorInfo *weights, unsigned int depth_multiplier);
 
+/** Utility function to know whether we can use the cl image storage for the input of depthwise convolution to get better performance
+ *
+ * @param[in] src              Input TensorInfo of the depthwise convolution
+ * @param[in] weights          Weights TensorInfo of the depthwise convolution
+ * @param[in] depth_multiplier Depth multiplier
+ * @param[in] n0               Number of output channels processed by each work-item
+ *
+ * @return true if the input of depthwise convolution can be read through the cl image storage to improve the performance
+ */
+bool use_cl_image_for_input(const ITensorInfo *src,
+                            const ITensorInfo *weights,
+                            unsigned int       depth_multiplier,
+                            unsigned int       n0);
+
 } // namespace cl_dwc
 } // namespace arm_compute
 #endif /* SRC_RUNTIME_HEURISTICS_DWC_NATIVE_CLDWCNATIVEHEURISTICSHELPERS */
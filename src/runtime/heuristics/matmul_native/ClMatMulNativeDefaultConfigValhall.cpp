@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -90,7 +90,10 @@ ClMatMulNativeDefaultConfigValhall::configure(const ITensorInfo *lhs, const ITen
     const unsigned int b = lhs_shape.z();
 
     ARM_COMPUTE_ERROR_ON_MSG(func == nullptr, "Data type not supported for matmul native");
-    return (this->*func)(m, n, k, b, rhs->lock_paddings(), info);
+    const MatMulKernelInfo desc = (this->*func)(m, n, k, b, rhs->lock_paddings(), info);
+
+    // Quantized workloads run on the MatMul Lowp Native kernel, which only reads the LHS from buffer
+    return is_data_type_float(lhs->data_type()) ? select_lhs_info(desc, lhs, rhs, n, k) : desc;
 }
 
 MatMulKernelInfo ClMatMulNativeDefaultConfigValhall::configure_G715_f32(
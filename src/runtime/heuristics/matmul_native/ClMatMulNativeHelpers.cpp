@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 #include "src/gpu/cl/kernels/ClMatMulNativeKernel.h"
 
 #include <limits>
+#include <memory>
 #include <utility>
 
 namespace arm_compute
@@ -78,6 +79,40 @@ MatMulKernelInfo select_info(const MatMulKernelInfo &info0,
     }
 }
 
+MatMulKernelInfo select_lhs_info(
+    const MatMulKernelInfo &info, const ITensorInfo *lhs, const ITensorInfo *rhs, unsigned int n, unsigned int k)
+{
+    constexpr unsigned int min_n_blocks = 8;
+    constexpr unsigned int min_k        = 64;
+
+    if (info.adj_lhs || !lhs->is_resizable() || lhs->lock_paddings() || lhs->offset_first_element_in_bytes() != 0)
+    {
+        return info;
+    }
+
+    const unsigned int n_blocks = (n + info.n0 - 1) / info.n0;
+    if (n_blocks < min_n_blocks || k < min_k)
+    {
+        return info;
+    }
+
+    MatMulKernelInfo info_img       = info;
+    info_img.export_lhs_to_cl_image = true;
+
+    // Validate on clones so that the caller's tensor infos are not affected by the padding required by cl_image
+    const std::unique_ptr<ITensorInfo> lhs_info = lhs->clone();
+    const std::unique_ptr<ITensorInfo> rhs_info = rhs->clone();
+    TensorInfo                         dst_info;
+
+    if (bool(opencl::kernels::ClMatMulNativeKernel::validate(lhs_info.get(), rhs_info.get(), nullptr, &dst_info,
+                                                             info_img)))
+    {
+        return info_img;
+    }
+
+    return info;
+}
+
 MatMulKernelInfo find_info(const MatMulNativeConfigsMatrix &configs,
                            bool                             adj_lhs,
                            bool                             adj_rhs,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@ namespace arm_compute
 {
 // Forward declaration
 struct MatMulKernelInfo;
+class ITensorInfo;
 
 namespace cl_matmul
 {
@@ -59,6 +60,23 @@ MatMulKernelInfo select_info(const MatMulKernelInfo &info0,
                              DataType                data_type,
                              bool                    rhs_lock_padding);
 
+/** Decide whether the LHS tensor of the MatMul Native kernel should be read through cl_image
+ *
+ * The LHS is worth reading through the texture cache when the same LHS rows are loaded by many work-items
+ * along N and the inner dimension is large enough to amortize the image creation.
+ * If the kernel does not accept the cl_image configuration, @p info is returned unchanged.
+ *
+ * @param[in] info MatMulKernelInfo selected for the workload
+ * @param[in] lhs  Input tensor info for the LHS matrix
+ * @param[in] rhs  Input tensor info for the RHS matrix
+ * @param[in] n    Number of columns (N) in the RHS matrix not reshaped
+ * @param[in] k    Number of rows (K) in the RHS matrix not reshaped
+ *
+ * @return @ref MatMulKernelInfo
+ */
+MatMulKernelInfo select_lhs_info(
+    const MatMulKernelInfo &info, const ITensorInfo *lhs, const ITensorInfo *rhs, unsigned int n, unsigned int k);
+
 /** Find the preferred configurations for the MatMul Native kernel using the MatMulNativeConfigsMatrix provided by the user
  *
  * @param[in] configs List of best configurations for a limited number of MatMul shapes
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/runtime/heuristics/matmul_native/ClScaledDotProductAttentionKernelConfig.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/utils/helpers/AdjustVecSize.h"
+
+namespace arm_compute
+{
+namespace cl_matmul
+{
+opencl::kernels::ClScaledDotProductAttentionKernelInfo
+configure_scaled_dot_product_attention(GPUTarget          gpu_target,
+                                       const ITensorInfo *q,
+                                       const ITensorInfo *k,
+                                       const ITensorInfo *v)
+{
+    ARM_COMPUTE_UNUSED(gpu_target, k);
+
+    const unsigned int d       = q->dimension(0);
+    const unsigned int sq      = q->dimension(1);
+    const unsigned int dv      = v->dimension(0);
+    const bool         is_fp16 = q->data_type() == DataType::F16;
+
+    opencl::kernels::ClScaledDotProductAttentionKernelInfo info{};
+
+    // The MMUL variant keeps a row of the output per work-item in registers, so large value depths fall back to native
+    if (arm_matrix_multiply_supported(CLKernelLibrary::get().get_device()) && (d % 4) == 0 && (dv % 4) == 0 &&
+        dv <= 128)
+    {
+        info.use_mmul = true;
+        info.n0       = 4;
+        return info;
+    }
+
+    info.m0 = sq >= 4 ? 4 : sq;
+    info.n0 = 4;
+    for (int k0 : {is_fp16 ? 8 : 4, 2, 1})
+    {
+        if ((d % k0) == 0)
+        {
+            info.k0 = k0;
+            break;
+        }
+    }
+    info.dv0 = adjust_vec_size(is_fp16 ? 16 : 8, dv);
+    return info;
+}
+} // namespace cl_matmul
+} // namespace arm_compute
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_RUNTIME_HEURISTICS_MATMUL_NATIVE_CLSCALEDDOTPRODUCTATTENTIONKERNELCONFIG_H
+#define ACL_SRC_RUNTIME_HEURISTICS_MATMUL_NATIVE_CLSCALEDDOTPRODUCTATTENTIONKERNELCONFIG_H
+
+#include "arm_compute/core/GPUTarget.h"
+#include "arm_compute/core/ITensorInfo.h"
+
+#include "src/gpu/cl/kernels/ClScaledDotProductAttentionKernel.h"
+
+namespace arm_compute
+{
+namespace cl_matmul
+{
+/** Select the variant and block sizes of @ref opencl::kernels::ClScaledDotProductAttentionKernel
+ *
+ * The MMUL variant is preferred when the cl_arm_matrix_multiply extension is available and the depths of the
+ * queries and values are multiples of the MMUL block. Otherwise the native variant is configured with the widest
+ * K0 dividing the depth of the queries.
+ *
+ * @param[in] gpu_target GPU target
+ * @param[in] q          Queries tensor info
+ * @param[in] k          Keys tensor info
+ * @param[in] v          Values tensor info
+ *
+ * @return @ref opencl::kernels::ClScaledDotProductAttentionKernelInfo
+ */
+opencl::kernels::ClScaledDotProductAttentionKernelInfo
+configure_scaled_dot_product_attention(GPUTarget          gpu_target,
+                                       const ITensorInfo *q,
+                                       const ITensorInfo *k,
+                                       const ITensorInfo *v);
+} // namespace cl_matmul
+} // namespace arm_compute
+#endif // ACL_SRC_RUNTIME_HEURISTICS_MATMUL_NATIVE_CLSCALEDDOTPRODUCTATTENTIONKERNELCONFIG_H
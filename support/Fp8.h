@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SUPPORT_FP8_H
+#define ACL_SUPPORT_FP8_H
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace arm_compute
+{
+namespace fp8
+{
+namespace detail
+{
+/** Decode an 8-bit floating-point number of @p mant_bits mantissa bits and an exponent biased by @p bias
+ *
+ * The special values are not handled here, see @ref e4m3_to_float and @ref e5m2_to_float.
+ */
+template <unsigned int mant_bits, int bias>
+inline float decode(uint8_t v)
+{
+    const unsigned int mag      = v & 0x7F;
+    const int          exponent = static_cast<int>(mag >> mant_bits);
+    const unsigned int mantissa = mag & ((1U << mant_bits) - 1);
+
+    // Subnormals have the exponent of the smallest normal number without its implicit leading bit
+    const float res = exponent == 0
+                          ? std::ldexp(static_cast<float>(mantissa), 1 - bias - static_cast<int>(mant_bits))
+                          : std::ldexp(static_cast<float>((1U << mant_bits) | mantissa),
+                                       exponent - bias - static_cast<int>(mant_bits));
+    return (v & 0x80) != 0 ? -res : res;
+}
+
+/** Encode a float as an 8-bit floating-point number rounding to the nearest even
+ *
+ * @param[in] v          Value to encode.
+ * @param[in] max_finite Encoding of the largest finite magnitude.
+ * @param[in] overflow   Encoding of the magnitudes rounding above @p max_finite.
+ * @param[in] nan        Encoding of NaN.
+ */
+template <unsigned int mant_bits, int bias>
+inline uint8_t encode(float v, uint8_t max_finite, uint8_t overflow, uint8_t nan)
+{
+    uint32_t bits = 0;
+    std::memcpy(&bits, &v, sizeof(bits));
+    const uint8_t  sign = static_cast<uint8_t>((bits >> 24) & 0x80);
+    const uint32_t abs  = bits & 0x7FFFFFFF;
+
+    if (abs > 0x7F800000)
+    {
+        return sign | nan;
+    }
+
+    constexpr int min_normal_exp = 1 - bias;
+    const float   abs_v          = std::fabs(v);
+    if (abs_v < std::ldexp(1.f, min_normal_exp))
+    {
+        // Subnormal, the scaling by a power of two is exact so only the rounding to an integer can round
+        const float q = std::nearbyint(std::ldexp(abs_v, static_cast<int>(mant_bits) - min_normal_exp));
+        return sign | static_cast<uint8_t>(q);
+    }
+
+    // Round the mantissa to nearest even on the float bits, a carry into the exponent gives the next binade
+    constexpr unsigned int shift   = 23 - mant_bits;
+    const uint64_t         rounded = static_cast<uint64_t>(abs) + ((1U << (shift - 1)) - 1) + ((abs >> shift) & 1);
+    const uint64_t         encoded = (rounded >> shift) - (static_cast<uint64_t>(127 - bias) << mant_bits);
+    return sign | (encoded > max_finite ? overflow : static_cast<uint8_t>(encoded));
+}
+} // namespace detail
+
+/** Convert an E4M3 8-bit floating-point number to float
+ *
+ * E4M3 has no infinities, the all-ones magnitude is NaN.
+ *
+ * @param[in] v Bits of the E4M3 number
+ *
+ * @return Converted value
+ */
+inline float e4m3_to_float(uint8_t v)
+{
+    if ((v & 0x7F) == 0x7F)
+    {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    return detail::decode<3, 7>(v);
+}
+
+/** Convert an E5M2 8-bit floating-point number to float
+ *
+ * @param[in] v Bits of the E5M2 number
+ *
+ * @return Converted value
+ */
+inline float e5m2_to_float(uint8_t v)
+{
+    if ((v & 0x7C) == 0x7C)
+    {
+        const float res =
+            (v & 0x03) == 0 ? std::numeric_limits<float>::infinity() : std::numeric_limits<float>::quiet_NaN();
+        return (v & 0x80) != 0 ? -res : res;
+    }
+    return detail::decode<2, 15>(v);
+}
+
+/** Convert a float to an E4M3 8-bit floating-point number rounding to the nearest even
+ *
+ * @param[in] v        Value to convert
+ * @param[in] saturate (Optional) Whether the magnitudes above the largest one, 448, saturate or become NaN
+ *
+ * @return Bits of the E4M3 number
+ */
+inline uint8_t float_to_e4m3(float v, bool saturate = true)
+{
+    return detail::encode<3, 7>(v, 0x7E, saturate ? 0x7E : 0x7F, 0x7F);
+}
+
+/** Convert a float to an E5M2 8-bit floating-point number rounding to the nearest even
+ *
+ * @param[in] v        Value to convert
+ * @param[in] saturate (Optional) Whether the magnitudes above the largest one, 57344, saturate or become infinities
+ *
+ * @return Bits of the E5M2 number
+ */
+inline uint8_t float_to_e5m2(float v, bool saturate = true)
+{
+    // Infinities only stay infinite when not saturating
+    return detail::encode<2, 15>(v, 0x7B, saturate ? 0x7B : 0x7C, 0x7F);
+}
+} // namespace fp8
+} // namespace arm_compute
+#endif // ACL_SUPPORT_FP8_H
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/CLTensorAllocator.h"
+#include "arm_compute/runtime/CL/functions/CLConvolutionLayer.h"
+#include "arm_compute/runtime/CL/functions/CLDirectConvolutionLayer.h"
+#include "arm_compute/runtime/CL/functions/CLFFTConvolutionLayer.h"
+#include "arm_compute/runtime/CL/functions/CLGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/CL/functions/CLIndirectConvolutionLayer.h"
+#include "arm_compute/runtime/CL/functions/CLWinogradConvolutionLayer.h"
+#include "tests/CL/CLAccessor.h"
+#include "tests/benchmark/fixtures/CLTunerFixture.h"
+#include "tests/benchmark/fixtures/ConvolutionLayerFixture.h"
+#include "tests/datasets/system_tests/googlenet/inceptionv1/GoogLeNetInceptionV1ConvolutionLayerDataset.h"
+#include "tests/datasets/system_tests/mobilenet/MobileNetConvolutionLayerDataset.h"
+#include "tests/datasets/system_tests/vgg/vgg16/VGG16ConvolutionLayerDataset.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto data_types   = framework::dataset::make("DataType", { DataType::F16, DataType::F32 });
+const auto data_layouts = framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC });
+const auto no_fast_math = framework::dataset::make("FastMath", { false });
+} // namespace
+
+using CLConvolutionLayerFixture         = ConvolutionLayerFixture<CLTensor, CLConvolutionLayer, CLAccessor>;
+using CLGEMMConvolutionLayerFixture     = ConvolutionLayerFixture<CLTensor, CLGEMMConvolutionLayer, CLAccessor>;
+using CLWinogradConvolutionLayerFixture = ConvolutionLayerFixture<CLTensor, CLWinogradConvolutionLayer, CLAccessor>;
+using CLDirectConvolutionLayerFixture   = ConvolutionLayerFixture<CLTensor, CLDirectConvolutionLayer, CLAccessor>;
+using CLIndirectConvolutionLayerFixture = ConvolutionLayerFixture<CLTensor, CLIndirectConvolutionLayer, CLAccessor>;
+using CLFFTConvolutionLayerFixture      = ConvolutionLayerFixture<CLTensor, CLFFTConvolutionLayer, CLAccessor>;
+
+TEST_SUITE(CL)
+TEST_SUITE(TunerOff)
+TEST_SUITE(ConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV1, CLTunerOffFixture<CLConvolutionLayerFixture>, framework::DatasetMode::ALL, combine(datasets::GoogLeNetInceptionV1ConvolutionLayerDataset(), data_types, data_layouts, no_fast_math));
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16, CLTunerOffFixture<CLConvolutionLayerFixture>, framework::DatasetMode::NIGHTLY, combine(datasets::VGG16ConvolutionLayerDataset(), data_types, data_layouts,
+                                                                                                                                   framework::dataset::make("FastMath", { false, true })));
+TEST_SUITE_END() // ConvolutionLayer
+
+TEST_SUITE(GEMMConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(MobileNet, CLTunerOffFixture<CLGEMMConvolutionLayerFixture>, framework::DatasetMode::ALL, combine(datasets::MobileNetConvolutionLayerDataset(), data_types, data_layouts, no_fast_math));
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16, CLTunerOffFixture<CLGEMMConvolutionLayerFixture>, framework::DatasetMode::NIGHTLY, combine(datasets::VGG16ConvolutionLayerDataset(), data_types, data_layouts, no_fast_math));
+TEST_SUITE_END() // GEMMConvolutionLayer
+
+TEST_SUITE(WinogradConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16, CLTunerOffFixture<CLWinogradConvolutionLayerFixture>, framework::DatasetMode::ALL, combine(datasets::VGG16ConvolutionLayerDataset(), data_types, data_layouts,
+                                                                                                                                        framework::dataset::make("FastMath", { true })));
+TEST_SUITE_END() // WinogradConvolutionLayer
+
+TEST_SUITE(DirectConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16, CLTunerOffFixture<CLDirectConvolutionLayerFixture>, framework::DatasetMode::ALL, combine(datasets::VGG16DirectConvolutionLayerDataset(), data_types, data_layouts, no_fast_math));
+TEST_SUITE_END() // DirectConvolutionLayer
+
+// The indirect convolution only supports NHWC
+TEST_SUITE(IndirectConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16, CLTunerOffFixture<CLIndirectConvolutionLayerFixture>, framework::DatasetMode::ALL, combine(datasets::VGG16DirectConvolutionLayerDataset(), data_types,
+                                                                                                                                        framework::dataset::make("DataLayout", { DataLayout::NHWC }), no_fast_math));
+TEST_SUITE_END() // IndirectConvolutionLayer
+
+// The FFT convolution only supports unit strides
+TEST_SUITE(FFTConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16, CLTunerOffFixture<CLFFTConvolutionLayerFixture>, framework::DatasetMode::NIGHTLY, combine(datasets::VGG16ConvolutionLayerDataset(), framework::dataset::make("DataType", { DataType::F32 }),
+                                                                                                                                       data_layouts, no_fast_math));
+TEST_SUITE_END() // FFTConvolutionLayer
+TEST_SUITE_END() // TunerOff
+
+TEST_SUITE(TunerOn)
+TEST_SUITE(ConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV1, CLTunerOnFixture<CLConvolutionLayerFixture>, framework::DatasetMode::ALL, combine(datasets::GoogLeNetInceptionV1ConvolutionLayerDataset(), data_types, data_layouts, no_fast_math));
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16, CLTunerOnFixture<CLConvolutionLayerFixture>, framework::DatasetMode::NIGHTLY, combine(datasets::VGG16ConvolutionLayerDataset(), data_types, data_layouts,
+                                                                                                                                  framework::dataset::make("FastMath", { false, true })));
+TEST_SUITE_END() // ConvolutionLayer
+
+TEST_SUITE(GEMMConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(MobileNet, CLTunerOnFixture<CLGEMMConvolutionLayerFixture>, framework::DatasetMode::ALL, combine(datasets::MobileNetConvolutionLayerDataset(), data_types, data_layouts, no_fast_math));
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16, CLTunerOnFixture<CLGEMMConvolutionLayerFixture>, framework::DatasetMode::NIGHTLY, combine(datasets::VGG16ConvolutionLayerDataset(), data_types, data_layouts, no_fast_math));
+TEST_SUITE_END() // GEMMConvolutionLayer
+
+TEST_SUITE(WinogradConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16, CLTunerOnFixture<CLWinogradConvolutionLayerFixture>, framework::DatasetMode::ALL, combine(datasets::VGG16ConvolutionLayerDataset(), data_types, data_layouts,
+                                                                                                                                       framework::dataset::make("FastMath", { true })));
+TEST_SUITE_END() // WinogradConvolutionLayer
+
+TEST_SUITE(DirectConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16, CLTunerOnFixture<CLDirectConvolutionLayerFixture>, framework::DatasetMode::ALL, combine(datasets::VGG16DirectConvolutionLayerDataset(), data_types, data_layouts, no_fast_math));
+TEST_SUITE_END() // DirectConvolutionLayer
+
+TEST_SUITE(IndirectConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16, CLTunerOnFixture<CLIndirectConvolutionLayerFixture>, framework::DatasetMode::ALL, combine(datasets::VGG16DirectConvolutionLayerDataset(), data_types,
+                                                                                                                                       framework::dataset::make("DataLayout", { DataLayout::NHWC }), no_fast_math));
+TEST_SUITE_END() // IndirectConvolutionLayer
+
+TEST_SUITE(FFTConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16, CLTunerOnFixture<CLFFTConvolutionLayerFixture>, framework::DatasetMode::NIGHTLY, combine(datasets::VGG16ConvolutionLayerDataset(), framework::dataset::make("DataType", { DataType::F32 }),
+                                                                                                                                      data_layouts, no_fast_math));
+TEST_SUITE_END() // FFTConvolutionLayer
+TEST_SUITE_END() // TunerOn
+TEST_SUITE_END() // CL
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
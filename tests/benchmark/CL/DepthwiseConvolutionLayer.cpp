@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/CLTensorAllocator.h"
+#include "arm_compute/runtime/CL/functions/CLDepthwiseConvolutionLayer.h"
+#include "tests/CL/CLAccessor.h"
+#include "tests/benchmark/fixtures/CLTunerFixture.h"
+#include "tests/benchmark/fixtures/DepthwiseConvolutionLayerFixture.h"
+#include "tests/datasets/system_tests/mobilenet/MobileNetDepthwiseConvolutionLayerDataset.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto data_types   = framework::dataset::make("DataType", { DataType::F16, DataType::F32 });
+const auto data_layouts = framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC });
+} // namespace
+
+using CLDepthwiseConvolutionLayerFixture = DepthwiseConvolutionLayerFixture<CLTensor, CLDepthwiseConvolutionLayer, CLAccessor>;
+
+TEST_SUITE(CL)
+TEST_SUITE(TunerOff)
+TEST_SUITE(DepthwiseConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(MobileNet, CLTunerOffFixture<CLDepthwiseConvolutionLayerFixture>, framework::DatasetMode::ALL, combine(datasets::MobileNetDepthwiseConvolutionLayerDataset(),
+                                                                                                                                         framework::dataset::make("DepthMultiplier", { 1 }),
+                                                                                                                                         data_types, data_layouts));
+TEST_SUITE_END() // DepthwiseConvolutionLayer
+TEST_SUITE_END() // TunerOff
+
+TEST_SUITE(TunerOn)
+TEST_SUITE(DepthwiseConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(MobileNet, CLTunerOnFixture<CLDepthwiseConvolutionLayerFixture>, framework::DatasetMode::ALL, combine(datasets::MobileNetDepthwiseConvolutionLayerDataset(),
+                                                                                                                                        framework::dataset::make("DepthMultiplier", { 1 }),
+                                                                                                                                        data_types, data_layouts));
+TEST_SUITE_END() // DepthwiseConvolutionLayer
+TEST_SUITE_END() // TunerOn
+TEST_SUITE_END() // CL
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
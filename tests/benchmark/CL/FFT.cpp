@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/CLTensorAllocator.h"
+#include "arm_compute/runtime/CL/functions/CLFFT1D.h"
+#include "arm_compute/runtime/CL/functions/CLFFT2D.h"
+#include "tests/CL/CLAccessor.h"
+#include "tests/benchmark/fixtures/CLTunerFixture.h"
+#include "tests/benchmark/fixtures/FFTFixture.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto data_types = framework::dataset::make("DataType", { DataType::F16, DataType::F32 });
+// Radix 2, 3, 4, 5, 7 and 8 decompositions along the first axis
+const auto shapes_1d = framework::dataset::make("TensorShape", { TensorShape(64U, 256U), TensorShape(96U, 256U), TensorShape(1024U, 64U), TensorShape(1225U, 64U) });
+const auto shapes_2d = framework::dataset::make("TensorShape", { TensorShape(64U, 64U, 16U), TensorShape(128U, 128U, 4U), TensorShape(224U, 224U, 3U) });
+} // namespace
+
+using CLFFT1DFixture = FFTFixture<CLTensor, CLFFT1D, FFT1DInfo, CLAccessor>;
+using CLFFT2DFixture = FFTFixture<CLTensor, CLFFT2D, FFT2DInfo, CLAccessor>;
+
+TEST_SUITE(CL)
+TEST_SUITE(TunerOff)
+TEST_SUITE(FFT1D)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, CLTunerOffFixture<CLFFT1DFixture>, framework::DatasetMode::ALL, combine(shapes_1d, data_types));
+TEST_SUITE_END() // FFT1D
+
+TEST_SUITE(FFT2D)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, CLTunerOffFixture<CLFFT2DFixture>, framework::DatasetMode::ALL, combine(shapes_2d, data_types));
+TEST_SUITE_END() // FFT2D
+TEST_SUITE_END() // TunerOff
+
+TEST_SUITE(TunerOn)
+TEST_SUITE(FFT1D)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, CLTunerOnFixture<CLFFT1DFixture>, framework::DatasetMode::ALL, combine(shapes_1d, data_types));
+TEST_SUITE_END() // FFT1D
+
+TEST_SUITE(FFT2D)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, CLTunerOnFixture<CLFFT2DFixture>, framework::DatasetMode::ALL, combine(shapes_2d, data_types));
+TEST_SUITE_END() // FFT2D
+TEST_SUITE_END() // TunerOn
+TEST_SUITE_END() // CL
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/CLTensorAllocator.h"
+#include "arm_compute/runtime/CL/functions/CLGEMM.h"
+#include "src/gpu/cl/kernels/ClGemmMatrixMultiplyNativeKernel.h"
+#include "src/gpu/cl/kernels/ClGemmMatrixMultiplyReshapedKernel.h"
+#include "src/gpu/cl/kernels/ClGemmMatrixMultiplyReshapedOnlyRhsKernel.h"
+#include "src/gpu/cl/kernels/ClGemmMatrixMultiplyReshapedOnlyRhsMMULKernel.h"
+#include "src/gpu/cl/kernels/ClGemmReshapeLhsMatrixKernel.h"
+#include "src/gpu/cl/kernels/ClGemmReshapeRhsMatrixKernel.h"
+#include "tests/CL/CLAccessor.h"
+#include "tests/CL/Helper.h"
+#include "tests/benchmark/fixtures/CLTunerFixture.h"
+#include "tests/benchmark/fixtures/GEMMFixture.h"
+#include "tests/benchmark/fixtures/GEMMMatrixMultiplyFixture.h"
+#include "tests/datasets/AlexNetGEMMDataset.h"
+#include "tests/datasets/GoogleNetGEMMDataset.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+using namespace arm_compute::opencl::kernels;
+
+const auto data_types        = framework::dataset::make("DataType", { DataType::F32 });
+const auto kernel_data_types = framework::dataset::make("DataType", { DataType::F16, DataType::F32 });
+
+/** Matrix sizes of the kernel benchmarks: a fully connected layer, a square GEMM and a pointwise convolution */
+const auto kernel_shapes = zip(framework::dataset::make("M", { 1U, 256U, 3136U }),
+                               framework::dataset::make("N", { 1000U, 256U, 64U }),
+                               framework::dataset::make("K", { 1024U, 256U, 64U }),
+                               framework::dataset::make("batch_size", { 1U, 1U, 1U }));
+
+const auto native_blocking = combine(framework::dataset::make("LHSInfo", { GEMMLHSMatrixInfo(4U, 4U, 1U, false, false) }),
+                                     framework::dataset::make("RHSInfo", { GEMMRHSMatrixInfo(4U, 4U, 1U, false, false, false) }));
+const auto reshaped_blocking = combine(framework::dataset::make("LHSInfo", { GEMMLHSMatrixInfo(4U, 4U, 2U, false, true) }),
+                                       framework::dataset::make("RHSInfo", { GEMMRHSMatrixInfo(4U, 4U, 4U, true, true, false) }));
+const auto reshaped_only_rhs_blocking = combine(framework::dataset::make("LHSInfo", { GEMMLHSMatrixInfo(4U, 4U, 1U, false, false) }),
+                                                framework::dataset::make("RHSInfo", { GEMMRHSMatrixInfo(4U, 4U, 4U, true, true, false) }));
+const auto mmul_blocking = combine(framework::dataset::make("LHSInfo", { GEMMLHSMatrixInfo(4U, 1U, 1U, false, false) }),
+                                   framework::dataset::make("RHSInfo", { GEMMRHSMatrixInfo(4U, 1U, 4U, false, true, false) }));
+} // namespace
+
+using CLGEMMReshapeLHSMatrix                  = CLSynthetizeOperator<ClGemmReshapeLhsMatrixKernel>;
+using CLGEMMReshapeRHSMatrix                  = CLSynthetizeOperator<ClGemmReshapeRhsMatrixKernel>;
+using CLGEMMMatrixMultiplyNative              = CLSynthetizeOperator<ClGemmMatrixMultiplyNativeKernel>;
+using CLGEMMMatrixMultiplyReshaped            = CLSynthetizeOperator<ClGemmMatrixMultiplyReshapedKernel>;
+using CLGEMMMatrixMultiplyReshapedOnlyRHS     = CLSynthetizeOperator<ClGemmMatrixMultiplyReshapedOnlyRhsKernel>;
+using CLGEMMMatrixMultiplyReshapedOnlyRhsMMUL = CLSynthetizeOperator<ClGemmMatrixMultiplyReshapedOnlyRhsMMULKernel>;
+
+using CLGEMMFixture = GEMMFixture<CLTensor, CLGEMM, CLAccessor>;
+using CLGEMMNativeFixture =
+    GEMMMatrixMultiplyFixture<CLTensor, CLAccessor, CLGEMMReshapeLHSMatrix, CLGEMMReshapeRHSMatrix, CLGEMMMatrixMultiplyNative, false, false>;
+using CLGEMMReshapedFixture =
+    GEMMMatrixMultiplyFixture<CLTensor, CLAccessor, CLGEMMReshapeLHSMatrix, CLGEMMReshapeRHSMatrix, CLGEMMMatrixMultiplyReshaped, true, true>;
+using CLGEMMReshapedOnlyRHSFixture =
+    GEMMMatrixMultiplyFixture<CLTensor, CLAccessor, CLGEMMReshapeLHSMatrix, CLGEMMReshapeRHSMatrix, CLGEMMMatrixMultiplyReshapedOnlyRHS, false, true>;
+using CLGEMMReshapedOnlyRhsMMULFixture =
+    GEMMMatrixMultiplyFixture<CLTensor, CLAccessor, CLGEMMReshapeLHSMatrix, CLGEMMReshapeRHSMatrix, CLGEMMMatrixMultiplyReshapedOnlyRhsMMUL, false, true>;
+
+TEST_SUITE(CL)
+TEST_SUITE(TunerOff)
+TEST_SUITE(GEMM)
+REGISTER_FIXTURE_DATA_TEST_CASE(AlexNet, CLTunerOffFixture<CLGEMMFixture>, framework::DatasetMode::ALL, combine(datasets::AlexNetGEMMDataset(), data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(GoogleNet, CLTunerOffFixture<CLGEMMFixture>, framework::DatasetMode::NIGHTLY, combine(datasets::GoogleNetGEMMDataset(), data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(Native, CLTunerOffFixture<CLGEMMNativeFixture>, framework::DatasetMode::ALL, combine(kernel_shapes, native_blocking, kernel_data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(Reshaped, CLTunerOffFixture<CLGEMMReshapedFixture>, framework::DatasetMode::ALL, combine(kernel_shapes, reshaped_blocking, kernel_data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(ReshapedOnlyRHS, CLTunerOffFixture<CLGEMMReshapedOnlyRHSFixture>, framework::DatasetMode::ALL, combine(kernel_shapes, reshaped_only_rhs_blocking, kernel_data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(ReshapedOnlyRhsMMUL, CLTunerOffFixture<CLGEMMReshapedOnlyRhsMMULFixture>, framework::DatasetMode::ALL, combine(kernel_shapes, mmul_blocking, kernel_data_types));
+TEST_SUITE_END() // GEMM
+TEST_SUITE_END() // TunerOff
+
+TEST_SUITE(TunerOn)
+TEST_SUITE(GEMM)
+REGISTER_FIXTURE_DATA_TEST_CASE(AlexNet, CLTunerOnFixture<CLGEMMFixture>, framework::DatasetMode::ALL, combine(datasets::AlexNetGEMMDataset(), data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(GoogleNet, CLTunerOnFixture<CLGEMMFixture>, framework::DatasetMode::NIGHTLY, combine(datasets::GoogleNetGEMMDataset(), data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(Native, CLTunerOnFixture<CLGEMMNativeFixture>, framework::DatasetMode::ALL, combine(kernel_shapes, native_blocking, kernel_data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(Reshaped, CLTunerOnFixture<CLGEMMReshapedFixture>, framework::DatasetMode::ALL, combine(kernel_shapes, reshaped_blocking, kernel_data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(ReshapedOnlyRHS, CLTunerOnFixture<CLGEMMReshapedOnlyRHSFixture>, framework::DatasetMode::ALL, combine(kernel_shapes, reshaped_only_rhs_blocking, kernel_data_types));
+REGISTER_FIXTURE_DATA_TEST_CASE(ReshapedOnlyRhsMMUL, CLTunerOnFixture<CLGEMMReshapedOnlyRhsMMULFixture>, framework::DatasetMode::ALL, combine(kernel_shapes, mmul_blocking, kernel_data_types));
+TEST_SUITE_END() // GEMM
+TEST_SUITE_END() // TunerOn
+TEST_SUITE_END() // CL
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "tests/benchmark/fixtures/ArmGemmKernelFixture.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+/** Grid of problem sizes covering the GEMV, hybrid and interleaved kernels */
+const auto small_shapes = combine(framework::dataset::make("M", { 1U, 64U }),
+                                  framework::dataset::make("N", { 64U, 256U }),
+                                  framework::dataset::make("K", { 64U, 256U }));
+const auto large_shapes = combine(framework::dataset::make("M", { 1U, 16U, 64U, 256U, 1024U }),
+                                  framework::dataset::make("N", { 64U, 256U, 1024U }),
+                                  framework::dataset::make("K", { 64U, 256U, 1024U }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ArmGemmKernels)
+
+TEST_SUITE(FP32)
+using ArmGemmKernelFP32Fixture = ArmGemmKernelFixture<float, float>;
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, ArmGemmKernelFP32Fixture, framework::DatasetMode::PRECOMMIT, small_shapes);
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, ArmGemmKernelFP32Fixture, framework::DatasetMode::NIGHTLY, large_shapes);
+TEST_SUITE_END() // FP32
+
+#ifdef __aarch64__
+TEST_SUITE(S8)
+using ArmGemmKernelS8Fixture = ArmGemmKernelFixture<int8_t, int32_t>;
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, ArmGemmKernelS8Fixture, framework::DatasetMode::PRECOMMIT, small_shapes);
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, ArmGemmKernelS8Fixture, framework::DatasetMode::NIGHTLY, large_shapes);
+TEST_SUITE_END() // S8
+
+TEST_SUITE(U8)
+using ArmGemmKernelU8Fixture = ArmGemmKernelFixture<uint8_t, uint32_t>;
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, ArmGemmKernelU8Fixture, framework::DatasetMode::PRECOMMIT, small_shapes);
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, ArmGemmKernelU8Fixture, framework::DatasetMode::NIGHTLY, large_shapes);
+TEST_SUITE_END() // U8
+#endif /* __aarch64__ */
+
+TEST_SUITE_END() // ArmGemmKernels
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
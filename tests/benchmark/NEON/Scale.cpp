@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,9 +43,14 @@ namespace benchmark
 namespace
 {
 const auto interpolation_types = framework::dataset::make("InterpolationPolicy", { InterpolationPolicy::NEAREST_NEIGHBOR, InterpolationPolicy::BILINEAR });
+
+/** 4K and Full HD NHWC RGB frames downscaled to the input size of classification networks */
+const auto downscale_to_size_shapes = zip(framework::dataset::make("Shape", { TensorShape(3U, 3840U, 2160U), TensorShape(3U, 1920U, 1080U) }),
+                                          framework::dataset::make("ScaledShape", { TensorShape(3U, 224U, 224U), TensorShape(3U, 224U, 224U) }));
 } // namespace
 
-using NEScaleFixture = ScaleFixture<Tensor, NEScale, Accessor>;
+using NEScaleFixture       = ScaleFixture<Tensor, NEScale, Accessor>;
+using NEScaleToSizeFixture = ScaleToSizeFixture<Tensor, NEScale, Accessor>;
 
 TEST_SUITE(NEON)
 TEST_SUITE(Scale)
@@ -54,6 +59,9 @@ REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEScaleFixture, framework::DatasetMode
                                                                                                                      interpolation_types),
                                                                                                              datasets::BorderModes()),
                                                                                                      framework::dataset::make("SamplingPolicy", { SamplingPolicy::CENTER })));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunDownscaleToSize, NEScaleToSizeFixture, framework::DatasetMode::ALL, combine(combine(downscale_to_size_shapes,
+                                                                                                                       framework::dataset::make("DataType", { DataType::U8, DataType::F32 })),
+                                                                                                               framework::dataset::make("InterpolationPolicy", { InterpolationPolicy::BILINEAR, InterpolationPolicy::AREA })));
 TEST_SUITE_END() // Scale
 TEST_SUITE_END() // Neon
 } // namespace benchmark
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_ARMGEMMKERNELFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_ARMGEMMKERNELFIXTURE_H
+
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/IScheduler.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/cpu/kernels/assembly/arm_gemm.hpp"
+#include "src/cpu/kernels/assembly/CpuGemmAssemblyWrapperKernel.h"
+#include "support/StringSupport.h"
+#include "tests/framework/Fixture.h"
+#include "tests/framework/Framework.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture timing every arm_gemm kernel compatible with a GEMM problem in isolation
+ *
+ * The kernels are created straight from the arm_gemm implementation lists, bypassing the kernel selection of
+ * @ref cpu::CpuGemmAssemblyDispatch, and run through @ref NEScheduler on constant-filled buffers. For each kernel the
+ * fixture reports, next to the instruments which measure all the kernels together:
+ * - <kernel>/Prepare: time taken to pretranspose B, once per test
+ * - <kernel>/Compute: time taken by one run, once per iteration
+ * - <kernel>/GFLOPS: throughput of the run, once per iteration
+ * - <kernel>/Estimated GFLOPS: throughput predicted by the cycle estimate arm_gemm ranks the kernels with, only when
+ *   the clock of the CPU can be read
+ */
+template <typename TypeInput, typename TypeOutput>
+class ArmGemmKernelFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int M, unsigned int N, unsigned int K)
+    {
+        const CPUInfo     &ci          = NEScheduler::get().cpu_info();
+        const unsigned int num_threads = NEScheduler::get().num_threads();
+        const double       flops       = 2. * M * N * K;
+        const double       ghz         = max_clock_ghz();
+
+        _flops     = flops;
+        _iteration = 0;
+
+        const arm_gemm::GemmArgs args(&ci, M, N, K, 1, 1, 1, false, arm_gemm::Activation(), num_threads);
+        for (const auto &kernel : arm_gemm::get_compatible_kernels<TypeInput, TypeInput, TypeOutput>(args))
+        {
+            auto run        = std::make_unique<KernelRun>(args, kernel);
+            run->args._cfg  = &run->cfg;
+            run->gemm       = arm_gemm::gemm<TypeInput, TypeInput, TypeOutput>(run->args);
+
+            // The filter is a substring match and may select a kernel with a longer name
+            if (run->gemm == nullptr || run->gemm->get_config().filter != kernel.name)
+            {
+                continue;
+            }
+
+            prepare(*run, M, N, K);
+
+            if (ghz > 0. && kernel.cycle_estimate > 0)
+            {
+                framework::Framework::get().add_test_measurement(
+                    run->name + "/Estimated GFLOPS", framework::Measurement(flops * ghz / kernel.cycle_estimate, "GFLOPS"));
+            }
+            _runs.emplace_back(std::move(run));
+        }
+    }
+
+    void run()
+    {
+        // Like the instruments, skip the warm-up iteration when there is more than one
+        const bool measure = framework::Framework::get().num_iterations() == 1 || _iteration++ != 0;
+
+        for (auto &run : _runs)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            NEScheduler::get().schedule(run->wrapper.get(), run->hints);
+            const auto end = std::chrono::steady_clock::now();
+
+            if (measure)
+            {
+                const double ns = std::max<double>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), 1.);
+                framework::Framework::get().add_test_measurement(run->name + "/Compute",
+                                                                 framework::Measurement(ns / 1e6, "ms"));
+                framework::Framework::get().add_test_measurement(run->name + "/GFLOPS",
+                                                                 framework::Measurement(_flops / ns, "GFLOPS"));
+            }
+        }
+    }
+
+    void sync()
+    {
+        // The scheduler returns once the kernels are done
+    }
+
+    void teardown()
+    {
+        _runs.clear();
+    }
+
+private:
+    using Wrapper = cpu::kernel::CpuGemmAssemblyWrapperKernel<TypeInput, TypeInput, TypeOutput>;
+
+    struct KernelRun
+    {
+        KernelRun(const arm_gemm::GemmArgs &gemm_args, const arm_gemm::KernelDescription &kernel)
+            : name(kernel.name), cfg(kernel.method), args(gemm_args)
+        {
+            cfg.filter = kernel.name;
+        }
+
+        std::string                                                   name;
+        arm_gemm::GemmConfig                                          cfg;
+        arm_gemm::GemmArgs                                            args;
+        arm_gemm::UniqueGemmCommon<TypeInput, TypeInput, TypeOutput> gemm{};
+        std::vector<TypeInput>                                        a{};
+        std::vector<TypeInput>                                        b{};
+        std::vector<TypeOutput>                                       d{};
+        std::vector<uint8_t>                                          workspace{};
+        std::vector<uint8_t>                                          pretranspose{};
+        std::unique_ptr<Wrapper>                                      wrapper{};
+        IScheduler::Hints                                             hints{ Window::DimX };
+    };
+
+    /** Clock of the CPU in GHz, 0 when it cannot be read */
+    static double max_clock_ghz()
+    {
+#if defined(__linux__) && !defined(BARE_METAL)
+        std::ifstream fs("/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq");
+        unsigned long khz = 0;
+        if (fs >> khz)
+        {
+            return khz / 1e6;
+        }
+#endif /* defined(__linux__) && !defined(BARE_METAL) */
+        return 0.;
+    }
+
+    void prepare(KernelRun &run, unsigned int M, unsigned int N, unsigned int K)
+    {
+        // Constant inputs keep the floating point kernels away from denormals
+        run.a.assign(static_cast<size_t>(M) * K, static_cast<TypeInput>(1));
+        run.b.assign(static_cast<size_t>(N) * K, static_cast<TypeInput>(1));
+        run.d.assign(static_cast<size_t>(M) * N, static_cast<TypeOutput>(0));
+
+        // Same alignments as the memory requested by cpu::CpuGemmAssemblyDispatch
+        run.workspace.resize(run.gemm->get_working_size() + 4096);
+        void  *workspace_ptr  = run.workspace.data();
+        size_t workspace_size = run.workspace.size();
+        run.gemm->set_working_space(std::align(4096, workspace_size - 4096, workspace_ptr, workspace_size));
+
+        if (run.gemm->B_pretranspose_required())
+        {
+            run.pretranspose.resize(run.gemm->get_B_pretransposed_array_size() + 128);
+            void  *pretranspose_ptr  = run.pretranspose.data();
+            size_t pretranspose_size = run.pretranspose.size();
+
+            const auto start = std::chrono::steady_clock::now();
+            run.gemm->pretranspose_B_array(std::align(128, pretranspose_size - 128, pretranspose_ptr, pretranspose_size),
+                                           run.b.data(), N, N * K, false);
+            const auto end = std::chrono::steady_clock::now();
+            framework::Framework::get().add_test_measurement(
+                run.name + "/Prepare",
+                framework::Measurement(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 1e6,
+                                       "ms"));
+        }
+
+        run.gemm->set_arrays(run.a.data(), K, K * M, K * M, run.b.data(), N, N * K, run.d.data(), N, N * M, N * M,
+                             nullptr, 0);
+
+        run.wrapper = std::make_unique<Wrapper>();
+        run.wrapper->configure(run.gemm.get(), "");
+
+        // Same scheduling as cpu::CpuGemmAssemblyDispatch
+        const Window &window      = run.wrapper->window();
+        unsigned int  num_threads = std::min<unsigned int>(run.gemm->get_window_size().total_size(),
+                                                          NEScheduler::get().num_threads());
+        if (window.num_iterations(Window::DimY) > 1 && window.num_iterations(Window::DimX) > 1)
+        {
+            run.hints = IScheduler::Hints(IScheduler::split_dimensions_all);
+        }
+        else
+        {
+            run.hints = IScheduler::Hints(window.num_iterations(Window::DimY) > 1 ? Window::DimY : Window::DimX);
+            num_threads =
+                std::min<unsigned int>(window.num_iterations(run.hints.split_dimension()), num_threads);
+        }
+        run.gemm->set_nthreads(num_threads);
+    }
+
+    std::vector<std::unique_ptr<KernelRun>> _runs{};
+    double                                  _flops{ 0. };
+    unsigned int                            _iteration{ 0 };
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_ARMGEMMKERNELFIXTURE_H
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_CLTUNERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_CLTUNERFIXTURE_H
+
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLTuner.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture running an OpenCL benchmark fixture with the local work-size tuner forced on or off
+ *
+ * The tuner replaces the one of the scheduler for the lifetime of the test. When @p tune is true, the kernels are
+ * tuned in RAPID mode when they are first enqueued, that is during the warm-up iteration: run the benchmark with more
+ * than one iteration to keep the tuning out of the measurements. When @p tune is false, the kernels use their default
+ * local work-size whatever the --enable-tuner and --tuner-file options are.
+ */
+template <typename Fixture, bool tune>
+class CLTunerFixture : public Fixture
+{
+public:
+    /** Default constructor */
+    CLTunerFixture() : _tuner(tune), _previous_tuner(CLScheduler::get().tuner())
+    {
+        _tuner.set_tuner_mode(CLTunerMode::RAPID);
+        CLScheduler::get().set_tuner(tune ? &_tuner : nullptr);
+    }
+    /** Restores the tuner of the scheduler */
+    ~CLTunerFixture()
+    {
+        CLScheduler::get().set_tuner(_previous_tuner);
+    }
+
+private:
+    CLTuner   _tuner;
+    ICLTuner *_previous_tuner;
+};
+
+/** Fixture running an OpenCL benchmark fixture with the tuner off */
+template <typename Fixture>
+using CLTunerOffFixture = CLTunerFixture<Fixture, false>;
+
+/** Fixture running an OpenCL benchmark fixture with the tuner on */
+template <typename Fixture>
+using CLTunerOnFixture = CLTunerFixture<Fixture, true>;
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_CLTUNERFIXTURE_H
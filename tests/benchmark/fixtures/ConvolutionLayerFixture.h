@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_CONVOLUTIONLAYERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_CONVOLUTIONLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace detail
+{
+/** Configure functions taking weights info, dilation and a fast math flag (generic and Neon GEMM-based convolution) */
+template <typename Function, typename TensorType>
+auto configure_conv(Function            &func,
+                    TensorType          &src,
+                    TensorType          &weights,
+                    TensorType          &biases,
+                    TensorType          &dst,
+                    const PadStrideInfo &info,
+                    const Size2D        &dilation,
+                    bool                 enable_fast_math,
+                    int)
+    -> decltype(func.configure(
+                    &src, &weights, &biases, &dst, info, WeightsInfo(), dilation, ActivationLayerInfo(), false, 1U),
+                void())
+{
+    func.configure(&src, &weights, &biases, &dst, info, WeightsInfo(), dilation, ActivationLayerInfo(),
+                   enable_fast_math);
+}
+
+/** Configure functions taking weights info and dilation but no fast math flag (OpenCL GEMM-based convolution) */
+template <typename Function, typename TensorType>
+auto configure_conv(Function            &func,
+                    TensorType          &src,
+                    TensorType          &weights,
+                    TensorType          &biases,
+                    TensorType          &dst,
+                    const PadStrideInfo &info,
+                    const Size2D        &dilation,
+                    bool                 enable_fast_math,
+                    long)
+    -> decltype(func.configure(&src, &weights, &biases, &dst, info, WeightsInfo(), dilation), void())
+{
+    ARM_COMPUTE_UNUSED(enable_fast_math);
+    func.configure(&src, &weights, &biases, &dst, info, WeightsInfo(), dilation);
+}
+
+/** Configure functions taking a fast math flag after the activation (Winograd convolution) */
+template <typename Function, typename TensorType>
+auto configure_conv(Function            &func,
+                    TensorType          &src,
+                    TensorType          &weights,
+                    TensorType          &biases,
+                    TensorType          &dst,
+                    const PadStrideInfo &info,
+                    const Size2D        &dilation,
+                    bool                 enable_fast_math,
+                    long)
+    -> decltype(func.configure(&src, &weights, &biases, &dst, info, ActivationLayerInfo(), enable_fast_math), void())
+{
+    ARM_COMPUTE_UNUSED(dilation);
+    func.configure(&src, &weights, &biases, &dst, info, ActivationLayerInfo(), enable_fast_math);
+}
+
+/** Configure functions without dilation or fast math support (direct convolution) */
+template <typename Function, typename TensorType>
+void configure_conv(Function            &func,
+                    TensorType          &src,
+                    TensorType          &weights,
+                    TensorType          &biases,
+                    TensorType          &dst,
+                    const PadStrideInfo &info,
+                    const Size2D        &dilation,
+                    bool                 enable_fast_math,
+                    ...)
+{
+    ARM_COMPUTE_UNUSED(dilation, enable_fast_math);
+    func.configure(&src, &weights, &biases, &dst, info);
+}
+} // namespace detail
+
+/** Fixture that can be used for the generic, GEMM-based, Winograd and direct convolution functions */
+template <typename TensorType, typename Function, typename Accessor>
+class ConvolutionLayerFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape   src_shape,
+               TensorShape   weights_shape,
+               TensorShape   biases_shape,
+               TensorShape   dst_shape,
+               PadStrideInfo info,
+               Size2D        dilation,
+               DataType      data_type,
+               DataLayout    data_layout,
+               bool          enable_fast_math)
+    {
+        if (data_layout == DataLayout::NHWC)
+        {
+            permute(src_shape, PermutationVector(2U, 0U, 1U));
+            permute(weights_shape, PermutationVector(2U, 0U, 1U));
+            permute(dst_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        // Create tensors
+        src     = create_tensor<TensorType>(src_shape, data_type, 1, QuantizationInfo(), data_layout);
+        weights = create_tensor<TensorType>(weights_shape, data_type, 1, QuantizationInfo(), data_layout);
+        biases  = create_tensor<TensorType>(biases_shape, data_type, 1, QuantizationInfo(), data_layout);
+        dst     = create_tensor<TensorType>(dst_shape, data_type, 1, QuantizationInfo(), data_layout);
+
+        // Create and configure function
+        detail::configure_conv(conv_layer, src, weights, biases, dst, info, dilation, enable_fast_math, 0);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        biases.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        library->fill_tensor_uniform(Accessor(src), 0);
+        library->fill_tensor_uniform(Accessor(weights), 1);
+        library->fill_tensor_uniform(Accessor(biases), 2);
+    }
+
+    void run()
+    {
+        conv_layer.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        weights.allocator()->free();
+        biases.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    TensorType src{};
+    TensorType weights{};
+    TensorType biases{};
+    TensorType dst{};
+    Function   conv_layer{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_CONVOLUTIONLAYERFIXTURE_H
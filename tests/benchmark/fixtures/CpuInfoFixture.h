@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_CPUINFOFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_CPUINFOFIXTURE_H
+
+#include "src/common/cpuinfo/CpuInfo.h"
+#include "tests/framework/Fixture.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture timing the detection of the CPU run at start-up, with or without the ARM_COMPUTE_CPUINFO_CACHE cache
+ *
+ * The cache is written by the warm-up iteration and then read by the measured ones.
+ */
+class CpuInfoFixture : public framework::Fixture
+{
+public:
+    void setup(bool use_cache)
+    {
+        _use_cache = use_cache;
+        if (_use_cache)
+        {
+            _cache_path = "/tmp/acl_cpuinfo_cache_" + std::to_string(getpid());
+            setenv("ARM_COMPUTE_CPUINFO_CACHE", _cache_path.c_str(), 1);
+        }
+        else
+        {
+            unsetenv("ARM_COMPUTE_CPUINFO_CACHE");
+        }
+    }
+
+    void run()
+    {
+        _info = cpuinfo::CpuInfo::build();
+    }
+
+    void sync()
+    {
+    }
+
+    void teardown()
+    {
+        if (_use_cache)
+        {
+            unsetenv("ARM_COMPUTE_CPUINFO_CACHE");
+            std::remove(_cache_path.c_str());
+        }
+    }
+
+private:
+    bool             _use_cache{false};
+    std::string      _cache_path{};
+    cpuinfo::CpuInfo _info{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_CPUINFOFIXTURE_H
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_GEMMMATRIXMULTIPLYFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_GEMMMATRIXMULTIPLYFIXTURE_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture running one of the OpenCL GEMM matrix multiply kernels on its own
+ *
+ * Unlike @ref GEMMFixture, which lets the function pick the kernel with its heuristics, the fixture benchmarks the
+ * kernel given by @p GEMMType with the blocking given by the dataset. The RHS matrix is reshaped once when the test is
+ * set up, as the weights of a network would be, while the LHS matrix is reshaped at every run. Configurations which
+ * are not supported by the device (for instance the MMUL kernels without the cl_arm_matrix_multiply extension) are
+ * skipped.
+ */
+template <typename TensorType,
+          typename Accessor,
+          typename ReshapeLHSType,
+          typename ReshapeRHSType,
+          typename GEMMType,
+          bool     reshape_lhs,
+          bool     reshape_rhs>
+class GEMMMatrixMultiplyFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int      m,
+               unsigned int      n,
+               unsigned int      k,
+               unsigned int      batch_size,
+               GEMMLHSMatrixInfo lhs_info,
+               GEMMRHSMatrixInfo rhs_info,
+               DataType          data_type)
+    {
+        GEMMKernelInfo kernel_info;
+        kernel_info.m                       = m;
+        kernel_info.n                       = n;
+        kernel_info.k                       = k;
+        kernel_info.depth_output_gemm3d     = 0;
+        kernel_info.reinterpret_input_as_3d = false;
+        kernel_info.broadcast_bias          = false;
+
+        // Create tensors
+        lhs = create_tensor<TensorType>(TensorShape(k, m, batch_size), data_type);
+        rhs = create_tensor<TensorType>(TensorShape(n, k, batch_size), data_type);
+
+        ITensorInfo *gemm_lhs = reshape_lhs ? lhs_reshaped.info() : lhs.info();
+        ITensorInfo *gemm_rhs = reshape_rhs ? rhs_reshaped.info() : rhs.info();
+
+        // Create and configure the kernels, skipping the configurations the device does not support
+        _supported = (!reshape_lhs || bool(ReshapeLHSType::validate(lhs.info(), lhs_reshaped.info(), lhs_info, false))) &&
+                     (!reshape_rhs || bool(ReshapeRHSType::validate(rhs.info(), rhs_reshaped.info(), rhs_info)));
+        if (_supported)
+        {
+            if (reshape_lhs)
+            {
+                reshape_lhs_op.configure(lhs.info(), lhs_reshaped.info(), lhs_info, false);
+            }
+            if (reshape_rhs)
+            {
+                reshape_rhs_op.configure(rhs.info(), rhs_reshaped.info(), rhs_info);
+            }
+            _supported = bool(GEMMType::validate(gemm_lhs, gemm_rhs, nullptr, dst.info(), 1.f, 0.f, lhs_info, rhs_info,
+                                                 kernel_info));
+        }
+        if (!_supported)
+        {
+            ARM_COMPUTE_TEST_INFO("Configuration not supported by the device. Test skipped");
+            framework::ARM_COMPUTE_PRINT_INFO();
+            return;
+        }
+        gemm.configure(gemm_lhs, gemm_rhs, nullptr, dst.info(), 1.f, 0.f, lhs_info, rhs_info, kernel_info);
+
+        // Allocate tensors
+        lhs.allocator()->allocate();
+        rhs.allocator()->allocate();
+        dst.allocator()->allocate();
+        if (reshape_lhs)
+        {
+            lhs_reshaped.allocator()->allocate();
+        }
+        if (reshape_rhs)
+        {
+            rhs_reshaped.allocator()->allocate();
+        }
+
+        // Fill tensors
+        library->fill_tensor_uniform(Accessor(lhs), 0);
+        library->fill_tensor_uniform(Accessor(rhs), 1);
+
+        if (reshape_rhs)
+        {
+            ITensorPack reshape_rhs_pack = {{ACL_SRC, &rhs}, {ACL_DST, &rhs_reshaped}};
+            reshape_rhs_op.run(reshape_rhs_pack);
+        }
+    }
+
+    void run()
+    {
+        if (!_supported)
+        {
+            return;
+        }
+        if (reshape_lhs)
+        {
+            ITensorPack reshape_lhs_pack = {{ACL_SRC, &lhs}, {ACL_DST, &lhs_reshaped}};
+            reshape_lhs_op.run(reshape_lhs_pack);
+        }
+        ITensorPack gemm_pack = {{ACL_SRC_0, reshape_lhs ? &lhs_reshaped : &lhs},
+                                 {ACL_SRC_1, reshape_rhs ? &rhs_reshaped : &rhs},
+                                 {ACL_DST, &dst}};
+        gemm.run(gemm_pack);
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        if (_supported)
+        {
+            lhs.allocator()->free();
+            rhs.allocator()->free();
+            dst.allocator()->free();
+            if (reshape_lhs)
+            {
+                lhs_reshaped.allocator()->free();
+            }
+            if (reshape_rhs)
+            {
+                rhs_reshaped.allocator()->free();
+            }
+        }
+    }
+
+private:
+    TensorType     lhs{};
+    TensorType     rhs{};
+    TensorType     lhs_reshaped{};
+    TensorType     rhs_reshaped{};
+    TensorType     dst{};
+    ReshapeLHSType reshape_lhs_op{};
+    ReshapeRHSType reshape_rhs_op{};
+    GEMMType       gemm{};
+    bool           _supported{false};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_GEMMMATRIXMULTIPLYFIXTURE_H
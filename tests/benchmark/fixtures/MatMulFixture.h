@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_MATMULFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_MATMULFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/MatMulInfo.h"
+
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace detail
+{
+/** Set the fast math flag of settings supporting it (Neon) */
+template <typename Settings>
+auto set_fast_math(Settings &settings, bool fast_math, int) -> decltype(settings.fast_math(fast_math), void())
+{
+    settings.fast_math(fast_math);
+}
+
+/** Ignore the fast math flag for settings without it (OpenCL) */
+template <typename Settings>
+void set_fast_math(Settings &settings, bool fast_math, ...)
+{
+    ARM_COMPUTE_UNUSED(settings, fast_math);
+}
+} // namespace detail
+
+/** Fixture that can be used for Neon and CL */
+template <typename TensorType, typename Function, typename Settings, typename Accessor>
+class MatMulFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape shape_dst, DataType data_type, bool fast_math)
+    {
+        // Create tensors
+        a   = create_tensor<TensorType>(shape_a, data_type);
+        b   = create_tensor<TensorType>(shape_b, data_type);
+        dst = create_tensor<TensorType>(shape_dst, data_type);
+
+        // Create and configure function
+        Settings settings;
+        detail::set_fast_math(settings, fast_math, 0);
+        matmul.configure(&a, &b, &dst, MatMulInfo(), settings);
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        // Fill tensors
+        library->fill_tensor_uniform(Accessor(a), 0);
+        library->fill_tensor_uniform(Accessor(b), 1);
+    }
+
+    void run()
+    {
+        matmul.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        a.allocator()->free();
+        b.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    TensorType a{};
+    TensorType b{};
+    TensorType dst{};
+    Function   matmul{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_MATMULFIXTURE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2023 Arm Limited.
+ * Copyright (c) 2017-2020, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -98,6 +98,47 @@ public:
         dst.allocator()->free();
     }
 
+private:
+    TensorType src{};
+    TensorType dst{};
+    Function   scale_func{};
+};
+/** Fixture resizing NHWC images to a fixed size, as done when preprocessing images for inference */
+template <typename TensorType, typename Function, typename Accessor>
+class ScaleToSizeFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape, TensorShape shape_scaled, DataType data_type, InterpolationPolicy policy)
+    {
+        // Create tensors
+        src = create_tensor<TensorType>(shape, data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        dst = create_tensor<TensorType>(shape_scaled, data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+
+        // Create and configure function
+        scale_func.configure(&src, &dst, ScaleKernelInfo{ policy, BorderMode::REPLICATE, PixelValue(), SamplingPolicy::CENTER, false });
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+    }
+
+    void run()
+    {
+        scale_func.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        dst.allocator()->free();
+    }
+
 private:
     TensorType src{};
     TensorType dst{};
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021,2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 #include "arm_compute/runtime/Scheduler.h"
 #include "tests/framework/Framework.h"
 #include "tests/framework/Macros.h"
+#include "tests/framework/Utils.h"
 #include "tests/framework/command_line/CommonOptions.h"
 #include "tests/framework/instruments/Instruments.h"
 #include "utils/command_line/CommandLineParser.h"
@@ -40,6 +41,11 @@
 #include "arm_compute/runtime/CL/CLScheduler.h"
 #endif /* ARM_COMPUTE_CL */
 
+#ifdef BENCHMARK_GRAPH_EXAMPLES
+#include "arm_compute/graph/GraphManager.h"
+#endif /* BENCHMARK_GRAPH_EXAMPLES */
+
+#include <chrono>
 #include <libgen.h>
 
 using namespace arm_compute;
@@ -56,6 +62,16 @@ std::string command_line(int argc, char **argv)
     }
     return ss.str();
 }
+
+double elapsed_ms(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::string ms_to_string(double ms)
+{
+    return framework::arithmetic_to_string(ms, 3) + " ms";
+}
 } // namespace
 namespace arm_compute
 {
@@ -63,6 +79,13 @@ namespace utils
 {
 static std::unique_ptr<Example> g_example      = nullptr;
 static std::vector<char *>      g_example_argv = {};
+/** Cold start timings of the example, the warm iterations being measured by the framework's instruments */
+struct ColdStartTimings
+{
+    double setup_ms{ 0.0 };     /**< Time spent configuring the example (and preparing it, unless done on first use) */
+    double first_run_ms{ 0.0 }; /**< Time spent in the first run of the example */
+};
+static ColdStartTimings g_cold_start = {};
 class ExampleTest : public arm_compute::test::framework::TestCase
 {
 public:
@@ -70,13 +93,21 @@ public:
     void do_setup() override
     {
         ARM_COMPUTE_ERROR_ON_NULLPTR(g_example.get());
-        _is_setup = g_example->do_setup(g_example_argv.size(), &g_example_argv[0]);
+        const auto start      = std::chrono::steady_clock::now();
+        _is_setup             = g_example->do_setup(g_example_argv.size(), &g_example_argv[0]);
+        g_cold_start.setup_ms = elapsed_ms(start);
     }
     void do_run() override
     {
         if(_is_setup)
         {
+            const auto start = std::chrono::steady_clock::now();
             g_example->do_run();
+            if(!_has_run)
+            {
+                g_cold_start.first_run_ms = elapsed_ms(start);
+                _has_run                  = true;
+            }
         }
     }
     void do_teardown() override
@@ -90,8 +121,34 @@ public:
 
 private:
     bool _is_setup{ false };
+    bool _has_run{ false };
 };
 
+/** Print the split of the time to first inference of the example
+ *
+ * The steady state latencies are the percentiles reported by the instruments for the iterations after the first one.
+ */
+void print_cold_start(framework::Printer &p)
+{
+    p.print_entry("ColdStart/Setup", ms_to_string(g_cold_start.setup_ms));
+#ifdef BENCHMARK_GRAPH_EXAMPLES
+    // Split the setup of the graph (mostly its finalization) into configuration and preparation
+    double prepare_ms = 0.0;
+    for(const auto &phase : graph::GraphManager::last_finalize_timings())
+    {
+        p.print_entry("GraphFinalize/" + phase.first, ms_to_string(phase.second));
+        if(phase.first == "prepare")
+        {
+            prepare_ms = phase.second;
+        }
+    }
+    p.print_entry("ColdStart/Configure", ms_to_string(g_cold_start.setup_ms - prepare_ms));
+    p.print_entry("ColdStart/Prepare", ms_to_string(prepare_ms));
+#endif /* BENCHMARK_GRAPH_EXAMPLES */
+    p.print_entry("ColdStart/FirstRun", ms_to_string(g_cold_start.first_run_ms));
+    p.print_entry("ColdStart/TimeToFirstInference", ms_to_string(g_cold_start.setup_ms + g_cold_start.first_run_ms));
+}
+
 int run_example(int argc, char **argv, std::unique_ptr<Example> example)
 {
     utils::CommandLineParser parser;
@@ -191,6 +248,7 @@ int run_example(int argc, char **argv, std::unique_ptr<Example> example)
     {
         for(auto &p : printers)
         {
+            print_cold_start(*p);
             p->print_global_footer();
         }
     }
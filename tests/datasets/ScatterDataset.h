@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -208,6 +208,19 @@ public:
     }
 };
 
+// Many more updates than destination blocks, so that indices collide across the threads splitting the blocks
+class SmallScatterCollisionsDataset final : public ScatterDataset
+{
+public:
+    SmallScatterCollisionsDataset()
+    {
+        add_config(TensorShape(64U, 8U), TensorShape(64U, 200U), TensorShape(1U, 200U), TensorShape(64U, 8U));
+        add_config(TensorShape(17U, 4U, 3U), TensorShape(17U, 150U), TensorShape(2U, 150U), TensorShape(17U, 4U, 3U));
+        // scalar updates
+        add_config(TensorShape(16U), TensorShape(300U), TensorShape(1U, 300U), TensorShape(16U));
+    }
+};
+
 // This dataset is for data types that does not require full testing. It contains selected tests from the above.
 class SmallScatterMixedDataset final : public ScatterDataset
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -322,7 +322,9 @@ public:
                      TensorShape{ 27U, 13U, 2U, 4U },
                      TensorShape{ 1U, 1U, 1U, 5U },
                      TensorShape{ 1U, 16U, 10U, 2U, 128U },
-                     TensorShape{ 1U, 16U, 10U, 2U, 128U }
+                     TensorShape{ 1U, 16U, 10U, 2U, 128U },
+                     TensorShape{ 16U, 7U, 5U, 2U },
+                     TensorShape{ 1U }
     }),
     ShapeDataset("Shape1",
     {
@@ -333,7 +335,9 @@ public:
         TensorShape{ 1U },
         TensorShape{ 9U, 9U, 3U, 5U },
         TensorShape{ 1U, 1U, 1U, 1U, 128U },
-        TensorShape{ 128U }
+        TensorShape{ 128U },
+        TensorShape{ 16U },
+        TensorShape{ 9U, 5U, 3U }
     }))
     {
     }
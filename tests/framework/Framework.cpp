@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include "arm_compute/runtime/Scheduler.h"
 #include "tests/framework/ParametersLibrary.h"
 #include "tests/framework/TestFilter.h"
+#include "tests/framework/instruments/InstrumentsStats.h"
 
 #ifdef ARM_COMPUTE_CL
 #include "arm_compute/runtime/CL/CLRuntimeContext.h"
@@ -68,10 +69,16 @@ Framework::Framework()
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::SCHEDULER_TIMER, ScaleFactor::NONE), Instrument::make_instrument<SchedulerTimer, ScaleFactor::NONE>);
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::SCHEDULER_TIMER, ScaleFactor::TIME_MS), Instrument::make_instrument<SchedulerTimer, ScaleFactor::TIME_MS>);
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::SCHEDULER_TIMER, ScaleFactor::TIME_S), Instrument::make_instrument<SchedulerTimer, ScaleFactor::TIME_S>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::ENERGY, ScaleFactor::NONE), Instrument::make_instrument<EnergyMeter, ScaleFactor::NONE>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::ENERGY, ScaleFactor::SCALE_1K), Instrument::make_instrument<EnergyMeter, ScaleFactor::SCALE_1K>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::ENERGY, ScaleFactor::SCALE_1M), Instrument::make_instrument<EnergyMeter, ScaleFactor::SCALE_1M>);
 #ifdef PMU_ENABLED
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::NONE), Instrument::make_instrument<PMUCounter, ScaleFactor::NONE>);
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::SCALE_1K), Instrument::make_instrument<PMUCounter, ScaleFactor::SCALE_1K>);
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::SCALE_1M), Instrument::make_instrument<PMUCounter, ScaleFactor::SCALE_1M>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_CACHE, ScaleFactor::NONE), Instrument::make_instrument<PMUGroupCounter<PMUEventGroup::CACHE>, ScaleFactor::NONE>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_MEMORY, ScaleFactor::NONE), Instrument::make_instrument<PMUGroupCounter<PMUEventGroup::MEMORY>, ScaleFactor::NONE>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_SVE, ScaleFactor::NONE), Instrument::make_instrument<PMUGroupCounter<PMUEventGroup::SVE>, ScaleFactor::NONE>);
 #endif /* PMU_ENABLED */
 #ifdef MALI_ENABLED
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::MALI, ScaleFactor::NONE), Instrument::make_instrument<MaliCounter, ScaleFactor::NONE>);
@@ -189,6 +196,11 @@ void Framework::func_on_all_printers(F &&func)
     std::for_each(std::begin(_printers), std::end(_printers), func);
 }
 
+void Framework::add_test_measurement(const std::string &name, Measurement measurement)
+{
+    _test_measurements[name].emplace_back(std::move(measurement));
+}
+
 void Framework::log_test_start(const TestInfo &info)
 {
     if(_log_level >= LogLevel::TESTS)
@@ -310,6 +322,7 @@ TestResult::Status Framework::run_test(const TestInfo &info, TestCaseFactory &te
 
     _current_test_info   = &info;
     _current_test_result = &result;
+    _test_measurements.clear();
 
     if(_log_level >= LogLevel::ERRORS)
     {
@@ -541,6 +554,16 @@ TestResult::Status Framework::run_test(const TestInfo &info, TestCaseFactory &te
 
     result.header_data  = profiler.header();
     result.measurements = profiler.measurements();
+    for(auto &measurement : _test_measurements)
+    {
+        auto &values = result.measurements[measurement.first];
+        values.insert(values.end(), measurement.second.begin(), measurement.second.end());
+    }
+    _test_measurements.clear();
+    if(_current_sweep != nullptr)
+    {
+        add_scaling_measurements(info, result.measurements);
+    }
 
     set_test_result(info, result);
     log_test_end(info);
@@ -551,6 +574,7 @@ bool Framework::run()
 {
     // Clear old test results
     _test_results.clear();
+    _sweep_references.clear();
 
     if(_log_level >= LogLevel::TESTS)
     {
@@ -562,45 +586,59 @@ bool Framework::run()
 
     const std::chrono::time_point<std::chrono::high_resolution_clock> start = std::chrono::high_resolution_clock::now();
 
-    int id          = 0;
     int id_run_test = 0;
     ARM_COMPUTE_UNUSED(id_run_test); // Not used if ARM_COMPUTE_CL is not defined
 
-    for(auto &test_factory : _test_factories)
+    // Run all the tests under one configuration before switching to the next one
+    const size_t num_passes = std::max<size_t>(1U, _sweep.size());
+    for(size_t pass = 0; pass < num_passes; ++pass)
     {
-        const std::string test_case_name = test_factory->name();
-        const TestInfo    test_info{ id, test_case_name, test_factory->mode(), test_factory->status() };
+        _current_sweep = _sweep.empty() ? nullptr : &_sweep[pass];
+        if(_current_sweep != nullptr && _current_sweep->apply)
+        {
+            _current_sweep->apply();
+        }
 
-        if(_test_filter->is_selected(test_info))
+        int id = 0;
+        for(auto &test_factory : _test_factories)
         {
-#ifdef ARM_COMPUTE_CL
-            // Every 100 tests, reset the OpenCL context to release the allocated memory
-            if(opencl_is_available() && (id_run_test % 100) == 0)
+            const std::string test_case_name = test_factory->name();
+            const TestInfo    test_info{ id, test_case_name, test_factory->mode(), test_factory->status() };
+
+            if(_test_filter->is_selected(test_info))
             {
-                auto ctx_properties   = CLScheduler::get().context().getInfo<CL_CONTEXT_PROPERTIES>(nullptr);
-                auto queue_properties = CLScheduler::get().queue().getInfo<CL_QUEUE_PROPERTIES>(nullptr);
+                // The tests are filtered by their own name, and reported under the name of the configuration as well
+                const TestInfo run_info = _current_sweep != nullptr ? TestInfo{ id, test_case_name + "@" + _current_sweep->name, test_info.mode, test_info.status } : test_info;
+#ifdef ARM_COMPUTE_CL
+                // Every 100 tests, reset the OpenCL context to release the allocated memory
+                if(opencl_is_available() && (id_run_test % 100) == 0)
+                {
+                    auto ctx_properties   = CLScheduler::get().context().getInfo<CL_CONTEXT_PROPERTIES>(nullptr);
+                    auto queue_properties = CLScheduler::get().queue().getInfo<CL_QUEUE_PROPERTIES>(nullptr);
 
-                cl::Context      new_ctx   = cl::Context(CL_DEVICE_TYPE_DEFAULT, ctx_properties.data());
-                cl::CommandQueue new_queue = cl::CommandQueue(new_ctx, CLKernelLibrary::get().get_device(), queue_properties);
+                    cl::Context      new_ctx   = cl::Context(CL_DEVICE_TYPE_DEFAULT, ctx_properties.data());
+                    cl::CommandQueue new_queue = cl::CommandQueue(new_ctx, CLKernelLibrary::get().get_device(), queue_properties);
 
-                CLKernelLibrary::get().clear_programs_cache();
-                CLScheduler::get().set_context(new_ctx);
-                CLScheduler::get().set_queue(new_queue);
-            }
+                    CLKernelLibrary::get().clear_programs_cache();
+                    CLScheduler::get().set_context(new_ctx);
+                    CLScheduler::get().set_queue(new_queue);
+                }
 #endif // ARM_COMPUTE_CL
-            TestResult::Status result = run_test(test_info, *test_factory);
-            if((_print_rerun_cmd) && (result == TestResult::Status::CRASHED || result == TestResult::Status::FAILED))
-            {
-                std::cout << "Rerun command: ./arm_compute_validation --filter='^" << test_info.name << "$' --seed=" << _seed << std::endl;
+                TestResult::Status result = run_test(run_info, *test_factory);
+                if((_print_rerun_cmd) && (result == TestResult::Status::CRASHED || result == TestResult::Status::FAILED))
+                {
+                    std::cout << "Rerun command: ./arm_compute_validation --filter='^" << test_info.name << "$' --seed=" << _seed << std::endl;
+                }
+                ++id_run_test;
+
+                // Run test delay
+                sleep_in_seconds(_cooldown_sec);
             }
-            ++id_run_test;
 
-            // Run test delay
-            sleep_in_seconds(_cooldown_sec);
+            ++id;
         }
-
-        ++id;
     }
+    _current_sweep = nullptr;
 
     const std::chrono::time_point<std::chrono::high_resolution_clock> end = std::chrono::high_resolution_clock::now();
 
@@ -630,6 +668,59 @@ bool Framework::run()
     return (static_cast<unsigned int>(num_successful_tests) == _test_results.size());
 }
 
+void Framework::set_sweep(std::vector<SweepConfiguration> sweep)
+{
+    _sweep = std::move(sweep);
+}
+
+void Framework::add_scaling_measurements(const TestInfo &info, Profiler::MeasurementsMap &measurements)
+{
+    static const std::string wall_clock_time = "Wall clock/Wall clock time";
+    static const std::string energy          = "Energy/Energy";
+
+    const auto key       = std::make_pair(info.id, _current_sweep->group);
+    const auto reference = _sweep_references.find(key);
+    if(reference == _sweep_references.end())
+    {
+        // First configuration of the group: the next ones are compared to it
+        _sweep_references.emplace(key, std::make_pair(_current_sweep->num_threads, measurements));
+        return;
+    }
+
+    // Median of a measurement, or a negative value if it was not taken
+    const auto median_of = [](const Profiler::MeasurementsMap & map, const std::string & name)
+    {
+        const auto measurement = map.find(name);
+        if(measurement == map.end() || measurement->second.empty())
+        {
+            return -1.0;
+        }
+        const Measurement::Value value = InstrumentsStats(measurement->second).median().value();
+        return value.is_floating_point ? value.v.floating_point : static_cast<double>(value.v.integer);
+    };
+
+    const double reference_median = median_of(reference->second.second, wall_clock_time);
+    const double median           = median_of(measurements, wall_clock_time);
+    if(reference_median >= 0.0 && median > 0.0)
+    {
+        const double speed_up = reference_median / median;
+        measurements["Scaling/Speed-up"].emplace_back(speed_up, "x");
+        if(reference->second.first > 0 && _current_sweep->num_threads > 0)
+        {
+            const double thread_ratio = static_cast<double>(_current_sweep->num_threads) / reference->second.first;
+            measurements["Scaling/Parallel efficiency"].emplace_back(100.0 * speed_up / thread_ratio, "%");
+        }
+    }
+
+    // Below 1x the configuration does the same work for less energy than the reference one
+    const double reference_energy = median_of(reference->second.second, energy);
+    const double median_energy    = median_of(measurements, energy);
+    if(reference_energy > 0.0 && median_energy >= 0.0)
+    {
+        measurements["Scaling/Relative energy"].emplace_back(median_energy / reference_energy, "x");
+    }
+}
+
 void Framework::set_test_result(TestInfo info, TestResult result)
 {
     _test_results.emplace(std::move(info), std::move(result));
@@ -663,7 +754,8 @@ Profiler Framework::get_profiler() const
     {
         return std::find_if(_instruments.begin(), _instruments.end(), [&](InstrumentsDescription type) -> bool {
             const auto group = static_cast<InstrumentType>(static_cast<uint64_t>(type.first) & 0xFF00);
-            return (group == instrument.first) && (instrument.second == type.second);
+            // Event groups are separate instruments, also selecting the main instrument of their family
+            return (group == instrument.first || type.first == instrument.first) && (instrument.second == type.second);
         })
         != _instruments.end();
     };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <functional>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -88,9 +89,19 @@ struct TestInfo
 
 inline bool operator<(const TestInfo &lhs, const TestInfo &rhs)
 {
-    return lhs.id < rhs.id;
+    // The same test runs once per sweep configuration, under a different name
+    return lhs.id < rhs.id || (lhs.id == rhs.id && lhs.name < rhs.name);
 }
 
+/** Runtime configuration the tests are run under when sweeping, e.g. a number of threads. */
+struct SweepConfiguration
+{
+    std::string           name;        /**< Suffix appended to the names of the tests run under this configuration. */
+    std::string           group;       /**< Configurations of a group are compared to the first one of the group. */
+    unsigned int          num_threads; /**< Number of threads of the configuration, used for the parallel efficiency. */
+    std::function<void()> apply;       /**< Function applying the configuration before the tests are run. */
+};
+
 /** Main framework class.
  *
  * Keeps track of the global state, owns all test cases and collects results.
@@ -175,6 +186,16 @@ public:
      */
     void print_test_info(std::ostream &os) const;
 
+    /** Add a measurement computed by the running test.
+     *
+     * The measurement is reported along with the ones of the instruments. Measurements added several times under the
+     * same name, for instance once per iteration, are aggregated like the iterations of an instrument.
+     *
+     * @param[in] name        Name of the measurement.
+     * @param[in] measurement Value of the measurement.
+     */
+    void add_test_measurement(const std::string &name, Measurement measurement);
+
     /** Tell the framework that execution of a test starts.
      *
      * @param[in] info Test info.
@@ -349,6 +370,15 @@ public:
      */
     void set_seed(unsigned int seed);
 
+    /** Set the configurations to sweep.
+     *
+     * All the selected tests are run once per configuration. The wall clock time of each run is compared to the
+     * one of the first configuration of its group, which is reported as speed-up and parallel efficiency.
+     *
+     * @param[in] sweep Configurations to run the tests under, in order. Empty to run the tests once.
+     */
+    void set_sweep(std::vector<SweepConfiguration> sweep);
+
 private:
     Framework();
     ~Framework() = default;
@@ -357,6 +387,7 @@ private:
     Framework &operator=(const Framework &) = delete;
 
     TestResult::Status run_test(const TestInfo &info, TestCaseFactory &test_factory);
+    void add_scaling_measurements(const TestInfo &info, Profiler::MeasurementsMap &measurements);
     std::map<TestResult::Status, int> count_test_results() const;
 
     /** Returns the current test suite name.
@@ -389,6 +420,11 @@ private:
     PrepareFunc            _prepare_function{};
     bool                   _print_iterations{false};
 
+    std::vector<SweepConfiguration> _sweep{};
+    const SweepConfiguration       *_current_sweep{ nullptr };
+    /** Number of threads and measurements of the first configuration of each group, per test */
+    std::map<std::pair<int, std::string>, std::pair<unsigned int, Profiler::MeasurementsMap>> _sweep_references{};
+
     using create_function = std::unique_ptr<Instrument>();
     std::map<InstrumentsDescription, create_function *> _available_instruments{};
 
@@ -398,6 +434,7 @@ private:
     const TestInfo                             *_current_test_info{ nullptr };
     TestResult                                 *_current_test_result{ nullptr };
     std::vector<std::string>                    _test_info{};
+    Profiler::MeasurementsMap                   _test_measurements{};
 };
 
 template <typename T>
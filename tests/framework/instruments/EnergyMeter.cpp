@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "EnergyMeter.h"
+
+#include "../Framework.h"
+#include "../Utils.h"
+
+#if defined(__linux__)
+#include <dirent.h>
+#endif /* defined(__linux__) */
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+namespace
+{
+/** Interval between two samples of the power sensors */
+constexpr std::chrono::microseconds sampling_interval{ 1000 };
+
+#if defined(__linux__)
+std::vector<std::string> list_directory(const std::string &path)
+{
+    std::vector<std::string> entries;
+    DIR                     *dir = opendir(path.c_str());
+    if(dir != nullptr)
+    {
+        for(struct dirent *entry = readdir(dir); entry != nullptr; entry = readdir(dir))
+        {
+            const std::string name = entry->d_name;
+            if(name != "." && name != "..")
+            {
+                entries.push_back(name);
+            }
+        }
+        closedir(dir);
+    }
+    std::sort(entries.begin(), entries.end());
+    return entries;
+}
+
+std::string read_line(const std::string &path)
+{
+    std::ifstream file(path);
+    std::string   line;
+    std::getline(file, line);
+    return line;
+}
+
+bool starts_with(const std::string &str, const std::string &prefix)
+{
+    return str.compare(0, prefix.size(), prefix) == 0;
+}
+
+bool ends_with(const std::string &str, const std::string &suffix)
+{
+    return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+#endif /* defined(__linux__) */
+} // namespace
+
+EnergyMeter::EnergyMeter(ScaleFactor scale_factor)
+{
+    switch(scale_factor)
+    {
+        case ScaleFactor::NONE:
+            _scale_factor = 1.0;
+            _unit         = "uJ";
+            break;
+        case ScaleFactor::SCALE_1K:
+            _scale_factor = 1000.0;
+            _unit         = "mJ";
+            break;
+        case ScaleFactor::SCALE_1M:
+            _scale_factor = 1000000.0;
+            _unit         = "J";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Invalid scale");
+    }
+    discover_rails();
+}
+
+EnergyMeter::~EnergyMeter()
+{
+    _sampling = false;
+    if(_sampler.joinable())
+    {
+        _sampler.join();
+    }
+}
+
+std::string EnergyMeter::id() const
+{
+    return "Energy";
+}
+
+void EnergyMeter::discover_rails()
+{
+#if defined(__linux__)
+    // Linux hardware monitors: energyN_input accumulators are preferred over powerN_input sensors of the same device
+    static const std::string hwmon = "/sys/class/hwmon/";
+    for(const auto &device : list_directory(hwmon))
+    {
+        const std::string device_path = hwmon + device + "/";
+        const std::string device_name = read_line(device_path + "name");
+        const auto        files       = list_directory(device_path);
+        const bool        has_energy  = std::any_of(files.begin(), files.end(), [](const std::string & f)
+        {
+            return starts_with(f, "energy") && ends_with(f, "_input");
+        });
+        for(const auto &file : files)
+        {
+            const bool energy = starts_with(file, "energy") && ends_with(file, "_input");
+            const bool power  = !has_energy && starts_with(file, "power") && ends_with(file, "_input");
+            if(!energy && !power)
+            {
+                continue;
+            }
+            const std::string channel = file.substr(0, file.size() - std::string("_input").size());
+            const std::string label   = read_line(device_path + channel + "_label");
+            Rail              rail{ device_name + ":" + (label.empty() ? channel : label), energy ? RailType::ENERGY_UJ : RailType::POWER_UW, device_path + file };
+            _rails.push_back(rail);
+        }
+    }
+
+    // Android on-device power monitors, listing one "CH<n>(T=<ms>)[<rail>], <energy>" line per channel
+    static const std::string iio = "/sys/bus/iio/devices/";
+    for(const auto &device : list_directory(iio))
+    {
+        const std::string path = iio + device + "/energy_value";
+        std::ifstream     file(path);
+        std::string       line;
+        while(std::getline(file, line))
+        {
+            const size_t open  = line.find('[');
+            const size_t close = line.find(']');
+            if(starts_with(line, "CH") && open != std::string::npos && close != std::string::npos && close > open)
+            {
+                _rails.push_back(Rail{ line.substr(open + 1, close - open - 1), RailType::ODPM, path });
+            }
+        }
+    }
+
+    // Android battery, as a last resort since it includes the whole device and only reports when discharging
+    if(_rails.empty())
+    {
+        static const std::string power_supply = "/sys/class/power_supply/";
+        for(const auto &supply : list_directory(power_supply))
+        {
+            const std::string path = power_supply + supply + "/";
+            if(read_line(path + "type") == "Battery" && !read_line(path + "current_now").empty() && !read_line(path + "voltage_now").empty())
+            {
+                Rail rail{ supply, RailType::SUPPLY, path + "current_now" };
+                rail.voltage_path = path + "voltage_now";
+                _rails.push_back(rail);
+            }
+        }
+    }
+#endif /* defined(__linux__) */
+}
+
+double EnergyMeter::read_rail(const Rail &rail) const
+{
+    double value = 0.0;
+#if defined(__linux__)
+    switch(rail.type)
+    {
+        case RailType::ENERGY_UJ:
+        case RailType::POWER_UW:
+            std::istringstream(read_line(rail.path)) >> value;
+            break;
+        case RailType::SUPPLY:
+        {
+            double current_ua = 0.0;
+            double voltage_uv = 0.0;
+            std::istringstream(read_line(rail.path)) >> current_ua;
+            std::istringstream(read_line(rail.voltage_path)) >> voltage_uv;
+            // The sign of the current depends on the driver
+            value = std::abs(current_ua) * voltage_uv / 1000000.0;
+            break;
+        }
+        case RailType::ODPM:
+        {
+            std::ifstream     file(rail.path);
+            std::string       line;
+            const std::string tag = "[" + rail.name + "],";
+            while(std::getline(file, line))
+            {
+                const size_t pos = line.find(tag);
+                if(pos != std::string::npos)
+                {
+                    std::istringstream(line.substr(pos + tag.size())) >> value;
+                    break;
+                }
+            }
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Unsupported rail type");
+    }
+#else  /* defined(__linux__) */
+    ARM_COMPUTE_UNUSED(rail);
+#endif /* defined(__linux__) */
+    return value;
+}
+
+void EnergyMeter::sample_sensors(std::chrono::steady_clock::time_point previous)
+{
+    while(_sampling)
+    {
+        std::this_thread::sleep_for(sampling_interval);
+        const auto   now = std::chrono::steady_clock::now();
+        const double dt  = std::chrono::duration<double>(now - previous).count();
+        previous         = now;
+        for(auto &rail : _rails)
+        {
+            if(rail.type == RailType::POWER_UW || rail.type == RailType::SUPPLY)
+            {
+                // Trapezoidal integration of the power in uW over the interval in s
+                const double power_uw = read_rail(rail);
+                rail.energy_uj += 0.5 * (rail.start + power_uw) * dt;
+                rail.start = power_uw;
+            }
+        }
+    }
+}
+
+void EnergyMeter::start()
+{
+    bool has_sensors = false;
+    for(auto &rail : _rails)
+    {
+        rail.energy_uj = 0.0;
+        rail.start     = read_rail(rail);
+        has_sensors |= (rail.type == RailType::POWER_UW || rail.type == RailType::SUPPLY);
+    }
+    _start = std::chrono::steady_clock::now();
+    if(has_sensors)
+    {
+        _sampling = true;
+        _sampler  = std::thread(&EnergyMeter::sample_sensors, this, _start);
+    }
+}
+
+void EnergyMeter::stop()
+{
+    const auto stop = std::chrono::steady_clock::now();
+    if(_sampler.joinable())
+    {
+        _sampling = false;
+        _sampler.join();
+    }
+    _elapsed_s = std::chrono::duration<double>(stop - _start).count();
+    for(auto &rail : _rails)
+    {
+        if(rail.type == RailType::ENERGY_UJ || rail.type == RailType::ODPM)
+        {
+            rail.energy_uj = read_rail(rail) - rail.start;
+        }
+    }
+}
+
+Instrument::MeasurementsMap EnergyMeter::measurements() const
+{
+    MeasurementsMap measurements;
+    if(_rails.empty())
+    {
+        return measurements;
+    }
+
+    double total_uj = 0.0;
+    for(const auto &rail : _rails)
+    {
+        measurements.emplace("Energy[" + rail.name + "]", Measurement(rail.energy_uj / _scale_factor, _unit));
+        total_uj += rail.energy_uj;
+    }
+    measurements.emplace("Energy", Measurement(total_uj / _scale_factor, _unit));
+    if(_elapsed_s > 0.0)
+    {
+        measurements.emplace("Average power", Measurement(total_uj / _elapsed_s / 1000.0, "mW"));
+    }
+    return measurements;
+}
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_FRAMEWORK_INSTRUMENTS_ENERGYMETER_H
+#define ACL_TESTS_FRAMEWORK_INSTRUMENTS_ENERGYMETER_H
+
+#include "Instrument.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+/** Implementation of an instrument to measure the energy drawn from the power rails of the platform.
+ *
+ * The rails are discovered when the instrument is created:
+ * - The energy accumulators and power sensors of the Linux hwmon devices (/sys/class/hwmon).
+ * - The rails of the Android on-device power monitors (energy_value of the /sys/bus/iio/devices/iio:device<N> devices).
+ * - The battery of the Android power supply class (/sys/class/power_supply), from its current and voltage.
+ *
+ * Accumulators are read at the start and end of each iteration. Power sensors are sampled by a background
+ * thread during the iteration and their samples integrated. The sensors typically update every millisecond
+ * or slower, so short iterations should be run many times and the median energy looked at.
+ */
+class EnergyMeter : public Instrument
+{
+public:
+    /** Construct an energy meter.
+     *
+     * @param[in] scale_factor Measurement scale factor.
+     */
+    EnergyMeter(ScaleFactor scale_factor);
+    /** Prevent instances of this class from being copied (As this class contains a sampling thread) */
+    EnergyMeter(const EnergyMeter &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains a sampling thread) */
+    EnergyMeter &operator=(const EnergyMeter &) = delete;
+    /** Stop the sampling thread if it is running */
+    ~EnergyMeter();
+
+    std::string     id() const override;
+    void            start() override;
+    void            stop() override;
+    MeasurementsMap measurements() const override;
+
+private:
+    /** How the value of a rail is read */
+    enum class RailType
+    {
+        ENERGY_UJ, /**< Accumulated energy in microjoules */
+        POWER_UW,  /**< Instantaneous power in microwatts */
+        SUPPLY,    /**< Instantaneous current in microamperes and voltage in microvolts */
+        ODPM,      /**< Channel of an on-device power monitor, accumulated energy in microwatt-seconds */
+    };
+
+    /** Power rail */
+    struct Rail
+    {
+        std::string name;             /**< Name of the rail */
+        RailType    type;             /**< How the rail is read */
+        std::string path;             /**< File read, the current for @ref RailType::SUPPLY */
+        std::string voltage_path{};   /**< Voltage file of a @ref RailType::SUPPLY rail */
+        double      start{ 0.0 };     /**< Value at the start of the iteration, or last sample of a sensor */
+        double      energy_uj{ 0.0 }; /**< Energy of the last iteration */
+    };
+
+    void   discover_rails();
+    double read_rail(const Rail &rail) const;
+    void   sample_sensors(std::chrono::steady_clock::time_point previous);
+
+    std::vector<Rail>                     _rails{};
+    std::thread                           _sampler{};
+    std::atomic<bool>                     _sampling{ false };
+    std::chrono::steady_clock::time_point _start{};
+    double                                _elapsed_s{ 0.0 };
+    double                                _scale_factor{ 1.0 };
+};
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
+#endif /* ACL_TESTS_FRAMEWORK_INSTRUMENTS_ENERGYMETER_H */
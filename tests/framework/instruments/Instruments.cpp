@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 Arm Limited.
+ * Copyright (c) 2017-2018, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -58,6 +58,9 @@ InstrumentsDescription instrument_type_from_name(const std::string &name)
         { "pmu_m", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::SCALE_1M) },
         { "pmu_cycles", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_CYCLE_COUNTER, ScaleFactor::NONE) },
         { "pmu_instructions", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_INSTRUCTION_COUNTER, ScaleFactor::NONE) },
+        { "pmu_cache", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_CACHE, ScaleFactor::NONE) },
+        { "pmu_memory", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_MEMORY, ScaleFactor::NONE) },
+        { "pmu_sve", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_SVE, ScaleFactor::NONE) },
         { "mali", std::pair<InstrumentType, ScaleFactor>(InstrumentType::MALI, ScaleFactor::NONE) },
         { "mali_k", std::pair<InstrumentType, ScaleFactor>(InstrumentType::MALI, ScaleFactor::SCALE_1K) },
         { "mali_m", std::pair<InstrumentType, ScaleFactor>(InstrumentType::MALI, ScaleFactor::SCALE_1M) },
@@ -72,6 +75,9 @@ InstrumentsDescription instrument_type_from_name(const std::string &name)
         { "opencl_memory_usage", std::pair<InstrumentType, ScaleFactor>(InstrumentType::OPENCL_MEMORY_USAGE, ScaleFactor::NONE) },
         { "opencl_memory_usage_k", std::pair<InstrumentType, ScaleFactor>(InstrumentType::OPENCL_MEMORY_USAGE, ScaleFactor::SCALE_1K) },
         { "opencl_memory_usage_m", std::pair<InstrumentType, ScaleFactor>(InstrumentType::OPENCL_MEMORY_USAGE, ScaleFactor::SCALE_1M) },
+        { "energy", std::pair<InstrumentType, ScaleFactor>(InstrumentType::ENERGY, ScaleFactor::NONE) },
+        { "energy_mj", std::pair<InstrumentType, ScaleFactor>(InstrumentType::ENERGY, ScaleFactor::SCALE_1K) },
+        { "energy_j", std::pair<InstrumentType, ScaleFactor>(InstrumentType::ENERGY, ScaleFactor::SCALE_1M) },
     };
 
     try
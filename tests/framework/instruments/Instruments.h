@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 #include "OpenCLTimer.h"
 #include "PMUCounter.h"
 #endif /* !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(__QNX__) */
+#include "EnergyMeter.h"
 #include "SchedulerTimer.h"
 #include "WallClockTimer.h"
 
@@ -51,6 +52,9 @@ enum class InstrumentType : unsigned int
     PMU                     = 0x0200,
     PMU_CYCLE_COUNTER       = 0x0201,
     PMU_INSTRUCTION_COUNTER = 0x0202,
+    PMU_CACHE               = 0x0203,
+    PMU_MEMORY              = 0x0204,
+    PMU_SVE                 = 0x0205,
     MALI                    = 0x0300,
     OPENCL_TIMER            = 0x0400,
     SCHEDULER_TIMER         = 0x0500,
@@ -58,6 +62,7 @@ enum class InstrumentType : unsigned int
     WALL_CLOCK_TIMESTAMPS   = 0x0700,
     OPENCL_TIMESTAMPS       = 0x0800,
     SCHEDULER_TIMESTAMPS    = 0x0900,
+    ENERGY                  = 0x0A00,
 };
 
 struct InstrumentsInfo
@@ -168,6 +173,15 @@ inline ::std::stringstream &operator<<(::std::stringstream &stream, InstrumentsD
         case InstrumentType::PMU_INSTRUCTION_COUNTER:
             stream << "PMU_INSTRUCTION_COUNTER";
             break;
+        case InstrumentType::PMU_CACHE:
+            stream << "PMU_CACHE";
+            break;
+        case InstrumentType::PMU_MEMORY:
+            stream << "PMU_MEMORY";
+            break;
+        case InstrumentType::PMU_SVE:
+            stream << "PMU_SVE";
+            break;
         case InstrumentType::MALI:
             switch(instrument.second)
             {
@@ -238,6 +252,22 @@ inline ::std::stringstream &operator<<(::std::stringstream &stream, InstrumentsD
                     throw std::invalid_argument("Unsupported instrument scale");
             }
             break;
+        case InstrumentType::ENERGY:
+            switch(instrument.second)
+            {
+                case ScaleFactor::NONE:
+                    stream << "ENERGY";
+                    break;
+                case ScaleFactor::SCALE_1K:
+                    stream << "ENERGY_MJ";
+                    break;
+                case ScaleFactor::SCALE_1M:
+                    stream << "ENERGY_J";
+                    break;
+                default:
+                    throw std::invalid_argument("Unsupported instrument scale");
+            }
+            break;
         case InstrumentType::ALL:
             stream << "ALL";
             break;
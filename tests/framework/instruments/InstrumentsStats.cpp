@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 Arm Limited.
+ * Copyright (c) 2018, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,9 @@
 #include "InstrumentsStats.h"
 #include "arm_compute/core/utils/misc/Utility.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace arm_compute
 {
 namespace test
@@ -31,7 +34,7 @@ namespace test
 namespace framework
 {
 InstrumentsStats::InstrumentsStats(const std::vector<Measurement> &measurements)
-    : _min(nullptr), _max(nullptr), _median(nullptr), _mean(measurements.begin()->value().is_floating_point), _stddev(0.0)
+    : _sorted(), _min(nullptr), _max(nullptr), _median(nullptr), _mean(measurements.begin()->value().is_floating_point), _stddev(0.0)
 {
     auto add_measurements = [](Measurement::Value a, const Measurement & b)
     {
@@ -43,6 +46,11 @@ InstrumentsStats::InstrumentsStats(const std::vector<Measurement> &measurements)
     _median      = &measurements[indices[measurements.size() / 2]];
     _min         = &measurements[indices[0]];
     _max         = &measurements[indices[measurements.size() - 1]];
+    _sorted.reserve(indices.size());
+    for(auto index : indices)
+    {
+        _sorted.push_back(&measurements[index]);
+    }
 
     Measurement::Value sum_values = std::accumulate(measurements.begin(), measurements.end(), Measurement::Value(_min->value().is_floating_point), add_measurements);
 
@@ -57,6 +65,13 @@ InstrumentsStats::InstrumentsStats(const std::vector<Measurement> &measurements)
     auto variance = sq_sum / measurements.size();
     _stddev       = Measurement::Value::relative_standard_deviation(variance, _mean);
 }
+
+const Measurement &InstrumentsStats::percentile(double p) const
+{
+    const double rank  = std::ceil(std::max(0.0, std::min(p, 100.0)) / 100.0 * _sorted.size());
+    const size_t index = rank < 1.0 ? 0 : static_cast<size_t>(rank) - 1;
+    return *_sorted[std::min(index, _sorted.size() - 1)];
+}
 } // namespace framework
 } // namespace test
 } // namespace arm_compute
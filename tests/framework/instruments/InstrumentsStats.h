@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 Arm Limited.
+ * Copyright (c) 2018, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -74,13 +74,21 @@ public:
     {
         return _stddev;
     }
+    /** The measurement at the given percentile, using the nearest-rank method
+     *
+     * @param[in] p Percentile in the range [0, 100]
+     *
+     * @return The smallest measurement that is greater or equal to p percent of the measurements
+     */
+    const Measurement &percentile(double p) const;
 
 private:
-    const Measurement *_min;
-    const Measurement *_max;
-    const Measurement *_median;
-    Measurement::Value _mean;
-    double             _stddev;
+    std::vector<const Measurement *> _sorted;
+    const Measurement               *_min;
+    const Measurement               *_max;
+    const Measurement               *_median;
+    Measurement::Value               _mean;
+    double                           _stddev;
 };
 
 } // namespace framework
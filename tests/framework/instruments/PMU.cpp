@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019 Arm Limited.
+ * Copyright (c) 2017-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,6 +47,8 @@ PMU::PMU()
     _perf_config.inherit = 1;
     // Enables saving of event counts on context switch for inherited tasks
     _perf_config.inherit_stat = 1;
+    // Report how long the counter was scheduled, to scale its value when multiplexed
+    _perf_config.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
 }
 
 PMU::PMU(uint64_t config)
@@ -68,8 +70,7 @@ void PMU::open(uint64_t config)
 
 void PMU::open(const perf_event_attr &perf_config)
 {
-    // Measure this process/thread (+ children) on any CPU
-    _fd = syscall(__NR_perf_event_open, &perf_config, 0, -1, -1, 0);
+    _fd = open_fd(perf_config, -1);
 
     ARM_COMPUTE_ERROR_ON_MSG(_fd < 0, "perf_event_open failed");
 
@@ -80,6 +81,48 @@ void PMU::open(const perf_event_attr &perf_config)
     }
 }
 
+bool PMU::try_open(uint32_t type, uint64_t config, const PMU *leader)
+{
+    close();
+
+    perf_event_attr perf_config = _perf_config;
+    perf_config.type            = type;
+    perf_config.config          = config;
+
+    _fd = open_fd(perf_config, (leader != nullptr) ? leader->_fd : -1);
+    if(_fd < 0 || ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0) == -1)
+    {
+        close();
+        return false;
+    }
+    _perf_config = perf_config;
+    return true;
+}
+
+bool PMU::is_open() const
+{
+    return _fd != -1;
+}
+
+long PMU::open_fd(const perf_event_attr &perf_config, long group_fd) const
+{
+    // Measure this process/thread (+ children) on any CPU
+    return syscall(__NR_perf_event_open, &perf_config, 0, -1, static_cast<int>(group_fd), 0);
+}
+
+PMU::ReadFormat PMU::read_counter() const
+{
+    ReadFormat    data{};
+    const ssize_t result = read(_fd, &data, sizeof(data));
+
+    if(result == -1)
+    {
+        ARM_COMPUTE_ERROR_VAR("Can't get PMU counter value: %d", errno);
+    }
+
+    return data;
+}
+
 void PMU::close()
 {
     if(_fd != -1)
@@ -96,6 +139,7 @@ void PMU::reset()
     {
         ARM_COMPUTE_ERROR_VAR("Failed to reset PMU counter: %d", errno);
     }
+    _at_reset = read_counter();
 }
 } // namespace framework
 } // namespace test
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019 Arm Limited.
+ * Copyright (c) 2017-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -76,6 +76,25 @@ public:
      */
     void open(const perf_event_attr &perf_config);
 
+    /** Try to open a counter, without failing if the event is not supported.
+     *
+     * The counters of a group are scheduled on the hardware together, so ratios between them are consistent
+     * when the kernel has to multiplex more events than there are hardware counters.
+     *
+     * @param[in] type   Type of the event, e.g. PERF_TYPE_HARDWARE or PERF_TYPE_RAW.
+     * @param[in] config Event identifier.
+     * @param[in] leader (Optional) Already opened leader of the group of the counter.
+     *
+     * @return True if the counter has been opened.
+     */
+    bool try_open(uint32_t type, uint64_t config, const PMU *leader = nullptr);
+
+    /** Whether the counter is open.
+     *
+     * @return True if the counter is open.
+     */
+    bool is_open() const;
+
     /** Close the currently open counter. */
     void close();
 
@@ -83,22 +102,37 @@ public:
     void reset();
 
 private:
+    /** Layout of a counter read with PERF_FORMAT_TOTAL_TIME_ENABLED and PERF_FORMAT_TOTAL_TIME_RUNNING */
+    struct ReadFormat
+    {
+        uint64_t value{ 0 };
+        uint64_t time_enabled{ 0 };
+        uint64_t time_running{ 0 };
+    };
+
+    ReadFormat read_counter() const;
+    long       open_fd(const perf_event_attr &perf_config, long group_fd) const;
+
     perf_event_attr _perf_config;
     long            _fd{ -1 };
+    ReadFormat      _at_reset{};
 };
 
 template <typename T>
 T PMU::get_value() const
 {
-    T             value{};
-    const ssize_t result = read(_fd, &value, sizeof(T));
+    const ReadFormat data = read_counter();
+
+    // Times are not reset with the counter
+    const uint64_t enabled = data.time_enabled - _at_reset.time_enabled;
+    const uint64_t running = data.time_running - _at_reset.time_running;
 
-    if(result == -1)
+    // The counter only ran for part of the time when multiplexed with other counters: extrapolate its value
+    if(running > 0 && running < enabled)
     {
-        ARM_COMPUTE_ERROR_VAR("Can't get PMU counter value: %d", errno);
+        return static_cast<T>(static_cast<double>(data.value) * static_cast<double>(enabled) / static_cast<double>(running));
     }
-
-    return value;
+    return static_cast<T>(data.value);
 }
 } // namespace framework
 } // namespace test
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017 Arm Limited.
+ * Copyright (c) 2017, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,51 +23,171 @@
  */
 #include "PMUCounter.h"
 
+#include <utility>
+
 namespace arm_compute
 {
 namespace test
 {
 namespace framework
 {
-std::string PMUCounter::id() const
+namespace
+{
+/** Description of an event to count */
+struct EventDescription
+{
+    const char *name;
+    const char *unit;
+    uint32_t    type;
+    uint64_t    config;
+};
+
+constexpr uint64_t hw_cache_event(uint64_t cache, uint64_t result)
 {
-    return "PMU Counter";
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (result << 16);
 }
 
-void PMUCounter::start()
+// Common Armv8 PMU events, not exposed as generic events by the kernel
+constexpr uint64_t armv8_l2d_cache          = 0x16;
+constexpr uint64_t armv8_l2d_cache_refill   = 0x17;
+constexpr uint64_t armv8_bus_access         = 0x19;
+constexpr uint64_t armv8_stall_backend_mem  = 0x4005;
+constexpr uint64_t armv8_sve_inst_retired   = 0x8002;
+constexpr int      cache_line_size_in_bytes = 64;
+
+std::vector<EventDescription> group_events(PMUEventGroup group)
 {
-    _pmu_cycles.reset();
-    _pmu_instructions.reset();
+    // The cycles are counted first, to lead the group
+    std::vector<EventDescription> events{ { "CPU cycles", "cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES } };
+    switch(group)
+    {
+        case PMUEventGroup::CACHE:
+            events.push_back({ "L1D cache reads", "accesses", PERF_TYPE_HW_CACHE, hw_cache_event(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_RESULT_ACCESS) });
+            events.push_back({ "L1D cache refills", "refills", PERF_TYPE_HW_CACHE, hw_cache_event(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_RESULT_MISS) });
+#ifdef __aarch64__
+            events.push_back({ "L2D cache accesses", "accesses", PERF_TYPE_RAW, armv8_l2d_cache });
+            events.push_back({ "L2D cache refills", "refills", PERF_TYPE_RAW, armv8_l2d_cache_refill });
+#endif /* __aarch64__ */
+            events.push_back({ "LLC reads", "accesses", PERF_TYPE_HW_CACHE, hw_cache_event(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_RESULT_ACCESS) });
+            events.push_back({ "LLC refills", "refills", PERF_TYPE_HW_CACHE, hw_cache_event(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_RESULT_MISS) });
+            break;
+        case PMUEventGroup::MEMORY:
+#ifdef __aarch64__
+            events.push_back({ "Bus accesses", "accesses", PERF_TYPE_RAW, armv8_bus_access });
+            events.push_back({ "L2D cache refills", "refills", PERF_TYPE_RAW, armv8_l2d_cache_refill });
+            events.push_back({ "Backend memory stall cycles", "cycles", PERF_TYPE_RAW, armv8_stall_backend_mem });
+#endif /* __aarch64__ */
+            events.push_back({ "Backend stall cycles", "cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_BACKEND });
+            break;
+        case PMUEventGroup::SVE:
+            events.push_back({ "CPU instructions", "instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS });
+#ifdef __aarch64__
+            events.push_back({ "SVE instructions", "instructions", PERF_TYPE_RAW, armv8_sve_inst_retired });
+#endif /* __aarch64__ */
+            break;
+        case PMUEventGroup::DEFAULT:
+        default:
+            events.push_back({ "CPU instructions", "instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS });
+            break;
+    }
+    return events;
 }
+} // namespace
 
-void PMUCounter::stop()
+void PMUCounter::open_events()
 {
-    try
+    for(const auto &description : group_events(_group))
     {
-        _cycles = _pmu_cycles.get_value<long long>();
+        auto       pmu    = std::make_unique<PMU>();
+        const PMU *leader = _events.empty() ? nullptr : _events.front().pmu.get();
+        if(pmu->try_open(description.type, description.config, leader))
+        {
+            _events.push_back(Event{ description.name, description.unit, std::move(pmu) });
+        }
     }
-    catch(const std::runtime_error &)
+}
+
+long long PMUCounter::value_of(const std::string &name) const
+{
+    for(const auto &event : _events)
     {
-        _cycles = 0;
+        if(event.name == name)
+        {
+            return event.value;
+        }
     }
+    return 0;
+}
 
-    try
+std::string PMUCounter::id() const
+{
+    switch(_group)
     {
-        _instructions = _pmu_instructions.get_value<long long>();
+        case PMUEventGroup::CACHE:
+            return "PMU Cache";
+        case PMUEventGroup::MEMORY:
+            return "PMU Memory";
+        case PMUEventGroup::SVE:
+            return "PMU SVE";
+        case PMUEventGroup::DEFAULT:
+        default:
+            return "PMU Counter";
     }
-    catch(const std::runtime_error &)
+}
+
+void PMUCounter::start()
+{
+    for(auto &event : _events)
     {
-        _instructions = 0;
+        event.pmu->reset();
+    }
+}
+
+void PMUCounter::stop()
+{
+    for(auto &event : _events)
+    {
+        try
+        {
+            event.value = event.pmu->get_value<long long>();
+        }
+        catch(const std::runtime_error &)
+        {
+            event.value = 0;
+        }
     }
 }
 
 Instrument::MeasurementsMap PMUCounter::measurements() const
 {
-    return MeasurementsMap
+    MeasurementsMap measurements;
+    for(const auto &event : _events)
     {
-        { "CPU cycles", Measurement(_cycles / _scale_factor, _unit + "cycles") },
-        { "CPU instructions", Measurement(_instructions / _scale_factor, _unit + "instructions") },
+        measurements.emplace(event.name, Measurement(event.value / _scale_factor, _unit + event.unit));
+    }
+
+    // Derived metrics, to tell whether a run is compute or memory bound
+    const auto ratio = [&](const std::string & name, const std::string & numerator, const std::string & denominator, double scale, const std::string & unit)
+    {
+        const long long den = value_of(denominator);
+        if(measurements.count(numerator) != 0 && den > 0)
+        {
+            measurements.emplace(name, Measurement(scale * static_cast<double>(value_of(numerator)) / static_cast<double>(den), unit));
+        }
     };
+    ratio("IPC", "CPU instructions", "CPU cycles", 1.0, "instructions/cycle");
+    ratio("L1D refill rate", "L1D cache refills", "L1D cache reads", 100.0, "%");
+    ratio("L2D refill rate", "L2D cache refills", "L2D cache accesses", 100.0, "%");
+    ratio("LLC refill rate", "LLC refills", "LLC reads", 100.0, "%");
+    ratio("SVE instruction ratio", "SVE instructions", "CPU instructions", 100.0, "%");
+    if(_group == PMUEventGroup::MEMORY)
+    {
+        ratio("L2D refill bandwidth", "L2D cache refills", "CPU cycles", cache_line_size_in_bytes, "bytes/cycle");
+        ratio("Bus accesses per cycle", "Bus accesses", "CPU cycles", 1.0, "accesses/cycle");
+        ratio("Backend memory stalls", "Backend memory stall cycles", "CPU cycles", 100.0, "%");
+        ratio("Backend stalls", "Backend stall cycles", "CPU cycles", 100.0, "%");
+    }
+    return measurements;
 }
 } // namespace framework
 } // namespace test
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 Arm Limited.
+ * Copyright (c) 2017-2018, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,21 +27,39 @@
 #include "Instrument.h"
 #include "PMU.h"
 
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace arm_compute
 {
 namespace test
 {
 namespace framework
 {
-/** Implementation of an instrument to count CPU cycles. */
+/** Groups of CPU events counted together by a @ref PMUCounter */
+enum class PMUEventGroup
+{
+    DEFAULT, /**< Cycles and instructions */
+    CACHE,   /**< L1D, L2D and last level cache accesses and refills */
+    MEMORY,  /**< Bus accesses, L2D refills and backend stalls */
+    SVE,     /**< Retired SVE instructions */
+};
+
+/** Implementation of an instrument to count CPU events.
+ *
+ * The events of the group which are not supported by the CPU or the kernel are not reported.
+ */
 class PMUCounter : public Instrument
 {
 public:
     /** Construct a PMU counter.
      *
      * @param[in] scale_factor Measurement scale factor.
+     * @param[in] group        (Optional) Group of events to count.
      */
-    PMUCounter(ScaleFactor scale_factor)
+    PMUCounter(ScaleFactor scale_factor, PMUEventGroup group = PMUEventGroup::DEFAULT)
+        : _group(group)
     {
         switch(scale_factor)
         {
@@ -60,6 +78,7 @@ public:
             default:
                 ARM_COMPUTE_ERROR("Invalid scale");
         }
+        open_events();
     };
 
     std::string     id() const override;
@@ -68,11 +87,36 @@ public:
     MeasurementsMap measurements() const override;
 
 private:
-    PMU       _pmu_cycles{ PERF_COUNT_HW_CPU_CYCLES };
-    PMU       _pmu_instructions{ PERF_COUNT_HW_INSTRUCTIONS };
-    long long _cycles{ 0 };
-    long long _instructions{ 0 };
-    int       _scale_factor{};
+    /** Counted event */
+    struct Event
+    {
+        std::string          name;       /**< Name of the measurement */
+        std::string          unit;       /**< Unit of the measurement, without scale */
+        std::unique_ptr<PMU> pmu;        /**< Counter of the event */
+        long long            value{ 0 }; /**< Value at the end of the last run */
+    };
+
+    void      open_events();
+    long long value_of(const std::string &name) const;
+
+    PMUEventGroup      _group;
+    std::vector<Event> _events{};
+    int                _scale_factor{};
+};
+
+/** PMU counter of a given group of events, to be created by @ref Instrument::make_instrument */
+template <PMUEventGroup group>
+class PMUGroupCounter final : public PMUCounter
+{
+public:
+    /** Construct a PMU counter of the group.
+     *
+     * @param[in] scale_factor Measurement scale factor.
+     */
+    PMUGroupCounter(ScaleFactor scale_factor)
+        : PMUCounter(scale_factor, group)
+    {
+    }
 };
 } // namespace framework
 } // namespace test
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019,2021 Arm Limited.
+ * Copyright (c) 2017-2019,2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #include "JSONPrinter.h"
 
 #include "../Framework.h"
+#include "../instruments/InstrumentsStats.h"
 #include "../instruments/Measurement.h"
 
 #include <algorithm>
@@ -204,6 +205,14 @@ void JSONPrinter::print_measurements(const Profiler::MeasurementsMap &measuremen
         };
         *_stream << R"("raw" : [)" << join(i_it->second.begin(), i_it->second.end(), ",", measurement_to_string) << "],";
         *_stream << R"("unit" : ")" << i_it->second.begin()->unit() << R"(")";
+
+        // Percentiles of the iterations, so that the latency distributions of two runs can be diffed directly
+        const InstrumentsStats stats(i_it->second);
+        *_stream << R"(,"percentiles" : {)";
+        *_stream << R"("p50" : ")" << stats.percentile(50.0).value() << R"(",)";
+        *_stream << R"("p90" : ")" << stats.percentile(90.0).value() << R"(",)";
+        *_stream << R"("p99" : ")" << stats.percentile(99.0).value() << R"(",)";
+        *_stream << R"("p99.9" : ")" << stats.percentile(99.9).value() << R"("})";
         *_stream << "}";
 
         if(++i_it != i_end)
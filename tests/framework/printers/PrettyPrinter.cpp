@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019,2021 Arm Limited.
+ * Copyright (c) 2017-2019,2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -138,6 +138,9 @@ void PrettyPrinter::print_measurements(const Profiler::MeasurementsMap &measurem
             *_stream << ", MIN=" << stats.min();
             *_stream << ", MAX=" << stats.max();
             *_stream << ", MEDIAN=" << stats.median().value() << " " << stats.median().unit();
+            *_stream << ", P90=" << stats.percentile(90.0);
+            *_stream << ", P99=" << stats.percentile(99.0);
+            *_stream << ", P99.9=" << stats.percentile(99.9);
         }
         *_stream << end_color() << "\n";
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,15 +45,18 @@
 #include "arm_compute/runtime/CL/CLTuner.h"
 #include "utils/TypePrinter.h"
 #endif /* ARM_COMPUTE_CL */
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
 #include "arm_compute/runtime/Scheduler.h"
 #include "src/common/cpuinfo/CpuModel.h"
 
+#include <algorithm>
 #include <fstream>
 #include <initializer_list>
 #include <iostream>
 #include <memory>
 #include <random>
 #include <utility>
+#include <vector>
 
 using namespace arm_compute;
 using namespace arm_compute::test;
@@ -92,6 +95,143 @@ bool file_exists(const std::string &filename)
     return file.good();
 }
 #endif /* ARM_COMPUTE_CL */
+
+/** Find the CPUs of the big and little clusters of the system
+ *
+ * The CPUs are ranked by the capacity the kernel exposes in /sys/devices/system/cpu/cpu<N>/cpu_capacity or, if not
+ * exposed, by their maximum frequency.
+ *
+ * @param[in] num_cpus Number of CPUs of the system.
+ *
+ * @return The CPUs of the largest capacity and the CPUs of the smallest capacity, both empty if the CPUs all have the same capacity
+ */
+std::pair<std::vector<int>, std::vector<int>> find_big_little_cpus(int num_cpus)
+{
+    std::vector<std::pair<long, int>> capacities;
+    for(int cpu = 0; cpu < num_cpus; ++cpu)
+    {
+        const std::string path     = "/sys/devices/system/cpu/cpu" + support::cpp11::to_string(cpu) + "/";
+        long              capacity = 0;
+        std::ifstream(path + "cpu_capacity") >> capacity;
+        if(capacity <= 0)
+        {
+            std::ifstream(path + "cpufreq/cpuinfo_max_freq") >> capacity;
+        }
+        capacities.emplace_back(capacity, cpu);
+    }
+
+    std::pair<std::vector<int>, std::vector<int>> clusters;
+    if(capacities.empty())
+    {
+        return clusters;
+    }
+    const auto minmax = std::minmax_element(capacities.begin(), capacities.end());
+    if(minmax.first->first == minmax.second->first)
+    {
+        return clusters;
+    }
+    for(const auto &capacity : capacities)
+    {
+        if(capacity.first == minmax.second->first)
+        {
+            clusters.first.push_back(capacity.second);
+        }
+        else if(capacity.first == minmax.first->first)
+        {
+            clusters.second.push_back(capacity.second);
+        }
+    }
+    return clusters;
+}
+
+/** Create the configurations of a thread scaling study
+ *
+ * @param[in] max_threads    Largest number of threads to run with.
+ * @param[in] thread_sweep   Run with 1, 2, 4, ... @p max_threads threads, otherwise only with @p max_threads threads.
+ * @param[in] affinity_sweep Run with unbound threads, then with the threads bound to the CPUs in increasing and decreasing order.
+ * @param[in] mode_sweep     Run in the linear and fanout modes of the CPP scheduler, otherwise in its automatic mode.
+ * @param[in] cluster_sweep  Also run with the threads bound to the big CPUs only, then to the little CPUs only.
+ *
+ * @return The configurations, grouped by affinity and scheduling mode when sweeping the number of threads
+ */
+std::vector<framework::SweepConfiguration> create_thread_sweep(unsigned int max_threads, bool thread_sweep, bool affinity_sweep, bool mode_sweep, bool cluster_sweep)
+{
+    using SchedulingMode = CPPScheduler::SchedulingMode;
+    std::vector<std::pair<std::string, IScheduler::BindFunc>> affinities =
+    {
+        { "none", nullptr },
+    };
+    if(affinity_sweep)
+    {
+        affinities.emplace_back("compact", [](int thread, int num_cpus) { return thread % num_cpus; });
+        affinities.emplace_back("reverse", [](int thread, int num_cpus) { return num_cpus - 1 - (thread % num_cpus); });
+    }
+    if(cluster_sweep)
+    {
+        // Threads beyond the size of a cluster share its CPUs
+        const auto clusters = find_big_little_cpus(Scheduler::get().cpu_info().get_cpu_num());
+        if(clusters.first.empty())
+        {
+            std::cout << "The CPUs all have the same capacity: the cluster sweep is skipped" << std::endl;
+        }
+        else
+        {
+            const std::vector<int> big    = clusters.first;
+            const std::vector<int> little = clusters.second;
+            affinities.emplace_back("big", [big](int thread, int) { return big[thread % big.size()]; });
+            affinities.emplace_back("little", [little](int thread, int) { return little[thread % little.size()]; });
+        }
+    }
+    const std::vector<std::pair<std::string, SchedulingMode>> modes =
+    {
+        { "auto", SchedulingMode::AUTO },
+        { "linear", SchedulingMode::LINEAR },
+        { "fanout", SchedulingMode::FANOUT },
+    };
+
+    std::vector<unsigned int> thread_counts;
+    for(unsigned int num_threads = 1; thread_sweep && num_threads < max_threads; num_threads *= 2)
+    {
+        thread_counts.push_back(num_threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    std::vector<framework::SweepConfiguration> sweep;
+    for(size_t a = 0; a < affinities.size(); ++a)
+    {
+        // The automatic mode is only swept when the modes are not
+        for(size_t m = (mode_sweep ? 1U : 0U); m < (mode_sweep ? modes.size() : 1U); ++m)
+        {
+            const std::string group = "affinity=" + affinities[a].first + ",mode=" + modes[m].first;
+            for(auto num_threads : thread_counts)
+            {
+                const IScheduler::BindFunc bind = affinities[a].second;
+                const SchedulingMode       mode = modes[m].second;
+                framework::SweepConfiguration config;
+                config.name        = "threads=" + support::cpp11::to_string(num_threads) + "," + group;
+                config.group       = thread_sweep ? group : std::string();
+                config.num_threads = num_threads;
+                config.apply       = [num_threads, bind, mode]()
+                {
+                    if(bind)
+                    {
+                        Scheduler::get().set_num_threads_with_affinity(num_threads, bind);
+                    }
+                    else
+                    {
+                        Scheduler::get().set_num_threads(num_threads);
+                    }
+                    if(Scheduler::get_type() == Scheduler::Type::CPP)
+                    {
+                        static_cast<CPPScheduler &>(Scheduler::get()).set_scheduling_mode(mode);
+                    }
+                };
+                sweep.push_back(std::move(config));
+            }
+        }
+    }
+    return sweep;
+}
 } //namespace
 
 int main(int argc, char **argv)
@@ -151,6 +291,14 @@ int main(int argc, char **argv)
 #endif /* ARM_COMPUTE_CL */
     auto threads = parser.add_option<utils::SimpleOption<int>>("threads", 1);
     threads->set_help("Number of threads to use");
+    auto thread_sweep = parser.add_option<utils::ToggleOption>("thread-sweep", false);
+    thread_sweep->set_help("Run the tests with 1, 2, 4, ... up to --threads threads (all the CPUs if not set) and report the speed-up and parallel efficiency of each run");
+    auto affinity_sweep = parser.add_option<utils::ToggleOption>("affinity-sweep", false);
+    affinity_sweep->set_help("Run the tests with unbound threads, then with the threads bound to the CPUs in increasing and decreasing order");
+    auto scheduler_mode_sweep = parser.add_option<utils::ToggleOption>("scheduler-mode-sweep", false);
+    scheduler_mode_sweep->set_help("Run the tests in the linear and fanout modes of the CPP scheduler");
+    auto cluster_sweep = parser.add_option<utils::ToggleOption>("cluster-sweep", false);
+    cluster_sweep->set_help("Run the tests with unbound threads, then with the threads bound to the big CPUs only and to the little CPUs only. Combine with the energy instrument to compare their energy efficiency");
     auto cooldown_sec = parser.add_option<utils::SimpleOption<float>>("delay", -1.f);
     cooldown_sec->set_help("Delay to add between test executions in seconds");
     auto configure_only = parser.add_option<utils::ToggleOption>("configure-only", false);
@@ -301,6 +449,11 @@ int main(int argc, char **argv)
         framework.set_throw_errors(options.throw_errors->value());
         framework.set_stop_on_error(stop_on_error->value());
         framework.set_error_on_missing_assets(error_on_missing_assets->value());
+        if(thread_sweep->value() || affinity_sweep->value() || scheduler_mode_sweep->value() || cluster_sweep->value())
+        {
+            const unsigned int max_threads = (thread_sweep->value() && !threads->is_set()) ? Scheduler::get().cpu_info().get_cpu_num() : std::max(1, threads->value());
+            framework.set_sweep(create_thread_sweep(max_threads, thread_sweep->value(), affinity_sweep->value(), scheduler_mode_sweep->value(), cluster_sweep->value()));
+        }
         if (randomize_seeds)
         {
             framework.set_prepare_function([&] (){
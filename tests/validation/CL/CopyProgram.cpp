@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/CLTensorAllocator.h"
+#include "arm_compute/runtime/CL/functions/CLCopyProgram.h"
+
+#include "tests/CL/CLAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/validation/reference/Permute.h"
+#include "tests/validation/reference/ReshapeLayer.h"
+#include "tests/validation/reference/SliceOperations.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Run the stages of a copy program one after the other with the reference functions */
+template <typename T>
+SimpleTensor<T> reference_copy_program(SimpleTensor<T> src, const CopyProgramInfo &program)
+{
+    for (const auto &stage : program)
+    {
+        switch (stage.type)
+        {
+            case CopyProgramStageType::RESHAPE:
+                src = reference::reshape_layer(src, stage.shape);
+                break;
+            case CopyProgramStageType::PERMUTE:
+                src = reference::permute(src, stage.perm);
+                break;
+            case CopyProgramStageType::SLICE:
+            {
+                Coordinates ends;
+                BiStrides   strides;
+                for (size_t i = 0; i < src.shape().num_dimensions(); ++i)
+                {
+                    const int stride = i < stage.strides.num_dimensions() ? stage.strides[i] : 1;
+                    ends.set(i, stage.starts[i] + (static_cast<int>(stage.shape[i]) - 1) * stride + 1);
+                    strides.set(i, stride);
+                }
+                src = reference::strided_slice(src, stage.starts, ends, strides, 0, 0, 0);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    return src;
+}
+
+/** Run @ref CLCopyProgram and validate its output against the reference functions */
+template <typename T>
+void validate_copy_program(const TensorShape &shape, DataType data_type, const CopyProgramInfo &program)
+{
+    CLTensor src = create_tensor<CLTensor>(shape, data_type);
+    CLTensor dst;
+
+    CLCopyProgram copy_program;
+    copy_program.configure(&src, &dst, program);
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(CLAccessor(src), 0);
+
+    copy_program.run();
+
+    SimpleTensor<T> ref_src{shape, data_type};
+    library->fill_tensor_uniform(ref_src, 0);
+
+    validate(CLAccessor(dst), reference_copy_program(ref_src, program));
+}
+} // namespace
+
+TEST_SUITE(CL)
+TEST_SUITE(CopyProgram)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("SrcInfo", { TensorInfo(TensorShape(8U, 6U, 2U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(8U, 6U, 2U), 1, DataType::F32),    // Reshape changing the number of elements
+                                 TensorInfo(TensorShape(8U, 6U, 2U), 1, DataType::F32),    // Slice out of the input
+                                 TensorInfo(TensorShape(8U, 6U, 2U), 1, DataType::F32),    // Mismatching data types
+                                 TensorInfo(TensorShape(8U, 6U, 2U, 2U, 2U), 1, DataType::F32), // 5D input
+                               }),
+               make("DstInfo", { TensorInfo(TensorShape(6U, 4U, 2U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(6U, 4U, 2U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(6U, 4U, 2U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(6U, 4U, 2U), 1, DataType::F16),
+                                 TensorInfo(TensorShape(6U, 4U, 2U), 1, DataType::F32),
+                               }),
+               make("ReshapeShape", { TensorShape(6U, 8U, 2U),
+                                      TensorShape(6U, 8U, 3U),
+                                      TensorShape(6U, 8U, 2U),
+                                      TensorShape(6U, 8U, 2U),
+                                      TensorShape(6U, 8U, 2U),
+                                    }),
+               make("SliceStarts", { Coordinates(0, 3), Coordinates(0, 3), Coordinates(0, 5), Coordinates(0, 3), Coordinates(0, 3) }),
+               make("Expected", { true, false, false, false, false })),
+               src_info, dst_info, reshape_shape, slice_starts, expected)
+{
+    const CopyProgramInfo program{ CopyProgramStage(reshape_shape), CopyProgramStage(slice_starts, BiStrides(), TensorShape(6U, 4U, 2U)) };
+    const Status          status = CLCopyProgram::validate(&src_info, &dst_info, program);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+/** Test case for the stages of @ref CLCopyProgram.
+ *
+ * Uses programs mixing reshapes, permutations and strided slices of 2D, 3D and 4D tensors.
+ *
+ * Checks performed in order:
+ * - The output matches the reference functions run one after the other
+ */
+TEST_CASE(RunProgram, framework::DatasetMode::ALL)
+{
+    // Flatten the channels of a NCHW tensor after moving them innermost
+    validate_copy_program<float>(TensorShape(7U, 5U, 3U, 2U), DataType::F32,
+                                 {CopyProgramStage(PermutationVector(2U, 0U, 1U)),
+                                  CopyProgramStage(TensorShape(105U, 2U))});
+    // Split a row into heads, swap the heads with the rows and keep every other head
+    validate_copy_program<float>(TensorShape(24U, 5U), DataType::F32,
+                                 {CopyProgramStage(TensorShape(6U, 4U, 5U)),
+                                  CopyProgramStage(PermutationVector(0U, 2U, 1U)),
+                                  CopyProgramStage(Coordinates(0, 0, 1), BiStrides(1, 1, 2), TensorShape(6U, 5U, 2U))});
+    // Slice, permute and slice again a 4D tensor with half elements
+    validate_copy_program<half>(TensorShape(9U, 6U, 4U, 3U), DataType::F16,
+                                {CopyProgramStage(Coordinates(1, 0, 1, 0), BiStrides(2, 1, 1, 1), TensorShape(4U, 6U, 3U, 3U)),
+                                 CopyProgramStage(PermutationVector(3U, 2U, 1U, 0U)),
+                                 CopyProgramStage(Coordinates(0, 1, 2, 1), BiStrides(), TensorShape(3U, 2U, 4U, 3U))});
+}
+
+TEST_SUITE_END() // CopyProgram
+TEST_SUITE_END() // CL
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023 Arm Limited.
+ * Copyright (c) 2019-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,6 +52,10 @@ using CLDepthwiseConvolutionLayerNative = CLSynthetizeFunction<CLDepthwiseConvol
 template <typename T>
 using CLDepthwiseConvolutionLayerNativeFixture = DepthwiseConvolutionLayerNativeConfigurableValidationFixture<CLTensor, CLAccessor, CLDepthwiseConvolutionLayerNative, T>;
 
+// Fixture for CLDepthwiseConvolutionLayerNative reading the input through cl_image
+template <typename T>
+using CLDepthwiseConvolutionLayerNativeExportInputFixture = DepthwiseConvolutionLayerNativeConfigurableValidationFixture<CLTensor, CLAccessor, CLDepthwiseConvolutionLayerNative, T, false, true>;
+
 namespace
 {
 // *INDENT-OFF*
@@ -279,6 +283,38 @@ FIXTURE_DATA_TEST_CASE_NEW(RunLarge, CLDepthwiseConvolutionLayerNativeFixture<fl
 }
 
 TEST_SUITE_END() // ExportWeightsToCLImage
+
+TEST_SUITE(ExportInputToCLImage)
+FIXTURE_DATA_TEST_CASE_NEW(RunSmall, CLDepthwiseConvolutionLayerNativeExportInputFixture<float>, framework::DatasetMode::ALL,
+                combine(combine(combine(combine(combine(combine(combine(combine(combine(combine(combine(combine(combine(
+                                                                                                width_values_precommit,
+                                                                                                height_values_precommit),
+                                                                                                channel_values_export_to_cl_image_precommit),
+                                                                                                batch_values_precommit),
+                                                                                                kernel_sz_values_precommit),
+                                                                                                make("depth_multiplier", 1)),
+                                                                                                dilation_values),
+                                                                                                stride_values),
+                                                                                                padding_valid_values),
+                                                                                                make("DataType", DataType::F32)),
+                                                                                                data_layout_values),
+                                                                                                act_values),
+                                                                                                n0_values_export_to_cl_image_precommit),
+                                                                                                make("ExportToCLImage", { false, true })))
+{
+   // Validate output
+    if(_validate_output)
+    {
+        // Validate output
+        validate(CLAccessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("cl_khr_image2d_from_buffer not supported. TEST skipped");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // ExportInputToCLImage
 TEST_SUITE_END() // FP32
 
 TEST_SUITE(FP16)
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/CLTensorAllocator.h"
+#include "arm_compute/runtime/CL/functions/CLElementwiseChain.h"
+
+#include "tests/CL/CLAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Scalar evaluation of the activations used by the tests */
+float reference_activation(const ActivationLayerInfo &act_info, float x)
+{
+    switch (act_info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::RELU:
+            return std::max(0.f, x);
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+            return std::min(act_info.a(), std::max(0.f, x));
+        case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+            return 1.f / (1.f + std::exp(-x));
+        case ActivationLayerInfo::ActivationFunction::TANH:
+            return act_info.a() * std::tanh(act_info.b() * x);
+        case ActivationLayerInfo::ActivationFunction::ELU:
+            return x >= 0.f ? x : act_info.a() * (std::exp(x) - 1.f);
+        case ActivationLayerInfo::ActivationFunction::SOFT_RELU:
+            return std::log(1.f + std::exp(x));
+        case ActivationLayerInfo::ActivationFunction::SQRT:
+            return std::sqrt(x);
+        default:
+            return x;
+    }
+}
+
+/** Scalar evaluation of an elementwise chain on one element */
+float reference_chain(const ElementwiseChainInfo       &chain,
+                      const std::vector<const float *> &operands,
+                      size_t                            idx,
+                      float                             x)
+{
+    for (const auto &op : chain)
+    {
+        const float o = is_binary_elementwise_chain_op(op.type) ? operands[op.operand][idx] : 0.f;
+        const float a = op.reversed ? o : x;
+        const float b = op.reversed ? x : o;
+        switch (op.type)
+        {
+            case ElementwiseChainOpType::ADD:
+                x = a + b;
+                break;
+            case ElementwiseChainOpType::SUB:
+                x = a - b;
+                break;
+            case ElementwiseChainOpType::MUL:
+                x = a * b;
+                break;
+            case ElementwiseChainOpType::DIV:
+                x = a / b;
+                break;
+            case ElementwiseChainOpType::MIN:
+                x = std::min(a, b);
+                break;
+            case ElementwiseChainOpType::MAX:
+                x = std::max(a, b);
+                break;
+            case ElementwiseChainOpType::SQUARED_DIFF:
+                x = (a - b) * (a - b);
+                break;
+            case ElementwiseChainOpType::EXP:
+                x = std::exp(x);
+                break;
+            case ElementwiseChainOpType::NEG:
+                x = -x;
+                break;
+            case ElementwiseChainOpType::ABS:
+                x = std::abs(x);
+                break;
+            case ElementwiseChainOpType::RSQRT:
+                x = 1.f / std::sqrt(x);
+                break;
+            case ElementwiseChainOpType::ACTIVATION:
+                x = reference_activation(op.act_info, x);
+                break;
+            default:
+                break;
+        }
+    }
+    return x;
+}
+
+/** Max absolute difference between @ref CLElementwiseChain and a scalar evaluation of the chain
+ *
+ * For quantized outputs the difference is returned in quantization steps.
+ */
+float run_elementwise_chain(const TensorShape          &shape,
+                            const ElementwiseChainInfo &chain,
+                            unsigned int                num_operands,
+                            DataType                    dst_dt = DataType::F32)
+{
+    const QuantizationInfo qinfo(0.05f, 10);
+    const TensorInfo       src_info(shape, 1, DataType::F32);
+    const TensorInfo       dst_info(shape, 1, dst_dt, dst_dt == DataType::F32 ? QuantizationInfo() : qinfo);
+
+    std::mt19937                          gen(library->seed());
+    std::uniform_real_distribution<float> dist(0.5f, 2.f);
+
+    CLTensor src, dst;
+    src.allocator()->init(src_info);
+    dst.allocator()->init(dst_info);
+    std::vector<CLTensor>          operands(num_operands);
+    std::vector<const ICLTensor *> operand_ptrs;
+    for (auto &operand : operands)
+    {
+        operand.allocator()->init(src_info);
+        operand_ptrs.push_back(&operand);
+    }
+
+    CLElementwiseChain chain_func;
+    chain_func.configure(&src, operand_ptrs, &dst, chain);
+
+    // Inputs are kept on the host to evaluate the reference
+    std::vector<std::vector<float>> operand_data(num_operands, std::vector<float>(shape.total_size()));
+    std::vector<float>              src_data(shape.total_size());
+    std::generate(src_data.begin(), src_data.end(), [&]() { return dist(gen); });
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+    src.map(true);
+    std::copy(src_data.begin(), src_data.end(), reinterpret_cast<float *>(src.buffer()));
+    src.unmap();
+    for (unsigned int op = 0; op < num_operands; ++op)
+    {
+        std::generate(operand_data[op].begin(), operand_data[op].end(), [&]() { return dist(gen); });
+        operands[op].allocator()->allocate();
+        operands[op].map(true);
+        std::copy(operand_data[op].begin(), operand_data[op].end(), reinterpret_cast<float *>(operands[op].buffer()));
+        operands[op].unmap();
+    }
+    std::vector<const float *> operand_ptrs_host;
+    for (const auto &data : operand_data)
+    {
+        operand_ptrs_host.push_back(data.data());
+    }
+
+    chain_func.run();
+    CLScheduler::get().sync();
+
+    dst.map(true);
+    float max_diff = 0.f;
+    for (size_t i = 0; i < shape.total_size(); ++i)
+    {
+        const float expected = reference_chain(chain, operand_ptrs_host, i, src_data[i]);
+        float       diff     = 0.f;
+        if (dst_dt == DataType::QASYMM8)
+        {
+            diff = std::abs(static_cast<int>(quantize_qasymm8(expected, qinfo)) - static_cast<int>(dst.buffer()[i]));
+        }
+        else
+        {
+            const float actual = reinterpret_cast<const float *>(dst.buffer())[i];
+            diff               = std::abs(expected - actual) / std::max(1.f, std::abs(expected));
+        }
+        max_diff = std::max(max_diff, diff);
+    }
+    dst.unmap();
+    return max_diff;
+}
+} // namespace
+
+TEST_SUITE(CL)
+TEST_SUITE(ElementwiseChain)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("SrcInfo", { TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(27U, 13U), 1, DataType::S32),    // Unsupported data type
+                                 TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),    // Operand shape mismatch
+                                 TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),    // Operand index out of range
+                                 TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),    // Unsupported activation
+                               }),
+               make("OperandInfo", { TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                     TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                     TensorInfo(TensorShape(27U, 13U), 1, DataType::S32),
+                                     TensorInfo(TensorShape(27U, 1U), 1, DataType::F32),
+                                     TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                     TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                   }),
+               make("DstInfo", { TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(27U, 13U), 1, DataType::QASYMM8, QuantizationInfo(0.1f, 3)),
+                                 TensorInfo(TensorShape(27U, 13U), 1, DataType::S32),
+                                 TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(27U, 13U), 1, DataType::F32),
+                               }),
+               make("Operand", { 0U, 0U, 0U, 0U, 1U, 0U }),
+               make("Activation", { ActivationLayerInfo::ActivationFunction::RELU,
+                                    ActivationLayerInfo::ActivationFunction::RELU,
+                                    ActivationLayerInfo::ActivationFunction::RELU,
+                                    ActivationLayerInfo::ActivationFunction::RELU,
+                                    ActivationLayerInfo::ActivationFunction::RELU,
+                                    ActivationLayerInfo::ActivationFunction::SWISH,
+                                  }),
+               make("Expected", { true, true, false, false, false, false })),
+               src_info, operand_info, dst_info, operand, act, expected)
+{
+    const ElementwiseChainInfo chain{ ElementwiseChainOp(ElementwiseChainOpType::ADD, operand), ElementwiseChainOp(ActivationLayerInfo(act)) };
+    const Status               status = CLElementwiseChain::validate(&src_info, { &operand_info }, &dst_info, chain);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_SUITE(FP32)
+/** Test case for the generated kernels of @ref CLElementwiseChain.
+ *
+ * Uses row lengths that are not a multiple of the vector size, reversed operands and chains mixing binary operations,
+ * unary operations and activations, including the activations only the OpenCL backend fuses.
+ *
+ * Checks performed in order:
+ * - The output matches a scalar evaluation of the chain on the same inputs
+ */
+TEST_CASE(RunChain, framework::DatasetMode::ALL)
+{
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+
+    const ElementwiseChainInfo add_relu_mul{ElementwiseChainOp(ElementwiseChainOpType::ADD, 0),
+                                            ElementwiseChainOp(ActivationLayerInfo(ActFunction::RELU)),
+                                            ElementwiseChainOp(ElementwiseChainOpType::MUL, 1)};
+    const ElementwiseChainInfo mixed{ElementwiseChainOp(ElementwiseChainOpType::SUB, 0, true),
+                                     ElementwiseChainOp(ElementwiseChainOpType::SQUARED_DIFF, 1),
+                                     ElementwiseChainOp(ElementwiseChainOpType::NEG),
+                                     ElementwiseChainOp(ElementwiseChainOpType::EXP),
+                                     ElementwiseChainOp(ElementwiseChainOpType::DIV, 0, true),
+                                     ElementwiseChainOp(ActivationLayerInfo(ActFunction::LOGISTIC)),
+                                     ElementwiseChainOp(ElementwiseChainOpType::MAX, 1)};
+    const ElementwiseChainInfo unary{ElementwiseChainOp(ElementwiseChainOpType::ABS),
+                                     ElementwiseChainOp(ElementwiseChainOpType::RSQRT),
+                                     ElementwiseChainOp(ActivationLayerInfo(ActFunction::TANH, 1.f, 1.f))};
+
+    ARM_COMPUTE_EXPECT(run_elementwise_chain(TensorShape(7U, 3U), add_relu_mul, 2) < 1e-5f,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_elementwise_chain(TensorShape(67U, 5U, 2U), mixed, 2) < 1e-3f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_elementwise_chain(TensorShape(33U, 9U), unary, 0) < 1e-3f, framework::LogLevel::ERRORS);
+
+    const ElementwiseChainInfo cl_activations{ElementwiseChainOp(ActivationLayerInfo(ActFunction::SQRT)),
+                                              ElementwiseChainOp(ElementwiseChainOpType::SUB, 0),
+                                              ElementwiseChainOp(ActivationLayerInfo(ActFunction::ELU, 0.5f)),
+                                              ElementwiseChainOp(ActivationLayerInfo(ActFunction::SOFT_RELU))};
+    ARM_COMPUTE_EXPECT(run_elementwise_chain(TensorShape(19U, 4U, 3U), cl_activations, 1) < 1e-3f,
+                       framework::LogLevel::ERRORS);
+}
+
+/** Test case for the quantization of the result of @ref CLElementwiseChain.
+ *
+ * Checks performed in order:
+ * - The output is at most one quantization step away from quantizing a scalar evaluation of the chain
+ */
+TEST_CASE(RunChainToQASYMM8, framework::DatasetMode::ALL)
+{
+    const ActivationLayerInfo  relu6(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f);
+    const ElementwiseChainInfo chain{ElementwiseChainOp(ElementwiseChainOpType::MUL, 0),
+                                     ElementwiseChainOp(ElementwiseChainOpType::MIN, 1, true),
+                                     ElementwiseChainOp(relu6)};
+
+    ARM_COMPUTE_EXPECT(run_elementwise_chain(TensorShape(45U, 7U), chain, 2, DataType::QASYMM8) <= 1.f,
+                       framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // FP32
+
+TEST_SUITE_END() // ElementwiseChain
+TEST_SUITE_END() // CL
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
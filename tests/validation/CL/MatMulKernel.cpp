@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,8 @@
 #include "tests/validation/reference/Permute.h"
 
 #include <tuple>
+#include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -78,6 +80,9 @@ using CLMatMulKernelFixture = MatMulKernelValidationFixture<T, ClMatMulNativeKer
 template <typename T>
 using CLMatMulKernelBiasFixture = MatMulKernelWithBiasValidation<T, ClMatMulNativeKernel>;
 
+template <typename T>
+using CLMatMulKernelExportLhsFixture = MatMulKernelExportLhsValidationFixture<T, ClMatMulNativeKernel>;
+
 TEST_SUITE(CL)
 TEST_SUITE(MatMulKernel)
 TEST_SUITE(Validate)
@@ -233,6 +238,41 @@ TEST_CASE(ExportToCLImage, framework::DatasetMode::ALL)
     }
 }
 
+TEST_CASE(ExportLhsToCLImage, framework::DatasetMode::ALL)
+{
+    // We skip this test if the hardware does not support exporting to CL Image
+    if(image2d_from_buffer_supported(CLKernelLibrary::get().get_device()))
+    {
+        using ShapeConfigurationTuple = std::tuple<TensorShape, TensorShape, bool, bool, int, bool>;
+        const std::vector<ShapeConfigurationTuple> shape_configurations =
+        {
+            // lhs_shape, rhs_shape, adj_lhs, adj_rhs, K0, expected
+            { TensorShape(5U, 3U), TensorShape(4U, 5U), false, false, 4, false },  // K should be multiple of 4
+            { TensorShape(8U, 3U), TensorShape(4U, 8U), false, false, 2, false },  // K0 not in {4, 8, 16}
+            { TensorShape(3U, 8U), TensorShape(4U, 8U), true, false, 4, false },   // Lhs transposed is not supported
+            { TensorShape(8U, 3U), TensorShape(4U, 8U), false, false, 4, true },
+            { TensorShape(16U, 3U), TensorShape(16U, 5U), false, true, 8, true },
+        };
+
+        for(auto &tuple : shape_configurations)
+        {
+            const TensorInfo lhs_info = TensorInfo(std::get<0>(tuple), 1, DataType::F32);
+            const TensorInfo rhs_info = TensorInfo(std::get<1>(tuple), 1, DataType::F32);
+
+            const MatMulKernelInfo matmul_kernel_info
+            {
+                std::get<2>(tuple), std::get<3>(tuple), 4, 4, std::get<4>(tuple), false /* export_rhs_to_cl_image */, true /* export_lhs_to_cl_image */
+            };
+
+            TensorInfo output_info;
+            Status     status = ClMatMulNativeKernel::validate(&lhs_info, &rhs_info, nullptr, &output_info, matmul_kernel_info);
+
+            const bool expected = std::get<5>(tuple);
+            ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+        }
+    }
+}
+
 TEST_CASE(ValidateInputShapes, framework::DatasetMode::ALL)
 {
     // Configurations are assumed to be Nt/Nt, but will be transposed inside the test to test other configurations
@@ -337,6 +377,39 @@ TEST_CASE(ValidateDataTypes, framework::DatasetMode::ALL)
 
 TEST_SUITE_END() // Validate
 
+TEST_CASE(ReuseProgramAcrossShapes, framework::DatasetMode::ALL)
+{
+    // M and K are kernel arguments: the kernels below only differ by them and must share the same program
+    const MatMulKernelInfo matmul_kernel_info{ false, false, 4, 4, 4, false /* export_rhs_to_cl_image */, false /* export_lhs_to_cl_image */ };
+
+    using ShapePair = std::pair<TensorShape, TensorShape>;
+    const std::vector<ShapePair> shape_configurations =
+    {
+        // lhs_shape, rhs_shape
+        { TensorShape(12U, 9U), TensorShape(8U, 12U) },
+        { TensorShape(20U, 37U), TensorShape(8U, 20U) },
+        { TensorShape(7U, 64U), TensorShape(8U, 7U) },
+    };
+
+    size_t num_programs = 0;
+    for(size_t i = 0; i < shape_configurations.size(); ++i)
+    {
+        TensorInfo lhs_info = TensorInfo(shape_configurations[i].first, 1, DataType::F32);
+        TensorInfo rhs_info = TensorInfo(shape_configurations[i].second, 1, DataType::F32);
+        TensorInfo dst_info;
+
+        ClMatMulNativeKernel kernel;
+        kernel.configure(CLKernelLibrary::get().get_compile_context(), &lhs_info, &rhs_info, nullptr, &dst_info, matmul_kernel_info);
+
+        const size_t num_built_programs = CLKernelLibrary::get().get_built_programs().size();
+        if(i > 0)
+        {
+            ARM_COMPUTE_EXPECT(num_built_programs == num_programs, framework::LogLevel::ERRORS);
+        }
+        num_programs = num_built_programs;
+    }
+}
+
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
 TEST_SUITE(Buffer)
@@ -508,6 +581,25 @@ FIXTURE_DATA_TEST_CASE(RunLargeRhsTransposed, CLMatMulKernelFixture<float>, fram
     }
 }
 TEST_SUITE_END() // ExportRhsToCLImage
+
+TEST_SUITE(ExportLhsToCLImage)
+FIXTURE_DATA_TEST_CASE(RunSmall, CLMatMulKernelExportLhsFixture<float>, framework::DatasetMode::ALL,
+                       combine(combine(combine(combine(combine(combine(combine(datasets::SmallMatMulDatasetRhsExportToCLImageRhsT(),
+                                                                               framework::dataset::make("TransposeA", { false })),
+                                                                       framework::dataset::make("TransposeB", { false, true })),
+                                                               framework::dataset::make("M0", { 1, 3 })),
+                                                       framework::dataset::make("N0", { 4 })),
+                                               framework::dataset::make("K0", { 4, 8, 16 })),
+                                       framework::dataset::make("ExportRhsToCLImage", { false })),
+                               framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    if(_device_supports_export_to_cl_image)
+    {
+        validate(CLAccessor(_target), _reference, tolerance_f32, 0.f, abs_tolerance_f32);
+    }
+}
+TEST_SUITE_END() // ExportLhsToCLImage
 TEST_SUITE_END() // FP32
 
 TEST_SUITE(FP16)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,6 +45,8 @@ namespace
 /** Tolerance for float operations */
 AbsoluteTolerance<float> tolerance_f32(0.001f);
 RelativeTolerance<float> rel_tolerance_f32(0.00001f);
+/** Tolerance for long rows, summed in a different order by work-groups */
+RelativeTolerance<float> rel_tolerance_long_rows_f32(0.001f);
 AbsoluteTolerance<float> tolerance_f16(0.5f);
 RelativeTolerance<float> rel_tolerance_f16(0.2f);
 /** Tolerance for quantized operations */
@@ -64,6 +66,17 @@ const auto ReductionOperationsMinMax = framework::dataset::make("ReductionMinMax
 });
 
 const auto KeepDimensions = framework::dataset::make("KeepDims", { true, false });
+
+/** Rows long enough to be reduced by work-groups, split into chunks when they are few */
+const auto LongRowShapes = framework::dataset::make("Shape", { TensorShape(32768U), TensorShape(4099U, 3U), TensorShape(1024U, 2U, 2U) });
+const auto ReductionOperationsLongRows = framework::dataset::make("ReductionOperationsLongRows",
+{
+    ReductionOperation::SUM,
+    ReductionOperation::SUM_SQUARE,
+    ReductionOperation::MEAN_SUM,
+    ReductionOperation::MIN,
+    ReductionOperation::MAX,
+});
 } // namespace
 
 TEST_SUITE(CL)
@@ -137,6 +150,14 @@ FIXTURE_DATA_TEST_CASE(RunSmall4D, CLReductionOperationFixture<float>, framework
     // Validate output
     validate(CLAccessor(_target), _reference, tolerance_f32);
 }
+FIXTURE_DATA_TEST_CASE(RunLongRows, CLReductionOperationFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(LongRowShapes, framework::dataset::make("DataType", DataType::F32)), framework::dataset::make("Axis", { 0 })),
+                                       ReductionOperationsLongRows),
+                               KeepDimensions))
+{
+    // Validate output
+    validate(CLAccessor(_target), _reference, rel_tolerance_long_rows_f32, 0, tolerance_f32);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge, CLReductionOperationFixture<float>, framework::DatasetMode::NIGHTLY,
                        combine(combine(combine(combine(datasets::LargeShapes(), framework::dataset::make("DataType", DataType::F32)), framework::dataset::make("Axis", { 0, 1, 2, 3 })), concat(ReductionOperationsSumProdMean,
                                        ReductionOperationsMinMax)),
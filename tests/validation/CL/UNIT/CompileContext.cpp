@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,9 @@
 #include "tests/framework/Macros.h"
 #include "tests/validation/Validation.h"
 
+#include <thread>
+#include <vector>
+
 namespace arm_compute
 {
 namespace test
@@ -67,6 +70,89 @@ TEST_CASE(CompileContextCache, framework::DatasetMode::ALL)
     ARM_COMPUTE_EXPECT(compile_context.get_built_programs().size() == 1, framework::LogLevel::ERRORS);
 }
 
+/** Test case for the persistent cache of program binaries of @ref CLCompileContext.
+ *
+ * Build a program with a first compile context writing to the cache, and create the same kernel with a second
+ * compile context reading from the cache.
+ *
+ * Checks performed in order:
+ * - The kernel created from the cached binary is valid
+ */
+TEST_CASE(CompileContextDiskCache, framework::DatasetMode::ALL)
+{
+    const std::string kernel_name  = "floor_layer";
+    const std::string program_name = CLKernelLibrary::get().get_program_name(kernel_name);
+    std::pair<std::string, bool> kernel_src = CLKernelLibrary::get().get_program(program_name);
+    const std::string kernel_path = CLKernelLibrary::get().get_kernel_path();
+
+    std::set<std::string> build_opts;
+    build_opts.emplace("-DDATA_TYPE=float");
+    build_opts.emplace("-DVEC_SIZE=16");
+    build_opts.emplace("-DVEC_SIZE_LEFTOVER=0");
+
+    // Compile the program and write its binary to the cache
+    {
+        CLCompileContext compile_context(CLKernelLibrary::get().context(), CLKernelLibrary::get().get_device());
+        compile_context.set_program_cache_directory(".");
+        compile_context.create_kernel(kernel_name, program_name, kernel_src.first, kernel_path, build_opts, kernel_src.second);
+        compile_context.wait_for_program_cache();
+    }
+
+    // Create the kernel from the cached binary
+    CLCompileContext compile_context(CLKernelLibrary::get().context(), CLKernelLibrary::get().get_device());
+    compile_context.set_program_cache_directory(".");
+    const Kernel kernel = compile_context.create_kernel(kernel_name, program_name, kernel_src.first, kernel_path, build_opts, kernel_src.second);
+    ARM_COMPUTE_EXPECT(static_cast<cl::Kernel>(kernel).getInfo<CL_KERNEL_FUNCTION_NAME>() == kernel_name,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(compile_context.get_built_programs().size() == 1, framework::LogLevel::ERRORS);
+}
+
+/** Test case for concurrent calls to @ref CLCompileContext::create_kernel.
+ *
+ * Create kernels from several threads, half of them from one program and half from a program built with different
+ * options.
+ *
+ * Checks performed in order:
+ * - All the kernels are valid
+ * - Each program has been built and cached only once
+ */
+TEST_CASE(CompileContextConcurrentBuilds, framework::DatasetMode::ALL)
+{
+    CLCompileContext compile_context(CLKernelLibrary::get().context(), CLKernelLibrary::get().get_device());
+
+    const std::string kernel_name  = "floor_layer";
+    const std::string program_name = CLKernelLibrary::get().get_program_name(kernel_name);
+    std::pair<std::string, bool> kernel_src = CLKernelLibrary::get().get_program(program_name);
+    const std::string kernel_path = CLKernelLibrary::get().get_kernel_path();
+
+    constexpr int            num_threads = 8;
+    std::vector<std::string> names(num_threads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back(
+            [&, i]()
+            {
+                std::set<std::string> build_opts;
+                build_opts.emplace("-DDATA_TYPE=float");
+                build_opts.emplace(i % 2 == 0 ? "-DVEC_SIZE=16" : "-DVEC_SIZE=4");
+                build_opts.emplace("-DVEC_SIZE_LEFTOVER=0");
+                const Kernel kernel = compile_context.create_kernel(kernel_name, program_name, kernel_src.first, kernel_path, build_opts, kernel_src.second);
+                names[i]            = static_cast<cl::Kernel>(kernel).getInfo<CL_KERNEL_FUNCTION_NAME>();
+            });
+    }
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+
+    for (const auto &name : names)
+    {
+        ARM_COMPUTE_EXPECT(name == kernel_name, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(compile_context.get_built_programs().size() == 2, framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE_END() // CompileContext
 TEST_SUITE_END() // UNIT
 TEST_SUITE_END() // CL
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLKernelProfiler.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/functions/CLActivationLayer.h"
+
+#include "tests/CL/CLAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Sampler counting the kernels it is called for */
+class CountingSampler final : public ICLHardwareCounterSampler
+{
+public:
+    void begin_kernel() override
+    {
+        ++_begins;
+    }
+    std::map<std::string, uint64_t> end_kernel() override
+    {
+        return {{"Kernels", ++_ends}};
+    }
+    uint64_t _begins{0};
+    uint64_t _ends{0};
+};
+} // namespace
+
+TEST_SUITE(CL)
+TEST_SUITE(UNIT)
+TEST_SUITE(KernelProfiler)
+/** Test case for @ref CLKernelProfiler.
+ *
+ * Profile two functions with a counter sampler.
+ *
+ * Checks performed in order:
+ * - One profile is recorded per kernel, with its configuration ID
+ * - The device timestamps of each profile are ordered
+ * - The sampler is called around each kernel and its counters are attached to the profile
+ * - No profile is recorded once the profiler is unset
+ */
+TEST_CASE(ProfileFunctions, framework::DatasetMode::ALL)
+{
+    const TensorInfo info(TensorShape(33U, 17U, 3U), 1, DataType::F32);
+
+    CLTensor src = create_tensor<CLTensor>(info);
+    CLTensor mid = create_tensor<CLTensor>(info);
+    CLTensor dst = create_tensor<CLTensor>(info);
+
+    CLActivationLayer act_0;
+    CLActivationLayer act_1;
+    act_0.configure(&src, &mid, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    act_1.configure(&mid, &dst, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
+
+    src.allocator()->allocate();
+    mid.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(CLAccessor(src), 0);
+
+    CountingSampler  sampler;
+    CLKernelProfiler profiler;
+    profiler.set_counter_sampler(&sampler);
+    CLScheduler::get().set_kernel_profiler(&profiler);
+    act_0.run();
+    act_1.run();
+    CLScheduler::get().set_kernel_profiler(nullptr);
+
+    const auto &profiles = profiler.profiles();
+    ARM_COMPUTE_ASSERT(profiles.size() == 2U);
+    ARM_COMPUTE_EXPECT(sampler._begins == 2U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(sampler._ends == 2U, framework::LogLevel::ERRORS);
+    for (size_t i = 0; i < profiles.size(); ++i)
+    {
+        const CLKernelProfile &profile = profiles[i];
+        ARM_COMPUTE_EXPECT(!profile.name.empty(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!profile.config_id.empty(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(profile.queued_ns <= profile.start_ns, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(profile.start_ns <= profile.end_ns, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(profile.counters.at("Kernels") == i + 1, framework::LogLevel::ERRORS);
+    }
+
+    profiler.clear();
+    act_0.run();
+    ARM_COMPUTE_EXPECT(profiler.profiles().empty(), framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // KernelProfiler
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // CL
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -465,6 +465,68 @@ TEST_CASE(InvalidUsageOfHeuristicsShouldReturnInvalidStatus, framework::DatasetM
     // Querying unavailable data type should return invalid Status
     ARM_COMPUTE_EXPECT(!heuristics.query_gemm_config_reshaped_only_rhs(Query{ "g76", DataType::QASYMM8, 1024, 1024, 100, 3 }).first, framework::LogLevel::ERRORS);
 }
+TEST_CASE(TunedConfigsShouldBeSavedAndReloaded, framework::DatasetMode::ALL)
+{
+    std::string       mlgo_str = R"_(
+        <header>
+        gemm-version, [1,2,1]
+        ip-type,gpu
+        </header>
+        <heuristics-table>
+        0, g76 , 8, f32, best-performance, static, gemm-type, [m,n,k,n]
+        1, g71 , 8, f16, best-performance, static, gemm-config-reshaped-only-rhs, [m,n,k,n]
+        </heuristics-table>
+        <heuristic, 0>
+        b , 0, var, m, ==, num, 10., 1, 2
+        l , 1, gemm-type, reshaped
+        b , 2, var, r_mn, >=, num, 2., 3, 6
+        b , 3, var, n, >=, num, 200., 4, 5
+        l , 4, gemm-type, reshaped-only-rhs
+        l , 5, gemm-type, reshaped
+        l , 6, gemm-type, reshaped-only-rhs
+        </heuristic>
+        <heuristic, 1>
+        b ,0,var, n, >, num, 100., 1, 4
+        b ,1,var, r_mnk, <=, num, 20., 2, 3
+        l ,2,gemm-config-reshaped-only-rhs, [4, 4,4,2,1,0,1]
+        l ,3,gemm-config-reshaped-only-rhs,[ 2, 2,4,2,1,1, 1 ]
+        b ,4,var, n, >=, num, 199.12, 5, 6
+        l ,5,gemm-config-reshaped-only-rhs, [1, 4,3,4,0,0,0]
+        l ,6,gemm-config-reshaped-only-rhs, [5, 4,4,5,1,1,0]
+        </heuristic>
+    )_";
+    std::stringstream ss(mlgo_str);
+    MLGOHeuristics    heuristics;
+    ARM_COMPUTE_EXPECT(heuristics.reload_from_stream(ss), framework::LogLevel::ERRORS);
+
+    // Tuned configs are returned before the ones of the heuristic trees
+    heuristics.add_tuned_gemm_config_reshaped_only_rhs(Query{ "g71", DataType::F16, 100, 1024, 20, 32 }, GEMMConfigReshapedOnlyRHS{ 8, 2, 2, 16, false, true, false });
+    heuristics.add_tuned_gemm_config_reshaped_only_rhs(Query{ "g71", DataType::F16, 100, 1000, 20, 1 }, GEMMConfigReshapedOnlyRHS{ 3, 8, 2, 1, false, true, false });
+    heuristics.add_tuned_gemm_config_reshaped(Query{ "g78", DataType::F32, 64, 64, 64, 1 }, GEMMConfigReshaped{ 4, 4, 4, 2, 2, true, true, false, false });
+    ARM_COMPUTE_EXPECT((heuristics.query_gemm_config_reshaped_only_rhs(Query{ "g71", DataType::F16, 100, 1024, 20, 32 }).second == GEMMConfigReshapedOnlyRHS{ 8, 2, 2, 16, false, true, false }),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!heuristics.query_tuned_gemm_config_reshaped_only_rhs(Query{ "g71", DataType::F16, 100, 1024, 20, 1 }).first, framework::LogLevel::ERRORS);
+
+    std::stringstream saved;
+    heuristics.save_to_stream(saved);
+    MLGOHeuristics reloaded;
+    ARM_COMPUTE_EXPECT(reloaded.reload_from_stream(saved), framework::LogLevel::ERRORS);
+
+    // The tuned configs are merged into the heuristic trees
+    ARM_COMPUTE_EXPECT((reloaded.query_gemm_config_reshaped_only_rhs(Query{ "g71", DataType::F16, 100, 1024, 20, 32 }).second == GEMMConfigReshapedOnlyRHS{ 8, 2, 2, 16, false, true, false }),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT((reloaded.query_gemm_config_reshaped_only_rhs(Query{ "g71", DataType::F16, 100, 1000, 20, 1 }).second == GEMMConfigReshapedOnlyRHS{ 3, 8, 2, 1, false, true, false }),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT((reloaded.query_gemm_config_reshaped(Query{ "g78", DataType::F32, 64, 64, 64, 1 }).second == GEMMConfigReshaped{ 4, 4, 4, 2, 2, true, true, false, false }),
+                       framework::LogLevel::ERRORS);
+
+    // The other shapes still follow the original heuristic trees
+    ARM_COMPUTE_EXPECT((reloaded.query_gemm_config_reshaped_only_rhs(Query{ "g71", DataType::F16, 400, 100, 512, 1 }).second == GEMMConfigReshapedOnlyRHS{ 5, 4, 4, 5, true, true, false }),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT((reloaded.query_gemm_config_reshaped_only_rhs(Query{ "g71", DataType::F16, 128, 101, 20, 1 }).second == GEMMConfigReshapedOnlyRHS{ 2, 2, 4, 2, true, true, true }),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(reloaded.query_gemm_type(Query{ "g76", DataType::F32, 400, 201, 5, 1 }).second == GEMMType::RESHAPED_ONLY_RHS, framework::LogLevel::ERRORS);
+}
 TEST_SUITE_END() // MLGOHeuristics
 TEST_SUITE_END() // UNIT
 TEST_SUITE_END() // CL
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLRecordedQueue.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/functions/CLActivationLayer.h"
+
+#include "tests/CL/CLAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+#include <cstring>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+std::vector<uint8_t> read_tensor(CLTensor &tensor)
+{
+    std::vector<uint8_t> data(tensor.info()->total_size());
+    tensor.map(true);
+    std::memcpy(data.data(), tensor.buffer(), data.size());
+    tensor.unmap();
+    return data;
+}
+} // namespace
+
+TEST_SUITE(CL)
+TEST_SUITE(UNIT)
+TEST_SUITE(RecordedQueue)
+/** Test case for @ref CLRecordedQueue.
+ *
+ * Record two functions, change their input and replay them.
+ *
+ * Checks performed in order:
+ * - The recording can be replayed
+ * - The replay computes the same output as running the functions
+ */
+TEST_CASE(ReplayFunctions, framework::DatasetMode::ALL)
+{
+    const TensorInfo info(TensorShape(33U, 17U, 3U), 1, DataType::F32);
+
+    CLTensor src = create_tensor<CLTensor>(info);
+    CLTensor mid = create_tensor<CLTensor>(info);
+    CLTensor dst = create_tensor<CLTensor>(info);
+
+    CLActivationLayer act_0;
+    CLActivationLayer act_1;
+    act_0.configure(&src, &mid, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    act_1.configure(&mid, &dst, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
+
+    src.allocator()->allocate();
+    mid.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(CLAccessor(src), 0);
+
+    CLRecordedQueue recording;
+    recording.begin_recording();
+    act_0.run();
+    act_1.run();
+    ARM_COMPUTE_EXPECT(recording.end_recording(), framework::LogLevel::ERRORS);
+
+    // Replay on a new input
+    library->fill_tensor_uniform(CLAccessor(src), 1);
+    ARM_COMPUTE_EXPECT(recording.replay(), framework::LogLevel::ERRORS);
+    CLScheduler::get().sync();
+    const auto replayed = read_tensor(dst);
+
+    act_0.run();
+    act_1.run();
+    CLScheduler::get().sync();
+    const auto reference = read_tensor(dst);
+
+    ARM_COMPUTE_EXPECT(replayed == reference, framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // RecordedQueue
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // CL
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/runtime/BlobLifetimeManager.h"
 #include "arm_compute/runtime/CL/CLBufferAllocator.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLSVMAllocator.h"
 #include "arm_compute/runtime/CL/functions/CLActivationLayer.h"
 #include "arm_compute/runtime/CL/functions/CLGEMMConvolutionLayer.h"
 #include "arm_compute/runtime/MemoryGroup.h"
@@ -167,6 +168,49 @@ TEST_CASE(ExternalGlobalAllocatorMemoryPool, framework::DatasetMode::ALL)
     CLTensorAllocator::set_global_allocator(nullptr);
 }
 
+/* Validate that the SVM allocator can back the pool manager and the tensors shared with the host */
+TEST_CASE(SVMAllocator, framework::DatasetMode::ALL)
+{
+    auto lifetime_mgr = std::make_shared<BlobLifetimeManager>();
+    auto pool_mgr     = std::make_shared<PoolManager>();
+    auto mm           = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+
+    CLSVMAllocator svm_alloc;
+    CLTensorAllocator::set_global_allocator(&svm_alloc);
+
+    // Run a convolution
+    run_conv2d(mm, svm_alloc);
+
+    // Check that host writes and device results are visible through the mapping
+    CLTensor tensor;
+    tensor.allocator()->init(TensorInfo(TensorShape(24U, 16U, 3U), 1, DataType::F32));
+    CLActivationLayer act_func;
+    act_func.configure(&tensor, nullptr, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    tensor.allocator()->allocate();
+
+    const size_t total_size_in_elems = tensor.info()->tensor_shape().total_size();
+    tensor.map(true);
+    auto *typed_ptr = reinterpret_cast<float *>(tensor.buffer());
+    for(unsigned int i = 0; i < total_size_in_elems; ++i)
+    {
+        typed_ptr[i] = (i % 2 == 0) ? -1.f : 1.f;
+    }
+    tensor.unmap();
+
+    act_func.run();
+
+    tensor.map(true);
+    typed_ptr = reinterpret_cast<float *>(tensor.buffer());
+    for(unsigned int i = 0; i < total_size_in_elems; ++i)
+    {
+        ARM_COMPUTE_EXPECT(typed_ptr[i] == ((i % 2 == 0) ? 0.f : 1.f), framework::LogLevel::ERRORS);
+    }
+    tensor.unmap();
+
+    // Nullify global allocator
+    CLTensorAllocator::set_global_allocator(nullptr);
+}
+
 /** Validates import memory interface when importing cl buffer objects */
 TEST_CASE(ImportMemoryBuffer, framework::DatasetMode::ALL)
 {
@@ -208,6 +252,32 @@ TEST_CASE(ImportMemoryBuffer, framework::DatasetMode::ALL)
     ARM_COMPUTE_EXPECT(t4.cl_buffer().get() != buf.get(), framework::LogLevel::ERRORS);
 }
 
+/** Validates import memory interface when importing external memory handles */
+TEST_CASE(ImportMemoryExternalHandle, framework::DatasetMode::ALL)
+{
+    const TensorInfo info(TensorShape(24U, 16U, 3U), 1, DataType::F32);
+
+    // Negative case : Import an invalid file descriptor
+    CLTensor t1;
+    t1.allocator()->init(info);
+    ARM_COMPUTE_ASSERT(!bool(t1.allocator()->import_dma_buf(-1)));
+    ARM_COMPUTE_ASSERT(t1.info()->is_resizable());
+
+    // Negative case : Import nullptr
+    CLTensor t2;
+    t2.allocator()->init(info);
+    ARM_COMPUTE_ASSERT(!bool(t2.allocator()->import_android_hardware_buffer(nullptr)));
+    ARM_COMPUTE_ASSERT(t2.info()->is_resizable());
+
+    // Negative case : Import memory to a tensor that is memory managed
+    CLTensor    t3;
+    MemoryGroup mg;
+    t3.allocator()->init(info);
+    t3.allocator()->set_associated_memory_group(&mg);
+    ARM_COMPUTE_ASSERT(!bool(t3.allocator()->import_dma_buf(0)));
+    ARM_COMPUTE_ASSERT(t3.info()->is_resizable());
+}
+
 /** Validates import memory interface when importing malloced memory */
 TEST_CASE(ImportMemoryMalloc, framework::DatasetMode::ALL)
 {
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/GPUTarget.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/CLTuner.h"
+
+#include "src/gpu/cl/kernels/ClActivationKernel.h"
+#include "tests/CL/CLAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+std::vector<uint8_t> read_tensor(CLTensor &tensor)
+{
+    std::vector<uint8_t> data(tensor.info()->total_size());
+    tensor.map(true);
+    std::memcpy(data.data(), tensor.buffer(), data.size());
+    tensor.unmap();
+    return data;
+}
+} // namespace
+
+TEST_SUITE(CL)
+TEST_SUITE(UNIT)
+TEST_SUITE(Tuner)
+/** Test case for the online mode of @ref CLTuner.
+ *
+ * Run a kernel until the tuner has explored all the candidates of its search.
+ *
+ * Checks performed in order:
+ * - Every run computes the same output while the kernel is being tuned
+ * - The search converges and the tuned parameters are added to the table
+ */
+TEST_CASE(OnlineTuning, framework::DatasetMode::ALL)
+{
+    const TensorInfo info(TensorShape(67U, 23U, 5U), 1, DataType::F32);
+
+    CLTensor src = create_tensor<CLTensor>(info);
+    CLTensor dst = create_tensor<CLTensor>(info);
+
+    opencl::kernels::ClActivationKernel kernel;
+    kernel.configure(CLKernelLibrary::get().get_compile_context(), src.info(), dst.info(),
+                     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(CLAccessor(src), 0);
+
+    ITensorPack pack{{TensorType::ACL_SRC, &src}, {TensorType::ACL_DST, &dst}};
+
+    CLTuningInfo tuning_info;
+    tuning_info.tuner_mode  = CLTunerMode::RAPID;
+    tuning_info.tune_online = true;
+    CLTuner tuner(true, tuning_info);
+
+    std::vector<uint8_t> reference;
+    bool                 outputs_match = true;
+    for (unsigned int i = 0; i < 1000 && tuner.tuning_params_table().empty(); ++i)
+    {
+        tuner.tune_kernel_dynamic(kernel, pack);
+        CLScheduler::get().enqueue_op(kernel, pack);
+        CLScheduler::get().sync();
+
+        const auto output = read_tensor(dst);
+        if (reference.empty())
+        {
+            reference = output;
+        }
+        outputs_match = outputs_match && (output == reference);
+    }
+
+    ARM_COMPUTE_EXPECT(outputs_match, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tuner.tuning_params_table().size() == 1, framework::LogLevel::ERRORS);
+}
+
+/** Test case for the device sections of the tuning files of @ref CLTuner.
+ *
+ * Load a file tuned on a device of another GPU target and on a device of the same GPU target with another driver,
+ * then save it.
+ *
+ * Checks performed in order:
+ * - Only the parameters of the device with the same GPU target are used
+ * - The saved file still holds the section of the other GPU target
+ * - Loading the saved file uses the parameters saved for the current device
+ */
+TEST_CASE(DeviceSections, framework::DatasetMode::ALL)
+{
+    const cl::Device  &device = CLKernelLibrary::get().get_device();
+    const std::string  target = string_from_target(get_target_from_device(device));
+    const unsigned int cus    = CLKernelLibrary::get().get_num_compute_units();
+
+    const std::string filename       = "acl_tuner_device_sections.csv";
+    const std::string saved_filename = "acl_tuner_device_sections_saved.csv";
+    {
+        std::ofstream fs(filename);
+        fs << "lws" << std::endl;
+        fs << "#device;not_a_gpu_target;driver;" << cus << std::endl;
+        fs << "foreign_kernel;4;1;1" << std::endl;
+        fs << "#device;" << target << ";another driver;" << cus + 2 << std::endl;
+        fs << "nearest_kernel;8;2;1" << std::endl;
+    }
+
+    CLTuner tuner;
+    tuner.load_from_file(filename);
+    const auto &table = tuner.tuning_params_table();
+    ARM_COMPUTE_EXPECT(table.count("foreign_kernel") == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(table.count("nearest_kernel") == 1, framework::LogLevel::ERRORS);
+
+    ARM_COMPUTE_EXPECT(tuner.save_to_file(saved_filename), framework::LogLevel::ERRORS);
+    std::stringstream saved;
+    saved << std::ifstream(saved_filename).rdbuf();
+    ARM_COMPUTE_EXPECT(saved.str().find("foreign_kernel") != std::string::npos, framework::LogLevel::ERRORS);
+
+    CLTuner reloaded;
+    reloaded.load_from_file(saved_filename);
+    ARM_COMPUTE_EXPECT(reloaded.tuning_params_table().count("foreign_kernel") == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(reloaded.tuning_params_table().count("nearest_kernel") == 1, framework::LogLevel::ERRORS);
+
+    std::remove(filename.c_str());
+    std::remove(saved_filename.c_str());
+}
+TEST_SUITE_END() // Tuner
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // CL
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/CLWeightsCache.h"
+#include "arm_compute/runtime/CL/functions/CLGEMMConvolutionLayer.h"
+
+#include "tests/CL/CLAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+
+#include <cstring>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+std::vector<uint8_t> read_tensor(CLTensor &tensor)
+{
+    std::vector<uint8_t> data(tensor.info()->total_size());
+    tensor.map(true);
+    std::memcpy(data.data(), tensor.buffer(), data.size());
+    tensor.unmap();
+    return data;
+}
+} // namespace
+
+TEST_SUITE(CL)
+TEST_SUITE(UNIT)
+TEST_SUITE(WeightsCache)
+/** Test case for @ref CLWeightsCache.
+ *
+ * Configure two convolution layers with the same registered weights, as two graphs finalized one after the other.
+ *
+ * Checks performed in order:
+ * - The weights transformed by the first layer are cached once
+ * - The second layer imports them and computes the same output, even once the first layer is destroyed
+ * - The entries are dropped when the weights are unregistered
+ */
+TEST_CASE(ShareTransformedWeights, framework::DatasetMode::ALL)
+{
+    const TensorInfo    src_info(TensorShape(17U, 13U, 8U), 1, DataType::F32);
+    const TensorInfo    wei_info(TensorShape(3U, 3U, 8U, 16U), 1, DataType::F32);
+    const TensorInfo    bia_info(TensorShape(16U), 1, DataType::F32);
+    const TensorInfo    dst_info(TensorShape(15U, 11U, 16U), 1, DataType::F32);
+    const PadStrideInfo conv_info(1, 1, 0, 0);
+
+    CLTensor src     = create_tensor<CLTensor>(src_info);
+    CLTensor weights = create_tensor<CLTensor>(wei_info);
+    CLTensor biases  = create_tensor<CLTensor>(bia_info);
+    CLTensor dst_0   = create_tensor<CLTensor>(dst_info);
+    CLTensor dst_1   = create_tensor<CLTensor>(dst_info);
+
+    src.allocator()->allocate();
+    weights.allocator()->allocate();
+    biases.allocator()->allocate();
+    dst_0.allocator()->allocate();
+    dst_1.allocator()->allocate();
+    library->fill_tensor_uniform(CLAccessor(src), 0);
+    library->fill_tensor_uniform(CLAccessor(weights), 1);
+    library->fill_tensor_uniform(CLAccessor(biases), 2);
+
+    CLWeightsCache  cache;
+    CLWeightsCache *old_cache = CLScheduler::get().weights_cache();
+    CLScheduler::get().set_weights_cache(&cache);
+    cache.register_weights(&weights);
+
+    {
+        CLGEMMConvolutionLayer conv_0;
+        conv_0.configure(&src, &weights, &biases, &dst_0, conv_info);
+        conv_0.run();
+    }
+    ARM_COMPUTE_EXPECT(cache.size() == 1U, framework::LogLevel::ERRORS);
+
+    CLGEMMConvolutionLayer conv_1;
+    conv_1.configure(&src, &weights, &biases, &dst_1, conv_info);
+    conv_1.run();
+    ARM_COMPUTE_EXPECT(cache.size() == 1U, framework::LogLevel::ERRORS);
+
+    ARM_COMPUTE_EXPECT(read_tensor(dst_1) == read_tensor(dst_0), framework::LogLevel::ERRORS);
+
+    cache.unregister_weights(&weights);
+    ARM_COMPUTE_EXPECT(cache.size() == 0U, framework::LogLevel::ERRORS);
+    CLScheduler::get().set_weights_cache(old_cache);
+}
+TEST_SUITE_END() // WeightsCache
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // CL
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
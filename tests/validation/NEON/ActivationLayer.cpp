@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -151,6 +151,8 @@ TEST_CASE(ActivationAPI, framework::DatasetMode::ALL)
     // Execute operator
     err = act.run(queue, pack);
     ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    err = queue.finish();
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
 }
 
 // *INDENT-OFF*
@@ -233,6 +235,19 @@ FIXTURE_DATA_TEST_CASE(RunLogistic5D, NEActivationLayerFixture<float>, framework
 FIXTURE_DATA_TEST_CASE(RunLogisticSME, NEActivationLayerFixture<float>, framework::DatasetMode::ALL, combine(datasets::LogisticSMEStressShapesFp32(), LogsisticDataset, framework::dataset::make("DataType",
                                                                                                        DataType::F32)))
 
+{
+    // Validate output
+    validate(Accessor(_target), _reference, helper::relative_tolerance(_data_type, _function), 0.f, helper::absolute_tolerance(_data_type, _function));
+}
+
+const auto ClampSMEDataset = combine(framework::dataset::make("InPlace", { false, true }), framework::dataset::make("Function", { ActivationLayerInfo::ActivationFunction::RELU,
+                                                                                                                                  ActivationLayerInfo::ActivationFunction::BOUNDED_RELU,
+                                                                                                                                  ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU
+                                                                                                                                }),
+                                     framework::dataset::make("AlphaBeta", { 0.5f, 1.f }));
+FIXTURE_DATA_TEST_CASE(RunClampSME, NEActivationLayerFixture<float>, framework::DatasetMode::ALL, combine(datasets::LogisticSMEStressShapesFp32(), ClampSMEDataset, framework::dataset::make("DataType",
+                                                                                                     DataType::F32)))
+
 {
     // Validate output
     validate(Accessor(_target), _reference, helper::relative_tolerance(_data_type, _function), 0.f, helper::absolute_tolerance(_data_type, _function));
@@ -260,6 +275,13 @@ const auto QuantizedActivationDataset = combine(combine(framework::dataset::make
                                                         concat(QuantizedActivationFunctionsDataset, framework::dataset::make("ActivationFunction", ActivationLayerInfo::ActivationFunction::HARD_SWISH))),
                                                 framework::dataset::make("AlphaBeta", { 0.5f, 1.f }));
 
+#ifdef __aarch64__
+/** Activations only computed through a lookup table in the 8-bit integer domain */
+const auto QuantizedLutActivationDataset = combine(framework::dataset::make("InPlace", { false }),
+                                                   framework::dataset::make("ActivationFunction", { ActivationLayerInfo::ActivationFunction::ELU, ActivationLayerInfo::ActivationFunction::SWISH }),
+                                                   framework::dataset::make("AlphaBeta", { 0.5f, 1.f }));
+#endif // __aarch64__
+
 TEST_SUITE(Quantized)
 TEST_SUITE(QASYMM8)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEActivationLayerQuantizedFixture<uint8_t>, framework::DatasetMode::ALL, combine(combine(combine(datasets::SmallShapes(), QuantizedActivationDataset),
@@ -270,6 +292,15 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEActivationLayerQuantizedFixture<uint8_t>, fra
     // Validate output
     validate(Accessor(_target), _reference, helper::tolerance_qasymm8(_function));
 }
+#ifdef __aarch64__
+FIXTURE_DATA_TEST_CASE(RunSmallLut, NEActivationLayerQuantizedFixture<uint8_t>, framework::DatasetMode::ALL, combine(datasets::SmallShapes(), QuantizedLutActivationDataset,
+                                                                                                                     framework::dataset::make("DataType", DataType::QASYMM8),
+                                                                                                                     framework::dataset::make("QuantizationInfo", { QuantizationInfo(0.1f, 128.0f) })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, helper::tolerance_qasymm8(_function));
+}
+#endif // __aarch64__
 TEST_SUITE_END() // QASYMM8
 
 TEST_SUITE(QASYMM8_SIGNED)
@@ -281,6 +312,15 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEActivationLayerQuantizedFixture<int8_t>, fram
     // Validate output
     validate(Accessor(_target), _reference, helper::tolerance_qasymm8(_function));
 }
+#ifdef __aarch64__
+FIXTURE_DATA_TEST_CASE(RunSmallLut, NEActivationLayerQuantizedFixture<int8_t>, framework::DatasetMode::ALL, combine(datasets::SmallShapes(), QuantizedLutActivationDataset,
+                                                                                                                    framework::dataset::make("DataType", DataType::QASYMM8_SIGNED),
+                                                                                                                    framework::dataset::make("QuantizationInfo", { QuantizationInfo(0.5f, 10.0f) })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, helper::tolerance_qasymm8(_function));
+}
+#endif // __aarch64__
 TEST_SUITE_END() // QASYMM8_SIGNED
 
 /** Input data sets. */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -60,6 +60,13 @@ const auto ArgMinMaxSmallDatasetAxis0 = framework::dataset::make("Shape",
     TensorShape{ 17U },
     TensorShape{ 15U, 2U },
 });
+/** Logits of classifiers, reduced along X by the lane-tracking kernels */
+const auto ArgMinMaxClassifierDatasetAxis0 = framework::dataset::make("Shape",
+{
+    TensorShape{ 10U, 4U },
+    TensorShape{ 1000U },
+    TensorShape{ 1001U, 2U },
+});
 using ArgMinMaxSmallDataset = datasets::Small4DShapes;
 using ArgMinMaxLargeDataset = datasets::Large4DShapes;
 }
@@ -203,6 +210,19 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     validate(Accessor(_target), _reference);
 }
 
+FIXTURE_DATA_TEST_CASE(RunClassifier,
+                       NEArgMinMaxValidationFixture_F32_S32,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(ArgMinMaxClassifierDatasetAxis0,
+                                                       framework::dataset::make("DataTypeIn", DataType::F32)),
+                                               framework::dataset::make("DataTypeOut", DataType::S32)),
+                                       framework::dataset::make("Axis", { 0 })),
+                               OpsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
+
 #ifdef __aarch64__
 FIXTURE_DATA_TEST_CASE(RunSmall_F32_S64,
                        NEArgMinMaxValidationFixture_F32_S64,
@@ -253,6 +273,19 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference);
 }
+FIXTURE_DATA_TEST_CASE(RunClassifier,
+                       NEArgMinMaxQuantizedValidationFixture_U8_S32,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(ArgMinMaxClassifierDatasetAxis0,
+                                                               framework::dataset::make("DataTypeIn", DataType::QASYMM8)),
+                                                       framework::dataset::make("DataTypeOut", DataType::S32)),
+                                               framework::dataset::make("Axis", { 0 })),
+                                       OpsDataset),
+                               QInfoDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge,
                        NEArgMinMaxQuantizedValidationFixture_U8_S32,
                        framework::DatasetMode::NIGHTLY,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024 Arm Limited.
+ * Copyright (c) 2019-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,10 +24,12 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/utils/StringUtils.h"
 #include "arm_compute/runtime/NEON/functions/NECast.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "src/common/cpuinfo/CpuIsaInfo.h"
 #include "src/cpu/kernels/CpuCastKernel.h"
+#include "support/Fp8.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/PaddingCalculator.h"
 #include "tests/datasets/ConvertPolicyDataset.h"
@@ -39,7 +41,12 @@
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/CastFixture.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
 #include <vector>
 
 namespace arm_compute
@@ -138,11 +145,131 @@ void validate_static_cast(const TensorShape &shape, DataType src_dtype, DataType
     }
 }
 
+
+template <typename TIn, typename TOut>
+void validate_affine_cast(DataType src_dtype, DataType dst_dtype, float scale, float offset)
+{
+    const auto shape = TensorShape(37U, 3U); // Not a multiple of the vector length to stress the leftover lanes
+
+    Tensor input  = create_tensor<Tensor>(shape, src_dtype, 1);
+    Tensor output = create_tensor<Tensor>(shape, dst_dtype, 1);
+
+    cpu::kernels::CpuCastKernel cast;
+    cast.configure(input.info(), output.info(), ConvertPolicy::SATURATE, scale, offset);
+    input.allocator()->allocate();
+    output.allocator()->allocate();
+
+    library->fill_tensor_uniform(Accessor(input), 0);
+
+    ITensorPack pack{ { TensorType::ACL_SRC, &input }, { TensorType::ACL_DST, &output } };
+    NEScheduler::get().schedule_op(&cast, Window::DimY, cast.window(), pack);
+
+    const auto *src_ptr = reinterpret_cast<const TIn *>(input.buffer());
+    const auto *dst_ptr = reinterpret_cast<const TOut *>(output.buffer());
+    for(size_t i = 0; i < shape.total_size(); ++i)
+    {
+        const float value = static_cast<float>(src_ptr[i]) * scale + offset;
+        TOut        ref   = static_cast<TOut>(value);
+        if(std::is_integral<TOut>::value)
+        {
+            const float lowest = static_cast<float>(std::numeric_limits<TOut>::lowest());
+            const float max    = static_cast<float>(std::numeric_limits<TOut>::max());
+            ref                = static_cast<TOut>(std::round(std::min(std::max(value, lowest), max)));
+        }
+
+        // The kernels may fuse the multiply-add, which can move integer results across a rounding boundary
+        const float tolerance = std::is_integral<TOut>::value ? 1.f : 1e-5f * std::abs(value);
+        ARM_COMPUTE_EXPECT(std::abs(static_cast<float>(ref) - static_cast<float>(dst_ptr[i])) <= tolerance, framework::LogLevel::ERRORS);
+    }
+}
 } // namespace
 
 TEST_SUITE(NEON)
 TEST_SUITE(Cast)
 
+TEST_CASE(FusedAffine, framework::DatasetMode::ALL)
+{
+    validate_affine_cast<float, int8_t>(DataType::F32, DataType::QASYMM8_SIGNED, 0.5f, 3.f);
+    validate_affine_cast<float, uint8_t>(DataType::F32, DataType::QASYMM8, 64.f, 128.f);
+    validate_affine_cast<float, int32_t>(DataType::F32, DataType::S32, 1000.f, -0.5f);
+    validate_affine_cast<uint8_t, float>(DataType::U8, DataType::F32, 0.25f, -1.f);
+    validate_affine_cast<int8_t, float>(DataType::QASYMM8_SIGNED, DataType::F32, 0.1f, 2.f);
+    validate_affine_cast<int32_t, float>(DataType::S32, DataType::F32, 1.f / 256.f, 0.f);
+
+    // A scale or offset can only be fused through F32
+    const TensorInfo s16_info(TensorShape(16U), 1, DataType::S16);
+    const TensorInfo s32_info(TensorShape(16U), 1, DataType::S32);
+    ARM_COMPUTE_EXPECT(!bool(cpu::kernels::CpuCastKernel::validate(&s16_info, &s32_info, ConvertPolicy::SATURATE, 2.f, 0.f)), framework::LogLevel::ERRORS);
+}
+
+#ifdef __aarch64__
+/** Test case for the FP8 casts of @ref NECast
+ *
+ * Checks performed in order:
+ * - Every finite FP8 number is decoded to F32 and F16 as @ref fp8::e4m3_to_float and @ref fp8::e5m2_to_float do
+ * - Casting the decoded numbers back gives the same FP8 numbers
+ * - Values out of range saturate with ConvertPolicy::SATURATE
+ */
+TEST_CASE(Fp8, framework::DatasetMode::ALL)
+{
+    const auto run_cast = [](const std::vector<uint8_t> &in, DataType src_dt, DataType dst_dt, ConvertPolicy policy)
+    {
+        const TensorShape shape(in.size() / data_size_from_type(src_dt));
+        Tensor            src, dst;
+        src.allocator()->init(TensorInfo(shape, 1, src_dt));
+        dst.allocator()->init(TensorInfo(shape, 1, dst_dt));
+        NECast cast;
+        cast.configure(&src, &dst, policy);
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+        std::copy(in.begin(), in.end(), src.buffer());
+        cast.run();
+        return std::vector<uint8_t>(dst.buffer(), dst.buffer() + dst.info()->total_size());
+    };
+
+    for(DataType fp8_dt : { DataType::FP8_E4M3, DataType::FP8_E5M2 })
+    {
+        const bool is_e4m3 = fp8_dt == DataType::FP8_E4M3;
+
+        // E4M3 only reserves its largest magnitude for NaN, E5M2 reserves its largest exponent for infinities and NaNs
+        std::vector<uint8_t> codes;
+        for(unsigned int c = 0; c < 256; ++c)
+        {
+            const unsigned int mag = c & 0x7F;
+            if(mag < (is_e4m3 ? 0x7Fu : 0x7Cu))
+            {
+                codes.push_back(static_cast<uint8_t>(c));
+            }
+        }
+
+        const std::vector<uint8_t> f32 = run_cast(codes, fp8_dt, DataType::F32, ConvertPolicy::SATURATE);
+        for(size_t i = 0; i < codes.size(); ++i)
+        {
+            float value = 0.f;
+            std::memcpy(&value, f32.data() + i * sizeof(float), sizeof(float));
+            const float expected = is_e4m3 ? fp8::e4m3_to_float(codes[i]) : fp8::e5m2_to_float(codes[i]);
+            ARM_COMPUTE_EXPECT(value == expected && std::signbit(value) == std::signbit(expected), framework::LogLevel::ERRORS);
+        }
+        ARM_COMPUTE_EXPECT(run_cast(f32, DataType::F32, fp8_dt, ConvertPolicy::SATURATE) == codes, framework::LogLevel::ERRORS);
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+        if(CPUInfo::get().has_fp16())
+        {
+            const std::vector<uint8_t> f16 = run_cast(codes, fp8_dt, DataType::F16, ConvertPolicy::SATURATE);
+            ARM_COMPUTE_EXPECT(run_cast(f16, DataType::F16, fp8_dt, ConvertPolicy::SATURATE) == codes, framework::LogLevel::ERRORS);
+        }
+#endif // ARM_COMPUTE_ENABLE_FP16
+
+        std::vector<uint8_t> large(sizeof(float) * 2);
+        const float          values[2] = { 1e6f, -1e6f };
+        std::memcpy(large.data(), values, sizeof(values));
+        const std::vector<uint8_t> saturated = run_cast(large, DataType::F32, fp8_dt, ConvertPolicy::SATURATE);
+        const uint8_t              max_code  = is_e4m3 ? 0x7E : 0x7B;
+        ARM_COMPUTE_EXPECT(saturated[0] == max_code && saturated[1] == (max_code | 0x80), framework::LogLevel::ERRORS);
+    }
+}
+#endif // __aarch64__
+
 // Validate casting truncates floats to integer instead of rounding
 DATA_TEST_CASE(ValidateStaticCastBehavior, framework::DatasetMode::ALL,
     combine(
@@ -323,6 +450,31 @@ cpu_ext, data_type)
     ARM_COMPUTE_EXPECT_EQUAL(expected, actual, framework::LogLevel::ERRORS);
 }
 
+DATA_TEST_CASE(KernelSelectionSVE, framework::DatasetMode::ALL,
+               combine(make("SrcDataType", { DataType::F32, DataType::S32, DataType::U8, DataType::QASYMM8, DataType::QASYMM8_SIGNED }),
+                       make("DstDataType", { DataType::F32, DataType::S32, DataType::U8, DataType::QASYMM8, DataType::QASYMM8_SIGNED })),
+               src_dt, dst_dt)
+{
+    using namespace cpu::kernels;
+
+    cpuinfo::CpuIsaInfo cpu_isa{};
+    cpu_isa.neon = true;
+    cpu_isa.sve  = true;
+
+    const auto *selected_impl = CpuCastKernel::get_implementation(CastDataTypeISASelectorData{ src_dt, dst_dt, cpu_isa }, cpu::KernelSelectionType::Preferred);
+
+    // Only conversions through F32 lanes have a vector-length-agnostic kernel
+    if((src_dt == DataType::F32) != (dst_dt == DataType::F32))
+    {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(selected_impl);
+        ARM_COMPUTE_EXPECT_EQUAL(std::string("sve_fp32_cast"), std::string(selected_impl->name), framework::LogLevel::ERRORS);
+    }
+    else
+    {
+        ARM_COMPUTE_EXPECT(selected_impl == nullptr, framework::LogLevel::ERRORS);
+    }
+}
+
 TEST_SUITE_END() // Cast
 TEST_SUITE_END() // Neon
 } // namespace validation
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024 Arm Limited.
+ * Copyright (c) 2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/runtime/NEON/functions/NEConv3D.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
@@ -138,6 +139,63 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolution3DFixture<float>, framework:
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+
+/** Test case for a convolution whose input moves to another buffer between two runs
+ *
+ * Checks performed in order:
+ * - The second run reads the new buffer, as a convolution configured on it does
+ */
+TEST_CASE(RunWithMovedInput, framework::DatasetMode::ALL)
+{
+    const TensorShape src_shape(3U, 9U, 7U, 5U);
+    const TensorShape weights_shape(4U, 3U, 3U, 3U, 3U);
+    const Conv3dInfo  conv3d_info(Size3D(1U, 1U, 1U), Padding3D(1U, 1U, 1U), ActivationLayerInfo(), Size3D(1U, 1U, 1U),
+                                  DimensionRoundingType::FLOOR, false);
+    const TensorShape dst_shape = misc::shape_calculator::compute_conv3d_shape(src_shape, weights_shape, conv3d_info);
+    const TensorInfo  src_info(src_shape, 1, DataType::F32, DataLayout::NDHWC);
+
+    std::vector<float> first_src(src_shape.total_size());
+    std::vector<float> second_src(src_shape.total_size());
+
+    Tensor src;
+    Tensor ref_src;
+    src.allocator()->init(src_info);
+    ref_src.allocator()->init(src_info);
+    Tensor weights = create_tensor<Tensor>(weights_shape, DataType::F32, 1, QuantizationInfo(), DataLayout::NDHWC);
+    Tensor dst     = create_tensor<Tensor>(dst_shape, DataType::F32, 1, QuantizationInfo(), DataLayout::NDHWC);
+    Tensor ref_dst = create_tensor<Tensor>(dst_shape, DataType::F32, 1, QuantizationInfo(), DataLayout::NDHWC);
+
+    NEConv3D conv;
+    NEConv3D ref_conv;
+    conv.configure(&src, &weights, nullptr, &dst, conv3d_info);
+    ref_conv.configure(&ref_src, &weights, nullptr, &ref_dst, conv3d_info);
+
+    weights.allocator()->allocate();
+    dst.allocator()->allocate();
+    ref_dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(weights), 0);
+
+    // Run on a first input, then move the input to a second buffer with different values
+    ARM_COMPUTE_ASSERT(bool(src.allocator()->import_memory(first_src.data())));
+    library->fill_tensor_uniform(Accessor(src), 1);
+    conv.run();
+
+    ARM_COMPUTE_ASSERT(bool(src.allocator()->import_memory(second_src.data())));
+    library->fill_tensor_uniform(Accessor(src), 2);
+    std::fill(first_src.begin(), first_src.end(), 0.f);
+    conv.run();
+
+    // The output must match a convolution that only ever ran on the second buffer
+    ARM_COMPUTE_ASSERT(bool(ref_src.allocator()->import_memory(second_src.data())));
+    ref_conv.run();
+
+    const auto *values     = reinterpret_cast<const float *>(dst.buffer());
+    const auto *ref_values = reinterpret_cast<const float *>(ref_dst.buffer());
+    for (size_t i = 0; i < dst_shape.total_size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(values[i] == ref_values[i], framework::LogLevel::ERRORS);
+    }
+}
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_FP16
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1222,6 +1222,41 @@ TEST_CASE(MemoryInjection, framework::DatasetMode::ALL)
     }
 }
 
+/** Test case for the workspace of NHWC convolutions in @ref cpu::CpuGemmConv2d that cannot skip im2col.
+ *
+ * Strided and dilated convolutions read the source through the convolution parameters of the assembly kernels.
+ *
+ * Checks performed in order:
+ * - No auxiliary tensor is as large as the im2col buffer
+ */
+DATA_TEST_CASE(NoIm2ColWorkspace, framework::DatasetMode::ALL, zip(
+               make("ConvInfo", { PadStrideInfo(2, 2, 1, 1), PadStrideInfo(1, 1, 2, 2), PadStrideInfo(2, 2, 0, 0) }),
+               make("Dilation", { Size2D(1U, 1U), Size2D(2U, 2U), Size2D(1U, 1U) }),
+               make("KernelSize", { 3U, 3U, 1U }),
+               make("OutputSize", { 16U, 32U, 16U })),
+               conv_info, dilation, kernel_size, output_size)
+{
+    constexpr unsigned int channels = 16U;
+    constexpr unsigned int kernels  = 8U;
+
+    const auto src_info    = TensorInfo(TensorShape(channels, 32U, 32U), 1, DataType::F32, DataLayout::NHWC);
+    const auto weight_info = TensorInfo(TensorShape(channels, kernel_size, kernel_size, kernels), 1, DataType::F32, DataLayout::NHWC);
+    const auto bias_info   = TensorInfo(TensorShape(kernels), 1, DataType::F32, DataLayout::NHWC);
+    auto       dst_info    = TensorInfo(TensorShape(kernels, output_size, output_size), 1, DataType::F32, DataLayout::NHWC);
+
+    ARM_COMPUTE_EXPECT(bool(cpu::CpuGemmConv2d::validate(&src_info, &weight_info, &bias_info, &dst_info, conv_info, WeightsInfo(), dilation)),
+                       framework::LogLevel::ERRORS);
+
+    auto conv = std::make_unique<cpu::CpuGemmConv2d>();
+    conv->configure(&src_info, &weight_info, &bias_info, &dst_info, conv_info, WeightsInfo(), dilation);
+
+    const size_t im2col_size = channels * kernel_size * kernel_size * output_size * output_size * sizeof(float);
+    for(const auto &mem : conv->workspace())
+    {
+        ARM_COMPUTE_EXPECT(mem.size < im2col_size, framework::LogLevel::ERRORS);
+    }
+}
+
 /** Test case for memory injection in @ref NEGEMMConvolutionLayer.
  *
  * Make sure @ref NEGEMMConvolutionLayer still works through injecting the memory at configure time using the old API.
@@ -1358,6 +1393,73 @@ FIXTURE_DATA_TEST_CASE(RunVeryLarge, NEGEMMConvolutionLayerFixture<float>, frame
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 
+TEST_SUITE(Grouped)
+/** Grouped NHWC convolutions, the IFM of the weights being the one of a group */
+const auto SmallGroupedConvolutionDataset = zip(
+    make("Input", { TensorShape(23U, 27U, 8U), TensorShape(33U, 27U, 12U), TensorShape(23U, 27U, 8U, 2U), TensorShape(17U, 15U, 32U, 3U) }),
+    make("Weights", { TensorShape(1U, 1U, 4U, 24U), TensorShape(5U, 5U, 6U, 16U), TensorShape(3U, 3U, 2U, 24U), TensorShape(3U, 3U, 1U, 32U) }),
+    make("Bias", { TensorShape(24U), TensorShape(16U), TensorShape(24U), TensorShape(32U) }),
+    make("Output", { TensorShape(12U, 27U, 24U), TensorShape(11U, 12U, 16U), TensorShape(23U, 27U, 24U, 2U), TensorShape(17U, 15U, 32U, 3U) }),
+    make("PadStrideInfo", { PadStrideInfo(2, 1, 0, 0), PadStrideInfo(3, 2, 1, 0), PadStrideInfo(1, 1, 1, 1), PadStrideInfo(1, 1, 1, 1) }),
+    make("Dilation", { Size2D(1U, 1U), Size2D(1U, 1U), Size2D(1U, 1U), Size2D(1U, 1U) }));
+
+/** Test case for the validation of grouped convolutions in @ref NEConvolutionLayer
+ *
+ * Checks performed in order:
+ * - NHWC F32 is supported
+ * - NCHW is not supported
+ * - QASYMM8 is not supported
+ * - The number of kernels must be a multiple of the number of groups
+ */
+TEST_CASE(Validate, framework::DatasetMode::ALL)
+{
+    const PadStrideInfo conv_info(1, 1, 1, 1);
+    const unsigned int  num_groups = 4U;
+
+    const auto src_info    = TensorInfo(TensorShape(16U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC);
+    const auto weight_info = TensorInfo(TensorShape(4U, 3U, 3U, 12U), 1, DataType::F32, DataLayout::NHWC);
+    const auto dst_info    = TensorInfo(TensorShape(12U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC);
+    ARM_COMPUTE_EXPECT(bool(NEConvolutionLayer::validate(&src_info, &weight_info, nullptr, &dst_info, conv_info, WeightsInfo(), Size2D(1U, 1U),
+                                                         ActivationLayerInfo(), false, num_groups)),
+                       framework::LogLevel::ERRORS);
+
+    const auto nchw_src_info    = TensorInfo(TensorShape(8U, 8U, 16U), 1, DataType::F32, DataLayout::NCHW);
+    const auto nchw_weight_info = TensorInfo(TensorShape(3U, 3U, 4U, 12U), 1, DataType::F32, DataLayout::NCHW);
+    const auto nchw_dst_info    = TensorInfo(TensorShape(8U, 8U, 12U), 1, DataType::F32, DataLayout::NCHW);
+    ARM_COMPUTE_EXPECT(!bool(NEConvolutionLayer::validate(&nchw_src_info, &nchw_weight_info, nullptr, &nchw_dst_info, conv_info, WeightsInfo(), Size2D(1U, 1U),
+                                                          ActivationLayerInfo(), false, num_groups)),
+                       framework::LogLevel::ERRORS);
+
+    auto qsrc_info    = TensorInfo(TensorShape(16U, 8U, 8U), 1, DataType::QASYMM8, DataLayout::NHWC);
+    auto qweight_info = TensorInfo(TensorShape(4U, 3U, 3U, 12U), 1, DataType::QASYMM8, DataLayout::NHWC);
+    auto qdst_info    = TensorInfo(TensorShape(12U, 8U, 8U), 1, DataType::QASYMM8, DataLayout::NHWC);
+    qsrc_info.set_quantization_info(QuantizationInfo(0.5f, 3));
+    qweight_info.set_quantization_info(QuantizationInfo(0.5f, 3));
+    qdst_info.set_quantization_info(QuantizationInfo(0.5f, 3));
+    ARM_COMPUTE_EXPECT(!bool(NEConvolutionLayer::validate(&qsrc_info, &qweight_info, nullptr, &qdst_info, conv_info, WeightsInfo(), Size2D(1U, 1U),
+                                                          ActivationLayerInfo(), false, num_groups)),
+                       framework::LogLevel::ERRORS);
+
+    const auto odd_weight_info = TensorInfo(TensorShape(4U, 3U, 3U, 10U), 1, DataType::F32, DataLayout::NHWC);
+    const auto odd_dst_info    = TensorInfo(TensorShape(10U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC);
+    ARM_COMPUTE_EXPECT(!bool(NEConvolutionLayer::validate(&src_info, &odd_weight_info, nullptr, &odd_dst_info, conv_info, WeightsInfo(), Size2D(1U, 1U),
+                                                          ActivationLayerInfo(), false, num_groups)),
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConvolutionLayerFixture<float>, framework::DatasetMode::ALL, combine(SmallGroupedConvolutionDataset,
+                                                                                                            make("ReshapeWeights", { true }),
+                                                                                                            make("DataType", DataType::F32),
+                                                                                                            make("DataLayout", { DataLayout::NHWC }),
+                                                                                                            ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Grouped
+
 // TODO(COMPMID-6573): Extend quantized tests with at least one suite where the weight is padded (the legacy case, see floating point's RunPaddedWeights)
 template <typename T>
 using NEGEMMConvolutionLayerForUpdatedStaticQuantInfoAfterConfigureFixture = ConvolutionValidationForUpdatedStaticQuantInfoAfterConfigureFixture<Tensor, Accessor, NEGEMMConvolutionLayer, T>;
@@ -1666,6 +1768,70 @@ TEST_CASE(MultipleExecutionWithConfigure, framework::DatasetMode::ALL)
     }
 }
 
+/** Test case for the accumulation of @ref NEGEMMConv2d into its destination.
+ *
+ * Every output of a 3x3x4 convolution of ones by twos is 72 before the bias and the addend are added.
+ *
+ * Checks performed in order:
+ * - The convolution is added to the destination, with and without bias
+ * - The activation is applied to the sum
+ * - Accumulation is rejected for quantized data and uninitialized destinations
+ */
+TEST_CASE(Accumulate, framework::DatasetMode::ALL)
+{
+    const auto src_info    = TensorInfo(TensorShape(4U, 6U, 5U), 1, DataType::F32, DataLayout::NHWC);
+    const auto weight_info = TensorInfo(TensorShape(4U, 3U, 3U, 8U), 1, DataType::F32, DataLayout::NHWC);
+    const auto bias_info   = TensorInfo(TensorShape(8U), 1, DataType::F32, DataLayout::NHWC);
+    const auto dst_info    = TensorInfo(TensorShape(8U, 4U, 3U), 1, DataType::F32, DataLayout::NHWC);
+
+    auto run_conv = [&](bool has_bias, float addend, const ActivationLayerInfo &act_info)
+    {
+        Conv2dInfo conv_info{ PadStrideInfo(1, 1, 0, 0), Size2D(1U, 1U), act_info, false, 1 };
+        conv_info.accumulate = true;
+
+        auto src    = create_tensor<Tensor>(src_info);
+        auto weight = create_tensor<Tensor>(weight_info);
+        auto bias   = create_tensor<Tensor>(bias_info);
+        auto dst    = create_tensor<Tensor>(dst_info);
+        NEGEMMConv2d conv;
+        conv.configure(&src, &weight, has_bias ? &bias : nullptr, &dst, conv_info);
+        src.allocator()->allocate();
+        weight.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+        library->fill_tensor_value(Accessor(src), 1.f);
+        library->fill_tensor_value(Accessor(weight), 2.f);
+        library->fill_tensor_value(Accessor(bias), 3.f);
+        library->fill_tensor_value(Accessor(dst), addend);
+        conv.run();
+
+        const float value = reinterpret_cast<float *>(dst.buffer())[0];
+        for(size_t i = 1; i < dst_info.tensor_shape().total_size(); ++i)
+        {
+            ARM_COMPUTE_EXPECT(reinterpret_cast<float *>(dst.buffer())[i] == value, framework::LogLevel::ERRORS);
+        }
+        return value;
+    };
+
+    const ActivationLayerInfo relu(ActivationLayerInfo::ActivationFunction::RELU);
+    ARM_COMPUTE_EXPECT(run_conv(false, 5.f, ActivationLayerInfo()) == 77.f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_conv(true, 5.f, ActivationLayerInfo()) == 80.f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_conv(true, 5.f, relu) == 80.f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_conv(true, -100.f, relu) == 0.f, framework::LogLevel::ERRORS);
+
+    Conv2dInfo conv_info{ PadStrideInfo(1, 1, 0, 0), Size2D(1U, 1U), ActivationLayerInfo(), false, 1 };
+    conv_info.accumulate = true;
+    TensorInfo qsrc_info(TensorShape(4U, 6U, 5U), 1, DataType::QASYMM8, DataLayout::NHWC);
+    TensorInfo qweight_info(TensorShape(4U, 3U, 3U, 8U), 1, DataType::QASYMM8, DataLayout::NHWC);
+    TensorInfo qdst_info(TensorShape(8U, 4U, 3U), 1, DataType::QASYMM8, DataLayout::NHWC);
+    qsrc_info.set_quantization_info(QuantizationInfo(0.5f, 3));
+    qweight_info.set_quantization_info(QuantizationInfo(0.5f, 3));
+    qdst_info.set_quantization_info(QuantizationInfo(0.5f, 3));
+    const TensorInfo empty_dst_info{};
+    ARM_COMPUTE_EXPECT(!bool(NEGEMMConv2d::validate(&qsrc_info, &qweight_info, nullptr, &qdst_info, conv_info)), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!bool(NEGEMMConv2d::validate(&src_info, &weight_info, &bias_info, &empty_dst_info, conv_info)), framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectGEMMConv2dLayerFixture<float>, framework::DatasetMode::ALL, combine(combine(combine(combine(datasets::SmallConvolutionLayerDataset(),
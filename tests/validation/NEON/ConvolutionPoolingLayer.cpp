@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionPoolingLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConv2d.h"
+#include "arm_compute/runtime/NEON/functions/NEPoolingLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Max relative difference between @ref NEConvolutionPoolingLayer and a convolution followed by a pooling
+ *
+ * The input, weights and biases are filled with the same random values for both.
+ */
+float run_convolution_pooling(const TensorShape         &input_shape,
+                              const TensorShape         &weights_shape,
+                              const PadStrideInfo       &pad_stride,
+                              const ActivationLayerInfo &act_info = ActivationLayerInfo())
+{
+    const TensorInfo       input_info(input_shape, 1, DataType::F32, DataLayout::NHWC);
+    const TensorInfo       weights_info(weights_shape, 1, DataType::F32, DataLayout::NHWC);
+    const TensorInfo       biases_info(TensorShape(weights_shape[3]), 1, DataType::F32);
+    const Conv2dInfo       conv_info(pad_stride, Size2D(1U, 1U), act_info, false, 1U);
+    const PoolingLayerInfo pool_info(PoolingType::MAX, 2U, DataLayout::NHWC, PadStrideInfo(2, 2, 0, 0));
+
+    Tensor input, weights, biases, conv, reference, dst;
+    input.allocator()->init(input_info);
+    weights.allocator()->init(weights_info);
+    biases.allocator()->init(biases_info);
+
+    NEGEMMConv2d   conv_func;
+    NEPoolingLayer pool_func;
+    conv_func.configure(&input, &weights, &biases, &conv, conv_info);
+    pool_func.configure(&conv, &reference, pool_info);
+
+    NEConvolutionPoolingLayer fused_func;
+    fused_func.configure(&input, &weights, &biases, &dst, conv_info, pool_info);
+
+    for (Tensor *tensor : {&input, &weights, &biases, &conv, &reference, &dst})
+    {
+        tensor->allocator()->allocate();
+    }
+
+    std::mt19937                          gen(library->seed());
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    for (Tensor *tensor : {&input, &weights, &biases})
+    {
+        auto *data = reinterpret_cast<float *>(tensor->buffer());
+        for (size_t i = 0; i < tensor->info()->tensor_shape().total_size(); ++i)
+        {
+            data[i] = dist(gen);
+        }
+    }
+
+    conv_func.run();
+    pool_func.run();
+    fused_func.run();
+
+    const auto *expected = reinterpret_cast<const float *>(reference.buffer());
+    const auto *actual   = reinterpret_cast<const float *>(dst.buffer());
+    float       max_diff = 0.f;
+    for (size_t i = 0; i < dst.info()->tensor_shape().total_size(); ++i)
+    {
+        max_diff = std::max(max_diff, std::abs(expected[i] - actual[i]) / std::max(1.f, std::abs(expected[i])));
+    }
+    return max_diff;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ConvolutionPoolingLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::F32, DataLayout::NHWC),
+                                   TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::F32, DataLayout::NHWC),
+                                   TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::F32, DataLayout::NHWC),   // Average pooling
+                                   TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::F32, DataLayout::NHWC),   // 3x3 pooling
+                                   TensorInfo(TensorShape(16U, 16U, 8U), 1, DataType::F32, DataLayout::NCHW),   // NCHW layout
+                                   TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::QASYMM8, DataLayout::NHWC), // Quantized data
+                                   TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::F32, DataLayout::NHWC),   // Mismatching output shape
+                                 }),
+               make("WeightsInfo", { TensorInfo(TensorShape(8U, 3U, 3U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                     TensorInfo(TensorShape(8U, 3U, 3U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                     TensorInfo(TensorShape(8U, 3U, 3U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                     TensorInfo(TensorShape(8U, 3U, 3U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                     TensorInfo(TensorShape(3U, 3U, 8U, 4U), 1, DataType::F32, DataLayout::NCHW),
+                                     TensorInfo(TensorShape(8U, 3U, 3U, 4U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                                     TensorInfo(TensorShape(8U, 3U, 3U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                   }),
+               make("OutputInfo", { TensorInfo(TensorShape(4U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                    TensorInfo(),
+                                    TensorInfo(TensorShape(4U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                    TensorInfo(TensorShape(4U, 7U, 7U), 1, DataType::F32, DataLayout::NHWC),
+                                    TensorInfo(TensorShape(8U, 8U, 4U), 1, DataType::F32, DataLayout::NCHW),
+                                    TensorInfo(TensorShape(4U, 8U, 8U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                                    TensorInfo(TensorShape(4U, 16U, 16U), 1, DataType::F32, DataLayout::NHWC),
+                                  }),
+               make("PoolType", { PoolingType::MAX, PoolingType::MAX, PoolingType::AVG, PoolingType::MAX, PoolingType::MAX,
+                                  PoolingType::MAX, PoolingType::MAX }),
+               make("PoolSize", { 2U, 2U, 2U, 3U, 2U, 2U, 2U }),
+               make("Expected", { true, true, false, false, false, false, false })),
+               input_info, weights_info, output_info, pool_type, pool_size, expected)
+{
+    const DataLayout       layout = input_info.data_layout();
+    const Conv2dInfo       conv_info(PadStrideInfo(1, 1, 1, 1), Size2D(1U, 1U), ActivationLayerInfo(), false, 1U);
+    const PoolingLayerInfo pool_info(pool_type, pool_size, layout, PadStrideInfo(2, 2, 0, 0));
+    const Status           status = NEConvolutionPoolingLayer::validate(&input_info, &weights_info, nullptr, &output_info, conv_info, pool_info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_SUITE(FP32)
+/** Test case for @ref NEConvolutionPoolingLayer on outputs computed in a single band.
+ *
+ * Checks performed in order:
+ * - The output matches a convolution followed by a 2x2 max pooling, with and without padding or fused activation
+ * - Odd convolution heights leave the last row out of the pooling
+ */
+TEST_CASE(RunSingleBand, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_convolution_pooling(TensorShape(8U, 16U, 16U), TensorShape(8U, 3U, 3U, 12U),
+                                               PadStrideInfo(1, 1, 1, 1)) < 1e-5f,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_convolution_pooling(TensorShape(5U, 13U, 11U, 2U), TensorShape(5U, 3U, 3U, 7U),
+                                               PadStrideInfo(1, 1, 0, 0),
+                                               ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)) <
+                           1e-5f,
+                       framework::LogLevel::ERRORS);
+}
+
+/** Test case for @ref NEConvolutionPoolingLayer on outputs too large to stay in the cache.
+ *
+ * The rows of the convolution output are larger than half the L2 cache, so the output is computed in bands of two
+ * rows, reading zero-padded copies of the input at the top and bottom borders.
+ *
+ * Checks performed in order:
+ * - The output matches a convolution followed by a 2x2 max pooling for padded, unpadded and strided convolutions
+ */
+TEST_CASE(RunMultipleBands, framework::DatasetMode::NIGHTLY)
+{
+    ARM_COMPUTE_EXPECT(run_convolution_pooling(TensorShape(8U, 1024U, 10U), TensorShape(8U, 3U, 3U, 256U),
+                                               PadStrideInfo(1, 1, 1, 1)) < 1e-5f,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_convolution_pooling(TensorShape(8U, 1026U, 11U), TensorShape(8U, 3U, 3U, 256U),
+                                               PadStrideInfo(1, 1, 0, 0)) < 1e-5f,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_convolution_pooling(TensorShape(8U, 2048U, 17U), TensorShape(8U, 3U, 3U, 256U),
+                                               PadStrideInfo(2, 2, 1, 1)) < 1e-5f,
+                       framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // FP32
+
+TEST_SUITE_END() // ConvolutionPoolingLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
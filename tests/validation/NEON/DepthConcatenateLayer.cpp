@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2024 Arm Limited.
+ * Copyright (c) 2017-2020, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,7 +22,9 @@
  * SOFTWARE.
  */
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEConcatenateLayer.h"
+#include "arm_compute/runtime/SubTensorViews.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "tests/NEON/Accessor.h"
@@ -80,6 +82,53 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
 // clang-format on
 // *INDENT-ON*
 
+/** Producers writing into concatenation views must fill the output as a concatenation would */
+TEST_CASE(ZeroCopyViews, framework::DatasetMode::ALL)
+{
+    const std::vector<TensorShape> input_shapes{ TensorShape(9U, 6U, 2U), TensorShape(9U, 6U, 3U) };
+    const TensorShape              output_shape(9U, 6U, 5U);
+    const ActivationLayerInfo      act_info(ActivationLayerInfo::ActivationFunction::RELU);
+
+    std::vector<Tensor> srcs(input_shapes.size());
+    std::vector<Tensor> acts(input_shapes.size());
+    Tensor              viewed_dst = create_tensor<Tensor>(output_shape, DataType::F32);
+    Tensor              concat_dst = create_tensor<Tensor>(output_shape, DataType::F32);
+    auto                views      = create_concatenate_views(&viewed_dst, input_shapes, Window::DimZ);
+
+    std::vector<NEActivationLayer> view_producers(input_shapes.size());
+    std::vector<NEActivationLayer> producers(input_shapes.size());
+    std::vector<const ITensor *>   concat_srcs;
+    for(size_t i = 0; i < input_shapes.size(); ++i)
+    {
+        srcs[i] = create_tensor<Tensor>(input_shapes[i], DataType::F32);
+        acts[i] = create_tensor<Tensor>(input_shapes[i], DataType::F32);
+        view_producers[i].configure(&srcs[i], &views[i], act_info);
+        producers[i].configure(&srcs[i], &acts[i], act_info);
+        concat_srcs.emplace_back(&acts[i]);
+    }
+    NEConcatenateLayer concat;
+    concat.configure(concat_srcs, &concat_dst, Window::DimZ);
+
+    viewed_dst.allocator()->allocate();
+    concat_dst.allocator()->allocate();
+    for(size_t i = 0; i < input_shapes.size(); ++i)
+    {
+        srcs[i].allocator()->allocate();
+        acts[i].allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(srcs[i]), i);
+        view_producers[i].run();
+        producers[i].run();
+    }
+    concat.run();
+
+    const auto *viewed_ptr = reinterpret_cast<const float *>(viewed_dst.buffer());
+    const auto *concat_ptr = reinterpret_cast<const float *>(concat_dst.buffer());
+    for(size_t i = 0; i < output_shape.total_size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(viewed_ptr[i] == concat_ptr[i], framework::LogLevel::ERRORS);
+    }
+}
+
 template <typename T>
 using NEDepthConcatenateLayerFixture = ConcatenateLayerValidationFixture<Tensor, ITensor, Accessor, NEConcatenateLayer, T>;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -531,6 +531,53 @@ FIXTURE_DATA_TEST_CASE_NEW(RunVariableWeightsLarge3x3, NEDepthwiseConvolutionLay
 {
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+TEST_CASE(FastMath, framework::DatasetMode::ALL)
+{
+    // Fast math only allows BF16 arithmetic, both functions must then agree within the BF16 precision
+    const TensorShape   src_shape(16U, 9U, 7U, 2U);
+    const TensorShape   weights_shape(16U, 3U, 3U);
+    const TensorShape   dst_shape(16U, 9U, 7U, 2U);
+    const PadStrideInfo conv_info(1, 1, 1, 1);
+
+    auto make_tensor = [](const TensorShape &shape)
+    {
+        return create_tensor<Tensor>(shape, DataType::F32, 1, QuantizationInfo(), DataLayout::NHWC);
+    };
+    Tensor src         = make_tensor(src_shape);
+    Tensor weights     = make_tensor(weights_shape);
+    Tensor biases      = make_tensor(TensorShape(16U));
+    Tensor dst         = make_tensor(dst_shape);
+    Tensor dst_precise = make_tensor(dst_shape);
+
+    ARM_COMPUTE_EXPECT(bool(NEDepthwiseConvolutionLayer::validate(src.info(), weights.info(), biases.info(), dst.info(), conv_info, 1, ActivationLayerInfo(),
+                                                                  Size2D(1U, 1U), true)),
+                       framework::LogLevel::ERRORS);
+
+    NEDepthwiseConvolutionLayer dwc_fast;
+    NEDepthwiseConvolutionLayer dwc_precise;
+    dwc_fast.configure(&src, &weights, &biases, &dst, conv_info, 1, ActivationLayerInfo(), Size2D(1U, 1U), true);
+    dwc_precise.configure(&src, &weights, &biases, &dst_precise, conv_info);
+
+    src.allocator()->allocate();
+    weights.allocator()->allocate();
+    biases.allocator()->allocate();
+    dst.allocator()->allocate();
+    dst_precise.allocator()->allocate();
+
+    library->fill_tensor_uniform(Accessor(src), 0, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(weights), 1, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(biases), 2, -1.f, 1.f);
+
+    dwc_fast.run();
+    dwc_precise.run();
+
+    const auto *dst_ptr         = reinterpret_cast<const float *>(dst.buffer());
+    const auto *dst_precise_ptr = reinterpret_cast<const float *>(dst_precise.buffer());
+    for(size_t i = 0; i < dst_shape.total_size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(dst_ptr[i] - dst_precise_ptr[i]) <= 0.05f, framework::LogLevel::ERRORS);
+    }
+}
 TEST_SUITE_END() // Optimized
 TEST_SUITE_END() // F32
 
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseSeparableConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConv2d.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Max relative difference between @ref NEDepthwiseSeparableConvolutionLayer and a depthwise convolution followed by
+ * a pointwise convolution
+ *
+ * The input, weights and biases are filled with the same random values for both. If @p num_inputs is not zero, the
+ * depthwise convolution reads the result of an expansion pointwise convolution of an input of @p num_inputs channels.
+ */
+float run_depthwise_separable(const TensorShape         &input_shape,
+                              const TensorShape         &depthwise_weights_shape,
+                              unsigned int               num_outputs,
+                              const PadStrideInfo       &pad_stride,
+                              const ActivationLayerInfo &act_info   = ActivationLayerInfo(),
+                              unsigned int               num_inputs = 0U)
+{
+    const bool            has_expansion = num_inputs != 0U;
+    const unsigned int    channels      = depthwise_weights_shape[0];
+    const TensorInfo      input_info(has_expansion ? TensorShape(input_shape).set(0, num_inputs) : input_shape, 1,
+                                     DataType::F32, DataLayout::NHWC);
+    const TensorInfo      ex_weights_info(TensorShape(num_inputs, 1U, 1U, input_shape[0]), 1, DataType::F32,
+                                          DataLayout::NHWC);
+    const TensorInfo      ex_biases_info(TensorShape(input_shape[0]), 1, DataType::F32);
+    const TensorInfo      dw_weights_info(depthwise_weights_shape, 1, DataType::F32, DataLayout::NHWC);
+    const TensorInfo      dw_biases_info(TensorShape(channels), 1, DataType::F32);
+    const TensorInfo      pw_weights_info(TensorShape(channels, 1U, 1U, num_outputs), 1, DataType::F32,
+                                          DataLayout::NHWC);
+    const TensorInfo      pw_biases_info(TensorShape(num_outputs), 1, DataType::F32);
+    const ConvolutionInfo dw_info{pad_stride, channels / input_shape[0], act_info, Size2D(1U, 1U)};
+    const Conv2dInfo      pw_info(PadStrideInfo(1, 1, 0, 0), Size2D(1U, 1U), act_info, false, 1U);
+
+    Tensor input, ex_weights, ex_biases, expanded, dw_weights, dw_biases, pw_weights, pw_biases, mid, reference, dst;
+    input.allocator()->init(input_info);
+    ex_weights.allocator()->init(ex_weights_info);
+    ex_biases.allocator()->init(ex_biases_info);
+    dw_weights.allocator()->init(dw_weights_info);
+    dw_biases.allocator()->init(dw_biases_info);
+    pw_weights.allocator()->init(pw_weights_info);
+    pw_biases.allocator()->init(pw_biases_info);
+
+    NEGEMMConv2d                         ex_func;
+    NEDepthwiseConvolutionLayer          dw_func;
+    NEGEMMConv2d                         pw_func;
+    NEDepthwiseSeparableConvolutionLayer fused_func;
+    if (has_expansion)
+    {
+        ex_func.configure(&input, &ex_weights, &ex_biases, &expanded, pw_info);
+        dw_func.configure(&expanded, &dw_weights, &dw_biases, &mid, pad_stride, dw_info.depth_multiplier, act_info);
+        fused_func.configure(&input, &ex_weights, &ex_biases, &dw_weights, &dw_biases, &pw_weights, &pw_biases, &dst,
+                             pw_info, dw_info, pw_info);
+    }
+    else
+    {
+        dw_func.configure(&input, &dw_weights, &dw_biases, &mid, pad_stride, dw_info.depth_multiplier, act_info);
+        fused_func.configure(&input, &dw_weights, &dw_biases, &pw_weights, &pw_biases, &dst, dw_info, pw_info);
+    }
+    pw_func.configure(&mid, &pw_weights, &pw_biases, &reference, pw_info);
+
+    for (Tensor *tensor : {&input, &dw_weights, &dw_biases, &pw_weights, &pw_biases, &mid, &reference, &dst})
+    {
+        tensor->allocator()->allocate();
+    }
+    if (has_expansion)
+    {
+        for (Tensor *tensor : {&ex_weights, &ex_biases, &expanded})
+        {
+            tensor->allocator()->allocate();
+        }
+    }
+
+    std::mt19937                          gen(library->seed());
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    for (Tensor *tensor : {&input, &ex_weights, &ex_biases, &dw_weights, &dw_biases, &pw_weights, &pw_biases})
+    {
+        if (tensor->buffer() == nullptr)
+        {
+            continue;
+        }
+        auto *data = reinterpret_cast<float *>(tensor->buffer());
+        for (size_t i = 0; i < tensor->info()->tensor_shape().total_size(); ++i)
+        {
+            data[i] = dist(gen);
+        }
+    }
+
+    if (has_expansion)
+    {
+        ex_func.run();
+    }
+    dw_func.run();
+    pw_func.run();
+    fused_func.run();
+
+    const auto *expected = reinterpret_cast<const float *>(reference.buffer());
+    const auto *actual   = reinterpret_cast<const float *>(dst.buffer());
+    float       max_diff = 0.f;
+    for (size_t i = 0; i < dst.info()->tensor_shape().total_size(); ++i)
+    {
+        max_diff = std::max(max_diff, std::abs(expected[i] - actual[i]) / std::max(1.f, std::abs(expected[i])));
+    }
+    return max_diff;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(DepthwiseSeparableConvolutionLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::F32, DataLayout::NHWC),
+                                   TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::F32, DataLayout::NHWC),
+                                   TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::F32, DataLayout::NHWC),     // 3x3 pointwise weights
+                                   TensorInfo(TensorShape(16U, 16U, 8U), 1, DataType::F32, DataLayout::NCHW),     // NCHW layout
+                                   TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::QASYMM8, DataLayout::NHWC), // Quantized data
+                                   TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::F32, DataLayout::NHWC),     // Mismatching output shape
+                                 }),
+               make("PointwiseWeightsInfo", { TensorInfo(TensorShape(8U, 1U, 1U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                              TensorInfo(TensorShape(8U, 1U, 1U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                              TensorInfo(TensorShape(8U, 3U, 3U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                              TensorInfo(TensorShape(1U, 1U, 8U, 4U), 1, DataType::F32, DataLayout::NCHW),
+                                              TensorInfo(TensorShape(8U, 1U, 1U, 4U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                                              TensorInfo(TensorShape(8U, 1U, 1U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                            }),
+               make("OutputInfo", { TensorInfo(TensorShape(4U, 16U, 16U), 1, DataType::F32, DataLayout::NHWC),
+                                    TensorInfo(),
+                                    TensorInfo(TensorShape(4U, 14U, 14U), 1, DataType::F32, DataLayout::NHWC),
+                                    TensorInfo(TensorShape(16U, 16U, 4U), 1, DataType::F32, DataLayout::NCHW),
+                                    TensorInfo(TensorShape(4U, 16U, 16U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                                    TensorInfo(TensorShape(4U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                  }),
+               make("Expected", { true, true, false, false, false, false })),
+               input_info, pw_weights_info, output_info, expected)
+{
+    const DataLayout      layout = input_info.data_layout();
+    const TensorInfo      dw_weights_info(layout == DataLayout::NHWC ? TensorShape(8U, 3U, 3U) : TensorShape(3U, 3U, 8U), 1, input_info.data_type(), layout);
+    const ConvolutionInfo dw_info{PadStrideInfo(1, 1, 1, 1), 1U, ActivationLayerInfo(), Size2D(1U, 1U)};
+    const Conv2dInfo      pw_info(PadStrideInfo(1, 1, 0, 0), Size2D(1U, 1U), ActivationLayerInfo(), false, 1U);
+    const Status          status = NEDepthwiseSeparableConvolutionLayer::validate(&input_info, &dw_weights_info, nullptr, &pw_weights_info, nullptr, &output_info, dw_info, pw_info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_SUITE(FP32)
+/** Test case for @ref NEDepthwiseSeparableConvolutionLayer on outputs computed in a single band.
+ *
+ * Checks performed in order:
+ * - The output matches a depthwise convolution followed by a pointwise convolution, with and without padding or
+ *   fused activation
+ * - Strided depthwise convolutions and depth multipliers are supported
+ */
+TEST_CASE(RunSingleBand, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_depthwise_separable(TensorShape(8U, 16U, 16U), TensorShape(8U, 3U, 3U), 12U,
+                                               PadStrideInfo(1, 1, 1, 1)) < 1e-5f,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_depthwise_separable(TensorShape(5U, 13U, 11U, 2U), TensorShape(5U, 3U, 3U), 7U,
+                                               PadStrideInfo(1, 1, 0, 0),
+                                               ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)) <
+                           1e-5f,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_depthwise_separable(TensorShape(4U, 17U, 15U), TensorShape(8U, 3U, 3U), 6U,
+                                               PadStrideInfo(2, 2, 1, 1)) < 1e-5f,
+                       framework::LogLevel::ERRORS);
+}
+
+/** Test case for @ref NEDepthwiseSeparableConvolutionLayer on outputs too large to stay in the cache.
+ *
+ * The rows of the depthwise output are larger than half the L2 cache, so the output is computed one row at a time.
+ * The first and last bands are padded, the inner bands share the same depthwise convolution.
+ *
+ * Checks performed in order:
+ * - The output matches a depthwise convolution followed by a pointwise convolution for padded, unpadded, strided
+ *   and batched inputs
+ */
+TEST_CASE(RunMultipleBands, framework::DatasetMode::NIGHTLY)
+{
+    ARM_COMPUTE_EXPECT(run_depthwise_separable(TensorShape(256U, 1024U, 10U), TensorShape(256U, 3U, 3U), 32U,
+                                               PadStrideInfo(1, 1, 1, 1)) < 1e-5f,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_depthwise_separable(TensorShape(256U, 1026U, 11U), TensorShape(256U, 3U, 3U), 32U,
+                                               PadStrideInfo(1, 1, 0, 0)) < 1e-5f,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_depthwise_separable(TensorShape(256U, 2048U, 17U, 2U), TensorShape(256U, 3U, 3U), 32U,
+                                               PadStrideInfo(2, 2, 1, 1),
+                                               ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)) <
+                           1e-5f,
+                       framework::LogLevel::ERRORS);
+}
+
+/** Test case for @ref NEDepthwiseSeparableConvolutionLayer on inverted residual blocks.
+ *
+ * Each band computes the expanded rows read by its depthwise convolution again, the halo rows included.
+ *
+ * Checks performed in order:
+ * - The output matches an expansion convolution followed by a depthwise and a pointwise convolutions on a single band
+ * - The output matches on multiple padded, unpadded and strided bands
+ */
+TEST_CASE(RunExpansion, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_depthwise_separable(TensorShape(24U, 16U, 16U), TensorShape(24U, 3U, 3U), 8U,
+                                               PadStrideInfo(1, 1, 1, 1),
+                                               ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                                               4U) < 1e-5f,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_depthwise_separable(TensorShape(256U, 1024U, 10U), TensorShape(256U, 3U, 3U), 32U,
+                                               PadStrideInfo(1, 1, 1, 1), ActivationLayerInfo(), 16U) < 1e-5f,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_depthwise_separable(TensorShape(256U, 1026U, 11U), TensorShape(256U, 3U, 3U), 32U,
+                                               PadStrideInfo(2, 2, 0, 0), ActivationLayerInfo(), 16U) < 1e-5f,
+                       framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // FP32
+
+TEST_SUITE_END() // DepthwiseSeparableConvolutionLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
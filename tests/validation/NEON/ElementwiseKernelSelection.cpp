@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -98,7 +98,7 @@ DATA_TEST_CASE(KernelSelection_elementwise_arithmetic, framework::DatasetMode::A
     cpu_isa.fp16 = (data_type == DataType::F16);
 
     const auto *selected_impl = CpuArithmeticKernel::get_implementation(
-                                    ElementwiseDataTypeISASelectorData{ data_type, cpu_isa, static_cast<int>(ArithmeticOperation::ADD) },
+                                    ElementwiseDataTypeISASelectorData{ data_type, cpu_isa, static_cast<int>(ArithmeticOperation::ADD), false },
                                     cpu::KernelSelectionType::Preferred);
 
     ARM_COMPUTE_ERROR_ON_NULLPTR(selected_impl);
@@ -141,7 +141,7 @@ DATA_TEST_CASE(KernelSelection_elementwise_comparison, framework::DatasetMode::A
     cpu_isa.fp16 = (data_type == DataType::F16);
 
     const auto *selected_impl = CpuComparisonKernel::get_implementation(
-                                    ElementwiseDataTypeISASelectorData{ data_type, cpu_isa, static_cast<int>(ComparisonOperation::Equal) },
+                                    ElementwiseDataTypeISASelectorData{ data_type, cpu_isa, static_cast<int>(ComparisonOperation::Equal), false },
                                     cpu::KernelSelectionType::Preferred);
 
     ARM_COMPUTE_ERROR_ON_NULLPTR(selected_impl);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -160,6 +160,27 @@ FIXTURE_DATA_TEST_CASE(RunSmallBroadcast, NEElementwiseMaxQuantizedBroadcastFixt
     // Validate output
     validate(Accessor(_target), _reference);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallSameQuantizationInfo, NEElementwiseMaxQuantizedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(combine(datasets::SmallShapes(),
+                                                                                                                       ElementwiseMaxQASYMM8Dataset),
+                                                                                                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo(3.f / 255.f, 12) })),
+                                                                                                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo(3.f / 255.f, 12) })),
+                                                                                                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo(3.f / 255.f, 12) })),
+                                                                                                                       OutOfPlaceDataSet))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallBroadcastSameQuantizationInfo, NEElementwiseMaxQuantizedBroadcastFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(datasets::SmallShapesBroadcast(),
+                                                               ElementwiseMaxQASYMM8Dataset),
+                                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo(3.f / 255.f, 12) })),
+                                               framework::dataset::make("QuantizationInfo", { QuantizationInfo(3.f / 255.f, 12) })),
+                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo(3.f / 255.f, 12) })),
+                               OutOfPlaceDataSet))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
 TEST_SUITE_END()
 
 TEST_SUITE(QASYMM8_SIGNED)
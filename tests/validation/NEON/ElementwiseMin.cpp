@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -169,6 +169,16 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEElementwiseMinQuantizedFixture<uint8_t>, fram
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32, 0.01);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallSameQuantizationInfo, NEElementwiseMinQuantizedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(combine(datasets::SmallShapes(),
+                                                                                                                       ElementwiseMinQASYMM8Dataset),
+                                                                                                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo(3.f / 255.f, 12) })),
+                                                                                                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo(3.f / 255.f, 12) })),
+                                                                                                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo(3.f / 255.f, 12) })),
+                                                                                                                       OutOfPlaceDataSet))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
 TEST_SUITE_END()
 
 TEST_SUITE(QASYMM8_SIGNED)
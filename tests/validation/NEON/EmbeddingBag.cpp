@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEEmbeddingBag.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Max relative difference between @ref NEEmbeddingBag and a scalar reference
+ *
+ * The bags are described by @p offsets into 3 * num_rows random indices. The last index is out of range and must
+ * gather a row of zeros.
+ */
+template <typename T>
+float run_embedding_bag(DataType                     data_type,
+                        unsigned int                 embedding_size,
+                        unsigned int                 num_rows,
+                        const std::vector<uint32_t> &offsets_values,
+                        bool                         weighted,
+                        ReductionOperation           op)
+{
+    const unsigned int     num_indices = 3 * num_rows;
+    const unsigned int     num_bags    = offsets_values.size();
+    const QuantizationInfo qinfo(0.05f, data_type == DataType::QASYMM8 ? 120 : -8);
+
+    Tensor table, indices, offsets, weights, output;
+    table.allocator()->init(TensorInfo(TensorShape(embedding_size, num_rows), 1, data_type, qinfo));
+    indices.allocator()->init(TensorInfo(TensorShape(num_indices), 1, DataType::U32));
+    offsets.allocator()->init(TensorInfo(TensorShape(num_bags), 1, DataType::U32));
+    weights.allocator()->init(TensorInfo(TensorShape(num_indices), 1, DataType::F32));
+
+    NEEmbeddingBag embedding_bag;
+    embedding_bag.configure(&table, &indices, &offsets, weighted ? &weights : nullptr, &output, op);
+
+    for (Tensor *tensor : {&table, &indices, &offsets, &weights, &output})
+    {
+        tensor->allocator()->allocate();
+    }
+
+    std::mt19937                            gen(library->seed());
+    std::uniform_real_distribution<float>   dist(-1.f, 1.f);
+    std::uniform_int_distribution<int>      qdist(data_type == DataType::QASYMM8 ? 0 : -128,
+                                                  data_type == DataType::QASYMM8 ? 255 : 127);
+    std::uniform_int_distribution<uint32_t> index_dist(0, num_rows - 1);
+
+    auto *table_ptr   = reinterpret_cast<T *>(table.buffer());
+    auto *indices_ptr = reinterpret_cast<uint32_t *>(indices.buffer());
+    auto *weights_ptr = reinterpret_cast<float *>(weights.buffer());
+    for (unsigned int i = 0; i < embedding_size * num_rows; ++i)
+    {
+        table_ptr[i] = is_data_type_quantized(data_type) ? static_cast<T>(qdist(gen)) : static_cast<T>(dist(gen));
+    }
+    for (unsigned int i = 0; i < num_indices; ++i)
+    {
+        indices_ptr[i] = index_dist(gen);
+        weights_ptr[i] = dist(gen);
+    }
+    indices_ptr[num_indices - 1] = num_rows;
+    std::copy(offsets_values.begin(), offsets_values.end(), reinterpret_cast<uint32_t *>(offsets.buffer()));
+
+    embedding_bag.run();
+
+    const UniformQuantizationInfo uqinfo = qinfo.uniform();
+    const auto table_value = [&](uint32_t row, unsigned int x)
+    {
+        const float v = static_cast<float>(table_ptr[row * embedding_size + x]);
+        return is_data_type_quantized(data_type) ? (v - uqinfo.offset) * uqinfo.scale : v;
+    };
+
+    const auto *actual   = reinterpret_cast<const float *>(output.buffer());
+    float       max_diff = 0.f;
+    for (unsigned int b = 0; b < num_bags; ++b)
+    {
+        const uint32_t begin = offsets_values[b];
+        const uint32_t end   = b + 1 < num_bags ? offsets_values[b + 1] : num_indices;
+        for (unsigned int x = 0; x < embedding_size; ++x)
+        {
+            float reference = 0.f;
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                if (indices_ptr[i] < num_rows)
+                {
+                    reference += table_value(indices_ptr[i], x) * (weighted ? weights_ptr[i] : 1.f);
+                }
+            }
+            if (op == ReductionOperation::MEAN_SUM && end > begin)
+            {
+                reference /= end - begin;
+            }
+            const float diff = std::abs(reference - actual[b * embedding_size + x]);
+            max_diff         = std::max(max_diff, diff / std::max(1.f, std::abs(reference)));
+        }
+    }
+    return max_diff;
+}
+
+constexpr float tolerance_f32 = 0.0001f;
+
+/** Bags of uneven sizes over 3 * 16 indices, the third one is empty */
+const std::vector<uint32_t> bag_offsets{0, 5, 17, 17, 30, 47};
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(EmbeddingBag)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("TableInfo", { TensorInfo(TensorShape(32U, 100U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(32U, 100U), 1, DataType::QASYMM8),
+                                   TensorInfo(TensorShape(32U, 100U), 1, DataType::S32),     // Unsupported table data type
+                                   TensorInfo(TensorShape(32U, 100U), 1, DataType::F32),     // Mismatching weights shape
+                                   TensorInfo(TensorShape(32U, 100U), 1, DataType::F32),     // Weights with mean pooling
+                                   TensorInfo(TensorShape(32U, 100U), 1, DataType::QASYMM8), // Quantized output
+                                 }),
+               make("WeightsInfo", { TensorInfo(TensorShape(40U), 1, DataType::F32),
+                                     TensorInfo(TensorShape(40U), 1, DataType::F32),
+                                     TensorInfo(TensorShape(40U), 1, DataType::F32),
+                                     TensorInfo(TensorShape(20U), 1, DataType::F32),
+                                     TensorInfo(TensorShape(40U), 1, DataType::F32),
+                                     TensorInfo(TensorShape(40U), 1, DataType::F32),
+                                   }),
+               make("OutputInfo", { TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(32U, 8U), 1, DataType::QASYMM8),
+                                  }),
+               make("Operation", { ReductionOperation::SUM, ReductionOperation::SUM, ReductionOperation::SUM,
+                                   ReductionOperation::SUM, ReductionOperation::MEAN_SUM, ReductionOperation::SUM }),
+               make("Expected", { true, true, false, false, false, false })),
+               table_info, weights_info, output_info, op, expected)
+{
+    const TensorInfo indices_info(TensorShape(40U), 1, DataType::S32);
+    const TensorInfo offsets_info(TensorShape(8U), 1, DataType::S32);
+    const Status     status = NEEmbeddingBag::validate(&table_info.clone()->set_is_resizable(false), &indices_info, &offsets_info,
+                                                       &weights_info.clone()->set_is_resizable(false),
+                                                       &output_info.clone()->set_is_resizable(false), op);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+/** Floating-point tables with embedding sizes that are and are not a multiple of the vector step.
+ *
+ * Checks performed in order:
+ * - Sum pooling matches the reference
+ * - Mean pooling matches the reference
+ * - Weighted sum pooling matches the reference
+ */
+TEST_CASE(RunFloat, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_embedding_bag<float>(DataType::F32, 64U, 16U, bag_offsets, false, ReductionOperation::SUM) <=
+                           tolerance_f32,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_embedding_bag<float>(DataType::F32, 37U, 16U, bag_offsets, false,
+                                                ReductionOperation::MEAN_SUM) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_embedding_bag<float>(DataType::F32, 37U, 16U, bag_offsets, true, ReductionOperation::SUM) <=
+                           tolerance_f32,
+                       framework::LogLevel::ERRORS);
+}
+
+/** Quantized tables dequantized on the fly.
+ *
+ * Checks performed in order:
+ * - QASYMM8 weighted sum pooling matches the reference
+ * - QASYMM8 mean pooling matches the reference
+ * - QASYMM8_SIGNED weighted sum pooling matches the reference
+ */
+TEST_CASE(RunQuantized, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_embedding_bag<uint8_t>(DataType::QASYMM8, 45U, 16U, bag_offsets, true,
+                                                  ReductionOperation::SUM) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_embedding_bag<uint8_t>(DataType::QASYMM8, 45U, 16U, bag_offsets, false,
+                                                  ReductionOperation::MEAN_SUM) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_embedding_bag<int8_t>(DataType::QASYMM8_SIGNED, 45U, 16U, bag_offsets, true,
+                                                 ReductionOperation::SUM) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // EmbeddingBag
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,10 @@
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/FullyConnectedLayerFixture.h"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 namespace arm_compute
 {
 namespace test
@@ -247,6 +251,152 @@ TEST_CASE(Quant8_Signed_Mult_gt_1, framework::DatasetMode::ALL)
     }
 }
 
+#ifdef __aarch64__
+/** Unit test for @ref NEFullyConnectedLayer with F32 src and QASYMM8_SIGNED weights
+ *
+ * Checks performed in order:
+ * - Each output is within the error of the symmetric quantization of the src from the F32 product
+ * - A second run with a src of a different range is quantized with its own scale
+ */
+TEST_CASE(DynamicQuantization, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int k            = 37;
+    constexpr unsigned int m            = 3;
+    constexpr unsigned int n            = 5;
+    constexpr float        weight_scale = 0.01f;
+
+    auto weight_info = TensorInfo(TensorShape(k, n), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(weight_scale, 0));
+    weight_info.set_are_values_constant(true);
+
+    auto src    = create_tensor<Tensor>(TensorInfo(TensorShape(k, m), 1, DataType::F32));
+    auto weight = create_tensor<Tensor>(weight_info);
+    auto bias   = create_tensor<Tensor>(TensorInfo(TensorShape(n), 1, DataType::F32));
+    auto dst    = create_tensor<Tensor>(TensorInfo(TensorShape(n, m), 1, DataType::F32));
+
+    NEFullyConnectedLayer fc;
+    ARM_COMPUTE_EXPECT(bool(NEFullyConnectedLayer::validate(src.info(), weight.info(), bias.info(), dst.info())), framework::LogLevel::ERRORS);
+    fc.configure(&src, &weight, &bias, &dst);
+
+    src.allocator()->allocate();
+    weight.allocator()->allocate();
+    bias.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    std::vector<int8_t> weight_values(k * n);
+    std::vector<float>  bias_values(n);
+    for(unsigned int i = 0; i < weight_values.size(); ++i)
+    {
+        weight_values[i] = static_cast<int8_t>(static_cast<int>((i * 37) % 255) - 127);
+    }
+    for(unsigned int i = 0; i < n; ++i)
+    {
+        bias_values[i] = 0.25f * static_cast<float>(i);
+    }
+    library->fill_static_values(Accessor(weight), weight_values);
+    library->fill_static_values(Accessor(bias), bias_values);
+
+    for(const float range : { 2.f, 50.f })
+    {
+        std::vector<float> src_values(k * m);
+        float              abs_max = 0.f;
+        for(unsigned int i = 0; i < src_values.size(); ++i)
+        {
+            src_values[i] = range * std::sin(static_cast<float>(i));
+            abs_max       = std::max(abs_max, std::abs(src_values[i]));
+        }
+        library->fill_static_values(Accessor(src), src_values);
+
+        fc.run();
+
+        // Each src value is off by at most half a quantization step
+        const float src_scale = abs_max / 127.f;
+        const auto *dst_ptr   = reinterpret_cast<const float *>(dst.buffer());
+        for(unsigned int row = 0; row < m; ++row)
+        {
+            for(unsigned int col = 0; col < n; ++col)
+            {
+                float expected  = bias_values[col];
+                float max_error = 1e-3f * range;
+                for(unsigned int i = 0; i < k; ++i)
+                {
+                    const float w = weight_scale * weight_values[col * k + i];
+                    expected += src_values[row * k + i] * w;
+                    max_error += 0.5f * src_scale * std::abs(w);
+                }
+                const float error = std::abs(dst_ptr[row * n + col] - expected);
+                ARM_COMPUTE_EXPECT(error <= max_error, framework::LogLevel::ERRORS);
+            }
+        }
+    }
+}
+#endif // __aarch64__
+
+/** Unit test for @ref NEFullyConnectedLayer with pruned F32 weights at batch 1
+ *
+ * Checks performed in order:
+ * - The layer is validated with block_sparse_weights set
+ * - Each output matches the dense product, for weights whose non-zero values are spread unevenly across the outputs
+ */
+TEST_CASE(BlockSparseWeights, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int k = 37;
+    constexpr unsigned int n = 29;
+
+    auto src    = create_tensor<Tensor>(TensorInfo(TensorShape(k), 1, DataType::F32));
+    auto weight = create_tensor<Tensor>(TensorInfo(TensorShape(k, n), 1, DataType::F32));
+    auto bias   = create_tensor<Tensor>(TensorInfo(TensorShape(n), 1, DataType::F32));
+    auto dst    = create_tensor<Tensor>(TensorInfo(TensorShape(n), 1, DataType::F32));
+
+    FullyConnectedLayerInfo fc_info{};
+    fc_info.block_sparse_weights = true;
+    fc_info.activation_info      = ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU);
+
+    NEFullyConnectedLayer fc;
+    ARM_COMPUTE_EXPECT(bool(NEFullyConnectedLayer::validate(src.info(), weight.info(), bias.info(), dst.info(), fc_info)), framework::LogLevel::ERRORS);
+    fc.configure(&src, &weight, &bias, &dst, fc_info);
+
+    src.allocator()->allocate();
+    weight.allocator()->allocate();
+    bias.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    // The first outputs keep all their weights, the others about one in ten
+    std::vector<float> src_values(k);
+    std::vector<float> weight_values(k * n, 0.f);
+    std::vector<float> bias_values(n);
+    for(unsigned int i = 0; i < k; ++i)
+    {
+        src_values[i] = std::sin(static_cast<float>(i));
+    }
+    for(unsigned int col = 0; col < n; ++col)
+    {
+        bias_values[col] = 0.1f * static_cast<float>(col % 5) - 0.2f;
+        for(unsigned int i = 0; i < k; ++i)
+        {
+            if(col < 3 || (i * 7 + col * 3) % 10 == 0)
+            {
+                weight_values[col * k + i] = std::cos(static_cast<float>(col * k + i));
+            }
+        }
+    }
+    library->fill_static_values(Accessor(src), src_values);
+    library->fill_static_values(Accessor(weight), weight_values);
+    library->fill_static_values(Accessor(bias), bias_values);
+
+    fc.run();
+
+    const auto *dst_ptr = reinterpret_cast<const float *>(dst.buffer());
+    for(unsigned int col = 0; col < n; ++col)
+    {
+        float expected = bias_values[col];
+        for(unsigned int i = 0; i < k; ++i)
+        {
+            expected += src_values[i] * weight_values[col * k + i];
+        }
+        ARM_COMPUTE_EXPECT(std::abs(dst_ptr[col] - std::max(expected, 0.f)) <= 1e-4f, framework::LogLevel::ERRORS);
+    }
+}
+
 // *INDENT-OFF*
 // clang-format off
 DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(zip(
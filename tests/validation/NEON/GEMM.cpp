@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,7 +23,11 @@
  */
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/utils/StringUtils.h"
+#include "arm_compute/runtime/experimental/RunWorkspace.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SingleThreadScheduler.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "src/core/helpers/MemoryHelpers.h"
@@ -32,6 +36,7 @@
 #include "src/cpu/kernels/CpuGemmTranspose1xWKernel.h"
 #include "src/cpu/operators/CpuDynamicGemm.h"
 #include "src/cpu/operators/CpuGemm.h"
+#include "src/cpu/operators/internal/CpuGroupedGemmAssemblyDispatch.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/NEON/Helper.h"
 #include "tests/PaddingCalculator.h"
@@ -46,6 +51,9 @@
 #include "tests/validation/fixtures/GEMMInterleave4x4Fixture.h"
 #include "tests/validation/fixtures/GEMMTranspose1xWFixture.h"
 
+#include <thread>
+#include <vector>
+
 namespace arm_compute
 {
 namespace test
@@ -204,6 +212,208 @@ TEST_CASE(MultipleExecutionWithConfigure, framework::DatasetMode::ALL)
     }
 }
 
+/** Test case for the description of a configured @ref NEGEMM.
+ *
+ * Checks performed in order:
+ * - The function is described by a single CpuGemm child
+ * - The assembly path reports the arm_gemm strategy, its configuration and the split dimension
+ * - The native path reports the kernels it runs
+ */
+TEST_CASE(Describe, framework::DatasetMode::ALL)
+{
+    auto lhs = create_tensor<Tensor>(TensorInfo(TensorShape(64U, 32U), 1, DataType::F32));
+    auto rhs = create_tensor<Tensor>(TensorInfo(TensorShape(48U, 64U), 1, DataType::F32));
+    auto dst = create_tensor<Tensor>(TensorInfo(TensorShape(48U, 32U), 1, DataType::F32));
+
+    NEGEMM gemm;
+    gemm.configure(&lhs, &rhs, nullptr, &dst, 1.f, 0.f, GEMMInfo{});
+
+    const OperatorDescription desc = gemm.describe();
+    ARM_COMPUTE_EXPECT(desc.name == "NEGEMM", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_ASSERT(desc.children.size() == 1);
+
+    const OperatorDescription &op = desc.children[0];
+    ARM_COMPUTE_EXPECT(op.name == "CpuGemm", framework::LogLevel::ERRORS);
+    if(op.method == "Assembly")
+    {
+        ARM_COMPUTE_ASSERT(!op.children.empty());
+        const OperatorDescription &asm_gemm = op.children[0];
+        ARM_COMPUTE_EXPECT(asm_gemm.name == "CpuGemmAssemblyDispatch", framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!asm_gemm.gemm_strategy.empty(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!asm_gemm.gemm_config.empty(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!asm_gemm.split_dimension.empty(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(asm_gemm.kernels.size() == 1, framework::LogLevel::ERRORS);
+    }
+    else
+    {
+        ARM_COMPUTE_EXPECT(!op.kernels.empty(), framework::LogLevel::ERRORS);
+    }
+}
+
+/** Test case for concurrent runs of a prepared @ref NEGEMM.
+ *
+ * Prepare the function once and run it from several threads at the same time, each with its own source,
+ * destination, workspace and scheduler.
+ *
+ * Checks performed in order:
+ * - Every concurrent run computes the same output as a sequential run on the same source
+ */
+TEST_CASE(ConcurrentRunsWithWorkspaces, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_workers    = 2;
+    constexpr unsigned int num_iterations = 8;
+    const auto             lhs_info       = TensorInfo(TensorShape(16U, 24U), 1, DataType::F32);
+    const auto             rhs_info       = TensorInfo(TensorShape(20U, 16U), 1, DataType::F32);
+    const auto             dst_info       = TensorInfo(TensorShape(20U, 24U), 1, DataType::F32);
+
+    auto lhs = create_tensor<Tensor>(lhs_info);
+    auto rhs = create_tensor<Tensor>(rhs_info);
+    auto dst = create_tensor<Tensor>(dst_info);
+
+    NEGEMM gemm;
+    gemm.configure(&lhs, &rhs, nullptr, &dst, 1.f, 0.f);
+    lhs.allocator()->allocate();
+    rhs.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(rhs), 0);
+    gemm.prepare();
+
+    std::vector<Tensor> srcs(num_workers);
+    std::vector<Tensor> expected(num_workers);
+    std::vector<Tensor> outputs(num_workers);
+    for(unsigned int i = 0; i < num_workers; ++i)
+    {
+        srcs[i].allocator()->init(lhs_info);
+        expected[i].allocator()->init(dst_info);
+        outputs[i].allocator()->init(dst_info);
+        srcs[i].allocator()->allocate();
+        expected[i].allocator()->allocate();
+        outputs[i].allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(srcs[i]), i + 1);
+
+        experimental::RunWorkspace workspace;
+        gemm.configure_workspace(workspace);
+        gemm.run(&srcs[i], &expected[i], workspace);
+    }
+
+    std::vector<std::thread> workers;
+    for(unsigned int i = 0; i < num_workers; ++i)
+    {
+        workers.emplace_back([&, i]()
+        {
+            SingleThreadScheduler      scheduler;
+            ScopedScheduler            scope(&scheduler);
+            experimental::RunWorkspace workspace;
+            gemm.configure_workspace(workspace);
+            for(unsigned int it = 0; it < num_iterations; ++it)
+            {
+                gemm.run(&srcs[i], &outputs[i], workspace);
+            }
+        });
+    }
+    for(auto &w : workers)
+    {
+        w.join();
+    }
+
+    for(unsigned int i = 0; i < num_workers; ++i)
+    {
+        for(size_t j = 0; j < dst_info.tensor_shape().total_size(); ++j)
+        {
+            ARM_COMPUTE_EXPECT(((float *)outputs[i].buffer())[j] == ((float *)expected[i].buffer())[j], framework::LogLevel::ERRORS);
+        }
+    }
+}
+
+/** Test case for @ref cpu::CpuGroupedGemmAssemblyDispatch.
+ *
+ * Configure one grouped operator over problems of different shapes, with and without bias.
+ *
+ * Checks performed in order:
+ * - The grouped operator is configured
+ * - Each output matches a naive GEMM of its own problem
+ */
+TEST_CASE(GroupedAssembly, framework::DatasetMode::ALL)
+{
+    // (M, N, K) of each problem
+    const std::vector<std::array<unsigned int, 3>> shapes{ { 5U, 7U, 8U }, { 3U, 12U, 16U }, { 9U, 4U, 33U }, { 1U, 24U, 5U } };
+
+    std::vector<TensorInfo> a_infos, b_infos, c_infos, d_infos;
+    for(const auto &s : shapes)
+    {
+        a_infos.emplace_back(TensorShape(s[2], s[0]), 1, DataType::F32);
+        b_infos.emplace_back(TensorShape(s[1], s[2]), 1, DataType::F32);
+        c_infos.emplace_back(TensorShape(s[1]), 1, DataType::F32);
+        d_infos.emplace_back(TensorShape(s[1], s[0]), 1, DataType::F32);
+    }
+
+    std::vector<cpu::AsmGemmProblem> problems(shapes.size());
+    for(size_t i = 0; i < shapes.size(); ++i)
+    {
+        // Every other problem has a bias
+        problems[i] = cpu::AsmGemmProblem{ &a_infos[i], &b_infos[i], (i % 2 == 0) ? &c_infos[i] : nullptr, &d_infos[i] };
+    }
+
+    cpu::CpuGroupedGemmAssemblyDispatch gemm;
+    gemm.configure(problems, cpu::AsmGemmInfo{});
+    ARM_COMPUTE_EXPECT(gemm.is_configured(), framework::LogLevel::ERRORS);
+
+    std::vector<Tensor> a(shapes.size()), b(shapes.size()), c(shapes.size()), d(shapes.size());
+    ITensorPack run_pack;
+    ITensorPack prep_pack;
+    for(size_t i = 0; i < shapes.size(); ++i)
+    {
+        a[i].allocator()->init(a_infos[i]);
+        b[i].allocator()->init(b_infos[i]);
+        c[i].allocator()->init(c_infos[i]);
+        d[i].allocator()->init(d_infos[i]);
+        a[i].allocator()->allocate();
+        b[i].allocator()->allocate();
+        c[i].allocator()->allocate();
+        d[i].allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(a[i]), 3 * i);
+        library->fill_tensor_uniform(Accessor(b[i]), 3 * i + 1);
+        library->fill_tensor_uniform(Accessor(c[i]), 3 * i + 2);
+
+        run_pack.add_const_tensor(cpu::CpuGroupedGemmAssemblyDispatch::tensor_id(i, TensorType::ACL_SRC_0), &a[i]);
+        run_pack.add_const_tensor(cpu::CpuGroupedGemmAssemblyDispatch::tensor_id(i, TensorType::ACL_SRC_1), &b[i]);
+        prep_pack.add_const_tensor(cpu::CpuGroupedGemmAssemblyDispatch::tensor_id(i, TensorType::ACL_SRC_1), &b[i]);
+        if(problems[i].c != nullptr)
+        {
+            run_pack.add_const_tensor(cpu::CpuGroupedGemmAssemblyDispatch::tensor_id(i, TensorType::ACL_SRC_2), &c[i]);
+        }
+        run_pack.add_tensor(cpu::CpuGroupedGemmAssemblyDispatch::tensor_id(i, TensorType::ACL_DST), &d[i]);
+    }
+
+    auto mg = MemoryGroup{};
+    auto ws = manage_workspace<Tensor>(gemm.workspace(), mg, run_pack, prep_pack);
+    gemm.prepare(prep_pack);
+    gemm.run(run_pack);
+
+    for(size_t i = 0; i < shapes.size(); ++i)
+    {
+        const unsigned int M = shapes[i][0];
+        const unsigned int N = shapes[i][1];
+        const unsigned int K = shapes[i][2];
+        const auto        *pa = reinterpret_cast<const float *>(a[i].buffer());
+        const auto        *pb = reinterpret_cast<const float *>(b[i].buffer());
+        const auto        *pc = reinterpret_cast<const float *>(c[i].buffer());
+        const auto        *pd = reinterpret_cast<const float *>(d[i].buffer());
+        for(unsigned int m = 0; m < M; ++m)
+        {
+            for(unsigned int n = 0; n < N; ++n)
+            {
+                float expected = (problems[i].c != nullptr) ? pc[n] : 0.f;
+                for(unsigned int k = 0; k < K; ++k)
+                {
+                    expected += pa[m * K + k] * pb[k * N + n];
+                }
+                ARM_COMPUTE_EXPECT(std::abs(pd[m * N + n] - expected) <= 0.001f * std::max(1.f, std::abs(expected)), framework::LogLevel::ERRORS);
+            }
+        }
+    }
+}
+
 // *INDENT-OFF*
 // clang-format off
 DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
@@ -479,6 +689,196 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMFixture<float>, framework::DatasetMode::N
     validate(Accessor(_target), _reference, tolerance_f);
 }
 
+/** Test case for @ref NEGEMM::export_pretransposed_weights and @ref NEGEMM::import_pretransposed_weights
+ *
+ * Export the pretransposed weights of one function and import them in a second function whose weights are never
+ * filled, then try to import them in a function with a different problem size.
+ *
+ * Checks performed in order:
+ * - The weights are exported
+ * - The import is accepted
+ * - Both functions compute the same output
+ * - The import is rejected for a different problem size
+ */
+TEST_CASE(PretransposedWeightsExportImport, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int m = 13;
+    constexpr unsigned int k = 64;
+    constexpr unsigned int n = 48;
+
+    auto make_gemm = [](Tensor &a, Tensor &b, Tensor &d, NEGEMM &gemm, unsigned int n_cols)
+    {
+        a.allocator()->init(TensorInfo(TensorShape(k, m), 1, DataType::F32));
+        b.allocator()->init(TensorInfo(TensorShape(n_cols, k), 1, DataType::F32));
+        d.allocator()->init(TensorInfo(TensorShape(n_cols, m), 1, DataType::F32));
+        gemm.configure(&a, &b, nullptr, &d, 1.f, 0.f, GEMMInfo(false, false, true /* reshape_b_only_on_first_run */));
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        d.allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(a), 0);
+    };
+
+    Tensor a0, b0, d0;
+    NEGEMM gemm0;
+    make_gemm(a0, b0, d0, gemm0, n);
+    library->fill_tensor_uniform(Accessor(b0), 1);
+
+    std::vector<uint8_t> blob;
+    const Status         exported = gemm0.export_pretransposed_weights(blob);
+    ARM_COMPUTE_EXPECT(bool(exported), framework::LogLevel::ERRORS);
+    if(!bool(exported))
+    {
+        return;
+    }
+    gemm0.run();
+
+    Tensor a1, b1, d1;
+    NEGEMM gemm1;
+    make_gemm(a1, b1, d1, gemm1, n);
+    library->fill_tensor_value(Accessor(b1), 0.f);
+    ARM_COMPUTE_EXPECT(bool(gemm1.import_pretransposed_weights(blob)), framework::LogLevel::ERRORS);
+    gemm1.run();
+
+    const auto *pd0 = reinterpret_cast<const float *>(d0.buffer());
+    const auto *pd1 = reinterpret_cast<const float *>(d1.buffer());
+    for(unsigned int i = 0; i < m * n; ++i)
+    {
+        ARM_COMPUTE_EXPECT(pd0[i] == pd1[i], framework::LogLevel::ERRORS);
+    }
+
+    Tensor a2, b2, d2;
+    NEGEMM gemm2;
+    make_gemm(a2, b2, d2, gemm2, n + 8);
+    ARM_COMPUTE_EXPECT(!bool(gemm2.import_pretransposed_weights(blob)), framework::LogLevel::ERRORS);
+
+    // A truncated blob is rejected as well
+    blob.pop_back();
+    Tensor a3, b3, d3;
+    NEGEMM gemm3;
+    make_gemm(a3, b3, d3, gemm3, n);
+    ARM_COMPUTE_EXPECT(!bool(gemm3.import_pretransposed_weights(blob)), framework::LogLevel::ERRORS);
+}
+
+/** Test case for @ref NEGEMM with 2:4 structured-sparse weights
+ *
+ * Prune B so that each column keeps at most 2 values out of every 4 rows, then run it with the sparse_weights hint
+ * and without it.
+ *
+ * Checks performed in order:
+ * - The sparse path is selected
+ * - Both functions compute the same output, for a single row and for several rows of A
+ */
+TEST_CASE(SparseWeights, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int k = 37;
+    constexpr unsigned int n = 21;
+
+    for(unsigned int m : { 1U, 13U })
+    {
+        auto make_gemm = [m](Tensor &a, Tensor &b, Tensor &bias, Tensor &d, NEGEMM &gemm, bool sparse)
+        {
+            a.allocator()->init(TensorInfo(TensorShape(k, m), 1, DataType::F32));
+            b.allocator()->init(TensorInfo(TensorShape(n, k), 1, DataType::F32));
+            bias.allocator()->init(TensorInfo(TensorShape(n), 1, DataType::F32));
+            d.allocator()->init(TensorInfo(TensorShape(n, m), 1, DataType::F32));
+            GEMMInfo gemm_info(false, false, true /* reshape_b_only_on_first_run */);
+            gemm_info.set_sparse_weights(sparse);
+            gemm.configure(&a, &b, &bias, &d, 0.5f, 1.f, gemm_info);
+            a.allocator()->allocate();
+            b.allocator()->allocate();
+            bias.allocator()->allocate();
+            d.allocator()->allocate();
+            library->fill_tensor_uniform(Accessor(a), 0);
+            library->fill_tensor_uniform(Accessor(b), 1);
+            library->fill_tensor_uniform(Accessor(bias), 2);
+
+            // Column col keeps the rows (col + g) % 4 and (col + g + 1) % 4 of each group g of 4 rows
+            auto *pb = reinterpret_cast<float *>(b.buffer());
+            for(unsigned int row = 0; row < k; ++row)
+            {
+                for(unsigned int col = 0; col < n; ++col)
+                {
+                    const unsigned int keep = (col + row / 4) % 4;
+                    if(row % 4 != keep && row % 4 != (keep + 1) % 4)
+                    {
+                        pb[row * n + col] = 0.f;
+                    }
+                }
+            }
+        };
+
+        Tensor a0, b0, bias0, d0;
+        NEGEMM gemm0;
+        make_gemm(a0, b0, bias0, d0, gemm0, true);
+        ARM_COMPUTE_EXPECT(gemm0.describe().children[0].method == "Sparse2:4", framework::LogLevel::ERRORS);
+        gemm0.run();
+
+        Tensor a1, b1, bias1, d1;
+        NEGEMM gemm1;
+        make_gemm(a1, b1, bias1, d1, gemm1, false);
+        gemm1.run();
+
+        const auto *pd0 = reinterpret_cast<const float *>(d0.buffer());
+        const auto *pd1 = reinterpret_cast<const float *>(d1.buffer());
+        for(unsigned int i = 0; i < m * n; ++i)
+        {
+            ARM_COMPUTE_EXPECT(std::abs(pd0[i] - pd1[i]) <= 0.001f, framework::LogLevel::ERRORS);
+        }
+    }
+}
+
+/** Test case for @ref NEGEMM splitting K between the threads
+ *
+ * A single row of A times a few columns of B leaves most threads without work unless K is split, the result with
+ * several threads is compared with the one computed by a single thread.
+ *
+ * Checks performed in order:
+ * - Both functions compute the same output, with the bias added and the activation applied once
+ */
+TEST_CASE(SplitK, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int m = 1;
+    constexpr unsigned int k = 2048;
+    constexpr unsigned int n = 24;
+
+    auto run_gemm = [](Tensor &d, unsigned int num_threads)
+    {
+        const unsigned int old_num_threads = NEScheduler::get().num_threads();
+        NEScheduler::get().set_num_threads(num_threads);
+
+        Tensor a, b, bias;
+        a.allocator()->init(TensorInfo(TensorShape(k, m), 1, DataType::F32));
+        b.allocator()->init(TensorInfo(TensorShape(n, k), 1, DataType::F32));
+        bias.allocator()->init(TensorInfo(TensorShape(n), 1, DataType::F32));
+        d.allocator()->init(TensorInfo(TensorShape(n, m), 1, DataType::F32));
+        GEMMInfo gemm_info(false, false, true /* reshape_b_only_on_first_run */);
+        gemm_info.set_activation_info(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f));
+        NEGEMM gemm;
+        gemm.configure(&a, &b, &bias, &d, 1.f, 1.f, gemm_info);
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        bias.allocator()->allocate();
+        d.allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(a), 0);
+        library->fill_tensor_uniform(Accessor(b), 1);
+        library->fill_tensor_uniform(Accessor(bias), 2);
+        gemm.run();
+
+        NEScheduler::get().set_num_threads(old_num_threads);
+    };
+
+    Tensor d0, d1;
+    run_gemm(d0, 1);
+    run_gemm(d1, 4);
+
+    const auto *pd0 = reinterpret_cast<const float *>(d0.buffer());
+    const auto *pd1 = reinterpret_cast<const float *>(d1.buffer());
+    for(unsigned int i = 0; i < m * n; ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(pd0[i] - pd1[i]) <= 0.001f * std::max(1.f, std::abs(pd0[i])), framework::LogLevel::ERRORS);
+    }
+}
+
 #if defined(__aarch64__)
 TEST_SUITE(DynamicShape)
 DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, combine(
@@ -546,6 +946,67 @@ FIXTURE_DATA_TEST_CASE(RunSmallConstantRHS, NEDynamicGEMMFixtureRunTwice<float>,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f);
 }
+/** Test case for the reuse of the packed RHS in @ref cpu::CpuDynamicGemm.
+ *
+ * Configure once with dynamic a and d and constant b and c, then run with a different number of rows in a each time.
+ *
+ * Checks performed in order:
+ * - Every run matches a naive GEMM computed on the same inputs
+ */
+TEST_CASE(RunVaryingRowsConstantRHS, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int k = 19;
+    constexpr unsigned int n = 23;
+
+    Tensor a, b, c, d;
+    b.allocator()->init(TensorInfo(TensorShape(n, k), 1, DataType::F32));
+    c.allocator()->init(TensorInfo(TensorShape(n, 1U), 1, DataType::F32));
+    a.allocator()->init(TensorInfo(TensorShape(), 1, DataType::F32));
+    d.allocator()->init(TensorInfo(TensorShape(), 1, DataType::F32));
+    a.info()->set_dynamic(true);
+    d.info()->set_dynamic(true);
+
+    NEGEMM gemm;
+    gemm.configure(&a, &b, &c, &d, 1.f, 1.f, GEMMInfo(false, false, true /* reshape_b_only_on_first_run */));
+
+    b.allocator()->allocate();
+    c.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(b), 0);
+    library->fill_tensor_uniform(Accessor(c), 1);
+
+    const auto *pb = reinterpret_cast<const float *>(b.buffer());
+    const auto *pc = reinterpret_cast<const float *>(c.buffer());
+
+    for(unsigned int m : { 1U, 7U, 3U, 16U, 7U })
+    {
+        a.allocator()->free();
+        d.allocator()->free();
+        a.info()->set_tensor_shape(TensorShape(k, m));
+        d.info()->set_tensor_shape(TensorShape(n, m));
+        a.allocator()->allocate();
+        d.allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(a), 2 + m);
+
+        gemm.run();
+
+        const auto *pa       = reinterpret_cast<const float *>(a.buffer());
+        const auto *pd       = reinterpret_cast<const float *>(d.buffer());
+        float       max_diff = 0.f;
+        for(unsigned int y = 0; y < m; ++y)
+        {
+            for(unsigned int x = 0; x < n; ++x)
+            {
+                float expected = pc[x];
+                for(unsigned int z = 0; z < k; ++z)
+                {
+                    expected += pa[y * k + z] * pb[z * n + x];
+                }
+                max_diff = std::max(max_diff, std::abs(expected - pd[y * n + x]));
+            }
+        }
+        ARM_COMPUTE_EXPECT(max_diff < 1e-4f, framework::LogLevel::ERRORS);
+    }
+}
 FIXTURE_DATA_TEST_CASE(RunLarge, NEDynamicGEMMFixture<float>, framework::DatasetMode::NIGHTLY,
         combine(
             datasets::LargeGEMMVectorBiasDataset(),
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -286,6 +286,76 @@ TEST_CASE(MultipleExecutionWithConfigure, framework::DatasetMode::ALL)
     }
 }
 
+/** Test case for packed 4-bit weights in @ref NEGEMMLowpMatrixMultiplyCore
+ *
+ * Checks performed in order:
+ * - The packed weights compute the same output as the same weights stored as 8-bit values, with both a per-tensor
+ *   and a per-channel quantization
+ */
+TEST_CASE(PackedInt4Weights, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int m = 5;
+    constexpr unsigned int k = 24;
+    constexpr unsigned int n = 34;
+
+    std::vector<float> per_channel_scales(n);
+    for(unsigned int i = 0; i < n; ++i)
+    {
+        per_channel_scales[i] = 0.01f * static_cast<float>(i + 1);
+    }
+
+    for(const bool per_channel : { false, true })
+    {
+        const QuantizationInfo b_qinfo = per_channel ? QuantizationInfo(per_channel_scales) : QuantizationInfo(0.5f, 3);
+        const DataType         b_dt    = per_channel ? DataType::QSYMM8_PER_CHANNEL : DataType::QASYMM8_SIGNED;
+
+        auto a          = create_tensor<Tensor>(TensorInfo(TensorShape(k, m), 1, DataType::QASYMM8_SIGNED, QuantizationInfo(0.25f, -7)));
+        auto b_packed   = create_tensor<Tensor>(TensorInfo(TensorShape(n / 2, k), 1, DataType::U8, b_qinfo));
+        auto b          = create_tensor<Tensor>(TensorInfo(TensorShape(n, k), 1, b_dt, b_qinfo));
+        auto dst_packed = create_tensor<Tensor>(TensorInfo(TensorShape(n, m), 1, DataType::S32));
+        auto dst        = create_tensor<Tensor>(TensorInfo(TensorShape(n, m), 1, DataType::S32));
+
+        NEGEMMLowpMatrixMultiplyCore gemm_packed;
+        NEGEMMLowpMatrixMultiplyCore gemm;
+        ARM_COMPUTE_EXPECT(bool(NEGEMMLowpMatrixMultiplyCore::validate(a.info(), b_packed.info(), nullptr, dst_packed.info())), framework::LogLevel::ERRORS);
+        gemm_packed.configure(&a, &b_packed, nullptr, &dst_packed);
+        gemm.configure(&a, &b, nullptr, &dst);
+
+        a.allocator()->allocate();
+        b_packed.allocator()->allocate();
+        b.allocator()->allocate();
+        dst_packed.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        std::vector<int8_t>  a_values(k * m);
+        std::vector<int8_t>  b_values(n * k);
+        std::vector<uint8_t> b_packed_values(n * k / 2);
+        for(unsigned int i = 0; i < a_values.size(); ++i)
+        {
+            a_values[i] = static_cast<int8_t>(static_cast<int>((i * 53) % 256) - 128);
+        }
+        for(unsigned int i = 0; i < b_values.size(); ++i)
+        {
+            b_values[i] = static_cast<int8_t>(static_cast<int>((i * 11) % 16) - 8);
+        }
+        for(unsigned int i = 0; i < b_packed_values.size(); ++i)
+        {
+            b_packed_values[i] = static_cast<uint8_t>((b_values[2 * i] & 0xF) | ((b_values[2 * i + 1] & 0xF) << 4));
+        }
+        library->fill_static_values(Accessor(a), a_values);
+        library->fill_static_values(Accessor(b), b_values);
+        library->fill_static_values(Accessor(b_packed), b_packed_values);
+
+        gemm_packed.run();
+        gemm.run();
+
+        for(size_t i = 0; i < dst.info()->tensor_shape().total_size(); ++i)
+        {
+            ARM_COMPUTE_EXPECT(((int32_t *)dst_packed.buffer())[i] == ((int32_t *)dst.buffer())[i], framework::LogLevel::ERRORS);
+        }
+    }
+}
+
 FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMLowpMatrixMultiplyCoreFixture, framework::DatasetMode::ALL, datasets::SmallGEMMLowpDataset())
 {
     // Validate output
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NELSTMLayer.h"
+#include "arm_compute/runtime/NEON/functions/NELSTMSequenceLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Max relative difference between the output of @ref NELSTMSequenceLayer and the outputs of @ref NELSTMLayer run
+ * once per timestep
+ *
+ * The input, the weights and the initial states are filled with the same random values for both.
+ */
+float run_sequence(unsigned int input_size,
+                   unsigned int num_units,
+                   unsigned int batch_size,
+                   unsigned int num_timesteps,
+                   bool         cifg,
+                   bool         peephole,
+                   bool         projection,
+                   bool         layer_norm)
+{
+    const unsigned int output_size = projection ? num_units / 2 : num_units;
+    const unsigned int num_gates   = cifg ? 3 : 4;
+    const TensorInfo   input_weights_info(TensorShape(input_size, num_units), 1, DataType::F32);
+    const TensorInfo   recurrent_weights_info(TensorShape(output_size, num_units), 1, DataType::F32);
+    const TensorInfo   vector_info(TensorShape(num_units), 1, DataType::F32);
+    const TensorInfo   cell_state_info(TensorShape(num_units, batch_size), 1, DataType::F32);
+    const TensorInfo   output_state_info(TensorShape(output_size, batch_size), 1, DataType::F32);
+
+    // Gate weights and biases in the order [input, forget, cell, output]
+    Tensor input_weights[4], recurrent_weights[4], biases[4], peephole_weights[3], layer_norm_weights[4];
+    Tensor projection_weights, projection_bias;
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        input_weights[i].allocator()->init(input_weights_info);
+        recurrent_weights[i].allocator()->init(recurrent_weights_info);
+        biases[i].allocator()->init(vector_info);
+        layer_norm_weights[i].allocator()->init(vector_info);
+    }
+    for (Tensor &tensor : peephole_weights)
+    {
+        tensor.allocator()->init(vector_info);
+    }
+    projection_weights.allocator()->init(TensorInfo(TensorShape(num_units, output_size), 1, DataType::F32));
+    projection_bias.allocator()->init(TensorInfo(TensorShape(output_size), 1, DataType::F32));
+
+    LSTMParams<ITensor> lstm_params;
+    if (!cifg)
+    {
+        lstm_params.set_cifg_params(&input_weights[0], &recurrent_weights[0], peephole ? &peephole_weights[0] : nullptr,
+                                    &biases[0]);
+    }
+    if (peephole)
+    {
+        lstm_params.set_peephole_params(&peephole_weights[1], &peephole_weights[2]);
+    }
+    if (projection)
+    {
+        lstm_params.set_projection_params(&projection_weights, &projection_bias);
+    }
+    if (layer_norm)
+    {
+        lstm_params.set_layer_normalization_params(cifg ? nullptr : &layer_norm_weights[0], &layer_norm_weights[1],
+                                                   &layer_norm_weights[2], &layer_norm_weights[3]);
+    }
+    const ActivationLayerInfo act_info(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f);
+
+    // One call per timestep, the states are carried over by copying the outputs back to the inputs
+    Tensor step_input, output_state_in, cell_state_in, scratch, output_state_out, cell_state_out, step_output;
+    step_input.allocator()->init(TensorInfo(TensorShape(input_size, batch_size), 1, DataType::F32));
+    output_state_in.allocator()->init(output_state_info);
+    cell_state_in.allocator()->init(cell_state_info);
+    scratch.allocator()->init(TensorInfo(TensorShape(num_gates * num_units, batch_size), 1, DataType::F32));
+
+    NELSTMLayer step_func;
+    step_func.configure(&step_input, &input_weights[1], &input_weights[2], &input_weights[3], &recurrent_weights[1],
+                        &recurrent_weights[2], &recurrent_weights[3], &biases[1], &biases[2], &biases[3],
+                        &output_state_in, &cell_state_in, &scratch, &output_state_out, &cell_state_out, &step_output,
+                        lstm_params, act_info, 0.f, 0.f);
+
+    Tensor input, seq_output_state_in, seq_cell_state_in, seq_output_state_out, seq_cell_state_out, output;
+    input.allocator()->init(TensorInfo(TensorShape(input_size, batch_size, num_timesteps), 1, DataType::F32));
+    seq_output_state_in.allocator()->init(output_state_info);
+    seq_cell_state_in.allocator()->init(cell_state_info);
+    seq_output_state_out.allocator()->init(output_state_info);
+    seq_cell_state_out.allocator()->init(cell_state_info);
+    output.allocator()->init(TensorInfo(TensorShape(output_size, batch_size, num_timesteps), 1, DataType::F32));
+
+    NELSTMSequenceLayer seq_func;
+    seq_func.configure(&input, &input_weights[1], &input_weights[2], &input_weights[3], &recurrent_weights[1],
+                       &recurrent_weights[2], &recurrent_weights[3], &biases[1], &biases[2], &biases[3],
+                       &seq_output_state_in, &seq_cell_state_in, &seq_output_state_out, &seq_cell_state_out, &output,
+                       lstm_params, act_info, 0.f, 0.f);
+
+    std::vector<Tensor *> filled{&input, &output_state_in, &cell_state_in, &projection_weights, &projection_bias};
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        filled.insert(filled.end(), {&input_weights[i], &recurrent_weights[i], &biases[i], &layer_norm_weights[i]});
+    }
+    filled.insert(filled.end(), {&peephole_weights[0], &peephole_weights[1], &peephole_weights[2]});
+    for (Tensor *tensor : filled)
+    {
+        tensor->allocator()->allocate();
+    }
+    for (Tensor *tensor : {&step_input, &scratch, &output_state_out, &cell_state_out, &step_output,
+                           &seq_output_state_in, &seq_cell_state_in, &seq_output_state_out, &seq_cell_state_out,
+                           &output})
+    {
+        tensor->allocator()->allocate();
+    }
+
+    std::mt19937                          gen(library->seed());
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    for (Tensor *tensor : filled)
+    {
+        auto *data = reinterpret_cast<float *>(tensor->buffer());
+        for (size_t i = 0; i < tensor->info()->tensor_shape().total_size(); ++i)
+        {
+            data[i] = dist(gen);
+        }
+    }
+    std::memcpy(seq_output_state_in.buffer(), output_state_in.buffer(), output_state_info.total_size());
+    std::memcpy(seq_cell_state_in.buffer(), cell_state_in.buffer(), cell_state_info.total_size());
+
+    seq_func.run();
+
+    const size_t         step_input_size  = step_input.info()->total_size();
+    const size_t         step_output_size = step_output.info()->total_size();
+    std::vector<uint8_t> reference(output.info()->total_size());
+    for (unsigned int t = 0; t < num_timesteps; ++t)
+    {
+        std::memcpy(step_input.buffer(), input.buffer() + t * step_input_size, step_input_size);
+        step_func.run();
+        std::memcpy(reference.data() + t * step_output_size, step_output.buffer(), step_output_size);
+        std::memcpy(output_state_in.buffer(), output_state_out.buffer(), output_state_info.total_size());
+        std::memcpy(cell_state_in.buffer(), cell_state_out.buffer(), cell_state_info.total_size());
+    }
+
+    const auto max_rel_diff = [](const float *expected, const float *actual, size_t num_elements)
+    {
+        float max_diff = 0.f;
+        for (size_t i = 0; i < num_elements; ++i)
+        {
+            max_diff = std::max(max_diff, std::abs(expected[i] - actual[i]) / std::max(1.f, std::abs(expected[i])));
+        }
+        return max_diff;
+    };
+    return std::max({max_rel_diff(reinterpret_cast<const float *>(reference.data()),
+                                  reinterpret_cast<const float *>(output.buffer()),
+                                  output.info()->tensor_shape().total_size()),
+                     max_rel_diff(reinterpret_cast<const float *>(output_state_out.buffer()),
+                                  reinterpret_cast<const float *>(seq_output_state_out.buffer()),
+                                  output_state_info.tensor_shape().total_size()),
+                     max_rel_diff(reinterpret_cast<const float *>(cell_state_out.buffer()),
+                                  reinterpret_cast<const float *>(seq_cell_state_out.buffer()),
+                                  cell_state_info.tensor_shape().total_size())});
+}
+
+constexpr float tolerance_f32 = 0.0001f;
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(LSTMSequenceLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(8U, 2U, 5U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(8U, 2U, 5U), 1, DataType::U8),  // Wrong data type
+                                   TensorInfo(TensorShape(9U, 2U, 5U), 1, DataType::F32), // Wrong input size
+                                   TensorInfo(TensorShape(8U, 3U, 5U), 1, DataType::F32), // Wrong batch size
+                                   TensorInfo(TensorShape(8U, 2U, 5U), 1, DataType::F32), // Wrong output size
+                                 }),
+               make("OutputInfo", { TensorInfo(TensorShape(16U, 2U, 5U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(16U, 2U, 5U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(16U, 2U, 5U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(16U, 3U, 5U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(16U, 2U, 4U), 1, DataType::F32),
+                                  }),
+               make("Expected", { true, false, false, false, false })),
+               input_info, output_info, expected)
+{
+    const TensorInfo input_weights_info(TensorShape(8U, 16U), 1, DataType::F32);
+    const TensorInfo recurrent_weights_info(TensorShape(16U, 16U), 1, DataType::F32);
+    const TensorInfo bias_info(TensorShape(16U), 1, DataType::F32);
+    const TensorInfo state_info(TensorShape(16U, 2U), 1, DataType::F32);
+
+    LSTMParams<ITensorInfo> lstm_params_info;
+    lstm_params_info.set_cifg_params(&input_weights_info, &recurrent_weights_info, nullptr, &bias_info);
+
+    const Status status = NELSTMSequenceLayer::validate(&input_info.clone()->set_is_resizable(false), &input_weights_info, &input_weights_info, &input_weights_info,
+                                                        &recurrent_weights_info, &recurrent_weights_info, &recurrent_weights_info, &bias_info, &bias_info, &bias_info,
+                                                        &state_info, &state_info, &state_info, &state_info, &output_info.clone()->set_is_resizable(false),
+                                                        lstm_params_info, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f));
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+/** Basic sequence against one call of @ref NELSTMLayer per timestep.
+ *
+ * Checks performed in order:
+ * - The output of every timestep and the final states match
+ */
+TEST_CASE(RunBasic, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_sequence(8U, 16U, 2U, 5U, false, false, false, false) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+}
+
+/** CIFG, peephole connections and projection.
+ *
+ * Checks performed in order:
+ * - The outputs match without CIFG
+ * - The outputs match with CIFG
+ */
+TEST_CASE(RunPeepholeProjection, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_sequence(8U, 16U, 3U, 4U, false, true, true, false) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_sequence(8U, 16U, 3U, 4U, true, true, true, false) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+}
+
+/** Layer normalization, where the biases are added after the normalization instead of by the input GEMM.
+ *
+ * Checks performed in order:
+ * - The outputs match with layer normalization only
+ * - The outputs match with every option enabled
+ */
+TEST_CASE(RunLayerNorm, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_sequence(7U, 13U, 2U, 3U, false, false, false, true) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_sequence(7U, 13U, 2U, 3U, true, true, true, true) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // LSTMSequenceLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
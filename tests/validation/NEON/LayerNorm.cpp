@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NELayerNorm.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Max relative difference between @ref NELayerNorm and a two-pass fp32 reference
+ *
+ * The input, the residual, gamma and beta are filled with random values. The input is offset so that the mean of the
+ * rows is far from zero, which is where a single-pass sum of squares would lose precision.
+ */
+float run_layer_norm(const TensorShape &shape, bool has_residual, bool has_affine, bool use_rms_norm, bool in_place)
+{
+    constexpr float  epsilon = 1e-5f;
+    const TensorInfo info(shape, 1, DataType::F32);
+    const TensorInfo vector_info(TensorShape(shape[0]), 1, DataType::F32);
+
+    Tensor input, residual, gamma, beta, output;
+    input.allocator()->init(info);
+    residual.allocator()->init(info);
+    gamma.allocator()->init(vector_info);
+    beta.allocator()->init(vector_info);
+    output.allocator()->init(info);
+
+    NELayerNorm layer_norm;
+    layer_norm.configure(&input, has_residual ? &residual : nullptr, has_affine ? &gamma : nullptr,
+                         has_affine ? &beta : nullptr, in_place ? &input : &output, epsilon, use_rms_norm);
+
+    for (Tensor *tensor : {&input, &residual, &gamma, &beta, &output})
+    {
+        tensor->allocator()->allocate();
+    }
+
+    std::mt19937                          gen(library->seed());
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    for (Tensor *tensor : {&input, &residual, &gamma, &beta})
+    {
+        auto *data = reinterpret_cast<float *>(tensor->buffer());
+        for (size_t i = 0; i < tensor->info()->tensor_shape().total_size(); ++i)
+        {
+            data[i] = dist(gen) + (tensor == &input ? 100.f : 0.f);
+        }
+    }
+
+    // Reference computed before the run, which may overwrite the input
+    const size_t       row_len  = shape[0];
+    const size_t       num_rows = shape.total_size_upper(1);
+    const auto        *src      = reinterpret_cast<const float *>(input.buffer());
+    const auto        *res      = reinterpret_cast<const float *>(residual.buffer());
+    const auto        *g        = reinterpret_cast<const float *>(gamma.buffer());
+    const auto        *b        = reinterpret_cast<const float *>(beta.buffer());
+    std::vector<float> reference(row_len * num_rows);
+    for (size_t r = 0; r < num_rows; ++r)
+    {
+        std::vector<double> x(row_len);
+        for (size_t i = 0; i < row_len; ++i)
+        {
+            x[i] = src[r * row_len + i] + (has_residual ? res[r * row_len + i] : 0.f);
+        }
+        double mean = 0.0;
+        if (!use_rms_norm)
+        {
+            for (double v : x)
+            {
+                mean += v;
+            }
+            mean /= row_len;
+        }
+        double var = 0.0;
+        for (double v : x)
+        {
+            var += (v - mean) * (v - mean);
+        }
+        var /= row_len;
+        for (size_t i = 0; i < row_len; ++i)
+        {
+            double y = (x[i] - mean) / std::sqrt(var + epsilon);
+            if (has_affine)
+            {
+                y = y * g[i] + b[i];
+            }
+            reference[r * row_len + i] = static_cast<float>(y);
+        }
+    }
+
+    layer_norm.run();
+
+    const auto *actual   = reinterpret_cast<const float *>(in_place ? input.buffer() : output.buffer());
+    float       max_diff = 0.f;
+    for (size_t i = 0; i < reference.size(); ++i)
+    {
+        max_diff = std::max(max_diff, std::abs(reference[i] - actual[i]) / std::max(1.f, std::abs(reference[i])));
+    }
+    return max_diff;
+}
+
+constexpr float tolerance_f32 = 0.0001f;
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(LayerNorm)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(32U, 8U), 1, DataType::QASYMM8), // Unsupported data type
+                                   TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),     // Mismatching residual shape
+                                   TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),     // Mismatching gamma size
+                                   TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),     // Mismatching output shape
+                                 }),
+               make("ResidualInfo", { TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),
+                                      TensorInfo(TensorShape(32U, 8U), 1, DataType::QASYMM8),
+                                      TensorInfo(TensorShape(32U, 4U), 1, DataType::F32),
+                                      TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),
+                                      TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),
+                                    }),
+               make("GammaInfo", { TensorInfo(TensorShape(32U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(32U), 1, DataType::QASYMM8),
+                                   TensorInfo(TensorShape(32U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(8U), 1, DataType::F32),
+                                   TensorInfo(TensorShape(32U), 1, DataType::F32),
+                                 }),
+               make("OutputInfo", { TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(32U, 8U), 1, DataType::QASYMM8),
+                                    TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(32U, 8U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(16U, 8U), 1, DataType::F32),
+                                  }),
+               make("Expected", { true, false, false, false, false })),
+               input_info, residual_info, gamma_info, output_info, expected)
+{
+    const Status status = NELayerNorm::validate(&input_info.clone()->set_is_resizable(false), &residual_info.clone()->set_is_resizable(false),
+                                                &gamma_info.clone()->set_is_resizable(false), &gamma_info.clone()->set_is_resizable(false),
+                                                &output_info.clone()->set_is_resizable(false));
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+/** Layer normalization of rows whose length is and is not a multiple of the vector step.
+ *
+ * Checks performed in order:
+ * - Plain normalization matches the reference
+ * - Normalization with gamma and beta matches the reference
+ * - Normalization of a 3D tensor matches the reference
+ */
+TEST_CASE(RunLayerNorm, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_layer_norm(TensorShape(64U, 7U), false, false, false, false) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_layer_norm(TensorShape(77U, 5U), false, true, false, false) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_layer_norm(TensorShape(13U, 3U, 2U), false, true, false, false) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+}
+
+/** RMS normalization.
+ *
+ * Checks performed in order:
+ * - Plain RMS normalization matches the reference
+ * - RMS normalization with gamma and beta matches the reference
+ */
+TEST_CASE(RunRMSNorm, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_layer_norm(TensorShape(64U, 7U), false, false, true, false) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_layer_norm(TensorShape(77U, 5U), false, true, true, false) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+}
+
+/** Fused residual addition, where the destination holds the sum between the two passes.
+ *
+ * Checks performed in order:
+ * - Layer normalization with a residual matches the reference
+ * - RMS normalization with a residual matches the reference
+ * - In-place layer normalization with a residual matches the reference
+ */
+TEST_CASE(RunResidual, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_layer_norm(TensorShape(77U, 5U), true, true, false, false) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_layer_norm(TensorShape(77U, 5U), true, true, true, false) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_layer_norm(TensorShape(40U, 6U), true, false, false, true) <= tolerance_f32,
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // LayerNorm
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
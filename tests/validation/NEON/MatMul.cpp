@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,10 +29,14 @@
 #include "tests/framework/Asserts.h"
 #include "tests/framework/datasets/Datasets.h"
 #include "tests/framework/Macros.h"
+#include "tests/Globals.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/validation/fixtures/MatMulFixture.h"
 #include "tests/validation/Validation.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace arm_compute
 {
 namespace test
@@ -41,6 +45,157 @@ namespace validation
 {
 using framework::dataset::make;
 
+namespace
+{
+/** Max absolute difference between an incremental NEMatMul and a naive product over the valid rhs rows
+ *
+ * The rhs holds @p capacity rows of @p depth elements per head, like a key/value cache. With @p adj_rhs it is used as
+ * keys (dst = lhs * rhs^T over the valid rows), otherwise as values (dst = lhs * rhs with lhs restricted to the valid
+ * columns). The function is configured once and run for several valid row counts.
+ */
+float run_incremental_matmul(bool adj_rhs, unsigned int capacity, unsigned int depth, unsigned int m, unsigned int heads)
+{
+    Tensor lhs, rhs, dst;
+    lhs.allocator()->init(TensorInfo(TensorShape(adj_rhs ? depth : capacity, m, heads), 1, DataType::F32));
+    rhs.allocator()->init(TensorInfo(TensorShape(depth, capacity, heads), 1, DataType::F32));
+    dst.allocator()->init(TensorInfo(TensorShape(adj_rhs ? capacity : depth, m, heads), 1, DataType::F32));
+    lhs.info()->set_are_values_constant(false);
+    rhs.info()->set_are_values_constant(false);
+
+    const auto matmul_info = MatMulInfo().adj_rhs(adj_rhs).incremental(true);
+    NEMatMul   matmul;
+    matmul.configure(&lhs, &rhs, &dst, matmul_info, CpuMatMulSettings());
+
+    lhs.allocator()->allocate();
+    rhs.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(lhs), 0);
+    library->fill_tensor_uniform(Accessor(rhs), 1);
+
+    const auto *pl = reinterpret_cast<const float *>(lhs.buffer());
+    const auto *pr = reinterpret_cast<const float *>(rhs.buffer());
+    const auto *pd = reinterpret_cast<const float *>(dst.buffer());
+
+    const unsigned int lhs_width = lhs.info()->dimension(0);
+    const unsigned int dst_width = dst.info()->dimension(0);
+
+    float max_diff = 0.f;
+    for(unsigned int rows : { 1U, 63U, 64U, 65U, capacity / 2 + 1, capacity })
+    {
+        matmul.set_valid_rhs_rows(rows);
+        matmul.run();
+
+        for(unsigned int h = 0; h < heads; ++h)
+        {
+            for(unsigned int y = 0; y < m; ++y)
+            {
+                for(unsigned int x = 0; x < (adj_rhs ? rows : depth); ++x)
+                {
+                    float expected = 0.f;
+                    for(unsigned int k = 0; k < (adj_rhs ? depth : rows); ++k)
+                    {
+                        const float r = adj_rhs ? pr[(h * capacity + x) * depth + k] : pr[(h * capacity + k) * depth + x];
+                        expected += pl[(h * m + y) * lhs_width + k] * r;
+                    }
+                    max_diff = std::max(max_diff, std::abs(expected - pd[(h * m + y) * dst_width + x]));
+                }
+            }
+        }
+    }
+    return max_diff;
+}
+
+/** Max difference between NEMatMul with the epilogue of a gated feed-forward layer and a naive evaluation of it
+ *
+ * The epilogue adds a bias row to the product, applies @p act, multiplies by a gate and adds a residual. For quantized
+ * outputs the difference is returned in quantization steps.
+ */
+float run_matmul_epilogue(const ActivationLayerInfo &act, bool adj_rhs, DataType dst_dt)
+{
+    const unsigned int     m = 5, k = 19, n = 37, batches = 2;
+    const QuantizationInfo qinfo(0.05f, 128);
+
+    Tensor lhs, rhs, bias, gate, residual, dst;
+    lhs.allocator()->init(TensorInfo(TensorShape(k, m, batches), 1, DataType::F32));
+    rhs.allocator()->init(TensorInfo(adj_rhs ? TensorShape(k, n, batches) : TensorShape(n, k, batches), 1, DataType::F32));
+    bias.allocator()->init(TensorInfo(TensorShape(n), 1, DataType::F32));
+    gate.allocator()->init(TensorInfo(TensorShape(n, m, batches), 1, DataType::F32));
+    residual.allocator()->init(TensorInfo(TensorShape(n, m, batches), 1, DataType::F32));
+    dst.allocator()->init(TensorInfo(TensorShape(n, m, batches), 1, dst_dt, dst_dt == DataType::F32 ? QuantizationInfo() : qinfo));
+    lhs.info()->set_are_values_constant(false);
+    rhs.info()->set_are_values_constant(false);
+
+    const ElementwiseChainInfo epilogue{ ElementwiseChainOp(ElementwiseChainOpType::ADD, 0), ElementwiseChainOp(act),
+                                         ElementwiseChainOp(ElementwiseChainOpType::MUL, 1),
+                                         ElementwiseChainOp(ElementwiseChainOpType::ADD, 2) };
+    NEMatMul matmul;
+    matmul.configure(&lhs, &rhs, { &bias, &gate, &residual }, &dst, MatMulInfo().adj_rhs(adj_rhs), CpuMatMulSettings(), epilogue);
+
+    for(Tensor *t : { &lhs, &rhs, &bias, &gate, &residual, &dst })
+    {
+        t->allocator()->allocate();
+    }
+    library->fill_tensor_uniform(Accessor(lhs), 0);
+    library->fill_tensor_uniform(Accessor(rhs), 1);
+    library->fill_tensor_uniform(Accessor(bias), 2);
+    library->fill_tensor_uniform(Accessor(gate), 3);
+    library->fill_tensor_uniform(Accessor(residual), 4);
+
+    matmul.run();
+
+    const auto *pl = reinterpret_cast<const float *>(lhs.buffer());
+    const auto *pr = reinterpret_cast<const float *>(rhs.buffer());
+    const auto *pb = reinterpret_cast<const float *>(bias.buffer());
+    const auto *pg = reinterpret_cast<const float *>(gate.buffer());
+    const auto *pe = reinterpret_cast<const float *>(residual.buffer());
+
+    float max_diff = 0.f;
+    for(unsigned int b = 0; b < batches; ++b)
+    {
+        for(unsigned int y = 0; y < m; ++y)
+        {
+            for(unsigned int x = 0; x < n; ++x)
+            {
+                float v = pb[x];
+                for(unsigned int i = 0; i < k; ++i)
+                {
+                    const float r = adj_rhs ? pr[(b * n + x) * k + i] : pr[(b * k + i) * n + x];
+                    v += pl[(b * m + y) * k + i] * r;
+                }
+                switch(act.activation())
+                {
+                    case ActivationLayerInfo::ActivationFunction::RELU:
+                        v = std::max(0.f, v);
+                        break;
+                    case ActivationLayerInfo::ActivationFunction::SWISH:
+                        v = v / (1.f + std::exp(-act.a() * v));
+                        break;
+                    case ActivationLayerInfo::ActivationFunction::GELU:
+                        v = v * 0.5f * (1.f + std::erf(v / std::sqrt(2.f)));
+                        break;
+                    default:
+                        break;
+                }
+                const size_t idx = (b * m + y) * n + x;
+                v                = v * pg[idx] + pe[idx];
+
+                float diff = 0.f;
+                if(dst_dt == DataType::QASYMM8)
+                {
+                    diff = std::abs(static_cast<int>(quantize_qasymm8(v, qinfo)) - static_cast<int>(dst.buffer()[idx]));
+                }
+                else
+                {
+                    diff = std::abs(v - reinterpret_cast<const float *>(dst.buffer())[idx]);
+                }
+                max_diff = std::max(max_diff, diff);
+            }
+        }
+    }
+    return max_diff;
+}
+} // namespace
+
 TEST_SUITE(NEON)
 TEST_SUITE(MatMul)
 
@@ -253,6 +408,59 @@ make("NumberOfRuns", 5)))
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+
+/** Test case for the incremental mode of @ref NEMatMul.
+ *
+ * Uses valid row counts around the block size with a single lhs row per head (decode).
+ *
+ * Checks performed in order:
+ * - The scores against a growing key cache (adj_rhs) match a naive product over the valid rows
+ * - The weighted sum of a growing value cache matches a naive product over the valid rows
+ */
+TEST_CASE(RunIncremental, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_incremental_matmul(true, 200U, 16U, 1U, 4U) < 0.001f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_incremental_matmul(false, 200U, 16U, 1U, 4U) < 0.001f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_incremental_matmul(false, 130U, 24U, 3U, 2U) < 0.001f, framework::LogLevel::ERRORS);
+}
+
+/** Test case for the epilogue of @ref NEMatMul.
+ *
+ * Uses the bias, activation, gate and residual of a gated feed-forward layer, with a ReLU the assembly kernels apply
+ * themselves and activations left to the elementwise chain.
+ *
+ * Checks performed in order:
+ * - The output matches a naive product followed by the epilogue, with and without adj_rhs
+ * - The quantized output is at most one quantization step away from quantizing the naive evaluation
+ * - Incremental mode is rejected
+ */
+TEST_CASE(RunEpilogue, framework::DatasetMode::ALL)
+{
+    using ActFunction = ActivationLayerInfo::ActivationFunction;
+
+    const ActivationLayerInfo relu(ActFunction::RELU);
+    const ActivationLayerInfo swish(ActFunction::SWISH, 1.f);
+
+    ARM_COMPUTE_EXPECT(run_matmul_epilogue(relu, false, DataType::F32) < 0.001f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_matmul_epilogue(swish, false, DataType::F32) < 0.001f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_matmul_epilogue(swish, true, DataType::F32) < 0.001f, framework::LogLevel::ERRORS);
+#ifdef __aarch64__
+    const ActivationLayerInfo gelu(ActFunction::GELU);
+    ARM_COMPUTE_EXPECT(run_matmul_epilogue(gelu, true, DataType::F32) < 0.001f, framework::LogLevel::ERRORS);
+#endif // __aarch64__
+    ARM_COMPUTE_EXPECT(run_matmul_epilogue(swish, false, DataType::QASYMM8) <= 1.f, framework::LogLevel::ERRORS);
+
+    TensorInfo lhs_info(TensorShape(8U, 4U), 1, DataType::F32);
+    TensorInfo rhs_info(TensorShape(16U, 8U), 1, DataType::F32);
+    lhs_info.set_are_values_constant(false);
+    rhs_info.set_are_values_constant(false);
+    const TensorInfo           dst_info(TensorShape(16U, 4U), 1, DataType::F32);
+    const ElementwiseChainInfo epilogue{ ElementwiseChainOp(swish) };
+    ARM_COMPUTE_EXPECT(bool(NEMatMul::validate(&lhs_info, &rhs_info, {}, &dst_info, MatMulInfo(), CpuMatMulSettings(), epilogue)),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!bool(NEMatMul::validate(&lhs_info, &rhs_info, {}, &dst_info, MatMulInfo().incremental(true), CpuMatMulSettings(), epilogue)),
+                       framework::LogLevel::ERRORS);
+}
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_BF16
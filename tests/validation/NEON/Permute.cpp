@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2024 Arm Limited.
+ * Copyright (c) 2018-2020, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,9 +67,17 @@ const auto PermuteVectors4 = framework::dataset::make("PermutationVector",
     PermutationVector(3U, 0U, 2U, 1U),
     PermutationVector(0U, 3U, 2U, 1U)
 });
+const auto PermuteVectors5 = framework::dataset::make("PermutationVector",
+{
+    PermutationVector(0U, 2U, 1U, 3U, 4U),
+    PermutationVector(3U, 1U, 4U, 0U, 2U),
+    PermutationVector(4U, 3U, 2U, 1U, 0U),
+    PermutationVector(1U, 0U, 3U, 2U, 4U)
+});
 const auto PermuteVectors         = concat(concat(PermuteVectors2, PermuteVectors3), PermuteVectors4);
 const auto PermuteParametersSmall = concat(concat(datasets::Small2DShapes(), datasets::Small3DShapes()), datasets::Small4DShapes()) * PermuteVectors;
 const auto PermuteParametersLarge = datasets::Large4DShapes() * PermuteVectors;
+const auto PermuteParameters5D    = concat(datasets::Tiny5dShapes(), datasets::Small5dShapes()) * PermuteVectors5;
 } // namespace
 TEST_SUITE(NEON)
 TEST_SUITE(Permute)
@@ -143,6 +151,12 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEPermuteFixture<uint8_t>, framework::DatasetMo
     // Validate output
     validate(Accessor(_target), _reference);
 }
+FIXTURE_DATA_TEST_CASE(RunSmall5D, NEPermuteFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       PermuteParameters5D * framework::dataset::make("DataType", DataType::U8))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
 TEST_SUITE_END()
 
 TEST_SUITE(U16)
@@ -158,6 +172,12 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEPermuteFixture<uint16_t>, framework::DatasetM
     // Validate output
     validate(Accessor(_target), _reference);
 }
+FIXTURE_DATA_TEST_CASE(RunSmall5D, NEPermuteFixture<uint16_t>, framework::DatasetMode::PRECOMMIT,
+                       PermuteParameters5D * framework::dataset::make("DataType", DataType::U16))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
 TEST_SUITE_END()
 
 TEST_SUITE(U32)
@@ -173,6 +193,12 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEPermuteFixture<uint32_t>, framework::DatasetM
     // Validate output
     validate(Accessor(_target), _reference);
 }
+FIXTURE_DATA_TEST_CASE(RunSmall5D, NEPermuteFixture<uint32_t>, framework::DatasetMode::PRECOMMIT,
+                       PermuteParameters5D * framework::dataset::make("DataType", DataType::U32))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
 TEST_SUITE_END()
 
 #ifdef ARM_COMPUTE_ENABLE_FP16
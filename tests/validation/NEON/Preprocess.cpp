@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEPreprocess.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+const std::vector<float> mean_rgb{123.675f, 116.28f, 103.53f};
+const std::vector<float> std_rgb{58.395f, 57.12f, 57.375f};
+
+TensorInfo image_info(const TensorShape &shape, DataType data_type, const QuantizationInfo &qinfo = QuantizationInfo())
+{
+    TensorInfo info(shape, 1, data_type, qinfo);
+    info.set_data_layout(DataLayout::NHWC);
+    return info;
+}
+
+/** RGB value in [0, 255] of the pixel (x, y) of a random frame of the given format */
+std::array<double, 3>
+reference_rgb(const std::vector<uint8_t> &frame, Format format, int width, int height, int x, int y)
+{
+    if (format == Format::RGB888 || format == Format::RGBA8888)
+    {
+        const int channels = format == Format::RGB888 ? 3 : 4;
+        const int idx      = (y * width + x) * channels;
+        return {{static_cast<double>(frame[idx]), static_cast<double>(frame[idx + 1]),
+                 static_cast<double>(frame[idx + 2])}};
+    }
+    const int    uv_idx = (height + y / 2) * width + (x & ~1);
+    const double luma   = frame[y * width + x];
+    const double u      = frame[uv_idx + (format == Format::NV21 ? 1 : 0)] - 128.0;
+    const double v      = frame[uv_idx + (format == Format::NV21 ? 0 : 1)] - 128.0;
+    const auto   clamp  = [](double value) { return std::min(std::max(value, 0.0), 255.0); };
+    return {{clamp(luma + 1.402 * v), clamp(luma - 0.344136 * u - 0.714136 * v), clamp(luma + 1.772 * u)}};
+}
+
+/** Max absolute difference between @ref NEPreprocess and a scalar reference
+ *
+ * The difference is measured in the units of the destination, so in quantized steps for the quantized types.
+ */
+double run_preprocess(Format format, DataType dst_dt, int width, int height, const TensorShape &dst_shape, bool bgr)
+{
+    const bool        is_yuv    = format == Format::NV12 || format == Format::NV21;
+    const TensorShape src_shape = is_yuv ? TensorShape(width, height * 3 / 2)
+                                         : TensorShape(format == Format::RGB888 ? 3U : 4U, width, height);
+    const QuantizationInfo dst_qinfo =
+        is_data_type_quantized_asymmetric(dst_dt) ? QuantizationInfo(0.02f, dst_dt == DataType::QASYMM8 ? 128 : 0)
+                                                  : QuantizationInfo();
+
+    Tensor src = create_tensor<Tensor>(src_shape, DataType::U8);
+    Tensor dst = create_tensor<Tensor>(dst_shape, dst_dt, 1, dst_qinfo, DataLayout::NHWC);
+
+    NEPreprocess preprocess;
+    preprocess.configure(&src, &dst, format, mean_rgb, std_rgb, bgr);
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    std::mt19937                       gen(library->seed());
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t>               frame(src_shape.total_size());
+    for (auto &value : frame)
+    {
+        value = static_cast<uint8_t>(dist(gen));
+    }
+    std::copy(frame.begin(), frame.end(), src.buffer());
+
+    preprocess.run();
+
+    const double wr    = static_cast<double>(width) / dst_shape[1];
+    const double hr    = static_cast<double>(height) / dst_shape[2];
+    const auto   qinfo = dst_qinfo.uniform();
+
+    double max_diff = 0.0;
+    for (unsigned int oy = 0; oy < dst_shape[2]; ++oy)
+    {
+        const double y0 = oy * hr;
+        const double y1 = std::min((oy + 1) * hr, static_cast<double>(height));
+        for (unsigned int ox = 0; ox < dst_shape[1]; ++ox)
+        {
+            const double x0 = ox * wr;
+            const double x1 = std::min((ox + 1) * wr, static_cast<double>(width));
+
+            std::array<double, 3> sum{{0.0, 0.0, 0.0}};
+            for (int iy = static_cast<int>(std::floor(y0)); iy < static_cast<int>(std::ceil(y1)); ++iy)
+            {
+                const double wy = std::min(iy + 1.0, y1) - std::max(static_cast<double>(iy), y0);
+                for (int ix = static_cast<int>(std::floor(x0)); ix < static_cast<int>(std::ceil(x1)); ++ix)
+                {
+                    const double wx  = std::min(ix + 1.0, x1) - std::max(static_cast<double>(ix), x0);
+                    const auto   rgb = reference_rgb(frame, format, width, height, ix, iy);
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        sum[c] += wx * wy * rgb[c];
+                    }
+                }
+            }
+
+            for (int c = 0; c < 3; ++c)
+            {
+                const double avg      = sum[bgr ? 2 - c : c] / ((x1 - x0) * (y1 - y0));
+                double       expected = (avg - mean_rgb[c]) / std_rgb[c];
+
+                const size_t dst_idx = (oy * dst_shape[1] + ox) * 3 + c;
+                double       actual  = 0.0;
+                switch (dst_dt)
+                {
+                    case DataType::QASYMM8:
+                        expected = std::max(0.0, std::min(255.0, std::round(expected / qinfo.scale + qinfo.offset)));
+                        actual   = reinterpret_cast<const uint8_t *>(dst.buffer())[dst_idx];
+                        break;
+                    case DataType::QASYMM8_SIGNED:
+                        expected = std::max(-128.0, std::min(127.0, std::round(expected / qinfo.scale + qinfo.offset)));
+                        actual   = reinterpret_cast<const int8_t *>(dst.buffer())[dst_idx];
+                        break;
+                    default:
+                        actual = reinterpret_cast<const float *>(dst.buffer())[dst_idx];
+                        break;
+                }
+                max_diff = std::max(max_diff, std::abs(expected - actual));
+            }
+        }
+    }
+    return max_diff;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Preprocess)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(64U, 72U), 1, DataType::U8),
+                                   TensorInfo(TensorShape(4U, 64U, 48U), 1, DataType::U8),
+                                   TensorInfo(TensorShape(63U, 72U), 1, DataType::U8),      // Odd width
+                                   TensorInfo(TensorShape(64U, 70U), 1, DataType::U8),      // Missing chroma rows
+                                   TensorInfo(TensorShape(3U, 64U, 48U), 1, DataType::U8),  // Channels do not match the format
+                                   TensorInfo(TensorShape(64U, 72U), 1, DataType::U8),      // Unsupported format
+                                   TensorInfo(TensorShape(64U, 72U), 1, DataType::U8),      // Destination is not RGB
+                                   TensorInfo(TensorShape(64U, 72U), 1, DataType::F32),     // Unsupported source type
+                                 }),
+               make("OutputInfo", { image_info(TensorShape(3U, 16U, 12U), DataType::F32),
+                                    image_info(TensorShape(3U, 16U, 12U), DataType::QASYMM8, QuantizationInfo(0.02f, 128)),
+                                    image_info(TensorShape(3U, 16U, 12U), DataType::F32),
+                                    image_info(TensorShape(3U, 16U, 12U), DataType::F32),
+                                    image_info(TensorShape(3U, 16U, 12U), DataType::F32),
+                                    image_info(TensorShape(3U, 16U, 12U), DataType::F32),
+                                    image_info(TensorShape(4U, 16U, 12U), DataType::F32),
+                                    image_info(TensorShape(3U, 16U, 12U), DataType::F32),
+                                  }),
+               make("Format", { Format::NV12, Format::RGBA8888, Format::NV21, Format::NV12, Format::RGBA8888, Format::YUYV422, Format::NV12, Format::NV12 }),
+               make("Expected", { true, true, false, false, false, false, false, false })),
+               input_info, output_info, format, expected)
+{
+    const Status status = NEPreprocess::validate(&input_info.clone()->set_is_resizable(false),
+                                                 &output_info.clone()->set_is_resizable(false), format, mean_rgb, std_rgb);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_CASE(NV12ToF32, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_preprocess(Format::NV12, DataType::F32, 258, 132, TensorShape(3U, 23U, 17U), false) < 1e-3,
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(NV21ToQASYMM8BGR, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_preprocess(Format::NV21, DataType::QASYMM8, 100, 76, TensorShape(3U, 32U, 32U), true) <= 1.0,
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RGBA8888ToQASYMM8_SIGNED, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(
+        run_preprocess(Format::RGBA8888, DataType::QASYMM8_SIGNED, 257, 131, TensorShape(3U, 23U, 17U), false) <= 1.0,
+        framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RGB888ToF32BGR, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_preprocess(Format::RGB888, DataType::F32, 64, 64, TensorShape(3U, 16U, 10U), true) < 1e-3,
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // Preprocess
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
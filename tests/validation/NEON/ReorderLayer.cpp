@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -101,6 +101,19 @@ FIXTURE_DATA_TEST_CASE(RunInterleave4,
     validate(Accessor(_target), _reference);
 }
 
+FIXTURE_DATA_TEST_CASE(RunInterleave16,
+                       NEReorderLayerAlias<float>,
+                       framework::DatasetMode::ALL,
+                       combine(datasets::ReorderLayerDatasetInterleave16(),
+                               make("OutputWeightFormat", WeightFormat::OHWIo16),
+                               make("InputDataType", DataType::F32),
+                               make("OutputDataType", DataType::F32),
+                               make("Transpose", {true, false})))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
+
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_BF16
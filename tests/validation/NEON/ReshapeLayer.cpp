@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018, 2023 Arm Limited.
+ * Copyright (c) 2017-2018, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -138,6 +138,37 @@ TEST_SUITE_END() //S16
 TEST_SUITE_END() //Integer
 TEST_SUITE_END() //Padded
 
+/** Test case for a reshape whose destination aliases the memory of its source
+ *
+ * Checks performed in order:
+ * - The values are unchanged after running in-place
+ */
+TEST_CASE(InPlace, framework::DatasetMode::ALL)
+{
+    Tensor src = create_tensor<Tensor>(TensorShape(8U, 4U, 6U), DataType::F32);
+    Tensor dst = create_tensor<Tensor>(TensorShape(32U, 6U), DataType::F32);
+
+    NEReshapeLayer reshape;
+    reshape.configure(&src, &dst);
+
+    src.allocator()->allocate();
+    dst.allocator()->import_memory(src.buffer());
+
+    const size_t num_elements = src.info()->tensor_shape().total_size();
+    auto        *values       = reinterpret_cast<float *>(src.buffer());
+    for (size_t i = 0; i < num_elements; ++i)
+    {
+        values[i] = static_cast<float>(i);
+    }
+
+    reshape.run();
+
+    for (size_t i = 0; i < num_elements; ++i)
+    {
+        ARM_COMPUTE_EXPECT(values[i] == static_cast<float>(i), framework::LogLevel::ERRORS);
+    }
+}
+
 TEST_SUITE_END() //ReshapeLayer
 TEST_SUITE_END() //NEON
 } // namespace validation
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEResizeNormalize.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+const std::vector<float> mean_rgb{0.485f, 0.456f, 0.406f};
+const std::vector<float> std_rgb{0.229f, 0.224f, 0.225f};
+
+TensorInfo quantized_nhwc_info(const TensorShape &shape, DataType data_type, const QuantizationInfo &qinfo)
+{
+    TensorInfo info(shape, 1, data_type, qinfo);
+    info.set_data_layout(DataLayout::NHWC);
+    return info;
+}
+
+/** Max absolute difference between @ref NEResizeNormalize and a scalar reference on a NHWC image of 3 channels
+ *
+ * The source values are in [0, 255] for U8 and [0, 1] for F32, the difference is measured in the units of the
+ * destination, so in quantized steps for the quantized types.
+ */
+double run_resize_normalize(DataType           src_dt,
+                            DataType           dst_dt,
+                            const TensorShape &src_shape,
+                            const TensorShape &dst_shape)
+{
+    const bool             is_quantized = is_data_type_quantized_asymmetric(dst_dt);
+    const QuantizationInfo dst_qinfo    = is_quantized ? QuantizationInfo(0.02f, dst_dt == DataType::QASYMM8 ? 128 : 0)
+                                                       : QuantizationInfo();
+
+    Tensor src = create_tensor<Tensor>(src_shape, src_dt, 1, QuantizationInfo(), DataLayout::NHWC);
+    Tensor dst = create_tensor<Tensor>(dst_shape, dst_dt, 1, dst_qinfo, DataLayout::NHWC);
+
+    NEResizeNormalize resize_normalize;
+    resize_normalize.configure(&src, &dst, mean_rgb, std_rgb);
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    // U8 images are normalized from [0, 255], so the mean and the standard deviation are applied to the raw values
+    std::mt19937                          gen(library->seed());
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    std::uniform_int_distribution<int>    idist(0, 255);
+    std::vector<double>                   src_values(src_shape.total_size());
+    for (size_t i = 0; i < src_values.size(); ++i)
+    {
+        if (src_dt == DataType::U8)
+        {
+            reinterpret_cast<uint8_t *>(src.buffer())[i] = static_cast<uint8_t>(idist(gen));
+            src_values[i] = reinterpret_cast<uint8_t *>(src.buffer())[i];
+        }
+        else
+        {
+            reinterpret_cast<float *>(src.buffer())[i] = dist(gen);
+            src_values[i] = reinterpret_cast<float *>(src.buffer())[i];
+        }
+    }
+
+    resize_normalize.run();
+
+    const int    channels   = src_shape[0];
+    const int    src_width  = src_shape[1];
+    const int    src_height = src_shape[2];
+    const double wr         = static_cast<double>(src_width) / dst_shape[1];
+    const double hr         = static_cast<double>(src_height) / dst_shape[2];
+    const auto   qinfo      = dst_qinfo.uniform();
+
+    double max_diff = 0.0;
+    for (unsigned int b = 0; b < dst_shape[3]; ++b)
+    {
+        for (unsigned int oy = 0; oy < dst_shape[2]; ++oy)
+        {
+            const double y0 = oy * hr;
+            const double y1 = std::min((oy + 1) * hr, static_cast<double>(src_height));
+            for (unsigned int ox = 0; ox < dst_shape[1]; ++ox)
+            {
+                const double x0 = ox * wr;
+                const double x1 = std::min((ox + 1) * wr, static_cast<double>(src_width));
+                for (int c = 0; c < channels; ++c)
+                {
+                    double sum = 0.0;
+                    for (int iy = static_cast<int>(std::floor(y0)); iy < static_cast<int>(std::ceil(y1)); ++iy)
+                    {
+                        const double wy = std::min(iy + 1.0, y1) - std::max(static_cast<double>(iy), y0);
+                        for (int ix = static_cast<int>(std::floor(x0)); ix < static_cast<int>(std::ceil(x1)); ++ix)
+                        {
+                            const double wx = std::min(ix + 1.0, x1) - std::max(static_cast<double>(ix), x0);
+                            sum += wx * wy * src_values[((b * src_height + iy) * src_width + ix) * channels + c];
+                        }
+                    }
+                    double expected = (sum / ((x1 - x0) * (y1 - y0)) - mean_rgb[c]) / std_rgb[c];
+
+                    const size_t dst_idx = ((b * dst_shape[2] + oy) * dst_shape[1] + ox) * channels + c;
+                    double       actual  = 0.0;
+                    switch (dst_dt)
+                    {
+                        case DataType::QASYMM8:
+                            expected =
+                                std::max(0.0, std::min(255.0, std::round(expected / qinfo.scale + qinfo.offset)));
+                            actual   = reinterpret_cast<const uint8_t *>(dst.buffer())[dst_idx];
+                            break;
+                        case DataType::QASYMM8_SIGNED:
+                            expected =
+                                std::max(-128.0, std::min(127.0, std::round(expected / qinfo.scale + qinfo.offset)));
+                            actual = reinterpret_cast<const int8_t *>(dst.buffer())[dst_idx];
+                            break;
+                        default:
+                            actual = reinterpret_cast<const float *>(dst.buffer())[dst_idx];
+                            break;
+                    }
+                    max_diff = std::max(max_diff, std::abs(expected - actual));
+                }
+            }
+        }
+    }
+    return max_diff;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ResizeNormalize)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("InputInfo", { TensorInfo(TensorShape(3U, 64U, 48U), 1, DataType::U8, DataLayout::NHWC),
+                                   TensorInfo(TensorShape(3U, 64U, 48U), 1, DataType::F32, DataLayout::NHWC),
+                                   TensorInfo(TensorShape(3U, 64U, 48U), 1, DataType::S16, DataLayout::NHWC),     // Unsupported source type
+                                   TensorInfo(TensorShape(64U, 48U, 3U), 1, DataType::U8, DataLayout::NCHW),      // Unsupported layout
+                                   TensorInfo(TensorShape(3U, 64U, 48U), 1, DataType::U8, DataLayout::NHWC),      // Mismatching channels
+                                   TensorInfo(TensorShape(3U, 64U, 48U), 1, DataType::U8, DataLayout::NHWC),      // Wrong number of means
+                                   TensorInfo(TensorShape(3U, 64U, 48U), 1, DataType::U8, DataLayout::NHWC),      // Zero standard deviation
+                                 }),
+               make("OutputInfo", { TensorInfo(TensorShape(3U, 16U, 12U), 1, DataType::F32, DataLayout::NHWC),
+                                    quantized_nhwc_info(TensorShape(3U, 16U, 12U), DataType::QASYMM8_SIGNED, QuantizationInfo(0.02f, 0)),
+                                    TensorInfo(TensorShape(3U, 16U, 12U), 1, DataType::F32, DataLayout::NHWC),
+                                    TensorInfo(TensorShape(16U, 12U, 3U), 1, DataType::F32, DataLayout::NCHW),
+                                    TensorInfo(TensorShape(4U, 16U, 12U), 1, DataType::F32, DataLayout::NHWC),
+                                    TensorInfo(TensorShape(3U, 16U, 12U), 1, DataType::F32, DataLayout::NHWC),
+                                    TensorInfo(TensorShape(3U, 16U, 12U), 1, DataType::F32, DataLayout::NHWC),
+                                  }),
+               make("Mean", { mean_rgb, mean_rgb, mean_rgb, mean_rgb, mean_rgb, std::vector<float>{ 0.5f, 0.5f }, std::vector<float>{ 0.5f } }),
+               make("StdDev", { std_rgb, std::vector<float>{ 0.25f }, std_rgb, std_rgb, std_rgb, std_rgb, std::vector<float>{ 0.2f, 0.f, 0.2f } }),
+               make("Expected", { true, true, false, false, false, false, false })),
+               input_info, output_info, mean, std_dev, expected)
+{
+    const Status status = NEResizeNormalize::validate(&input_info.clone()->set_is_resizable(false),
+                                                      &output_info.clone()->set_is_resizable(false), mean, std_dev);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_CASE(U8ToF32, framework::DatasetMode::ALL)
+{
+    // 255 / 0.224 is the largest normalized value, the tolerance accounts for the fp32 accumulation over 11x7 pixels
+    ARM_COMPUTE_EXPECT(run_resize_normalize(DataType::U8, DataType::F32, TensorShape(3U, 257U, 131U, 2U),
+                                            TensorShape(3U, 23U, 17U, 2U)) < 0.01,
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(U8ToQASYMM8, framework::DatasetMode::ALL)
+{
+    // Normalized U8 values mostly saturate, which checks the clamping of the quantization
+    ARM_COMPUTE_EXPECT(run_resize_normalize(DataType::U8, DataType::QASYMM8, TensorShape(3U, 100U, 75U),
+                                            TensorShape(3U, 32U, 32U)) <= 1.0,
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(F32ToQASYMM8_SIGNED, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_resize_normalize(DataType::F32, DataType::QASYMM8_SIGNED, TensorShape(3U, 257U, 131U),
+                                            TensorShape(3U, 23U, 17U)) <= 1.0,
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(F32ToF32, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_resize_normalize(DataType::F32, DataType::F32, TensorShape(3U, 64U, 64U),
+                                            TensorShape(3U, 16U, 10U)) < 1e-4,
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // ResizeNormalize
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
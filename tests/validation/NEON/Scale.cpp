@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/runtime/NEON/functions/NEScale.h"
+#include "tests/Globals.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/datasets/ScaleValidationDataset.h"
 #include "tests/framework/Macros.h"
@@ -30,6 +31,13 @@
 #include "tests/validation/fixtures/ScaleFixture.h"
 #include "utils/TypePrinter.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
 namespace arm_compute
 {
 namespace test
@@ -87,6 +95,99 @@ RelativeTolerance<half> tolerance_f16(half(0.1));
 
 constexpr float tolerance_num_s16 = 0.01f;
 constexpr float tolerance_num_f32 = 0.01f;
+
+/** Coverage weighted average of the source pixels under each destination pixel of a NHWC tensor
+ *
+ * Destination pixel (x, y) covers the source rectangle [x * wr, (x + 1) * wr) x [y * hr, (y + 1) * hr).
+ */
+std::vector<double> reference_area_nhwc(const std::vector<double> &src, const TensorShape &src_shape, const TensorShape &dst_shape)
+{
+    const int    channels   = src_shape[0];
+    const int    src_width  = src_shape[1];
+    const int    src_height = src_shape[2];
+    const double wr         = static_cast<double>(src_width) / dst_shape[1];
+    const double hr         = static_cast<double>(src_height) / dst_shape[2];
+
+    std::vector<double> dst(dst_shape.total_size());
+    for(unsigned int oy = 0; oy < dst_shape[2]; ++oy)
+    {
+        const double y0 = oy * hr;
+        const double y1 = std::min((oy + 1) * hr, static_cast<double>(src_height));
+        for(unsigned int ox = 0; ox < dst_shape[1]; ++ox)
+        {
+            const double x0 = ox * wr;
+            const double x1 = std::min((ox + 1) * wr, static_cast<double>(src_width));
+            for(int c = 0; c < channels; ++c)
+            {
+                double sum = 0.0;
+                for(int iy = static_cast<int>(std::floor(y0)); iy < static_cast<int>(std::ceil(y1)); ++iy)
+                {
+                    const double wy = std::min(iy + 1.0, y1) - std::max(static_cast<double>(iy), y0);
+                    for(int ix = static_cast<int>(std::floor(x0)); ix < static_cast<int>(std::ceil(x1)); ++ix)
+                    {
+                        const double wx = std::min(ix + 1.0, x1) - std::max(static_cast<double>(ix), x0);
+                        sum += wx * wy * src[(iy * src_width + ix) * channels + c];
+                    }
+                }
+                dst[(oy * dst_shape[1] + ox) * channels + c] = sum / ((x1 - x0) * (y1 - y0));
+            }
+        }
+    }
+    return dst;
+}
+
+/** Max absolute difference between @ref NEScale with area interpolation on a NHWC tensor and a scalar reference
+ *
+ * The difference is measured in the units of the destination, so in quantized steps for the integer types.
+ */
+template <typename T>
+double run_area_nhwc(DataType data_type, const TensorShape &src_shape, const TensorShape &dst_shape)
+{
+    const bool             is_quantized = is_data_type_quantized_asymmetric(data_type);
+    const QuantizationInfo src_qinfo    = is_quantized ? QuantizationInfo(0.5f, -10) : QuantizationInfo();
+    const QuantizationInfo dst_qinfo    = is_quantized ? QuantizationInfo(0.6f, 5) : QuantizationInfo();
+
+    Tensor src = create_tensor<Tensor>(src_shape, data_type, 1, src_qinfo, DataLayout::NHWC);
+    Tensor dst = create_tensor<Tensor>(dst_shape, data_type, 1, dst_qinfo, DataLayout::NHWC);
+
+    NEScale scale;
+    scale.configure(&src, &dst, ScaleKernelInfo{ InterpolationPolicy::AREA, BorderMode::CONSTANT, PixelValue(), SamplingPolicy::CENTER });
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    std::mt19937                          gen(library->seed());
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::uniform_int_distribution<int>    idist(std::is_signed<T>::value ? -128 : 0, std::is_signed<T>::value ? 127 : 255);
+
+    auto               *src_ptr = reinterpret_cast<T *>(src.buffer());
+    std::vector<double> src_values(src_shape.total_size());
+    for(size_t i = 0; i < src_values.size(); ++i)
+    {
+        src_ptr[i]    = std::is_floating_point<T>::value ? static_cast<T>(dist(gen)) : static_cast<T>(idist(gen));
+        src_values[i] = is_quantized ? (src_ptr[i] - src_qinfo.uniform().offset) * static_cast<double>(src_qinfo.uniform().scale) : src_ptr[i];
+    }
+
+    scale.run();
+
+    const std::vector<double> reference = reference_area_nhwc(src_values, src_shape, dst_shape);
+    const auto               *dst_ptr   = reinterpret_cast<const T *>(dst.buffer());
+    double                    max_diff  = 0.0;
+    for(size_t i = 0; i < reference.size(); ++i)
+    {
+        double expected = reference[i];
+        if(is_quantized)
+        {
+            expected = expected / dst_qinfo.uniform().scale + dst_qinfo.uniform().offset;
+        }
+        if(!std::is_floating_point<T>::value)
+        {
+            expected = std::max<double>(std::min<double>(std::round(expected), std::numeric_limits<T>::max()), std::numeric_limits<T>::lowest());
+        }
+        max_diff = std::max(max_diff, std::abs(expected - static_cast<double>(dst_ptr[i])));
+    }
+    return max_diff;
+}
 } // namespace
 
 TEST_SUITE(NEON)
@@ -214,15 +315,25 @@ TEST_CASE(UsePadding, framework::DatasetMode::ALL)
 
 TEST_CASE(AreaWithNHWC, framework::DatasetMode::ALL)
 {
-    // InterpolationPolicy::AREA is not supported for NHWC
+    // InterpolationPolicy::AREA with NHWC supports U8, QASYMM8, QASYMM8_SIGNED, F16 and F32 without aligned corners
     constexpr auto interpolation_policy = InterpolationPolicy::AREA;
     constexpr auto data_layout          = DataLayout::NHWC;
+    const auto     area_input_shape     = TensorShape{ 3, 8, 8, 2 };
+    const auto     area_output_shape    = TensorShape{ 3, 3, 4, 2 };
 
-    const auto input  = TensorInfo{ input_shape, 1, default_data_type, data_layout };
-    const auto output = TensorInfo{ output_shape, 1, default_data_type, data_layout };
+    const auto input      = TensorInfo{ area_input_shape, 1, default_data_type, data_layout };
+    const auto output     = TensorInfo{ area_output_shape, 1, default_data_type, data_layout };
+    const auto input_s16  = TensorInfo{ area_input_shape, 1, DataType::S16, data_layout };
+    const auto output_s16 = TensorInfo{ area_output_shape, 1, DataType::S16, data_layout };
     Status     result{};
 
     result = NEScale::validate(&input, &output, ScaleKernelInfo{ interpolation_policy, default_border_mode, PixelValue(), SamplingPolicy::CENTER, false });
+    ARM_COMPUTE_EXPECT(bool(result) == true, framework::LogLevel::ERRORS);
+
+    result = NEScale::validate(&input_s16, &output_s16, ScaleKernelInfo{ interpolation_policy, default_border_mode, PixelValue(), SamplingPolicy::CENTER, false });
+    ARM_COMPUTE_EXPECT(bool(result) == false, framework::LogLevel::ERRORS);
+
+    result = NEScale::validate(&input, &output, ScaleKernelInfo{ interpolation_policy, default_border_mode, PixelValue(), SamplingPolicy::TOP_LEFT, false, true });
     ARM_COMPUTE_EXPECT(bool(result) == false, framework::LogLevel::ERRORS);
 }
 
@@ -326,6 +437,28 @@ DATA_TEST_CASE(CheckNoPaddingInterpAREA, framework::DatasetMode::ALL, combine(co
     validate(dst.info()->padding(), PaddingSize(0, 0, 0, 0));
 }
 
+TEST_SUITE(AreaNHWC)
+// Large downscaling ratios, non integer in both directions, with a number of channels that is not a multiple of the vector length
+TEST_CASE(F32, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_area_nhwc<float>(DataType::F32, TensorShape(3U, 257U, 131U), TensorShape(3U, 23U, 17U)) < 1e-4, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_area_nhwc<float>(DataType::F32, TensorShape(19U, 64U, 50U), TensorShape(19U, 16U, 7U)) < 1e-4, framework::LogLevel::ERRORS);
+}
+TEST_CASE(U8, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_area_nhwc<uint8_t>(DataType::U8, TensorShape(3U, 257U, 131U), TensorShape(3U, 23U, 17U)) <= 1.0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_area_nhwc<uint8_t>(DataType::U8, TensorShape(35U, 40U, 33U), TensorShape(35U, 13U, 11U)) <= 1.0, framework::LogLevel::ERRORS);
+}
+TEST_CASE(QASYMM8, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_area_nhwc<uint8_t>(DataType::QASYMM8, TensorShape(3U, 257U, 131U), TensorShape(3U, 23U, 17U)) <= 1.0, framework::LogLevel::ERRORS);
+}
+TEST_CASE(QASYMM8_SIGNED, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_area_nhwc<int8_t>(DataType::QASYMM8_SIGNED, TensorShape(17U, 97U, 61U), TensorShape(17U, 10U, 9U)) <= 1.0, framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // AreaNHWC
+
 template <typename T>
 using NEScaleFixture = ScaleValidationFixture<Tensor, Accessor, NEScale, T>;
 template <typename T>
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuScaledDotProductAttention.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+
+#include <cmath>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Max absolute difference between the fused attention and a naive softmax(scale * Q K^T) V on the same inputs */
+float run_attention(unsigned int d, unsigned int dv, unsigned int sq, unsigned int skv, unsigned int heads, bool is_causal)
+{
+    const float scale = 1.f / std::sqrt(static_cast<float>(d));
+
+    const TensorInfo q_info(TensorShape(d, sq, heads), 1, DataType::F32);
+    const TensorInfo k_info(TensorShape(d, skv, heads), 1, DataType::F32);
+    const TensorInfo v_info(TensorShape(dv, skv, heads), 1, DataType::F32);
+    TensorInfo       dst_info;
+
+    cpu::CpuScaledDotProductAttention sdpa;
+    sdpa.configure(&q_info, &k_info, &v_info, &dst_info, scale, is_causal);
+
+    Tensor q, k, v, dst;
+    q.allocator()->init(q_info);
+    k.allocator()->init(k_info);
+    v.allocator()->init(v_info);
+    dst.allocator()->init(dst_info);
+    q.allocator()->allocate();
+    k.allocator()->allocate();
+    v.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(q), 0);
+    library->fill_tensor_uniform(Accessor(k), 1);
+    library->fill_tensor_uniform(Accessor(v), 2);
+
+    ITensorPack pack{ { TensorType::ACL_SRC_0, &q }, { TensorType::ACL_SRC_1, &k }, { TensorType::ACL_SRC_2, &v }, { TensorType::ACL_DST, &dst } };
+    auto        mg = MemoryGroup{};
+    auto        ws = manage_workspace<Tensor>(sdpa.workspace(), mg, pack);
+    sdpa.run(pack);
+
+    const auto *pq = reinterpret_cast<const float *>(q.buffer());
+    const auto *pk = reinterpret_cast<const float *>(k.buffer());
+    const auto *pv = reinterpret_cast<const float *>(v.buffer());
+    const auto *pd = reinterpret_cast<const float *>(dst.buffer());
+
+    float max_diff = 0.f;
+    for(unsigned int h = 0; h < heads; ++h)
+    {
+        for(unsigned int i = 0; i < sq; ++i)
+        {
+            const unsigned int num_keys = is_causal ? i + skv - sq + 1 : skv;
+            std::vector<float> p(num_keys);
+            float              max_score = -INFINITY;
+            for(unsigned int j = 0; j < num_keys; ++j)
+            {
+                float s = 0.f;
+                for(unsigned int x = 0; x < d; ++x)
+                {
+                    s += pq[(h * sq + i) * d + x] * pk[(h * skv + j) * d + x];
+                }
+                p[j]      = scale * s;
+                max_score = std::max(max_score, p[j]);
+            }
+            float sum = 0.f;
+            for(auto &e : p)
+            {
+                e = std::exp(e - max_score);
+                sum += e;
+            }
+            for(unsigned int x = 0; x < dv; ++x)
+            {
+                float expected = 0.f;
+                for(unsigned int j = 0; j < num_keys; ++j)
+                {
+                    expected += p[j] * pv[(h * skv + j) * dv + x];
+                }
+                max_diff = std::max(max_diff, std::abs(expected / sum - pd[(h * sq + i) * dv + x]));
+            }
+        }
+    }
+    return max_diff;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ScaledDotProductAttention)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("QInfo", { TensorInfo(TensorShape(16U, 8U, 2U), 1, DataType::F32),
+                               TensorInfo(TensorShape(16U, 8U, 2U), 1, DataType::S32),     // Unsupported data type
+                               TensorInfo(TensorShape(16U, 8U, 2U), 1, DataType::F32),     // Depth of K differs
+                               TensorInfo(TensorShape(16U, 8U, 2U), 1, DataType::F32),     // Lengths of K and V differ
+                               TensorInfo(TensorShape(16U, 40U, 2U), 1, DataType::F32),    // Causal with fewer keys than queries
+                             }),
+               make("KInfo", { TensorInfo(TensorShape(16U, 32U, 2U), 1, DataType::F32),
+                               TensorInfo(TensorShape(16U, 32U, 2U), 1, DataType::S32),
+                               TensorInfo(TensorShape(12U, 32U, 2U), 1, DataType::F32),
+                               TensorInfo(TensorShape(16U, 32U, 2U), 1, DataType::F32),
+                               TensorInfo(TensorShape(16U, 32U, 2U), 1, DataType::F32),
+                             }),
+               make("VInfo", { TensorInfo(TensorShape(24U, 32U, 2U), 1, DataType::F32),
+                               TensorInfo(TensorShape(24U, 32U, 2U), 1, DataType::S32),
+                               TensorInfo(TensorShape(24U, 32U, 2U), 1, DataType::F32),
+                               TensorInfo(TensorShape(24U, 31U, 2U), 1, DataType::F32),
+                               TensorInfo(TensorShape(24U, 32U, 2U), 1, DataType::F32),
+                             }),
+               make("IsCausal", { true, false, false, false, true }),
+               make("Expected", { true, false, false, false, false })),
+               q_info, k_info, v_info, is_causal, expected)
+{
+    const TensorInfo dst_info;
+    const Status     status = cpu::CpuScaledDotProductAttention::validate(&q_info, &k_info, &v_info, &dst_info, 1.f, is_causal);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_SUITE(FP32)
+/** Test case for the online softmax of @ref cpu::CpuScaledDotProductAttention.
+ *
+ * Uses key counts around the key block size, odd depths and a single query row (decode).
+ *
+ * Checks performed in order:
+ * - The output matches a naive attention computed on the same inputs
+ */
+TEST_CASE(RunSmall, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_attention(16U, 16U, 7U, 130U, 2U, false) < 1e-4f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_attention(13U, 5U, 9U, 9U, 3U, false) < 1e-4f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_attention(64U, 64U, 1U, 200U, 4U, false) < 1e-4f, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RunCausal, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_attention(32U, 32U, 50U, 70U, 1U, true) < 1e-4f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_attention(8U, 12U, 65U, 65U, 2U, true) < 1e-4f, framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // FP32
+
+TEST_SUITE_END() // ScaledDotProductAttention
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
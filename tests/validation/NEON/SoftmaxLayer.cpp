@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2022-2025 Arm Limited.
+ * Copyright (c) 2017-2020, 2022-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@
 #include "tests/framework/datasets/Datasets.h"
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/SoftmaxLayerFixture.h"
+#include "tests/validation/reference/SoftmaxLayer.h"
 namespace arm_compute
 {
 namespace test
@@ -232,6 +233,25 @@ FIXTURE_DATA_TEST_CASE(RunSmall4D, NESoftmaxLayerFixture<half>, framework::Datas
         framework::ARM_COMPUTE_PRINT_INFO();
     }
 }
+// Rows long enough to be normalized by the online softmax
+FIXTURE_DATA_TEST_CASE(RunLongRows, NESoftmaxLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+    combine(
+        make("Shape", { TensorShape(16384U, 2U), TensorShape(32003U, 2U) }),
+        make("DataType", DataType::F16),
+        make("Beta", { 1.0f }),
+        make("Axis", { 0 })))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
 FIXTURE_DATA_TEST_CASE(RunLarge, NESoftmaxLayerFixture<half>, framework::DatasetMode::NIGHTLY,
     combine(
         datasets::SoftmaxLayerLargeShapes(),
@@ -262,18 +282,9 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NESoftmaxLayerFixture<bfloat16>, framework::Dat
         make("Beta", { 1.0f, 2.0f }),
         make("Axis", { 0 })))
 {
-    // The LUT is implemented using SVE. Bf16 support is not required because
-    // we do not use any instructions from FEAT_BF16
-    if(CPUInfo::get().has_sve())
-    {
-        // Validate output
-        validate(Accessor(_target), _reference, tolerance_bf16);
-    }
-    else
-    {
-        ARM_COMPUTE_TEST_INFO("Device does not support SVE. Test SKIPPED.");
-        framework::ARM_COMPUTE_PRINT_INFO();
-    }
+    // The LUT is implemented using SVE, other devices run the online softmax in fp32.
+    // Bf16 support is not required because we do not use any instructions from FEAT_BF16
+    validate(Accessor(_target), _reference, tolerance_bf16);
 }
 TEST_SUITE_END() //BF16
 #endif /* ARM_COMPUTE_ENABLE_BF16 */
@@ -308,6 +319,17 @@ FIXTURE_DATA_TEST_CASE(RunSmall4D, NESoftmaxLayerFixture<float>, framework::Data
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+// Rows long enough to be normalized by the online softmax
+FIXTURE_DATA_TEST_CASE(RunLongRows, NESoftmaxLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+    combine(
+        make("Shape", { TensorShape(8192U, 3U), TensorShape(32003U, 2U) }),
+        make("DataType", DataType::F32),
+        make("Beta", { 1.0f, 2.0f }),
+        make("Axis", { 0 })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge, NESoftmaxLayerFixture<float>, framework::DatasetMode::NIGHTLY,
     combine(datasets::SoftmaxLayerLargeShapes(),
         make("DataType", DataType::F32),
@@ -317,6 +339,62 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NESoftmaxLayerFixture<float>, framework::Datase
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+/** Test case for the shape bounds of @ref NESoftmaxLayer.
+ *
+ * Configure once with the largest shape and some of its dimensions marked as dynamic, then run on smaller shapes
+ * within the same allocation.
+ *
+ * Checks performed in order:
+ * - Dynamic shapes without bounds are rejected
+ * - Every run matches the reference on the run-time shape
+ */
+TEST_CASE(RunShapeBounds, framework::DatasetMode::ALL)
+{
+    TensorInfo unbounded_info(TensorShape(), 1, DataType::F32);
+    unbounded_info.set_dynamic(true);
+    ARM_COMPUTE_EXPECT(!bool(NESoftmaxLayer::validate(&unbounded_info, &unbounded_info)), framework::LogLevel::ERRORS);
+
+    const std::vector<std::pair<int32_t, std::vector<TensorShape>>> configs{
+        { 0, { TensorShape(37U, 9U, 4U), TensorShape(13U, 1U, 1U), TensorShape(37U, 5U, 3U), TensorShape(37U, 9U, 4U) } },
+        { 1, { TensorShape(20U, 6U, 3U), TensorShape(13U, 6U, 2U), TensorShape(1U, 6U, 3U) } },
+    };
+
+    for(const auto &config : configs)
+    {
+        const int32_t axis = config.first;
+
+        // The softmax dimension of the second configuration is kept static
+        ITensorInfo::TensorDimsState dims_state{};
+        dims_state.fill(ITensorInfo::get_dynamic_state_value());
+        dims_state[1] = (axis == 1) ? ITensorInfo::get_static_state_value() : dims_state[1];
+
+        Tensor src, dst;
+        src.allocator()->init(TensorInfo(config.second.front(), 1, DataType::F32));
+        dst.allocator()->init(TensorInfo(config.second.front(), 1, DataType::F32));
+        src.info()->set_tensor_dims_state(dims_state);
+        dst.info()->set_tensor_dims_state(dims_state);
+
+        NESoftmaxLayer softmax;
+        softmax.configure(&src, &dst, 1.f, axis);
+
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        int seed = 0;
+        for(const auto &shape : config.second)
+        {
+            src.info()->set_tensor_shape(shape);
+            dst.info()->set_tensor_shape(shape);
+            library->fill_tensor_uniform(Accessor(src), seed);
+
+            softmax.run();
+
+            SimpleTensor<float> ref_src{ shape, DataType::F32 };
+            library->fill_tensor_uniform(ref_src, seed++);
+            validate(Accessor(dst), reference::softmax_layer<float>(ref_src, 1.f, axis), tolerance_f32);
+        }
+    }
+}
 TEST_SUITE_END() //FP32
 TEST_SUITE_END() //Float
 
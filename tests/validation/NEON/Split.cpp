@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/functions/NESplit.h"
+#include "arm_compute/runtime/SubTensorViews.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 
@@ -91,6 +92,52 @@ DATA_TEST_CASE(ValidateSplitShapes, framework::DatasetMode::ALL, zip(zip(zip(
 // clang-format on
 // *INDENT-ON*
 
+/** Split views must alias the input and read the same values as the outputs of NESplit */
+TEST_CASE(AliasingViews, framework::DatasetMode::ALL)
+{
+    const unsigned int num_splits = 3;
+    const unsigned int axis       = 1;
+
+    Tensor src   = create_tensor<Tensor>(TensorShape(12U, 6U, 3U), DataType::F32);
+    auto   views = create_split_views(&src, std::vector<size_t>{ 1U, 2U, 3U }, axis);
+
+    std::vector<Tensor>    dsts(num_splits);
+    std::vector<ITensor *> dsts_ptr;
+    for(auto &dst : dsts)
+    {
+        dsts_ptr.emplace_back(&dst);
+    }
+    NESplit split;
+    split.configure(&src, dsts_ptr, axis);
+
+    src.allocator()->allocate();
+    for(auto &dst : dsts)
+    {
+        dst.allocator()->allocate();
+    }
+    library->fill_tensor_uniform(Accessor(src), 0);
+
+    // The equal split of the same input must match NESplit exactly
+    auto equal_views = create_split_views(&src, num_splits, axis);
+    split.run();
+
+    for(unsigned int i = 0; i < num_splits; ++i)
+    {
+        ARM_COMPUTE_EXPECT(views[i].info()->tensor_shape()[axis] == i + 1, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(equal_views[i].buffer() == src.buffer(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(equal_views[i].info()->tensor_shape() == dsts[i].info()->tensor_shape(), framework::LogLevel::ERRORS);
+
+        Window window;
+        window.use_tensor_dimensions(dsts[i].info()->tensor_shape());
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            const float viewed = *reinterpret_cast<const float *>(Accessor(equal_views[i])(id));
+            const float copied = *reinterpret_cast<const float *>(Accessor(dsts[i])(id));
+            ARM_COMPUTE_EXPECT(viewed == copied, framework::LogLevel::ERRORS);
+        });
+    }
+}
+
 template <typename T>
 using NESplitFixture = SplitFixture<Tensor, ITensor, Accessor, NESplit, T>;
 
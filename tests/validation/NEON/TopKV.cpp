@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NETopKV.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/Globals.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Whether @ref NETopKV selects the same values and indices as a stable sort of each row
+ *
+ * The values are drawn from a small range so that the rows have many equal values.
+ */
+template <typename T>
+bool run_topkv(unsigned int num_elements, unsigned int num_rows, unsigned int k, DataType data_type)
+{
+    const QuantizationInfo qinfo(0.5f, 10);
+
+    Tensor src, values, indices;
+    src.allocator()->init(TensorInfo(TensorShape(num_elements, num_rows), 1, data_type, qinfo));
+
+    NETopKV topkv;
+    topkv.configure(&src, &values, &indices, k);
+
+    src.allocator()->allocate();
+    values.allocator()->allocate();
+    indices.allocator()->allocate();
+
+    std::mt19937                       gen(library->seed());
+    std::uniform_int_distribution<int> dist(0, 50);
+
+    auto *ps = reinterpret_cast<T *>(src.buffer());
+    for(unsigned int i = 0; i < num_elements * num_rows; ++i)
+    {
+        ps[i] = static_cast<T>(dist(gen));
+    }
+
+    topkv.run();
+
+    const auto *pv = reinterpret_cast<const T *>(values.buffer());
+    const auto *pi = reinterpret_cast<const uint32_t *>(indices.buffer());
+    for(unsigned int y = 0; y < num_rows; ++y)
+    {
+        const T              *row = ps + y * num_elements;
+        std::vector<uint32_t> order(num_elements);
+        std::iota(order.begin(), order.end(), 0U);
+        std::stable_sort(order.begin(), order.end(), [row](uint32_t lhs, uint32_t rhs)
+                         { return static_cast<float>(row[lhs]) > static_cast<float>(row[rhs]); });
+
+        for(unsigned int j = 0; j < k; ++j)
+        {
+            if(pi[y * k + j] != order[j] || static_cast<float>(pv[y * k + j]) != static_cast<float>(row[order[j]]))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(TopKV)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("SrcInfo", { TensorInfo(TensorShape(100U, 4U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(100U, 4U), 1, DataType::QASYMM8),
+                                 TensorInfo(TensorShape(100U, 4U), 1, DataType::S32),     // Unsupported data type
+                                 TensorInfo(TensorShape(100U, 4U), 1, DataType::F32),     // k larger than a row
+                                 TensorInfo(TensorShape(100U, 4U), 1, DataType::F32),     // Mismatching values shape
+                                 TensorInfo(TensorShape(100U, 4U), 1, DataType::F32),     // Wrong indices data type
+                               }),
+               make("ValuesInfo", { TensorInfo(TensorShape(5U, 4U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(5U, 4U), 1, DataType::QASYMM8),
+                                    TensorInfo(TensorShape(5U, 4U), 1, DataType::S32),
+                                    TensorInfo(TensorShape(101U, 4U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(5U, 3U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(5U, 4U), 1, DataType::F32),
+                                  }),
+               make("IndicesInfo", { TensorInfo(TensorShape(5U, 4U), 1, DataType::U32),
+                                     TensorInfo(TensorShape(5U, 4U), 1, DataType::U32),
+                                     TensorInfo(TensorShape(5U, 4U), 1, DataType::U32),
+                                     TensorInfo(TensorShape(101U, 4U), 1, DataType::U32),
+                                     TensorInfo(TensorShape(5U, 4U), 1, DataType::U32),
+                                     TensorInfo(TensorShape(5U, 4U), 1, DataType::F32),
+                                   }),
+               make("K", { 5U, 5U, 5U, 101U, 5U, 5U }),
+               make("Expected", { true, true, false, false, false, false })),
+               src_info, values_info, indices_info, k, expected)
+{
+    const Status status = NETopKV::validate(&src_info, &values_info, &indices_info, k);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+/** Test case for the threshold filtering of @ref NETopKV.
+ *
+ * Uses rows that are not a multiple of the vector blocks, k equal to 1 and to the row length, and several rows.
+ *
+ * Checks performed in order:
+ * - The values and indices match a stable sort of each row, for each data type
+ */
+TEST_CASE(Run, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_topkv<float>(1000U, 3U, 5U, DataType::F32), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_topkv<float>(37U, 2U, 1U, DataType::F32), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_topkv<float>(37U, 2U, 37U, DataType::F32), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_topkv<uint8_t>(1000U, 3U, 10U, DataType::QASYMM8), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_topkv<int8_t>(1000U, 3U, 10U, DataType::QASYMM8_SIGNED), framework::LogLevel::ERRORS);
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    if(CPUInfo::get().has_fp16())
+    {
+        ARM_COMPUTE_EXPECT(run_topkv<half>(1000U, 3U, 5U, DataType::F16), framework::LogLevel::ERRORS);
+    }
+#endif // ARM_COMPUTE_ENABLE_FP16
+}
+
+TEST_SUITE_END() // TopKV
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
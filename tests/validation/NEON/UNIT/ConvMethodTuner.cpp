@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/utils/CpuConvMethodTuner.h"
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <cstdio>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(ConvMethodTuner)
+
+TEST_CASE(SaveAndLoad, framework::DatasetMode::ALL)
+{
+    auto             &tuner    = cpu::CpuConvMethodTuner::get();
+    const std::string filename = "cpu_conv_method_tuner_test.txt";
+
+    tuner.add("test_save_and_load", ConvolutionMethod::WINOGRAD);
+    ARM_COMPUTE_EXPECT(tuner.save_to_file(filename), framework::LogLevel::ERRORS);
+
+    // Loading overwrites the entry changed since it was saved
+    tuner.add("test_save_and_load", ConvolutionMethod::DIRECT);
+    tuner.load_from_file(filename);
+    std::remove(filename.c_str());
+
+    ConvolutionMethod loaded = ConvolutionMethod::GEMM;
+    ARM_COMPUTE_EXPECT(tuner.find("test_save_and_load", loaded), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(loaded == ConvolutionMethod::WINOGRAD, framework::LogLevel::ERRORS);
+}
+
+/** Test case for the measured convolution method selection
+ *
+ * Checks performed in order:
+ * - The method measured with tuning enabled is valid and recorded in the table
+ * - The method in the table is returned instead of the heuristics once tuning is disabled
+ * - An entry of the table the convolution cannot run with is ignored
+ */
+TEST_CASE(MeasureConvolution, framework::DatasetMode::ALL)
+{
+    auto      &tuner   = cpu::CpuConvMethodTuner::get();
+    const bool enabled = tuner.is_tuning_enabled();
+
+    TensorInfo src(TensorShape(32U, 14U, 14U), 1, DataType::F32, DataLayout::NHWC);
+    TensorInfo weights(TensorShape(32U, 3U, 3U, 16U), 1, DataType::F32, DataLayout::NHWC);
+    TensorInfo dst(TensorShape(16U, 14U, 14U), 1, DataType::F32, DataLayout::NHWC);
+    const PadStrideInfo conv_info(1U, 1U, 1U, 1U);
+
+    tuner.set_tuning_enabled(true);
+    const ConvolutionMethod measured = NEConvolutionLayer::get_convolution_method(&src, &weights, &dst, conv_info);
+    tuner.set_tuning_enabled(false);
+
+    const std::string key =
+        cpu::CpuConvMethodTuner::make_key(&src, &weights, conv_info, Size2D(1U, 1U), ActivationLayerInfo(), false);
+    ConvolutionMethod recorded = ConvolutionMethod::FFT;
+    ARM_COMPUTE_EXPECT(tuner.find(key, recorded), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(recorded == measured, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NEConvolutionLayer::validate(&src, &weights, nullptr, &dst, conv_info)),
+                       framework::LogLevel::ERRORS);
+
+    // GEMM runs any convolution, so it is used whatever the heuristics would pick
+    tuner.add(key, ConvolutionMethod::GEMM);
+    ARM_COMPUTE_EXPECT(NEConvolutionLayer::get_convolution_method(&src, &weights, &dst, conv_info) ==
+                           ConvolutionMethod::GEMM,
+                       framework::LogLevel::ERRORS);
+
+    // Direct convolution does not run dilated convolutions
+    const Size2D      dilation(2U, 2U);
+    const std::string dilated_key =
+        cpu::CpuConvMethodTuner::make_key(&src, &weights, conv_info, dilation, ActivationLayerInfo(), false);
+    tuner.add(dilated_key, ConvolutionMethod::DIRECT);
+    ConvolutionMethod method = ConvolutionMethod::FFT;
+    ARM_COMPUTE_EXPECT(!NEConvolutionLayer::get_measured_convolution_method(
+                           &src, &weights, &dst, conv_info, dilation, ActivationLayerInfo(), false, method),
+                       framework::LogLevel::ERRORS);
+
+    tuner.set_tuning_enabled(enabled);
+}
+
+TEST_SUITE_END() // ConvMethodTuner
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
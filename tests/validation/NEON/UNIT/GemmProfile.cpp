@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/utils/CpuGemmProfile.h"
+
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "src/core/NEON/kernels/arm_gemm/performance_parameters.hpp"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <cstdio>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GemmProfile)
+
+TEST_CASE(SaveAndLoad, framework::DatasetMode::ALL)
+{
+    auto             &profile  = cpu::CpuGemmProfile::get();
+    const CPUModel    model    = NEScheduler::get().cpu_info().get_cpu_model();
+    const std::string filename = "cpu_gemm_profile_test.txt";
+
+    cpu::CpuGemmProfile::Entry entry;
+    entry.kernel_macs_cycle = 12.5f;
+    entry.merge_bytes_cycle = 4.f;
+    profile.set(model, "test_kernel", entry);
+    ARM_COMPUTE_EXPECT(profile.has_model(model), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(profile.save_to_file(filename), framework::LogLevel::ERRORS);
+
+    // Loading overwrites the figures changed since they were saved
+    cpu::CpuGemmProfile::Entry other;
+    other.kernel_macs_cycle = 1.f;
+    profile.set(model, "test_kernel", other);
+    profile.load_from_file(filename);
+    std::remove(filename.c_str());
+
+    // The loaded figures are the ones arm_gemm ranks the kernels with
+    arm_gemm::PerformanceParameters params(0.f);
+    ARM_COMPUTE_EXPECT(arm_gemm::get_performance_parameters_override(model, "test_kernel", params),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(params.kernel_macs_cycle == entry.kernel_macs_cycle, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(params.prepare_bytes_cycle == 0.f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(params.merge_bytes_cycle == entry.merge_bytes_cycle, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // GemmProfile
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
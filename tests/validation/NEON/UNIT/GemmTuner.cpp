@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/utils/CpuGemmTuner.h"
+
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Reads the entries of the tuner table, keyed by problem */
+std::map<std::string, std::string> read_entries(const cpu::CpuGemmTuner &tuner)
+{
+    const std::string                  filename = "cpu_gemm_tuner_entries.txt";
+    std::map<std::string, std::string> entries;
+    if (tuner.save_to_file(filename))
+    {
+        std::ifstream fs(filename);
+        std::string   line;
+        while (std::getline(fs, line))
+        {
+            const size_t separator = line.find(';');
+            entries[line.substr(0, separator)] = line.substr(separator + 1);
+        }
+        std::remove(filename.c_str());
+    }
+    return entries;
+}
+} // namespace
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GemmTuner)
+
+TEST_CASE(SaveAndLoad, framework::DatasetMode::ALL)
+{
+    auto             &tuner    = cpu::CpuGemmTuner::get();
+    const std::string filename = "cpu_gemm_tuner_test.txt";
+
+    arm_gemm::GemmConfig cfg;
+    cfg.method           = arm_gemm::GemmMethod::GEMM_INTERLEAVED;
+    cfg.filter           = "test_kernel";
+    cfg.inner_block_size = 128;
+    tuner.add("test_save_and_load", cfg);
+    ARM_COMPUTE_EXPECT(tuner.save_to_file(filename), framework::LogLevel::ERRORS);
+
+    // Loading overwrites the entry changed since it was saved
+    arm_gemm::GemmConfig other;
+    other.filter = "other_kernel";
+    tuner.add("test_save_and_load", other);
+    tuner.load_from_file(filename);
+    std::remove(filename.c_str());
+
+    arm_gemm::GemmConfig loaded;
+    ARM_COMPUTE_EXPECT(tuner.find("test_save_and_load", loaded), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(loaded.method == cfg.method, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(loaded.filter == cfg.filter, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(loaded.inner_block_size == cfg.inner_block_size, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(loaded.outer_block_size == cfg.outer_block_size, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(TuneGEMM, framework::DatasetMode::ALL)
+{
+    auto      &tuner   = cpu::CpuGemmTuner::get();
+    const bool enabled = tuner.is_tuning_enabled();
+
+    const TensorShape a_shape(67U, 33U);
+    const TensorShape b_shape(51U, 67U);
+    const TensorShape d_shape(51U, 33U);
+
+    Tensor a, b, d0, d1, d2;
+    a.allocator()->init(TensorInfo(a_shape, 1, DataType::F32));
+    b.allocator()->init(TensorInfo(b_shape, 1, DataType::F32));
+    d0.allocator()->init(TensorInfo(d_shape, 1, DataType::F32));
+    d1.allocator()->init(TensorInfo(d_shape, 1, DataType::F32));
+    d2.allocator()->init(TensorInfo(d_shape, 1, DataType::F32));
+
+    // Reference selection from the heuristics, then the tuned one
+    NEGEMM gemm0, gemm1, gemm2;
+    tuner.set_tuning_enabled(false);
+    gemm0.configure(&a, &b, nullptr, &d0, 1.f, 0.f);
+    const std::map<std::string, std::string> entries = read_entries(tuner);
+    tuner.set_tuning_enabled(true);
+    gemm1.configure(&a, &b, nullptr, &d1, 1.f, 0.f);
+
+    // Exactly one entry is recorded for the problem
+    std::vector<std::string> new_keys;
+    for (const auto &entry : read_entries(tuner))
+    {
+        if (entries.find(entry.first) == entries.end())
+        {
+            new_keys.push_back(entry.first);
+        }
+    }
+    ARM_COMPUTE_EXPECT(new_keys.size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tuner.num_entries() == entries.size() + 1, framework::LogLevel::ERRORS);
+
+    if (new_keys.size() == 1)
+    {
+        // Mark the recorded entry with a K block larger than K, which the tuner never measures: tuning again would
+        // overwrite it, while the kernel still runs K as a single block
+        arm_gemm::GemmConfig recorded;
+        ARM_COMPUTE_EXPECT(tuner.find(new_keys[0], recorded), framework::LogLevel::ERRORS);
+        recorded.inner_block_size = 2 * a_shape.x();
+        tuner.add(new_keys[0], recorded);
+
+        // A second configuration of the problem uses the recorded kernel without tuning it again
+        gemm2.configure(&a, &b, nullptr, &d2, 1.f, 0.f);
+        arm_gemm::GemmConfig reused;
+        ARM_COMPUTE_EXPECT(tuner.find(new_keys[0], reused), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(reused.filter == recorded.filter, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(reused.inner_block_size == recorded.inner_block_size, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(tuner.num_entries() == entries.size() + 1, framework::LogLevel::ERRORS);
+    }
+    else
+    {
+        gemm2.configure(&a, &b, nullptr, &d2, 1.f, 0.f);
+    }
+    tuner.set_tuning_enabled(enabled);
+
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    d0.allocator()->allocate();
+    d1.allocator()->allocate();
+    d2.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(a), 0);
+    library->fill_tensor_uniform(Accessor(b), 1);
+
+    gemm0.run();
+    gemm1.run();
+    gemm2.run();
+
+    // The kernels may accumulate in a different order
+    const auto *out0 = reinterpret_cast<const float *>(d0.buffer());
+    const auto *out1 = reinterpret_cast<const float *>(d1.buffer());
+    const auto *out2 = reinterpret_cast<const float *>(d2.buffer());
+    bool        same = true;
+    for (size_t i = 0; i < d_shape.total_size(); ++i)
+    {
+        const float tolerance = 1e-3f * std::max(1.f, std::abs(out0[i]));
+        same = same && std::abs(out0[i] - out1[i]) <= tolerance && std::abs(out0[i] - out2[i]) <= tolerance;
+    }
+    ARM_COMPUTE_EXPECT(same, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // GemmTuner
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,9 +23,11 @@
  */
 #include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/HugePageAllocator.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
 #include "arm_compute/runtime/NEON/functions/NENormalizationLayer.h"
+#include "arm_compute/runtime/PackedOffsetLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "tests/AssetsLibrary.h"
@@ -35,6 +37,8 @@
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
 
+#include <cstring>
+
 namespace arm_compute
 {
 namespace test
@@ -89,6 +93,211 @@ TEST_CASE(BlobMemoryManagerSimpleWithinFunctionLevel, framework::DatasetMode::AL
     ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 0, framework::LogLevel::ERRORS);
 }
 
+/** Test case for @ref HugePageAllocator.
+ *
+ * Run a function whose tensors and memory pool are backed by huge pages, large enough to be mapped, and compare it
+ * with the same function using the default allocator.
+ *
+ * Checks performed in order:
+ * - The tensors backed by the allocator are allocated
+ * - Both runs compute the same output
+ */
+TEST_CASE(HugePageAllocatorWithinFunctionLevel, framework::DatasetMode::ALL)
+{
+    const TensorShape shape(256U, 128U, 24U);
+
+    auto run_function = [&](IAllocator &allocator, bool set_backing_allocator) -> std::vector<float>
+    {
+        auto lifetime_mgr = std::make_shared<BlobLifetimeManager>();
+        auto pool_mgr     = std::make_shared<PoolManager>();
+        auto mm           = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+
+        Tensor src = create_tensor<Tensor>(shape, DataType::F32, 1);
+        Tensor dst = create_tensor<Tensor>(shape, DataType::F32, 1);
+        if (set_backing_allocator)
+        {
+            src.allocator()->set_backing_allocator(&allocator);
+            dst.allocator()->set_backing_allocator(&allocator);
+        }
+
+        NENormalizationLayer norm_layer(mm);
+        norm_layer.configure(&src, &dst, NormalizationLayerInfo(NormType::CROSS_MAP, 3));
+
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+        ARM_COMPUTE_EXPECT(src.allocator()->is_allocated(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.allocator()->is_allocated(), framework::LogLevel::ERRORS);
+
+        mm->populate(allocator, 1 /* num_pools */);
+        arm_compute::test::library->fill_tensor_uniform(Accessor(src), 0);
+        norm_layer.run();
+
+        std::vector<float> result(dst.info()->total_size() / sizeof(float));
+        std::memcpy(result.data(), dst.buffer(), dst.info()->total_size());
+        mm->clear();
+        return result;
+    };
+
+    Allocator         allocator{};
+    HugePageAllocator huge_page_allocator{};
+    const auto        reference = run_function(allocator, false);
+    const auto        result    = run_function(huge_page_allocator, true);
+    ARM_COMPUTE_EXPECT(reference == result, framework::LogLevel::ERRORS);
+}
+
+/** Test case for @ref PackedOffsetLifetimeManager.
+ *
+ * Manage a chain of small and large tensors where each tensor is alive with the previous one only, so that the
+ * large tensors can share their offset while the small ones fit next to them.
+ *
+ * Checks performed in order:
+ * - The blob size reaches the largest total size of the tensors alive at the same time
+ * - The memory manager creates a single pool
+ * - The tensors alive at the same time do not overlap
+ */
+TEST_CASE(PackedOffsetMemoryManagerChain, framework::DatasetMode::ALL)
+{
+    Allocator allocator{};
+    auto      lifetime_mgr = std::make_shared<PackedOffsetLifetimeManager>();
+    auto      pool_mgr     = std::make_shared<PoolManager>();
+    auto      mm           = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+    MemoryGroup group(mm);
+
+    std::vector<Tensor> tensors(4);
+    for (size_t i = 0; i < tensors.size(); ++i)
+    {
+        tensors[i].allocator()->init(TensorInfo(TensorShape(i % 2 == 0 ? 1024U : 4096U), 1, DataType::F32));
+    }
+
+    // Each tensor starts its lifetime before the previous one ends
+    group.manage(&tensors[0]);
+    for (size_t i = 1; i < tensors.size(); ++i)
+    {
+        group.manage(&tensors[i]);
+        tensors[i - 1].allocator()->allocate();
+    }
+    tensors.back().allocator()->allocate();
+
+    const size_t lower_bound = (1024U + 4096U) * sizeof(float);
+    ARM_COMPUTE_EXPECT(lifetime_mgr->lower_bound_size() == lower_bound, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lifetime_mgr->info().size == lower_bound, framework::LogLevel::ERRORS);
+
+    mm->populate(allocator, 1 /* num_pools */);
+    ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 1, framework::LogLevel::ERRORS);
+
+    group.acquire();
+    for (size_t i = 1; i < tensors.size(); ++i)
+    {
+        const uint8_t *prev = tensors[i - 1].buffer();
+        const uint8_t *curr = tensors[i].buffer();
+        const bool     disjoint =
+            prev + tensors[i - 1].info()->total_size() <= curr || curr + tensors[i].info()->total_size() <= prev;
+        ARM_COMPUTE_EXPECT(disjoint, framework::LogLevel::ERRORS);
+    }
+    group.release();
+
+    mm->clear();
+}
+
+/** Test case for the memory usage report of @ref MemoryManagerOnDemand.
+ *
+ * Manage two groups of tensors with a blob lifetime manager and query the sizes before and after populating the pools.
+ *
+ * Checks performed in order:
+ * - The planned size and the per-group sizes are known before any pool is created
+ * - The pools allocate the planned size each
+ * - Clearing the manager frees all the pools
+ */
+TEST_CASE(MemoryUsageReport, framework::DatasetMode::ALL)
+{
+    Allocator   allocator{};
+    auto        lifetime_mgr = std::make_shared<BlobLifetimeManager>();
+    auto        pool_mgr     = std::make_shared<PoolManager>();
+    auto        mm           = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+    MemoryGroup group_a(mm);
+    MemoryGroup group_b(mm);
+
+    std::vector<Tensor> tensors(3);
+    tensors[0].allocator()->init(TensorInfo(TensorShape(1024U), 1, DataType::F32));
+    tensors[1].allocator()->init(TensorInfo(TensorShape(256U), 1, DataType::F32));
+    tensors[2].allocator()->init(TensorInfo(TensorShape(2048U), 1, DataType::F32));
+
+    // Group A: both tensors are alive at the same time
+    group_a.manage(&tensors[0]);
+    group_a.manage(&tensors[1]);
+    tensors[0].allocator()->allocate();
+    tensors[1].allocator()->allocate();
+
+    // Group B: a single larger tensor sharing the first blob
+    group_b.manage(&tensors[2]);
+    tensors[2].allocator()->allocate();
+
+    ARM_COMPUTE_EXPECT(lifetime_mgr->group_size(&group_a) == (1024U + 256U) * sizeof(float),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(lifetime_mgr->group_size(&group_b) == 2048U * sizeof(float), framework::LogLevel::ERRORS);
+
+    const size_t planned = (2048U + 256U) * sizeof(float);
+    ARM_COMPUTE_EXPECT(mm->usage().planned_size == planned, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mm->usage().allocated_size == 0, framework::LogLevel::ERRORS);
+
+    mm->populate(allocator, 2 /* num_pools */);
+    ARM_COMPUTE_EXPECT(mm->usage().allocated_size == 2 * planned, framework::LogLevel::ERRORS);
+
+    mm->clear();
+    ARM_COMPUTE_EXPECT(mm->usage().allocated_size == 0, framework::LogLevel::ERRORS);
+}
+
+/** Test case for @ref MemoryManagerOnDemand::trim.
+ *
+ * Run a function, trim the memory manager between runs and check that the pools are freed and brought back.
+ *
+ * Checks performed in order:
+ * - Trimming frees the pools but keeps them registered
+ * - A run after trimming re-acquires the memory and computes the same output
+ * - Restoring a trimmed manager allocates the planned size again
+ */
+TEST_CASE(TrimAndRestoreBetweenRuns, framework::DatasetMode::ALL)
+{
+    Allocator allocator{};
+    auto      lifetime_mgr = std::make_shared<BlobLifetimeManager>();
+    auto      pool_mgr     = std::make_shared<PoolManager>();
+    auto      mm           = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+
+    Tensor src = create_tensor<Tensor>(TensorShape(27U, 11U, 3U), DataType::F32, 1);
+    Tensor dst = create_tensor<Tensor>(TensorShape(27U, 11U, 3U), DataType::F32, 1);
+
+    NENormalizationLayer norm_layer(mm);
+    norm_layer.configure(&src, &dst, NormalizationLayerInfo(NormType::CROSS_MAP, 3));
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    mm->populate(allocator, 1 /* num_pools */);
+    const size_t planned = mm->usage().planned_size;
+    ARM_COMPUTE_EXPECT(mm->usage().allocated_size == planned, framework::LogLevel::ERRORS);
+
+    arm_compute::test::library->fill_tensor_uniform(Accessor(src), 0);
+    norm_layer.run();
+    std::vector<float> reference(dst.info()->total_size() / sizeof(float));
+    std::memcpy(reference.data(), dst.buffer(), dst.info()->total_size());
+
+    mm->trim();
+    ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mm->usage().allocated_size == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mm->usage().planned_size == planned, framework::LogLevel::ERRORS);
+
+    std::memset(dst.buffer(), 0, dst.info()->total_size());
+    norm_layer.run();
+    std::vector<float> result(dst.info()->total_size() / sizeof(float));
+    std::memcpy(result.data(), dst.buffer(), dst.info()->total_size());
+    ARM_COMPUTE_EXPECT(reference == result, framework::LogLevel::ERRORS);
+
+    mm->trim();
+    mm->restore();
+    ARM_COMPUTE_EXPECT(mm->usage().allocated_size == planned, framework::LogLevel::ERRORS);
+
+    mm->clear();
+}
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 TEST_SUITE_END()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024 Arm Limited.
+ * Copyright (c) 2019-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/runtime/RuntimeContext.h"
 
+#include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/SchedulerFactory.h"
 #include "arm_compute/runtime/Tensor.h"
@@ -61,6 +62,54 @@ TEST_CASE(CpuCapacity, framework::DatasetMode::ALL)
 #endif /* defined(ARM_COMPUTE_OPENMP_SCHEDULER) && !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && \
     (defined(__arm__) || defined(__aarch64__)) && defined(__ANDROID__)*/
 
+namespace
+{
+/** Scheduler running everything on the calling thread and counting the operators it is given */
+class CountingScheduler final : public IScheduler
+{
+public:
+    void set_num_threads(unsigned int) override
+    {
+    }
+    unsigned int num_threads() const override
+    {
+        return 1;
+    }
+    void schedule(ICPPKernel *kernel, const Hints &hints) override
+    {
+        ITensorPack tensors;
+        schedule_op(kernel, hints, kernel->window(), tensors);
+    }
+    void schedule_op(ICPPKernel *kernel, const Hints &, const Window &window, ITensorPack &tensors) override
+    {
+        ++num_scheduled;
+        ThreadInfo info;
+        info.cpu_info = &cpu_info();
+        if(tensors.empty())
+        {
+            kernel->run(window, info);
+        }
+        else
+        {
+            kernel->run_op(tensors, window, info);
+        }
+    }
+
+    unsigned int num_scheduled{ 0 };
+
+protected:
+    void run_workloads(std::vector<Workload> &workloads) override
+    {
+        ThreadInfo info;
+        info.cpu_info = &cpu_info();
+        for(auto &wl : workloads)
+        {
+            wl(info);
+        }
+    }
+};
+} // namespace
+
 TEST_SUITE(RuntimeContext)
 
 TEST_CASE(Scheduler, framework::DatasetMode::ALL)
@@ -106,6 +155,47 @@ TEST_CASE(Scheduler, framework::DatasetMode::ALL)
     act_layer.run();
 }
 
+TEST_CASE(BindScopedScheduler, framework::DatasetMode::ALL)
+{
+    CountingScheduler outer;
+    CountingScheduler inner;
+    IScheduler       *active = &arm_compute::Scheduler::get();
+    {
+        arm_compute::ScopedScheduler outer_scope(&outer);
+        ARM_COMPUTE_EXPECT(&arm_compute::Scheduler::get() == &outer, framework::LogLevel::ERRORS);
+        {
+            arm_compute::ScopedScheduler inner_scope(&inner);
+            ARM_COMPUTE_EXPECT(&arm_compute::Scheduler::get() == &inner, framework::LogLevel::ERRORS);
+        }
+        {
+            // A null scheduler keeps the current binding
+            arm_compute::ScopedScheduler null_scope(nullptr);
+            ARM_COMPUTE_EXPECT(&arm_compute::Scheduler::get() == &outer, framework::LogLevel::ERRORS);
+        }
+        ARM_COMPUTE_EXPECT(&arm_compute::Scheduler::get() == &outer, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(&arm_compute::Scheduler::get() == active, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(FunctionHonoursContextScheduler, framework::DatasetMode::ALL)
+{
+    CountingScheduler scheduler;
+    RuntimeContext    ctx;
+    ctx.set_scheduler(&scheduler);
+
+    NEActivationLayer act_layer(&ctx);
+    Tensor            src = create_tensor<Tensor>(TensorShape(32, 32), DataType::F32, 1);
+    Tensor            dst = create_tensor<Tensor>(TensorShape(32, 32), DataType::F32, 1);
+    act_layer.configure(&src, &dst, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0);
+
+    act_layer.run();
+    ARM_COMPUTE_EXPECT(scheduler.num_scheduled == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(&arm_compute::Scheduler::get() != &scheduler, framework::LogLevel::ERRORS);
+}
+
 #if !defined(BARE_METAL)
 // This test tries scheduling work concurrently from two independent threads
 TEST_CASE(MultipleThreadedScheduller, framework::DatasetMode::ALL)
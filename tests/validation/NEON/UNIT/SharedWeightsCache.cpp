@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/utils/CpuSharedWeightsCache.h"
+
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/reference/GEMM.h"
+#include "tests/validation/Validation.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.001f); /**< Tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+} // namespace
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(SharedWeightsCache)
+
+TEST_CASE(AcquireIsReferenceCounted, framework::DatasetMode::ALL)
+{
+    auto            &cache = cpu::CpuSharedWeightsCache::get();
+    const TensorInfo info(TensorShape(64U), 1, DataType::U8);
+    int              num_transforms = 0;
+    const auto       transform      = [&](ITensor &) { ++num_transforms; };
+
+    const size_t num_entries = cache.num_entries();
+    {
+        auto a = cache.acquire("test_acquire", info, 128, transform);
+        auto b = cache.acquire("test_acquire", info, 128, transform);
+        ARM_COMPUTE_EXPECT(a == b, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(num_transforms == 1, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(cache.num_entries() == num_entries + 1, framework::LogLevel::ERRORS);
+    }
+    // The entry is released with its last reference
+    ARM_COMPUTE_EXPECT(cache.num_entries() == num_entries, framework::LogLevel::ERRORS);
+    auto c = cache.acquire("test_acquire", info, 128, transform);
+    ARM_COMPUTE_EXPECT(num_transforms == 2, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ShareGEMMWeights, framework::DatasetMode::ALL)
+{
+    auto      &cache   = cpu::CpuSharedWeightsCache::get();
+    const bool enabled = cache.is_enabled();
+    cache.set_enabled(true);
+
+    const TensorShape a_shape(64U, 32U);
+    const TensorShape b_shape(48U, 64U);
+    const TensorShape d_shape(48U, 32U);
+
+    Tensor a, b, d0, d1;
+    a.allocator()->init(TensorInfo(a_shape, 1, DataType::F32));
+    b.allocator()->init(TensorInfo(b_shape, 1, DataType::F32));
+    d0.allocator()->init(TensorInfo(d_shape, 1, DataType::F32));
+    d1.allocator()->init(TensorInfo(d_shape, 1, DataType::F32));
+
+    const size_t num_entries = cache.num_entries();
+    auto         gemm0       = std::make_unique<NEGEMM>();
+    auto         gemm1       = std::make_unique<NEGEMM>();
+    gemm0->configure(&a, &b, nullptr, &d0, 1.f, 0.f);
+    gemm1->configure(&a, &b, nullptr, &d1, 1.f, 0.f);
+
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    d0.allocator()->allocate();
+    d1.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(a), 0);
+    library->fill_tensor_uniform(Accessor(b), 1);
+
+    // The weights are pretransposed into the cache when the first function is prepared
+    gemm0->run();
+    ARM_COMPUTE_EXPECT(cache.num_entries() == num_entries + 1, framework::LogLevel::ERRORS);
+
+    // The second function finds them in the cache
+    gemm1->run();
+    ARM_COMPUTE_EXPECT(cache.num_entries() == num_entries + 1, framework::LogLevel::ERRORS);
+
+    // The pretransposed weights outlive the first function as the second one holds the same buffer
+    gemm0.reset();
+    ARM_COMPUTE_EXPECT(cache.num_entries() == num_entries + 1, framework::LogLevel::ERRORS);
+
+    // Compute reference
+    SimpleTensor<float> ref_a{a_shape, DataType::F32};
+    SimpleTensor<float> ref_b{b_shape, DataType::F32};
+    SimpleTensor<float> ref_c{d_shape, DataType::F32};
+    library->fill_tensor_uniform(ref_a, 0);
+    library->fill_tensor_uniform(ref_b, 1);
+    library->fill_tensor_value(ref_c, 0.f);
+    const SimpleTensor<float> ref_d = reference::gemm<float>(ref_a, ref_b, ref_c, 1.f, 0.f);
+
+    validate(Accessor(d0), ref_d, tolerance_f32);
+    validate(Accessor(d1), ref_d, tolerance_f32);
+
+    gemm1.reset();
+    ARM_COMPUTE_EXPECT(cache.num_entries() == num_entries, framework::LogLevel::ERRORS);
+
+    cache.set_enabled(enabled);
+}
+
+TEST_SUITE_END() // SharedWeightsCache
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
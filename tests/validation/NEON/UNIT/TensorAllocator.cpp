@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -256,6 +256,44 @@ TEST_CASE(ImportMemoryMappedFile, framework::DatasetMode::ALL)
     tensor.allocator()->free();
     ARM_COMPUTE_ASSERT(tensor.info()->is_resizable());
 }
+
+TEST_CASE(ImportMemoryMappedFileCopyOnWrite, framework::DatasetMode::ALL)
+{
+    const TensorShape shape     = TensorShape(24U, 16U, 3U);
+    const DataType    data_type = DataType::F32;
+
+    // Create tensor
+    const TensorInfo info(shape, 1, data_type);
+    Tensor           tensor;
+    tensor.allocator()->init(info);
+
+    // Create file
+    const size_t       total_size_in_elems = tensor.info()->tensor_shape().total_size();
+    std::vector<float> file_data(total_size_in_elems, 1.f);
+    std::ofstream      output_file("test_mmap_cow_import.bin", std::ios::binary | std::ios::out);
+    output_file.write(reinterpret_cast<const char *>(file_data.data()), tensor.info()->total_size());
+    output_file.close();
+
+    // Map file privately
+    utils::mmap_io::MMappedFile mmapped_file("test_mmap_cow_import.bin", 0 /** Whole file */, 0, true);
+    ARM_COMPUTE_ASSERT(mmapped_file.is_mapped());
+
+    // Import memory mapped memory and modify it
+    ARM_COMPUTE_ASSERT(bool(tensor.allocator()->import_memory(mmapped_file.data())));
+    auto *typed_ptr = reinterpret_cast<float *>(tensor.buffer());
+    ARM_COMPUTE_EXPECT(typed_ptr[0] == 1.f, framework::LogLevel::ERRORS);
+    typed_ptr[0] = 2.f;
+
+    // Validate that the file has not been modified
+    std::ifstream input_file("test_mmap_cow_import.bin", std::ios::binary | std::ios::in);
+    float         file_value = 0.f;
+    input_file.read(reinterpret_cast<char *>(&file_value), sizeof(float));
+    ARM_COMPUTE_EXPECT(file_value == 1.f, framework::LogLevel::ERRORS);
+
+    // Release resources
+    tensor.allocator()->free();
+    ARM_COMPUTE_ASSERT(tensor.info()->is_resizable());
+}
 #endif // !defined(_WIN64) && !defined(BARE_METAL)
 
 TEST_CASE(AlignedAlloc, framework::DatasetMode::ALL)
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "src/cpu/operators/CpuWeightOnlyQuantizedGemm.h"
+#include "support/Fp8.h"
+#include "tests/Globals.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** Max absolute difference between the weight-only quantized GEMM and a naive dequantize-then-multiply reference */
+float run_woq_gemm(unsigned int k, unsigned int n, unsigned int m, unsigned int group_size, DataType weights_dt, bool has_bias)
+{
+    const bool       int4 = weights_dt == DataType::U8;
+    const TensorInfo src_info(TensorShape(k, m), 1, DataType::F32);
+    const TensorInfo weights_info(TensorShape(int4 ? k / 2 : k, n), 1, weights_dt);
+    const TensorInfo scales_info(TensorShape(n, k / group_size), 1, DataType::F32);
+    const TensorInfo bias_info(TensorShape(n), 1, DataType::F32);
+    TensorInfo       dst_info;
+
+    cpu::CpuWeightOnlyQuantizedGemm gemm;
+    gemm.configure(&src_info, &weights_info, &scales_info, has_bias ? &bias_info : nullptr, &dst_info, group_size);
+
+    Tensor src, weights, scales, bias, dst;
+    src.allocator()->init(src_info);
+    weights.allocator()->init(weights_info);
+    scales.allocator()->init(scales_info);
+    bias.allocator()->init(bias_info);
+    dst.allocator()->init(dst_info);
+    src.allocator()->allocate();
+    weights.allocator()->allocate();
+    scales.allocator()->allocate();
+    bias.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    std::mt19937                          gen(library->seed());
+    std::uniform_real_distribution<float> real_dist(-1.f, 1.f);
+    std::uniform_int_distribution<int>    int_dist(int4 ? -8 : -128, int4 ? 7 : 127);
+
+    auto *ps = reinterpret_cast<float *>(src.buffer());
+    auto *pw = weights.buffer();
+    auto *pq = reinterpret_cast<float *>(scales.buffer());
+    auto *pb = reinterpret_cast<float *>(bias.buffer());
+    auto *pd = reinterpret_cast<const float *>(dst.buffer());
+
+    for(unsigned int i = 0; i < k * m; ++i)
+    {
+        ps[i] = real_dist(gen);
+    }
+    for(unsigned int i = 0; i < n * (k / group_size); ++i)
+    {
+        pq[i] = 0.1f * real_dist(gen);
+    }
+    for(unsigned int i = 0; i < n; ++i)
+    {
+        pb[i] = real_dist(gen);
+    }
+    std::vector<float> w(k * n);
+    for(unsigned int y = 0; y < n; ++y)
+    {
+        for(unsigned int x = 0; x < k; ++x)
+        {
+            const int v  = int_dist(gen);
+            w[y * k + x] = static_cast<float>(v);
+            if(weights_dt == DataType::FP8_E4M3)
+            {
+                // Small values keep the magnitude of the outputs close to the integer cases
+                pw[y * k + x] = fp8::float_to_e4m3(4.f * real_dist(gen));
+                w[y * k + x]  = fp8::e4m3_to_float(pw[y * k + x]);
+            }
+            else if(weights_dt == DataType::FP8_E5M2)
+            {
+                pw[y * k + x] = fp8::float_to_e5m2(4.f * real_dist(gen));
+                w[y * k + x]  = fp8::e5m2_to_float(pw[y * k + x]);
+            }
+            else if(int4)
+            {
+                uint8_t &byte = pw[y * (k / 2) + x / 2];
+                byte          = (x % 2 == 0) ? ((byte & 0xF0) | (v & 0xF)) : ((byte & 0x0F) | ((v & 0xF) << 4));
+            }
+            else
+            {
+                pw[y * k + x] = static_cast<uint8_t>(static_cast<int8_t>(v));
+            }
+        }
+    }
+
+    ITensorPack pack{ { TensorType::ACL_SRC_0, &src }, { TensorType::ACL_SRC_1, &weights }, { TensorType::ACL_SRC_2, &scales }, { TensorType::ACL_SRC_3, has_bias ? &bias : nullptr }, { TensorType::ACL_DST, &dst } };
+    gemm.run(pack);
+
+    float max_diff = 0.f;
+    for(unsigned int i = 0; i < m; ++i)
+    {
+        for(unsigned int j = 0; j < n; ++j)
+        {
+            float expected = has_bias ? pb[j] : 0.f;
+            for(unsigned int x = 0; x < k; ++x)
+            {
+                expected += ps[i * k + x] * w[j * k + x] * pq[(x / group_size) * n + j];
+            }
+            max_diff = std::max(max_diff, std::abs(expected - pd[i * n + j]));
+        }
+    }
+    return max_diff;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(WeightOnlyQuantizedGemm)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               make("SrcInfo", { TensorInfo(TensorShape(64U, 1U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(64U, 1U), 1, DataType::F32),
+                                 TensorInfo(TensorShape(64U, 1U), 1, DataType::S32),    // Unsupported activation type
+                                 TensorInfo(TensorShape(64U, 1U), 1, DataType::F32),    // Packed int4 depth mismatch
+                                 TensorInfo(TensorShape(64U, 1U), 1, DataType::F32),    // Group size does not divide K
+                                 TensorInfo(TensorShape(64U, 1U), 1, DataType::F32),    // Wrong number of scales
+                               }),
+               make("WeightsInfo", { TensorInfo(TensorShape(64U, 10U), 1, DataType::S8),
+                                     TensorInfo(TensorShape(32U, 10U), 1, DataType::U8),
+                                     TensorInfo(TensorShape(64U, 10U), 1, DataType::S8),
+                                     TensorInfo(TensorShape(64U, 10U), 1, DataType::U8),
+                                     TensorInfo(TensorShape(64U, 10U), 1, DataType::S8),
+                                     TensorInfo(TensorShape(64U, 10U), 1, DataType::S8),
+                                   }),
+               make("ScalesInfo", { TensorInfo(TensorShape(10U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(10U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(10U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(10U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(10U, 2U), 1, DataType::F32),
+                                    TensorInfo(TensorShape(10U, 4U), 1, DataType::F32),
+                                  }),
+               make("GroupSize", { 32U, 32U, 32U, 32U, 48U, 32U }),
+               make("Expected", { true, true, false, false, false, false })),
+               src_info, weights_info, scales_info, group_size, expected)
+{
+    const TensorInfo dst_info;
+    const Status     status = cpu::CpuWeightOnlyQuantizedGemm::validate(&src_info, &weights_info, &scales_info, nullptr, &dst_info, group_size);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_SUITE(FP32)
+/** Test case for the in-register dequantization of @ref cpu::CpuWeightOnlyQuantizedGemm.
+ *
+ * Uses output counts that are not a multiple of the output block, several groups per row and a few activation rows.
+ *
+ * Checks performed in order:
+ * - The output matches a naive dequantize-then-multiply computed on the same inputs
+ */
+TEST_CASE(RunInt8, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_woq_gemm(64U, 7U, 1U, 32U, DataType::S8, true) < 1e-3f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_woq_gemm(256U, 33U, 3U, 64U, DataType::S8, false) < 1e-3f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_woq_gemm(128U, 4U, 5U, 128U, DataType::S8, true) < 1e-3f, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RunInt4, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_woq_gemm(64U, 7U, 1U, 16U, DataType::U8, true) < 1e-3f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_woq_gemm(256U, 33U, 3U, 32U, DataType::U8, false) < 1e-3f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_woq_gemm(512U, 1U, 2U, 128U, DataType::U8, true) < 1e-3f, framework::LogLevel::ERRORS);
+}
+
+#ifdef __aarch64__
+TEST_CASE(RunFp8E4M3, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_woq_gemm(64U, 7U, 1U, 32U, DataType::FP8_E4M3, true) < 1e-3f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_woq_gemm(256U, 33U, 3U, 64U, DataType::FP8_E4M3, false) < 1e-3f, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RunFp8E5M2, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(run_woq_gemm(64U, 7U, 1U, 16U, DataType::FP8_E5M2, true) < 1e-3f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_woq_gemm(128U, 4U, 5U, 128U, DataType::FP8_E5M2, false) < 1e-3f, framework::LogLevel::ERRORS);
+}
+#endif // __aarch64__
+TEST_SUITE_END() // FP32
+
+TEST_SUITE_END() // WeightOnlyQuantizedGemm
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
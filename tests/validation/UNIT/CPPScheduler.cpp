@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,11 +27,50 @@
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
 
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 using namespace arm_compute;
 using namespace arm_compute::test;
 
+#if defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL)
+namespace
+{
+std::atomic<bool>        count_allocations{ false };
+std::atomic<std::size_t> num_allocations{ 0 };
+} // namespace
+
+// Count the heap allocations of every thread while count_allocations is set
+void *operator new(std::size_t size)
+{
+    if(count_allocations.load(std::memory_order_relaxed))
+    {
+        ++num_allocations;
+    }
+    void *ptr = std::malloc(size != 0 ? size : 1);
+    if(ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+#endif // defined(ARM_COMPUTE_CPP_SCHEDULER) && !defined(BARE_METAL)
+
 namespace
 {
 class TestException: public std::exception
@@ -64,6 +103,61 @@ public:
     }
 
 };
+
+class SmallWorkloadKernel: public ICPPKernel
+{
+public:
+    SmallWorkloadKernel()
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, 8));
+        configure(window);
+    }
+
+    const char* name() const override
+    {
+        return "SmallWorkloadKernel";
+    }
+
+    size_t get_mws(const CPUInfo &, size_t) const override
+    {
+        return 16;
+    }
+
+    void run(const Window &window, const ThreadInfo &) override
+    {
+        ++num_runs;
+        caller_id = std::this_thread::get_id();
+        num_iterations = window.num_iterations(0);
+    }
+
+    unsigned int    num_runs{ 0 };
+    std::thread::id caller_id{};
+    size_t          num_iterations{ 0 };
+};
+
+class CountingKernel: public ICPPKernel
+{
+public:
+    CountingKernel()
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, 64));
+        configure(window);
+    }
+
+    const char* name() const override
+    {
+        return "CountingKernel";
+    }
+
+    void run(const Window &window, const ThreadInfo &) override
+    {
+        num_iterations += window.num_iterations(0);
+    }
+
+    std::atomic<size_t> num_iterations{ 0 };
+};
 }
 
 TEST_SUITE(UNIT)
@@ -86,6 +180,238 @@ TEST_CASE(RethrowException, framework::DatasetMode::ALL)
     }
     ARM_COMPUTE_EXPECT_FAIL("Expected exception not caught", framework::LogLevel::ERRORS);
 }
+
+TEST_CASE(RethrowExceptionAsync, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    CPPScheduler::Hints hints(0);
+    TestKernel kernel;
+    ITensorPack tensors;
+
+    scheduler.set_num_threads(2);
+    // Submitting must not throw: the exception is only reported when waiting on the handle
+    auto handle = scheduler.schedule_op_async(&kernel, hints, kernel.window(), tensors);
+    try
+    {
+        handle.wait();
+    }
+    catch(const TestException&)
+    {
+        ARM_COMPUTE_EXPECT(handle.is_complete(), framework::LogLevel::ERRORS);
+        return;
+    }
+    ARM_COMPUTE_EXPECT_FAIL("Expected exception not caught", framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(SmallWorkloadRunsInline, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    CPPScheduler::Hints hints(0);
+    SmallWorkloadKernel kernel;
+
+    // The window is smaller than twice the minimum workload size, so it must not be split across the workers
+    scheduler.set_num_threads(4);
+    scheduler.schedule(&kernel, hints);
+    ARM_COMPUTE_EXPECT(kernel.num_runs == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernel.num_iterations == 8, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernel.caller_id == std::this_thread::get_id(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(Statistics, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_threads = 4;
+    constexpr unsigned int num_parts   = 8;
+
+    CPPScheduler scheduler;
+    CPPScheduler::Hints hints(0);
+    CountingKernel kernel;
+    scheduler.set_num_threads(num_threads);
+
+    // Nothing is recorded until the statistics are enabled
+    scheduler.schedule(&kernel, hints);
+    ARM_COMPUTE_EXPECT(!scheduler.statistics_enabled(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(scheduler.statistics().empty(), framework::LogLevel::ERRORS);
+
+    scheduler.set_statistics_enabled(true);
+    scheduler.schedule(&kernel, hints);
+    for(unsigned int i = 0; i < 2; ++i)
+    {
+        // The first part is much longer than the other ones, which makes the runs unbalanced
+        std::vector<IScheduler::Workload> workloads;
+        for(unsigned int p = 0; p < num_parts; ++p)
+        {
+            workloads.emplace_back([p](const ThreadInfo &)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(p == 0 ? 20 : 1));
+            });
+        }
+        scheduler.run_tagged_workloads(workloads, "Statistics");
+    }
+
+    const auto stats = scheduler.statistics();
+    ARM_COMPUTE_EXPECT(stats.size() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.count("CountingKernel") == 1 && stats.at("CountingKernel").num_runs == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(stats.count("Statistics") == 1, framework::LogLevel::ERRORS);
+
+    const IScheduler::KernelStatistics &tagged = stats.at("Statistics");
+    ARM_COMPUTE_EXPECT(tagged.num_runs == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tagged.num_parts.size() == num_threads, framework::LogLevel::ERRORS);
+
+    uint64_t total_parts = 0;
+    uint64_t total_fed   = 0;
+    double   total_busy  = 0.0;
+    for(unsigned int t = 0; t < tagged.num_parts.size(); ++t)
+    {
+        total_parts += tagged.num_parts[t];
+        total_fed += tagged.num_fed_parts[t];
+        total_busy += tagged.busy_time_us[t];
+        ARM_COMPUTE_EXPECT(tagged.wait_time_us[t] >= 0.0, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(total_parts == 2 * num_parts, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(total_fed > 0 && total_fed < total_parts, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(total_busy >= 2 * 27000.0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tagged.total_time_us >= 2 * 20000.0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(tagged.imbalance() > 1.2, framework::LogLevel::ERRORS);
+
+    scheduler.reset_statistics();
+    ARM_COMPUTE_EXPECT(scheduler.statistics().empty(), framework::LogLevel::ERRORS);
+}
+
+#ifndef ARM_COMPUTE_LOGGING_ENABLED
+TEST_CASE(SteadyStateRunDoesNotAllocate, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    CPPScheduler::Hints hints(0);
+    CountingKernel kernel;
+
+    scheduler.set_num_threads(4);
+    scheduler.schedule(&kernel, hints);
+
+    // Once the threads are running, splitting and running a kernel must not touch the heap
+    num_allocations = 0;
+    count_allocations = true;
+    for(unsigned int i = 0; i < 10; ++i)
+    {
+        scheduler.schedule(&kernel, hints);
+    }
+    count_allocations = false;
+
+    ARM_COMPUTE_EXPECT(num_allocations == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(kernel.num_iterations == 11 * 64, framework::LogLevel::ERRORS);
+}
+#endif // ARM_COMPUTE_LOGGING_ENABLED
+
+TEST_CASE(SpinWait, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(2);
+    scheduler.set_spin_wait_duration(100);
+    ARM_COMPUTE_EXPECT(scheduler.spin_wait_duration() == 100, framework::LogLevel::ERRORS);
+
+    // Schedule back to back runs so that the workers pick up new work while spinning
+    std::atomic<unsigned int> counter{ 0 };
+    for(unsigned int i = 0; i < 100; ++i)
+    {
+        std::vector<IScheduler::Workload> workloads(4, [&counter](const ThreadInfo &) { ++counter; });
+        scheduler.run_tagged_workloads(workloads, nullptr);
+    }
+    ARM_COMPUTE_EXPECT(counter == 400, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(HighPriorityPreemptsNormalJob, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_threads      = 4;
+    constexpr unsigned int num_normal_parts = 64;
+    constexpr unsigned int num_high_parts   = 16;
+
+    for(unsigned int num_reserved = 0; num_reserved < 2; ++num_reserved)
+    {
+        CPPScheduler scheduler;
+        scheduler.set_num_threads(num_threads);
+        scheduler.set_num_reserved_threads(num_reserved);
+        ARM_COMPUTE_EXPECT(scheduler.num_reserved_threads() == num_reserved, framework::LogLevel::ERRORS);
+
+        // Normal priority job with long parts, scheduled from another thread
+        std::atomic<bool>         normal_started{ false };
+        std::atomic<unsigned int> normal_counter{ 0 };
+        std::thread               normal_thread([&]()
+        {
+            std::vector<IScheduler::Workload> workloads(num_normal_parts, [&](const ThreadInfo &)
+            {
+                normal_started = true;
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                ++normal_counter;
+            });
+            scheduler.run_tagged_workloads(workloads, nullptr);
+        });
+        while(!normal_started)
+        {
+            std::this_thread::yield();
+        }
+
+        // The high priority parts run between the normal ones, never twice at once under the same thread id
+        std::atomic<unsigned int> high_counter{ 0 };
+        std::atomic<bool>         valid_ids{ true };
+        std::atomic<unsigned int> running[num_threads] = {};
+        std::vector<IScheduler::Workload> workloads(num_high_parts, [&](const ThreadInfo &info)
+        {
+            if(info.thread_id < 0 || info.thread_id >= static_cast<int>(num_threads) || running[info.thread_id]++ != 0)
+            {
+                valid_ids = false;
+                return;
+            }
+            ++high_counter;
+            --running[info.thread_id];
+        });
+        CPPScheduler::set_thread_priority(CPPScheduler::Priority::HIGH);
+        scheduler.run_tagged_workloads(workloads, nullptr);
+        CPPScheduler::set_thread_priority(CPPScheduler::Priority::NORMAL);
+        const unsigned int normal_parts_done = normal_counter;
+        normal_thread.join();
+
+        ARM_COMPUTE_EXPECT(valid_ids, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(high_counter == num_high_parts, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(normal_parts_done < num_normal_parts, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(normal_counter == num_normal_parts, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_CASE(AdaptiveThreads, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_threads = 4;
+    constexpr unsigned int num_parts   = 8;
+    constexpr unsigned int num_runs    = 110;
+
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(num_threads);
+    scheduler.set_adaptive_threads(true);
+    ARM_COMPUTE_EXPECT(scheduler.adaptive_threads(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(scheduler.num_active_threads() == num_threads, framework::LogLevel::ERRORS);
+
+    // Each run takes at least 2ms, so the first epoch (200ms and 64 runs) ends by the 100th run, while the second one
+    // cannot end before the 128th: the controller is left probing one thread less
+    std::atomic<unsigned int> counter{ 0 };
+    std::atomic<bool>         valid_ids{ true };
+    for(unsigned int i = 0; i < num_runs; ++i)
+    {
+        std::vector<IScheduler::Workload> workloads(num_parts, [&](const ThreadInfo &info)
+        {
+            if(info.thread_id < 0 || info.thread_id >= info.num_threads || info.num_threads > static_cast<int>(num_threads))
+            {
+                valid_ids = false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ++counter;
+        });
+        scheduler.run_tagged_workloads(workloads, nullptr);
+    }
+    ARM_COMPUTE_EXPECT(valid_ids, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(counter == num_runs * num_parts, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(scheduler.num_active_threads() == num_threads - 1, framework::LogLevel::ERRORS);
+
+    scheduler.set_adaptive_threads(false);
+    ARM_COMPUTE_EXPECT(scheduler.num_active_threads() == num_threads, framework::LogLevel::ERRORS);
+}
 #endif // defined(ARM_COMPUTE_CPP_SCHEDULER) &&  !defined(BARE_METAL)
 TEST_SUITE_END()
 TEST_SUITE_END()
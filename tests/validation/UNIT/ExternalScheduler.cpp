@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/ExternalScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+
+namespace
+{
+/** Executor starting one thread per task, standing for the thread pool of an application */
+class ThreadPerTaskExecutor : public IExternalExecutor
+{
+public:
+    explicit ThreadPerTaskExecutor(unsigned int concurrency)
+        : _concurrency(concurrency)
+    {
+    }
+
+    unsigned int concurrency() const override
+    {
+        return _concurrency;
+    }
+
+    void run_and_wait(Task task, void *context, unsigned int num_tasks) override
+    {
+        ++calls;
+        std::vector<std::thread> threads;
+        for(unsigned int i = 0; i < num_tasks; ++i)
+        {
+            threads.emplace_back(task, context, i);
+        }
+        for(auto &t : threads)
+        {
+            t.join();
+        }
+    }
+
+    unsigned int calls{ 0 };
+
+private:
+    unsigned int _concurrency;
+};
+
+/** Executor running the tasks one after the other on the calling thread */
+class SerialExecutor : public IExternalExecutor
+{
+public:
+    unsigned int concurrency() const override
+    {
+        return 3;
+    }
+
+    void run_and_wait(Task task, void *context, unsigned int num_tasks) override
+    {
+        for(unsigned int i = 0; i < num_tasks; ++i)
+        {
+            task(context, i);
+        }
+    }
+};
+
+class TestException : public std::exception
+{
+public:
+    const char *what() const noexcept override
+    {
+        return "Expected test exception";
+    }
+};
+
+class ThrowingKernel : public ICPPKernel
+{
+public:
+    ThrowingKernel()
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, 2));
+        configure(window);
+    }
+
+    const char *name() const override
+    {
+        return "ThrowingKernel";
+    }
+
+    void run(const Window &, const ThreadInfo &) override
+    {
+        throw TestException();
+    }
+};
+
+/** Run @p num_workloads workloads and check each runs once, with a thread id that no concurrent workload uses */
+bool run_each_workload_once(IScheduler &scheduler, unsigned int num_workloads)
+{
+    const unsigned int                     num_threads = scheduler.num_threads();
+    std::vector<std::atomic<unsigned int>> counters(num_workloads);
+    std::vector<std::atomic<unsigned int>> busy(num_threads);
+    std::atomic<bool>                      valid_ids{ true };
+    for(auto &c : counters)
+    {
+        c = 0;
+    }
+    for(auto &b : busy)
+    {
+        b = 0;
+    }
+
+    std::vector<IScheduler::Workload> workloads;
+    for(unsigned int i = 0; i < num_workloads; ++i)
+    {
+        workloads.emplace_back([i, num_threads, &counters, &busy, &valid_ids](const ThreadInfo &info)
+        {
+            if(info.thread_id < 0 || static_cast<unsigned int>(info.thread_id) >= num_threads || info.num_threads > static_cast<int>(num_threads) || busy[info.thread_id]++ != 0)
+            {
+                valid_ids = false;
+                return;
+            }
+            volatile unsigned int acc = 0;
+            for(unsigned int k = 0; k < (i % 5) * 1000; ++k)
+            {
+                acc += k;
+            }
+            ++counters[i];
+            --busy[info.thread_id];
+        });
+    }
+
+    scheduler.run_tagged_workloads(workloads, nullptr);
+
+    bool success = valid_ids;
+    for(auto &c : counters)
+    {
+        success = success && c == 1;
+    }
+    return success;
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(ExternalScheduler)
+/** Test case for @ref ExternalScheduler
+ *
+ * Checks performed in order:
+ * - The number of threads defaults to the concurrency of the executor and can be capped
+ * - Every workload runs exactly once, with a thread id below num_threads() not shared with a concurrent workload
+ * - An executor running the tasks serially on the calling thread gives the same results
+ * - A single task skips the executor
+ */
+TEST_CASE(RunEachWorkloadOnce, framework::DatasetMode::ALL)
+{
+    ThreadPerTaskExecutor executor(4);
+    ExternalScheduler     scheduler(&executor);
+    ARM_COMPUTE_EXPECT(scheduler.num_threads() == 4, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_each_workload_once(scheduler, 257), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_each_workload_once(scheduler, 3), framework::LogLevel::ERRORS);
+
+    scheduler.set_num_threads(2);
+    ARM_COMPUTE_EXPECT(scheduler.num_threads() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(run_each_workload_once(scheduler, 64), framework::LogLevel::ERRORS);
+
+    SerialExecutor    serial_executor;
+    ExternalScheduler serial_scheduler(&serial_executor);
+    ARM_COMPUTE_EXPECT(run_each_workload_once(serial_scheduler, 31), framework::LogLevel::ERRORS);
+
+    const unsigned int calls = executor.calls;
+    ARM_COMPUTE_EXPECT(run_each_workload_once(scheduler, 1), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(executor.calls == calls, framework::LogLevel::ERRORS);
+}
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+TEST_CASE(RethrowException, framework::DatasetMode::ALL)
+{
+    ThreadPerTaskExecutor    executor(2);
+    ExternalScheduler        scheduler(&executor);
+    ExternalScheduler::Hints hints(0);
+    ThrowingKernel           kernel;
+
+    try
+    {
+        scheduler.schedule(&kernel, hints);
+    }
+    catch(const TestException &)
+    {
+        return;
+    }
+    ARM_COMPUTE_EXPECT_FAIL("Expected exception not caught", framework::LogLevel::ERRORS);
+}
+#endif // ARM_COMPUTE_EXCEPTIONS_DISABLED
+TEST_SUITE_END() // ExternalScheduler
+TEST_SUITE_END() // UNIT
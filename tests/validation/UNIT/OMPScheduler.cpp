@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Arm Limited.
+ * Copyright (c) 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -73,6 +73,51 @@ public:
 private:
     std::array<bool, num_threads> roll_call{};
 };
+
+/** Kernel counting how many times each of its @p num_iterations iterations runs */
+template <int num_iterations>
+class CountingKernel : public ICPPKernel
+{
+public:
+    CountingKernel()
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, num_iterations));
+        configure(window);
+    }
+
+    const char *name() const override
+    {
+        return "CountingKernel";
+    }
+
+    size_t get_mws(const CPUInfo &platform, size_t thread_count) const override
+    {
+        ARM_COMPUTE_UNUSED(platform, thread_count);
+        return 1;
+    }
+
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+#pragma omp critical
+        {
+            valid_ids = valid_ids && info.thread_id >= 0 && info.thread_id < info.num_threads;
+            for(int x = window.x().start(); x < window.x().end(); ++x)
+            {
+                ++counts[x];
+            }
+        }
+    }
+
+    bool success()
+    {
+        return valid_ids && std::all_of(counts.begin(), counts.end(), [](int c) { return c == 1; });
+    }
+
+private:
+    std::array<int, num_iterations> counts{};
+    bool                            valid_ids{ true };
+};
 } // namespace
 
 TEST_SUITE(UNIT)
@@ -101,6 +146,47 @@ TEST_CASE(NestedParallelRegions, framework::DatasetMode::ALL)
         ARM_COMPUTE_EXPECT(kernel.success(), framework::LogLevel::ERRORS);
     }
 }
+
+TEST_CASE(DynamicStrategy, framework::DatasetMode::ALL)
+{
+    // More windows than threads, picked by the threads as they become idle
+    OMPScheduler        scheduler;
+    OMPScheduler::Hints hints(0, IScheduler::StrategyHint::DYNAMIC, 16);
+    CountingKernel<64>  kernel;
+
+    scheduler.set_num_threads(4);
+    scheduler.schedule(&kernel, hints);
+
+    ARM_COMPUTE_EXPECT(kernel.success(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(NestedPolicies, framework::DatasetMode::ALL)
+{
+    const int max_active_levels = omp_get_max_active_levels();
+    omp_set_max_active_levels(2);
+
+    for(auto policy : { OMPScheduler::NestedPolicy::SERIAL, OMPScheduler::NestedPolicy::TEAM, OMPScheduler::NestedPolicy::TASKLOOP })
+    {
+        for(auto strategy : { IScheduler::StrategyHint::STATIC, IScheduler::StrategyHint::DYNAMIC })
+        {
+            bool success = true;
+#pragma omp parallel num_threads(2) reduction(&& : success)
+            {
+                OMPScheduler        scheduler;
+                OMPScheduler::Hints hints(0, strategy, 8);
+                CountingKernel<32>  kernel;
+
+                scheduler.set_num_threads(2);
+                scheduler.set_nested_policy(policy, 2);
+                scheduler.schedule(&kernel, hints);
+
+                success = kernel.success();
+            }
+            ARM_COMPUTE_EXPECT(success, framework::LogLevel::ERRORS);
+        }
+    }
+    omp_set_max_active_levels(max_active_levels);
+}
 TEST_SUITE_END() // OMPScheduler
 TEST_SUITE_END() // UNIT
 
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/IMemoryPool.h"
+#include "arm_compute/runtime/PoolManager.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Mock memory pool counting the threads using it at the same time */
+class MockMemoryPool : public IMemoryPool
+{
+public:
+    void acquire(MemoryMappings &handles) override
+    {
+        ARM_COMPUTE_UNUSED(handles);
+    }
+    void release(MemoryMappings &handles) override
+    {
+        ARM_COMPUTE_UNUSED(handles);
+    }
+    MappingType mapping_type() const override
+    {
+        return MappingType::BLOBS;
+    }
+    std::unique_ptr<IMemoryPool> duplicate() override
+    {
+        return std::make_unique<MockMemoryPool>();
+    }
+    size_t allocated_size() const override
+    {
+        return 16;
+    }
+    void trim() override
+    {
+    }
+    void restore() override
+    {
+    }
+
+    std::atomic<int> users{0};
+};
+} // namespace
+TEST_SUITE(UNIT)
+TEST_SUITE(PoolManager)
+
+/** Validate that locked pools are not handed out again until they are unlocked */
+TEST_CASE(LockUnlock, framework::DatasetMode::ALL)
+{
+    PoolManager pool_mgr;
+    pool_mgr.register_pool(std::make_unique<MockMemoryPool>());
+    pool_mgr.register_pool(std::make_unique<MockMemoryPool>());
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_mgr.allocated_size() == 32, framework::LogLevel::ERRORS);
+
+    IMemoryPool *pool_a = pool_mgr.lock_pool();
+    IMemoryPool *pool_b = pool_mgr.lock_pool();
+    ARM_COMPUTE_EXPECT(pool_a != nullptr && pool_b != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_a != pool_b, framework::LogLevel::ERRORS);
+
+    // Free pools are handed out last released first
+    pool_mgr.unlock_pool(pool_a);
+    ARM_COMPUTE_EXPECT(pool_mgr.lock_pool() == pool_a, framework::LogLevel::ERRORS);
+    pool_mgr.unlock_pool(pool_a);
+    pool_mgr.unlock_pool(pool_b);
+
+    // Pools can only be released once all of them are free
+    ARM_COMPUTE_EXPECT(pool_mgr.release_pool() != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == 1, framework::LogLevel::ERRORS);
+    IMemoryPool *pool_c = pool_mgr.lock_pool();
+    ARM_COMPUTE_EXPECT(pool_c != nullptr, framework::LogLevel::ERRORS);
+    pool_mgr.unlock_pool(pool_c);
+}
+
+#if !defined(BARE_METAL)
+/** Validate that threads competing for fewer pools than there are threads never share one */
+TEST_CASE(ConcurrentLockUnlock, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int num_pools      = 2;
+    constexpr unsigned int num_threads    = 4;
+    constexpr unsigned int num_iterations = 2000;
+
+    PoolManager pool_mgr;
+    for (unsigned int i = 0; i < num_pools; ++i)
+    {
+        pool_mgr.register_pool(std::make_unique<MockMemoryPool>());
+    }
+
+    std::atomic<bool>        shared{false};
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                for (unsigned int i = 0; i < num_iterations; ++i)
+                {
+                    auto *pool = static_cast<MockMemoryPool *>(pool_mgr.lock_pool());
+                    if (pool->users.fetch_add(1) != 0)
+                    {
+                        shared = true;
+                    }
+                    pool->users.fetch_sub(1);
+                    pool_mgr.unlock_pool(pool);
+                }
+            });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    ARM_COMPUTE_EXPECT(!shared, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(pool_mgr.num_pools() == num_pools, framework::LogLevel::ERRORS);
+    // All the pools are free again
+    ARM_COMPUTE_EXPECT(pool_mgr.release_pool() != nullptr, framework::LogLevel::ERRORS);
+}
+#endif // !defined(BARE_METAL)
+
+TEST_SUITE_END() // PoolManager
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
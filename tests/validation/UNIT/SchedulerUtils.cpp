@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/runtime/SchedulerUtils.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <vector>
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+
+TEST_SUITE(UNIT)
+TEST_SUITE(SchedulerUtils)
+#ifndef BARE_METAL
+TEST_CASE(SplitWeighted, framework::DatasetMode::ALL)
+{
+    // Chunks proportional to the weights
+    const std::vector<unsigned int> boundaries = scheduler_utils::split_weighted(100, { 1.f, 1.f, 0.4f, 0.4f });
+    ARM_COMPUTE_EXPECT(boundaries == std::vector<unsigned int>({ 0, 35, 71, 85, 100 }), framework::LogLevel::ERRORS);
+
+    // Every chunk gets at least one iteration
+    const std::vector<unsigned int> narrow = scheduler_utils::split_weighted(4, { 1.f, 1.f, 0.1f, 0.1f });
+    ARM_COMPUTE_EXPECT(narrow == std::vector<unsigned int>({ 0, 1, 2, 3, 4 }), framework::LogLevel::ERRORS);
+
+    // Uniform weights and too few iterations fall back to the even split
+    ARM_COMPUTE_EXPECT(scheduler_utils::split_weighted(100, { 1.f, 1.f }).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(scheduler_utils::split_weighted(1, { 1.f, 0.5f }).empty(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(NarrowWindow, framework::DatasetMode::ALL)
+{
+    Window window;
+    window.set(0, Window::Dimension(0, 100, 4));
+
+    const Window narrowed = scheduler_utils::narrow_window(window, 0, 3, 10);
+    ARM_COMPUTE_EXPECT(narrowed[0].start() == 12, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(narrowed[0].end() == 40, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(narrowed[0].step() == 4, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(AffinityCores, framework::DatasetMode::ALL)
+{
+    // Two LITTLE cores, then two big physical cores with two SMT siblings each, the big cores sharing an L3 of their own
+    const std::vector<scheduler_utils::CoreTopology> cores{ { 0, 0.5f, 0, 0, 0 }, { 1, 0.5f, 1, 0, 0 }, { 2, 1.f, 2, 1, 2 },
+                                                            { 3, 1.f, 2, 1, 2 }, { 4, 1.f, 4, 1, 2 }, { 5, 1.f, 4, 1, 2 } };
+
+    const auto big = scheduler_utils::affinity_cores(IScheduler::AffinityPolicy::BIG_CORES, cores);
+    ARM_COMPUTE_EXPECT(big == std::vector<int>({ 2, 4, 3, 5 }), framework::LogLevel::ERRORS);
+
+    const auto physical = scheduler_utils::affinity_cores(IScheduler::AffinityPolicy::PHYSICAL_CORES, cores);
+    ARM_COMPUTE_EXPECT(physical == std::vector<int>({ 2, 4, 0, 1 }), framework::LogLevel::ERRORS);
+
+    const auto compact = scheduler_utils::affinity_cores(IScheduler::AffinityPolicy::CLUSTER_COMPACT, cores);
+    ARM_COMPUTE_EXPECT(compact == std::vector<int>({ 2, 4, 3, 5, 0, 1 }), framework::LogLevel::ERRORS);
+
+    const auto spread = scheduler_utils::affinity_cores(IScheduler::AffinityPolicy::SPREAD_L3, cores);
+    ARM_COMPUTE_EXPECT(spread == std::vector<int>({ 2, 0, 4, 1, 3, 5 }), framework::LogLevel::ERRORS);
+}
+#endif // BARE_METAL
+TEST_SUITE_END() // SchedulerUtils
+TEST_SUITE_END() // UNIT
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/Tracer.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <sstream>
+#include <thread>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(UNIT)
+TEST_SUITE(Tracer)
+
+TEST_CASE(RecordScopes, framework::DatasetMode::ALL)
+{
+    Tracer &tracer = Tracer::get();
+    tracer.clear();
+    {
+        const TraceScope outer("test", "outer");
+        tracer.record("test", "instant", Tracer::Phase::INSTANT);
+    }
+
+    const auto events = tracer.events();
+    ARM_COMPUTE_ASSERT(events.size() == 3);
+    ARM_COMPUTE_EXPECT(events[0].phase == Tracer::Phase::BEGIN && events[0].name == "outer", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[1].phase == Tracer::Phase::INSTANT && events[1].name == "instant", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[2].phase == Tracer::Phase::END && events[2].category == "test", framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[0].timestamp_ns <= events[2].timestamp_ns, framework::LogLevel::ERRORS);
+
+    std::stringstream trace;
+    tracer.dump(trace);
+    ARM_COMPUTE_EXPECT(trace.str().find(R"("name":"outer","cat":"test","ph":"B")") != std::string::npos, framework::LogLevel::ERRORS);
+    tracer.clear();
+}
+
+TEST_CASE(DisabledAndWrapAround, framework::DatasetMode::ALL)
+{
+    Tracer &tracer = Tracer::get();
+    tracer.clear();
+
+    // Nothing is recorded while disabled
+    tracer.set_enabled(false);
+    tracer.record("test", "ignored", Tracer::Phase::INSTANT);
+    tracer.set_enabled(true);
+    ARM_COMPUTE_EXPECT(tracer.events().empty(), framework::LogLevel::ERRORS);
+
+    // Only the newest events are kept, whichever thread recorded them
+    const size_t num_events = Tracer::capacity + 10;
+    std::thread  other([&]()
+    {
+        for(size_t i = 0; i < num_events / 2; ++i)
+        {
+            tracer.record("test", "other", Tracer::Phase::INSTANT);
+        }
+    });
+    for(size_t i = 0; i < num_events - num_events / 2; ++i)
+    {
+        tracer.record("test", "main", Tracer::Phase::INSTANT);
+    }
+    other.join();
+    ARM_COMPUTE_EXPECT(tracer.events().size() == Tracer::capacity, framework::LogLevel::ERRORS);
+    tracer.clear();
+}
+
+TEST_SUITE_END() // Tracer
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
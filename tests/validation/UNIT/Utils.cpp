@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 Arm Limited.
+ * Copyright (c) 2017-2018, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "arm_compute/core/utils/TrustedConfigure.h"
 #include "tests/Utils.h"
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
@@ -29,6 +30,7 @@
 #include "utils/TypePrinter.h"
 
 #include <stdexcept>
+#include <thread>
 
 using namespace arm_compute;
 using namespace arm_compute::test;
@@ -84,5 +86,25 @@ DATA_TEST_CASE(Coord2Index, framework::DatasetMode::ALL, zip(zip(framework::data
     ARM_COMPUTE_EXPECT(index == ref_index, framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(TrustedConfigureScope, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(!is_configure_trusted(), framework::LogLevel::ERRORS);
+    {
+        const arm_compute::TrustedConfigureScope trusted{};
+        ARM_COMPUTE_EXPECT(is_configure_trusted(), framework::LogLevel::ERRORS);
+        {
+            const arm_compute::TrustedConfigureScope untrusted(false);
+            ARM_COMPUTE_EXPECT(!is_configure_trusted(), framework::LogLevel::ERRORS);
+        }
+        ARM_COMPUTE_EXPECT(is_configure_trusted(), framework::LogLevel::ERRORS);
+
+        // The scope only applies to the thread which opened it
+        bool trusted_on_other_thread = true;
+        std::thread([&]() { trusted_on_other_thread = is_configure_trusted(); }).join();
+        ARM_COMPUTE_EXPECT(!trusted_on_other_thread, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(!is_configure_trusted(), framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE_END()
 TEST_SUITE_END()
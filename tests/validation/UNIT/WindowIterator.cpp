@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 Arm Limited.
+ * Copyright (c) 2017-2018, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/WindowIterator.h"
 #include "tests/Utils.h"
 #include "tests/framework/Asserts.h"
@@ -134,5 +135,34 @@ window, start, end, expected_row_size, expected)
     ARM_COMPUTE_EXPECT_EQUAL(i, expected.size(), framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(ExecuteWindowLoopDims, framework::DatasetMode::ALL)
+{
+    // Rows of a 4x3x2x2 tensor of U32 with one element of padding at the end of each row
+    const Strides         strides(4, 20, 60, 120);
+    std::vector<uint32_t> buffer(2 * 2 * 3 * 5);
+    const Window          window = create_window(Window::Dimension(0, 1), Window::Dimension(0, 3), Window::Dimension(0, 2), Window::Dimension(0, 2));
+
+    std::vector<size_t> expected_offsets;
+    Iterator            it(4, strides, reinterpret_cast<uint8_t *>(buffer.data()), 0, window);
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        expected_offsets.push_back(it.offset());
+    },
+    it);
+
+    // Once collapsed from Z, only the first 3 dimensions are iterated over and the rows are visited in the same order
+    const Window        collapsed = window.collapse(window, Window::DimZ);
+    std::vector<size_t> offsets;
+    Iterator            collapsed_it(4, strides, reinterpret_cast<uint8_t *>(buffer.data()), 0, collapsed);
+    execute_window_loop_dims<3>(collapsed, [&](const Coordinates &)
+    {
+        offsets.push_back(collapsed_it.offset());
+    },
+    collapsed_it);
+
+    ARM_COMPUTE_EXPECT_EQUAL(expected_offsets.size(), size_t(12), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(offsets == expected_offsets, framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE_END()
 TEST_SUITE_END()
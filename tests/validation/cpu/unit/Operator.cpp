@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/Acl.hpp"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(CPU)
+TEST_SUITE(UNIT)
+TEST_SUITE(Operator)
+
+/** Test case for AclGemm
+ *
+ * Validate that a GEMM operator computes the expected matrix product
+ *
+ * Test Steps:
+ *  - Create a valid context and queue
+ *  - Validate and create a GEMM operator
+ *  - Import the tensors' memory and run the operator twice
+ *  - Check the result against the hand computed one
+ */
+TEST_CASE(SimpleGemm, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Queue queue(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    // a is 2x3, b is 3x2 and d is 2x2 (shapes are given innermost dimension first)
+    acl::TensorDescriptor a_info({3, 2}, acl::DataType::Float32);
+    acl::TensorDescriptor b_info({2, 3}, acl::DataType::Float32);
+    acl::TensorDescriptor d_info({2, 2}, acl::DataType::Float32);
+    const acl::GemmDesc   desc{1.f, 0.f};
+
+    const AclStatus valid = AclGemm(ARM_COMPUTE_VALIDATE_OPERATOR_SUPPORT, ctx.get(), a_info.get(), b_info.get(),
+                                    nullptr, d_info.get(), desc);
+    ARM_COMPUTE_ASSERT(valid == AclSuccess);
+
+    acl::Gemm gemm(ctx, a_info, b_info, nullptr, d_info, desc, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    std::vector<float> a_data{1.f, 2.f, 3.f, 4.f, 5.f, 6.f};
+    std::vector<float> b_data{1.f, 0.f, 0.f, 1.f, 1.f, 1.f};
+    std::vector<float> d_data(4, 0.f);
+
+    acl::Tensor a(ctx, a_info, false, &err);
+    acl::Tensor b(ctx, b_info, false, &err);
+    acl::Tensor d(ctx, d_info, false, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(a.import(a_data.data(), acl::ImportType::Host) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(b.import(b_data.data(), acl::ImportType::Host) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(d.import(d_data.data(), acl::ImportType::Host) == acl::StatusCode::Success);
+
+    acl::TensorPack pack(ctx);
+    err = pack.add({{&a, ACL_SRC_0}, {&b, ACL_SRC_1}, {&d, ACL_DST}});
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    // The second run reuses the weights prepared by the first one
+    for (int i = 0; i < 2; ++i)
+    {
+        err = gemm.run(queue, pack);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        err = queue.finish();
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+        const std::vector<float> expected{4.f, 5.f, 10.f, 11.f};
+        for (size_t e = 0; e < expected.size(); ++e)
+        {
+            ARM_COMPUTE_EXPECT(d_data[e] == expected[e], framework::LogLevel::ERRORS);
+        }
+    }
+}
+
+/** Test case for AclRunOperators
+ *
+ * Validate that a list of operators is run in order
+ *
+ * Test Steps:
+ *  - Create a valid context and queue
+ *  - Create an elementwise addition followed by a bounded ReLU
+ *  - Run both through a single batched call
+ *  - Check the result of the chained operators
+ */
+TEST_CASE(RunOperatorList, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Queue queue(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::TensorDescriptor info({4}, acl::DataType::Float32);
+
+    acl::Elementwise add(ctx, info, info, info, acl::ElementwiseDesc{AclElementwiseAdd, {}}, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Activation relu(ctx, info, info, acl::ActivationDesc{AclBoundedRelu, 6.f, 0.f, false}, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    std::vector<float> src0_data{-4.f, 1.f, 2.f, 5.f};
+    std::vector<float> src1_data{1.f, 1.f, 2.f, 3.f};
+    std::vector<float> tmp_data(4, 0.f);
+    std::vector<float> dst_data(4, 0.f);
+
+    acl::Tensor src0(ctx, info, false, &err);
+    acl::Tensor src1(ctx, info, false, &err);
+    acl::Tensor tmp(ctx, info, false, &err);
+    acl::Tensor dst(ctx, info, false, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(src0.import(src0_data.data(), acl::ImportType::Host) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(src1.import(src1_data.data(), acl::ImportType::Host) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(tmp.import(tmp_data.data(), acl::ImportType::Host) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(dst.import(dst_data.data(), acl::ImportType::Host) == acl::StatusCode::Success);
+
+    acl::TensorPack add_pack(ctx);
+    err = add_pack.add({{&src0, ACL_SRC_0}, {&src1, ACL_SRC_1}, {&tmp, ACL_DST}});
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::TensorPack relu_pack(ctx);
+    err = relu_pack.add({{&tmp, ACL_SRC}, {&dst, ACL_DST}});
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    err = acl::run_operators(queue, {&add, &relu}, {&add_pack, &relu_pack});
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    err = queue.finish();
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    const std::vector<float> expected{0.f, 2.f, 4.f, 6.f};
+    for (size_t e = 0; e < expected.size(); ++e)
+    {
+        ARM_COMPUTE_EXPECT(dst_data[e] == expected[e], framework::LogLevel::ERRORS);
+    }
+
+    // Mismatching lists and invalid entries are rejected before anything runs
+    ARM_COMPUTE_ASSERT(acl::run_operators(queue, {&add, &relu}, {&add_pack}) == acl::StatusCode::InvalidArgument);
+
+    AclOperator   ops[]   = {add.get(), nullptr};
+    AclTensorPack packs[] = {add_pack.get(), relu_pack.get()};
+    ARM_COMPUTE_ASSERT(AclRunOperators(ops, queue.get(), packs, 2) == AclInvalidArgument);
+    ARM_COMPUTE_ASSERT(AclRunOperators(nullptr, queue.get(), packs, 2) == AclInvalidArgument);
+}
+
+/** Test case for asynchronous execution on a CPU queue
+ *
+ * Validate that the operators enqueued on a queue run in submission order and are completed by finish
+ *
+ * Test Steps:
+ *  - Create a valid context and queue
+ *  - Enqueue the same in-place accumulation several times without waiting
+ *  - Finish the queue
+ *  - Check that every accumulation has been applied
+ */
+TEST_CASE(AsynchronousRuns, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Queue queue(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::TensorDescriptor info({16}, acl::DataType::Float32);
+    acl::Elementwise      add(ctx, info, info, info, acl::ElementwiseDesc{AclElementwiseAdd, {}}, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    std::vector<float> acc_data(16, 1.f);
+    std::vector<float> inc_data(16, 2.f);
+
+    acl::Tensor acc(ctx, info, false, &err);
+    acl::Tensor inc(ctx, info, false, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(acc.import(acc_data.data(), acl::ImportType::Host) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(inc.import(inc_data.data(), acl::ImportType::Host) == acl::StatusCode::Success);
+
+    acl::TensorPack pack(ctx);
+    err = pack.add({{&acc, ACL_SRC_0}, {&inc, ACL_SRC_1}, {&acc, ACL_DST}});
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    constexpr int num_runs = 32;
+    for (int i = 0; i < num_runs; ++i)
+    {
+        err = add.run(queue, pack);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    }
+    err = queue.finish();
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    for (const float v : acc_data)
+    {
+        ARM_COMPUTE_EXPECT(v == 1.f + 2.f * num_runs, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END() // Operator
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // CPU
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2019-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -78,7 +78,7 @@ protected:
         TensorShape dst_shape(src_shape[0], crop_size.x, crop_size.y, boxes_shape[1]);
 
         // Create tensors
-        TensorType src       = create_tensor<TensorType>(src_shape, data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType src       = create_tensor<TensorType>(src_shape, data_type, 1, src_quantization_info(data_type), DataLayout::NHWC);
         TensorType boxes     = create_tensor<TensorType>(boxes_shape, DataType::F32);
         TensorType boxes_ind = create_tensor<TensorType>(TensorShape(boxes_shape[1]), DataType::S32);
         TensorType dst       = create_tensor<TensorType>(dst_shape, DataType::F32, 1, QuantizationInfo(), DataLayout::NHWC);
@@ -114,7 +114,7 @@ protected:
                                           float extrapolation_value, bool is_outside_bounds, DataType data_type)
     {
         // Create reference
-        SimpleTensor<T>       src{ src_shape, data_type, 1, QuantizationInfo(), DataLayout::NHWC };
+        SimpleTensor<T>       src{ src_shape, data_type, 1, src_quantization_info(data_type), DataLayout::NHWC };
         SimpleTensor<float>   boxes{ boxes_shape, DataType::F32 };
         SimpleTensor<int32_t> boxes_ind{ TensorShape(boxes_shape[1]), DataType::S32 };
 
@@ -129,6 +129,11 @@ protected:
         return permuted;
     }
 
+    static QuantizationInfo src_quantization_info(DataType data_type)
+    {
+        return is_data_type_quantized_asymmetric(data_type) ? QuantizationInfo(0.5f, 10) : QuantizationInfo();
+    }
+
     constexpr static float out_of_bounds_reach = 2.0f;
 
     TensorType          _target{};
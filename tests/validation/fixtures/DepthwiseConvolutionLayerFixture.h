@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -547,7 +547,7 @@ protected:
     unsigned int  _depth_multiplier{};
 };
 
-template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool in_place = false>
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool in_place = false, bool export_input_to_cl_image = false>
 class DepthwiseConvolutionLayerNativeConfigurableValidationFixture : public DepthwiseConvolutionLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>
 {
 public:
@@ -580,7 +580,7 @@ public:
     void configure_target()
     {
 #if defined(ARM_COMPUTE_OPENCL_ENABLED)
-        if(_export_to_cl_image)
+        if(_export_to_cl_image || export_input_to_cl_image)
         {
             _validate_output &= image2d_from_buffer_supported(CLKernelLibrary::get().get_device());
             _validate_output &= (get_cl_image_pitch_alignment(CLKernelLibrary::get().get_device()) != 0);
@@ -615,7 +615,7 @@ public:
         DWCComputeKernelInfo dwc_info;
         dwc_info.n0                         = _n0;
         dwc_info.m0                         = _conv_info.stride().first == 1 && _dilation.x() == 1 ? 8 : 1;
-        dwc_info.export_input_to_cl_image   = false;
+        dwc_info.export_input_to_cl_image   = export_input_to_cl_image;
         dwc_info.export_weights_to_cl_image = _export_to_cl_image;
 
         const ConvolutionInfo conv_kernel_info
@@ -623,7 +623,15 @@ public:
             _conv_info, _depth_multiplier, _act_info, _dilation
         };
 
-        add_padding_x({ &_src, &_biases, &_target }, _data_layout);
+        if(export_input_to_cl_image)
+        {
+            add_padding_x({ &_src }, _data_layout, true); // Don't add left padding if cl image will be used
+            add_padding_x({ &_biases, &_target }, _data_layout);
+        }
+        else
+        {
+            add_padding_x({ &_src, &_biases, &_target }, _data_layout);
+        }
         add_padding_x({ &_weights }, _data_layout, _export_to_cl_image); // Don't add left padding if cl image will be used
 
         // Create Depthwise Convolution configure function
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -112,7 +112,7 @@ public:
 
         // Skip configurations unsupported by the device.
         _device_supports_export_to_cl_image = image2d_from_buffer_supported(CLKernelLibrary::get().get_device());
-        if(!_device_supports_export_to_cl_image && export_rhs_to_cl_image)
+        if(!_device_supports_export_to_cl_image && (export_rhs_to_cl_image || _export_lhs_to_cl_image))
         {
             ARM_COMPUTE_TEST_INFO("cl_khr_image2d_from_buffer not supported. TEST skipped");
             framework::ARM_COMPUTE_PRINT_INFO();
@@ -178,6 +178,7 @@ protected:
         matmul_info.n0                     = N0;
         matmul_info.k0                     = K0;
         matmul_info.export_rhs_to_cl_image = export_rhs_to_cl_image;
+        matmul_info.export_lhs_to_cl_image = _export_lhs_to_cl_image;
 
         bool is_quantized = is_data_type_quantized(data_type);
 
@@ -357,6 +358,7 @@ protected:
     SimpleTensor<T> _reference{};
     bool            _enable_bias{ false };
     bool            _device_supports_export_to_cl_image{ true };
+    bool            _export_lhs_to_cl_image{ false };
     bool            _device_supports_mmul{ true };
     int32_t         _min_bias{ 0 };
     int32_t         _max_bias{ 0 };
@@ -384,6 +386,18 @@ public:
                                                                              true /* enable bias */);
     }
 };
+
+template <typename T, typename KernelType>
+class MatMulKernelExportLhsValidationFixture : public MatMulKernelGenericValidationFixture<T, KernelType>
+{
+public:
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape output_shape, bool pretranspose_a, bool pretranspose_b, int M0, int N0, int K0, bool export_rhs_to_cl_image, DataType data_type)
+    {
+        this->_export_lhs_to_cl_image = true;
+        MatMulKernelGenericValidationFixture<T, KernelType>::setup(shape_a, shape_b, output_shape, pretranspose_a, pretranspose_b, M0, N0, K0, export_rhs_to_cl_image, data_type,
+                                                                   false /* enable bias */);
+    }
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
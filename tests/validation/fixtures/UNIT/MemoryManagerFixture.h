@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -44,11 +44,15 @@ namespace test
 {
 namespace validation
 {
-/** Simple test case to run two fully connected layers using a blob affinity memory manager
+/** Simple test case to run two fully connected layers using a memory manager, of blob affinity by default
  *
  * Runs two fully connected layers back to back
  */
-template <typename TensorType, typename AccessorType, typename AllocatorType, typename FullyConnectedFunction>
+template <typename TensorType,
+          typename AccessorType,
+          typename AllocatorType,
+          typename FullyConnectedFunction,
+          typename LifetimeManagerType = BlobLifetimeManager>
 class BlobMemoryManagerSimpleTestCaseFixture : public framework::Fixture
 {
     using T = float;
@@ -70,7 +74,7 @@ protected:
 
     TensorType compute_target()
     {
-        auto lifetime_mgr = std::make_shared<BlobLifetimeManager>();
+        auto lifetime_mgr = std::make_shared<LifetimeManagerType>();
         auto pool_mgr     = std::make_shared<PoolManager>();
         auto mm           = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -232,6 +232,8 @@ AbsoluteTolerance<uint8_t> tolerance_qasymm8(ActivationLayerInfo::ActivationFunc
         case ActivationLayerInfo::ActivationFunction::HARD_SWISH:
         case ActivationLayerInfo::ActivationFunction::SOFT_RELU:
         case ActivationLayerInfo::ActivationFunction::LEAKY_RELU:
+        case ActivationLayerInfo::ActivationFunction::ELU:
+        case ActivationLayerInfo::ActivationFunction::SWISH:
             return AbsoluteTolerance<uint8_t>(1);
         default:
             return AbsoluteTolerance<uint8_t>(0);
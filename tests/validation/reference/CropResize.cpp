@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020 Arm Limited.
+ * Copyright (c) 2019-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -127,6 +127,10 @@ SimpleTensor<float> crop_image(const SimpleTensor<T> &src, Coordinates start, Co
 
     SimpleTensor<float> out{ out_shape, DataType::F32, 1, QuantizationInfo(), DataLayout::NHWC };
 
+    // Quantized values are cropped dequantized
+    const bool                    is_quantized = is_data_type_quantized_asymmetric(src.data_type());
+    const UniformQuantizationInfo qinfo        = src.quantization_info().uniform();
+
     Window win;
     win.use_tensor_dimensions(out_shape);
     execute_window_loop(win, [&](const Coordinates & id)
@@ -144,7 +148,8 @@ SimpleTensor<float> crop_image(const SimpleTensor<T> &src, Coordinates start, Co
         }
         if(!out_of_bounds)
         {
-            *reinterpret_cast<float *>(out(id)) = static_cast<float>(*reinterpret_cast<const T *>(src(offset)));
+            const float value                   = static_cast<float>(*reinterpret_cast<const T *>(src(offset)));
+            *reinterpret_cast<float *>(out(id)) = is_quantized ? (value - qinfo.offset) * qinfo.scale : value;
         }
         else
         {
@@ -193,6 +198,8 @@ template SimpleTensor<float> crop_and_resize(const SimpleTensor<int32_t> &src, c
                                              Coordinates2D crop_size, InterpolationPolicy method, float extrapolation_value);
 template SimpleTensor<float> crop_and_resize(const SimpleTensor<half> &src, const SimpleTensor<float> &boxes, SimpleTensor<int32_t> box_ind,
                                              Coordinates2D crop_size, InterpolationPolicy method, float extrapolation_value);
+template SimpleTensor<float> crop_and_resize(const SimpleTensor<int8_t> &src, const SimpleTensor<float> &boxes, SimpleTensor<int32_t> box_ind,
+                                             Coordinates2D crop_size, InterpolationPolicy method, float extrapolation_value);
 template SimpleTensor<float> crop_and_resize(const SimpleTensor<uint8_t> &src, const SimpleTensor<float> &boxes, SimpleTensor<int32_t> box_ind,
                                              Coordinates2D crop_size, InterpolationPolicy method, float extrapolation_value);
 } // namespace reference
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025 Arm Limited.
+ * Copyright (c) 2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -135,6 +135,8 @@ SimpleTensor<TOut> reorder_layer(const SimpleTensor<TIn> &src, const TensorShape
         Transform_ref<4, 1, sizeof(TOut), sizeof(TIn), TOut, arm_gemm::VLType::None>::Transform(dst, src, transpose ? rows : cols, 0, rows, 0, cols, transpose);
     } else if (interleave_by == 8 && block_by == 1) {
         Transform_ref<8, 1, sizeof(TOut), sizeof(TIn), TOut, arm_gemm::VLType::None>::Transform(dst, src, transpose ? rows : cols, 0, rows, 0, cols, transpose);
+    } else if (interleave_by == 16 && block_by == 1) {
+        Transform_ref<16, 1, sizeof(TOut), sizeof(TIn), TOut, arm_gemm::VLType::None>::Transform(dst, src, transpose ? rows : cols, 0, rows, 0, cols, transpose);
     } else if (interleave_by == 4 && block_by == 4) {
         Transform_ref<4, 4, sizeof(TOut), sizeof(TIn), TOut, arm_gemm::VLType::None>::Transform(dst, src, transpose ? rows : cols, 0, rows, 0, cols, transpose);
     } else if (interleave_by == 8 && block_by == 4) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -207,6 +207,58 @@ TEST_CASE(MultipleExecutionWithConfigure, framework::DatasetMode::ALL)
     };
 }
 
+/** Test case for the performance report of @ref cpu::CpuGemmAssemblyDispatch.
+ *
+ * Run a GEMM with and without reports enabled.
+ *
+ * Checks performed in order:
+ * - The report describes the problem and the kernel on configuration
+ * - The runs are only measured while reports are enabled
+ */
+TEST_CASE(PerformanceReport, framework::DatasetMode::ALL)
+{
+    cpu::CpuGemmAssemblyDispatch gemm;
+    const auto                   lhs_info = TensorInfo(TensorShape(3U, 3U), 1, DataType::F32);
+    const auto                   rhs_info = TensorInfo(TensorShape(4U, 3U), 1, DataType::F32);
+    auto                         dst_info = TensorInfo(TensorShape(4U, 3U), 1, DataType::F32);
+    gemm.configure(&lhs_info, &rhs_info, nullptr, &dst_info, cpu::AsmGemmInfo{});
+    ARM_COMPUTE_ASSERT(gemm.is_configured());
+
+    const cpu::AsmGemmReport configured = gemm.report();
+    ARM_COMPUTE_EXPECT(!configured.kernel_name.empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(configured.macs == 3U * 4U * 3U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(configured.bytes == (9U + 12U + 12U) * sizeof(float), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(configured.runs == 0U, framework::LogLevel::ERRORS);
+
+    auto lhs = create_tensor<Tensor>(lhs_info);
+    auto rhs = create_tensor<Tensor>(rhs_info);
+    auto dst = create_tensor<Tensor>(dst_info);
+    lhs.allocator()->allocate();
+    rhs.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_value(Accessor(lhs), 1.f);
+    library->fill_tensor_value(Accessor(rhs), 2.f);
+
+    ITensorPack run_pack{{TensorType::ACL_SRC_0, &lhs}, {TensorType::ACL_SRC_1, &rhs}, {TensorType::ACL_DST, &dst}};
+    ITensorPack prep_pack{{TensorType::ACL_SRC_1, &rhs}};
+    auto        mg = MemoryGroup{};
+    auto        ws = manage_workspace<Tensor>(gemm.workspace(), mg, run_pack, prep_pack);
+    gemm.prepare(prep_pack);
+
+    cpu::CpuGemmAssemblyDispatch::enable_reports(false);
+    gemm.run(run_pack);
+    ARM_COMPUTE_EXPECT(gemm.report().runs == 0U, framework::LogLevel::ERRORS);
+
+    cpu::CpuGemmAssemblyDispatch::enable_reports(true);
+    gemm.run(run_pack);
+    gemm.run(run_pack);
+    cpu::CpuGemmAssemblyDispatch::enable_reports(false);
+
+    const cpu::AsmGemmReport measured = gemm.report();
+    ARM_COMPUTE_EXPECT(measured.runs == 2U, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(measured.kernel_name == configured.kernel_name, framework::LogLevel::ERRORS);
+}
+
 // *INDENT-OFF*
 // clang-format off
 DATA_TEST_CASE(ValidateAllDataTypes,
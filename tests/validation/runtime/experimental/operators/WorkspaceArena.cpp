@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/experimental/WorkspaceArena.h"
+
+#include "arm_compute/runtime/experimental/operators/CpuGemm.h"
+#include "arm_compute/runtime/experimental/operators/CpuSoftmax.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/core/helpers/MemoryHelpers.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(OPERATORS)
+
+TEST_SUITE(WorkspaceArena)
+/** Test case for @ref arm_compute::experimental::WorkspaceArena.
+ *
+ * Plan the workspace of a GEMM followed by two quantized softmax operators, whose temporary workspaces can share
+ * memory, and run the chain on the arena.
+ *
+ * Checks performed in order:
+ * - The arena is smaller than the sum of the workspaces
+ * - The chain computes the same output as with a workspace allocated per operator
+ */
+TEST_CASE(RunChain, framework::DatasetMode::ALL)
+{
+    const TensorInfo a_info(TensorShape(24U, 9U), 1, DataType::F32);
+    const TensorInfo b_info(TensorShape(16U, 24U), 1, DataType::F32);
+    TensorInfo       gemm_dst_info;
+    const TensorInfo sm_src_info(TensorShape(40U, 7U), 1, DataType::QASYMM8, QuantizationInfo(1.f / 32, 10));
+    TensorInfo       sm_dst_info_0;
+    TensorInfo       sm_dst_info_1;
+
+    experimental::op::CpuGemm    gemm;
+    experimental::op::CpuSoftmax softmax_0;
+    experimental::op::CpuSoftmax softmax_1;
+    gemm.configure(&a_info, &b_info, nullptr, &gemm_dst_info, 1.f, 0.f, GEMMInfo(false, false, true));
+    softmax_0.configure(&sm_src_info, &sm_dst_info_0);
+    softmax_1.configure(&sm_dst_info_0, &sm_dst_info_1);
+
+    size_t workspace_sum = 0;
+    const std::vector<const experimental::IOperator *> operators{&gemm, &softmax_0, &softmax_1};
+    for (const experimental::IOperator *op : operators)
+    {
+        for (const auto &info : op->workspace())
+        {
+            workspace_sum += info.size;
+        }
+    }
+
+    experimental::WorkspaceArena arena;
+    arena.configure(operators);
+    arena.allocate();
+    ARM_COMPUTE_EXPECT(arena.total_size() < workspace_sum, framework::LogLevel::ERRORS);
+
+    auto a       = create_tensor<Tensor>(a_info);
+    auto b       = create_tensor<Tensor>(b_info);
+    auto sm_src  = create_tensor<Tensor>(sm_src_info);
+    auto sm_mid  = create_tensor<Tensor>(sm_dst_info_0);
+    auto sm_dst  = create_tensor<Tensor>(sm_dst_info_1);
+    auto dst     = create_tensor<Tensor>(gemm_dst_info);
+    auto dst_ref = create_tensor<Tensor>(gemm_dst_info);
+    auto sm_ref  = create_tensor<Tensor>(sm_dst_info_1);
+    for (Tensor *t : {&a, &b, &sm_src, &sm_mid, &sm_dst, &dst, &dst_ref, &sm_ref})
+    {
+        t->allocator()->allocate();
+    }
+    library->fill_tensor_uniform(Accessor(a), 0);
+    library->fill_tensor_uniform(Accessor(b), 1);
+    library->fill_tensor_uniform(Accessor(sm_src), 2);
+
+    // Reference: every operator with its own workspace
+    {
+        ITensorPack gemm_pack{{TensorType::ACL_SRC_0, &a}, {TensorType::ACL_SRC_1, &b}, {TensorType::ACL_DST, &dst_ref}};
+        ITensorPack gemm_prep{{TensorType::ACL_SRC_1, &b}};
+        ITensorPack sm_pack_0{{TensorType::ACL_SRC, &sm_src}, {TensorType::ACL_DST, &sm_mid}};
+        ITensorPack sm_pack_1{{TensorType::ACL_SRC, &sm_mid}, {TensorType::ACL_DST, &sm_ref}};
+
+        MemoryGroup mg;
+        auto        ws_gemm = manage_workspace<Tensor>(gemm.workspace(), mg, gemm_pack, gemm_prep);
+        auto        ws_sm_0 = manage_workspace<Tensor>(softmax_0.workspace(), mg, sm_pack_0);
+        auto        ws_sm_1 = manage_workspace<Tensor>(softmax_1.workspace(), mg, sm_pack_1);
+        gemm.prepare(gemm_prep);
+        gemm.run(gemm_pack);
+        softmax_0.run(sm_pack_0);
+        softmax_1.run(sm_pack_1);
+    }
+
+    ITensorPack gemm_pack{{TensorType::ACL_SRC_0, &a}, {TensorType::ACL_SRC_1, &b}, {TensorType::ACL_DST, &dst}};
+    ITensorPack gemm_prep{{TensorType::ACL_SRC_1, &b}};
+    ITensorPack sm_pack_0{{TensorType::ACL_SRC, &sm_src}, {TensorType::ACL_DST, &sm_mid}};
+    ITensorPack sm_pack_1{{TensorType::ACL_SRC, &sm_mid}, {TensorType::ACL_DST, &sm_dst}};
+    arena.add_to_pack(0, gemm_pack);
+    arena.add_to_pack(0, gemm_prep);
+    arena.add_to_pack(1, sm_pack_0);
+    arena.add_to_pack(2, sm_pack_1);
+
+    gemm.prepare(gemm_prep);
+    for (int i = 0; i < 2; ++i)
+    {
+        gemm.run(gemm_pack);
+        softmax_0.run(sm_pack_0);
+        softmax_1.run(sm_pack_1);
+
+        ARM_COMPUTE_EXPECT(std::memcmp(dst.buffer(), dst_ref.buffer(), dst.info()->total_size()) == 0, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(std::memcmp(sm_dst.buffer(), sm_ref.buffer(), sm_dst.info()->total_size()) == 0, framework::LogLevel::ERRORS);
+    }
+}
+TEST_SUITE_END() // WorkspaceArena
+
+TEST_SUITE_END() // OPERATORS
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -109,6 +109,7 @@ struct CommonGraphParams
     std::string                      validation_path{};
     std::string                      tuner_file{};
     std::string                      mlgo_file{};
+    bool                             trusted_configure{false};
     unsigned int                     validation_range_start{0};
     unsigned int                     validation_range_end{std::numeric_limits<unsigned int>::max()};
 };
@@ -150,24 +151,25 @@ public:
     /** Default destructor */
     ~CommonGraphOptions() = default;
 
-    ToggleOption                           *help;             /**< Show help option */
-    SimpleOption<int>                      *threads;          /**< Number of threads option */
-    SimpleOption<int>                      *batches;          /**< Number of batches */
-    EnumOption<arm_compute::graph::Target> *target;           /**< Graph execution target */
-    EnumOption<arm_compute::DataType>      *data_type;        /**< Graph data type */
-    EnumOption<arm_compute::DataLayout>    *data_layout;      /**< Graph data layout */
-    ToggleOption                           *enable_tuner;     /**< Enable tuner */
-    ToggleOption                           *enable_cl_cache;  /**< Enable opencl kernels cache */
-    SimpleOption<arm_compute::CLTunerMode> *tuner_mode;       /**< Tuner mode */
-    ToggleOption                           *fast_math_hint;   /**< Fast math hint */
-    SimpleOption<std::string>              *data_path;        /**< Trainable parameters path */
-    SimpleOption<std::string>              *image;            /**< Image */
-    SimpleOption<std::string>              *labels;           /**< Labels */
-    SimpleOption<std::string>              *validation_file;  /**< Validation file */
-    SimpleOption<std::string>              *validation_path;  /**< Validation data path */
-    SimpleOption<std::string>              *validation_range; /**< Validation range */
-    SimpleOption<std::string>              *tuner_file;       /**< File to load/store the tuner's values from */
-    SimpleOption<std::string>              *mlgo_file;        /**< File to load the MLGO heuristics from */
+    ToggleOption                           *help;              /**< Show help option */
+    SimpleOption<int>                      *threads;           /**< Number of threads option */
+    SimpleOption<int>                      *batches;           /**< Number of batches */
+    EnumOption<arm_compute::graph::Target> *target;            /**< Graph execution target */
+    EnumOption<arm_compute::DataType>      *data_type;         /**< Graph data type */
+    EnumOption<arm_compute::DataLayout>    *data_layout;       /**< Graph data layout */
+    ToggleOption                           *enable_tuner;      /**< Enable tuner */
+    ToggleOption                           *enable_cl_cache;   /**< Enable opencl kernels cache */
+    SimpleOption<arm_compute::CLTunerMode> *tuner_mode;        /**< Tuner mode */
+    ToggleOption                           *fast_math_hint;    /**< Fast math hint */
+    SimpleOption<std::string>              *data_path;         /**< Trainable parameters path */
+    SimpleOption<std::string>              *image;             /**< Image */
+    SimpleOption<std::string>              *labels;            /**< Labels */
+    SimpleOption<std::string>              *validation_file;   /**< Validation file */
+    SimpleOption<std::string>              *validation_path;   /**< Validation data path */
+    SimpleOption<std::string>              *validation_range;  /**< Validation range */
+    SimpleOption<std::string>              *tuner_file;        /**< File to load/store the tuner's values from */
+    SimpleOption<std::string>              *mlgo_file;         /**< File to load the MLGO heuristics from */
+    ToggleOption                           *trusted_configure; /**< Skip the nested validations when configuring */
 };
 
 /** Consumes the common graph options and creates a structure containing any information
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
 #include "arm_compute/runtime/SubTensor.h"
 
 #pragma GCC diagnostic push
@@ -35,6 +36,8 @@
 #pragma GCC diagnostic pop
 #include "utils/Utils.h"
 
+#include <cmath>
+#include <cstring>
 #include <inttypes.h>
 #include <iomanip>
 #include <limits>
@@ -43,6 +46,42 @@ using namespace arm_compute::graph_utils;
 
 namespace
 {
+/** Copies a region of @p width by @p height pixels of @p src starting at @p src_start to @p dst at @p dst_start
+ *
+ * The tensors must have the same layout and the same size along their other dimensions.
+ */
+void copy_region(const arm_compute::ITensor     &src,
+                 arm_compute::ITensor           &dst,
+                 const arm_compute::Coordinates &src_start,
+                 const arm_compute::Coordinates &dst_start,
+                 int                             width,
+                 int                             height)
+{
+    using namespace arm_compute;
+
+    const DataLayout layout = dst.info()->data_layout();
+    const size_t     idx_w  = get_data_layout_dimension_index(layout, DataLayoutDimension::WIDTH);
+    const size_t     idx_h  = get_data_layout_dimension_index(layout, DataLayoutDimension::HEIGHT);
+
+    Window window;
+    window.use_tensor_dimensions(dst.info()->tensor_shape());
+    window.set(idx_w, Window::Dimension(dst_start[0], dst_start[0] + width));
+    window.set(idx_h, Window::Dimension(dst_start[1], dst_start[1] + height));
+
+    // The elements along the first dimension are contiguous in both tensors
+    const size_t row_size = static_cast<size_t>(window.x().end() - window.x().start()) * dst.info()->element_size();
+    window.set(Window::DimX, Window::Dimension(window.x().start(), window.x().start() + 1));
+
+    execute_window_loop(window,
+                        [&](const Coordinates &id)
+                        {
+                            Coordinates src_id = id;
+                            src_id.set(idx_w, id[idx_w] - dst_start[0] + src_start[0]);
+                            src_id.set(idx_h, id[idx_h] - dst_start[1] + src_start[1]);
+                            std::memcpy(dst.ptr_to_element(id), src.ptr_to_element(src_id), row_size);
+                        });
+}
+
 std::pair<arm_compute::TensorShape, arm_compute::PermutationVector>
 compute_permutation_parameters(const arm_compute::TensorShape &shape, arm_compute::DataLayout data_layout)
 {
@@ -782,14 +821,83 @@ bool RandomAccessor::access_tensor(ITensor &tensor)
     return true;
 }
 
-NumPyBinLoader::NumPyBinLoader(std::string filename, DataLayout file_layout)
-    : _already_loaded(false), _filename(std::move(filename)), _file_layout(file_layout)
+NumPyBinLoader::NumPyBinLoader(std::string filename, DataLayout file_layout, bool use_mmap)
+    : _already_loaded(false),
+      _filename(std::move(filename)),
+      _file_layout(file_layout),
+      _use_mmap(use_mmap),
+#if !defined(_WIN64) && !defined(BARE_METAL)
+      _mapped_file(),
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+      _mapped_data(nullptr)
+{
+}
+
+void *NumPyBinLoader::import_memory(const ITensorInfo &info)
 {
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    // Data can only be aliased if it is stored in the file as in the tensor
+    const bool same_layout = (_file_layout == info.data_layout()) || (info.tensor_shape().num_dimensions() <= 2);
+    if (!_use_mmap || !same_layout || !info.padding().empty())
+    {
+        return nullptr;
+    }
+
+    std::ifstream fs(_filename, std::ios::in | std::ios::binary);
+    if (!fs.good())
+    {
+        return nullptr;
+    }
+    npy::header_t header = utils::parse_npy_header(fs);
+    if (!fs.good() || header.fortran_order || header.dtype.str() != utils::get_typestring(info.data_type()))
+    {
+        return nullptr;
+    }
+    const size_t data_offset = static_cast<size_t>(fs.tellg());
+
+    // Correct dimensions (Needs to match TensorShape dimension corrections)
+    std::vector<unsigned long> shape = header.shape;
+    while (shape.size() > info.tensor_shape().num_dimensions() && shape.back() == 1)
+    {
+        shape.pop_back();
+    }
+    if (shape.size() != info.tensor_shape().num_dimensions())
+    {
+        return nullptr;
+    }
+    for (size_t i = 0; i < shape.size(); ++i)
+    {
+        if (shape[i] != info.tensor_shape()[i])
+        {
+            return nullptr;
+        }
+    }
+
+    // Kernels expect the data to be at least aligned to a vector
+    constexpr size_t data_alignment = 16;
+    if (data_offset % data_alignment != 0)
+    {
+        return nullptr;
+    }
+
+    _mapped_file = std::make_unique<arm_compute::utils::mmap_io::MMappedFile>(_filename, 0, 0, true);
+    if (!_mapped_file->is_mapped() || _mapped_file->map_size() < data_offset + info.total_size())
+    {
+        _mapped_file = nullptr;
+        return nullptr;
+    }
+    _mapped_data = _mapped_file->data() + data_offset;
+    return _mapped_data;
+#else  // !defined(_WIN64) && !defined(BARE_METAL)
+    ARM_COMPUTE_UNUSED(info);
+    return nullptr;
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
 }
 
 bool NumPyBinLoader::access_tensor(ITensor &tensor)
 {
-    if (!_already_loaded)
+    // Nothing to load if the tensor aliases the file mapping
+    if (!_already_loaded && (_mapped_data == nullptr || tensor.buffer() != _mapped_data))
     {
         utils::NPYLoader loader;
         loader.open(_filename, _file_layout);
@@ -799,3 +907,148 @@ bool NumPyBinLoader::access_tensor(ITensor &tensor)
     _already_loaded = !_already_loaded;
     return _already_loaded;
 }
+
+SpatialTiler::Axis
+SpatialTiler::compute_axis(unsigned int image, unsigned int tile, unsigned int halo, unsigned int alignment)
+{
+    ARM_COMPUTE_EXIT_ON_MSG(image < tile, "The image is smaller than a tile");
+    ARM_COMPUTE_EXIT_ON_MSG(image % alignment != 0 || tile % alignment != 0,
+                            "The image and tile sizes must be multiples of the largest stride of the graph");
+
+    // Tiles start at multiples of the largest stride, so that they compute the same outputs as the whole image
+    const unsigned int aligned_halo = arm_compute::ceil_to_multiple(halo, alignment);
+    ARM_COMPUTE_EXIT_ON_MSG(image > tile && tile <= 2 * aligned_halo, "The tiles are too small for the graph halo");
+    const unsigned int core = image > tile ? tile - 2 * aligned_halo : image;
+
+    Axis axis{};
+    for (unsigned int start = 0; start < image; start += core)
+    {
+        // The tiles on the borders are kept inside the image and compute more outputs than shared with their neighbour
+        const int origin = std::min(std::max(static_cast<int>(start) - static_cast<int>(aligned_halo), 0),
+                                    static_cast<int>(image - tile));
+        axis.origins.push_back(static_cast<unsigned int>(origin));
+        axis.core_starts.push_back(start);
+        axis.core_ends.push_back(std::min(start + core, image));
+    }
+    return axis;
+}
+
+void SpatialTiler::configure(graph::Graph &g, unsigned int image_width, unsigned int image_height)
+{
+    ARM_COMPUTE_EXIT_ON_MSG(!graph::compute_receptive_field(g, _info), "The graph cannot be run on tiles");
+    ARM_COMPUTE_EXIT_ON_MSG(g.nodes(graph::NodeType::Output).size() != 1, "Only graphs with one output are supported");
+
+    const graph::TensorDescriptor &tile_desc =
+        g.node(g.nodes(graph::NodeType::Input).front())->output(0)->desc();
+    const graph::TensorDescriptor &output_desc =
+        g.node(g.nodes(graph::NodeType::Output).front())->input(0)->desc();
+    const size_t idx_w = get_data_layout_dimension_index(tile_desc.layout, DataLayoutDimension::WIDTH);
+    const size_t idx_h = get_data_layout_dimension_index(tile_desc.layout, DataLayoutDimension::HEIGHT);
+    const size_t out_w = get_data_layout_dimension_index(output_desc.layout, DataLayoutDimension::WIDTH);
+    const size_t out_h = get_data_layout_dimension_index(output_desc.layout, DataLayoutDimension::HEIGHT);
+
+    const auto scaled = [&](unsigned int pixels)
+    { return static_cast<unsigned int>(std::lround(static_cast<float>(pixels) * _info.scale)); };
+    ARM_COMPUTE_EXIT_ON_MSG(output_desc.shape[out_w] != scaled(tile_desc.shape[idx_w]) ||
+                                output_desc.shape[out_h] != scaled(tile_desc.shape[idx_h]),
+                            "The output of a tile must be its input scaled by the graph");
+
+    _x      = compute_axis(image_width, tile_desc.shape[idx_w], _info.halo_x, _info.alignment);
+    _y      = compute_axis(image_height, tile_desc.shape[idx_h], _info.halo_y, _info.alignment);
+    _tile_x = 0;
+    _tile_y = 0;
+
+    TensorShape image_shape = tile_desc.shape;
+    image_shape.set(idx_w, image_width).set(idx_h, image_height);
+    TensorShape output_shape = output_desc.shape;
+    output_shape.set(out_w, scaled(image_width)).set(out_h, scaled(image_height));
+
+    _image.allocator()->init(
+        TensorInfo(image_shape, 1, tile_desc.data_type, tile_desc.quant_info).set_data_layout(tile_desc.layout));
+    _output.allocator()->init(TensorInfo(output_shape, 1, output_desc.data_type, output_desc.quant_info)
+                                  .set_data_layout(output_desc.layout));
+    _image.allocator()->allocate();
+    _output.allocator()->allocate();
+}
+
+arm_compute::Tensor &SpatialTiler::image()
+{
+    return _image;
+}
+
+arm_compute::Tensor &SpatialTiler::output()
+{
+    return _output;
+}
+
+bool SpatialTiler::is_first_tile() const
+{
+    return _tile_x == 0 && _tile_y == 0;
+}
+
+void SpatialTiler::read_tile(ITensor &tile) const
+{
+    const size_t idx_w = get_data_layout_dimension_index(tile.info()->data_layout(), DataLayoutDimension::WIDTH);
+    const size_t idx_h = get_data_layout_dimension_index(tile.info()->data_layout(), DataLayoutDimension::HEIGHT);
+    copy_region(_image, tile, Coordinates(_x.origins[_tile_x], _y.origins[_tile_y]), Coordinates(0, 0),
+                tile.info()->dimension(idx_w), tile.info()->dimension(idx_h));
+}
+
+bool SpatialTiler::write_tile(const ITensor &tile)
+{
+    const auto scaled = [&](unsigned int pixels)
+    { return static_cast<int>(std::lround(static_cast<float>(pixels) * _info.scale)); };
+
+    // Only the outputs of the core of the tile are kept
+    const unsigned int origin_x = _x.origins[_tile_x];
+    const unsigned int origin_y = _y.origins[_tile_y];
+    const int          start_x  = scaled(_x.core_starts[_tile_x]);
+    const int          start_y  = scaled(_y.core_starts[_tile_y]);
+    copy_region(tile, _output, Coordinates(start_x - scaled(origin_x), start_y - scaled(origin_y)),
+                Coordinates(start_x, start_y), scaled(_x.core_ends[_tile_x]) - start_x,
+                scaled(_y.core_ends[_tile_y]) - start_y);
+
+    // Move to the next tile, the first one of the image after the last one
+    if (++_tile_x == _x.origins.size())
+    {
+        _tile_x = 0;
+        if (++_tile_y == _y.origins.size())
+        {
+            _tile_y = 0;
+        }
+    }
+    return is_first_tile();
+}
+
+TiledInputAccessor::TiledInputAccessor(std::shared_ptr<SpatialTiler>           tiler,
+                                       std::unique_ptr<graph::ITensorAccessor> image_accessor)
+    : _tiler(std::move(tiler)), _image_accessor(std::move(image_accessor))
+{
+}
+
+bool TiledInputAccessor::access_tensor(ITensor &tensor)
+{
+    // Load the next image before reading its first tile
+    if (_tiler->is_first_tile() && _image_accessor != nullptr && !_image_accessor->access_tensor(_tiler->image()))
+    {
+        return false;
+    }
+    _tiler->read_tile(tensor);
+    return true;
+}
+
+TiledOutputAccessor::TiledOutputAccessor(std::shared_ptr<SpatialTiler>           tiler,
+                                         std::unique_ptr<graph::ITensorAccessor> output_accessor)
+    : _tiler(std::move(tiler)), _output_accessor(std::move(output_accessor))
+{
+}
+
+bool TiledOutputAccessor::access_tensor(ITensor &tensor)
+{
+    // Keep running the graph on the tiles until the output of the whole image is stitched
+    if (!_tiler->write_tile(tensor))
+    {
+        return true;
+    }
+    return _output_accessor == nullptr || _output_accessor->access_tensor(_tiler->output());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/misc/MMappedFile.h"
 #include "arm_compute/core/utils/misc/Utility.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/ITensorAccessor.h"
@@ -35,6 +36,7 @@
 #include "utils/CommonGraphOptions.h"
 
 #include <array>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
@@ -442,18 +444,131 @@ public:
      *
      * @param[in] filename    Binary file name
      * @param[in] file_layout (Optional) Layout of the numpy tensor data. Defaults to NCHW
+     * @param[in] use_mmap    (Optional) Alias the tensor to a copy-on-write mapping of the file when its data is laid out
+     *                        as the tensor, instead of copying it. Defaults to false
      */
-    NumPyBinLoader(std::string filename, DataLayout file_layout = DataLayout::NCHW);
+    NumPyBinLoader(std::string filename, DataLayout file_layout = DataLayout::NCHW, bool use_mmap = false);
     /** Allows instances to move constructed */
     NumPyBinLoader(NumPyBinLoader &&) = default;
 
     // Inherited methods overriden:
-    bool access_tensor(ITensor &tensor) override;
+    bool  access_tensor(ITensor &tensor) override;
+    void *import_memory(const ITensorInfo &info) override;
 
 private:
     bool              _already_loaded;
     const std::string _filename;
     const DataLayout  _file_layout;
+    const bool        _use_mmap;
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    std::unique_ptr<arm_compute::utils::mmap_io::MMappedFile> _mapped_file;
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+    unsigned char *_mapped_data;
+};
+
+/** Splits an image too large for a graph into overlapping tiles and stitches the outputs of the graph on each tile
+ *
+ * The graph is built for an input tile, the region of the image it reads for each output pixel being given by
+ * graph::compute_receptive_field(). Consecutive tiles overlap by twice the halo of the graph, each of them keeping the
+ * outputs computed at least a halo away from the borders of the tile that are not borders of the image. The stitched
+ * output is therefore the one of the graph on the whole image, while the transition buffers of the graph only hold a
+ * tile.
+ */
+class SpatialTiler
+{
+public:
+    /** Default constructor */
+    SpatialTiler() = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    SpatialTiler(const SpatialTiler &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    SpatialTiler &operator=(const SpatialTiler &) = delete;
+    /** Computes the tiles of the image and allocates the image and the stitched output
+     *
+     * @param[in] g            Graph built for an input tile, with a single input and output
+     * @param[in] image_width  Width of the image. Must not be smaller than the width of a tile
+     * @param[in] image_height Height of the image. Must not be smaller than the height of a tile
+     */
+    void configure(graph::Graph &g, unsigned int image_width, unsigned int image_height);
+    /** Image the tiles are read from */
+    Tensor &image();
+    /** Output stitched from the tiles */
+    Tensor &output();
+    /** Returns true if the current tile is the first one of the image */
+    bool is_first_tile() const;
+    /** Copies the current tile of the image
+     *
+     * @param[out] tile Input tensor of the graph
+     */
+    void read_tile(ITensor &tile) const;
+    /** Copies the outputs kept from the current tile to the stitched output then moves to the next tile
+     *
+     * @param[in] tile Output tensor of the graph
+     *
+     * @return True if the tile was the last one of the image
+     */
+    bool write_tile(const ITensor &tile);
+
+private:
+    /** Tiles along one dimension of the image */
+    struct Axis
+    {
+        std::vector<unsigned int> origins{};     /**< First image pixel read by each tile */
+        std::vector<unsigned int> core_starts{}; /**< First image pixel each tile keeps the outputs of */
+        std::vector<unsigned int> core_ends{};   /**< Image pixel past the last one each tile keeps the outputs of */
+    };
+
+    static Axis compute_axis(unsigned int image, unsigned int tile, unsigned int halo, unsigned int alignment);
+
+    graph::ReceptiveFieldInfo _info{};
+    Axis                      _x{};
+    Axis                      _y{};
+    size_t                    _tile_x{0};
+    size_t                    _tile_y{0};
+    Tensor                    _image{};
+    Tensor                    _output{};
+};
+
+/** Accessor reading the tiles of an image to the input of a graph built for a tile */
+class TiledInputAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] tiler          Tiler of the image
+     * @param[in] image_accessor Accessor loading the whole image before its first tile is read
+     */
+    TiledInputAccessor(std::shared_ptr<SpatialTiler> tiler, std::unique_ptr<graph::ITensorAccessor> image_accessor);
+    /** Allows instances to move constructed */
+    TiledInputAccessor(TiledInputAccessor &&) = default;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    std::shared_ptr<SpatialTiler>           _tiler;
+    std::unique_ptr<graph::ITensorAccessor> _image_accessor;
+};
+
+/** Accessor stitching the output of a graph built for a tile of an image */
+class TiledOutputAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] tiler           Tiler of the image
+     * @param[in] output_accessor Accessor reading the stitched output once the last tile is computed
+     */
+    TiledOutputAccessor(std::shared_ptr<SpatialTiler> tiler, std::unique_ptr<graph::ITensorAccessor> output_accessor);
+    /** Allows instances to move constructed */
+    TiledOutputAccessor(TiledOutputAccessor &&) = default;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    std::shared_ptr<SpatialTiler>           _tiler;
+    std::unique_ptr<graph::ITensorAccessor> _output_accessor;
 };
 
 /** Generates appropriate random accessor
@@ -477,11 +592,14 @@ get_random_accessor(PixelValue lower, PixelValue upper, const std::random_device
  * @param[in] path        Path to the data files
  * @param[in] data_file   Relative path to the data files from path
  * @param[in] file_layout (Optional) Layout of file. Defaults to NCHW
+ * @param[in] use_mmap    (Optional) Alias the weights to a mapping of the file when possible. Defaults to false
  *
  * @return An appropriate tensor accessor
  */
-inline std::unique_ptr<graph::ITensorAccessor>
-get_weights_accessor(const std::string &path, const std::string &data_file, DataLayout file_layout = DataLayout::NCHW)
+inline std::unique_ptr<graph::ITensorAccessor> get_weights_accessor(const std::string &path,
+                                                                    const std::string &data_file,
+                                                                    DataLayout         file_layout = DataLayout::NCHW,
+                                                                    bool               use_mmap    = false)
 {
     if (path.empty())
     {
@@ -489,7 +607,7 @@ get_weights_accessor(const std::string &path, const std::string &data_file, Data
     }
     else
     {
-        return std::make_unique<NumPyBinLoader>(path + data_file, file_layout);
+        return std::make_unique<NumPyBinLoader>(path + data_file, file_layout, use_mmap);
     }
 }
 
@@ -0,0 +1,827 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "utils/TFLiteModel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/utils/misc/MMappedFile.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/TensorDescriptor.h"
+#include "arm_compute/graph/frontend/IStream.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+
+namespace arm_compute
+{
+namespace graph_utils
+{
+using namespace arm_compute::graph;
+
+namespace
+{
+/** Contents of a .tflite file, mapped in memory when possible */
+class TFLiteFile
+{
+public:
+    explicit TFLiteFile(const std::string &filename)
+    {
+#if !defined(_WIN64) && !defined(BARE_METAL)
+        _mapped_file = std::make_unique<utils::mmap_io::MMappedFile>(filename, 0, 0, true);
+        if (_mapped_file->is_mapped())
+        {
+            _data = _mapped_file->data();
+            _size = _mapped_file->map_size();
+            return;
+        }
+        _mapped_file = nullptr;
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+        std::ifstream fs(filename, std::ios::in | std::ios::binary);
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(!fs.good(), "Cannot open TFLite model %s", filename.c_str());
+        _contents.assign(std::istreambuf_iterator<char>(fs), std::istreambuf_iterator<char>());
+        _data = _contents.data();
+        _size = _contents.size();
+    }
+
+    const uint8_t *data() const
+    {
+        return _data;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+private:
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    std::unique_ptr<utils::mmap_io::MMappedFile> _mapped_file{nullptr};
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+    std::vector<uint8_t> _contents{};
+    const uint8_t       *_data{nullptr};
+    size_t               _size{0};
+};
+
+/** Read-only view of a flatbuffer vector */
+class FlatVector
+{
+public:
+    FlatVector() = default;
+    FlatVector(const uint8_t *base, size_t size, size_t pos, size_t element_size) : _base(base), _pos(pos + 4)
+    {
+        ARM_COMPUTE_EXIT_ON_MSG(pos + 4 > size, "Malformed TFLite model");
+        std::memcpy(&_length, base + pos, sizeof(_length));
+        ARM_COMPUTE_EXIT_ON_MSG(_pos + static_cast<uint64_t>(_length) * element_size > size,
+                                 "Malformed TFLite model");
+        _size = size;
+    }
+
+    size_t size() const
+    {
+        return _length;
+    }
+
+    template <typename T>
+    T at(size_t i) const
+    {
+        T value;
+        std::memcpy(&value, _base + _pos + i * sizeof(T), sizeof(T));
+        return value;
+    }
+
+    /** Position of the element @p i in the buffer */
+    size_t position(size_t i, size_t element_size) const
+    {
+        return _pos + i * element_size;
+    }
+
+    const uint8_t *data() const
+    {
+        return _base + _pos;
+    }
+
+    const uint8_t *base() const
+    {
+        return _base;
+    }
+
+    size_t buffer_size() const
+    {
+        return _size;
+    }
+
+private:
+    const uint8_t *_base{nullptr};
+    size_t         _size{0};
+    size_t         _pos{0};
+    uint32_t       _length{0};
+};
+
+/** Read-only view of a flatbuffer table */
+class FlatTable
+{
+public:
+    FlatTable() = default;
+    FlatTable(const uint8_t *base, size_t size, size_t pos) : _base(base), _size(size), _pos(pos)
+    {
+        ARM_COMPUTE_EXIT_ON_MSG(pos + 4 > size, "Malformed TFLite model");
+        const int64_t vtable = static_cast<int64_t>(pos) - read<int32_t>(pos);
+        ARM_COMPUTE_EXIT_ON_MSG(vtable < 0 || static_cast<size_t>(vtable) + 4 > size, "Malformed TFLite model");
+        _vtable      = static_cast<size_t>(vtable);
+        _vtable_size = read<uint16_t>(_vtable);
+        ARM_COMPUTE_EXIT_ON_MSG(_vtable + _vtable_size > size, "Malformed TFLite model");
+    }
+
+    /** Table of the root of the flatbuffer */
+    static FlatTable root(const uint8_t *base, size_t size)
+    {
+        ARM_COMPUTE_EXIT_ON_MSG(size < 8, "Malformed TFLite model");
+        uint32_t offset;
+        std::memcpy(&offset, base, sizeof(offset));
+        return FlatTable(base, size, offset);
+    }
+
+    bool valid() const
+    {
+        return _base != nullptr;
+    }
+
+    bool has(unsigned int id) const
+    {
+        return field(id) != 0;
+    }
+
+    template <typename T>
+    T scalar(unsigned int id, T default_value) const
+    {
+        const size_t offset = field(id);
+        return offset == 0 ? default_value : read<T>(_pos + offset);
+    }
+
+    FlatTable table(unsigned int id) const
+    {
+        const size_t pos = indirect(id);
+        return pos == 0 ? FlatTable() : FlatTable(_base, _size, pos);
+    }
+
+    FlatVector vector(unsigned int id, size_t element_size) const
+    {
+        const size_t pos = indirect(id);
+        return pos == 0 ? FlatVector() : FlatVector(_base, _size, pos, element_size);
+    }
+
+    std::string string(unsigned int id) const
+    {
+        const FlatVector chars = vector(id, 1);
+        return std::string(reinterpret_cast<const char *>(chars.data()), chars.size());
+    }
+
+    /** Table @p i of a vector of tables */
+    static FlatTable table_at(const FlatVector &tables, size_t i)
+    {
+        const size_t pos = tables.position(i, sizeof(uint32_t));
+        return FlatTable(tables.base(), tables.buffer_size(), pos + tables.at<uint32_t>(i));
+    }
+
+private:
+    template <typename T>
+    T read(size_t pos) const
+    {
+        ARM_COMPUTE_EXIT_ON_MSG(pos + sizeof(T) > _size, "Malformed TFLite model");
+        T value;
+        std::memcpy(&value, _base + pos, sizeof(T));
+        return value;
+    }
+
+    size_t field(unsigned int id) const
+    {
+        if (!valid() || 4 + 2 * id + 2 > _vtable_size)
+        {
+            return 0;
+        }
+        return read<uint16_t>(_vtable + 4 + 2 * id);
+    }
+
+    size_t indirect(unsigned int id) const
+    {
+        const size_t offset = field(id);
+        return offset == 0 ? 0 : _pos + offset + read<uint32_t>(_pos + offset);
+    }
+
+    const uint8_t *_base{nullptr};
+    size_t         _size{0};
+    size_t         _pos{0};
+    size_t         _vtable{0};
+    size_t         _vtable_size{0};
+};
+
+// Subset of the TFLite schema used by the importer
+enum TFLiteOperator : int32_t
+{
+    ADD               = 0,
+    AVERAGE_POOL_2D   = 1,
+    CONCATENATION     = 2,
+    CONV_2D           = 3,
+    DEPTHWISE_CONV_2D = 4,
+    FULLY_CONNECTED   = 9,
+    LOGISTIC          = 14,
+    MAX_POOL_2D       = 17,
+    MUL               = 18,
+    RELU              = 19,
+    RELU_N1_TO_1      = 20,
+    RELU6             = 21,
+    RESHAPE           = 22,
+    SOFTMAX           = 25,
+    TANH              = 28,
+    MEAN              = 40,
+    SUB               = 41,
+    SQUEEZE           = 43,
+    HARD_SWISH        = 117,
+};
+
+enum TFLiteActivation : int8_t
+{
+    ACT_NONE         = 0,
+    ACT_RELU         = 1,
+    ACT_RELU_N1_TO_1 = 2,
+    ACT_RELU6        = 3,
+    ACT_TANH         = 4,
+};
+
+enum TFLiteTensorType : int8_t
+{
+    TYPE_FLOAT32 = 0,
+    TYPE_FLOAT16 = 1,
+    TYPE_INT32   = 2,
+    TYPE_UINT8   = 3,
+    TYPE_INT8    = 9,
+};
+
+constexpr int8_t tflite_padding_same = 0;
+
+/** Accessor of a constant tensor aliasing its buffer in the model */
+class TFLiteBufferAccessor final : public ITensorAccessor
+{
+public:
+    TFLiteBufferAccessor(std::shared_ptr<const TFLiteFile> file, const uint8_t *data, size_t size)
+        : _file(std::move(file)), _data(data), _size(size)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        // Nothing to fill if the tensor aliases the model buffer
+        if (tensor.buffer() == _data)
+        {
+            return true;
+        }
+
+        const ITensorInfo &info = *tensor.info();
+        ARM_COMPUTE_EXIT_ON_MSG(info.tensor_shape().total_size() * info.element_size() != _size,
+                                 "TFLite buffer does not match the tensor");
+
+        Window window;
+        window.use_tensor_dimensions(info.tensor_shape());
+        window.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+        const size_t   row_size = info.dimension(0) * info.element_size();
+        const uint8_t *src      = _data;
+        Iterator       it(&tensor, window);
+        execute_window_loop(
+            window,
+            [&](const Coordinates &)
+            {
+                std::memcpy(it.ptr(), src, row_size);
+                src += row_size;
+            },
+            it);
+        return true;
+    }
+
+    void *import_memory(const ITensorInfo &info) override
+    {
+        // Kernels expect the data to be at least aligned to a vector, which the flatbuffer buffers are
+        constexpr uintptr_t data_alignment = 16;
+        if (!info.padding().empty() || info.total_size() != _size ||
+            reinterpret_cast<uintptr_t>(_data) % data_alignment != 0)
+        {
+            return nullptr;
+        }
+        // The model is mapped copy-on-write, so writes to the tensor never reach the file
+        return const_cast<uint8_t *>(_data);
+    }
+
+private:
+    std::shared_ptr<const TFLiteFile> _file;
+    const uint8_t                    *_data;
+    size_t                            _size;
+};
+
+/** Builds the graph of the first subgraph of a TFLite model */
+class TFLiteGraphImporter
+{
+public:
+    TFLiteGraphImporter(std::shared_ptr<const TFLiteFile> file, frontend::IStream &s)
+        : _file(std::move(file)), _s(s), _g(s.graph())
+    {
+        ARM_COMPUTE_EXIT_ON_MSG(_file->size() < 8 || std::memcmp(_file->data() + 4, "TFL3", 4) != 0,
+                                "Not a TFLite model");
+        const FlatTable model = FlatTable::root(_file->data(), _file->size());
+
+        _buffers        = model.vector(4, sizeof(uint32_t));
+        _operator_codes = model.vector(1, sizeof(uint32_t));
+
+        const FlatVector subgraphs = model.vector(2, sizeof(uint32_t));
+        ARM_COMPUTE_EXIT_ON_MSG(subgraphs.size() == 0, "TFLite model without subgraph");
+        _subgraph = FlatTable::table_at(subgraphs, 0);
+        _tensors  = _subgraph.vector(0, sizeof(uint32_t));
+    }
+
+    NodeID import(std::vector<ITensorAccessorUPtr> &input_accessors,
+                  std::vector<ITensorAccessorUPtr> &output_accessors)
+    {
+        const FlatVector inputs = _subgraph.vector(1, sizeof(int32_t));
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            const int32_t       id       = inputs.at<int32_t>(i);
+            ITensorAccessorUPtr accessor = i < input_accessors.size() ? std::move(input_accessors[i]) : nullptr;
+            _nodes[id] = {GraphBuilder::add_input_node(_g, params(id), descriptor(id), std::move(accessor)), 0};
+        }
+
+        const FlatVector operators = _subgraph.vector(3, sizeof(uint32_t));
+        for (size_t i = 0; i < operators.size(); ++i)
+        {
+            add_operator(FlatTable::table_at(operators, i));
+        }
+
+        const FlatVector outputs = _subgraph.vector(2, sizeof(int32_t));
+        ARM_COMPUTE_EXIT_ON_MSG(outputs.size() == 0, "TFLite model without output");
+        for (size_t i = 0; i < outputs.size() && i < output_accessors.size(); ++i)
+        {
+            if (output_accessors[i] != nullptr)
+            {
+                const int32_t id = outputs.at<int32_t>(i);
+                GraphBuilder::add_output_node(_g, params(id), node(id), std::move(output_accessors[i]));
+            }
+        }
+        return node(outputs.at<int32_t>(0)).node_id;
+    }
+
+private:
+    FlatTable tensor(int32_t id) const
+    {
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(id < 0 || static_cast<size_t>(id) >= _tensors.size(),
+                                    "Invalid TFLite tensor %d", id);
+        return FlatTable::table_at(_tensors, id);
+    }
+
+    NodeParams params(int32_t id) const
+    {
+        return {tensor(id).string(3), _s.hints().target_hint};
+    }
+
+    /** Shape of a TFLite tensor, the innermost TFLite dimension being the first one of the Compute Library shape */
+    std::vector<int32_t> tflite_shape(int32_t id) const
+    {
+        const FlatVector     dims = tensor(id).vector(0, sizeof(int32_t));
+        std::vector<int32_t> shape(dims.size());
+        for (size_t i = 0; i < dims.size(); ++i)
+        {
+            shape[i] = dims.at<int32_t>(i);
+        }
+        return shape;
+    }
+
+    TensorShape shape(int32_t id) const
+    {
+        const std::vector<int32_t> dims = tflite_shape(id);
+        TensorShape                shape{};
+        shape.set_num_dimensions(0);
+        for (size_t i = 0; i < dims.size(); ++i)
+        {
+            shape.set(i, dims[dims.size() - 1 - i], false);
+        }
+        if (dims.empty())
+        {
+            shape = TensorShape(1U);
+        }
+        return shape;
+    }
+
+    QuantizationInfo quant_info(int32_t id) const
+    {
+        const FlatTable quantization = tensor(id).table(4);
+        if (!quantization.valid())
+        {
+            return QuantizationInfo();
+        }
+        const FlatVector scales      = quantization.vector(2, sizeof(float));
+        const FlatVector zero_points = quantization.vector(3, sizeof(int64_t));
+        if (scales.size() == 0)
+        {
+            return QuantizationInfo();
+        }
+        ARM_COMPUTE_EXIT_ON_MSG(scales.size() > 1, "Per-channel quantized TFLite tensors are not supported");
+        const int64_t zero_point = zero_points.size() > 0 ? zero_points.at<int64_t>(0) : 0;
+        return QuantizationInfo(scales.at<float>(0), static_cast<int32_t>(zero_point));
+    }
+
+    DataType data_type(int32_t id) const
+    {
+        const int8_t type = tensor(id).scalar<int8_t>(1, TYPE_FLOAT32);
+        switch (type)
+        {
+            case TYPE_FLOAT32:
+                return DataType::F32;
+            case TYPE_FLOAT16:
+                return DataType::F16;
+            case TYPE_INT32:
+                return DataType::S32;
+            case TYPE_UINT8:
+                return DataType::QASYMM8;
+            case TYPE_INT8:
+                return DataType::QASYMM8_SIGNED;
+            default:
+                ARM_COMPUTE_EXIT_ON_MSG_VAR(true, "Unsupported TFLite tensor type %d", type);
+                return DataType::UNKNOWN;
+        }
+    }
+
+    TensorDescriptor descriptor(int32_t id) const
+    {
+        return TensorDescriptor(shape(id), data_type(id), quant_info(id), DataLayout::NHWC);
+    }
+
+    /** Accessor of the constant data of a tensor, nullptr if the tensor has none */
+    ITensorAccessorUPtr buffer_accessor(int32_t id) const
+    {
+        const uint32_t buffer_id = tensor(id).scalar<uint32_t>(2, 0);
+        // Buffer 0 is the empty sentinel buffer
+        if (buffer_id == 0 || buffer_id >= _buffers.size())
+        {
+            return nullptr;
+        }
+        const FlatTable buffer = FlatTable::table_at(_buffers, buffer_id);
+        const uint64_t  offset = buffer.scalar<uint64_t>(1, 0);
+        if (offset > 1)
+        {
+            // Data stored after the flatbuffer, for models larger than 2GB
+            const uint64_t size = buffer.scalar<uint64_t>(2, 0);
+            ARM_COMPUTE_EXIT_ON_MSG(offset + size > _file->size(), "Malformed TFLite model");
+            return std::make_unique<TFLiteBufferAccessor>(_file, _file->data() + offset, size);
+        }
+        const FlatVector data = buffer.vector(0, 1);
+        if (data.size() == 0)
+        {
+            return nullptr;
+        }
+        return std::make_unique<TFLiteBufferAccessor>(_file, data.data(), data.size());
+    }
+
+    /** Node producing a tensor, a Const node being added for the constant tensors */
+    NodeIdxPair node(int32_t id)
+    {
+        const auto it = _nodes.find(id);
+        if (it != _nodes.end())
+        {
+            return it->second;
+        }
+        ITensorAccessorUPtr accessor = buffer_accessor(id);
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(accessor == nullptr, "TFLite tensor %d is used before being computed", id);
+        const NodeIdxPair nid = {GraphBuilder::add_const_node(_g, params(id), descriptor(id), std::move(accessor)), 0};
+        _nodes[id]            = nid;
+        return nid;
+    }
+
+    ITensorAccessorUPtr const_accessor(int32_t id) const
+    {
+        if (id < 0)
+        {
+            return nullptr;
+        }
+        ITensorAccessorUPtr accessor = buffer_accessor(id);
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(accessor == nullptr, "TFLite tensor %d must be constant", id);
+        return accessor;
+    }
+
+    /** Appends the fused activation of an operator */
+    NodeIdxPair add_activation(NodeIdxPair input, int8_t activation, int32_t output_id)
+    {
+        ActivationLayerInfo act_info;
+        switch (activation)
+        {
+            case ACT_NONE:
+                return input;
+            case ACT_RELU:
+                act_info = ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU);
+                break;
+            case ACT_RELU_N1_TO_1:
+                act_info = ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 1.f, -1.f);
+                break;
+            case ACT_RELU6:
+                act_info = ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f);
+                break;
+            case ACT_TANH:
+                act_info = ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f);
+                break;
+            default:
+                ARM_COMPUTE_EXIT_ON_MSG_VAR(true, "Unsupported TFLite fused activation %d", activation);
+        }
+        NodeParams act_params = params(output_id);
+        act_params.name += "/Activation";
+        return {GraphBuilder::add_activation_node(_g, act_params, input, act_info, quant_info(output_id)), 0};
+    }
+
+    /** Padding and strides of a TFLite convolution or pooling */
+    PadStrideInfo pad_stride_info(int8_t       padding,
+                                  int32_t      stride_x,
+                                  int32_t      stride_y,
+                                  int32_t      kernel_x,
+                                  int32_t      kernel_y,
+                                  const TensorShape &input_shape) const
+    {
+        ARM_COMPUTE_EXIT_ON_MSG(stride_x <= 0 || stride_y <= 0, "Invalid TFLite strides");
+        if (padding != tflite_padding_same)
+        {
+            return PadStrideInfo(stride_x, stride_y, 0, 0);
+        }
+        const auto same_padding = [](int32_t in, int32_t stride, int32_t kernel)
+        {
+            const int32_t out = (in + stride - 1) / stride;
+            return std::max((out - 1) * stride + kernel - in, 0);
+        };
+        const int32_t pad_x = same_padding(input_shape[1], stride_x, kernel_x);
+        const int32_t pad_y = same_padding(input_shape[2], stride_y, kernel_y);
+        return PadStrideInfo(stride_x, stride_y, pad_x / 2, pad_x - pad_x / 2, pad_y / 2, pad_y - pad_y / 2,
+                             DimensionRoundingType::FLOOR);
+    }
+
+    int32_t builtin_code(uint32_t opcode_index) const
+    {
+        ARM_COMPUTE_EXIT_ON_MSG(opcode_index >= _operator_codes.size(), "Malformed TFLite model");
+        const FlatTable code = FlatTable::table_at(_operator_codes, opcode_index);
+        // Codes over 127 are only in the builtin_code field, older models only have the deprecated one
+        return std::max<int32_t>(code.scalar<int8_t>(0, 0), code.scalar<int32_t>(3, 0));
+    }
+
+    void add_operator(const FlatTable &op)
+    {
+        const int32_t    code    = builtin_code(op.scalar<uint32_t>(0, 0));
+        const FlatVector inputs  = op.vector(1, sizeof(int32_t));
+        const FlatVector outputs = op.vector(2, sizeof(int32_t));
+        const FlatTable  options = op.table(4);
+        ARM_COMPUTE_EXIT_ON_MSG(inputs.size() == 0 || outputs.size() != 1, "Unsupported TFLite operator signature");
+
+        const int32_t in_id  = inputs.at<int32_t>(0);
+        const int32_t out_id = outputs.at<int32_t>(0);
+        const auto    input  = [&](size_t i) { return i < inputs.size() ? inputs.at<int32_t>(i) : -1; };
+
+        const frontend::StreamHints &hints = _s.hints();
+        NodeIdxPair                  result;
+
+        switch (code)
+        {
+            case CONV_2D:
+            {
+                const std::vector<int32_t> w = tflite_shape(input(1)); // [OC, KH, KW, IC]
+                ARM_COMPUTE_EXIT_ON_MSG(w.size() != 4, "Invalid TFLite convolution weights");
+                ARM_COMPUTE_EXIT_ON_MSG(options.scalar<int32_t>(4, 1) != 1 || options.scalar<int32_t>(5, 1) != 1,
+                                        "Dilated TFLite convolutions are not supported");
+                const TensorShape  in_shape   = shape(in_id);
+                const unsigned int num_groups = in_shape[0] / w[3];
+                const NodeIdxPair  src        = node(in_id);
+                const NodeID       nid        = GraphBuilder::add_convolution_node(
+                    _g, params(out_id), src, Size2D(w[2], w[1]), w[0],
+                    pad_stride_info(options.scalar<int8_t>(0, 0), options.scalar<int32_t>(1, 0),
+                                    options.scalar<int32_t>(2, 0), w[2], w[1], in_shape),
+                    num_groups, hints.convolution_method_hint, hints.fast_math_hint, const_accessor(input(1)),
+                    const_accessor(input(2)), quant_info(input(1)), quant_info(out_id));
+                result = add_activation({nid, 0}, options.scalar<int8_t>(3, 0), out_id);
+                break;
+            }
+            case DEPTHWISE_CONV_2D:
+            {
+                const std::vector<int32_t> w = tflite_shape(input(1)); // [1, KH, KW, IC * M]
+                ARM_COMPUTE_EXIT_ON_MSG(w.size() != 4, "Invalid TFLite depthwise convolution weights");
+                ARM_COMPUTE_EXIT_ON_MSG(options.scalar<int32_t>(5, 1) != 1 || options.scalar<int32_t>(6, 1) != 1,
+                                        "Dilated TFLite convolutions are not supported");
+                const TensorShape in_shape = shape(in_id);
+                const NodeIdxPair src      = node(in_id);
+                const NodeID      nid      = GraphBuilder::add_depthwise_convolution_node(
+                    _g, params(out_id), src, Size2D(w[2], w[1]),
+                    pad_stride_info(options.scalar<int8_t>(0, 0), options.scalar<int32_t>(1, 0),
+                                    options.scalar<int32_t>(2, 0), w[2], w[1], in_shape),
+                    w[3] / in_shape[0], hints.depthwise_convolution_method_hint, const_accessor(input(1)),
+                    const_accessor(input(2)), quant_info(input(1)), quant_info(out_id), hints.fast_math_hint);
+                result = add_activation({nid, 0}, options.scalar<int8_t>(4, 0), out_id);
+                break;
+            }
+            case FULLY_CONNECTED:
+            {
+                const std::vector<int32_t> w = tflite_shape(input(1)); // [OC, IC]
+                ARM_COMPUTE_EXIT_ON_MSG(w.size() != 2 || options.scalar<int8_t>(1, 0) != 0,
+                                        "Unsupported TFLite fully connected weights");
+                // TFLite flattens the input to [-1, IC]
+                NodeIdxPair       src      = node(in_id);
+                const TensorShape in_shape = shape(in_id);
+                if (in_shape.num_dimensions() != 2 || static_cast<int32_t>(in_shape[0]) != w[1])
+                {
+                    NodeParams reshape_params = params(out_id);
+                    reshape_params.name += "/Reshape";
+                    src = {GraphBuilder::add_reshape_node(_g, reshape_params, src,
+                                                          TensorShape(w[1], in_shape.total_size() / w[1])),
+                           0};
+                }
+                FullyConnectedLayerInfo fc_info;
+                fc_info.set_weights_trained_layout(DataLayout::NHWC);
+                const NodeID nid = GraphBuilder::add_fully_connected_layer(
+                    _g, params(out_id), src, w[0], const_accessor(input(1)), const_accessor(input(2)), fc_info,
+                    quant_info(input(1)), quant_info(out_id), hints.fast_math_hint);
+                result = add_activation({nid, 0}, options.scalar<int8_t>(0, 0), out_id);
+                break;
+            }
+            case AVERAGE_POOL_2D:
+            case MAX_POOL_2D:
+            {
+                const int32_t     pool_x   = options.scalar<int32_t>(3, 0);
+                const int32_t     pool_y   = options.scalar<int32_t>(4, 0);
+                const TensorShape in_shape = shape(in_id);
+                // TFLite averages over the elements inside the input only
+                const PoolingLayerInfo pool_info(
+                    code == MAX_POOL_2D ? PoolingType::MAX : PoolingType::AVG, Size2D(pool_x, pool_y),
+                    DataLayout::NHWC,
+                    pad_stride_info(options.scalar<int8_t>(0, 0), options.scalar<int32_t>(1, 0),
+                                    options.scalar<int32_t>(2, 0), pool_x, pool_y, in_shape),
+                    true);
+                const NodeID nid = GraphBuilder::add_pooling_node(_g, params(out_id), node(in_id), pool_info);
+                result           = add_activation({nid, 0}, options.scalar<int8_t>(5, 0), out_id);
+                break;
+            }
+            case ADD:
+            case SUB:
+            case MUL:
+            {
+                const EltwiseOperation operation = code == ADD   ? EltwiseOperation::Add
+                                                   : code == SUB ? EltwiseOperation::Sub
+                                                                 : EltwiseOperation::Mul;
+                const NodeIdxPair      src0      = node(in_id);
+                const NodeIdxPair      src1      = node(input(1));
+                const NodeID           nid =
+                    GraphBuilder::add_elementwise_node(_g, params(out_id), src0, src1, operation, quant_info(out_id));
+                result           = add_activation({nid, 0}, options.scalar<int8_t>(0, 0), out_id);
+                break;
+            }
+            case CONCATENATION:
+            {
+                const int32_t rank = static_cast<int32_t>(tflite_shape(in_id).size());
+                int32_t       axis = options.scalar<int32_t>(0, 0);
+                axis               = axis < 0 ? axis + rank : axis;
+                ARM_COMPUTE_EXIT_ON_MSG(axis < 0 || axis >= rank || rank > 4, "Unsupported TFLite concatenation");
+                // Index of the axis in the Compute Library shape, whose NHWC dimensions are C, W, H and N
+                const DataLayoutDimension dims[] = {DataLayoutDimension::CHANNEL, DataLayoutDimension::WIDTH,
+                                                    DataLayoutDimension::HEIGHT, DataLayoutDimension::BATCHES};
+                std::vector<NodeIdxPair>  srcs;
+                for (size_t i = 0; i < inputs.size(); ++i)
+                {
+                    srcs.push_back(node(inputs.at<int32_t>(i)));
+                }
+                const descriptors::ConcatLayerDescriptor desc(dims[rank - 1 - axis], quant_info(out_id));
+                const NodeID nid = GraphBuilder::add_concatenate_node(_g, params(out_id), srcs, desc);
+                result = add_activation({nid, 0}, options.scalar<int8_t>(1, 0), out_id);
+                break;
+            }
+            case MEAN:
+            {
+                // Only the average over the spatial dimensions, as found at the end of classification models
+                ARM_COMPUTE_EXIT_ON_MSG(!is_spatial_mean(in_id, input(1)), "Unsupported TFLite mean");
+                const NodeID nid = GraphBuilder::add_pooling_node(
+                    _g, params(out_id), node(in_id), PoolingLayerInfo(PoolingType::AVG, DataLayout::NHWC));
+                result = {nid, 0};
+                // The pooling keeps the quantization of its input, requantize to the one of the output
+                if (is_data_type_quantized(data_type(out_id)) && quant_info(out_id) != quant_info(in_id))
+                {
+                    NodeParams quant_params = params(out_id);
+                    quant_params.name += "/Requantize";
+                    result = {GraphBuilder::add_quantization_node(_g, quant_params, result, quant_info(out_id),
+                                                                  data_type(out_id)),
+                              0};
+                }
+                if (shape(out_id).num_dimensions() != shape(in_id).num_dimensions())
+                {
+                    NodeParams reshape_params = params(out_id);
+                    reshape_params.name += "/Reshape";
+                    result = {GraphBuilder::add_reshape_node(_g, reshape_params, result, shape(out_id)), 0};
+                }
+                break;
+            }
+            case RESHAPE:
+            case SQUEEZE:
+            {
+                result = {GraphBuilder::add_reshape_node(_g, params(out_id), node(in_id), shape(out_id)), 0};
+                break;
+            }
+            case SOFTMAX:
+            {
+                const float beta = options.scalar<float>(0, 0.f);
+                result           = {GraphBuilder::add_softmax_node(_g, params(out_id), node(in_id), beta), 0};
+                break;
+            }
+            case LOGISTIC:
+            case RELU:
+            case RELU6:
+            case RELU_N1_TO_1:
+            case TANH:
+            case HARD_SWISH:
+            {
+                using ActFunc = ActivationLayerInfo::ActivationFunction;
+                const ActivationLayerInfo act_info =
+                    code == LOGISTIC       ? ActivationLayerInfo(ActFunc::LOGISTIC)
+                    : code == RELU         ? ActivationLayerInfo(ActFunc::RELU)
+                    : code == RELU6        ? ActivationLayerInfo(ActFunc::BOUNDED_RELU, 6.f)
+                    : code == RELU_N1_TO_1 ? ActivationLayerInfo(ActFunc::LU_BOUNDED_RELU, 1.f, -1.f)
+                    : code == TANH         ? ActivationLayerInfo(ActFunc::TANH, 1.f, 1.f)
+                                           : ActivationLayerInfo(ActFunc::HARD_SWISH);
+                result = {GraphBuilder::add_activation_node(_g, params(out_id), node(in_id), act_info,
+                                                            quant_info(out_id)),
+                          0};
+                break;
+            }
+            default:
+                ARM_COMPUTE_EXIT_ON_MSG_VAR(true, "Unsupported TFLite operator %d", code);
+        }
+        _nodes[out_id] = result;
+    }
+
+    /** Checks whether a MEAN reduces the height and width of a 4D tensor */
+    bool is_spatial_mean(int32_t in_id, int32_t axes_id) const
+    {
+        if (axes_id < 0 || tflite_shape(in_id).size() != 4)
+        {
+            return false;
+        }
+        const uint32_t buffer_id = tensor(axes_id).scalar<uint32_t>(2, 0);
+        if (buffer_id == 0 || buffer_id >= _buffers.size() || data_type(axes_id) != DataType::S32)
+        {
+            return false;
+        }
+        const FlatVector data = FlatTable::table_at(_buffers, buffer_id).vector(0, 1);
+        if (data.size() != 2 * sizeof(int32_t))
+        {
+            return false;
+        }
+        int32_t axes[2];
+        std::memcpy(axes, data.data(), sizeof(axes));
+        return std::min(axes[0], axes[1]) == 1 && std::max(axes[0], axes[1]) == 2;
+    }
+
+    std::shared_ptr<const TFLiteFile> _file;
+    frontend::IStream                &_s;
+    Graph                            &_g;
+    FlatTable                         _subgraph{};
+    FlatVector                        _buffers{};
+    FlatVector                        _operator_codes{};
+    FlatVector                        _tensors{};
+    std::map<int32_t, NodeIdxPair>    _nodes{};
+};
+} // namespace
+
+TFLiteModelLayer::TFLiteModelLayer(std::string                      filename,
+                                   std::vector<ITensorAccessorUPtr> input_accessors,
+                                   std::vector<ITensorAccessorUPtr> output_accessors)
+    : _filename(std::move(filename)),
+      _input_accessors(std::move(input_accessors)),
+      _output_accessors(std::move(output_accessors))
+{
+}
+
+NodeID TFLiteModelLayer::create_layer(frontend::IStream &s)
+{
+    TFLiteGraphImporter importer(std::make_shared<const TFLiteFile>(_filename), s);
+    return importer.import(_input_accessors, _output_accessors);
+}
+} // namespace graph_utils
+} // namespace arm_compute
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_UTILS_TFLITEMODEL_H
+#define ACL_UTILS_TFLITEMODEL_H
+
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/graph/frontend/ILayer.h"
+
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph_utils
+{
+/** Layer importing the first subgraph of a TensorFlow Lite model into a stream
+ *
+ * The .tflite flatbuffer is mapped in memory and the nodes of the model are added to the graph with @ref
+ * graph::GraphBuilder, in NHWC. The constant tensors of the model are imported as the memory of their Const nodes
+ * whenever the backend allows it, so the weights go from the page cache to the preparation of the functions without
+ * being copied. The mapping is copy-on-write and stays valid as long as the graph holds the accessors.
+ *
+ * Supported operators: ADD, SUB, MUL, AVERAGE_POOL_2D, MAX_POOL_2D, CONCATENATION, CONV_2D, DEPTHWISE_CONV_2D,
+ * FULLY_CONNECTED, LOGISTIC, RELU, RELU6, RELU_N1_TO_1, TANH, HARD_SWISH, RESHAPE, SQUEEZE, SOFTMAX and MEAN over
+ * the spatial dimensions. Tensors can be F32, F16 or per-tensor quantized QASYMM8/QASYMM8_SIGNED.
+ *
+ * The layer returns the node producing the first output of the model, so that an output layer can be appended to
+ * the stream when no output accessors are given.
+ */
+class TFLiteModelLayer final : public graph::frontend::ILayer
+{
+public:
+    /** Constructor
+     *
+     * @param[in] filename         Path of the .tflite model
+     * @param[in] input_accessors  (Optional) Accessors of the inputs of the model, in the order of the model
+     * @param[in] output_accessors (Optional) Accessors of the outputs of the model, in the order of the model. No
+     *                             output node is added for the outputs without one
+     */
+    TFLiteModelLayer(std::string                           filename,
+                     std::vector<graph::ITensorAccessorUPtr> input_accessors  = {},
+                     std::vector<graph::ITensorAccessorUPtr> output_accessors = {});
+
+    // Inherited methods overridden:
+    graph::NodeID create_layer(graph::frontend::IStream &s) override;
+
+private:
+    std::string                             _filename;
+    std::vector<graph::ITensorAccessorUPtr> _input_accessors;
+    std::vector<graph::ITensorAccessorUPtr> _output_accessors;
+};
+} // namespace graph_utils
+} // namespace arm_compute
+#endif // ACL_UTILS_TFLITEMODEL_H
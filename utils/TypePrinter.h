@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,6 +47,7 @@
 #include "arm_compute/runtime/common/LSTMParams.h"
 #include "arm_compute/runtime/FunctionDescriptors.h"
 #include "arm_compute/runtime/NEON/functions/NEMatMul.h"
+#include "arm_compute/runtime/OperatorDescription.h"
 
 #include "support/Cast.h"
 #include "support/StringSupport.h"
@@ -825,6 +826,12 @@ inline ::std::ostream &operator<<(::std::ostream &os, const DataType &data_type)
         case DataType::F64:
             os << "F64";
             break;
+        case DataType::FP8_E4M3:
+            os << "FP8_E4M3";
+            break;
+        case DataType::FP8_E5M2:
+            os << "FP8_E5M2";
+            break;
         case DataType::SIZET:
             os << "SIZET";
             break;
@@ -2553,6 +2560,10 @@ inline std::string to_string(CLGEMMKernelType val)
         {
             return "Reshaped";
         }
+        case CLGEMMKernelType::RESHAPED_ONLY_RHS_MMUL:
+        {
+            return "Reshaped_Only_RHS_MMUL";
+        }
         default:
         {
             return "Unknown";
@@ -2724,7 +2735,8 @@ inline ::std::ostream &operator<<(::std::ostream &os, const Conv2dInfo &conv_inf
        << "dilation=" << conv_info.dilation << ", "
        << "act_info=" << to_string(conv_info.act_info) << ", "
        << "enable_fast_math=" << conv_info.enable_fast_math << ", "
-       << "num_groups=" << conv_info.num_groups << ","
+       << "num_groups=" << conv_info.num_groups << ", "
+       << "accumulate=" << conv_info.accumulate << ","
        << "}";
     return os;
 }
@@ -3293,7 +3305,8 @@ inline ::std::ostream &operator<<(::std::ostream &os, const arm_compute::MatMulI
     os << "MatMulKernelInfo="
        << "["
        << "adj_lhs=" << matmul_info.adj_lhs() << ", "
-       << "adj_rhs=" << matmul_info.adj_rhs() << "] ";
+       << "adj_rhs=" << matmul_info.adj_rhs() << ", "
+       << "incremental=" << matmul_info.incremental() << "] ";
     return os;
 }
 /** Formatted output of the arm_compute::MatMulInfo type.
@@ -3452,6 +3465,68 @@ inline std::string to_string(const bool &info)
     return info ? "true" : "false";
 }
 
+/** Formatted output of the arm_compute::OperatorDescription type, one node per line indented by depth.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  desc arm_compute::OperatorDescription type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const OperatorDescription &desc)
+{
+    struct Printer
+    {
+        static void print(::std::ostream &os, const OperatorDescription &desc, unsigned int depth)
+        {
+            os << std::string(2 * depth, ' ') << desc.name;
+            if (!desc.method.empty())
+            {
+                os << " method=" << desc.method;
+            }
+            for (const auto &kernel : desc.kernels)
+            {
+                os << " kernel=" << kernel;
+            }
+            if (!desc.gemm_strategy.empty())
+            {
+                os << " gemm_strategy=" << desc.gemm_strategy << " gemm_config=[" << desc.gemm_config << "]";
+            }
+            if (!desc.split_dimension.empty())
+            {
+                os << " split_dimension=" << desc.split_dimension;
+            }
+            if (desc.workspace_bytes != 0)
+            {
+                os << " workspace_bytes=" << desc.workspace_bytes;
+            }
+            if (desc.estimated_cycles != 0)
+            {
+                os << " estimated_cycles=" << desc.estimated_cycles;
+            }
+            os << "\n";
+            for (const auto &child : desc.children)
+            {
+                print(os, child, depth + 1);
+            }
+        }
+    };
+    Printer::print(os, desc, 0);
+    return os;
+}
+
+/** Formatted output of the arm_compute::OperatorDescription type.
+ *
+ * @param[in] desc arm_compute::OperatorDescription type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const OperatorDescription &desc)
+{
+    std::stringstream str;
+    str << desc;
+    return str.str();
+}
+
 } // namespace arm_compute
 
 #endif // ACL_UTILS_TYPEPRINTER_H